@@ -64,6 +64,13 @@ void ZipOutputStream::putNextEntry(const std::string& entryName) {
 }
 
 
+void ZipOutputStream::putCompressedEntry( const std::string& entryName, const std::string& data,
+                                          uint32 crc, uint32 size ) {
+  ozf->putCompressedEntry( ZipCDirEntry( entryName ), data.data(),
+                           static_cast< uint32 >( data.size() ), crc, size ) ;
+}
+
+
 void ZipOutputStream::setComment( const std::string &comment ) {
   ozf->setComment( comment ) ;
 }
@@ -54,6 +54,11 @@ public:
   */
   void putNextEntry(const std::string& entryName);
 
+  /** Writes a complete entry whose data has already been compressed
+      as a raw deflate stream. \see ZipOutputStreambuf::putCompressedEntry */
+  void putCompressedEntry( const std::string& entryName, const std::string& data,
+                           uint32 crc, uint32 size ) ;
+
   /** Sets the global comment for the Zip archive. */
   void setComment( const std::string& comment ) ;
 
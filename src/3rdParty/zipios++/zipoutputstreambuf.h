@@ -49,6 +49,17 @@ public:
       entry. */
   void putNextEntry( const ZipCDirEntry &entry ) ;
 
+  /** Writes a complete entry whose data has already been compressed
+      elsewhere as a raw deflate stream (no zlib header). The current
+      entry, if any, is closed first.
+      @param entry the entry to write.
+      @param data the deflated data.
+      @param compressed_size the number of bytes in data.
+      @param crc the crc32 of the uncompressed data.
+      @param size the size of the uncompressed data. */
+  void putCompressedEntry( const ZipCDirEntry &entry, const char *data,
+                           uint32 compressed_size, uint32 crc, uint32 size ) ;
+
   /** Sets the global comment for the Zip archive. */
   void setComment( const string &comment ) ;
 
@@ -68,6 +79,7 @@ protected:
 
   void setEntryClosedState() ;
   void updateEntryHeaderInfo() ;
+  static int currentDosTime() ;
 
   // Should/could be moved to zipheadio.h ?!
   static void writeCentralDirectory( const vector< ZipCDirEntry > &entries, 
@@ -113,10 +113,12 @@
 #include "DocumentObjectGroup.h"
 #include "DocumentObjectGroupPy.h"
 #include "DocumentObserver.h"
+#include "DocumentPrefetcher.h"
 #include "DocumentPy.h"
 #include "ExpressionParser.h"
 #include "FeatureTest.h"
 #include "FeaturePython.h"
+#include "FeaturePythonPool.h"
 #include "GeoFeature.h"
 #include "GeoFeatureGroupExtension.h"
 #include "ImagePlane.h"
@@ -481,6 +483,7 @@ Document* Application::newDocument(const char * proposedName, const char * propo
     doc->signalDeletedObject.connect(std::bind(&Application::slotDeletedObject, this, sp::_1));
     doc->signalBeforeChangeObject.connect(std::bind(&Application::slotBeforeChangeObject, this, sp::_1, sp::_2));
     doc->signalChangedObject.connect(std::bind(&Application::slotChangedObject, this, sp::_1, sp::_2));
+    doc->signalBulkChanged.connect(std::bind(&Application::slotBulkChanged, this, sp::_1, sp::_2));
     doc->signalRelabelObject.connect(std::bind(&Application::slotRelabelObject, this, sp::_1));
     doc->signalActivatedObject.connect(std::bind(&Application::slotActivatedObject, this, sp::_1));
     doc->signalUndo.connect(std::bind(&Application::slotUndoDocument, this, sp::_1));
@@ -625,6 +628,8 @@ int Application::addPendingDocument(const char *FileName, const char *objName, b
     ret.first->second.emplace_back(objName);
     if(ret.second) {
         _pendingDocs.emplace_back(ret.first->first.c_str());
+        if (_prefetcher)
+            _prefetcher->prefetch(FileName);
         return 1;
     }
     return -1;
@@ -670,6 +675,20 @@ public:
     }
 };
 
+class DocPrefetchGuard {
+public:
+    DocumentPrefetcher prefetcher;
+    DocumentPrefetcher *&ptr;
+    explicit DocPrefetchGuard(DocumentPrefetcher *&p)
+        :ptr(p)
+    {
+        ptr = &prefetcher;
+    }
+    ~DocPrefetchGuard() {
+        ptr = nullptr;
+    }
+};
+
 Document* Application::openDocument(const char * FileName, DocumentInitFlags initFlags) {
     std::vector<std::string> filenames(1,FileName);
     auto docs = openDocuments(filenames, nullptr, nullptr, nullptr, initFlags);
@@ -742,6 +761,16 @@ std::vector<Document*> Application::openDocuments(const std::vector<std::string>
     for (auto &name : filenames)
         _pendingDocs.emplace_back(name.c_str());
 
+    // Documents are restored one by one, but their files are read in advance
+    // by worker threads, including the ones found while restoring the others.
+    DocPrefetchGuard prefetchGuard(_prefetcher);
+    for (std::size_t i = 0; i < filenames.size(); ++i) {
+        if (paths && paths->size() > i)
+            _prefetcher->prefetch((*paths)[i]);
+        else
+            _prefetcher->prefetch(filenames[i]);
+    }
+
     std::map<DocumentT, DocTiming> timings;
 
     FC_TIME_INIT(t);
@@ -1573,6 +1602,11 @@ void Application::slotChangedObject(const DocumentObject& obj, const Property& p
     this->signalChangedObject(obj, prop);
 }
 
+void Application::slotBulkChanged(const Document& doc, const std::vector<BulkChange>& changes)
+{
+    this->signalBulkChanged(doc, changes);
+}
+
 void Application::slotRelabelObject(const DocumentObject& obj)
 {
     this->signalRelabelObject(obj);
@@ -1707,6 +1741,7 @@ void Application::destruct()
     cleanupUnits();
 #endif
 
+    FeaturePythonPool::destruct();
     CleanupProcess::callCleanup();
 
     // not initialized or double destruct!
@@ -2222,7 +2257,9 @@ void parseProgramOptions(int ac, char ** av, const std::string& exe, boost::prog
     ("python-path,P", boost::program_options::value< std::vector<std::string> >()->composing(),"Additional python paths")
     ("disable-addon", boost::program_options::value< std::vector<std::string> >()->composing(),"Disable a given addon.")
     ("single-instance", "Allow to run a single instance of the application")
+    ("service", "Runs as a batch service reading JSON requests from stdin (console mode only)")
     ("safe-mode", "Force enable safe mode")
+    ("startup-trace", "Prints the time spent in the init scripts and imports during start-up")
     ("pass", boost::program_options::value< std::vector<std::string> >()->multitoken(), "Ignores the following arguments and pass them through to be used by a script")
     ;
 
@@ -2458,6 +2495,14 @@ void processProgramOptions(const boost::program_options::variables_map& vm, std:
         mConfig["SingleInstance"] = "1";
     }
 
+    if (vm.contains("service")) {
+        mConfig["RunMode"] = "Service";
+    }
+
+    if (vm.contains("startup-trace")) {
+        mConfig["StartupTrace"] = "1";
+    }
+
     if (vm.contains("dump-config")) {
         std::stringstream str;
         for (const auto & it : mConfig) {
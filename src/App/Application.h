@@ -59,6 +59,8 @@ class ApplicationDirectories;
 class ApplicationObserver;
 class Property;
 class AutoTransaction;
+class DocumentPrefetcher;
+struct BulkChange;
 class ExtensionContainer;
 
 /// Options for acquiring links.
@@ -408,6 +410,8 @@ public:
     fastsignals::signal<void (const App::DocumentObject&, const App::Property&)> signalBeforeChangeObject;
     /// Signal on a changed property in an object.
     fastsignals::signal<void (const App::DocumentObject&, const App::Property&)> signalChangedObject;
+    /// Signal with the coalesced object changes at the end of a bulk update.
+    fastsignals::signal<void (const App::Document&, const std::vector<App::BulkChange>&)> signalBulkChanged;
     /// Signal on a relabeled object.
     fastsignals::signal<void (const App::DocumentObject&)> signalRelabelObject;
     /// Signal on an activated object.
@@ -889,6 +893,8 @@ protected:
     void slotBeforeChangeObject(const App::DocumentObject& obj, const App::Property& prop);
     /// A slot for after a property of an object has changed.
     void slotChangedObject(const App::DocumentObject& obj, const App::Property& prop);
+    /// A slot for the end of a bulk update.
+    void slotBulkChanged(const App::Document& doc, const std::vector<App::BulkChange>& changes);
     /// A slot for when an object is relabeled.
     void slotRelabelObject(const App::DocumentObject& obj);
     /// A slot for when an object is activated.
@@ -1008,6 +1014,8 @@ private:
 
     std::deque<std::string> _pendingDocs;
     std::deque<std::string> _pendingDocsReopen;
+    // reads the files of the pending documents while openDocuments() restores
+    DocumentPrefetcher* _prefetcher{nullptr};
     std::map<std::string,std::vector<std::string> > _pendingDocMap;
 
     // To prevent infinite recursion of reloading a partial document due a truly
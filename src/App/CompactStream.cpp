@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+#include <algorithm>
+#include <ostream>
+
+#include <Base/Exception.h>
+
+#include "CompactStream.h"
+
+
+using namespace App;
+
+namespace
+{
+constexpr unsigned bitsPerByte = 7;
+constexpr std::uint8_t moreBytes = 0x80;
+constexpr std::uint8_t valueMask = 0x7f;
+}  // namespace
+
+CompactOutputStream::CompactOutputStream(std::ostream& stream)
+    : stream(stream)
+{}
+
+void CompactOutputStream::writeUInt(std::uint64_t value)
+{
+    while (value >= moreBytes) {
+        stream.put(static_cast<char>((value & valueMask) | moreBytes));
+        value >>= bitsPerByte;
+    }
+    stream.put(static_cast<char>(value));
+}
+
+void CompactOutputStream::writeInt(std::int64_t value)
+{
+    // zigzag encoding keeps small negative values small
+    auto bits = static_cast<std::uint64_t>(value);
+    writeUInt((bits << 1) ^ (value < 0 ? ~std::uint64_t(0) : std::uint64_t(0)));
+}
+
+void CompactOutputStream::writeBytes(std::string_view data)
+{
+    writeUInt(data.size());
+    stream.write(data.data(), static_cast<std::streamsize>(data.size()));
+}
+
+void CompactOutputStream::writeString(std::string_view str)
+{
+    auto diff = std::mismatch(str.begin(), str.end(), last.begin(), last.end());
+    auto prefix = static_cast<std::size_t>(diff.first - str.begin());
+    writeUInt(prefix);
+    writeBytes(str.substr(prefix));
+    last.assign(str);
+}
+
+CompactInputStream::CompactInputStream(std::string_view data)
+    : data(data)
+{}
+
+std::uint64_t CompactInputStream::readUInt()
+{
+    std::uint64_t value = 0;
+    for (unsigned shift = 0; shift < 64; shift += bitsPerByte) {  // NOLINT
+        if (pos >= data.size()) {
+            throw Base::RuntimeError("Unexpected end of binary data");
+        }
+        auto byte = static_cast<std::uint8_t>(data[pos++]);
+        value |= std::uint64_t(byte & valueMask) << shift;
+        if ((byte & moreBytes) == 0) {
+            return value;
+        }
+    }
+    throw Base::RuntimeError("Invalid integer in binary data");
+}
+
+std::int64_t CompactInputStream::readInt()
+{
+    std::uint64_t bits = readUInt();
+    return static_cast<std::int64_t>((bits >> 1) ^ (~(bits & 1) + 1));
+}
+
+std::string_view CompactInputStream::readBytes()
+{
+    std::uint64_t size = readUInt();
+    if (size > remaining()) {
+        throw Base::RuntimeError("Unexpected end of binary data");
+    }
+    std::string_view result = data.substr(pos, size);
+    pos += size;
+    return result;
+}
+
+std::string_view CompactInputStream::readString()
+{
+    std::uint64_t prefix = readUInt();
+    if (prefix > last.size()) {
+        throw Base::RuntimeError("Invalid string in binary data");
+    }
+    std::string_view suffix = readBytes();
+    last.resize(prefix);
+    last.append(suffix);
+    return last;
+}
@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+#include <FCGlobal.h>
+
+namespace App
+{
+
+/**
+ * @brief Writes a compact binary encoding of integers and strings.
+ *
+ * Integers are written as variable length quantities, so that small values take a single byte.
+ * Strings written with writeString() only store the part that differs from the previously
+ * written string, which makes sorted or otherwise similar names very cheap to store.
+ *
+ * @sa CompactInputStream
+ */
+class AppExport CompactOutputStream
+{
+public:
+    explicit CompactOutputStream(std::ostream& stream);
+
+    void writeUInt(std::uint64_t value);
+    void writeInt(std::int64_t value);
+    /// Writes the size followed by the raw data
+    void writeBytes(std::string_view data);
+    /// Writes the string with the prefix it shares with the previous string removed
+    void writeString(std::string_view str);
+
+private:
+    std::ostream& stream;
+    std::string last;
+};
+
+/**
+ * @brief Reads the data written by CompactOutputStream from a memory buffer.
+ *
+ * The buffer is not copied and must outlive the stream. All functions throw
+ * Base::RuntimeError if the data is truncated.
+ */
+class AppExport CompactInputStream
+{
+public:
+    explicit CompactInputStream(std::string_view data);
+
+    std::uint64_t readUInt();
+    std::int64_t readInt();
+    /// Returns a view into the buffer
+    std::string_view readBytes();
+    /// Returns a view that is valid until the next call of readString()
+    std::string_view readString();
+
+    /// Returns the number of bytes that are not read yet
+    std::size_t remaining() const
+    {
+        return data.size() - pos;
+    }
+
+private:
+    std::string_view data;
+    std::size_t pos = 0;
+    std::string last;
+};
+
+}  // namespace App
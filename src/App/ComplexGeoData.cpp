@@ -24,11 +24,14 @@
  *                                                                          *
  ***************************************************************************/
 
+#include <algorithm>
 #include <cstdlib>
+#include <iterator>
 #include <limits>
 
 #include <boost/regex.hpp>
 
+#include "CompactStream.h"
 #include "ComplexGeoData.h"
 #include "ElementMap.h"
 #include "ElementNamingUtils.h"
@@ -335,10 +338,13 @@ ElementMapPtr ComplexGeoData::elementMap(bool flush) const
 
 ElementMapPtr ComplexGeoData::ensureElementMap(bool flush)
 {
+    if (flush) {
+        flushElementMap();
+    }
     if (!_elementMap) {
         resetElementMap(std::make_shared<Data::ElementMap>());
     }
-    return elementMap(flush);
+    return _elementMap;
 }
 
 void ComplexGeoData::flushElementMap() const
@@ -461,7 +467,8 @@ void ComplexGeoData::Save(Base::Writer& writer) const
     writer.Stream() << writer.ind() << "<ElementMap2";
 
     if (!_persistenceName.empty()) {
-        writer.Stream() << " file=\"" << writer.addFile((_persistenceName + ".txt").c_str(), this)
+        const char* ext = writer.getMode("BinaryElementMap") ? ".bin" : ".txt";
+        writer.Stream() << " file=\"" << writer.addFile((_persistenceName + ext).c_str(), this)
                         << "\"/>\n";
         return;
     }
@@ -634,6 +641,11 @@ void ComplexGeoData::SaveDocFile(Base::Writer& writer) const
 {
     flushElementMap();
     if (_elementMap) {
+        if (writer.getMode("BinaryElementMap")) {
+            writer.Stream() << "BinaryElementMap v1\n";
+            _elementMap->saveBinary(writer.Stream());
+            return;
+        }
         writer.Stream() << "BeginElementMap v1\n";
         _elementMap->save(writer.Stream());
     }
@@ -656,6 +668,22 @@ void ComplexGeoData::RestoreDocFile(Base::Reader& reader)
             return;
         }
     }
+    else if (boost::equals(marker, "BinaryElementMap")) {
+        resetElementMap();
+        reader >> ver;
+        if (ver != "v1") {
+            FC_WARN("Unknown element map format");  // NOLINT
+            return;
+        }
+        // skip the line end of the header
+        reader.get();
+        std::string buffer {std::istreambuf_iterator<char>(reader),
+                            std::istreambuf_iterator<char>()};
+        ::App::CompactInputStream in(buffer);
+        resetElementMap(std::make_shared<ElementMap>());
+        _elementMap = _elementMap->restoreBinary(Hasher, in);
+        return;
+    }
     auto count = atoll(marker.c_str());  // Try to prevent UB if the number is unreasonably large
     if (count < 0 || count > std::numeric_limits<int>::max()) {
         FC_THROWM(Base::RuntimeError, "Failed to restore element map " << _persistenceName);
@@ -667,8 +695,10 @@ unsigned int ComplexGeoData::getMemSize() const
 {
     flushElementMap();
     if (_elementMap) {
-        static const int multiplier {10};
-        return _elementMap->size() * multiplier;
+        std::size_t size = _elementMap->getMemSize();
+        return static_cast<unsigned int>(
+            std::min<std::size_t>(size, std::numeric_limits<unsigned int>::max())
+        );
     }
     return 0;
 }
@@ -683,6 +713,7 @@ void ComplexGeoData::setMappedChildElements(
 {
     // DO NOT reset element map if there is one. Because we allow mixing child
     // mapping and normal mapping
+    flushElementMap();
     if (!_elementMap) {
         resetElementMap(std::make_shared<Data::ElementMap>());
     }
@@ -691,6 +722,7 @@ void ComplexGeoData::setMappedChildElements(
 
 std::vector<Data::ElementMap::MappedChildElements> ComplexGeoData::getMappedChildElements() const
 {
+    flushElementMap();
     if (!_elementMap) {
         return {};
     }
@@ -35,6 +35,8 @@
 #include <list>
 #include <algorithm>
 #include <filesystem>
+#include <numeric>
+#include <thread>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/bimap.hpp>
@@ -48,6 +50,7 @@
 
 #include <QCryptographicHash>
 #include <QCoreApplication>
+#include <QtConcurrentMap>
 
 #include <FCConfig.h>
 
@@ -71,11 +74,14 @@
 #include "Application.h"
 #include "AutoTransaction.h"
 #include "BackupPolicy.h"
+#include "DocumentPrefetcher.h"
 #include "ExpressionParser.h"
+#include "FeaturePythonPool.h"
 #include "GeoFeature.h"
 #include "License.h"
 #include "Link.h"
 #include "MergeDocuments.h"
+#include "PropertyTransfer.h"
 #include "StringHasher.h"
 #include "Transactions.h"
 
@@ -86,6 +92,7 @@
 #include <zipios++/zipinputstream.h>
 #include <zipios++/zipoutputstream.h>
 #include <zipios++/meta-iostreams.h>
+#include <Base/ZipHeader.h>
 
 
 FC_LOG_LEVEL_INIT("App", true, true, true)
@@ -304,6 +311,36 @@ bool Document::isPerformingTransaction() const
     return d->undoing || d->rollback;
 }
 
+void Document::beginBulkUpdate()
+{
+    ++d->bulkUpdateDepth;
+}
+
+void Document::endBulkUpdate()
+{
+    if (d->bulkUpdateDepth <= 0 || --d->bulkUpdateDepth > 0) {
+        return;
+    }
+
+    std::vector<BulkChange> changes;
+    changes.swap(d->bulkChanges);
+    d->bulkChangeIndex.clear();
+    changes.erase(std::remove_if(changes.begin(),
+                                 changes.end(),
+                                 [](const BulkChange& change) {
+                                     return !change.object;
+                                 }),
+                  changes.end());
+    if (!changes.empty()) {
+        signalBulkChanged(*this, changes);
+    }
+}
+
+bool Document::isBulkUpdating() const
+{
+    return d->bulkUpdateDepth > 0;
+}
+
 std::vector<std::string> Document::getAvailableUndoNames() const
 {
     std::vector<std::string> vList;
@@ -494,6 +531,7 @@ void Document::_commitTransaction(const bool notify)
         Base::FlagToggler<> flag(d->committing);
         Application::TransactionSignaller signaller(false, true);
         const int id = d->activeUndoTransaction->getID();
+        d->activeUndoTransaction->compact();
         mUndoTransactions.push_back(d->activeUndoTransaction);
         d->activeUndoTransaction = nullptr;
         // check the stack for the limits
@@ -502,6 +540,19 @@ void Document::_commitTransaction(const bool notify)
             delete mUndoTransactions.front();
             mUndoTransactions.pop_front();
         }
+        // and for the memory limit, the last transaction is always kept
+        if (d->UndoMemSize > 0) {
+            std::size_t memSize = 0;
+            for (auto* transaction : mUndoTransactions) {
+                memSize += transaction->getMemUsage();
+            }
+            while (mUndoTransactions.size() > 1 && memSize > d->UndoMemSize) {
+                memSize -= mUndoTransactions.front()->getMemUsage();
+                mUndoMap.erase(mUndoTransactions.front()->getID());
+                delete mUndoTransactions.front();
+                mUndoTransactions.pop_front();
+            }
+        }
         signalCommitTransaction(*this);
 
         // closeActiveTransaction() may call again _commitTransaction()
@@ -706,6 +757,18 @@ unsigned int Document::getUndoMemSize() const
     return d->UndoMemSize;
 }
 
+std::size_t Document::getUndoMemUsage() const
+{
+    std::size_t memSize = 0;
+    for (auto* transaction : mUndoTransactions) {
+        memSize += transaction->getMemUsage();
+    }
+    for (auto* transaction : mRedoTransactions) {
+        memSize += transaction->getMemUsage();
+    }
+    return memSize;
+}
+
 void Document::setUndoLimit(const unsigned int UndoMemSize) // NOLINT
 {
     d->UndoMemSize = UndoMemSize;
@@ -793,6 +856,31 @@ void Document::onChanged(const Property* prop)
 
 void Document::onBeforeChangeProperty(const TransactionalObject* Who, const Property* What)
 {
+    // Undo copies of lists only keep the changed entries and take the others
+    // from the current value, which must therefore not change unrecorded
+    auto expandUndoDelta = [this, Who, What]() {
+        if (!mUndoTransactions.empty() && dynamic_cast<const PropertyListsBase*>(What)) {
+            for (auto transaction : mUndoTransactions) {
+                transaction->expandDelta(Who, What);
+            }
+        }
+    };
+
+    if (d->isRecomputeWorker()) {
+        // Observers are not thread safe. Record the change for undo/redo right
+        // away but postpone the notification to the recompute thread.
+        std::lock_guard<std::recursive_mutex> guard(d->recomputeMutex);
+        d->deferredChanges.push_back({Who, What, true});
+        if (!d->rollback && !globalIsRelabeling) {
+            if (d->activeUndoTransaction) {
+                d->activeUndoTransaction->addObjectChange(Who, What);
+            }
+            else {
+                expandUndoDelta();
+            }
+        }
+        return;
+    }
     if (Who->isDerivedFrom<DocumentObject>()) {
         signalBeforeChangeObject(*static_cast<const DocumentObject*>(Who), *What);
     }
@@ -801,11 +889,22 @@ void Document::onBeforeChangeProperty(const TransactionalObject* Who, const Prop
         if (d->activeUndoTransaction) {
             d->activeUndoTransaction->addObjectChange(Who, What);
         }
+        else {
+            expandUndoDelta();
+        }
     }
 }
 
 void Document::onChangedProperty(const DocumentObject* Who, const Property* What)
 {
+    if (d->isRecomputeWorker()) {
+        std::lock_guard<std::recursive_mutex> guard(d->recomputeMutex);
+        d->deferredChanges.push_back({Who, What, false});
+        return;
+    }
+    if (d->bulkUpdateDepth > 0) {
+        d->recordBulkChange(Who, What);
+    }
     signalChangedObject(*Who, *What);
 }
 
@@ -1009,6 +1108,9 @@ void Document::Save(Base::Writer& writer) const
     }
     beforeSave();
 
+    // Drop string IDs that nothing refers to any more, e.g. names of shapes
+    // replaced by a recompute, so the table does not keep growing across saves.
+    d->Hasher->compact();
     d->Hasher->Save(writer);
 
     writer.decInd();
@@ -1251,6 +1353,62 @@ void Document::exportObjects(const std::vector<DocumentObject*>& obj, std::ostre
     d->hashers.clear();
 }
 
+void Document::exportProperties(DocumentObject* obj,
+                                const std::vector<Property*>& props,
+                                std::ostream& out)
+{
+    DocumentExporting exporting({obj});
+    d->hashers.clear();
+
+    Base::ZipWriter writer(out);
+    writer.putNextEntry("Properties.xml");
+    writer.Stream() << "<?xml version='1.0' encoding='utf-8'?>" << '\n';
+    writer.Stream() << "<Properties Count=\"" << props.size() << "\">" << '\n';
+    writer.incInd();
+    for (auto prop : props) {
+        writer.Stream() << writer.ind() << "<Property name=\"" << prop->getName()
+                        << "\" type=\"" << prop->getTypeId().getName() << "\">" << '\n';
+        writer.incInd();
+        prop->Save(writer);
+        writer.decInd();
+        writer.Stream() << writer.ind() << "</Property>" << '\n';
+    }
+    writer.decInd();
+    writer.Stream() << "</Properties>" << '\n';
+
+    writer.writeFiles();
+    d->hashers.clear();
+}
+
+void Document::importProperties(DocumentObject* obj, std::istream& in)
+{
+    d->hashers.clear();
+    zipios::ZipInputStream zipstream(in);
+    Base::XMLReader reader("<memory>", zipstream);
+    // the same version as written by exportObjects()
+    reader.DocumentSchema = 4;
+    reader.FileVersion = 1;
+
+    reader.readElement("Properties");
+    const long count = reader.getAttribute<long>("Count");
+    for (long i = 0; i < count; ++i) {
+        reader.readElement("Property");
+        std::string name = reader.getAttribute<const char*>("name");
+        std::string type = reader.getAttribute<const char*>("type");
+        Property* prop = obj->getPropertyByName(name.c_str());
+        if (!prop || type != prop->getTypeId().getName()) {
+            throw Base::TypeError("Object '" + std::string(obj->getNameInDocument())
+                                  + "' has no property '" + name + "' of type " + type);
+        }
+        prop->Restore(reader);
+        reader.readEndElement("Property");
+    }
+    reader.readEndElement("Properties");
+
+    reader.readFiles(zipstream);
+    d->hashers.clear();
+}
+
 constexpr auto fcAttrDependencies {"Dependencies"};
 constexpr auto fcElementObjectDeps {"ObjectDeps"};
 constexpr auto fcAttrDepCount {"Count"};
@@ -1714,7 +1872,7 @@ unsigned int Document::getMemSize() const
     size += PropertyContainer::getMemSize();
 
     // Undo Redo size
-    size += getUndoMemSize();
+    size += static_cast<unsigned int>(getUndoMemUsage());
 
     return size;
 }
@@ -1877,6 +2035,22 @@ bool Document::saveToFile(const char* filename) const
         if (hGrp->GetBool("SaveBinaryBrep", false)) {
             writer.setMode("BinaryBrep");
         }
+        // Shared shape storage can also be enabled for a single document
+        if (hGrp->GetBool("SaveSharedBrep", false) || Meta["SaveSharedBrep"] == "1") {
+            writer.setMode("SharedBrep");
+        }
+        // Element maps and string tables in the compact binary format. Off by default because
+        // older versions can only read the text format.
+        if (hGrp->GetBool("SaveBinaryElementMap", false)
+            || Meta["SaveBinaryElementMap"] == "1") {
+            writer.setMode("BinaryElementMap");
+        }
+        // Geometry lists, e.g. of sketches, in a binary file. Off by default because older
+        // versions can only read the XML format.
+        if (hGrp->GetBool("SaveBinaryGeometry", false) || Meta["SaveBinaryGeometry"] == "1") {
+            writer.setMode("BinaryGeometry");
+        }
+        writer.setConcurrentCompression(hGrp->GetBool("ConcurrentCompression", true));
 
         writer.Stream() << "<?xml version='1.0' encoding='utf-8'?>" << '\n'
                         << "<!--" << '\n'
@@ -1944,6 +2118,7 @@ void Document::registerLabel(const std::string& newLabel)
     if (!newLabel.empty()) {
         d->objectLabelManager.addExactName(newLabel);
     }
+    d->objectLabelIndexValid = false;
 }
 
 void Document::unregisterLabel(const std::string& oldLabel)
@@ -1951,6 +2126,7 @@ void Document::unregisterLabel(const std::string& oldLabel)
     if (!oldLabel.empty()) {
         d->objectLabelManager.removeExactName(oldLabel);
     }
+    d->objectLabelIndexValid = false;
 }
 
 bool Document::containsLabel(const std::string& label)
@@ -1972,6 +2148,72 @@ bool Document::isAnyRestoring()
     return globalIsRestoring;
 }
 
+namespace
+{
+// Read-only stream over a project file prefetched by the application
+class ProjectBuffer: public std::streambuf
+{
+public:
+    explicit ProjectBuffer(const std::string& data)
+    {
+        char* begin = const_cast<char*>(data.data());  // NOLINT
+        setg(begin, begin, begin + data.size());
+    }
+
+protected:
+    pos_type seekoff(off_type off,
+                     std::ios_base::seekdir dir,
+                     std::ios_base::openmode which) override
+    {
+        if (!(which & std::ios_base::in)) {
+            return pos_type(off_type(-1));
+        }
+        off_type pos = off;
+        if (dir == std::ios_base::cur) {
+            pos += gptr() - eback();
+        }
+        else if (dir == std::ios_base::end) {
+            pos += egptr() - eback();
+        }
+        if (pos < 0 || pos > egptr() - eback()) {
+            return pos_type(off_type(-1));
+        }
+        setg(eback(), eback() + pos, egptr());
+        return pos_type(pos);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+    {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+};
+
+class ProjectStream: public std::istream
+{
+public:
+    explicit ProjectStream(std::shared_ptr<const std::string> data)
+        : std::istream(nullptr)
+        , data(std::move(data))
+        , buffer(*this->data)
+    {
+        rdbuf(&buffer);
+    }
+
+private:
+    std::shared_ptr<const std::string> data;
+    ProjectBuffer buffer;
+};
+
+std::unique_ptr<std::istream> openProjectFile(const Base::FileInfo& fi,
+                                              const std::shared_ptr<const std::string>& content)
+{
+    if (content) {
+        return std::make_unique<ProjectStream>(content);
+    }
+    return std::make_unique<Base::ifstream>(fi, std::ios::in | std::ios::binary);
+}
+}  // namespace
+
 // Open the document
 void Document::restore(const char* filename,
                        bool delaySignal,
@@ -2011,15 +2253,20 @@ void Document::restore(const char* filename,
         filename = FileName.getValue();
     }
     Base::FileInfo fi(filename);
-    Base::ifstream file(fi, std::ios::in | std::ios::binary);
-    std::streambuf* buf = file.rdbuf();
+    // The file may have been read in the background already, see Application::openDocuments()
+    std::shared_ptr<const std::string> content;
+    if (auto prefetcher = GetApplication()._prefetcher) {
+        content = prefetcher->take(fi.filePath());
+    }
+    std::unique_ptr<std::istream> file = openProjectFile(fi, content);
+    std::streambuf* buf = file->rdbuf();
     std::streamoff size = buf->pubseekoff(0, std::ios::end, std::ios::in);
     buf->pubseekoff(0, std::ios::beg, std::ios::in);
     if (size < 22) {  // an empty zip archive has 22 bytes
         throw Base::FileException("Invalid project file", filename);
     }
 
-    zipios::ZipInputStream zipstream(file);
+    zipios::ZipInputStream zipstream(*file);
     Base::XMLReader reader(filename, zipstream);
 
     if (!reader.isValid()) {
@@ -2049,7 +2296,27 @@ void Document::restore(const char* filename,
     // Note: This file doesn't need to be available if the document has been created
     // without GUI. But if available then follow after all data files of the App document.
     signalRestoreDocument(reader);
-    reader.readFiles(zipstream);
+
+    // Read the data files by name from the central directory, using a stream of its own.
+    // Archives with a broken directory, e.g. from an interrupted save, are still read
+    // entry by entry.
+    std::unique_ptr<std::istream> archiveFile = openProjectFile(fi, content);
+    std::unique_ptr<zipios::ZipHeader> archive;
+    try {
+        archive = std::make_unique<zipios::ZipHeader>(*archiveFile);
+        if (!archive->isValid()) {
+            archive.reset();
+        }
+    }
+    catch (const std::exception&) {
+        archive.reset();
+    }
+    if (archive) {
+        reader.readFiles(*archive);
+    }
+    else {
+        reader.readFiles(zipstream);
+    }
 
     DocumentP::checkStringHasher(reader);
 
@@ -2085,6 +2352,9 @@ bool Document::afterRestore(const std::vector<DocumentObject*>& objArray, bool c
         return false;
     }
 
+    // Expressions are parsed below, identical ones only once
+    ExpressionParser::ParseCache parseCache;
+
     // Some link type properties cannot restore link information until other
     // objects have been restored. For example, PropertyExpressionEngine and
     // PropertySheet with expressions containing a label reference. So we add
@@ -2649,6 +2919,51 @@ void Document::renameObjectIdentifiers(
     }
 }
 
+// Assign each object of a topologically sorted list the length of its longest
+// dependency chain within the list. Objects of equal level are independent.
+static std::vector<int> getDependencyLevels(const std::vector<DocumentObject*>& sortedObjs)
+{
+    std::unordered_map<const DocumentObject*, int> levelMap;
+    std::vector<int> levels;
+    levels.reserve(sortedObjs.size());
+    for (auto obj : sortedObjs) {
+        int level = 0;
+        for (auto dep : obj->getOutList()) {
+            auto it = levelMap.find(dep);
+            if (it != levelMap.end()) {
+                level = std::max(level, it->second + 1);
+            }
+        }
+        levelMap[obj] = level;
+        levels.push_back(level);
+    }
+    return levels;
+}
+
+// Python extensions may hook into execute()
+static bool hasPythonExtension(const DocumentObject* obj)
+{
+    for (auto ext : obj->getExtensionsDerivedFromType<Extension>()) {
+        if (ext->isPythonExtension()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool canRecomputeConcurrently(const DocumentObject* obj)
+{
+    return obj->canRecomputeConcurrently() && !hasPythonExtension(obj);
+}
+
+// Check whether the calling thread holds the GIL and may release it while
+// executing the object
+static bool canReleaseGIL(const DocumentObject* obj)
+{
+    return obj->isExecuteGILFree() && !hasPythonExtension(obj) && Py_IsInitialized()
+        && PyGILState_Check();
+}
+
 void Document::setPreRecomputeHook(const PreRecomputeHook& hook)
 {
      d->_preRecomputeHook = hook;
@@ -2690,6 +3005,7 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
 
     // delete recompute log
     d->clearRecomputeLog();
+    d->recomputeStats.begin();
 
     FC_TIME_INIT(t);
 
@@ -2722,8 +3038,10 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
    */
 
     // alt:
-    auto topoSortedObjects =
-        getDependencyList(objs.empty() ? d->objectArray : objs, DepSort | options);
+    // The sorted list of the whole document is cached and only rebuilt after
+    // the dependencies have changed.
+    auto topoSortedObjects = objs.empty() ? d->getSortedObjects(DepSort | options)
+                                          : getDependencyList(objs, DepSort | options);
 
     for (auto obj : topoSortedObjects) {
         obj->setStatus(ObjectStatus::PendingRecompute, true);
@@ -2733,10 +3051,38 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
         GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document");
     bool canAbort = hGrp->GetBool("CanAbortRecompute", true);
 
+    // In parallel mode the objects are grouped into dependency levels. Objects
+    // of the same level do not depend on each other and can be recomputed at
+    // the same time. Sorting by level keeps the topological order intact.
+    // Pure Python features of a level are sent to the worker processes at once.
+    std::vector<int> levels;
+    bool parallel = hGrp->GetBool("ParallelRecompute", false);
+    FeaturePythonPool& pool = FeaturePythonPool::instance();
+    bool usePool = pool.isEnabled();
+    if ((parallel || usePool) && topoSortedObjects.size() > 1) {
+        levels = getDependencyLevels(topoSortedObjects);
+        std::vector<size_t> order(topoSortedObjects.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&levels](size_t a, size_t b) {
+            return levels[a] < levels[b];
+        });
+        std::vector<DocumentObject*> sortedObjects;
+        std::vector<int> sortedLevels;
+        sortedObjects.reserve(order.size());
+        sortedLevels.reserve(order.size());
+        for (auto i : order) {
+            sortedObjects.push_back(topoSortedObjects[i]);
+            sortedLevels.push_back(levels[i]);
+        }
+        topoSortedObjects.swap(sortedObjects);
+        levels.swap(sortedLevels);
+    }
+
     FC_TIME_INIT(t2);
 
     try {
         std::set<DocumentObject*> filter;
+        std::map<DocumentObject*, int> precomputed;
         size_t idx = 0;
         // maximum two passes to allow some form of dependency inversion
         for (int passes = 0; passes < 2 && idx < topoSortedObjects.size(); ++passes) {
@@ -2748,15 +3094,69 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
             FC_LOG("Recompute pass " << passes);
             for (; idx < topoSortedObjects.size(); ++idx) {
                 auto obj = topoSortedObjects[idx];
+                if (passes == 0 && !levels.empty()
+                    && (idx == 0 || levels[idx] != levels[idx - 1])) {
+                    // entering a new dependency level, execute its independent
+                    // objects concurrently and handle the results in order below
+                    std::vector<DocumentObject*> batch;
+                    std::vector<DocumentObject*> pythonBatch;
+                    // objects sharing an input would fill the caches of its
+                    // data at the same time, the later ones run in order below
+                    std::set<DocumentObject*> inputs;
+                    auto sharesInput = [&inputs](DocumentObject* o) {
+                        auto outList = o->getOutList();
+                        for (auto dep : outList) {
+                            if (inputs.contains(dep)) {
+                                return true;
+                            }
+                        }
+                        inputs.insert(outList.begin(), outList.end());
+                        return false;
+                    };
+                    for (size_t i = idx;
+                         i < topoSortedObjects.size() && levels[i] == levels[idx];
+                         ++i) {
+                        auto o = topoSortedObjects[i];
+                        if (o->isAttachedToDocument() && !filter.contains(o)
+                            && o->mustRecompute()) {
+                            if (canRecomputeConcurrently(o)) {
+                                if (!sharesInput(o)) {
+                                    batch.push_back(o);
+                                }
+                            }
+                            else if (usePool && pool.canExecute(o)) {
+                                pythonBatch.push_back(o);
+                            }
+                        }
+                    }
+                    // the results of the workers are applied in order by execute()
+                    if (!pythonBatch.empty()) {
+                        pool.submit(pythonBatch);
+                    }
+                    if (parallel && batch.size() > 1) {
+                        auto results = _recomputeFeatures(batch);
+                        for (size_t i = 0; i < batch.size(); ++i) {
+                            precomputed[batch[i]] = results[i];
+                        }
+                    }
+                }
                 if (!obj->isAttachedToDocument() || filter.find(obj) != filter.end()) {
                     continue;
                 }
                 // ask the object if it should be recomputed
                 bool doRecompute = false;
-                if (obj->mustRecompute()) {
+                auto itDone = precomputed.find(obj);
+                if (itDone != precomputed.end() || obj->mustRecompute()) {
                     doRecompute = true;
                     ++objectCount;
-                    int res = _recomputeFeature(obj);
+                    int res = 0;
+                    if (itDone != precomputed.end()) {
+                        res = itDone->second;
+                        precomputed.erase(itDone);
+                    }
+                    else {
+                        res = _recomputeFeature(obj);
+                    }
                     if (res != 0) {
                         if (hasError) {
                             *hasError = true;
@@ -2807,9 +3207,13 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
     catch (Base::Exception& e) {
         e.reportException();
     }
+    // drop the jobs of objects that have been skipped
+    pool.clear();
 
     FC_TIME_LOG(t2, "Recompute");
 
+    d->recomputeStats.finish(topoSortedObjects);
+
     for (auto obj : topoSortedObjects) {
         if (!obj->isAttachedToDocument()) {
             continue;
@@ -3042,11 +3446,24 @@ int Document::_recomputeFeature(DocumentObject* Feat) // NOLINT
 {
     FC_LOG("Recomputing " << Feat->getFullName());
 
+    RecomputeStats::ObjectTimer timer(d->recomputeStats, Feat);
+
+    // only objects that allow it may be handed to a recompute worker
+    assert(!d->isRecomputeWorker() || canRecomputeConcurrently(Feat));
+
     DocumentObjectExecReturn* returnCode = nullptr;
     try {
         returnCode = Feat->ExpressionEngine.execute(PropertyExpressionEngine::ExecuteNonOutput);
         if (returnCode == DocumentObject::StdReturn) {
-            returnCode = Feat->recompute();
+            if (canReleaseGIL(Feat)) {
+                Base::PyGILStateRelease unlock;
+                returnCode = Feat->recompute();
+                // a GIL free execute() must not leave the interpreter locked
+                assert(!PyGILState_Check());
+            }
+            else {
+                returnCode = Feat->recompute();
+            }
             if (returnCode == DocumentObject::StdReturn) {
                 returnCode =
                     Feat->ExpressionEngine.execute(PropertyExpressionEngine::ExecuteOutput);
@@ -3095,6 +3512,56 @@ int Document::_recomputeFeature(DocumentObject* Feat) // NOLINT
     return 0;
 }
 
+std::vector<int> Document::_recomputeFeatures(const std::vector<DocumentObject*>& objs)
+{
+    std::vector<int> results(objs.size(), 0);
+    std::vector<size_t> indices(objs.size());
+    std::iota(indices.begin(), indices.end(), 0);
+
+    FC_LOG("Recomputing " << objs.size() << " objects concurrently");
+    {
+        d->recomputeThread = std::this_thread::get_id();
+        Base::StateLocker guard(d->parallelRecompute);
+        // The workers may need the GIL, e.g. to evaluate expressions, so make
+        // sure this thread doesn't hold it while waiting for them.
+        Base::PyGILStateLocker lock;
+        Base::PyGILStateRelease unlock;
+        QtConcurrent::blockingMap(indices, [this, &objs, &results](size_t i) {
+            results[i] = _recomputeFeature(objs[i]);
+        });
+    }
+
+    // now notify the observers about the changes made by the workers
+    std::vector<DocumentP::DeferredChange> changes;
+    changes.swap(d->deferredChanges);
+    for (const auto& change : changes) {
+        if (change.before) {
+            if (change.object->isDerivedFrom<DocumentObject>()) {
+                signalBeforeChangeObject(*static_cast<const DocumentObject*>(change.object),
+                                         *change.property);
+            }
+        }
+        else {
+            auto obj = static_cast<const DocumentObject*>(change.object);
+            if (d->bulkUpdateDepth > 0) {
+                d->recordBulkChange(obj, change.property);
+            }
+            signalChangedObject(*obj, *change.property);
+        }
+    }
+    return results;
+}
+
+const RecomputeStats& Document::getRecomputeStats() const
+{
+    return d->recomputeStats;
+}
+
+bool Document::isRecomputeWorker() const
+{
+    return d->isRecomputeWorker();
+}
+
 bool Document::recomputeFeature(DocumentObject* feature, bool recursive)
 {
     // delete recompute log
@@ -3225,6 +3692,9 @@ void Document::_addObject(DocumentObject* pcObject, const char* pObjectName, Add
     }
     d->objectIdMap[pcObject->_Id] = pcObject;
     d->objectArray.push_back(pcObject);
+    d->addToObjectIndex(pcObject);
+    // invalidate cached dependency information
+    pcObject->clearOutListCache();
 
      // do no transactions if we do a rollback!
     if (!d->rollback) {
@@ -3257,6 +3727,9 @@ void Document::_addObject(DocumentObject* pcObject, const char* pObjectName, Add
     }
     pcObject->_pcViewProviderName = viewType ? viewType : "";
 
+    if (d->bulkUpdateDepth > 0) {
+        d->recordBulkChange(pcObject, nullptr);
+    }
     signalNewObject(*pcObject);
 
     // do no transactions if we do a rollback!
@@ -3353,6 +3826,7 @@ void Document::_removeObject(DocumentObject* pcObject, RemoveObjectOptions optio
     if (!d->undoing && !d->rollback) {
         pcObject->unsetupObject();
     }
+    d->forgetBulkChange(pcObject);
     signalDeletedObject(*pcObject);
     signalTransactionRemove(*pcObject, d->rollback ? nullptr : d->activeUndoTransaction);
     breakDependency(pcObject, true);
@@ -3389,9 +3863,11 @@ void Document::_removeObject(DocumentObject* pcObject, RemoveObjectOptions optio
          ++it) {
         if (*it == pcObject) {
             d->objectArray.erase(it);
+            d->removeFromObjectIndex(pcObject);
             break;
         }
     }
+    pcObject->clearOutListCache();
 
     // In case the object gets deleted the pointer must be nullified
     if (tobedestroyed) {
@@ -3429,6 +3905,10 @@ Document::copyObject(const std::vector<DocumentObject*>& objs, bool recursive, b
     // if not copying recursively then suppress possible warnings
     md.setVerbose(recursive);
 
+    // The originals stay alive, so properties with large data like shapes are
+    // handed over instead of being written and parsed again
+    PropertyTransfer transfer;
+
     unsigned int memsize = 1000;  // ~ for the meta-information
     for (auto it : deps) {
         memsize += it->getMemSize();
@@ -3694,27 +4174,24 @@ const std::vector<DocumentObject*>& Document::getObjects() const
 
 std::vector<DocumentObject*> Document::getObjectsOfType(const Base::Type& typeId) const
 {
-    std::vector<DocumentObject*> Objects;
-    for (auto it : d->objectArray) {
-        if (it->isDerivedFrom(typeId)) {
-            Objects.push_back(it);
-        }
-    }
-    return Objects;
+    return d->getObjectsOfType([&typeId](const Base::Type& type) {
+        return type.isDerivedFrom(typeId);
+    });
 }
 
 std::vector<DocumentObject*> Document::getObjectsOfType(const std::vector<Base::Type>& types) const
 {
-    std::vector<DocumentObject*> Objects;
-    for (auto it : d->objectArray) {
-        for (auto& typeId : types) {
-            if (it->isDerivedFrom(typeId)) {
-                Objects.push_back(it);
-                break; // Prevent adding several times the same object.
-            }
-        }
-    }
-    return Objects;
+    return d->getObjectsOfType([&types](const Base::Type& type) {
+        return std::any_of(types.begin(), types.end(), [&type](const Base::Type& typeId) {
+            return type.isDerivedFrom(typeId);
+        });
+    });
+}
+
+std::vector<DocumentObject*> Document::getObjectsByLabel(const std::string& label) const
+{
+    auto objects = d->getObjectsByLabel(label);
+    return objects ? *objects : std::vector<DocumentObject*>();
 }
 
 std::vector<DocumentObject*> Document::getObjectsWithExtension(const Base::Type& typeId,
@@ -3747,32 +4224,29 @@ Document::findObjects(const Base::Type& typeId, const char* objname, const char*
     }
 
     std::vector<DocumentObject*> Objects;
-    DocumentObject* found = nullptr;
-    for (const auto it : d->objectArray) {
-        if (it->isDerivedFrom(typeId)) {
-            found = it;
-
-            if (!rx_name.empty() && !boost::regex_search(it->getNameInDocument(), what, rx_name)) {
-                found = nullptr;
-            }
-
-            if (!rx_label.empty() && !boost::regex_search(it->Label.getValue(), what, rx_label)) {
-                found = nullptr;
-            }
+    for (const auto it : getObjectsOfType(typeId)) {
+        if (!rx_name.empty() && !boost::regex_search(it->getNameInDocument(), what, rx_name)) {
+            continue;
+        }
 
-            if (found) {
-                Objects.push_back(found);
-            }
+        if (!rx_label.empty() && !boost::regex_search(it->Label.getValue(), what, rx_label)) {
+            continue;
         }
+
+        Objects.push_back(it);
     }
     return Objects;
 }
 
 int Document::countObjectsOfType(const Base::Type& typeId) const
 {
-    return std::count_if(d->objectMap.begin(), d->objectMap.end(), [&](const auto& it) {
-        return it.second->isDerivedFrom(typeId);
-    });
+    std::size_t count = 0;
+    for (const auto& it : d->objectTypeIndex) {
+        if (Base::Type::fromKey(it.first).isDerivedFrom(typeId)) {
+            count += it.second.size();
+        }
+    }
+    return static_cast<int>(count);
 }
 
 int Document::countObjectsOfType(const char* typeName) const
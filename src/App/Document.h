@@ -80,12 +80,24 @@ class TransactionalObject;
 class DocumentObject;
 class DocumentObjectExecReturn;
 class Document;
+class RecomputeStats;
 class DocumentPy;
 class Application;
 class Transaction;
 class StringHasher;
 using StringHasherRef = Base::Reference<StringHasher>;
 
+/// The coalesced changes of one object during a bulk update, see Document::beginBulkUpdate()
+struct BulkChange
+{
+    /// The changed object
+    DocumentObject* object;
+    /// Whether the object was created during the bulk update
+    bool created;
+    /// The names of the changed properties in the order of their first change
+    std::vector<std::string> properties;
+};
+
 /**
  * @brief A class that represents a FreeCAD document.
  *
@@ -222,6 +234,8 @@ public:
     fastsignals::signal<void(const Document&)> signalUndo;
     /// Signal on redo.
     fastsignals::signal<void(const Document&)> signalRedo;
+    /// Signal with the coalesced changes at the end of a bulk update.
+    fastsignals::signal<void(const Document&, const std::vector<BulkChange>&)> signalBulkChanged;
 
     /**
      * @brief Signal on load/save document.
@@ -392,6 +406,29 @@ public:
      */
     std::vector<DocumentObject*> importObjects(Base::XMLReader& reader);
 
+    /**
+     * @brief Export some properties of an object to a stream.
+     *
+     * The properties are written like by exportObjects(), e.g. to transfer
+     * the results of a recompute to a copy of the object in another process.
+     *
+     * @param[in] obj: The object owning the properties.
+     * @param[in] props: The properties to export.
+     * @param[in, out] out: The output stream to write to.
+     */
+    void exportProperties(DocumentObject* obj,
+                          const std::vector<Property*>& props,
+                          std::ostream& out);
+
+    /**
+     * @brief Import properties written by exportProperties() into an object.
+     *
+     * @param[in] obj: The object to restore the properties of.
+     * @param[in, out] in: The input stream to read from.
+     * @throw Base::TypeError if the object has no matching property.
+     */
+    void importProperties(DocumentObject* obj, std::istream& in);
+
     /**
      * @brief Import any externally linked objects
      *
@@ -668,6 +705,14 @@ public:
      */
     std::vector<DocumentObject*> getObjectsOfType(const std::vector<Base::Type>& types) const;
 
+    /**
+     * @brief Get all objects with the given label.
+     *
+     * @param[in] label The label to search for.
+     * @return A vector of the objects with exactly this label in creation order.
+     */
+    std::vector<DocumentObject*> getObjectsByLabel(const std::string& label) const;
+
     /**
      * @brief Get all objects with a given extension.
      *
@@ -792,6 +837,24 @@ public:
      */
     bool recomputeFeature(DocumentObject* Feat, bool recursive = false);
 
+    /**
+     * @brief Get the timing statistics of the last recompute.
+     *
+     * @return The per-object timings and the critical path of the last
+     * call of recompute().
+     */
+    const RecomputeStats& getRecomputeStats() const;
+
+    /**
+     * @brief Check whether the calling thread is a worker of a parallel recompute.
+     *
+     * Objects recomputed on a worker must not touch state shared with other
+     * objects, e.g. the string table of the document, without synchronization.
+     *
+     * @return True if called by a recompute worker, false otherwise.
+     */
+    bool isRecomputeWorker() const;
+
     /**
      * @brief Get the text of the error for a specified object.
      * @param[in] Obj The object to get the error text for.
@@ -920,11 +983,17 @@ public:
     void setUndoLimit(unsigned int UndoMemSize = 0);
 
     /**
-     * @brief Get the undo memory size.
-     * @return The memory used by the undo stack in bytes.
+     * @brief Get the undo memory limit.
+     * @return The maximum memory of the undo stack in bytes, 0 if unlimited.
      */
     unsigned int getUndoMemSize() const;
 
+    /**
+     * @brief Get the memory used by the undo and redo stacks.
+     * @return The memory in bytes, without data shared with the document.
+     */
+    std::size_t getUndoMemUsage() const;
+
     /**
      * @brief Set the Undo limit as stack size.
      *
@@ -1027,6 +1096,28 @@ public:
     void renamePropertyOfObject(TransactionalObject* obj, const Property* prop, const char* newName);
     /// @}
 
+    /** @name Bulk updates
+     *
+     * During a bulk update the object signals are emitted as usual, but the
+     * created and changed objects are also recorded, one entry per object
+     * with each changed property listed once. When the outermost bulk update
+     * ends, signalBulkChanged() is emitted with all entries of objects that
+     * still exist.
+     *
+     * Observers that only need the final state opt in by ignoring the object
+     * signals while isBulkUpdating() returns true and handling
+     * signalBulkChanged() instead.
+     * @{
+     */
+
+    /// Start a bulk update, calls may be nested.
+    void beginBulkUpdate();
+    /// End a bulk update and dispatch the changes if it is the outermost one.
+    void endBulkUpdate();
+    /// Check if a bulk update is active.
+    bool isBulkUpdating() const;
+    /// @}
+
     /** @name Dependency items.
      * @{
      */
@@ -1382,6 +1473,17 @@ protected:
      */
     int _recomputeFeature(DocumentObject* Feat);
 
+    /**
+     * @brief Recompute a set of independent objects concurrently.
+     *
+     * Change notifications emitted by the worker threads are deferred and
+     * signaled on the calling thread once all objects are done.
+     *
+     * @param[in] objs The objects to recompute. None may depend on another.
+     * @return The result of _recomputeFeature() for each object.
+     */
+    std::vector<int> _recomputeFeatures(const std::vector<DocumentObject*>& objs);
+
     /// Clear the redos.
     void _clearRedos();
 
@@ -1475,4 +1577,25 @@ T* Document::addObject(const char* pObjectName, bool isNew, const char* viewType
     return static_cast<T*>(addObject(T::getClassName(), pObjectName, isNew, viewType, isPartial));
 }
 
+/// Helper class to run a bulk update of a document within a scope
+class BulkUpdateLocker
+{
+public:
+    explicit BulkUpdateLocker(Document* doc)
+        : doc(doc)
+    {
+        doc->beginBulkUpdate();
+    }
+    ~BulkUpdateLocker()
+    {
+        doc->endBulkUpdate();
+    }
+
+    BulkUpdateLocker(const BulkUpdateLocker&) = delete;
+    BulkUpdateLocker& operator=(const BulkUpdateLocker&) = delete;
+
+private:
+    Document* doc;
+};
+
 }  // namespace App
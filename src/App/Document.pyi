@@ -4,7 +4,7 @@ from __future__ import annotations
 
 from PropertyContainer import PropertyContainer
 from DocumentObject import DocumentObject
-from typing import Final, Sequence
+from typing import Any, Callable, Final, Sequence
 
 
 class Document(PropertyContainer):
@@ -57,6 +57,9 @@ class Document(PropertyContainer):
     HasPendingTransaction: Final[bool] = False
     """Check if there is a pending transaction"""
 
+    BulkUpdating: Final[bool] = False
+    """Check if a bulk update is active"""
+
     InList: Final[list[Document]] = []
     """A list of all documents that link to this document."""
 
@@ -184,6 +187,23 @@ class Document(PropertyContainer):
         """
         ...
 
+    def beginBulkUpdate(self) -> None:
+        """
+        Start a bulk update, calls may be nested.
+
+        Until the matching endBulkUpdate() the created and changed objects are
+        recorded. Document observers implementing slotBulkChanged(doc, changes)
+        then skip their object slots and get the coalesced changes at the end
+        instead.
+        """
+        ...
+
+    def endBulkUpdate(self) -> None:
+        """
+        End a bulk update and notify the observers if it is the outermost one.
+        """
+        ...
+
     def addObject(
         self,
         type: str,
@@ -361,6 +381,54 @@ class Document(PropertyContainer):
         """
         ...
 
+    def runSweep(
+        self,
+        inputs: Sequence[tuple[DocumentObject, str]],
+        rows: Sequence[Sequence[Any]],
+        outputs: Sequence[tuple[DocumentObject, str]],
+        callback: Callable[[int, list | None], None] = None,
+        /,
+    ) -> list[list | None]:
+        """
+        Recompute the document for each row of input values and collect the outputs.
+
+        inputs and outputs are sequences of (object, property path) tuples. Each row
+        of rows holds one value per input. For each row the inputs are set, the
+        document is recomputed and the output values are collected. The optional
+        callback is called after each row with the row index and its outputs, e.g.
+        to export files. Afterwards the original input values are restored.
+
+        Returns one list of output values per row, or None for the rows whose
+        recompute failed.
+        """
+        ...
+
+    def getRecomputeStats(self) -> dict:
+        """
+        Return the timing statistics of the last recompute.
+
+        The returned dictionary contains the keys 'TotalTime', 'CriticalPath',
+        'CriticalPathTime' and 'Objects'. 'Objects' is a list with one dictionary
+        per recomputed object holding its 'Name' and the 'StartTime', 'WallTime',
+        'PythonTime' and 'OccTime' in seconds. 'CriticalPath' is the list of
+        object names forming the dependency chain with the largest recompute time.
+        """
+        ...
+
+    def getMemoryReport(self) -> dict:
+        """
+        Return the estimated memory usage of the document in bytes.
+
+        The returned dictionary contains the keys 'Total', 'Categories',
+        'PropertyTypes' and 'Objects'. 'Categories' maps e.g. 'Objects',
+        'Undo/Redo', 'String table' and, with the GUI, 'View providers' to
+        their size. 'PropertyTypes' maps property type names to their size. 'Objects'
+        is a list with one dictionary per object, largest first, holding its
+        'Name', 'Label', 'TypeId', the size of its 'Properties', the 'Extra'
+        memory per category held by other modules and the 'Total'.
+        """
+        ...
+
     def mustExecute(self) -> bool:
         """
         Check if any object must be recomputed
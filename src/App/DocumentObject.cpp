@@ -23,6 +23,7 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <atomic>
 #include <stack>
 #include <memory>
 #include <map>
@@ -860,6 +861,10 @@ void DocumentObject::onEarlyChange(const Property* prop)
 /// get called by the container when a Property was changed
 void DocumentObject::onChanged(const Property* prop)
 {
+    if (prop->isDerivedFrom<PropertyPlacement>() || prop->isDerivedFrom<PropertyLinkBase>()) {
+        GeoFeatureGroupExtension::invalidateGlobalPlacements();
+    }
+
     if (prop == &Label && _pDoc && _pDoc->containsObject(this) && oldLabel != Label.getStrValue()) {
         _pDoc->unregisterLabel(oldLabel);
         _pDoc->registerLabel(Label.getStrValue());
@@ -916,11 +921,22 @@ void DocumentObject::onChanged(const Property* prop)
     signalChanged(*this, *prop);
 }
 
+namespace
+{
+std::atomic<std::size_t> dependencyRevision {0};  // NOLINT
+}
+
 void DocumentObject::clearOutListCache() const
 {
     _outList.clear();
     _outListMap.clear();
     _outListCached = false;
+    ++dependencyRevision;
+}
+
+std::size_t DocumentObject::getDependencyRevision()
+{
+    return dependencyRevision;
 }
 
 PyObject* DocumentObject::getPyObject()
@@ -1269,6 +1285,7 @@ void App::DocumentObject::_removeBackLink(DocumentObject* rmvObj)
     if (it != _inList.end()) {
         _inList.erase(it);
     }
+    GeoFeatureGroupExtension::invalidateGlobalPlacements();
 }
 
 void App::DocumentObject::_addBackLink(DocumentObject* newObj)
@@ -1278,6 +1295,7 @@ void App::DocumentObject::_addBackLink(DocumentObject* newObj)
     // only once this removal would clear the object from the inlist, even though there may be other
     // link properties from this object that link to us.
     _inList.push_back(newObj);
+    GeoFeatureGroupExtension::invalidateGlobalPlacements();
 }
 
 int DocumentObject::setElementVisible(const char* element, bool visible)
@@ -520,6 +520,17 @@ public:
     /// Clear the internal OutList cache.
     void clearOutListCache() const;
 
+    /**
+     * @brief Get the revision of the object dependency graph.
+     *
+     * The revision is incremented whenever the OutList cache of any object is
+     * cleared, i.e. whenever a link changes or an object is added to or removed
+     * from a document. It is used to validate cached dependency information.
+     *
+     * @return The current revision of the dependency graph.
+     */
+    static std::size_t getDependencyRevision();
+
     /**
      * @brief Get all possible paths from this object to another object.
      *
@@ -938,6 +949,39 @@ public:
         return false;
     }
 
+    /**
+     * @brief Check whether this object can be recomputed on a worker thread.
+     *
+     * If parallel recompute is enabled in the preferences, independent
+     * objects of the dependency graph that return true here are recomputed
+     * concurrently.  Only override this function for objects whose execute()
+     * runs no Python code, doesn't touch global, unprotected state, neither
+     * adds nor removes dynamic properties and doesn't change link properties.
+     * The signals of those changes are not deferred to the calling thread.
+     *
+     * @return true if the object can be recomputed concurrently, false otherwise.
+     */
+    virtual bool canRecomputeConcurrently() const
+    {
+        return false;
+    }
+
+    /**
+     * @brief Check whether execute() runs without the Python interpreter.
+     *
+     * Objects returning true declare their execute() as thread-safe and free
+     * of Python code. The thread driving the recompute then releases the
+     * global interpreter lock (GIL) while they are executed, so that the
+     * workers of a parallel recompute and other Python threads aren't
+     * blocked by it. Expressions are still evaluated with the GIL held.
+     *
+     * @return true if execute() doesn't need the GIL, false otherwise.
+     */
+    virtual bool isExecuteGILFree() const
+    {
+        return false;
+    }
+
     /**
      * @brief Called when a new label for the document object is proposed.
      *
@@ -99,6 +99,7 @@ DocumentObserverPython::DocumentObserverPython(const Py::Object& obj)
     FC_PY_ELEMENT_ARG1(DeletedObject, DeletedObject)
     FC_PY_ELEMENT_ARG2(BeforeChangeObject, BeforeChangeObject)
     FC_PY_ELEMENT_ARG2(ChangedObject, ChangedObject)
+    FC_PY_ELEMENT_ARG2(BulkChanged, BulkChanged)
     FC_PY_ELEMENT_ARG1(RecomputedObject, ObjectRecomputed)
     FC_PY_ELEMENT_ARG1(BeforeRecomputeDocument, BeforeRecomputeDocument)
     FC_PY_ELEMENT_ARG1(RecomputedDocument, Recomputed)
@@ -300,8 +301,16 @@ void DocumentObserverPython::slotChangedDocument(const App::Document& Doc,
     }
 }
 
+bool DocumentObserverPython::isBulkUpdating(const App::DocumentObject& Obj) const
+{
+    return !pyBulkChanged.py.isNone() && Obj.getDocument() && Obj.getDocument()->isBulkUpdating();
+}
+
 void DocumentObserverPython::slotCreatedObject(const App::DocumentObject& Obj)
 {
+    if (isBulkUpdating(Obj)) {
+        return;
+    }
     Base::PyGILStateLocker lock;
     try {
         Py::Tuple args(1);
@@ -331,6 +340,9 @@ void DocumentObserverPython::slotDeletedObject(const App::DocumentObject& Obj)
 void DocumentObserverPython::slotBeforeChangeObject(const App::DocumentObject& Obj,
                                                     const App::Property& Prop)
 {
+    if (isBulkUpdating(Obj)) {
+        return;
+    }
     Base::PyGILStateLocker lock;
     try {
         Py::Tuple args(2);
@@ -352,6 +364,9 @@ void DocumentObserverPython::slotBeforeChangeObject(const App::DocumentObject& O
 void DocumentObserverPython::slotChangedObject(const App::DocumentObject& Obj,
                                                const App::Property& Prop)
 {
+    if (isBulkUpdating(Obj)) {
+        return;
+    }
     Base::PyGILStateLocker lock;
     try {
         Py::Tuple args(2);
@@ -370,6 +385,34 @@ void DocumentObserverPython::slotChangedObject(const App::DocumentObject& Obj,
     }
 }
 
+void DocumentObserverPython::slotBulkChanged(const App::Document& Doc,
+                                             const std::vector<App::BulkChange>& Changes)
+{
+    Base::PyGILStateLocker lock;
+    try {
+        Py::List list;
+        for (const auto& change : Changes) {
+            Py::Tuple names(change.properties.size());
+            for (std::size_t i = 0; i < change.properties.size(); i++) {
+                names.setItem(i, Py::String(change.properties[i]));
+            }
+            Py::Tuple item(3);
+            item.setItem(0, Py::asObject(change.object->getPyObject()));
+            item.setItem(1, Py::Boolean(change.created));
+            item.setItem(2, names);
+            list.append(item);
+        }
+        Py::Tuple args(2);
+        args.setItem(0, Py::asObject(const_cast<App::Document&>(Doc).getPyObject()));
+        args.setItem(1, list);
+        Base::pyCall(pyBulkChanged.ptr(), args.ptr());
+    }
+    catch (Py::Exception&) {
+        Base::PyException e;  // extract the Python error text
+        e.reportException();
+    }
+}
+
 void DocumentObserverPython::slotRecomputedObject(const App::DocumentObject& Obj)
 {
     Base::PyGILStateLocker lock;
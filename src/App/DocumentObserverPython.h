@@ -34,6 +34,7 @@
 namespace App
 {
 
+struct BulkChange;
 class Document;
 class DocumentObject;
 class ExtensionContainer;
@@ -78,6 +79,8 @@ private:
     void slotBeforeChangeObject(const App::DocumentObject& Obj, const App::Property& Prop);
     /** The property of an observed object has changed */
     void slotChangedObject(const App::DocumentObject& Obj, const App::Property& Prop);
+    /** Called with the coalesced object changes at the end of a bulk update */
+    void slotBulkChanged(const App::Document& Doc, const std::vector<App::BulkChange>& Changes);
     /** Undoes the last transaction of the document */
     void slotUndoDocument(const App::Document& Doc);
     /** Redoes the last undone transaction of the document */
@@ -119,6 +122,9 @@ private:
 
 
 private:
+    /// Whether the object slots are skipped in favour of slotBulkChanged()
+    bool isBulkUpdating(const App::DocumentObject& Obj) const;
+
     Py::Object inst;
     static std::vector<DocumentObserverPython*> _instances;
 
@@ -144,6 +150,7 @@ private:
     Connection pyDeletedObject;
     Connection pyBeforeChangeObject;
     Connection pyChangedObject;
+    Connection pyBulkChanged;
     Connection pyRecomputedObject;
     Connection pyBeforeRecomputeDocument;
     Connection pyRecomputedDocument;
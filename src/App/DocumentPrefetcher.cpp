@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include <atomic>
+#include <map>
+#include <QFuture>
+#include <QtConcurrentRun>
+
+#include <Base/FileInfo.h>
+#include <Base/Stream.h>
+
+#include "DocumentPrefetcher.h"
+#include "Application.h"
+
+using namespace App;
+
+using FileContent = std::shared_ptr<const std::string>;
+
+struct DocumentPrefetcher::Private
+{
+    std::map<std::string, QFuture<FileContent>> files;
+    /// The bytes held for files that are not yet taken
+    std::atomic<std::size_t> bytes {0};
+    std::size_t limit {0};
+
+    FileContent read(const std::string& path)
+    {
+        Base::FileInfo fi(path);
+        Base::ifstream file(fi, std::ios::in | std::ios::binary);
+        if (!file) {
+            return {};
+        }
+        file.seekg(0, std::ios::end);
+        std::streamoff size = file.tellg();
+        if (size <= 0) {
+            return {};
+        }
+
+        auto length = static_cast<std::size_t>(size);
+        if (bytes.fetch_add(length) + length > limit) {
+            bytes -= length;
+            return {};
+        }
+
+        auto content = std::make_shared<std::string>(length, '\0');
+        file.seekg(0, std::ios::beg);
+        if (!file.read(content->data(), size)) {
+            bytes -= length;
+            return {};
+        }
+        return content;
+    }
+};
+
+DocumentPrefetcher::DocumentPrefetcher()
+    : d(std::make_unique<Private>())
+{
+    ParameterGrp::handle hGrp = GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document"
+    );
+    d->limit = static_cast<std::size_t>(hGrp->GetUnsigned("PrefetchMemory", 1024)) << 20;
+}
+
+DocumentPrefetcher::~DocumentPrefetcher()
+{
+    for (auto& it : d->files) {
+        it.second.waitForFinished();
+    }
+}
+
+void DocumentPrefetcher::prefetch(const std::string& path)
+{
+    if (d->limit == 0) {
+        return;
+    }
+    std::string key = Base::FileInfo(path).filePath();
+    if (d->files.contains(key)) {
+        return;
+    }
+    Private* p = d.get();
+    d->files.emplace(key, QtConcurrent::run([p, key]() { return p->read(key); }));
+}
+
+std::shared_ptr<const std::string> DocumentPrefetcher::take(const std::string& path)
+{
+    auto it = d->files.find(Base::FileInfo(path).filePath());
+    if (it == d->files.end()) {
+        return {};
+    }
+    FileContent content = it->second.result();
+    d->files.erase(it);
+    if (content) {
+        d->bytes -= content->size();
+    }
+    return content;
+}
@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <FCGlobal.h>
+
+namespace App
+{
+
+/**
+ * The DocumentPrefetcher class reads project files in the background.
+ *
+ * Application::openDocuments() restores the requested documents and the documents they link to
+ * one after the other, because restoring creates objects and notifies observers that expect the
+ * main thread. Meanwhile the files of the queued documents are read into memory by the global
+ * thread pool, so that the disk or network access of all of them overlaps with restoring.
+ * Document::restore() then takes the content instead of opening the file.
+ *
+ * The memory held for files that are not yet taken is limited by the parameter
+ * "PrefetchMemory" in MB of BaseApp/Preferences/Document, files beyond it are read as usual.
+ * All functions must be called from the main thread.
+ */
+class AppExport DocumentPrefetcher
+{
+public:
+    DocumentPrefetcher();
+    ~DocumentPrefetcher();
+
+    DocumentPrefetcher(const DocumentPrefetcher&) = delete;
+    DocumentPrefetcher& operator=(const DocumentPrefetcher&) = delete;
+
+    /// Starts reading the file \a path unless it's already read
+    void prefetch(const std::string& path);
+    /** Returns the content of the file \a path and forgets about it
+     *
+     * Waits until the file is read. Returns a null pointer if the file wasn't prefetched or
+     * couldn't be read, the caller then has to open it itself.
+     */
+    std::shared_ptr<const std::string> take(const std::string& path);
+
+private:
+    struct Private;
+    std::unique_ptr<Private> d;
+};
+
+}  // namespace App
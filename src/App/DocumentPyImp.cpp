@@ -29,7 +29,10 @@
 #include "Document.h"
 #include "DocumentObject.h"
 #include "DocumentObjectPy.h"
+#include "MemoryReport.h"
 #include "MergeDocuments.h"
+#include "ParameterSweep.h"
+#include "RecomputeStats.h"
 
 // inclusion of the generated files (generated By DocumentPy.xml)
 #include "DocumentPy.h"
@@ -618,6 +621,33 @@ Py::Boolean DocumentPy::getHasPendingTransaction() const
     return {getDocumentPtr()->hasPendingTransaction()};
 }
 
+PyObject* DocumentPy::beginBulkUpdate(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    getDocumentPtr()->beginBulkUpdate();
+    Py_Return;
+}
+
+PyObject* DocumentPy::endBulkUpdate(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    PY_TRY
+    {
+        getDocumentPtr()->endBulkUpdate();
+        Py_Return;
+    }
+    PY_CATCH;
+}
+
+Py::Boolean DocumentPy::getBulkUpdating() const
+{
+    return {getDocumentPtr()->isBulkUpdating()};
+}
+
 PyObject* DocumentPy::undo(PyObject* args)
 {
     if (!PyArg_ParseTuple(args, "")) {
@@ -753,6 +783,149 @@ PyObject* DocumentPy::recompute(PyObject* args)
     PY_CATCH;
 }
 
+PyObject* DocumentPy::runSweep(PyObject* args)
+{
+    PyObject* pyInputs;
+    PyObject* pyRows;
+    PyObject* pyOutputs;
+    PyObject* pyCallback = Py_None;
+    if (!PyArg_ParseTuple(args, "OOO|O", &pyInputs, &pyRows, &pyOutputs, &pyCallback)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        ParameterSweep sweep(getDocumentPtr());
+        auto addPaths = [](PyObject* pyPaths, auto add) {
+            for (const auto& item : Py::Sequence(pyPaths)) {
+                Py::Tuple tuple(item);
+                if (tuple.size() != 2
+                    || !PyObject_TypeCheck(tuple[0].ptr(), &DocumentObjectPy::Type)) {
+                    throw Py::TypeError("expect (DocumentObject, path) tuples");
+                }
+                auto obj = static_cast<DocumentObjectPy*>(tuple[0].ptr())->getDocumentObjectPtr();
+                add(obj, Py::String(tuple[1]).as_std_string("utf-8"));
+            }
+        };
+        addPaths(pyInputs, [&](DocumentObject* obj, const std::string& path) {
+            sweep.addInput(obj, path);
+        });
+        addPaths(pyOutputs, [&](DocumentObject* obj, const std::string& path) {
+            sweep.addOutput(obj, path);
+        });
+
+        std::vector<std::vector<App::any>> rows;
+        for (const auto& pyRow : Py::Sequence(pyRows)) {
+            rows.emplace_back();
+            for (const auto& value : Py::Sequence(pyRow)) {
+                rows.back().push_back(pyObjectToAny(value));
+            }
+        }
+
+        auto toPython = [](const ParameterSweep::Result& result) {
+            if (!result.valid) {
+                return Py::None();
+            }
+            Py::List values;
+            for (const auto& value : result.outputs) {
+                values.append(pyObjectFromAny(value));
+            }
+            return Py::Object(values);
+        };
+
+        ParameterSweep::Callback callback;
+        if (pyCallback != Py_None) {
+            Py::Callable pyCallable(pyCallback);
+            callback = [&](std::size_t index, const ParameterSweep::Result& result) {
+                Py::Tuple callArgs(2);
+                callArgs.setItem(0, Py::Long(static_cast<unsigned long>(index)));
+                callArgs.setItem(1, toPython(result));
+                pyCallable.apply(callArgs);
+            };
+        }
+
+        Py::List results;
+        for (const auto& result : sweep.run(rows, callback)) {
+            results.append(toPython(result));
+        }
+        return Py::new_reference_to(results);
+    }
+    PY_CATCH;
+}
+
+PyObject* DocumentPy::getRecomputeStats(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    const auto& stats = getDocumentPtr()->getRecomputeStats();
+    Py::List objects;
+    for (const auto& entry : stats.getObjects()) {
+        Py::Dict item;
+        item.setItem("Name", Py::String(entry.name));
+        item.setItem("StartTime", Py::Float(entry.startTime));
+        item.setItem("WallTime", Py::Float(entry.wallTime));
+        item.setItem("PythonTime", Py::Float(entry.pythonTime));
+        item.setItem("OccTime", Py::Float(entry.occTime));
+        objects.append(item);
+    }
+    Py::List path;
+    for (const auto& name : stats.getCriticalPath()) {
+        path.append(Py::String(name));
+    }
+
+    Py::Dict dict;
+    dict.setItem("TotalTime", Py::Float(stats.getTotalTime()));
+    dict.setItem("CriticalPath", path);
+    dict.setItem("CriticalPathTime", Py::Float(stats.getCriticalPathTime()));
+    dict.setItem("Objects", objects);
+    return Py::new_reference_to(dict);
+}
+
+PyObject* DocumentPy::getMemoryReport(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    auto toPython = [](std::size_t size) {
+        return Py::asObject(PyLong_FromSize_t(size));
+    };
+
+    MemoryReport report(*getDocumentPtr());
+    Py::List objects;
+    for (const auto& usage : report.getObjects()) {
+        Py::Dict extra;
+        for (const auto& [category, size] : usage.extra) {
+            extra.setItem(category, toPython(size));
+        }
+        Py::Dict item;
+        item.setItem("Name", Py::String(usage.name));
+        item.setItem("Label", Py::String(usage.label));
+        item.setItem("TypeId", Py::String(usage.type));
+        item.setItem("Properties", toPython(usage.properties));
+        item.setItem("Extra", extra);
+        item.setItem("Total", toPython(usage.total()));
+        objects.append(item);
+    }
+    Py::Dict types;
+    for (const auto& [type, size] : report.getPropertyTypes()) {
+        types.setItem(type, toPython(size));
+    }
+    Py::Dict categories;
+    for (const auto& [category, size] : report.getCategories()) {
+        categories.setItem(category, toPython(size));
+    }
+
+    Py::Dict dict;
+    dict.setItem("Total", toPython(report.getTotal()));
+    dict.setItem("Categories", categories);
+    dict.setItem("PropertyTypes", types);
+    dict.setItem("Objects", objects);
+    return Py::new_reference_to(dict);
+}
+
 PyObject* DocumentPy::mustExecute(PyObject* args)
 {
     if (!PyArg_ParseTuple(args, "")) {
@@ -817,12 +990,8 @@ PyObject* DocumentPy::getObjectsByLabel(PyObject* args)
     }
 
     Py::List list;
-    std::string name = sName;
-    std::vector<DocumentObject*> objs = getDocumentPtr()->getObjects();
-    for (auto obj : objs) {
-        if (name == obj->Label.getValue()) {
-            list.append(Py::asObject(obj->getPyObject()));
-        }
+    for (auto obj : getDocumentPtr()->getObjectsByLabel(sName)) {
+        list.append(Py::asObject(obj->getPyObject()));
     }
 
     return Py::new_reference_to(list);
@@ -956,7 +1125,7 @@ void DocumentPy::setUndoMode(Py::Long arg)
 
 Py::Long DocumentPy::getUndoRedoMemSize() const
 {
-    return Py::Long((long)getDocumentPtr()->getUndoMemSize());
+    return Py::Long(getDocumentPtr()->getUndoMemUsage());
 }
 
 Py::Long DocumentPy::getUndoCount() const
@@ -22,6 +22,7 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <cstring>
 #include <map>
 #include <vector>
 #include <string>
@@ -52,10 +53,19 @@ std::size_t CStringHasher::operator()(const char* s) const {
     if (!s) {
         return 0;
     }
-    return boost::hash_range(s, s + std::strlen(s));
+    // FNV-1a, computed in a single pass without a separate strlen()
+    std::size_t hash = 14695981039346656037ULL;
+    for (; *s; ++s) {
+        hash = (hash ^ static_cast<unsigned char>(*s)) * 1099511628211ULL;
+    }
+    return hash;
 }
 
 bool CStringHasher::operator()(const char* a, const char* b) const {
+    // property names are mostly looked up with the same static string they were added with
+    if (a == b) {
+        return true;
+    }
     if (!a) {
         return !b;
     }
@@ -65,6 +75,11 @@ bool CStringHasher::operator()(const char* a, const char* b) const {
     return std::strcmp(a, b) == 0;
 }
 
+HashedName::HashedName(const char* name)
+    : name(name)
+    , hash(CStringHasher()(name))
+{}
+
 namespace bmi = boost::multi_index;
 
 struct DynamicProperty::Impl {
@@ -76,6 +91,7 @@ struct DynamicProperty::Impl {
                             CStringHasher>,
         bmi::hashed_unique<bmi::member<PropData, Property*, &PropData::property>>>>
     props;
+    unsigned changeCount = 0;
 };
 
 
@@ -93,6 +109,7 @@ void DynamicProperty::clear()
         delete v.property;
     }
     index.clear();
+    ++impl->changeCount;
 }
 
 void DynamicProperty::getPropertyList(std::vector<Property*>& List) const
@@ -124,9 +141,17 @@ void DynamicProperty::getPropertyMap(std::map<std::string,Property*>& Map) const
 }
 
 Property* DynamicProperty::getDynamicPropertyByName(const char* name) const
+{
+    return getDynamicPropertyByName(HashedName(name));
+}
+
+Property* DynamicProperty::getDynamicPropertyByName(const HashedName& name) const
 {
     auto& index = impl->props.get<0>();
-    auto it = index.find(name);
+    if (index.empty()) {
+        return nullptr;
+    }
+    auto it = index.find(name, CStringHasher(), CStringHasher());
     if (it != index.end()) {
         return it->property;
     }
@@ -202,6 +227,11 @@ size_t DynamicProperty::size() const
     return impl->props.size();
 }
 
+unsigned DynamicProperty::getChangeCount() const
+{
+    return impl->changeCount;
+}
+
 const char* DynamicProperty::getPropertyDocumentation(const char* name) const
 {
     auto& index = impl->props.get<0>();
@@ -271,6 +301,7 @@ Property* DynamicProperty::addDynamicProperty(PropertyContainer& pc,
     Property* pcProperty = static_cast<Property*>(propInstance);
 
     auto res = impl->props.get<0>().emplace(pcProperty, name, nullptr, group, doc, attr, ro, hidden);
+    ++impl->changeCount;
 
     pcProperty->setContainer(&pc);
     pcProperty->myName = res.first->name.c_str();
@@ -313,6 +344,7 @@ bool DynamicProperty::addProperty(Property* prop)
                   prop->getType(),
                   false,
                   false);
+    ++impl->changeCount;
     return true;
 }
 
@@ -322,6 +354,7 @@ bool DynamicProperty::removeProperty(const Property* prop)
     auto it = index.find(const_cast<Property*>(prop));
     if (it != index.end()) {
         index.erase(it);
+        ++impl->changeCount;
         return true;
     }
     return false;
@@ -345,6 +378,7 @@ bool DynamicProperty::removeDynamicProperty(const char* name)
         if (prop->myName) {
             Property::destroy(prop);
             index.erase(it);
+            ++impl->changeCount;
             // memory of myName has been freed
             prop->myName = nullptr;
         }
@@ -492,6 +526,7 @@ bool DynamicProperty::renameDynamicProperty(Property* prop,
         // manages the memory.
         d.property->myName = d.name.c_str();
     });
+    ++impl->changeCount;
 
     GetApplication().signalRenameDynamicProperty(*prop, oldName.c_str());
 
@@ -47,10 +47,34 @@ namespace App
 class Property;
 class PropertyContainer;
 
+/** A property name together with its hash
+ * This allows to look up the same name in the dynamic and static properties of a container
+ * while hashing it only once.
+ */
+struct AppExport HashedName
+{
+    explicit HashedName(const char* name);
+    const char* name;
+    std::size_t hash;
+};
+
 struct AppExport CStringHasher
 {
     std::size_t operator()(const char* s) const;
     bool operator()(const char* a, const char* b) const;
+
+    std::size_t operator()(const HashedName& n) const
+    {
+        return n.hash;
+    }
+    bool operator()(const HashedName& a, const char* b) const
+    {
+        return operator()(a.name, b);
+    }
+    bool operator()(const char* a, const HashedName& b) const
+    {
+        return operator()(a, b.name);
+    }
 };
 
 /** This class implements an interface to add properties at run-time to an object
@@ -75,6 +99,8 @@ public:
     void getPropertyMap(std::map<std::string, Property*>& Map) const;
     /// Find a dynamic property by its name
     Property* getDynamicPropertyByName(const char* name) const;
+    /// Find a dynamic property by its name with a precomputed hash
+    Property* getDynamicPropertyByName(const HashedName& name) const;
     /*!
       Add a dynamic property of the type @a type and with the name @a name.
       @a Group gives the grouping name which appears in the property editor and
@@ -142,6 +168,9 @@ public:
     /// Get property count
     size_t size() const;
 
+    /// Get the number of additions, removals and renames of properties
+    unsigned getChangeCount() const;
+
     void save(const Property* prop, Base::Writer& writer) const;
 
     Property* restore(PropertyContainer& pc,
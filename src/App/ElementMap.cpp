@@ -1,10 +1,14 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
+#include <algorithm>
+#include <set>
+#include <sstream>
 #include <unordered_map>
 #ifndef FC_DEBUG
 #include <random>
 #endif
 
+#include "CompactStream.h"
 #include "ElementMap.h"
 #include "ElementNamingUtils.h"
 
@@ -107,8 +111,8 @@ void ElementMap::beforeSave(const ::App::StringHasherRef& hasherRef) const
 
 void ElementMap::save(std::ostream& stream,
                       int index,
-                      const std::map<const ElementMap*, int>& childMapSet,
-                      const std::map<QByteArray, int>& postfixMap) const
+                      const std::unordered_map<const ElementMap*, int>& childMapSet,
+                      const QHash<QByteArray, int>& postfixMap) const
 {
     stream << "\nElementMap " << index << ' ' << this->_id << ' ' << this->indexedNames.size()
            << '\n';
@@ -164,7 +168,7 @@ void ElementMap::save(std::ostream& stream,
                                                        static_cast<int>(qstrlen(idx.getType())));
                     auto it = postfixMap.find(key);
                     if (it != postfixMap.end()) {
-                        stream << ':' << it->second << '.' << idx.getIndex();
+                        stream << ':' << it.value() << '.' << idx.getIndex();
                         printName = false;
                     }
                 }
@@ -197,7 +201,7 @@ void ElementMap::save(std::ostream& stream,
                 else {
                     auto it = postfixMap.find(postfix);
                     assert(it != postfixMap.end());
-                    stream << '.' << it->second;
+                    stream << '.' << it.value();
                 }
                 for (auto& sid : ref->sids) {
                     if (sid.isMarked() && sid.value() != prefixID.id) {
@@ -215,9 +219,9 @@ void ElementMap::save(std::ostream& stream,
 
 void ElementMap::save(std::ostream& stream) const
 {
-    std::map<const ElementMap*, int> childMapSet;
+    std::unordered_map<const ElementMap*, int> childMapSet;
     std::vector<const ElementMap*> childMaps;
-    std::map<QByteArray, int> postfixMap;
+    QHash<QByteArray, int> postfixMap;
     std::vector<QByteArray> postfixes;
 
     collectChildMaps(childMapSet, childMaps, postfixMap, postfixes);
@@ -386,6 +390,7 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef,
         stream >> std::hex;
 
         indices.names.resize(outerCount);
+        this->mappedNames.reserve(this->mappedNames.size() + outerCount);
         for (int j = 0; j < outerCount; ++j) {
             idx.setIndex(j);
             auto* ref = &indices.names[j];
@@ -448,7 +453,7 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef,
                     }
                 }
 
-                this->mappedNames.emplace(ref->name, idx);
+                this->mappedNames.insert(ref->name, idx);
 
                 if (!hasherRef) {
                     if (offset + 1 < (int)tokens.size()) {
@@ -500,6 +505,390 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef,
     return shared_from_this();
 }
 
+namespace
+{
+// How a mapped name is stored in the binary format, see the markers ':', '$' and ';' of the text
+// format
+enum class NameEncoding : std::uint8_t
+{
+    PostfixIndexed = 0,
+    PrefixID = 1,
+    Plain = 2,
+};
+}  // namespace
+
+void ElementMap::saveBinary(std::ostream& stream) const
+{
+    std::unordered_map<const ElementMap*, int> childMapSet;
+    std::vector<const ElementMap*> childMaps;
+    QHash<QByteArray, int> postfixMap;
+    std::vector<QByteArray> postfixes;
+
+    collectChildMaps(childMapSet, childMaps, postfixMap, postfixes);
+
+    ::App::CompactOutputStream out(stream);
+    out.writeUInt(this->_id);
+    out.writeUInt(postfixes.size());
+    for (auto& postfix : postfixes) {
+        out.writeString(std::string_view(postfix.constData(), postfix.size()));
+    }
+
+    // Each map is written as a block of its own, so that a map that is already restored can be
+    // skipped without parsing it.
+    int index = 0;
+    out.writeUInt(childMaps.size());
+    for (auto& elementMap : childMaps) {
+        std::ostringstream block;
+        ::App::CompactOutputStream blockOut(block);
+        elementMap->saveBinary(blockOut, childMapSet, postfixMap);
+        out.writeUInt(++index);
+        out.writeUInt(elementMap->_id);
+        out.writeBytes(block.str());
+    }
+}
+
+void ElementMap::saveBinary(::App::CompactOutputStream& stream,
+                            const std::unordered_map<const ElementMap*, int>& childMapSet,
+                            const QHash<QByteArray, int>& postfixMap) const
+{
+    stream.writeUInt(this->indexedNames.size());
+    for (auto& indexedName : this->indexedNames) {
+        stream.writeString(indexedName.first);
+
+        stream.writeUInt(indexedName.second.children.size());
+        for (auto& vv : indexedName.second.children) {
+            auto& child = vv.second;
+            int mapIndex = 0;
+            if (child.elementMap) {
+                auto it = childMapSet.find(child.elementMap.get());
+                if (it == childMapSet.end() || it->second == 0) {
+                    FC_ERR("Invalid child element map");  // NOLINT
+                }
+                else {
+                    mapIndex = it->second;
+                }
+            }
+            stream.writeUInt(child.indexedName.getIndex());
+            stream.writeInt(child.offset);
+            stream.writeInt(child.count);
+            stream.writeInt(child.tag);
+            stream.writeUInt(mapIndex);
+            stream.writeBytes(std::string_view(child.postfix.constData(), child.postfix.size()));
+
+            auto marked = std::count_if(child.sids.begin(), child.sids.end(), [](auto& sid) {
+                return sid.isMarked();
+            });
+            stream.writeUInt(marked);
+            for (auto& sid : child.sids) {
+                if (sid.isMarked()) {
+                    stream.writeInt(sid.value());
+                }
+            }
+        }
+
+        stream.writeUInt(indexedName.second.names.size());
+        for (auto& dequeueOfMappedNameRef : indexedName.second.names) {
+            std::size_t count = 0;
+            for (auto ref = &dequeueOfMappedNameRef; ref && ref->name; ref = ref->next.get()) {
+                ++count;
+            }
+            stream.writeUInt(count);
+
+            for (auto ref = &dequeueOfMappedNameRef; ref && ref->name; ref = ref->next.get()) {
+                ::App::StringID::IndexID prefixID {};
+                prefixID.id = 0;
+                IndexedName idx(ref->name.dataBytes());
+                const QByteArray& data = ref->name.dataBytes();
+                NameEncoding encoding = NameEncoding::Plain;
+                if (idx) {
+                    auto key = QByteArray::fromRawData(idx.getType(),
+                                                       static_cast<int>(qstrlen(idx.getType())));
+                    auto it = postfixMap.find(key);
+                    if (it != postfixMap.end()) {
+                        encoding = NameEncoding::PostfixIndexed;
+                        stream.writeUInt(static_cast<std::uint8_t>(encoding));
+                        stream.writeUInt(it.value());
+                        stream.writeUInt(idx.getIndex());
+                    }
+                }
+                else {
+                    prefixID = ::App::StringID::fromString(data);
+                    if (prefixID.id != 0) {
+                        auto isPrefix = [&prefixID](auto& sid) {
+                            return sid.isMarked() && sid.value() == prefixID.id;
+                        };
+                        auto found = std::find_if(ref->sids.begin(), ref->sids.end(), isPrefix);
+                        if (found != ref->sids.end()) {
+                            encoding = NameEncoding::PrefixID;
+                        }
+                        else {
+                            prefixID.id = 0;
+                        }
+                    }
+                }
+                if (encoding != NameEncoding::PostfixIndexed) {
+                    stream.writeUInt(static_cast<std::uint8_t>(encoding));
+                    stream.writeString(std::string_view(data.constData(), data.size()));
+                }
+
+                const QByteArray& postfix = ref->name.postfixBytes();
+                if (postfix.isEmpty()) {
+                    stream.writeUInt(0);
+                }
+                else {
+                    auto it = postfixMap.find(postfix);
+                    assert(it != postfixMap.end());
+                    stream.writeUInt(it.value());
+                }
+
+                auto written = std::count_if(ref->sids.begin(), ref->sids.end(), [&](auto& sid) {
+                    return sid.isMarked() && sid.value() != prefixID.id;
+                });
+                stream.writeUInt(written);
+                for (auto& sid : ref->sids) {
+                    if (sid.isMarked() && sid.value() != prefixID.id) {
+                        stream.writeInt(sid.value());
+                    }
+                }
+            }
+        }
+    }
+}
+
+ElementMapPtr ElementMap::restoreBinary(::App::StringHasherRef hasherRef,
+                                        ::App::CompactInputStream& stream)
+{
+    const char* msg = "Invalid element map";
+
+    auto id = static_cast<unsigned>(stream.readUInt());
+    auto& map = _idToElementMap[id];
+    if (map) {
+        return map;
+    }
+
+    // every entry takes at least one byte, which limits the counts of corrupted data
+    std::uint64_t count = stream.readUInt();
+    if (count > stream.remaining()) {
+        FC_THROWM(Base::RuntimeError, msg);  // NOLINT
+    }
+    std::vector<std::string> postfixes;
+    postfixes.reserve(count);
+    for (std::uint64_t i = 0; i < count; ++i) {
+        postfixes.emplace_back(stream.readString());
+    }
+
+    std::uint64_t mapCount = stream.readUInt();
+    if (mapCount == 0 || mapCount > stream.remaining()) {
+        FC_THROWM(Base::RuntimeError, msg);  // NOLINT
+    }
+
+    std::vector<ElementMapPtr> childMaps;
+    childMaps.reserve(mapCount - 1);
+    for (std::uint64_t i = 0; i < mapCount; ++i) {
+        auto index = static_cast<int>(stream.readUInt());
+        auto mapId = static_cast<unsigned>(stream.readUInt());
+        std::string_view block = stream.readBytes();
+        if (index != static_cast<int>(i + 1)) {
+            FC_THROWM(Base::RuntimeError, msg);  // NOLINT
+        }
+
+        ::App::CompactInputStream blockStream(block);
+        if (i + 1 == mapCount) {
+            return restoreBinary(hasherRef, blockStream, index, childMaps, postfixes);
+        }
+
+        auto existing = _idToElementMap.find(mapId);
+        if (existing != _idToElementMap.end() && existing->second) {
+            childMaps.push_back(existing->second);
+        }
+        else {
+            childMaps.push_back(std::make_shared<ElementMap>()->restoreBinary(hasherRef,
+                                                                              blockStream,
+                                                                              index,
+                                                                              childMaps,
+                                                                              postfixes));
+        }
+    }
+
+    return shared_from_this();
+}
+
+ElementMapPtr ElementMap::restoreBinary(::App::StringHasherRef hasherRef,
+                                        ::App::CompactInputStream& stream,
+                                        int index,
+                                        std::vector<ElementMapPtr>& childMaps,
+                                        const std::vector<std::string>& postfixes)
+{
+    const char* msg = "Invalid element map";
+    constexpr std::uint64_t maxTypeCount(1000);
+    std::uint64_t typeCount = stream.readUInt();
+    if (typeCount > maxTypeCount) {
+        FC_THROWM(Base::RuntimeError, "Bad type count in element map, ignoring map");  // NOLINT
+    }
+
+    const char* hasherWarn = nullptr;
+    const char* hasherIDWarn = nullptr;
+    const char* postfixWarn = nullptr;
+    const char* childSIDWarn = nullptr;
+
+    auto readCount = [&stream, msg]() {
+        std::uint64_t count = stream.readUInt();
+        if (count > stream.remaining()) {
+            FC_THROWM(Base::RuntimeError, msg);  // NOLINT
+        }
+        return static_cast<int>(count);
+    };
+
+    auto getID = [&](long id, const char*& warning, const char* text) {
+        ::App::StringIDRef sid;
+        if (!hasherRef) {
+            hasherWarn = "No hasherRef";
+        }
+        else if (!(sid = hasherRef->getID(id))) {
+            warning = text;
+        }
+        return sid;
+    };
+
+    for (std::uint64_t i = 0; i < typeCount; ++i) {
+        std::string type(stream.readString());
+        IndexedName idx(type.c_str(), 1);
+        auto& indices = this->indexedNames[idx.getType()];
+
+        int childCount = readCount();
+        for (int j = 0; j < childCount; ++j) {
+            auto cIndex = static_cast<int>(stream.readUInt());
+            auto offset = static_cast<int>(stream.readInt());
+            auto count = static_cast<int>(stream.readInt());
+            auto tag = static_cast<long>(stream.readInt());
+            auto mapIndex = static_cast<int>(stream.readUInt());
+            std::string_view postfix = stream.readBytes();
+            if (cIndex < 0) {
+                FC_THROWM(Base::RuntimeError, "Invalid element child index");  // NOLINT
+            }
+            if (offset < 0) {
+                FC_THROWM(Base::RuntimeError, "Invalid element child offset");  // NOLINT
+            }
+            if (mapIndex >= index || mapIndex < 0 || mapIndex > (int)childMaps.size()) {
+                FC_THROWM(Base::RuntimeError, "Invalid element child map index");  // NOLINT
+            }
+            auto& child = indices.children[cIndex + offset + count];
+            child.indexedName = IndexedName::fromConst(idx.getType(), cIndex);
+            child.offset = offset;
+            child.count = count;
+            child.tag = tag;
+            if (mapIndex > 0) {
+                child.elementMap = childMaps[mapIndex - 1];
+            }
+            else {
+                child.elementMap = nullptr;
+            }
+            child.postfix = QByteArray(postfix.data(), static_cast<int>(postfix.size()));
+            this->childElements[child.postfix].childMap = &child;
+            this->childElementSize += child.count;
+
+            int sidCount = readCount();
+            child.sids.reserve(sidCount);
+            for (int k = 0; k < sidCount; ++k) {
+                auto sid = getID(static_cast<long>(stream.readInt()),
+                                 childSIDWarn,
+                                 "Missing element child string id");
+                if (sid) {
+                    child.sids.push_back(sid);
+                }
+            }
+        }
+
+        int nameCount = readCount();
+        indices.names.resize(nameCount);
+        this->mappedNames.reserve(this->mappedNames.size() + nameCount);
+        for (int j = 0; j < nameCount; ++j) {
+            idx.setIndex(j);
+            auto* ref = &indices.names[j];
+            int innerCount = readCount();
+            for (int k = 0; k < innerCount; ++k) {
+                if (k != 0) {
+                    ref->next = std::make_unique<MappedNameRef>();
+                    ref = ref->next.get();
+                }
+
+                ::App::StringID::IndexID prefixID {};
+                prefixID.id = 0;
+
+                switch (static_cast<NameEncoding>(stream.readUInt())) {
+                    case NameEncoding::PostfixIndexed: {
+                        std::uint64_t elementNameIndex = stream.readUInt();
+                        auto elementIndex = static_cast<int>(stream.readUInt());
+                        if (elementNameIndex == 0 || elementNameIndex > postfixes.size()) {
+                            FC_THROWM(Base::RuntimeError, "Invalid element name index");  // NOLINT
+                        }
+                        ref->name = MappedName(IndexedName::fromConst(
+                            postfixes[elementNameIndex - 1].c_str(),
+                            elementIndex));
+                        break;
+                    }
+                    case NameEncoding::PrefixID: {
+                        std::string_view name = stream.readString();
+                        ref->name = MappedName(name.data(), static_cast<int>(name.size()));
+                        prefixID = ::App::StringID::fromString(ref->name.dataBytes());
+                        break;
+                    }
+                    case NameEncoding::Plain: {
+                        std::string_view name = stream.readString();
+                        ref->name = MappedName(name.data(), static_cast<int>(name.size()));
+                        break;
+                    }
+                    default:
+                        FC_THROWM(Base::RuntimeError, "Invalid element name marker");  // NOLINT
+                }
+
+                std::uint64_t postfixIndex = stream.readUInt();
+                if (postfixIndex != 0) {
+                    if (postfixIndex > postfixes.size()) {
+                        postfixWarn = "Invalid element postfix index";
+                    }
+                    else {
+                        ref->name += postfixes[postfixIndex - 1];
+                    }
+                }
+
+                this->mappedNames.insert(ref->name, idx);
+
+                int sidCount = readCount();
+                ref->sids.reserve(sidCount + (prefixID.id != 0 ? 1 : 0));
+                if (prefixID.id != 0) {
+                    auto sid = getID(prefixID.id, hasherIDWarn, "Missing element name prefix id");
+                    if (sid) {
+                        ref->sids.push_back(sid);
+                    }
+                }
+                for (int l = 0; l < sidCount; ++l) {
+                    auto sid = getID(static_cast<long>(stream.readInt()),
+                                     hasherIDWarn,
+                                     "Invalid element name string id");
+                    if (sid) {
+                        ref->sids.push_back(sid);
+                    }
+                }
+            }
+        }
+    }
+    if (hasherWarn) {
+        FC_WARN(hasherWarn);  // NOLINT
+    }
+    if (hasherIDWarn) {
+        FC_WARN(hasherIDWarn);  // NOLINT
+    }
+    if (postfixWarn) {
+        FC_WARN(postfixWarn);  // NOLINT
+    }
+    if (childSIDWarn) {
+        FC_WARN(childSIDWarn);  // NOLINT
+    }
+
+    return shared_from_this();
+}
+
 MappedName ElementMap::addName(MappedName& name,
                                const IndexedName& idx,
                                const ElementIDRefs& sids,
@@ -515,40 +904,40 @@ MappedName ElementMap::addName(MappedName& name,
         if (overwrite) {
             erase(idx);
         }
-        auto ret = mappedNames.insert(std::make_pair(name, idx));
-        if (ret.second) {                // element just inserted did not exist yet in the map
-            ret.first->first.compact();  // FIXME see MappedName.cpp
-            mappedRef(idx).append(ret.first->first, sids);
+        auto ret = mappedNames.insert(name, idx);
+        if (ret.second) {               // element just inserted did not exist yet in the map
+            ret.first->name.compact();  // FIXME see MappedName.cpp
+            MappedName inserted = ret.first->name;
+            mappedRef(idx).append(inserted, sids);
             FC_TRACE(idx << " -> " << name);  // NOLINT
-            return ret.first->first;
+            return inserted;
         }
-        if (ret.first->second == idx) {
+        if (ret.first->index == idx) {
             FC_TRACE("duplicate " << idx << " -> " << name);  // NOLINT
-            return ret.first->first;
+            return ret.first->name;
         }
         if (!overwrite) {
             if (existing) {
-                *existing = ret.first->second;
+                *existing = ret.first->index;
             }
             return {};
         }
 
-        erase(ret.first->first);
+        // copy the name as erasing moves the entries of the index
+        MappedName duplicate = ret.first->name;
+        erase(duplicate);
     };
 }
 
 void ElementMap::addPostfix(const QByteArray& postfix,
-                            std::map<QByteArray, int>& postfixMap,
+                            QHash<QByteArray, int>& postfixMap,
                             std::vector<QByteArray>& postfixes)
 {
-    if (postfix.isEmpty()) {
+    if (postfix.isEmpty() || postfixMap.contains(postfix)) {
         return;
     }
-    auto res = postfixMap.insert(std::make_pair(postfix, 0));
-    if (res.second) {
-        postfixes.push_back(postfix);
-        res.first->second = (int)postfixes.size();
-    }
+    postfixes.push_back(postfix);
+    postfixMap.insert(postfix, (int)postfixes.size());
 }
 
 MappedName ElementMap::setElementName(const IndexedName& element,
@@ -783,16 +1172,16 @@ MappedName ElementMap::renameDuplicateElement(int index,
 
 void ElementMap::erase(const MappedName& name)
 {
-    auto it = this->mappedNames.find(name);
-    if (it == this->mappedNames.end()) {
+    const auto* entry = this->mappedNames.find(name);
+    if (!entry) {
         return;
     }
-    MappedNameRef* ref = findMappedRef(it->second);
+    MappedNameRef* ref = findMappedRef(entry->index);
     if (!ref) {
         return;
     }
     ref->erase(name);
-    this->mappedNames.erase(it);
+    this->mappedNames.erase(name);
 }
 
 void ElementMap::erase(const IndexedName& idx)
@@ -817,6 +1206,49 @@ unsigned long ElementMap::size() const
     return mappedNames.size() + childElementSize;
 }
 
+std::size_t ElementMap::getMemSize() const
+{
+    // estimated overhead of a node of std::map and of a heap allocation
+    constexpr std::size_t nodeSize = 4 * sizeof(void*);
+
+    std::set<const ElementMap*> visited;
+    std::vector<const ElementMap*> pending {this};
+    std::size_t size = 0;
+    while (!pending.empty()) {
+        const ElementMap* map = pending.back();
+        pending.pop_back();
+        if (!visited.insert(map).second) {
+            continue;
+        }
+
+        size += sizeof(ElementMap) + map->mappedNames.getMemSize();
+        for (const auto& [type, elements] : map->indexedNames) {
+            size += nodeSize + sizeof(IndexedElements);
+            size += elements.names.size() * sizeof(MappedNameRef);
+            for (const auto& ref : elements.names) {
+                for (auto name = &ref; name; name = name->next.get()) {
+                    if (name != &ref) {
+                        size += nodeSize + sizeof(MappedNameRef);
+                    }
+                    size += static_cast<std::size_t>(name->name.size())
+                        + static_cast<std::size_t>(name->sids.size()) * sizeof(StringIDRef);
+                }
+            }
+            for (const auto& [index, child] : elements.children) {
+                size += nodeSize + sizeof(MappedChildElements)
+                    + static_cast<std::size_t>(child.postfix.size())
+                    + static_cast<std::size_t>(child.sids.size()) * sizeof(StringIDRef);
+                if (child.elementMap) {
+                    pending.push_back(child.elementMap.get());
+                }
+            }
+        }
+        size += static_cast<std::size_t>(map->childElements.size())
+            * (nodeSize + sizeof(ChildMapInfo));
+    }
+    return size;
+}
+
 bool ElementMap::empty() const
 {
     return mappedNames.empty() && childElementSize == 0;
@@ -824,8 +1256,8 @@ bool ElementMap::empty() const
 
 IndexedName ElementMap::find(const MappedName& name, ElementIDRefs* sids) const
 {
-    auto nameIter = mappedNames.find(name);
-    if (nameIter == mappedNames.end()) {
+    const auto* nameIter = mappedNames.find(name);
+    if (!nameIter) {
         if (childElements.isEmpty()) {
             return IndexedName();
         }
@@ -862,7 +1294,7 @@ IndexedName ElementMap::find(const MappedName& name, ElementIDRefs* sids) const
     }
 
     if (sids) {
-        const MappedNameRef* ref = findMappedRef(nameIter->second);
+        const MappedNameRef* ref = findMappedRef(nameIter->index);
         for (; ref; ref = ref->next.get()) {
             if (ref->name == name) {
                 if (sids->empty()) {
@@ -875,7 +1307,7 @@ IndexedName ElementMap::find(const MappedName& name, ElementIDRefs* sids) const
             }
         }
     }
-    return nameIter->second;
+    return nameIter->index;
 }
 
 MappedName ElementMap::find(const IndexedName& idx, ElementIDRefs* sids) const
@@ -1054,9 +1486,9 @@ void ElementMap::hashChildMaps(long masterTag)
     }
 }
 
-void ElementMap::collectChildMaps(std::map<const ElementMap*, int>& childMapSet,
+void ElementMap::collectChildMaps(std::unordered_map<const ElementMap*, int>& childMapSet,
                                   std::vector<const ElementMap*>& childMaps,
-                                  std::map<QByteArray, int>& postfixMap,
+                                  QHash<QByteArray, int>& postfixMap,
                                   std::vector<QByteArray>& postfixes) const
 {
     auto res = childMapSet.insert(std::make_pair(this, 0));
@@ -1078,8 +1510,32 @@ void ElementMap::collectChildMaps(std::map<const ElementMap*, int>& childMapSet,
         }
     }
 
-    for (auto& mappedName : this->mappedNames) {
-        addPostfix(mappedName.first.constPostfix(), postfixMap, postfixes);
+    // Number the postfixes in the order of the smallest name using them, as when iterating
+    // a sorted map, so the saved map doesn't depend on the order of the hash index
+    QHash<QByteArray, const MappedName*> firstUse;
+    for (const auto& entry : this->mappedNames) {
+        const QByteArray& postfix = entry.name.postfixBytes();
+        if (postfix.isEmpty() || postfixMap.contains(postfix)) {
+            continue;
+        }
+        auto it = firstUse.find(postfix);
+        if (it == firstUse.end()) {
+            firstUse.insert(postfix, &entry.name);
+        }
+        else if (entry.name < *it.value()) {
+            it.value() = &entry.name;
+        }
+    }
+    std::vector<std::pair<const MappedName*, QByteArray>> newPostfixes;
+    newPostfixes.reserve(firstUse.size());
+    for (auto it = firstUse.cbegin(); it != firstUse.cend(); ++it) {
+        newPostfixes.emplace_back(it.value(), it.key());
+    }
+    std::sort(newPostfixes.begin(), newPostfixes.end(), [](const auto& a, const auto& b) {
+        return *a.first < *b.first;
+    });
+    for (const auto& it : newPostfixes) {
+        addPostfix(it.second, postfixMap, postfixes);
     }
 
     childMaps.push_back(this);
@@ -1309,8 +1765,8 @@ std::vector<MappedElement> ElementMap::getAll() const
 {
     std::vector<MappedElement> ret;
     ret.reserve(size());
-    for (auto& mappedName : this->mappedNames) {
-        ret.emplace_back(mappedName.first, mappedName.second);
+    for (const auto* entry : this->mappedNames.sorted()) {
+        ret.emplace_back(entry->name, entry->index);
     }
     for (auto& childElement : this->childElements) {
         auto& child = *childElement.childMap;
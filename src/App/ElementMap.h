@@ -29,6 +29,7 @@
 
 #include "Application.h"
 #include "MappedElement.h"
+#include "MappedNameIndex.h"
 #include "StringHasher.h"
 
 #include <cstring>
@@ -36,6 +37,13 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <unordered_map>
+
+namespace App
+{
+class CompactInputStream;
+class CompactOutputStream;
+}  // namespace App
 
 
 namespace Data
@@ -127,6 +135,25 @@ public:
      */
     ElementMapPtr restore(::App::StringHasherRef hasherRef, std::istream& stream);
 
+    /**
+     * @brief Serialize this map in the compact binary format.
+     *
+     * Stores the same information as save() but integers are variable length encoded and each
+     * name only stores the part that differs from the previous name.
+     *
+     * @param[in,out] stream The stream to serialize to.
+     */
+    void saveBinary(std::ostream& stream) const;
+
+    /**
+     * @brief Deserialize and restore this map from the compact binary format.
+     *
+     * @param[in] hasherRef Where all the StringIDs are stored.
+     * @param[in,out] stream The data written by saveBinary().
+     */
+    ElementMapPtr restoreBinary(::App::StringHasherRef hasherRef,
+                                ::App::CompactInputStream& stream);
+
     /**
      * @brief Add a sub-element name mapping.
      *
@@ -188,6 +215,15 @@ public:
     /// Get the size of the map.
     unsigned long size() const;
 
+    /**
+     * @brief Estimate the memory used by the map in bytes.
+     *
+     * Child maps are included, each of them is counted once even if it is
+     * referenced several times. Strings shared with the string hasher are
+     * counted here as well.
+     */
+    std::size_t getMemSize() const;
+
     /// Check if the map is empty.
     bool empty() const;
 
@@ -315,8 +351,8 @@ private:
      */
     void save(std::ostream& stream,
               int index,
-              const std::map<const ElementMap*, int>& childMapSet,
-              const std::map<QByteArray, int>& postfixMap) const;
+              const std::unordered_map<const ElementMap*, int>& childMapSet,
+              const QHash<QByteArray, int>& postfixMap) const;
 
     /** Deserialize and restore this map.
      * @param hasherRef: where all the StringIDs are stored
@@ -329,6 +365,18 @@ private:
                           std::vector<ElementMapPtr>& childMaps,
                           const std::vector<std::string>& postfixes);
 
+    /// Binary counterpart of the private save()
+    void saveBinary(::App::CompactOutputStream& stream,
+                    const std::unordered_map<const ElementMap*, int>& childMapSet,
+                    const QHash<QByteArray, int>& postfixMap) const;
+
+    /// Binary counterpart of the private restore()
+    ElementMapPtr restoreBinary(::App::StringHasherRef hasherRef,
+                                ::App::CompactInputStream& stream,
+                                int index,
+                                std::vector<ElementMapPtr>& childMaps,
+                                const std::vector<std::string>& postfixes);
+
     /** Associate the MappedName \c name with the IndexedName \c idx.
      * @param name: the name to add
      * @param idx: the indexed name that \c name will be bound to
@@ -348,7 +396,7 @@ private:
      * if it was not present in the map.
      */
     static void addPostfix(const QByteArray& postfix,
-                           std::map<QByteArray, int>& postfixMap,
+                           QHash<QByteArray, int>& postfixMap,
                            std::vector<QByteArray>& postfixes);
 
     /* Note: the original proc passed `ComplexGeoData& master` for getting the `Tag`,
@@ -377,9 +425,9 @@ private:
 
     MappedNameRef& mappedRef(const IndexedName& idx);
 
-    void collectChildMaps(std::map<const ElementMap*, int>& childMapSet,
+    void collectChildMaps(std::unordered_map<const ElementMap*, int>& childMapSet,
                           std::vector<const ElementMap*>& childMaps,
-                          std::map<QByteArray, int>& postfixMap,
+                          QHash<QByteArray, int>& postfixMap,
                           std::vector<QByteArray>& postfixes) const;
 
     struct CStringComp
@@ -399,7 +447,7 @@ private:
 
     std::map<const char*, IndexedElements, CStringComp> indexedNames;
 
-    std::map<MappedName, IndexedName, std::less<>> mappedNames;
+    MappedNameIndex mappedNames;
 
     struct ChildMapInfo
     {
@@ -38,6 +38,8 @@
 
 #include <numbers>
 #include <limits>
+#include <map>
+#include <memory>
 #include <sstream>
 #include <stack>
 #include <string>
@@ -657,6 +659,180 @@ Expression* expressionFromPy(const DocumentObject *owner, const Py::Object &valu
     return new PyObjectExpression(owner,value.ptr());
 }
 
+/**
+ * Value of the numeric evaluation. The types and the arithmetic follow the
+ * Python evaluation: dimensionless integral numbers are integers, integer
+ * arithmetic stays integral except for the true division, and any operation
+ * involving a quantity gives a quantity. Whatever would raise a Python
+ * exception (unit mismatch, division by zero, integer overflow) is left to
+ * the Python evaluation, so the error messages do not change.
+ */
+struct Expression::NumericValue
+{
+    enum Type
+    {
+        IntegerValue,
+        FloatValue,
+        QuantityValue,
+    };
+
+    Type type = IntegerValue;
+    long integer = 0;
+    double real = 0.0;
+    Quantity quantity;
+
+    // same as pyFromQuantity()
+    void set(const Quantity &q) {
+        if (!q.isDimensionless()) {
+            type = QuantityValue;
+            quantity = q;
+            return;
+        }
+        int i;
+        switch(essentiallyInteger(q.getValue(),integer,i)) {
+        case 1:
+        case 2:
+            type = IntegerValue;
+            break;
+        default:
+            type = FloatValue;
+            real = q.getValue();
+        }
+    }
+
+    double toDouble() const {
+        return type == IntegerValue ? static_cast<double>(integer) : real;
+    }
+
+    Quantity toQuantity() const {
+        return type == QuantityValue ? quantity : Quantity(toDouble());
+    }
+
+    App::any toAny() const {
+        switch(type) {
+        case IntegerValue:
+            return App::any(integer);
+        case FloatValue:
+            return App::any(real);
+        default:
+            return App::any(quantity);
+        }
+    }
+
+    bool negate() {
+        switch(type) {
+        case IntegerValue:
+            if (integer == std::numeric_limits<long>::min())
+                return false;
+            integer = -integer;
+            break;
+        case FloatValue:
+            real = -real;
+            break;
+        default:
+            quantity = quantity * -1.0;
+        }
+        return true;
+    }
+
+    bool apply(int op, const NumericValue &other) {
+        if (type == QuantityValue || other.type == QuantityValue)
+            return applyQuantity(op, toQuantity(), other.toQuantity());
+        if (type == FloatValue || other.type == FloatValue)
+            return applyFloat(op, toDouble(), other.toDouble());
+        return applyInteger(op, integer, other.integer);
+    }
+
+private:
+    bool applyQuantity(int op, const Quantity &l, const Quantity &r) {
+        try {
+            switch(op) {
+            case OperatorExpression::ADD:
+                if (l.getUnit() != r.getUnit())
+                    return false;
+                quantity = l + r;
+                break;
+            case OperatorExpression::SUB:
+                if (l.getUnit() != r.getUnit())
+                    return false;
+                quantity = l - r;
+                break;
+            case OperatorExpression::MUL:
+            case OperatorExpression::UNIT:
+                quantity = l * r;
+                break;
+            case OperatorExpression::DIV:
+                quantity = l / r;
+                break;
+            default:
+                return false;
+            }
+        }
+        catch (Base::Exception &) {
+            return false;
+        }
+        type = QuantityValue;
+        return true;
+    }
+
+    bool applyFloat(int op, double l, double r) {
+        switch(op) {
+        case OperatorExpression::ADD:
+            real = l + r;
+            break;
+        case OperatorExpression::SUB:
+            real = l - r;
+            break;
+        case OperatorExpression::MUL:
+        case OperatorExpression::UNIT:
+            real = l * r;
+            break;
+        case OperatorExpression::DIV:
+            if (r == 0.0)
+                return false;
+            real = l / r;
+            break;
+        default:
+            return false;
+        }
+        type = FloatValue;
+        return true;
+    }
+
+    bool applyInteger(int op, long l, long r) {
+        constexpr long min = std::numeric_limits<long>::min();
+        constexpr long max = std::numeric_limits<long>::max();
+        switch(op) {
+        case OperatorExpression::ADD:
+            if ((r > 0 && l > max - r) || (r < 0 && l < min - r))
+                return false;
+            integer = l + r;
+            return true;
+        case OperatorExpression::SUB:
+            if ((r < 0 && l > max + r) || (r > 0 && l < min + r))
+                return false;
+            integer = l - r;
+            return true;
+        case OperatorExpression::MUL:
+        case OperatorExpression::UNIT:
+            if (l > 0 ? (r > 0 ? l > max / r : r < min / l)
+                      : (r > 0 ? l < min / r : (l != 0 && r < max / l)))
+                return false;
+            integer = l * r;
+            return true;
+        case OperatorExpression::DIV: {
+            // Python rounds the true division of big integers differently
+            constexpr long long exact = 1LL << std::numeric_limits<double>::digits;
+            if (r == 0 || l > exact || l < -exact || r > exact || r < -exact)
+                return false;
+            return applyFloat(op, static_cast<double>(l), static_cast<double>(r));
+        }
+        default:
+            return false;
+        }
+    }
+};
+
 } // namespace App
 
 //
@@ -1105,10 +1281,19 @@ ExpressionPtr Expression::replaceObject(const DocumentObject *parent,
 }
 
 App::any Expression::getValueAsAny() const {
+    NumericValue value;
+    if (getNumericValue(value))
+        return value.toAny();
     Base::PyGILStateLocker lock;
     return pyObjectToAny(getPyValue());
 }
 
+bool Expression::getNumericValue(NumericValue &value) const {
+    if (!components.empty())
+        return false;
+    return _getNumericValue(value);
+}
+
 Py::Object Expression::getPyValue() const {
     try {
         Py::Object pyobj = _getPyValue();
@@ -1136,10 +1321,19 @@ void Expression::visit(ExpressionVisitor &v) {
 }
 
 Expression* Expression::eval() const {
+    if (Expression *result = evalNumeric())
+        return result;
     Base::PyGILStateLocker lock;
     return expressionFromPy(owner,getPyValue());
 }
 
+Expression* Expression::evalNumeric() const {
+    NumericValue value;
+    if (getNumericValue(value))
+        return new NumberExpression(owner,value.toQuantity());
+    return nullptr;
+}
+
 bool Expression::isSame(const Expression &other, bool checkComment) const {
     if(&other == this)
         return true;
@@ -1244,6 +1438,11 @@ Py::Object UnitExpression::_getPyValue() const {
     return Py::Object(cache);
 }
 
+bool UnitExpression::_getNumericValue(NumericValue &value) const {
+    value.set(quantity);
+    return true;
+}
+
 //
 // NumberExpression class
 //
@@ -1436,6 +1635,28 @@ Py::Object OperatorExpression::_getPyValue() const {
     return calc(this,op,left,right,false);
 }
 
+bool OperatorExpression::_getNumericValue(NumericValue &value) const {
+    switch(op) {
+    case POS:
+        return left->getNumericValue(value);
+    case NEG:
+        return left->getNumericValue(value) && value.negate();
+    case ADD:
+    case SUB:
+    case MUL:
+    case DIV:
+    case UNIT: {
+        NumericValue other;
+        return left->getNumericValue(value)
+            && right->getNumericValue(other)
+            && value.apply(op,other);
+    }
+    default:
+        // comparisons, power and modulo are left to Python
+        return false;
+    }
+}
+
 Expression *OperatorExpression::simplify() const
 {
     Expression * v1 = left->simplify();
@@ -1944,8 +2165,60 @@ public:
     }
 };
 
+/**
+ * Result of an aggregate function over cell ranges, together with the cell
+ * properties it was computed from.
+ */
+struct FunctionExpression::AggregateCache {
+    const DocumentObject *owner = nullptr;
+    std::vector<std::pair<CellAddress, CellAddress>> ranges;
+    unsigned propertyChanges = 0;
+    std::vector<std::pair<const Property*, unsigned>> inputs;
+    Quantity result;
+
+    bool isValid(const DocumentObject *obj,
+                 const std::vector<std::pair<CellAddress, CellAddress>> &other) const
+    {
+        // A changed set of dynamic properties may resolve the cells to
+        // other properties, or have deleted the cached ones.
+        if(obj != owner || other != ranges
+                || obj->getDynamicPropertyChangeCount() != propertyChanges)
+            return false;
+        for(auto &input : inputs) {
+            if(input.first->getChangeCount() != input.second)
+                return false;
+        }
+        return true;
+    }
+};
+
+Py::Object FunctionExpression::evalCachedAggregate() const
+{
+    // Only aggregates over ranges are cached, other arguments may depend on anything
+    std::vector<std::pair<CellAddress, CellAddress>> ranges;
+    for(auto arg : args) {
+        if(!arg->isDerivedFrom<RangeExpression>())
+            return evalAggregate(this,f,args);
+        Range range(static_cast<const RangeExpression&>(*arg).getRange());
+        ranges.emplace_back(range.from(),range.to());
+    }
+
+    if(aggregateCache && aggregateCache->isValid(owner,ranges))
+        return pyFromQuantity(aggregateCache->result);
+
+    aggregateCache.reset();
+    auto cache = std::make_unique<AggregateCache>();
+    cache->owner = owner;
+    cache->ranges = std::move(ranges);
+    cache->propertyChanges = owner->getDynamicPropertyChangeCount();
+    Py::Object result = evalAggregate(this,f,args,cache.get());
+    aggregateCache = std::move(cache);
+    return result;
+}
+
 Py::Object FunctionExpression::evalAggregate(
-        const Expression *owner, int f, const std::vector<Expression*> &args)
+        const Expression *owner, int f, const std::vector<Expression*> &args,
+        AggregateCache *cache)
 {
     std::unique_ptr<Collector> c;
 
@@ -1991,6 +2264,8 @@ Py::Object FunctionExpression::evalAggregate(
                 if (!p)
                     continue;
 
+                if (cache)
+                    cache->inputs.emplace_back(p, p->getChangeCount());
                 if ((qp = freecad_cast<PropertyQuantity*>(p)))
                     c->collect(qp->getQuantityValue());
                 else if ((fp = freecad_cast<PropertyFloat*>(p)))
@@ -2008,7 +2283,10 @@ Py::Object FunctionExpression::evalAggregate(
         }
     }
 
-    return pyFromQuantity(c->getQuantity());
+    Quantity result = c->getQuantity();
+    if (cache)
+        cache->result = result;
+    return pyFromQuantity(result);
 }
 
 Base::Vector3d FunctionExpression::evaluateSecondVectorArgument(const Expression *expression, const std::vector<Expression*> &arguments)
@@ -2581,6 +2859,8 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
 }
 
 Py::Object FunctionExpression::_getPyValue() const {
+    if(f > AGGREGATES && owner)
+        return evalCachedAggregate();
     return evaluate(this,f,args);
 }
 
@@ -2868,6 +3148,29 @@ Py::Object VariableExpression::_getPyValue() const {
     return var.getPyValue(true);
 }
 
+bool VariableExpression::_getNumericValue(NumericValue &value) const {
+    // Only the types whose Python object is the plain number or quantity
+    auto prop = var.getPlainProperty();
+    if (!prop)
+        return false;
+    if (auto quantity = freecad_cast<PropertyQuantity*>(prop)) {
+        // a quantity property is a quantity even without a unit
+        value.type = NumericValue::QuantityValue;
+        value.quantity = Quantity(quantity->getValue(),quantity->getUnit());
+    }
+    else if (auto number = freecad_cast<PropertyFloat*>(prop)) {
+        value.type = NumericValue::FloatValue;
+        value.real = number->getValue();
+    }
+    else if (auto integer = freecad_cast<PropertyInteger*>(prop)) {
+        value.type = NumericValue::IntegerValue;
+        value.integer = integer->getValue();
+    }
+    else
+        return false;
+    return true;
+}
+
 void VariableExpression::_toString(std::ostream &ss, bool persistent,int) const {
     if(persistent)
         ss << var.toPersistentString();
@@ -3214,6 +3517,10 @@ Py::Object ConstantExpression::_getPyValue() const {
     return Py::Object(cache);
 }
 
+bool ConstantExpression::_getNumericValue(NumericValue &value) const {
+    return isNumber() && NumberExpression::_getNumericValue(value);
+}
+
 bool ConstantExpression::isNumber() const {
     return strcmp(name,"None")
         && strcmp(name,"True")
@@ -3409,6 +3716,18 @@ Base::XMLReader *ExpressionParser::ExpressionImporter::reader() {
     return _Reader;
 }
 
+static int _ParseCacheCount = 0;
+static std::map<std::pair<const App::DocumentObject*, std::string>, std::unique_ptr<Expression> > _ParseCache;
+
+ExpressionParser::ParseCache::ParseCache() {
+    ++_ParseCacheCount;
+}
+
+ExpressionParser::ParseCache::~ParseCache() {
+    if(--_ParseCacheCount == 0)
+        _ParseCache.clear();
+}
+
 namespace App {
 
 namespace ExpressionParser {
@@ -3659,8 +3978,10 @@ std::vector<std::tuple<int, int, std::string> > tokenize(const std::string &str)
   *
   */
 
-Expression * App::ExpressionParser::parse(const App::DocumentObject *owner, const char* buffer)
+static Expression *parseBuffer(const App::DocumentObject *owner, const char* buffer)
 {
+    using namespace App::ExpressionParser;
+
     // parse from buffer
     ExpressionParser::YY_BUFFER_STATE my_string_buffer = ExpressionParser::ExpressionParser_scan_string (buffer);
     ExpressionParser::StringBufferCleaner cleaner(my_string_buffer);
@@ -3687,6 +4008,21 @@ Expression * App::ExpressionParser::parse(const App::DocumentObject *owner, cons
     }
 }
 
+Expression * App::ExpressionParser::parse(const App::DocumentObject *owner, const char* buffer)
+{
+    if (_ParseCacheCount == 0 || ExpressionImporter::reader()
+            || ObjectIdentifier::DocumentMapper::isMapping())
+        return parseBuffer(owner, buffer);
+
+    auto key = std::make_pair(owner, std::string(buffer));
+    auto it = _ParseCache.find(key);
+    if (it == _ParseCache.end()) {
+        std::unique_ptr<Expression> expr(parseBuffer(owner, buffer));
+        it = _ParseCache.emplace(std::move(key), std::move(expr)).first;
+    }
+    return it->second->copy();
+}
+
 UnitExpression * ExpressionParser::parseUnit(const App::DocumentObject *owner, const char* buffer)
 {
     // parse from buffer
@@ -333,6 +333,18 @@ public:
      */
     Expression* eval() const;
 
+    /**
+     * @brief Evaluate the expression, if it is purely numeric.
+     *
+     * Unlike eval(), this never falls back to the Python evaluation. It does
+     * not modify anything and may therefore be called from worker threads,
+     * as long as the document is not modified meanwhile.
+     *
+     * @return The evaluated NumberExpression, or `nullptr` if the expression
+     * needs the Python evaluation, see getNumericValue().
+     */
+    Expression* evalNumeric() const;
+
     /**
      * @brief Convert the expression to a string.
      *
@@ -531,6 +543,22 @@ public:
     /// Get the value as a Python object.
     Py::Object getPyValue() const;
 
+    /// The result of a numeric evaluation, see getNumericValue().
+    struct NumericValue;
+
+    /**
+     * @brief Evaluate a purely numeric expression without Python.
+     *
+     * Numbers, units, variables referring to integer, float or quantity
+     * properties, and the basic arithmetic operators are evaluated directly,
+     * giving the same result types as the Python evaluation.
+     *
+     * @param[out] value The result of the evaluation.
+     * @return true if the expression was evaluated, false if it needs the
+     * Python evaluation of getPyValue().
+     */
+    bool getNumericValue(NumericValue &value) const;
+
     /**
      * @brief Check if this expression is the same as another.
      *
@@ -563,6 +591,7 @@ protected:
     virtual void _moveCells(const CellAddress &, int, int, ExpressionVisitor &) {}
     virtual void _offsetCells(int, int, ExpressionVisitor &) {}
     virtual Py::Object _getPyValue() const = 0;
+    virtual bool _getNumericValue(NumericValue &) const {return false;}
     virtual void _visit(ExpressionVisitor &) {}
 
 protected:
@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include "Expression.h"
 #include <Base/Matrix.h>
 #include <Base/Quantity.h>
@@ -122,6 +124,7 @@ protected:
     Expression* _copy() const override;
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
     Py::Object _getPyValue() const override;
+    bool _getNumericValue(NumericValue& value) const override;
 
 protected:
     mutable PyObject* cache = nullptr;
@@ -175,6 +178,7 @@ public:
 
 protected:
     Py::Object _getPyValue() const override;
+    bool _getNumericValue(NumericValue& value) const override;
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
     Expression* _copy() const override;
 
@@ -244,6 +248,8 @@ protected:
 
     Py::Object _getPyValue() const override;
 
+    bool _getNumericValue(NumericValue& value) const override;
+
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
 
     void _visit(ExpressionVisitor& v) override;
@@ -417,8 +423,12 @@ public:
     }
 
 protected:
-    static Py::Object
-    evalAggregate(const Expression* owner, int type, const std::vector<Expression*>& args);
+    struct AggregateCache;
+    static Py::Object evalAggregate(const Expression* owner,
+                                    int type,
+                                    const std::vector<Expression*>& args,
+                                    AggregateCache* cache = nullptr);
+    Py::Object evalCachedAggregate() const;
     static Base::Vector3d evaluateSecondVectorArgument(const Expression* expression,
                                                        const std::vector<Expression*>& arguments);
     static double extractLengthValueArgument(const Expression* expression,
@@ -435,6 +445,11 @@ protected:
                                              const Base::Matrix4D* transformationMatrix);
     static Py::Object translationMatrix(double x, double y, double z);
     Py::Object _getPyValue() const override;
+    bool _getNumericValue(NumericValue&) const override
+    {
+        // functions are always evaluated by Python
+        return false;
+    }
     Expression* _copy() const override;
     void _visit(ExpressionVisitor& v) override;
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
@@ -442,6 +457,7 @@ protected:
     Function f; /**< Function to execute */
     std::string fname;
     std::vector<Expression*> args; /** Arguments to function*/
+    mutable std::unique_ptr<AggregateCache> aggregateCache; /**< Last result of an aggregate over ranges */
 };
 
 /**
@@ -498,6 +514,7 @@ public:
 protected:
     Expression* _copy() const override;
     Py::Object _getPyValue() const override;
+    bool _getNumericValue(NumericValue& value) const override;
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
     bool _isIndexable() const override;
     void _getIdentifiers(std::map<App::ObjectIdentifier, bool>&) const override;
@@ -646,6 +663,24 @@ public:
     static Base::XMLReader* reader();
 };
 
+/** Convenient class to share the parsing of identical expressions
+ *
+ * While an instance exists, parse() parses each text only once per owner and
+ * returns copies of the result afterwards. It is meant for code that parses
+ * many expressions at once, like restoring a document. Instances may be nested.
+ * The cache is not used while importing or mapping document names, because
+ * the result then depends on more than the text.
+ */
+class AppExport ParseCache
+{
+public:
+    ParseCache();
+    ~ParseCache();
+
+    ParseCache(const ParseCache&) = delete;
+    ParseCache& operator=(const ParseCache&) = delete;
+};
+
 AppExport bool isModuleImported(PyObject*);
 
 /**
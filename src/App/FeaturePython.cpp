@@ -22,6 +22,7 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <optional>
 #include <sstream>
 
 #include <App/DocumentObjectPy.h>
@@ -31,7 +32,9 @@
 #include <Base/Tools.h>
 
 #include "FeaturePython.h"
+#include "FeaturePythonPool.h"
 #include "FeaturePythonPyImp.h"
+#include "RecomputeStats.h"
 
 
 using namespace App;
@@ -74,7 +77,25 @@ void FeaturePythonImp::init(PyObject* pyobj)
 bool FeaturePythonImp::execute()
 {
     FC_PY_CALL_CHECK(execute)
-    Base::PyGILStateLocker lock;
+
+    // A pure execute() may have been run by a worker process already
+    std::string error;
+    switch (FeaturePythonPool::instance().takeResult(object, error)) {
+        case FeaturePythonPool::Result::Applied:
+            return true;
+        case FeaturePythonPool::Result::Failed:
+            throw Base::RuntimeError(error);
+        default:
+            break;
+    }
+
+    // Waiting for the GIL held by another thread doesn't count as Python time
+    std::optional<Base::PyGILStateLocker> lock;
+    {
+        RecomputeStats::ScopedTimer wait(RecomputeStats::Category::GILWait);
+        lock.emplace();
+    }
+    RecomputeStats::ScopedTimer timer(RecomputeStats::Category::Python);
     try {
         if (has__object__) {
             Py::Object res = Base::pyCall(py_execute.ptr());
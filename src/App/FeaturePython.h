@@ -320,6 +320,18 @@ public:
         }
     }
 
+    /// Python features always run on the thread that drives the recompute
+    bool canRecomputeConcurrently() const override
+    {
+        return false;
+    }
+
+    /// The Python implementation of execute() needs the GIL
+    bool isExecuteGILFree() const override
+    {
+        return false;
+    }
+
     bool redirectSubName(std::ostringstream& ss,
                          App::DocumentObject* topParent,
                          App::DocumentObject* child) const override
@@ -0,0 +1,472 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <sstream>
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QProcess>
+
+#include <Base/Console.h>
+#include <Base/Interpreter.h>
+#include <Base/Sequencer.h>
+
+#include "FeaturePythonPool.h"
+#include "Application.h"
+#include "Document.h"
+#include "DocumentObject.h"
+#include "MergeDocuments.h"
+#include "PropertyLinks.h"
+#include "PropertyPythonObject.h"
+
+FC_LOG_LEVEL_INIT("App", true, true)
+
+using namespace App;
+
+namespace
+{
+// How long to wait for a worker before checking for user abort
+constexpr int pollInterval = 50;
+
+FeaturePythonPool* poolInstance = nullptr;
+
+ParameterGrp::handle getParameter()
+{
+    return GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document"
+    );
+}
+
+QString getExecutable()
+{
+    std::string path = getParameter()->GetASCII("PythonWorkerExecutable");
+    if (!path.empty()) {
+        return QString::fromStdString(path);
+    }
+    return QDir(QCoreApplication::applicationDirPath()).filePath(QStringLiteral("FreeCADCmd"));
+}
+
+// Properties that are not transferred back from a worker: links refer to the objects of the
+// temporary document and the proxy must not be replaced
+bool isTransferable(const Property* prop)
+{
+    return !prop->isDerivedFrom<PropertyLinkBase>() && !prop->isDerivedFrom<PropertyPythonObject>()
+        && !prop->testStatus(Property::Transient) && !prop->testStatus(Property::PropNoPersist);
+}
+
+// Closes the temporary document of a job also if the job fails
+class TemporaryDocument
+{
+public:
+    TemporaryDocument()
+    {
+        DocumentInitFlags flags;
+        flags.createView = false;
+        flags.temporary = true;
+        doc = GetApplication().newDocument("ExecuteJob", nullptr, flags);
+    }
+    ~TemporaryDocument()
+    {
+        GetApplication().closeDocument(doc->getName());
+    }
+    Document* get() const
+    {
+        return doc;
+    }
+
+private:
+    Document* doc;
+
+    FC_DISABLE_COPY_MOVE(TemporaryDocument)
+};
+}  // namespace
+
+struct FeaturePythonPool::Private
+{
+    struct Job
+    {
+        QByteArray request;
+        bool done {false};
+        /// true if the worker has processed the request
+        bool ok {false};
+        std::string data;
+        std::string error;
+    };
+
+    struct Worker
+    {
+        std::unique_ptr<QProcess> process;
+        int jobId {0};
+        QByteArray buffer;
+    };
+
+    std::vector<Worker> workers;
+    std::map<int, Job> jobs;
+    std::map<const DocumentObject*, int> ids;
+    std::deque<int> queue;
+    int lastId {0};
+
+    bool start(Worker& worker)
+    {
+        auto process = std::make_unique<QProcess>();
+        process->setProgram(getExecutable());
+        process->setArguments({QStringLiteral("--service")});
+        process->setStandardErrorFile(QProcess::nullDevice());
+        process->start();
+        if (!process->waitForStarted()) {
+            FC_WARN("Cannot start Python worker " << process->program().toStdString());
+            return false;
+        }
+        worker.process = std::move(process);
+        worker.buffer.clear();
+        return true;
+    }
+
+    void stop(Worker& worker)
+    {
+        if (worker.process) {
+            // the service quits at the end of its input
+            worker.process->closeWriteChannel();
+            if (!worker.process->waitForFinished(1000)) {
+                worker.process->kill();
+                worker.process->waitForFinished();
+            }
+            worker.process.reset();
+        }
+        worker.jobId = 0;
+    }
+
+    void finish(int id, bool ok)
+    {
+        auto it = jobs.find(id);
+        if (it != jobs.end()) {
+            it->second.done = true;
+            it->second.ok = ok;
+        }
+    }
+
+    void handleReply(Worker& worker, const QByteArray& line)
+    {
+        QJsonDocument json = QJsonDocument::fromJson(line);
+        if (!json.isObject()) {
+            // e.g. output of the start-up
+            return;
+        }
+        QJsonObject reply = json.object();
+        if (reply[QLatin1String("id")].toInt() != worker.jobId) {
+            return;
+        }
+        int id = worker.jobId;
+        worker.jobId = 0;
+
+        auto it = jobs.find(id);
+        if (it == jobs.end()) {
+            // the job has been dropped meanwhile
+            return;
+        }
+        Job& job = it->second;
+        job.done = true;
+        job.ok = reply[QLatin1String("ok")].toBool();
+        if (!job.ok) {
+            FC_WARN("Python worker failed: "
+                    << reply[QLatin1String("error")].toString().toStdString());
+        }
+        else if (reply.contains(QLatin1String("executeError"))) {
+            job.error = reply[QLatin1String("executeError")].toString().toStdString();
+        }
+        else {
+            QByteArray data = reply[QLatin1String("data")].toString().toLatin1();
+            job.data = QByteArray::fromBase64(data).toStdString();
+        }
+    }
+
+    void read(Worker& worker, int msecs)
+    {
+        worker.process->waitForReadyRead(msecs);
+        worker.buffer += worker.process->readAllStandardOutput();
+        qsizetype pos = 0;
+        while ((pos = worker.buffer.indexOf('\n')) >= 0) {
+            QByteArray line = worker.buffer.left(pos);
+            worker.buffer.remove(0, pos + 1);
+            handleReply(worker, line);
+        }
+
+        if (worker.jobId != 0 && worker.process->state() != QProcess::Running) {
+            FC_WARN("Python worker has terminated unexpectedly");
+            finish(worker.jobId, false);
+            worker.process.reset();
+            worker.jobId = 0;
+        }
+    }
+};
+
+FeaturePythonPool& FeaturePythonPool::instance()
+{
+    if (!poolInstance) {
+        poolInstance = new FeaturePythonPool();
+    }
+    return *poolInstance;
+}
+
+void FeaturePythonPool::destruct()
+{
+    delete poolInstance;
+    poolInstance = nullptr;
+}
+
+FeaturePythonPool::FeaturePythonPool()
+    : d(new Private)
+{}
+
+FeaturePythonPool::~FeaturePythonPool()
+{
+    for (auto& worker : d->workers) {
+        d->stop(worker);
+    }
+}
+
+bool FeaturePythonPool::isEnabled() const
+{
+    return getParameter()->GetInt("PythonWorkerProcesses", 0) > 0;
+}
+
+bool FeaturePythonPool::canExecute(const DocumentObject* obj) const
+{
+    auto proxy = freecad_cast<PropertyPythonObject*>(obj->getPropertyByName("Proxy"));
+    if (!proxy) {
+        return false;
+    }
+
+    Base::PyGILStateLocker lock;
+    Py::Object pyobj = proxy->getValue();
+    if (pyobj.isNone() || !pyobj.hasAttr("__pure_execute__")) {
+        return false;
+    }
+    return pyobj.getAttr("__pure_execute__").isTrue();
+}
+
+void FeaturePythonPool::submit(const std::vector<DocumentObject*>& objs)
+{
+    auto count = static_cast<std::size_t>(getParameter()->GetInt("PythonWorkerProcesses", 0));
+    if (count == 0) {
+        return;
+    }
+    d->workers.resize(std::max(d->workers.size(), count));
+
+    for (auto obj : objs) {
+        if (d->ids.contains(obj) || !canExecute(obj)) {
+            continue;
+        }
+
+        // The inputs set by expressions must be exported, too. If this fails the object is
+        // executed in this process to report the error.
+        DocumentObjectExecReturn* ret =
+            obj->ExpressionEngine.execute(PropertyExpressionEngine::ExecuteNonOutput);
+        if (ret != DocumentObject::StdReturn) {
+            delete ret;
+            continue;
+        }
+
+        Document* doc = obj->getDocument();
+        std::vector<DocumentObject*> deps = Document::getDependencyList({obj});
+        bool external = std::any_of(deps.begin(), deps.end(), [doc](DocumentObject* dep) {
+            return dep->getDocument() != doc;
+        });
+        if (external) {
+            continue;
+        }
+
+        std::ostringstream str;
+        doc->exportObjects(deps, str);
+
+        int id = ++d->lastId;
+        QJsonObject request;
+        request[QLatin1String("id")] = id;
+        request[QLatin1String("command")] = QStringLiteral("execute");
+        request[QLatin1String("object")] = QString::fromUtf8(obj->getNameInDocument());
+        request[QLatin1String("data")] =
+            QString::fromLatin1(QByteArray::fromStdString(str.str()).toBase64());
+
+        Private::Job job;
+        job.request = QJsonDocument(request).toJson(QJsonDocument::Compact) + '\n';
+        d->jobs[id] = std::move(job);
+        d->ids[obj] = id;
+        d->queue.push_back(id);
+    }
+
+    dispatch();
+}
+
+void FeaturePythonPool::dispatch()
+{
+    for (auto& worker : d->workers) {
+        if (d->queue.empty()) {
+            break;
+        }
+        if (worker.jobId != 0) {
+            continue;
+        }
+        if (!worker.process && !d->start(worker)) {
+            // let the remaining jobs run in this process
+            while (!d->queue.empty()) {
+                d->finish(d->queue.front(), false);
+                d->queue.pop_front();
+            }
+            break;
+        }
+
+        int id = d->queue.front();
+        d->queue.pop_front();
+        worker.jobId = id;
+        worker.process->write(d->jobs[id].request);
+        if (!worker.process->waitForBytesWritten(-1)) {
+            d->finish(id, false);
+            d->stop(worker);
+        }
+    }
+}
+
+void FeaturePythonPool::poll(int msecs)
+{
+    // wait on the first busy worker and only look at the others
+    for (auto& worker : d->workers) {
+        if (worker.jobId != 0) {
+            d->read(worker, msecs);
+            msecs = 0;
+        }
+    }
+}
+
+FeaturePythonPool::Result FeaturePythonPool::takeResult(DocumentObject* obj, std::string& error)
+{
+    auto it = d->ids.find(obj);
+    if (it == d->ids.end()) {
+        return Result::NotSubmitted;
+    }
+    int id = it->second;
+    d->ids.erase(it);
+
+    try {
+        while (!d->jobs[id].done) {
+            dispatch();
+            poll(pollInterval);
+            Base::Sequencer().checkAbort();
+        }
+    }
+    catch (...) {
+        // the workers may be busy for a long time, so restart them
+        for (auto& worker : d->workers) {
+            d->stop(worker);
+        }
+        clear();
+        throw;
+    }
+
+    Private::Job job = std::move(d->jobs[id]);
+    d->jobs.erase(id);
+    dispatch();
+
+    if (!job.ok) {
+        return Result::NotSubmitted;
+    }
+    if (!job.error.empty()) {
+        error = job.error;
+        return Result::Failed;
+    }
+
+    try {
+        std::istringstream str(job.data);
+        obj->getDocument()->importProperties(obj, str);
+    }
+    catch (const Base::Exception& e) {
+        FC_WARN("Failed to apply the result of " << obj->getFullName() << ": " << e.what());
+        return Result::NotSubmitted;
+    }
+    return Result::Applied;
+}
+
+void FeaturePythonPool::clear()
+{
+    // Busy workers are kept, their replies are dropped when they arrive
+    d->jobs.clear();
+    d->ids.clear();
+    d->queue.clear();
+}
+
+std::string FeaturePythonPool::executeJob(
+    const std::string& objectName,
+    const std::string& data,
+    std::string& error
+)
+{
+    // A worker must not overwrite the parameters of the application that has started it
+    GetApplication().GetUserParameter().SetIgnoreSave(true);
+
+    TemporaryDocument tmp;
+    Document* doc = tmp.get();
+
+    MergeDocuments merge(doc);
+    merge.setVerbose(false);
+    std::istringstream str(data);
+    merge.importObjects(str);
+
+    std::string name = objectName;
+    auto it = merge.getNameMap().find(objectName);
+    if (it != merge.getNameMap().end()) {
+        name = it->second;
+    }
+    DocumentObject* obj = doc->getObject(name.c_str());
+    if (!obj) {
+        throw Base::ValueError("Unknown object '" + objectName + "'");
+    }
+
+    std::vector<Property*> changed;
+    auto conn = doc->signalChangedObject.connect(
+        [obj, &changed](const DocumentObject& o, const Property& prop) {
+            auto p = const_cast<Property*>(&prop);  // NOLINT
+            if (&o == obj && isTransferable(p)
+                && std::find(changed.begin(), changed.end(), p) == changed.end()) {
+                changed.push_back(p);
+            }
+        }
+    );
+    bool ok = doc->recomputeFeature(obj);
+    conn.disconnect();
+
+    if (!ok) {
+        error = obj->getStatusString();
+        if (error.empty()) {
+            error = "Failed to recompute " + objectName;
+        }
+        return {};
+    }
+
+    std::ostringstream out;
+    doc->exportProperties(obj, changed, out);
+    return out.str();
+}
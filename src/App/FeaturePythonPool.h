@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <FCGlobal.h>
+
+namespace App
+{
+
+class DocumentObject;
+
+/**
+ * The FeaturePythonPool class runs the execute() method of Python features in worker processes.
+ *
+ * All Python features of a recompute share the embedded interpreter and are therefore executed
+ * one after the other. A proxy can declare its execute() as pure with the class attribute
+ * @code
+ * __pure_execute__ = True
+ * @endcode
+ * It promises that execute() only reads the properties of its object and of the objects it
+ * depends on, and only modifies properties of its own object. If the pool is enabled the pure
+ * features of a dependency level are sent to the workers at once when the recompute enters the
+ * level. Their results are written back on the main thread when the recompute reaches them.
+ *
+ * A job consists of the object and its dependencies, exported like for copy & paste. The worker,
+ * a 'FreeCADCmd --service' process, imports them into a temporary document, recomputes the
+ * object and returns the properties that have been changed, see executeJob(). If a worker fails
+ * the object is executed in this process as usual.
+ *
+ * The pool is enabled by setting the number of workers with the parameter PythonWorkerProcesses
+ * of BaseApp/Preferences/Document. The parameter PythonWorkerExecutable overrides the path of
+ * FreeCADCmd.
+ */
+class AppExport FeaturePythonPool
+{
+public:
+    enum class Result
+    {
+        /// The object must be executed in this process
+        NotSubmitted,
+        /// The result of the worker has been written back to the object
+        Applied,
+        /// execute() has failed in the worker
+        Failed
+    };
+
+    static FeaturePythonPool& instance();
+    static void destruct();
+
+    /// Returns true if worker processes are enabled
+    bool isEnabled() const;
+    /// Returns true if the proxy of \a obj declares its execute() as pure
+    bool canExecute(const DocumentObject* obj) const;
+    /**
+     * Sends the objects that can be executed by a worker to the pool. The objects they depend on
+     * must be up to date. This must be called from the main thread.
+     */
+    void submit(const std::vector<DocumentObject*>& objs);
+    /**
+     * Waits for the job of \a obj and writes its result back to the object. If execute() has
+     * failed in the worker its error message is set to \a error.
+     */
+    Result takeResult(DocumentObject* obj, std::string& error);
+    /// Drops all jobs whose results haven't been taken
+    void clear();
+
+    /**
+     * Runs a job inside of a worker process. \a data holds the exported objects and
+     * \a objectName the name of the object to execute. Returns the changed properties
+     * as written by Document::exportProperties(), or sets \a error if execute() has failed.
+     */
+    static std::string
+    executeJob(const std::string& objectName, const std::string& data, std::string& error);
+
+private:
+    FeaturePythonPool();
+    ~FeaturePythonPool();
+
+    void dispatch();
+    void poll(int msecs);
+
+private:
+    struct Private;
+    std::unique_ptr<Private> d;
+
+    FC_DISABLE_COPY_MOVE(FeaturePythonPool)
+};
+
+}  // namespace App
@@ -203,6 +203,10 @@ public:
     /** @name methods override Feature */
     //@{
     DocumentObjectExecReturn* execute() override;
+    bool isExecuteGILFree() const override
+    {
+        return true;
+    }
     //@}
 };
 
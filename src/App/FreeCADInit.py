@@ -61,7 +61,10 @@ try:
     import types
     import importlib.resources as resources
     import importlib
+    import importlib.machinery
+    import builtins
     import functools
+    import time
     import re
     import pkgutil
 except ImportError:
@@ -884,6 +887,83 @@ class Config:
     DisabledAddons: set[str] = set(mod for mod in App.ConfigGet("DisabledAddons").split(";") if mod)
 
 
+@transient
+class StartupTrace:
+    """
+    Time spent during start-up, enabled with the --startup-trace command line option.
+
+    Every Init.py/InitGui.py and every module imported for the first time while tracing
+    is timed. Python modules are reported including their own imports, extension modules
+    with their self time only, which is mostly the loading of their shared libraries.
+
+    The instance is kept as App.__StartupTrace__ to be used by FreeCADGuiInit.py, so it
+    must not use globals of this script other than App and sys.
+    """
+
+    enabled = App.ConfigGet("StartupTrace") == "1"
+
+    def __init__(self) -> None:
+        self.builtins = builtins
+        self.clock = time.perf_counter
+        self.extension_suffixes = tuple(importlib.machinery.EXTENSION_SUFFIXES)
+        self.original_import = None
+        self.start()
+
+    def start(self) -> None:
+        """Reset the records and start timing imports."""
+        self.begin = self.clock()
+        self.scripts: list[tuple[str, float]] = []
+        self.imports: list[tuple[str, float, bool]] = []
+        self.stack: list[float] = []
+        if self.enabled and not self.original_import:
+            self.original_import = self.builtins.__import__
+            self.builtins.__import__ = self._import
+
+    def stop(self) -> None:
+        """Stop timing imports."""
+        if self.original_import:
+            self.builtins.__import__ = self.original_import
+            self.original_import = None
+
+    def add_script(self, name: str, start: float) -> None:
+        if self.enabled:
+            self.scripts.append((name, self.clock() - start))
+
+    def _import(self, name, globals=None, locals=None, fromlist=(), level=0):
+        if level or name in sys.modules:
+            return self.original_import(name, globals, locals, fromlist, level)
+
+        self.stack.append(0.0)
+        start = self.clock()
+        try:
+            return self.original_import(name, globals, locals, fromlist, level)
+        finally:
+            total = self.clock() - start
+            children = self.stack.pop()
+            if self.stack:
+                self.stack[-1] += total
+            module = sys.modules.get(name)
+            path = str(getattr(module, "__file__", None) or "")
+            if path.endswith(self.extension_suffixes):
+                self.imports.append((name, total - children, True))
+            elif module:
+                self.imports.append((name, total, False))
+
+    def report(self, title: str, limit: int = 30) -> None:
+        """Print the records of the slowest scripts and imports."""
+        if not self.enabled:
+            return
+
+        out = App.Console.PrintMessage
+        out(f"Startup trace of {title}: {(self.clock() - self.begin) * 1000:.1f} ms\n")
+        out("  Init scripts:\n")
+        for name, duration in sorted(self.scripts, key=lambda item: -item[1])[:limit]:
+            out(f"  {duration * 1000:9.1f} ms  {name}\n")
+        out("  Imports ('lib': self time of extension modules):\n")
+        for name, duration, lib in sorted(self.imports, key=lambda item: -item[1])[:limit]:
+            out(f"  {duration * 1000:9.1f} ms  {'lib' if lib else '   '}  {name}\n")
+
+
 @transient
 class WindowsPlatform:
     """
@@ -1003,7 +1083,9 @@ class Mod:
             Err(str(ex))
         else:
             if self.state == ModState.Resolved:
+                start = App.__StartupTrace__.clock()
                 self.run_init()
+                App.__StartupTrace__.add_script(self.name, start)
                 if self.state == ModState.Resolved:
                     self.state = ModState.Loaded
 
@@ -1541,7 +1623,10 @@ class InitPipeline:
 @call_in_place
 def init_applications() -> None:
     try:
+        App.__StartupTrace__ = StartupTrace()
         InitPipeline().run()
+        App.__StartupTrace__.stop()
+        App.__StartupTrace__.report("FreeCADInit.py")
         Log('Init: App::FreeCADInit.py done')
     except Exception as ex:
         Err(f'Error in init_applications {ex!s}')
@@ -43,6 +43,8 @@ EXTENSION_PROPERTY_SOURCE(App::GeoFeatureGroupExtension, App::GroupExtension)
 // Feature
 //===========================================================================
 
+std::atomic<std::size_t> GeoFeatureGroupExtension::placementState {1};
+
 GeoFeatureGroupExtension::GeoFeatureGroupExtension()
 {
     initExtensionType(GeoFeatureGroupExtension::getExtensionClassTypeId());
@@ -116,9 +118,31 @@ Base::Placement GeoFeatureGroupExtension::globalGroupPlacement()
         throw Base::RuntimeError("Global placement cannot be calculated on recompute");
     }
 
+    std::size_t state = placementState;
+    Base::Placement placement;
+    if (findCachedPlacement(state, placement)) {
+        return placement;
+    }
+
     std::unordered_set<GeoFeatureGroupExtension*> history;
     history.insert(this);
-    return recursiveGroupPlacement(this, history);
+    placement = recursiveGroupPlacement(this, history);
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    cachedGlobalPlacement = placement;
+    cachedPlacementState = state;
+    return placement;
+}
+
+bool GeoFeatureGroupExtension::findCachedPlacement(std::size_t state,
+                                                   Base::Placement& placement) const
+{
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    if (cachedPlacementState != state) {
+        return false;
+    }
+    placement = cachedGlobalPlacement;
+    return true;
 }
 
 
@@ -136,6 +160,10 @@ Base::Placement GeoFeatureGroupExtension::recursiveGroupPlacement(
             if (history.contains(parent)) {
                 break;
             }
+            Base::Placement placement;
+            if (parent->findCachedPlacement(placementState, placement)) {
+                return placement * group->placement().getValue();
+            }
             return recursiveGroupPlacement(parent, history) * group->placement().getValue();
         }
     }
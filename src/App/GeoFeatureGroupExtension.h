@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <mutex>
 #include <unordered_set>
 #include "DocumentObject.h"
 #include "GroupExtension.h"
@@ -96,6 +98,12 @@ public:
      */
     Base::Placement globalGroupPlacement();
 
+    /// Drops the cached global group placements, called on any change of placements or links
+    static void invalidateGlobalPlacements()
+    {
+        ++placementState;
+    }
+
     /// Returns true if the given DocumentObject is DocumentObjectGroup but not GeoFeatureGroup
     static bool isNonGeoGroup(const DocumentObject* obj)
     {
@@ -133,6 +141,14 @@ public:
 private:
     Base::Placement recursiveGroupPlacement(GeoFeatureGroupExtension* group,
                                             std::unordered_set<GeoFeatureGroupExtension*>& history);
+    bool findCachedPlacement(std::size_t state, Base::Placement& placement) const;
+    // The global placement is cached until any placement, group or link changes, so that
+    // repeated lookups in deeply nested groups don't walk up the InList every time. The
+    // mutex guards the cache against objects recomputed in parallel.
+    static std::atomic<std::size_t> placementState;
+    mutable std::mutex cacheMutex;
+    Base::Placement cachedGlobalPlacement;
+    std::size_t cachedPlacementState {0};
     static std::vector<App::DocumentObject*>
     getScopedObjectsFromLinks(const App::DocumentObject*, LinkScope scope = LinkScope::Local);
     static std::vector<App::DocumentObject*>
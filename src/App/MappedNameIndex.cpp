@@ -0,0 +1,184 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+#include <algorithm>
+
+#include "MappedNameIndex.h"
+
+
+using namespace Data;
+
+namespace
+{
+constexpr std::size_t minSlots = 16;
+
+std::size_t fnv1a(const QByteArray& bytes, std::size_t hash)
+{
+    const auto* data = reinterpret_cast<const unsigned char*>(bytes.constData());
+    for (int i = 0, count = bytes.size(); i < count; ++i) {
+        hash ^= data[i];
+        hash *= static_cast<std::size_t>(1099511628211ULL);
+    }
+    return hash;
+}
+}  // namespace
+
+std::size_t MappedNameIndex::hashName(const MappedName& name)
+{
+    std::size_t hash = static_cast<std::size_t>(14695981039346656037ULL);
+    hash = fnv1a(name.dataBytes(), hash);
+    hash = fnv1a(name.postfixBytes(), hash);
+    return hash;
+}
+
+std::size_t MappedNameIndex::probe(const MappedName& name, std::size_t hash) const
+{
+    const std::size_t mask = slots.size() - 1;
+    for (std::size_t slot = hash & mask;; slot = (slot + 1) & mask) {
+        std::uint32_t pos = slots[slot];
+        if (pos == Empty) {
+            return slot;
+        }
+        const Entry& entry = entries[pos - 1];
+        if (entry.hash == hash && entry.name == name) {
+            return slot;
+        }
+    }
+}
+
+void MappedNameIndex::rehash(std::size_t slotCount)
+{
+    slots.assign(slotCount, Empty);
+    const std::size_t mask = slotCount - 1;
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        std::size_t slot = entries[i].hash & mask;
+        while (slots[slot] != Empty) {
+            slot = (slot + 1) & mask;
+        }
+        slots[slot] = static_cast<std::uint32_t>(i + 1);
+    }
+}
+
+void MappedNameIndex::reserve(std::size_t count)
+{
+    entries.reserve(count);
+    // keep the load factor below 0.5
+    std::size_t slotCount = minSlots;
+    while (slotCount < 2 * count) {
+        slotCount *= 2;
+    }
+    if (slotCount > slots.size()) {
+        rehash(slotCount);
+    }
+}
+
+std::pair<MappedNameIndex::Entry*, bool> MappedNameIndex::insert(const MappedName& name,
+                                                                 const IndexedName& index)
+{
+    if (2 * (entries.size() + 1) > slots.size()) {
+        rehash(std::max(minSlots, 2 * slots.size()));
+    }
+
+    std::size_t hash = hashName(name);
+    std::size_t slot = probe(name, hash);
+    if (slots[slot] != Empty) {
+        return {&entries[slots[slot] - 1], false};
+    }
+
+    entries.push_back(Entry {name, index, hash});
+    slots[slot] = static_cast<std::uint32_t>(entries.size());
+    return {&entries.back(), true};
+}
+
+const MappedNameIndex::Entry* MappedNameIndex::find(const MappedName& name) const
+{
+    if (entries.empty()) {
+        return nullptr;
+    }
+
+    std::size_t slot = probe(name, hashName(name));
+    if (slots[slot] == Empty) {
+        return nullptr;
+    }
+    return &entries[slots[slot] - 1];
+}
+
+void MappedNameIndex::removeSlot(std::size_t slot)
+{
+    // backward shift deletion keeps the probe sequences intact without tombstones
+    const std::size_t mask = slots.size() - 1;
+    std::size_t hole = slot;
+    for (std::size_t next = (hole + 1) & mask; slots[next] != Empty; next = (next + 1) & mask) {
+        std::size_t home = entries[slots[next] - 1].hash & mask;
+        // move the entry if the hole lies on its probe sequence, i.e. between home and next
+        if (((next - home) & mask) >= ((next - hole) & mask)) {
+            slots[hole] = slots[next];
+            hole = next;
+        }
+    }
+    slots[hole] = Empty;
+}
+
+bool MappedNameIndex::erase(const MappedName& name)
+{
+    if (entries.empty()) {
+        return false;
+    }
+
+    std::size_t slot = probe(name, hashName(name));
+    std::uint32_t pos = slots[slot];
+    if (pos == Empty) {
+        return false;
+    }
+    removeSlot(slot);
+
+    // move the last entry into the gap and redirect its slot
+    std::uint32_t last = static_cast<std::uint32_t>(entries.size());
+    if (pos != last) {
+        Entry& moved = entries[last - 1];
+        std::size_t movedSlot = probe(moved.name, moved.hash);
+        slots[movedSlot] = pos;
+        entries[pos - 1] = std::move(moved);
+    }
+    entries.pop_back();
+    return true;
+}
+
+void MappedNameIndex::clear()
+{
+    entries.clear();
+    slots.clear();
+}
+
+std::vector<const MappedNameIndex::Entry*> MappedNameIndex::sorted() const
+{
+    std::vector<const Entry*> res;
+    res.reserve(entries.size());
+    for (const auto& entry : entries) {
+        res.push_back(&entry);
+    }
+    std::sort(res.begin(), res.end(), [](const Entry* a, const Entry* b) {
+        return a->name < b->name;
+    });
+    return res;
+}
@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "IndexedName.h"
+#include "MappedName.h"
+
+
+namespace Data
+{
+
+/**
+ * @brief Hash index from mapped names to indexed names, used by ElementMap.
+ *
+ * The entries are kept densely in one vector, so inserting a name doesn't
+ * allocate a tree node. Lookup goes through an open-addressing table with
+ * linear probing that stores the position of the entry, together with a
+ * cached hash so that most probes don't need to compare names.
+ *
+ * The hash covers the bytes of the data and postfix in sequence, so two names
+ * that compare equal but split them differently get the same hash.
+ *
+ * Iteration order is the order of the entries vector, which changes when an
+ * entry is erased. Use sorted() where a deterministic order is needed.
+ */
+class AppExport MappedNameIndex
+{
+public:
+    struct Entry
+    {
+        MappedName name;
+        IndexedName index;
+        std::size_t hash = 0;
+    };
+
+    MappedNameIndex() = default;
+
+    /// Insert @p name unless it exists. Returns the entry and whether it was inserted.
+    /// The pointer is valid until the next insert or erase.
+    std::pair<Entry*, bool> insert(const MappedName& name, const IndexedName& index);
+
+    const Entry* find(const MappedName& name) const;
+
+    /// Returns true if @p name was found and erased
+    bool erase(const MappedName& name);
+
+    void clear();
+    void reserve(std::size_t count);
+
+    std::size_t size() const
+    {
+        return entries.size();
+    }
+
+    /// Returns the memory of the index itself in bytes, without the data of the names
+    std::size_t getMemSize() const
+    {
+        return entries.capacity() * sizeof(Entry) + slots.capacity() * sizeof(std::uint32_t);
+    }
+
+    bool empty() const
+    {
+        return entries.empty();
+    }
+
+    std::vector<Entry>::const_iterator begin() const
+    {
+        return entries.begin();
+    }
+
+    std::vector<Entry>::const_iterator end() const
+    {
+        return entries.end();
+    }
+
+    /// Returns the entries ordered by name, i.e. the order of a std::map<MappedName, ...>
+    std::vector<const Entry*> sorted() const;
+
+    static std::size_t hashName(const MappedName& name);
+
+private:
+    static constexpr std::uint32_t Empty = 0;
+
+    /// Returns the slot holding @p name or the empty slot where it would go
+    std::size_t probe(const MappedName& name, std::size_t hash) const;
+    void rehash(std::size_t slotCount);
+    void removeSlot(std::size_t slot);
+
+    std::vector<Entry> entries;
+    /// Position + 1 of the entry in 'entries', 0 if the slot is empty
+    std::vector<std::uint32_t> slots;
+};
+
+}  // namespace Data
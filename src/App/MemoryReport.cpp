@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+#include <algorithm>
+#include <numeric>
+
+#include "MemoryReport.h"
+#include "Document.h"
+#include "DocumentObject.h"
+#include "StringHasher.h"
+
+using namespace App;
+
+namespace
+{
+std::vector<MemoryReport::Provider>& providers()
+{
+    static std::vector<MemoryReport::Provider> list;
+    return list;
+}
+}  // namespace
+
+std::size_t ObjectMemoryUsage::total() const
+{
+    return std::accumulate(
+        extra.begin(),
+        extra.end(),
+        properties,
+        [](std::size_t sum, const auto& it) { return sum + it.second; }
+    );
+}
+
+MemoryReport::MemoryReport(const Document& doc)
+{
+    std::vector<Property*> props;
+    for (auto obj : doc.getObjects()) {
+        ObjectMemoryUsage& usage = getObjectUsage(obj);
+        props.clear();
+        obj->getPropertyList(props);
+        for (auto prop : props) {
+            std::size_t size = prop->getMemSize();
+            usage.properties += size;
+            propertyTypes[prop->getTypeId().getName()] += size;
+        }
+        categories["Objects"] += usage.properties;
+    }
+
+    props.clear();
+    doc.getPropertyList(props);
+    for (auto prop : props) {
+        std::size_t size = prop->getMemSize();
+        propertyTypes[prop->getTypeId().getName()] += size;
+        categories["Document properties"] += size;
+    }
+
+    categories["Undo/Redo"] = doc.getUndoMemUsage();
+    categories["String table"] = doc.getStringHasher()->getMemSize();
+
+    for (const auto& provider : providers()) {
+        provider(doc, *this);
+    }
+}
+
+void MemoryReport::addProvider(const Provider& provider)
+{
+    providers().push_back(provider);
+}
+
+ObjectMemoryUsage& MemoryReport::getObjectUsage(const DocumentObject* obj)
+{
+    auto it = objects.find(obj);
+    if (it == objects.end()) {
+        ObjectMemoryUsage usage;
+        usage.name = obj->getNameInDocument();
+        usage.label = obj->Label.getValue();
+        usage.type = obj->getTypeId().getName();
+        it = objects.emplace(obj, std::move(usage)).first;
+    }
+    return it->second;
+}
+
+void MemoryReport::addObjectUsage(
+    const DocumentObject* obj,
+    const std::string& category,
+    std::size_t bytes
+)
+{
+    getObjectUsage(obj).extra[category] += bytes;
+    categories[category] += bytes;
+}
+
+void MemoryReport::addUsage(const std::string& category, std::size_t bytes)
+{
+    categories[category] += bytes;
+}
+
+std::vector<ObjectMemoryUsage> MemoryReport::getObjects() const
+{
+    std::vector<ObjectMemoryUsage> list;
+    list.reserve(objects.size());
+    for (const auto& it : objects) {
+        list.push_back(it.second);
+    }
+    std::stable_sort(list.begin(), list.end(), [](const auto& a, const auto& b) {
+        return a.total() > b.total();
+    });
+    return list;
+}
+
+const std::map<std::string, std::size_t>& MemoryReport::getPropertyTypes() const
+{
+    return propertyTypes;
+}
+
+const std::map<std::string, std::size_t>& MemoryReport::getCategories() const
+{
+    return categories;
+}
+
+std::size_t MemoryReport::getTotal() const
+{
+    return std::accumulate(
+        categories.begin(),
+        categories.end(),
+        std::size_t(0),
+        [](std::size_t sum, const auto& it) { return sum + it.second; }
+    );
+}
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <FCGlobal.h>
+
+namespace App
+{
+
+class Document;
+class DocumentObject;
+
+/// Memory usage of a single document object
+struct ObjectMemoryUsage
+{
+    std::string name;
+    std::string label;
+    std::string type;
+    /// The memory of the properties in bytes
+    std::size_t properties {0};
+    /// Further memory held for the object, e.g. its tessellation in the GUI
+    std::map<std::string, std::size_t> extra;
+
+    std::size_t total() const;
+};
+
+/**
+ * The MemoryReport class collects the memory usage of a document.
+ *
+ * The memory is broken down by object, by property type and by category. The categories are
+ * "Objects", "Document properties", "Undo/Redo" and "String table". Other modules can add
+ * further categories with addProvider(), e.g. the GUI adds the view providers together with the
+ * tessellations in their scene graphs.
+ *
+ * The numbers are based on Base::Persistence::getMemSize() and are estimates. Data that is
+ * shared by several objects, like the geometry of a link, is counted for each of them.
+ */
+class AppExport MemoryReport
+{
+public:
+    /// Adds the memory that a module holds for a document to the report
+    using Provider = std::function<void(const Document&, MemoryReport&)>;
+
+    explicit MemoryReport(const Document& doc);
+
+    /// Registers a provider that is called for every report
+    static void addProvider(const Provider& provider);
+
+    /// Adds \a bytes of the category \a category held for \a obj
+    void addObjectUsage(const DocumentObject* obj, const std::string& category, std::size_t bytes);
+    /// Adds \a bytes of the category \a category held for the whole document
+    void addUsage(const std::string& category, std::size_t bytes);
+
+    /// Returns the objects ordered by their total memory, largest first
+    std::vector<ObjectMemoryUsage> getObjects() const;
+    /// Returns the memory per property type
+    const std::map<std::string, std::size_t>& getPropertyTypes() const;
+    /// Returns the memory per category
+    const std::map<std::string, std::size_t>& getCategories() const;
+    /// Returns the sum of all categories
+    std::size_t getTotal() const;
+
+private:
+    ObjectMemoryUsage& getObjectUsage(const DocumentObject* obj);
+
+private:
+    std::map<const DocumentObject*, ObjectMemoryUsage> objects;
+    std::map<std::string, std::size_t> propertyTypes;
+    std::map<std::string, std::size_t> categories;
+};
+
+}  // namespace App
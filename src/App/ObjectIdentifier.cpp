@@ -1216,6 +1216,24 @@ Property* ObjectIdentifier::getProperty(int* ptype) const
     return result.resolvedProperty;
 }
 
+Property* ObjectIdentifier::getPlainProperty(bool subPath) const
+{
+    if (!subObjectName.getString().empty()) {
+        return nullptr;
+    }
+    ResolveResults result(*this);
+    if (!result.resolvedProperty || result.propertyType != PseudoNone
+        || result.resolvedProperty->getContainer() != result.resolvedDocumentObject
+        || (result.flags.test(ResolveByLabel) && !result.flags.test(ResolveByIdentifier))
+        || !components[result.propertyIndex].isSimple()) {
+        return nullptr;
+    }
+    if (!subPath && components.size() - result.propertyIndex != 1) {
+        return nullptr;
+    }
+    return result.resolvedProperty;
+}
+
 Property* ObjectIdentifier::resolveProperty(const App::DocumentObject* obj,
                                             const char* propertyName,
                                             App::DocumentObject*& sobj,
@@ -1289,6 +1307,11 @@ ObjectIdentifier::DocumentMapper::~DocumentMapper()
     _DocumentMap = nullptr;
 }
 
+bool ObjectIdentifier::DocumentMapper::isMapping()
+{
+    return _DocumentMap && !_DocumentMap->empty();
+}
+
 void ObjectIdentifier::setDocumentName(ObjectIdentifier::String&& name, bool force)
 {
     if (name.getString().empty()) {
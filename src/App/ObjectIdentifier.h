@@ -156,6 +156,9 @@ public:
          * variable local to the compilation unit is set to `nullptr`.
          */
         ~DocumentMapper();
+
+        /// Whether a non-empty mapping is in effect.
+        static bool isMapping();
     };
 
     /**
@@ -988,6 +991,18 @@ public:
      */
     App::Property* getProperty(int* ptype = nullptr) const;
 
+    /**
+     * @brief Get the property if this object identifier refers to it directly.
+     *
+     * @param[in] subPath Whether to accept a sub path into the property, e.g.
+     * `Placement.Base.x`.
+     *
+     * @return A pointer to the property if the identifier names a property of
+     * a document object by its name, without any sub-object or pseudo
+     * property, or `nullptr` otherwise.
+     */
+    App::Property* getPlainProperty(bool subPath = false) const;
+
     /**
      * @brief Create a canonical representation of the object identifier.
      *
@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+#include <Base/Exception.h>
+
+#include "ParameterSweep.h"
+#include "Document.h"
+
+
+using namespace App;
+
+ParameterSweep::ParameterSweep(Document* doc)
+    : doc(doc)
+{}
+
+void ParameterSweep::addInput(const DocumentObject* obj, const std::string& path)
+{
+    inputs.push_back(ObjectIdentifier::parse(obj, path));
+}
+
+void ParameterSweep::addOutput(const DocumentObject* obj, const std::string& path)
+{
+    outputs.push_back(ObjectIdentifier::parse(obj, path));
+}
+
+void ParameterSweep::setInputs(const std::vector<App::any>& values)
+{
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        inputs[i].setValue(values[i]);
+    }
+}
+
+std::vector<ParameterSweep::Result>
+ParameterSweep::run(const std::vector<std::vector<App::any>>& rows, const Callback& callback)
+{
+    for (const auto& row : rows) {
+        if (row.size() != inputs.size()) {
+            FC_THROWM(Base::ValueError,
+                      "Expected " << inputs.size() << " input values per variant, got "
+                                  << row.size());
+        }
+    }
+
+    std::vector<App::any> original;
+    original.reserve(inputs.size());
+    for (const auto& input : inputs) {
+        original.push_back(input.getValue());
+    }
+
+    std::vector<Result> results;
+    results.reserve(rows.size());
+    try {
+        for (std::size_t i = 0; i < rows.size(); ++i) {
+            setInputs(rows[i]);
+
+            Result result;
+            bool hasError = false;
+            doc->recompute({}, false, &hasError);
+            result.valid = !hasError;
+            result.outputs.reserve(outputs.size());
+            for (const auto& output : outputs) {
+                result.outputs.push_back(output.getValue());
+            }
+
+            if (callback) {
+                callback(i, result);
+            }
+            results.push_back(std::move(result));
+        }
+    }
+    catch (...) {
+        setInputs(original);
+        doc->recompute();
+        throw;
+    }
+
+    setInputs(original);
+    doc->recompute();
+    return results;
+}
@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <App/ObjectIdentifier.h>
+
+namespace App
+{
+
+class Document;
+
+/**
+ * @brief Recomputes a document for each row of a table of input values.
+ *
+ * Each row holds one value per input. For each row, the inputs are set, the
+ * document is recomputed, and the outputs are read. After the last row, and
+ * also when an exception is thrown, the original input values are restored
+ * and the document is recomputed again.
+ *
+ * The variants run one after the other on the document itself. Only the
+ * objects depending on the changed inputs are recomputed for each variant.
+ */
+class AppExport ParameterSweep
+{
+public:
+    /// Output values of one variant
+    struct Result
+    {
+        bool valid {true};               ///< false if the recompute failed
+        std::vector<App::any> outputs;  ///< one value per output
+    };
+
+    /// Called after each variant with the row index, e.g. to export files
+    using Callback = std::function<void(std::size_t, const Result&)>;
+
+    explicit ParameterSweep(Document* doc);
+
+    /// Add the property at \a path relative to \a obj as input
+    void addInput(const DocumentObject* obj, const std::string& path);
+    /// Add the property at \a path relative to \a obj as output
+    void addOutput(const DocumentObject* obj, const std::string& path);
+
+    const std::vector<ObjectIdentifier>& getInputs() const
+    {
+        return inputs;
+    }
+    const std::vector<ObjectIdentifier>& getOutputs() const
+    {
+        return outputs;
+    }
+
+    /**
+     * @brief Run all variants.
+     *
+     * @param rows The input values, one row per variant.
+     * @param callback Optional function called after each variant.
+     * @return The results in the order of the rows.
+     * @throw Base::ValueError If a row has the wrong number of values.
+     */
+    std::vector<Result> run(const std::vector<std::vector<App::any>>& rows,
+                            const Callback& callback = {});
+
+private:
+    void setInputs(const std::vector<App::any>& values);
+
+    Document* doc;
+    std::vector<ObjectIdentifier> inputs;
+    std::vector<ObjectIdentifier> outputs;
+};
+
+}  // namespace App
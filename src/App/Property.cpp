@@ -286,6 +286,7 @@ void Property::setReadOnly(bool readOnly)
 void Property::hasSetValue()
 {
     PropertyCleaner guard(this);
+    ++_changeCount;
     if (father) {
         if (isNotifyEnabled()) {
             father->onChanged(this);
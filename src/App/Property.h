@@ -29,8 +29,12 @@
 #include <Base/Persistence.h>
 #include <boost/any.hpp>
 #include <fastsignals/signal.h>
+#include <algorithm>
 #include <bitset>
+#include <functional>
 #include <string>
+#include <type_traits>
+#include <vector>
 #include <FCGlobal.h>
 
 #include "ElementNamingUtils.h"
@@ -164,6 +168,19 @@ public:
         return sizeof(father) + sizeof(StatusBits);
     }
 
+    /**
+     * @brief Get the memory held by a copy of this property made by Copy().
+     *
+     * Used for the memory limit of the undo stack. Properties whose copies
+     * share their data with the original only report what the copy owns.
+     *
+     * @return The memory in bytes.
+     */
+    virtual unsigned int getCopyMemSize() const
+    {
+        return getMemSize();
+    }
+
     /**
      * @brief Get the name of this property in the belonging container.
      *
@@ -524,6 +541,17 @@ public:
         return _id;
     }
 
+    /**
+     * @brief Return the number of changes of the property value.
+     *
+     * The count is increased each time hasSetValue() is called, so it can be
+     * used to tell whether the value has changed without comparing it.
+     */
+    unsigned getChangeCount() const
+    {
+        return _changeCount;
+    }
+
     /**
      * @brief Callback for when the property is about to be saved.
      *
@@ -604,6 +632,7 @@ private:
     PropertyContainer* father {nullptr};
     const char* myName {nullptr};
     int64_t _id;
+    unsigned _changeCount {0};
 
 public:
     /// Signal emitted when the property value has changed.
@@ -801,6 +830,58 @@ public:
         _touchList.clear();
     }
 
+    /**
+     * @brief Reduce an undo copy of a list to the entries that changed.
+     *
+     * A transaction keeps a copy of the list as it was before a change. When
+     * the transaction is committed, the entries at the front and at the back
+     * that are still equal in @p current are dropped from this copy.
+     * restoreDelta() puts them back when the change is undone.
+     *
+     * @param[in] current The list after the change, of the same type.
+     * @param[out] front The number of entries dropped at the front.
+     * @param[out] back The number of entries dropped at the back.
+     * @return True if entries were dropped, false if the list is kept as is.
+     */
+    virtual bool trimDelta(const Property& current, int& front, int& back)
+    {
+        (void)current;
+        (void)front;
+        (void)back;
+        return false;
+    }
+
+    /**
+     * @brief Restore the entries dropped by trimDelta().
+     *
+     * @param[in] current The list as it was after the change.
+     * @param[in] front The number of entries dropped at the front.
+     * @param[in] back The number of entries dropped at the back.
+     */
+    virtual void restoreDelta(const Property& current, int front, int back)
+    {
+        (void)current;
+        (void)front;
+        (void)back;
+    }
+
+    /**
+     * @brief Compute a hash of the entries that trimDelta() drops.
+     *
+     * A transaction records it for the list after the change, so that an
+     * unrecorded change of the dropped entries is detected on undo.
+     *
+     * @param[in] front The number of entries at the front.
+     * @param[in] back The number of entries at the back.
+     * @return The hash of the entries, or 0 if the list can't be trimmed.
+     */
+    virtual std::size_t hashDelta(int front, int back) const
+    {
+        (void)front;
+        (void)back;
+        return 0;
+    }
+
 protected:
     /**
      * @brief Set the values of the property list with Python values.
@@ -1078,6 +1159,39 @@ public:
      * @param[in] value  The new element value.
      * @throw Base::RuntimeError if @p index is out of bounds (< -1 or > size).
      */
+    bool trimDelta(const Property& current, int& front, int& back) override
+    {
+        // Only for entries that compare exactly, e.g. vectors compare with a tolerance
+        if constexpr (std::is_same_v<ListT, std::vector<T>>
+                      && (std::is_arithmetic_v<T> || std::is_same_v<T, std::string>)) {
+            return trimListDelta(current, front, back, std::equal_to<T>());
+        }
+        else {
+            return parent_type::trimDelta(current, front, back);
+        }
+    }
+
+    void restoreDelta(const Property& current, int front, int back) override
+    {
+        if constexpr (std::is_same_v<ListT, std::vector<T>>) {
+            restoreListDelta(current, front, back);
+        }
+        else {
+            parent_type::restoreDelta(current, front, back);
+        }
+    }
+
+    std::size_t hashDelta(int front, int back) const override
+    {
+        if constexpr (std::is_same_v<ListT, std::vector<T>>
+                      && (std::is_arithmetic_v<T> || std::is_same_v<T, std::string>)) {
+            return hashListDelta(front, back, std::hash<T>());
+        }
+        else {
+            return parent_type::hashDelta(front, back);
+        }
+    }
+
     virtual void set1Value(int index, const_reference value)
     {
         int size = getSize();
@@ -1128,6 +1242,78 @@ protected:
      */
     virtual T getPyValue(PyObject* item) const = 0;
 
+    /**
+     * @brief Implementation of trimDelta() for a vector of entries.
+     *
+     * @param[in] isEqual Returns true if two entries are exactly the same.
+     */
+    template<class Equal>
+    bool trimListDelta(const Property& current, int& front, int& back, Equal isEqual)
+    {
+        auto other = dynamic_cast<const PropertyListsT*>(&current);
+        if (!other) {
+            return false;
+        }
+        const ListT& now = other->_lValueList;
+        std::size_t size = std::min(_lValueList.size(), now.size());
+        std::size_t head = 0;
+        while (head < size && isEqual(_lValueList[head], now[head])) {
+            ++head;
+        }
+        std::size_t tail = 0;
+        while (tail < size - head
+               && isEqual(_lValueList[_lValueList.size() - 1 - tail], now[now.size() - 1 - tail])) {
+            ++tail;
+        }
+        if (head == 0 && tail == 0) {
+            return false;
+        }
+        _lValueList.erase(_lValueList.end() - tail, _lValueList.end());
+        _lValueList.erase(_lValueList.begin(), _lValueList.begin() + head);
+        front = static_cast<int>(head);
+        back = static_cast<int>(tail);
+        return true;
+    }
+
+    /**
+     * @brief Implementation of hashDelta() for a vector of entries.
+     *
+     * @param[in] hash Returns the hash of an entry.
+     */
+    template<class Hash>
+    std::size_t hashListDelta(int front, int back, Hash hash) const
+    {
+        std::size_t size = _lValueList.size();
+        std::size_t seed = size;
+        // combined like boost::hash_combine()
+        auto combine = [&seed, &hash](const T& value) {
+            seed ^= hash(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);  // NOLINT
+        };
+        for (std::size_t i = 0; i < std::min<std::size_t>(front, size); ++i) {
+            combine(_lValueList[i]);
+        }
+        for (std::size_t i = size - std::min<std::size_t>(back, size); i < size; ++i) {
+            combine(_lValueList[i]);
+        }
+        return seed;
+    }
+
+    /// Implementation of restoreDelta() for a vector of entries
+    void restoreListDelta(const Property& current, int front, int back)
+    {
+        auto other = dynamic_cast<const PropertyListsT*>(&current);
+        if (!other || other->getSize() < front + back) {
+            throw Base::RuntimeError("List changed outside of the undo history");
+        }
+        const ListT& now = other->_lValueList;
+        ListT values;
+        values.reserve(front + _lValueList.size() + back);
+        values.insert(values.end(), now.begin(), now.begin() + front);
+        values.insert(values.end(), _lValueList.begin(), _lValueList.end());
+        values.insert(values.end(), now.end() - back, now.end());
+        _lValueList = std::move(values);
+    }
+
 protected:
     ListT _lValueList;
 };
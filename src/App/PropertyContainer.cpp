@@ -77,11 +77,13 @@ App::Property* PropertyContainer::addDynamicProperty(
 
 Property *PropertyContainer::getPropertyByName(const char* name) const
 {
-    auto prop = dynamicProps.getDynamicPropertyByName(name);
+    // hash the name only once for the dynamic and the static properties
+    HashedName hashedName(name);
+    auto prop = dynamicProps.getDynamicPropertyByName(hashedName);
     if (prop) {
         return prop;
     }
-    return getPropertyData().getPropertyByName(this,name);
+    return getPropertyData().getPropertyByName(this,hashedName);
 }
 
 void PropertyContainer::getPropertyMap(std::map<std::string,Property*> &Map) const
@@ -505,11 +507,16 @@ void PropertyData::split(PropertyData *other) {
 }
 
 const PropertyData::PropertySpec *PropertyData::findProperty(OffsetBase offsetBase,const char* PropName) const
+{
+    return findProperty(offsetBase,HashedName(PropName));
+}
+
+const PropertyData::PropertySpec *PropertyData::findProperty(OffsetBase offsetBase,const HashedName& PropName) const
 {
     (void)offsetBase;
     merge();
     auto &index = impl->propertyData.get<1>();
-    auto it = index.find(PropName);
+    auto it = index.find(PropName,CStringHasher(),CStringHasher());
     if(it != index.end())
         return &(*it);
     return nullptr;
@@ -601,6 +608,11 @@ const char* PropertyData::getDocumentation(OffsetBase offsetBase,const char* nam
 }
 
 Property *PropertyData::getPropertyByName(OffsetBase offsetBase,const char* name) const
+{
+  return getPropertyByName(offsetBase,HashedName(name));
+}
+
+Property *PropertyData::getPropertyByName(OffsetBase offsetBase,const HashedName& name) const
 {
   const PropertyData::PropertySpec* Spec = findProperty(offsetBase,name);
 
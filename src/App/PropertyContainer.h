@@ -185,6 +185,15 @@ struct AppExport PropertyData
    */
   const PropertySpec *findProperty(OffsetBase offsetBase,const char* PropName) const;
 
+  /**
+   * @brief Find a property by its name with a precomputed hash.
+   *
+   * @param[in] offsetBase The base offset for the property.
+   * @param[in] PropName The hashed name of the property to find.
+   * @return The property specification if found; `nullptr` otherwise.
+   */
+  const PropertySpec *findProperty(OffsetBase offsetBase,const HashedName& PropName) const;
+
   /**
    * @brief Find a property by its pointer.
    *
@@ -222,6 +231,15 @@ struct AppExport PropertyData
    */
   Property *getPropertyByName(OffsetBase offsetBase,const char* name) const;
 
+  /**
+   * @brief Get a property by its name with a precomputed hash.
+   *
+   * @param[in] offsetBase The base offset for the property.
+   * @param[in] name The hashed name of the property to find.
+   * @return The property if found; `nullptr` otherwise.
+   */
+  Property *getPropertyByName(OffsetBase offsetBase,const HashedName& name) const;
+
   /**
    * @brief Get a map of properties.
    *
@@ -562,6 +580,16 @@ public:
       return dynamicProps.getDynamicPropertyByName(name);
   }
 
+  /**
+   * @brief Get the number of additions, removals and renames of dynamic properties.
+   *
+   * Callers caching the result of a property lookup by name can compare the
+   * count to tell whether the lookup is still valid.
+   */
+  unsigned getDynamicPropertyChangeCount() const {
+      return dynamicProps.getChangeCount();
+  }
+
   /**
    * @brief Called when the status of a property is changed.
    *
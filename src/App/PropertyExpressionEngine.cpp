@@ -119,6 +119,11 @@ struct PropertyExpressionEngine::Private
     std::vector<fastsignals::scoped_connection> conns;
     std::unordered_map<std::string, std::vector<ObjectIdentifier>> propMap;
 
+    // Properties read or written by the tracked expressions, see updateInputs()
+    std::vector<fastsignals::scoped_connection> inputConns;
+    std::unordered_map<const Property*, std::vector<ObjectIdentifier>> inputMap;
+    bool inputsValid = false;
+
     /**
      * @brief Build a graph of all expressions in \a exprs.
      * @param exprs Expressions to use in graph
@@ -256,6 +261,8 @@ Property* PropertyExpressionEngine::Copy() const
 void PropertyExpressionEngine::hasSetValue()
 {
     App::DocumentObject* owner = dynamic_cast<App::DocumentObject*>(getContainer());
+    invalidateInputs();
+
     if (!owner || !owner->isAttachedToDocument() || owner->isRestoring()
         || testFlag(LinkDetached)) {
         PropertyExpressionContainer::hasSetValue();
@@ -382,6 +389,97 @@ void PropertyExpressionEngine::updateHiddenReference(const std::string& key)
     }
 }
 
+void PropertyExpressionEngine::invalidateInputs()
+{
+    if (pimpl) {
+        pimpl->inputConns.clear();
+        pimpl->inputMap.clear();
+        pimpl->inputsValid = false;
+    }
+}
+
+void PropertyExpressionEngine::updateInputs(DocumentObject* owner)
+{
+    invalidateInputs();
+    if (!owner->isAttachedToDocument() || owner->isRestoring() || testFlag(LinkDetached)) {
+        return;
+    }
+    if (!pimpl) {
+        pimpl = std::make_unique<Private>();
+    }
+
+    std::set<DocumentObject*> objs;
+    objs.insert(owner);
+    for (auto& e : expressions) {
+        ExpressionInfo& info = e.second;
+        info.tracked = false;
+        info.changed = true;
+        if (!info.expression) {
+            continue;
+        }
+        // The property written by the binding is tracked as well, so that
+        // setting it manually brings back the value of the expression.
+        std::vector<Property*> props {e.first.getProperty()};
+        for (auto& id : info.expression->getIdentifiers()) {
+            // Anything that is not a plain property (sub-objects, pseudo
+            // properties, label references, unresolved paths) may change
+            // without notice and is always evaluated.
+            Property* prop = id.first.getPlainProperty(true);
+            if (!prop) {
+                props.clear();
+                break;
+            }
+            props.push_back(prop);
+        }
+        if (props.empty() || !props.front()) {
+            continue;
+        }
+        for (auto prop : props) {
+            auto obj = freecad_cast<DocumentObject*>(prop->getContainer());
+            if (obj) {
+                objs.insert(obj);
+            }
+            pimpl->inputMap[prop].push_back(e.first);
+        }
+        info.tracked = true;
+    }
+
+    for (auto obj : objs) {
+        // NOLINTBEGIN
+        pimpl->inputConns.emplace_back(obj->signalChanged.connect(
+            std::bind(&PropertyExpressionEngine::slotChangedInput, this, sp::_1, sp::_2)));
+        // NOLINTEND
+    }
+    // NOLINTBEGIN
+    pimpl->inputConns.emplace_back(GetApplication().signalRemoveDynamicProperty.connect(
+        std::bind(&PropertyExpressionEngine::slotRemovedInput, this, sp::_1)));
+    // NOLINTEND
+    pimpl->inputsValid = true;
+}
+
+void PropertyExpressionEngine::slotChangedInput(const App::DocumentObject&,
+                                                const App::Property& prop)
+{
+    auto it = pimpl->inputMap.find(&prop);
+    if (it == pimpl->inputMap.end()) {
+        return;
+    }
+    for (auto& path : it->second) {
+        auto expr = expressions.find(path);
+        if (expr != expressions.end()) {
+            expr->second.changed = true;
+        }
+    }
+}
+
+void PropertyExpressionEngine::slotRemovedInput(const App::Property& prop)
+{
+    if (pimpl->inputMap.count(&prop)) {
+        // rebuilt on the next execute(), which then reports the broken binding
+        pimpl->inputsValid = false;
+    }
+}
+
 void PropertyExpressionEngine::slotChangedObject(const App::DocumentObject& obj,
                                                  const App::Property&)
 {
@@ -688,6 +786,10 @@ DocumentObjectExecReturn* App::PropertyExpressionEngine::execute(ExecuteOption o
 
     resetter r(running);
 
+    if (!pimpl || !pimpl->inputsValid) {
+        updateInputs(docObj);
+    }
+
     // Compute evaluation order
     std::vector<App::ObjectIdentifier> evaluationOrder = computeEvaluationOrder(option);
     std::vector<ObjectIdentifier>::const_iterator it = evaluationOrder.begin();
@@ -713,11 +815,20 @@ DocumentObjectExecReturn* App::PropertyExpressionEngine::execute(ExecuteOption o
             throw Base::RuntimeError("Invalid property owner.");
         }
 
+        // Skip the expression if none of its inputs changed. Expressions are
+        // evaluated in dependency order, so a changed result marks the
+        // dependent expressions as changed before they are reached.
+        // The tracking is invalidated if the expressions change meanwhile.
+        ExpressionInfo& info = expressions[*it];
+        if (pimpl && pimpl->inputsValid && info.tracked && !info.changed) {
+            continue;
+        }
+
         /* Set value of property */
         App::any value;
         try {
             // Evaluate expression
-            std::shared_ptr<App::Expression> expression = expressions[*it].expression;
+            std::shared_ptr<App::Expression> expression = info.expression;
             if (expression) {
                 value = expression->getValueAsAny();
 
@@ -735,6 +846,7 @@ DocumentObjectExecReturn* App::PropertyExpressionEngine::execute(ExecuteOption o
                 // if (option == ExecuteOnRestore && prop->testStatus(Property::EvalOnRestore))
                 {
                     if (isAnyEqual(value, prop->getPathValue(*it))) {
+                        info.changed = false;
                         continue;
                     }
                     if (touched) {
@@ -742,6 +854,11 @@ DocumentObjectExecReturn* App::PropertyExpressionEngine::execute(ExecuteOption o
                     }
                 }
                 prop->setPathValue(*it, value);
+                // reset after setting, which notifies the change of its own output
+                auto found = expressions.find(*it);
+                if (found != expressions.end()) {
+                    found->second.changed = false;
+                }
             }
         }
         catch (Base::Exception& e) {
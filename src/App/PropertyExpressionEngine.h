@@ -147,6 +147,8 @@ public:
     {
         std::shared_ptr<App::Expression> expression; /**< The actual expression tree */
         bool busy;
+        bool tracked = false; /**< The inputs of the expression are tracked */
+        bool changed = true;  /**< Tracked inputs changed since the last evaluation */
 
         explicit ExpressionInfo(
             std::shared_ptr<App::Expression> expression = std::shared_ptr<App::Expression>())
@@ -348,6 +350,18 @@ private:
     void slotChangedProperty(const App::DocumentObject& obj, const App::Property& prop);
     void updateHiddenReference(const std::string& key);
 
+    /**
+     * @brief Track the properties read and written by each expression.
+     *
+     * Expressions whose inputs are all plain properties are only evaluated
+     * by execute() after one of them has changed. The tracking is rebuilt on
+     * the next execute() whenever the expressions or their links change.
+     */
+    void updateInputs(App::DocumentObject* owner);
+    void invalidateInputs();
+    void slotChangedInput(const App::DocumentObject& obj, const App::Property& prop);
+    void slotRemovedInput(const App::Property& prop);
+
     bool running = false; /**< Boolean used to avoid loops */
     bool restoring = false;
 
@@ -380,6 +380,24 @@ void PropertyVectorList::Paste(const Property& from)
     setValues(dynamic_cast<const PropertyVectorList&>(from)._lValueList);
 }
 
+bool PropertyVectorList::trimDelta(const Property& current, int& front, int& back)
+{
+    // Vector3d::operator==() has a tolerance, undo must restore the exact values
+    auto isEqual = [](const Base::Vector3d& v1, const Base::Vector3d& v2) {
+        return v1.x == v2.x && v1.y == v2.y && v1.z == v2.z;
+    };
+    return trimListDelta(current, front, back, isEqual);
+}
+
+std::size_t PropertyVectorList::hashDelta(int front, int back) const
+{
+    auto hash = [](const Base::Vector3d& v) {
+        std::hash<double> hasher;
+        return hasher(v.x) ^ (hasher(v.y) << 1) ^ (hasher(v.z) << 2);
+    };
+    return hashListDelta(front, back, hash);
+}
+
 unsigned int PropertyVectorList::getMemSize() const
 {
     return static_cast<unsigned int>(_lValueList.size() * sizeof(Base::Vector3d));
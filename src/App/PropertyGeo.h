@@ -239,6 +239,8 @@ public:
 
     Property* Copy() const override;
     void Paste(const Property& from) override;
+    bool trimDelta(const Property& current, int& front, int& back) override;
+    std::size_t hashDelta(int front, int back) const override;
 
     unsigned int getMemSize() const override;
     const char* getEditorName() const override
@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include "PropertyTransfer.h"
+
+using namespace App;
+
+namespace
+{
+thread_local PropertyTransfer* currentTransfer = nullptr;
+}
+
+PropertyTransfer::PropertyTransfer()
+    : previous(currentTransfer)
+{
+    currentTransfer = this;
+}
+
+PropertyTransfer::~PropertyTransfer()
+{
+    currentTransfer = previous;
+}
+
+PropertyTransfer* PropertyTransfer::current()
+{
+    return currentTransfer;
+}
+
+int PropertyTransfer::add(const Property* prop)
+{
+    sources.push_back(prop);
+    return static_cast<int>(sources.size()) - 1;
+}
+
+const Property* PropertyTransfer::get(int index) const
+{
+    if (index < 0 || index >= static_cast<int>(sources.size())) {
+        return nullptr;
+    }
+    return sources[index];
+}
@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#pragma once
+
+#include <vector>
+
+#include <FCGlobal.h>
+
+namespace App
+{
+
+class Property;
+
+/**
+ * The PropertyTransfer class hands property values from the originals to their copies while
+ * Document::copyObject() runs.
+ *
+ * The objects are still exported and imported as XML, so that their names, links and expressions
+ * are mapped as usual. But a property with large data, like a shape, may write the index returned
+ * by add() instead of its data while a transfer is current. Its copy then takes the value of the
+ * original, which is not serialized at all and can share its data.
+ *
+ * A transfer is current from its construction to its destruction, on the thread that created it.
+ */
+class AppExport PropertyTransfer
+{
+public:
+    PropertyTransfer();
+    ~PropertyTransfer();
+
+    /// Returns the transfer of the running copy, or nullptr if there is none
+    static PropertyTransfer* current();
+
+    /// Adds the original \a prop and returns the index to write instead of its data
+    int add(const Property* prop);
+    /// Returns the original property of \a index, or nullptr if the index is invalid
+    const Property* get(int index) const;
+
+    PropertyTransfer(const PropertyTransfer&) = delete;
+    PropertyTransfer(PropertyTransfer&&) = delete;
+    PropertyTransfer& operator=(const PropertyTransfer&) = delete;
+    PropertyTransfer& operator=(PropertyTransfer&&) = delete;
+
+private:
+    PropertyTransfer* previous;
+    std::vector<const Property*> sources;
+};
+
+}  // namespace App
@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
 #include <Base/Bitmask.h>
 #ifndef FC_GLOBAL_H
@@ -264,4 +265,15 @@ private:
 
 }  // namespace App
 
-ENABLE_BITMASK_OPERATORS(App::CellAddress::Cell)
\ No newline at end of file
+ENABLE_BITMASK_OPERATORS(App::CellAddress::Cell)
+
+/// Hash of a cell address, consistent with its equality that ignores the absolute flags
+template<>
+struct std::hash<App::CellAddress>
+{
+    std::size_t operator()(const App::CellAddress& address) const noexcept
+    {
+        return std::hash<unsigned int>()((static_cast<unsigned int>(address.row()) << 16)
+                                         | static_cast<unsigned int>(address.col() & 0xffff));
+    }
+};
\ No newline at end of file
@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "RecomputeStats.h"
+#include "DocumentObject.h"
+
+
+using namespace App;
+
+namespace
+{
+// The object that is currently recomputed by this thread
+thread_local RecomputeObjectStats* currentStats = nullptr;  // NOLINT
+// Depth of nested timers per category
+thread_local int timerDepth[3] = {0, 0, 0};  // NOLINT
+
+double elapsed(std::chrono::steady_clock::time_point start,
+               std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now())
+{
+    return std::chrono::duration<double>(end - start).count();
+}
+}  // namespace
+
+RecomputeStats::ScopedTimer::ScopedTimer(Category cat)
+    : stats(currentStats)
+    , category(cat)
+{
+    if (stats && timerDepth[static_cast<int>(category)]++ == 0) {
+        start = std::chrono::steady_clock::now();
+    }
+}
+
+RecomputeStats::ScopedTimer::~ScopedTimer()
+{
+    if (!stats || --timerDepth[static_cast<int>(category)] > 0) {
+        return;
+    }
+    double time = elapsed(start);
+    switch (category) {
+        case Category::Python:
+            stats->pythonTime += time;
+            break;
+        case Category::Occ:
+            stats->occTime += time;
+            break;
+        case Category::GILWait:
+            stats->gilWaitTime += time;
+            break;
+    }
+}
+
+RecomputeStats::ObjectTimer::ObjectTimer(RecomputeStats& owner, const DocumentObject* obj)
+    : stats(owner.addObject(obj))
+    , previous(currentStats)
+    , start(std::chrono::steady_clock::now())
+{
+    if (stats) {
+        stats->startTime = elapsed(owner.startTime, start);
+        currentStats = stats;
+    }
+}
+
+RecomputeStats::ObjectTimer::~ObjectTimer()
+{
+    if (stats) {
+        stats->wallTime = elapsed(start);
+        currentStats = previous;
+    }
+}
+
+RecomputeObjectStats* RecomputeStats::addObject(const DocumentObject* obj)
+{
+    if (!recording || !obj) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> guard(mutex);
+    auto& entry = entries.emplace_back();
+    entry.object = obj;
+    entry.name = obj->getNameInDocument() ? obj->getNameInDocument() : "";
+    return &entry;
+}
+
+void RecomputeStats::begin()
+{
+    entries.clear();
+    criticalPath.clear();
+    criticalPathTime = 0.0;
+    totalTime = 0.0;
+    startTime = std::chrono::steady_clock::now();
+    recording = true;
+}
+
+void RecomputeStats::finish(const std::vector<DocumentObject*>& sortedObjs)
+{
+    if (!recording) {
+        return;
+    }
+    recording = false;
+    totalTime = elapsed(startTime);
+
+    // Keyed by object, as objects of different documents may have the same name
+    std::unordered_map<const DocumentObject*, RecomputeObjectStats*> entryMap;
+    for (auto& entry : entries) {
+        entry.pathTime = 0.0;
+        // an object may be recomputed twice, only the last run is relevant
+        entryMap[entry.object] = &entry;
+    }
+
+    // The objects are sorted with the dependencies first, so the longest path
+    // to each dependency is known when visiting an object.
+    std::unordered_map<const RecomputeObjectStats*, const RecomputeObjectStats*> predecessor;
+    const RecomputeObjectStats* last = nullptr;
+    for (auto obj : sortedObjs) {
+        if (!obj->isAttachedToDocument()) {
+            continue;
+        }
+        auto it = entryMap.find(obj);
+        if (it == entryMap.end()) {
+            continue;
+        }
+        auto entry = it->second;
+        const RecomputeObjectStats* prev = nullptr;
+        for (auto dep : obj->getOutList()) {
+            if (!dep || !dep->isAttachedToDocument()) {
+                continue;
+            }
+            auto itDep = entryMap.find(dep);
+            if (itDep != entryMap.end() && itDep->second != entry
+                && (!prev || itDep->second->pathTime > prev->pathTime)) {
+                prev = itDep->second;
+            }
+        }
+        double execTime = entry->wallTime - entry->gilWaitTime;
+        entry->pathTime = execTime + (prev ? prev->pathTime : 0.0);
+        predecessor[entry] = prev;
+        if (!last || entry->pathTime > last->pathTime) {
+            last = entry;
+        }
+    }
+
+    if (last) {
+        criticalPathTime = last->pathTime;
+        for (auto entry = last; entry; entry = predecessor[entry]) {
+            criticalPath.push_back(entry->name);
+        }
+        std::reverse(criticalPath.begin(), criticalPath.end());
+    }
+}
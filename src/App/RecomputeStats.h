@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <FCGlobal.h>
+
+namespace App
+{
+
+class DocumentObject;
+
+/// Timing of the recompute of a single object, all times are in seconds
+struct RecomputeObjectStats
+{
+    const DocumentObject* object {nullptr};  ///< the object, only used as key
+    std::string name;          ///< internal name of the object
+    double startTime {0.0};    ///< start time relative to the begin of the recompute
+    double wallTime {0.0};     ///< total time spent to recompute the object
+    double pythonTime {0.0};   ///< time spent in Python code
+    double occTime {0.0};      ///< time spent in OpenCASCADE algorithms
+    double gilWaitTime {0.0};  ///< time spent waiting for the Python GIL, part of wallTime only
+    double pathTime {0.0};     ///< longest chain of recompute time up to this object
+};
+
+/**
+ * @brief Collects per-object timings of a document recompute.
+ *
+ * The document always records the wall time of each recomputed object. The
+ * time spent in Python and OpenCASCADE is accounted by placing a ScopedTimer
+ * around the respective calls. Once the recompute is done the critical path,
+ * i.e. the dependency chain with the largest accumulated recompute time, is
+ * determined from the object dependencies.
+ */
+class AppExport RecomputeStats
+{
+public:
+    enum class Category
+    {
+        Python,
+        Occ,
+        GILWait,
+    };
+
+    /**
+     * @brief Account the lifetime of this object to the given category.
+     *
+     * The time is added to the object that is currently recomputed by the
+     * calling thread. Nested timers of the same category are counted once.
+     * Outside of a recompute the timer does nothing.
+     */
+    class AppExport ScopedTimer
+    {
+    public:
+        explicit ScopedTimer(Category cat);
+        ~ScopedTimer();
+
+        FC_DISABLE_COPY_MOVE(ScopedTimer);
+
+    private:
+        RecomputeObjectStats* stats;
+        Category category;
+        std::chrono::steady_clock::time_point start;
+    };
+
+    /// Times the recompute of a single object, used by the document
+    class AppExport ObjectTimer
+    {
+    public:
+        ObjectTimer(RecomputeStats& owner, const DocumentObject* obj);
+        ~ObjectTimer();
+
+        FC_DISABLE_COPY_MOVE(ObjectTimer);
+
+    private:
+        RecomputeObjectStats* stats;
+        RecomputeObjectStats* previous;
+        std::chrono::steady_clock::time_point start;
+    };
+
+    /// Drop previous results and start recording
+    void begin();
+    /// Stop recording and compute the critical path of the topologically sorted objects
+    void finish(const std::vector<DocumentObject*>& sortedObjs);
+
+    /// Check if a recompute is being recorded
+    bool isRecording() const
+    {
+        return recording;
+    }
+    /// The entries of all recomputed objects in the order they were started
+    const std::deque<RecomputeObjectStats>& getObjects() const
+    {
+        return entries;
+    }
+    /// The names of the objects of the critical path, first to last. The time
+    /// spent waiting for the GIL doesn't count for the path.
+    const std::vector<std::string>& getCriticalPath() const
+    {
+        return criticalPath;
+    }
+    /// The accumulated recompute time of the critical path
+    double getCriticalPathTime() const
+    {
+        return criticalPathTime;
+    }
+    /// The wall time of the whole recompute
+    double getTotalTime() const
+    {
+        return totalTime;
+    }
+
+private:
+    RecomputeObjectStats* addObject(const DocumentObject* obj);
+
+private:
+    std::deque<RecomputeObjectStats> entries;
+    std::vector<std::string> criticalPath;
+    std::chrono::steady_clock::time_point startTime;
+    std::mutex mutex;
+    double criticalPathTime {0.0};
+    double totalTime {0.0};
+    bool recording {false};
+};
+
+}  // namespace App
@@ -23,7 +23,15 @@
 
 #include <QCryptographicHash>
 #include <QHash>
+#include <algorithm>
+#include <array>
 #include <deque>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_set>
 
 #include <Base/Console.h>
 #include <Base/Reader.h>
@@ -32,12 +40,10 @@
 
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/algorithm/string/split.hpp>
-#include <boost/bimap.hpp>
-#include <boost/bimap/set_of.hpp>
-#include <boost/bimap/unordered_set_of.hpp>
 #include <boost/io/ios_state.hpp>
 #include <boost/iostreams/stream.hpp>
 
+#include "CompactStream.h"
 #include "MappedElement.h"
 #include "StringHasher.h"
 #include "StringHasherPy.h"
@@ -73,15 +79,99 @@ struct StringIDHasher
     }
 };
 
-using HashMapBase =
-    boost::bimap<boost::bimaps::unordered_set_of<StringID*, StringIDHasher, StringIDHasher>,
-                 boost::bimaps::set_of<long>>;
-
-class StringHasher::HashMap: public HashMapBase
+// Shapes of independent objects may be built concurrently during a parallel
+// recompute, and they all share the document string table. The strings are
+// therefore split into shards by content hash, each with its own lock, so that
+// threads only contend when they hit the same shard. The ID index has its own
+// lock, which is always taken after the shard lock.
+class StringHasher::HashMap
 {
 public:
+    static constexpr std::size_t ShardCount = 16;
+
+    struct Shard
+    {
+        std::shared_mutex Mutex;
+        std::unordered_set<StringID*, StringIDHasher, StringIDHasher> Strings;
+    };
+
     bool SaveAll = false;
     int Threshold = 0;
+
+    std::array<Shard, ShardCount> Shards;
+
+    std::shared_mutex IDMutex;
+    std::map<long, StringID*> IDs;
+    long LastID = 0;
+
+    Shard& shard(const StringID* sid)
+    {
+        return Shards[StringIDHasher()(sid) % ShardCount];
+    }
+
+    /// Locks every shard and the ID index, e.g. for compact() and clear()
+    std::vector<std::unique_lock<std::shared_mutex>> lockAll()
+    {
+        std::vector<std::unique_lock<std::shared_mutex>> locks;
+        locks.reserve(ShardCount + 1);
+        for (auto& s : Shards) {
+            locks.emplace_back(s.Mutex);
+        }
+        locks.emplace_back(IDMutex);
+        return locks;
+    }
+
+    std::size_t size()
+    {
+        std::shared_lock<std::shared_mutex> lock(IDMutex);
+        return IDs.size();
+    }
+
+    /// Removes all entries without releasing them, the caller must hold lockAll()
+    void clear()
+    {
+        for (auto& s : Shards) {
+            s.Strings.clear();
+        }
+        IDs.clear();
+        LastID = 0;
+    }
+
+    /// Removes one entry, the caller must hold the lock of its shard and the ID index
+    bool erase(Shard& s, StringID* sid)
+    {
+        auto it = IDs.find(sid->value());
+        if (it == IDs.end() || it->second != sid) {
+            return false;
+        }
+        IDs.erase(it);
+        auto iter = s.Strings.find(sid);
+        if (iter != s.Strings.end() && *iter == sid) {
+            s.Strings.erase(iter);
+        }
+        return true;
+    }
+
+    /// Inserts one entry, the caller must hold the lock of its shard and the ID index
+    StringID* insert(StringHasher* owner, Shard& s, StringID& sid)
+    {
+        auto it = s.Strings.find(&sid);
+        if (it != s.Strings.end()) {
+            return *it;
+        }
+        if (sid._id <= 0) {
+            sid._id = LastID + 1;
+        }
+        auto res = IDs.emplace(sid._id, &sid);
+        if (!res.second) {
+            return res.first->second;
+        }
+        LastID = std::max(LastID, sid._id);
+        s.Strings.insert(&sid);
+        sid._hasher = owner;
+        sid.ref();
+        return &sid;
+    }
 };
 
 ///////////////////////////////////////////////////////////
@@ -91,7 +181,11 @@ TYPESYSTEM_SOURCE_ABSTRACT(App::StringID, Base::BaseClass)
 StringID::~StringID()
 {
     if (_hasher) {
-        _hasher->_hashes->right.erase(_id);
+        auto& hashes = *_hasher->_hashes;
+        auto& shard = hashes.shard(this);
+        std::unique_lock<std::shared_mutex> lock(shard.Mutex);
+        std::unique_lock<std::shared_mutex> idLock(hashes.IDMutex);
+        hashes.erase(shard, this);
     }
 }
 
@@ -195,10 +289,15 @@ void StringHasher::compact()
         return;
     }
 
+    // Released StringIDs are only destroyed once the last reference below is
+    // gone, and by then they no longer point back to this hasher, so holding
+    // all the locks here cannot dead lock.
+    auto locks = _hashes->lockAll();
+
     // Make a list of all the table entries that have only a single reference and are not marked
     // "persistent"
     std::deque<StringIDRef> pendings;
-    for (auto& hasher : _hashes->right) {
+    for (auto& hasher : _hashes->IDs) {
         if (!hasher.second->isPersistent() && hasher.second->getRefCount() == 1) {
             pendings.emplace_back(hasher.second);
         }
@@ -209,7 +308,7 @@ void StringHasher::compact()
         StringIDRef sid = pendings.front();
         pendings.pop_front();
         // Try to erase the map entry for this StringID
-        if (_hashes->right.erase(sid.value()) == 0U) {
+        if (!_hashes->erase(_hashes->shard(sid._sid), sid._sid)) {
             continue;  // If nothing was erased, there's nothing more to do
         }
         sid._sid->_hasher = nullptr;
@@ -243,12 +342,8 @@ int StringHasher::getThreshold() const
 
 long StringHasher::lastID() const
 {
-    if (_hashes->right.empty()) {
-        return 0;
-    }
-    auto it = _hashes->right.end();
-    --it;
-    return it->first;
+    std::shared_lock<std::shared_mutex> lock(_hashes->IDMutex);
+    return _hashes->LastID;
 }
 
 StringIDRef StringHasher::getID(const char* text, int len, bool hashable)
@@ -259,12 +354,31 @@ StringIDRef StringHasher::getID(const char* text, int len, bool hashable)
     return getID(QByteArray::fromRawData(text, len), hashable ? Option::Hashable : Option::None);
 }
 
-StringIDRef StringHasher::getID(const QByteArray& data, Options options)
+StringIDRef StringHasher::prepareID(const QByteArray& data, Options options) const
 {
-    bool binary = options.testFlag(Option::Binary);
     bool hashable = options.testFlag(Option::Hashable);
-    bool nocopy = options.testFlag(Option::NoCopy);
+    bool hashed = hashable && _hashes->Threshold > 0 && (int)data.size() > _hashes->Threshold;
 
+    StringID::Flags flags(StringID::Flag::None);
+    if (options.testFlag(Option::Binary)) {
+        flags.setFlag(StringID::Flag::Binary);
+    }
+    if (hashed) {
+        flags.setFlag(StringID::Flag::Hashed);
+        QCryptographicHash hasher(QCryptographicHash::Sha1);
+        hasher.addData(data);
+        return {new StringID(0, hasher.result(), flags)};
+    }
+    if (options.testFlag(Option::NoCopy)) {
+        return {new StringID(0, data, flags)};
+    }
+    // if not hashed, make a deep copy of the data
+    return {new StringID(0, QByteArray(data.constData(), data.size()), flags)};
+}
+
+StringIDRef StringHasher::getID(const QByteArray& data, Options options)
+{
+    bool hashable = options.testFlag(Option::Hashable);
     bool hashed = hashable && _hashes->Threshold > 0 && (int)data.size() > _hashes->Threshold;
 
     StringID dataID;
@@ -277,25 +391,48 @@ StringIDRef StringHasher::getID(const QByteArray& data, Options options)
         dataID._data = data;
     }
 
-    auto it = _hashes->left.find(&dataID);
-    if (it != _hashes->left.end()) {
-        return {it->first};
+    auto& shard = _hashes->shard(&dataID);
+    {
+        std::shared_lock<std::shared_mutex> lock(shard.Mutex);
+        auto it = shard.Strings.find(&dataID);
+        if (it != shard.Strings.end()) {
+            return {*it};
+        }
     }
 
-    if (!hashed && !nocopy) {
-        // if not hashed, make a deep copy of the data
-        dataID._data = QByteArray(data.constData(), data.size());
+    return {insert(prepareID(data, options))};
+}
+
+std::vector<StringIDRef> StringHasher::getIDs(const std::vector<QByteArray>& data, Options options)
+{
+    std::vector<StringIDRef> res;
+    res.reserve(data.size());
+    for (const auto& entry : data) {
+        res.push_back(prepareID(entry, options));
     }
 
-    StringID::Flags flags(StringID::Flag::None);
-    if (binary) {
-        flags.setFlag(StringID::Flag::Binary);
+    std::array<std::vector<std::size_t>, HashMap::ShardCount> groups;
+    for (std::size_t i = 0; i < res.size(); ++i) {
+        groups[StringIDHasher()(res[i]._sid) % HashMap::ShardCount].push_back(i);
     }
-    if (hashed) {
-        flags.setFlag(StringID::Flag::Hashed);
+
+    for (std::size_t s = 0; s < groups.size(); ++s) {
+        if (groups[s].empty()) {
+            continue;
+        }
+        auto& shard = _hashes->Shards[s];
+        std::unique_lock<std::shared_mutex> lock(shard.Mutex);
+        std::unique_lock<std::shared_mutex> idLock(_hashes->IDMutex);
+        for (auto i : groups[s]) {
+            StringID* sid = _hashes->insert(this, shard, *res[i]._sid);
+            if (sid != res[i]._sid) {
+                // Drop the prepared one. It was never in the table, so its
+                // destructor does not lock anything.
+                res[i] = StringIDRef(sid);
+            }
+        }
     }
-    StringIDRef sid(new StringID(lastID() + 1, dataID._data, flags));
-    return {insert(sid)};
+    return res;
 }
 
 StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<StringIDRef>& sids)
@@ -321,13 +458,17 @@ StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<Stri
     }
 
     // Check to see if there is already an entry in the hash table for this StringID
-    auto it = _hashes->left.find(&tempID);
-    if (it != _hashes->left.end()) {
-        auto res = StringIDRef(it->first);
-        if (indexed) {
-            res._index = indexed.getIndex();
+    {
+        auto& shard = _hashes->shard(&tempID);
+        std::shared_lock<std::shared_mutex> lock(shard.Mutex);
+        auto it = shard.Strings.find(&tempID);
+        if (it != shard.Strings.end()) {
+            auto res = StringIDRef(*it);
+            if (indexed) {
+                res._index = indexed.getIndex();
+            }
+            return res;
         }
-        return res;
     }
 
     if (!indexed && name.isRaw()) {
@@ -348,8 +489,8 @@ StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<Stri
         indexRef = getID(tempID._data);
     }
 
-    // The real StringID object that we are going to insert
-    StringIDRef newStringIDRef(new StringID(lastID() + 1, tempID._data));
+    // The real StringID object that we are going to insert, its ID is assigned on insertion
+    StringIDRef newStringIDRef(new StringID(0, tempID._data));
     StringID& newStringID = *newStringIDRef._sid;
     if (tempID._postfix.size() != 0) {
         newStringID._flags.setFlag(StringID::Flag::Postfixed);
@@ -437,8 +578,9 @@ StringIDRef StringHasher::getID(long id, int index) const
     if (id <= 0) {
         return {};
     }
-    auto it = _hashes->right.find(id);
-    if (it == _hashes->right.end()) {
+    std::shared_lock<std::shared_mutex> lock(_hashes->IDMutex);
+    auto it = _hashes->IDs.find(id);
+    if (it == _hashes->IDs.end()) {
         return {};
     }
     StringIDRef res(it->second);
@@ -476,7 +618,8 @@ void StringHasher::Save(Base::Writer& writer) const
 
     writer.Stream() << writer.ind() << "<StringHasher2 ";
     if (!_filename.empty()) {
-        writer.Stream() << " file=\"" << writer.addFile((_filename + ".txt").c_str(), this)
+        const char* ext = writer.getMode("BinaryElementMap") ? ".bin" : ".txt";
+        writer.Stream() << " file=\"" << writer.addFile((_filename + ext).c_str(), this)
                         << "\"/>\n";
         return;
     }
@@ -490,6 +633,11 @@ void StringHasher::Save(Base::Writer& writer) const
 void StringHasher::SaveDocFile(Base::Writer& writer) const
 {
     std::size_t count = _hashes->SaveAll ? this->size() : this->count();
+    if (writer.getMode("BinaryElementMap")) {
+        writer.Stream() << "StringTableBinary v1 " << count << '\n';
+        saveStreamBinary(writer.Stream());
+        return;
+    }
     writer.Stream() << "StringTableStart v1 " << count << '\n';
     saveStream(writer.Stream());
 }
@@ -505,7 +653,8 @@ void StringHasher::saveStream(std::ostream& stream) const
     long lastID = 0;
     bool relative = false;
 
-    for (auto& hasher : _hashes->right) {
+    std::shared_lock<std::shared_mutex> lock(_hashes->IDMutex);
+    for (auto& hasher : _hashes->IDs) {
         auto& d = *hasher.second;
         long id = d._id;
         if (!_hashes->SaveAll && !d.isMarked() && !d.isPersistent()) {
@@ -591,13 +740,59 @@ void StringHasher::saveStream(std::ostream& stream) const
     }
 }
 
+void StringHasher::saveStreamBinary(std::ostream& stream) const
+{
+    CompactOutputStream out(stream);
+    long lastID = 0;
+
+    std::shared_lock<std::shared_mutex> lock(_hashes->IDMutex);
+    for (auto& hasher : _hashes->IDs) {
+        auto& d = *hasher.second;
+        long id = d._id;
+        if (!_hashes->SaveAll && !d.isMarked() && !d.isPersistent()) {
+            continue;
+        }
+
+        // IDs are increasing and referenced IDs are always smaller than the
+        // referencing one, so both are stored as small positive differences.
+        out.writeUInt(id - lastID);
+        lastID = id;
+
+        auto flags = d._flags;
+        flags.setFlag(StringID::Flag::Marked, false);
+        out.writeUInt(flags.toUnderlyingType());
+
+        out.writeUInt(d._sids.size());
+        for (auto& sid : d._sids) {
+            out.writeInt(id - sid.value());
+        }
+
+        // Unlike the text format the data can be stored unencoded, and the
+        // parts that are restored from the referenced IDs are omitted.
+        if (d.isPostfixed()) {
+            if (!d.isPrefixIDIndex() && !d.isIndexed() && !d.isPrefixID()) {
+                out.writeBytes(std::string_view(d._data.constData(), d._data.size()));
+            }
+            if (!d.isPostfixEncoded()) {
+                out.writeBytes(std::string_view(d._postfix.constData(), d._postfix.size()));
+            }
+        }
+        else {
+            out.writeBytes(std::string_view(d._data.constData(), d._data.size()));
+        }
+    }
+}
+
 void StringHasher::RestoreDocFile(Base::Reader& reader)
 {
     std::string marker;
     std::string ver;
     reader >> marker;
     std::size_t count = 0;
-    _hashes->clear();
+    {
+        auto locks = _hashes->lockAll();
+        _hashes->clear();
+    }
     if (marker == "StringTableStart") {
         reader >> ver >> count;
         if (ver != "v1") {
@@ -606,6 +801,19 @@ void StringHasher::RestoreDocFile(Base::Reader& reader)
         restoreStreamNew(reader, count);
         return;
     }
+    if (marker == "StringTableBinary") {
+        reader >> ver >> count;
+        if (ver != "v1") {
+            FC_WARN("Unknown string table format");
+        }
+        // skip the line end of the header
+        reader.get();
+        std::string buffer {std::istreambuf_iterator<char>(reader),
+                            std::istreambuf_iterator<char>()};
+        CompactInputStream in(buffer);
+        restoreStreamBinary(in, count);
+        return;
+    }
     reader >> count;
     restoreStream(reader, count);
 }
@@ -613,7 +821,10 @@ void StringHasher::RestoreDocFile(Base::Reader& reader)
 void StringHasher::restoreStreamNew(std::istream& stream, std::size_t count)
 {
     Base::TextInputStream asciiStream(stream);
-    _hashes->clear();
+    {
+        auto locks = _hashes->lockAll();
+        _hashes->clear();
+    }
     std::string content;
     boost::io::ios_flags_saver ifs(stream);
     stream >> std::hex;
@@ -726,24 +937,93 @@ void StringHasher::restoreStreamNew(std::istream& stream, std::size_t count)
     }
 }
 
+void StringHasher::restoreStreamBinary(CompactInputStream& stream, std::size_t count)
+{
+    {
+        auto locks = _hashes->lockAll();
+        _hashes->clear();
+    }
+
+    auto toByteArray = [](std::string_view data) {
+        return QByteArray(data.data(), static_cast<int>(data.size()));
+    };
+
+    long lastid = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        long id = lastid + static_cast<long>(stream.readUInt());
+        lastid = id;
+
+        auto flag = static_cast<unsigned long>(stream.readUInt());
+        StringIDRef sid(new StringID(id, QByteArray(), static_cast<StringID::Flag>(flag)));
+
+        StringID& d = *sid._sid;
+        std::uint64_t sidCount = stream.readUInt();
+        if (sidCount > stream.remaining()) {
+            FC_THROWM(Base::RuntimeError, "Invalid string table");
+        }
+        d._sids.reserve(static_cast<int>(sidCount));
+        for (std::uint64_t j = 0; j < sidCount; ++j) {
+            StringIDRef ref = getID(id - static_cast<long>(stream.readInt()));
+            if (!ref) {
+                FC_THROWM(Base::RuntimeError, "Invalid string id reference");
+            }
+            d._sids.push_back(ref);
+        }
+
+        if (!d.isPostfixed()) {
+            d._data = toByteArray(stream.readBytes());
+        }
+        else {
+            int offset = 0;
+            if (d.isPostfixEncoded()) {
+                offset = 1;
+                if (d._sids.empty()) {
+                    FC_THROWM(Base::RuntimeError, "Missing string postfix");
+                }
+                d._postfix = d._sids[0]._sid->_data;
+            }
+            if (d.isIndexed()) {
+                if (d._sids.size() <= offset) {
+                    FC_THROWM(Base::RuntimeError, "Missing string prefix");
+                }
+                d._data = d._sids[offset]._sid->_data;
+            }
+            else if (d.isPrefixID() || d.isPrefixIDIndex()) {
+                if (d._sids.size() <= offset) {
+                    FC_THROWM(Base::RuntimeError, "Missing string prefix id");
+                }
+                d._data = d._sids[offset]._sid->toString(0).c_str();
+                if (d.isPrefixIDIndex()) {
+                    d._data += ":";
+                }
+            }
+            else {
+                d._data = toByteArray(stream.readBytes());
+            }
+            if (!d.isPostfixEncoded()) {
+                d._postfix = toByteArray(stream.readBytes());
+            }
+        }
+
+        insert(sid);
+    }
+}
+
 StringID* StringHasher::insert(const StringIDRef& sid)
 {
     assert(sid && sid._sid->_hasher == nullptr);
-    auto& hasher = *sid._sid;
-    hasher._hasher = this;
-    hasher.ref();
-    auto res = _hashes->right.insert(_hashes->right.end(),
-                                     HashMap::right_map::value_type(sid.value(), &hasher));
-    if (res->second != &hasher) {
-        hasher._hasher = nullptr;
-        hasher.unref();
-    }
-    return res->second;
+    auto& shard = _hashes->shard(sid._sid);
+    std::unique_lock<std::shared_mutex> lock(shard.Mutex);
+    std::unique_lock<std::shared_mutex> idLock(_hashes->IDMutex);
+    return _hashes->insert(this, shard, *sid._sid);
 }
 
 void StringHasher::restoreStream(std::istream& stream, std::size_t count)
 {
-    _hashes->clear();
+    {
+        auto locks = _hashes->lockAll();
+        _hashes->clear();
+    }
     std::string content;
     for (uint32_t i = 0; i < count; ++i) {
         int32_t id = 0;
@@ -762,11 +1042,16 @@ void StringHasher::restoreStream(std::istream& stream, std::size_t count)
 
 void StringHasher::clear()
 {
-    for (auto& hasher : _hashes->right) {
+    std::map<long, StringID*> ids;
+    {
+        auto locks = _hashes->lockAll();
+        ids.swap(_hashes->IDs);
+        _hashes->clear();
+    }
+    for (auto& hasher : ids) {
         hasher.second->_hasher = nullptr;
         hasher.second->unref();
     }
-    _hashes->clear();
 }
 
 size_t StringHasher::size() const
@@ -777,7 +1062,8 @@ size_t StringHasher::size() const
 size_t StringHasher::count() const
 {
     size_t count = 0;
-    for (auto& hasher : _hashes->right) {
+    std::shared_lock<std::shared_mutex> lock(_hashes->IDMutex);
+    for (auto& hasher : _hashes->IDs) {
         if (hasher.second->isMarked() || hasher.second->isPersistent()) {
             ++count;
         }
@@ -843,7 +1129,19 @@ void StringHasher::Restore(Base::XMLReader& reader)
 
 unsigned int StringHasher::getMemSize() const
 {
-    return (_hashes->SaveAll ? size() : count()) * 10;
+    // estimated overhead of a node in the ID index and the string set
+    constexpr std::size_t nodeSize = 4 * sizeof(void*);
+
+    std::size_t size = sizeof(HashMap);
+    std::shared_lock<std::shared_mutex> lock(_hashes->IDMutex);
+    for (const auto& [id, sid] : _hashes->IDs) {
+        size += sizeof(StringID) + 2 * nodeSize;
+        size += static_cast<std::size_t>(sid->_data.size() + sid->_postfix.size());
+        size += static_cast<std::size_t>(sid->_sids.size()) * sizeof(StringIDRef);
+    }
+    return static_cast<unsigned int>(
+        std::min<std::size_t>(size, std::numeric_limits<unsigned int>::max())
+    );
 }
 
 PyObject* StringHasher::getPyObject()
@@ -854,7 +1152,8 @@ PyObject* StringHasher::getPyObject()
 std::map<long, StringIDRef> StringHasher::getIDMap() const
 {
     std::map<long, StringIDRef> ret;
-    for (auto& hasher : _hashes->right) {
+    std::shared_lock<std::shared_mutex> lock(_hashes->IDMutex);
+    for (auto& hasher : _hashes->IDs) {
         ret.emplace_hint(ret.end(), hasher.first, StringIDRef(hasher.second));
     }
     return ret;
@@ -862,7 +1161,8 @@ std::map<long, StringIDRef> StringHasher::getIDMap() const
 
 void StringHasher::clearMarks() const
 {
-    for (auto& hasher : _hashes->right) {
+    std::shared_lock<std::shared_mutex> lock(_hashes->IDMutex);
+    for (auto& hasher : _hashes->IDs) {
         hasher.second->_flags.setFlag(StringID::Flag::Marked, false);
     }
 }
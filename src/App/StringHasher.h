@@ -26,6 +26,7 @@
 
 #include <bitset>
 #include <memory>
+#include <vector>
 
 #include <QByteArray>
 #include <QVector>
@@ -47,6 +48,7 @@ class MappedName;
 namespace App
 {
 
+class CompactInputStream;
 class StringHasher;
 class StringID;
 class StringIDRef;
@@ -629,6 +631,11 @@ private:
 /// If the string is longer than a given threshold, instead of storing the string, its SHA1 hash is
 /// stored (and the original string discarded). This allows an upper threshold on the length of a
 /// stored string, while still effectively guaranteeing uniqueness in the table.
+///
+/// getID() may be called concurrently from several threads. The table is split into shards by
+/// string hash, lookups of existing strings only take a shared lock on their shard, and inserts
+/// only lock the shard they go to. compact(), clear() and the restore functions must not run
+/// concurrently with anything else.
 class AppExport StringHasher: public Base::Persistence, public Base::Handled
 {
 
@@ -702,6 +709,18 @@ public:
      */
     StringIDRef getID(const QByteArray& data, Options options = Option::Hashable);
 
+    /** Map a batch of text or binary data to integers
+     *
+     * @param data: input data.
+     * @param options: options describing how to store the data, applied to all entries.
+     * @return The StringIDs in the same order as the input.
+     *
+     * Same as calling getID(const QByteArray&, Options) for each entry, except that each shard
+     * of the table is locked only once for the whole batch.
+     */
+    std::vector<StringIDRef> getIDs(const std::vector<QByteArray>& data,
+                                    Options options = Option::Hashable);
+
     /** Map geometry element name to an integer */
     StringIDRef getID(const Data::MappedName& name, const QVector<StringIDRef>& sids);
 
@@ -770,11 +789,14 @@ public:
     friend class StringID;
 
 protected:
+    StringIDRef prepareID(const QByteArray& data, Options options) const;
     StringID* insert(const StringIDRef& sid);
     long lastID() const;
     void saveStream(std::ostream& stream) const;
     void restoreStream(std::istream& stream, std::size_t count);
     void restoreStreamNew(std::istream& stream, std::size_t count);
+    void saveStreamBinary(std::ostream& stream) const;
+    void restoreStreamBinary(CompactInputStream& stream, std::size_t count);
 
 private:
     std::unique_ptr<HashMap>
@@ -25,7 +25,9 @@
 
 #include <cassert>
 
+#include <algorithm>
 #include <atomic>
+#include <limits>
 #include <Base/Console.h>
 #include <Base/Reader.h>
 #include <Base/Writer.h>
@@ -109,7 +111,41 @@ int Transaction::getLastID()
 
 unsigned int Transaction::getMemSize() const
 {
-    return 0;
+    return static_cast<unsigned int>(
+        std::min<std::size_t>(getMemUsage(), std::numeric_limits<unsigned int>::max()));
+}
+
+std::size_t Transaction::getMemUsage() const
+{
+    if (memSize > 0) {
+        return memSize;
+    }
+    std::size_t size = 0;
+    for (auto& info : _Objects) {
+        size += info.second->getMemUsage();
+    }
+    if (compacted) {
+        memSize = size;
+    }
+    return size;
+}
+
+void Transaction::compact()
+{
+    for (auto& info : _Objects) {
+        info.second->compact();
+    }
+    compacted = true;
+    memSize = 0;
+}
+
+void Transaction::expandDelta(const TransactionalObject* Obj, const Property* pcProp)
+{
+    auto& index = _Objects.get<1>();
+    auto pos = index.find(Obj);
+    if (pos != index.end() && pos->second->expandDelta(pcProp)) {
+        memSize = 0;
+    }
 }
 
 void Transaction::Save(Base::Writer& /*writer*/) const
@@ -372,6 +408,24 @@ void TransactionObject::applyChn(Document& /*Doc*/, TransactionalObject* pcObj,
             //     continue;
             // }
             try {
+                if (data.deltaFront >= 0) {
+                    // The copy only holds the changed entries, the others are the current ones
+                    if (prop->getTypeId() != data.propertyType) {
+                        FC_ERR("Cannot restore " << prop->getFullName() << " after a type change");
+                        continue;
+                    }
+                    // The dropped entries must still be the same as when they were trimmed
+                    auto current = dynamic_cast<const PropertyListsBase*>(prop);
+                    if (!current || current->getSize() != data.deltaSize
+                        || current->hashDelta(data.deltaFront, data.deltaBack) != data.deltaHash) {
+                        FC_ERR("Cannot restore " << prop->getFullName()
+                                                 << " after a change outside of the undo history");
+                        continue;
+                    }
+                    auto list = dynamic_cast<PropertyListsBase*>(data.property);
+                    list->restoreDelta(*prop, data.deltaFront, data.deltaBack);
+                    data.deltaFront = -1;
+                }
                 prop->Paste(*data.property);
             }
             catch (Base::Exception& e) {
@@ -387,6 +441,60 @@ void TransactionObject::applyChn(Document& /*Doc*/, TransactionalObject* pcObj,
     }
 }
 
+void TransactionObject::compact()
+{
+    // Only for changed objects, whose static properties are still alive
+    if (status != Chn) {
+        return;
+    }
+    for (auto& v : _PropChangeMap) {
+        auto& data = v.second;
+        if (!data.property || !data.propertyOrig || !data.name.empty() || !data.nameOrig.empty()
+            || data.deltaFront >= 0) {
+            continue;
+        }
+        // Outputs may change after the transaction without being recorded
+        const Property* prop = data.propertyOrig;
+        if ((prop->getType() & Prop_Output) || prop->testStatus(Property::Output)
+            || prop->getTypeId() != data.propertyType) {
+            continue;
+        }
+        auto list = dynamic_cast<PropertyListsBase*>(data.property);
+        int front = 0;
+        int back = 0;
+        if (list && list->trimDelta(*prop, front, back)) {
+            auto current = dynamic_cast<const PropertyListsBase*>(prop);
+            data.deltaFront = front;
+            data.deltaBack = back;
+            data.deltaSize = current->getSize();
+            data.deltaHash = current->hashDelta(front, back);
+        }
+    }
+}
+
+bool TransactionObject::expandDelta(const Property* pcProp)
+{
+    auto it = _PropChangeMap.find(pcProp->getID());
+    if (it == _PropChangeMap.end()) {
+        return false;
+    }
+    auto& data = it->second;
+    if (data.deltaFront < 0 || data.propertyOrig != pcProp) {
+        return false;
+    }
+    // The current value is still the one the copy was trimmed against, unless
+    // an earlier unrecorded change went unnoticed, which undo reports
+    auto current = dynamic_cast<const PropertyListsBase*>(pcProp);
+    if (current && current->getSize() == data.deltaSize
+        && current->hashDelta(data.deltaFront, data.deltaBack) == data.deltaHash) {
+        auto list = dynamic_cast<PropertyListsBase*>(data.property);
+        list->restoreDelta(*pcProp, data.deltaFront, data.deltaBack);
+        data.deltaFront = -1;
+        return true;
+    }
+    return false;
+}
+
 void TransactionObject::setProperty(const Property* pcProp)
 {
     auto& data = _PropChangeMap[pcProp->getID()];
@@ -450,7 +558,19 @@ void TransactionObject::addOrRemoveProperty(const Property* pcProp, bool add)
 
 unsigned int TransactionObject::getMemSize() const
 {
-    return 0;
+    return static_cast<unsigned int>(
+        std::min<std::size_t>(getMemUsage(), std::numeric_limits<unsigned int>::max()));
+}
+
+std::size_t TransactionObject::getMemUsage() const
+{
+    std::size_t size = 0;
+    for (auto& v : _PropChangeMap) {
+        if (v.second.property && v.second.nameOrig.empty()) {
+            size += v.second.property->getCopyMemSize();
+        }
+    }
+    return size;
 }
 
 void TransactionObject::Save(Base::Writer& /*writer*/) const
@@ -102,6 +102,34 @@ public:
     /// Check if the transaction list is empty.
     bool isEmpty() const;
 
+    /**
+     * @brief Reduce the memory of a committed transaction.
+     *
+     * Copies of list properties only keep the entries that were changed, and
+     * the memory usage is computed once when first asked for, as the
+     * transaction doesn't change anymore.
+     */
+    void compact();
+
+    /**
+     * @brief Get the memory held by the copies of this transaction.
+     *
+     * @return The memory in bytes, without data shared with the document.
+     */
+    std::size_t getMemUsage() const;
+
+    /**
+     * @brief Restore the full copy of a list property reduced by compact().
+     *
+     * Must be called before the property is changed without being recorded
+     * by a transaction, as undo puts the dropped entries back from the
+     * current value.
+     *
+     * @param[in] Obj The object of the property.
+     * @param[in] pcProp The property that is about to change.
+     */
+    void expandDelta(const TransactionalObject* Obj, const Property* pcProp);
+
     /**
      * @brief Check if this object is used in a transaction.
      *
@@ -156,6 +184,9 @@ private:
 
 private:
     int transID;
+    // Computed on demand once compact() was called, zero before
+    mutable std::size_t memSize {0};
+    bool compacted {false};
     using Info = std::pair<const TransactionalObject*, TransactionObject*>;
     bmi::multi_index_container<
         Info,
@@ -230,6 +261,14 @@ public:
      */
     void addOrRemoveProperty(const Property* prop, bool add);
 
+    /// Reduce copies of list properties to the changed entries, see Transaction::compact()
+    void compact();
+    /// Restore the full copy of a list property, see Transaction::expandDelta()
+    bool expandDelta(const Property* pcProp);
+
+    /// Memory held by the property copies, see Transaction::getMemUsage()
+    std::size_t getMemUsage() const;
+
     unsigned int getMemSize() const override;
     void Save(Base::Writer& writer) const override;
     void Restore(Base::XMLReader& reader) override;
@@ -252,6 +291,12 @@ protected:
         const Property* propertyOrig = nullptr;
         // for property renaming
         std::string nameOrig;
+        // Entries of a list property that are not in the copy, see PropertyListsBase::trimDelta()
+        int deltaFront = -1;
+        int deltaBack = 0;
+        // Size and hash of the entries that are not in the copy, as they were when trimmed
+        int deltaSize = 0;
+        std::size_t deltaHash = 0;
     };
 
     /// A map to maintain the properties of the object.
@@ -28,9 +28,12 @@
 #pragma warning(disable : 4834)
 #endif
 
+#include <algorithm>
 #include <map>
 #include <string>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
@@ -44,6 +47,7 @@
 #include <App/DocumentObserver.h>
 #include <App/StringHasher.h>
 #include <App/ExportInfo.h>
+#include <App/RecomputeStats.h>
 #include <Base/UniqueNameManager.h>
 
 // using VertexProperty = boost::property<boost::vertex_root_t, DocumentObject* >;
@@ -103,8 +107,52 @@ struct DocumentP
 
     Document::PreRecomputeHook _preRecomputeHook;
 
+    /// Object change notification emitted by a worker thread during parallel recompute
+    struct DeferredChange
+    {
+        const TransactionalObject* object;
+        const Property* property;
+        bool before;
+    };
+    // Guards the recompute log and the transaction during parallel recompute
+    std::recursive_mutex recomputeMutex;
+    std::thread::id recomputeThread;
+    bool parallelRecompute {false};
+    std::vector<DeferredChange> deferredChanges;
+    RecomputeStats recomputeStats;
+
+    // Changes recorded during a bulk update and the index of each object's entry
+    int bulkUpdateDepth {0};
+    std::vector<BulkChange> bulkChanges;
+    std::unordered_map<const DocumentObject*, std::size_t> bulkChangeIndex;
+
+    // Objects of each exact type in creation order. Each entry keeps the position of the
+    // object in the sequence of added objects to merge the entries of several types.
+    struct TypedObject
+    {
+        std::size_t sequence;
+        DocumentObject* object;
+    };
+    std::unordered_map<Base::Type::TypeId, std::vector<TypedObject>> objectTypeIndex;
+    std::size_t objectSequence {0};
+    // Objects by their label in creation order, rebuilt on demand after a label changed
+    std::unordered_map<std::string, std::vector<DocumentObject*>> objectLabelIndex;
+    bool objectLabelIndexValid {false};
+
+    // Sorted dependency list of all objects, valid as long as the dependency
+    // revision and the options don't change
+    std::vector<DocumentObject*> sortedObjects;
+    std::size_t sortedObjectsRevision {0};
+    int sortedObjectsOptions {-1};
+
     DocumentP();
 
+    /// Check whether the calling thread is a recompute worker
+    bool isRecomputeWorker() const
+    {
+        return parallelRecompute && std::this_thread::get_id() != recomputeThread;
+    }
+
     void addRecomputeLog(const char* why, App::DocumentObject* obj)
     {
         addRecomputeLog(new DocumentObjectExecReturn(why, obj));
@@ -121,6 +169,7 @@ struct DocumentP
             delete returnCode;
             return;
         }
+        std::lock_guard<std::recursive_mutex> guard(recomputeMutex);
         _RecomputeLog.emplace(returnCode->Which,
                               std::unique_ptr<DocumentObjectExecReturn>(returnCode));
         returnCode->Which->setStatus(ObjectStatus::Error, true);
@@ -136,12 +185,137 @@ struct DocumentP
         }
     }
 
+    const std::vector<DocumentObject*>& getSortedObjects(int options)
+    {
+        auto revision = DocumentObject::getDependencyRevision();
+        if (sortedObjectsOptions != options || sortedObjectsRevision != revision) {
+            sortedObjects = Document::getDependencyList(objectArray, options);
+            // sorting does not modify the links and therefore the revision
+            sortedObjectsRevision = revision;
+            sortedObjectsOptions = options;
+        }
+        return sortedObjects;
+    }
+
+    void addToObjectIndex(DocumentObject* obj)
+    {
+        objectTypeIndex[obj->getTypeId().getKey()].push_back({objectSequence++, obj});
+        objectLabelIndexValid = false;
+    }
+
+    void removeFromObjectIndex(const DocumentObject* obj)
+    {
+        auto it = objectTypeIndex.find(obj->getTypeId().getKey());
+        if (it != objectTypeIndex.end()) {
+            auto& objects = it->second;
+            auto pos = std::find_if(objects.begin(), objects.end(), [obj](const auto& entry) {
+                return entry.object == obj;
+            });
+            if (pos != objects.end()) {
+                objects.erase(pos);
+            }
+            if (objects.empty()) {
+                objectTypeIndex.erase(it);
+            }
+        }
+        objectLabelIndexValid = false;
+    }
+
+    void clearObjectIndex()
+    {
+        objectTypeIndex.clear();
+        objectLabelIndex.clear();
+        objectLabelIndexValid = false;
+    }
+
+    /// Get the objects whose type fulfills \a match in creation order
+    template<typename Pred>
+    std::vector<DocumentObject*> getObjectsOfType(Pred match) const
+    {
+        std::vector<const std::vector<TypedObject>*> matches;
+        for (const auto& it : objectTypeIndex) {
+            if (match(Base::Type::fromKey(it.first))) {
+                matches.push_back(&it.second);
+            }
+        }
+
+        std::vector<DocumentObject*> objects;
+        if (matches.size() == 1) {
+            objects.reserve(matches.front()->size());
+            for (const auto& entry : *matches.front()) {
+                objects.push_back(entry.object);
+            }
+        }
+        else if (!matches.empty()) {
+            std::vector<TypedObject> entries;
+            for (auto typed : matches) {
+                entries.insert(entries.end(), typed->begin(), typed->end());
+            }
+            std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+                return a.sequence < b.sequence;
+            });
+            objects.reserve(entries.size());
+            for (const auto& entry : entries) {
+                objects.push_back(entry.object);
+            }
+        }
+        return objects;
+    }
+
+    const std::vector<DocumentObject*>* getObjectsByLabel(const std::string& label)
+    {
+        if (!objectLabelIndexValid) {
+            objectLabelIndex.clear();
+            for (auto obj : objectArray) {
+                objectLabelIndex[obj->Label.getStrValue()].push_back(obj);
+            }
+            objectLabelIndexValid = true;
+        }
+        auto it = objectLabelIndex.find(label);
+        return it != objectLabelIndex.end() ? &it->second : nullptr;
+    }
+
+    /// Record a created object or a changed property during a bulk update
+    void recordBulkChange(const DocumentObject* obj, const Property* prop)
+    {
+        auto res = bulkChangeIndex.emplace(obj, bulkChanges.size());
+        if (res.second) {
+            bulkChanges.push_back({const_cast<DocumentObject*>(obj), false, {}});
+        }
+        auto& change = bulkChanges[res.first->second];
+        if (!prop) {
+            change.created = true;
+            return;
+        }
+        if (!prop->getName()) {
+            return;
+        }
+        auto& names = change.properties;
+        if (std::find(names.begin(), names.end(), prop->getName()) == names.end()) {
+            names.emplace_back(prop->getName());
+        }
+    }
+
+    /// Drop the recorded changes of a removed object
+    void forgetBulkChange(const DocumentObject* obj)
+    {
+        auto it = bulkChangeIndex.find(obj);
+        if (it != bulkChangeIndex.end()) {
+            bulkChanges[it->second].object = nullptr;
+            bulkChangeIndex.erase(it);
+        }
+    }
+
     void clearDocument()
     {
+        bulkChanges.clear();
+        bulkChangeIndex.clear();
+        clearObjectIndex();
         objectLabelManager.clear();
         objectArray.clear();
         for (auto& v : objectMap) {
             v.second->setStatus(ObjectStatus::Destroy, true);
+            v.second->clearOutListCache();
             delete (v.second);
             v.second = nullptr;
         }
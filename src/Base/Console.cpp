@@ -32,10 +32,13 @@
 #endif
 #include <cstring>
 #include <functional>
+#include <mutex>
+#include <vector>
 
 #include "Console.h"
 #include "PyObjectBase.h"
 #include <QCoreApplication>
+#include <QThread>
 
 
 using namespace Base;
@@ -71,9 +74,24 @@ public:
     {}
 };
 
+/// A message of the batched connection mode
+struct ConsoleMessage
+{
+    LogStyle category;
+    IntendedRecipient recipient;
+    ContentType content;
+    std::string notifier;
+    std::string msg;
+};
+
 class ConsoleOutput: public QObject  // clazy:exclude=missing-qobject-macro
 {
 public:
+    /// Event type to deliver the batched messages
+    static constexpr QEvent::Type BatchEvent = static_cast<QEvent::Type>(QEvent::User + 1);
+    /// Number of pending messages that are delivered right away from the main thread
+    static constexpr std::size_t maxPending = 10000;
+
     static ConsoleOutput* getInstance()
     {
         if (!instance) {
@@ -83,13 +101,58 @@ public:
     }
     static void destruct()
     {
+        if (instance) {
+            instance->flush();
+        }
         delete instance;
         instance = nullptr;
     }
 
+    void queue(ConsoleMessage&& message)
+    {
+        bool urgent = message.category == LogStyle::Error
+            || message.category == LogStyle::Critical;
+        bool first {};
+        std::size_t count {};
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            first = pending.empty();
+            pending.push_back(std::move(message));
+            count = pending.size();
+        }
+        if ((urgent || count >= maxPending) && QThread::currentThread() == thread()) {
+            flush();
+        }
+        else if (first) {
+            QCoreApplication::postEvent(this, new QEvent(BatchEvent));
+        }
+    }
+
+    /// Deliver the pending messages, must be called from the main thread
+    void flush()
+    {
+        std::vector<ConsoleMessage> messages;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            messages.swap(pending);
+        }
+        for (const auto& message : messages) {
+            Console().notifyPrivate(
+                message.category,
+                message.recipient,
+                message.content,
+                message.notifier,
+                message.msg
+            );
+        }
+    }
+
     void customEvent(QEvent* ev) override
     {
-        if (ev->type() == QEvent::User) {
+        if (ev->type() == BatchEvent) {
+            flush();
+        }
+        else if (ev->type() == QEvent::User) {
             switch (const auto ce = static_cast<ConsoleEvent*>(ev); ce->msgtype) {
                 case ConsoleSingleton::MsgType_Txt:
                     Console().notifyPrivate(
@@ -151,6 +214,9 @@ public:
 
 private:
     static ConsoleOutput* instance;  // NOLINT
+
+    std::mutex mutex;
+    std::vector<ConsoleMessage> pending;
 };
 
 ConsoleOutput* ConsoleOutput::instance = nullptr;  // NOLINT
@@ -277,12 +343,17 @@ bool ConsoleSingleton::isMsgTypeEnabled(const char* sObs, const FreeCAD_ConsoleM
 
 void ConsoleSingleton::setConnectionMode(const ConnectionMode mode)
 {
+    const ConnectionMode previous = connectionMode;
     connectionMode = mode;
 
     // make sure this method gets called from the main thread
-    if (connectionMode == Queued) {
+    if (connectionMode == Queued || connectionMode == Batched) {
         ConsoleOutput::getInstance();
     }
+    // don't hold back the collected messages any longer
+    if (previous == Batched && connectionMode != Batched) {
+        ConsoleOutput::getInstance()->flush();
+    }
 }
 
 //**************************************************************************
@@ -347,6 +418,17 @@ void ConsoleSingleton::postEvent(
     );
 }
 
+void ConsoleSingleton::batchEvent(
+    const LogStyle category,
+    const IntendedRecipient recipient,
+    const ContentType content,
+    const std::string& notifiername,
+    std::string&& msg
+)
+{
+    ConsoleOutput::getInstance()->queue({category, recipient, content, notifiername, std::move(msg)});
+}
+
 ILogger* ConsoleSingleton::get(const char* Name) const
 {
     const char* OName {};
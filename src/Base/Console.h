@@ -792,10 +792,18 @@ public:
     {
         Verbose = 1,  // suppress Log messages
     };
+    /** How messages reach the observers
+     * Direct: right away from the calling thread
+     * Queued: one event per message on the main thread's event loop
+     * Batched: the messages of all threads are collected and delivered together
+     * on the main thread's event loop, errors sent from the main thread and a
+     * long backlog are delivered at once.
+     */
     enum ConnectionMode
     {
         Direct = 0,
-        Queued = 1
+        Queued = 1,
+        Batched = 2
     };
 
     enum FreeCAD_ConsoleMsgType
@@ -880,6 +888,13 @@ private:
         const std::string& notifiername,
         const std::string& msg
     );
+    void batchEvent(
+        LogStyle category,
+        IntendedRecipient recipient,
+        ContentType content,
+        const std::string& notifiername,
+        std::string&& msg
+    );
     void notifyPrivate(
         LogStyle category,
         IntendedRecipient recipient,
@@ -1210,6 +1225,9 @@ void Base::ConsoleSingleton::send(const std::string& notifiername, const char* p
     if (connectionMode == Direct) {
         notify<category, recipient, contenttype>(notifiername, format);
     }
+    else if (connectionMode == Batched) {
+        batchEvent(category, recipient, contenttype, notifiername, std::move(format));
+    }
     else {
 
         const auto type = getConsoleMsg(category);
@@ -209,6 +209,17 @@ private:
  * must hold the GIL when instantiating an object of PyGILStateRelease.
  * As PyGILStateLocker it's best to create an instance of PyGILStateRelease on the
  * stack.
+ *
+ * While the GIL is released other Python threads run concurrently, so the code in
+ * the scope must:
+ * - not use any Python object or call the Python C API (including PyCXX),
+ * - not modify C++ data that is owned by a Python object, i.e. operate on local
+ *   objects and assign the result after the GIL has been acquired again. Reading
+ *   such data is fine as long as the caller keeps a reference to the Python object,
+ * - not modify documents or objects because their observers may run Python code.
+ *
+ * Python exceptions must be raised after the GIL has been acquired again. C++
+ * exceptions are fine because the destructor acquires the GIL during stack unwinding.
  */
 class BaseExport PyGILStateRelease
 {
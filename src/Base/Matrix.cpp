@@ -493,6 +493,38 @@ bool Matrix4D::toAxisAngle(Vector3d& rclBase, Vector3d& rclDir, double& rfAngle,
     return true;
 }
 
+namespace
+{
+template<typename Vec>
+void multVecs(const Matrix4D& mat, const Vec* src, Vec* dst, std::size_t count)
+{
+    using num_type = typename Vec::num_type;
+    // same computation as multVec() but the matrix elements are only loaded once, which
+    // also lets the compiler vectorize the loop
+    const double m00 = mat[0][0], m01 = mat[0][1], m02 = mat[0][2], m03 = mat[0][3];
+    const double m10 = mat[1][0], m11 = mat[1][1], m12 = mat[1][2], m13 = mat[1][3];
+    const double m20 = mat[2][0], m21 = mat[2][1], m22 = mat[2][2], m23 = mat[2][3];
+    for (std::size_t i = 0; i < count; i++) {
+        const double sx = static_cast<double>(src[i].x);
+        const double sy = static_cast<double>(src[i].y);
+        const double sz = static_cast<double>(src[i].z);
+        dst[i].x = static_cast<num_type>(m00 * sx + m01 * sy + m02 * sz + m03);
+        dst[i].y = static_cast<num_type>(m10 * sx + m11 * sy + m12 * sz + m13);
+        dst[i].z = static_cast<num_type>(m20 * sx + m21 * sy + m22 * sz + m23);
+    }
+}
+}  // namespace
+
+void Matrix4D::multVec(const Vector3d* src, Vector3d* dst, std::size_t count) const
+{
+    multVecs(*this, src, dst, count);
+}
+
+void Matrix4D::multVec(const Vector3f* src, Vector3f* dst, std::size_t count) const
+{
+    multVecs(*this, src, dst, count);
+}
+
 void Matrix4D::transform(const Vector3f& vec, const Matrix4D& mat)
 {
     move(-vec);
@@ -27,6 +27,8 @@
 #include <algorithm>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <xercesc/dom/DOM.hpp>
 #include <xercesc/framework/LocalFileFormatTarget.hpp>
 #include <xercesc/framework/LocalFileInputSource.hpp>
@@ -408,9 +410,27 @@ Base::Reference<ParameterGrp> ParameterGrp::GetGroup(const char* Name)
     return hGrp;
 }
 
+void ParameterGrp::_Reattach()
+{
+    if (_Detached && _Parent) {
+        _Parent->_GetGroup(_cName.c_str());
+    }
+}
+
 Base::Reference<ParameterGrp> ParameterGrp::_GetGroup(const char* Name)
 {
     Base::Reference<ParameterGrp> rParamGrp;
+    {
+        // an attached group is known without searching its element
+        std::shared_lock<std::shared_mutex> lock(_Mutex);
+        if (_pGroupNode && !_Clearing) {
+            auto it = _GroupMap.find(Name);
+            if (it != _GroupMap.end() && it->second.isValid() && !it->second->_Detached) {
+                return it->second;
+            }
+        }
+    }
+
     if (!_pGroupNode) {
         if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
             FC_WARN("Adding group " << Name << " in an orphan group " << _cName);
@@ -424,30 +444,38 @@ Base::Reference<ParameterGrp> ParameterGrp::_GetGroup(const char* Name)
         return rParamGrp;
     }
 
+    _Reattach();
+
     DOMElement* pcTemp {};
+    bool reattach = false;
+    {
+        std::unique_lock<std::shared_mutex> lock(_Mutex);
 
-    // search if Group node already there
-    pcTemp = FindElement(_pGroupNode, "FCParamGroup", Name);
+        // search if Group node already there
+        pcTemp = FindElement(_pGroupNode, "FCParamGroup", Name);
 
-    // already created?
-    if (!(rParamGrp = _GroupMap[Name]).isValid()) {
-        if (!pcTemp) {
-            pcTemp = CreateElement(_pGroupNode, "FCParamGroup", Name);
+        // already created?
+        if (!(rParamGrp = _GroupMap[Name]).isValid()) {
+            if (!pcTemp) {
+                pcTemp = CreateElement(_pGroupNode, "FCParamGroup", Name);
+            }
+            // create and register handle
+            rParamGrp = Base::Reference<ParameterGrp>(new ParameterGrp(pcTemp, Name, this));
+            _GroupMap[Name] = rParamGrp;
         }
-        // create and register handle
-        rParamGrp = Base::Reference<ParameterGrp>(new ParameterGrp(pcTemp, Name, this));
-        _GroupMap[Name] = rParamGrp;
-    }
-    else if (!pcTemp) {
-        _pGroupNode->appendChild(rParamGrp->_pGroupNode);
-        rParamGrp->_Detached = false;
-        if (this->_Detached && this->_Parent) {
-            // Re-attach the group. Note that this may fail if the parent is
-            // clearing. That's why we check this->_Detached below.
-            this->_Parent->_GetGroup(_cName.c_str());
+        else if (!pcTemp) {
+            _pGroupNode->appendChild(rParamGrp->_pGroupNode);
+            rParamGrp->_Detached = false;
+            reattach = this->_Detached && this->_Parent;
         }
     }
 
+    if (reattach) {
+        // Re-attach the group. Note that this may fail if the parent is
+        // clearing. That's why we check this->_Detached below.
+        this->_Parent->_GetGroup(_cName.c_str());
+    }
+
     if (!pcTemp && !this->_Detached) {
         _Notify(ParamType::FCGroup, Name, Name);
     }
@@ -473,6 +501,7 @@ std::vector<Base::Reference<ParameterGrp>> ParameterGrp::GetGroups()
     Base::Reference<ParameterGrp> rParamGrp;
     std::vector<Base::Reference<ParameterGrp>> vrParamGrp;
 
+    std::unique_lock<std::shared_mutex> lock(_Mutex);
     if (!_pGroupNode) {
         return vrParamGrp;
     }
@@ -507,6 +536,7 @@ bool ParameterGrp::IsEmpty() const
 /// test if a special sub group is in this group
 bool ParameterGrp::HasGroup(const char* Name) const
 {
+    std::shared_lock<std::shared_mutex> lock(_Mutex);
     if (_GroupMap.find(Name) != _GroupMap.end()) {
         return true;
     }
@@ -701,37 +731,99 @@ void ParameterGrp::_SetAttribute(ParamType T, const char* Name, const char* Valu
         return;
     }
 
-    // find or create the Element
-    DOMElement* pcElem = FindOrCreateElement(_pGroupNode, Type, Name);
-    if (pcElem) {
+    _Reattach();
+
+    bool changed = false;
+    {
+        std::unique_lock<std::shared_mutex> lock(_Mutex);
+        // find or create the Element
+        DOMElement* pcElem = FindOrCreateElement(_pGroupNode, Type, Name);
+        if (!pcElem) {
+            return;
+        }
         XStr attr("Value");
         // set the value only if different
         if (strcmp(StrX(pcElem->getAttribute(attr.unicodeForm())).c_str(), Value) != 0) {
             pcElem->setAttribute(attr.unicodeForm(), XStr(Value).unicodeForm());
-            // trigger observer
-            _Notify(T, Name, Value);
+            changed = true;
         }
-        // For backward compatibility, old observer gets notified regardless of
-        // value changes or not.
-        Notify(Name);
+        _ClearCache(T, Name);
+    }
+
+    if (changed) {
+        // trigger observer
+        _Notify(T, Name, Value);
     }
+    // For backward compatibility, old observer gets notified regardless of
+    // value changes or not.
+    Notify(Name);
 }
 
-bool ParameterGrp::GetBool(const char* Name, bool bPreset) const
+template<typename T, typename Func>
+T ParameterGrp::_GetCachedValue(ParamType Type, const char* Name, T Preset, Func read) const
 {
+    auto& cache = _ValueCache[static_cast<std::size_t>(Type)];
+    if (Name) {
+        std::shared_lock<std::shared_mutex> lock(_Mutex);
+        auto it = cache.find(Name);
+        if (it != cache.end()) {
+            return it->second ? std::get<T>(*it->second) : Preset;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(_Mutex);
     if (!_pGroupNode) {
-        return bPreset;
+        return Preset;
     }
 
     // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCBool", Name);
+    CachedValue value;
+    if (DOMElement* pcElem = FindElement(_pGroupNode, TypeName(Type), Name)) {
+        value.emplace(std::in_place_type<T>, read(pcElem));
+    }
+    if (Name) {
+        cache.emplace(Name, value);
+    }
     // if not return preset
-    if (!pcElem) {
-        return bPreset;
+    return value ? std::get<T>(*value) : Preset;
+}
+
+void ParameterGrp::_ClearCache(ParamType Type, const char* Name)
+{
+    if (Name) {
+        auto& cache = _ValueCache[static_cast<std::size_t>(Type)];
+        auto it = cache.find(Name);
+        if (it != cache.end()) {
+            cache.erase(it);
+        }
+    }
+}
+
+void ParameterGrp::_ClearCache(bool recursive)
+{
+    std::vector<Base::Reference<ParameterGrp>> groups;
+    {
+        std::unique_lock<std::shared_mutex> lock(_Mutex);
+        for (auto& cache : _ValueCache) {
+            cache.clear();
+        }
+        if (recursive) {
+            for (const auto& it : _GroupMap) {
+                groups.push_back(it.second);
+            }
+        }
+    }
+    for (auto& grp : groups) {
+        grp->_ClearCache(true);
     }
+}
 
-    // if yes check the value and return
-    return (strcmp(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str(), "1") == 0);
+bool ParameterGrp::GetBool(const char* Name, bool bPreset) const
+{
+    return _GetCachedValue(ParamType::FCBool, Name, bPreset, [](DOMElement* pcElem) {
+        return strcmp(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str(), "1")
+            == 0;
+    });
 }
 
 void ParameterGrp::SetBool(const char* Name, bool bValue)
@@ -797,18 +889,9 @@ std::vector<std::pair<std::string, bool>> ParameterGrp::GetBoolMap(const char* s
 
 long ParameterGrp::GetInt(const char* Name, long lPreset) const
 {
-    if (!_pGroupNode) {
-        return lPreset;
-    }
-
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCInt", Name);
-    // if not return preset
-    if (!pcElem) {
-        return lPreset;
-    }
-    // if yes check the value and return
-    return atol(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str());
+    return _GetCachedValue(ParamType::FCInt, Name, lPreset, [](DOMElement* pcElem) {
+        return atol(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str());
+    });
 }
 
 void ParameterGrp::SetInt(const char* Name, long lValue)
@@ -868,20 +951,14 @@ std::vector<std::pair<std::string, long>> ParameterGrp::GetIntMap(const char* sF
 
 unsigned long ParameterGrp::GetUnsigned(const char* Name, unsigned long lPreset) const
 {
-    if (!_pGroupNode) {
-        return lPreset;
-    }
-
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCUInt", Name);
-    // if not return preset
-    if (!pcElem) {
-        return lPreset;
-    }
-
-    // if yes check the value and return
-    const int base = 10;
-    return strtoul(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str(), nullptr, base);
+    return _GetCachedValue(ParamType::FCUInt, Name, lPreset, [](DOMElement* pcElem) {
+        const int base = 10;
+        return strtoul(
+            StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str(),
+            nullptr,
+            base
+        );
+    });
 }
 
 void ParameterGrp::SetUnsigned(const char* Name, unsigned long lValue)
@@ -949,18 +1026,9 @@ std::vector<std::pair<std::string, unsigned long>> ParameterGrp::GetUnsignedMap(
 
 double ParameterGrp::GetFloat(const char* Name, double dPreset) const
 {
-    if (!_pGroupNode) {
-        return dPreset;
-    }
-
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCFloat", Name);
-    // if not return preset
-    if (!pcElem) {
-        return dPreset;
-    }
-    // if yes check the value and return
-    return atof(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str());
+    return _GetCachedValue(ParamType::FCFloat, Name, dPreset, [](DOMElement* pcElem) {
+        return atof(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str());
+    });
 }
 
 void ParameterGrp::SetFloat(const char* Name, double dValue)
@@ -1035,53 +1103,52 @@ void ParameterGrp::SetASCII(const char* Name, const char* sValue)
         return;
     }
 
-    bool isNew = false;
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCText", Name);
-    if (!pcElem) {
-        pcElem = CreateElement(_pGroupNode, "FCText", Name);
-        isNew = true;
-    }
-    if (pcElem) {
+    _Reattach();
+
+    bool changed = false;
+    {
+        std::unique_lock<std::shared_mutex> lock(_Mutex);
+        bool isNew = false;
+        DOMElement* pcElem = FindElement(_pGroupNode, "FCText", Name);
+        if (!pcElem) {
+            pcElem = CreateElement(_pGroupNode, "FCText", Name);
+            isNew = true;
+        }
+        if (!pcElem) {
+            return;
+        }
         // and set the value
         DOMNode* pcElem2 = pcElem->getFirstChild();
         if (!pcElem2) {
             DOMDocument* pDocument = _pGroupNode->getOwnerDocument();
             DOMText* pText = pDocument->createTextNode(XUTF8Str(sValue).unicodeForm());
             pcElem->appendChild(pText);
-            if (isNew || sValue[0] != 0) {
-                _Notify(ParamType::FCText, Name, sValue);
-            }
+            changed = isNew || sValue[0] != 0;
         }
         else if (strcmp(StrXUTF8(pcElem2->getNodeValue()).c_str(), sValue) != 0) {
             pcElem2->setNodeValue(XUTF8Str(sValue).unicodeForm());
-            _Notify(ParamType::FCText, Name, sValue);
+            changed = true;
         }
-        // trigger observer
-        Notify(Name);
+        _ClearCache(ParamType::FCText, Name);
     }
+
+    if (changed) {
+        _Notify(ParamType::FCText, Name, sValue);
+    }
+    // trigger observer
+    Notify(Name);
 }
 
 std::string ParameterGrp::GetASCII(const char* Name, const char* pPreset) const
 {
-    if (!_pGroupNode) {
-        return pPreset ? pPreset : "";
-    }
-
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCText", Name);
-    // if not return preset
-    if (!pcElem) {
-        if (!pPreset) {
-            return {};
+    std::string preset = pPreset ? pPreset : "";
+    return _GetCachedValue(ParamType::FCText, Name, preset, [](DOMElement* pcElem) {
+        DOMNode* pcElem2 = pcElem->getFirstChild();
+        if (pcElem2) {
+            return std::string(StrXUTF8(pcElem2->getNodeValue()).c_str());
         }
-        return {pPreset};
-    }
-    // if yes check the value and return
-    DOMNode* pcElem2 = pcElem->getFirstChild();
-    if (pcElem2) {
-        return {StrXUTF8(pcElem2->getNodeValue()).c_str()};
-    }
-    return {};
+        return std::string();
+    });
 }
 
 std::vector<std::string> ParameterGrp::GetASCIIs(const char* sFilter) const
@@ -1148,110 +1215,70 @@ std::vector<std::pair<std::string, std::string>> ParameterGrp::GetASCIIMap(const
 //**************************************************************************
 // Access methods
 
-void ParameterGrp::RemoveASCII(const char* Name)
+bool ParameterGrp::_RemoveAttribute(ParamType Type, const char* Name)
 {
+    std::unique_lock<std::shared_mutex> lock(_Mutex);
     if (!_pGroupNode) {
-        return;
+        return false;
     }
 
     // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCText", Name);
+    DOMElement* pcElem = FindElement(_pGroupNode, TypeName(Type), Name);
     // if not return
     if (!pcElem) {
-        return;
+        return false;
     }
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
-
-    // trigger observer
-    _Notify(ParamType::FCText, Name, nullptr);
-    Notify(Name);
+    _ClearCache(Type, Name);
+    return true;
 }
 
-void ParameterGrp::RemoveBool(const char* Name)
+void ParameterGrp::RemoveASCII(const char* Name)
 {
-    if (!_pGroupNode) {
-        return;
+    if (_RemoveAttribute(ParamType::FCText, Name)) {
+        // trigger observer
+        _Notify(ParamType::FCText, Name, nullptr);
+        Notify(Name);
     }
+}
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCBool", Name);
-    // if not return
-    if (!pcElem) {
-        return;
+void ParameterGrp::RemoveBool(const char* Name)
+{
+    if (_RemoveAttribute(ParamType::FCBool, Name)) {
+        // trigger observer
+        _Notify(ParamType::FCBool, Name, nullptr);
+        Notify(Name);
     }
-
-    DOMNode* node = _pGroupNode->removeChild(pcElem);
-    node->release();
-
-    // trigger observer
-    _Notify(ParamType::FCBool, Name, nullptr);
-    Notify(Name);
 }
 
 
 void ParameterGrp::RemoveFloat(const char* Name)
 {
-    if (!_pGroupNode) {
-        return;
-    }
-
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCFloat", Name);
-    // if not return
-    if (!pcElem) {
-        return;
+    if (_RemoveAttribute(ParamType::FCFloat, Name)) {
+        // trigger observer
+        _Notify(ParamType::FCFloat, Name, nullptr);
+        Notify(Name);
     }
-
-    DOMNode* node = _pGroupNode->removeChild(pcElem);
-    node->release();
-
-    // trigger observer
-    _Notify(ParamType::FCFloat, Name, nullptr);
-    Notify(Name);
 }
 
 void ParameterGrp::RemoveInt(const char* Name)
 {
-    if (!_pGroupNode) {
-        return;
-    }
-
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCInt", Name);
-    // if not return
-    if (!pcElem) {
-        return;
+    if (_RemoveAttribute(ParamType::FCInt, Name)) {
+        // trigger observer
+        _Notify(ParamType::FCInt, Name, nullptr);
+        Notify(Name);
     }
-
-    DOMNode* node = _pGroupNode->removeChild(pcElem);
-    node->release();
-
-    // trigger observer
-    _Notify(ParamType::FCInt, Name, nullptr);
-    Notify(Name);
 }
 
 void ParameterGrp::RemoveUnsigned(const char* Name)
 {
-    if (!_pGroupNode) {
-        return;
-    }
-
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCUInt", Name);
-    // if not return
-    if (!pcElem) {
-        return;
+    if (_RemoveAttribute(ParamType::FCUInt, Name)) {
+        // trigger observer
+        _Notify(ParamType::FCUInt, Name, nullptr);
+        Notify(Name);
     }
-
-    DOMNode* node = _pGroupNode->removeChild(pcElem);
-    node->release();
-
-    // trigger observer
-    _Notify(ParamType::FCUInt, Name, nullptr);
-    Notify(Name);
 }
 
 Base::Color ParameterGrp::GetColor(const char* Name, Base::Color lPreset) const
@@ -1305,6 +1332,7 @@ void ParameterGrp::RemoveColor(const char* Name)
 
 void ParameterGrp::RemoveGrp(const char* Name)
 {
+    std::unique_lock<std::shared_mutex> lock(_Mutex);
     if (!_pGroupNode) {
         return;
     }
@@ -1319,7 +1347,9 @@ void ParameterGrp::RemoveGrp(const char* Name)
     // those existing observer won't get any notification. BUT, we DO delete
     // the underlying xml elements, so that we don't save the empty group
     // later.
+    lock.unlock();
     it->second->Clear(false);
+    lock.lock();
     if (!it->second->_Detached) {
         it->second->_Detached = true;
         _pGroupNode->removeChild(it->second->_pGroupNode);
@@ -1329,6 +1359,7 @@ void ParameterGrp::RemoveGrp(const char* Name)
         it->second->_Manager = nullptr;
         _GroupMap.erase(it);
     }
+    lock.unlock();
 
     // trigger observer
     Notify(Name);
@@ -1336,6 +1367,7 @@ void ParameterGrp::RemoveGrp(const char* Name)
 
 bool ParameterGrp::RenameGrp(const char* OldName, const char* NewName)
 {
+    std::unique_lock<std::shared_mutex> lock(_Mutex);
     if (!_pGroupNode) {
         return false;
     }
@@ -1359,6 +1391,7 @@ bool ParameterGrp::RenameGrp(const char* OldName, const char* NewName)
     if (pcElem) {
         pcElem->setAttribute(XStrLiteral("Name").unicodeForm(), XStr(NewName).unicodeForm());
     }
+    lock.unlock();
 
     _Notify(ParamType::FCGroup, NewName, OldName);
     return true;
@@ -1370,7 +1403,10 @@ void ParameterGrp::Clear(bool notify)
         return;
     }
 
+    // set the flag under the lock so that no other thread adds a sub-group meanwhile
+    std::unique_lock<std::shared_mutex> lock(_Mutex);
     Base::StateLocker guard(_Clearing);
+    lock.unlock();
 
     // early trigger notification of group removal when all its children
     // hierarchies are intact.
@@ -1384,6 +1420,7 @@ void ParameterGrp::Clear(bool notify)
         // underlying xml element from its parent so that we won't save this
         // empty group.
         it->second->Clear(notify);
+        std::lock_guard<std::shared_mutex> mapLock(_Mutex);
         if (!it->second->_Detached) {
             it->second->_Detached = true;
             _pGroupNode->removeChild(it->second->_pGroupNode);
@@ -1400,6 +1437,10 @@ void ParameterGrp::Clear(bool notify)
 
     // Remove the rest of non-group nodes;
     std::vector<std::pair<ParamType, std::string>> params;
+    lock.lock();
+    for (auto& cache : _ValueCache) {
+        cache.clear();
+    }
     for (DOMNode *child = _pGroupNode->getFirstChild(), *next = child; child != nullptr;
          child = next) {
         next = next->getNextSibling();
@@ -1414,6 +1455,7 @@ void ParameterGrp::Clear(bool notify)
         DOMNode* node = _pGroupNode->removeChild(child);
         node->release();
     }
+    lock.unlock();
 
     for (auto& v : params) {
         _Notify(v.first, v.second.c_str(), nullptr);
@@ -1584,7 +1626,13 @@ void ParameterGrp::NotifyAll()
 
 void ParameterGrp::_Reset()
 {
-    _pGroupNode = nullptr;
+    {
+        std::unique_lock<std::shared_mutex> lock(_Mutex);
+        _pGroupNode = nullptr;
+        for (auto& cache : _ValueCache) {
+            cache.clear();
+        }
+    }
     for (auto& v : _GroupMap) {
         v.second->_Reset();
     }
@@ -1927,6 +1975,7 @@ int ParameterManager::LoadDocument(const XERCES_CPP_NAMESPACE::InputSource& inpu
         throw XMLBaseException("Malformed Parameter document: Root group not found");
     }
 
+    _ClearCache(true);
     return 1;
 }
 
@@ -2049,6 +2098,7 @@ void ParameterManager::CreateDocument()
     _pGroupNode = _pDocument->createElement(XStrLiteral("FCParamGroup").unicodeForm());
     _pGroupNode->setAttribute(XStrLiteral("Name").unicodeForm(), XStrLiteral("Root").unicodeForm());
     rootElem->appendChild(_pGroupNode);
+    _ClearCache(true);
 }
 
 void ParameterManager::CheckDocument() const
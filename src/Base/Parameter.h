@@ -48,7 +48,13 @@ using PyObject = struct _object;
 # undef isalnum
 #endif
 
+#include <array>
+#include <atomic>
 #include <map>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <variant>
 #include <vector>
 #include <fastsignals/signal.h>
 #include <xercesc/util/XercesDefs.hpp>
@@ -438,6 +444,20 @@ protected:
 
     void _Reset();
 
+    /** Get the value of a parameter from the cache or read it with \a read
+     *  from its DOM element and add it to the cache.
+     */
+    template<typename T, typename Func>
+    T _GetCachedValue(ParamType Type, const char* Name, T Preset, Func read) const;
+    /// Remove the cached value of a parameter, the caller must lock _Mutex
+    void _ClearCache(ParamType Type, const char* Name);
+    /// Remove all cached values of this and optionally all sub-groups
+    void _ClearCache(bool recursive);
+    /// Remove the element of a parameter, returns false if it doesn't exist
+    bool _RemoveAttribute(ParamType Type, const char* Name);
+    /// Re-attach a detached group before locking it because this notifies the observers
+    void _Reattach();
+
     void _SetAttribute(ParamType Type, const char* Name, const char* Value);
     void _Notify(ParamType Type, const char* Name, const char* Value);
 
@@ -491,12 +511,24 @@ protected:
     ParameterGrp* _Parent = nullptr;
     ParameterManager* _Manager = nullptr;
     /// Means this group xml element has not been added to its parent yet.
-    bool _Detached = false;
+    std::atomic<bool> _Detached {false};
     /** Indicate this group is currently being cleared
      *
      * This is used to prevent anynew value/sub-group to be added in observer
      */
     bool _Clearing = false;
+
+    /// Value read by a typed getter, empty if the parameter doesn't exist
+    using CachedValue = std::optional<std::variant<bool, long, unsigned long, double, std::string>>;
+    /// Cached parameter values by name for each ParamType
+    mutable std::array<std::map<std::string, CachedValue, std::less<>>, 7> _ValueCache;
+    /** Guards the value cache, the group map and the child nodes of the group node
+     *
+     * The typed getters only take a shared lock if the value is cached, so that
+     * parameters can be read cheaply from any thread. Observers are always
+     * notified after releasing the lock.
+     */
+    mutable std::shared_mutex _Mutex;
 };
 
 /** The parameter serializer class
@@ -199,6 +199,17 @@ void Placement::multVec(const Vector3f& src, Vector3f& dst) const
     dst += Base::toVector<float>(this->_pos);
 }
 
+void Placement::multVec(const Vector3d* src, Vector3d* dst, std::size_t count) const
+{
+    // convert the rotation once instead of applying the quaternion to each vector
+    toMatrix().multVec(src, dst, count);
+}
+
+void Placement::multVec(const Vector3f* src, Vector3f* dst, std::size_t count) const
+{
+    toMatrix().multVec(src, dst, count);
+}
+
 Placement Placement::slerp(const Placement& p0, const Placement& p1, double t)
 {
     Rotation rot = Rotation::slerp(p0.getRotation(), p1.getRotation(), t);
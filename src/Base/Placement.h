@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <string>
 
 #include "Rotation.h"
@@ -105,6 +106,9 @@ public:
 
     void multVec(const Vector3d& src, Vector3d& dst) const;
     void multVec(const Vector3f& src, Vector3f& dst) const;
+    /// Transform an array of \a count vectors, \a src and \a dst may be the same
+    void multVec(const Vector3d* src, Vector3d* dst, std::size_t count) const;
+    void multVec(const Vector3f* src, Vector3f* dst, std::size_t count) const;
     //@}
 
     static Placement slerp(const Placement& p0, const Placement& p1, double t);
@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include <algorithm>
+#include <thread>
+
+#include "ProgressTask.h"
+#include "Exception.h"
+#include "Sequencer.h"
+
+using namespace Base;
+
+namespace
+{
+// The progress of a task tree is accumulated in fixed point units of the root task
+constexpr double totalUnits = 4294967296.0;  // 2^32
+
+// A task without steps is treated like a task with a single step
+double toUnitsPerStep(double parentUnits, std::size_t steps)
+{
+    return parentUnits / static_cast<double>(std::max<std::size_t>(steps, 1));
+}
+}  // namespace
+
+ProgressTask::ProgressTask(std::size_t steps)
+    : root(this)
+    , stepCount(steps)
+    , unitsPerStep(toUnitsPerStep(totalUnits, steps))
+{}
+
+ProgressTask::ProgressTask(ProgressTask& parent, std::size_t steps, std::size_t parentSteps)
+    : root(parent.root)
+    , stepCount(steps)
+    , unitsPerStep(toUnitsPerStep(parent.unitsPerStep * static_cast<double>(parentSteps), steps))
+{}
+
+ProgressTask::~ProgressTask()
+{
+    if (root != this) {
+        if (stepCount == 0) {
+            root->units.fetch_add(static_cast<std::uint64_t>(unitsPerStep));
+        }
+        else {
+            setProgress(stepCount);
+        }
+    }
+}
+
+std::size_t ProgressTask::numberOfSteps() const
+{
+    return stepCount;
+}
+
+void ProgressTask::report(std::size_t from, std::size_t to) noexcept
+{
+    // Positions are converted cumulatively, so that the rounding errors of the single calls
+    // don't add up.
+    auto toUnits = [this](std::size_t pos) {
+        auto clamped = static_cast<double>(std::min(pos, stepCount));
+        return static_cast<std::uint64_t>(unitsPerStep * clamped);
+    };
+    std::uint64_t delta = toUnits(to) - toUnits(from);
+    if (delta > 0) {
+        root->units.fetch_add(delta, std::memory_order_relaxed);
+    }
+}
+
+void ProgressTask::advance(std::size_t count) noexcept
+{
+    std::size_t from = done.fetch_add(count, std::memory_order_relaxed);
+    report(from, from + count);
+}
+
+void ProgressTask::setProgress(std::size_t pos) noexcept
+{
+    std::size_t from = done.load(std::memory_order_relaxed);
+    while (pos > from) {
+        if (done.compare_exchange_weak(from, pos, std::memory_order_relaxed)) {
+            report(from, pos);
+            break;
+        }
+    }
+}
+
+float ProgressTask::fraction() const noexcept
+{
+    auto value = static_cast<double>(root->units.load(std::memory_order_relaxed));
+    return static_cast<float>(std::min(value / totalUnits, 1.0));
+}
+
+void ProgressTask::cancel() noexcept
+{
+    root->canceled.store(true, std::memory_order_relaxed);
+}
+
+bool ProgressTask::isCanceled() const noexcept
+{
+    return root->canceled.load(std::memory_order_relaxed);
+}
+
+void ProgressTask::checkAbort() const
+{
+    if (isCanceled()) {
+        throw AbortException();
+    }
+}
+
+// ---------------------------------------------------------
+
+void Base::waitForProgress(
+    const char* text,
+    ProgressTask& task,
+    const std::function<bool()>& isFinished,
+    std::chrono::milliseconds interval
+)
+{
+    using Clock = std::chrono::steady_clock;
+    constexpr std::size_t percent = 100;
+    SequencerLauncher seq(text, percent);
+    std::size_t current = 0;
+
+    try {
+        while (!isFinished()) {
+            // Check for completion more often than the progress is shown, so that the caller
+            // doesn't wait for the next frame when the workers are done.
+            Clock::time_point frame = Clock::now() + interval;
+            while (!isFinished() && Clock::now() < frame) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+
+            auto value = static_cast<std::size_t>(task.fraction() * float(percent));
+            while (current < value) {
+                seq.next(true);
+                ++current;
+            }
+            Sequencer().checkAbort();
+        }
+    }
+    catch (...) {
+        task.cancel();
+        while (!isFinished()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        throw;
+    }
+
+    task.checkAbort();
+}
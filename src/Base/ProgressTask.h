@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "FCGlobal.h"
+
+namespace Base
+{
+
+/**
+ * \brief The ProgressTask class collects the progress of an operation that is processed by
+ * several worker threads.
+ *
+ * In contrast to the SequencerLauncher reporting progress doesn't touch the user interface:
+ * advance() only increments atomic counters and can be called from any thread in tight loops.
+ * The thread that runs the sequencer polls the progress at a fixed frame rate with
+ * waitForProgress().
+ *
+ * A task can be split into sub tasks, e.g. for nested algorithms or OCC operations. A sub task
+ * covers a given number of steps of its parent and reports directly into the root task, so
+ * polling the root task gives the aggregated progress of the whole tree. All tasks of a tree
+ * share the cancellation state of the root task.
+ *
+ * \code
+ * Base::ProgressTask task(items.size());
+ * QFuture<Result> future = QtConcurrent::mapped(items, [&task](const Item& item) {
+ *     if (task.isCanceled()) {
+ *         return Result();
+ *     }
+ *     Result result = compute(item);
+ *     task.advance();
+ *     return result;
+ * });
+ * Base::waitForProgress("Computing...", task, [&future]() { return future.isFinished(); });
+ * \endcode
+ */
+class BaseExport ProgressTask
+{
+public:
+    /// Creates a root task with the given number of steps
+    explicit ProgressTask(std::size_t steps);
+    /// Creates a sub task with \a steps steps that covers \a parentSteps steps of \a parent
+    ProgressTask(ProgressTask& parent, std::size_t steps, std::size_t parentSteps);
+    /// A sub task that is destroyed before it has finished credits its remaining steps
+    ~ProgressTask();
+
+    ProgressTask(const ProgressTask&) = delete;
+    ProgressTask(ProgressTask&&) = delete;
+    ProgressTask& operator=(const ProgressTask&) = delete;
+    ProgressTask& operator=(ProgressTask&&) = delete;
+
+    /// Returns the number of steps of this task
+    std::size_t numberOfSteps() const;
+    /// Marks \a count further steps as done. This is safe to be called from any thread.
+    void advance(std::size_t count = 1) noexcept;
+    /**
+     * Sets the number of finished steps. Values smaller than the current progress are ignored,
+     * so that it is safe to be called from several threads.
+     */
+    void setProgress(std::size_t pos) noexcept;
+    /// Returns the progress of the whole task tree in the range [0, 1]
+    float fraction() const noexcept;
+
+    /// Requests all workers of the task tree to stop
+    void cancel() noexcept;
+    /// Returns true if the task tree was canceled
+    bool isCanceled() const noexcept;
+    /// Throws an AbortException if the task tree was canceled
+    void checkAbort() const;
+
+private:
+    void report(std::size_t from, std::size_t to) noexcept;
+
+private:
+    ProgressTask* root;
+    std::size_t stepCount;
+    /// units of the root task per step of this task
+    double unitsPerStep;
+    std::atomic<std::size_t> done {0};
+    /// only used by the root task
+    std::atomic<std::uint64_t> units {0};
+    std::atomic<bool> canceled {false};
+};
+
+/**
+ * Waits until \a isFinished returns true and meanwhile forwards the progress of \a task to the
+ * active sequencer, at most once per \a interval. If the user cancels the operation the task is
+ * canceled, it's waited until the workers have stopped and an AbortException is thrown.
+ *
+ * This must be called from the thread that has started the workers.
+ */
+BaseExport void waitForProgress(
+    const char* text,
+    ProgressTask& task,
+    const std::function<bool()>& isFinished,
+    std::chrono::milliseconds interval = std::chrono::milliseconds(33)
+);
+
+}  // namespace Base
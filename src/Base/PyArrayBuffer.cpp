@@ -0,0 +1,269 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "PyArrayBuffer.h"
+
+
+namespace
+{
+bool isLittleEndian()
+{
+    const std::uint16_t value = 1;
+    return *reinterpret_cast<const unsigned char*>(&value) == 1;
+}
+
+template<typename S, typename T>
+void convertValues(const void* src, std::size_t count, T* dst)
+{
+    const S* values = static_cast<const S*>(src);
+    std::transform(values, values + count, dst, [](S value) {
+        return static_cast<T>(value);
+    });
+}
+}  // namespace
+
+Py::Object
+Base::createArrayView(const Py::Object& bytes, char format, std::size_t rows, std::size_t cols)
+{
+    Py::Object view(PyMemoryView_FromObject(bytes.ptr()), true);
+    const char fmt[2] = {format, '\0'};
+    PyObject* cast {};
+    if (rows > 0 && cols > 0) {
+        cast = PyObject_CallMethod(view.ptr(),
+                                   "cast",
+                                   "s(nn)",
+                                   fmt,
+                                   Py_ssize_t(rows),
+                                   Py_ssize_t(cols));
+    }
+    else {
+        cast = PyObject_CallMethod(view.ptr(), "cast", "s", fmt);
+    }
+    if (!cast) {
+        throw Py::Exception();
+    }
+    return Py::asObject(cast);
+}
+
+Base::PyArrayReader::PyArrayReader(PyObject* obj, std::size_t cols)
+    : cols(cols)
+{
+    if (PyObject_GetBuffer(obj, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0) {
+        PyErr_Clear();
+        readSequence(obj);
+        return;
+    }
+
+    // strip the byte order of the struct format
+    const char* format = view.format ? view.format : "B";
+    bool nativeOrder = true;
+    switch (*format) {
+        case '@':
+        case '=':
+            ++format;
+            break;
+        case '<':
+            nativeOrder = isLittleEndian();
+            ++format;
+            break;
+        case '>':
+        case '!':
+            nativeOrder = !isLittleEndian();
+            ++format;
+            break;
+        default:
+            break;
+    }
+
+    const char* error {};
+    auto size = view.itemsize;
+    bool validSize = size == 1 || size == 2 || size == 4 || size == 8;
+    if (!nativeOrder) {
+        error = "buffer must be in native byte order";
+    }
+    else if (format[0] == '\0' || format[1] != '\0') {
+        error = "buffer must hold plain numbers";
+    }
+    else if (std::strchr("fd", format[0])) {
+        kind = Kind::Float;
+        validSize = size == 4 || size == 8;
+    }
+    else if (std::strchr("bhilqn", format[0])) {
+        kind = Kind::Signed;
+    }
+    else if (std::strchr("BHILQN?", format[0])) {
+        kind = Kind::Unsigned;
+    }
+    else {
+        error = "buffer must hold integers or floating point numbers";
+    }
+    if (!error && !validSize) {
+        error = "unsupported item size of buffer";
+    }
+
+    if (error) {
+        PyBuffer_Release(&view);
+        throw Py::TypeError(error);
+    }
+
+    count = std::size_t(view.len / view.itemsize);
+    buffer = view.buf;
+    itemSize = view.itemsize;
+    if (cols == 0 || count % cols != 0) {
+        PyBuffer_Release(&view);
+        throw Py::ValueError("number of values in buffer must be a multiple of "
+                             + std::to_string(cols));
+    }
+}
+
+void Base::PyArrayReader::readSequence(PyObject* obj)
+{
+    // Strings are sequences too but never hold numbers
+    if (PyUnicode_Check(obj) || !PySequence_Check(obj)) {
+        throw Py::TypeError("object must support the buffer protocol or be a sequence of numbers");
+    }
+
+    Py::Object fast(PySequence_Fast(obj, "object must be a sequence of numbers"), true);
+    if (fast.isNull()) {
+        throw Py::Exception();
+    }
+    Py_ssize_t size = PySequence_Fast_GET_SIZE(fast.ptr());
+    PyObject** items = PySequence_Fast_ITEMS(fast.ptr());
+    sequence.reserve(size);
+    for (Py_ssize_t i = 0; i < size; ++i) {
+        double value = PyFloat_AsDouble(items[i]);
+        if (value == -1.0 && PyErr_Occurred()) {
+            PyErr_Clear();
+            throw Py::TypeError("sequence must hold plain numbers");
+        }
+        sequence.push_back(value);
+    }
+
+    count = sequence.size();
+    buffer = sequence.data();
+    itemSize = sizeof(double);
+    kind = Kind::Float;
+    if (cols == 0 || count % cols != 0) {
+        throw Py::ValueError("number of values in sequence must be a multiple of "
+                             + std::to_string(cols));
+    }
+}
+
+Base::PyArrayReader::~PyArrayReader()
+{
+    PyBuffer_Release(&view);
+}
+
+template<typename T>
+void Base::PyArrayReader::convert(T* values) const
+{
+    const void* buf = buffer;
+    switch (kind) {
+        case Kind::Float:
+            if (itemSize == 4) {
+                convertValues<float>(buf, count, values);
+            }
+            else {
+                convertValues<double>(buf, count, values);
+            }
+            break;
+        case Kind::Signed:
+            switch (itemSize) {
+                case 1:
+                    convertValues<std::int8_t>(buf, count, values);
+                    break;
+                case 2:
+                    convertValues<std::int16_t>(buf, count, values);
+                    break;
+                case 4:
+                    convertValues<std::int32_t>(buf, count, values);
+                    break;
+                default:
+                    convertValues<std::int64_t>(buf, count, values);
+                    break;
+            }
+            break;
+        case Kind::Unsigned:
+            switch (itemSize) {
+                case 1:
+                    convertValues<std::uint8_t>(buf, count, values);
+                    break;
+                case 2:
+                    convertValues<std::uint16_t>(buf, count, values);
+                    break;
+                case 4:
+                    convertValues<std::uint32_t>(buf, count, values);
+                    break;
+                default:
+                    convertValues<std::uint64_t>(buf, count, values);
+                    break;
+            }
+            break;
+    }
+}
+
+void Base::PyArrayReader::copyTo(double* values) const
+{
+    convert(values);
+}
+
+void Base::PyArrayReader::copyTo(float* values) const
+{
+    convert(values);
+}
+
+void Base::PyArrayReader::copyTo(int* values) const
+{
+    convert(values);
+}
+
+void Base::PyArrayReader::copyTo(unsigned int* values) const
+{
+    convert(values);
+}
+
+void Base::PyArrayReader::copyTo(long* values) const
+{
+    convert(values);
+}
+
+void Base::PyArrayReader::copyTo(unsigned long* values) const
+{
+    convert(values);
+}
+
+void Base::PyArrayReader::copyTo(long long* values) const
+{
+    convert(values);
+}
+
+void Base::PyArrayReader::copyTo(unsigned long long* values) const
+{
+    convert(values);
+}
@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include <CXX/Objects.hxx>
+#include <FCGlobal.h>
+
+
+namespace Base
+{
+
+/// Returns the format character of the struct module for the number type \a T
+template<typename T>
+constexpr char getBufferFormat()
+{
+    static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, long double>);
+    if constexpr (std::is_floating_point_v<T>) {
+        return std::is_same_v<T, double> ? 'd' : 'f';
+    }
+    else if constexpr (sizeof(T) == sizeof(char)) {
+        return std::is_signed_v<T> ? 'b' : 'B';
+    }
+    else if constexpr (sizeof(T) == sizeof(short)) {
+        return std::is_signed_v<T> ? 'h' : 'H';
+    }
+    else if constexpr (sizeof(T) == sizeof(int)) {
+        return std::is_signed_v<T> ? 'i' : 'I';
+    }
+    else if constexpr (sizeof(T) == sizeof(long)) {
+        return std::is_signed_v<T> ? 'l' : 'L';
+    }
+    else {
+        return std::is_signed_v<T> ? 'q' : 'Q';
+    }
+}
+
+/**
+ * Creates a memoryview of the shape \a rows x \a cols on the bytearray \a bytes
+ * holding numbers of the given \a format.
+ * A view with no rows is one-dimensional because memoryview doesn't support a
+ * zero-sized shape.
+ */
+BaseExport Py::Object
+createArrayView(const Py::Object& bytes, char format, std::size_t rows, std::size_t cols);
+
+/**
+ * The PyArrayWriter class passes a table of numbers to Python with a single copy.
+ * The numbers are written directly into a new bytearray which getView() exposes as
+ * a memoryview of the shape \a rows x \a cols, and numpy.asarray() wraps the view
+ * without copying the data again.
+ */
+template<typename T>
+class PyArrayWriter
+{
+public:
+    PyArrayWriter(std::size_t rows, std::size_t cols)
+        : rows(rows)
+        , cols(cols)
+        , bytes(PyByteArray_FromStringAndSize(nullptr, Py_ssize_t(rows * cols * sizeof(T))), true)
+    {}
+
+    /// The rows * cols uninitialized numbers, row by row
+    T* data()
+    {
+        return reinterpret_cast<T*>(PyByteArray_AS_STRING(bytes.ptr()));
+    }
+
+    Py::Object getView() const
+    {
+        return createArrayView(bytes, getBufferFormat<T>(), rows, cols);
+    }
+
+private:
+    std::size_t rows;
+    std::size_t cols;
+    Py::Object bytes;
+};
+
+/**
+ * The PyArrayReader class reads a table of numbers from any object supporting the
+ * buffer protocol, e.g. a NumPy array, a memoryview or an array.array.
+ * The buffer must be C-contiguous, be in native byte order and hold integers or
+ * floating point numbers whose count is a multiple of the number of columns.
+ * Otherwise the constructor throws a Py::TypeError or Py::ValueError.
+ * Objects without buffer, like the flat tuples of coordinates and indices returned
+ * by other libraries, are read as a sequence of numbers instead. This is slower but
+ * still avoids creating a Python object per row.
+ */
+class BaseExport PyArrayReader
+{
+public:
+    PyArrayReader(PyObject* obj, std::size_t cols);
+    ~PyArrayReader();
+
+    PyArrayReader(const PyArrayReader&) = delete;
+    PyArrayReader& operator=(const PyArrayReader&) = delete;
+
+    /// The number of numbers
+    std::size_t size() const
+    {
+        return count;
+    }
+    std::size_t rows() const
+    {
+        return count / cols;
+    }
+
+    /** @name Conversion
+     * Copies the numbers row by row into \a values converting them to its type.
+     */
+    //@{
+    void copyTo(double* values) const;
+    void copyTo(float* values) const;
+    void copyTo(int* values) const;
+    void copyTo(unsigned int* values) const;
+    void copyTo(long* values) const;
+    void copyTo(unsigned long* values) const;
+    void copyTo(long long* values) const;
+    void copyTo(unsigned long long* values) const;
+    //@}
+
+    template<typename T>
+    std::vector<T> getValues() const
+    {
+        std::vector<T> values(count);
+        copyTo(values.data());
+        return values;
+    }
+
+private:
+    void readSequence(PyObject* obj);
+    template<typename T>
+    void convert(T* values) const;
+
+private:
+    enum class Kind
+    {
+        Float,
+        Signed,
+        Unsigned
+    };
+    Py_buffer view {};
+    std::vector<double> sequence;
+    const void* buffer {};
+    Py_ssize_t itemSize {};
+    std::size_t cols;
+    std::size_t count {};
+    Kind kind {Kind::Float};
+};
+
+}  // namespace Base
@@ -22,7 +22,12 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <cerrno>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <iostream>
 #include <string>
@@ -45,6 +50,7 @@
 #ifdef _MSC_VER
 # include <zipios++/zipios-config.h>
 #endif
+#include <zipios++/fcoll.h>
 #include <zipios++/zipinputstream.h>
 #include <boost/iostreams/filtering_stream.hpp>
 
@@ -102,11 +108,37 @@ const char* Base::XMLReader::localName() const
 
 unsigned int Base::XMLReader::getAttributeCount() const
 {
-    return static_cast<unsigned int>(AttrMap.size());
+    return AttrCount;
+}
+
+const char* Base::XMLReader::findAttribute(const char* AttrName) const
+{
+    // elements only have a handful of attributes, so a linear search is faster than a lookup
+    for (unsigned int i = 0; i < AttrCount; i++) {
+        if (AttrList[i].name == AttrName) {
+            return AttrList[i].value.c_str();
+        }
+    }
+    return nullptr;
 }
 
 namespace
 {
+// Parse an integer without going through a std::string. Anything unusual, like leading
+// white space, a sign the type doesn't take or an invalid value, is left to the standard
+// conversion to keep its results and exceptions.
+template<typename T, typename Fallback>
+T readerInteger(const char* value, Fallback fallback)
+{
+    T result {};
+    const char* end = value + std::strlen(value);
+    auto [ptr, ec] = std::from_chars(value, end, result);
+    if (ec == std::errc() && ptr != value) {
+        return result;
+    }
+    return static_cast<T>(fallback(value));
+}
+
 template<typename T>
 T readerCast(const char* value)
 {
@@ -114,15 +146,28 @@ T readerCast(const char* value)
         return value;
     }
     if constexpr (std::is_same_v<T, long>) {
-        return stol(value);
+        return readerInteger<long>(value, [](const char* str) {
+            return stol(str);
+        });
     }
     if constexpr (std::is_same_v<T, int>) {
-        return stoi(value);
+        return readerInteger<int>(value, [](const char* str) {
+            return stoi(str);
+        });
     }
     if constexpr (std::is_same_v<T, unsigned long>) {
-        return stoul(value, nullptr);
+        return readerInteger<unsigned long>(value, [](const char* str) {
+            return stoul(str, nullptr);
+        });
     }
     if constexpr (std::is_same_v<T, double>) {
+        // stod() is strtod() on a copy, use it directly and only fall back for the errors
+        char* end = nullptr;
+        errno = 0;
+        double result = std::strtod(value, &end);
+        if (end != value && errno != ERANGE) {
+            return result;
+        }
         return stod(value, nullptr);
     }
     if constexpr (std::is_same_v<T, bool>) {
@@ -135,11 +180,10 @@ template<typename T>
     requires Base::XMLReader::instantiated<T>
 T Base::XMLReader::getAttribute(const char* AttrName, T defaultValue) const
 {
-    auto pos = AttrMap.find(AttrName);
-    if (pos == AttrMap.end()) {
+    const char* rawValue = findAttribute(AttrName);
+    if (!rawValue) {
         return defaultValue;
     }
-    const char* rawValue = pos->second.c_str();
     return readerCast<T>(rawValue);
 }
 
@@ -147,13 +191,12 @@ template<typename T>
     requires Base::XMLReader::instantiated<T>
 T Base::XMLReader::getAttribute(const char* AttrName) const
 {
-    auto pos = AttrMap.find(AttrName);
-    if (pos == AttrMap.end()) {
+    const char* rawValue = findAttribute(AttrName);
+    if (!rawValue) {
         // wrong name, use hasAttribute if not sure!
         std::string msg = std::string("XML Attribute: \"") + AttrName + "\" not found";
         throw Base::XMLAttributeError(msg);
     }
-    const char* rawValue = pos->second.c_str();
     return readerCast<T>(rawValue);
 }
 
@@ -190,7 +233,7 @@ template BaseExport unsigned long Base::XMLReader::getAttribute<unsigned long>(
 
 bool Base::XMLReader::hasAttribute(const char* AttrName) const
 {
-    return AttrMap.find(AttrName) != AttrMap.end();
+    return findAttribute(AttrName) != nullptr;
 }
 
 bool Base::XMLReader::read()
@@ -500,6 +543,43 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
     }
 }
 
+void Base::XMLReader::readFiles(zipios::FileCollection& archive) const
+{
+    // index the central directory once, the lookup of the collection is a linear search
+    std::unordered_map<std::string, zipios::ConstEntryPointer> index;
+    for (const auto& entry : archive.entries()) {
+        index.emplace(entry->getName(), entry);
+    }
+
+    Base::SequencerLauncher seq("Importing project files...", FileList.size());
+    for (const auto& file : FileList) {
+        // As with the sequential reading, files that are not part of the archive are skipped,
+        // e.g. the Gui document of a project that was saved without GUI up.
+        auto it = index.find(file.FileName);
+        if (it != index.end()) {
+            try {
+                std::unique_ptr<std::istream> str(archive.getInputStream(it->second));
+                if (!str) {
+                    throw Base::FileException("Cannot open embedded file", file.FileName);
+                }
+                Base::Reader reader(*str, file.FileName, FileVersion);
+                file.Object->RestoreDocFile(reader);
+                if (reader.getLocalReader()) {
+                    reader.getLocalReader()->readFiles(archive);
+                }
+            }
+            catch (...) {
+                Base::Console().error(
+                    "Reading failed from embedded file: %s\n",
+                    file.FileName.c_str()
+                );
+                FailedFiles.push_back(file.FileName);
+            }
+        }
+        seq.next();
+    }
+}
+
 const char* Base::XMLReader::addFile(const char* Name, Base::Persistence* Object)
 {
     FileEntry temp;
@@ -550,6 +630,31 @@ bool Base::XMLReader::doNameMapping() const
 // ---------------------------------------------------------------------------
 //  Base::XMLReader: Implementation of the SAX DocumentHandler interface
 // ---------------------------------------------------------------------------
+
+namespace
+{
+// Copy a string of the parser into a reused buffer. Names and most values are plain
+// ASCII which is copied directly, anything else goes through the given transcoder.
+template<typename Transcoder>
+void assignXMLString(std::string& target, const XMLCh* const str, XMLSize_t length)
+{
+    target.resize(length);
+    for (XMLSize_t i = 0; i < length; i++) {
+        if (str[i] >= 0x80) {
+            target = Transcoder(str).c_str();
+            return;
+        }
+        target[i] = static_cast<char>(str[i]);
+    }
+}
+
+template<typename Transcoder>
+void assignXMLString(std::string& target, const XMLCh* const str)
+{
+    assignXMLString<Transcoder>(target, str, XMLString::stringLen(str));
+}
+}  // namespace
+
 void Base::XMLReader::startDocument()
 {
     ReadType = StartDocument;
@@ -568,12 +673,16 @@ void Base::XMLReader::startElement(
 )
 {
     Level++;  // new scope
-    LocalName = StrX(localname).c_str();
+    assignXMLString<StrX>(LocalName, localname);
 
-    // saving attributes of the current scope, delete all previously stored ones
-    AttrMap.clear();
-    for (unsigned int i = 0; i < attrs.getLength(); i++) {
-        AttrMap[StrX(attrs.getQName(i)).c_str()] = StrXUTF8(attrs.getValue(i)).c_str();
+    // saving attributes of the current scope, overwriting the previously stored ones
+    AttrCount = static_cast<unsigned int>(attrs.getLength());
+    if (AttrList.size() < AttrCount) {
+        AttrList.resize(AttrCount);
+    }
+    for (unsigned int i = 0; i < AttrCount; i++) {
+        assignXMLString<StrX>(AttrList[i].name, attrs.getQName(i));
+        assignXMLString<StrXUTF8>(AttrList[i].value, attrs.getValue(i));
     }
 
     ReadType = StartElement;
@@ -582,7 +691,7 @@ void Base::XMLReader::startElement(
 void Base::XMLReader::endElement(const XMLCh* const /*uri*/, const XMLCh* const localname, const XMLCh* const /*qname*/)
 {
     Level--;  // end of scope
-    LocalName = StrX(localname).c_str();
+    assignXMLString<StrX>(LocalName, localname);
 
     if (ReadType == StartElement) {
         ReadType = StartEndElement;
@@ -604,7 +713,7 @@ void Base::XMLReader::endCDATA()
 
 void Base::XMLReader::characters(const XMLCh* const chars, const XMLSize_t length)
 {
-    Characters = StrX(chars).c_str();
+    assignXMLString<StrX>(Characters, chars, length);
     ReadType = Chars;
     CharacterCount += length;
 }
@@ -40,6 +40,7 @@
 
 namespace zipios
 {
+class FileCollection;
 class ZipInputStream;
 }
 
@@ -279,6 +280,10 @@ public:
     const char* addFile(const char* Name, Base::Persistence* Object);
     /// process the requested file writes
     void readFiles(zipios::ZipInputStream& zipstream) const;
+    /** Process the requested file reads by looking up each file in the central directory
+     * of the archive, so the order of the entries doesn't matter.
+     */
+    void readFiles(zipios::FileCollection& archive) const;
     /// Returns whether reader has any registered filenames
     bool hasFilenames() const;
     /// returns true if reading the file \a filename has failed
@@ -360,8 +365,19 @@ private:
     unsigned int CharacterCount {0};
     std::streamsize CharacterOffset {-1};
 
-    std::map<std::string, std::string> AttrMap;
-    using AttrMapType = std::map<std::string, std::string>;
+    /// Find the value of an attribute of the current element, nullptr if missing
+    const char* findAttribute(const char* AttrName) const;
+
+    // The attributes of the current element. The entries are reused from
+    // element to element to keep their string buffers, only the first
+    // AttrCount entries are valid.
+    struct Attribute
+    {
+        std::string name;
+        std::string value;
+    };
+    std::vector<Attribute> AttrList;
+    unsigned int AttrCount {0};
 
     enum
     {
@@ -57,6 +57,9 @@ struct Base::TypeData
     const Type parent;
     const Type type;
     const Type::instantiationMethod instMethod;
+    /// The keys from the root type down to this type, so that the ancestor of a given
+    /// depth can be checked in constant time
+    std::vector<Type::TypeId> ancestors;
 };
 
 namespace
@@ -64,7 +67,7 @@ namespace
 constexpr const char* BadTypeName = "BadType";
 }
 
-std::map<std::string, unsigned int> Type::typemap;
+std::unordered_map<std::string, Type::TypeId, Type::NameHash, std::equal_to<>> Type::typemap;
 std::vector<TypeData*> Type::typedata;
 std::set<std::string> Type::loadModuleSet;
 
@@ -143,7 +146,13 @@ const Type Type::createType(const Type parent, const char* name, instantiationMe
 
     Type newType;
     newType.index = static_cast<unsigned int>(Type::typedata.size());
-    Type::typedata.emplace_back(new TypeData(name, newType, parent, method));
+    auto data = new TypeData(name, newType, parent, method);
+    // super classes are registered before their derived classes
+    if (!parent.isBad() && parent.index < Type::typedata.size()) {
+        data->ancestors = Type::typedata[parent.index]->ancestors;
+    }
+    data->ancestors.push_back(newType.index);
+    Type::typedata.emplace_back(data);
 
     // add to dictionary for fast lookup
     Type::typemap.emplace(name, newType.getKey());
@@ -156,6 +165,7 @@ void Type::init()
 {
     assert(Type::typedata.size() == 0 && "Type::init() should only be called once");
     typedata.emplace_back(new TypeData(BadTypeName, BadType, BadType, nullptr));
+    typedata.back()->ancestors.push_back(BadTypeIndex);
     typemap[BadTypeName] = 0;
 }
 
@@ -206,15 +216,10 @@ const Type Type::getParent() const
 
 bool Type::isDerivedFrom(const Type type) const
 {
-    Type temp(*this);
-    do {
-        if (temp == type) {
-            return true;
-        }
-        temp = temp.getParent();
-    } while (!temp.isBad());
-
-    return false;
+    // this type is derived from 'type' if it has it as ancestor at the depth of 'type'
+    const auto& ancestors = typedata[index]->ancestors;
+    const std::size_t depth = typedata[type.index]->ancestors.size() - 1;
+    return depth < ancestors.size() && ancestors[depth] == type.index;
 }
 
 int Type::getAllDerivedFrom(const Type type, std::vector<Type>& list)
@@ -28,10 +28,17 @@
 #include <vector>
 #include <string>
 
+#include <algorithm>
+#include <deque>
 #include <limits>
 #include <locale>
 #include <iomanip>
 
+#include <QFuture>
+#include <QThreadPool>
+#include <QtConcurrentRun>
+#include <zlib.h>
+
 #include "Writer.h"
 #include "Base64.h"
 #include "Base64Filter.h"
@@ -311,6 +318,19 @@ std::string Writer::addFile(const char* Name, const Base::Persistence* Object)
     return temp.FileName;
 }
 
+bool Writer::isRegistered(const Base::Persistence* Object) const
+{
+    if (Object) {
+        for (const auto& it : FileList) {
+            if (it.Object == Object) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
 void Writer::incInd()
 {
     if (indent < 1020) {
@@ -368,6 +388,11 @@ void ZipWriter::putNextEntry(const char* file, const char* obj)
 
 void ZipWriter::writeFiles()
 {
+    if (ConcurrentCompression) {
+        writeFilesConcurrently();
+        return;
+    }
+
     // use a while loop because it is possible that while
     // processing the files new ones can be added
     size_t index = 0;
@@ -381,6 +406,104 @@ void ZipWriter::writeFiles()
     }
 }
 
+namespace
+{
+struct CompressedFile
+{
+    std::string name;
+    std::string data;
+    uLong crc = 0;
+    uLong size = 0;
+    bool failed = false;
+};
+
+CompressedFile compressFile(std::string name, const std::string& data, int level)
+{
+    CompressedFile file;
+    file.name = std::move(name);
+    file.size = static_cast<uLong>(data.size());
+    file.crc = crc32(0L, reinterpret_cast<const Bytef*>(data.data()), static_cast<uInt>(data.size()));
+
+    // raw deflate stream as expected by the zip format
+    z_stream zs {};
+    if (deflateInit2(&zs, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        file.failed = true;
+        return file;
+    }
+    file.data.resize(deflateBound(&zs, static_cast<uLong>(data.size())));
+    zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));  // NOLINT
+    zs.avail_in = static_cast<uInt>(data.size());
+    zs.next_out = reinterpret_cast<Bytef*>(file.data.data());
+    zs.avail_out = static_cast<uInt>(file.data.size());
+    int ret = deflate(&zs, Z_FINISH);
+    file.data.resize(zs.total_out);
+    deflateEnd(&zs);
+    file.failed = (ret != Z_STREAM_END);
+    return file;
+}
+}  // namespace
+
+void ZipWriter::writeFilesConcurrently()
+{
+    // Keep a bounded number of files in flight so that memory use does not
+    // grow with the size of the document
+    const auto maxPending =
+        static_cast<std::size_t>(std::max(2, QThreadPool::globalInstance()->maxThreadCount() * 2));
+    std::deque<QFuture<CompressedFile>> pending;
+
+    auto writeOldest = [&]() {
+        CompressedFile file = pending.front().result();
+        pending.pop_front();
+        if (file.failed) {
+            throw Base::FileException("Failed to compress entry", file.name);
+        }
+        ZipStream.putCompressedEntry(file.name, file.data, file.crc, file.size);
+        Writer::checkErrNo();
+    };
+
+    struct EntryStreamGuard
+    {
+        std::ostream*& stream;
+        ~EntryStreamGuard()
+        {
+            stream = nullptr;
+        }
+    };
+
+    // use a while loop because it is possible that while
+    // processing the files new ones can be added
+    size_t index = 0;
+    while (index < FileList.size()) {
+        FileEntry entry = FileList[index];
+        Writer::putNextEntry(entry.FileName.c_str());
+        indent = 0;
+        indBuf[0] = 0;
+
+        std::ostringstream buffer;
+        buffer.imbue(std::locale::classic());
+        buffer.precision(std::numeric_limits<double>::digits10 + 1);
+        buffer.setf(std::ios::fixed, std::ios::floatfield);
+        {
+            EntryStreamGuard guard {EntryStream};
+            EntryStream = &buffer;
+            entry.Object->SaveDocFile(*this);
+        }
+
+        pending.push_back(QtConcurrent::run(
+            [name = entry.FileName, data = std::move(buffer).str(), level = Level]() {
+                return compressFile(name, data, level);
+            }));
+        if (pending.size() >= maxPending) {
+            writeOldest();
+        }
+        index++;
+    }
+
+    while (!pending.empty()) {
+        writeOldest();
+    }
+}
+
 ZipWriter::~ZipWriter()
 {
     ZipStream.close();
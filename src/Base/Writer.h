@@ -97,6 +97,8 @@ public:
     //@{
     /// add a write request of a persistent object
     std::string addFile(const char* Name, const Base::Persistence* Object);
+    /// returns true if a write request for \a Object has been added
+    bool isRegistered(const Base::Persistence* Object) const;
     /// process the requested file storing
     virtual void writeFiles() = 0;
     /// Set mode
@@ -226,11 +228,17 @@ public:
 
     std::ostream& Stream() override
     {
+        if (EntryStream) {
+            return *EntryStream;
+        }
         return ZipStream;
     }
 
     const std::ostream& Stream() const override
     {
+        if (EntryStream) {
+            return *EntryStream;
+        }
         return ZipStream;
     }
 
@@ -240,8 +248,23 @@ public:
     }
     void setLevel(int level)
     {
+        Level = level;
         ZipStream.setLevel(level);
     }
+    /** Compress the files written by writeFiles() on worker threads.
+     * The files are still serialized one after another on the calling thread,
+     * but each one into a memory buffer that is then deflated in the background
+     * while the next file is being serialized. The compressed entries are
+     * written to the archive in their original order.
+     */
+    void setConcurrentCompression(bool on)
+    {
+        ConcurrentCompression = on;
+    }
+    bool isConcurrentCompression() const
+    {
+        return ConcurrentCompression;
+    }
     void putNextEntry(const char* filename, const char* objName = nullptr) override;
 
     ZipWriter(const ZipWriter&) = delete;
@@ -249,8 +272,14 @@ public:
     ZipWriter& operator=(const ZipWriter&) = delete;
     ZipWriter& operator=(ZipWriter&&) = delete;
 
+private:
+    void writeFilesConcurrently();
+
 private:
     zipios::ZipOutputStream ZipStream;
+    std::ostream* EntryStream = nullptr;
+    int Level = -1;  // Z_DEFAULT_COMPRESSION
+    bool ConcurrentCompression = false;
 };
 
 /** The StringWriter class
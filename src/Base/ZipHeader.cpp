@@ -55,7 +55,12 @@ std::istream* ZipHeader::getInputStream(const ConstEntryPointer& entry)
     if (!_valid) {
         throw zipios::InvalidStateException("Attempt to use an invalid FileCollection");
     }
-    return getInputStream(entry->getName());
+    // the entries of this collection are central directory entries, so use the offset
+    // directly instead of searching the entry by name again
+    return new zipios::ZipInputStream(
+        _input,
+        static_cast<const zipios::ZipCDirEntry*>(entry.get())->getLocalHeaderOffset() + _vs.startOffset()
+    );
 }
 
 std::istream* ZipHeader::getInputStream(const std::string& entry_name, MatchPath matchpath)
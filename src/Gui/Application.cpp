@@ -50,6 +50,7 @@
 
 #include <App/Document.h>
 #include <App/DocumentObjectPy.h>
+#include <App/MemoryReport.h>
 #include <Base/Console.h>
 #include <Base/Interpreter.h>
 #include <Base/Exception.h>
@@ -476,6 +477,20 @@ Application::Application(bool GUIenabled)
         App::GetApplication().signalShowHidden.connect(
             std::bind(&Gui::Application::slotShowHidden, this, sp::_1));
         // NOLINTEND
+
+        // add the view providers and their scene graphs to the memory report of a document
+        App::MemoryReport::addProvider([](const App::Document& doc, App::MemoryReport& report) {
+            Gui::Document* guiDoc = Application::Instance->getDocument(&doc);
+            if (!guiDoc) {
+                return;
+            }
+            for (auto obj : doc.getObjects()) {
+                if (auto vp = guiDoc->getViewProvider(obj)) {
+                    report.addObjectUsage(obj, "View providers", vp->getMemSize());
+                }
+            }
+        });
+
         // install the last active language
         ParameterGrp::handle hPGrp = App::GetApplication().GetUserParameter().GetGroup("BaseApp");
         hPGrp = hPGrp->GetGroup("Preferences")->GetGroup("General");
@@ -2606,8 +2621,20 @@ void Application::runApplication()
     }
 #endif
 
+    // Optionally deliver the console messages in batches on the event loop, so that verbose
+    // logging doesn't slow down the code that writes it
+    bool batchedLogging = App::GetApplication()
+                              .GetParameterGroupByPath("User parameter:BaseApp/Preferences/OutputWindow")
+                              ->GetBool("BatchedLogging", false);
+    if (batchedLogging) {
+        Base::Console().setConnectionMode(Base::ConsoleSingleton::Batched);
+    }
+
     runEventLoop(mainApp);
 
+    if (batchedLogging) {
+        Base::Console().setConnectionMode(Base::ConsoleSingleton::Direct);
+    }
     Base::Console().log("Finish: Event loop left\n");
 }
 
@@ -180,50 +180,20 @@ void AutoSaver::saveDocument(const std::string& name, AutoSaveProperty& saver)
         // qApp->processEvents();
 
         Base::TimeElapsed startTime;
-        // open extra scope to close ZipWriter properly
-        {
-            if (!this->compressed) {
-                RecoveryWriter writer(saver);
-
-                // We will be using thread pool if not compressed.
-                // So, always force binary format because ASCII
-                // is not reentrant. See PropertyPartShape::SaveDocFile
-                writer.setMode("BinaryBrep");
-
-                writer.putNextEntry("Document.xml");
-
-                doc->Save(writer);
-
-                // Special handling for Gui document.
-                doc->signalSaveDocument(writer);
-
-                // write additional files
-                writer.writeFiles();
+        if (!this->compressed) {
+            writeJournal(doc, saver);
+        }
+        // only create the files if something has changed
+        else if (!saver.touched.empty()) {
+            // Most auto-saves only write the changed properties to the recovery directory,
+            // their files being written by the thread pool. The full recovery file is
+            // serialized on this thread and so only written every few auto-saves.
+            int interval = hGrp->GetInt("AutoSaveCompactInterval", 10);
+            if (interval > 0 && saver.journalCount + 1 >= interval) {
+                writeRecoveryFile(doc, saver, hGrp->GetBool("SaveBinaryBrep", true));
             }
-            // only create the file if something has changed
-            else if (!saver.touched.empty()) {
-                std::string fn = doc->TransientDir.getValue();
-                fn += "/fc_recovery_file.fcstd";
-                Base::FileInfo tmp(fn);
-                Base::ofstream file(tmp, std::ios::out | std::ios::binary);
-                if (file.is_open()) {
-                    Base::ZipWriter writer(file);
-                    if (hGrp->GetBool("SaveBinaryBrep", true)) {
-                        writer.setMode("BinaryBrep");
-                    }
-
-                    writer.setComment("AutoRecovery file");
-                    writer.setLevel(1);  // apparently the fastest compression
-                    writer.putNextEntry("Document.xml");
-
-                    doc->Save(writer);
-
-                    // Special handling for Gui document.
-                    doc->signalSaveDocument(writer);
-
-                    // write additional files
-                    writer.writeFiles();
-                }
+            else {
+                writeJournal(doc, saver);
             }
         }
 
@@ -235,6 +205,76 @@ void AutoSaver::saveDocument(const std::string& name, AutoSaveProperty& saver)
     }
 }
 
+void AutoSaver::writeJournal(App::Document* doc, AutoSaveProperty& saver)
+{
+    Base::FileInfo dir(saver.dirName);
+    if (!dir.exists()) {
+        dir.createDirectory();
+    }
+
+    {
+        RecoveryWriter writer(saver);
+
+        // We will be using thread pool if not compressed.
+        // So, always force binary format because ASCII
+        // is not reentrant. See PropertyPartShape::SaveDocFile
+        writer.setMode("BinaryBrep");
+
+        writer.putNextEntry("Document.xml");
+
+        doc->Save(writer);
+
+        // Special handling for Gui document.
+        doc->signalSaveDocument(writer);
+
+        // write additional files
+        writer.writeFiles();
+    }
+    saver.journalCount++;
+
+    // The recovery dialog prefers the full recovery file which is now out of date
+    std::string fn = doc->TransientDir.getValue();
+    fn += "/fc_recovery_file.fcstd";
+    Base::FileInfo stale(fn);
+    if (stale.exists()) {
+        stale.deleteFile();
+    }
+}
+
+void AutoSaver::writeRecoveryFile(App::Document* doc, AutoSaveProperty& saver, bool binaryBrep)
+{
+    std::string fn = doc->TransientDir.getValue();
+    fn += "/fc_recovery_file.fcstd";
+    Base::FileInfo tmp(fn);
+    Base::ofstream file(tmp, std::ios::out | std::ios::binary);
+    if (file.is_open()) {
+        // open extra scope to close ZipWriter properly
+        {
+            Base::ZipWriter writer(file);
+            if (binaryBrep) {
+                writer.setMode("BinaryBrep");
+            }
+
+            writer.setComment("AutoRecovery file");
+            writer.setLevel(1);  // apparently the fastest compression
+            writer.putNextEntry("Document.xml");
+
+            doc->Save(writer);
+
+            // Special handling for Gui document.
+            doc->signalSaveDocument(writer);
+
+            // write additional files
+            writer.writeFiles();
+        }
+
+        // Changes made from now on are missing in the recovery directory,
+        // so the next journal rewrites all of it
+        saver.fileMap.clear();
+        saver.journalCount = 0;
+    }
+}
+
 void AutoSaver::timerEvent(QTimerEvent* event)
 {
     int id = event->timerId();
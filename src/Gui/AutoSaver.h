@@ -51,6 +51,8 @@ public:
     std::set<std::string> touched;
     std::string dirName;
     std::map<std::string, std::string> fileMap;
+    /// number of incremental saves since the last full recovery file
+    int journalCount {0};
 
 private:
     void slotNewObject(const App::DocumentObject&);
@@ -89,6 +91,10 @@ protected:
     void slotDeleteDocument(const App::Document& Doc);
     void timerEvent(QTimerEvent* event) override;
     void saveDocument(const std::string&, AutoSaveProperty&);
+    /// writes the changed properties to the recovery directory
+    void writeJournal(App::Document*, AutoSaveProperty&);
+    /// writes the whole document to the compressed recovery file
+    void writeRecoveryFile(App::Document*, AutoSaveProperty&, bool binaryBrep);
 
 public Q_SLOTS:
     void renameFile(QString dirName, QString file, QString tmpFile);
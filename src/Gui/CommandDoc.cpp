@@ -53,6 +53,7 @@
 #include "Selection.h"
 #include "Dialogs/DlgObjectSelection.h"
 #include "Dialogs/DlgProjectInformationImp.h"
+#include "Dialogs/DlgMemoryReport.h"
 #include "Dialogs/DlgProjectUtility.h"
 #include "GraphvizView.h"
 #include "ManualAlignment.h"
@@ -944,6 +945,36 @@ bool StdCmdProjectUtil::isActive()
     return true;
 }
 
+//===========================================================================
+// Std_MemoryReport
+//===========================================================================
+
+DEF_STD_CMD_A(StdCmdMemoryReport)
+
+StdCmdMemoryReport::StdCmdMemoryReport()
+    : Command("Std_MemoryReport")
+{
+    sGroup = "Tools";
+    sWhatsThis = "Std_MemoryReport";
+    sMenuText = QT_TR_NOOP("&Memory Usage");
+    sToolTipText = QT_TR_NOOP(
+        "Shows the memory used by the objects, properties and tessellations of the active document"
+    );
+    sStatusTip = sToolTipText;
+}
+
+void StdCmdMemoryReport::activated(int iMsg)
+{
+    Q_UNUSED(iMsg);
+    Gui::Dialog::DlgMemoryReport dlg(getActiveGuiDocument()->getDocument(), getMainWindow());
+    dlg.exec();
+}
+
+bool StdCmdMemoryReport::isActive()
+{
+    return (getActiveGuiDocument() ? true : false);
+}
+
 //===========================================================================
 // Std_Print
 //===========================================================================
@@ -2207,6 +2238,7 @@ void CreateDocCommands()
     rcCmdMgr.addCommand(new StdCmdRevert());
     rcCmdMgr.addCommand(new StdCmdProjectInfo());
     rcCmdMgr.addCommand(new StdCmdProjectUtil());
+    rcCmdMgr.addCommand(new StdCmdMemoryReport());
     rcCmdMgr.addCommand(new StdCmdUndo());
     rcCmdMgr.addCommand(new StdCmdRedo());
     rcCmdMgr.addCommand(new StdCmdPrint());
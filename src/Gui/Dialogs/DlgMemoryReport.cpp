@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include <algorithm>
+#include <vector>
+#include <QDialogButtonBox>
+#include <QHeaderView>
+#include <QLocale>
+#include <QPushButton>
+#include <QTreeWidget>
+#include <QVBoxLayout>
+
+#include <App/Document.h>
+#include <App/MemoryReport.h>
+
+#include "Dialogs/DlgMemoryReport.h"
+
+
+using namespace Gui::Dialog;
+
+/* TRANSLATOR Gui::Dialog::DlgMemoryReport */
+
+DlgMemoryReport::DlgMemoryReport(App::Document* doc, QWidget* parent)
+    : QDialog(parent)
+    , document(doc)
+    , tree(new QTreeWidget(this))
+{
+    setWindowTitle(tr("Memory Usage of %1").arg(QString::fromUtf8(doc->Label.getValue())));
+
+    tree->setColumnCount(2);
+    tree->setHeaderLabels({tr("Item"), tr("Memory")});
+    tree->header()->setSectionResizeMode(0, QHeaderView::Stretch);
+    tree->header()->setStretchLastSection(false);
+    tree->setUniformRowHeights(true);
+
+    auto buttons = new QDialogButtonBox(QDialogButtonBox::Close, this);
+    QPushButton* refreshButton = buttons->addButton(tr("Refresh"), QDialogButtonBox::ActionRole);
+    connect(refreshButton, &QPushButton::clicked, this, &DlgMemoryReport::refresh);
+    connect(buttons, &QDialogButtonBox::rejected, this, &DlgMemoryReport::reject);
+
+    auto layout = new QVBoxLayout(this);
+    layout->addWidget(tree);
+    layout->addWidget(buttons);
+    resize(600, 500);
+
+    refresh();
+}
+
+DlgMemoryReport::~DlgMemoryReport() = default;
+
+QTreeWidgetItem* DlgMemoryReport::addItem(
+    QTreeWidgetItem* parent,
+    const QString& text,
+    std::size_t bytes
+)
+{
+    auto item = parent ? new QTreeWidgetItem(parent) : new QTreeWidgetItem(tree);
+    item->setText(0, text);
+    item->setText(1, QLocale().formattedDataSize(static_cast<qint64>(bytes)));
+    item->setTextAlignment(1, Qt::AlignRight | Qt::AlignVCenter);
+    return item;
+}
+
+void DlgMemoryReport::refresh()
+{
+    tree->clear();
+    App::MemoryReport report(*document);
+
+    addItem(nullptr, tr("Total"), report.getTotal());
+
+    QTreeWidgetItem* categories = addItem(nullptr, tr("Categories"), report.getTotal());
+    for (const auto& [name, bytes] : report.getCategories()) {
+        addItem(categories, QString::fromStdString(name), bytes);
+    }
+    categories->setExpanded(true);
+
+    std::vector<App::ObjectMemoryUsage> objects = report.getObjects();
+    std::size_t objectTotal = 0;
+    for (const auto& usage : objects) {
+        objectTotal += usage.total();
+    }
+    QTreeWidgetItem* objectItems = addItem(nullptr, tr("Objects"), objectTotal);
+    for (const auto& usage : objects) {
+        QTreeWidgetItem* item = addItem(
+            objectItems,
+            QStringLiteral("%1 (%2)").arg(
+                QString::fromUtf8(usage.label.c_str()),
+                QString::fromLatin1(usage.name.c_str())
+            ),
+            usage.total()
+        );
+        item->setToolTip(0, QString::fromLatin1(usage.type.c_str()));
+        addItem(item, tr("Properties"), usage.properties);
+        for (const auto& [name, bytes] : usage.extra) {
+            addItem(item, QString::fromStdString(name), bytes);
+        }
+    }
+
+    std::size_t propertyTotal = 0;
+    for (const auto& it : report.getPropertyTypes()) {
+        propertyTotal += it.second;
+    }
+    QTreeWidgetItem* properties = addItem(nullptr, tr("Property types"), propertyTotal);
+    std::vector<std::pair<std::string, std::size_t>> types(
+        report.getPropertyTypes().begin(),
+        report.getPropertyTypes().end()
+    );
+    std::stable_sort(types.begin(), types.end(), [](const auto& a, const auto& b) {
+        return a.second > b.second;
+    });
+    for (const auto& [name, bytes] : types) {
+        addItem(properties, QString::fromLatin1(name.c_str()), bytes);
+    }
+}
+
+#include "moc_DlgMemoryReport.cpp"
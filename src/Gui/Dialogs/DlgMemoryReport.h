@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#pragma once
+
+#include <cstddef>
+#include <QDialog>
+
+class QTreeWidget;
+class QTreeWidgetItem;
+
+namespace App
+{
+class Document;
+}
+
+namespace Gui
+{
+namespace Dialog
+{
+
+/**
+ * The DlgMemoryReport class shows the memory usage of a document, broken down by category, by
+ * object and by property type. See App::MemoryReport.
+ */
+class DlgMemoryReport: public QDialog
+{
+    Q_OBJECT
+
+public:
+    DlgMemoryReport(App::Document* doc, QWidget* parent = nullptr);
+    ~DlgMemoryReport() override;
+
+private:
+    void refresh();
+    QTreeWidgetItem* addItem(QTreeWidgetItem* parent, const QString& text, std::size_t bytes);
+
+private:
+    App::Document* document;
+    QTreeWidget* tree;
+};
+
+}  // namespace Dialog
+}  // namespace Gui
@@ -20,6 +20,7 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
 #include <tuple>
 #include <memory>
 #include <list>
@@ -85,6 +86,7 @@ namespace Gui
 struct DocumentP
 {
     Thumbnail thumb;
+    QTimer thumbTimer;
     int _iWinCount;
     int _iDocId;
     bool _isClosing;
@@ -142,6 +144,7 @@ struct DocumentP
     Connection connectTransactionRemove;
     Connection connectTouchedObject;
     Connection connectChangePropertyEditor;
+    Connection connectChangeViewObject;
     AdvancedConnection connectChangeDocument;
 
     using ConnectionBlock = fastsignals::shared_connection_block;
@@ -525,6 +528,21 @@ Document::Document(App::Document* pcDocument, Application* app)
     );
     // NOLINTEND
 
+    // Changes of the objects reach this signal through slotChangedObject()
+    d->connectChangeViewObject = app->signalChangedObject.connect(
+        [this](const ViewProvider& vp, const App::Property&) {
+            auto vpd = freecad_cast<const ViewProviderDocumentObject*>(&vp);
+            if (vpd && vpd->getDocument() == this) {
+                scheduleThumbnail();
+            }
+        }
+    );
+    // Wait for a pause of the changes, e.g. after a recompute or an interaction
+    constexpr int thumbnailDelay = 2000;
+    d->thumbTimer.setSingleShot(true);
+    d->thumbTimer.setInterval(thumbnailDelay);
+    QObject::connect(&d->thumbTimer, &QTimer::timeout, [this] { updateThumbnail(); });
+
     pcDocument->setPreRecomputeHook([this] { callSignalBeforeRecompute(); });
 
     // pointer to the python class
@@ -540,6 +558,9 @@ Document::Document(App::Document* pcDocument, Application* app)
         d->_pcDocument->setUndoMode(1);
         // set the maximum stack size
         d->_pcDocument->setMaxUndoStackSize(hGrp->GetInt("MaxUndoSize", 20));
+        // memory limit of the undo stack in MB, no limit by default
+        long maxUndoMemory = std::clamp<long>(hGrp->GetInt("MaxUndoMemory", 0), 0, 4095);
+        d->_pcDocument->setUndoLimit(static_cast<unsigned int>(maxUndoMemory) * 1024U * 1024U);
     }
 
     d->_changeViewTouchDocument = hGrp->GetBool("ChangeViewProviderTouchDocument", true);
@@ -571,7 +592,9 @@ Document::~Document()
     d->connectTransactionRemove.disconnect();
     d->connectTouchedObject.disconnect();
     d->connectChangePropertyEditor.disconnect();
+    d->connectChangeViewObject.disconnect();
     d->connectChangeDocument.disconnect();
+    d->thumbTimer.stop();
 
     // e.g. if document gets closed from within a Python command
     d->_isClosing = true;
@@ -1058,6 +1081,7 @@ void Document::slotDeletedObject(const App::DocumentObject& Obj)
 {
     std::list<Gui::BaseView*>::iterator vIt;
     setModified(true);
+    scheduleThumbnail();
 
     // cycling to all views of the document
     ViewProvider* viewProvider = getViewProvider(&Obj);
@@ -1789,24 +1813,62 @@ void Document::Save(Base::Writer& writer) const
         if (hGrp->GetBool("SaveThumbnail", true)) {
             int size = hGrp->GetInt("ThumbnailSize", 256);
             size = Base::clamp<int>(size, 64, 512);
-            std::list<MDIView*> mdi = getMDIViews();
-
-            View3DInventorViewer* view = nullptr;
-            for (const auto& it : mdi) {
-                if (it->isDerivedFrom<View3DInventor>()) {
-                    view = static_cast<View3DInventor*>(it)->getViewer();
-                    break;
-                }
-            }
 
             d->thumb.setFileName(d->_pcDocument->FileName.getValue());
             d->thumb.setSize(size);
-            d->thumb.setViewer(view);
+            d->thumb.setViewer(getThumbnailViewer());
             d->thumb.Save(writer);
         }
     }
 }
 
+View3DInventorViewer* Document::getThumbnailViewer() const
+{
+    std::list<MDIView*> mdi = getMDIViews();
+    for (const auto& it : mdi) {
+        if (it->isDerivedFrom<View3DInventor>()) {
+            return static_cast<View3DInventor*>(it)->getViewer();
+        }
+    }
+    return nullptr;
+}
+
+void Document::scheduleThumbnail()
+{
+    d->thumb.invalidateImage();
+    if (!d->_isClosing && QThread::currentThread() == d->thumbTimer.thread()) {
+        d->thumbTimer.start();
+    }
+}
+
+void Document::updateThumbnail()
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document"
+    );
+    if (d->_isClosing || !hGrp->GetBool("SaveThumbnail", true)) {
+        return;
+    }
+
+    // Don't interfere with an interaction or an edit in progress, try again later
+    if (QApplication::mouseButtons() != Qt::NoButton || QApplication::activePopupWidget()
+        || d->_pcDocument->isPerformingTransaction()
+        || d->_pcDocument->testStatus(App::Document::Recomputing) || getInEdit()) {
+        d->thumbTimer.start();
+        return;
+    }
+
+    View3DInventorViewer* view = getThumbnailViewer();
+    if (!view || !view->isVisible()) {
+        return;
+    }
+
+    int size = Base::clamp<int>(hGrp->GetInt("ThumbnailSize", 256), 64, 512);
+    d->thumb.setSize(size);
+    d->thumb.setViewer(view);
+    d->thumb.updateImage();
+}
+
 /**
  * Loads a separate XML file from the projects file with information about the view providers.
  */
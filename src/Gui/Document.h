@@ -54,6 +54,7 @@ namespace Gui
 class BaseView;
 class MDIView;
 class View3DInventor;
+class View3DInventorViewer;
 class ViewProvider;
 class ViewProviderDocumentObject;
 class Application;
@@ -352,6 +353,11 @@ private:
     bool checkTransactionID(bool undo, int iSteps);
     /// Ask for user interaction if saving has failed
     bool askIfSavingFailed(const QString&);
+    /// Returns the viewer the thumbnail is rendered from
+    View3DInventorViewer* getThumbnailViewer() const;
+    /// Renders the thumbnail when the application is idle after a change
+    void scheduleThumbnail();
+    void updateThumbnail();
 
     struct DocumentP* d;
     static int _iDocCount;
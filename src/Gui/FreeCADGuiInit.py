@@ -267,12 +267,15 @@ class ModGui:
         """
         Load the Mod Gui.
         """
+        trace = App.__StartupTrace__
+        start = trace.clock()
         try:
             if self.mod.state == ModState.Loaded and not self.process_metadata():
                 self.run_init_gui()
         except Exception as ex:
             self.mod.state = ModState.Failed
             Err(str(ex))
+        trace.add_script(self.mod.name, start)
 
 
 class DirModGui(ModGui):
@@ -389,6 +392,7 @@ def InitApplications():
     freecad.gui = FreeCADGui
 
     Log("Init:   Searching modules\n")
+    App.__StartupTrace__.start()
 
     def mod_gui_init(kind: str, mod_type: type, output: list[str]) -> None:
         for mod in App.__ModCache__:
@@ -418,6 +422,9 @@ def InitApplications():
         Log(line)
     Log(output[0])
 
+    App.__StartupTrace__.stop()
+    App.__StartupTrace__.report("FreeCADGuiInit.py")
+
 
 def GeneratePackageIcon(
     subdirectory: str, workbench_metadata: FreeCAD.Metadata, wb_handle: Workbench
@@ -473,5 +480,5 @@ if not typing.TYPE_CHECKING:
     del InitApplications
     del NoneWorkbench
     del StandardWorkbench
-    del App.__ModCache__, ModGui, DirModGui, ExtModGui
+    del App.__ModCache__, App.__StartupTrace__, ModGui, DirModGui, ExtModGui
     del typing, re, Path, importlib
@@ -80,6 +80,11 @@ PropertyView::PropertyView(QWidget* parent)
     timer->setSingleShot(true);
     connect(timer, &QTimer::timeout, this, &PropertyView::onTimer);
 
+    updateTimer = new QTimer(this);
+    updateTimer->setSingleShot(true);
+    updateTimer->setInterval(0);
+    connect(updateTimer, &QTimer::timeout, this, &PropertyView::updatePendingProperties);
+
     tabs = new QTabWidget(this);
     tabs->setObjectName(QStringLiteral("propertyTab"));
     tabs->setTabPosition(QTabWidget::South);
@@ -188,6 +193,9 @@ void PropertyView::setShowAll(bool enable)
 void PropertyView::hideEvent(QHideEvent* ev)
 {
     this->timer->stop();
+    this->updateTimer->stop();
+    pendingData.clear();
+    pendingView.clear();
     this->detachSelection();
     // clear the properties before hiding.
     propertyEditorData->buildUp();
@@ -225,20 +233,55 @@ void PropertyView::slotRollback()
 
 void PropertyView::slotChangePropertyData(const App::Property& prop)
 {
-    if (propertyEditorData->propOwners.contains(prop.getContainer())) {
-        propertyEditorData->updateProperty(prop);
-        timer->start(ViewParams::instance()->getPropertyViewTimer());
+    if (prop.getName() && propertyEditorData->propOwners.contains(prop.getContainer())) {
+        // A recompute changes the same property of many selected objects, so only the
+        // rows are refreshed and only once the changes are done
+        pendingData.emplace(prop.getContainer(), prop.getName());
+        if (!updateTimer->isActive()) {
+            updateTimer->start();
+        }
+        // The link to the object whose properties are shown may have changed
+        if (linkedProperties) {
+            timer->start(ViewParams::instance()->getPropertyViewTimer());
+        }
     }
 }
 
 void PropertyView::slotChangePropertyView(const Gui::ViewProvider&, const App::Property& prop)
 {
-    if (propertyEditorView->propOwners.contains(prop.getContainer())) {
-        propertyEditorView->updateProperty(prop);
-        timer->start(ViewParams::instance()->getPropertyViewTimer());
+    if (prop.getName() && propertyEditorView->propOwners.contains(prop.getContainer())) {
+        pendingView.emplace(prop.getContainer(), prop.getName());
+        if (!updateTimer->isActive()) {
+            updateTimer->start();
+        }
     }
 }
 
+void PropertyView::updatePendingProperties()
+{
+    auto update = [](Gui::PropertyEditor::PropertyEditor* editor,
+                     std::set<PendingProperty>& pending) {
+        std::vector<const App::Property*> props;
+        props.reserve(pending.size());
+        for (const auto& [container, name] : pending) {
+            // Deleted objects are removed from the owners
+            if (!editor->propOwners.contains(container)) {
+                continue;
+            }
+            if (auto prop = container->getPropertyByName(name.c_str())) {
+                props.push_back(prop);
+            }
+        }
+        pending.clear();
+        if (!props.empty()) {
+            editor->updateProperties(props);
+        }
+    };
+
+    update(propertyEditorData, pendingData);
+    update(propertyEditorView, pendingView);
+}
+
 bool PropertyView::isPropertyHidden(const App::Property* prop)
 {
     return prop && !showAll()
@@ -354,18 +397,6 @@ struct PropertyView::PropInfo
     std::vector<App::Property*> propList;
 };
 
-struct PropertyView::PropFind
-{
-    const PropInfo& item;
-    explicit PropFind(const PropInfo& item)
-        : item(item)
-    {}
-    bool operator()(const PropInfo& elem) const
-    {
-        return (elem.propId == item.propId) && (elem.propName == item.propName);
-    }
-};
-
 void PropertyView::onSelectionChanged(const SelectionChanges& msg)
 {
     if (msg.Type != SelectionChanges::AddSelection && msg.Type != SelectionChanges::RmvSelection
@@ -387,6 +418,11 @@ void PropertyView::onTimer()
     Base::StateLocker guard(this->updating);
 
     timer->stop();
+    // The rebuild below refreshes all rows
+    updateTimer->stop();
+    pendingData.clear();
+    pendingView.clear();
+    linkedProperties = false;
 
     if (!this->isSelectionAttached()) {
         propertyEditorData->buildUp();
@@ -419,9 +455,26 @@ void PropertyView::onTimer()
 
     std::set<App::DocumentObject*> objSet;
 
-    // group the properties by <name,id>
+    // group the properties by <name,id>, the index maps keep the grouping fast when
+    // hundreds of objects are selected
+    using PropKey = std::pair<std::string, int>;
     std::vector<PropInfo> propDataMap;
     std::vector<PropInfo> propViewMap;
+    std::map<PropKey, std::size_t> propDataIndex;
+    std::map<PropKey, std::size_t> propViewIndex;
+    auto addProperty = [](std::vector<PropInfo>& infos,
+                          std::map<PropKey, std::size_t>& index,
+                          const std::string& name,
+                          App::Property* prop) {
+        auto res = index.emplace(PropKey(name, prop->getTypeId().getKey()), infos.size());
+        if (res.second) {
+            PropInfo nameType;
+            nameType.propName = name;
+            nameType.propId = res.first->first.second;
+            infos.push_back(std::move(nameType));
+        }
+        infos[res.first->second].propList.push_back(prop);
+    };
     bool checkLink = true;
     ViewProviderDocumentObject* vpLast = nullptr;
     auto sels = Gui::Selection().getSelectionEx("*");
@@ -466,18 +519,7 @@ void PropertyView::onTimer()
                     continue;
                 }
 
-                PropInfo nameType;
-                nameType.propName = prop->getName();
-                nameType.propId = prop->getTypeId().getKey();
-
-                auto pi = std::find_if(propDataMap.begin(), propDataMap.end(), PropFind(nameType));
-                if (pi != propDataMap.end()) {
-                    pi->propList.push_back(prop);
-                }
-                else {
-                    nameType.propList.push_back(prop);
-                    propDataMap.push_back(nameType);
-                }
+                addProperty(propDataMap, propDataIndex, prop->getName(), prop);
             }
         }
         // the same for the view properties
@@ -488,18 +530,7 @@ void PropertyView::onTimer()
                     continue;
                 }
 
-                PropInfo nameType;
-                nameType.propName = pt->first;
-                nameType.propId = pt->second->getTypeId().getKey();
-
-                auto pi = std::find_if(propViewMap.begin(), propViewMap.end(), PropFind(nameType));
-                if (pi != propViewMap.end()) {
-                    pi->propList.push_back(pt->second);
-                }
-                else {
-                    nameType.propList.push_back(pt->second);
-                    propViewMap.push_back(nameType);
-                }
+                addProperty(propViewMap, propViewIndex, pt->first, pt->second);
             }
         }
     }
@@ -559,6 +590,7 @@ void PropertyView::onTimer()
                     viewProps.emplace_back(name + "*", std::move(items));
                 }
             }
+            linkedProperties = true;
         }
     }
 
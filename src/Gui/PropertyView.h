@@ -22,6 +22,10 @@
 
 #pragma once
 
+#include <set>
+#include <string>
+#include <utility>
+
 #include "DockWindow.h"
 #include "Selection.h"
 
@@ -94,10 +98,12 @@ private:
     void slotDeletedObject(const App::DocumentObject&);
 
     void checkEnable(const char* doc = nullptr);
+    void updatePendingProperties();
 
 private:
     struct PropInfo;
-    struct PropFind;
+    /// A changed property, kept by container and name to not hold a pointer to it
+    using PendingProperty = std::pair<const App::PropertyContainer*, std::string>;
     using Connection = fastsignals::connection;
     Connection connectPropData;
     Connection connectPropView;
@@ -114,6 +120,12 @@ private:
     Connection connectChangedDocument;
     QTabWidget* tabs;
     QTimer* timer;
+    /// Refreshes the rows of changed properties once per event loop cycle
+    QTimer* updateTimer;
+    std::set<PendingProperty> pendingData;
+    std::set<PendingProperty> pendingView;
+    /// The data tab shows the properties of a linked object
+    bool linkedProperties = false;
     bool updating = false;
 };
 
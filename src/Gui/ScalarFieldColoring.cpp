@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <Inventor/nodes/SoSwitch.h>
+#include <Inventor/nodes/SoTexture2.h>
+#include <Inventor/nodes/SoTexture2Transform.h>
+#include <Inventor/nodes/SoTextureCoordinate2.h>
+#include <Inventor/nodes/SoTextureCoordinateBinding.h>
+
+#include "ScalarFieldColoring.h"
+#include "SoFCColorBar.h"
+
+using namespace Gui;
+
+namespace
+{
+// Number of texels of the colour texture. The first and last texel hold the colours of values
+// below and above the parameter range.
+constexpr int textureSize = 256;
+}  // namespace
+
+ScalarFieldColoring::ScalarFieldColoring()
+    : root(new SoSwitch)
+    , texture(new SoTexture2)
+    , transform(new SoTexture2Transform)
+    , coords(new SoTextureCoordinate2)
+{
+    root->ref();
+    root->whichChild = SO_SWITCH_NONE;
+
+    texture->model = SoTexture2::MODULATE;
+    texture->wrapS = SoTexture2::CLAMP;
+    texture->wrapT = SoTexture2::CLAMP;
+    root->addChild(texture);
+    root->addChild(transform);
+
+    auto binding = new SoTextureCoordinateBinding;
+    binding->value = SoTextureCoordinateBinding::PER_VERTEX_INDEXED;
+    root->addChild(binding);
+    root->addChild(coords);
+}
+
+ScalarFieldColoring::~ScalarFieldColoring()
+{
+    root->unref();
+}
+
+SoNode* ScalarFieldColoring::getRoot() const
+{
+    return root;
+}
+
+void ScalarFieldColoring::setValues(const std::vector<float>& values)
+{
+    // Keep the texture coordinates finite after the transformation. Values far outside of any
+    // sensible range (e.g. FLT_MAX for unknown distances) end up in the outermost texel anyway.
+    constexpr float limit = 1e30F;
+
+    // the second texture coordinate is irrelevant because the texture has only one row
+    coords->point.setNum(static_cast<int>(values.size()));
+    SbVec2f* pts = coords->point.startEditing();
+    for (std::size_t i = 0; i < values.size(); i++) {
+        float value = std::isnan(values[i]) ? limit : std::clamp(values[i], -limit, limit);
+        pts[i].setValue(value, 0.5F);
+    }
+    coords->point.finishEditing();
+
+    root->whichChild = values.empty() ? SO_SWITCH_NONE : SO_SWITCH_ALL;
+}
+
+int ScalarFieldColoring::countValues() const
+{
+    return coords->point.getNum();
+}
+
+void ScalarFieldColoring::setHiddenTransparency(float value)
+{
+    hiddenTransparency = value;
+}
+
+void ScalarFieldColoring::setColorBar(const SoFCColorBarBase* bar)
+{
+    float fMin = bar->getMinValue();
+    float fMax = bar->getMaxValue();
+    float step = (fMax - fMin) / float(textureSize - 3);
+    step = std::max(step, std::numeric_limits<float>::epsilon() * std::max(1.0F, std::fabs(fMin)));
+
+    // the texel centers 1 to n-2 cover the parameter range
+    std::vector<unsigned char> image(4 * textureSize);
+    for (int i = 0; i < textureSize; i++) {
+        float value = fMin + float(i - 1) * step;
+        Base::Color col = bar->getColor(value);
+        float transp = col.transparency();
+        if (hiddenTransparency >= 0.0F) {
+            transp = bar->isVisible(value) ? 0.0F : hiddenTransparency;
+        }
+
+        auto toByte = [](float v) {
+            return static_cast<unsigned char>(std::clamp(v, 0.0F, 1.0F) * 255.0F + 0.5F);
+        };
+        image[4 * i + 0] = toByte(col.r);
+        image[4 * i + 1] = toByte(col.g);
+        image[4 * i + 2] = toByte(col.b);
+        image[4 * i + 3] = toByte(1.0F - transp);
+    }
+
+    texture->image.setValue(SbVec2s(textureSize, 1), 4, image.data());
+
+    // maps a value v onto the texture coordinate ((v - fMin) / step + 1.5) / n
+    float scale = 1.0F / (step * float(textureSize));
+    float offset = (1.5F - fMin / step) / float(textureSize);
+    transform->scaleFactor.setValue(scale, 1.0F);
+    transform->translation.setValue(offset, 0.0F);
+}
@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <FCGlobal.h>
+
+class SoNode;
+class SoSwitch;
+class SoTexture2;
+class SoTexture2Transform;
+class SoTextureCoordinate2;
+
+namespace Gui
+{
+
+class SoFCColorBarBase;
+
+/**
+ * The ScalarFieldColoring class displays one scalar value per vertex with the colours of a
+ * colour bar.
+ *
+ * Instead of computing one colour per vertex the values are stored once as texture coordinates
+ * and the gradient of the colour bar is sampled into a small texture. The mapping of the
+ * parameter range onto the texture is done by a texture transformation, so that changing the
+ * range or the colours of the bar only updates the texture and the transformation, independent
+ * of the number of vertices.
+ *
+ * The root node must be inserted in front of the shape node. As the texture is modulated with
+ * the material the diffuse colour of the shape should be white.
+ */
+class GuiExport ScalarFieldColoring
+{
+public:
+    ScalarFieldColoring();
+    ~ScalarFieldColoring();
+
+    /// Returns the node that must be added in front of the shape node
+    SoNode* getRoot() const;
+    /// Sets one value per vertex. An empty list switches off the coloring.
+    void setValues(const std::vector<float>& values);
+    /// Returns the number of values
+    int countValues() const;
+    /// Rebuilds the colour texture and the mapping from the current settings of the colour bar
+    void setColorBar(const SoFCColorBarBase* bar);
+    /**
+     * Sets the transparency of values that are not visible in the colour bar. If negative the
+     * transparency of the colour bar is used.
+     */
+    void setHiddenTransparency(float value);
+
+private:
+    SoSwitch* root;
+    SoTexture2* texture;
+    SoTexture2Transform* transform;
+    SoTextureCoordinate2* coords;
+    float hiddenTransparency {-1.0F};
+
+    FC_DISABLE_COPY_MOVE(ScalarFieldColoring)
+};
+
+}  // namespace Gui
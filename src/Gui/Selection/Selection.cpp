@@ -25,6 +25,7 @@
 
 #include <array>
 #include <set>
+#include <unordered_map>
 #include <boost/algorithm/string/predicate.hpp>
 #include <QApplication>
 
@@ -568,21 +569,35 @@ static void notifyDocumentObjectViewProvider(const SelectionChanges& changes)
 
 void SelectionSingleton::notify(SelectionChanges&& Chng)
 {
-    if (Notifying) {
-        NotificationQueue.push_back(std::move(Chng));
+    NotificationQueue.push_back(std::move(Chng));
+    if (Notifying || batchDepth > 0) {
         return;
     }
+    processNotifications();
+}
+
+void SelectionSingleton::processNotifications()
+{
     Base::FlagToggler<bool> flag(Notifying);
-    NotificationQueue.push_back(std::move(Chng));
     while (!NotificationQueue.empty()) {
         const auto& msg = NotificationQueue.front();
+        // The messages of a closed batch still match the selection as long as no observer
+        // queued further changes, so checking each of them against the selection list, which
+        // is quadratic for big selections, is only needed afterwards
+        bool trusted = trustedNotifications > 0
+            && trustedNotifications == NotificationQueue.size();
+        if (trustedNotifications > 0) {
+            --trustedNotifications;
+        }
         bool notify = false;
         switch (msg.Type) {
             case SelectionChanges::AddSelection:
-                notify = isSelected(msg.pDocName, msg.pObjectName, msg.pSubName, ResolveMode::NoResolve);
+                notify = trusted
+                    || isSelected(msg.pDocName, msg.pObjectName, msg.pSubName, ResolveMode::NoResolve);
                 break;
             case SelectionChanges::RmvSelection:
-                notify = !isSelected(msg.pDocName, msg.pObjectName, msg.pSubName, ResolveMode::NoResolve);
+                notify = trusted
+                    || !isSelected(msg.pDocName, msg.pObjectName, msg.pSubName, ResolveMode::NoResolve);
                 break;
             case SelectionChanges::SetPreselect:
                 notify = CurrentPreselection.Type == SelectionChanges::SetPreselect
@@ -609,6 +624,58 @@ void SelectionSingleton::notify(SelectionChanges&& Chng)
         }
         NotificationQueue.pop_front();
     }
+    trustedNotifications = 0;
+}
+
+void SelectionSingleton::coalesceNotifications()
+{
+    // Only the last addition or removal of an element counts. Any other message ends the run,
+    // so that the order relative to e.g. clearing the selection is kept.
+    std::vector<bool> keep(NotificationQueue.size(), true);
+    std::unordered_map<std::string, std::size_t> lastChange;
+    for (std::size_t i = 0; i < NotificationQueue.size(); ++i) {
+        const auto& msg = NotificationQueue[i];
+        if (msg.Type != SelectionChanges::AddSelection
+            && msg.Type != SelectionChanges::RmvSelection) {
+            lastChange.clear();
+            continue;
+        }
+        std::string key(msg.pDocName);
+        key += '#';
+        key += msg.pObjectName;
+        key += '.';
+        key += msg.pSubName;
+        auto res = lastChange.emplace(std::move(key), i);
+        if (!res.second) {
+            keep[res.first->second] = false;
+            res.first->second = i;
+        }
+    }
+
+    std::deque<SelectionChanges> queue;
+    for (std::size_t i = 0; i < keep.size(); ++i) {
+        if (keep[i]) {
+            queue.push_back(std::move(NotificationQueue[i]));
+        }
+    }
+    NotificationQueue.swap(queue);
+}
+
+int SelectionSingleton::beginBatch()
+{
+    return ++batchDepth;
+}
+
+int SelectionSingleton::endBatch()
+{
+    if (--batchDepth > 0 || Notifying) {
+        // an outer batch or the running notification loop dispatches the queue
+        return batchDepth;
+    }
+    coalesceNotifications();
+    trustedNotifications = NotificationQueue.size();
+    processNotifications();
+    return batchDepth;
 }
 
 bool SelectionSingleton::hasPickedList() const
@@ -1448,6 +1515,7 @@ bool SelectionSingleton::addSelections(
 
     std::ostringstream ss;
     bool anyLogged = false;
+    SelectionBatch batch;
 
     if (!logDisabled) {
         ss << "Gui.Selection.addSelection(App.getDocument('" << pDocName << "').getObject('"
@@ -423,6 +423,15 @@ public:
     int disableCommandLog();
     int enableCommandLog(bool silent = false);
 
+    /** Open a batch of selection changes, e.g. of a box selection
+     * The notifications are queued until the outermost batch is closed. Then the additions
+     * and removals that undo each other are dropped and the rest is dispatched in one pass.
+     * @see SelectionBatch
+     */
+    int beginBatch();
+    /// Close a batch of selection changes
+    int endBatch();
+
     /** Returns the number of selected objects with a special object type
      * It's the convenient way to check if the right objects are selected to
      * perform an operation (GuiCommand). The check also detects base types.
@@ -766,8 +775,13 @@ protected:
 
     std::deque<SelectionChanges> NotificationQueue;
     bool Notifying = false;
+    int batchDepth = 0;
+    // number of queued notifications of a closed batch that need no more checks
+    std::size_t trustedNotifications = 0;
 
     void notify(SelectionChanges&& Chng);
+    void processNotifications();
+    void coalesceNotifications();
     void notify(const SelectionChanges& Chng)
     {
         notify(SelectionChanges(Chng));
@@ -902,4 +916,19 @@ private:
     bool silent;
 };
 
+/** Helper class to batch the selection changes done in its scope
+ */
+class GuiExport SelectionBatch
+{
+public:
+    SelectionBatch()
+    {
+        Selection().beginBatch();
+    }
+    ~SelectionBatch()
+    {
+        Selection().endBatch();
+    }
+};
+
 }  // namespace Gui
@@ -1203,9 +1203,28 @@ SoFCSeparator::SoFCSeparator(bool trackCacheMode)
 
 void SoFCSeparator::GLRenderBelowPath(SoGLRenderAction* action)
 {
-    if (trackCacheMode && renderCaching.getValue() != CacheMode) {
-        renderCaching = CacheMode;
-        boundingBoxCaching = CacheMode;
+    if (trackCacheMode) {
+        // Coin only culls a separator against the view volume with a valid bounding box cache.
+        // Unlike render caches, bounding box caches do not depend on the GL state, so keep them
+        // even when render caching is disabled, to skip whole objects outside of the view.
+        auto bboxCaching = CacheMode;
+        if (ViewParams::instance()->getRenderCulling()) {
+            if (bboxCaching == SoSeparator::OFF) {
+                bboxCaching = SoSeparator::AUTO;
+            }
+            if (renderCulling.getValue() != SoSeparator::ON) {
+                renderCulling = SoSeparator::ON;
+            }
+        }
+        else if (renderCulling.getValue() != SoSeparator::AUTO) {
+            renderCulling = SoSeparator::AUTO;
+        }
+        if (renderCaching.getValue() != CacheMode) {
+            renderCaching = CacheMode;
+        }
+        if (boundingBoxCaching.getValue() != bboxCaching) {
+            boundingBoxCaching = bboxCaching;
+        }
     }
     inherited::GLRenderBelowPath(action);
 }
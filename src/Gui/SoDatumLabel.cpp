@@ -38,6 +38,7 @@
 #include <cmath>
 #include <limits>
 #include <numbers>
+#include <sstream>
 #include <QFontMetrics>
 #include <QPainter>
 
@@ -54,6 +55,7 @@
 #include <Gui/Tools.h>
 
 #include "SoDatumLabel.h"
+#include "TextureAtlas.h"
 
 // NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-pro-bounds-pointer-arithmetic)
 constexpr const float ZCONSTR {0.006F};
@@ -178,10 +180,19 @@ SoDatumLabel::SoDatumLabel()
     this->imgWidth = 0;
     this->imgHeight = 0;
     this->glimagevalid = false;
+    this->atlasSlot = -1;
+}
+
+SoDatumLabel::~SoDatumLabel()
+{
+    TextureAtlas::instance().release(this->atlasSlot);
 }
 
 void SoDatumLabel::drawImage()
 {
+    TextureAtlas::instance().release(this->atlasSlot);
+    this->atlasSlot = -1;
+
     const SbString* s = string.getValues(0);
     int num = string.getNum();
     if (num == 0) {
@@ -226,6 +237,17 @@ void SoDatumLabel::drawImage()
     painter.end();
 
     Gui::BitmapFactory().convert(image, this->image);
+
+    SbVec2s imgsize;
+    int nc {};
+    const unsigned char* dataptr = this->image.getValue(imgsize, nc);
+    if (dataptr && nc == 4) {
+        std::ostringstream key;
+        key << name.getValue().getString() << '|' << size.getValue() << '|' << sampling.getValue()
+            << '|' << front.rgba() << '|' << strikethrough.getValue() << '|' << useAntialiasing
+            << '|' << s[0].getString();
+        this->atlasSlot = TextureAtlas::instance().acquire(key.str(), dataptr, imgsize);
+    }
 }
 
 namespace Gui
@@ -1234,7 +1256,7 @@ void SoDatumLabel::GLRender(SoGLRenderAction* action)
     }
 
     if (hasText) {
-        drawText(state, srcw, srch, angle, textOffset);
+        drawText(state, angle, textOffset);
     }
 
     glPopAttrib();
@@ -1459,103 +1481,27 @@ void SoDatumLabel::drawArcLength(const SbVec3f* points, float& angle, SbVec3f& t
     glDrawArrow(geom.pnt4, geom.dirEnd, arrowWidth, arrowLength);
 }
 
-// NOLINTNEXTLINE
-void SoDatumLabel::drawText(SoState* state, int srcw, int srch, float angle, const SbVec3f& textOffset)
+void SoDatumLabel::drawText(SoState* state, float angle, const SbVec3f& textOffset)
 {
-    SbVec2s imgsize;
-    int nc {};
-    const unsigned char* dataptr = this->image.getValue(imgsize, nc);
+    // The text images of all labels are kept in shared textures, and a label only uploads its
+    // image when the text changed
+    SbVec2f texMin;
+    SbVec2f texMax;
+    if (!TextureAtlas::instance().bind(state, this->atlasSlot, texMin, texMax)) {
+        return;
+    }
 
     // Get the camera z-direction
     const SbViewVolume& vv = SoViewVolumeElement::get(state);
     SbVec3f z = vv.zVector();
 
     bool flip = norm.getValue().dot(z) > std::numeric_limits<float>::epsilon();
-
-    static bool init = false;
-    static bool npot = false;
-    if (!init) {
-        init = true;
-        std::string ext = reinterpret_cast<const char*>(glGetString(GL_EXTENSIONS));  // NOLINT
-        npot = (ext.find("GL_ARB_texture_non_power_of_two") != std::string::npos);
-    }
-
-    int w = srcw;
-    int h = srch;
-    if (!npot) {
-        // make power of two
-        if ((w & (w - 1)) != 0) {
-            int i = 1;
-            while (i < 8) {
-                if ((w >> i) == 0) {
-                    break;
-                }
-                i++;
-            }
-            w = (1 << i);
-        }
-        // make power of two
-        if ((h & (h - 1)) != 0) {
-            int i = 1;
-            while (i < 8) {
-                if ((h >> i) == 0) {
-                    break;
-                }
-                i++;
-            }
-            h = (1 << i);
-        }
-    }
+    float left = flip ? texMin[0] : texMax[0];
+    float right = flip ? texMax[0] : texMin[0];
 
     glDisable(GL_DEPTH_TEST);
     glEnable(GL_TEXTURE_2D);  // Enable Textures
     glEnable(GL_BLEND);
-
-    // glGenTextures/glBindTexture was commented out but it must be active, see:
-    // #0000971: Tracing over a background image in Sketcher: image is overwritten by first
-    // dimensional constraint text #0001185: Planer image changes to number graphic when a part
-    // design constraint is made after the planar image
-    //
-    // Copy the text bitmap into memory and bind
-    GLuint myTexture {};
-    // generate a texture
-    glGenTextures(1, &myTexture);
-    glBindTexture(GL_TEXTURE_2D, myTexture);
-
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-
-    if (!npot) {
-        QImage imagedata(w, h, QImage::Format_ARGB32_Premultiplied);
-        imagedata.fill(0x00000000);
-        int sx = (w - srcw) / 2;
-        int sy = (h - srch) / 2;
-        glTexImage2D(
-            GL_TEXTURE_2D,
-            0,
-            nc,
-            w,
-            h,
-            0,
-            GL_RGBA,
-            GL_UNSIGNED_BYTE,
-            (const GLvoid*)imagedata.bits()
-        );
-        glTexSubImage2D(
-            GL_TEXTURE_2D,
-            0,
-            sx,
-            sy,
-            srcw,
-            srch,
-            GL_RGBA,
-            GL_UNSIGNED_BYTE,
-            (const GLvoid*)dataptr
-        );
-    }
-    else {
-        glTexImage2D(GL_TEXTURE_2D, 0, nc, srcw, srch, 0, GL_RGBA, GL_UNSIGNED_BYTE, (const GLvoid*)dataptr);
-    }
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
     glMatrixMode(GL_MODELVIEW);
@@ -1568,13 +1514,13 @@ void SoDatumLabel::drawText(SoState* state, int srcw, int srch, float angle, con
 
     glColor3f(1.F, 1.F, 1.F);
 
-    glTexCoord2f(flip ? 0.F : 1.F, 1.F);
+    glTexCoord2f(left, texMax[1]);
     glVertex2f(-this->imgWidth / 2, this->imgHeight / 2);
-    glTexCoord2f(flip ? 0.F : 1.F, 0.F);
+    glTexCoord2f(left, texMin[1]);
     glVertex2f(-this->imgWidth / 2, -this->imgHeight / 2);
-    glTexCoord2f(flip ? 1.F : 0.F, 0.F);
+    glTexCoord2f(right, texMin[1]);
     glVertex2f(this->imgWidth / 2, -this->imgHeight / 2);
-    glTexCoord2f(flip ? 1.F : 0.F, 1.F);
+    glTexCoord2f(right, texMax[1]);
     glVertex2f(this->imgWidth / 2, this->imgHeight / 2);
 
     glEnd();
@@ -1582,10 +1528,7 @@ void SoDatumLabel::drawText(SoState* state, int srcw, int srch, float angle, con
     // Reset the Mode
     glPopMatrix();
 
-    // wmayer: see bug report below which is caused by generating but not
-    // deleting the texture.
-    // #0000721: massive memory leak when dragging an unconstrained model
-    glDeleteTextures(1, &myTexture);
+    glBindTexture(GL_TEXTURE_2D, 0);
 }
 
 void SoDatumLabel::setPoints(SbVec3f p1, SbVec3f p2)
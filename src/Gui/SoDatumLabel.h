@@ -94,7 +94,7 @@ public:
     bool useAntialiasing;
 
 protected:
-    ~SoDatumLabel() override = default;
+    ~SoDatumLabel() override;
     void GLRender(SoGLRenderAction* action) override;
     void computeBBox(SoAction*, SbBox3f& box, SbVec3f& center) override;
     void generatePrimitives(SoAction* action) override;
@@ -228,13 +228,14 @@ private:
     void drawAngle(const SbVec3f* points, float& angle, SbVec3f& textOffset);
     void drawSymmetric(const SbVec3f* points);
     void drawArcLength(const SbVec3f* points, float& angle, SbVec3f& textOffset);
-    void drawText(SoState* state, int srcw, int srch, float angle, const SbVec3f& textOffset);
+    void drawText(SoState* state, float angle, const SbVec3f& textOffset);
 
 private:
     void drawImage();
     float imgWidth;
     float imgHeight;
     bool glimagevalid;
+    int atlasSlot;
 };
 
 }  // namespace Gui
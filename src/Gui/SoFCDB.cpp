@@ -121,6 +121,7 @@ void Gui::SoFCDB::init()
     SoFCDocumentAction ::initClass();
     SoGLWidgetNode ::initClass();
     SoGLVBOActivatedElement ::initClass();
+    SoFCInteractionDetailElement ::initClass();
     SoFCEnableSelectionAction ::initClass();
     SoFCEnablePreselectionAction ::initClass();
     SoFCSelectionColorAction ::initClass();
@@ -268,3 +268,56 @@ SoElement* SoGLVBOActivatedElement::copyMatchInfo() const
 {
     return nullptr;
 }
+
+// ---------------------------------
+
+SO_ELEMENT_SOURCE(SoFCInteractionDetailElement)
+
+void SoFCInteractionDetailElement::initClass()
+{
+    SO_ELEMENT_INIT_CLASS(SoFCInteractionDetailElement, inherited);
+    SO_ENABLE(SoGLRenderAction, SoFCInteractionDetailElement);
+}
+
+void SoFCInteractionDetailElement::init(SoState* state)
+{
+    inherited::init(state);
+    this->detail = Full;
+}
+
+SoFCInteractionDetailElement::~SoFCInteractionDetailElement() = default;
+
+void SoFCInteractionDetailElement::push(SoState* state)
+{
+    inherited::push(state);
+    this->detail = static_cast<const SoFCInteractionDetailElement*>(getNextInStack())->detail;
+}
+
+void SoFCInteractionDetailElement::set(SoState* state, Detail detail)
+{
+    auto elem = static_cast<SoFCInteractionDetailElement*>(
+        SoElement::getElement(state, classStackIndex)
+    );
+    elem->detail = detail;
+}
+
+SoFCInteractionDetailElement::Detail SoFCInteractionDetailElement::get(SoState* state)
+{
+    const auto self = static_cast<const SoFCInteractionDetailElement*>(
+        SoElement::getConstElement(state, classStackIndex)
+    );
+    return self->detail;
+}
+
+// Render caches that depend on the detail are rebuilt when it changes
+SbBool SoFCInteractionDetailElement::matches(const SoElement* element) const
+{
+    return static_cast<const SoFCInteractionDetailElement*>(element)->detail == this->detail;
+}
+
+SoElement* SoFCInteractionDetailElement::copyMatchInfo() const
+{
+    auto elem = static_cast<SoFCInteractionDetailElement*>(getTypeId().createInstance());
+    elem->detail = this->detail;
+    return elem;
+}
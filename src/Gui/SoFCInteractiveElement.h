@@ -156,4 +156,44 @@ protected:
     SbBool active;
 };
 
+/**
+ * The detail of the shapes while the camera moves. A viewer lowers it when the
+ * frames take too long, so that shapes can leave out what is costly to draw but
+ * not needed to navigate.
+ */
+class GuiExport SoFCInteractionDetailElement: public SoElement
+{
+    using inherited = SoElement;
+
+    SO_ELEMENT_HEADER(SoFCInteractionDetailElement);
+
+public:
+    enum Detail
+    {
+        /// Everything is rendered
+        Full,
+        /// Coarser tessellations are used
+        Reduced,
+        /// In addition, the edges and vertices of shapes are hidden
+        Minimal,
+    };
+
+    static void initClass();
+
+    void init(SoState* state) override;
+    void push(SoState* state) override;
+
+    SbBool matches(const SoElement* element) const override;
+    SoElement* copyMatchInfo() const override;
+
+    static void set(SoState* state, Detail detail);
+    static Detail get(SoState* state);
+
+protected:
+    ~SoFCInteractionDetailElement() override;
+
+protected:
+    Detail detail;
+};
+
 }  // namespace Gui
@@ -28,12 +28,16 @@
 #include <Inventor/actions/SoGLRenderAction.h>
 #include <Inventor/elements/SoGLCacheContextElement.h>
 #include <Inventor/fields/SoSFImage.h>
+#include <Inventor/misc/SoContextHandler.h>
+#include <Inventor/nodes/SoCamera.h>
 #include <Inventor/nodes/SoNode.h>
 #include <QBuffer>
 #include <QDateTime>
 #include <QFile>
 #include <QImage>
 #include <QImageWriter>
+#include <QRunnable>
+#include <QThreadPool>
 
 #if defined(FC_OS_WIN32)
 # include <windows.h>
@@ -453,6 +457,7 @@ void SoQtOffscreenRenderer::init(const SbViewportRegion& vpr, SoGLRenderAction*
     this->viewport = vpr;  // clazy:exclude=rule-of-two-soft
 
     this->framebuffer = nullptr;
+    this->contextSamples = -1;
     this->numSamples = -1;
     // this->texFormat = GL_RGBA32F_ARB;
     this->texFormat = GL_RGB32F_ARB;
@@ -483,7 +488,7 @@ SoQtOffscreenRenderer::SoQtOffscreenRenderer(SoGLRenderAction* action)
 */
 SoQtOffscreenRenderer::~SoQtOffscreenRenderer()
 {
-    delete framebuffer;
+    destroyContext();
 
     if (this->didallocation) {
         delete this->renderaction;
@@ -603,25 +608,57 @@ void SoQtOffscreenRenderer::makeFrameBuffer(int width, int height, int samples)
     fmt.setInternalTextureFormat(this->texFormat);
 
     framebuffer = new QOpenGLFramebufferObject(width, height, fmt);
-    cache_context = SoGLCacheContextElement::getUniqueCacheContext();  // unique per pixel buffer
-                                                                       // object, just to be sure
 }
 
-SbBool SoQtOffscreenRenderer::renderFromBase(SoBase* base)
+SbBool SoQtOffscreenRenderer::makeContext()
 {
-    const SbVec2s fullsize = this->viewport.getViewportSizePixels();
+    if (context && contextSamples == PRIVATE(this)->numSamples) {
+        return context->makeCurrent(surface.get());
+    }
+    destroyContext();
 
     QSurfaceFormat format;
     format.setSamples(PRIVATE(this)->numSamples);
-    QOpenGLContext context;
-    context.setFormat(format);
-    if (!context.create()) {
+    auto newContext = std::make_unique<QOpenGLContext>();
+    newContext->setFormat(format);
+    if (!newContext->create()) {
+        return false;
+    }
+    surface = std::make_unique<QOffscreenSurface>();
+    surface->setFormat(format);
+    surface->create();
+    context = std::move(newContext);
+    contextSamples = PRIVATE(this)->numSamples;
+    cache_context = SoGLCacheContextElement::getUniqueCacheContext();  // unique per GL context
+    return context->makeCurrent(surface.get());
+}
+
+void SoQtOffscreenRenderer::destroyContext()
+{
+    if (context && context->makeCurrent(surface.get())) {
+        // the GL resources of the frame buffer and of the render caches belong to the context
+        delete framebuffer;
+        if (cache_context) {
+            SoContextHandler::destructingContext(cache_context);
+        }
+        context->doneCurrent();
+    }
+    else {
+        delete framebuffer;
+    }
+    framebuffer = nullptr;
+    cache_context = 0;
+    context.reset();
+    surface.reset();
+}
+
+SbBool SoQtOffscreenRenderer::renderFromBase(SoBase* base)
+{
+    const SbVec2s fullsize = this->viewport.getViewportSizePixels();
+
+    if (!makeContext()) {
         return false;
     }
-    QOffscreenSurface offscreen;
-    offscreen.setFormat(format);
-    offscreen.create();
-    context.makeCurrent(&offscreen);
 
     if (!framebuffer) {
         makeFrameBuffer(fullsize[0], fullsize[1], PRIVATE(this)->numSamples);
@@ -667,7 +704,7 @@ SbBool SoQtOffscreenRenderer::renderFromBase(SoBase* base)
     this->renderaction->setCacheContext(oldcontext);  // restore old
 
     glImage = framebuffer->toImage();
-    context.doneCurrent();
+    context->doneCurrent();
 
     return true;
 }
@@ -726,6 +763,75 @@ SbBool SoQtOffscreenRenderer::render(SoPath* scene)
     return PRIVATE(this)->renderFromBase(scene);
 }
 
+/*!
+  Render \a scene with each of the \a orientations of \a camera into \a images.
+*/
+SbBool SoQtOffscreenRenderer::renderViews(
+    SoNode* scene,
+    SoCamera* camera,
+    const std::vector<SbRotation>& orientations,
+    std::vector<QImage>& images
+)
+{
+    images.clear();
+    images.reserve(orientations.size());
+
+    SoNode* saved = camera->copy();
+    saved->ref();
+    SbBool ok = true;
+    for (const auto& orientation : orientations) {
+        camera->orientation.setValue(orientation);
+        camera->viewAll(scene, PRIVATE(this)->viewport);
+        if (!renderFromBase(scene)) {
+            ok = false;
+            break;
+        }
+        images.emplace_back();
+        writeToImage(images.back());
+    }
+    camera->copyFieldValues(saved);
+    saved->unref();
+    return ok;
+}
+
+namespace
+{
+class ImageFileWriter: public QRunnable
+{
+public:
+    ImageFileWriter(const QImage& img, const QString& filename)
+        : image(img)
+        , filename(filename)
+    {}
+    void run() override
+    {
+        if (!image.save(filename)) {
+            Base::Console().warning("Cannot save image to %s\n", filename.toUtf8().constData());
+        }
+    }
+
+private:
+    QImage image;
+    QString filename;
+};
+
+QThreadPool& imageFileWriters()
+{
+    static QThreadPool pool;
+    return pool;
+}
+}  // namespace
+
+void SoQtOffscreenRenderer::writeToImageFileAsync(const QImage& img, const QString& filename)
+{
+    imageFileWriters().start(new ImageFileWriter(img, filename));
+}
+
+void SoQtOffscreenRenderer::waitForImageFiles()
+{
+    imageFileWriters().waitForDone();
+}
+
 /*!
    Writes the rendered image buffer directly into a QImage object.
 */
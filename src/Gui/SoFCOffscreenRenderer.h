@@ -22,8 +22,11 @@
 
 #pragma once
 
+#include <memory>
+#include <vector>
 #include <Inventor/SbColor4f.h>
 #include <Inventor/SbMatrix.h>
+#include <Inventor/SbRotation.h>
 #include <Inventor/SoOffscreenRenderer.h>
 
 #include <FCConfig.h>
@@ -42,7 +45,10 @@
 
 #include <FCGlobal.h>
 
+class QOffscreenSurface;
+class QOpenGLContext;
 class QOpenGLFramebufferObject;
+class SoCamera;
 
 namespace Gui
 {
@@ -143,16 +149,38 @@ public:
 
     SbBool render(SoNode* scene);
     SbBool render(SoPath* scene);
+    /**
+     * Renders \a scene once for each of the \a orientations of \a camera, which must be part of
+     * the scene. The camera is fitted to the scene for each view and restored afterwards. The
+     * GL context, frame buffer and render caches are shared by all views.
+     */
+    SbBool renderViews(
+        SoNode* scene,
+        SoCamera* camera,
+        const std::vector<SbRotation>& orientations,
+        std::vector<QImage>& images
+    );
 
     void writeToImage(QImage&) const;
     QStringList getWriteImageFiletypeInfo() const;
 
+    /// Saves \a img to \a filename in a worker thread
+    static void writeToImageFileAsync(const QImage& img, const QString& filename);
+    /// Waits until all images passed to writeToImageFileAsync() are saved
+    static void waitForImageFiles();
+
 private:
     void init(const SbViewportRegion& vpr, SoGLRenderAction* glrenderaction = nullptr);
     static void pre_render_cb(void* userdata, SoGLRenderAction* action);
+    SbBool makeContext();
+    void destroyContext();
     SbBool renderFromBase(SoBase* base);
     void makeFrameBuffer(int width, int height, int samples);
 
+    // kept between the renderings, so that the frame buffer and the render caches are reused
+    std::unique_ptr<QOpenGLContext> context;
+    std::unique_ptr<QOffscreenSurface> surface;
+    int contextSamples;
     QOpenGLFramebufferObject* framebuffer;
     uint32_t cache_context;  // our unique context id
 
@@ -151,6 +151,60 @@ Py::Object SoQtOffscreenRendererPy::render(const Py::Tuple& args)
 }
 PYCXX_VARARGS_METHOD_DECL(SoQtOffscreenRendererPy, render)
 
+Py::Object SoQtOffscreenRendererPy::renderViews(const Py::Tuple& args)
+{
+    PyObject* proxy;
+    PyObject* camProxy;
+    PyObject* views;
+    PyObject* files;
+    if (!PyArg_ParseTuple(args.ptr(), "OOOO", &proxy, &camProxy, &views, &files)) {
+        throw Py::Exception();
+    }
+
+    try {
+        void* ptr = nullptr;
+        Base::Interpreter().convertSWIGPointerObj("pivy.coin", "SoNode *", proxy, &ptr, 0);
+        auto node = static_cast<SoNode*>(ptr);
+        ptr = nullptr;
+        Base::Interpreter().convertSWIGPointerObj("pivy.coin", "SoCamera *", camProxy, &ptr, 0);
+        auto camera = static_cast<SoCamera*>(ptr);
+
+        std::vector<SbRotation> orientations;
+        for (const auto& it : Py::Sequence(views)) {
+            Py::Sequence quat(it);
+            if (quat.size() != 4) {
+                throw Py::ValueError("an orientation must be a quaternion of four floats");
+            }
+            orientations.emplace_back(
+                float(Py::Float(quat[0])),
+                float(Py::Float(quat[1])),
+                float(Py::Float(quat[2])),
+                float(Py::Float(quat[3]))
+            );
+        }
+        Py::Sequence filenames(files);
+        if (filenames.size() != static_cast<Py::sequence_index_type>(orientations.size())) {
+            throw Py::ValueError("the number of orientations and file names differs");
+        }
+
+        std::vector<QImage> images;
+        bool ok = false;
+        if (node && camera) {
+            ok = renderer.renderViews(node, camera, orientations, images);
+        }
+        for (std::size_t i = 0; i < images.size(); ++i) {
+            std::string filename = Py::String(filenames[i]);
+            SoQtOffscreenRenderer::writeToImageFileAsync(images[i], QString::fromStdString(filename));
+        }
+        return Py::Boolean(ok);
+    }
+    catch (const Base::Exception& e) {
+        e.setPyException();
+        throw Py::Exception();
+    }
+}
+PYCXX_VARARGS_METHOD_DECL(SoQtOffscreenRendererPy, renderViews)
+
 Py::Object SoQtOffscreenRendererPy::writeToImage(const Py::Tuple& args)
 {
     const char* filename;
@@ -179,6 +233,13 @@ Py::Object SoQtOffscreenRendererPy::getWriteImageFiletypeInfo()
 }
 PYCXX_NOARGS_METHOD_DECL(SoQtOffscreenRendererPy, getWriteImageFiletypeInfo)
 
+Py::Object SoQtOffscreenRendererPy::waitForImageFiles()
+{
+    SoQtOffscreenRenderer::waitForImageFiles();
+    return Py::None();
+}
+PYCXX_NOARGS_METHOD_DECL(SoQtOffscreenRendererPy, waitForImageFiles)
+
 void SoQtOffscreenRendererPy::init_type()
 {
     behaviors().name("Gui.SoQtOffscreenRenderer");
@@ -208,12 +269,24 @@ void SoQtOffscreenRendererPy::init_type()
         "getInternalTextureFormat() -> int"
     );
     PYCXX_ADD_VARARGS_METHOD(render, render, "render(node)");
+    PYCXX_ADD_VARARGS_METHOD(
+        renderViews,
+        renderViews,
+        "renderViews(node, camera, [quaternion], [string]) -> bool\n"
+        "Renders the scene once for each camera orientation and saves the images in the\n"
+        "background, see waitForImageFiles()"
+    );
     PYCXX_ADD_VARARGS_METHOD(writeToImage, writeToImage, "writeToImage(string)");
     PYCXX_ADD_NOARGS_METHOD(
         getWriteImageFiletypeInfo,
         getWriteImageFiletypeInfo,
         "getWriteImageFiletypeInfo() -> tuple"
     );
+    PYCXX_ADD_NOARGS_METHOD(
+        waitForImageFiles,
+        waitForImageFiles,
+        "waitForImageFiles()\nWaits until the images of renderViews() are saved"
+    );
 
     behaviors().readyType();
 }
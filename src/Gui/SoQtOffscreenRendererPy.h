@@ -53,9 +53,11 @@ public:
     Py::Object getInternalTextureFormat();
 
     Py::Object render(const Py::Tuple&);
+    Py::Object renderViews(const Py::Tuple&);
 
     Py::Object writeToImage(const Py::Tuple&);
     Py::Object getWriteImageFiletypeInfo();
+    Py::Object waitForImageFiles();
 
 private:
     SoQtOffscreenRenderer renderer;
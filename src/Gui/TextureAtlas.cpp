@@ -0,0 +1,323 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include <FCConfig.h>
+
+#ifdef FC_OS_WIN32
+# include <windows.h>
+# undef min
+# undef max
+#endif
+#ifdef FC_OS_MACOSX
+# include <OpenGL/gl.h>
+#else
+# include <GL/gl.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+
+#include <Inventor/elements/SoGLCacheContextElement.h>
+#include <Inventor/misc/SoContextHandler.h>
+
+#include "TextureAtlas.h"
+
+
+using namespace Gui;
+
+namespace
+{
+// size of a texture page, larger images get a page of their own
+constexpr int PageSize = 1024;
+// transparent pixels right and below of every image, so that neighbours don't bleed in
+constexpr int Padding = 1;
+// number of uploads remembered per page, older textures get the whole page again
+constexpr std::size_t MaxUpdates = 256;
+}  // namespace
+
+TextureAtlas& TextureAtlas::instance()
+{
+    // never destroyed, the context callbacks may still be called at exit
+    static auto atlas = new TextureAtlas();
+    return *atlas;
+}
+
+TextureAtlas::TextureAtlas()
+{
+    SoContextHandler::addContextDestructionCallback(context_destruction_cb, this);
+}
+
+TextureAtlas::~TextureAtlas()
+{
+    SoContextHandler::removeContextDestructionCallback(context_destruction_cb, this);
+}
+
+int TextureAtlas::acquire(const std::string& key, const unsigned char* rgba, const SbVec2s& size)
+{
+    auto it = keys.find(key);
+    if (it != keys.end()) {
+        Slot& slot = slots[it->second];
+        if (slot.refs++ == 0) {
+            ++pages[slot.page].live;
+        }
+        return it->second;
+    }
+
+    int width = size[0];
+    int height = size[1];
+    int id = allocate(width + Padding, height + Padding);
+
+    Slot& slot = slots[id];
+    slot.width = width;
+    slot.height = height;
+    slot.refs = 1;
+    slot.key = key;
+    keys[key] = id;
+
+    Page& page = pages[slot.page];
+    ++page.live;
+    for (int row = 0; row < slot.cellHeight; ++row) {
+        unsigned char* dst = &page.pixels[(std::size_t(slot.y + row) * page.width + slot.x) * 4];
+        int copied = 0;
+        if (row < height) {
+            copied = width * 4;
+            std::memcpy(dst, rgba + std::size_t(row) * copied, copied);
+        }
+        std::memset(dst + copied, 0, slot.cellWidth * 4 - copied);
+    }
+
+    page.updates.push_back({++page.revision, slot.x, slot.y, slot.cellWidth, slot.cellHeight});
+    if (page.updates.size() > MaxUpdates) {
+        page.updates.erase(page.updates.begin());
+    }
+    return id;
+}
+
+void TextureAtlas::release(int slot)
+{
+    if (slot < 0 || slot >= static_cast<int>(slots.size())) {
+        return;
+    }
+    // The image stays in its cell until the cell is needed, so it may be acquired again
+    Slot& s = slots[slot];
+    if (s.refs > 0 && --s.refs == 0) {
+        --pages[s.page].live;
+    }
+}
+
+int TextureAtlas::allocate(int width, int height)
+{
+    // Prefer the smallest unused cell the image fits in
+    int best = -1;
+    for (int i = 0; i < static_cast<int>(slots.size()); ++i) {
+        const Slot& s = slots[i];
+        if (s.page < 0 || s.refs > 0 || s.cellWidth < width || s.cellHeight < height
+            || s.cellHeight > 2 * height) {
+            continue;
+        }
+        if (best < 0
+            || s.cellWidth * s.cellHeight < slots[best].cellWidth * slots[best].cellHeight) {
+            best = i;
+        }
+    }
+    if (best >= 0) {
+        keys.erase(slots[best].key);
+        return best;
+    }
+
+    int x = 0;
+    int y = 0;
+    int page = 0;
+    for (; page < static_cast<int>(pages.size()); ++page) {
+        if (allocateOnPage(page, width, height, x, y)) {
+            break;
+        }
+    }
+
+    if (page == static_cast<int>(pages.size())) {
+        // Start over on a page without any used image before adding a new one
+        auto empty = std::find_if(pages.begin(), pages.end(), [](const Page& p) {
+            return p.live == 0;
+        });
+        if (empty != pages.end() && empty->width >= width && empty->height >= height) {
+            page = static_cast<int>(empty - pages.begin());
+            for (auto& s : slots) {
+                if (s.page == page) {
+                    keys.erase(s.key);
+                    s = Slot();
+                }
+            }
+            empty->shelves.clear();
+            empty->top = 0;
+        }
+        else {
+            Page newPage;
+            newPage.width = std::max(PageSize, width);
+            newPage.height = std::max(PageSize, height);
+            newPage.pixels.resize(std::size_t(newPage.width) * newPage.height * 4, 0);
+            pages.push_back(std::move(newPage));
+        }
+        allocateOnPage(page, width, height, x, y);
+    }
+
+    auto unused = std::find_if(slots.begin(), slots.end(), [](const Slot& s) {
+        return s.page < 0;
+    });
+    int id = static_cast<int>(unused - slots.begin());
+    if (unused == slots.end()) {
+        slots.emplace_back();
+    }
+
+    Slot& slot = slots[id];
+    slot.page = page;
+    slot.x = x;
+    slot.y = y;
+    slot.cellWidth = width;
+    slot.cellHeight = height;
+    return id;
+}
+
+bool TextureAtlas::allocateOnPage(int index, int width, int height, int& x, int& y)
+{
+    // Images are put on shelves of about their height, from left to right
+    Page& page = pages[index];
+    for (auto& shelf : page.shelves) {
+        if (shelf.height >= height && shelf.height <= height + height / 2
+            && page.width - shelf.used >= width) {
+            x = shelf.used;
+            y = shelf.y;
+            shelf.used += width;
+            return true;
+        }
+    }
+
+    if (page.height - page.top < height || page.width < width) {
+        return false;
+    }
+    page.shelves.push_back({page.top, height, width});
+    x = 0;
+    y = page.top;
+    page.top += height;
+    return true;
+}
+
+bool TextureAtlas::bind(SoState* state, int slot, SbVec2f& texMin, SbVec2f& texMax)
+{
+    if (slot < 0 || slot >= static_cast<int>(slots.size()) || slots[slot].page < 0) {
+        return false;
+    }
+
+    const Slot& s = slots[slot];
+    Page& page = pages[s.page];
+    auto& texture = page.textures[SoGLCacheContextElement::get(state)];
+    if (texture.first == 0) {
+        glGenTextures(1, &texture.first);
+        glBindTexture(GL_TEXTURE_2D, texture.first);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
+        glTexImage2D(
+            GL_TEXTURE_2D,
+            0,
+            GL_RGBA,
+            page.width,
+            page.height,
+            0,
+            GL_RGBA,
+            GL_UNSIGNED_BYTE,
+            page.pixels.data()
+        );
+        texture.second = page.revision;
+    }
+    else {
+        glBindTexture(GL_TEXTURE_2D, texture.first);
+        if (texture.second != page.revision) {
+            upload(page, texture.second);
+            texture.second = page.revision;
+        }
+    }
+
+    texMin.setValue(float(s.x) / float(page.width), float(s.y) / float(page.height));
+    texMax.setValue(
+        float(s.x + s.width) / float(page.width),
+        float(s.y + s.height) / float(page.height)
+    );
+    return true;
+}
+
+void TextureAtlas::upload(const Page& page, unsigned revision)
+{
+    glPushClientAttrib(GL_CLIENT_PIXEL_STORE_BIT);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, page.width);
+
+    // Only the images added since the last upload, unless they are no longer known
+    if (!page.updates.empty() && page.updates.front().revision <= revision + 1) {
+        for (const auto& update : page.updates) {
+            if (update.revision <= revision) {
+                continue;
+            }
+            glTexSubImage2D(
+                GL_TEXTURE_2D,
+                0,
+                update.x,
+                update.y,
+                update.width,
+                update.height,
+                GL_RGBA,
+                GL_UNSIGNED_BYTE,
+                &page.pixels[(std::size_t(update.y) * page.width + update.x) * 4]
+            );
+        }
+    }
+    else {
+        glTexSubImage2D(
+            GL_TEXTURE_2D,
+            0,
+            0,
+            0,
+            page.width,
+            page.height,
+            GL_RGBA,
+            GL_UNSIGNED_BYTE,
+            page.pixels.data()
+        );
+    }
+
+    glPopClientAttrib();
+}
+
+void TextureAtlas::context_destruction_cb(uint32_t context, void* userdata)
+{
+    auto self = static_cast<TextureAtlas*>(userdata);
+
+    for (auto& page : self->pages) {
+        auto it = page.textures.find(context);
+        if (it != page.textures.end()) {
+            glDeleteTextures(1, &it->second.first);
+            page.textures.erase(it);
+        }
+    }
+}
@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <Inventor/SbVec2f.h>
+#include <Inventor/SbVec2s.h>
+#include <Inventor/C/glue/gl.h>
+
+class SoState;
+
+namespace Gui
+{
+
+/**
+ * The TextureAtlas class packs small RGBA images into a few shared textures.
+ *
+ * Nodes that draw many small textured quads, like the text of SoDatumLabel, add their image once
+ * under a key describing it. Equal images share one slot, and only the slots added since the
+ * last frame are uploaded to the textures. A node then binds the page of its slot and draws its
+ * quad with the returned texture coordinates.
+ *
+ * The textures are created for every OpenGL context they are used in.
+ */
+class TextureAtlas
+{
+public:
+    /// The atlas shared by all nodes
+    static TextureAtlas& instance();
+
+    /// Returns the slot of the image stored under \a key, adding \a rgba of \a size if needed
+    int acquire(const std::string& key, const unsigned char* rgba, const SbVec2s& size);
+    /// Releases a slot returned by acquire()
+    void release(int slot);
+
+    /// Binds the texture holding \a slot in the current context and returns its coordinates
+    bool bind(SoState* state, int slot, SbVec2f& texMin, SbVec2f& texMax);
+
+private:
+    TextureAtlas();
+    ~TextureAtlas();
+
+    struct Slot
+    {
+        int page {-1};
+        int x {0}, y {0};
+        int width {0}, height {0};
+        int cellWidth {0}, cellHeight {0};
+        int refs {0};
+        std::string key;
+    };
+
+    struct Shelf
+    {
+        int y;
+        int height;
+        int used;
+    };
+
+    struct Update
+    {
+        unsigned revision;
+        int x, y, width, height;
+    };
+
+    struct Page
+    {
+        int width {0}, height {0};
+        std::vector<unsigned char> pixels;
+        std::vector<Shelf> shelves;
+        int top {0};
+        int live {0};
+        unsigned revision {0};
+        std::vector<Update> updates;
+        // texture id and uploaded revision per context
+        std::map<uint32_t, std::pair<GLuint, unsigned>> textures;
+    };
+
+    int allocate(int width, int height);
+    bool allocateOnPage(int page, int width, int height, int& x, int& y);
+    static void upload(const Page& page, unsigned revision);
+
+    static void context_destruction_cb(uint32_t context, void* userdata);
+
+    std::vector<Page> pages;
+    std::vector<Slot> slots;
+    std::unordered_map<std::string, int> keys;
+};
+
+}  // namespace Gui
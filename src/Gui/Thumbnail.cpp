@@ -27,6 +27,8 @@
 #include <QDateTime>
 #include <QImage>
 #include <QThread>
+#include <Inventor/nodes/SoOrthographicCamera.h>
+#include <Inventor/nodes/SoPerspectiveCamera.h>
 
 
 #include <App/Application.h>
@@ -44,6 +46,31 @@
 
 using namespace Gui;
 
+namespace
+{
+// Returns the values of the camera that determine the rendered image
+std::vector<float> getCameraState(View3DInventorViewer* viewer)
+{
+    std::vector<float> state;
+    SoCamera* cam = viewer->getCamera();
+    if (!cam) {
+        return state;
+    }
+
+    float q0 {}, q1 {}, q2 {}, q3 {};
+    cam->orientation.getValue().getValue(q0, q1, q2, q3);
+    const SbVec3f& pos = cam->position.getValue();
+    state = {pos[0], pos[1], pos[2], q0, q1, q2, q3, cam->focalDistance.getValue()};
+    if (cam->isOfType(SoOrthographicCamera::getClassTypeId())) {
+        state.push_back(static_cast<SoOrthographicCamera*>(cam)->height.getValue());
+    }
+    else if (cam->isOfType(SoPerspectiveCamera::getClassTypeId())) {
+        state.push_back(static_cast<SoPerspectiveCamera*>(cam)->heightAngle.getValue());
+    }
+    return state;
+}
+}  // namespace
+
 Thumbnail::Thumbnail(int s)
     : size(s)
 {}
@@ -65,9 +92,60 @@ void Thumbnail::setFileName(const char* fn)
     this->uri = QUrl::fromLocalFile(QString::fromUtf8(fn));
 }
 
+QImage Thumbnail::renderImage() const
+{
+    QImage img;
+    QColor invalid;
+    this->viewer->imageFromFramebuffer(this->size, this->size, 4, invalid, img);
+    return img;
+}
+
+void Thumbnail::updateImage()
+{
+    if (!this->viewer || this->viewer->thread() != QThread::currentThread()) {
+        return;
+    }
+
+    QImage img = renderImage();
+    std::vector<float> camera = getCameraState(this->viewer);
+    std::lock_guard<std::mutex> lock(imageMutex);
+    image = img;
+    imageCamera = camera;
+}
+
+void Thumbnail::invalidateImage()
+{
+    std::lock_guard<std::mutex> lock(imageMutex);
+    image = QImage();
+    imageCamera.clear();
+}
+
+bool Thumbnail::hasImage() const
+{
+    std::lock_guard<std::mutex> lock(imageMutex);
+    return !image.isNull();
+}
+
+bool Thumbnail::getCachedImage(QImage& img) const
+{
+    std::lock_guard<std::mutex> lock(imageMutex);
+    if (image.isNull() || image.width() != this->size) {
+        return false;
+    }
+    // The camera can only be checked from the GUI thread. A save from another thread uses the
+    // kept image anyway because it couldn't render a new one.
+    if (this->viewer && this->viewer->thread() == QThread::currentThread()
+        && getCameraState(this->viewer) != imageCamera) {
+        return false;
+    }
+    img = image;
+    return true;
+}
+
 unsigned int Thumbnail::getMemSize() const
 {
-    return 0;
+    std::lock_guard<std::mutex> lock(imageMutex);
+    return static_cast<unsigned int>(image.sizeInBytes());
 }
 
 void Thumbnail::Save(Base::Writer& writer) const
@@ -87,16 +165,15 @@ void Thumbnail::Restore(Base::XMLReader& reader)
 void Thumbnail::SaveDocFile(Base::Writer& writer) const
 {
     QImage img;
-    bool created = false;
 
-    // 1. Try to create the thumbnail from the viewer
-    if (this->viewer) {
+    // 1. Use the image rendered at idle time or create the thumbnail from the viewer
+    bool created = getCachedImage(img);
+    if (!created && this->viewer) {
         if (this->viewer->thread() != QThread::currentThread()) {
             qWarning("Cannot create a thumbnail from non-GUI thread");
         }
         else {
-            QColor invalid;
-            this->viewer->imageFromFramebuffer(this->size, this->size, 4, invalid, img);
+            img = renderImage();
             created = !img.isNull();
         }
     }
@@ -133,7 +210,7 @@ void Thumbnail::SaveDocFile(Base::Writer& writer) const
     }
 
     // If we still have no image and no viewer to generate one, we can do nothing more
-    if (!this->viewer) {
+    if (!this->viewer && !created) {
         return;
     }
 
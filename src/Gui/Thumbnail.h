@@ -23,11 +23,12 @@
 
 #pragma once
 
+#include <mutex>
+#include <vector>
 #include <Base/Persistence.h>
+#include <QImage>
 #include <QUrl>
 
-class QImage;
-
 namespace Gui
 {
 class View3DInventorViewer;
@@ -42,6 +43,20 @@ public:
     void setSize(int);
     void setFileName(const char*);
 
+    /** @name Cached image
+     * Rendering the thumbnail at save time blocks the GUI for a noticeable time on large models.
+     * Therefore the document renders it when the application is idle after a change and keeps
+     * it. At save time the kept image is written unless the camera has been moved since.
+     */
+    //@{
+    /// Renders the image from the viewer and keeps it for the next save
+    void updateImage();
+    /// Drops the kept image, e.g. because the document has changed
+    void invalidateImage();
+    /// Returns true if an image is kept
+    bool hasImage() const;
+    //@}
+
     /** @name I/O of the document */
     //@{
     unsigned int getMemSize() const override;
@@ -55,10 +70,18 @@ public:
     void RestoreDocFile(Base::Reader& reader) override;
     //@}
 
+private:
+    QImage renderImage() const;
+    bool getCachedImage(QImage& img) const;
+
 private:
     QUrl uri;
     View3DInventorViewer* viewer {nullptr};
     int size;
+
+    mutable std::mutex imageMutex;
+    QImage image;
+    std::vector<float> imageCamera;
 };
 
 }  // namespace Gui
@@ -5393,6 +5393,7 @@ void DocumentItem::clearSelection(DocumentObjectItem* exclude)
     if (item == exclude) {
         if (item->selected > 0) {
             item->selected = -1;
+            SelectedItems.insert(item);
         }
         else {
             item->selected = 0;
@@ -5467,6 +5468,9 @@ void DocumentItem::updateItemSelection(DocumentObjectItem* item)
         item->mySubs.clear();
     }
     item->selected = selected;
+    if (selected) {
+        SelectedItems.insert(item);
+    }
 
     auto obj = item->object()->getObject();
     if (!obj || !obj->isAttachedToDocument()) {
@@ -5701,6 +5705,7 @@ DocumentObjectItem* DocumentItem::findItem(
     if (!subname || *subname == 0) {
         if (select) {
             item->selected += 2;
+            SelectedItems.insert(item);
             item->mySubs.clear();
         }
         return item;
@@ -5717,6 +5722,7 @@ DocumentObjectItem* DocumentItem::findItem(
     else {
         if (select) {
             item->selected += 2;
+            SelectedItems.insert(item);
             if (std::ranges::find(item->mySubs, subname) == item->mySubs.end()) {
                 item->mySubs.emplace_back(subname);
             }
@@ -5733,6 +5739,7 @@ DocumentObjectItem* DocumentItem::findItem(
         }
         if (select) {
             item->selected += 2;
+            SelectedItems.insert(item);
             if (std::ranges::find(item->mySubs, subname) == item->mySubs.end()) {
                 item->mySubs.emplace_back(subname);
             }
@@ -5784,6 +5791,7 @@ DocumentObjectItem* DocumentItem::findItem(
         // Select the current object instead.
         TREE_TRACE("element " << subname << " not found");
         item->selected += 2;
+        SelectedItems.insert(item);
         if (std::ranges::find(item->mySubs, subname) == item->mySubs.end()) {
             item->mySubs.emplace_back(subname);
         }
@@ -5805,41 +5813,49 @@ void DocumentItem::selectItems(SelectionReason reason)
     DocumentObjectItem* newSelect = nullptr;
     DocumentObjectItem* oldSelect = nullptr;
 
-    FOREACH_ITEM_ALL(item)
-    if (item->selected == 1) {
-        // this means it is the old selection and is not in the current
-        // selection
-        item->selected = 0;
-        item->mySubs.clear();
-        item->setSelected(false);
-        item->setCheckState(false);
-    }
-    else if (item->selected) {
-        if (sync) {
-            if (item->selected == 2 && showItem(item, false, reason == SR_FORCE_EXPAND)) {
-                // This means newly selected and can auto expand
-                if (!newSelect) {
-                    newSelect = item;
-                }
-            }
-            if (!newSelect && !oldSelect && !item->isHidden()) {
-                bool visible = true;
-                for (auto parent = item->parent(); parent; parent = parent->parent()) {
-                    if (!parent->isExpanded() || parent->isHidden()) {
-                        visible = false;
-                        break;
+    // Only the items of the old and the new selection have to be updated, which avoids walking
+    // all items of big documents
+    std::vector<DocumentObjectItem*> items(SelectedItems.begin(), SelectedItems.end());
+    SelectedItems.clear();
+    for (auto item : items) {
+        if (item->selected == 0) {
+            continue;
+        }
+        if (item->selected == 1) {
+            // this means it is the old selection and is not in the current
+            // selection
+            item->selected = 0;
+            item->mySubs.clear();
+            item->setSelected(false);
+            item->setCheckState(false);
+        }
+        else if (item->selected) {
+            if (sync) {
+                if (item->selected == 2 && showItem(item, false, reason == SR_FORCE_EXPAND)) {
+                    // This means newly selected and can auto expand
+                    if (!newSelect) {
+                        newSelect = item;
                     }
                 }
-                if (visible) {
-                    oldSelect = item;
+                if (!newSelect && !oldSelect && !item->isHidden()) {
+                    bool visible = true;
+                    for (auto parent = item->parent(); parent; parent = parent->parent()) {
+                        if (!parent->isExpanded() || parent->isHidden()) {
+                            visible = false;
+                            break;
+                        }
+                    }
+                    if (visible) {
+                        oldSelect = item;
+                    }
                 }
             }
+            item->selected = 1;
+            SelectedItems.insert(item);
+            item->setSelected(true);
+            item->setCheckState(true);
         }
-        item->selected = 1;
-        item->setSelected(true);
-        item->setCheckState(true);
     }
-    END_FOREACH_ITEM;
 
     if (sync) {
         if (!newSelect) {
@@ -6007,6 +6023,9 @@ DocumentObjectItem::~DocumentObjectItem()
     --countItems;
     TREE_LOG("Delete item: " << countItems << ", " << object()->getObject()->getFullName());
     myData->removeItem(this);
+    if (myOwner) {
+        myOwner->SelectedItems.erase(this);
+    }
 
     if (myData->rootItem == this) {
         myData->rootItem = nullptr;
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <unordered_map>
+#include <unordered_set>
 #include <QTimer>
 #include <QElapsedTimer>
 #include <QStyledItemDelegate>
@@ -430,6 +431,8 @@ private:
     std::unordered_map<App::DocumentObject*, DocumentObjectDataPtr> ObjectMap;
     std::unordered_map<App::DocumentObject*, std::set<App::DocumentObject*>> _ParentMap;
     std::vector<App::DocumentObject*> PopulateObjects;
+    // items with a non zero selection state, see selectItems()
+    std::unordered_set<DocumentObjectItem*> SelectedItems;
 
     ExpandInfoPtr _ExpandInfo;
     void restoreItemExpansion(const ExpandInfoPtr&, DocumentObjectItem*);
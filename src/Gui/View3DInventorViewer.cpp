@@ -35,6 +35,8 @@
 # include <GL/glu.h>
 #endif
 
+#include <algorithm>
+
 #include <fmt/format.h>
 
 #include <Inventor/SbBox.h>
@@ -42,6 +44,7 @@
 #include <Inventor/SoPickedPoint.h>
 #include <Inventor/actions/SoGetBoundingBoxAction.h>
 #include <Inventor/actions/SoGetMatrixAction.h>
+#include <Inventor/actions/SoGetPrimitiveCountAction.h>
 #include <Inventor/actions/SoHandleEventAction.h>
 #include <Inventor/actions/SoRayPickAction.h>
 #include <Inventor/annex/HardCopy/SoVectorizePSAction.h>
@@ -82,8 +85,10 @@
 #endif
 #include <QKeyEvent>
 #include <QMessageBox>
+#include <QElapsedTimer>
 #include <QMimeData>
 #include <QOpenGLFramebufferObject>
+#include <QOpenGLTimerQuery>
 #include <QOpenGLWidget>
 #include <QSurfaceFormat>
 #include <QTimer>
@@ -450,6 +455,13 @@ void View3DInventorViewer::init()
     shading = true;
     fpsEnabled = false;
     vboEnabled = false;
+    renderStatsEnabled = false;
+    gpuTimerPending = false;
+    cpuFrameTime = 0.0;
+    gpuFrameTime = -1.0;
+    interacting = false;
+    interactionDetail = SoFCInteractionDetailElement::Full;
+    interactionFrames = 0;
 
     attachSelection();
 
@@ -786,13 +798,15 @@ void View3DInventorViewer::createStandardCursors()
 
 void View3DInventorViewer::aboutToDestroyGLContext()
 {
-    if (naviCube) {
+    if (naviCube || gpuTimer) {
         if (auto gl = qobject_cast<QOpenGLWidget*>(this->viewport())) {
             gl->makeCurrent();
         }
         delete naviCube;
         naviCube = nullptr;
         naviCubeEnabled = false;
+        gpuTimer.reset();
+        gpuTimerPending = false;
     }
 }
 
@@ -1403,6 +1417,96 @@ void View3DInventorViewer::setEnabledFPSCounter(bool on)
     fpsEnabled = on;
 }
 
+void View3DInventorViewer::setEnabledRenderStats(bool on)
+{
+    renderStatsEnabled = on;
+    if (!on) {
+        gpuFrameTime = -1.0;
+    }
+    getSoRenderManager()->scheduleRedraw();
+}
+
+bool View3DInventorViewer::isEnabledRenderStats() const
+{
+    return renderStatsEnabled;
+}
+
+View3DInventorViewer::RenderStats View3DInventorViewer::getRenderStats(int topCount) const
+{
+    RenderStats stats;
+    stats.cpuTime = cpuFrameTime;
+    stats.gpuTime = gpuFrameTime;
+
+    const SbViewportRegion& vp = getSoRenderManager()->getViewportRegion();
+    SoGetPrimitiveCountAction action(vp);
+    action.apply(pcViewProviderRoot);
+    stats.triangles = action.getTriangleCount();
+    stats.lines = action.getLineCount();
+    stats.points = action.getPointCount();
+
+    for (auto viewProvider : _ViewProviderSet) {
+        if (!viewProvider->isShow() || !viewProvider->getRoot()) {
+            continue;
+        }
+        action.apply(viewProvider->getRoot());
+        if (action.getTriangleCount() > 0) {
+            stats.viewProviders.emplace_back(viewProvider, action.getTriangleCount());
+        }
+    }
+    std::size_t count = std::min<std::size_t>(std::max(topCount, 0), stats.viewProviders.size());
+    std::partial_sort(
+        stats.viewProviders.begin(),
+        stats.viewProviders.begin() + count,
+        stats.viewProviders.end(),
+        [](const auto& a, const auto& b) { return a.second > b.second; }
+    );
+    stats.viewProviders.resize(count);
+    return stats;
+}
+
+bool View3DInventorViewer::beginRenderStats()
+{
+    if (!renderStatsEnabled) {
+        if (gpuTimer) {
+            gpuTimer.reset();
+            gpuTimerPending = false;
+        }
+        return false;
+    }
+
+    // The result of a query is only read once it is available, so that the measurement never
+    // stalls the pipeline. Meanwhile, the following frames are not measured.
+    if (gpuTimerPending) {
+        if (!gpuTimer->isResultAvailable()) {
+            return false;
+        }
+        gpuFrameTime = double(gpuTimer->waitForResult()) / 1e6;
+        gpuTimerPending = false;
+    }
+    if (!gpuTimer) {
+        gpuTimer = std::make_unique<QOpenGLTimerQuery>();
+        gpuTimer->create();
+    }
+    if (!gpuTimer->isCreated()) {
+        // timer queries are not supported by the driver
+        return false;
+    }
+    gpuTimer->begin();
+    gpuTimerPending = true;
+    return true;
+}
+
+void View3DInventorViewer::endRenderStats(double cpuTime, bool gpuTimerStarted)
+{
+    if (!renderStatsEnabled) {
+        return;
+    }
+    cpuFrameTime = cpuTime;
+    if (gpuTimerStarted) {
+        gpuTimer->end();
+    }
+}
+
 void View3DInventorViewer::setEnabledVBO(bool on)
 {
     vboEnabled = on;
@@ -2082,19 +2186,47 @@ void View3DInventorViewer::interactionStartCB(void* ud, SoQTQuarterAdaptor* view
     Q_UNUSED(ud)
     SoGLRenderAction* glra = viewer->getSoRenderManager()->getGLRenderAction();
     SoFCInteractiveElement::set(glra->getState(), viewer->getSceneGraph(), true);
+    auto self = static_cast<View3DInventorViewer*>(viewer);
+    self->interacting = true;
+    self->interactionFrames = 0;
 }
 
 /**
- * Sets the SoFCInteractiveElement to \a false and forces a redraw.
+ * Sets the SoFCInteractiveElement to \a false, restores the full detail and forces a redraw.
  */
 void View3DInventorViewer::interactionFinishCB(void* ud, SoQTQuarterAdaptor* viewer)
 {
     Q_UNUSED(ud)
     SoGLRenderAction* glra = viewer->getSoRenderManager()->getGLRenderAction();
     SoFCInteractiveElement::set(glra->getState(), viewer->getSceneGraph(), false);
+    auto self = static_cast<View3DInventorViewer*>(viewer);
+    self->interacting = false;
+    self->interactionDetail = SoFCInteractionDetailElement::Full;
     viewer->redraw();
 }
 
+/**
+ * Lowers the detail of the shapes by one step while the camera moves and a frame takes longer
+ * than the InteractionFrameBudget parameter in ms. A frame right after a change rebuilds the
+ * render caches, so it is not taken into account.
+ */
+void View3DInventorViewer::updateInteractionDetail(double cpuTime)
+{
+    if (!interacting || interactionDetail >= SoFCInteractionDetailElement::Minimal
+        || !ViewParams::instance()->getAdaptiveInteraction()) {
+        return;
+    }
+    if (++interactionFrames < 2) {
+        return;
+    }
+    // the GPU time of the previous frame is only known with the render statistics
+    double frameTime = std::max(cpuTime, gpuFrameTime);
+    if (frameTime > ViewParams::instance()->getInteractionFrameBudget()) {
+        ++interactionDetail;
+        interactionFrames = 0;
+    }
+}
+
 /**
  * Logs the type of the action that traverses the Inventor tree.
  */
@@ -2501,6 +2633,10 @@ void View3DInventorViewer::renderScene()
 {
     ZoneScoped;
 
+    QElapsedTimer frameTimer;
+    frameTimer.start();
+    bool gpuTimerStarted = beginRenderStats();
+
     // Must set up the OpenGL viewport manually, as upon resize
     // operations, Coin won't set it up until the SoGLRenderAction is
     // applied again. And since we need to do glClear() before applying
@@ -2530,6 +2666,10 @@ void View3DInventorViewer::renderScene()
         SoGLWidgetElement::set(state, qobject_cast<QOpenGLWidget*>(this->getGLWidget()));
         SoGLRenderActionElement::set(state, glra);
         SoGLVBOActivatedElement::set(state, this->vboEnabled);
+        SoFCInteractionDetailElement::set(
+            state,
+            static_cast<SoFCInteractionDetailElement::Detail>(interactionDetail)
+        );
         drawSingleBackground(col);
         glra->apply(this->backgroundroot);
     }
@@ -2611,6 +2751,27 @@ void View3DInventorViewer::renderScene()
         }
     }
 
+    double cpuTime = double(frameTimer.nsecsElapsed()) / 1e6;
+    endRenderStats(cpuTime, gpuTimerStarted);
+    updateInteractionDetail(cpuTime);
+    if (renderStatsEnabled) {
+        std::stringstream stream;
+        stream.precision(1);
+        stream.setf(std::ios::fixed | std::ios::showpoint);
+        stream << "cpu " << cpuFrameTime << " ms";
+        if (gpuFrameTime >= 0.0) {
+            stream << " / gpu " << gpuFrameTime << " ms";
+        }
+        // one line above the fps counter
+        SbVec2s size = vp.getViewportSizePixels();
+        draw2DString(
+            stream.str().c_str(),
+            size,
+            SbVec2f(0.01F * size[0], 0.01F * size[1] + 16.0F),
+            Base::Color(1.0F, 1.0F, 0.0F)
+        );
+    }
+
     // fps rendering
     if (fpsEnabled) {
         std::stringstream stream;
@@ -59,6 +59,7 @@
 #include "Quarter/SoQTQuarterAdaptor.h"
 
 class QOpenGLFramebufferObject;
+class QOpenGLTimerQuery;
 class QOpenGLWidget;
 class QSurfaceFormat;
 
@@ -493,6 +494,23 @@ public:
     void changeRotationCenterPosition(const SbVec3f& newCenter);
 
     void setEnabledFPSCounter(bool on);
+
+    /// Statistics of the rendering, see getRenderStats()
+    struct RenderStats
+    {
+        double cpuTime = 0.0;   // ms spent in the last frame
+        double gpuTime = -1.0;  // ms measured by a GL timer query, negative if not available
+        uint32_t triangles = 0;
+        uint32_t lines = 0;
+        uint32_t points = 0;
+        // the view providers with the most triangles, in descending order
+        std::vector<std::pair<ViewProvider*, uint32_t>> viewProviders;
+    };
+    /// Measures the frame times and shows them in an overlay
+    void setEnabledRenderStats(bool on);
+    bool isEnabledRenderStats() const;
+    /// Counts the primitives of the scene, which traverses it, and returns the frame times
+    RenderStats getRenderStats(int topCount = 10) const;
     void setEnabledNaviCube(bool on);
     bool isEnabledNaviCube() const;
     void setNaviCubeCorner(int);
@@ -522,6 +540,9 @@ protected:
     void renderGLImage();
     void animatedViewAll(int steps, int ms);
     void actualRedraw() override;
+    bool beginRenderStats();
+    void endRenderStats(double cpuTime, bool gpuTimerStarted);
+    void updateInteractionDetail(double cpuTime);
     void setSeekMode(bool on) override;
     void afterRealizeHook() override;
     bool processSoEvent(const SoEvent* ev) override;
@@ -603,6 +624,16 @@ private:
 
     // stuff needed to draw the fps counter
     bool fpsEnabled;
+    // frame time measurement
+    bool renderStatsEnabled;
+    bool gpuTimerPending;
+    double cpuFrameTime;
+    double gpuFrameTime;
+    std::unique_ptr<QOpenGLTimerQuery> gpuTimer;
+    // detail of the shapes while the camera moves, see SoFCInteractionDetailElement
+    bool interacting;
+    int interactionDetail;
+    int interactionFrames;
     bool vboEnabled;
     bool naviCubeEnabled;
 
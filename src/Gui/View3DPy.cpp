@@ -286,6 +286,19 @@ void View3DInventorPy::init_type()
         &View3DInventorPy::hasAxisCross,
         "check if the big axis-cross is on or off()"
     );
+    add_varargs_method(
+        "setRenderStats",
+        &View3DInventorPy::setRenderStats,
+        "setRenderStats(bool)\n"
+        "Measure the CPU and GPU time of each frame and show them in an overlay"
+    );
+    add_varargs_method(
+        "getRenderStats",
+        &View3DInventorPy::getRenderStats,
+        "getRenderStats([top=10]) -> dict\n"
+        "Returns the frame times in ms, the primitive counts of the scene and the\n"
+        "view providers with the most triangles"
+    );
     add_varargs_method(
         "addDraggerCallback",
         &View3DInventorPy::addDraggerCallback,
@@ -2541,6 +2554,48 @@ Py::Object View3DInventorPy::hasAxisCross()
     return Py::Boolean(ok ? true : false);
 }
 
+Py::Object View3DInventorPy::setRenderStats(const Py::Tuple& args)
+{
+    PyObject* on;
+    if (!PyArg_ParseTuple(args.ptr(), "O!", &PyBool_Type, &on)) {
+        throw Py::Exception();
+    }
+    getView3DInventorPtr()->getViewer()->setEnabledRenderStats(Base::asBoolean(on));
+    return Py::None();
+}
+
+Py::Object View3DInventorPy::getRenderStats(const Py::Tuple& args)
+{
+    int top = 10;
+    if (!PyArg_ParseTuple(args.ptr(), "|i", &top)) {
+        throw Py::Exception();
+    }
+
+    auto viewer = getView3DInventorPtr()->getViewer();
+    auto stats = viewer->getRenderStats(top);
+    Py::Dict dict;
+    dict.setItem("Enabled", Py::Boolean(viewer->isEnabledRenderStats()));
+    dict.setItem("CpuTime", Py::Float(stats.cpuTime));
+    if (stats.gpuTime >= 0.0) {
+        dict.setItem("GpuTime", Py::Float(stats.gpuTime));
+    }
+    else {
+        dict.setItem("GpuTime", Py::None());
+    }
+    dict.setItem("Triangles", Py::Long(static_cast<unsigned long>(stats.triangles)));
+    dict.setItem("Lines", Py::Long(static_cast<unsigned long>(stats.lines)));
+    dict.setItem("Points", Py::Long(static_cast<unsigned long>(stats.points)));
+    Py::List list;
+    for (const auto& it : stats.viewProviders) {
+        Py::Tuple item(2);
+        item.setItem(0, Py::asObject(it.first->getPyObject()));
+        item.setItem(1, Py::Long(static_cast<unsigned long>(it.second)));
+        list.append(item);
+    }
+    dict.setItem("ViewProviders", list);
+    return dict;
+}
+
 void View3DInventorPy::draggerCallback(void* ud, SoDragger* n)
 {
     Base::PyGILStateLocker lock;
@@ -50,6 +50,9 @@ public:
     FC_VIEW_PARAM(UseSelectionRoot, bool, Bool, true) \
     FC_VIEW_PARAM(EnableSelection, bool, Bool, true) \
     FC_VIEW_PARAM(RenderCache, int, Int, 0) \
+    FC_VIEW_PARAM(RenderCulling, bool, Bool, true) \
+    FC_VIEW_PARAM(AdaptiveInteraction, bool, Bool, true) \
+    FC_VIEW_PARAM(InteractionFrameBudget, double, Float, 40.0) \
     FC_VIEW_PARAM(RandomColor, bool, Bool, false) \
     FC_VIEW_PARAM(BoundingBoxColor, unsigned long, Unsigned, 4294967295UL) \
     FC_VIEW_PARAM(AnnotationTextColor, unsigned long, Unsigned, 4294967295UL) \
@@ -22,16 +22,31 @@
 
 #include <boost_graph_adjacency_list.hpp>
 #include <boost/graph/topological_sort.hpp>
+#include <algorithm>
+#include <limits>
+#include <set>
 
 #include <QApplication>
 #include <QKeyEvent>
 #include <QTimer>
 #include <Inventor/SoPickedPoint.h>
 #include <Inventor/actions/SoGetBoundingBoxAction.h>
+#include <Inventor/actions/SoSearchAction.h>
 #include <Inventor/details/SoDetail.h>
 #include <Inventor/events/SoKeyboardEvent.h>
 #include <Inventor/events/SoLocation2Event.h>
 #include <Inventor/events/SoMouseButtonEvent.h>
+#include <Inventor/fields/SoMFColor.h>
+#include <Inventor/fields/SoMFRotation.h>
+#include <Inventor/fields/SoMFShort.h>
+#include <Inventor/fields/SoMFUShort.h>
+#include <Inventor/fields/SoMFVec2f.h>
+#include <Inventor/fields/SoMFVec3f.h>
+#include <Inventor/fields/SoMFVec4f.h>
+#include <Inventor/fields/SoSFImage.h>
+#include <Inventor/lists/SoFieldList.h>
+#include <Inventor/lists/SoPathList.h>
+#include <Inventor/SoFullPath.h>
 #include <Inventor/nodes/SoSeparator.h>
 #include <Inventor/nodes/SoSwitch.h>
 #include <Inventor/nodes/SoTransform.h>
@@ -143,6 +158,82 @@ ViewProvider::~ViewProvider()
     }
 }
 
+namespace
+{
+// Estimates the memory of the data held by the fields of a node. Only the multi-value fields
+// and images are taken into account because they hold the tessellation and the textures.
+std::size_t getFieldMemSize(const SoField* field)
+{
+    if (field->isOfType(SoSFImage::getClassTypeId())) {
+        SbVec2s size;
+        int nc = 0;
+        static_cast<const SoSFImage*>(field)->getValue(size, nc);
+        return std::size_t(std::max<short>(size[0], 0)) * std::size_t(std::max<short>(size[1], 0))
+            * std::size_t(std::max(nc, 0));
+    }
+    if (!field->isOfType(SoMField::getClassTypeId())) {
+        return 0;
+    }
+
+    std::size_t num = std::max(static_cast<const SoMField*>(field)->getNum(), 0);
+    if (field->isOfType(SoMFVec4f::getClassTypeId())
+        || field->isOfType(SoMFRotation::getClassTypeId())) {
+        return num * 4 * sizeof(float);
+    }
+    if (field->isOfType(SoMFVec3f::getClassTypeId())
+        || field->isOfType(SoMFColor::getClassTypeId())) {
+        return num * 3 * sizeof(float);
+    }
+    if (field->isOfType(SoMFVec2f::getClassTypeId())) {
+        return num * 2 * sizeof(float);
+    }
+    if (field->isOfType(SoMFShort::getClassTypeId())
+        || field->isOfType(SoMFUShort::getClassTypeId())) {
+        return num * sizeof(short);
+    }
+    // Int32, UInt32, Float and the like
+    return num * sizeof(int32_t);
+}
+
+std::size_t getSceneMemSize(SoNode* root)
+{
+    SoSearchAction sa;
+    sa.setType(SoNode::getClassTypeId());
+    sa.setInterest(SoSearchAction::ALL);
+    sa.setSearchingAll(true);
+    sa.apply(root);
+
+    // Nodes may be shared, e.g. by links, so count each one once
+    std::set<SoNode*> nodes;
+    std::size_t size = 0;
+    const SoPathList& paths = sa.getPaths();
+    for (int i = 0; i < paths.getLength(); ++i) {
+        SoNode* node = static_cast<SoFullPath*>(paths[i])->getTail();
+        if (!nodes.insert(node).second) {
+            continue;
+        }
+
+        SoFieldList fields;
+        int count = node->getFields(fields);
+        for (int j = 0; j < count; ++j) {
+            size += getFieldMemSize(fields[j]);
+        }
+    }
+    return size;
+}
+}  // namespace
+
+unsigned int ViewProvider::getMemSize() const
+{
+    std::size_t size = TransactionalObject::getMemSize();
+    if (pcRoot) {
+        size += getSceneMemSize(pcRoot);
+    }
+    return static_cast<unsigned int>(
+        std::min<std::size_t>(size, std::numeric_limits<unsigned int>::max())
+    );
+}
+
 ViewProvider* ViewProvider::startEditing(int ModNum)
 {
     try {
@@ -143,6 +143,9 @@ public:
     /// destructor.
     ~ViewProvider() override;
 
+    /// Returns the memory of the properties and an estimate of the memory of the scene graph
+    unsigned int getMemSize() const override;
+
     // returns the root node of the Provider (3D)
     virtual SoSeparator* getRoot() const
     {
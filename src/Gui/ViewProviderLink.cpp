@@ -42,6 +42,7 @@
 #include <Inventor/nodes/SoAnnotation.h>
 #include <Inventor/nodes/SoCube.h>
 #include <Inventor/nodes/SoDrawStyle.h>
+#include <Inventor/nodes/SoMatrixTransform.h>
 #include <Inventor/nodes/SoPickStyle.h>
 #include <Inventor/nodes/SoSeparator.h>
 #include <Inventor/nodes/SoShapeHints.h>
@@ -982,7 +983,9 @@ public:
     LinkView& handle;
     CoinPtr<SoSwitch> pcSwitch;
     CoinPtr<SoFCSelectionRoot> pcRoot;
-    CoinPtr<SoTransform> pcTransform;
+    // A plain matrix is all an array element needs. Unlike SoTransform it is neither decomposed
+    // on assignment nor recomposed on every traversal, which adds up for large arrays.
+    CoinPtr<SoMatrixTransform> pcTransform;
     int groupIndex = -1;
     bool isGroup = false;
 
@@ -991,7 +994,7 @@ public:
     Element(LinkView& handle)
         : handle(handle)
     {
-        pcTransform = new SoTransform;
+        pcTransform = new SoMatrixTransform;
         pcRoot = new SoFCSelectionRoot(true);
         pcSwitch = new SoSwitch;
         pcSwitch->addChild(pcRoot);
@@ -1264,6 +1267,22 @@ void LinkView::setTransform(SoTransform* pcTransform, const Base::Matrix4D& mat)
     ));
 }
 
+void LinkView::setTransform(SoMatrixTransform* pcTransform, const Base::Matrix4D& mat)
+{
+    double dMtrx[16];
+    mat.getGLMatrix(dMtrx);
+    SbMatrix matrix;
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            matrix[i][j] = static_cast<float>(dMtrx[i * 4 + j]);
+        }
+    }
+    // avoid notifying the scene graph for unchanged placements of array elements
+    if (pcTransform->matrix.getValue() != matrix) {
+        pcTransform->matrix.setValue(matrix);
+    }
+}
+
 void LinkView::setSize(int _size)
 {
     size_t size = _size < 0 ? 0 : (size_t)_size;
@@ -1271,6 +1290,8 @@ void LinkView::setSize(int _size)
         return;
     }
     resetRoot();
+    // Adding a child notifies all parents of the root, do it only once for the whole array
+    SbBool autonotify = pcLinkRoot->enableNotify(FALSE);
     if (!size || childType >= 0) {
         nodeArray.clear();
         nodeMap.clear();
@@ -1278,6 +1299,8 @@ void LinkView::setSize(int _size)
             if (pcLinkedRoot) {
                 pcLinkRoot->addChild(pcLinkedRoot);
             }
+            pcLinkRoot->enableNotify(autonotify);
+            pcLinkRoot->touch();
             return;
         }
         childType = SnapshotContainer;
@@ -1302,6 +1325,8 @@ void LinkView::setSize(int _size)
         pcLinkRoot->addChild(info.pcSwitch);
         nodeMap.emplace(info.pcSwitch, (int)nodeArray.size() - 1);
     }
+    pcLinkRoot->enableNotify(autonotify);
+    pcLinkRoot->touch();
 }
 
 void LinkView::resetRoot()
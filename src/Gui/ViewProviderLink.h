@@ -38,6 +38,7 @@
 class SoBase;
 class SoDragger;
 class SoMaterialBinding;
+class SoMatrixTransform;
 class SoPickStyle;
 
 namespace Gui
@@ -145,6 +146,7 @@ public:
     }
 
     static void setTransform(SoTransform* pcTransform, const Base::Matrix4D& mat);
+    static void setTransform(SoMatrixTransform* pcTransform, const Base::Matrix4D& mat);
 
     enum SnapshotType
     {
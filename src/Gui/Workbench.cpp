@@ -784,6 +784,7 @@ MenuItem* StdWorkbench::setupMenuBar() const
           << "Std_ExportDependencyGraph"
           << "Separator"
           << "Std_ProjectUtil"
+          << "Std_MemoryReport"
           << "Std_DlgParameter"
           << "Std_DlgCustomize";
 
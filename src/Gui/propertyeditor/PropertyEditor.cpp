@@ -746,6 +746,14 @@ void PropertyEditor::updateProperty(const App::Property& prop)
     blockCollapseAll();
 }
 
+void PropertyEditor::updateProperties(const std::vector<const App::Property*>& props)
+{
+    if (!committing) {
+        propertyModel->updateProperties(props);
+    }
+    blockCollapseAll();
+}
+
 void PropertyEditor::setEditorMode(const QModelIndex& parent, int start, int end)
 {
     int column = 1;
@@ -87,6 +87,7 @@ public:
     );
     void blockCollapseAll();
     void updateProperty(const App::Property&);
+    void updateProperties(const std::vector<const App::Property*>&);
     void removeProperty(const App::Property&);
     void renameProperty(const App::Property&);
     void setAutomaticDocumentUpdate(bool);
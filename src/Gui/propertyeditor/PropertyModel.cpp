@@ -22,6 +22,7 @@
  ***************************************************************************/
 
 #include <limits>
+#include <unordered_set>
 #include <boost/algorithm/string/predicate.hpp>
 
 #include <Base/Tools.h>
@@ -503,8 +504,27 @@ void PropertyModel::updateProperty(const App::Property& prop)
         return;
     }
 
+    updateItem(it->second, prop);
+}
+
+void PropertyModel::updateProperties(const std::vector<const App::Property*>& props)
+{
+    // An item shows the same property of all selected objects, so refresh it only once
+    std::unordered_set<PropertyItem*> updated;
+    for (auto prop : props) {
+        auto it = itemMap.find(const_cast<App::Property*>(prop));
+        if (it == itemMap.end() || !it->second || !it->second->parent()) {
+            continue;
+        }
+        if (updated.insert(it->second).second) {
+            updateItem(it->second, *prop);
+        }
+    }
+}
+
+void PropertyModel::updateItem(PropertyItem* item, const App::Property& prop)
+{
     int column = 1;
-    PropertyItem* item = it->second;
     item->updateData();
     QModelIndex parent = this->index(item->parent()->row(), 0, QModelIndex());
     item->assignProperty(&prop);
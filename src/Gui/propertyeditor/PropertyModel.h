@@ -71,6 +71,8 @@ public:
     bool removeRows(int row, int count, const QModelIndex& parent = QModelIndex()) override;
 
     void updateProperty(const App::Property&);
+    /// Refreshes the rows of the given properties, each row at most once
+    void updateProperties(const std::vector<const App::Property*>&);
     void appendProperty(const App::Property&);
     void removeProperty(const App::Property&);
     void renameProperty(const App::Property&);
@@ -81,6 +83,7 @@ public:
 private:
     void resetGroups();
     void initGroups();
+    void updateItem(PropertyItem* item, const App::Property& prop);
     void updateChildren(PropertyItem* item, int column, const QModelIndex& parent);
     void findOrCreateChildren(const PropertyList& props);
     void insertOrMoveChildren();
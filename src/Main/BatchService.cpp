@@ -0,0 +1,388 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include "../FCConfig.h"
+
+#include <string>
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonValue>
+
+#include <Base/Console.h>
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
+#include <Base/Interpreter.h>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/DocumentObject.h>
+#include <App/FeaturePythonPool.h>
+#include <App/Property.h>
+
+#include "BatchService.h"
+
+
+namespace
+{
+std::string toStdString(const QJsonValue& value)
+{
+    return value.toString().toStdString();
+}
+
+App::Document* getDocument(const QJsonObject& request)
+{
+    App::Document* doc = nullptr;
+    if (request.contains(QLatin1String("document"))) {
+        std::string name = toStdString(request[QLatin1String("document")]);
+        doc = App::GetApplication().getDocument(name.c_str());
+        if (!doc) {
+            throw Base::ValueError("Unknown document '" + name + "'");
+        }
+    }
+    else {
+        doc = App::GetApplication().getActiveDocument();
+        if (!doc) {
+            throw Base::ValueError("No active document");
+        }
+    }
+    return doc;
+}
+
+App::DocumentObject* getObject(App::Document* doc, const QJsonValue& value)
+{
+    std::string name = toStdString(value);
+    auto obj = doc->getObject(name.c_str());
+    if (!obj) {
+        throw Base::ValueError(
+            "Unknown object '" + name + "' in document '" + doc->getName() + "'"
+        );
+    }
+    return obj;
+}
+
+std::string getFileName(const QJsonObject& request)
+{
+    std::string file = toStdString(request[QLatin1String("file")]);
+    if (file.empty()) {
+        throw Base::ValueError("Missing 'file' member");
+    }
+    return file;
+}
+
+Py::Object importModule(const std::string& name)
+{
+    PyObject* module = PyImport_ImportModule(name.c_str());
+    if (!module) {
+        throw Py::Exception();
+    }
+    return Py::asObject(module);
+}
+
+Py::Object toPython(const QJsonValue& value)
+{
+    // wrap the value into an array to also support scalar values
+    QJsonArray array;
+    array.append(value);
+    QByteArray text = QJsonDocument(array).toJson(QJsonDocument::Compact);
+    Py::Object json = importModule("json");
+    Py::Tuple args(1);
+    args.setItem(0, Py::String(text.constData()));
+    Py::List list(Py::Callable(json.getAttr("loads")).apply(args));
+    return list[0];
+}
+}  // namespace
+
+BatchService::BatchService(std::istream& in, std::ostream& out)
+    : in(in)
+    , out(out)
+{}
+
+int BatchService::run()
+{
+    {
+        // stdout is reserved for the replies
+        Base::Console().setEnabledMsgType("Console", Base::ConsoleSingleton::MsgType_Txt, false);
+        Base::PyGILStateLocker lock;
+        Base::Interpreter().runString("import sys\nsys.stdout = sys.stderr");
+    }
+
+    std::string line;
+    while (!quit && std::getline(in, line)) {
+        if (line.find_first_not_of(" \t\r") == std::string::npos) {
+            continue;
+        }
+
+        QJsonParseError error {};
+        QJsonDocument json = QJsonDocument::fromJson(QByteArray::fromStdString(line), &error);
+        if (!json.isObject()) {
+            QJsonObject response;
+            response[QLatin1String("ok")] = false;
+            response[QLatin1String("error")] = error.error != QJsonParseError::NoError
+                ? error.errorString()
+                : QStringLiteral("Request is not a JSON object");
+            reply(response);
+            continue;
+        }
+
+        QJsonObject request = json.object();
+        QJsonObject response;
+        try {
+            response = process(request);
+            response[QLatin1String("ok")] = true;
+        }
+        catch (const Base::SystemExitException& e) {
+            quit = true;
+            exitCode = static_cast<int>(e.getExitCode());
+            response[QLatin1String("ok")] = true;
+        }
+        catch (const Base::Exception& e) {
+            response[QLatin1String("ok")] = false;
+            response[QLatin1String("error")] = QString::fromUtf8(e.what());
+        }
+        catch (Py::Exception&) {
+            Base::PyGILStateLocker lock;
+            Base::PyException e;
+            response[QLatin1String("ok")] = false;
+            response[QLatin1String("error")] = QString::fromUtf8(e.what());
+        }
+        catch (const std::exception& e) {
+            response[QLatin1String("ok")] = false;
+            response[QLatin1String("error")] = QString::fromUtf8(e.what());
+        }
+        catch (...) {
+            response[QLatin1String("ok")] = false;
+            response[QLatin1String("error")] = QStringLiteral("Unknown exception");
+        }
+        if (request.contains(QLatin1String("id"))) {
+            response[QLatin1String("id")] = request[QLatin1String("id")];
+        }
+        reply(response);
+    }
+
+    return exitCode;
+}
+
+QJsonObject BatchService::process(const QJsonObject& request)
+{
+    std::string command = toStdString(request[QLatin1String("command")]);
+    if (command == "open") {
+        return openDocument(request);
+    }
+    if (command == "close") {
+        return closeDocument(request);
+    }
+    if (command == "import") {
+        return importModules(request);
+    }
+    if (command == "set") {
+        return setProperty(request);
+    }
+    if (command == "recompute") {
+        return recompute(request);
+    }
+    if (command == "export") {
+        return exportObjects(request);
+    }
+    if (command == "save") {
+        return saveDocument(request);
+    }
+    if (command == "run") {
+        return runScript(request);
+    }
+    if (command == "execute") {
+        return executeObject(request);
+    }
+    if (command == "quit") {
+        quit = true;
+        exitCode = request[QLatin1String("code")].toInt();
+        return {};
+    }
+    throw Base::ValueError("Unknown command '" + command + "'");
+}
+
+QJsonObject BatchService::openDocument(const QJsonObject& request)
+{
+    std::string file = getFileName(request);
+    if (request[QLatin1String("reload")].toBool()) {
+        // The document may be open from a previous job with modified properties
+        std::string path = Base::FileInfo(file).filePath();
+        for (auto doc : App::GetApplication().getDocuments()) {
+            if (Base::FileInfo(doc->FileName.getValue()).filePath() == path) {
+                App::GetApplication().closeDocument(doc->getName());
+                break;
+            }
+        }
+    }
+
+    App::Document* doc = App::GetApplication().openDocument(file.c_str());
+    if (!doc) {
+        throw Base::FileException("Cannot open document", file);
+    }
+    App::GetApplication().setActiveDocument(doc);
+
+    QJsonObject response;
+    response[QLatin1String("document")] = QString::fromUtf8(doc->getName());
+    return response;
+}
+
+QJsonObject BatchService::closeDocument(const QJsonObject& request)
+{
+    if (request[QLatin1String("all")].toBool()) {
+        App::GetApplication().closeAllDocuments();
+    }
+    else {
+        App::GetApplication().closeDocument(getDocument(request));
+    }
+    return {};
+}
+
+QJsonObject BatchService::importModules(const QJsonObject& request)
+{
+    Base::PyGILStateLocker lock;
+    for (const auto& module : request[QLatin1String("modules")].toArray()) {
+        importModule(toStdString(module));
+    }
+    return {};
+}
+
+QJsonObject BatchService::setProperty(const QJsonObject& request)
+{
+    App::Document* doc = getDocument(request);
+    App::DocumentObject* obj = getObject(doc, request[QLatin1String("object")]);
+    std::string name = toStdString(request[QLatin1String("property")]);
+    App::Property* prop = obj->getPropertyByName(name.c_str());
+    if (!prop) {
+        throw Base::AttributeError(
+            "Object '" + std::string(obj->getNameInDocument()) + "' has no property '" + name + "'"
+        );
+    }
+
+    Base::PyGILStateLocker lock;
+    prop->setPyObject(toPython(request[QLatin1String("value")]).ptr());
+    return {};
+}
+
+QJsonObject BatchService::recompute(const QJsonObject& request)
+{
+    App::Document* doc = getDocument(request);
+    int count = doc->recompute();
+
+    QJsonArray errors;
+    for (auto obj : doc->getObjects()) {
+        if (obj->isError()) {
+            QJsonObject error;
+            error[QLatin1String("object")] = QString::fromUtf8(obj->getNameInDocument());
+            error[QLatin1String("message")] = QString::fromUtf8(obj->getStatusString());
+            errors.append(error);
+        }
+    }
+
+    QJsonObject response;
+    response[QLatin1String("recomputed")] = count;
+    response[QLatin1String("errors")] = errors;
+    return response;
+}
+
+QJsonObject BatchService::exportObjects(const QJsonObject& request)
+{
+    App::Document* doc = getDocument(request);
+    std::string file = getFileName(request);
+
+    std::vector<App::DocumentObject*> objs;
+    if (request.contains(QLatin1String("objects"))) {
+        for (const auto& name : request[QLatin1String("objects")].toArray()) {
+            objs.push_back(getObject(doc, name));
+        }
+    }
+    else {
+        objs = doc->getRootObjects();
+    }
+
+    Base::FileInfo fi(file);
+    std::vector<std::string> mods = App::GetApplication().getExportModules(fi.extension());
+    if (mods.empty()) {
+        throw Base::FileException("File format not supported", file);
+    }
+
+    Base::PyGILStateLocker lock;
+    Py::List list;
+    for (auto obj : objs) {
+        list.append(Py::asObject(obj->getPyObject()));
+    }
+    Py::Tuple args(2);
+    args.setItem(0, list);
+    args.setItem(1, Py::String(file));
+    Py::Object module = importModule(mods.front());
+    Py::Callable(module.getAttr("export")).apply(args);
+    return {};
+}
+
+QJsonObject BatchService::saveDocument(const QJsonObject& request)
+{
+    App::Document* doc = getDocument(request);
+    bool ok = false;
+    if (request.contains(QLatin1String("file"))) {
+        ok = doc->saveAs(getFileName(request).c_str());
+    }
+    else {
+        ok = doc->save();
+    }
+    if (!ok) {
+        throw Base::FileException("Failed to save document", std::string(doc->FileName.getValue()));
+    }
+    return {};
+}
+
+QJsonObject BatchService::runScript(const QJsonObject& request)
+{
+    std::string script = toStdString(request[QLatin1String("script")]);
+    Base::Interpreter().runString(script.c_str());
+    return {};
+}
+
+QJsonObject BatchService::executeObject(const QJsonObject& request)
+{
+    std::string name = toStdString(request[QLatin1String("object")]);
+    QByteArray data = QByteArray::fromBase64(request[QLatin1String("data")].toString().toLatin1());
+
+    std::string error;
+    std::string result = App::FeaturePythonPool::executeJob(name, data.toStdString(), error);
+
+    QJsonObject response;
+    if (!error.empty()) {
+        response[QLatin1String("executeError")] = QString::fromStdString(error);
+    }
+    else {
+        response[QLatin1String("data")] =
+            QString::fromLatin1(QByteArray::fromStdString(result).toBase64());
+    }
+    return response;
+}
+
+void BatchService::reply(const QJsonObject& response)
+{
+    out << QJsonDocument(response).toJson(QJsonDocument::Compact).constData() << std::endl;
+}
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#pragma once
+
+#include <istream>
+#include <ostream>
+
+class QJsonObject;
+
+/** Long-running request loop of FreeCADCmd
+ *
+ * Started with 'FreeCADCmd --service'. Requests are read from \a in as one
+ * JSON object per line, and for each of them a single line JSON reply is
+ * written to \a out:
+ *
+ * @code
+ * {"id": 1, "command": "open", "file": "/path/part.FCStd"}
+ * {"id": 1, "ok": true, "document": "part"}
+ * @endcode
+ *
+ * The application, the imported modules and the opened documents stay alive
+ * between requests, so that a job queue only pays for the start-up once.
+ * Several documents can be kept open at the same time and are addressed by
+ * the "document" member of the request. The supported commands are "open",
+ * "close", "import", "set", "recompute", "export", "save", "run" and "quit".
+ *
+ * The command "execute" is used by App::FeaturePythonPool to run the
+ * recompute of a Python feature in a worker process.
+ */
+class BatchService
+{
+public:
+    BatchService(std::istream& in, std::ostream& out);
+
+    /// Process requests until "quit" or the end of the input, returns the exit code
+    int run();
+
+private:
+    QJsonObject process(const QJsonObject& request);
+
+    QJsonObject openDocument(const QJsonObject& request);
+    QJsonObject closeDocument(const QJsonObject& request);
+    QJsonObject importModules(const QJsonObject& request);
+    QJsonObject setProperty(const QJsonObject& request);
+    QJsonObject recompute(const QJsonObject& request);
+    QJsonObject exportObjects(const QJsonObject& request);
+    QJsonObject saveDocument(const QJsonObject& request);
+    QJsonObject runScript(const QJsonObject& request);
+    QJsonObject executeObject(const QJsonObject& request);
+
+    void reply(const QJsonObject& response);
+
+    std::istream& in;
+    std::ostream& out;
+    bool quit = false;
+    int exitCode = 0;
+};
@@ -42,6 +42,8 @@
 // FreeCAD doc header
 #include <App/Application.h>
 
+#include "BatchService.h"
+
 
 using App::Application;
 using Base::Console;
@@ -131,8 +133,15 @@ int main(int argc, char** argv)
     }
 
     // Run phase ===========================================================
+    int exitCode = 0;
     try {
-        Application::runApplication();
+        if (App::Application::Config()["RunMode"] == "Service") {
+            BatchService service(std::cin, std::cout);
+            exitCode = service.run();
+        }
+        else {
+            Application::runApplication();
+        }
     }
     catch (const Base::SystemExitException& e) {
         exit(e.getExitCode());
@@ -161,5 +170,5 @@ int main(int argc, char** argv)
 
     Console().log("FreeCAD completely terminated\n");
 
-    return 0;
+    return exitCode;
 }
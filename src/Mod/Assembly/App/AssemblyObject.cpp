@@ -23,6 +23,7 @@
 
 #include <boost/core/ignore_unused.hpp>
 #include <cmath>
+#include <functional>
 #include <vector>
 #include <unordered_map>
 
@@ -88,6 +89,7 @@ FC_LOG_LEVEL_INIT("Assembly", true, true, true)
 
 using namespace Assembly;
 using namespace MbD;
+namespace sp = std::placeholders;
 
 
 namespace PartApp = Part;
@@ -106,9 +108,19 @@ AssemblyObject::AssemblyObject()
     , lastHasPartialRedundancies(false)
     , lastHasMalformedConstraints(false)
     , lastSolverStatus(0)
+    , frameCount(0)
+    , externalChanges(false)
+    , solving(false)
 {
     mbdAssembly->externalSystem->freecadAssemblyObject = this;
 
+    connChangedObject = App::GetApplication().signalChangedObject.connect(
+        std::bind(&AssemblyObject::slotChangedObject, this, sp::_1, sp::_2)
+    );
+    connDeletedObject = App::GetApplication().signalDeletedObject.connect(
+        std::bind(&AssemblyObject::slotDeletedObject, this, sp::_1)
+    );
+
     lastDoF = numberOfComponents() * 6;
     signalSolverUpdate();
 }
@@ -147,15 +159,35 @@ void AssemblyObject::onChanged(const App::Property* prop)
 
 int AssemblyObject::solve(bool enableRedo, bool updateJCS)
 {
+    // Placements written while solving are results, not changes to solve again
+    Base::StateLocker lock(solving);
+    std::unordered_set<App::DocumentObject*> changed;
+    changed.swap(changedObjects);
+    // Changing e.g. the body a part links to or a feature a joint references also affects them
+    std::unordered_set<App::DocumentObject*> affected = changed;
+    for (auto* obj : changed) {
+        for (auto* dependent : obj->getInListRecursive()) {
+            affected.insert(dependent);
+        }
+    }
+    bool solveAll = bundleFixed || externalChanges;
+    externalChanges = false;
+
     ensureIdentityPlacements();
 
     mbdAssembly = makeMbdAssembly();
     objectPartMap.clear();
     motions.clear();
+    fixedConnections.clear();
+    clearFrames();
+    if (bundleFixed) {
+        collectFixedConnections();
+    }
 
     auto groundedObjs = fixGroundedParts();
     if (groundedObjs.empty()) {
         // If no part fixed we can't solve.
+        solvedComponents.clear();
         return -6;
     }
 
@@ -163,6 +195,18 @@ int AssemblyObject::solve(bool enableRedo, bool updateJCS)
 
     removeUnconnectedJoints(joints, groundedObjs);
 
+    // Only the components touched since the last solve are given to the solver.
+    // Dragging works on the whole assembly, so it always solves everything.
+    std::vector<SolveComponent> components = getSolveComponents(joints, groundedObjs);
+    joints.clear();
+    for (auto& component : components) {
+        if (!solveAll && keepPreviousSolve(component, affected)) {
+            continue;
+        }
+        joints.insert(joints.end(), component.joints.begin(), component.joints.end());
+    }
+    solvedComponents = std::move(components);
+
     jointParts(joints);
 
     if (enableRedo) {
@@ -176,12 +220,14 @@ int AssemblyObject::solve(bool enableRedo, bool updateJCS)
     catch (const std::exception& e) {
         FC_ERR("Solve failed: " << e.what());
         lastSolverStatus = -1;
+        solvedComponents.clear();
         updateSolveStatus();
         return -1;
     }
     catch (...) {
         FC_ERR("Solve failed: unhandled exception");
         lastSolverStatus = -1;
+        solvedComponents.clear();
         updateSolveStatus();
         return -1;
     }
@@ -222,6 +268,10 @@ void AssemblyObject::updateSolveStatus()
     };
 
 
+    // Constraints and redundancy of the joints in the model, to keep the status of
+    // the components that are solved again
+    std::unordered_map<App::DocumentObject*, std::pair<int, bool>> jointStatus;
+
     // Iterate through all joints and motions in the MBD system
     mbdAssembly->mbdSystem->jointsMotionsDo([&](std::shared_ptr<MbD::Joint> jm) {
         if (!jm) {
@@ -229,6 +279,7 @@ void AssemblyObject::updateSolveStatus()
         }
         // Base::Console().warning("jm->name %s\n", jm->name);
         bool isJointRedundant = false;
+        int constraintCount = 0;
 
         jm->constraintsDo([&](std::shared_ptr<MbD::Constraint> con) {
             if (!con) {
@@ -242,6 +293,7 @@ void AssemblyObject::updateSolveStatus()
             }
             // Base::Console().warning("    - %s\n", spec);
             --lastDoF;
+            ++constraintCount;
         });
 
         const std::string fullName = cleanJointName(jm->name);
@@ -253,6 +305,10 @@ void AssemblyObject::updateSolveStatus()
             return;
         }
 
+        auto& status = jointStatus[docObj];
+        status.first += constraintCount;
+        status.second = status.second || isJointRedundant;
+
         if (isJointRedundant) {
             // Check if this joint is already in the list to avoid duplicates
             std::string objName = docObj->getNameInDocument();
@@ -263,6 +319,32 @@ void AssemblyObject::updateSolveStatus()
         }
     });
 
+    // Components left out of the last solve keep the status of their previous solve
+    for (auto& component : solvedComponents) {
+        if (component.inModel) {
+            component.constraintCount = 0;
+            component.redundantJoints.clear();
+            for (auto* joint : component.joints) {
+                auto it = jointStatus.find(joint);
+                if (it == jointStatus.end()) {
+                    continue;
+                }
+                component.constraintCount += it->second.first;
+                if (it->second.second) {
+                    component.redundantJoints.emplace_back(joint->getNameInDocument());
+                }
+            }
+            continue;
+        }
+
+        lastDoF -= component.constraintCount;
+        for (auto& objName : component.redundantJoints) {
+            if (std::ranges::find(lastRedundantJoints, objName) == lastRedundantJoints.end()) {
+                lastRedundantJoints.push_back(objName);
+            }
+        }
+    }
+
     // Update the summary boolean flag
     if (!lastRedundantJoints.empty()) {
         lastHasRedundancies = true;
@@ -274,7 +356,9 @@ void AssemblyObject::updateSolveStatus()
 int AssemblyObject::generateSimulation(App::DocumentObject* sim)
 {
     mbdAssembly = makeMbdAssembly();
+    solvedComponents.clear();
     objectPartMap.clear();
+    clearFrames();
 
     motions = getMotionsFromSimulation(sim);
 
@@ -294,10 +378,12 @@ int AssemblyObject::generateSimulation(App::DocumentObject* sim)
 
     try {
         mbdAssembly->runKINEMATIC();
+        recordFrames(joints);
     }
     catch (...) {
         Base::Console().error("Generation of simulation failed\n");
         motions.clear();
+        clearFrames();
         return -1;
     }
 
@@ -306,6 +392,59 @@ int AssemblyObject::generateSimulation(App::DocumentObject* sim)
     return 0;
 }
 
+void AssemblyObject::recordFrames(const std::vector<App::DocumentObject*>& joints)
+{
+    frameParts.clear();
+    std::vector<MbDPartData> partData;
+    for (auto& [obj, data] : objectPartMap) {
+        if (obj && data.part && obj->getPlacementProperty()) {
+            frameParts.push_back(obj);
+            partData.push_back(data);
+        }
+    }
+
+    frameCount = mbdAssembly->numberOfFrames();
+    framePlacements.resize(frameCount * frameParts.size());
+    auto placement = framePlacements.begin();
+    for (size_t index = 0; index < frameCount; ++index) {
+        mbdAssembly->updateForFrame(index);
+        for (auto& data : partData) {
+            *placement = getMbdPlacement(data.part);
+            if (!data.offsetPlc.isIdentity()) {
+                *placement = *placement * data.offsetPlc;
+            }
+            ++placement;
+        }
+    }
+
+    frameJoints = joints;
+}
+
+void AssemblyObject::clearFrames()
+{
+    frameCount = 0;
+    frameParts.clear();
+    framePlacements.clear();
+    frameJoints.clear();
+}
+
+void AssemblyObject::setFramePlacements(std::span<const Base::Placement> placements)
+{
+    for (size_t i = 0; i < frameParts.size(); ++i) {
+        auto* propPlacement = frameParts[i]->getPlacementProperty();
+        if (propPlacement && !propPlacement->getValue().isSame(placements[i])) {
+            propPlacement->setValue(placements[i]);
+            frameParts[i]->purgeTouched();
+        }
+    }
+
+    for (auto* joint : frameJoints) {
+        if (joint->Visibility.getValue()) {
+            redrawJointPlacement(joint);
+        }
+    }
+}
+
 std::vector<App::DocumentObject*> AssemblyObject::getMotionsFromSimulation(App::DocumentObject* sim)
 {
     if (!sim) {
@@ -322,25 +461,44 @@ std::vector<App::DocumentObject*> AssemblyObject::getMotionsFromSimulation(App::
 
 int Assembly::AssemblyObject::updateForFrame(size_t index, bool updateJCS)
 {
-    if (!mbdAssembly) {
+    boost::ignore_unused(updateJCS);
+    if (index >= frameCount) {
         return -1;
     }
 
-    auto nfrms = mbdAssembly->numberOfFrames();
-    if (index >= nfrms) {
+    size_t partCount = frameParts.size();
+    setFramePlacements(std::span(framePlacements).subspan(index * partCount, partCount));
+    return 0;
+}
+
+int Assembly::AssemblyObject::interpolateFrame(double frame)
+{
+    if (frameCount == 0 || frame < 0.0 || frame > double(frameCount - 1)) {
         return -1;
     }
 
-    mbdAssembly->updateForFrame(index);
-    setNewPlacements();
-    auto jointDocs = getJoints(updateJCS);
-    redrawJointPlacements(jointDocs);
+    auto index = size_t(frame);
+    if (index + 1 >= frameCount) {
+        return updateForFrame(frameCount - 1);
+    }
+
+    double t = frame - double(index);
+    size_t partCount = frameParts.size();
+    std::vector<Base::Placement> placements(partCount);
+    for (size_t i = 0; i < partCount; ++i) {
+        placements[i] = Base::Placement::slerp(
+            framePlacements[index * partCount + i],
+            framePlacements[(index + 1) * partCount + i],
+            t
+        );
+    }
+    setFramePlacements(placements);
     return 0;
 }
 
 size_t Assembly::AssemblyObject::numberOfFrames()
 {
-    return mbdAssembly->numberOfFrames();
+    return frameCount;
 }
 
 void AssemblyObject::preDrag(std::vector<App::DocumentObject*> dragParts)
@@ -379,6 +537,9 @@ void AssemblyObject::preDrag(std::vector<App::DocumentObject*> dragParts)
 
         draggedParts.push_back(part);
     }
+
+    dragJoints = getJoints(false);
+    dragGroundedParts = getGroundedParts();
 }
 
 void AssemblyObject::doDragStep()
@@ -416,11 +577,10 @@ void AssemblyObject::doDragStep()
         mbdAssembly->runDragStep(dragPartsVec);
 
         // Timing the validation and placement setting
-        if (validateNewPlacements()) {
+        if (validateNewPlacements(dragGroundedParts)) {
             setNewPlacements();
 
-            auto joints = getJoints(false);
-            for (auto* joint : joints) {
+            for (auto* joint : dragJoints) {
                 if (joint->Visibility.getValue()) {
                     // redraw only the moving joint as its quite slow as its python code.
                     redrawJointPlacement(joint);
@@ -451,9 +611,13 @@ Base::Placement AssemblyObject::getMbdPlacement(std::shared_ptr<ASMTPart> mbdPar
 }
 
 bool AssemblyObject::validateNewPlacements()
+{
+    return validateNewPlacements(getGroundedParts());
+}
+
+bool AssemblyObject::validateNewPlacements(const std::unordered_set<App::DocumentObject*>& groundedParts)
 {
     // First we check if a grounded object has moved. It can happen that they flip.
-    auto groundedParts = getGroundedParts();
     for (auto* obj : groundedParts) {
         auto* propPlacement = obj->getPlacementProperty();
         if (propPlacement) {
@@ -486,6 +650,8 @@ bool AssemblyObject::validateNewPlacements()
 void AssemblyObject::postDrag()
 {
     mbdAssembly->runPostDrag();  // Do this after last drag
+    dragJoints.clear();
+    dragGroundedParts.clear();
     purgeTouched();
 }
 
@@ -547,6 +713,7 @@ void AssemblyObject::clearUndo()
 void AssemblyObject::exportAsASMT(std::string fileName)
 {
     mbdAssembly = makeMbdAssembly();
+    solvedComponents.clear();
     objectPartMap.clear();
     fixGroundedParts();
 
@@ -1036,6 +1203,137 @@ void AssemblyObject::removeUnconnectedJoints(
     );
 }
 
+std::vector<AssemblyObject::SolveComponent> AssemblyObject::getSolveComponents(
+    const std::vector<App::DocumentObject*>& joints,
+    const std::unordered_set<App::DocumentObject*>& groundedObjs
+)
+{
+    // Union-find over the moving parts of the joints
+    std::unordered_map<App::DocumentObject*, App::DocumentObject*> parents;
+    auto findRoot = [&parents](App::DocumentObject* obj) {
+        App::DocumentObject* root = parents.try_emplace(obj, obj).first->second;
+        while (root != parents[root]) {
+            root = parents[root];
+        }
+        while (obj != root) {
+            App::DocumentObject* next = parents[obj];
+            parents[obj] = root;
+            obj = next;
+        }
+        return root;
+    };
+
+    auto movingPart = [&groundedObjs](App::DocumentObject* part) {
+        return groundedObjs.contains(part) ? nullptr : part;
+    };
+
+    std::vector<std::pair<App::DocumentObject*, App::DocumentObject*>> refParts;
+    refParts.reserve(joints.size());
+    for (auto* joint : joints) {
+        refParts.emplace_back(
+            getMovingPartFromRef(joint, "Reference1"),
+            getMovingPartFromRef(joint, "Reference2")
+        );
+        App::DocumentObject* part1 = movingPart(refParts.back().first);
+        App::DocumentObject* part2 = movingPart(refParts.back().second);
+        if (part1 && part2) {
+            App::DocumentObject* root1 = findRoot(part1);
+            App::DocumentObject* root2 = findRoot(part2);
+            if (root1 != root2) {
+                parents[root1] = root2;
+            }
+        }
+        else if (part1 || part2) {
+            findRoot(part1 ? part1 : part2);
+        }
+    }
+
+    std::vector<SolveComponent> components;
+    std::unordered_map<App::DocumentObject*, size_t> componentOfRoot;
+    for (size_t i = 0; i < joints.size(); ++i) {
+        App::DocumentObject* part1 = movingPart(refParts[i].first);
+        App::DocumentObject* part2 = movingPart(refParts[i].second);
+        // A joint between two grounded parts is a component of its own
+        App::DocumentObject* root = part1 ? findRoot(part1) : part2 ? findRoot(part2) : joints[i];
+        auto [it, isNew] = componentOfRoot.try_emplace(root, components.size());
+        if (isNew) {
+            components.emplace_back();
+        }
+        SolveComponent& component = components[it->second];
+        component.joints.push_back(joints[i]);
+        for (App::DocumentObject* part : {refParts[i].first, refParts[i].second}) {
+            auto& parts = groundedObjs.contains(part) ? component.groundedParts : component.parts;
+            if (part && std::ranges::find(parts, part) == parts.end()) {
+                parts.push_back(part);
+            }
+        }
+    }
+
+    // Sorted to compare them with the components of the previous solve
+    for (auto& component : components) {
+        std::ranges::sort(component.joints);
+        std::ranges::sort(component.parts);
+        std::ranges::sort(component.groundedParts);
+    }
+    return components;
+}
+
+bool AssemblyObject::keepPreviousSolve(
+    SolveComponent& component,
+    const std::unordered_set<App::DocumentObject*>& affected
+) const
+{
+    auto previous = std::ranges::find_if(solvedComponents, [&component](const auto& other) {
+        return other.joints == component.joints && other.groundedParts == component.groundedParts;
+    });
+    if (previous == solvedComponents.end()) {
+        return false;
+    }
+
+    // The status of joints from other documents is not kept, see updateSolveStatus()
+    for (auto* joint : component.joints) {
+        if (joint->getDocument() != getDocument()) {
+            return false;
+        }
+    }
+
+    for (const auto* objs : {&component.joints, &component.parts, &component.groundedParts}) {
+        for (auto* obj : *objs) {
+            if (affected.contains(obj)) {
+                return false;
+            }
+        }
+    }
+
+    component.inModel = false;
+    component.constraintCount = previous->constraintCount;
+    component.redundantJoints = previous->redundantJoints;
+    return true;
+}
+
+void AssemblyObject::slotChangedObject(const App::DocumentObject& obj, const App::Property& prop)
+{
+    boost::ignore_unused(prop);
+    if (solving || !getDocument()) {
+        return;
+    }
+    if (obj.getDocument() != getDocument()) {
+        externalChanges = true;
+        return;
+    }
+    changedObjects.insert(const_cast<App::DocumentObject*>(&obj));  // NOLINT
+}
+
+void AssemblyObject::slotDeletedObject(const App::DocumentObject& obj)
+{
+    changedObjects.erase(const_cast<App::DocumentObject*>(&obj));  // NOLINT
+    solvedComponents.clear();
+    if (obj.getDocument() == getDocument()) {
+        // The stored frames refer to the parts and joints
+        clearFrames();
+    }
+}
+
 void AssemblyObject::traverseAndMarkConnectedParts(
     App::DocumentObject* currentObj,
     std::vector<ObjRef>& connectedParts,
@@ -1863,26 +2161,22 @@ AssemblyObject::MbDPartData AssemblyObject::getMbDData(App::DocumentObject* part
     // Associate other objects connected with fixed joints
     if (bundleFixed) {
         auto addConnectedFixedParts = [&](App::DocumentObject* currentPart, auto& self) -> void {
-            std::vector<App::DocumentObject*> joints = getJointsOfPart(currentPart);
-            for (auto* joint : joints) {
-                JointType jointType = getJointType(joint);
-                if (jointType == JointType::Fixed) {
-                    App::DocumentObject* part1 = getMovingPartFromRef(joint, "Reference1");
-                    App::DocumentObject* part2 = getMovingPartFromRef(joint, "Reference2");
-                    App::DocumentObject* partToAdd = currentPart == part1 ? part2 : part1;
-
-                    if (objectPartMap.find(partToAdd) != objectPartMap.end()) {
-                        // already added
-                        continue;
-                    }
+            auto connected = fixedConnections.find(currentPart);
+            if (connected == fixedConnections.end()) {
+                return;
+            }
+            for (auto* partToAdd : connected->second) {
+                if (objectPartMap.find(partToAdd) != objectPartMap.end()) {
+                    // already added
+                    continue;
+                }
 
-                    Base::Placement plci = getPlacementFromProp(partToAdd, "Placement");
-                    MbDPartData partData = {mbdPart, plc.inverse() * plci};
-                    objectPartMap[partToAdd] = partData;  // Store the association
+                Base::Placement plci = getPlacementFromProp(partToAdd, "Placement");
+                MbDPartData partData = {mbdPart, plc.inverse() * plci};
+                objectPartMap[partToAdd] = partData;  // Store the association
 
-                    // Recursively call for partToAdd
-                    self(partToAdd, self);
-                }
+                // Recursively call for partToAdd
+                self(partToAdd, self);
             }
         };
 
@@ -1891,6 +2185,25 @@ AssemblyObject::MbDPartData AssemblyObject::getMbDData(App::DocumentObject* part
     return data;
 }
 
+void AssemblyObject::collectFixedConnections()
+{
+    // Looking up the joints of each bundled part resolved the references of all
+    // joints every time, which made preparing a drag quadratic in the number of parts.
+    fixedConnections.clear();
+    for (auto* joint : getJoints(false)) {
+        if (getJointType(joint) != JointType::Fixed) {
+            continue;
+        }
+        App::DocumentObject* part1 = getMovingPartFromRef(joint, "Reference1");
+        App::DocumentObject* part2 = getMovingPartFromRef(joint, "Reference2");
+        if (!part1 || !part2) {
+            continue;
+        }
+        fixedConnections[part1].push_back(part2);
+        fixedConnections[part2].push_back(part1);
+    }
+}
+
 std::shared_ptr<ASMTPart> AssemblyObject::getMbDPart(App::DocumentObject* part)
 {
     if (!part) {
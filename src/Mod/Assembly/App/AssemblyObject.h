@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <span>
 #include <boost/signals2.hpp>
 
 #include <Mod/Assembly/AssemblyGlobal.h>
@@ -94,6 +95,8 @@ public:
     int solve(bool enableRedo = false, bool updateJCS = true);
     int generateSimulation(App::DocumentObject* sim);
     int updateForFrame(size_t index, bool updateJCS = true);
+    // Moves the parts between two frames, frame being a fractional frame index
+    int interpolateFrame(double frame);
     size_t numberOfFrames();
     void preDrag(std::vector<App::DocumentObject*> dragParts);
     void doDragStep();
@@ -106,6 +109,7 @@ public:
 
     Base::Placement getMbdPlacement(std::shared_ptr<MbD::ASMTPart> mbdPart);
     bool validateNewPlacements();
+    bool validateNewPlacements(const std::unordered_set<App::DocumentObject*>& groundedParts);
     void setNewPlacements();
     static void redrawJointPlacements(std::vector<App::DocumentObject*> joints);
     static void redrawJointPlacement(App::DocumentObject* joint);
@@ -132,6 +136,8 @@ public:
         Base::Placement offsetPlc;  // This is the offset within the bundled parts
     };
     MbDPartData getMbDData(App::DocumentObject* part);
+    // Parts connected by fixed joints, collected once per solve for bundling
+    void collectFixedConnections();
     std::shared_ptr<MbD::ASMTMarker> makeMbdMarker(std::string& name, Base::Placement& plc);
     std::vector<std::shared_ptr<MbD::ASMTJoint>> makeMbdJoint(App::DocumentObject* joint);
     std::shared_ptr<MbD::ASMTJoint> makeMbdJointOfType(App::DocumentObject* joint, JointType jointType);
@@ -179,6 +185,23 @@ public:
         std::vector<App::DocumentObject*>& joints,
         std::unordered_set<App::DocumentObject*> groundedObjs
     );
+    // Joints that can be solved independently of the rest of the assembly. Grounded parts
+    // don't move, so they don't tie the joints on either side of them together.
+    struct SolveComponent
+    {
+        std::vector<App::DocumentObject*> joints;
+        std::vector<App::DocumentObject*> parts;
+        std::vector<App::DocumentObject*> groundedParts;
+        // Whether the joints are in the current mbdAssembly, else the status below is
+        // the one of the last solve of the component.
+        bool inModel = true;
+        int constraintCount = 0;
+        std::vector<std::string> redundantJoints;
+    };
+    std::vector<SolveComponent> getSolveComponents(
+        const std::vector<App::DocumentObject*>& joints,
+        const std::unordered_set<App::DocumentObject*>& groundedObjs
+    );
     void traverseAndMarkConnectedParts(
         App::DocumentObject* currentPart,
         std::vector<ObjRef>& connectedParts,
@@ -263,6 +286,10 @@ private:
     std::unordered_map<App::DocumentObject*, MbDPartData> objectPartMap;
     std::vector<std::pair<App::DocumentObject*, double>> objMasses;
     std::vector<App::DocumentObject*> draggedParts;
+    // Joints and grounded parts don't change during a drag, so they are only looked up once
+    std::vector<App::DocumentObject*> dragJoints;
+    std::unordered_set<App::DocumentObject*> dragGroundedParts;
+    std::unordered_map<App::DocumentObject*, std::vector<App::DocumentObject*>> fixedConnections;
     std::vector<App::DocumentObject*> motions;
 
     std::vector<std::pair<App::DocumentObject*, Base::Placement>> previousPositions;
@@ -280,6 +307,32 @@ private:
     std::vector<std::string> lastConflictingJoints;
     std::vector<std::string> lastPartialRedundantJoints;
     std::vector<std::string> lastMalformedJoints;
+
+    // The frames of the last simulation are stored once it is generated, so playing it back
+    // doesn't go through the solver. framePlacements holds the placements of frameParts,
+    // frame after frame.
+    void recordFrames(const std::vector<App::DocumentObject*>& joints);
+    void clearFrames();
+    void setFramePlacements(std::span<const Base::Placement> placements);
+    std::vector<App::DocumentObject*> frameParts;
+    std::vector<Base::Placement> framePlacements;
+    std::vector<App::DocumentObject*> frameJoints;
+    size_t frameCount;
+
+    // Components of the last solve and the objects changed since then. Components that
+    // didn't change are left out of the next solve.
+    void slotChangedObject(const App::DocumentObject& obj, const App::Property& prop);
+    void slotDeletedObject(const App::DocumentObject& obj);
+    bool keepPreviousSolve(
+        SolveComponent& component,
+        const std::unordered_set<App::DocumentObject*>& affected
+    ) const;
+    std::vector<SolveComponent> solvedComponents;
+    std::unordered_set<App::DocumentObject*> changedObjects;
+    bool externalChanges;
+    bool solving;
+    fastsignals::scoped_connection connChangedObject;
+    fastsignals::scoped_connection connDeletedObject;
 };
 
 }  // namespace Assembly
@@ -73,6 +73,19 @@ class AssemblyObject(Part):
         """
         ...
 
+    @constmethod
+    def interpolateFrame(self, frame: float, /) -> None:
+        """
+        Update entire assembly to a position between two frames.
+
+        Args:
+            frame: fractional index of frame, e.g. 2.5 is halfway between
+            frames 2 and 3.
+
+        Returns: None
+        """
+        ...
+
     @constmethod
     def numberOfFrames(self) -> int:
         """Return Number of frames"""
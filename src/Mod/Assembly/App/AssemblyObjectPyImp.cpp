@@ -103,6 +103,22 @@ PyObject* AssemblyObjectPy::updateForFrame(PyObject* args) const
     Py_Return;
 }
 
+PyObject* AssemblyObjectPy::interpolateFrame(PyObject* args) const
+{
+    double frame {};
+
+    if (!PyArg_ParseTuple(args, "d", &frame)) {
+        throw Py::RuntimeError("interpolateFrame requires a frame index");
+    }
+    PY_TRY
+    {
+        this->getAssemblyObjectPtr()->interpolateFrame(frame);
+    }
+    PY_CATCH;
+
+    Py_Return;
+}
+
 PyObject* AssemblyObjectPy::numberOfFrames(PyObject* args) const
 {
     if (!PyArg_ParseTuple(args, "")) {
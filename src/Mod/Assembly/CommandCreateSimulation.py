@@ -924,6 +924,9 @@ class TaskAssemblyCreateSimulation(QtCore.QObject):
 
     def onFrameChanged(self, val):
         self.assembly.updateForFrame(val)
+        self.updateFrameLabels(val)
+
+    def updateFrameLabels(self, val):
         self.form.FrameLabel.setText(translate("Assembly", "Frame" + " " + str(val)))
         time = float(val * self.simFeaturePy.cTimeStepOutput)
         self.form.FrameTimeLabel.setText(f"{time:.2f} s")
@@ -954,15 +957,23 @@ class TaskAssemblyCreateSimulation(QtCore.QObject):
         self.deltaTime = 1.0 / self.fps
         self.startTime = time.time()
         self.index = self.currentFrm
-        self.animationTimer.setInterval(self.deltaTime * 1000)  # ms
+        # The view is refreshed at least 30 times per second, the parts are moved
+        # between the frames in the meantime.
+        self.animationTimer.setInterval(min(self.deltaTime, 1.0 / 30) * 1000)  # ms
         self.animationTimer.start()
 
     def playAnimation(self):
         range_ = self.endFrm - self.startFrm
         offset = self.currentFrm - self.startFrm
-        count = int((time.time() - self.startTime) / self.deltaTime)
-        self.index = ((self.direction * count + offset) % range_) + self.startFrm
+        count = (time.time() - self.startTime) / self.deltaTime
+        position = ((self.direction * count + offset) % range_) + self.startFrm
+        self.index = int(position)
+        self.assembly.interpolateFrame(position)
+
+        self.form.frameSlider.blockSignals(True)
         self.setFrameValue(self.index)
+        self.form.frameSlider.blockSignals(False)
+        self.updateFrameLabels(self.index)
 
     def displayLastFrame(self):
         nFrms = self.assembly.numberOfFrames()
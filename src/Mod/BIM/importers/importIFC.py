@@ -185,6 +185,11 @@ def insert(srcfile, docname, skip=[], only=[], root=None, preferences=None):
     if preferences is None:
         preferences = importIFCHelper.getPreferences()
 
+    if preferences["LIGHTWEIGHT"] and not hasattr(srcfile, "by_guid"):
+        from importers import importIFCplaceholder
+
+        return importIFCplaceholder.insert(srcfile, docname, preferences)
+
     if preferences["MULTICORE"] and not hasattr(srcfile, "by_guid"):
         # override with BIM IFC importer if present
         try:
@@ -105,6 +105,7 @@ def getPreferences():
         "ALLOW_INVALID": params.get_param_arch("ifcAllowInvalid"),
         "REPLACE_PROJECT": params.get_param_arch("ifcReplaceProject"),
         "MULTICORE": params.get_param_arch("ifcMulticore"),
+        "LIGHTWEIGHT": params.get_param_arch("ifcLightweight"),
         "IMPORT_LAYER": params.get_param_arch("ifcImportLayer"),
     }
 
@@ -0,0 +1,313 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+
+# ***************************************************************************
+# *                                                                         *
+# *   Copyright (c) 2026 FreeCAD Project Association                        *
+# *                                                                         *
+# *   This file is part of FreeCAD.                                         *
+# *                                                                         *
+# *   FreeCAD is free software: you can redistribute it and/or modify it    *
+# *   under the terms of the GNU Lesser General Public License as           *
+# *   published by the Free Software Foundation, either version 2.1 of the  *
+# *   License, or (at your option) any later version.                       *
+# *                                                                         *
+# *   FreeCAD is distributed in the hope that it will be useful, but        *
+# *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+# *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+# *   Lesser General Public License for more details.                       *
+# *                                                                         *
+# *   You should have received a copy of the GNU Lesser General Public      *
+# *   License along with FreeCAD. If not, see                               *
+# *   <https://www.gnu.org/licenses/>.                                      *
+# *                                                                         *
+# ***************************************************************************
+
+"""FreeCAD IFC importer - Placeholder version
+
+Imports the products of an IFC file as lightweight placeholders instead of
+BIM components. The triangulation of every representation is turned into a
+single mesh, and every product becomes a link to the mesh of its
+representation, so repeated elements like windows or columns are stored once.
+The geometry is tessellated by the IfcOpenShell iterator on all cores and
+copied into the meshes in C++.
+
+A placeholder keeps the file name and the GlobalId of its product. Double
+clicking or editing it replaces it by a BIM component with the full BREP
+geometry, see buildComponent().
+"""
+
+import os
+import time
+
+import FreeCAD
+
+from FreeCAD import Base
+
+from importers import importIFCHelper
+
+# cache of the opened IFC files for buildComponent()
+ifcfiles = {}  # filename : ifcfile
+
+
+def open(filename):
+    "opens an IFC file in a new document"
+
+    return insert(filename)
+
+
+def insert(filename, docname=None, preferences=None):
+    """imports the contents of an IFC file as placeholders in the given document"""
+
+    import ifcopenshell
+    from ifcopenshell import geom
+    import Mesh
+
+    starttime = time.time()  # in seconds
+    filesize = os.path.getsize(filename) * 0.000001  # in megabytes
+    print("Opening", filename + ",", round(filesize, 2), "Mb")
+
+    if not preferences:
+        preferences = importIFCHelper.getPreferences()
+    settings = ifcopenshell.geom.settings()
+    # products keep their own placement so that representations can be shared
+    settings.set(settings.USE_WORLD_COORDS, False)
+    if hasattr(settings, "WELD_VERTICES"):
+        settings.set(settings.WELD_VERTICES, True)
+    if preferences["SEPARATE_OPENINGS"]:
+        settings.set(settings.DISABLE_OPENING_SUBTRACTIONS, True)
+
+    if docname:
+        try:
+            doc = FreeCAD.getDocument(docname)
+        except NameError:
+            doc = FreeCAD.newDocument(docname)
+    else:
+        doc = FreeCAD.ActiveDocument
+        if not doc:
+            doc = FreeCAD.newDocument(os.path.splitext(os.path.basename(filename))[0])
+    FreeCAD.setActiveDocument(doc.Name)
+
+    ifcfile = ifcopenshell.open(filename)
+    ifcfiles[filename] = ifcfile
+    skip = [t.strip().lower() for t in preferences["SKIP"] if t.strip()]
+    productscount = len(ifcfile.by_type("IfcProduct"))
+    progressbar = Base.ProgressIndicator()
+    progressbar.start("Importing " + str(productscount) + " products...", productscount)
+    cores = preferences["MULTICORE"] or os.cpu_count() or 1
+    iterator = ifcopenshell.geom.iterator(settings, ifcfile, cores)
+
+    scale = FreeCAD.Matrix()
+    scale.scale(1000.0)  # IfcOpenShell outputs in meters
+    representations = doc.addObject("App::DocumentObjectGroup", "IfcRepresentations")
+    meshes = {}  # geometry id : Mesh::Feature
+    containers = {}  # ifcid : App::DocumentObjectGroup
+    count = 0
+
+    if iterator.initialize():
+        for item in iterator:
+            ifcproduct = ifcfile.by_id(item.id)
+            progressbar.next(True)
+            if ifcproduct.is_a().lower() in skip:
+                continue
+
+            feature = meshes.get(item.geometry.id)
+            if not feature:
+                mesh = Mesh.Mesh()
+                mesh.setTopology(item.geometry.verts, item.geometry.faces)
+                mesh.transform(scale)
+                feature = doc.addObject("Mesh::Feature", "Representation")
+                feature.Mesh = mesh
+                representations.addObject(feature)
+                setColor(feature, ifcproduct)
+                meshes[item.geometry.id] = feature
+
+            obj = makePlaceholder(doc, filename, ifcproduct, feature)
+            obj.Placement = getPlacement(item.transformation.matrix)
+            container = getContainer(doc, ifcproduct, containers)
+            if container:
+                container.addObject(obj)
+            count += 1
+
+    if FreeCAD.GuiUp:
+        representations.ViewObject.Visibility = False
+    progressbar.stop()
+    doc.recompute()
+    endtime = "%02d:%02d" % (divmod(round(time.time() - starttime, 1), 60))
+    print(
+        "Imported",
+        count,
+        "products with",
+        len(meshes),
+        "representations in",
+        endtime,
+    )
+    return doc
+
+
+def getPlacement(matrix):
+    """returns the placement of an IfcOpenShell transformation matrix"""
+
+    m = matrix.data if hasattr(matrix, "data") else matrix
+    if len(m) == 12:
+        # 4x3 matrix in column-major order
+        rows = (m[0], m[3], m[6], m[9]), (m[1], m[4], m[7], m[10]), (m[2], m[5], m[8], m[11])
+    else:
+        # 4x4 matrix in column-major order
+        rows = (m[0], m[4], m[8], m[12]), (m[1], m[5], m[9], m[13]), (m[2], m[6], m[10], m[14])
+    mat = FreeCAD.Matrix()
+    mat.A = [v for r in rows for v in (r[0], r[1], r[2], r[3] * 1000.0)] + [0, 0, 0, 1]
+    return FreeCAD.Placement(mat)
+
+
+def getContainer(doc, ifcproduct, containers):
+    """returns the group of the spatial element containing a product"""
+
+    for rel in getattr(ifcproduct, "ContainedInStructure", None) or []:
+        structure = rel.RelatingStructure
+        group = containers.get(structure.id())
+        if not group:
+            group = doc.addObject("App::DocumentObjectGroup", "Container")
+            group.Label = structure.Name or structure.is_a()
+            containers[structure.id()] = group
+        return group
+    return None
+
+
+def setColor(obj, ifcproduct):
+    """sets the color of a representation from one of its products"""
+
+    if FreeCAD.GuiUp:
+        color = importIFCHelper.getColorFromProduct(ifcproduct)
+        if color and hasattr(obj.ViewObject, "ShapeColor"):
+            obj.ViewObject.ShapeColor = color[:3]
+
+
+def makePlaceholder(doc, filename, ifcproduct, feature):
+    """creates the placeholder of a product"""
+
+    obj = doc.addObject("App::LinkPython", "IfcProduct")
+    IfcPlaceholder(obj)
+    obj.LinkedObject = feature
+    obj.IfcFile = filename
+    obj.GlobalId = ifcproduct.GlobalId
+    obj.IfcClass = ifcproduct.is_a()
+    obj.Label = ifcproduct.Name or ifcproduct.is_a()
+    if FreeCAD.GuiUp:
+        ViewProviderIfcPlaceholder(obj.ViewObject)
+    return obj
+
+
+def buildComponent(obj):
+    """replaces a placeholder by a BIM component with the BREP of its product"""
+
+    import ifcopenshell
+    from ifcopenshell import geom
+    import Arch
+    import Part
+    from importers import importIFCmulticore
+
+    ifcfile = ifcfiles.get(obj.IfcFile)
+    if not ifcfile:
+        ifcfile = ifcopenshell.open(obj.IfcFile)
+        ifcfiles[obj.IfcFile] = ifcfile
+    ifcproduct = ifcfile.by_guid(obj.GlobalId)
+
+    settings = ifcopenshell.geom.settings()
+    settings.set(settings.USE_BREP_DATA, True)
+    settings.set(settings.SEW_SHELLS, True)
+    settings.set(settings.USE_WORLD_COORDS, True)
+    brep = ifcopenshell.geom.create_shape(settings, ifcproduct).geometry.brep_data
+
+    shape = Part.Shape()
+    shape.importBrepFromString(brep, False)
+    shape.scale(1000.0)  # IfcOpenShell outputs in meters
+    if ifcproduct.is_a("IfcSpace"):
+        component = Arch.makeSpace()
+    else:
+        component = Arch.makeComponent()
+    component.Shape = shape
+    importIFCmulticore.setAttributes(component, ifcproduct)
+    importIFCmulticore.setColor(component, ifcproduct)
+
+    doc = obj.Document
+    for parent in obj.InList:
+        if parent.isDerivedFrom("App::DocumentObjectGroup"):
+            parent.Group = [component if o == obj else o for o in parent.Group]
+    doc.removeObject(obj.Name)
+    return component
+
+
+class IfcPlaceholder:
+    """The proxy of a product imported as placeholder"""
+
+    def __init__(self, obj):
+        obj.Proxy = self
+        obj.addProperty(
+            "App::PropertyString",
+            "IfcFile",
+            "IFC",
+            "The IFC file of the product",
+            locked=True,
+        )
+        obj.addProperty(
+            "App::PropertyString",
+            "GlobalId",
+            "IFC",
+            "The GlobalId of the product",
+            locked=True,
+        )
+        obj.addProperty(
+            "App::PropertyString",
+            "IfcClass",
+            "IFC",
+            "The IFC class of the product",
+            locked=True,
+        )
+
+    def dumps(self):
+        return None
+
+    def loads(self, state):
+        return None
+
+
+class ViewProviderIfcPlaceholder:
+    """The view provider of a placeholder, editing it builds the BREP"""
+
+    def __init__(self, vobj):
+        vobj.Proxy = self
+
+    def attach(self, vobj):
+        self.Object = vobj.Object
+
+    def doubleClicked(self, vobj):
+        self.replace(vobj.Object)
+        return True
+
+    def setEdit(self, vobj, mode=0):
+        if mode != 0:
+            return None
+        self.replace(vobj.Object)
+        return False
+
+    def replace(self, obj):
+        import FreeCADGui
+
+        doc = obj.Document
+        doc.openTransaction("Build IFC geometry")
+        try:
+            component = buildComponent(obj)
+        except Exception as e:
+            doc.abortTransaction()
+            FreeCAD.Console.PrintError("Cannot build the geometry of {}: {}\n".format(obj.Label, e))
+            return
+        doc.commitTransaction()
+        doc.recompute()
+        FreeCADGui.Selection.clearSelection()
+        FreeCADGui.Selection.addSelection(component)
+
+    def dumps(self):
+        return None
+
+    def loads(self, state):
+        return None
@@ -190,9 +190,8 @@ private:
                 = static_cast<App::DocumentObjectPy*>(pObj)->getDocumentObjectPtr();
             if (obj->isDerivedFrom<Path::Feature>()) {
                 const Path::Toolpath& path = static_cast<Path::Feature*>(obj)->Path.getValue();
-                std::string gcode = path.toGCode();
                 Base::ofstream ofile(file);
-                ofile << gcode;
+                path.toGCode(ofile);
                 ofile.close();
             }
             else {
@@ -233,11 +232,8 @@ private:
         try {
             // read the gcode file
             Base::ifstream filestr(file);
-            std::stringstream buffer;
-            buffer << filestr.rdbuf();
-            std::string gcode = buffer.str();
             Path::Toolpath path;
-            path.setFromGCode(gcode);
+            path.setFromGCode(filestr);
             auto* object = pcDoc->addObject<Path::Feature>(file.fileNamePure().c_str());
             object->Path.setValue(path);
             pcDoc->recompute();
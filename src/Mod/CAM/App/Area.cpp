@@ -25,7 +25,10 @@
 // From Boost 1.75 on the geometry component requires C++14
 #define BOOST_GEOMETRY_DISABLE_DEPRECATED_03_WARNING
 
+#include <algorithm>
+#include <exception>
 #include <limits>
+#include <numeric>
 
 #include <boost/geometry.hpp>
 #include <boost/geometry/geometries/register/point.hpp>
@@ -67,6 +70,8 @@
 #include <TopoDS_Compound.hxx>
 #include <TopTools_HSequenceOfShape.hxx>
 
+#include <QtConcurrentMap>
+
 #include <App/Application.h>
 #include <App/Document.h>
 #include <Base/Exception.h>
@@ -1896,124 +1901,172 @@ std::vector<shared_ptr<Area>> Area::makeSections(
     bool can_retry = fabs(tolerance) > Precision::Confusion();
     TopLoc_Location locInverse(loc.Inverted());
 
-    for (size_t i = 0; i < heights.size(); ++i) {
-        double z = heights[i];
-        bool retried = !can_retry;
-        while (true) {
-            gp_Pln pln(gp_Pnt(0, 0, z), gp_Dir(0, 0, 1));
-            Standard_Real a, b, c, d;
-            pln.Coefficients(a, b, c, d);
-            BRepLib_MakeFace mkFace(pln, xMin, xMax, yMin, yMax);
-            const TopoDS_Shape& face = mkFace.Face();
-
-            shared_ptr<Area> area(std::make_shared<Area>(&myParams));
-            area->myParams.Outline = false;
-            area->setPlane(face.Moved(locInverse));
-
-            if (project) {
-                for (const auto& s : projectedShapes) {
-                    gp_Trsf t;
-                    t.SetTranslation(gp_Vec(0, 0, -d));
-                    TopLoc_Location wloc(t);
-                    area->add(s.shape.Moved(wloc).Moved(locInverse), s.op);
-                }
-                sections.push_back(area);
-                break;
-            }
+    // Each height is sliced independently into its own Area, so the sections are made
+    // concurrently and collected by index to keep them in height order. Warnings are
+    // buffered and printed in the same order afterwards.
+    struct SectionResult
+    {
+        shared_ptr<Area> area;
+        std::vector<std::string> warnings;
+        std::exception_ptr error;
+    };
+    std::vector<SectionResult> results(heights.size());
 
-            for (auto it = myShapes.begin(); it != myShapes.end(); ++it) {
-                const auto& s = *it;
-                BRep_Builder builder;
-                TopoDS_Compound comp;
-                builder.MakeCompound(comp);
-
-                for (TopExp_Explorer xp(s.shape.Moved(loc), TopAbs_SOLID); xp.More(); xp.Next()) {
-                    showShape(xp.Current(), nullptr, "section_%zu_shape", i);
-                    std::list<TopoDS_Wire> wires;
-                    Part::CrossSection section(a, b, c, xp.Current());
-                    Part::FuzzyHelper::withBooleanFuzzy(.0, [&]() {
-                        // Workaround for https://github.com/FreeCAD/FreeCAD/issues/17748
-                        // needed to make finish pass work.
-                        // This fix might be better to move into Part::CrossSection but it is kept
-                        // here for now to be on the safe side.
-                        wires = section.slice(-d);
-                    });
-                    showShapes(wires, nullptr, "section_%zu_wire", i);
-                    if (wires.empty()) {
-                        AREA_LOG("Section returns no wires");
-                        continue;
+    auto makeSection = [&](std::size_t i) {
+        SectionResult& result = results[i];
+        try {
+            double z = heights[i];
+            bool retried = !can_retry;
+            while (true) {
+                gp_Pln pln(gp_Pnt(0, 0, z), gp_Dir(0, 0, 1));
+                Standard_Real a, b, c, d;
+                pln.Coefficients(a, b, c, d);
+                BRepLib_MakeFace mkFace(pln, xMin, xMax, yMin, yMax);
+                const TopoDS_Shape& face = mkFace.Face();
+
+                shared_ptr<Area> area(std::make_shared<Area>(&myParams));
+                area->myParams.Outline = false;
+                area->setPlane(face.Moved(locInverse));
+
+                if (project) {
+                    for (const auto& s : projectedShapes) {
+                        gp_Trsf t;
+                        t.SetTranslation(gp_Vec(0, 0, -d));
+                        TopLoc_Location wloc(t);
+                        area->add(s.shape.Moved(wloc).Moved(locInverse), s.op);
                     }
+                    result.area = area;
+                    break;
+                }
 
-                    // always try to make face to normalize wire orientation
-                    Part::FaceMakerBullseye mkFace;
-                    mkFace.setPlane(pln);
-                    for (const TopoDS_Wire& wire : wires) {
-                        if (BRep_Tool::IsClosed(wire)) {
-                            mkFace.addWire(wire);
+                for (auto it = myShapes.begin(); it != myShapes.end(); ++it) {
+                    const auto& s = *it;
+                    BRep_Builder builder;
+                    TopoDS_Compound comp;
+                    builder.MakeCompound(comp);
+
+                    for (TopExp_Explorer xp(s.shape.Moved(loc), TopAbs_SOLID); xp.More();
+                         xp.Next()) {
+                        showShape(xp.Current(), nullptr, "section_%zu_shape", i);
+                        std::list<TopoDS_Wire> wires;
+                        Part::CrossSection section(a, b, c, xp.Current());
+                        wires = section.slice(-d);
+                        showShapes(wires, nullptr, "section_%zu_wire", i);
+                        if (wires.empty()) {
+                            AREA_LOG("Section returns no wires");
+                            continue;
                         }
-                    }
-                    try {
-                        mkFace.Build();
-                        const TopoDS_Shape& shape = mkFace.Shape();
-                        if (shape.IsNull()) {
-                            AREA_WARN("FaceMakerBullseye return null shape on section");
+
+                        // always try to make face to normalize wire orientation
+                        Part::FaceMakerBullseye mkFace;
+                        mkFace.setPlane(pln);
+                        for (const TopoDS_Wire& wire : wires) {
+                            if (BRep_Tool::IsClosed(wire)) {
+                                mkFace.addWire(wire);
+                            }
                         }
-                        else {
-                            showShape(shape, nullptr, "section_%zu_face", i);
-                            for (auto it = wires.begin(), itNext = it; it != wires.end();
-                                 it = itNext) {
-                                ++itNext;
-                                if (BRep_Tool::IsClosed(*it)) {
-                                    wires.erase(it);
-                                }
+                        try {
+                            mkFace.Build();
+                            const TopoDS_Shape& shape = mkFace.Shape();
+                            if (shape.IsNull()) {
+                                result.warnings.emplace_back(
+                                    "FaceMakerBullseye return null shape on section"
+                                );
                             }
-                            for (TopExp_Explorer xp(
-                                     shape,
-                                     myParams.Fill == FillNone ? TopAbs_WIRE : TopAbs_FACE
-                                 );
-                                 xp.More();
-                                 xp.Next()) {
-                                builder.Add(comp, xp.Current());
+                            else {
+                                showShape(shape, nullptr, "section_%zu_face", i);
+                                for (auto it = wires.begin(), itNext = it; it != wires.end();
+                                     it = itNext) {
+                                    ++itNext;
+                                    if (BRep_Tool::IsClosed(*it)) {
+                                        wires.erase(it);
+                                    }
+                                }
+                                for (TopExp_Explorer xp(
+                                         shape,
+                                         myParams.Fill == FillNone ? TopAbs_WIRE : TopAbs_FACE
+                                     );
+                                     xp.More();
+                                     xp.Next()) {
+                                    builder.Add(comp, xp.Current());
+                                }
                             }
                         }
+                        catch (Base::Exception& e) {
+                            result.warnings.push_back(
+                                std::string("FaceMakerBullseye failed on section: ") + e.what()
+                            );
+                        }
+                        for (const TopoDS_Wire& wire : wires) {
+                            builder.Add(comp, wire);
+                        }
                     }
-                    catch (Base::Exception& e) {
-                        AREA_WARN("FaceMakerBullseye failed on section: " << e.what());
+
+                    // Make sure the compound has at least one edge
+                    if (TopExp_Explorer(comp, TopAbs_EDGE).More()) {
+                        const TopoDS_Shape& shape = comp.Moved(locInverse);
+                        showShape(shape, nullptr, "section_%zu_result", i);
+                        area->add(shape, s.op);
                     }
-                    for (const TopoDS_Wire& wire : wires) {
-                        builder.Add(comp, wire);
+                    else if (area->myShapes.empty()) {
+                        auto itNext = it;
+                        if (++itNext != myShapes.end()
+                            && (itNext->op == OperationIntersection
+                                || itNext->op == OperationDifference)) {
+                            break;
+                        }
                     }
                 }
-
-                // Make sure the compound has at least one edge
-                if (TopExp_Explorer(comp, TopAbs_EDGE).More()) {
-                    const TopoDS_Shape& shape = comp.Moved(locInverse);
-                    showShape(shape, nullptr, "section_%zu_result", i);
-                    area->add(shape, s.op);
+                if (!area->myShapes.empty()) {
+                    result.area = area;
+                    FC_TIME_LOG(t1, "makeSection " << z);
+                    showShape(area->getShape(), nullptr, "section_%zu_final", i);
+                    break;
                 }
-                else if (area->myShapes.empty()) {
-                    auto itNext = it;
-                    if (++itNext != myShapes.end()
-                        && (itNext->op == OperationIntersection || itNext->op == OperationDifference)) {
-                        break;
-                    }
+                if (retried) {
+                    result.warnings.emplace_back("Discard empty section");
+                    break;
+                }
+                else {
+                    AREA_TRACE("retry section " << z << "->" << z + tolerance);
+                    z += tolerance;
+                    retried = true;
                 }
             }
-            if (!area->myShapes.empty()) {
-                sections.push_back(area);
-                FC_TIME_LOG(t1, "makeSection " << z);
-                showShape(area->getShape(), nullptr, "section_%zu_final", i);
-                break;
-            }
-            if (retried) {
-                AREA_WARN("Discard empty section");
-                break;
-            }
-            else {
-                AREA_TRACE("retry section " << z << "->" << z + tolerance);
-                z += tolerance;
-                retried = true;
-            }
+        }
+        catch (...) {
+            result.error = std::current_exception();
+        }
+    };
+
+    std::vector<std::size_t> indices(heights.size());
+    std::iota(indices.begin(), indices.end(), 0);
+
+    // Workaround for https://github.com/FreeCAD/FreeCAD/issues/17748
+    // needed to make finish pass work.
+    // This fix might be better to move into Part::CrossSection but it is kept
+    // here for now to be on the safe side. The fuzzy value is global, so it is
+    // set once here instead of inside the concurrent slicing.
+    Part::FuzzyHelper::withBooleanFuzzy(.0, [&]() {
+        // Logging and showShape() (which adds document objects) are only safe in
+        // the calling thread, so debugging keeps the sequential order.
+        if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
+            std::for_each(indices.begin(), indices.end(), makeSection);
+        }
+        else {
+            QtConcurrent::blockingMap(indices, makeSection);
+        }
+    });
+
+    for (SectionResult& result : results) {
+        for (const std::string& msg : result.warnings) {
+            AREA_WARN(msg);
+        }
+        if (result.error) {
+            std::rethrow_exception(result.error);
+        }
+        if (result.area) {
+            sections.push_back(result.area);
         }
     }
     FC_TIME_LOG(t, "makeSection count: " << sections.size() << ", total");
@@ -2223,7 +2276,58 @@ TopoDS_Shape Area::toShape(CArea& area, short fill, int reorient)
     return toShape(area, bFill, &trsf, reorient);
 }
 
+static bool isSameCurves(const CArea* a, const CArea* b)
+{
+    if (!a || !b) {
+        return a == b;
+    }
+    if (a->m_curves.size() != b->m_curves.size()) {
+        return false;
+    }
+    for (auto ia = a->m_curves.begin(), ib = b->m_curves.begin(); ia != a->m_curves.end();
+         ++ia, ++ib) {
+        if (ia->m_vertices.size() != ib->m_vertices.size()) {
+            return false;
+        }
+        for (auto va = ia->m_vertices.begin(), vb = ib->m_vertices.begin();
+             va != ia->m_vertices.end();
+             ++va, ++vb) {
+            if (va->m_type != vb->m_type || va->m_p != vb->m_p
+                || (va->m_type != 0 && va->m_c != vb->m_c)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool Area::isSameSection(Area& other)
+{
+    if (myParams != other.myParams) {
+        return false;
+    }
+    build();
+    other.build();
+    return myHaveFace == other.myHaveFace && myHaveSolid == other.myHaveSolid
+        && isSameCurves(myArea.get(), other.myArea.get())
+        && isSameCurves(myAreaOpen.get(), other.myAreaOpen.get());
+}
+
+TopoDS_Shape Area::moveFromSection(const Area& other, const TopoDS_Shape& shape) const
+{
+    if (shape.IsNull()) {
+        return shape;
+    }
+    // Both results are made from the same planar curves, transformed by the
+    // inverse of their own section transformation in toShape()
+    gp_Trsf trsf(myTrsf.Inverted());
+    trsf.Multiply(other.myTrsf);
+    return shape.Moved(TopLoc_Location(trsf));
+}
 
+// Consecutive sections with identical curves (e.g. the levels of a straight walled
+// pocket) reuse the result of the last computed section. The operations are kept
+// sequential, because libarea applies its settings through static members.
 #define AREA_SECTION(_op, _index, ...) \
     do { \
         if (mySections.size()) { \
@@ -2233,8 +2337,17 @@ TopoDS_Shape Area::toShape(CArea& area, short fill, int reorient)
                 BRep_Builder builder; \
                 TopoDS_Compound compound; \
                 builder.MakeCompound(compound); \
+                shared_ptr<Area> last; \
+                TopoDS_Shape lastShape; \
                 for (shared_ptr<Area> area : mySections) { \
-                    const TopoDS_Shape& s = area->_op(_index, ##__VA_ARGS__); \
+                    TopoDS_Shape s; \
+                    if (last && area->isSameSection(*last)) \
+                        s = area->moveFromSection(*last, lastShape); \
+                    else { \
+                        s = area->_op(_index, ##__VA_ARGS__); \
+                        last = area; \
+                        lastShape = s; \
+                    } \
                     if (s.IsNull()) \
                         continue; \
                     builder.Add(compound, s); \
@@ -2447,6 +2560,8 @@ void Area::makeOffset(
             last_stepover = 0;
         }
     }
+    // Converts myArea to Clipper paths once for all the offsets below
+    std::unique_ptr<CAreaClipperOffset> clipperOffset;
     for (int i = 0; count < 0 || i < count; ++i, offset += stepover) {
         if (from_center) {
             areas.push_front(make_shared<CArea>());
@@ -2467,9 +2582,7 @@ void Area::makeOffset(
                 }
             }
         }
-        else
 #endif
-            area = *myArea;
 
 #ifdef AREA_OFFSET_ALGO
         switch (myParams.Algo) {
@@ -2485,13 +2598,16 @@ void Area::makeOffset(
                 break;
             case Area::AlgoClipperOffset:
 #endif
-                area.OffsetWithClipper(
-                    offset,
-                    JoinType,
-                    EndType,
-                    myParams.MiterLimit,
-                    myParams.RoundPrecision
-                );
+                if (!clipperOffset) {
+                    clipperOffset = std::make_unique<CAreaClipperOffset>(
+                        *myArea,
+                        JoinType,
+                        EndType,
+                        myParams.MiterLimit,
+                        myParams.RoundPrecision
+                    );
+                }
+                clipperOffset->Offset(offset, area);
 #ifdef AREA_OFFSET_ALGO
                 break;
         }
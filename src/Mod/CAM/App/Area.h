@@ -177,6 +177,17 @@ protected:
 
     std::list<Shape> getProjectedShapes(const gp_Trsf& trsf, bool inverse = true) const;
 
+    /** Check if this section has the same parameters and planar curves as \c other
+     *
+     * Sections of a prismatic shape are identical except for their placement, so
+     * the result of an operation on \c other can be moved to this section instead
+     * of being computed again. Both sections are built if necessary.
+     */
+    bool isSameSection(Area& other);
+
+    /** Move a \c shape made from section \c other to the plane of this section */
+    TopoDS_Shape moveFromSection(const Area& other, const TopoDS_Shape& shape) const;
+
 public:
     /** Declare all parameters defined in #AREA_PARAMS_ALL as member variable */
     PARAM_ENUM_DECLARE(AREA_PARAMS_ALL)
@@ -21,6 +21,7 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
 #include <cinttypes>
 #include <iomanip>
 #include <boost/algorithm/string.hpp>
@@ -39,6 +40,125 @@ using namespace Path;
 
 TYPESYSTEM_SOURCE(Path::Command, Base::Persistence)
 
+// CommandParameters
+
+CommandParameters::CommandParameters(const std::map<std::string, double>& parameters)
+{
+    for (const auto& [name, value] : parameters) {
+        (*this)[name] = value;
+    }
+}
+
+const std::string& CommandParameters::slotName(int slot)
+{
+    static const std::array<std::string, NumSlots> names = {"F", "I", "J", "K", "X", "Y", "Z"};
+    return names[slot];
+}
+
+std::size_t CommandParameters::lowerBound(const std::string& name) const
+{
+    auto it = std::lower_bound(extra.begin(), extra.end(), name, [](const auto& entry, const auto& n) {
+        return entry.first < n;
+    });
+    return it - extra.begin();
+}
+
+double& CommandParameters::operator[](const std::string& name)
+{
+    int slot = slotOf(name);
+    if (slot >= 0) {
+        if (!(used & (1u << slot))) {
+            used |= (1u << slot);
+            slots[slot] = 0.0;
+        }
+        return slots[slot];
+    }
+    std::size_t pos = lowerBound(name);
+    if (pos == extra.size() || extra[pos].first != name) {
+        extra.emplace(extra.begin() + pos, name, 0.0);
+    }
+    return extra[pos].second;
+}
+
+CommandParameters::iterator CommandParameters::find(const std::string& name)
+{
+    int slot = slotOf(name);
+    if (slot >= 0) {
+        if (!(used & (1u << slot))) {
+            return end();
+        }
+        // the position of the slot in the merged order
+        return {this, slot, lowerBound(name)};
+    }
+    std::size_t pos = lowerBound(name);
+    if (pos == extra.size() || extra[pos].first != name) {
+        return end();
+    }
+    // the slots sorting before the word are already passed
+    slot = nextSlot(0);
+    while (slot < NumSlots && slotName(slot) < name) {
+        slot = nextSlot(slot + 1);
+    }
+    return {this, slot, pos};
+}
+
+CommandParameters::const_iterator CommandParameters::find(const std::string& name) const
+{
+    return const_cast<CommandParameters*>(this)->find(name);
+}
+
+bool CommandParameters::contains(const std::string& name) const
+{
+    int slot = slotOf(name);
+    if (slot >= 0) {
+        return used & (1u << slot);
+    }
+    std::size_t pos = lowerBound(name);
+    return pos != extra.size() && extra[pos].first == name;
+}
+
+std::size_t CommandParameters::erase(const std::string& name)
+{
+    int slot = slotOf(name);
+    if (slot >= 0) {
+        if (!(used & (1u << slot))) {
+            return 0;
+        }
+        used &= ~(1u << slot);
+        return 1;
+    }
+    std::size_t pos = lowerBound(name);
+    if (pos == extra.size() || extra[pos].first != name) {
+        return 0;
+    }
+    extra.erase(extra.begin() + pos);
+    return 1;
+}
+
+std::size_t CommandParameters::size() const
+{
+    std::size_t count = extra.size();
+    for (int slot = 0; slot < NumSlots; ++slot) {
+        if (used & (1u << slot)) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+bool CommandParameters::operator==(const CommandParameters& other) const
+{
+    if (used != other.used || extra != other.extra) {
+        return false;
+    }
+    for (int slot = 0; slot < NumSlots; ++slot) {
+        if ((used & (1u << slot)) && slots[slot] != other.slots[slot]) {
+            return false;
+        }
+    }
+    return true;
+}
+
 // Constructors & destructors
 
 Command::Command(const char* name, const std::map<std::string, double>& parameters)
@@ -107,15 +227,21 @@ bool Command::has(const std::string& attr) const
 std::string Command::toGCode(int precision, bool padzero) const
 {
     std::stringstream str;
-    str.fill('0');
+    toGCode(str, precision, padzero);
+    return str.str();
+}
+
+void Command::toGCode(std::ostream& str, int precision, bool padzero) const
+{
+    char fill = str.fill('0');
+    std::ios_base::fmtflags flags = str.flags();
     str << Name;
     if (precision < 0) {
         precision = 0;
     }
     double scale = std::pow(10.0, precision + 1);
     std::int64_t iscale = static_cast<std::int64_t>(scale) / 10;
-    for (std::map<std::string, double>::const_iterator i = Parameters.begin(); i != Parameters.end();
-         ++i) {
+    for (auto i = Parameters.begin(); i != Parameters.end(); ++i) {
         if (i->first == "N") {
             continue;
         }
@@ -169,7 +295,8 @@ std::string Command::toGCode(int precision, bool padzero) const
         }
     }
 
-    return str.str();
+    str.fill(fill);
+    str.flags(flags);
 }
 
 void Command::setFromGCode(const std::string& str)
@@ -334,8 +461,7 @@ Command Command::transform(const Base::Placement& other)
     plac.getRotation().getYawPitchRoll(aval, bval, cval);
     Command c = Command();
     c.Name = Name;
-    for (std::map<std::string, double>::const_iterator i = Parameters.begin(); i != Parameters.end();
-         ++i) {
+    for (auto i = Parameters.begin(); i != Parameters.end(); ++i) {
         std::string k = i->first;
         double v = i->second;
         if (k == "X") {
@@ -363,8 +489,7 @@ Command Command::transform(const Base::Placement& other)
 
 void Command::scaleBy(double factor)
 {
-    for (std::map<std::string, double>::const_iterator i = Parameters.begin(); i != Parameters.end();
-         ++i) {
+    for (auto i = Parameters.begin(); i != Parameters.end(); ++i) {
         switch (i->first[0]) {
             case 'X':
             case 'Y':
@@ -374,7 +499,7 @@ void Command::scaleBy(double factor)
             case 'R':
             case 'Q':
             case 'F':
-                Parameters[i->first] = i->second * factor;
+                i->second *= factor;
                 break;
         }
     }
@@ -24,9 +24,15 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
+#include <iosfwd>
+#include <iterator>
 #include <map>
 #include <string>
+#include <utility>
 #include <variant>
+#include <vector>
 #include <Base/Persistence.h>
 #include <Base/Placement.h>
 #include <Base/Vector3D.h>
@@ -34,6 +40,198 @@
 
 namespace Path
 {
+/** The parameters of a command ordered by name, with the interface of the std::map they
+ * replace. The feed rate, the center offsets and the coordinates of the moves are stored in fixed
+ * slots and all other words in a small vector sorted by name, so that the millions of moves of a
+ * surface or adaptive toolpath don't need a tree node per parameter.
+ */
+class PathExport CommandParameters
+{
+    enum Slot
+    {
+        F,
+        I,
+        J,
+        K,
+        X,
+        Y,
+        Z,
+        NumSlots
+    };
+
+    // -1 if the name has no slot
+    static int slotOf(const std::string& name)
+    {
+        if (name.size() != 1) {
+            return -1;
+        }
+        switch (name[0]) {
+            case 'F':
+                return F;
+            case 'I':
+                return I;
+            case 'J':
+                return J;
+            case 'K':
+                return K;
+            case 'X':
+                return X;
+            case 'Y':
+                return Y;
+            case 'Z':
+                return Z;
+            default:
+                return -1;
+        }
+    }
+    static const std::string& slotName(int slot);
+
+    using Extra = std::vector<std::pair<std::string, double>>;
+
+    template<typename Params, typename Value>
+    class Iterator
+    {
+    public:
+        using value_type = std::pair<const std::string&, Value&>;
+        using reference = value_type;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::forward_iterator_tag;
+        struct pointer
+        {
+            value_type entry;
+            const value_type* operator->() const
+            {
+                return &entry;
+            }
+        };
+
+        Iterator() = default;
+        Iterator(Params* params, int slot, std::size_t extra)
+            : params(params)
+            , slot(params->nextSlot(slot))
+            , extra(extra)
+        {}
+        // a const iterator from an iterator
+        template<typename P, typename V>
+        Iterator(const Iterator<P, V>& other)  // NOLINT
+            : params(other.params)
+            , slot(other.slot)
+            , extra(other.extra)
+        {}
+
+        value_type operator*() const
+        {
+            if (isSlot()) {
+                return {slotName(slot), params->slots[slot]};
+            }
+            return {params->extra[extra].first, params->extra[extra].second};
+        }
+        pointer operator->() const
+        {
+            return {**this};
+        }
+        Iterator& operator++()
+        {
+            if (isSlot()) {
+                slot = params->nextSlot(slot + 1);
+            }
+            else {
+                ++extra;
+            }
+            return *this;
+        }
+        Iterator operator++(int)
+        {
+            Iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+        bool operator==(const Iterator& other) const
+        {
+            return slot == other.slot && extra == other.extra;
+        }
+        bool operator!=(const Iterator& other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+        // the slots and the extra words are merged in name order
+        bool isSlot() const
+        {
+            return slot < NumSlots
+                && (extra == params->extra.size() || slotName(slot) < params->extra[extra].first);
+        }
+
+        Params* params = nullptr;
+        int slot = NumSlots;
+        std::size_t extra = 0;
+
+        template<typename P, typename V>
+        friend class Iterator;
+        friend class CommandParameters;
+    };
+
+public:
+    using key_type = std::string;
+    using mapped_type = double;
+    using iterator = Iterator<CommandParameters, double>;
+    using const_iterator = Iterator<const CommandParameters, const double>;
+
+    CommandParameters() = default;
+    CommandParameters(const std::map<std::string, double>& parameters);  // NOLINT
+
+    iterator begin()
+    {
+        return {this, 0, 0};
+    }
+    iterator end()
+    {
+        return {this, NumSlots, extra.size()};
+    }
+    const_iterator begin() const
+    {
+        return {this, 0, 0};
+    }
+    const_iterator end() const
+    {
+        return {this, NumSlots, extra.size()};
+    }
+
+    double& operator[](const std::string& name);
+    iterator find(const std::string& name);
+    const_iterator find(const std::string& name) const;
+    bool contains(const std::string& name) const;
+    std::size_t erase(const std::string& name);
+    std::size_t size() const;
+    bool empty() const
+    {
+        return used == 0 && extra.empty();
+    }
+    void clear()
+    {
+        used = 0;
+        extra.clear();
+    }
+
+    bool operator==(const CommandParameters& other) const;
+
+private:
+    int nextSlot(int slot) const
+    {
+        while (slot < NumSlots && !(used & (1u << slot))) {
+            ++slot;
+        }
+        return slot;
+    }
+    // position of the first extra word not before name
+    std::size_t lowerBound(const std::string& name) const;
+
+    std::array<double, NumSlots> slots {};
+    std::uint8_t used = 0;
+    Extra extra;
+};
+
 /** The representation of a cnc command in a path */
 class PathExport Command: public Base::Persistence
 {
@@ -66,7 +264,12 @@ public:
     std::string toGCode(
         int precision = 6,
         bool padzero = true
-    ) const;                                // returns a GCode string representation of the command
+    ) const;  // returns a GCode string representation of the command
+    void toGCode(
+        std::ostream& out,
+        int precision = 6,
+        bool padzero = true
+    ) const;                                // writes the GCode representation to out
     void setFromGCode(const std::string&);  // sets the parameters from the contents of the given
                                             // GCode string
     void setFromPlacement(const Base::Placement&);  // sets the parameters from the contents of the
@@ -105,7 +308,7 @@ public:
 
     // attributes
     std::string Name;
-    std::map<std::string, double> Parameters;
+    CommandParameters Parameters;
     std::map<std::string, std::variant<std::string, double>> Annotations;
 };
 
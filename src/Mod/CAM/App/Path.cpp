@@ -22,6 +22,10 @@
  ***************************************************************************/
 
 
+#include <istream>
+#include <ostream>
+#include <sstream>
+
 #include <App/Application.h>
 #include <Base/Console.h>
 #include <Base/Reader.h>
@@ -333,69 +337,133 @@ static void bulkAddCommand(const std::string& gcodestr, std::vector<Command*>& c
     }
 }
 
-void Toolpath::setFromGCode(const std::string instr)
+namespace
 {
-    clear();
 
-    // remove comments
-    // boost::regex e("\\(.*?\\)");
-    // std::string str = boost::regex_replace(instr, e, "");
-    std::string str(instr);
+// Splits GCode text into commands, which start at a G or M word or a comment. The text can be fed
+// in chunks, the command still open at the end of a chunk is kept for the next one.
+class GCodeSplitter
+{
+public:
+    explicit GCodeSplitter(std::vector<Command*>& commands)
+        : commands(commands)
+    {}
 
-    // split input string by () or G or M commands
-    std::string mode = "command";
-    std::size_t found = str.find_first_of("(gGmM");
-    int last = -1;
-    bool inches = false;
-    while (found != std::string::npos) {
-        if (str[found] == '(') {
-            // start of comment
-            if ((last > -1) && (mode == "command")) {
-                // before opening a comment, add the last found command
-                std::string gcodestr = str.substr(last, found - last);
-                bulkAddCommand(gcodestr, vpcCommands, inches);
+    void feed(const char* data, std::size_t size)
+    {
+        buffer.append(data, size);
+        split(false);
+    }
+    void finish()
+    {
+        split(true);
+    }
+
+private:
+    void add(std::size_t start, std::size_t end)
+    {
+        bulkAddCommand(buffer.substr(start, end - start), commands, inches);
+    }
+
+    void split(bool final)
+    {
+        static const char* delimiters = "(gGmM";
+        // a kept command starts the buffer
+        std::size_t last = pending ? 0 : std::string::npos;
+        std::size_t from = pending ? 1 : 0;
+        std::size_t found = comment ? buffer.find(')', from) : buffer.find_first_of(delimiters, from);
+        while (found != std::string::npos) {
+            if (buffer[found] == '(') {
+                // start of comment
+                if (last != std::string::npos && !comment) {
+                    // before opening a comment, add the last found command
+                    add(last, found);
+                }
+                comment = true;
+                last = found;
+                found = buffer.find(')', found + 1);
+            }
+            else if (buffer[found] == ')') {
+                // end of comment
+                add(last, found + 1);
+                last = std::string::npos;
+                found = buffer.find_first_of(delimiters, found + 1);
+                comment = false;
+            }
+            else {
+                // command
+                if (last != std::string::npos) {
+                    add(last, found);
+                }
+                last = found;
+                found = buffer.find_first_of(delimiters, found + 1);
             }
-            mode = "comment";
-            last = found;
-            found = str.find_first_of(')', found + 1);
-        }
-        else if (str[found] == ')') {
-            // end of comment
-            std::string gcodestr = str.substr(last, found - last + 1);
-            bulkAddCommand(gcodestr, vpcCommands, inches);
-            last = -1;
-            found = str.find_first_of("(gGmM", found + 1);
-            mode = "command";
         }
-        else if (mode == "command") {
-            // command
-            if (last > -1) {
-                std::string gcodestr = str.substr(last, found - last);
-                bulkAddCommand(gcodestr, vpcCommands, inches);
+
+        if (final) {
+            // add the last command found, if any
+            if (last != std::string::npos && !comment) {
+                add(last, buffer.size());
             }
-            last = found;
-            found = str.find_first_of("(gGmM", found + 1);
+            buffer.clear();
+            pending = false;
         }
-    }
-    // add the last command found, if any
-    if (last > -1) {
-        if (mode == "command") {
-            std::string gcodestr = str.substr(last, std::string::npos);
-            bulkAddCommand(gcodestr, vpcCommands, inches);
+        else if (last != std::string::npos) {
+            buffer.erase(0, last);
+            pending = true;
+        }
+        else {
+            buffer.clear();
+            pending = false;
         }
     }
+
+    std::vector<Command*>& commands;
+    std::string buffer;
+    bool pending = false;
+    bool comment = false;
+    bool inches = false;
+};
+
+}  // namespace
+
+void Toolpath::setFromGCode(const std::string instr)
+{
+    clear();
+
+    // split input string by () or G or M commands
+    GCodeSplitter splitter(vpcCommands);
+    splitter.feed(instr.data(), instr.size());
+    splitter.finish();
+    recalculate();
+}
+
+void Toolpath::setFromGCode(std::istream& stream)
+{
+    clear();
+
+    GCodeSplitter splitter(vpcCommands);
+    std::vector<char> chunk(1 << 20);
+    while (stream.read(chunk.data(), chunk.size()) || stream.gcount() > 0) {
+        splitter.feed(chunk.data(), stream.gcount());
+    }
+    splitter.finish();
     recalculate();
 }
 
 std::string Toolpath::toGCode() const
 {
-    std::string result;
-    for (std::vector<Command*>::const_iterator it = vpcCommands.begin(); it != vpcCommands.end();
-         ++it) {
-        result += (*it)->toGCode();
-        result += "\n";
+    std::ostringstream result;
+    toGCode(result);
+    return result.str();
+}
+
+void Toolpath::toGCode(std::ostream& stream) const
+{
+    for (const Command* cmd : vpcCommands) {
+        cmd->toGCode(stream);
+        stream << '\n';
     }
-    return result;
 }
 
 void Toolpath::recalculate()  // recalculates the path cache
@@ -466,7 +534,8 @@ void Toolpath::recalculate()  // recalculates the path cache
 
 unsigned int Toolpath::getMemSize() const
 {
-    return toGCode().size();
+    // estimated, formatting all the GCode only to count it is too expensive for big paths
+    return vpcCommands.size() * (sizeof(Command*) + sizeof(Command));
 }
 
 void Toolpath::setCenter(const Base::Vector3d& c)
@@ -506,10 +575,8 @@ void Toolpath::Save(Writer& writer) const
 
 void Toolpath::SaveDocFile(Base::Writer& writer) const
 {
-    if (toGCode().empty()) {
-        return;
-    }
-    writer.Stream() << toGCode();
+    // written command by command, without a copy of the whole program in memory
+    toGCode(writer.Stream());
 }
 
 void Toolpath::Restore(XMLReader& reader)
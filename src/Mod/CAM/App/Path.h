@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <iosfwd>
+
 #include <Base/BoundBox.h>
 #include <Base/Persistence.h>
 #include <Base/Vector3D.h>
@@ -63,7 +65,9 @@ public:
     double getCycleTime(double, double, double, double);  // return the Cycle Time (s) of the Path
     void recalculate();                                   // recalculates the points
     void setFromGCode(const std::string);  // sets the path from the contents of the given GCode string
+    void setFromGCode(std::istream&);      // sets the path from a GCode stream, read in chunks
     std::string toGCode() const;           // gets a gcode string representation from the Path
+    void toGCode(std::ostream&) const;     // writes the gcode representation command by command
     Base::BoundBox3d getBoundBox() const;
 
     // shortcut functions
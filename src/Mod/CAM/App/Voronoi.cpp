@@ -21,6 +21,21 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
+#include <set>
+#include <unordered_map>
+
+#include <BRepAdaptor_CompCurve.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepTopAdaptor_FClass2d.hxx>
+#include <BRep_Tool.hxx>
+#include <Bnd_Box.hxx>
+#include <GCPnts_QuasiUniformDeflection.hxx>
+#include <Precision.hxx>
+#include <ShapeAnalysis_Surface.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Wire.hxx>
+
 #include <Base/Vector3D.h>
 #include <Base/Tools.h>
 
@@ -66,50 +81,28 @@ Base::Vector3d Voronoi::diagram_type::scaledVector(const vertex_type& v, double
 }
 
 
-int Voronoi::diagram_type::index(const Voronoi::diagram_type::cell_type* cell) const
+// The diagram stores its cells, edges and vertices in vectors, the index of an
+// element is its offset in there.
+template<typename T>
+static int indexIn(const std::vector<T>& elements, const T* element)
 {
-    auto it = cell_index.find(intptr_t(cell));
-    if (it == cell_index.end()) {
+    if (elements.empty() || element < elements.data() || element >= elements.data() + elements.size()) {
         return Voronoi::InvalidIndex;
     }
-    return it->second;
+    return static_cast<int>(element - elements.data());
 }
-int Voronoi::diagram_type::index(const Voronoi::diagram_type::edge_type* edge) const
+
+int Voronoi::diagram_type::index(const Voronoi::diagram_type::cell_type* cell) const
 {
-    auto it = edge_index.find(intptr_t(edge));
-    if (it == edge_index.end()) {
-        return Voronoi::InvalidIndex;
-    }
-    return it->second;
+    return indexIn(cells(), cell);
 }
-int Voronoi::diagram_type::index(const Voronoi::diagram_type::vertex_type* vertex) const
+int Voronoi::diagram_type::index(const Voronoi::diagram_type::edge_type* edge) const
 {
-    auto it = vertex_index.find(intptr_t(vertex));
-    if (it == vertex_index.end()) {
-        return Voronoi::InvalidIndex;
-    }
-    return it->second;
+    return indexIn(edges(), edge);
 }
-
-void Voronoi::diagram_type::reIndex()
+int Voronoi::diagram_type::index(const Voronoi::diagram_type::vertex_type* vertex) const
 {
-    int idx = 0;
-    cell_index.clear();
-    edge_index.clear();
-    vertex_index.clear();
-
-    idx = 0;
-    for (auto it = cells().begin(); it != cells().end(); ++it, ++idx) {
-        cell_index[intptr_t(&(*it))] = idx;
-    }
-    idx = 0;
-    for (auto it = edges().begin(); it != edges().end(); ++it, ++idx) {
-        edge_index[intptr_t(&(*it))] = idx;
-    }
-    idx = 0;
-    for (auto it = vertices().begin(); it != vertices().end(); ++it, ++idx) {
-        vertex_index[intptr_t(&(*it))] = idx;
-    }
+    return indexIn(vertices(), vertex);
 }
 
 Voronoi::point_type Voronoi::diagram_type::retrievePoint(
@@ -138,6 +131,29 @@ Voronoi::segment_type Voronoi::diagram_type::retrieveSegment(
     return segments[index];
 }
 
+bool Voronoi::diagram_type::isPointOnSegment(
+    const Voronoi::point_type& point,
+    const Voronoi::segment_type& segment
+) const
+{
+    auto matches = [this](const Voronoi::point_type& p0, const Voronoi::point_type& p1) {
+        return 1e-6 > std::hypot(p0.x() - p1.x(), p0.y() - p1.y()) / scale;
+    };
+    return matches(point, low(segment)) || matches(point, high(segment));
+}
+
+bool Voronoi::diagram_type::isBorderline(const Voronoi::diagram_type::edge_type* edge) const
+{
+    if (edge->is_linear()) {
+        return false;
+    }
+    const cell_type* pointCell = edge->cell()->contains_point() ? edge->cell()
+                                                                : edge->twin()->cell();
+    const cell_type* segmentCell = edge->cell()->contains_point() ? edge->twin()->cell()
+                                                                  : edge->cell();
+    return isPointOnSegment(retrievePoint(pointCell), retrieveSegment(segmentCell));
+}
+
 
 // Voronoi
 
@@ -167,6 +183,41 @@ void Voronoi::addSegment(const Voronoi::segment_type& s)
     vd->segments.emplace_back(pil, pih);
 }
 
+void Voronoi::addWire(const TopoDS_Wire& wire, double deflection)
+{
+    BRepAdaptor_CompCurve adapt(wire);
+    GCPnts_QuasiUniformDeflection discretizer(
+        adapt,
+        deflection,
+        adapt.FirstParameter(),
+        adapt.LastParameter()
+    );
+    std::vector<point_type> pts;
+    pts.reserve(discretizer.NbPoints() + 1);
+    for (int i = 1; i <= discretizer.NbPoints(); ++i) {
+        gp_Pnt p = discretizer.Value(i);
+        pts.emplace_back(p.X(), p.Y());
+    }
+    if (pts.empty()) {
+        return;
+    }
+    // If the discretizer aimed for the start point and missed it by a little bit,
+    // closing the polygon as is could result in a self-intersecting polygon after
+    // scaling the coordinates. Drop the last point and let the closing segment
+    // end at the start point instead, see issue 8064
+    if (pts.size() > 1
+        && std::hypot(pts.back().x() - pts.front().x(), pts.back().y() - pts.front().y())
+            < Precision::Confusion()) {
+        pts.pop_back();
+    }
+    pts.push_back(pts.front());
+
+    vd->segments.reserve(vd->segments.size() + pts.size() - 1);
+    for (std::size_t i = 0; i + 1 < pts.size(); ++i) {
+        addSegment(segment_type(pts[i], pts[i + 1]));
+    }
+}
+
 long Voronoi::numPoints() const
 {
     return vd->points.size();
@@ -203,7 +254,6 @@ void Voronoi::construct()
         vd->segments.end(),
         static_cast<voronoi_diagram_type*>(vd)
     );
-    vd->reIndex();
 }
 
 void Voronoi::colorExterior(const Voronoi::diagram_type::edge_type* edge, std::size_t colorValue)
@@ -235,6 +285,86 @@ void Voronoi::colorExterior(Voronoi::color_type color)
     }
 }
 
+void Voronoi::colorExterior(
+    Voronoi::color_type color,
+    const std::function<bool(const Voronoi::vertex_type*)>& isExterior
+)
+{
+    colorExterior(color);
+
+    std::unordered_map<const vertex_type*, bool> cache;
+    auto exterior = [&](const vertex_type* v) {
+        if (v->color()) {
+            return false;
+        }
+        auto it = cache.find(v);
+        if (it == cache.end()) {
+            it = cache.emplace(v, isExterior(v)).first;
+        }
+        return it->second;
+    };
+
+    std::map<int32_t, std::set<int32_t>> pts;
+    for (auto e = vd->edges().begin(); e != vd->edges().end(); ++e) {
+        if (e->is_finite() && e->color() == 0) {
+            const vertex_type* v0 = e->vertex0();
+            const vertex_type* v1 = e->vertex1();
+            if (exterior(v0) && exterior(v1)) {
+                colorExterior(&(*e), color);
+            }
+            else if (exterior(v1)) {
+                if (pts.empty()) {
+                    for (auto s = vd->segments.begin(); s != vd->segments.end(); ++s) {
+                        pts[low(*s).x()].insert(low(*s).y());
+                        pts[high(*s).x()].insert(high(*s).y());
+                    }
+                }
+                auto ys = pts.find(int32_t(v0->x()));
+                if (ys != pts.end() && ys->second.find(v0->y()) != ys->second.end()) {
+                    colorExterior(&(*e), color);
+                }
+            }
+        }
+    }
+}
+
+void Voronoi::colorExterior(Voronoi::color_type color, const TopoDS_Face& face)
+{
+    // the classifier and the surface analysis are set up once for all vertices
+    BRepTopAdaptor_FClass2d classifier(face, Precision::Confusion());
+    ShapeAnalysis_Surface surface(BRep_Tool::Surface(face));
+    Bnd_Box bounds;
+    BRepBndLib::Add(face, bounds);
+    bounds.SetGap(0.0);
+    double z = bounds.CornerMin().Z();
+
+    colorExterior(color, [&](const vertex_type* v) {
+        Base::Vector3d p = vd->scaledVector(*v, z);
+        gp_Pnt2d uv = surface.ValueOfUV(gp_Pnt(p.x, p.y, p.z), Precision::Confusion());
+        TopAbs_State state = classifier.Perform(uv);
+        return state != TopAbs_ON && state != TopAbs_IN;
+    });
+}
+
+void Voronoi::colorPrimary(
+    Voronoi::color_type primary,
+    Voronoi::color_type secondary,
+    Voronoi::color_type borderline
+)
+{
+    for (diagram_type::const_edge_iterator it = vd->edges().begin(); it != vd->edges().end(); ++it) {
+        if (!it->is_primary()) {
+            it->color(secondary);
+        }
+        else if (vd->isBorderline(&(*it))) {
+            it->color(borderline);
+        }
+        else {
+            it->color(primary);
+        }
+    }
+}
+
 void Voronoi::colorTwins(Voronoi::color_type color)
 {
     for (diagram_type::const_edge_iterator it = vd->edges().begin(); it != vd->edges().end(); ++it) {
@@ -336,3 +466,90 @@ void Voronoi::resetColor(Voronoi::color_type color)
         }
     }
 }
+
+std::vector<Voronoi::wire_type> Voronoi::wires(Voronoi::color_type color) const
+{
+    using edge_type = diagram_type::edge_type;
+
+    // edges of the given color at each of their vertices, vertices in order of appearance
+    std::vector<const vertex_type*> order;
+    std::unordered_map<const vertex_type*, std::vector<const edge_type*>> incident;
+    for (auto it = vd->edges().begin(); it != vd->edges().end(); ++it) {
+        if (it->color() != color) {
+            continue;
+        }
+        for (const vertex_type* v : {it->vertex0(), it->vertex1()}) {
+            if (!v) {
+                continue;
+            }
+            auto& edges = incident[v];
+            if (edges.empty()) {
+                order.push_back(v);
+            }
+            edges.push_back(&(*it));
+        }
+    }
+
+    // knots are the start and end points of a wire
+    std::vector<const vertex_type*> knots;
+    for (const vertex_type* v : order) {
+        if (incident[v].size() == 1) {
+            knots.push_back(v);
+        }
+    }
+    for (const vertex_type* v : order) {
+        if (incident[v].size() > 2) {
+            knots.push_back(v);
+        }
+    }
+    if (knots.empty() && !order.empty()) {
+        knots.push_back(order.front());
+    }
+
+    // removes the edge from the vertex and returns true if that was its last edge
+    auto consume = [&](const vertex_type* v, const edge_type* edge) {
+        auto& edges = incident[v];
+        edges.erase(std::remove(edges.begin(), edges.end(), edge), edges.end());
+        return edges.empty();
+    };
+    auto removeKnot = [&](const vertex_type* v) {
+        knots.erase(std::remove(knots.begin(), knots.end(), v), knots.end());
+    };
+
+    std::vector<wire_type> result;
+    while (!knots.empty()) {
+        const vertex_type* first = knots.front();
+        const vertex_type* last = first;
+        if (!incident[first].empty()) {
+            wire_type wire;
+            const vertex_type* start = first;
+            while (start) {
+                last = start;
+                auto& edges = incident[start];
+                if (edges.empty()) {
+                    break;
+                }
+                const edge_type* edge = edges.front();
+                const vertex_type* end = nullptr;
+                if (start == edge->vertex0()) {
+                    end = edge->vertex1();
+                    wire.push_back(edge);
+                }
+                else {
+                    end = edge->vertex0();
+                    wire.push_back(edge->twin());
+                }
+                consume(start, edge);
+                start = consume(end, edge) ? nullptr : end;
+            }
+            result.push_back(std::move(wire));
+        }
+        if (incident[first].empty()) {
+            removeKnot(first);
+        }
+        if (incident[last].empty()) {
+            removeKnot(last);
+        }
+    }
+    return result;
+}
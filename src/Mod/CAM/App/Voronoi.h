@@ -22,6 +22,7 @@
  ***************************************************************************/
 #pragma once
 
+#include <functional>
 #include <limits>
 #include <map>
 #include <vector>
@@ -33,6 +34,8 @@
 #include <boost/polygon/polygon.hpp>
 #include <boost/polygon/voronoi.hpp>
 
+class TopoDS_Face;
+class TopoDS_Wire;
 
 namespace Path
 {
@@ -68,16 +71,10 @@ public:
         Base::Vector3d scaledVector(const point_type& p, double z) const;
         Base::Vector3d scaledVector(const vertex_type& v, double z) const;
 
-        using cell_map_type = std::map<intptr_t, int>;
-        using edge_map_type = std::map<intptr_t, int>;
-        using vertex_map_type = std::map<intptr_t, int>;
-
         int index(const cell_type* cell) const;
         int index(const edge_type* edge) const;
         int index(const vertex_type* vertex) const;
 
-        void reIndex();
-
         std::vector<point_type> points;
         std::vector<segment_type> segments;
 
@@ -88,15 +85,20 @@ public:
         double angleOfSegment(int i, angle_map_t* angle = nullptr) const;
         bool segmentsAreConnected(int i, int j) const;
 
+        bool isPointOnSegment(const point_type& point, const segment_type& segment) const;
+        // curved edge between a segment and one of its own end points
+        bool isBorderline(const edge_type* edge) const;
+
     private:
         double scale;
-        cell_map_type cell_index;
-        edge_map_type edge_index;
-        vertex_map_type vertex_index;
     };
 
+    using wire_type = std::vector<const diagram_type::edge_type*>;
+
     void addPoint(const point_type& p);
     void addSegment(const segment_type& p);
+    // adds the closed polygon of the discretized wire as segments
+    void addWire(const TopoDS_Wire& wire, double deflection);
     long numPoints() const;
     long numSegments() const;
 
@@ -106,10 +108,16 @@ public:
     long numVertices() const;
 
     void resetColor(color_type color);
+    void colorPrimary(color_type primary, color_type secondary, color_type borderline);
     void colorExterior(color_type color);
+    void colorExterior(color_type color, const std::function<bool(const vertex_type*)>& isExterior);
+    void colorExterior(color_type color, const TopoDS_Face& face);
     void colorTwins(color_type color);
     void colorColinear(color_type color, double degree);
 
+    // chains of connected edges of the given color, edges are oriented along their wire
+    std::vector<wire_type> wires(color_type color) const;
+
     template<typename T>
     T* create(int index)
     {
@@ -44,12 +44,26 @@ class Voronoi(BaseClass):
         """add given segment to input collection"""
         ...
 
+    def addWires(self, wires: Any, deflection: float = 0.01, /) -> None:
+        """addWires(wires, [deflection=0.01]): discretize the wires of the given shape (or list of shapes)
+        and add their closed polygons as segments to the input collection"""
+        ...
+
     def construct(self) -> Any:
         """constructs the voronoi diagram from the input collections"""
         ...
 
     def colorExterior(self) -> Any:
-        """assign given color to all exterior edges and vertices"""
+        """assign given color to all exterior edges and vertices
+
+        The optional second argument is either a callable, which is called for each vertex and
+        returns True if it is exterior, or a face, outside of which vertices are exterior"""
+        ...
+
+    def colorPrimary(self) -> Any:
+        """colorPrimary(primary, secondary, borderline): assign the first color to primary edges,
+        the second to secondary edges and the third to curved primary edges between a segment and
+        one of its own end points"""
         ...
 
     def colorTwins(self) -> Any:
@@ -64,6 +78,12 @@ class Voronoi(BaseClass):
         """assign color 0 to all elements with the given color"""
         ...
 
+    @constmethod
+    def getWires(self) -> Any:
+        """getWires(color): Get list of wires, each a list of connected edges of the given color
+        oriented along the wire."""
+        ...
+
     @constmethod
     def getPoints(self) -> Any:
         """Get list of all input points."""
@@ -188,16 +188,6 @@ bool retrieveDistances(const VoronoiEdge* edge, Py::List* list)
     return false;
 }
 
-bool pointsMatch(const Voronoi::point_type& p0, const Voronoi::point_type& p1, double scale)
-{
-    return 1e-6 > distanceBetween(p0, p1, scale);
-}
-
-bool isPointOnSegment(const Voronoi::point_type& point, const Voronoi::segment_type& segment, double scale)
-{
-    return pointsMatch(point, low(segment), scale) || pointsMatch(point, high(segment), scale);
-}
-
 template<typename T>
 PyObject* makeLineSegment(const VoronoiEdge* e, const T& p0, double z0, const T& p1, double z1)
 {
@@ -451,18 +441,7 @@ PyObject* VoronoiEdgePy::isSecondary(PyObject* args) const
 PyObject* VoronoiEdgePy::isBorderline(PyObject* args) const
 {
     VoronoiEdge* e = getVoronoiEdgeFromPy(this, args);
-    PyObject* chk = Py_False;
-    if (e->isBound() && !e->ptr->is_linear()) {
-        Voronoi::point_type point = e->ptr->cell()->contains_point()
-            ? e->dia->retrievePoint(e->ptr->cell())
-            : e->dia->retrievePoint(e->ptr->twin()->cell());
-        Voronoi::segment_type segment = e->ptr->cell()->contains_point()
-            ? e->dia->retrieveSegment(e->ptr->twin()->cell())
-            : e->dia->retrieveSegment(e->ptr->cell());
-        if (isPointOnSegment(point, segment, e->dia->getScale())) {
-            chk = Py_True;
-        }
-    }
+    PyObject* chk = e->isBound() && e->dia->isBorderline(e->ptr) ? Py_True : Py_False;
     Py_INCREF(chk);
     return chk;
 }
@@ -552,7 +531,7 @@ PyObject* VoronoiEdgePy::toShape(PyObject* args) const
             // the location is the mid point between the normal on the segment through point
             // this is only the mid point of the segment if the parabola is symmetric
 
-            if (isPointOnSegment(point, segment, e->dia->getScale())) {
+            if (e->dia->isPointOnSegment(point, segment)) {
                 return makeLineSegment(e, low(segment), z0, high(segment), z1);
             }
 
@@ -22,9 +22,13 @@
  ***************************************************************************/
 
 
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+
 #include "Base/GeometryPyCXX.h"
 #include "Base/Vector3D.h"
 #include "Base/VectorPy.h"
+#include "Mod/Part/App/TopoShapePy.h"
 
 #include "VoronoiPy.h"
 #include "VoronoiPy.cpp"
@@ -109,6 +113,44 @@ PyObject* VoronoiPy::addSegment(PyObject* args)
     return Py_None;
 }
 
+static void addWiresFromPy(Voronoi* vo, PyObject* obj, double deflection)
+{
+    if (PyObject_TypeCheck(obj, &Part::TopoShapePy::Type)) {
+        const TopoDS_Shape& shape = static_cast<Part::TopoShapePy*>(obj)->getTopoShapePtr()->getShape();
+        for (TopExp_Explorer xp(shape, TopAbs_WIRE); xp.More(); xp.Next()) {
+            vo->addWire(TopoDS::Wire(xp.Current()), deflection);
+        }
+        return;
+    }
+    if (PySequence_Check(obj)) {
+        Py::Sequence list(obj);
+        for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
+            if (!PyObject_TypeCheck((*it).ptr(), &Part::TopoShapePy::Type)) {
+                throw Py::TypeError("Wires must be a shape or a list of shapes");
+            }
+            addWiresFromPy(vo, (*it).ptr(), deflection);
+        }
+        return;
+    }
+    throw Py::TypeError("Wires must be a shape or a list of shapes");
+}
+
+PyObject* VoronoiPy::addWires(PyObject* args)
+{
+    PyObject* obj = nullptr;
+    double deflection = 0.01;
+    if (!PyArg_ParseTuple(args, "O|d", &obj, &deflection)) {
+        return nullptr;
+    }
+    if (deflection <= 0) {
+        throw Py::ValueError("deflection must be positive");
+    }
+    addWiresFromPy(getVoronoiPtr(), obj, deflection);
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
 PyObject* VoronoiPy::construct(PyObject* args)
 {
     if (!PyArg_ParseTuple(args, "")) {
@@ -171,25 +213,28 @@ Py::List VoronoiPy::getCells() const
     return list;
 }
 
-using exterior_map_t = std::map<uintptr_t, bool>;
-using coordinate_map_t = std::map<int32_t, std::set<int32_t>>;
-
-#define VORONOI_USE_EXTERIOR_CACHE 1
-
-static bool callbackWithVertex(
-    Voronoi::diagram_type* dia,
-    PyObject* callback,
-    const Voronoi::diagram_type::vertex_type* v,
-    bool& bail,
-    exterior_map_t& cache
-)
+PyObject* VoronoiPy::colorExterior(PyObject* args)
 {
-    bool rc = false;
-    if (!bail && v->color() == 0) {
-#if VORONOI_USE_EXTERIOR_CACHE
-        auto it = cache.find(uintptr_t(v));
-        if (it == cache.end()) {
-#endif
+    Voronoi::color_type color = 0;
+    PyObject* callback = nullptr;
+    if (!PyArg_ParseTuple(args, "k|O", &color, &callback)) {
+        throw Py::RuntimeError("colorExterior requires an integer (color) argument");
+    }
+    Voronoi* vo = getVoronoiPtr();
+    if (!callback) {
+        vo->colorExterior(color);
+    }
+    else if (PyObject_TypeCheck(callback, &Part::TopoShapePy::Type)) {
+        const TopoDS_Shape& shape
+            = static_cast<Part::TopoShapePy*>(callback)->getTopoShapePtr()->getShape();
+        if (shape.IsNull() || shape.ShapeType() != TopAbs_FACE) {
+            throw Py::TypeError("colorExterior requires a face or a callable");
+        }
+        vo->colorExterior(color, TopoDS::Face(shape));
+    }
+    else {
+        Voronoi::diagram_type* dia = vo->vd;
+        vo->colorExterior(color, [dia, callback](const Voronoi::vertex_type* v) {
             PyObject* vx = new VoronoiVertexPy(new VoronoiVertex(dia, v));
             PyObject* arglist = Py_BuildValue("(O)", vx);
             PyObject* result = PyObject_CallObject(callback, arglist);
@@ -197,67 +242,51 @@ static bool callbackWithVertex(
             Py_DECREF(arglist);
             Py_DECREF(vx);
             if (!result) {
-                bail = true;
+                throw Py::Exception();
             }
-            else {
-                rc = result == Py_True;
-                Py_DECREF(result);
-                cache.insert(exterior_map_t::value_type(uintptr_t(v), rc));
-            }
-#if VORONOI_USE_EXTERIOR_CACHE
-        }
-        else {
-            rc = it->second;
-        }
-#else
-        (void)cache;
-#endif
+            bool rc = result == Py_True;
+            Py_DECREF(result);
+            return rc;
+        });
     }
-    return rc;
+
+    Py_INCREF(Py_None);
+    return Py_None;
 }
 
-PyObject* VoronoiPy::colorExterior(PyObject* args)
+PyObject* VoronoiPy::colorPrimary(PyObject* args)
+{
+    Voronoi::color_type primary = 0;
+    Voronoi::color_type secondary = 0;
+    Voronoi::color_type borderline = 0;
+    if (!PyArg_ParseTuple(args, "kkk", &primary, &secondary, &borderline)) {
+        throw Py::RuntimeError(
+            "colorPrimary requires three integer (primary, secondary and borderline color) "
+            "arguments"
+        );
+    }
+    getVoronoiPtr()->colorPrimary(primary, secondary, borderline);
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+PyObject* VoronoiPy::getWires(PyObject* args) const
 {
     Voronoi::color_type color = 0;
-    PyObject* callback = nullptr;
-    if (!PyArg_ParseTuple(args, "k|O", &color, &callback)) {
-        throw Py::RuntimeError("colorExterior requires an integer (color) argument");
+    if (!PyArg_ParseTuple(args, "k", &color)) {
+        throw Py::RuntimeError("getWires requires an integer (color) argument");
     }
     Voronoi* vo = getVoronoiPtr();
-    vo->colorExterior(color);
-    if (callback) {
-        exterior_map_t cache;
-        coordinate_map_t pts;
-        for (auto e = vo->vd->edges().begin(); e != vo->vd->edges().end(); ++e) {
-            if (e->is_finite() && e->color() == 0) {
-                const Voronoi::diagram_type::vertex_type* v0 = e->vertex0();
-                const Voronoi::diagram_type::vertex_type* v1 = e->vertex1();
-                bool bail = false;
-                if (callbackWithVertex(vo->vd, callback, v0, bail, cache)
-                    && callbackWithVertex(vo->vd, callback, v1, bail, cache)) {
-                    vo->colorExterior(&(*e), color);
-                }
-                else if (!bail && callbackWithVertex(vo->vd, callback, v1, bail, cache)) {
-                    if (pts.empty()) {
-                        for (auto s = vo->vd->segments.begin(); s != vo->vd->segments.end(); ++s) {
-                            pts[low(*s).x()].insert(low(*s).y());
-                            pts[high(*s).x()].insert(high(*s).y());
-                        }
-                    }
-                    auto ys = pts.find(int32_t(v0->x()));
-                    if (ys != pts.end() && ys->second.find(v0->y()) != ys->second.end()) {
-                        vo->colorExterior(&(*e), color);
-                    }
-                }
-                if (bail) {
-                    return nullptr;
-                }
-            }
+    Py::List list;
+    for (const Voronoi::wire_type& wire : vo->wires(color)) {
+        Py::List edges;
+        for (const Voronoi::diagram_type::edge_type* edge : wire) {
+            edges.append(Py::asObject(new VoronoiEdgePy(new VoronoiEdge(vo->vd, edge))));
         }
+        list.append(edges);
     }
-
-    Py_INCREF(Py_None);
-    return Py_None;
+    return Py::new_reference_to(list);
 }
 
 PyObject* VoronoiPy::colorTwins(PyObject* args)
@@ -26,6 +26,11 @@
 #include <limits>
 #include <cmath>
 #include <algorithm>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <numeric>
+#include <thread>
 #include <Base/Precision.h>
 
 namespace
@@ -65,50 +70,21 @@ double distSquared(const TSPPoint& a, const TSPPoint& b)
 }
 
 /**
- * @brief Core TSP solver implementation using nearest neighbor + iterative improvement
+ * @brief Build and optimize the route of a small point set
  *
- * Algorithm steps:
- * 1. Add temporary start/end points if specified
- * 2. Build initial route using nearest neighbor heuristic
- * 3. Optimize route with 2-opt and relocation moves
- * 4. Remove temporary points and map back to original indices
+ * Nearest neighbor construction and exhaustive 2-opt and relocation passes, see solve_impl().
  *
- * @param points Input points to visit
- * @param startPoint Optional starting location constraint
- * @param endPoint Optional ending location constraint
- * @return Vector of indices representing optimized visit order
+ * @param pts Points including the temporary start (and end) point
+ * @param tempEndIdx Index of the temporary end point, or -1
+ * @param deadline Stop improving the route after this time
+ * @return Visit order of all points in pts
  */
-std::vector<int> solve_impl(
-    const std::vector<TSPPoint>& points,
-    const TSPPoint* startPoint,
-    const TSPPoint* endPoint
+std::vector<int> solveSmall(
+    const std::vector<TSPPoint>& pts,
+    int tempEndIdx,
+    std::chrono::steady_clock::time_point deadline
 )
 {
-    // ========================================================================
-    // STEP 1: Prepare point set with temporary start/end markers
-    // ========================================================================
-    // We insert temporary points to enforce start/end constraints.
-    // These will be removed after optimization and won't appear in final result.
-    std::vector<TSPPoint> pts = points;
-    int tempStartIdx = -1, tempEndIdx = -1;
-
-    if (startPoint) {
-        // Insert user-specified start point at beginning
-        pts.insert(pts.begin(), TSPPoint(startPoint->x, startPoint->y));
-        tempStartIdx = 0;
-    }
-    else if (!pts.empty()) {
-        // No start specified: duplicate first point as anchor
-        pts.insert(pts.begin(), TSPPoint(pts[0].x, pts[0].y));
-        tempStartIdx = 0;
-    }
-
-    if (endPoint) {
-        // Add user-specified end point at the end
-        pts.push_back(TSPPoint(endPoint->x, endPoint->y));
-        tempEndIdx = static_cast<int>(pts.size()) - 1;
-    }
-
     // ========================================================================
     // STEP 2: Build initial route using Nearest Neighbor algorithm
     // ========================================================================
@@ -191,7 +167,7 @@ std::vector<int> solve_impl(
     size_t limitRelocationJ = route.size() - 1;
     int lastImprovementAtStep = 0;
 
-    while (true) {
+    while (std::chrono::steady_clock::now() < deadline) {
 
         // --- 2-Opt Optimization ---
         // Try reversing every possible segment of the route.
@@ -335,6 +311,603 @@ std::vector<int> solve_impl(
         }
     }
 
+    return route;
+}
+
+/// Point count above which the spatial index backed solver is used
+constexpr size_t LARGE_PROBLEM_SIZE = 500;
+
+/// Number of nearest neighbors considered for every point by the large problem improvement
+constexpr size_t NEIGHBOR_COUNT = 10;
+
+/**
+ * @brief Uniform grid over a point set for nearest neighbor queries
+ *
+ * Points are bucketed into square cells holding about two points each and stored cell by cell
+ * in one array. Points can be removed from the grid, which keeps track of the points not yet
+ * visited while building the initial route.
+ */
+class PointGrid
+{
+public:
+    PointGrid(const std::vector<TSPPoint>& pts, const std::vector<int>& indices)
+        : pts(pts)
+        , slot(pts.size(), -1)
+        , remaining(indices.size())
+    {
+        double minX = std::numeric_limits<double>::max();
+        double minY = minX;
+        double maxX = std::numeric_limits<double>::lowest();
+        double maxY = maxX;
+        for (int i : indices) {
+            minX = std::min(minX, pts[i].x);
+            minY = std::min(minY, pts[i].y);
+            maxX = std::max(maxX, pts[i].x);
+            maxY = std::max(maxY, pts[i].y);
+        }
+        originX = minX;
+        originY = minY;
+
+        // Aim for about two points per cell, collinear points get a single row or column
+        double width = maxX - minX;
+        double height = maxY - minY;
+        double count = std::max(1.0, static_cast<double>(indices.size()));
+        if (width * height > 0.0) {
+            cellSize = std::sqrt(2.0 * width * height / count);
+        }
+        else {
+            cellSize = 2.0 * std::max(width, height) / count;
+        }
+        if (!(cellSize > 0.0)) {
+            cellSize = 1.0;
+        }
+        columns = static_cast<int>(width / cellSize) + 1;
+        rows = static_cast<int>(height / cellSize) + 1;
+
+        size_t cells = static_cast<size_t>(columns) * rows;
+        cellStart.assign(cells + 1, 0);
+        cellFill.assign(cells, 0);
+        for (int i : indices) {
+            ++cellStart[cellOf(pts[i]) + 1];
+        }
+        for (size_t c = 0; c < cells; ++c) {
+            cellStart[c + 1] += cellStart[c];
+        }
+        cellPoints.resize(indices.size());
+        for (int i : indices) {
+            int c = cellOf(pts[i]);
+            int s = cellStart[c] + cellFill[c]++;
+            cellPoints[s] = i;
+            slot[i] = s;
+        }
+    }
+
+    size_t size() const
+    {
+        return remaining;
+    }
+
+    size_t cellCount() const
+    {
+        return cellFill.size();
+    }
+
+    /// Remove point i from the grid, later searches won't report it
+    void remove(int i)
+    {
+        int c = cellOf(pts[i]);
+        int last = cellStart[c] + --cellFill[c];
+        int moved = cellPoints[last];
+        cellPoints[slot[i]] = moved;
+        slot[moved] = slot[i];
+        cellPoints[last] = i;
+        slot[i] = -1;
+        --remaining;
+    }
+
+    /// Points not removed from the grid
+    std::vector<int> points() const
+    {
+        std::vector<int> result;
+        result.reserve(remaining);
+        for (size_t c = 0; c < cellFill.size(); ++c) {
+            auto begin = cellPoints.begin() + cellStart[c];
+            result.insert(result.end(), begin, begin + cellFill[c]);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Visit the points in growing rings of cells around p
+     *
+     * visit(i) is called for every point of the cells at ring distance r, then done(covered)
+     * is asked whether the search can stop, where covered is the squared distance from p
+     * within which all points have been visited.
+     */
+    template<typename Visit, typename Done>
+    void search(const TSPPoint& p, Visit visit, Done done) const
+    {
+        auto visitCell = [&](int x, int y) {
+            int c = y * columns + x;
+            for (int s = cellStart[c]; s < cellStart[c] + cellFill[c]; ++s) {
+                visit(cellPoints[s]);
+            }
+        };
+
+        int cx = columnOf(p);
+        int cy = rowOf(p);
+        // Distance from p to the border of its own cell, the rings grow from there
+        double border = std::min(
+            {p.x - originX - cx * cellSize,
+             originX + (cx + 1) * cellSize - p.x,
+             p.y - originY - cy * cellSize,
+             originY + (cy + 1) * cellSize - p.y}
+        );
+        border = std::max(border, 0.0);
+        int maxRing = std::max({cx, cy, columns - 1 - cx, rows - 1 - cy});
+        for (int r = 0; r <= maxRing; ++r) {
+            int xMin = std::max(cx - r, 0);
+            int xMax = std::min(cx + r, columns - 1);
+            for (int y = std::max(cy - r, 0); y <= std::min(cy + r, rows - 1); ++y) {
+                if (y == cy - r || y == cy + r) {
+                    for (int x = xMin; x <= xMax; ++x) {
+                        visitCell(x, y);
+                    }
+                    continue;
+                }
+                if (cx - r >= 0) {
+                    visitCell(cx - r, y);
+                }
+                if (cx + r < columns) {
+                    visitCell(cx + r, y);
+                }
+            }
+            double covered = border + r * cellSize;
+            if (r == maxRing || done(covered * covered)) {
+                return;
+            }
+        }
+    }
+
+private:
+    int columnOf(const TSPPoint& p) const
+    {
+        return std::clamp(static_cast<int>((p.x - originX) / cellSize), 0, columns - 1);
+    }
+
+    int rowOf(const TSPPoint& p) const
+    {
+        return std::clamp(static_cast<int>((p.y - originY) / cellSize), 0, rows - 1);
+    }
+
+    int cellOf(const TSPPoint& p) const
+    {
+        return rowOf(p) * columns + columnOf(p);
+    }
+
+    const std::vector<TSPPoint>& pts;
+    double originX = 0.0;
+    double originY = 0.0;
+    double cellSize = 1.0;
+    int columns = 1;
+    int rows = 1;
+    std::vector<int> cellStart;   // First slot of every cell in cellPoints
+    std::vector<int> cellFill;    // Number of points left in every cell
+    std::vector<int> cellPoints;  // Point indices, cell by cell
+    std::vector<int> slot;        // Position of every point in cellPoints, -1 if removed
+    size_t remaining;
+};
+
+/**
+ * @brief Build the initial route of a large point set with the nearest neighbor heuristic
+ *
+ * Same greedy choice and tie-breaking as solveSmall(), but the nearest unvisited point is
+ * looked up in a PointGrid, which is rebuilt over the remaining points whenever most of its
+ * cells got empty.
+ */
+std::vector<int> nearestNeighborRoute(const std::vector<TSPPoint>& pts, int tempEndIdx)
+{
+    std::vector<int> unvisited;
+    unvisited.reserve(pts.size());
+    for (size_t i = 1; i < pts.size(); ++i) {
+        if (static_cast<int>(i) != tempEndIdx) {
+            unvisited.push_back(static_cast<int>(i));
+        }
+    }
+    auto grid = std::make_unique<PointGrid>(pts, unvisited);
+
+    std::vector<int> route;
+    route.reserve(pts.size());
+    route.push_back(0);
+    while (grid->size() > 0) {
+        if (grid->size() * 8 < grid->cellCount()) {
+            grid = std::make_unique<PointGrid>(pts, grid->points());
+        }
+
+        const TSPPoint& current = pts[route.back()];
+        double minDist = std::numeric_limits<double>::max();
+        int next = -1;
+        double nextYDiff = std::numeric_limits<double>::max();
+        grid->search(
+            current,
+            [&](int i) {
+                double d = distSquared(current, pts[i]);
+                double yDiff = std::abs(pts[route.front()].y - pts[i].y);
+                if (d > minDist + 0.1) {
+                    return;
+                }
+                if (d < minDist - 0.1 || yDiff < nextYDiff) {
+                    minDist = d;
+                    next = i;
+                    nextYDiff = yDiff;
+                }
+            },
+            [&](double covered) { return next != -1 && covered > minDist + 0.1; }
+        );
+
+        route.push_back(next);
+        grid->remove(next);
+    }
+
+    if (tempEndIdx != -1) {
+        route.push_back(tempEndIdx);
+    }
+    return route;
+}
+
+/**
+ * @brief Find the nearest neighbors of every point
+ *
+ * The points are split into chunks searched concurrently.
+ *
+ * @return NEIGHBOR_COUNT (or fewer) neighbor indices per point, nearest first
+ */
+std::vector<std::vector<int>> nearestNeighbors(const std::vector<TSPPoint>& pts)
+{
+    std::vector<int> all(pts.size());
+    std::iota(all.begin(), all.end(), 0);
+    const PointGrid grid(pts, all);
+    std::vector<std::vector<int>> neighbors(pts.size());
+
+    auto findNeighbors = [&](size_t begin, size_t end) {
+        std::vector<std::pair<double, int>> best;
+        for (size_t i = begin; i < end; ++i) {
+            best.clear();
+            grid.search(
+                pts[i],
+                [&](int j) {
+                    if (j == static_cast<int>(i)) {
+                        return;
+                    }
+                    double d = distSquared(pts[i], pts[j]);
+                    if (best.size() == NEIGHBOR_COUNT && d >= best.back().first) {
+                        return;
+                    }
+                    if (best.size() == NEIGHBOR_COUNT) {
+                        best.pop_back();
+                    }
+                    best.insert(std::upper_bound(best.begin(), best.end(), std::pair(d, j)), {d, j});
+                },
+                [&](double covered) {
+                    return best.size() == NEIGHBOR_COUNT && covered > best.back().first;
+                }
+            );
+            neighbors[i].reserve(best.size());
+            for (const auto& entry : best) {
+                neighbors[i].push_back(entry.second);
+            }
+        }
+    };
+
+    size_t threadCount = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, 16);
+    size_t chunk = (pts.size() + threadCount - 1) / threadCount;
+    std::vector<std::thread> threads;
+    for (size_t begin = chunk; begin < pts.size(); begin += chunk) {
+        threads.emplace_back(findNeighbors, begin, std::min(begin + chunk, pts.size()));
+    }
+    findNeighbors(0, std::min(chunk, pts.size()));
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return neighbors;
+}
+
+/**
+ * @brief Local search on a route restricted to the nearest neighbors of each point
+ *
+ * Applies 2-opt moves and Or-opt moves (relocating segments of up to three points, optionally
+ * reversed) where one of the new edges connects a point to one of its nearest neighbors.
+ * Points whose surroundings changed are queued for another look, so the work stays
+ * proportional to the number of improvements. The first point, and the last one if the end
+ * is fixed, keep their position.
+ */
+class RouteOptimizer
+{
+public:
+    RouteOptimizer(
+        const std::vector<TSPPoint>& pts,
+        std::vector<int>& route,
+        bool fixedEnd,
+        std::chrono::steady_clock::time_point deadline
+    )
+        : pts(pts)
+        , route(route)
+        , neighbors(nearestNeighbors(pts))
+        , pos(pts.size())
+        , queued(pts.size(), true)
+        , fixedEnd(fixedEnd)
+        , deadline(deadline)
+    {
+        for (size_t i = 0; i < route.size(); ++i) {
+            pos[route[i]] = static_cast<int>(i);
+        }
+        queue.assign(route.begin(), route.end());
+    }
+
+    void run()
+    {
+        size_t steps = 0;
+        while (!queue.empty()) {
+            if (++steps % 256 == 0 && std::chrono::steady_clock::now() >= deadline) {
+                return;
+            }
+            int a = queue.front();
+            queue.pop_front();
+            queued[a] = false;
+            if (improveTwoOpt(a) || improveOrOpt(a)) {
+                enqueue(a);
+            }
+        }
+    }
+
+private:
+    int last() const
+    {
+        return static_cast<int>(route.size()) - 1;
+    }
+
+    double edge(int i, int j) const
+    {
+        return dist(pts[route[i]], pts[route[j]]);
+    }
+
+    void enqueue(int node)
+    {
+        if (!queued[node]) {
+            queued[node] = true;
+            queue.push_back(node);
+        }
+    }
+
+    void enqueueAt(int i)
+    {
+        if (i >= 0 && i <= last()) {
+            enqueue(route[i]);
+        }
+    }
+
+    void updatePositions(int begin, int end)
+    {
+        for (int i = begin; i <= end; ++i) {
+            pos[route[i]] = i;
+        }
+    }
+
+    /// Replace edges p→p+1 and q→q+1 with p→q and p+1→q+1 by reversing [p+1, q]
+    bool tryTwoOpt(int p, int q)
+    {
+        if (p < 0 || q <= p + 1 || q > last() || (q == last() && fixedEnd)) {
+            return false;
+        }
+        double gain = edge(p, p + 1) - edge(p, q);
+        if (q < last()) {
+            gain += edge(q, q + 1) - edge(p + 1, q + 1);
+        }
+        if (gain <= Base::Precision::Confusion()) {
+            return false;
+        }
+        std::reverse(route.begin() + p + 1, route.begin() + q + 1);
+        updatePositions(p + 1, q);
+        enqueueAt(p);
+        enqueueAt(p + 1);
+        enqueueAt(q);
+        enqueueAt(q + 1);
+        return true;
+    }
+
+    /// Distance from the point at i to the farther of its route neighbors
+    double longestEdge(int i) const
+    {
+        if (i == last()) {
+            // The last point of an open route may connect to anything in front of it
+            return fixedEnd ? edge(i - 1, i) : std::numeric_limits<double>::max();
+        }
+        return i == 0 ? edge(0, 1) : std::max(edge(i - 1, i), edge(i, i + 1));
+    }
+
+    bool improveTwoOpt(int a)
+    {
+        int i = pos[a];
+        double limit = longestEdge(i);
+        for (int c : neighbors[a]) {
+            if (dist(pts[a], pts[c]) >= limit) {
+                break;
+            }
+            int j = pos[c];
+            // New edge a→c replacing the edges after a and c, or the ones before them
+            if (tryTwoOpt(std::min(i, j), std::max(i, j))
+                || tryTwoOpt(std::min(i, j) - 1, std::max(i, j) - 1)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Try to move the segment [s, e] between the points at j and j+1
+     *
+     * j+1 may be past the end of an open route, the segment is then appended.
+     */
+    bool tryMove(int s, int e, int j)
+    {
+        if (j < 0 || j > last() || (j >= s - 1 && j <= e) || (j == last() && fixedEnd)) {
+            return false;
+        }
+        bool tail = e == last();
+        double removeGain = edge(s - 1, s) - Base::Precision::Confusion();
+        if (!tail) {
+            removeGain += edge(e, e + 1) - edge(s - 1, e + 1);
+        }
+        double forward = edge(j, s);
+        double reversed = edge(j, e);
+        if (j < last()) {
+            double bridge = edge(j, j + 1);
+            forward += edge(e, j + 1) - bridge;
+            reversed += edge(s, j + 1) - bridge;
+        }
+        bool reverse = reversed < forward;
+        if (std::min(forward, reversed) >= removeGain) {
+            return false;
+        }
+
+        int length = e - s + 1;
+        int begin, end, joined;
+        if (j > e) {
+            std::rotate(route.begin() + s, route.begin() + e + 1, route.begin() + j + 1);
+            begin = s;
+            end = j;
+            joined = s - 1;
+            s = j - length + 1;
+        }
+        else {
+            std::rotate(route.begin() + j + 1, route.begin() + s, route.begin() + e + 1);
+            begin = j + 1;
+            end = e;
+            joined = e;
+            s = j + 1;
+        }
+        if (reverse) {
+            std::reverse(route.begin() + s, route.begin() + s + length);
+        }
+        updatePositions(begin, end);
+        // joined and joined + 1 used to be around the segment
+        enqueueAt(joined);
+        enqueueAt(joined + 1);
+        enqueueAt(s - 1);
+        enqueueAt(s);
+        enqueueAt(s + length - 1);
+        enqueueAt(s + length);
+        return true;
+    }
+
+    bool improveOrOpt(int a)
+    {
+        int i = pos[a];
+        int lastMovable = fixedEnd ? last() - 1 : last();
+        for (int length = 1; length <= 3; ++length) {
+            // Segments starting at a and segments ending at a
+            for (int s = i; s >= i - length + 1; s -= std::max(length - 1, 1)) {
+                int e = s + length - 1;
+                if (s < 1 || e > lastMovable) {
+                    continue;
+                }
+                for (int c : neighbors[a]) {
+                    int j = pos[c];
+                    if (tryMove(s, e, j) || tryMove(s, e, j - 1)) {
+                        return true;
+                    }
+                }
+            }
+        }
+        return false;
+    }
+
+    const std::vector<TSPPoint>& pts;
+    std::vector<int>& route;
+    const std::vector<std::vector<int>> neighbors;
+    std::vector<int> pos;        // Position of every point in the route
+    std::vector<bool> queued;    // Whether a point is waiting in the queue
+    std::deque<int> queue;
+    bool fixedEnd;
+    std::chrono::steady_clock::time_point deadline;
+};
+
+/**
+ * @brief Build and optimize the route of a large point set
+ *
+ * Grid based nearest neighbor construction followed by 2-opt and Or-opt moves over the
+ * nearest neighbors of each point, see RouteOptimizer.
+ *
+ * @param pts Points including the temporary start (and end) point
+ * @param tempEndIdx Index of the temporary end point, or -1
+ * @param deadline Stop improving the route after this time
+ * @return Visit order of all points in pts
+ */
+std::vector<int> solveLarge(
+    const std::vector<TSPPoint>& pts,
+    int tempEndIdx,
+    std::chrono::steady_clock::time_point deadline
+)
+{
+    std::vector<int> route = nearestNeighborRoute(pts, tempEndIdx);
+    RouteOptimizer(pts, route, tempEndIdx != -1, deadline).run();
+    return route;
+}
+
+/**
+ * @brief Core TSP solver implementation using nearest neighbor + iterative improvement
+ *
+ * Algorithm steps:
+ * 1. Add temporary start/end points if specified
+ * 2. Build initial route using nearest neighbor heuristic
+ * 3. Optimize route with 2-opt and relocation moves
+ * 4. Remove temporary points and map back to original indices
+ *
+ * Steps 2 and 3 are done by solveSmall(), or by solveLarge() for more than
+ * LARGE_PROBLEM_SIZE points where the exhaustive passes become too slow.
+ *
+ * @param points Input points to visit
+ * @param startPoint Optional starting location constraint
+ * @param endPoint Optional ending location constraint
+ * @param deadline Stop improving the route after this time
+ * @return Vector of indices representing optimized visit order
+ */
+std::vector<int> solve_impl(
+    const std::vector<TSPPoint>& points,
+    const TSPPoint* startPoint,
+    const TSPPoint* endPoint,
+    std::chrono::steady_clock::time_point deadline
+)
+{
+    // ========================================================================
+    // STEP 1: Prepare point set with temporary start/end markers
+    // ========================================================================
+    // We insert temporary points to enforce start/end constraints.
+    // These will be removed after optimization and won't appear in final result.
+    std::vector<TSPPoint> pts = points;
+    int tempStartIdx = -1, tempEndIdx = -1;
+
+    if (startPoint) {
+        // Insert user-specified start point at beginning
+        pts.insert(pts.begin(), TSPPoint(startPoint->x, startPoint->y));
+        tempStartIdx = 0;
+    }
+    else if (!pts.empty()) {
+        // No start specified: duplicate first point as anchor
+        pts.insert(pts.begin(), TSPPoint(pts[0].x, pts[0].y));
+        tempStartIdx = 0;
+    }
+
+    if (endPoint) {
+        // Add user-specified end point at the end
+        pts.push_back(TSPPoint(endPoint->x, endPoint->y));
+        tempEndIdx = static_cast<int>(pts.size()) - 1;
+    }
+
+    std::vector<int> route = pts.size() > LARGE_PROBLEM_SIZE
+        ? solveLarge(pts, tempEndIdx, deadline)
+        : solveSmall(pts, tempEndIdx, deadline);
+
     // ========================================================================
     // STEP 4: Remove temporary start/end points
     // ========================================================================
@@ -375,16 +948,25 @@ std::vector<int> solve_impl(
  * - If endPoint is provided, the path will end at the point closest to endPoint
  * - If both are provided, the path will respect both constraints while optimizing the middle path
  * - The algorithm ensures all points are visited exactly once
+ * - If timeLimit is positive, route improvement stops after that many seconds
  */
 
 
 std::vector<int> TSPSolver::solve(
     const std::vector<TSPPoint>& points,
     const TSPPoint* startPoint,
-    const TSPPoint* endPoint
+    const TSPPoint* endPoint,
+    double timeLimit
 )
 {
-    return solve_impl(points, startPoint, endPoint);
+    auto deadline = std::chrono::steady_clock::time_point::max();
+    if (timeLimit > 0.0) {
+        deadline = std::chrono::steady_clock::now()
+            + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                       std::chrono::duration<double>(timeLimit)
+            );
+    }
+    return solve_impl(points, startPoint, endPoint, deadline);
 }
 
 std::vector<TSPTunnel> TSPSolver::solveTunnels(
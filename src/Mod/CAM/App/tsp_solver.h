@@ -61,10 +61,12 @@ public:
     // Returns a vector of indices representing the visit order using 2-Opt
     // If startPoint or endPoint are provided, the path will start/end at the closest point to these
     // coordinates
+    // A positive timeLimit (seconds) bounds the time spent improving the initial route
     static std::vector<int> solve(
         const std::vector<TSPPoint>& points,
         const TSPPoint* startPoint = nullptr,
-        const TSPPoint* endPoint = nullptr
+        const TSPPoint* endPoint = nullptr,
+        double timeLimit = 0.0
     );
 
     // Solves TSP for tunnels (path segments with entry/exit points)
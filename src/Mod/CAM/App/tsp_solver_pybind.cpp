@@ -30,7 +30,8 @@ namespace py = pybind11;
 std::vector<int> tspSolvePy(
     const std::vector<std::pair<double, double>>& points,
     const py::object& startPoint = py::none(),
-    const py::object& endPoint = py::none()
+    const py::object& endPoint = py::none(),
+    double timeLimit = 0.0
 )
 {
     std::vector<TSPPoint> pts;
@@ -94,7 +95,7 @@ std::vector<int> tspSolvePy(
         }
     }
 
-    return TSPSolver::solve(pts, pStartPoint, pEndPoint);
+    return TSPSolver::solve(pts, pStartPoint, pEndPoint, timeLimit);
 }
 
 // Python wrapper for solveTunnels function
@@ -205,12 +206,15 @@ PYBIND11_MODULE(tsp_solver, m)
         py::arg("points"),
         py::arg("startPoint") = py::none(),
         py::arg("endPoint") = py::none(),
+        py::arg("timeLimit") = 0.0,
         "Solve TSP for a list of (x, y) points using 2-Opt, returns visit order.\n"
         "Optional arguments:\n"
         "- startPoint: Optional [x, y] point where the path should start (closest point will be "
         "chosen)\n"
         "- endPoint: Optional [x, y] point where the path should end (closest point will be "
-        "chosen)"
+        "chosen)\n"
+        "- timeLimit: Optional number of seconds after which route improvement stops, 0 for no "
+        "limit"
     );
 
     m.def(
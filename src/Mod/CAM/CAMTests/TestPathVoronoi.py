@@ -189,3 +189,37 @@ class TestPathVoronoi(PathTestUtils.PathTestBase):
         )
         self.assertRoughly(e.valueAt(e.FirstParameter).z, 2.37)
         self.assertRoughly(e.valueAt(e.LastParameter).z, 5.14)
+
+    def test70(self):
+        """Check bulk wire input, primary coloring and wire collection"""
+
+        pts = [
+            FreeCAD.Vector(0, 0),
+            FreeCAD.Vector(30, 0),
+            FreeCAD.Vector(30, 10),
+            FreeCAD.Vector(0, 10),
+        ]
+        face = Part.Face(Part.makePolygon(pts + [pts[0]]))
+
+        dia = Path.Voronoi.Diagram()
+        dia.addWires(face.Wires, 0.01)
+        self.assertGreaterEqual(dia.numSegments(), 4)
+        dia.construct()
+
+        dia.colorPrimary(1, 2, 3)
+        for e in dia.Edges:
+            if e.isBorderline():
+                self.assertEqual(e.Color, 3)
+            elif e.isPrimary():
+                self.assertEqual(e.Color, 1)
+            else:
+                self.assertEqual(e.Color, 2)
+
+        dia.colorExterior(4, face)
+        wires = dia.getWires(1)
+        self.assertNotEqual(len(wires), 0)
+        for wire in wires:
+            for e0, e1 in zip(wire, wire[1:]):
+                self.assertEqual(e0.Vertices[1], e1.Vertices[0])
+            for e in wire:
+                self.assertEqual(e.Color, 1)
@@ -442,6 +442,27 @@ class TestTSPSolver(PathTestBase):
             elif tunnel["index"] == 1:
                 self.assertEqual(tunnel["notes"], "high precision")
 
+    def test_10_large_hole_grid(self):
+        """Test the spatial index backed solver used for large point sets."""
+        pitch = 2.54
+        points = [(x * pitch, y * pitch) for y in range(50) for x in range(50)]
+        route = tsp_solver.solve(
+            points, startPoint=[0, 0], endPoint=[0, 49 * pitch], timeLimit=10.0
+        )
+
+        self.assertEqual(len(route), len(points))
+        self.assertEqual(set(route), set(range(len(points))))
+        self.assertEqual(route[0], 0)
+        self.assertEqual(route[-1], 49 * 50)
+
+        # A serpentine through all rows is optimal, 2499 steps of one pitch
+        total_distance = 0
+        for i in range(len(route) - 1):
+            pt1 = points[route[i]]
+            pt2 = points[route[i + 1]]
+            total_distance += math.sqrt((pt2[0] - pt1[0]) ** 2 + (pt2[1] - pt1[1]) ** 2)
+        self.assertLess(total_distance, 1.05 * 2499 * pitch)
+
 
 if __name__ == "__main__":
     import unittest
@@ -22,21 +22,30 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
 #include <limits>
 #include <boost/algorithm/string/replace.hpp>
 
+#include <Inventor/SbBox3f.h>
+#include <Inventor/SbColor.h>
 #include <Inventor/SbVec3f.h>
 #include <Inventor/details/SoLineDetail.h>
 #include <Inventor/nodes/SoBaseColor.h>
 #include <Inventor/nodes/SoCoordinate3.h>
 #include <Inventor/nodes/SoDrawStyle.h>
+#include <Inventor/nodes/SoIndexedLineSet.h>
+#include <Inventor/nodes/SoLevelOfDetail.h>
 #include <Inventor/nodes/SoMaterial.h>
 #include <Inventor/nodes/SoMaterialBinding.h>
+#include <Inventor/nodes/SoPickStyle.h>
 #include <Inventor/nodes/SoPointSet.h>
 #include <Inventor/nodes/SoSeparator.h>
 #include <Inventor/nodes/SoSwitch.h>
 #include <Inventor/nodes/SoTransform.h>
 
+#include <QFutureWatcher>
+#include <QtConcurrentRun>
+
 #include <App/Application.h>
 #include <App/DocumentObject.h>
 #include <Base/Parameter.h>
@@ -135,6 +144,351 @@ public:
 
     SoSwitch* pcLastArrowSwitch = nullptr;
 };
+
+/// The lines of a toolpath with the offsets of its edges, for showing a range of them
+struct PathLines
+{
+    /// Coordinate indices of the polylines, separated by -1
+    std::vector<int32_t> coordIndex;
+    /// Kind of each line segment: 0 rapid, 1 feed and 2 probe move
+    std::vector<int> colorindex;
+    /// Offsets of the edges in coordIndex, with an extra entry for the end
+    std::vector<int> indexOffset;
+    /// Offsets of the edges in colorindex, with an extra entry for the end
+    std::vector<int> colorOffset;
+    /// Colors of the segments, see ViewProviderPath::updateColors()
+    std::vector<SbColor> colors;
+};
+
+/// The geometry of a toolpath, built without touching the scene graph
+struct PathVisual
+{
+    std::vector<SbVec3f> points;
+    std::vector<SbVec3f> markers;
+    std::vector<int> command2Edge;
+    std::vector<int> edge2Command;
+    /// The end of each edge in points
+    std::vector<int> edgeIndices;
+    /// One polyline per edge, used for picking
+    PathLines lines;
+    /// Decimated lines for overview zoom levels, empty for small toolpaths
+    PathLines coarseLines;
+    /// The projected size in pixels up to which the decimated lines are shown
+    float coarseArea {0.0F};
+};
+
+struct PathLODSettings
+{
+    /// The minimum number of points to decimate the lines
+    long minPoints;
+    /// The decimated lines have no error if the path is up to this many pixels wide
+    long resolution;
+};
+
+class VisualPathSegmentVisitor: public PathSegmentVisitor
+{
+public:
+    VisualPathSegmentVisitor(const Toolpath& tp, PathVisual& visual)
+        : command2Edge(visual.command2Edge)
+        , edge2Command(visual.edge2Command)
+        , edgeIndices(visual.edgeIndices)
+        , colorindex(visual.lines.colorindex)
+        , points(visual.points)
+        , markers(visual.markers)
+    {
+        command2Edge.resize(tp.getSize(), -1);
+    }
+
+    void setup(const Base::Vector3d& last) override
+    {
+        addPoint(last);
+        addMarker(last);
+    }
+
+    void g0(
+        int id,
+        const Base::Vector3d& last,
+        const Base::Vector3d& next,
+        const std::deque<Base::Vector3d>& pts
+    ) override
+    {
+        (void)last;
+        gx(id, &next, pts, 0);
+    }
+
+    void g1(
+        int id,
+        const Base::Vector3d& last,
+        const Base::Vector3d& next,
+        const std::deque<Base::Vector3d>& pts
+    ) override
+    {
+        (void)last;
+        gx(id, &next, pts, 1);
+    }
+
+    void g23(
+        int id,
+        const Base::Vector3d& last,
+        const Base::Vector3d& next,
+        const std::deque<Base::Vector3d>& pts,
+        const Base::Vector3d& center
+    ) override
+    {
+        (void)last;
+        gx(id, &next, pts, 1);
+        addMarker(center);
+    }
+
+    void g8x(
+        int id,
+        const Base::Vector3d& last,
+        const Base::Vector3d& next,
+        const std::deque<Base::Vector3d>& pts,
+        const std::deque<Base::Vector3d>& p,
+        const std::deque<Base::Vector3d>& q
+    ) override
+    {
+        (void)last;
+
+        gx(id, nullptr, pts, 0);
+
+        addPoint(p[0]);
+        addMarker(p[0]);
+        colorindex.push_back(0);
+
+        addPoint(p[1]);
+        addMarker(p[1]);
+        colorindex.push_back(0);
+
+        addPoint(next);
+        addMarker(next);
+        colorindex.push_back(1);
+
+        for (std::deque<Base::Vector3d>::const_iterator it = q.begin(); q.end() != it; ++it) {
+            addMarker(*it);
+        }
+
+        addPoint(p[2]);
+        addMarker(p[2]);
+        colorindex.push_back(0);
+
+        pushCommand(id);
+    }
+
+    void g38(int id, const Base::Vector3d& last, const Base::Vector3d& next) override
+    {
+#if 0
+      Base::Vector3d p1(next.x,next.y,last.z);
+      points.push_back(p1);
+      colorindex.push_back(0);
+
+      points.push_back(next);
+      colorindex.push_back(2);
+
+      Base::Vector3d p3(next.x,next.y,last.z);
+      points.push_back(p3);
+      colorindex.push_back(0);
+
+      pushCommand(id);
+#else
+        (void)last;
+        const std::deque<Base::Vector3d> pts {};
+        gx(id, &next, pts, 2);
+#endif
+    }
+
+private:
+    std::vector<int>& command2Edge;
+    std::vector<int>& edge2Command;
+    std::vector<int>& edgeIndices;
+
+    std::vector<int>& colorindex;
+    std::vector<SbVec3f>& points;
+    std::vector<SbVec3f>& markers;
+
+    void addPoint(const Base::Vector3d& pt)
+    {
+        points.emplace_back(float(pt.x), float(pt.y), float(pt.z));
+    }
+
+    void addMarker(const Base::Vector3d& pt)
+    {
+        markers.emplace_back(float(pt.x), float(pt.y), float(pt.z));
+    }
+
+    virtual void gx(int id, const Base::Vector3d* next, const std::deque<Base::Vector3d>& pts, int color)
+    {
+        for (std::deque<Base::Vector3d>::const_iterator it = pts.begin(); pts.end() != it; ++it) {
+            addPoint(*it);
+            colorindex.push_back(color);
+        }
+
+        if (next) {
+            addPoint(*next);
+            addMarker(*next);
+            colorindex.push_back(color);
+
+            pushCommand(id);
+        }
+    }
+
+    void pushCommand(int id)
+    {
+        command2Edge[id] = edgeIndices.size();
+        edgeIndices.push_back(points.size());
+        edge2Command.push_back(id);
+    }
+};
+
+// One polyline per edge, each starting at the last point of the previous one
+static void buildLines(PathVisual& visual)
+{
+    PathLines& lines = visual.lines;
+    std::size_t edges = visual.edgeIndices.size();
+    lines.coordIndex.reserve(visual.points.size() + 2 * edges);
+    lines.indexOffset.reserve(edges + 1);
+    lines.colorOffset.reserve(edges + 1);
+
+    int start = 0;
+    for (int end : visual.edgeIndices) {
+        lines.indexOffset.push_back(static_cast<int>(lines.coordIndex.size()));
+        lines.colorOffset.push_back(start);
+        for (; start < end; ++start) {
+            lines.coordIndex.push_back(start);
+        }
+        lines.coordIndex.push_back(-1);
+        --start;
+    }
+    lines.indexOffset.push_back(static_cast<int>(lines.coordIndex.size()));
+    lines.colorOffset.push_back(start);
+}
+
+// Merges the edges of the same color into polylines and drops the points that are closer than
+// tolerance to the previous one. The offset of the colors of an edge starting inside a polyline
+// skips the segment that leads to it, so that a range of edges can still be shown.
+static void buildCoarseLines(PathVisual& visual, float tolerance)
+{
+    const std::vector<SbVec3f>& points = visual.points;
+    const std::vector<int>& kinds = visual.lines.colorindex;
+    PathLines& lines = visual.coarseLines;
+    const float sqrTolerance = tolerance * tolerance;
+    const int last = visual.edgeIndices.back() - 1;
+
+    bool open = false;
+    int color = -1;
+    SbVec3f kept;
+    auto addIndex = [&](int index) {
+        lines.coordIndex.push_back(index);
+        lines.colorindex.push_back(color);
+        kept = points[index];
+    };
+    auto closeAt = [&](int index) {
+        if (lines.coordIndex.back() != index) {
+            addIndex(index);
+        }
+        lines.coordIndex.push_back(-1);
+    };
+
+    int start = 0;
+    for (int end : visual.edgeIndices) {
+        if (open && kinds[start] != color) {
+            closeAt(start);
+            open = false;
+        }
+        lines.indexOffset.push_back(static_cast<int>(lines.coordIndex.size()));
+        lines.colorOffset.push_back(static_cast<int>(lines.colorindex.size()) + (open ? 1 : 0));
+        if (!open) {
+            lines.coordIndex.push_back(start);
+            kept = points[start];
+            color = kinds[start];
+            open = true;
+        }
+        for (int i = start + 1; i < end; ++i) {
+            if (kinds[i - 1] != color) {
+                closeAt(i - 1);
+                lines.coordIndex.push_back(i - 1);
+                color = kinds[i - 1];
+            }
+            if (i == last || (points[i] - kept).sqrLength() > sqrTolerance) {
+                addIndex(i);
+            }
+        }
+        start = end - 1;
+    }
+    lines.indexOffset.push_back(static_cast<int>(lines.coordIndex.size()));
+    lines.colorOffset.push_back(static_cast<int>(lines.colorindex.size()));
+}
+
+static std::shared_ptr<PathVisual> buildVisual(
+    const Toolpath& tp,
+    const Base::Vector3d& startPosition,
+    const PathLODSettings& lod
+)
+{
+    auto visual = std::make_shared<PathVisual>();
+    VisualPathSegmentVisitor collect(tp, *visual);
+    PathSegmentWalker segments(tp);
+    segments.walk(collect, startPosition);
+    if (visual->edgeIndices.empty()) {
+        return visual;
+    }
+
+    buildLines(*visual);
+    if (lod.resolution > 0 && (long)visual->points.size() >= lod.minPoints) {
+        SbBox3f box;
+        for (const auto& pt : visual->points) {
+            box.extendBy(pt);
+        }
+        float size = (box.getMax() - box.getMin()).length();
+        buildCoarseLines(*visual, size / float(lod.resolution));
+        if (visual->coarseLines.coordIndex.size() * 2 > visual->lines.coordIndex.size()) {
+            // not worth it
+            visual->coarseLines = PathLines();
+        }
+        else {
+            // roughly the projected area of the bounding box when its diagonal has this size
+            visual->coarseArea = 0.5F * float(lod.resolution * lod.resolution);
+        }
+    }
+    return visual;
+}
+
+/// Builds the visual of large toolpaths in a worker thread
+class PathVisualBuilder
+{
+public:
+    explicit PathVisualBuilder(ViewProviderPath* vp)
+    {
+        QObject::connect(&watcher, &QFutureWatcherBase::finished, [this, vp]() {
+            if (pending) {
+                pending = false;
+                vp->setVisual(watcher.result());
+                vp->updateVisual();
+            }
+        });
+    }
+
+    void start(const Toolpath& tp, const Base::Vector3d& startPosition, const PathLODSettings& lod)
+    {
+        // the toolpath may change while the worker is busy
+        auto path = std::make_shared<const Toolpath>(tp);
+        pending = true;
+        watcher.setFuture(QtConcurrent::run([path, startPosition, lod]() {
+            return buildVisual(*path, startPosition, lod);
+        }));
+    }
+
+    void cancel()
+    {
+        pending = false;
+    }
+
+private:
+    QFutureWatcher<std::shared_ptr<PathVisual>> watcher;
+    bool pending {false};
+};
+
 }  // namespace PathGui
 
 //////////////////////////////////////////////////////////////////////////////
@@ -145,8 +499,7 @@ ViewProviderPath::ViewProviderPath()
     : pt0Index(-1)
     , blockPropertyChange(false)
     , edgeStart(-1)
-    , coordStart(-1)
-    , coordEnd(-1)
+    , edgeEnd(-1)
 {
     ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
         "User parameter:BaseApp/Preferences/Mod/CAM"
@@ -222,6 +575,28 @@ ViewProviderPath::ViewProviderPath()
     pcMatBind->ref();
     pcMatBind->value = SoMaterialBinding::OVERALL;
 
+    pcCoarseLines = new SoIndexedLineSet();
+    pcCoarseLines->ref();
+
+    pcCoarseColor = new SoMaterial;
+    pcCoarseColor->ref();
+
+    // The decimated lines are shown for overview zoom levels and can't be picked, because
+    // their segments don't match the commands.
+    pcLineLOD = new SoLevelOfDetail();
+    pcLineLOD->ref();
+    auto pFineLines = new SoSeparator();
+    pFineLines->addChild(pcLineColor);
+    pFineLines->addChild(pcLines);
+    pcLineLOD->addChild(pFineLines);
+    auto pCoarseLines = new SoSeparator();
+    auto pCoarseStyle = new SoPickStyle();
+    pCoarseStyle->style = SoPickStyle::UNPICKABLE;
+    pCoarseLines->addChild(pCoarseStyle);
+    pCoarseLines->addChild(pcCoarseColor);
+    pCoarseLines->addChild(pcCoarseLines);
+    pcLineLOD->addChild(pCoarseLines);
+
     pcMarkerColor = new SoBaseColor;
     pcMarkerColor->ref();
 
@@ -262,6 +637,12 @@ ViewProviderPath::ViewProviderPath()
 
 ViewProviderPath::~ViewProviderPath()
 {
+    // the fields point into the visual
+    pcLines->coordIndex.setNum(0);
+    pcLineColor->diffuseColor.setNum(0);
+    pcCoarseLines->coordIndex.setNum(0);
+    pcCoarseColor->diffuseColor.setNum(0);
+
     pcLineCoords->unref();
     pcMarkerCoords->unref();
     pcMarkerSwitch->unref();
@@ -269,6 +650,9 @@ ViewProviderPath::~ViewProviderPath()
     pcMarkerStyle->unref();
     pcLines->unref();
     pcLineColor->unref();
+    pcLineLOD->unref();
+    pcCoarseLines->unref();
+    pcCoarseColor->unref();
     pcMatBind->unref();
     pcMarkerColor->unref();
     pcArrowSwitch->unref();
@@ -280,11 +664,10 @@ void ViewProviderPath::attach(App::DocumentObject* pcObj)
 
     // Draw trajectory lines
     SoSeparator* linesep = new SoSeparator;
-    linesep->addChild(pcLineColor);
     linesep->addChild(pcMatBind);
     linesep->addChild(pcDrawStyle);
     linesep->addChild(pcLineCoords);
-    linesep->addChild(pcLines);
+    linesep->addChild(pcLineLOD);
 
     // Draw markers
     SoSeparator* markersep = new SoSeparator;
@@ -325,11 +708,12 @@ std::vector<std::string> ViewProviderPath::getDisplayModes() const
 
 std::string ViewProviderPath::getElement(const SoDetail* detail) const
 {
-    if (edgeStart >= 0 && detail && detail->getTypeId() == SoLineDetail::getClassTypeId()) {
+    if (visual && edgeStart >= 0 && detail
+        && detail->getTypeId() == SoLineDetail::getClassTypeId()) {
         const SoLineDetail* line_detail = static_cast<const SoLineDetail*>(detail);
         int index = line_detail->getLineIndex() + edgeStart;
-        if (index >= 0 && index < (int)edge2Command.size()) {
-            index = edge2Command[index];
+        if (index >= 0 && index < (int)visual->edge2Command.size()) {
+            index = visual->edge2Command[index];
             Path::Feature* pcPathObj = static_cast<Path::Feature*>(pcObject);
             const Toolpath& tp = pcPathObj->Path.getValue();
             if (index < (int)tp.getSize()) {
@@ -352,8 +736,8 @@ SoDetail* ViewProviderPath::getDetail(const char* subelement) const
 {
     int index = std::atoi(subelement);
     SoDetail* detail = nullptr;
-    if (index > 0 && index <= (int)command2Edge.size()) {
-        index = command2Edge[index - 1];
+    if (visual && index > 0 && index <= (int)visual->command2Edge.size()) {
+        index = visual->command2Edge[index - 1];
         if (index >= 0 && edgeStart >= 0 && edgeStart <= index) {
             detail = new SoLineDetail();
             static_cast<SoLineDetail*>(detail)->setLineIndex(index - edgeStart);
@@ -372,47 +756,9 @@ void ViewProviderPath::onChanged(const App::Property* prop)
         pcDrawStyle->lineWidth = LineWidth.getValue();
     }
     else if (prop == &NormalColor) {
-        if (!colorindex.empty() && coordStart >= 0 && coordStart < (int)colorindex.size()) {
-            const Base::Color& c = NormalColor.getValue();
-            ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
-                "User parameter:BaseApp/Preferences/Mod/CAM"
-            );
-            unsigned long rcol
-                = hGrp->GetUnsigned("DefaultRapidPathColor", 2852126975UL);  // dark red (170,0,0)
-            float rr, rg, rb;
-            rr = ((rcol >> 24) & 0xff) / 255.0;
-            rg = ((rcol >> 16) & 0xff) / 255.0;
-            rb = ((rcol >> 8) & 0xff) / 255.0;
-
-            unsigned long pcol
-                = hGrp->GetUnsigned("DefaultProbePathColor", 4293591295UL);  // yellow (255,255,5)
-            float pr, pg, pb;
-            pr = ((pcol >> 24) & 0xff) / 255.0;
-            pg = ((pcol >> 16) & 0xff) / 255.0;
-            pb = ((pcol >> 8) & 0xff) / 255.0;
-
-            pcMatBind->value = SoMaterialBinding::PER_PART;
-            // resizing and writing the color vector:
-
-            int count = coordEnd - coordStart;
-            if (count > (int)colorindex.size() - coordStart) {
-                count = colorindex.size() - coordStart;
-            }
-            pcLineColor->diffuseColor.setNum(count);
-            SbColor* colors = pcLineColor->diffuseColor.startEditing();
-            for (int i = 0; i < count; i++) {
-                switch (colorindex[i + coordStart]) {
-                    case 0:
-                        colors[i] = SbColor(rr, rg, rb);
-                        break;
-                    case 1:
-                        colors[i] = SbColor(c.r, c.g, c.b);
-                        break;
-                    default:
-                        colors[i] = SbColor(pr, pg, pb);
-                }
-            }
-            pcLineColor->diffuseColor.finishEditing();
+        if (visual) {
+            updateColors();
+            updateRange();
         }
     }
     else if (prop == &MarkerColor) {
@@ -539,228 +885,105 @@ void ViewProviderPath::hideSelection()
     pcArrowSwitch->whichChild = -1;
 }
 
-class VisualPathSegmentVisitor: public PathSegmentVisitor
+void ViewProviderPath::updateVisual(bool rebuild)
 {
-public:
-    VisualPathSegmentVisitor(
-        const Toolpath& tp,
-        SoCoordinate3* pcLineCoords_,
-        SoCoordinate3* pcMarkerCoords_,
-        std::vector<int>& command2Edge_,
-        std::deque<int>& edge2Command_,
-        std::deque<int>& edgeIndices_,
-        std::vector<int>& colorindex_,
-        std::deque<Base::Vector3d>& points_,
-        std::deque<Base::Vector3d>& markers_
-    )
-        : pcLineCoords(pcLineCoords_)
-        , pcMarkerCoords(pcMarkerCoords_)
-        , command2Edge(command2Edge_)
-        , edge2Command(edge2Command_)
-        , edgeIndices(edgeIndices_)
-        , colorindex(colorindex_)
-        , points(points_)
-        , markers(markers_)
-    {
-        pcLineCoords->point.deleteValues(0);
-        pcMarkerCoords->point.deleteValues(0);
-
-        command2Edge.clear();
-        edge2Command.clear();
-        edgeIndices.clear();
-
-        colorindex.clear();
-
-        command2Edge.resize(tp.getSize(), -1);
-    }
-
-    void setup(const Base::Vector3d& last) override
-    {
-        points.push_back(last);
-        markers.push_back(last);
-    }
-
-    void g0(
-        int id,
-        const Base::Vector3d& last,
-        const Base::Vector3d& next,
-        const std::deque<Base::Vector3d>& pts
-    ) override
-    {
-        (void)last;
-        gx(id, &next, pts, 0);
-    }
-
-    void g1(
-        int id,
-        const Base::Vector3d& last,
-        const Base::Vector3d& next,
-        const std::deque<Base::Vector3d>& pts
-    ) override
-    {
-        (void)last;
-        gx(id, &next, pts, 1);
-    }
 
-    void g23(
-        int id,
-        const Base::Vector3d& last,
-        const Base::Vector3d& next,
-        const std::deque<Base::Vector3d>& pts,
-        const Base::Vector3d& center
-    ) override
-    {
-        (void)last;
-        gx(id, &next, pts, 1);
-        markers.push_back(center);
-    }
-
-    void g8x(
-        int id,
-        const Base::Vector3d& last,
-        const Base::Vector3d& next,
-        const std::deque<Base::Vector3d>& pts,
-        const std::deque<Base::Vector3d>& p,
-        const std::deque<Base::Vector3d>& q
-    ) override
-    {
-        (void)last;
-
-        gx(id, nullptr, pts, 0);
+    hideSelection();
 
-        points.push_back(p[0]);
-        markers.push_back(p[0]);
-        colorindex.push_back(0);
+    updateShowConstraints();
 
-        points.push_back(p[1]);
-        markers.push_back(p[1]);
-        colorindex.push_back(0);
+    if (rebuild) {
+        Path::Feature* pcPathObj = static_cast<Path::Feature*>(pcObject);
+        const Toolpath& tp = pcPathObj->Path.getValue();
 
-        points.push_back(next);
-        markers.push_back(next);
-        colorindex.push_back(1);
+        ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+            "User parameter:BaseApp/Preferences/Mod/CAM"
+        );
+        PathLODSettings lod;
+        lod.minPoints = hGrp->GetInt("PathLODMinPoints", 100000);
+        lod.resolution = hGrp->GetInt("PathLODResolution", 2000);
 
-        for (std::deque<Base::Vector3d>::const_iterator it = q.begin(); q.end() != it; ++it) {
-            markers.push_back(*it);
+        if (!builder) {
+            builder = std::make_unique<PathVisualBuilder>(this);
         }
-
-        points.push_back(p[2]);
-        markers.push_back(p[2]);
-        colorindex.push_back(0);
-
-        pushCommand(id);
+        // Large toolpaths are shown when ready, until then the old one stays
+        const std::size_t asyncCommandCount = 50000;
+        if (tp.getSize() >= asyncCommandCount) {
+            builder->start(tp, StartPosition.getValue(), lod);
+            return;
+        }
+        builder->cancel();
+        setVisual(buildVisual(tp, StartPosition.getValue(), lod));
     }
 
-    void g38(int id, const Base::Vector3d& last, const Base::Vector3d& next) override
-    {
-#if 0
-      Base::Vector3d p1(next.x,next.y,last.z);
-      points.push_back(p1);
-      colorindex.push_back(0);
-
-      points.push_back(next);
-      colorindex.push_back(2);
+    updateRange();
+}
 
-      Base::Vector3d p3(next.x,next.y,last.z);
-      points.push_back(p3);
-      colorindex.push_back(0);
+void ViewProviderPath::setVisual(std::shared_ptr<PathVisual> newVisual)
+{
+    // detach the fields from the arrays of the old visual
+    pcLines->coordIndex.setNum(0);
+    pcLineColor->diffuseColor.setNum(0);
+    pcCoarseLines->coordIndex.setNum(0);
+    pcCoarseColor->diffuseColor.setNum(0);
+    edgeStart = -1;
 
-      pushCommand(id);
-#else
-        (void)last;
-        const std::deque<Base::Vector3d> pts {};
-        gx(id, &next, pts, 2);
-#endif
+    visual = std::move(newVisual);
+    if (visual->edgeIndices.empty()) {
+        pcLineCoords->point.setNum(0);
+        pcMarkerCoords->point.setNum(0);
     }
+    else {
+        pcLineCoords->point.setNum(visual->points.size());
+        pcLineCoords->point.setValues(0, visual->points.size(), visual->points.data());
+        pcMarkerCoords->point.setNum(visual->markers.size());
+        pcMarkerCoords->point.setValues(0, visual->markers.size(), visual->markers.data());
 
-private:
-    SoCoordinate3* pcLineCoords;
-    SoCoordinate3* pcMarkerCoords;
-
-    std::vector<int>& command2Edge;
-    std::deque<int>& edge2Command;
-    std::deque<int>& edgeIndices;
-
-    std::vector<int>& colorindex;
-    std::deque<Base::Vector3d>& points;
-    std::deque<Base::Vector3d>& markers;
+        recomputeBoundingBox();
+    }
 
-    virtual void gx(int id, const Base::Vector3d* next, const std::deque<Base::Vector3d>& pts, int color)
-    {
-        for (std::deque<Base::Vector3d>::const_iterator it = pts.begin(); pts.end() != it; ++it) {
-            points.push_back(*it);
-            colorindex.push_back(color);
-        }
+    if (visual->coarseLines.coordIndex.empty()) {
+        pcLineLOD->screenArea.setNum(0);
+    }
+    else {
+        pcLineLOD->screenArea.setValue(visual->coarseArea);
+    }
 
-        if (next) {
-            points.push_back(*next);
-            markers.push_back(*next);
-            colorindex.push_back(color);
+    updateColors();
+}
 
-            pushCommand(id);
-        }
+static void showLines(
+    const PathLines& lines,
+    int edgeStart,
+    int edgeEnd,
+    SoMFInt32& coordIndex,
+    SoMFColor& colors
+)
+{
+    if (lines.coordIndex.empty()) {
+        return;
     }
-
-    void pushCommand(int id)
-    {
-        command2Edge[id] = edgeIndices.size();
-        edgeIndices.push_back(points.size());
-        edge2Command.push_back(id);
+    // Only point to the range, the arrays are kept by the visual
+    int first = lines.indexOffset[edgeStart];
+    int count = lines.indexOffset[edgeEnd] - first;
+    int firstColor = lines.colorOffset[edgeStart];
+    int colorCount = (int)lines.colors.size() - firstColor;
+    if (count > 0 && colorCount > 0) {
+        coordIndex.setValuesPointer(count, lines.coordIndex.data() + first);
+        colors.setValuesPointer(colorCount, lines.colors.data() + firstColor);
     }
-};
+}
 
-void ViewProviderPath::updateVisual(bool rebuild)
+void ViewProviderPath::updateRange()
 {
+    pcLines->coordIndex.setNum(0);
+    pcCoarseLines->coordIndex.setNum(0);
 
-    hideSelection();
-
-    updateShowConstraints();
-
-    pcLines->coordIndex.deleteValues(0);
-
-    if (rebuild) {
-        Path::Feature* pcPathObj = static_cast<Path::Feature*>(pcObject);
-        const Toolpath& tp = pcPathObj->Path.getValue();
-
-        std::deque<Base::Vector3d> points;
-        std::deque<Base::Vector3d> markers;
-
-        VisualPathSegmentVisitor collect(
-            tp,
-            pcLineCoords,
-            pcMarkerCoords,
-            command2Edge,
-            edge2Command,
-            edgeIndices,
-            colorindex,
-            points,
-            markers
-        );
-
-        PathSegmentWalker segments(tp);
-        segments.walk(collect, StartPosition.getValue());
-
-
-        if (!edgeIndices.empty()) {
-            pcLineCoords->point.setNum(points.size());
-            SbVec3f* verts = pcLineCoords->point.startEditing();
-            int i = 0;
-            for (const auto& pt : points) {
-                verts[i++].setValue(pt.x, pt.y, pt.z);
-            }
-            pcLineCoords->point.finishEditing();
-
-            pcMarkerCoords->point.setNum(markers.size());
-            for (unsigned int i = 0; i < markers.size(); i++) {
-                pcMarkerCoords->point.set1Value(i, markers[i].x, markers[i].y, markers[i].z);
-            }
-
-            recomputeBoundingBox();
-        }
-    }
-
-    // count = index + separators
     edgeStart = -1;
+    if (!visual) {
+        return;
+    }
+    const std::vector<int>& command2Edge = visual->command2Edge;
     int i;
     for (i = StartIndex.getValue(); i < (int)command2Edge.size(); ++i) {
         if ((edgeStart = command2Edge[i]) >= 0) {
@@ -779,33 +1002,55 @@ void ViewProviderPath::updateVisual(bool rebuild)
         StartIndex.purgeTouched();
     }
 
-    int edgeEnd = edgeStart + ShowCount.getValue();
-    if (edgeEnd == edgeStart || edgeEnd > (int)edgeIndices.size()) {
-        edgeEnd = edgeIndices.size();
+    edgeEnd = edgeStart + ShowCount.getValue();
+    if (edgeEnd == edgeStart || edgeEnd > (int)visual->edgeIndices.size()) {
+        edgeEnd = visual->edgeIndices.size();
     }
 
-    // coord index start
-    coordStart = edgeStart == 0 ? 0 : (edgeIndices[edgeStart - 1] - 1);
-    coordEnd = edgeIndices[edgeEnd - 1];
-
-    // count = coord indices + index separators
-    int count = coordEnd - coordStart + 2 * (edgeEnd - edgeStart - 1) + 1;
+    showLines(visual->lines, edgeStart, edgeEnd, pcLines->coordIndex, pcLineColor->diffuseColor);
+    showLines(
+        visual->coarseLines,
+        edgeStart,
+        edgeEnd,
+        pcCoarseLines->coordIndex,
+        pcCoarseColor->diffuseColor
+    );
+}
 
-    pcLines->coordIndex.setNum(count);
-    int32_t* idx = pcLines->coordIndex.startEditing();
-    i = 0;
-    int start = coordStart;
-    for (int e = edgeStart; e != edgeEnd; ++e) {
-        for (int end = edgeIndices[e]; start < end; ++start) {
-            idx[i++] = start;
-        }
-        idx[i++] = -1;
-        --start;
+void ViewProviderPath::updateColors()
+{
+    const Base::Color& c = NormalColor.getValue();
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/CAM"
+    );
+    unsigned long rcol = hGrp->GetUnsigned("DefaultRapidPathColor", 2852126975UL);  // dark red
+                                                                                   // (170,0,0)
+    float rr, rg, rb;
+    rr = ((rcol >> 24) & 0xff) / 255.0;
+    rg = ((rcol >> 16) & 0xff) / 255.0;
+    rb = ((rcol >> 8) & 0xff) / 255.0;
+
+    unsigned long pcol = hGrp->GetUnsigned("DefaultProbePathColor", 4293591295UL);  // yellow
+                                                                                   // (255,255,5)
+    float pr, pg, pb;
+    pr = ((pcol >> 24) & 0xff) / 255.0;
+    pg = ((pcol >> 16) & 0xff) / 255.0;
+    pb = ((pcol >> 8) & 0xff) / 255.0;
+
+    pcMatBind->value = SoMaterialBinding::PER_PART;
+
+    const SbColor rapid(rr, rg, rb);
+    const SbColor normal(c.r, c.g, c.b);
+    const SbColor probe(pr, pg, pb);
+    for (PathLines* lines : {&visual->lines, &visual->coarseLines}) {
+        lines->colors.resize(lines->colorindex.size());
+        std::transform(
+            lines->colorindex.begin(),
+            lines->colorindex.end(),
+            lines->colors.begin(),
+            [&](int kind) { return kind == 0 ? rapid : (kind == 1 ? normal : probe); }
+        );
     }
-    pcLines->coordIndex.finishEditing();
-    assert(i == count);
-
-    NormalColor.touch();
 }
 
 void ViewProviderPath::recomputeBoundingBox()
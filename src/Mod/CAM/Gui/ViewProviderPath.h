@@ -24,6 +24,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include <App/PropertyGeo.h>
 #include <Gui/Selection/Selection.h>
 #include <Gui/ViewProviderGeometryObject.h>
@@ -33,6 +35,8 @@
 
 
 class SoCoordinate3;
+class SoIndexedLineSet;
+class SoLevelOfDetail;
 class SoDrawStyle;
 class SoMaterial;
 class SoBaseColor;
@@ -49,6 +53,8 @@ namespace PathGui
 {
 
 class PathSelectionObserver;
+class PathVisualBuilder;
+struct PathVisual;
 
 class PathGuiExport ViewProviderPath: public Gui::ViewProviderGeometryObject
 {
@@ -92,10 +98,16 @@ public:
     void showBoundingBox(bool show) override;
 
     friend class PathSelectionObserver;
+    friend class PathVisualBuilder;
 
 private:
     /// Find the index of the first non-rapid move command
     long findFirstFeedMoveIndex(const Path::Toolpath& path) const;
+    /// Replaces the coordinates and lines by \a newVisual
+    void setVisual(std::shared_ptr<PathVisual> newVisual);
+    /// Shows the commands selected by StartIndex and ShowCount
+    void updateRange();
+    void updateColors();
 
 protected:
     void onChanged(const App::Property* prop) override;
@@ -107,22 +119,22 @@ protected:
     SoDrawStyle* pcMarkerStyle;
     PartGui::SoBrepEdgeSet* pcLines;
     SoMaterial* pcLineColor;
+    SoLevelOfDetail* pcLineLOD;
+    SoIndexedLineSet* pcCoarseLines;
+    SoMaterial* pcCoarseColor;
     SoBaseColor* pcMarkerColor;
     SoMaterialBinding* pcMatBind;
-    std::vector<int> colorindex;
     SoSwitch* pcMarkerSwitch;
     SoSwitch* pcArrowSwitch;
     SoTransform* pcArrowTransform;
 
-    std::vector<int> command2Edge;
-    std::deque<int> edge2Command;
-    std::deque<int> edgeIndices;
+    std::shared_ptr<PathVisual> visual;
+    std::unique_ptr<PathVisualBuilder> builder;
 
     mutable int pt0Index;
     bool blockPropertyChange;
     int edgeStart;
-    int coordStart;
-    int coordEnd;
+    int edgeEnd;
 };
 
 using ViewProviderPathPython = Gui::ViewProviderFeaturePythonT<ViewProviderPath>;
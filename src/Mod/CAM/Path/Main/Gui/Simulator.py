@@ -312,6 +312,21 @@ class PathSimulation:
             return
         self.busy = True
 
+        if self.disableAnim:
+            # fast forward, cut the rest of the operation at once
+            commands = self.opCommands[self.icmd :]
+            self.curpos = self.voxSim.ApplyPath(self.curpos, Path.Path(commands))
+            self.icmd = len(self.opCommands)
+            self.iprogress += len(commands)
+            self.UpdateProgress()
+            self.ioperation += 1
+            if self.ioperation >= len(self.activeOps):
+                self.EndSimulation()
+                return
+            self.SetupOperation(self.ioperation)
+            self.busy = False
+            return
+
         cmd = self.opCommands[self.icmd]
         # for cmd in job.Path.Commands:
         if cmd.Name in ("G0", "G00", "G1", "G01", "G2", "G02", "G3", "G03"):
@@ -52,65 +52,6 @@ else:
 translate = FreeCAD.Qt.translate
 
 
-def _collectVoronoiWires(vd):
-    edges = [e for e in vd.Edges if e.Color == PRIMARY]
-    vertex = {}
-    for e in edges:
-        for v in e.Vertices:
-            i = v.Index
-            j = vertex.get(i, [])
-            j.append(e)
-            vertex[i] = j
-
-    # knots are the start and end points of a wire
-    knots = [i for i in vertex if len(vertex[i]) == 1]
-    knots.extend([i for i in vertex if len(vertex[i]) > 2])
-    if len(knots) == 0:
-        for i in vertex:
-            if len(vertex[i]) > 0:
-                knots.append(i)
-                break
-
-    def consume(v, edge):
-        vertex[v] = [e for e in vertex[v] if e.Index != edge.Index]
-        return len(vertex[v]) == 0
-
-    def traverse(vStart, edge, edges):
-        if vStart == edge.Vertices[0].Index:
-            vEnd = edge.Vertices[1].Index
-            edges.append(edge)
-        else:
-            vEnd = edge.Vertices[0].Index
-            edges.append(edge.Twin)
-
-        consume(vStart, edge)
-        if consume(vEnd, edge):
-            return None
-        return vEnd
-
-    wires = []
-    while knots:
-        we = []
-        vFirst = knots[0]
-        vStart = vFirst
-        vLast = vFirst
-        if len(vertex[vStart]):
-            while vStart is not None:
-                vLast = vStart
-                edges = vertex[vStart]
-                if len(edges) > 0:
-                    edge = edges[0]
-                    vStart = traverse(vStart, edge, we)
-                else:
-                    vStart = None
-            wires.append(we)
-        if len(vertex[vFirst]) == 0:
-            knots = [v for v in knots if v != vFirst]
-        if len(vertex[vLast]) == 0:
-            knots = [v for v in knots if v != vLast]
-    return wires
-
-
 def _sortVoronoiWires(wires, start=FreeCAD.Vector(0, 0, 0)):
     def closestTo(start, point):
         p = None
@@ -472,79 +413,44 @@ class ObjectVcarve(PathEngraveBase.ObjectOp):
         :returns: dictionary - each face object is a key containing list of wires"""
 
         medial_wires_by_face = dict()
-        edges_by_face = dict()  # non processed voronoi edges, for debugging
+        diagram_by_face = dict()  # voronoi diagrams, their edges are for debugging
 
         self.voronoiDebugMedialCache = dict()
         self.voronoiDebugEdgeCache = dict()
 
-        def is_exterior(vertex, face):
-            vector = FreeCAD.Vector(vertex.toPoint(face.BoundBox.ZMin))
-            (u, v) = face.Surface.parameter(vector)
-            # isPartOfDomain is faster than face.IsInside(...)
-            return not face.isPartOfDomain(u, v)
-
-        def insert_many_wires(vd, wires):
-            for wire in wires:
-                Path.Log.debug("discretize value: {}".format(obj.Discretize))
-                pts = wire.discretize(QuasiDeflection=obj.Discretize)
-                ptv = [FreeCAD.Vector(p.x, p.y) for p in pts]
-                # Check over the last point before just closing the polygon
-                # by adding the start again.  If the discretizer was aiming
-                # for the last point and missed by a little bit, closing the
-                # polygon as is could result in OpenVoronoi truncating the
-                # coordinates to a self-intersecting polygon which is invalid.
-                # Instead, if the last point is close to the first, remove it
-                # and let the final append close the polygon.
-                # See issue 8064
-                if len(ptv) > 0:
-                    dist = ptv[-1].distanceToPoint(ptv[0])
-                    if dist < FreeCAD.Base.Precision.confusion():
-                        Path.Log.debug(
-                            "Removing bad carve point: {} from polygon origin".format(dist)
-                        )
-                        del ptv[-1]
-                ptv.append(ptv[0])
-
-                for i in range(len(ptv) - 1):
-                    vd.addSegment(ptv[i], ptv[i + 1])
-
         for f in faces:
             voronoiWires = []
             vd = Path.Voronoi.Diagram()
-            insert_many_wires(vd, f.Wires)
+            Path.Log.debug("discretize value: {}".format(obj.Discretize))
+            vd.addWires(f.Wires, obj.Discretize)
 
             vd.construct()
-            edges_by_face[f] = vd.Edges
+            # keep the diagram instead of a list of all its edges, which is
+            # expensive to create and only needed for debugging
+            diagram_by_face[f] = vd
 
-            for e in vd.Edges:
-                if e.isPrimary():
-                    if e.isBorderline():
-                        e.Color = BORDERLINE
-                    else:
-                        e.Color = PRIMARY
-                else:
-                    e.Color = SECONDARY
+            vd.colorPrimary(PRIMARY, SECONDARY, BORDERLINE)
 
             # filter our colinear edged so there are fewer ones
             # to iterate over in colorExterior which is slow
             vd.colorColinear(COLINEAR, obj.Colinear)
 
             vd.colorExterior(EXTERIOR1)
-            vd.colorExterior(EXTERIOR2, lambda v: is_exterior(v, f))
+            vd.colorExterior(EXTERIOR2, f)
 
             # if colorTwin is done before colorExterior we seem to have
             # much more weird exterior edges needed to be filtered out,
             # keep it here to be safe
             vd.colorTwins(TWIN)
 
-            wires = _collectVoronoiWires(vd)
+            wires = vd.getWires(PRIMARY)
             wires = _sortVoronoiWires(wires)
             voronoiWires.extend(wires)
 
             medial_wires_by_face[f] = voronoiWires
 
         self.voronoiDebugMedialCache = medial_wires_by_face
-        self.voronoiDebugEdgeCache = edges_by_face
+        self.voronoiDebugEdgeCache = diagram_by_face
 
         return medial_wires_by_face
 
@@ -802,8 +708,8 @@ class ObjectVcarve(PathEngraveBase.ObjectOp):
 
         edgesToShow = []
 
-        for face, edges in self.voronoiDebugEdgeCache.items():
-            for edge in edges:  # those are voronoi Edge objects, not FC Edge
+        for face, vd in self.voronoiDebugEdgeCache.items():
+            for edge in vd.Edges:  # those are voronoi Edge objects, not FC Edge
                 currentEdge = edge.toShape()
 
                 edgesToShow.append(currentEdge)
@@ -23,12 +23,108 @@
  ***************************************************************************/
 
 
+#include <Mod/CAM/App/PathSegmentWalker.h>
+
 #include "PathSim.h"
 
 
 using namespace Base;
 using namespace PathSimulator;
 
+namespace
+{
+
+// collects the segmented moves of a toolpath as straight segments
+class SegmentCollector: public Path::PathSegmentVisitor
+{
+public:
+    void setup(const Vector3d& last) override
+    {
+        position = last;
+    }
+
+    void g0(
+        int,
+        const Vector3d& last,
+        const Vector3d& next,
+        const std::deque<Vector3d>& pts
+    ) override
+    {
+        addPolyline(last, pts, next);
+    }
+
+    void g1(
+        int,
+        const Vector3d& last,
+        const Vector3d& next,
+        const std::deque<Vector3d>& pts
+    ) override
+    {
+        addPolyline(last, pts, next);
+    }
+
+    void g23(
+        int,
+        const Vector3d& last,
+        const Vector3d& next,
+        const std::deque<Vector3d>& pts,
+        const Vector3d&
+    ) override
+    {
+        addPolyline(last, pts, next);
+    }
+
+    void g8x(
+        int,
+        const Vector3d& last,
+        const Vector3d& next,
+        const std::deque<Vector3d>& pts,
+        const std::deque<Vector3d>& p,
+        const std::deque<Vector3d>&
+    ) override
+    {
+        // p holds the point above the hole, the retract plane and the final retract
+        // position, the hole bottom is next
+        std::deque<Vector3d> points(pts);
+        if (p.size() == 3) {
+            points.push_back(p[0]);
+            points.push_back(p[1]);
+            points.push_back(next);
+            addPolyline(last, points, p[2]);
+        }
+        else {
+            addPolyline(last, points, next);
+        }
+    }
+
+    void g38(int, const Vector3d& last, const Vector3d& next) override
+    {
+        addPolyline(last, {}, next);
+    }
+
+    std::vector<std::pair<Point3D, Point3D>> segments;
+    Vector3d position;
+
+private:
+    void addPolyline(const Vector3d& last, const std::deque<Vector3d>& pts, const Vector3d& next)
+    {
+        Vector3d from = last;
+        for (const Vector3d& pt : pts) {
+            addSegment(from, pt);
+            from = pt;
+        }
+        addSegment(from, next);
+        position = next;
+    }
+
+    void addSegment(const Vector3d& from, const Vector3d& to)
+    {
+        segments.emplace_back(Point3D(from.x, from.y, from.z), Point3D(to.x, to.y, to.z));
+    }
+};
+
+}  // namespace
+
 TYPESYSTEM_SOURCE(PathSimulator::PathSim, Base::BaseClass);
 
 PathSim::PathSim()
@@ -49,6 +145,7 @@ void PathSim::BeginSimulation(Part::TopoShape* stock, float resolution)
         bbox.LengthZ(),
         resolution
     );
+    m_states.clear();
 }
 
 void PathSim::SetToolShape(const TopoDS_Shape& toolShape, float resolution)
@@ -82,3 +179,42 @@ Base::Placement* PathSim::ApplyCommand(Base::Placement* pos, Command* cmd)
     plc->setPosition(vec);
     return plc;
 }
+
+Base::Placement* PathSim::ApplyToolpath(Base::Placement* pos, const Toolpath& path)
+{
+    SegmentCollector collector;
+    Path::PathSegmentWalker walker(path);
+    walker.walk(collector, pos->getPosition());
+    if (m_tool && m_stock) {
+        m_stock->ApplyLinearTools(collector.segments, *m_tool);
+    }
+
+    Base::Placement* plc = new Base::Placement(*pos);
+    plc->setPosition(collector.position);
+    return plc;
+}
+
+int PathSim::SaveState()
+{
+    if (!m_stock) {
+        throw Base::RuntimeError("Path Simulation: simulation not started");
+    }
+    m_states.push_back(m_stock->GetHeights());
+    return static_cast<int>(m_states.size()) - 1;
+}
+
+void PathSim::RestoreState(int index)
+{
+    if (!m_stock) {
+        throw Base::RuntimeError("Path Simulation: simulation not started");
+    }
+    if (index < 0 || index >= static_cast<int>(m_states.size())) {
+        throw Base::IndexError("Path Simulation: invalid state index");
+    }
+    m_stock->SetHeights(m_states[index]);
+}
+
+void PathSim::ClearStates()
+{
+    m_states.clear();
+}
@@ -25,6 +25,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 #include <TopoDS_Shape.hxx>
 
 #include <Mod/CAM/App/Command.h>
@@ -52,10 +53,28 @@ public:
     void BeginSimulation(Part::TopoShape* stock, float resolution);
     void SetToolShape(const TopoDS_Shape& toolShape, float resolution);
     Base::Placement* ApplyCommand(Base::Placement* pos, Command* cmd);
+    /** Apply all commands of a toolpath at once
+     *
+     * The toolpath is split into straight segments by PathSegmentWalker (arcs, drill cycles
+     * and rotations included), which are then cut into the stock concurrently.
+     */
+    Base::Placement* ApplyToolpath(Base::Placement* pos, const Toolpath& path);
+
+    /** Store the current stock, returns the index to restore it
+     *
+     * Used to seek back or to simulate again from an operation that has changed, without
+     * replaying the toolpaths before it.
+     */
+    int SaveState();
+    void RestoreState(int index);
+    void ClearStates();
 
 public:
     std::unique_ptr<cStock> m_stock;
     std::unique_ptr<cSimTool> m_tool;
+
+private:
+    std::vector<std::vector<float>> m_states;
 };
 
 }  // namespace PathSimulator
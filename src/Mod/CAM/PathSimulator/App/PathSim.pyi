@@ -10,6 +10,7 @@ from Base.Placement import Placement
 from Part.App.TopoShape import TopoShape
 from Mesh.App.Mesh import Mesh
 from CAM.App.Command import Command
+from CAM.App.Path import Path
 
 @export(
     FatherInclude="Base/BaseClassPy.h",
@@ -53,5 +54,30 @@ class PathSim(BaseClass):
         Apply a single path command on the stock starting from placement.
         """
         ...
+
+    def ApplyPath(self, placement: Placement, path: Path, /) -> Placement:
+        """
+        Apply all commands of a path on the stock starting from placement.
+        The moves are cut concurrently, returns the end placement.
+        """
+        ...
+
+    def SaveState(self) -> int:
+        """
+        Store the current stock and return the index to restore it.
+        """
+        ...
+
+    def RestoreState(self, index: int, /) -> None:
+        """
+        Restore the stock stored by SaveState(), e.g. to simulate again from a changed operation.
+        """
+        ...
+
+    def ClearStates(self) -> None:
+        """
+        Discard all stored stock states.
+        """
+        ...
     Tool: Final[Any]
     """Return current simulation tool."""
@@ -28,6 +28,8 @@
 
 #include <Mod/Mesh/App/MeshPy.h>
 #include <Mod/CAM/App/CommandPy.h>
+#include <Mod/CAM/App/PathPy.h>
+#include <Mod/Part/App/OCCError.h>
 #include <Mod/Part/App/TopoShapePy.h>
 
 #include "PathSim.h"
@@ -145,6 +147,66 @@ PyObject* PathSimPy::ApplyCommand(PyObject* args, PyObject* kwds)
     return newposPy;
 }
 
+PyObject* PathSimPy::ApplyPath(PyObject* args)
+{
+    PyObject* pObjPlace;
+    PyObject* pObjPath;
+    if (!PyArg_ParseTuple(
+            args,
+            "O!O!",
+            &(Base::PlacementPy::Type),
+            &pObjPlace,
+            &(Path::PathPy::Type),
+            &pObjPath
+        )) {
+        return nullptr;
+    }
+    PathSim* sim = getPathSimPtr();
+    Base::Placement* pos = static_cast<Base::PlacementPy*>(pObjPlace)->getPlacementPtr();
+    Path::Toolpath* path = static_cast<Path::PathPy*>(pObjPath)->getToolpathPtr();
+    PY_TRY
+    {
+        Base::Placement* newpos = sim->ApplyToolpath(pos, *path);
+        return new Base::PlacementPy(newpos);
+    }
+    PY_CATCH_OCC
+}
+
+PyObject* PathSimPy::SaveState(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    PY_TRY
+    {
+        return Py::new_reference_to(Py::Long(getPathSimPtr()->SaveState()));
+    }
+    PY_CATCH
+}
+
+PyObject* PathSimPy::RestoreState(PyObject* args)
+{
+    int index;
+    if (!PyArg_ParseTuple(args, "i", &index)) {
+        return nullptr;
+    }
+    PY_TRY
+    {
+        getPathSimPtr()->RestoreState(index);
+        Py_Return;
+    }
+    PY_CATCH
+}
+
+PyObject* PathSimPy::ClearStates(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    getPathSimPtr()->ClearStates();
+    Py_Return;
+}
+
 Py::Object PathSimPy::getTool() const
 {
     // return Py::Object();
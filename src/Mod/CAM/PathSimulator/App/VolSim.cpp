@@ -24,6 +24,8 @@
 
 #include <algorithm>
 
+#include <QThread>
+#include <QtConcurrentMap>
 
 #include <BRepBndLib.hxx>
 #include <BRepCheck_Analyzer.hxx>
@@ -512,7 +514,7 @@ void cStock::CreatePocket(float cxf, float cyf, float radf, float height)
     }
 }
 
-void cStock::ApplyLinearTool(Point3D& p1, Point3D& p2, cSimTool& tool)
+void cStock::ApplyLinearTool(Point3D& p1, Point3D& p2, cSimTool& tool, int xStart, int xEnd)
 {
     // translate coordinates
     Point3D pi1 = ToInner(p1);
@@ -521,6 +523,12 @@ void cStock::ApplyLinearTool(Point3D& p1, Point3D& p2, cSimTool& tool)
     rad /= m_res;
     float cupAngle = 180;
 
+    xStart = std::max(xStart, 0);
+    xEnd = std::min(xEnd, m_x);
+    if (std::max(pi1.x, pi2.x) + rad + 1 < xStart || std::min(pi1.x, pi2.x) - rad - 1 > xEnd) {
+        return;  // the tool does not reach these columns
+    }
+
     // strait motion
     float perpDirX = 1;
     float perpDirY = 0;
@@ -541,13 +549,7 @@ void cStock::ApplyLinearTool(Point3D& p1, Point3D& p2, cSimTool& tool)
             float z = pi1.z + tool.GetToolProfileAt(t);
             Point3D p = start;
             for (int i = 0; i < lenSteps; i++) {
-                int x = (int)p.x;
-                int y = (int)p.y;
-                if (x >= 0 && y >= 0 && x < m_x && y < m_y) {
-                    if (m_stock[x][y] > z) {
-                        m_stock[x][y] = z;
-                    }
-                }
+                CutAt((int)p.x, (int)p.y, z, xStart, xEnd);
                 p.Add(mainWay);
                 z += zstep;
             }
@@ -566,18 +568,56 @@ void cStock::ApplyLinearTool(Point3D& p1, Point3D& p2, cSimTool& tool)
         cupCirc.SetRotationAngle(-rotang);
         float z = pi2.z + tool.GetToolProfileAt(r / rad);
         for (float a = 0; a < cupAngle; a += rotang) {
-            int x = (int)(pi2.x + cupCirc.x);
-            int y = (int)(pi2.y + cupCirc.y);
-            if (x >= 0 && y >= 0 && x < m_x && y < m_y) {
-                if (m_stock[x][y] > z) {
-                    m_stock[x][y] = z;
-                }
-            }
+            CutAt((int)(pi2.x + cupCirc.x), (int)(pi2.y + cupCirc.y), z, xStart, xEnd);
             cupCirc.Rotate();
         }
     }
 }
 
+void cStock::ApplyLinearTools(
+    const std::vector<std::pair<Point3D, Point3D>>& segments,
+    cSimTool& tool
+)
+{
+    // Cutting keeps the lowest height of every column, so the order of the segments does
+    // not matter and each band gives the same result as cutting the whole stock at once.
+    int bandCount = std::min(m_x, QThread::idealThreadCount() * 4);
+    if (bandCount <= 1 || segments.size() < 2) {
+        for (const auto& segment : segments) {
+            Point3D p1 = segment.first;
+            Point3D p2 = segment.second;
+            ApplyLinearTool(p1, p2, tool);
+        }
+        return;
+    }
+
+    std::vector<std::pair<int, int>> bands;
+    bands.reserve(bandCount);
+    for (int i = 0; i < bandCount; i++) {
+        bands.emplace_back(m_x * i / bandCount, m_x * (i + 1) / bandCount);
+    }
+    QtConcurrent::blockingMap(bands, [&](const std::pair<int, int>& band) {
+        for (const auto& segment : segments) {
+            Point3D p1 = segment.first;
+            Point3D p2 = segment.second;
+            ApplyLinearTool(p1, p2, tool, band.first, band.second);
+        }
+    });
+}
+
+std::vector<float> cStock::GetHeights()
+{
+    return std::vector<float>(m_stock.GetData(), m_stock.GetData() + m_x * m_y);
+}
+
+void cStock::SetHeights(const std::vector<float>& heights)
+{
+    if (heights.size() != size_t(m_x * m_y)) {
+        throw Base::ValueError("Path Simulation: stock size mismatch");
+    }
+    std::copy(heights.begin(), heights.end(), m_stock.GetData());
+}
+
 void cStock::ApplyCircularTool(Point3D& p1, Point3D& p2, Point3D& cent, cSimTool& tool, bool isCCW)
 {
     // translate coordinates
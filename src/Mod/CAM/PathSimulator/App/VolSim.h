@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <climits>
+#include <utility>
 #include <vector>
 
 #include <Mod/Mesh/App/Mesh.h>
@@ -214,6 +216,11 @@ public:
         return data + i * height;
     }
 
+    T* GetData()
+    {
+        return data;
+    }
+
 private:
     T* data;
     int height;
@@ -226,14 +233,33 @@ public:
     ~cStock();
     void Tessellate(Mesh::MeshObject& meshOuter, Mesh::MeshObject& meshInner);
     void CreatePocket(float x, float y, float rad, float height);
-    void ApplyLinearTool(Point3D& p1, Point3D& p2, cSimTool& tool);
+    /* only the stock columns xStart <= x < xEnd (in inner coordinates) are cut */
+    void ApplyLinearTool(
+        Point3D& p1,
+        Point3D& p2,
+        cSimTool& tool,
+        int xStart = 0,
+        int xEnd = INT_MAX
+    );
+    /* cut all segments, the stock is split into bands of columns processed concurrently */
+    void ApplyLinearTools(const std::vector<std::pair<Point3D, Point3D>>& segments, cSimTool& tool);
     void ApplyCircularTool(Point3D& p1, Point3D& p2, Point3D& cent, cSimTool& tool, bool isCCW);
+    std::vector<float> GetHeights();
+    void SetHeights(const std::vector<float>& heights);
     inline Point3D ToInner(Point3D& p)
     {
         return Point3D((p.x - m_px) / m_res, (p.y - m_py) / m_res, p.z);
     }
 
 private:
+    inline void CutAt(int x, int y, float z, int xStart, int xEnd)
+    {
+        if (x >= xStart && y >= 0 && x < xEnd && y < m_y) {
+            if (m_stock[x][y] > z) {
+                m_stock[x][y] = z;
+            }
+        }
+    }
     float FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanHoriz);
     void FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHoriz);
     void SetFacetPoints(MeshCore::MeshGeomFacet& facet, Point3D& p1, Point3D& p2, Point3D& p3);
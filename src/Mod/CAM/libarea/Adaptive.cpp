@@ -28,8 +28,12 @@
 #include <cstring>
 #include <ctime>
 #include <algorithm>
+#include <chrono>
+#include <exception>
+#include <mutex>
 #include <numbers>
 #include <optional>
+#include <thread>
 
 namespace ClipperLib
 {
@@ -953,15 +957,15 @@ private:
     bool running = false;
 };
 
-PerfCounter Perf_ProcessPolyNode("ProcessPolyNode");
-PerfCounter Perf_CalcCutAreaCirc("CalcCutArea");
-PerfCounter Perf_NextEngagePoint("NextEngagePoint");
-PerfCounter Perf_PointIterations("PointIterations");
-PerfCounter Perf_ExpandCleared("ExpandCleared");
-PerfCounter Perf_DistanceToBoundary("DistanceToBoundary");
-PerfCounter Perf_AppendToolPath("AppendToolPath");
-PerfCounter Perf_IsAllowedToCutTrough("IsAllowedToCutTrough");
-PerfCounter Perf_IsClearPath("IsClearPath");
+thread_local PerfCounter Perf_ProcessPolyNode("ProcessPolyNode");
+thread_local PerfCounter Perf_CalcCutAreaCirc("CalcCutArea");
+thread_local PerfCounter Perf_NextEngagePoint("NextEngagePoint");
+thread_local PerfCounter Perf_PointIterations("PointIterations");
+thread_local PerfCounter Perf_ExpandCleared("ExpandCleared");
+thread_local PerfCounter Perf_DistanceToBoundary("DistanceToBoundary");
+thread_local PerfCounter Perf_AppendToolPath("AppendToolPath");
+thread_local PerfCounter Perf_IsAllowedToCutTrough("IsAllowedToCutTrough");
+thread_local PerfCounter Perf_IsClearPath("IsClearPath");
 
 //***********************************
 // Cleared area bounding support
@@ -1693,12 +1697,81 @@ void Adaptive2d::ApplyStockToLeave(Paths& inputPaths)
 // Adaptive2d - Execute
 //********************************************
 
+namespace
+{
+// Results of the last few Execute() calls, job recomputes often run the adaptive operation
+// again with unchanged geometry and settings
+struct ResultCacheEntry
+{
+    std::vector<double> params;
+    DPaths stockPaths;
+    DPaths paths;
+    size_t hash;
+    std::list<AdaptiveOutput> results;
+};
+
+const size_t RESULT_CACHE_SIZE = 4;
+std::list<ResultCacheEntry> resultCache;
+std::mutex resultCacheMutex;
+
+void hashCombine(size_t& seed, double value)
+{
+    seed ^= std::hash<double>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+size_t hashPaths(size_t seed, const DPaths& paths)
+{
+    for (const auto& path : paths) {
+        hashCombine(seed, double(path.size()));
+        for (const auto& pt : path) {
+            hashCombine(seed, pt.first);
+            hashCombine(seed, pt.second);
+        }
+    }
+    return seed;
+}
+}  // namespace
+
 std::list<AdaptiveOutput> Adaptive2d::Execute(
     const DPaths& stockPaths,
     const DPaths& paths,
     std::function<bool(TPaths)> progressCallbackFn
 )
 {
+    //**********************************
+    // Result cache lookup
+    //**********************************
+    std::vector<double> cacheParams = {
+        toolDiameter,
+        helixRampTargetDiameter,
+        helixRampMinDiameter,
+        stepOverFactor,
+        tolerance,
+        stockToLeave,
+        double(forceInsideOut),
+        double(finishingProfile),
+        keepToolDownDistRatio,
+        double(opType),
+        double(polyTreeNestingLimit)
+    };
+    size_t cacheHash = 0;
+    for (double value : cacheParams) {
+        hashCombine(cacheHash, value);
+    }
+    cacheHash = hashPaths(hashPaths(cacheHash, stockPaths), paths);
+    {
+        std::lock_guard<std::mutex> lock(resultCacheMutex);
+        for (auto it = resultCache.begin(); it != resultCache.end(); ++it) {
+            if (it->hash == cacheHash && it->params == cacheParams
+                && it->stockPaths == stockPaths && it->paths == paths) {
+                cout << "Adaptive: using cached result" << endl;
+                resultCache.splice(resultCache.begin(), resultCache, it);
+                results.insert(results.end(), it->results.begin(), it->results.end());
+                return results;
+            }
+        }
+    }
+
     //**********************************
     // Initializations
     //**********************************
@@ -1720,7 +1793,7 @@ std::list<AdaptiveOutput> Adaptive2d::Execute(
     stepOverScaled = toolRadiusScaled * stepOverFactor;
     progressCallback = &progressCallbackFn;
     lastProgressTime = clock();
-    stopProcessing = false;
+    *stopProcessing = false;
 
     if (helixRampTargetDiameter < NTOL) {
         helixRampTargetDiameter = toolDiameter;
@@ -1802,6 +1875,7 @@ std::list<AdaptiveOutput> Adaptive2d::Execute(
     //	Resolve hierarchy and run processing
     //***************************************
     double cornerRoundingOffset = 0.15 * toolRadiusScaled / 2;
+    std::vector<std::pair<Paths, Paths>> regions;
     if (opType == OperationType::otClearingInside || opType == OperationType::otClearingOutside) {
 
         // prepare stock boundary overshooted paths
@@ -1852,7 +1926,7 @@ std::list<AdaptiveOutput> Adaptive2d::Execute(
                 clipof.Clear();
                 clipof.AddPaths(toolBoundPaths, JoinType::jtRound, EndType::etClosedPolygon);
                 clipof.Execute(boundPaths, toolRadiusScaled + finishPassOffsetScaled);
-                ProcessPolyNode(boundPaths, toolBoundPaths);
+                regions.emplace_back(boundPaths, toolBoundPaths);
             }
         }
     }
@@ -1909,14 +1983,92 @@ std::list<AdaptiveOutput> Adaptive2d::Execute(
                     clipof.AddPaths(toolBoundPaths, JoinType::jtRound, EndType::etClosedPolygon);
                     clipof.Execute(boundPaths, toolRadiusScaled + finishPassOffsetScaled);
 
-                    ProcessPolyNode(boundPaths, toolBoundPaths);
+                    regions.emplace_back(boundPaths, toolBoundPaths);
                 }
             }
         }
     }
+
+    size_t resultsBefore = results.size();
+    ProcessRegions(regions);
+
+    if (!*stopProcessing) {
+        std::lock_guard<std::mutex> lock(resultCacheMutex);
+        auto first = std::next(results.begin(), resultsBefore);
+        resultCache.push_front(
+            {std::move(cacheParams),
+             stockPaths,
+             paths,
+             cacheHash,
+             std::list<AdaptiveOutput>(first, results.end())}
+        );
+        if (resultCache.size() > RESULT_CACHE_SIZE) {
+            resultCache.pop_back();
+        }
+    }
     return results;
 }
 
+void Adaptive2d::ProcessRegions(const std::vector<std::pair<Paths, Paths>>& regions)
+{
+    size_t threadCount = min<size_t>(regions.size(), max(1U, std::thread::hardware_concurrency()));
+#ifdef DEV_MODE
+    threadCount = 1;  // the debug drawing functions are not thread safe
+#endif
+    if (threadCount <= 1) {
+        for (const auto& region : regions) {
+            ProcessPolyNode(region.first, region.second);
+        }
+        return;
+    }
+
+    // Regions are independent, so each thread takes the next unprocessed region and the
+    // results are appended in region order afterwards. Only the calling thread reports
+    // progress, because the callback calls into Python.
+    std::vector<std::list<AdaptiveOutput>> regionResults(regions.size());
+    std::vector<std::exception_ptr> errors(threadCount);
+    std::atomic<size_t> nextRegion(0);
+    auto processRegions = [&](Adaptive2d& processor, size_t thread) {
+        try {
+            for (size_t i = nextRegion++; i < regions.size(); i = nextRegion++) {
+                processor.current_region = int(i);
+                processor.results.clear();
+                processor.ProcessPolyNode(regions[i].first, regions[i].second);
+                regionResults[i] = std::move(processor.results);
+            }
+        }
+        catch (...) {
+            errors[thread] = std::current_exception();
+            *stopProcessing = true;
+        }
+    };
+
+    std::list<AdaptiveOutput> previousResults;
+    previousResults.swap(results);
+
+    std::vector<Adaptive2d> processors(threadCount - 1, *this);
+    std::vector<std::thread> threads;
+    threads.reserve(processors.size());
+    for (size_t i = 0; i < processors.size(); i++) {
+        processors[i].progressCallback = nullptr;
+        threads.emplace_back(processRegions, std::ref(processors[i]), i + 1);
+    }
+    processRegions(*this, 0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    results.swap(previousResults);
+    for (auto& regionResult : regionResults) {
+        results.splice(results.end(), regionResult);
+    }
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
 bool Adaptive2d::FindEntryPoint(
     TPaths& progressPaths,
     const Paths& toolBoundPaths,
@@ -2219,16 +2371,19 @@ bool Adaptive2d::ResolveLinkPath(
     size_t sindex;
     double par;
 
-    // put a time limit on the resolving the link path
-    clock_t time_limit = (clock_t)(max(keepToolDownDistRatio, 3.0) * CLOCKS_PER_SEC / 6);
+    // put a time limit on the resolving the link path, using wall time as clock() counts the
+    // processor time of all threads processing regions
+    auto time_limit = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(max(keepToolDownDistRatio, 3.0) / 6)
+    );
 
-    clock_t time_out = clock() + time_limit;
+    auto time_out = std::chrono::steady_clock::now() + time_limit;
 
     while (!queue.empty()) {
-        if (stopProcessing) {
+        if (*stopProcessing) {
             return false;
         }
-        if (clock() > time_out) {
+        if (std::chrono::steady_clock::now() > time_out) {
             cout << "Unable to resolve tool down linking path (limit reached)." << endl;
             return false;
         }
@@ -2301,7 +2456,7 @@ bool Adaptive2d::ResolveLinkPath(
                 0.5 * double(pointPair.first.Y + pointPair.second.Y)
             );
             for (long i = 1;; i++) {
-                if (stopProcessing) {
+                if (*stopProcessing) {
                     return false;
                 }
                 double offset = i * scanStep;
@@ -2683,7 +2838,7 @@ void Adaptive2d::CheckReportProgress(TPaths& progressPaths, bool force)
     }
     if (progressCallback) {
         if ((*progressCallback)(progressPaths)) {
-            stopProcessing = true;  // call python function, if returns true signal stop processing
+            *stopProcessing = true;  // call python function, if returns true signal stop processing
         }
     }
     // clean the paths - keep the last point
@@ -2868,7 +3023,7 @@ void Adaptive2d::ProcessPolyNode(Paths boundPaths, Paths toolBoundPaths)
     // LOOP - PASSES
     //*******************************
     for (long pass = 0; pass < PASSES_LIMIT; pass++) {
-        if (stopProcessing) {
+        if (*stopProcessing) {
             break;
         }
 
@@ -2906,7 +3061,7 @@ void Adaptive2d::ProcessPolyNode(Paths boundPaths, Paths toolBoundPaths)
         // LOOP - POINTS
         //*******************************
         for (long point_index = 0; point_index < POINTS_PER_PASS_LIMIT; point_index++) {
-            if (stopProcessing) {
+            if (*stopProcessing) {
                 break;
             }
 
@@ -3288,7 +3443,7 @@ void Adaptive2d::ProcessPolyNode(Paths boundPaths, Paths toolBoundPaths)
         Path finShiftedPath;
 
         bool allCutsAllowed = true;
-        while (!stopProcessing
+        while (!*stopProcessing
                && PopPathWithClosestPoint(finishingPaths, lastPoint, finShiftedPath, stepOverScaled)) {
             if (finShiftedPath.empty()) {
                 continue;
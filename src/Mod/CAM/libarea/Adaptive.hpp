@@ -23,6 +23,9 @@
  ***************************************************************************/
 
 #include "clipper.hpp"
+#include <atomic>
+#include <functional>
+#include <memory>
 #include <vector>
 #include <list>
 #include <time.h>
@@ -79,7 +82,7 @@ struct AdaptiveOutput
     int ReturnMotionType;  // MotionType enum, problem with serialization if enum is used
 };
 
-// used to isolate state -> enable potential adding of multi-threaded processing of separate regions
+// used to isolate state -> separate regions are processed by copies of Adaptive2d in worker threads
 
 class Adaptive2d
 {
@@ -122,7 +125,8 @@ private:
     long helixRampMinRadiusScaled = 0;
     double referenceCutArea = 0;
     double optimalCutAreaPD = 0;
-    bool stopProcessing = false;
+    // shared with the copies processing other regions
+    std::shared_ptr<std::atomic<bool>> stopProcessing = std::make_shared<std::atomic<bool>>(false);
     int current_region = 0;
     clock_t lastProgressTime = 0;
 
@@ -130,6 +134,7 @@ private:
     Path toolGeometry;  // tool geometry at coord 0,0, should not be modified
 
     void ProcessPolyNode(Paths boundPaths, Paths toolBoundPaths);
+    void ProcessRegions(const std::vector<std::pair<Paths, Paths>>& regions);
     bool FindEntryPoint(
         TPaths& progressPaths,
         const Paths& toolBoundPaths,
@@ -129,6 +129,27 @@ public:
     );
 };
 
+// Offsets one area by a series of values. The area is converted to Clipper paths (and its
+// arcs flattened) once on construction instead of on every CArea::OffsetWithClipper() call.
+class CAreaClipperOffset
+{
+public:
+    CAreaClipperOffset(
+        const CArea& area,
+        ClipperLib::JoinType joinType = ClipperLib::jtRound,
+        ClipperLib::EndType endType = ClipperLib::etOpenRound,
+        double miterLimit = 5.0,
+        double roundPrecision = 0.0
+    );
+
+    // replaces the curves of result with the area offset by the given value
+    void Offset(double offset, CArea& result);
+
+private:
+    ClipperLib::ClipperOffset m_clipper;
+    double m_round_precision;
+};
+
 enum eOverlapType
 {
     eOutside,
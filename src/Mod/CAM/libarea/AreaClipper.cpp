@@ -40,7 +40,7 @@ public:
     }
 };
 
-static std::list<DoubleAreaPoint> pts_for_AddVertex;
+static std::vector<DoubleAreaPoint> pts_for_AddVertex;
 
 static void AddPoint(const DoubleAreaPoint& p)
 {
@@ -110,21 +110,23 @@ static void AddVertex(const CVertex& vertex, const CVertex* prev_vertex)
 
             dphi = phit / (Segments);
 
-            double px = prev_vertex->m_p.x * CArea::m_units;
-            double py = prev_vertex->m_p.y * CArea::m_units;
+            // step around the centre by rotating the radius vector, which avoids
+            // evaluating atan2, sin and cos for every point
+            double cx = vertex.m_c.x * CArea::m_units;
+            double cy = vertex.m_c.y * CArea::m_units;
+            double cos_dphi = cos(dphi);
+            double sin_dphi = sin(dphi);
+            phi = ang1;
+            dx = radius * cos(phi);
+            dy = radius * sin(phi);
 
             for (i = 1; i <= Segments; i++) {
-                dx = px - vertex.m_c.x * CArea::m_units;
-                dy = py - vertex.m_c.y * CArea::m_units;
-                phi = atan2(dy, dx);
+                double rx = dx * cos_dphi + dy * sin_dphi;
+                double ry = dy * cos_dphi - dx * sin_dphi;
+                dx = rx;
+                dy = ry;
 
-                double nx = vertex.m_c.x * CArea::m_units + radius * cos(phi - dphi);
-                double ny = vertex.m_c.y * CArea::m_units + radius * sin(phi - dphi);
-
-                AddPoint(DoubleAreaPoint(nx, ny));
-
-                px = nx;
-                py = ny;
+                AddPoint(DoubleAreaPoint(cx + dx, cy + dy));
             }
         }
     }
@@ -207,10 +209,8 @@ static void OffsetWithLoops(const TPolyPolygon& pp, TPolyPolygon& pp_new, double
 
             TPolygon loopy_polygon;
             loopy_polygon.reserve(pts_for_AddVertex.size());
-            for (std::list<DoubleAreaPoint>::iterator It = pts_for_AddVertex.begin();
-                 It != pts_for_AddVertex.end();
-                 It++) {
-                loopy_polygon.push_back(It->int_point());
+            for (DoubleAreaPoint& pt : pts_for_AddVertex) {
+                loopy_polygon.push_back(pt.int_point());
             }
             c.AddPath(loopy_polygon, ptSubject, true);
             pts_for_AddVertex.clear();
@@ -278,34 +278,28 @@ static void OffsetSpansWithObrounds(const CArea& area, TPolyPolygon& pp_new, dou
     c.StrictlySimple(CArea::m_clipper_simple);
     pp_new.clear();
 
-    for (std::list<CCurve>::const_iterator It = area.m_curves.begin(); It != area.m_curves.end();
-         It++) {
-        c.Clear();
-        c.AddPaths(pp_new, ptSubject, true);
-        pp_new.clear();
+    // the obrounds of all the spans are united in one go, uniting them curve by
+    // curve with the previous result gets quadratic for areas with many curves
+    for (const CCurve& curve : area.m_curves) {
         pts_for_AddVertex.clear();
 
-        const CCurve& curve = *It;
         const CVertex* prev_vertex = NULL;
-        for (std::list<CVertex>::const_iterator It2 = curve.m_vertices.begin();
-             It2 != curve.m_vertices.end();
-             It2++) {
-            const CVertex& vertex = *It2;
+        for (const CVertex& vertex : curve.m_vertices) {
             if (prev_vertex) {
                 MakeObround(prev_vertex->m_p, vertex, radius);
 
                 TPolygon loopy_polygon;
                 loopy_polygon.reserve(pts_for_AddVertex.size());
-                for (std::list<DoubleAreaPoint>::iterator It = pts_for_AddVertex.begin();
-                     It != pts_for_AddVertex.end();
-                     It++) {
-                    loopy_polygon.push_back(It->int_point());
+                for (DoubleAreaPoint& pt : pts_for_AddVertex) {
+                    loopy_polygon.push_back(pt.int_point());
                 }
                 c.AddPath(loopy_polygon, ptSubject, true);
                 pts_for_AddVertex.clear();
             }
             prev_vertex = &vertex;
         }
+    }
+    if (!area.m_curves.empty()) {
         c.Execute(ctUnion, pp_new, pftNonZero, pftNonZero);
     }
 
@@ -351,18 +345,14 @@ static void MakePoly(const CCurve& curve, TPolygon& p, bool reverse = false)
     p.resize(pts_for_AddVertex.size());
     if (reverse) {
         std::size_t i = pts_for_AddVertex.size() - 1;  // clipper wants them the opposite way to CArea
-        for (std::list<DoubleAreaPoint>::iterator It = pts_for_AddVertex.begin();
-             It != pts_for_AddVertex.end();
-             It++, i--) {
-            p[i] = It->int_point();
+        for (DoubleAreaPoint& pt : pts_for_AddVertex) {
+            p[i--] = pt.int_point();
         }
     }
     else {
-        unsigned int i = 0;
-        for (std::list<DoubleAreaPoint>::iterator It = pts_for_AddVertex.begin();
-             It != pts_for_AddVertex.end();
-             It++, i++) {
-            p[i] = It->int_point();
+        std::size_t i = 0;
+        for (DoubleAreaPoint& pt : pts_for_AddVertex) {
+            p[i++] = pt.int_point();
         }
     }
 }
@@ -567,10 +557,35 @@ void CArea::OffsetWithClipper(
     double roundPrecision /*  = 0.0 */
 )
 {
-    offset *= m_units * m_clipper_scale;
+    CAreaClipperOffset clipper(*this, joinType, endType, miterLimit, roundPrecision);
+    clipper.Offset(offset, *this);
+}
+
+CAreaClipperOffset::CAreaClipperOffset(
+    const CArea& area,
+    JoinType joinType /* =jtRound */,
+    EndType endType /* =etOpenRound */,
+    double miterLimit /*  = 5.0 */,
+    double roundPrecision /*  = 0.0 */
+)
+    : m_clipper(miterLimit)
+    , m_round_precision(roundPrecision)
+{
+    TPolyPolygon pp;
+    MakePolyPoly(area, pp, false);
+    int i = 0;
+    for (const CCurve& c : area.m_curves) {
+        m_clipper.AddPath(pp[i++], joinType, c.IsClosed() ? etClosedPolygon : endType);
+    }
+}
+
+void CAreaClipperOffset::Offset(double offset, CArea& result)
+{
+    offset *= CArea::m_units * CArea::m_clipper_scale;
+    double roundPrecision = m_round_precision;
     if (roundPrecision == 0.0) {
         // Clipper roundPrecision definition: https://goo.gl/4odfQh
-        double dphi = acos(1.0 - m_accuracy * m_clipper_scale / fabs(offset));
+        double dphi = acos(1.0 - CArea::m_accuracy * CArea::m_clipper_scale / fabs(offset));
         int Segments = (int)ceil(PI / dphi);
         if (Segments < 2 * CArea::m_min_arc_points) {
             Segments = 2 * CArea::m_min_arc_points;
@@ -581,19 +596,14 @@ void CArea::OffsetWithClipper(
         roundPrecision = (1.0 - cos(dphi)) * fabs(offset);
     }
     else {
-        roundPrecision *= m_clipper_scale;
+        roundPrecision *= CArea::m_clipper_scale;
     }
 
-    ClipperOffset clipper(miterLimit, roundPrecision);
-    TPolyPolygon pp, pp2;
-    MakePolyPoly(*this, pp, false);
-    int i = 0;
-    for (const CCurve& c : m_curves) {
-        clipper.AddPath(pp[i++], joinType, c.IsClosed() ? etClosedPolygon : endType);
-    }
-    clipper.Execute(pp2, (long64)(offset));
-    SetFromResult(*this, pp2, false);
-    this->Reorder();
+    m_clipper.ArcTolerance = roundPrecision;
+    TPolyPolygon pp;
+    m_clipper.Execute(pp, (long64)(offset));
+    SetFromResult(result, pp, false);
+    result.Reorder();
 }
 
 void CArea::Thicken(double value)
@@ -618,10 +628,7 @@ void UnFitArcs(CCurve& curve)
 
     curve.m_vertices.clear();
 
-    for (std::list<DoubleAreaPoint>::iterator It = pts_for_AddVertex.begin();
-         It != pts_for_AddVertex.end();
-         It++) {
-        DoubleAreaPoint& pt = *It;
+    for (DoubleAreaPoint& pt : pts_for_AddVertex) {
         CVertex vertex(0, Point(pt.X / CArea::m_units, pt.Y / CArea::m_units), Point(0.0, 0.0));
         curve.m_vertices.push_back(vertex);
     }
@@ -66,6 +66,9 @@
 # include "FemPostPipeline.h"
 # include "FemPostBranchFilter.h"
 # include "PropertyPostDataObject.h"
+# include <string>
+# include <vtkSMPTools.h>
+# include <vtkVersion.h>
 #endif
 
 
@@ -210,5 +213,13 @@ PyMOD_INIT_FUNC(Fem)
 #endif
     // clang-format on
 
+#if defined(FC_USE_VTK) && VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 1, 0)
+    // the filters with SMP support (clip, plane cut, contours, the clean filter) only use
+    // several threads with a threaded backend, but VTK may be built with Sequential as default
+    if (std::string(vtkSMPTools::GetBackend()) == "Sequential") {
+        vtkSMPTools::SetBackend("STDThread");
+    }
+#endif
+
     PyMOD_Return(femModule);
 }
@@ -21,8 +21,10 @@
  ***************************************************************************/
 
 #include <Python.h>
+#include <algorithm>
 #include <cstdlib>
 #include <memory>
+#include <utility>
 
 #include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
@@ -137,6 +139,7 @@ FemMesh& FemMesh::operator=(const FemMesh& mesh)
 
 void FemMesh::copyMeshData(const FemMesh& mesh)
 {
+    invalidateNodeIndex();
     _Mtrx = mesh._Mtrx;
 
     // 1. Get source mesh
@@ -271,6 +274,8 @@ const SMESH_Mesh* FemMesh::getSMesh() const
 
 SMESH_Mesh* FemMesh::getSMesh()
 {
+    // the caller may change the mesh
+    invalidateNodeIndex();
     return myMesh;
 }
 
@@ -330,6 +335,7 @@ void FemMesh::setStandardHypotheses()
 
 void FemMesh::compute()
 {
+    invalidateNodeIndex();
     getGenerator()->Compute(*myMesh, myMesh->GetShapeToMesh());
 }
 
@@ -571,8 +577,6 @@ std::map<int, int> FemMesh::getccxVolumesByFace(const TopoDS_Face& face) const
 
 std::set<int> FemMesh::getNodesBySolid(const TopoDS_Solid& solid) const
 {
-    std::set<int> result;
-
     Bnd_Box box;
     BRepBndLib::Add(solid, box);
 
@@ -582,50 +586,11 @@ std::set<int> FemMesh::getNodesBySolid(const TopoDS_Solid& solid) const
     double limit = analysis.Tolerance(solid, 1, shapetype);
     Base::Console().log("The limit if a node is in or out: %.12lf in scientific: %.4e \n", limit, limit);
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
-
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
-
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(solid, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
-
-            if (measure.Value() < limit)
-#pragma omp critical
-            {
-                result.insert(aNode->GetID());
-            }
-        }
-    }
-    return result;
+    return getNodesNearShape(solid, box, limit);
 }
 
 std::set<int> FemMesh::getNodesByFace(const TopoDS_Face& face) const
 {
-    std::set<int> result;
-
     Bnd_Box box;
     BRepBndLib::Add(
         face,
@@ -636,129 +601,144 @@ std::set<int> FemMesh::getNodesByFace(const TopoDS_Face& face) const
     double limit = BRep_Tool::Tolerance(face);
     box.Enlarge(limit);
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
-
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
-
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(face, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
-
-            if (measure.Value() < limit)
-#pragma omp critical
-            {
-                result.insert(aNode->GetID());
-            }
-        }
-    }
-
-    return result;
+    return getNodesNearShape(face, box, limit);
 }
 
 std::set<int> FemMesh::getNodesByEdge(const TopoDS_Edge& edge) const
 {
-    std::set<int> result;
-
     Bnd_Box box;
     BRepBndLib::Add(edge, box);
     // limit where the mesh node belongs to the edge:
     double limit = BRep_Tool::Tolerance(edge);
     box.Enlarge(limit);
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
-
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
+    return getNodesNearShape(edge, box, limit);
+}
 
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
+std::set<int> FemMesh::getNodesByVertex(const TopoDS_Vertex& vertex) const
+{
+    std::set<int> result;
 
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(edge, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
+    double limit = BRep_Tool::Tolerance(vertex);
+    gp_Pnt pnt = BRep_Tool::Pnt(vertex);
+    Base::Vector3d node(pnt.X(), pnt.Y(), pnt.Z());
+    Bnd_Box box;
+    box.Add(pnt);
+    box.Enlarge(limit);
+    limit *= limit;  // use square to improve speed
 
-            if (measure.Value() < limit)
-#pragma omp critical
-            {
-                result.insert(aNode->GetID());
-            }
+    const NodeIndex& index = getNodeIndex();
+    index.forEachInBox(box, [&](std::size_t i) {
+        if (Base::DistanceP2(node, index.points[i]) <= limit) {
+            result.insert(index.ids[i]);
         }
-    }
+    });
 
     return result;
 }
 
-std::set<int> FemMesh::getNodesByVertex(const TopoDS_Vertex& vertex) const
+/*! A compact copy of the node ids and their placed coordinates, sorted along x.
+ * The geometry queries use it instead of walking the SMDS nodes on every call, and
+ * only the nodes within the bounding box of the shape are looked at.
+ */
+struct FemMesh::NodeIndex
 {
-    std::set<int> result;
+    const SMESH_Mesh* mesh {nullptr};
+    Base::Matrix4D transform;
+    std::vector<int> ids;
+    std::vector<Base::Vector3d> points;
 
-    double limit = BRep_Tool::Tolerance(vertex);
-    limit *= limit;  // use square to improve speed
-    gp_Pnt pnt = BRep_Tool::Pnt(vertex);
-    Base::Vector3d node(pnt.X(), pnt.Y(), pnt.Z());
+    template<typename Func>
+    void forEachInBox(const Bnd_Box& box, Func&& func) const
+    {
+        if (box.IsVoid()) {
+            return;
+        }
+        double xmin, ymin, zmin, xmax, ymax, zmax;
+        box.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+        auto lessX = [](const Base::Vector3d& point, double x) {
+            return point.x < x;
+        };
+        auto begin = std::lower_bound(points.begin(), points.end(), xmin, lessX);
+        for (auto it = begin; it != points.end() && it->x <= xmax; ++it) {
+            if (!box.IsOut(gp_Pnt(it->x, it->y, it->z))) {
+                func(static_cast<std::size_t>(it - points.begin()));
+            }
+        }
+    }
+};
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
+const FemMesh::NodeIndex& FemMesh::getNodeIndex() const
+{
+    if (nodeIndex && nodeIndex->mesh == myMesh && nodeIndex->transform == _Mtrx
+        && nodeIndex->ids.size() == static_cast<std::size_t>(myMesh->NbNodes())) {
+        return *nodeIndex;
+    }
 
-    std::vector<const SMDS_MeshNode*> nodes;
+    std::vector<std::pair<Base::Vector3d, int>> nodes;
+    nodes.reserve(myMesh->NbNodes());
     SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
     while (aNodeIter->more()) {
         const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
+        // Apply the matrix to hold the nodes in absolute space.
+        nodes.emplace_back(_Mtrx * Base::Vector3d(aNode->X(), aNode->Y(), aNode->Z()), aNode->GetID());
+    }
+    std::sort(nodes.begin(), nodes.end(), [](const auto& a, const auto& b) {
+        return a.first.x < b.first.x;
+    });
+
+    auto index = std::make_shared<NodeIndex>();
+    index->mesh = myMesh;
+    index->transform = _Mtrx;
+    index->ids.reserve(nodes.size());
+    index->points.reserve(nodes.size());
+    for (const auto& it : nodes) {
+        index->points.push_back(it.first);
+        index->ids.push_back(it.second);
+    }
+    nodeIndex = index;
+    return *nodeIndex;
+}
+
+void FemMesh::invalidateNodeIndex()
+{
+    nodeIndex.reset();
+}
 
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        vec = Mtrx * vec;
+/*! Returns the nodes within the box that are closer than limit to the shape.
+ * The distance tests are the expensive part, so every thread keeps one
+ * BRepExtrema_DistShapeShape with the shape loaded instead of making one per node.
+ */
+std::set<int> FemMesh::getNodesNearShape(const TopoDS_Shape& shape, const Bnd_Box& box, double limit) const
+{
+    std::set<int> result;
+    const NodeIndex& index = getNodeIndex();
+    std::vector<std::size_t> candidates;
+    index.forEachInBox(box, [&candidates](std::size_t i) { candidates.push_back(i); });
 
-        if (Base::DistanceP2(node, vec) <= limit)
+#pragma omp parallel
+    {
+        BRepExtrema_DistShapeShape measure;
+        measure.LoadS1(shape);
+        std::vector<int> found;
+#pragma omp for schedule(dynamic)
+        for (long i = 0; i < static_cast<long>(candidates.size()); ++i) {
+            const Base::Vector3d& vec = index.points[candidates[i]];
+            // create a vertex
+            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
+            // measure distance
+            measure.LoadS2(aBuilder.Vertex());
+            measure.Perform();
+            if (!measure.IsDone() || measure.NbSolution() < 1) {
+                continue;
+            }
+            if (measure.Value() < limit) {
+                found.push_back(index.ids[candidates[i]]);
+            }
+        }
 #pragma omp critical
         {
-            result.insert(aNode->GetID());
+            result.insert(found.begin(), found.end());
         }
     }
 
@@ -1632,6 +1612,7 @@ void FemMesh::read(const char* FileName)
 {
     Base::FileInfo File(FileName);
     _Mtrx = Base::Matrix4D();
+    invalidateNodeIndex();
 
     // checking on the file
     if (!File.isReadable()) {
@@ -2042,29 +2023,29 @@ void FemMesh::writeABAQUS(
 
     // add some text and make sure one of the known elemParam values is used
     anABAQUS_Output << "** written by FreeCAD inp file writer for CalculiX,Abaqus meshes"
-                    << std::endl;
+                    << '\n';
     switch (elemParam) {
         case 0:
-            anABAQUS_Output << "** all mesh elements." << std::endl << std::endl;
+            anABAQUS_Output << "** all mesh elements." << '\n' << '\n';
             break;
         case 1:
-            anABAQUS_Output << "** highest dimension mesh elements only." << std::endl << std::endl;
+            anABAQUS_Output << "** highest dimension mesh elements only." << '\n' << '\n';
             break;
         case 2:
             anABAQUS_Output << "** FEM mesh elements only (edges if they do not belong to faces "
                                "and faces if they do not belong to volumes)."
-                            << std::endl
-                            << std::endl;
+                            << '\n'
+                            << '\n';
             break;
         default:
-            anABAQUS_Output << "** Problem on writing" << std::endl;
+            anABAQUS_Output << "** Problem on writing" << '\n';
             anABAQUS_Output.close();
             throw std::runtime_error("Unknown ABAQUS element choice parameter, [0|1|2] are allowed.");
     }
 
     // write nodes
-    anABAQUS_Output << "** Nodes" << std::endl;
-    anABAQUS_Output << "*Node, NSET=Nall" << std::endl;
+    anABAQUS_Output << "** Nodes" << '\n';
+    anABAQUS_Output << "*Node, NSET=Nall" << '\n';
 
     // Axisymmetric, plane strain and plane stress elements expect nodes in the plane z=0.
     // Set the z coordinate to 0 to avoid possible rounding errors.
@@ -2093,9 +2074,9 @@ void FemMesh::writeABAQUS(
     // See https://forum.freecad.org/viewtopic.php?f=18&t=12646&start=40#p103004
     for (const auto& it : vertexMap) {
         anABAQUS_Output << it.first << ", " << it.second.x << ", " << it.second.y << ", "
-                        << it.second.z << std::endl;
+                        << it.second.z << '\n';
     }
-    anABAQUS_Output << std::endl << std::endl;
+    anABAQUS_Output << '\n' << '\n';
     ;
 
 
@@ -2103,8 +2084,8 @@ void FemMesh::writeABAQUS(
     std::string elsetname;
     if (!elementsMapVol.empty()) {
         for (const auto& it : elementsMapVol) {
-            anABAQUS_Output << "** Volume elements" << std::endl;
-            anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Evolumes" << std::endl;
+            anABAQUS_Output << "** Volume elements" << '\n';
+            anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Evolumes" << '\n';
             for (const auto& jt : it.second) {
                 anABAQUS_Output << jt.first;
                 // Calculix allows max 16 entries in one line, a hexa20 has more !
@@ -2116,7 +2097,7 @@ void FemMesh::writeABAQUS(
                     }
                     else {
                         if (first_line) {
-                            anABAQUS_Output << "," << std::endl << *kt;
+                            anABAQUS_Output << "," << '\n' << *kt;
                             first_line = false;
                         }
                         else {
@@ -2124,24 +2105,24 @@ void FemMesh::writeABAQUS(
                         }
                     }
                 }
-                anABAQUS_Output << std::endl;
+                anABAQUS_Output << '\n';
             }
         }
         elsetname += "Evolumes";
-        anABAQUS_Output << std::endl;
+        anABAQUS_Output << '\n';
     }
 
     // write faces to file
     if (!elementsMapFac.empty()) {
         for (const auto& it : elementsMapFac) {
-            anABAQUS_Output << "** Face elements" << std::endl;
-            anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Efaces" << std::endl;
+            anABAQUS_Output << "** Face elements" << '\n';
+            anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Efaces" << '\n';
             for (const auto& jt : it.second) {
                 anABAQUS_Output << jt.first;
                 for (int kt : jt.second) {
                     anABAQUS_Output << ", " << kt;
                 }
-                anABAQUS_Output << std::endl;
+                anABAQUS_Output << '\n';
             }
         }
         if (elsetname.empty()) {
@@ -2150,20 +2131,20 @@ void FemMesh::writeABAQUS(
         else {
             elsetname += ", Efaces";
         }
-        anABAQUS_Output << std::endl;
+        anABAQUS_Output << '\n';
     }
 
     // write edges to file
     if (!elementsMapEdg.empty()) {
         for (const auto& it : elementsMapEdg) {
-            anABAQUS_Output << "** Edge elements" << std::endl;
-            anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Eedges" << std::endl;
+            anABAQUS_Output << "** Edge elements" << '\n';
+            anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Eedges" << '\n';
             for (const auto& jt : it.second) {
                 anABAQUS_Output << jt.first;
                 for (int kt : jt.second) {
                     anABAQUS_Output << ", " << kt;
                 }
-                anABAQUS_Output << std::endl;
+                anABAQUS_Output << '\n';
             }
         }
         if (elsetname.empty()) {
@@ -2172,13 +2153,13 @@ void FemMesh::writeABAQUS(
         else {
             elsetname += ", Eedges";
         }
-        anABAQUS_Output << std::endl;
+        anABAQUS_Output << '\n';
     }
 
     // write elset Eall
-    anABAQUS_Output << "** Define element set Eall" << std::endl;
-    anABAQUS_Output << "*ELSET, ELSET=Eall" << std::endl;
-    anABAQUS_Output << elsetname << std::endl;
+    anABAQUS_Output << "** Define element set Eall" << '\n';
+    anABAQUS_Output << "*ELSET, ELSET=Eall" << '\n';
+    anABAQUS_Output << elsetname << '\n';
 
     // groups
     if (!groupParam) {
@@ -2186,7 +2167,7 @@ void FemMesh::writeABAQUS(
     }
     else {
         // get and write group data
-        anABAQUS_Output << std::endl << "** Group data" << std::endl;
+        anABAQUS_Output << '\n' << "** Group data" << '\n';
 
         std::list<int> groupIDs = myMesh->GetGroupIds();
         for (int it : groupIDs) {
@@ -2224,13 +2205,13 @@ void FemMesh::writeABAQUS(
             }
             const char* groupName = myMesh->GetGroup(it)->GetName();
             anABAQUS_Output << "** GroupID: " << (it) << " --> GroupName: " << groupName
-                            << " --> GroupElementType: " << groupElementType << std::endl;
+                            << " --> GroupElementType: " << groupElementType << '\n';
 
             if (aElementType == SMDSAbs_Node) {
-                anABAQUS_Output << "*NSET, NSET=" << groupName << std::endl;
+                anABAQUS_Output << "*NSET, NSET=" << groupName << '\n';
             }
             else {
-                anABAQUS_Output << "*ELSET, ELSET=" << groupName << std::endl;
+                anABAQUS_Output << "*ELSET, ELSET=" << groupName << '\n';
             }
 
             // get and write group elements
@@ -2241,17 +2222,35 @@ void FemMesh::writeABAQUS(
                 ids.insert(aElement->GetID());
             }
             for (int it : ids) {
-                anABAQUS_Output << it << std::endl;
+                anABAQUS_Output << it << '\n';
             }
 
             // write newline after each group
-            anABAQUS_Output << std::endl;
+            anABAQUS_Output << '\n';
         }
         anABAQUS_Output.close();
     }
 }
 
 
+void FemMesh::writeABAQUSSet(
+    std::ostream& out,
+    const std::string& keyword,
+    const std::string& name,
+    const std::vector<int>& ids
+)
+{
+    if (keyword != "NSET" && keyword != "ELSET") {
+        throw Base::ValueError("Unknown set keyword, [NSET|ELSET] are allowed");
+    }
+
+    out << '*' << keyword << ',' << keyword << '=' << name << '\n';
+    for (int id : ids) {
+        out << id << ",\n";
+    }
+}
+
+
 void FemMesh::writeZ88(const std::string& FileName) const
 {
     Base::TimeElapsed Start;
@@ -2441,6 +2440,7 @@ void FemMesh::RestoreDocFile(Base::Reader& reader)
     file.close();
 
     // read the shape from the temp file
+    invalidateNodeIndex();
     myMesh->UNVToMesh(fi.filePath().c_str());
 
     // delete the temp file
@@ -2450,6 +2450,7 @@ void FemMesh::RestoreDocFile(Base::Reader& reader)
 void FemMesh::transformGeometry(const Base::Matrix4D& rclTrf)
 {
     // We perform a translation and rotation of the current active Mesh object
+    invalidateNodeIndex();
     Base::Matrix4D clMatrix(rclTrf);
     SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
     Base::Vector3d current_node;
@@ -2748,3 +2749,162 @@ void FemMesh::renameGroup(int id, const std::string& name)
         grp->SetName(name.c_str());
     }
 }
+
+namespace
+{
+
+// Calls the SMESHDS_Mesh::Add* overload of the node count, numbered by SMESH if id is 0
+template<std::size_t... I>
+SMDS_MeshElement*
+addEdge(SMESHDS_Mesh* meshDS, const SMDS_MeshNode* const* nodes, int id, std::index_sequence<I...>)
+{
+    return id > 0 ? meshDS->AddEdgeWithID(nodes[I]..., id) : meshDS->AddEdge(nodes[I]...);
+}
+
+template<std::size_t... I>
+SMDS_MeshElement*
+addFace(SMESHDS_Mesh* meshDS, const SMDS_MeshNode* const* nodes, int id, std::index_sequence<I...>)
+{
+    return id > 0 ? meshDS->AddFaceWithID(nodes[I]..., id) : meshDS->AddFace(nodes[I]...);
+}
+
+template<std::size_t... I>
+SMDS_MeshElement*
+addVolume(SMESHDS_Mesh* meshDS, const SMDS_MeshNode* const* nodes, int id, std::index_sequence<I...>)
+{
+    return id > 0 ? meshDS->AddVolumeWithID(nodes[I]..., id) : meshDS->AddVolume(nodes[I]...);
+}
+
+SMDS_MeshElement* addElement(
+    SMESHDS_Mesh* meshDS,
+    SMDSAbs_ElementType type,
+    const SMDS_MeshNode* const* nodes,
+    int count,
+    int id
+)
+{
+    switch (type) {
+        case SMDSAbs_Edge:
+            switch (count) {
+                case 2:
+                    return addEdge(meshDS, nodes, id, std::make_index_sequence<2>());
+                case 3:
+                    return addEdge(meshDS, nodes, id, std::make_index_sequence<3>());
+                default:
+                    throw Base::ValueError("Unknown node count, [2|3] are allowed");
+            }
+        case SMDSAbs_Face:
+            switch (count) {
+                case 3:
+                    return addFace(meshDS, nodes, id, std::make_index_sequence<3>());
+                case 4:
+                    return addFace(meshDS, nodes, id, std::make_index_sequence<4>());
+                case 6:
+                    return addFace(meshDS, nodes, id, std::make_index_sequence<6>());
+                case 8:
+                    return addFace(meshDS, nodes, id, std::make_index_sequence<8>());
+                default:
+                    throw Base::ValueError("Unknown node count, [3|4|6|8] are allowed");
+            }
+        case SMDSAbs_Volume:
+            switch (count) {
+                case 4:
+                    return addVolume(meshDS, nodes, id, std::make_index_sequence<4>());
+                case 5:
+                    return addVolume(meshDS, nodes, id, std::make_index_sequence<5>());
+                case 6:
+                    return addVolume(meshDS, nodes, id, std::make_index_sequence<6>());
+                case 8:
+                    return addVolume(meshDS, nodes, id, std::make_index_sequence<8>());
+                case 10:
+                    return addVolume(meshDS, nodes, id, std::make_index_sequence<10>());
+                case 13:
+                    return addVolume(meshDS, nodes, id, std::make_index_sequence<13>());
+                case 15:
+                    return addVolume(meshDS, nodes, id, std::make_index_sequence<15>());
+                case 20:
+                    return addVolume(meshDS, nodes, id, std::make_index_sequence<20>());
+                default:
+                    throw Base::ValueError(
+                        "Unknown node count, [4|5|6|8|10|13|15|20] are allowed"
+                    );
+            }
+        default:
+            throw Base::ValueError("Only edges, faces and volumes can be added");
+    }
+}
+
+}  // namespace
+
+std::vector<int> FemMesh::addNodes(const std::vector<double>& coords, const std::vector<int>& ids)
+{
+    const std::size_t count = coords.size() / 3;
+    if (coords.size() % 3 != 0) {
+        throw Base::ValueError("Number of coordinates must be a multiple of three");
+    }
+    if (!ids.empty() && ids.size() != count) {
+        throw Base::ValueError("Number of IDs must be equal to the number of nodes");
+    }
+
+    invalidateNodeIndex();
+    SMESHDS_Mesh* meshDS = myMesh->GetMeshDS();
+    std::vector<int> result(count);
+    for (std::size_t i = 0; i < count; i++) {
+        const double* p = &coords[3 * i];
+        SMDS_MeshNode* node = ids.empty() ? meshDS->AddNode(p[0], p[1], p[2])
+                                          : meshDS->AddNodeWithID(p[0], p[1], p[2], ids[i]);
+        if (!node) {
+            throw Base::RuntimeError("Failed to add node");
+        }
+        result[i] = node->GetID();
+    }
+    return result;
+}
+
+/*! The node IDs of all elements are resolved in one pass before any element is
+ * made, so a bad ID leaves the mesh unchanged. SMDS has no way to reserve storage
+ * up front and still grows its element pools in chunks.
+ */
+std::vector<int> FemMesh::addElements(
+    SMDSAbs_ElementType type,
+    const std::vector<int>& nodes,
+    const std::vector<int>& nodeCounts,
+    const std::vector<int>& ids
+)
+{
+    if (!ids.empty() && ids.size() != nodeCounts.size()) {
+        throw Base::ValueError("Number of IDs must be equal to the number of elements");
+    }
+    std::size_t total = 0;
+    for (int count : nodeCounts) {
+        if (count <= 0) {
+            throw Base::ValueError("Node counts must be positive");
+        }
+        total += count;
+    }
+    if (total != nodes.size()) {
+        throw Base::ValueError("Sum of the node counts must be equal to the number of nodes");
+    }
+
+    SMESHDS_Mesh* meshDS = myMesh->GetMeshDS();
+    std::vector<const SMDS_MeshNode*> meshNodes(nodes.size());
+    for (std::size_t i = 0; i < nodes.size(); i++) {
+        meshNodes[i] = meshDS->FindNode(nodes[i]);
+        if (!meshNodes[i]) {
+            throw Base::ValueError("Failed to get node of the given indices");
+        }
+    }
+
+    std::vector<int> result(nodeCounts.size());
+    const SMDS_MeshNode* const* elemNodes = meshNodes.data();
+    for (std::size_t i = 0; i < nodeCounts.size(); i++) {
+        SMDS_MeshElement* elem
+            = addElement(meshDS, type, elemNodes, nodeCounts[i], ids.empty() ? 0 : ids[i]);
+        if (!elem) {
+            throw Base::RuntimeError("Failed to add element");
+        }
+        result[i] = elem->GetID();
+        elemNodes += nodeCounts[i];
+    }
+    return result;
+}
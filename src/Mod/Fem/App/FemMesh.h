@@ -22,8 +22,10 @@
 
 #pragma once
 
+#include <iosfwd>
 #include <list>
 #include <memory>
+#include <set>
 #include <vector>
 
 #include <SMDSAbs_ElementType.hxx>
@@ -42,6 +44,7 @@ class TopoDS_Face;
 class TopoDS_Edge;
 class TopoDS_Vertex;
 class TopoDS_Solid;
+class Bnd_Box;
 
 namespace Fem
 {
@@ -185,6 +188,24 @@ public:
     void renameGroup(int id, const std::string& name);
     //@}
 
+    /** @name Bulk construction */
+    //@{
+    /** Adds nodes from interleaved x, y, z coordinates.
+     *  Without \a ids SMESH numbers the nodes. Returns the IDs of the new nodes.
+     */
+    std::vector<int> addNodes(const std::vector<double>& coords, const std::vector<int>& ids = {});
+    /** Adds elements of one type from the node IDs of all elements in a row and
+     *  the node count of each element, in SMESH node order.
+     *  Without \a ids SMESH numbers the elements. Returns the IDs of the new elements.
+     */
+    std::vector<int> addElements(
+        SMDSAbs_ElementType type,
+        const std::vector<int>& nodes,
+        const std::vector<int>& nodeCounts,
+        const std::vector<int>& ids = {}
+    );
+    //@}
+
 
     struct FemMeshInfo
     {
@@ -215,11 +236,23 @@ public:
         ABAQUS_FaceVariant faceVariant = ABAQUS_FaceVariant::Shell,
         ABAQUS_EdgeVariant edgeVariant = ABAQUS_EdgeVariant::Beam
     ) const;
+    /// Writes a named node (NSET) or element (ELSET) set of the ABAQUS input format
+    static void writeABAQUSSet(
+        std::ostream& out,
+        const std::string& keyword,
+        const std::string& name,
+        const std::vector<int>& ids
+    );
     void writeVTK(const std::string& FileName, bool highest = true) const;
     void writeZ88(const std::string& FileName) const;
 
 private:
     void copyMeshData(const FemMesh&);
+    /// node snapshot for the geometry queries, made on first use
+    struct NodeIndex;
+    const NodeIndex& getNodeIndex() const;
+    void invalidateNodeIndex();
+    std::set<int> getNodesNearShape(const TopoDS_Shape& shape, const Bnd_Box& box, double limit) const;
     void readNastran(const std::string& Filename);
     void readNastran95(const std::string& Filename);
     void readZ88(const std::string& Filename);
@@ -235,6 +268,7 @@ private:
 
     std::list<SMESH_HypothesisPtr> hypoth;
     static SMESH_Gen* _mesh_gen;
+    mutable std::shared_ptr<const NodeIndex> nodeIndex;
 };
 
 
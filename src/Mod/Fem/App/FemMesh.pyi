@@ -49,6 +49,15 @@ class FemMesh(ComplexGeoData):
         """Add a node by setting (x,y,z)."""
         ...
 
+    def addNodes(self, coords: Any, ids: Any = None, /) -> memoryview:
+        """
+        Add nodes from an array of coordinates of shape (n, 3), e.g. a NumPy array.
+
+        The optional array of n node IDs sets the IDs of the new nodes.
+        Returns the IDs of the added nodes.
+        """
+        ...
+
     @overload
     def addEdge(self, n1: int, n2: int, /) -> int: ...
     @overload
@@ -57,8 +66,12 @@ class FemMesh(ComplexGeoData):
         """Add an edge by setting two node indices."""
         ...
 
-    def addEdgeList(self, nodes: list[int], np: list[int], /) -> list[int]:
-        """Add list of edges by list of node indices and list of nodes per edge."""
+    def addEdgeList(self, nodes: Any, np: Any, /) -> list[int]:
+        """
+        Add list of edges by list of node indices and list of nodes per edge.
+
+        Both may also be integer arrays, e.g. NumPy arrays.
+        """
         ...
 
     @overload
@@ -69,8 +82,12 @@ class FemMesh(ComplexGeoData):
         """Add a face by setting three node indices."""
         ...
 
-    def addFaceList(self, nodes: list[int], np: list[int], /) -> list[int]:
-        """Add list of faces by list of node indices and list of nodes per face."""
+    def addFaceList(self, nodes: Any, np: Any, /) -> list[int]:
+        """
+        Add list of faces by list of node indices and list of nodes per face.
+
+        Both may also be integer arrays, e.g. NumPy arrays.
+        """
         ...
 
     def addQuad(self, n1: int, n2: int, n3: int, n4: int, /) -> int:
@@ -85,8 +102,12 @@ class FemMesh(ComplexGeoData):
         """Add a volume by setting an arbitrary number of node indices."""
         ...
 
-    def addVolumeList(self, nodes: list[int], np: list[int], /) -> list[int]:
-        """Add list of volumes by list of node indices and list of nodes per volume."""
+    def addVolumeList(self, nodes: Any, np: Any, /) -> list[int]:
+        """
+        Add list of volumes by list of node indices and list of nodes per volume.
+
+        Both may also be integer arrays, e.g. NumPy arrays.
+        """
         ...
 
     def read(self, file_name: str, /) -> None:
@@ -161,6 +182,16 @@ class FemMesh(ComplexGeoData):
         """
         ...
 
+    @constmethod
+    def writeABAQUSSet(self, file: Any, keyword: str, name: str, ids: Any, /) -> None:
+        """
+        Write a named node or element set in ABAQUS inp format to an open text file.
+
+        keyword: "NSET" or "ELSET"
+        ids: The node or element IDs, one is written per line.
+        """
+        ...
+
     def setTransform(self, placement: Placement, /) -> None:
         """Use a Placement object to perform a translation or rotation"""
         ...
@@ -290,6 +321,16 @@ class FemMesh(ComplexGeoData):
     def getIdByElementType(self, elem_type: str, /) -> tuple[int, ...]:
         """Return a tuple of IDs to a given element type"""
         ...
+
+    @constmethod
+    def getNodeArray(self) -> tuple[memoryview, memoryview]:
+        """
+        Return the node IDs and the node coordinates as memoryviews.
+
+        The coordinates are doubles of shape (n, 3) in the order of the IDs. Both
+        arrays are copied once and numpy.asarray() uses them without a copy.
+        """
+        ...
     Nodes: Final[dict]
     """Dictionary of Nodes by ID (int ID:Vector())"""
 
@@ -32,11 +32,14 @@
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Shape.hxx>
 #include <algorithm>
+#include <sstream>
 #include <stdexcept>
 
 
 #include "Mod/Fem/App/FemMesh.h"
+#include <Base/Interpreter.h>
 #include <Base/PlacementPy.h>
+#include <Base/PyArrayBuffer.h>
 #include <Base/PyWrapParseTupleAndKeywords.h>
 #include <Base/QuantityPy.h>
 #include <Base/VectorPy.h>
@@ -243,6 +246,31 @@ PyObject* FemMeshPy::addNode(PyObject* args)
     return nullptr;
 }
 
+PyObject* FemMeshPy::addNodes(PyObject* args)
+{
+    PyObject* pyCoords {};
+    PyObject* pyIds = Py_None;
+    if (!PyArg_ParseTuple(args, "O|O", &pyCoords, &pyIds)) {
+        return nullptr;
+    }
+
+    Base::PyArrayReader coordArray(pyCoords, 3);
+    std::vector<double> coords = coordArray.getValues<double>();
+    std::vector<int> ids;
+    if (pyIds != Py_None) {
+        Base::PyArrayReader idArray(pyIds, 1);
+        if (idArray.size() != coordArray.rows()) {
+            throw Py::ValueError("Number of IDs must be equal to the number of nodes");
+        }
+        ids = idArray.getValues<int>();
+    }
+
+    std::vector<int> nodeIds = getFemMeshPtr()->addNodes(coords, ids);
+    Base::PyArrayWriter<int> result(nodeIds.size(), 1);
+    std::copy(nodeIds.begin(), nodeIds.end(), result.data());
+    return Py::new_reference_to(result.getView());
+}
+
 PyObject* FemMeshPy::addEdge(PyObject* args)
 {
     SMESH_Mesh* mesh = getFemMeshPtr()->getSMesh();
@@ -832,289 +860,66 @@ PyObject* FemMeshPy::addVolume(PyObject* args)
     return nullptr;
 }
 
-PyObject* FemMeshPy::addEdgeList(PyObject* args)
+namespace
 {
-    PyObject* nodesObj = nullptr;
-    PyObject* npObj = nullptr;
-    ;
-    if (!PyArg_ParseTuple(args, "O!O!", &PyList_Type, &nodesObj, &PyList_Type, &npObj)) {
-        return nullptr;
-    }
 
-    Py::List nodesList(nodesObj);
-    Py::List npList(npObj);
-    SMESHDS_Mesh* meshDS = getFemMeshPtr()->getSMesh()->GetMeshDS();
+// Reads IDs or counts from any sequence or set of integers, or from an object
+// supporting the buffer protocol
+std::vector<int> readIntegers(PyObject* obj)
+{
+    if (PyObject_CheckBuffer(obj)) {
+        return Base::PyArrayReader(obj, 1).getValues<int>();
+    }
 
-    std::vector<const SMDS_MeshNode*> nodes;
-    for (Py::List::iterator it = nodesList.begin(); it != nodesList.end(); ++it) {
-        Py::Long n(*it);
-        const SMDS_MeshNode* node = meshDS->FindNode(static_cast<int>(n));
-        if (!node) {
-            throw std::runtime_error("Failed to get node of the given indices");
-        }
-        nodes.push_back(node);
-    }
-
-    std::vector<const SMDS_MeshNode*>::iterator nodeIt = nodes.begin();
-    SMDS_MeshEdge* edge = nullptr;
-    Py::List result;
-    int np = 0;
-    for (Py::List::iterator it = npList.begin(); it != npList.end(); ++it, nodeIt += np) {
-        np = Py::Long(*it);
-        std::vector<const SMDS_MeshNode*> nodesElem(nodeIt, nodeIt + np);
-        switch (np) {
-            case 2:
-                edge = meshDS->AddEdge(nodesElem[0], nodesElem[1]);
-                break;
-            case 3:
-                edge = meshDS->AddEdge(nodesElem[0], nodesElem[1], nodesElem[2]);
-                break;
-            default:
-                PyErr_SetString(PyExc_TypeError, "Unknown node count, [2|3] are allowed");
-                return nullptr;
-        }
-        if (edge) {
-            result.append(Py::Long(edge->GetID()));
-        }
-        else {
-            PyErr_SetString(PyExc_TypeError, "Failed to add edge");
-            return nullptr;
+    PyObject* fast = PySequence_Fast(obj, "Expected a sequence or an array of integers");
+    if (!fast) {
+        throw Py::Exception();
+    }
+    Py::Object seq(fast, true);
+    const Py_ssize_t size = PySequence_Fast_GET_SIZE(seq.ptr());
+    PyObject** items = PySequence_Fast_ITEMS(seq.ptr());
+    std::vector<int> values(size);
+    for (Py_ssize_t i = 0; i < size; i++) {
+        long value = PyLong_AsLong(items[i]);
+        if (value == -1 && PyErr_Occurred()) {
+            throw Py::Exception();
         }
+        values[i] = static_cast<int>(value);
     }
-
-    return Py::new_reference_to(result);
+    return values;
 }
 
-
-PyObject* FemMeshPy::addFaceList(PyObject* args)
+PyObject* addElementList(FemMesh* mesh, SMDSAbs_ElementType type, PyObject* args)
 {
     PyObject* nodesObj = nullptr;
     PyObject* npObj = nullptr;
-    ;
-    if (!PyArg_ParseTuple(args, "O!O!", &PyList_Type, &nodesObj, &PyList_Type, &npObj)) {
+    if (!PyArg_ParseTuple(args, "OO", &nodesObj, &npObj)) {
         return nullptr;
     }
 
-    Py::List nodesList(nodesObj);
-    Py::List npList(npObj);
-    SMESHDS_Mesh* meshDS = getFemMeshPtr()->getSMesh()->GetMeshDS();
-
-    std::vector<const SMDS_MeshNode*> nodes;
-    for (Py::List::iterator it = nodesList.begin(); it != nodesList.end(); ++it) {
-        Py::Long n(*it);
-        const SMDS_MeshNode* node = meshDS->FindNode(static_cast<int>(n));
-        if (!node) {
-            throw std::runtime_error("Failed to get node of the given indices");
-        }
-        nodes.push_back(node);
-    }
-
-    std::vector<const SMDS_MeshNode*>::iterator nodeIt = nodes.begin();
-    SMDS_MeshFace* face = nullptr;
-    Py::List result;
-    int np = 0;
-    for (Py::List::iterator it = npList.begin(); it != npList.end(); ++it, nodeIt += np) {
-        np = Py::Long(*it);
-        std::vector<const SMDS_MeshNode*> nodesElem(nodeIt, nodeIt + np);
-        switch (np) {
-            case 3:
-                face = meshDS->AddFace(nodesElem[0], nodesElem[1], nodesElem[2]);
-                break;
-            case 4:
-                face = meshDS->AddFace(nodesElem[0], nodesElem[1], nodesElem[2], nodesElem[3]);
-                break;
-            case 6:
-                face = meshDS->AddFace(
-                    nodesElem[0],
-                    nodesElem[1],
-                    nodesElem[2],
-                    nodesElem[3],
-                    nodesElem[4],
-                    nodesElem[5]
-                );
-                break;
-            case 8:
-                face = meshDS->AddFace(
-                    nodesElem[0],
-                    nodesElem[1],
-                    nodesElem[2],
-                    nodesElem[3],
-                    nodesElem[4],
-                    nodesElem[5],
-                    nodesElem[6],
-                    nodesElem[7]
-                );
-                break;
-            default:
-                PyErr_SetString(PyExc_TypeError, "Unknown node count, [3|4|6|8] are allowed");
-                return nullptr;
-        }
-        if (face) {
-            result.append(Py::Long(face->GetID()));
-        }
-        else {
-            PyErr_SetString(PyExc_TypeError, "Failed to add face");
-            return nullptr;
-        }
+    std::vector<int> ids = mesh->addElements(type, readIntegers(nodesObj), readIntegers(npObj));
+    Py::List result(ids.size());
+    for (std::size_t i = 0; i < ids.size(); i++) {
+        result[i] = Py::Long(ids[i]);
     }
-
     return Py::new_reference_to(result);
 }
 
+}  // namespace
 
-PyObject* FemMeshPy::addVolumeList(PyObject* args)
+PyObject* FemMeshPy::addEdgeList(PyObject* args)
 {
-    PyObject* nodesObj = nullptr;
-    PyObject* npObj = nullptr;
-    ;
-    if (!PyArg_ParseTuple(args, "O!O!", &PyList_Type, &nodesObj, &PyList_Type, &npObj)) {
-        return nullptr;
-    }
-
-    Py::List nodesList(nodesObj);
-    Py::List npList(npObj);
-    SMESHDS_Mesh* meshDS = getFemMeshPtr()->getSMesh()->GetMeshDS();
+    return addElementList(getFemMeshPtr(), SMDSAbs_Edge, args);
+}
 
-    std::vector<const SMDS_MeshNode*> nodes;
-    for (Py::List::iterator it = nodesList.begin(); it != nodesList.end(); ++it) {
-        Py::Long n(*it);
-        const SMDS_MeshNode* node = meshDS->FindNode(static_cast<int>(n));
-        if (!node) {
-            throw std::runtime_error("Failed to get node of the given indices");
-        }
-        nodes.push_back(node);
-    }
-
-    std::vector<const SMDS_MeshNode*>::iterator nodeIt = nodes.begin();
-    SMDS_MeshVolume* vol = nullptr;
-    Py::List result;
-    int np = 0;
-    for (Py::List::iterator it = npList.begin(); it != npList.end(); ++it, nodeIt += np) {
-        np = Py::Long(*it);
-        std::vector<const SMDS_MeshNode*> nodesElem(nodeIt, nodeIt + np);
-        switch (np) {
-            case 4:
-                vol = meshDS->AddVolume(nodesElem[0], nodesElem[1], nodesElem[2], nodesElem[3]);
-                break;
-            case 5:
-                vol = meshDS->AddVolume(
-                    nodesElem[0],
-                    nodesElem[1],
-                    nodesElem[2],
-                    nodesElem[3],
-                    nodesElem[4]
-                );
-                break;
-            case 6:
-                vol = meshDS->AddVolume(
-                    nodesElem[0],
-                    nodesElem[1],
-                    nodesElem[2],
-                    nodesElem[3],
-                    nodesElem[4],
-                    nodesElem[5]
-                );
-                break;
-            case 8:
-                vol = meshDS->AddVolume(
-                    nodesElem[0],
-                    nodesElem[1],
-                    nodesElem[2],
-                    nodesElem[3],
-                    nodesElem[4],
-                    nodesElem[5],
-                    nodesElem[6],
-                    nodesElem[7]
-                );
-                break;
-            case 10:
-                vol = meshDS->AddVolume(
-                    nodesElem[0],
-                    nodesElem[1],
-                    nodesElem[2],
-                    nodesElem[3],
-                    nodesElem[4],
-                    nodesElem[5],
-                    nodesElem[6],
-                    nodesElem[7],
-                    nodesElem[8],
-                    nodesElem[9]
-                );
-                break;
-            case 13:
-                vol = meshDS->AddVolume(
-                    nodesElem[0],
-                    nodesElem[1],
-                    nodesElem[2],
-                    nodesElem[3],
-                    nodesElem[4],
-                    nodesElem[5],
-                    nodesElem[6],
-                    nodesElem[7],
-                    nodesElem[8],
-                    nodesElem[9],
-                    nodesElem[10],
-                    nodesElem[11],
-                    nodesElem[12]
-                );
-                break;
-            case 15:
-                vol = meshDS->AddVolume(
-                    nodesElem[0],
-                    nodesElem[1],
-                    nodesElem[2],
-                    nodesElem[3],
-                    nodesElem[4],
-                    nodesElem[5],
-                    nodesElem[6],
-                    nodesElem[7],
-                    nodesElem[8],
-                    nodesElem[9],
-                    nodesElem[10],
-                    nodesElem[11],
-                    nodesElem[12],
-                    nodesElem[13],
-                    nodesElem[14]
-                );
-                break;
-            case 20:
-                vol = meshDS->AddVolume(
-                    nodesElem[0],
-                    nodesElem[1],
-                    nodesElem[2],
-                    nodesElem[3],
-                    nodesElem[4],
-                    nodesElem[5],
-                    nodesElem[6],
-                    nodesElem[7],
-                    nodesElem[8],
-                    nodesElem[9],
-                    nodesElem[10],
-                    nodesElem[11],
-                    nodesElem[12],
-                    nodesElem[13],
-                    nodesElem[14],
-                    nodesElem[15],
-                    nodesElem[16],
-                    nodesElem[17],
-                    nodesElem[18],
-                    nodesElem[19]
-                );
-                break;
-            default:
-                PyErr_SetString(PyExc_TypeError, "Unknown node count, [4|5|6|8|10|13|15|20] are allowed");
-                return nullptr;
-        }
-        if (vol) {
-            result.append(Py::Long(vol->GetID()));
-        }
-        else {
-            PyErr_SetString(PyExc_TypeError, "Failed to add face");
-            return nullptr;
-        }
-    }
+PyObject* FemMeshPy::addFaceList(PyObject* args)
+{
+    return addElementList(getFemMeshPtr(), SMDSAbs_Face, args);
+}
 
-    return Py::new_reference_to(result);
+PyObject* FemMeshPy::addVolumeList(PyObject* args)
+{
+    return addElementList(getFemMeshPtr(), SMDSAbs_Volume, args);
 }
 
 
@@ -1138,7 +943,12 @@ PyObject* FemMeshPy::read(PyObject* args)
     PyMem_Free(Name);
 
     try {
-        getFemMeshPtr()->read(EncodedName.c_str());
+        FemMesh mesh;
+        {
+            Base::PyGILStateRelease unlock;
+            mesh.read(EncodedName.c_str());
+        }
+        *getFemMeshPtr() = mesh;
     }
     catch (const std::exception& e) {
         PyErr_SetString(Base::PyExc_FC_GeneralError, e.what());
@@ -1157,6 +967,7 @@ PyObject* FemMeshPy::write(PyObject* args) const
     PyMem_Free(Name);
 
     try {
+        Base::PyGILStateRelease unlock;
         getFemMeshPtr()->write(EncodedName.c_str());
     }
     catch (const std::exception& e) {
@@ -1249,6 +1060,7 @@ PyObject* FemMeshPy::writeABAQUS(PyObject* args, PyObject* kwd) const
     }
 
     try {
+        Base::PyGILStateRelease unlock;
         getFemMeshPtr()->writeABAQUS(
             EncodedName.c_str(),
             elemParam,
@@ -1265,6 +1077,24 @@ PyObject* FemMeshPy::writeABAQUS(PyObject* args, PyObject* kwd) const
     Py_Return;
 }
 
+PyObject* FemMeshPy::writeABAQUSSet(PyObject* args) const
+{
+    PyObject* file;
+    const char* keyword;
+    const char* name;
+    PyObject* ids;
+    if (!PyArg_ParseTuple(args, "OssO", &file, &keyword, &name, &ids)) {
+        return nullptr;
+    }
+
+    // Format the whole set at once, a write call per ID is what makes large sets slow
+    std::ostringstream str;
+    FemMesh::writeABAQUSSet(str, keyword, name, readIntegers(ids));
+    Py::Callable write(Py::Object(file).getAttr("write"));
+    write.apply(Py::TupleN(Py::String(str.str())));
+    Py_Return;
+}
+
 PyObject* FemMeshPy::setTransform(PyObject* args)
 {
     PyObject* ptr;
@@ -1862,6 +1692,33 @@ Py::Dict FemMeshPy::getNodes() const
     return dict;
 }
 
+PyObject* FemMeshPy::getNodeArray(PyObject* args) const
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    SMESHDS_Mesh* meshDS = getFemMeshPtr()->getSMesh()->GetMeshDS();
+    Base::Matrix4D Mtrx = getFemMeshPtr()->getTransform();
+    auto count = static_cast<std::size_t>(meshDS->NbNodes());
+    Base::PyArrayWriter<int> ids(count, 1);
+    Base::PyArrayWriter<double> coords(count, 3);
+    int* id = ids.data();
+    double* coord = coords.data();
+
+    SMDS_NodeIteratorPtr aNodeIter = meshDS->nodesIterator();
+    for (std::size_t i = 0; i < count && aNodeIter->more(); i++) {
+        const SMDS_MeshNode* aNode = aNodeIter->next();
+        Base::Vector3d vec = Mtrx * Base::Vector3d(aNode->X(), aNode->Y(), aNode->Z());
+        *id++ = aNode->GetID();
+        *coord++ = vec.x;
+        *coord++ = vec.y;
+        *coord++ = vec.z;
+    }
+
+    return Py::new_reference_to(Py::TupleN(ids.getView(), coords.getView()));
+}
+
 Py::Long FemMeshPy::getNodeCount() const
 {
     return Py::Long(getFemMeshPtr()->getSMesh()->NbNodes());
@@ -22,17 +22,23 @@
 
 #include <SMESH_Version.h>
 
+#include <algorithm>
+#include <chrono>
+#include <future>
+
 #include <Python.h>
 #include <SMESHDS_Mesh.hxx>
 #include <SMESH_Mesh.hxx>
 
 #ifdef FCWithNetgen
 # include <NETGENPlugin_Hypothesis.hxx>
-# include <NETGENPlugin_Mesher.hxx>
+# include <NETGENPlugin_NETGEN_2D3D.hxx>
 #endif
 
 #include <App/DocumentObjectPy.h>
 #include <Base/Console.h>
+#include <Base/Exception.h>
+#include <Base/Sequencer.h>
 #include <Mod/Part/App/PartFeature.h>
 
 #include "FemMesh.h"
@@ -93,12 +99,8 @@ App::DocumentObjectExecReturn* FemMeshShapeNetgenObject::execute()
 
     TopoDS_Shape shape = feat->Shape.getValue();
 
-    NETGENPlugin_Mesher myNetGenMesher(newMesh.getSMesh(), shape, true);
-# if SMESH_VERSION_MAJOR >= 9
-    NETGENPlugin_Hypothesis* tet = new NETGENPlugin_Hypothesis(0, newMesh.getGenerator());
-# else
-    NETGENPlugin_Hypothesis* tet = new NETGENPlugin_Hypothesis(0, 0, newMesh.getGenerator());
-# endif
+    auto hyp = newMesh.createHypothesis<NETGENPlugin_Hypothesis>(0);
+    auto tet = static_cast<NETGENPlugin_Hypothesis*>(hyp.get());
     tet->SetMaxSize(MaxSize.getValue());
     tet->SetMinSize(MinSize.getValue());
     tet->SetSecondOrder(SecondOrder.getValue());
@@ -110,10 +112,40 @@ App::DocumentObjectExecReturn* FemMeshShapeNetgenObject::execute()
         tet->SetNbSegPerEdge(NbSegsPerEdge.getValue());
         tet->SetNbSegPerRadius(NbSegsPerRadius.getValue());
     }
-    myNetGenMesher.SetParameters(tet);
-    newMesh.getSMesh()->ShapeToMesh(shape);
 
-    myNetGenMesher.Compute();
+    // The algorithm runs the same mesher as NETGENPlugin_Mesher, and can report its progress
+    // and be canceled while computing
+    auto algo = newMesh.createHypothesis<NETGENPlugin_NETGEN_2D3D>(1);
+    auto mesher = static_cast<NETGENPlugin_NETGEN_2D3D*>(algo.get());
+    newMesh.getSMesh()->ShapeToMesh(shape);
+    newMesh.addHypothesis(shape, algo);
+    newMesh.addHypothesis(shape, hyp);
+
+    // Mesh in a worker thread, so the progress bar stays responsive
+    auto result = std::async(std::launch::async, [&newMesh]() { newMesh.compute(); });
+    {
+        Base::SequencerLauncher seq("Meshing with Netgen...", 100);
+        std::size_t percent = 0;
+        try {
+            while (result.wait_for(std::chrono::milliseconds(100)) != std::future_status::ready) {
+                auto progress = static_cast<std::size_t>(
+                    std::clamp(mesher->GetProgress(), 0.0, 1.0) * 100
+                );
+                if (progress > percent) {
+                    percent = progress;
+                    seq.setProgress(percent);
+                }
+                Base::Sequencer().checkAbort();
+            }
+        }
+        catch (const Base::AbortException&) {
+            mesher->CancelCompute();
+            result.wait();
+            return new App::DocumentObjectExecReturn("Meshing canceled by the user", this);
+        }
+    }
+    // Rethrow the exceptions of the mesher
+    result.get();
 
     SMESHDS_Mesh* data = const_cast<SMESH_Mesh*>(newMesh.getSMesh())->GetMeshDS();
     const SMDS_MeshInfo& info = data->GetMeshInfo();
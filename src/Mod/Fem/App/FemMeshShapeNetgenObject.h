@@ -52,6 +52,11 @@ public:
         return "FemGui::ViewProviderFemMeshShapeNetgen";
     }
     App::DocumentObjectExecReturn* execute() override;
+    /// Netgen keeps its meshing parameters and state in global variables
+    bool canRecomputeConcurrently() const override
+    {
+        return false;
+    }
 
     // virtual short mustExecute(void) const;
     // virtual PyObject *getPyObject(void);
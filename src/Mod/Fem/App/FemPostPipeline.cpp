@@ -21,6 +21,7 @@
  ***************************************************************************/
 
 #include <cmath>
+#include <map>
 
 #include <Python.h>
 #include <vtkAppendFilter.h>
@@ -38,6 +39,7 @@
 #include <vtkXMLUnstructuredGridReader.h>
 #include <vtkXMLMultiBlockDataReader.h>
 #include <vtkMultiBlockDataSet.h>
+#include <vtkDoubleArray.h>
 #include <vtkFloatArray.h>
 #include <vtkStringArray.h>
 #include <vtkInformation.h>
@@ -74,9 +76,21 @@ FemPostPipeline::FemPostPipeline()
         "set via pipeline object)."
     );
     ADD_PROPERTY_TYPE(MergeDuplicate, (false), "Pipeline", App::Prop_None, "Remove coindent elements.");
+    ADD_PROPERTY_TYPE(
+        LazyFrames,
+        (false),
+        "Pipeline",
+        App::Prop_None,
+        "Read the frames of file based multiframe results only when they are requested and keep "
+        "only a few in memory. The document then references the result files instead of "
+        "containing the frame data. Applies to the next read of files."
+    );
 
     // create our source algorithm
     m_source_algorithm = vtkSmartPointer<vtkFemFrameSourceAlgorithm>::New();
+    m_source_algorithm->setFrameReader([this](vtkDataObject* placeholder) {
+        return readFramePlaceholder(placeholder);
+    });
     m_clean_filter = vtkSmartPointer<vtkCleanUnstructuredGrid>::New();
 
     m_clean_filter->SetPointDataWeighingStrategy(vtkCleanUnstructuredGrid::AVERAGING);
@@ -202,7 +216,7 @@ vtkSmartPointer<vtkDataObject> FemPostPipeline::readPVD(const Base::FileInfo& fi
     std::string dir = file.dirPath();
     for (auto v : values) {
         Base::FileInfo fi(dir + "/" + v.second);
-        auto data = dataObjectFromFile(fi);
+        auto data = frameFromFile(fi);
         auto time = vtkSmartPointer<vtkFloatArray>::New();
         time->SetName("TimeValue");
         time->InsertNextValue(v.first);
@@ -216,6 +230,52 @@ vtkSmartPointer<vtkDataObject> FemPostPipeline::readPVD(const Base::FileInfo& fi
     return multiBlock;
 }
 
+vtkSmartPointer<vtkDataObject> FemPostPipeline::frameFromFile(const Base::FileInfo& File)
+{
+    if (!LazyFrames.getValue()) {
+        return dataObjectFromFile(File);
+    }
+    if (!File.isReadable()) {
+        throw Base::FileException("File to load not existing or not readable", File);
+    }
+    return vtkFemFrameSourceAlgorithm::createFramePlaceholder(File.filePath());
+}
+
+vtkSmartPointer<vtkDataObject> FemPostPipeline::readFramePlaceholder(vtkDataObject* placeholder)
+{
+    vtkFieldData* fieldData = placeholder->GetFieldData();
+    auto file = vtkStringArray::SafeDownCast(fieldData->GetAbstractArray("FrameFile"));
+    if (!file || file->GetNumberOfValues() < 1) {
+        return nullptr;
+    }
+
+    vtkSmartPointer<vtkDataObject> data;
+    try {
+        data = dataObjectFromFile(Base::FileInfo(file->GetValue(0)));
+    }
+    catch (const Base::Exception& e) {
+        Base::Console().error("Frame not loaded: %s\n", e.what());
+        return nullptr;
+    }
+
+    if (auto scale = vtkDoubleArray::SafeDownCast(fieldData->GetArray("FrameScale"))) {
+        PropertyPostDataObject::scaleDataObject(data, scale->GetValue(0));
+    }
+    // renames are stored as pairs of old and new name
+    auto renames = vtkStringArray::SafeDownCast(fieldData->GetAbstractArray("FrameRename"));
+    auto dataSet = vtkDataSet::SafeDownCast(data);
+    if (renames && dataSet) {
+        for (vtkIdType i = 0; i + 1 < renames->GetNumberOfValues(); i += 2) {
+            auto array = dataSet->GetPointData()->GetAbstractArray(renames->GetValue(i).c_str());
+            if (array) {
+                array->SetName(renames->GetValue(i + 1).c_str());
+            }
+        }
+    }
+
+    return data;
+}
+
 void FemPostPipeline::read(Base::FileInfo File)
 {
     Data.setValue(dataObjectFromFile(File));
@@ -268,7 +328,7 @@ void FemPostPipeline::read(
             throw Base::FileException("File to load not existing or not readable", File);
         }
 
-        auto data = dataObjectFromFile(File);
+        auto data = frameFromFile(File);
         data->GetFieldData()->AddArray(TimeValue);
         data->GetFieldData()->AddArray(TimeInfo);
 
@@ -281,6 +341,24 @@ void FemPostPipeline::read(
 
 void FemPostPipeline::scale(double s)
 {
+    // placeholders have no points, their scale is applied when the frame is read
+    if (auto blocks = vtkMultiBlockDataSet::SafeDownCast(Data.getValue())) {
+        for (unsigned int i = 0; i < blocks->GetNumberOfBlocks(); ++i) {
+            vtkDataObject* block = blocks->GetBlock(i);
+            if (!vtkFemFrameSourceAlgorithm::isFramePlaceholder(block)) {
+                continue;
+            }
+            auto scale = vtkDoubleArray::SafeDownCast(block->GetFieldData()->GetArray("FrameScale"));
+            if (!scale) {
+                scale = vtkDoubleArray::New();
+                scale->SetName("FrameScale");
+                scale->InsertNextValue(1.0);
+                block->GetFieldData()->AddArray(scale);
+                scale->Delete();
+            }
+            scale->SetValue(0, scale->GetValue(0) * s);
+        }
+    }
     Data.scale(s);
     onChanged(&Data);
 }
@@ -616,6 +694,10 @@ void FemPostPipeline::load(
     TimeInfo->InsertNextValue(frame_type);
     TimeInfo->InsertNextValue(unit.getString());
 
+    // the frames of a transient analysis usually share one mesh, it is converted only once
+    // and the grids of all these frames reference the same points and cells
+    std::map<const FemMeshObject*, vtkSmartPointer<vtkUnstructuredGrid>> meshGrids;
+
     auto multiblock = vtkSmartPointer<vtkMultiBlockDataSet>::New();
     for (ulong i = 0; i < res.size(); i++) {
 
@@ -624,9 +706,14 @@ void FemPostPipeline::load(
         }
 
         // first copy the mesh over
-        const FemMesh& mesh = static_cast<FemMeshObject*>(res[i]->Mesh.getValue())->FemMesh.getValue();
+        auto meshObj = static_cast<FemMeshObject*>(res[i]->Mesh.getValue());
+        vtkSmartPointer<vtkUnstructuredGrid>& meshGrid = meshGrids[meshObj];
+        if (!meshGrid) {
+            meshGrid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+            FemVTKTools::exportVTKMesh(&meshObj->FemMesh.getValue(), meshGrid);
+        }
         vtkSmartPointer<vtkUnstructuredGrid> grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
-        FemVTKTools::exportVTKMesh(&mesh, grid);
+        grid->ShallowCopy(meshGrid);
 
         // Now copy the point data over
         FemVTKTools::exportFreeCADResult(res[i], grid);
@@ -705,7 +792,24 @@ void FemPostPipeline::renameArrays(const std::map<std::string, std::string>& nam
     }
     else if (auto blocks = vtkMultiBlockDataSet::SafeDownCast(data)) {
         for (unsigned int i = 0; i < blocks->GetNumberOfBlocks(); ++i) {
-            if (auto dataSet = vtkDataSet::SafeDownCast(blocks->GetBlock(i))) {
+            vtkDataObject* block = blocks->GetBlock(i);
+            if (vtkFemFrameSourceAlgorithm::isFramePlaceholder(block)) {
+                // applied when the frame is read
+                auto renames = vtkStringArray::SafeDownCast(
+                    block->GetFieldData()->GetAbstractArray("FrameRename")
+                );
+                if (!renames) {
+                    renames = vtkStringArray::New();
+                    renames->SetName("FrameRename");
+                    block->GetFieldData()->AddArray(renames);
+                    renames->Delete();
+                }
+                for (const auto& name : names) {
+                    renames->InsertNextValue(name.first);
+                    renames->InsertNextValue(name.second);
+                }
+            }
+            else if (auto dataSet = vtkDataSet::SafeDownCast(block)) {
                 fields.emplace_back(dataSet);
             }
         }
@@ -52,6 +52,7 @@ public:
 
     App::PropertyEnumeration Frame;
     App::PropertyBool MergeDuplicate;
+    App::PropertyBool LazyFrames;
 
     virtual vtkDataSet* getDataSet() override;
     Fem::FemPostFunctionProvider* getFunctionProvider();
@@ -135,6 +136,10 @@ private:
         return reader->GetOutput();
     }
     vtkSmartPointer<vtkDataObject> dataObjectFromFile(const Base::FileInfo& File);
+    // file based frame: a placeholder if LazyFrames is set, otherwise the data of the file
+    vtkSmartPointer<vtkDataObject> frameFromFile(const Base::FileInfo& File);
+    // read the file of a frame placeholder and apply its scale and array names
+    vtkSmartPointer<vtkDataObject> readFramePlaceholder(vtkDataObject* placeholder);
     // read .pvd file into multiblock dataset
     vtkSmartPointer<vtkDataObject> readPVD(const Base::FileInfo& file);
 };
@@ -23,11 +23,13 @@
 
 
 #include <Python.h>
+#include <array>
 #include <charconv>
 #include <cmath>
 #include <cstdlib>
 #include <map>
 #include <memory>
+#include <stdexcept>
 
 #include <SMESHDS_Mesh.hxx>
 #include <SMESH_Mesh.hxx>
@@ -42,6 +44,7 @@
 #include <vtkIdList.h>
 #include <vtkLine.h>
 #include <vtkMultiBlockDataSet.h>
+#include <vtkNew.h>
 #include <vtkPointData.h>
 #include <vtkPyramid.h>
 #include <vtkQuad.h>
@@ -124,27 +127,61 @@ void fillVtkArray(vtkSmartPointer<vtkCellArray>& elemArray, std::vector<int>& ty
     types.push_back(SMDS_MeshCell::toVtkType(elem->GetEntityType()));
 }
 
-// Helper function to fill SMDS_Mesh elements ID from vtk cell
-void fillMeshElementIds(vtkCell* cell, std::vector<int>& ids)
+// Helper function to append the SMDS_Mesh node IDs of a vtk cell in SMDS order
+void appendMeshElementIds(int cellType, vtkIdList* pointIds, std::vector<int>& ids)
 {
-    VTKCellType cellType = static_cast<VTKCellType>(cell->GetCellType());
-    const std::vector<int>& order = SMDS_MeshCell::fromVtkOrder(cellType);
-    vtkIdType* vtkIds = cell->GetPointIds()->GetPointer(0);
-    ids.clear();
-    int nbPoints = cell->GetNumberOfPoints();
-    ids.resize(nbPoints);
+    const std::vector<int>& order = SMDS_MeshCell::fromVtkOrder(static_cast<VTKCellType>(cellType));
+    const vtkIdType* vtkIds = pointIds->GetPointer(0);
+    const vtkIdType nbPoints = pointIds->GetNumberOfIds();
     if (!order.empty()) {
-        for (int i = 0; i < nbPoints; ++i) {
-            ids[i] = vtkIds[order[i]] + 1;
+        for (vtkIdType i = 0; i < nbPoints; ++i) {
+            ids.push_back(static_cast<int>(vtkIds[order[i]] + 1));
         }
     }
     else {
-        for (int i = 0; i < nbPoints; ++i) {
-            ids[i] = vtkIds[i] + 1;
+        for (vtkIdType i = 0; i < nbPoints; ++i) {
+            ids.push_back(static_cast<int>(vtkIds[i] + 1));
         }
     }
 }
 
+// The SMDS element type of the supported vtk cell types, SMDSAbs_All for the others
+SMDSAbs_ElementType getMeshElementType(int cellType)
+{
+    switch (cellType) {
+        // 1D edges
+        case VTK_LINE:            // seg2
+        case VTK_QUADRATIC_EDGE:  // seg3
+            return SMDSAbs_Edge;
+        // 2D faces
+        case VTK_TRIANGLE:            // tria3
+        case VTK_QUADRATIC_TRIANGLE:  // tria6
+        case VTK_QUAD:                // quad4
+        case VTK_QUADRATIC_QUAD:      // quad8
+            return SMDSAbs_Face;
+        // 3D volumes
+        case VTK_TETRA:                   // tetra4
+        case VTK_QUADRATIC_TETRA:         // tetra10
+        case VTK_HEXAHEDRON:              // hexa8
+        case VTK_QUADRATIC_HEXAHEDRON:    // hexa20
+        case VTK_WEDGE:                   // penta6
+        case VTK_QUADRATIC_WEDGE:         // penta15
+        case VTK_PYRAMID:                 // pyra5
+        case VTK_QUADRATIC_PYRAMID:       // pyra13
+            return SMDSAbs_Volume;
+        default:
+            return SMDSAbs_All;
+    }
+}
+
+// The elements of one dimension, gathered for FemMesh::addElements
+struct MeshElements
+{
+    std::vector<int> nodes;
+    std::vector<int> nodeCounts;
+    std::vector<int> ids;
+};
+
 }  // namespace
 
 
@@ -160,156 +197,41 @@ void FemVTKTools::importVTKMesh(vtkSmartPointer<vtkDataSet> dataset, FemMesh* me
     SMESHDS_Mesh* meshds = smesh->GetMeshDS();
     meshds->ClearMesh();
 
+    std::vector<double> coords(3 * nPoints);
+    std::vector<int> nodeIds(nPoints);
     for (vtkIdType i = 0; i < nPoints; i++) {
         double* p = dataset->GetPoint(i);
-        meshds->AddNodeWithID(p[0] * scale, p[1] * scale, p[2] * scale, i + 1);
-    }
-
+        coords[3 * i] = p[0] * scale;
+        coords[3 * i + 1] = p[1] * scale;
+        coords[3 * i + 2] = p[2] * scale;
+        nodeIds[i] = static_cast<int>(i + 1);
+    }
+    mesh->addNodes(coords, nodeIds);
+
+    // Read the point IDs straight from the dataset instead of making a vtkCell per cell
+    // and add the elements of each dimension in one go, keeping the cell numbering
+    std::map<SMDSAbs_ElementType, MeshElements> elements;
+    vtkNew<vtkIdList> pointIds;
+    bool unsupported = false;
     for (vtkIdType iCell = 0; iCell < nCells; iCell++) {
-        vtkCell* cell = dataset->GetCell(iCell);
-        std::vector<int> ids;
-        fillMeshElementIds(cell, ids);
-        switch (cell->GetCellType()) {
-            // 1D edges
-            case VTK_LINE:  // seg2
-                meshds->AddEdgeWithID(ids[0], ids[1], iCell + 1);
-                break;
-            case VTK_QUADRATIC_EDGE:  // seg3
-                meshds->AddEdgeWithID(ids[0], ids[1], ids[2], iCell + 1);
-                break;
-            // 2D faces
-            case VTK_TRIANGLE:  // tria3
-                meshds->AddFaceWithID(ids[0], ids[1], ids[2], iCell + 1);
-                break;
-            case VTK_QUADRATIC_TRIANGLE:  // tria6
-                meshds->AddFaceWithID(ids[0], ids[1], ids[2], ids[3], ids[4], ids[5], iCell + 1);
-                break;
-            case VTK_QUAD:  // quad4
-                meshds->AddFaceWithID(ids[0], ids[1], ids[2], ids[3], iCell + 1);
-                break;
-            case VTK_QUADRATIC_QUAD:  // quad8
-                meshds->AddFaceWithID(
-                    ids[0],
-                    ids[1],
-                    ids[2],
-                    ids[3],
-                    ids[4],
-                    ids[5],
-                    ids[6],
-                    ids[7],
-                    iCell + 1
-                );
-                break;
-            // 3D volumes
-            case VTK_TETRA:  // tetra4
-                meshds->AddVolumeWithID(ids[0], ids[1], ids[2], ids[3], iCell + 1);
-                break;
-            case VTK_QUADRATIC_TETRA:  // tetra10
-                meshds->AddVolumeWithID(
-                    ids[0],
-                    ids[1],
-                    ids[2],
-                    ids[3],
-                    ids[4],
-                    ids[5],
-                    ids[6],
-                    ids[7],
-                    ids[8],
-                    ids[9],
-                    iCell + 1
-                );
-                break;
-            case VTK_HEXAHEDRON:  // hexa8
-                meshds->AddVolumeWithID(
-                    ids[0],
-                    ids[1],
-                    ids[2],
-                    ids[3],
-                    ids[4],
-                    ids[5],
-                    ids[6],
-                    ids[7],
-                    iCell + 1
-                );
-                break;
-            case VTK_QUADRATIC_HEXAHEDRON:  // hexa20
-                meshds->AddVolumeWithID(
-                    ids[0],
-                    ids[1],
-                    ids[2],
-                    ids[3],
-                    ids[4],
-                    ids[5],
-                    ids[6],
-                    ids[7],
-                    ids[8],
-                    ids[9],
-                    ids[10],
-                    ids[11],
-                    ids[12],
-                    ids[13],
-                    ids[14],
-                    ids[15],
-                    ids[16],
-                    ids[17],
-                    ids[18],
-                    ids[19],
-                    iCell + 1
-                );
-                break;
-            case VTK_WEDGE:  // penta6
-                meshds->AddVolumeWithID(ids[0], ids[1], ids[2], ids[3], ids[4], ids[5], iCell + 1);
-                break;
-            case VTK_QUADRATIC_WEDGE:  // penta15
-                meshds->AddVolumeWithID(
-                    ids[0],
-                    ids[1],
-                    ids[2],
-                    ids[3],
-                    ids[4],
-                    ids[5],
-                    ids[6],
-                    ids[7],
-                    ids[8],
-                    ids[9],
-                    ids[10],
-                    ids[11],
-                    ids[12],
-                    ids[13],
-                    ids[14],
-                    iCell + 1
-                );
-                break;
-            case VTK_PYRAMID:  // pyra5
-                meshds->AddVolumeWithID(ids[0], ids[1], ids[2], ids[3], ids[4], iCell + 1);
-                break;
-            case VTK_QUADRATIC_PYRAMID:  // pyra13
-                meshds->AddVolumeWithID(
-                    ids[0],
-                    ids[1],
-                    ids[2],
-                    ids[3],
-                    ids[4],
-                    ids[5],
-                    ids[6],
-                    ids[7],
-                    ids[8],
-                    ids[9],
-                    ids[10],
-                    ids[11],
-                    ids[12],
-                    iCell + 1
-                );
-                break;
-
-            // not handled cases
-            default: {
-                Base::Console().error(
-                    "Only common 1D, 2D and 3D Cells are supported in VTK mesh import\n"
-                );
-                break;
-            }
+        int cellType = dataset->GetCellType(iCell);
+        SMDSAbs_ElementType type = getMeshElementType(cellType);
+        if (type == SMDSAbs_All) {
+            unsupported = true;
+            continue;
         }
+        dataset->GetCellPoints(iCell, pointIds);
+        MeshElements& elems = elements[type];
+        appendMeshElementIds(cellType, pointIds, elems.nodes);
+        elems.nodeCounts.push_back(static_cast<int>(pointIds->GetNumberOfIds()));
+        elems.ids.push_back(static_cast<int>(iCell + 1));
+    }
+    if (unsupported) {
+        Base::Console().error("Only common 1D, 2D and 3D Cells are supported in VTK mesh import\n");
+    }
+
+    for (const auto& [type, elems] : elements) {
+        mesh->addElements(type, elems.nodes, elems.nodeCounts, elems.ids);
     }
 }
 
@@ -1175,77 +1097,80 @@ void valueFromLine<double>(const std::string_view::iterator& it, int digits, dou
     value = std::strtof(sub.data(), nullptr);
 }
 
-// add cell from sorted nodes
-template<typename T>
-void addCell(vtkSmartPointer<vtkCellArray>& cellArray, const std::vector<int>& topoElem)
+// map CalculiX element type to Vtk cell type
+std::map<ElementType, int> mapCcxTypeToVtk = {
+    {ElementType::Edge, VTK_LINE},
+    {ElementType::QuadEdge, VTK_QUADRATIC_EDGE},
+    {ElementType::Triangle, VTK_TRIANGLE},
+    {ElementType::QuadTriangle, VTK_QUADRATIC_TRIANGLE},
+    {ElementType::Quadrangle, VTK_QUAD},
+    {ElementType::QuadQuadrangle, VTK_QUADRATIC_QUAD},
+    {ElementType::Tetra, VTK_TETRA},
+    {ElementType::QuadTetra, VTK_QUADRATIC_TETRA},
+    {ElementType::Hexa, VTK_HEXAHEDRON},
+    {ElementType::QuadHexa, VTK_QUADRATIC_HEXAHEDRON},
+    {ElementType::Penta, VTK_WEDGE},
+    {ElementType::QuadPenta, VTK_QUADRATIC_WEDGE},
+};
+
+// frd node number to vtk point id.
+// The node numbers are mostly contiguous, so a plain vector needs a fraction of the memory
+// of a std::map and the lookup is a single index operation
+class NodeMap
 {
-    vtkSmartPointer<T> cell = vtkSmartPointer<T>::New();
-    cell->GetPointIds()->SetNumberOfIds(topoElem.size());
-    int type = cell->GetCellType();
-    for (size_t i = 0; i < topoElem.size(); ++i) {
-        cell->GetPointIds()->SetId(i, topoElem[mapCcxToVtk[type][i]]);
+public:
+    void reserve(long numNodes)
+    {
+        ids.reserve(numNodes + 1);
+    }
+    void insert(int node, vtkIdType id)
+    {
+        if (node < 0) {
+            return;
+        }
+        if (static_cast<size_t>(node) >= ids.size()) {
+            ids.resize(node + 1, -1);
+        }
+        if (ids[node] < 0) {
+            ++count;
+        }
+        ids[node] = id;
+    }
+    // throws std::out_of_range for unknown nodes like std::map::at()
+    vtkIdType at(int node) const
+    {
+        if (node < 0 || static_cast<size_t>(node) >= ids.size() || ids[node] < 0) {
+            throw std::out_of_range("Unknown frd node");
+        }
+        return ids[node];
+    }
+    size_t size() const
+    {
+        return count;
     }
-    cellArray->InsertNextCell(cell);
-}
 
-// fill cell array
+private:
+    std::vector<vtkIdType> ids;
+    size_t count {0};
+};
+
+// fill cell array from sorted nodes, the ids are inserted directly without creating a
+// vtkCell object for each element
 void fillCell(
     vtkSmartPointer<vtkCellArray>& cellArray,
-    std::vector<int>& topoElem,
+    const std::vector<vtkIdType>& topoElem,
     std::vector<int>& vtkType,
     ElementType elemType
 )
 {
-    switch (elemType) {
-        case ElementType::Hexa:
-            addCell<vtkHexahedron>(cellArray, topoElem);
-            vtkType.emplace_back(VTK_HEXAHEDRON);
-            break;
-        case ElementType::Penta:
-            addCell<vtkWedge>(cellArray, topoElem);
-            vtkType.emplace_back(VTK_WEDGE);
-            break;
-        case ElementType::Tetra:
-            addCell<vtkTetra>(cellArray, topoElem);
-            vtkType.emplace_back(VTK_TETRA);
-            break;
-        case ElementType::QuadHexa:
-            addCell<vtkQuadraticHexahedron>(cellArray, topoElem);
-            vtkType.emplace_back(VTK_QUADRATIC_HEXAHEDRON);
-            break;
-        case ElementType::QuadPenta:
-            addCell<vtkQuadraticWedge>(cellArray, topoElem);
-            vtkType.emplace_back(VTK_QUADRATIC_WEDGE);
-            break;
-        case ElementType::QuadTetra:
-            addCell<vtkQuadraticTetra>(cellArray, topoElem);
-            vtkType.emplace_back(VTK_QUADRATIC_TETRA);
-            break;
-        case ElementType::Triangle:
-            addCell<vtkTriangle>(cellArray, topoElem);
-            vtkType.emplace_back(VTK_TRIANGLE);
-            break;
-        case ElementType::QuadTriangle:
-            addCell<vtkQuadraticTriangle>(cellArray, topoElem);
-            vtkType.emplace_back(VTK_QUADRATIC_TRIANGLE);
-            break;
-        case ElementType::Quadrangle:
-            addCell<vtkQuad>(cellArray, topoElem);
-            vtkType.emplace_back(VTK_QUAD);
-            break;
-        case ElementType::QuadQuadrangle:
-            addCell<vtkQuadraticQuad>(cellArray, topoElem);
-            vtkType.emplace_back(VTK_QUADRATIC_QUAD);
-            break;
-        case ElementType::Edge:
-            addCell<vtkLine>(cellArray, topoElem);
-            vtkType.emplace_back(VTK_LINE);
-            break;
-        case ElementType::QuadEdge:
-            addCell<vtkQuadraticEdge>(cellArray, topoElem);
-            vtkType.emplace_back(VTK_QUADRATIC_EDGE);
-            break;
+    int type = mapCcxTypeToVtk[elemType];
+    const std::vector<int>& order = mapCcxToVtk[type];
+    std::array<vtkIdType, 20> ids {};
+    for (size_t i = 0; i < topoElem.size(); ++i) {
+        ids[i] = topoElem[order[i]];
     }
+    cellArray->InsertNextCell(static_cast<vtkIdType>(topoElem.size()), ids.data());
+    vtkType.emplace_back(type);
 }
 
 struct FRDResultInfo
@@ -1307,7 +1232,7 @@ std::vector<size_t> identifyScalarEntities(const std::vector<std::vector<int>> e
 }
 
 // read nodes and fill vtkPoints object
-std::map<int, int> readNodes(
+NodeMap readNodes(
     std::ifstream& ifstr,
     const std::string& lines,
     vtkSmartPointer<vtkPoints>& points
@@ -1322,7 +1247,7 @@ std::map<int, int> readNodes(
 
     // frd file might have nodes that are not numbered starting from zero.
     // Use the map to identify them
-    std::map<int, int> mapNodes;
+    NodeMap mapNodes;
 
     std::string_view view {lines};
     std::string_view sub = view.substr(keyCode.length() + 18);
@@ -1334,6 +1259,7 @@ std::map<int, int> readNodes(
     int digits = getDigits(static_cast<Indicator>(indicator));
 
     points->SetNumberOfPoints(numNodes);
+    mapNodes.reserve(numNodes);
 
     std::string line;
     while (nodeID < numNodes && std::getline(ifstr, line)) {
@@ -1352,7 +1278,7 @@ std::map<int, int> readNodes(
         }
 
         points->SetPoint(nodeID, coords.data());
-        mapNodes[node] = nodeID++;
+        mapNodes.insert(node, nodeID++);
     }
 
     return mapNodes;
@@ -1362,7 +1288,7 @@ std::map<int, int> readNodes(
 std::vector<int> readElements(
     std::ifstream& ifstr,
     const std::string& lines,
-    const std::map<int, int>& mapNodes,
+    const NodeMap& mapNodes,
     vtkSmartPointer<vtkCellArray>& cellArray
 )
 {
@@ -1376,8 +1302,7 @@ std::vector<int> readElements(
     long elemID = 0;
     // element info: {type, group, material}
     std::vector<int> info(3);
-    std::map<int, int> mapElem;
-    std::vector<int> topoElem;
+    std::vector<vtkIdType> topoElem;
     std::vector<int> vtkType;
 
     std::string_view view {lines};
@@ -1388,6 +1313,7 @@ std::vector<int> readElements(
     sub = sub.substr(12 + 37);
     valueFromLine(sub.begin(), 1, indicator);
     int digits = getDigits(static_cast<Indicator>(indicator));
+    vtkType.reserve(numElem);
     while (elemID < numElem && std::getline(ifstr, line)) {
         std::string_view view {line};
         if (view.rfind(keyCodeType, 0) == 0) {
@@ -1413,7 +1339,7 @@ std::vector<int> readElements(
             if (topoElem.size() == mapCcxTypeNodes[static_cast<ElementType>(info[0])]) {
                 fillCell(cellArray, topoElem, vtkType, static_cast<ElementType>(info[0]));
                 topoElem.clear();
-                mapElem[elem] = elemID++;
+                ++elemID;
             }
         }
     }
@@ -1460,7 +1386,7 @@ void readResultInfo(std::ifstream& ifstr, const std::string& lines, FRDResultInf
 void readResults(
     std::ifstream& ifstr,
     const std::string& lines,
-    const std::map<int, int>& mapNodes,
+    const NodeMap& mapNodes,
     const FRDResultInfo& info,
     vtkSmartPointer<vtkUnstructuredGrid>& grid
 )
@@ -1520,13 +1446,6 @@ void readResults(
     // enter in node values block
     std::string code1 = " -1";
     std::string code2 = " -2";
-    int node {-1};
-    double value {0.0};
-    std::vector<double> vecValues;
-    std::vector<double> scaValues;
-    std::vector<int> nodes;
-    int countNodes = 0;
-    size_t countScaPos {0};
     // result block could have both vector/matrix and scalar components
     // save each scalars entity in his own array
     auto scalarPos = identifyScalarEntities(entityTypes);
@@ -1538,7 +1457,8 @@ void readResults(
         scaArrays.emplace_back(vtkSmartPointer<vtkDoubleArray>::New());
     }
 
-    vecArray->SetNumberOfComponents(numComps - scalarPos.size());
+    const int numVecComps = static_cast<int>(numComps - scalarPos.size());
+    vecArray->SetNumberOfComponents(numVecComps);
     vecArray->SetNumberOfTuples(mapNodes.size());
     vecArray->SetName(dataSetName.c_str());
     // set all values to zero
@@ -1557,73 +1477,112 @@ void readResults(
         }
     }
 
-    while (countNodes < info.numNodes && std::getline(ifstr, line)) {
+    // target of each component: >= 0 is the component of vecArray, < 0 is scaArrays[-target - 1]
+    std::vector<int> target(numComps);
+    for (unsigned int comp = 0, vecComp = 0; comp < numComps; ++comp) {
+        auto pos = std::ranges::find(scalarPos, comp);
+        if (pos == scalarPos.end()) {
+            target[comp] = static_cast<int>(vecComp++);
+        }
+        else {
+            target[comp] = -static_cast<int>(pos - scalarPos.begin()) - 1;
+        }
+    }
+
+    // First read the lines of the block, then convert the values of the nodes concurrently.
+    // The buffer only holds one result block, and the values are written straight into the
+    // preallocated arrays
+    std::string buffer;
+    std::vector<size_t> lineStarts;
+    std::vector<size_t> records;  // first line of each node
+    long countNodes = 0;
+    while (std::getline(ifstr, line)) {
         std::string_view view {line};
-        if (view.rfind(code1, 0) == 0) {
-            sub = view.substr(code1.length());
-            valueFromLine(sub.begin(), digits, node);
-            // clear values vector for each node result block
-            vecValues.clear();
-            scaValues.clear();
-            countScaPos = 0;
-            try {
-                // result nodes could not exist in .frd file due to element expansion
-                // so mapNodes.at() could throw an exception
-                nodes.emplace_back(mapNodes.at(node));
-                sub = sub.substr(digits);
-                for (auto it = sub.begin(); it != sub.end(); it += 12, ++countScaPos) {
-                    valueFromLine(it, 12, value);
-                    // search if value is scalar or vector/matrix component
-                    auto pos = std::ranges::find(scalarPos, countScaPos);
-                    if (pos == scalarPos.end()) {
-                        vecValues.emplace_back(value);
-                    }
-                    else {
-                        scaValues.emplace_back(value);
-                    }
-                }
+        bool first = view.rfind(code1, 0) == 0;
+        if (!first && view.rfind(code2, 0) != 0) {
+            // end of block, or a line not belonging to the node values
+            if (countNodes >= info.numNodes) {
+                break;
             }
-            catch (const std::out_of_range&) {
-                Base::Console().warning("Invalid node: %d\n", node);
+            continue;
+        }
+        if (first) {
+            if (countNodes >= info.numNodes) {
+                break;
             }
+            records.emplace_back(lineStarts.size());
             ++countNodes;
         }
-        else if (view.rfind(code2, 0) == 0) {
-            sub = view.substr(code2.length() + digits);
+        lineStarts.emplace_back(buffer.size());
+        buffer.append(line);
+        buffer.push_back('\n');
+    }
+    lineStarts.emplace_back(buffer.size());
+    records.emplace_back(lineStarts.size() - 1);
+
+    double* vecData = numVecComps > 0 ? vecArray->GetPointer(0) : nullptr;
+    std::vector<double*> scaData;
+    for (auto& s : scaArrays) {
+        scaData.emplace_back(s->GetPointer(0));
+    }
+    std::vector<int> invalidNodes(records.size() - 1, -1);
+    const long numRecords = static_cast<long>(records.size()) - 1;
+
+#pragma omp parallel for schedule(static)
+    for (long r = 0; r < numRecords; ++r) {
+        int node {-1};
+        double value {0.0};
+        std::vector<double> values;
+        values.reserve(numComps);
+        for (size_t l = records[r]; l < records[r + 1]; ++l) {
+            // without the line break
+            std::string_view view(
+                buffer.data() + lineStarts[l],
+                lineStarts[l + 1] - lineStarts[l] - 1
+            );
+            std::string_view sub;
+            if (l == records[r]) {
+                sub = view.substr(code1.length());
+                valueFromLine(sub.begin(), digits, node);
+                sub = sub.substr(digits);
+            }
+            else {
+                sub = view.substr(code2.length() + digits);
+            }
             for (auto it = sub.begin(); it != sub.end(); it += 12) {
                 valueFromLine(it, 12, value);
-                // search if value is scalar or vector/matrix component
-                auto pos = std::ranges::find(scalarPos, countScaPos);
-                if (pos == scalarPos.end()) {
-                    vecValues.emplace_back(value);
-                }
-                else {
-                    scaValues.emplace_back(value);
-                }
+                values.emplace_back(value);
             }
         }
-        if ((vecValues.size() + scaValues.size()) == numComps) {
-            if (!vecValues.empty()) {
-                if (node == -1) {
-                    throw Base::FileException("File to load not readable");
-                }
-                vecArray->SetTuple(mapNodes.at(node), vecValues.data());
+        vtkIdType id = -1;
+        try {
+            // result nodes could not exist in .frd file due to element expansion
+            // so mapNodes.at() could throw an exception
+            id = mapNodes.at(node);
+        }
+        catch (const std::out_of_range&) {
+            invalidNodes[r] = node;
+        }
+        if (id < 0 || values.size() != numComps) {
+            continue;
+        }
+        for (unsigned int comp = 0; comp < numComps; ++comp) {
+            int t = target[comp];
+            if (t >= 0) {
+                vecData[id * numVecComps + t] = values[comp];
             }
-            if (!scaValues.empty()) {
-                if (node == -1) {
-                    throw Base::FileException("File to load not readable");
-                }
-                std::vector<vtkSmartPointer<vtkDoubleArray>>::iterator it1;
-                std::vector<double>::iterator it2;
-                for (it1 = scaArrays.begin(), it2 = scaValues.begin();
-                     it1 != scaArrays.end() && it2 != scaValues.end();
-                     ++it1, ++it2) {
-                    (*it1)->SetTuple1(mapNodes.at(node), *it2);
-                }
+            else {
+                scaData[-t - 1][id] = values[comp];
             }
         }
     }
 
+    for (int node : invalidNodes) {
+        if (node != -1) {
+            Base::Console().warning("Invalid node: %d\n", node);
+        }
+    }
+
     // add vecArray only if not all scalars
     if (numComps != scalarPos.size()) {
         grid->GetPointData()->AddArray(vecArray);
@@ -1662,7 +1621,7 @@ vtkSmartPointer<vtkMultiBlockDataSet> readFRD(std::ifstream& ifstr)
     std::map<FRDResultInfo, vtkSmartPointer<vtkUnstructuredGrid>> grids;
     std::map<AnalysisType, vtkSmartPointer<vtkMultiBlockDataSet>> blocks;
     std::string line;
-    std::map<int, int> mapNodes;
+    NodeMap mapNodes;
     std::vector<int> cellTypes;
 
     while (std::getline(ifstr, line)) {
@@ -47,6 +47,8 @@ public:
     //@{
     /// Scale the point coordinates of the data set with factor \a s
     void scale(double s);
+    /// Scale the point coordinates of \a dataObject with factor \a s
+    static void scaleDataObject(vtkDataObject* dataObject, double s);
     /// set the dataset
     void setValue(const vtkSmartPointer<vtkDataObject>&);
     /// get the part shape
@@ -79,9 +81,6 @@ public:
     /// Get valid paths for this property; used by auto completer
     void getPaths(std::vector<App::ObjectIdentifier>& paths) const override;
 
-private:
-    static void scaleDataObject(vtkDataObject*, double s);
-
 protected:
     void createDataObjectByExternalType(vtkSmartPointer<vtkDataObject> ex);
     vtkSmartPointer<vtkDataObject> m_dataObject;
@@ -35,6 +35,7 @@
 # include <vtkFloatArray.h>
 # include <vtkInformation.h>
 # include <vtkInformationVector.h>
+# include <vtkStringArray.h>
 #endif
 
 #include "vtkFemFrameSourceAlgorithm.h"
@@ -56,10 +57,78 @@ vtkFemFrameSourceAlgorithm::~vtkFemFrameSourceAlgorithm() = default;
 void vtkFemFrameSourceAlgorithm::setDataObject(vtkSmartPointer<vtkDataObject> data)
 {
     m_data = data;
+    m_frameCache.clear();
     Modified();
     Update();
 }
 
+void vtkFemFrameSourceAlgorithm::setFrameReader(FrameReader reader)
+{
+    m_frameReader = std::move(reader);
+    m_frameCache.clear();
+}
+
+void vtkFemFrameSourceAlgorithm::setFrameCacheSize(unsigned long size)
+{
+    m_frameCacheSize = std::max(size, 1ul);
+    while (m_frameCache.size() > m_frameCacheSize) {
+        m_frameCache.pop_back();
+    }
+}
+
+vtkSmartPointer<vtkDataObject> vtkFemFrameSourceAlgorithm::createFramePlaceholder(
+    const std::string& file
+)
+{
+    auto placeholder = vtkSmartPointer<vtkUnstructuredGrid>::New();
+    auto frameFile = vtkSmartPointer<vtkStringArray>::New();
+    frameFile->SetName("FrameFile");
+    frameFile->InsertNextValue(file);
+    placeholder->GetFieldData()->AddArray(frameFile);
+    return placeholder;
+}
+
+bool vtkFemFrameSourceAlgorithm::isFramePlaceholder(vtkDataObject* block)
+{
+    return block && block->GetFieldData()->HasArray("FrameFile");
+}
+
+vtkSmartPointer<vtkDataObject> vtkFemFrameSourceAlgorithm::getFrame(unsigned long idx)
+{
+    vtkSmartPointer<vtkMultiBlockDataSet> multiblock = vtkMultiBlockDataSet::SafeDownCast(m_data);
+    vtkDataObject* block = multiblock->GetBlock(idx);
+    if (!isFramePlaceholder(block) || !m_frameReader) {
+        return block;
+    }
+
+    auto it = std::ranges::find_if(m_frameCache, [idx](const auto& entry) {
+        return entry.first == idx;
+    });
+    if (it != m_frameCache.end()) {
+        m_frameCache.splice(m_frameCache.begin(), m_frameCache, it);
+        return it->second;
+    }
+
+    vtkSmartPointer<vtkDataObject> frame = m_frameReader(block);
+    if (!frame) {
+        return block;
+    }
+    // keep the frame information of the placeholder
+    vtkFieldData* fieldData = block->GetFieldData();
+    for (int i = 0; i < fieldData->GetNumberOfArrays(); ++i) {
+        vtkAbstractArray* array = fieldData->GetAbstractArray(i);
+        if (array->GetName() && std::string(array->GetName()).rfind("Frame", 0) != 0) {
+            frame->GetFieldData()->AddArray(array);
+        }
+    }
+
+    m_frameCache.emplace_front(idx, frame);
+    if (m_frameCache.size() > m_frameCacheSize) {
+        m_frameCache.pop_back();
+    }
+    return frame;
+}
+
 bool vtkFemFrameSourceAlgorithm::isValid()
 {
     return m_data.GetPointer() ? true : false;
@@ -162,7 +231,6 @@ int vtkFemFrameSourceAlgorithm::RequestData(
         return 1;
     }
 
-    vtkSmartPointer<vtkMultiBlockDataSet> multiblock = vtkMultiBlockDataSet::SafeDownCast(m_data);
     // find the block asked for (lazy implementation)
     unsigned long idx = 0;
     if (outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP())) {
@@ -179,7 +247,7 @@ int vtkFemFrameSourceAlgorithm::RequestData(
         idx = std::distance(frames.begin(), it);
     }
 
-    auto block = multiblock->GetBlock(idx);
+    auto block = getFrame(idx);
     output->ShallowCopy(block);
     return 1;
 }
@@ -23,6 +23,12 @@
 
 #pragma once
 
+#include <functional>
+#include <list>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include <vtkSmartPointer.h>
 #include <vtkUnstructuredGridAlgorithm.h>
 
@@ -45,12 +51,25 @@ public:
     void setDataObject(vtkSmartPointer<vtkDataObject> data);
     std::vector<double> getFrameValues();
 
+    // frames can be placeholders that only reference a result file: they are read with the
+    // frame reader when requested, and only the most recently used ones are kept in memory
+    using FrameReader = std::function<vtkSmartPointer<vtkDataObject>(vtkDataObject* placeholder)>;
+    void setFrameReader(FrameReader reader);
+    void setFrameCacheSize(unsigned long size);
+    static vtkSmartPointer<vtkDataObject> createFramePlaceholder(const std::string& file);
+    static bool isFramePlaceholder(vtkDataObject* block);
+
 protected:
     vtkFemFrameSourceAlgorithm();
     ~vtkFemFrameSourceAlgorithm() override;
 
     vtkSmartPointer<vtkDataObject> m_data;
 
+    vtkSmartPointer<vtkDataObject> getFrame(unsigned long idx);
+    FrameReader m_frameReader;
+    unsigned long m_frameCacheSize = 3;
+    std::list<std::pair<unsigned long, vtkSmartPointer<vtkDataObject>>> m_frameCache;
+
     int RequestInformation(
         vtkInformation* reqInfo,
         vtkInformationVector** inVector,
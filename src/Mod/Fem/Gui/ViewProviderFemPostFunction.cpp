@@ -39,6 +39,7 @@
 #include <QApplication>
 #include <QMessageBox>
 #include <QTextStream>
+#include <QTimer>
 
 #include <App/Document.h>
 #include <Base/UnitsApi.h>
@@ -149,6 +150,7 @@ ViewProviderFemPostFunction::ViewProviderFemPostFunction()
     , m_autoscale(false)
     , m_isDragging(false)
     , m_autoRecompute(false)
+    , m_recomputeTimer(new QTimer())
 {
     ADD_PROPERTY_TYPE(AutoScaleFactorX, (1), "AutoScale", App::Prop_Hidden, "Automatic scaling factor");
     ADD_PROPERTY_TYPE(AutoScaleFactorY, (1), "AutoScale", App::Prop_Hidden, "Automatic scaling factor");
@@ -160,10 +162,22 @@ ViewProviderFemPostFunction::ViewProviderFemPostFunction()
     m_scale = new SoScale();
     m_scale->ref();
     m_scale->scaleFactor = SbVec3f(1, 1, 1);
+
+    // The motion events during a drag only start the timer. It fires once the queued events are
+    // handled, so a slow pipeline is recomputed once with the latest position instead of once
+    // per event, and the previous result stays visible meanwhile
+    m_recomputeTimer->setSingleShot(true);
+    m_recomputeTimer->setInterval(0);
+    QObject::connect(m_recomputeTimer, &QTimer::timeout, [this]() {
+        if (m_isDragging && m_autoRecompute) {
+            getObject()->getDocument()->recompute();
+        }
+    });
 }
 
 ViewProviderFemPostFunction::~ViewProviderFemPostFunction()
 {
+    delete m_recomputeTimer;
     m_geometrySeperator->unref();
     m_manip->unref();
     m_scale->unref();
@@ -280,6 +294,7 @@ void ViewProviderFemPostFunction::dragFinishCallback(void* data, SoDragger*)
     Gui::Application::Instance->activeDocument()->commitCommand();
 
     ViewProviderFemPostFunction* that = static_cast<ViewProviderFemPostFunction*>(data);
+    that->m_recomputeTimer->stop();
     if (that->m_autoRecompute) {
         that->getObject()->getDocument()->recompute();
     }
@@ -292,8 +307,8 @@ void ViewProviderFemPostFunction::dragMotionCallback(void* data, SoDragger* drag
     ViewProviderFemPostFunction* that = static_cast<ViewProviderFemPostFunction*>(data);
     that->draggerUpdate(drag);
 
-    if (that->m_autoRecompute) {
-        that->getObject()->getDocument()->recompute();
+    if (that->m_autoRecompute && !that->m_recomputeTimer->isActive()) {
+        that->m_recomputeTimer->start();
     }
 }
 
@@ -38,6 +38,7 @@ class SoScale;
 class SoSphere;
 class SoSurroundScale;
 class SoTransformManip;
+class QTimer;
 class Ui_BoxWidget;
 class Ui_CylinderWidget;
 class Ui_PlaneWidget;
@@ -186,6 +187,8 @@ private:
     SoTransformManip* m_manip;
     SoScale* m_scale;
     bool m_autoscale, m_isDragging, m_autoRecompute;
+    // coalesces the recomputes of the drag motion events
+    QTimer* m_recomputeTimer;
 };
 
 // ***************************************************************************
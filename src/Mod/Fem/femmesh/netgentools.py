@@ -278,8 +278,9 @@ run_netgen(**{kwds})
         # load Netgen result
         netgen_result, groups = np.load(self.result_file, allow_pickle=True)
 
-        for node in netgen_result["coords"]:
-            fem_mesh.addNode(*node)
+        coords = np.ascontiguousarray(netgen_result["coords"], dtype=np.float64)
+        if len(coords):
+            fem_mesh.addNodes(coords.reshape(-1, 3))
 
         fem_mesh.addEdgeList(*netgen_result["Edges"])
         fem_mesh.addFaceList(*netgen_result["Faces"])
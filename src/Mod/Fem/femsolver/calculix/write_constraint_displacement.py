@@ -57,9 +57,7 @@ def get_after_write_constraint():
 
 
 def write_meshdata_constraint(f, femobj, disp_obj, ccxwriter):
-    f.write(f"*NSET,NSET={disp_obj.Name}\n")
-    for n in femobj["Nodes"]:
-        f.write(f"{n},\n")
+    ccxwriter.femmesh.writeABAQUSSet(f, "NSET", disp_obj.Name, femobj["Nodes"])
 
 
 def write_constraint(f, femobj, disp_obj, ccxwriter):
@@ -44,9 +44,7 @@ def write_meshdata_constraint(f, femobj, den_obj, ccxwriter):
         return
 
     if den_obj.Concentrated and den_obj.Mode == "Total Source":
-        f.write(f"*NSET,NSET={den_obj.Name}\n")
-        for n in femobj["Nodes"]:
-            f.write(f"{n},\n")
+        ccxwriter.femmesh.writeABAQUSSet(f, "NSET", den_obj.Name, femobj["Nodes"])
         return
 
     if den_obj.Mode in ["Source", "Total Source"]:
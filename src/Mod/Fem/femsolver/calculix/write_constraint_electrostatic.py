@@ -46,9 +46,7 @@ def write_meshdata_constraint(f, femobj, pot_obj, ccxwriter):
         return
 
     if femobj["Object"].BoundaryCondition == "Dirichlet":
-        f.write(f"*NSET,NSET={pot_obj.Name}\n")
-        for n in femobj["Nodes"]:
-            f.write(f"{n},\n")
+        ccxwriter.femmesh.writeABAQUSSet(f, "NSET", pot_obj.Name, femobj["Nodes"])
 
 
 def get_before_write_meshdata_constraint():
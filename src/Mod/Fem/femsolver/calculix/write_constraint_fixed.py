@@ -59,17 +59,15 @@ def write_meshdata_constraint(f, femobj, fix_obj, ccxwriter):
         len(ccxwriter.member.geos_shellthickness) > 0 or len(ccxwriter.member.geos_beamsection) > 0
     ):
         if len(femobj["NodesSolid"]) > 0:
-            f.write(f"*NSET,NSET={fix_obj.Name}Solid\n")
-            for n in femobj["NodesSolid"]:
-                f.write(f"{n},\n")
+            ccxwriter.femmesh.writeABAQUSSet(
+                f, "NSET", f"{fix_obj.Name}Solid", femobj["NodesSolid"]
+            )
         if len(femobj["NodesFaceEdge"]) > 0:
-            f.write(f"*NSET,NSET={fix_obj.Name}FaceEdge\n")
-            for n in femobj["NodesFaceEdge"]:
-                f.write(f"{n},\n")
+            ccxwriter.femmesh.writeABAQUSSet(
+                f, "NSET", f"{fix_obj.Name}FaceEdge", femobj["NodesFaceEdge"]
+            )
     else:
-        f.write("*NSET,NSET=" + fix_obj.Name + "\n")
-        for n in femobj["Nodes"]:
-            f.write(f"{n},\n")
+        ccxwriter.femmesh.writeABAQUSSet(f, "NSET", fix_obj.Name, femobj["Nodes"])
 
 
 def write_constraint(f, femobj, fix_obj, ccxwriter):
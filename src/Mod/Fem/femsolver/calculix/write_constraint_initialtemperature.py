@@ -42,9 +42,7 @@ def get_constraint_title():
 
 def write_meshdata_constraint(f, femobj, inittemp_obj, ccxwriter):
     if inittemp_obj.References and len(inittemp_obj.References) > 0:
-        f.write(f"*NSET,NSET={inittemp_obj.Name}\n")
-        for n in femobj["Nodes"]:
-            f.write(f"{n},\n")
+        ccxwriter.femmesh.writeABAQUSSet(f, "NSET", inittemp_obj.Name, femobj["Nodes"])
     else:
         return
 
@@ -56,9 +56,7 @@ def get_after_write_constraint():
 
 def write_meshdata_constraint(f, femobj, rb_obj, ccxwriter):
 
-    f.write("*NSET,NSET=" + rb_obj.Name + "\n")
-    for n in femobj["Nodes"]:
-        f.write(f"{n},\n")
+    ccxwriter.femmesh.writeABAQUSSet(f, "NSET", rb_obj.Name, femobj["Nodes"])
 
 
 def write_constraint(f, femobj, rb_obj, ccxwriter):
@@ -42,9 +42,7 @@ def get_constraint_title():
 
 
 def write_meshdata_constraint(f, femobj, temp_obj, ccxwriter):
-    f.write(f"*NSET,NSET={temp_obj.Name}\n")
-    for n in femobj["Nodes"]:
-        f.write(f"{n},\n")
+    ccxwriter.femmesh.writeABAQUSSet(f, "NSET", temp_obj.Name, femobj["Nodes"])
 
 
 def get_before_write_meshdata_constraint():
@@ -61,11 +61,10 @@ def get_after_write_constraint():
 
 def write_meshdata_constraint(f, femobj, trans_obj, ccxwriter):
     if trans_obj.TransformType == "Rectangular":
-        f.write(f"*NSET,NSET=Rect{trans_obj.Name}\n")
+        set_name = f"Rect{trans_obj.Name}"
     elif trans_obj.TransformType == "Cylindrical":
-        f.write(f"*NSET,NSET=Cylin{trans_obj.Name}\n")
-    for n in femobj["Nodes"]:
-        f.write(f"{n},\n")
+        set_name = f"Cylin{trans_obj.Name}"
+    ccxwriter.femmesh.writeABAQUSSet(f, "NSET", set_name, femobj["Nodes"])
 
 
 def write_constraint(f, femobj, trans_obj, ccxwriter):
@@ -34,10 +34,10 @@ def write_femelement_matgeosets(f, ccxwriter):
 
     for matgeoset in ccxwriter.mat_geo_sets:
 
-        f.write("*ELSET,ELSET={}\n".format(matgeoset["ccx_elset_name"]))
-
         if isinstance(matgeoset["ccx_elset"], str):
+            f.write("*ELSET,ELSET={}\n".format(matgeoset["ccx_elset_name"]))
             f.write("{}\n".format(matgeoset["ccx_elset"]))
         else:
-            for elid in matgeoset["ccx_elset"]:
-                f.write(str(elid) + ",\n")
+            ccxwriter.femmesh.writeABAQUSSet(
+                f, "ELSET", matgeoset["ccx_elset_name"], matgeoset["ccx_elset"]
+            )
@@ -129,6 +129,27 @@ class TestMeshCommon(unittest.TestCase):
             edge_data, expected_edges, "Edges of Python created seg3 element are unexpected"
         )
 
+    # ********************************************************************************************
+    def test_mesh_element_list_arrays(self):
+        from array import array
+
+        mesh = Fem.FemMesh()
+        mesh.addNodes(
+            array("d", [0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 1]), array("i", [1, 2, 3, 4, 5])
+        )
+        volumes = mesh.addVolumeList(array("i", [1, 2, 3, 4, 2, 3, 4, 5]), array("i", [4, 4]))
+        faces = mesh.addFaceList([1, 2, 3], [3])
+
+        self.assertEqual(mesh.NodeCount, 5)
+        self.assertEqual(mesh.VolumeCount, 2)
+        self.assertEqual(mesh.getElementNodes(volumes[1]), (2, 3, 4, 5))
+        self.assertEqual(mesh.getElementNodes(faces[0]), (1, 2, 3))
+        with self.assertRaises(ValueError):
+            mesh.addVolumeList([1, 2, 3], [3])
+        with self.assertRaises(ValueError):
+            mesh.addEdgeList([1, 99], [2])
+        self.assertEqual(mesh.EdgeCount, 0)
+
     # ********************************************************************************************
     def test_unv_save_load(self):
         tetra10 = Fem.FemMesh()
@@ -25,7 +25,14 @@
 #if defined(__MINGW32__)
 # define WNT  // avoid conflict with GUID
 #endif
+#include <cmath>
+
+#include <BRepAdaptor_Curve.hxx>
+#include <BRepAdaptor_Surface.hxx>
+#include <BRep_Tool.hxx>
+#include <Bnd_Box.hxx>
 #include <Interface_Static.hxx>
+#include <Precision.hxx>
 #include <Quantity_ColorRGBA.hxx>
 #include <Standard_Failure.hxx>
 #include <Standard_Version.hxx>
@@ -34,6 +41,7 @@
 #include <TDF_LabelSequence.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
 #include <TopoDS_Iterator.hxx>
 #include <XCAFDoc_DocumentTool.hxx>
 #include <XCAFDoc_GraphNode.hxx>
@@ -42,6 +50,8 @@
 
 #include <boost/algorithm/string.hpp>
 #include <boost/format.hpp>
+#include <boost/functional/hash.hpp>
+#include <QtConcurrentMap>
 
 #include <App/Application.h>
 #include <App/Document.h>
@@ -104,6 +114,7 @@ ImportOCAFOptions ImportOCAF2::customImportOptions()
     defaultOptions.reduceObjects = settings.getReduceObjects();
     defaultOptions.showProgress = settings.getShowProgress();
     defaultOptions.expandCompound = settings.getExpandCompound();
+    defaultOptions.instanceShapes = settings.getInstanceShapes();
     defaultOptions.mode = static_cast<int>(settings.getImportMode());
 
     auto hGrp = App::GetApplication().GetParameterGroupByPath(
@@ -302,9 +313,9 @@ bool ImportOCAF2::createObject(
     TDF_LabelSequence seq;
     if (!label.IsNull() && aShapeTool->GetSubShapes(label, seq)) {
 
-        TopTools_IndexedMapOfShape faceMap, edgeMap;
-        TopExp::MapShapes(tshape.getShape(), TopAbs_FACE, faceMap);
-        TopExp::MapShapes(tshape.getShape(), TopAbs_EDGE, edgeMap);
+        const ShapeIndex& index = getShapeIndex(shape);
+        const TopTools_IndexedMapOfShape& faceMap = index.faceMap;
+        const TopTools_IndexedMapOfShape& edgeMap = index.edgeMap;
 
         faceColors.assign(faceMap.Extent(), info.faceColor);
         edgeColors.assign(edgeMap.Extent(), info.edgeColor);
@@ -374,9 +385,13 @@ bool ImportOCAF2::createObject(
         doc = getDocument(doc, label);
     }
 
-    if (options.expandCompound
-        && (tshape.countSubShapes(TopAbs_SOLID) > 1
-            || (!tshape.countSubShapes(TopAbs_SOLID) && tshape.countSubShapes(TopAbs_SHELL) > 1))) {
+    bool expand = false;
+    if (options.expandCompound) {
+        const ShapeIndex& index = getShapeIndex(shape);
+        expand = index.solidCount > 1 || (!index.solidCount && index.shellCount > 1);
+    }
+
+    if (expand) {
         feature = dynamic_cast<Part::Feature*>(expandShape(doc, label, shape));
         assert(feature);
     }
@@ -398,6 +413,153 @@ bool ImportOCAF2::createObject(
     return true;
 }
 
+void ImportOCAF2::ShapeIndex::build(const TopoDS_Shape& shape, bool withGeometry)
+{
+    if (!ready) {
+        TopExp::MapShapes(shape, TopAbs_FACE, faceMap);
+        TopExp::MapShapes(shape, TopAbs_EDGE, edgeMap);
+        TopTools_IndexedMapOfShape map;
+        TopExp::MapShapes(shape, TopAbs_SOLID, map);
+        solidCount = map.Extent();
+        map.Clear();
+        TopExp::MapShapes(shape, TopAbs_SHELL, map);
+        shellCount = map.Extent();
+        ready = true;
+    }
+    if (!withGeometry || hasGeometry) {
+        return;
+    }
+
+    // Vertices and edge mid points in exploration order, which is the same for
+    // copies of a part written by the same exporter, and the surface and curve
+    // types to tell apart shapes sharing their points.
+    TopTools_IndexedMapOfShape vertexMap;
+    TopExp::MapShapes(shape, TopAbs_VERTEX, vertexMap);
+    points.reserve(vertexMap.Extent() + edgeMap.Extent());
+    types.reserve(faceMap.Extent() + edgeMap.Extent());
+    for (int i = 1; i <= vertexMap.Extent(); ++i) {
+        points.push_back(BRep_Tool::Pnt(TopoDS::Vertex(vertexMap(i))));
+    }
+    for (int i = 1; i <= edgeMap.Extent(); ++i) {
+        const TopoDS_Edge& edge = TopoDS::Edge(edgeMap(i));
+        if (BRep_Tool::Degenerated(edge)) {
+            types.push_back(-1);
+            continue;
+        }
+        BRepAdaptor_Curve curve(edge);
+        points.push_back(curve.Value((curve.FirstParameter() + curve.LastParameter()) / 2));
+        types.push_back(curve.GetType());
+    }
+    for (int i = 1; i <= faceMap.Extent(); ++i) {
+        types.push_back(BRepAdaptor_Surface(TopoDS::Face(faceMap(i)), Standard_False).GetType());
+    }
+
+    // Only counts and the rounded bounding box of the points go into the hash,
+    // isSameGeometry() compares the points with the modeling tolerance.
+    Bnd_Box box;
+    for (const auto& pnt : points) {
+        box.Add(pnt);
+    }
+    hash = 0;
+    auto combine = [this](std::size_t value) {
+        boost::hash_combine(hash, value);
+    };
+    for (int count : {solidCount, shellCount, faceMap.Extent(), edgeMap.Extent(), vertexMap.Extent()}) {
+        combine(count);
+    }
+    if (!box.IsVoid()) {
+        double values[6];
+        box.Get(values[0], values[1], values[2], values[3], values[4], values[5]);
+        for (double value : values) {
+            combine(std::hash<long long> {}(std::llround(value * 1e3)));
+        }
+    }
+    hasGeometry = true;
+}
+
+bool ImportOCAF2::ShapeIndex::isSameGeometry(const ShapeIndex& other) const
+{
+    if (solidCount != other.solidCount || shellCount != other.shellCount
+        || faceMap.Extent() != other.faceMap.Extent() || edgeMap.Extent() != other.edgeMap.Extent()
+        || points.size() != other.points.size() || types != other.types) {
+        return false;
+    }
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        if (!points[i].IsEqual(other.points[i], Precision::Confusion())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void ImportOCAF2::prepareShapes(const TDF_LabelSequence& labels)
+{
+    // Exploring the sub-shapes of a large part is the costly step of creating
+    // its object and only depends on the shape, so it is done for all parts in
+    // parallel. Everything touching the OCAF or FreeCAD document stays on the
+    // calling thread.
+    std::vector<std::pair<const TopoDS_Shape*, ShapeIndex*>> tasks;
+    for (Standard_Integer i = 1; i <= labels.Length(); i++) {
+        auto label = labels.Value(i);
+        if (aShapeTool->IsAssembly(label)) {
+            continue;
+        }
+        TDF_LabelSequence subShapes;
+        if (!options.expandCompound && !options.instanceShapes
+            && !aShapeTool->GetSubShapes(label, subShapes)) {
+            continue;
+        }
+        TopoDS_Shape shape = aShapeTool->GetShape(label);
+        if (shape.IsNull()) {
+            continue;
+        }
+        auto res = myShapeIndices.emplace(shape.Located(TopLoc_Location()), ShapeIndex());
+        if (res.second) {
+            tasks.emplace_back(&res.first->first, &res.first->second);
+        }
+    }
+    bool withGeometry = options.instanceShapes;
+    QtConcurrent::blockingMap(
+        tasks,
+        [withGeometry](const std::pair<const TopoDS_Shape*, ShapeIndex*>& task) {
+            task.second->build(*task.first, withGeometry);
+        }
+    );
+}
+
+const ImportOCAF2::ShapeIndex& ImportOCAF2::getShapeIndex(const TopoDS_Shape& shape, bool withGeometry)
+{
+    auto& index = myShapeIndices[shape];
+    index.build(shape, withGeometry);
+    return index;
+}
+
+bool ImportOCAF2::canInstance(TDF_Label label)
+{
+    // Parts with colored or named sub-shapes keep their own object, a link
+    // can only override the color of the whole part.
+    TDF_LabelSequence subShapes;
+    return !label.IsNull() && !aShapeTool->IsAssembly(label)
+        && !aShapeTool->GetSubShapes(label, subShapes);
+}
+
+bool ImportOCAF2::findInstance(const TopoDS_Shape& shape, TopoDS_Shape& source)
+{
+    const ShapeIndex& index = getShapeIndex(shape, true);
+    auto it = myInstanceSources.find(index.hash);
+    if (it == myInstanceSources.end()) {
+        return false;
+    }
+    for (const auto& candidate : it->second) {
+        if (candidate.ShapeType() == shape.ShapeType()
+            && getShapeIndex(candidate, true).isSameGeometry(index)) {
+            source = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
 App::Document* ImportOCAF2::getDocument(App::Document* doc, TDF_Label label)
 {
     if (filePath.empty() || options.mode == SingleDoc || options.merge) {
@@ -522,10 +684,13 @@ App::DocumentObject* ImportOCAF2::loadShapes()
     FC_LOG("free shape count " << labels.Length());
     sequencer = options.showProgress ? &seq : nullptr;
 
-    labels.Clear();
     myShapes.clear();
     myNames.clear();
     myCollapsedObjects.clear();
+    myShapeIndices.clear();
+    myInstanceSources.clear();
+    prepareShapes(labels);
+    labels.Clear();
 
     std::vector<App::DocumentObject*> objs;
     aShapeTool->GetFreeShapes(labels);
@@ -583,6 +748,8 @@ App::DocumentObject* ImportOCAF2::loadShapes()
         ret = feature;
         ret->recomputeFeature(true);
     }
+    myShapeIndices.clear();
+    myInstanceSources.clear();
     sequencer = nullptr;
     return ret;
 }
@@ -671,18 +838,28 @@ App::DocumentObject* ImportOCAF2::loadShape(
         if (sequencer && !baseLabel.IsNull() && aShapeTool->IsTopLevel(baseLabel)) {
             sequencer->next(true);
         }
-        bool res;
-        if (baseLabel.IsNull() || !aShapeTool->IsAssembly(baseLabel)) {
-            res = createObject(doc, baseLabel, baseShape, info, newDoc);
+        bool instance = options.instanceShapes && canInstance(baseLabel);
+        TopoDS_Shape source;
+        if (instance && findInstance(baseShape, source)) {
+            it = myShapes.find(source);
         }
         else {
-            res = createAssembly(doc, baseLabel, baseShape, info, newDoc);
-        }
-        if (!res) {
-            return nullptr;
+            bool res;
+            if (baseLabel.IsNull() || !aShapeTool->IsAssembly(baseLabel)) {
+                res = createObject(doc, baseLabel, baseShape, info, newDoc);
+            }
+            else {
+                res = createAssembly(doc, baseLabel, baseShape, info, newDoc);
+            }
+            if (!res) {
+                return nullptr;
+            }
+            setObjectName(info, baseLabel);
+            it = myShapes.emplace(baseShape, info).first;
+            if (instance) {
+                myInstanceSources[getShapeIndex(baseShape, true).hash].push_back(baseShape);
+            }
         }
-        setObjectName(info, baseLabel);
-        it = myShapes.emplace(baseShape, info).first;
     }
     if (baseOnly) {
         return it->second.obj;
@@ -31,9 +31,11 @@
 #include <vector>
 
 #include <TDocStd_Document.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <TopoDS_Shape.hxx>
 #include <XCAFDoc_ColorTool.hxx>
 #include <XCAFDoc_ShapeTool.hxx>
+#include <gp_Pnt.hxx>
 
 #include <Base/Sequencer.h>
 #include <Mod/Part/App/TopoShape.h>
@@ -44,6 +46,7 @@
 
 
 class TDF_Label;
+class TDF_LabelSequence;
 class TopLoc_Location;
 
 namespace App
@@ -71,6 +74,7 @@ struct ImportExport ImportOCAFOptions
     bool reduceObjects = false;
     bool showProgress = false;
     bool expandCompound = false;
+    bool instanceShapes = false;
     int mode = 0;
 };
 
@@ -108,6 +112,10 @@ public:
     {
         options.expandCompound = enable;
     }
+    void setInstanceShapes(bool enable)
+    {
+        options.instanceShapes = enable;
+    }
 
     enum ImportMode
     {
@@ -137,6 +145,25 @@ private:
         int free = true;
     };
 
+    // Sub-shape indices of a part shape, built off the main thread by prepareShapes()
+    struct ShapeIndex
+    {
+        TopTools_IndexedMapOfShape faceMap;
+        TopTools_IndexedMapOfShape edgeMap;
+        int solidCount = 0;
+        int shellCount = 0;
+        bool ready = false;
+
+        // Geometric signature to find identical parts with distinct TShapes
+        std::vector<gp_Pnt> points;
+        std::vector<int> types;
+        std::size_t hash = 0;
+        bool hasGeometry = false;
+
+        void build(const TopoDS_Shape& shape, bool withGeometry);
+        bool isSameGeometry(const ShapeIndex& other) const;
+    };
+
     App::DocumentObject* loadShape(
         App::Document* doc,
         TDF_Label label,
@@ -172,6 +199,10 @@ private:
     void setObjectName(Info& info, TDF_Label label);
     std::string getLabelName(TDF_Label label);
     App::DocumentObject* expandShape(App::Document* doc, TDF_Label label, const TopoDS_Shape& shape);
+    void prepareShapes(const TDF_LabelSequence& labels);
+    const ShapeIndex& getShapeIndex(const TopoDS_Shape& shape, bool withGeometry = false);
+    bool canInstance(TDF_Label label);
+    bool findInstance(const TopoDS_Shape& shape, TopoDS_Shape& source);
 
     virtual void applyEdgeColors(Part::Feature*, const std::vector<Base::Color>&)
     {}
@@ -213,6 +244,8 @@ private:
     std::unordered_map<TopoDS_Shape, Info, ShapeHasher> myShapes;
     std::unordered_map<TDF_Label, std::string, LabelHasher> myNames;
     std::unordered_map<App::DocumentObject*, App::PropertyPlacement*> myCollapsedObjects;
+    std::unordered_map<TopoDS_Shape, ShapeIndex, ShapeHasher> myShapeIndices;
+    std::unordered_map<std::size_t, std::vector<TopoDS_Shape>> myInstanceSources;
 
     Base::SequencerLauncher* sequencer {nullptr};
 };
@@ -75,8 +75,14 @@ void ReaderGltf::processDocument(Handle(TDocStd_Document) hDoc)
 
     TDF_LabelSequence shapeLabels;
     aShapeTool->GetShapes(shapeLabels);
+    fixedShapes.clear();
     for (Standard_Integer i = 1; i <= shapeLabels.Length(); i++) {
         auto topLevelshape = shapeLabels.Value(i);
+        // Assemblies only place their parts. Replacing their shape by a copy of
+        // all meshes would turn every instance into a separate object on import.
+        if (XCAFDoc_ShapeTool::IsAssembly(topLevelshape)) {
+            continue;
+        }
         TopoDS_Shape shape = aShapeTool->GetShape(topLevelshape);
         if (!shape.IsNull()) {
             TDF_LabelSequence subShapeLabels;
@@ -89,6 +95,8 @@ void ReaderGltf::processDocument(Handle(TDocStd_Document) hDoc)
             }
         }
     }
+    fixedShapes.clear();
+    aShapeTool->UpdateAssemblies();
 }
 
 // NOLINTNEXTLINE
@@ -142,6 +150,19 @@ void ReaderGltf::setCleanup(bool value)
 }
 
 TopoDS_Shape ReaderGltf::fixShape(TopoDS_Shape shape)  // NOLINT
+{
+    // A mesh shared by several nodes is only converted once, so the instances
+    // keep sharing their shape
+    TopLoc_Location loc = shape.Location();
+    TopoDS_Shape baseShape = shape.Located(TopLoc_Location());
+    auto it = fixedShapes.find(baseShape);
+    if (it == fixedShapes.end()) {
+        it = fixedShapes.emplace(baseShape, makeShape(baseShape)).first;
+    }
+    return it->second.Moved(loc);
+}
+
+TopoDS_Shape ReaderGltf::makeShape(const TopoDS_Shape& shape) const
 {
     // The glTF reader creates a compound of faces that only contains the triangulation
     // but not the underlying surfaces. This leads to faces without boundaries.
@@ -23,11 +23,14 @@
 
 #pragma once
 
+#include <unordered_map>
+
 #include <Mod/Import/ImportGlobal.h>
 #include <Base/FileInfo.h>
 #include <TDocStd_Document.hxx>
 #include <TDF_LabelSequence.hxx>
 #include <TopoDS_Shape.hxx>
+#include "Tools.h"
 
 namespace Import
 {
@@ -43,12 +46,14 @@ public:
 
 private:
     TopoDS_Shape fixShape(TopoDS_Shape);
+    TopoDS_Shape makeShape(const TopoDS_Shape&) const;
     void processDocument(Handle(TDocStd_Document) hDoc);
     TopoDS_Shape processSubShapes(Handle(TDocStd_Document) hDoc, const TDF_LabelSequence& subShapeLabels);
 
 private:
     Base::FileInfo file;
     bool clean = true;
+    std::unordered_map<TopoDS_Shape, TopoDS_Shape, ShapeHasher> fixedShapes;
 };
 
 }  // namespace Import
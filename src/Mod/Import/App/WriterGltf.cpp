@@ -26,14 +26,70 @@
 #include <Standard_Version.hxx>
 #include <TColStd_IndexedDataMapOfStringString.hxx>
 #include <Message_ProgressRange.hxx>
+#include <Precision.hxx>
 #include <RWGltf_CafWriter.hxx>
+#if OCC_VERSION_HEX >= 0x070700
+# include <RWGltf_DracoParameters.hxx>
+#endif
+#include <TDF_LabelSequence.hxx>
+#include <gp.hxx>
+#include <XCAFDoc_DocumentTool.hxx>
+#include <XCAFDoc_ShapeTool.hxx>
 
 #include "WriterGltf.h"
+#include <App/Application.h>
 #include <Base/Exception.h>
+#include <Base/Tools.h>
+#include <Mod/Part/App/OCAF/ImportExportSettings.h>
+#include <Mod/Part/App/TessellationCache.h>
+#include <Mod/Part/App/Tools.h>
 #include <Mod/Part/App/encodeFilename.h>
 
 using namespace Import;
 
+namespace
+{
+// glTF only contains the triangulations stored on the shapes. Shapes that are already
+// triangulated, e.g. because they are displayed, are written as they are. The others
+// are meshed with the tessellation settings of the 3D view, so that displaying them
+// later reuses the triangulation. They are meshed in one batch, so that independent
+// parts are meshed side by side.
+void meshShapes(Handle(TDocStd_Document) hDoc)
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part"
+    );
+    double deviation = hGrp->GetFloat("MeshDeviation", 0.2);
+    double angularDeflection = hGrp->GetFloat("MeshAngularDeflection", 28.65);
+
+    Handle(XCAFDoc_ShapeTool) shapeTool = XCAFDoc_DocumentTool::ShapeTool(hDoc->Main());
+    TDF_LabelSequence labels;
+    shapeTool->GetShapes(labels);
+    std::vector<std::pair<TopoDS_Shape, Part::TessellationCache::Parameters>> shapes;
+    for (Standard_Integer i = 1; i <= labels.Length(); i++) {
+        const TDF_Label& label = labels.Value(i);
+        if (XCAFDoc_ShapeTool::IsAssembly(label)) {
+            continue;
+        }
+
+        TopoDS_Shape shape = XCAFDoc_ShapeTool::GetShape(label);
+        if (shape.IsNull() || Part::TessellationCache::hasTriangulation(shape)) {
+            continue;
+        }
+
+        Part::TessellationCache::Parameters params;
+        params.deflection = Part::Tools::getDeflection(shape, deviation);
+        if (params.deflection < gp::Resolution()) {
+            params.deflection = Precision::Confusion();
+        }
+        params.angularDeflection = Base::toRadians(angularDeflection);
+        params.allowQualityDecrease = true;
+        shapes.emplace_back(shape, params);
+    }
+    Part::TessellationCache::instance().mesh(shapes);
+}
+}  // namespace
+
 WriterGltf::WriterGltf(const Base::FileInfo& file)  // NOLINT
     : file {file}
 {}
@@ -52,6 +108,20 @@ void WriterGltf::write(Handle(TDocStd_Document) hDoc) const  // NOLINT
 #if OCC_VERSION_HEX >= 0x070700
     aWriter.SetParallel(true);
 #endif
+    Part::OCAF::ImportExportSettings settings;
+#if OCC_VERSION_HEX >= 0x070600
+    // One primitive per part instead of per face gives far fewer buffers and draw calls
+    aWriter.SetMergeFaces(settings.getGltfMergeFaces());
+#endif
+#if OCC_VERSION_HEX >= 0x070700
+    if (settings.getGltfDracoCompression()) {
+        // Quantized and compressed buffers, only available if OCCT is built with Draco
+        RWGltf_DracoParameters draco;
+        draco.DracoCompression = true;
+        aWriter.SetCompressionParameters(draco);
+    }
+#endif
+    meshShapes(hDoc);
     Standard_Boolean ret = aWriter.Perform(hDoc, aMetadata, Message_ProgressRange());
     if (!ret) {
         throw Base::FileException("Cannot save to file: ", file);
@@ -1880,8 +1880,13 @@ void CDxfWrite::writeObjectsSection()
 const DxfUnits DxfUnits::Instance;
 
 CDxfRead::CDxfRead(const std::string& filepath)
-    : m_ifs(new ifstream(filepath))
+    : m_ifs(new ifstream())
+    , m_read_buffer(1 << 20)  // NOLINT(readability-magic-numbers)
 {
+    // The buffer has to be set before the file is opened
+    m_ifs->rdbuf()->pubsetbuf(m_read_buffer.data(), std::streamsize(m_read_buffer.size()));
+    m_ifs->open(filepath);
+    m_parse_stream.imbue(std::locale("C"));
     if (!(*m_ifs)) {
         m_fail = true;
         ImportError("DXF file didn't load\n");
@@ -1954,10 +1959,7 @@ void CDxfRead::SetupValueAttribute(eDXFGroupCode_t record_type, T& destination)
 // Static processing helpers for ProcessCommonEntityAttribute
 void CDxfRead::ProcessScaledDouble(CDxfRead* object, void* target)
 {
-    std::istringstream ss;
-    ss.imbue(std::locale("C"));
-
-    ss.str(object->m_record_data);
+    std::istringstream& ss = object->record_stream();
     double value = 0;
     ss >> value;
     if (ss.fail()) {
@@ -1970,10 +1972,7 @@ void CDxfRead::ProcessScaledDouble(CDxfRead* object, void* target)
 }
 void CDxfRead::ProcessScaledDoubleIntoList(CDxfRead* object, void* target)
 {
-    std::istringstream ss;
-    ss.imbue(std::locale("C"));
-
-    ss.str(object->m_record_data);
+    std::istringstream& ss = object->record_stream();
     double value = 0;
     ss >> value;
     if (ss.fail()) {
@@ -1987,10 +1986,7 @@ void CDxfRead::ProcessScaledDoubleIntoList(CDxfRead* object, void* target)
 template<typename T>
 bool CDxfRead::ParseValue(CDxfRead* object, void* target)
 {
-    std::istringstream ss;
-    ss.imbue(std::locale("C"));
-
-    ss.str(object->m_record_data);
+    std::istringstream& ss = object->record_stream();
     ss >> *static_cast<T*>(target);
     if (ss.fail()) {
         object->ImportError(
@@ -2460,7 +2456,7 @@ bool CDxfRead::get_next_record()
         std::getline(*m_ifs, m_record_data);
         ++m_line;
         int temp = 0;
-        if (!ParseValue<int>(this, &temp)) {
+        if (!parse_group_code(temp) && !ParseValue<int>(this, &temp)) {
             ImportError(
                 "CDxfRead::get_next_record() Failed to get integer record type from '%s'\n",
                 m_record_data
@@ -2494,6 +2490,41 @@ void CDxfRead::repeat_last_record()
     m_repeat_last_record = true;
 }
 
+std::istringstream& CDxfRead::record_stream()
+{
+    m_parse_stream.clear();
+    m_parse_stream.str(m_record_data);
+    return m_parse_stream;
+}
+
+bool CDxfRead::parse_group_code(int& value) const
+{
+    // Every record starts with a group code, so the plain integers are parsed
+    // directly. Anything else is left to ParseValue, which also reports errors.
+    constexpr int maxDigits = 6;
+    const char* pos = m_record_data.c_str();
+    while (*pos == ' ' || *pos == '\t') {
+        ++pos;
+    }
+    bool negative = *pos == '-';
+    if (negative || *pos == '+') {
+        ++pos;
+    }
+    int result = 0;
+    int digits = 0;
+    for (; *pos >= '0' && *pos <= '9'; ++pos, ++digits) {
+        result = result * 10 + (*pos - '0');  // NOLINT(readability-magic-numbers)
+    }
+    while (*pos == ' ' || *pos == '\t' || *pos == '\r') {
+        ++pos;
+    }
+    if (digits == 0 || digits > maxDigits || *pos != '\0') {
+        return false;
+    }
+    value = negative ? -result : result;
+    return true;
+}
+
 //
 //  Intercepts for On... calls to derived class
 //  (These have distinct signatures from the ones they call)
@@ -19,6 +19,7 @@
 #include <list>
 #include <map>
 #include <set>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -487,6 +488,10 @@ class ImportExport CDxfRead
 private:
     // Low-level reader members
     std::ifstream* m_ifs;  // TODO: gsl::owner<ifstream>
+    std::vector<char> m_read_buffer;
+    // Reused for parsing record values, creating a stream with the "C" locale for
+    // each value dominated the reading time of large files
+    std::istringstream m_parse_stream;
     // https://stackoverflow.com/questions/41167119/how-to-fix-a-wsubobject-linkage-warning
     eDXFGroupCode_t m_record_type = eObjectType;
     std::string m_record_data;
@@ -723,6 +728,8 @@ private:
 
     bool get_next_record();
     void repeat_last_record();
+    std::istringstream& record_stream();
+    bool parse_group_code(int& value) const;
 
     bool (CDxfRead::*stringToUTF8)(std::string&) const = &CDxfRead::UTF8ToUTF8;
 
@@ -286,6 +286,11 @@ private:
                             static_cast<bool>(Py::Boolean(options.getItem("expandCompound")))
                         );
                     }
+                    if (options.hasKey("instanceShapes")) {
+                        ocaf.setInstanceShapes(
+                            static_cast<bool>(Py::Boolean(options.getItem("instanceShapes")))
+                        );
+                    }
                     if (options.hasKey("mode")) {
                         ocaf.setMode(static_cast<int>(Py::Long(options.getItem("mode"))));
                     }
@@ -23,35 +23,43 @@
  ***************************************************************************/
 
 #include <boost/core/ignore_unused.hpp>
+#include <cstring>
 #include <numeric>
 #include <limits>
+#include <type_traits>
 
+#include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include <BRepClass3d_SolidClassifier.hxx>
 #include <BRepExtrema_DistShapeShape.hxx>
 #include <BRepGProp_Face.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <Bnd_Box.hxx>
 #include <TopExp.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <TopoDS.hxx>
 #include <gp_Pnt.hxx>
 
-#include <QEventLoop>
 #include <QFuture>
-#include <QFutureWatcher>
 #include <QtConcurrentMap>
 
 #include <Base/Console.h>
-#include <Base/FutureWatcherProgress.h>
+#include <Base/ProgressTask.h>
 #include <Base/Sequencer.h>
 #include <Base/Stream.h>
 
 #include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/BVH.h>
 #include <Mod/Mesh/App/Core/Grid.h>
 #include <Mod/Mesh/App/Core/Iterator.h>
 #include <Mod/Mesh/App/Core/MeshKernel.h>
 #include <Mod/Mesh/App/MeshFeature.h>
 #include <Mod/Part/App/PartFeature.h>
+#include <Mod/Part/App/Tools.h>
+#include <Mod/Points/App/FeatureOutOfCore.h>
 #include <Mod/Points/App/PointsFeature.h>
 #include <Mod/Points/App/PointsGrid.h>
+#include <Mod/Points/App/PointsOutOfCore.h>
 
 #include "InspectionFeature.h"
 
@@ -102,6 +110,31 @@ Base::Vector3f InspectActualPoints::getPoint(unsigned long index) const
 
 // ----------------------------------------------------------------
 
+InspectActualTiledPoints::InspectActualTiledPoints(
+    std::shared_ptr<const Points::PointsOutOfCore> tiles,
+    const Base::Matrix4D& mat
+)
+    : _tiles(std::move(tiles))
+    , _bApply(mat != Base::Matrix4D())
+    , _clTrf(mat)
+{}
+
+unsigned long InspectActualTiledPoints::countPoints() const
+{
+    return static_cast<unsigned long>(_tiles->countPoints());
+}
+
+Base::Vector3f InspectActualTiledPoints::getPoint(unsigned long index) const
+{
+    Base::Vector3f pnt = _tiles->getPoint(index);
+    if (_bApply) {
+        _clTrf.multVec(pnt, pnt);
+    }
+    return pnt;
+}
+
+// ----------------------------------------------------------------
+
 InspectActualShape::InspectActualShape(const Part::TopoShape& shape)
     : _rShape(shape)
 {
@@ -225,21 +258,19 @@ protected:
                 for (unsigned long ulY = ulY1; ulY <= ulY2; ulY++) {
                     for (unsigned long ulZ = ulZ1; ulZ <= ulZ2; ulZ++) {
                         if (rclFacet.IntersectBoundingBox(GetBoundBox(ulX, ulY, ulZ))) {
-                            _aulGrid[ulX][ulY][ulZ].insert(ulFacetIndex);
+                            _aulGrid.Add(ulX, ulY, ulZ, ulFacetIndex);
                         }
                     }
                 }
             }
         }
         else {
-            _aulGrid[ulX1][ulY1][ulZ1].insert(ulFacetIndex);
+            _aulGrid.Add(ulX1, ulY1, ulZ1, ulFacetIndex);
         }
     }
 
     void InitGrid() override
     {
-        unsigned long i, j;
-
         Base::BoundBox3f clBBMesh = _pclMesh->GetBoundBox().Transformed(_transform);
 
         float fLengthX = clBBMesh.LengthX();
@@ -255,14 +286,7 @@ protected:
         _fGridLenZ = (1.0f + fLengthZ) / float(_ulCtGridsZ);
         _fMinZ = clBBMesh.MinZ - 0.5f;
 
-        _aulGrid.clear();
-        _aulGrid.resize(_ulCtGridsX);
-        for (i = 0; i < _ulCtGridsX; i++) {
-            _aulGrid[i].resize(_ulCtGridsY);
-            for (j = 0; j < _ulCtGridsY; j++) {
-                _aulGrid[i][j].resize(_ulCtGridsZ);
-            }
-        }
+        _aulGrid.Resize(_ulCtGridsX, _ulCtGridsY, _ulCtGridsZ);
     }
 
     void RebuildGrid() override
@@ -276,6 +300,7 @@ protected:
         for (clFIter.Init(); clFIter.More(); clFIter.Next()) {
             AddFacet(*clFIter, i++);
         }
+        _aulGrid.Finish();
     }
 
 private:
@@ -283,37 +308,37 @@ private:
 };
 }  // namespace Inspection
 
+void InspectNominalGeometry::getDistances(
+    const std::vector<Base::Vector3f>& points,
+    std::vector<float>& distances
+) const
+{
+    distances.resize(points.size());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        distances[i] = getDistance(points[i]);
+    }
+}
+
+// ----------------------------------------------------------------
+
 InspectNominalMesh::InspectNominalMesh(const Mesh::MeshObject& rMesh, float offset)
     : _mesh(rMesh.getKernel())
+    , _offset(offset)
 {
     Base::Matrix4D tmp;
     _clTrf = rMesh.getTransform();
     _bApply = _clTrf != tmp;
 
-    // Max. limit of grid elements
-    float fMaxGridElements = 8000000.0f;
-    Base::BoundBox3f box = _mesh.GetBoundBox().Transformed(rMesh.getTransform());
-
-    // estimate the minimum allowed grid length
-    float fMinGridLen
-        = (float)pow((box.LengthX() * box.LengthY() * box.LengthZ() / fMaxGridElements), 0.3333f);
-    float fGridLen = 5.0f * MeshCore::MeshAlgorithm(_mesh).GetAverageEdgeLength();
-
-    // We want to avoid to get too small grid elements otherwise building up the grid structure
-    // would take too much time and memory. Having quite a dense grid speeds up more the following
-    // algorithms extremely. Due to the issue above it's always a compromise between speed and
-    // memory usage.
-    fGridLen = std::max<float>(fMinGridLen, fGridLen);
-
-    // build up grid structure to speed up algorithms
-    _pGrid = new MeshInspectGrid(_mesh, fGridLen, rMesh.getTransform());
-    _box = box;
+    // The hierarchy adapts to the facet density, so unlike a grid it finds the
+    // really nearest facet also for scans with very uneven point density.
+    _pBVH = new MeshCore::MeshFacetBVH(_mesh, _clTrf);
+    _box = _pBVH->GetBoundBox();
     _box.Enlarge(offset);
 }
 
 InspectNominalMesh::~InspectNominalMesh()
 {
-    delete this->_pGrid;
+    delete this->_pBVH;
 }
 
 float InspectNominalMesh::getDistance(const Base::Vector3f& point) const
@@ -322,35 +347,72 @@ float InspectNominalMesh::getDistance(const Base::Vector3f& point) const
         return std::numeric_limits<float>::max();  // must be inside bbox
     }
 
-    std::vector<unsigned long> indices;
-    //_pGrid->GetElements(point, indices);
-    if (indices.empty()) {
-        std::set<unsigned long> inds;
-        _pGrid->MeshGrid::SearchNearestFromPoint(point, inds);
-        indices.insert(indices.begin(), inds.begin(), inds.end());
-    }
-
     float fMinDist = std::numeric_limits<float>::max();
-    bool positive = true;
-    for (unsigned long it : indices) {
-        MeshCore::MeshGeomFacet geomFace = _mesh.GetFacet(it);
-        if (_bApply) {
-            geomFace.Transform(_clTrf);
-        }
+    MeshCore::FacetIndex index = _pBVH->NearestFacetToPoint(point, fMinDist);
+    if (index == MeshCore::FACET_INDEX_MAX) {
+        return std::numeric_limits<float>::max();
+    }
 
-        float fDist = geomFace.DistanceToPoint(point);
-        if (fabs(fDist) < fabs(fMinDist)) {
-            fMinDist = fDist;
-            positive = point.DistanceToPlane(geomFace._aclPoints[0], geomFace.GetNormal()) > 0;
-        }
+    MeshCore::MeshGeomFacet geomFace = _mesh.GetFacet(index);
+    if (_bApply) {
+        geomFace.Transform(_clTrf);
     }
 
+    bool positive = point.DistanceToPlane(geomFace._aclPoints[0], geomFace.GetNormal()) > 0;
     if (!positive) {
         fMinDist = -fMinDist;
     }
     return fMinDist;
 }
 
+void InspectNominalMesh::getDistances(
+    const std::vector<Base::Vector3f>& points,
+    std::vector<float>& distances
+) const
+{
+    distances.resize(points.size());
+
+    // Neighbouring points of a scan mostly have the same or an adjacent nearest facet. Its
+    // distance bounds the search for the next point so that the BVH can skip most nodes.
+    MeshCore::FacetIndex lastIndex = MeshCore::FACET_INDEX_MAX;
+    MeshCore::MeshGeomFacet lastFace;
+    for (std::size_t i = 0; i < points.size(); i++) {
+        const Base::Vector3f& point = points[i];
+        if (!_box.IsInBox(point)) {
+            distances[i] = std::numeric_limits<float>::max();
+            continue;
+        }
+
+        float fLastDist = std::numeric_limits<float>::max();
+        if (lastIndex != MeshCore::FACET_INDEX_MAX) {
+            fLastDist = lastFace.DistanceToPoint(point);
+        }
+
+        float fMinDist = std::numeric_limits<float>::max();
+        MeshCore::FacetIndex index
+            = _pBVH->NearestFacetToPoint(point, fMinDist, std::min(fLastDist, _offset));
+        if (index == MeshCore::FACET_INDEX_MAX) {
+            if (fLastDist > _offset) {
+                distances[i] = std::numeric_limits<float>::max();
+                continue;
+            }
+            // no facet is nearer than the last one
+            index = lastIndex;
+            fMinDist = fLastDist;
+        }
+        else if (index != lastIndex) {
+            lastIndex = index;
+            lastFace = _mesh.GetFacet(index);
+            if (_bApply) {
+                lastFace.Transform(_clTrf);
+            }
+        }
+
+        bool positive = point.DistanceToPlane(lastFace._aclPoints[0], lastFace.GetNormal()) > 0;
+        distances[i] = positive ? fMinDist : -fMinDist;
+    }
+}
+
 // ----------------------------------------------------------------
 
 InspectNominalFastMesh::InspectNominalFastMesh(const Mesh::MeshObject& rMesh, float offset)
@@ -400,6 +462,48 @@ float InspectNominalFastMesh::getDistance(const Base::Vector3f& point) const
     }
 
     std::set<unsigned long> indices;
+    getFacets(point, indices);
+    return getDistance(point, indices);
+}
+
+void InspectNominalFastMesh::getDistances(
+    const std::vector<Base::Vector3f>& points,
+    std::vector<float>& distances
+) const
+{
+    distances.resize(points.size());
+
+    // neighbouring points mostly lie in the same grid element and thus share the facets
+    std::set<unsigned long> indices;
+    unsigned long ulLastX = std::numeric_limits<unsigned long>::max();
+    unsigned long ulLastY = ulLastX;
+    unsigned long ulLastZ = ulLastX;
+    for (std::size_t i = 0; i < points.size(); i++) {
+        const Base::Vector3f& point = points[i];
+        if (!_box.IsInBox(point)) {
+            distances[i] = std::numeric_limits<float>::max();
+            continue;
+        }
+
+        unsigned long ulX, ulY, ulZ;
+        _pGrid->Position(point, ulX, ulY, ulZ);
+        if (ulX != ulLastX || ulY != ulLastY || ulZ != ulLastZ) {
+            indices.clear();
+            getFacets(point, indices);
+            ulLastX = ulX;
+            ulLastY = ulY;
+            ulLastZ = ulZ;
+        }
+
+        distances[i] = getDistance(point, indices);
+    }
+}
+
+void InspectNominalFastMesh::getFacets(
+    const Base::Vector3f& point,
+    std::set<unsigned long>& indices
+) const
+{
 #if 0  // a point in a neighbour grid can be nearer
     std::vector<unsigned long> elements;
     _pGrid->GetElements(point, elements);
@@ -415,7 +519,13 @@ float InspectNominalFastMesh::getDistance(const Base::Vector3f& point) const
         _pGrid->GetHull(ulX, ulY, ulZ, ulLevel, indices);
     }
 #endif
+}
 
+float InspectNominalFastMesh::getDistance(
+    const Base::Vector3f& point,
+    const std::set<unsigned long>& indices
+) const
+{
     float fMinDist = std::numeric_limits<float>::max();
     bool positive = true;
     for (unsigned long it : indices) {
@@ -453,13 +563,47 @@ InspectNominalPoints::~InspectNominalPoints()
 
 float InspectNominalPoints::getDistance(const Base::Vector3f& point) const
 {
-    // TODO: Make faster
     std::set<unsigned long> indices;
     unsigned long x, y, z;
     Base::Vector3d pointd(point.x, point.y, point.z);
     _pGrid->Position(pointd, x, y, z);
     _pGrid->GetElements(x, y, z, indices);
+    return getDistance(pointd, indices);
+}
 
+void InspectNominalPoints::getDistances(
+    const std::vector<Base::Vector3f>& points,
+    std::vector<float>& distances
+) const
+{
+    distances.resize(points.size());
+
+    // neighbouring points mostly lie in the same grid element
+    std::set<unsigned long> indices;
+    unsigned long lastX = std::numeric_limits<unsigned long>::max();
+    unsigned long lastY = lastX;
+    unsigned long lastZ = lastX;
+    for (std::size_t i = 0; i < points.size(); i++) {
+        unsigned long x, y, z;
+        Base::Vector3d pointd(points[i].x, points[i].y, points[i].z);
+        _pGrid->Position(pointd, x, y, z);
+        if (x != lastX || y != lastY || z != lastZ) {
+            indices.clear();
+            _pGrid->GetElements(x, y, z, indices);
+            lastX = x;
+            lastY = y;
+            lastZ = z;
+        }
+
+        distances[i] = getDistance(pointd, indices);
+    }
+}
+
+float InspectNominalPoints::getDistance(
+    const Base::Vector3d& pointd,
+    const std::set<unsigned long>& indices
+) const
+{
     double fMinDist = std::numeric_limits<double>::max();
     for (unsigned long it : indices) {
         Base::Vector3d pt = _rKernel.getPoint(it);
@@ -474,7 +618,102 @@ float InspectNominalPoints::getDistance(const Base::Vector3f& point) const
 
 // ----------------------------------------------------------------
 
-InspectNominalShape::InspectNominalShape(const TopoDS_Shape& shape, float /*radius*/)
+struct InspectNominalTiledPoints::Tile
+{
+    explicit Tile(Points::PointKernel&& pts)
+        : kernel(std::move(pts))
+        , grid(this->kernel, 50)
+    {}
+
+    Points::PointKernel kernel;
+    Points::PointsGrid grid;
+};
+
+InspectNominalTiledPoints::InspectNominalTiledPoints(
+    std::shared_ptr<const Points::PointsOutOfCore> tiles,
+    const Base::Matrix4D& mat,
+    float offset
+)
+    : _tiles(std::move(tiles))
+    , _clInv(mat)
+    , _offset(offset)
+{
+    // the placement is rigid, so distances can be computed in the coordinate system of the tiles
+    _clInv.inverseOrthogonal();
+}
+
+InspectNominalTiledPoints::~InspectNominalTiledPoints() = default;
+
+std::shared_ptr<const InspectNominalTiledPoints::Tile> InspectNominalTiledPoints::getTile(
+    std::size_t index
+) const
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (auto it = _cache.begin(); it != _cache.end(); ++it) {
+            if (it->first == index) {
+                _cache.splice(_cache.begin(), _cache, it);
+                return it->second;
+            }
+        }
+    }
+
+    // build the grid outside the lock so that other threads can search the cached tiles
+    std::vector<Base::Vector3f> points;
+    _tiles->getTile(index, points);
+    Points::PointKernel kernel;
+    kernel.setBasicPoints(points);
+    auto tile = std::make_shared<const Tile>(std::move(kernel));
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _cache.emplace_front(index, tile);
+    const std::size_t maxTiles = 16;
+    if (_cache.size() > maxTiles) {
+        _cache.pop_back();
+    }
+    return tile;
+}
+
+float InspectNominalTiledPoints::getDistance(const Base::Vector3f& point) const
+{
+    Base::Vector3f local = _clInv * point;
+    Base::BoundBox3f box(local, _offset);
+
+    double fMinDist = std::numeric_limits<double>::max();
+    Base::Vector3d pointd(local.x, local.y, local.z);
+    for (std::size_t index : _tiles->findTiles(box)) {
+        std::shared_ptr<const Tile> tile = getTile(index);
+
+        std::set<unsigned long> indices;
+        unsigned long x, y, z;
+        tile->grid.Position(pointd, x, y, z);
+        tile->grid.GetElements(x, y, z, indices);
+
+        for (unsigned long it : indices) {
+            Base::Vector3d pt = tile->kernel.getPoint(it);
+            double fDist = Base::Distance(pointd, pt);
+            if (fDist < fMinDist) {
+                fMinDist = fDist;
+            }
+        }
+    }
+
+    return (float)fMinDist;
+}
+
+// ----------------------------------------------------------------
+
+struct InspectNominalShape::Proxy
+{
+    MeshCore::MeshKernel mesh;
+    MeshCore::MeshFacetBVH bvh;
+    std::vector<TopoDS_Face> faces;
+    std::vector<std::size_t> facetToFace;
+    float deflection {};
+    float radius {};
+};
+
+InspectNominalShape::InspectNominalShape(const TopoDS_Shape& shape, float radius)
     : _rShape(shape)
 {
     distss = new BRepExtrema_DistShapeShape();
@@ -491,15 +730,90 @@ InspectNominalShape::InspectNominalShape(const TopoDS_Shape& shape, float /*radi
         }
     }
     // distss->SetDeflection(radius);
+
+    buildProxy(radius);
 }
 
 InspectNominalShape::~InspectNominalShape()
 {
     delete distss;
+    delete proxy;
+}
+
+void InspectNominalShape::buildProxy(float radius)
+{
+    TopTools_IndexedMapOfShape mapOfFaces;
+    TopExp::MapShapes(_rShape, TopAbs_FACE, mapOfFaces);
+    if (mapOfFaces.IsEmpty()) {
+        return;
+    }
+
+    // The tessellation must be fine compared to the search radius but shouldn't get too big
+    // for huge models.
+    Bnd_Box bounds;
+    BRepBndLib::Add(_rShape, bounds);
+    bounds.SetGap(0.0);
+    Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+    bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+    double diagonal = gp_Pnt(xMin, yMin, zMin).Distance(gp_Pnt(xMax, yMax, zMax));
+    double deflection = std::max(0.25 * radius, 0.0005 * diagonal);
+    if (deflection <= 0.0) {
+        return;
+    }
+
+    BRepMesh_IncrementalMesh mesher(_rShape, deflection, Standard_False, 0.5, Standard_True);
+
+    auto data = new Proxy();
+    data->deflection = float(deflection);
+    data->radius = radius;
+
+    MeshCore::MeshPointArray meshPoints;
+    MeshCore::MeshFacetArray meshFacets;
+    for (int i = 1; i <= mapOfFaces.Extent(); i++) {
+        const TopoDS_Face& face = TopoDS::Face(mapOfFaces(i));
+        std::vector<gp_Pnt> points;
+        std::vector<Poly_Triangle> facets;
+        if (!Part::Tools::getTriangulation(face, points, facets)) {
+            continue;
+        }
+
+        std::size_t faceIndex = data->faces.size();
+        data->faces.push_back(face);
+
+        auto offset = static_cast<MeshCore::PointIndex>(meshPoints.size());
+        for (const auto& pnt : points) {
+            meshPoints.emplace_back(Base::convertTo<Base::Vector3f>(pnt));
+        }
+        for (const auto& facet : facets) {
+            Standard_Integer n1, n2, n3;
+            facet.Get(n1, n2, n3);
+            meshFacets.emplace_back(offset + n1, offset + n2, offset + n3);
+            data->facetToFace.push_back(faceIndex);
+        }
+    }
+
+    if (meshFacets.empty()) {
+        delete data;
+        return;
+    }
+
+    data->mesh.Adopt(meshPoints, meshFacets);
+    data->bvh.Build(data->mesh);
+    proxy = data;
+}
+
+bool InspectNominalShape::isThreadSafe() const
+{
+    // the proxy creates its own distance tools for each point
+    return proxy != nullptr;
 }
 
 float InspectNominalShape::getDistance(const Base::Vector3f& point) const
 {
+    if (proxy) {
+        return getProxyDistance(point);
+    }
+
     gp_Pnt pnt3d(point.x, point.y, point.z);
     BRepBuilderAPI_MakeVertex mkVert(pnt3d);
     distss->LoadS2(mkVert.Vertex());
@@ -515,7 +829,7 @@ float InspectNominalShape::getDistance(const Base::Vector3f& point) const
         }
         else if (fMinDist > 0) {
             // check if the distance was computed from a face
-            if (isBelowFace(pnt3d)) {
+            if (isBelowFace(*distss, pnt3d)) {
                 fMinDist = -fMinDist;
             }
         }
@@ -523,6 +837,50 @@ float InspectNominalShape::getDistance(const Base::Vector3f& point) const
     return fMinDist;
 }
 
+float InspectNominalShape::getProxyDistance(const Base::Vector3f& point) const
+{
+    // The tessellation deviates at most by the deflection from the faces, so points that are
+    // farther away from it cannot be inside the search radius.
+    float fProxyDist = std::numeric_limits<float>::max();
+    float fMaxDist = proxy->radius + proxy->deflection;
+    if (proxy->bvh.NearestFacetToPoint(point, fProxyDist, fMaxDist) == MeshCore::FACET_INDEX_MAX) {
+        return std::numeric_limits<float>::max();
+    }
+
+    // only the faces whose tessellation is close enough can contain the nearest point
+    std::vector<MeshCore::FacetIndex> facets;
+    Base::BoundBox3f box(point, fProxyDist + 2.0F * proxy->deflection);
+    proxy->bvh.Inside(
+        [&box](const Base::BoundBox3f& bb) {
+            return box.Intersect(bb);
+        },
+        facets
+    );
+    std::set<std::size_t> faces;
+    for (MeshCore::FacetIndex it : facets) {
+        faces.insert(proxy->facetToFace[it]);
+    }
+
+    gp_Pnt pnt3d(point.x, point.y, point.z);
+    BRepBuilderAPI_MakeVertex mkVert(pnt3d);
+    double fMinDist = std::numeric_limits<double>::max();
+    bool below = false;
+    for (std::size_t it : faces) {
+        BRepExtrema_DistShapeShape dist(proxy->faces[it], mkVert.Vertex());
+        if (dist.IsDone() && dist.NbSolution() > 0 && dist.Value() < fMinDist) {
+            fMinDist = dist.Value();
+            below = !isSolid && fMinDist > 0 && isBelowFace(dist, pnt3d);
+        }
+    }
+
+    if (fMinDist == std::numeric_limits<double>::max()) {
+        return fProxyDist;
+    }
+
+    bool inside = isSolid ? isInsideSolid(pnt3d) : below;
+    return inside ? -float(fMinDist) : float(fMinDist);
+}
+
 bool InspectNominalShape::isInsideSolid(const gp_Pnt& pnt3d) const
 {
     const Standard_Real tol = 0.001;
@@ -531,15 +889,15 @@ bool InspectNominalShape::isInsideSolid(const gp_Pnt& pnt3d) const
     return (classifier.State() == TopAbs_IN);
 }
 
-bool InspectNominalShape::isBelowFace(const gp_Pnt& pnt3d) const
+bool InspectNominalShape::isBelowFace(const BRepExtrema_DistShapeShape& distss, const gp_Pnt& pnt3d)
 {
     // check if the distance was computed from a face
-    for (Standard_Integer index = 1; index <= distss->NbSolution(); index++) {
-        if (distss->SupportTypeShape1(index) == BRepExtrema_IsInFace) {
-            TopoDS_Shape face = distss->SupportOnShape1(index);
+    for (Standard_Integer index = 1; index <= distss.NbSolution(); index++) {
+        if (distss.SupportTypeShape1(index) == BRepExtrema_IsInFace) {
+            TopoDS_Shape face = distss.SupportOnShape1(index);
             Standard_Real u, v;
-            distss->ParOnFaceS1(index, u, v);
-            // gp_Pnt pnt = distss->PointOnShape1(index);
+            distss.ParOnFaceS1(index, u, v);
+            // gp_Pnt pnt = distss.PointOnShape1(index);
             BRepGProp_Face props(TopoDS::Face(face));
             gp_Vec normal;
             gp_Pnt center;
@@ -737,30 +1095,250 @@ struct DistanceInspection
     std::vector<InspectNominalGeometry*> nominal;
 };
 
-// Helper internal class for QtConcurrent map operation. Holds sums-of-squares and counts for RMS
-// calculation
-class DistanceInspectionRMS
+// Helper internal class for QtConcurrent map operation. Collects the statistics of the distances
+// inside the search radius while they are computed: sums for mean and RMS, the extremes and
+// histograms over [-radius, radius]. The fine histogram is used to estimate percentiles.
+class DistanceInspectionStatistics
 {
 public:
-    DistanceInspectionRMS() = default;
-    DistanceInspectionRMS& operator+=(const DistanceInspectionRMS& rhs)
+    static constexpr std::size_t fineBins = 4096;
+
+    DistanceInspectionStatistics() = default;
+    DistanceInspectionStatistics(float radius, std::size_t bins)
+        : m_radius(radius)
+        , m_bins(std::max<std::size_t>(bins, 1))
+        , m_fine(fineBins)
+    {}
+    void add(float dist)
+    {
+        if (dist >= std::numeric_limits<float>::max()) {
+            m_above++;
+            return;
+        }
+        if (dist <= -std::numeric_limits<float>::max()) {
+            m_below++;
+            return;
+        }
+
+        double value = dist;
+        m_numv++;
+        m_sum += value;
+        m_sumsq += value * value;
+        m_min = std::min(m_min, value);
+        m_max = std::max(m_max, value);
+        m_bins[binIndex(value, m_bins.size())]++;
+        m_fine[binIndex(value, m_fine.size())]++;
+    }
+    DistanceInspectionStatistics& operator+=(const DistanceInspectionStatistics& rhs)
     {
+        // the result of the reduction is default constructed
+        if (this->m_fine.empty()) {
+            *this = rhs;
+            return *this;
+        }
+        if (rhs.m_fine.empty()) {
+            return *this;
+        }
+
         this->m_numv += rhs.m_numv;
+        this->m_above += rhs.m_above;
+        this->m_below += rhs.m_below;
+        this->m_sum += rhs.m_sum;
         this->m_sumsq += rhs.m_sumsq;
+        this->m_min = std::min(this->m_min, rhs.m_min);
+        this->m_max = std::max(this->m_max, rhs.m_max);
+        for (std::size_t i = 0; i < m_bins.size(); i++) {
+            this->m_bins[i] += rhs.m_bins[i];
+        }
+        for (std::size_t i = 0; i < m_fine.size(); i++) {
+            this->m_fine[i] += rhs.m_fine[i];
+        }
         return *this;
     }
-    double getRMS()
+    double getRMS() const
     {
         if (this->m_numv == 0) {
             return 0.0;
         }
         return sqrt(this->m_sumsq / (double)this->m_numv);
     }
-    int m_numv {0};
+    double getMean() const
+    {
+        if (this->m_numv == 0) {
+            return 0.0;
+        }
+        return this->m_sum / (double)this->m_numv;
+    }
+    double getStandardDeviation() const
+    {
+        if (this->m_numv == 0) {
+            return 0.0;
+        }
+        double mean = getMean();
+        return sqrt(std::max(this->m_sumsq / (double)this->m_numv - mean * mean, 0.0));
+    }
+    double getMin() const
+    {
+        return m_numv > 0 ? m_min : 0.0;
+    }
+    double getMax() const
+    {
+        return m_numv > 0 ? m_max : 0.0;
+    }
+    /// Estimates the distance below which \a percent of the distances lie
+    double getPercentile(double percent) const
+    {
+        if (this->m_numv == 0) {
+            return 0.0;
+        }
+
+        double rank = std::clamp(percent, 0.0, 100.0) / 100.0 * (double)this->m_numv;
+        double width = 2.0 * m_radius / (double)m_fine.size();
+        double count = 0.0;
+        for (std::size_t i = 0; i < m_fine.size(); i++) {
+            double next = count + (double)m_fine[i];
+            if (next >= rank && m_fine[i] > 0) {
+                // interpolate linearly inside the bin
+                double value = -m_radius + width * ((double)i + (rank - count) / m_fine[i]);
+                return std::clamp(value, m_min, m_max);
+            }
+            count = next;
+        }
+        return m_max;
+    }
+    const std::vector<long>& getHistogram() const
+    {
+        return m_bins;
+    }
+
+    long m_numv {0};
+    long m_above {0};
+    long m_below {0};
+
+private:
+    std::size_t binIndex(double value, std::size_t bins) const
+    {
+        double pos = (value + m_radius) / (2.0 * m_radius) * (double)bins;
+        return std::min<std::size_t>(pos > 0.0 ? std::size_t(pos) : 0, bins - 1);
+    }
+
+    double m_radius {0.0};
+    double m_sum {0.0};
     double m_sumsq {0.0};
+    double m_min {std::numeric_limits<double>::max()};
+    double m_max {-std::numeric_limits<double>::max()};
+    std::vector<long> m_bins;
+    std::vector<long> m_fine;
+};
+
+// FNV-1a over 32-bit words, used to detect changed geometry
+class ContentHash
+{
+public:
+    void add(const void* data, std::size_t size)
+    {
+        const char* bytes = static_cast<const char*>(data);
+        std::size_t pos = 0;
+        for (; pos + sizeof(std::uint32_t) <= size; pos += sizeof(std::uint32_t)) {
+            std::uint32_t word {};
+            std::memcpy(&word, bytes + pos, sizeof(word));
+            addWord(word);
+        }
+        for (; pos < size; pos++) {
+            addWord(static_cast<unsigned char>(bytes[pos]));
+        }
+    }
+    template<typename T>
+    void add(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        add(&value, sizeof(T));
+    }
+    void add(const Base::Matrix4D& mat)
+    {
+        double values[16];
+        mat.getMatrix(values);
+        add(values, sizeof(values));
+    }
+    std::uint64_t value() const
+    {
+        return hash;
+    }
+
+private:
+    void addWord(std::uint32_t word)
+    {
+        hash ^= word;
+        hash *= 1099511628211ULL;
+    }
+
+    std::uint64_t hash {14695981039346656037ULL};
 };
+
+// Adds the geometry of a nominal object to the hash. Shapes are only compared by identity, so
+// they are collected in \a shapes.
+void addNominal(ContentHash& hash, App::DocumentObject* obj, std::vector<TopoDS_Shape>& shapes)
+{
+    hash.add(obj->getTypeId().getKey());
+    if (obj->isDerivedFrom<Points::FeatureOutOfCore>()) {
+        // the tile files aren't modified after they are written
+        auto pts = static_cast<Points::FeatureOutOfCore*>(obj);
+        std::string file = pts->TileFile.getValue();
+        hash.add(file.data(), file.size());
+        hash.add(pts->Placement.getValue().toMatrix());
+        if (auto tiles = pts->getTiles()) {
+            hash.add(tiles->countPoints());
+        }
+    }
+    else if (obj->isDerivedFrom<Mesh::Feature>()) {
+        const Mesh::MeshObject& mesh = static_cast<Mesh::Feature*>(obj)->Mesh.getValue();
+        const MeshCore::MeshKernel& kernel = mesh.getKernel();
+        for (const auto& pnt : kernel.GetPoints()) {
+            hash.add(pnt.x);
+            hash.add(pnt.y);
+            hash.add(pnt.z);
+        }
+        for (const auto& face : kernel.GetFacets()) {
+            hash.add(face._aulPoints);
+        }
+        hash.add(mesh.getTransform());
+    }
+    else if (obj->isDerivedFrom<Points::Feature>()) {
+        const Points::PointKernel& kernel = static_cast<Points::Feature*>(obj)->Points.getValue();
+        const std::vector<Base::Vector3f>& points = kernel.getBasicPoints();
+        hash.add(points.data(), points.size() * sizeof(Base::Vector3f));
+        hash.add(kernel.getTransform());
+    }
+    else if (obj->isDerivedFrom<Part::Feature>()) {
+        shapes.push_back(static_cast<Part::Feature*>(obj)->Shape.getValue());
+    }
+}
 }  // namespace Inspection
 
+/** Keeps the state of the last inspection so that only blocks of points whose coordinates have
+ * changed are inspected again as long as the nominals stay the same. */
+struct Feature::Cache
+{
+    std::uint64_t nominalHash {};
+    // the shapes are kept to compare them, this way their data cannot be re-used for new shapes
+    std::vector<TopoDS_Shape> nominalShapes;
+    std::vector<std::uint64_t> blockHashes;
+
+    bool hasSameNominals(const Cache& other) const
+    {
+        if (nominalHash != other.nominalHash
+            || nominalShapes.size() != other.nominalShapes.size()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < nominalShapes.size(); i++) {
+            if (!nominalShapes[i].IsEqual(other.nominalShapes[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
 PROPERTY_SOURCE(Inspection::Feature, App::DocumentObject)
 
 Feature::Feature()
@@ -770,6 +1348,70 @@ Feature::Feature()
     ADD_PROPERTY(Actual, (nullptr));
     ADD_PROPERTY(Nominals, (nullptr));
     ADD_PROPERTY(Distances, (0.0));
+
+    const char* group = "Statistics";
+    auto output = static_cast<App::PropertyType>(App::Prop_ReadOnly | App::Prop_Output);
+    ADD_PROPERTY_TYPE(
+        HistogramBins,
+        (100),
+        group,
+        App::Prop_None,
+        "Number of histogram bins over the search radius"
+    );
+    ADD_PROPERTY_TYPE(
+        PercentileLevels,
+        (),
+        group,
+        App::Prop_None,
+        "Levels in percent for which the percentiles are computed"
+    );
+    ADD_PROPERTY_TYPE(
+        MinDistance,
+        (0.0),
+        group,
+        output,
+        "Minimum distance inside the search radius"
+    );
+    ADD_PROPERTY_TYPE(
+        MaxDistance,
+        (0.0),
+        group,
+        output,
+        "Maximum distance inside the search radius"
+    );
+    ADD_PROPERTY_TYPE(MeanDistance, (0.0), group, output, "Mean distance inside the search radius");
+    ADD_PROPERTY_TYPE(
+        RMS,
+        (0.0),
+        group,
+        output,
+        "Root mean square of the distances inside the search radius"
+    );
+    ADD_PROPERTY_TYPE(
+        StandardDeviation,
+        (0.0),
+        group,
+        output,
+        "Standard deviation of the distances inside the search radius"
+    );
+    ADD_PROPERTY_TYPE(CountInside, (0), group, output, "Number of points inside the search radius");
+    ADD_PROPERTY_TYPE(CountAbove, (0), group, output, "Number of points above the search radius");
+    ADD_PROPERTY_TYPE(CountBelow, (0), group, output, "Number of points below the search radius");
+    ADD_PROPERTY_TYPE(
+        Percentiles,
+        (),
+        group,
+        output,
+        "Estimated distances for the percentile levels"
+    );
+    ADD_PROPERTY_TYPE(
+        Histogram,
+        (),
+        group,
+        output,
+        "Number of points per bin, the bins evenly divide [-SearchRadius, SearchRadius]"
+    );
+    PercentileLevels.setValues({5.0, 25.0, 50.0, 75.0, 95.0});
 }
 
 Feature::~Feature() = default;
@@ -788,6 +1430,9 @@ short Feature::mustExecute() const
     if (Nominals.isTouched()) {
         return 1;
     }
+    if (HistogramBins.isTouched() || PercentileLevels.isTouched()) {
+        return 1;
+    }
     return 0;
 }
 
@@ -801,7 +1446,14 @@ App::DocumentObjectExecReturn* Feature::execute()
     }
 
     InspectActualGeometry* actual = nullptr;
-    if (pcActual->isDerivedFrom<Mesh::Feature>()) {
+    if (pcActual->isDerivedFrom<Points::FeatureOutOfCore>()) {
+        auto pts = static_cast<Points::FeatureOutOfCore*>(pcActual);
+        if (!pts->getTiles()) {
+            throw Base::FileException("Cannot open tile file", pts->TileFile.getValue());
+        }
+        actual = new InspectActualTiledPoints(pts->getTiles(), pts->Placement.getValue().toMatrix());
+    }
+    else if (pcActual->isDerivedFrom<Mesh::Feature>()) {
         Mesh::Feature* mesh = static_cast<Mesh::Feature*>(pcActual);
         actual = new InspectActualMesh(mesh->Mesh.getValue());
     }
@@ -824,7 +1476,15 @@ App::DocumentObjectExecReturn* Feature::execute()
     const std::vector<App::DocumentObject*>& nominals = Nominals.getValues();
     for (auto it : nominals) {
         InspectNominalGeometry* nominal = nullptr;
-        if (it->isDerivedFrom<Mesh::Feature>()) {
+        if (it->isDerivedFrom<Points::FeatureOutOfCore>()) {
+            auto pts = static_cast<Points::FeatureOutOfCore*>(it);
+            if (pts->getTiles()) {
+                nominal = new InspectNominalTiledPoints(pts->getTiles(),
+                                                        pts->Placement.getValue().toMatrix(),
+                                                        this->SearchRadius.getValue());
+            }
+        }
+        else if (it->isDerivedFrom<Mesh::Feature>()) {
             Mesh::Feature* mesh = static_cast<Mesh::Feature*>(it);
             nominal = new InspectNominalMesh(mesh->Mesh.getValue(), this->SearchRadius.getValue());
         }
@@ -833,17 +1493,32 @@ App::DocumentObjectExecReturn* Feature::execute()
             nominal = new InspectNominalPoints(pts->Points.getValue(), this->SearchRadius.getValue());
         }
         else if (it->isDerivedFrom<Part::Feature>()) {
-            useMultithreading = false;
             Part::Feature* part = static_cast<Part::Feature*>(it);
             nominal = new InspectNominalShape(part->Shape.getValue(), this->SearchRadius.getValue());
         }
 
         if (nominal) {
+            useMultithreading = useMultithreading && nominal->isThreadSafe();
             inspectNominal.push_back(nominal);
         }
     }
     // clang-format on
 
+    // The distances of a block of points are taken from the last run if neither the nominals
+    // nor the coordinates of its points have changed.
+    float radius = this->SearchRadius.getValue();
+    auto newCache = std::make_unique<Cache>();
+    {
+        ContentHash hash;
+        hash.add(radius);
+        for (auto it : nominals) {
+            addNominal(hash, it, newCache->nominalShapes);
+        }
+        newCache->nominalHash = hash.value();
+    }
+    const Cache* oldCache = cache && cache->hasSameNominals(*newCache) ? cache.get() : nullptr;
+    const std::vector<float>& oldVals = Distances.getValues();
+
 #if 0
 # if 1  // test with some huge data sets
     std::vector<unsigned long> index(actual->countPoints());
@@ -901,72 +1576,97 @@ App::DocumentObjectExecReturn* Feature::execute()
 #else
     unsigned long count = actual->countPoints();
     std::vector<float> vals(count);
-    std::function<DistanceInspectionRMS(int)> fMap = [&](unsigned int index) {
-        DistanceInspectionRMS res;
-        Base::Vector3f pnt = actual->getPoint(index);
 
-        float fMinDist = std::numeric_limits<float>::max();
-        for (auto it : inspectNominal) {
-            float fDist = it->getDistance(pnt);
-            if (fabs(fDist) < fabs(fMinDist)) {
-                fMinDist = fDist;
-            }
+    // The points are inspected in blocks of neighbouring points so that the nominals can reuse
+    // their search results from one point to the next.
+    const unsigned long blockSize = 4096;
+    unsigned long countBlocks = (count + blockSize - 1) / blockSize;
+    newCache->blockHashes.resize(countBlocks);
+    auto bins = static_cast<std::size_t>(std::max<long>(HistogramBins.getValue(), 1));
+    std::function<DistanceInspectionStatistics(unsigned long)> fMap = [&](unsigned long block) {
+        DistanceInspectionStatistics res(radius, bins);
+        unsigned long first = block * blockSize;
+        unsigned long last = std::min(first + blockSize, count);
+
+        std::vector<Base::Vector3f> points;
+        points.reserve(last - first);
+        for (unsigned long index = first; index < last; index++) {
+            points.push_back(actual->getPoint(index));
         }
 
-        if (fMinDist > this->SearchRadius.getValue()) {
-            fMinDist = std::numeric_limits<float>::max();
-        }
-        else if (-fMinDist > this->SearchRadius.getValue()) {
-            fMinDist = -std::numeric_limits<float>::max();
+        ContentHash hash;
+        hash.add(points.data(), points.size() * sizeof(Base::Vector3f));
+        newCache->blockHashes[block] = hash.value();
+        if (oldCache && block < oldCache->blockHashes.size()
+            && oldCache->blockHashes[block] == hash.value() && last <= oldVals.size()) {
+            for (unsigned long index = first; index < last; index++) {
+                res.add(oldVals[index]);
+                vals[index] = oldVals[index];
+            }
+            return res;
         }
-        else {
-            res.m_sumsq += static_cast<double>(fMinDist) * static_cast<double>(fMinDist);
-            res.m_numv++;
+
+        std::vector<float> minDist(points.size(), std::numeric_limits<float>::max());
+        std::vector<float> dist;
+        for (auto it : inspectNominal) {
+            it->getDistances(points, dist);
+            for (std::size_t i = 0; i < points.size(); i++) {
+                if (fabs(dist[i]) < fabs(minDist[i])) {
+                    minDist[i] = dist[i];
+                }
+            }
         }
 
-        vals[index] = fMinDist;
+        for (std::size_t i = 0; i < points.size(); i++) {
+            float fMinDist = minDist[i];
+            if (fMinDist > radius) {
+                fMinDist = std::numeric_limits<float>::max();
+            }
+            else if (-fMinDist > radius) {
+                fMinDist = -std::numeric_limits<float>::max();
+            }
+
+            res.add(fMinDist);
+            vals[first + i] = fMinDist;
+        }
         return res;
     };
 
-    DistanceInspectionRMS res;
+    DistanceInspectionStatistics res;
 
     if (useMultithreading) {
-        // Build vector of increasing indices
-        std::vector<unsigned long> index(count);
+        // Build vector of increasing block indices
+        std::vector<unsigned long> index(countBlocks);
         std::iota(index.begin(), index.end(), 0);
+        // The workers only count the finished blocks, the progress bar is updated from here
+        Base::ProgressTask task(countBlocks);
+        auto fMapProgress = [&fMap, &task](unsigned long block) {
+            if (task.isCanceled()) {
+                return DistanceInspectionStatistics();
+            }
+            DistanceInspectionStatistics stat = fMap(block);
+            task.advance();
+            return stat;
+        };
         // Perform map-reduce operation : compute distances and update sum of squares for RMS
         // computation
-        QFuture<DistanceInspectionRMS> future
-            = QtConcurrent::mappedReduced(index, fMap, &DistanceInspectionRMS::operator+=);
-        // Setup progress bar
-        Base::FutureWatcherProgress progress("Inspecting...", actual->countPoints());
-        QFutureWatcher<DistanceInspectionRMS> watcher;
-        QObject::connect(
-            &watcher,
-            &QFutureWatcher<DistanceInspectionRMS>::progressValueChanged,
-            &progress,
-            &Base::FutureWatcherProgress::progressValueChanged
+        QFuture<DistanceInspectionStatistics> future = QtConcurrent::mappedReduced(
+            index,
+            fMapProgress,
+            &DistanceInspectionStatistics::operator+=
         );
-        // Keep UI responsive during computation
-        QEventLoop loop;
-        QObject::connect(
-            &watcher,
-            &QFutureWatcher<DistanceInspectionRMS>::finished,
-            &loop,
-            &QEventLoop::quit
-        );
-        watcher.setFuture(future);
-        loop.exec();
+        Base::waitForProgress("Inspecting...", task, [&future]() { return future.isFinished(); });
         res = future.result();
     }
     else {
         // Single-threaded operation
         std::stringstream str;
         str << "Inspecting " << this->Label.getValue() << "…";
-        Base::SequencerLauncher seq(str.str().c_str(), count);
+        Base::SequencerLauncher seq(str.str().c_str(), countBlocks);
 
-        for (unsigned int i = 0; i < count; i++) {
+        for (unsigned long i = 0; i < countBlocks; i++) {
             res += fMap(i);
+            seq.next();
         }
     }
 
@@ -978,6 +1678,24 @@ App::DocumentObjectExecReturn* Feature::execute()
         res.getRMS()
     );
     Distances.setValues(vals);
+    cache = std::move(newCache);
+
+    MinDistance.setValue(res.getMin());
+    MaxDistance.setValue(res.getMax());
+    MeanDistance.setValue(res.getMean());
+    RMS.setValue(res.getRMS());
+    StandardDeviation.setValue(res.getStandardDeviation());
+    CountInside.setValue(res.m_numv);
+    CountAbove.setValue(res.m_above);
+    CountBelow.setValue(res.m_below);
+    std::vector<double> percentiles;
+    for (double level : PercentileLevels.getValues()) {
+        percentiles.push_back(res.getPercentile(level));
+    }
+    Percentiles.setValues(percentiles);
+    std::vector<long> histogram = res.getHistogram();
+    histogram.resize(bins);
+    Histogram.setValues(histogram);
 #endif
 
     delete actual;
@@ -24,6 +24,10 @@
 
 #pragma once
 
+#include <list>
+#include <memory>
+#include <mutex>
+
 #include <App/DocumentObject.h>
 #include <App/DocumentObjectGroup.h>
 
@@ -38,6 +42,7 @@ class gp_Pnt;
 namespace MeshCore
 {
 class MeshKernel;
+class MeshFacetBVH;
 class MeshGrid;
 }  // namespace MeshCore
 
@@ -48,6 +53,7 @@ class MeshObject;
 namespace Points
 {
 class PointsGrid;
+class PointsOutOfCore;
 }
 namespace Part
 {
@@ -93,6 +99,20 @@ private:
     const Points::PointKernel& _rKernel;
 };
 
+/** The points are read tile by tile from a PointsOutOfCore file and transformed with \a mat. */
+class InspectionExport InspectActualTiledPoints: public InspectActualGeometry
+{
+public:
+    InspectActualTiledPoints(std::shared_ptr<const Points::PointsOutOfCore>, const Base::Matrix4D& mat);
+    unsigned long countPoints() const override;
+    Base::Vector3f getPoint(unsigned long) const override;
+
+private:
+    std::shared_ptr<const Points::PointsOutOfCore> _tiles;
+    bool _bApply;
+    Base::Matrix4D _clTrf;
+};
+
 class InspectionExport InspectActualShape: public InspectActualGeometry
 {
 public:
@@ -115,6 +135,18 @@ public:
     InspectNominalGeometry() = default;
     virtual ~InspectNominalGeometry() = default;
     virtual float getDistance(const Base::Vector3f&) const = 0;
+    /** Computes the distances of a block of \a points. Subsequent points should be close to each
+     * other so that search results can be reused. Distances beyond the search radius may be given
+     * as the maximum float value. The default implementation calls getDistance() for each point. */
+    virtual void getDistances(
+        const std::vector<Base::Vector3f>& points,
+        std::vector<float>& distances
+    ) const;
+    /// Checks whether getDistance() can be called from several threads at the same time
+    virtual bool isThreadSafe() const
+    {
+        return true;
+    }
 };
 
 class InspectionExport InspectNominalMesh: public InspectNominalGeometry
@@ -123,11 +155,13 @@ public:
     InspectNominalMesh(const Mesh::MeshObject& rMesh, float offset);
     ~InspectNominalMesh() override;
     float getDistance(const Base::Vector3f&) const override;
+    void getDistances(const std::vector<Base::Vector3f>&, std::vector<float>&) const override;
 
 private:
     const MeshCore::MeshKernel& _mesh;
-    MeshCore::MeshGrid* _pGrid;
+    MeshCore::MeshFacetBVH* _pBVH;
     Base::BoundBox3f _box;
+    float _offset;
     bool _bApply;
     Base::Matrix4D _clTrf;
 };
@@ -138,6 +172,11 @@ public:
     InspectNominalFastMesh(const Mesh::MeshObject& rMesh, float offset);
     ~InspectNominalFastMesh() override;
     float getDistance(const Base::Vector3f&) const override;
+    void getDistances(const std::vector<Base::Vector3f>&, std::vector<float>&) const override;
+
+protected:
+    void getFacets(const Base::Vector3f&, std::set<unsigned long>&) const;
+    float getDistance(const Base::Vector3f&, const std::set<unsigned long>&) const;
 
 protected:
     const MeshCore::MeshKernel& _mesh;
@@ -154,25 +193,61 @@ public:
     InspectNominalPoints(const Points::PointKernel&, float offset);
     ~InspectNominalPoints() override;
     float getDistance(const Base::Vector3f&) const override;
+    void getDistances(const std::vector<Base::Vector3f>&, std::vector<float>&) const override;
+
+private:
+    float getDistance(const Base::Vector3d&, const std::set<unsigned long>&) const;
 
 private:
     const Points::PointKernel& _rKernel;
     Points::PointsGrid* _pGrid;
 };
 
+/** Only the tiles of a PointsOutOfCore file near to a point are loaded and searched. A grid is
+ * built for each loaded tile and the most recently used ones are kept in a cache. */
+class InspectionExport InspectNominalTiledPoints: public InspectNominalGeometry
+{
+public:
+    InspectNominalTiledPoints(
+        std::shared_ptr<const Points::PointsOutOfCore>,
+        const Base::Matrix4D& mat,
+        float offset
+    );
+    ~InspectNominalTiledPoints() override;
+    float getDistance(const Base::Vector3f&) const override;
+
+private:
+    struct Tile;
+    std::shared_ptr<const Tile> getTile(std::size_t) const;
+
+private:
+    std::shared_ptr<const Points::PointsOutOfCore> _tiles;
+    Base::Matrix4D _clInv;
+    float _offset;
+    mutable std::mutex _mutex;
+    mutable std::list<std::pair<std::size_t, std::shared_ptr<const Tile>>> _cache;
+};
+
+/** If the shape has faces the distance is first computed to a tessellation of it. Only for
+ * points inside the search radius the exact distance to the nearby faces is computed. */
 class InspectionExport InspectNominalShape: public InspectNominalGeometry
 {
 public:
     InspectNominalShape(const TopoDS_Shape&, float offset);
     ~InspectNominalShape() override;
     float getDistance(const Base::Vector3f&) const override;
+    bool isThreadSafe() const override;
 
 private:
+    void buildProxy(float offset);
+    float getProxyDistance(const Base::Vector3f&) const;
     bool isInsideSolid(const gp_Pnt&) const;
-    bool isBelowFace(const gp_Pnt&) const;
+    static bool isBelowFace(const BRepExtrema_DistShapeShape&, const gp_Pnt&);
 
 private:
+    struct Proxy;
     BRepExtrema_DistShapeShape* distss;
+    Proxy* proxy {nullptr};
     const TopoDS_Shape& _rShape;
     bool isSolid {false};
 };
@@ -258,6 +333,25 @@ public:
     PropertyDistanceList Distances;
     //@}
 
+    /** @name Statistics
+     * The statistics are collected while computing the distances and only consider the points
+     * inside the search radius.
+     */
+    //@{
+    App::PropertyInteger HistogramBins;
+    App::PropertyFloatList PercentileLevels;
+    App::PropertyFloat MinDistance;
+    App::PropertyFloat MaxDistance;
+    App::PropertyFloat MeanDistance;
+    App::PropertyFloat RMS;
+    App::PropertyFloat StandardDeviation;
+    App::PropertyInteger CountInside;
+    App::PropertyInteger CountAbove;
+    App::PropertyInteger CountBelow;
+    App::PropertyFloatList Percentiles;
+    App::PropertyIntegerList Histogram;
+    //@}
+
     /** @name Actions */
     //@{
     short mustExecute() const override;
@@ -270,6 +364,10 @@ public:
     {
         return "InspectionGui::ViewProviderInspection";
     }
+
+private:
+    struct Cache;
+    std::unique_ptr<Cache> cache;
 };
 
 class InspectionExport Group: public App::DocumentObjectGroup
@@ -50,6 +50,7 @@
 #include <Gui/Document.h>
 #include <Gui/Flag.h>
 #include <Gui/MainWindow.h>
+#include <Gui/ScalarFieldColoring.h>
 #include <Gui/SoFCColorBar.h>
 #include <Gui/SoFCColorBarNotifier.h>
 #include <Gui/View3DInventorViewer.h>
@@ -92,6 +93,10 @@ ViewProviderInspection::ViewProviderInspection()
     pcMatBinding->ref();
     pcColorMat = new SoMaterial;
     pcColorMat->ref();
+    // the colors are taken from the texture of the scalar field
+    pcColorMat->diffuseColor.setValue(1.0f, 1.0f, 1.0f);
+    scalarField = std::make_unique<Gui::ScalarFieldColoring>();
+    scalarField->setHiddenTransparency(0.8f);
     pcColorStyle = new SoDrawStyle();
     pcColorRoot->addChild(pcColorStyle);
     pcCoords = new SoCoordinate3;
@@ -192,6 +197,7 @@ void ViewProviderInspection::attach(App::DocumentObject* pcFeat)
 
     pcColorShadedRoot->addChild(pcColorMat);
     pcColorShadedRoot->addChild(pcMatBinding);
+    pcColorShadedRoot->addChild(scalarField->getRoot());
     pcColorShadedRoot->addChild(pcLinkRoot);
 
     addDisplayMaskMode(pcColorShadedRoot, "ColorShaded");
@@ -418,35 +424,13 @@ void ViewProviderInspection::setDistances()
     const std::vector<float>& fValues
         = static_cast<Inspection::PropertyDistanceList*>(pDistances)->getValues();
     if ((int)fValues.size() != this->pcCoords->point.getNum()) {
-        pcMatBinding->value = SoMaterialBinding::OVERALL;
+        scalarField->setValues({});
         return;
     }
 
-    if (pcColorMat->diffuseColor.getNum() != static_cast<int>(fValues.size())) {
-        pcColorMat->diffuseColor.setNum(static_cast<int>(fValues.size()));
-    }
-    if (pcColorMat->transparency.getNum() != static_cast<int>(fValues.size())) {
-        pcColorMat->transparency.setNum(static_cast<int>(fValues.size()));
-    }
-
-    SbColor* cols = pcColorMat->diffuseColor.startEditing();
-    float* tran = pcColorMat->transparency.startEditing();
-
-    unsigned long j = 0;
-    for (std::vector<float>::const_iterator jt = fValues.begin(); jt != fValues.end(); ++jt, j++) {
-        Base::Color col = pcColorBar->getColor(*jt);
-        cols[j] = SbColor(col.r, col.g, col.b);
-        if (pcColorBar->isVisible(*jt)) {
-            tran[j] = 0.0f;
-        }
-        else {
-            tran[j] = 0.8f;
-        }
-    }
-
-    pcColorMat->diffuseColor.finishEditing();
-    pcColorMat->transparency.finishEditing();
-    pcMatBinding->value = SoMaterialBinding::PER_VERTEX_INDEXED;
+    // the values are mapped onto the colors of the color bar when rendering
+    scalarField->setValues(fValues);
+    scalarField->setColorBar(pcColorBar);
 }
 
 QIcon ViewProviderInspection::getIcon() const
@@ -486,7 +470,8 @@ std::vector<std::string> ViewProviderInspection::getDisplayModes() const
 
 void ViewProviderInspection::OnChange(Base::Subject<int>& /*rCaller*/, int /*rcReason*/)
 {
-    setActiveMode();
+    // only the color mapping has changed, the distances can be kept
+    scalarField->setColorBar(pcColorBar);
 }
 
 namespace InspectionGui
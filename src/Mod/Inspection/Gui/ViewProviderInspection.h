@@ -25,6 +25,7 @@
 #pragma once
 
 #include <limits>
+#include <memory>
 
 #include <App/ComplexGeoData.h>
 #include <Base/Observer.h>
@@ -41,6 +42,7 @@ class SoCoordinate3;
 
 namespace Gui
 {
+class ScalarFieldColoring;
 class SoFCColorBar;
 class View3DInventorViewer;
 }  // namespace Gui
@@ -108,6 +110,7 @@ private:
     SoDrawStyle* pcPointStyle;
     SoSeparator* pcColorRoot;
     SoCoordinate3* pcCoords;
+    std::unique_ptr<Gui::ScalarFieldColoring> scalarField;
 
 private:
     float search_radius {std::numeric_limits<float>::max()};
@@ -95,7 +95,7 @@ bool MaterialFilter::modelIncluded(const Material& material) const
 bool MaterialFilter::modelIncluded(const QString& uuid) const
 {
     try {
-        auto material = MaterialManager::getManager().getMaterial(uuid);
+        auto material = MaterialManager::getManager().getIndexedMaterial(uuid);
         return modelIncluded(*material);
     }
     catch (const MaterialNotFound&) {
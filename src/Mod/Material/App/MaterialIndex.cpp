@@ -0,0 +1,196 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QTextStream>
+
+#include <App/Application.h>
+#include <Base/Console.h>
+
+#include "MaterialIndex.h"
+#include "Materials.h"
+
+
+using namespace Materials;
+
+namespace
+{
+// Increase when the entries change, older indexes are then rebuilt
+const QString indexHeader = QStringLiteral("FCMatIndex\t1");
+const QChar fieldSeparator = QLatin1Char('\t');
+const QChar listSeparator = QLatin1Char(';');
+const int fieldCount = 9;
+
+qint64 modificationTime(const QFileInfo& file)
+{
+    return file.lastModified().toMSecsSinceEpoch();
+}
+
+QStringList splitList(const QString& field)
+{
+    return field.split(listSeparator, Qt::SkipEmptyParts);
+}
+
+QStringList sortedList(const QSet<QString>& set)
+{
+    QStringList list(set.begin(), set.end());
+    list.sort();
+    return list;
+}
+}  // namespace
+
+MaterialIndex::MaterialIndex(const QString& libraryDirectory)
+    : _directory(libraryDirectory)
+{
+    auto hash = QCryptographicHash::hash(libraryDirectory.toUtf8(), QCryptographicHash::Sha1);
+    _indexPath = QString::fromStdString(App::Application::getUserCachePath())
+        + QStringLiteral("MaterialIndex/") + QString::fromLatin1(hash.toHex())
+        + QStringLiteral(".txt");
+}
+
+void MaterialIndex::load()
+{
+    _entries.clear();
+    _modified = false;
+
+    QFile file(_indexPath);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        return;
+    }
+
+    QTextStream in(&file);
+#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
+    in.setCodec("UTF-8");
+#endif
+    if (in.readLine() != indexHeader || in.readLine() != _directory) {
+        // Different version or a hash collision. It is rebuilt on save
+        _modified = true;
+        return;
+    }
+
+    while (!in.atEnd()) {
+        auto fields = in.readLine().split(fieldSeparator);
+        if (fields.size() != fieldCount) {
+            _modified = true;
+            continue;
+        }
+
+        Entry entry;
+        entry.path = fields[0];
+        entry.modified = fields[1].toLongLong();
+        entry.size = fields[2].toLongLong();
+        entry.uuid = fields[3];
+        entry.name = fields[4];
+        entry.parentUuid = fields[5];
+        entry.physicalModels = splitList(fields[6]);
+        entry.appearanceModels = splitList(fields[7]);
+        entry.values = splitList(fields[8]);
+        _entries[entry.path] = entry;
+    }
+}
+
+void MaterialIndex::save()
+{
+    if (!_modified) {
+        return;
+    }
+
+    QDir().mkpath(QFileInfo(_indexPath).absolutePath());
+    QFile file(_indexPath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text | QIODevice::Truncate)) {
+        Base::Console().log("Unable to write the material index '%s'\n",
+                            _indexPath.toStdString().c_str());
+        return;
+    }
+
+    QTextStream out(&file);
+#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
+    out.setCodec("UTF-8");
+#endif
+    out << indexHeader << '\n' << _directory << '\n';
+    for (auto& it : _entries) {
+        auto& entry = it.second;
+        QStringList fields {entry.path,
+                            QString::number(entry.modified),
+                            QString::number(entry.size),
+                            entry.uuid,
+                            entry.name,
+                            entry.parentUuid,
+                            entry.physicalModels.join(listSeparator),
+                            entry.appearanceModels.join(listSeparator),
+                            entry.values.join(listSeparator)};
+        out << fields.join(fieldSeparator) << '\n';
+    }
+    _modified = false;
+}
+
+const MaterialIndex::Entry* MaterialIndex::find(const QFileInfo& file) const
+{
+    auto it = _entries.find(file.canonicalFilePath());
+    if (it == _entries.end() || it->second.modified != modificationTime(file)
+        || it->second.size != file.size()) {
+        return nullptr;
+    }
+    return &it->second;
+}
+
+void MaterialIndex::update(const QFileInfo& file, const Material& material)
+{
+    Entry entry;
+    entry.path = file.canonicalFilePath();
+    entry.modified = modificationTime(file);
+    entry.size = file.size();
+    entry.uuid = material.getUUID();
+    entry.name = material.getName();
+    entry.parentUuid = material.getParentUUID();
+    entry.physicalModels = sortedList(*material.getPhysicalModels());
+    entry.appearanceModels = sortedList(*material.getAppearanceModels());
+    entry.values = sortedList(material.getValuedPropertyNames());
+
+    for (auto& field : {entry.path, entry.name}) {
+        if (field.contains(fieldSeparator) || field.contains(QLatin1Char('\n'))) {
+            // Can't be stored, the file is parsed on every start up instead
+            _modified = _entries.erase(entry.path) > 0 || _modified;
+            return;
+        }
+    }
+
+    _entries[entry.path] = entry;
+    _modified = true;
+}
+
+void MaterialIndex::retain(const QSet<QString>& paths)
+{
+    for (auto it = _entries.begin(); it != _entries.end();) {
+        if (paths.contains(it->first)) {
+            ++it;
+        }
+        else {
+            it = _entries.erase(it);
+            _modified = true;
+        }
+    }
+}
@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#pragma once
+
+#include <map>
+
+#include <QFileInfo>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+
+#include <Mod/Material/MaterialGlobal.h>
+
+namespace Materials
+{
+class Material;
+
+/*
+ * Persistent index of the materials in a local library
+ *
+ * The index records the metadata of each material file together with its modification time
+ * and size, so materials can be listed and filtered at start up without parsing the files.
+ * It is stored in the user cache directory, one file per library directory.
+ */
+class MaterialsExport MaterialIndex
+{
+public:
+    struct Entry
+    {
+        QString path;
+        qint64 modified = 0;
+        qint64 size = 0;
+        QString uuid;
+        QString name;
+        QString parentUuid;
+        QStringList physicalModels;
+        QStringList appearanceModels;
+        QStringList values;  // Names of the properties with a value in the file
+    };
+
+    explicit MaterialIndex(const QString& libraryDirectory);
+    ~MaterialIndex() = default;
+
+    void load();
+    void save();
+
+    /*
+     * Return the entry of the file, or nullptr if it isn't indexed or has changed since
+     */
+    const Entry* find(const QFileInfo& file) const;
+    void update(const QFileInfo& file, const Material& material);
+    /*
+     * Remove the entries of the files not in the list
+     */
+    void retain(const QSet<QString>& paths);
+
+private:
+    QString _directory;
+    QString _indexPath;
+    std::map<QString, Entry> _entries;
+    bool _modified = false;
+};
+
+}  // namespace Materials
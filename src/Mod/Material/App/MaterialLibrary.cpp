@@ -98,7 +98,7 @@ MaterialLibrary::getMaterialTree(const Materials::MaterialFilter& filter,
         child->setUUID(uuid);
         child->setReadOnly(isReadOnly());
         if (isLocal()) {
-            auto material = MaterialManager::getManager().getMaterial(uuid);
+            auto material = MaterialManager::getManager().getIndexedMaterial(uuid);
             child->setOldFormat(material->isOldFormat());
         }
         (*node)[filename] = child;
@@ -357,6 +357,11 @@ std::shared_ptr<Material> MaterialLibraryLocal::getMaterialByPath(const QString&
     throw MaterialNotFound();
 }
 
+void MaterialLibraryLocal::clearMaterials()
+{
+    _materialPathMap->clear();
+}
+
 QString MaterialLibraryLocal::getUUIDFromPath(const QString& path) const
 {
     QString filePath = getRelativePath(path);
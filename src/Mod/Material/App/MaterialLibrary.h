@@ -96,6 +96,8 @@ public:
     std::shared_ptr<Material> addMaterial(const std::shared_ptr<Material>& material,
                                           const QString& path);
     std::shared_ptr<Material> getMaterialByPath(const QString& path) const;
+    // Drop the materials, such as when the library has been replaced by a reloaded one
+    void clearMaterials();
 
     bool operator==(const MaterialLibrary& library) const
     {
@@ -26,6 +26,7 @@
 #include <QList>
 #include <QMetaType>
 #include <QRegularExpression>
+#include <QSet>
 #include <QString>
 
 
@@ -37,6 +38,7 @@
 #include "Materials.h"
 
 #include "MaterialConfigLoader.h"
+#include "MaterialIndex.h"
 #include "MaterialLibrary.h"
 #include "MaterialLoader.h"
 #include "Model.h"
@@ -166,6 +168,14 @@ std::shared_ptr<Array3D> MaterialYamlEntry::read3DArray(const YAML::Node& node,
 
 void MaterialYamlEntry::addToTree(
     std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> materialMap)
+{
+    auto finalModel = createMaterial();
+
+    QString path = QDir(getDirectory()).absolutePath();
+    (*materialMap)[getUUID()] = getLibrary()->addMaterial(finalModel, path);
+}
+
+std::shared_ptr<Material> MaterialYamlEntry::createMaterial() const
 {
     std::set<QString> exclude;
     exclude.insert(QStringLiteral("General"));
@@ -359,8 +369,7 @@ void MaterialYamlEntry::addToTree(
         }
     }
 
-    QString path = QDir(directory).absolutePath();
-    (*materialMap)[uuid] = library->addMaterial(finalModel, path);
+    return finalModel;
 }
 
 //===
@@ -510,6 +519,16 @@ void MaterialLoader::dereference(
             }
         }
 
+        if (!material->isLoaded()) {
+            // The values are inherited again once the material is read
+            material->inheritIndexedValues(*parent);
+            material->markDereferenced();
+            return;
+        }
+        if (!parent->isLoaded()) {
+            loadMaterial(materialMap, parent);
+        }
+
         // Add values
         auto properties = parent->getPhysicalProperties();
         for (auto& itp : properties) {
@@ -540,22 +559,123 @@ void MaterialLoader::dereference(const std::shared_ptr<Material>& material)
     dereference(_materialMap, material);
 }
 
+void MaterialLoader::loadMaterial(
+    const std::shared_ptr<std::map<QString, std::shared_ptr<Material>>>& materialMap,
+    const std::shared_ptr<Material>& material)
+{
+    if (material->isLoaded()) {
+        return;
+    }
+
+    auto loaded = readMaterial(material);
+    if (!loaded) {
+        // Don't try again if the file can't be read
+        material->setLoaded(true);
+        return;
+    }
+    dereference(materialMap, loaded);
+
+    // Update the indexed material in place as it is shared with the library. Other threads
+    // see it as loaded only once the assignment is complete
+    *material = *loaded;
+}
+
+std::shared_ptr<Material> MaterialLoader::readMaterial(const std::shared_ptr<Material>& material)
+{
+    auto library = material->getLibrary();
+    if (!library || !library->isLocal()) {
+        return nullptr;
+    }
+    auto materialLibrary =
+        reinterpret_cast<const std::shared_ptr<Materials::MaterialLibraryLocal>&>(library);
+    QString path = QDir::cleanPath(materialLibrary->getLocalPath(
+        material->getDirectory() + QStringLiteral("/") + material->getFilename()));
+
+    Base::FileInfo info(path.toStdString());
+    Base::ifstream fin(info);
+    if (!fin) {
+        Base::Console().error("YAML file open error: '%s'\n", path.toStdString().c_str());
+        return nullptr;
+    }
+
+    YAML::Node yamlroot;
+    try {
+        yamlroot = YAML::Load(fin);
+
+        auto model = getMaterialFromYAML(materialLibrary, yamlroot, path);
+        if (!model) {
+            return nullptr;
+        }
+
+        auto loaded = model->createMaterial();
+        loaded->setLibrary(library);
+        loaded->setDirectory(material->getDirectory());
+        loaded->setFilename(material->getFilename());
+        return loaded;
+    }
+    catch (YAML::Exception const& e) {
+        Base::Console().error("YAML parsing error: '%s'\n", path.toStdString().c_str());
+        Base::Console().error("\t'%s'\n", e.what());
+        showYaml(yamlroot);
+    }
+
+    return nullptr;
+}
+
+void MaterialLoader::addIndexed(const std::shared_ptr<MaterialLibraryLocal>& library,
+                                const QFileInfo& file,
+                                const MaterialIndex& index)
+{
+    auto entry = index.find(file);
+    auto material = std::make_shared<Material>(library, entry->path, entry->uuid, entry->name);
+    material->setParentUUID(entry->parentUuid);
+    for (auto& uuid : entry->physicalModels) {
+        material->addPhysical(uuid);
+    }
+    for (auto& uuid : entry->appearanceModels) {
+        material->addAppearance(uuid);
+    }
+    material->setIndexedValues(QSet<QString>(entry->values.begin(), entry->values.end()));
+    material->setLoaded(false);
+
+    (*_materialMap)[entry->uuid] = library->addMaterial(material, entry->path);
+}
+
 void MaterialLoader::loadLibrary(const std::shared_ptr<MaterialLibraryLocal>& library)
 {
     if (_materialEntryMap == nullptr) {
         _materialEntryMap = std::make_unique<std::map<QString, std::shared_ptr<MaterialEntry>>>();
     }
 
+    auto param = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Material/Resources");
+    bool useIndex = param->GetBool("UseMaterialIndex", true);
+
+    // Files unchanged since the last start up are created from the index and read on demand
+    MaterialIndex index(library->getDirectory());
+    if (useIndex) {
+        index.load();
+    }
+
+    QSet<QString> paths;
+    std::vector<std::pair<QFileInfo, QString>> parsed;
     QDirIterator it(library->getDirectory(), QDirIterator::Subdirectories);
     while (it.hasNext()) {
         auto pathname = it.next();
         QFileInfo file(pathname);
         if (file.isFile()) {
             if (file.suffix().toStdString() == "FCMat") {
+                paths.insert(file.canonicalFilePath());
+                if (useIndex && index.find(file)) {
+                    addIndexed(library, file, index);
+                    continue;
+                }
+
                 try {
                     auto model = getMaterialFromPath(library, file.canonicalFilePath());
                     if (model) {
                         (*_materialEntryMap)[model->getUUID()] = model;
+                        parsed.emplace_back(file, model->getUUID());
                     }
                 }
                 catch (const MaterialReadError&) {
@@ -568,6 +688,18 @@ void MaterialLoader::loadLibrary(const std::shared_ptr<MaterialLibraryLocal>& li
     for (auto& it : *_materialEntryMap) {
         it.second->addToTree(_materialMap);
     }
+
+    if (useIndex) {
+        // Values are indexed before inheritance is applied
+        for (auto& [file, uuid] : parsed) {
+            auto material = _materialMap->find(uuid);
+            if (material != _materialMap->end()) {
+                index.update(file, *material->second);
+            }
+        }
+        index.retain(paths);
+        index.save();
+    }
 }
 
 void MaterialLoader::loadLibraries(
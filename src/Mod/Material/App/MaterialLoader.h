@@ -26,6 +26,7 @@
 #include <memory>
 
 #include <QDir>
+#include <QFileInfo>
 #include <QString>
 #include <yaml-cpp/yaml.h>
 
@@ -34,6 +35,7 @@
 
 namespace Materials
 {
+class MaterialIndex;
 class MaterialLibrary;
 class MaterialLibraryLocal;
 
@@ -49,6 +51,7 @@ public:
 
     virtual void
     addToTree(std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> materialMap) = 0;
+    virtual std::shared_ptr<Material> createMaterial() const = 0;
 
     std::shared_ptr<MaterialLibraryLocal> getLibrary() const
     {
@@ -86,6 +89,7 @@ public:
 
     void
     addToTree(std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> materialMap) override;
+    std::shared_ptr<Material> createMaterial() const override;
 
     const YAML::Node& getModel() const
     {
@@ -123,6 +127,12 @@ public:
     static void
     dereference(const std::shared_ptr<std::map<QString, std::shared_ptr<Material>>>& materialMap,
                 const std::shared_ptr<Material>& material);
+    /*
+     * Read the property values of a material created from a library index
+     */
+    static void
+    loadMaterial(const std::shared_ptr<std::map<QString, std::shared_ptr<Material>>>& materialMap,
+                 const std::shared_ptr<Material>& material);
     static std::shared_ptr<MaterialEntry>
     getMaterialFromYAML(const std::shared_ptr<MaterialLibraryLocal>& library,
                         YAML::Node& yamlroot,
@@ -131,11 +141,15 @@ public:
 private:
     MaterialLoader();
 
+    static std::shared_ptr<Material> readMaterial(const std::shared_ptr<Material>& material);
     void addToTree(std::shared_ptr<MaterialEntry> model);
     void dereference(const std::shared_ptr<Material>& material);
     std::shared_ptr<MaterialEntry>
     getMaterialFromPath(const std::shared_ptr<MaterialLibraryLocal>& library, const QString& path) const;
     void addLibrary(const std::shared_ptr<MaterialLibraryLocal>& model);
+    void addIndexed(const std::shared_ptr<MaterialLibraryLocal>& library,
+                    const QFileInfo& file,
+                    const MaterialIndex& index);
     void loadLibrary(const std::shared_ptr<MaterialLibraryLocal>& library);
     void loadLibraries(
         const std::shared_ptr<std::list<std::shared_ptr<MaterialLibrary>>>& libraryList);
@@ -518,6 +518,19 @@ std::shared_ptr<Material> MaterialManager::getMaterial(const QString& uuid) cons
     return _localManager->getMaterial(uuid);
 }
 
+std::shared_ptr<Material> MaterialManager::getIndexedMaterial(const QString& uuid) const
+{
+#if defined(BUILD_MATERIAL_EXTERNAL)
+    if (_useExternal) {
+        auto material = _externalManager->getMaterial(uuid);
+        if (material) {
+            return material;
+        }
+    }
+#endif
+    return _localManager->getIndexedMaterial(uuid);
+}
+
 std::shared_ptr<Material> MaterialManager::getMaterial(const App::Material& material)
 {
     MaterialManager manager;
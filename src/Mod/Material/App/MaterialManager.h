@@ -116,6 +116,8 @@ public:
     // Material management
     std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> getLocalMaterials() const;
     std::shared_ptr<Material> getMaterial(const QString& uuid) const;
+    // Metadata and models only, the values of local materials may not have been read yet
+    std::shared_ptr<Material> getIndexedMaterial(const QString& uuid) const;
     static std::shared_ptr<Material> getMaterial(const App::Material& material);
     std::shared_ptr<Material> getMaterialByPath(const QString& path) const;
     std::shared_ptr<Material> getMaterialByPath(const QString& path, const QString& library) const;
@@ -21,6 +21,7 @@
  *                                                                         *
  **************************************************************************/
 
+#include <mutex>
 #include <random>
 
 #include <QDirIterator>
@@ -49,6 +50,7 @@ std::shared_ptr<std::list<std::shared_ptr<MaterialLibrary>>>
 std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> MaterialManagerLocal::_materialMap =
     nullptr;
 QMutex MaterialManagerLocal::_mutex;
+std::mutex MaterialManagerLocal::_snapshotMutex;
 
 TYPESYSTEM_SOURCE(Materials::MaterialManagerLocal, Base::BaseClass)
 
@@ -62,45 +64,93 @@ void MaterialManagerLocal::initLibraries()
 {
     QMutexLocker locker(&_mutex);
 
-    if (_materialMap == nullptr) {
-        // Load the models first
-        ModelManager::getManager();
+    if (materials() == nullptr) {
+        loadLibraries();
+    }
+}
 
-        _materialMap = std::make_shared<std::map<QString, std::shared_ptr<Material>>>();
+void MaterialManagerLocal::loadLibraries()
+{
+    // Load the models first
+    ModelManager::getManager();
 
-        if (_libraryList == nullptr) {
-            _libraryList = getConfiguredLibraries();
-        }
+    // The libraries are loaded into new containers, readers keep the current ones until
+    // they are published
+    auto materialMap = std::make_shared<std::map<QString, std::shared_ptr<Material>>>();
+    auto libraryList = getConfiguredLibraries();
 
-        // Load the libraries
-        MaterialLoader loader(_materialMap, _libraryList);
-    }
+    // Load the libraries
+    MaterialLoader loader(materialMap, libraryList);
+
+    publish(materialMap);
+    publish(libraryList);
 }
 
 void MaterialManagerLocal::cleanup()
 {
     QMutexLocker locker(&_mutex);
 
-    if (_libraryList) {
-        _libraryList->clear();
-        _libraryList = nullptr;
+    auto libraryList = libraries();
+    auto materialMap = materials();
+    publish(std::shared_ptr<std::map<QString, std::shared_ptr<Material>>>());
+    publish(std::shared_ptr<std::list<std::shared_ptr<MaterialLibrary>>>());
+
+    if (libraryList) {
+        libraryList->clear();
     }
 
-    if (_materialMap) {
-        for (auto& it : *_materialMap) {
+    if (materialMap) {
+        for (auto& it : *materialMap) {
             // This is needed to resolve cyclic dependencies
             it.second->setLibrary(nullptr);
         }
-        _materialMap->clear();
-        _materialMap = nullptr;
+        materialMap->clear();
     }
 }
 
 void MaterialManagerLocal::refresh()
 {
     // This is very expensive and can be improved using observers?
-    cleanup();
-    initLibraries();
+    QMutexLocker locker(&_mutex);
+
+    auto libraryList = libraries();
+    loadLibraries();
+
+    // Resolve the cyclic dependencies of the previous state. Its materials may still be in
+    // use by other threads so they keep their library
+    if (libraryList) {
+        for (auto& library : *libraryList) {
+            if (library->isLocal()) {
+                std::static_pointer_cast<MaterialLibraryLocal>(library)->clearMaterials();
+            }
+        }
+    }
+}
+
+std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> MaterialManagerLocal::materials()
+{
+    std::lock_guard<std::mutex> lock(_snapshotMutex);
+    return _materialMap;
+}
+
+std::shared_ptr<std::list<std::shared_ptr<MaterialLibrary>>> MaterialManagerLocal::libraries()
+{
+    std::lock_guard<std::mutex> lock(_snapshotMutex);
+    return _libraryList;
+}
+
+void MaterialManagerLocal::publish(
+    const std::shared_ptr<std::map<QString, std::shared_ptr<Material>>>& materialMap)
+{
+    std::lock_guard<std::mutex> lock(_snapshotMutex);
+    _materialMap = materialMap;
+}
+
+void MaterialManagerLocal::publish(
+    const std::shared_ptr<std::list<std::shared_ptr<MaterialLibrary>>>& libraryList)
+{
+    std::lock_guard<std::mutex> lock(_snapshotMutex);
+    _libraryList = libraryList;
 }
 
 //=====
@@ -111,24 +161,22 @@ void MaterialManagerLocal::refresh()
 
 std::shared_ptr<std::list<std::shared_ptr<MaterialLibrary>>> MaterialManagerLocal::getLibraries()
 {
-    if (_libraryList == nullptr) {
+    if (libraries() == nullptr) {
         initLibraries();
     }
-    return _libraryList;
+    return libraries();
 }
 
 std::shared_ptr<std::list<std::shared_ptr<MaterialLibrary>>>
 MaterialManagerLocal::getMaterialLibraries()
 {
-    if (_libraryList == nullptr) {
-        initLibraries();
-    }
-    return _libraryList;
+    return getLibraries();
 }
 
 std::shared_ptr<MaterialLibrary> MaterialManagerLocal::getLibrary(const QString& name) const
 {
-    for (auto& library : *_libraryList) {
+    auto libraryList = libraries();
+    for (auto& library : *libraryList) {
         if (library->isLocal() && library->isName(name)) {
             return library;
         }
@@ -151,14 +199,20 @@ void MaterialManagerLocal::createLibrary(const QString& libraryName,
 
     auto materialLibrary =
         std::make_shared<MaterialLibraryLocal>(libraryName, directory, iconPath, readOnly);
-    _libraryList->push_back(materialLibrary);
+
+    QMutexLocker locker(&_mutex);
+    auto libraryList =
+        std::make_shared<std::list<std::shared_ptr<MaterialLibrary>>>(*libraries());
+    libraryList->push_back(materialLibrary);
+    publish(libraryList);
 
     // This needs to be persisted somehow
 }
 
 void MaterialManagerLocal::renameLibrary(const QString& libraryName, const QString& newName)
 {
-    for (auto& library : *_libraryList) {
+    auto libraryList = libraries();
+    for (auto& library : *libraryList) {
         if (library->isLocal() && library->isName(libraryName)) {
             auto materialLibrary =
                 reinterpret_cast<const std::shared_ptr<Materials::MaterialLibraryLocal>&>(library);
@@ -172,7 +226,8 @@ void MaterialManagerLocal::renameLibrary(const QString& libraryName, const QStri
 
 void MaterialManagerLocal::changeIcon(const QString& libraryName, const QByteArray& icon)
 {
-    for (auto& library : *_libraryList) {
+    auto libraryList = libraries();
+    for (auto& library : *libraryList) {
         if (library->isLocal() && library->isName(libraryName)) {
             auto materialLibrary =
                 reinterpret_cast<const std::shared_ptr<Materials::MaterialLibraryLocal>&>(library);
@@ -186,9 +241,13 @@ void MaterialManagerLocal::changeIcon(const QString& libraryName, const QByteArr
 
 void MaterialManagerLocal::removeLibrary(const QString& libraryName)
 {
-    for (auto& library : *_libraryList) {
+    QMutexLocker locker(&_mutex);
+    auto libraryList =
+        std::make_shared<std::list<std::shared_ptr<MaterialLibrary>>>(*libraries());
+    for (auto& library : *libraryList) {
         if (library->isLocal() && library->isName(libraryName)) {
-            _libraryList->remove(library);
+            libraryList->remove(library);
+            publish(libraryList);
 
             // At this point we should rebuild the material map
             return;
@@ -203,7 +262,8 @@ MaterialManagerLocal::libraryMaterials(const QString& libraryName)
 {
     auto materials = std::make_shared<std::vector<LibraryObject>>();
 
-    for (auto& it : *_materialMap) {
+    auto materialMap = MaterialManagerLocal::materials();
+    for (auto& it : *materialMap) {
         // This is needed to resolve cyclic dependencies
         auto library = it.second->getLibrary();
         if (library->isName(libraryName)) {
@@ -235,7 +295,8 @@ MaterialManagerLocal::libraryMaterials(const QString& libraryName,
 {
     auto materials = std::make_shared<std::vector<LibraryObject>>();
 
-    for (auto& it : *_materialMap) {
+    auto materialMap = MaterialManagerLocal::materials();
+    for (auto& it : *materialMap) {
         // This is needed to resolve cyclic dependencies
         auto library = it.second->getLibrary();
         if (library->isName(libraryName)) {
@@ -292,30 +353,52 @@ void MaterialManagerLocal::deleteRecursive(const std::shared_ptr<MaterialLibrary
 std::shared_ptr<std::map<QString, std::shared_ptr<Material>>>
 MaterialManagerLocal::getLocalMaterials() const
 {
-    return _materialMap;
+    auto materialMap = materials();
+    for (auto& it : *materialMap) {
+        load(it.second);
+    }
+    return materialMap;
 }
 
 std::shared_ptr<Material> MaterialManagerLocal::getMaterial(const QString& uuid) const
+{
+    auto material = getIndexedMaterial(uuid);
+    load(material);
+    return material;
+}
+
+std::shared_ptr<Material> MaterialManagerLocal::getIndexedMaterial(const QString& uuid) const
 {
     try {
-        return _materialMap->at(uuid);
+        return materials()->at(uuid);
     }
     catch (std::out_of_range&) {
         throw MaterialNotFound();
     }
 }
 
+void MaterialManagerLocal::load(const std::shared_ptr<Material>& material) const
+{
+    if (!material->isLoaded()) {
+        QMutexLocker locker(&_mutex);
+        MaterialLoader::loadMaterial(materials(), material);
+    }
+}
+
 std::shared_ptr<Material> MaterialManagerLocal::getMaterialByPath(const QString& path) const
 {
     QString cleanPath = QDir::cleanPath(path);
 
-    for (auto& library : *_libraryList) {
+    auto libraryList = libraries();
+    for (auto& library : *libraryList) {
         if (library->isLocal()) {
             auto materialLibrary =
                 reinterpret_cast<const std::shared_ptr<Materials::MaterialLibraryLocal>&>(library);
             if (cleanPath.startsWith(materialLibrary->getDirectory())) {
                 try {
-                    return materialLibrary->getMaterialByPath(cleanPath);
+                    auto material = materialLibrary->getMaterialByPath(cleanPath);
+                    load(material);
+                    return material;
                 }
                 catch (const MaterialNotFound&) {
                 }
@@ -328,8 +411,12 @@ std::shared_ptr<Material> MaterialManagerLocal::getMaterialByPath(const QString&
                         auto material =
                             MaterialConfigLoader::getMaterialFromPath(materialLibrary, path);
                         if (material) {
-                            (*_materialMap)[material->getUUID()] =
+                            auto materialMap =
+                                std::make_shared<std::map<QString, std::shared_ptr<Material>>>(
+                                    *materials());
+                            (*materialMap)[material->getUUID()] =
                                 materialLibrary->addMaterial(material, path);
+                            publish(materialMap);
                         }
 
                         return material;
@@ -360,7 +447,9 @@ std::shared_ptr<Material> MaterialManagerLocal::getMaterialByPath(const QString&
     if (library->isLocal()) {
         auto materialLibrary =
             reinterpret_cast<const std::shared_ptr<Materials::MaterialLibraryLocal>&>(library);
-        return materialLibrary->getMaterialByPath(path);  // May throw MaterialNotFound
+        auto material = materialLibrary->getMaterialByPath(path);  // May throw MaterialNotFound
+        load(material);
+        return material;
     }
 
     throw LibraryNotFound();
@@ -369,7 +458,7 @@ std::shared_ptr<Material> MaterialManagerLocal::getMaterialByPath(const QString&
 bool MaterialManagerLocal::exists(const QString& uuid) const
 {
     try {
-        auto material = getMaterial(uuid);
+        auto material = getIndexedMaterial(uuid);
         if (material) {
             return true;
         }
@@ -384,7 +473,7 @@ bool MaterialManagerLocal::exists(const MaterialLibrary& library,
                                   const QString& uuid) const
 {
     try {
-        auto material = getMaterial(uuid);
+        auto material = getIndexedMaterial(uuid);
         if (material && material->getLibrary()->isLocal()) {
             auto materialLibrary =
                 reinterpret_cast<const std::shared_ptr<Materials::MaterialLibraryLocal>&>(
@@ -400,7 +489,11 @@ bool MaterialManagerLocal::exists(const MaterialLibrary& library,
 
 void MaterialManagerLocal::remove(const QString& uuid)
 {
-    _materialMap->erase(uuid);
+    QMutexLocker locker(&_mutex);
+    auto materialMap =
+        std::make_shared<std::map<QString, std::shared_ptr<Material>>>(*materials());
+    materialMap->erase(uuid);
+    publish(materialMap);
 }
 
 void MaterialManagerLocal::saveMaterial(const std::shared_ptr<MaterialLibraryLocal>& library,
@@ -413,7 +506,12 @@ void MaterialManagerLocal::saveMaterial(const std::shared_ptr<MaterialLibraryLoc
     if (library->isLocal()) {
         auto newMaterial =
             library->saveMaterial(material, path, overwrite, saveAsCopy, saveInherited);
-        (*_materialMap)[newMaterial->getUUID()] = newMaterial;
+
+        QMutexLocker locker(&_mutex);
+        auto materialMap =
+            std::make_shared<std::map<QString, std::shared_ptr<Material>>>(*materials());
+        (*materialMap)[newMaterial->getUUID()] = newMaterial;
+        publish(materialMap);
     }
 }
 
@@ -447,11 +545,13 @@ MaterialManagerLocal::materialsWithModel(const QString& uuid) const
     std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> dict =
         std::make_shared<std::map<QString, std::shared_ptr<Material>>>();
 
-    for (auto& it : *_materialMap) {
+    auto materialMap = materials();
+    for (auto& it : *materialMap) {
         QString key = it.first;
         auto material = it.second;
 
         if (material->hasModel(uuid)) {
+            load(material);
             (*dict)[key] = material;
         }
     }
@@ -465,11 +565,13 @@ MaterialManagerLocal::materialsWithModelComplete(const QString& uuid) const
     std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> dict =
         std::make_shared<std::map<QString, std::shared_ptr<Material>>>();
 
-    for (auto& it : *_materialMap) {
+    auto materialMap = materials();
+    for (auto& it : *materialMap) {
         QString key = it.first;
         auto material = it.second;
 
         if (material->isModelComplete(uuid)) {
+            load(material);
             (*dict)[key] = material;
         }
     }
@@ -479,22 +581,24 @@ MaterialManagerLocal::materialsWithModelComplete(const QString& uuid) const
 
 void MaterialManagerLocal::dereference() const
 {
+    auto materialMap = materials();
+
     // First clear the inheritences
-    for (auto& it : *_materialMap) {
+    for (auto& it : *materialMap) {
         auto material = it.second;
         material->clearDereferenced();
         material->clearInherited();
     }
 
     // Run the dereference again
-    for (auto& it : *_materialMap) {
+    for (auto& it : *materialMap) {
         dereference(it.second);
     }
 }
 
 void MaterialManagerLocal::dereference(std::shared_ptr<Material> material) const
 {
-    MaterialLoader::dereference(_materialMap, material);
+    MaterialLoader::dereference(materials(), material);
 }
 
 std::shared_ptr<std::list<std::shared_ptr<MaterialLibrary>>>
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 
 #include <filesystem>
 
@@ -91,6 +92,8 @@ public:
     // Material management
     std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> getLocalMaterials() const;
     std::shared_ptr<Material> getMaterial(const QString& uuid) const;
+    // Unlike getMaterial(), this doesn't read the values of a material created from the index
+    std::shared_ptr<Material> getIndexedMaterial(const QString& uuid) const;
     std::shared_ptr<Material> getMaterialByPath(const QString& path) const;
     std::shared_ptr<Material> getMaterialByPath(const QString& path, const QString& library) const;
     bool exists(const QString& uuid) const;
@@ -121,11 +124,22 @@ protected:
                     const Materials::MaterialFilterOptions& options) const;
 
 private:
+    // The library list and the material map are immutable once published. Readers take a
+    // snapshot, writers publish a modified copy while holding _mutex
     static std::shared_ptr<std::list<std::shared_ptr<MaterialLibrary>>> _libraryList;
     static std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> _materialMap;
     static QMutex _mutex;
+    static std::mutex _snapshotMutex;  // Guards only the copy of the two pointers
 
     static void initLibraries();
+    static void loadLibraries();
+    static std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> materials();
+    static std::shared_ptr<std::list<std::shared_ptr<MaterialLibrary>>> libraries();
+    static void
+    publish(const std::shared_ptr<std::map<QString, std::shared_ptr<Material>>>& materialMap);
+    static void
+    publish(const std::shared_ptr<std::list<std::shared_ptr<MaterialLibrary>>>& libraryList);
+    void load(const std::shared_ptr<Material>& material) const;
 };
 
 }  // namespace Materials
\ No newline at end of file
@@ -491,6 +491,7 @@ TYPESYSTEM_SOURCE(Materials::Material, Base::BaseClass)
 Material::Material()
     : _dereferenced(false)
     , _oldFormat(false)
+    , _loaded(true)
     , _editState(ModelEdit_None)
 {
     // Create an initial UUID
@@ -506,6 +507,7 @@ Material::Material(const std::shared_ptr<MaterialLibrary>& library,
     , _name(name)
     , _dereferenced(false)
     , _oldFormat(false)
+    , _loaded(true)
     , _editState(ModelEdit_None)
 {
     setDirectory(directory);
@@ -525,6 +527,9 @@ Material::Material(const Material& other)
     , _reference(other._reference)
     , _dereferenced(other._dereferenced)
     , _oldFormat(other._oldFormat)
+    , _loaded(other._loaded.load())
+    , _indexedValues(other._indexedValues)
+    , _inheritedValues(other._inheritedValues)
     , _editState(other._editState)
 {
     for (auto& it : other._tags) {
@@ -630,6 +635,7 @@ void Material::clearModels()
 void Material::clearInherited()
 {
     _allUuids.clear();
+    _inheritedValues.clear();
 
     // Rebuild the UUID lists without the inherited UUIDs
     for (auto& uuid : _physicalUuids) {
@@ -1282,7 +1288,7 @@ bool Material::isPhysicalModelComplete(const QString& uuid) const
             QString propertyName = it.first;
             auto property = getPhysicalProperty(propertyName);
 
-            if (property->isNull()) {
+            if (!hasValue(propertyName, *property)) {
                 return false;
             }
         }
@@ -1308,7 +1314,7 @@ bool Material::isAppearanceModelComplete(const QString& uuid) const
             QString propertyName = it.first;
             auto property = getAppearanceProperty(propertyName);
 
-            if (property->isNull()) {
+            if (!hasValue(propertyName, *property)) {
                 return false;
             }
         }
@@ -1320,6 +1326,39 @@ bool Material::isAppearanceModelComplete(const QString& uuid) const
     return true;
 }
 
+bool Material::hasValue(const QString& name, const MaterialProperty& property) const
+{
+    if (!property.isNull()) {
+        return true;
+    }
+    return !_loaded && (_indexedValues.contains(name) || _inheritedValues.contains(name));
+}
+
+void Material::inheritIndexedValues(const Material& parent)
+{
+    _inheritedValues.unite(parent.getValuedPropertyNames());
+}
+
+QSet<QString> Material::getValuedPropertyNames() const
+{
+    if (!_loaded) {
+        return _indexedValues + _inheritedValues;
+    }
+
+    QSet<QString> names;
+    for (auto& it : _physical) {
+        if (!it.second->isNull()) {
+            names.insert(it.first);
+        }
+    }
+    for (auto& it : _appearance) {
+        if (!it.second->isNull()) {
+            names.insert(it.first);
+        }
+    }
+    return names;
+}
+
 void Material::saveGeneral(QTextStream& stream) const
 {
     stream << "General:\n";
@@ -1601,6 +1640,8 @@ Material& Material::operator=(const Material& other)
     _reference = other._reference;
     _dereferenced = other._dereferenced;
     _oldFormat = other._oldFormat;
+    _indexedValues = other._indexedValues;
+    _inheritedValues = other._inheritedValues;
     _editState = other._editState;
 
     _tags.clear();
@@ -1636,6 +1677,9 @@ Material& Material::operator=(const Material& other)
         _legacy[it.first] = it.second;
     }
 
+    // Last, so a material read on demand is complete once it is seen as loaded
+    _loaded = other._loaded.load();
+
     return *this;
 }
 
@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 
 #include <QDir>
@@ -399,6 +400,29 @@ public:
         _oldFormat = isOld;
     }
 
+    /*
+     * Materials created from a library index only have their metadata and models. The
+     * property values are read from the file when the material is first requested, until
+     * then the completeness tests use the names of the properties that have a value.
+     */
+    bool isLoaded() const
+    {
+        return _loaded;
+    }
+    void setLoaded(bool loaded)
+    {
+        _loaded = loaded;
+    }
+    void setIndexedValues(const QSet<QString>& names)
+    {
+        _indexedValues = names;
+    }
+    void inheritIndexedValues(const Material& parent);
+    /*
+     * Return the names of the properties that have a value
+     */
+    QSet<QString> getValuedPropertyNames() const;
+
     /*
      * Normalize models by removing any inherited models
      */
@@ -463,6 +487,7 @@ protected:
     void saveInherits(QTextStream& stream) const;
     void saveModels(QTextStream& stream, bool saveInherited) const;
     void saveAppearanceModels(QTextStream& stream, bool saveInherited) const;
+    bool hasValue(const QString& name, const MaterialProperty& property) const;
 
 private:
     std::shared_ptr<MaterialLibrary> _library;
@@ -485,6 +510,9 @@ private:
     std::map<QString, QString> _legacy;
     bool _dereferenced;
     bool _oldFormat;
+    std::atomic<bool> _loaded;
+    QSet<QString> _indexedValues;
+    QSet<QString> _inheritedValues;  // Indexed values of the parent materials
     ModelEdit _editState;
 };
 
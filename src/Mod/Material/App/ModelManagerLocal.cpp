@@ -21,6 +21,8 @@
  *                                                                         *
  **************************************************************************/
 
+#include <mutex>
+
 #include <QDirIterator>
 #include <QMutexLocker>
 
@@ -35,6 +37,7 @@ using namespace Materials;
 std::shared_ptr<std::list<std::shared_ptr<ModelLibraryLocal>>> ModelManagerLocal::_libraryList = nullptr;
 std::shared_ptr<std::map<QString, std::shared_ptr<Model>>> ModelManagerLocal::_modelMap = nullptr;
 QMutex ModelManagerLocal::_mutex;
+std::mutex ModelManagerLocal::_snapshotMutex;
 
 
 TYPESYSTEM_SOURCE(Materials::ModelManagerLocal, Base::BaseClass)
@@ -48,17 +51,44 @@ void ModelManagerLocal::initLibraries()
 {
     QMutexLocker locker(&_mutex);
 
-    if (_modelMap == nullptr) {
-        _modelMap = std::make_shared<std::map<QString, std::shared_ptr<Model>>>();
-        if (_libraryList == nullptr) {
-            _libraryList = std::make_shared<std::list<std::shared_ptr<ModelLibraryLocal>>>();
-        }
-
-        // Load the libraries
-        ModelLoader loader(_modelMap, _libraryList);
+    if (models() == nullptr) {
+        loadLibraries();
     }
 }
 
+void ModelManagerLocal::loadLibraries()
+{
+    // Readers keep the current containers until the new ones are published
+    auto modelMap = std::make_shared<std::map<QString, std::shared_ptr<Model>>>();
+    auto libraryList = std::make_shared<std::list<std::shared_ptr<ModelLibraryLocal>>>();
+
+    // Load the libraries
+    ModelLoader loader(modelMap, libraryList);
+
+    std::lock_guard<std::mutex> lock(_snapshotMutex);
+    _modelMap = modelMap;
+    _libraryList = libraryList;
+}
+
+std::shared_ptr<std::map<QString, std::shared_ptr<Model>>> ModelManagerLocal::models()
+{
+    std::lock_guard<std::mutex> lock(_snapshotMutex);
+    return _modelMap;
+}
+
+std::shared_ptr<std::list<std::shared_ptr<ModelLibraryLocal>>> ModelManagerLocal::libraries()
+{
+    std::lock_guard<std::mutex> lock(_snapshotMutex);
+    return _libraryList;
+}
+
+void ModelManagerLocal::publish(
+    const std::shared_ptr<std::list<std::shared_ptr<ModelLibraryLocal>>>& libraryList)
+{
+    std::lock_guard<std::mutex> lock(_snapshotMutex);
+    _libraryList = libraryList;
+}
+
 bool ModelManagerLocal::isModel(const QString& file)
 {
     // if (!fs::is_regular_file(p))
@@ -72,32 +102,34 @@ bool ModelManagerLocal::isModel(const QString& file)
 
 void ModelManagerLocal::cleanup()
 {
-    if (_libraryList) {
-        _libraryList->clear();
+    QMutexLocker locker(&_mutex);
+
+    auto libraryList = libraries();
+    if (libraryList) {
+        libraryList->clear();
     }
 
-    if (_modelMap) {
-        for (auto& it : *_modelMap) {
+    auto modelMap = models();
+    if (modelMap) {
+        for (auto& it : *modelMap) {
             // This is needed to resolve cyclic dependencies
             it.second->setLibrary(nullptr);
         }
-        _modelMap->clear();
+        modelMap->clear();
     }
 }
 
 void ModelManagerLocal::refresh()
 {
-    _modelMap->clear();
-    _libraryList->clear();
-
-    // Load the libraries
-    ModelLoader loader(_modelMap, _libraryList);
+    QMutexLocker locker(&_mutex);
+    loadLibraries();
 }
 
 std::shared_ptr<std::list<std::shared_ptr<ModelLibrary>>> ModelManagerLocal::getLibraries()
 {
+    auto libraryList = libraries();
     return reinterpret_cast<std::shared_ptr<std::list<std::shared_ptr<ModelLibrary>>>&>(
-        _libraryList);
+        libraryList);
 }
 
 void ModelManagerLocal::createLibrary(const QString& libraryName,
@@ -113,12 +145,18 @@ void ModelManagerLocal::createLibrary(const QString& libraryName,
     }
 
     auto modelLibrary = std::make_shared<ModelLibraryLocal>(libraryName, directory, icon, readOnly);
-    _libraryList->push_back(modelLibrary);
+
+    QMutexLocker locker(&_mutex);
+    auto libraryList =
+        std::make_shared<std::list<std::shared_ptr<ModelLibraryLocal>>>(*libraries());
+    libraryList->push_back(modelLibrary);
+    publish(libraryList);
 }
 
 void ModelManagerLocal::renameLibrary(const QString& libraryName, const QString& newName)
 {
-    for (auto& library : *_libraryList) {
+    auto libraryList = libraries();
+    for (auto& library : *libraryList) {
         if (library->isName(libraryName)) {
             library->setName(newName);
             return;
@@ -130,7 +168,8 @@ void ModelManagerLocal::renameLibrary(const QString& libraryName, const QString&
 
 void ModelManagerLocal::changeIcon(const QString& libraryName, const QString& icon)
 {
-    for (auto& library : *_libraryList) {
+    auto libraryList = libraries();
+    for (auto& library : *libraryList) {
         if (library->isName(libraryName)) {
             library->setIcon(icon);
             return;
@@ -142,9 +181,13 @@ void ModelManagerLocal::changeIcon(const QString& libraryName, const QString& ic
 
 void ModelManagerLocal::removeLibrary(const QString& libraryName)
 {
-    for (auto& library : *_libraryList) {
+    QMutexLocker locker(&_mutex);
+    auto libraryList =
+        std::make_shared<std::list<std::shared_ptr<ModelLibraryLocal>>>(*libraries());
+    for (auto& library : *libraryList) {
         if (library->isName(libraryName)) {
-            _libraryList->remove(library);
+            libraryList->remove(library);
+            publish(libraryList);
 
             // At this point we should rebuild the model map
             return;
@@ -159,7 +202,8 @@ ModelManagerLocal::libraryModels(const QString& libraryName)
 {
     auto models = std::make_shared<std::vector<LibraryObject>>();
 
-    for (auto& it : *_modelMap) {
+    auto modelMap = ModelManagerLocal::models();
+    for (auto& it : *modelMap) {
         // This is needed to resolve cyclic dependencies
         if (it.second->getLibrary()->isName(libraryName)) {
             models->push_back(
@@ -173,11 +217,12 @@ ModelManagerLocal::libraryModels(const QString& libraryName)
 std::shared_ptr<Model> ModelManagerLocal::getModel(const QString& uuid) const
 {
     try {
-        if (_modelMap == nullptr) {
+        auto modelMap = models();
+        if (modelMap == nullptr) {
             throw Uninitialized();
         }
 
-        return _modelMap->at(uuid);
+        return modelMap->at(uuid);
     }
     catch (std::out_of_range const&) {
         throw ModelNotFound();
@@ -188,7 +233,8 @@ std::shared_ptr<Model> ModelManagerLocal::getModelByPath(const QString& path) co
 {
     QString cleanPath = QDir::cleanPath(path);
 
-    for (auto& library : *_libraryList) {
+    auto libraryList = libraries();
+    for (auto& library : *libraryList) {
         if (library->isLocal()) {
             auto localLibrary = std::static_pointer_cast<Materials::ModelLibraryLocal> (library);
             if (cleanPath.startsWith(localLibrary->getDirectory())) {
@@ -214,7 +260,8 @@ std::shared_ptr<Model> ModelManagerLocal::getModelByPath(const QString& path,
 
 std::shared_ptr<ModelLibrary> ModelManagerLocal::getLibrary(const QString& name) const
 {
-    for (auto& library : *_libraryList) {
+    auto libraryList = libraries();
+    for (auto& library : *libraryList) {
         if (library->isName(name)) {
             return library;
         }
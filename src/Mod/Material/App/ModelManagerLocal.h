@@ -24,6 +24,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 
 #include <Mod/Material/MaterialGlobal.h>
 
@@ -61,7 +62,7 @@ public:
 
     std::shared_ptr<std::map<QString, std::shared_ptr<Model>>> getModels()
     {
-        return _modelMap;
+        return models();
     }
     std::shared_ptr<std::map<QString, std::shared_ptr<ModelTreeNode>>>
     getModelTree(std::shared_ptr<ModelLibrary> library, ModelFilter filter = ModelFilter_None) const
@@ -77,10 +78,18 @@ public:
 
 private:
     static void initLibraries();
-
+    static void loadLibraries();
+    static std::shared_ptr<std::map<QString, std::shared_ptr<Model>>> models();
+    static std::shared_ptr<std::list<std::shared_ptr<ModelLibraryLocal>>> libraries();
+    static void
+    publish(const std::shared_ptr<std::list<std::shared_ptr<ModelLibraryLocal>>>& libraryList);
+
+    // The library list and the model map are immutable once published. Readers take a
+    // snapshot, writers publish a modified copy while holding _mutex
     static std::shared_ptr<std::list<std::shared_ptr<ModelLibraryLocal>>> _libraryList;
     static std::shared_ptr<std::map<QString, std::shared_ptr<Model>>> _modelMap;
     static QMutex _mutex;
+    static std::mutex _snapshotMutex;  // Guards only the copy of the two pointers
 };
 
 }  // namespace Materials
\ No newline at end of file
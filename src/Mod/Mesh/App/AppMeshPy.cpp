@@ -30,6 +30,7 @@
 #include <App/Application.h>
 #include <App/Document.h>
 #include <App/DocumentObjectPy.h>
+#include <Base/Converter.h>
 #include <Base/GeometryPyCXX.h>
 #include <Base/Interpreter.h>
 #include <Base/PlacementPy.h>
@@ -38,6 +39,7 @@
 #include "Core/Approximation.h"
 #include "Core/Evaluation.h"
 #include "Core/Iterator.h"
+#include "Core/KDTree.h"
 #include "Core/MeshIO.h"
 #include "Core/MeshKernel.h"
 #include "WildMagic4/Wm4ContBox3.h"
@@ -119,6 +121,23 @@ public:
             "tuple of seven items:\n"
             "    center, u, v, w directions and the lengths of the three vectors.\n"
         );
+        add_varargs_method(
+            "nearestNeighbours",
+            &Module::nearestNeighbours,
+            "nearestNeighbours(seq(Base.Vector), seq(Base.Vector), [k=1])\n"
+            "Finds for each query point of the second list the k nearest points of the\n"
+            "first list. The return value is a tuple of three lists (offsets, indices,\n"
+            "distances) where the neighbours of the i-th query point are the items from\n"
+            "offsets[i] to offsets[i+1]-1 of indices and distances, sorted by distance.\n"
+        );
+        add_varargs_method(
+            "neighboursInRadius",
+            &Module::neighboursInRadius,
+            "neighboursInRadius(seq(Base.Vector), seq(Base.Vector), float)\n"
+            "Finds for each query point of the second list all points of the first list\n"
+            "within the given radius. The result has the same layout as for\n"
+            "nearestNeighbours().\n"
+        );
         initialize(
             "The functions in this module allow working with mesh objects.\n"
             "A set of functions are provided for reading in registered mesh\n"
@@ -156,7 +175,10 @@ private:
         PyMem_Free(Name);
 
         std::unique_ptr<MeshObject> mesh(new MeshObject);
-        mesh->load(EncodedName.c_str());
+        {
+            Base::PyGILStateRelease unlock;
+            mesh->load(EncodedName.c_str());
+        }
         return Py::asObject(new MeshPy(mesh.release()));
     }
     Py::Object open(const Py::Tuple& args)
@@ -630,6 +652,90 @@ private:
 
         return result;  // NOLINT
     }
+    Py::Object nearestNeighbours(const Py::Tuple& args)
+    {
+        PyObject* input {};
+        PyObject* query {};
+        int k = 1;
+
+        if (!PyArg_ParseTuple(args.ptr(), "OO|i", &input, &query, &k)) {
+            throw Py::Exception();
+        }
+
+        if (k < 0) {
+            throw Py::ValueError("Number of neighbours must not be negative");
+        }
+
+        MeshCore::MeshKDTree tree(getPoints(input));
+        std::vector<std::size_t> offsets;
+        std::vector<MeshCore::PointIndex> indices;
+        std::vector<float> distances;
+        tree.FindKNearest(getPoints(query), std::size_t(k), offsets, indices, distances);
+        return makeNeighbours(offsets, indices, distances);
+    }
+    Py::Object neighboursInRadius(const Py::Tuple& args)
+    {
+        PyObject* input {};
+        PyObject* query {};
+        double radius {};
+
+        if (!PyArg_ParseTuple(args.ptr(), "OOd", &input, &query, &radius)) {
+            throw Py::Exception();
+        }
+
+        MeshCore::MeshKDTree tree(getPoints(input));
+        std::vector<std::size_t> offsets;
+        std::vector<MeshCore::PointIndex> indices;
+        std::vector<float> distances;
+        tree.FindInRadius(getPoints(query), float(radius), offsets, indices, distances);
+        return makeNeighbours(offsets, indices, distances);
+    }
+
+private:
+    static std::vector<Base::Vector3f> getPoints(PyObject* input)
+    {
+        if (!PySequence_Check(input)) {
+            throw Py::TypeError("Input has to be a sequence of Base.Vector()");
+        }
+
+        Py::Sequence list(input);
+        std::vector<Base::Vector3f> points;
+        points.reserve(list.size());
+        for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
+            PyObject* value = (*it).ptr();
+            if (!PyObject_TypeCheck(value, &(Base::VectorPy::Type))) {
+                throw Py::TypeError("Input has to be a sequence of Base.Vector()");
+            }
+            Base::VectorPy* pcObject = static_cast<Base::VectorPy*>(value);
+            points.push_back(Base::toVector<float>(*pcObject->getVectorPtr()));
+        }
+
+        return points;
+    }
+    static Py::Tuple makeNeighbours(
+        const std::vector<std::size_t>& offsets,
+        const std::vector<MeshCore::PointIndex>& indices,
+        const std::vector<float>& distances
+    )
+    {
+        Py::List off(offsets.size());
+        for (std::size_t i = 0; i < offsets.size(); i++) {
+            off.setItem(i, Py::Long(static_cast<unsigned long>(offsets[i])));
+        }
+
+        Py::List ind(indices.size());
+        Py::List dist(distances.size());
+        for (std::size_t i = 0; i < indices.size(); i++) {
+            ind.setItem(i, Py::Long(static_cast<unsigned long>(indices[i])));
+            dist.setItem(i, Py::Float(distances[i]));
+        }
+
+        Py::Tuple result(3);
+        result.setItem(0, off);
+        result.setItem(1, ind);
+        result.setItem(2, dist);
+        return result;
+    }
 };
 
 PyObject* initModule()
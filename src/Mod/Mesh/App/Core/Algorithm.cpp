@@ -25,19 +25,50 @@
 
 #include <algorithm>
 #include <limits>
+#include <numeric>
+
+#include <QtConcurrentMap>
 
 #include <Base/Console.h>
 #include <Base/Sequencer.h>
 
 #include "Algorithm.h"
 #include "Approximation.h"
+#include "BVH.h"
 #include "Elements.h"
 #include "Grid.h"
 #include "Iterator.h"
+#include "Neighbourhood.h"
 #include "Triangulation.h"
 
 
 using namespace MeshCore;
+
+namespace
+{
+// Projects every point once and returns a mask of the points whose projection fulfills pred.
+// Facets share their points, so this avoids projecting each point about six times.
+template<class Predicate>
+std::vector<char> MarkProjectedPoints(
+    const MeshPointArray& points,
+    const Base::ViewProjMatrix& proj,
+    Predicate pred
+)
+{
+    const std::size_t chunkSize = 65536;
+    std::vector<char> mask(points.size());
+    std::vector<std::size_t> chunks((points.size() + chunkSize - 1) / chunkSize);
+    std::iota(chunks.begin(), chunks.end(), 0);
+    QtConcurrent::blockingMap(chunks, [&](std::size_t& chunk) {
+        std::size_t end = std::min(points.size(), (chunk + 1) * chunkSize);
+        for (std::size_t i = chunk * chunkSize; i < end; i++) {
+            Base::Vector3f pt2d = proj(points[i]);
+            mask[i] = pred(Base::Vector2d(pt2d.x, pt2d.y)) ? 1 : 0;
+        }
+    });
+    return mask;
+}
+}  // namespace
 using Base::BoundBox2d;
 using Base::BoundBox3f;
 using Base::Polygon2d;
@@ -150,6 +181,18 @@ bool MeshAlgorithm::NearestFacetOnRay(
     return false;
 }
 
+bool MeshAlgorithm::NearestFacetOnRay(
+    const Base::Vector3f& rclPt,
+    const Base::Vector3f& rclDir,
+    float fMaxAngle,
+    const MeshFacetBVH& rclBVH,
+    Base::Vector3f& rclRes,
+    FacetIndex& rulFacet
+) const
+{
+    return rclBVH.NearestFacetOnRay(rclPt, rclDir, fMaxAngle, rclRes, rulFacet);
+}
+
 bool MeshAlgorithm::NearestFacetOnRay(
     const Base::Vector3f& rclPt,
     const Base::Vector3f& rclDir,
@@ -1217,7 +1260,6 @@ void MeshAlgorithm::CheckFacets(
 ) const
 {
     std::vector<FacetIndex>::iterator it;
-    MeshFacetIterator clIter(_rclMesh, 0);
     Base::Vector3f clPt2d;
     Base::Vector3f clGravityOfFacet;
     bool bNoPointInside {};
@@ -1281,15 +1323,21 @@ void MeshAlgorithm::CheckFacets(
     }
     // When cutting triangles outside then go through all elements
     else {
-        Base::SequencerLauncher seq("Check facets", _rclMesh.CountFacets());
-        for (clIter.Init(); clIter.More(); clIter.Next()) {
-            for (const auto& pnt : clIter->_aclPoints) {
-                clPt2d = fixedProj(pnt);
-                if ((clPolyBBox.Contains(Base::Vector2d(clPt2d.x, clPt2d.y))
-                     && !rclPoly.Contains(Base::Vector2d(clPt2d.x, clPt2d.y)))) {
-                    raulFacets.push_back(clIter.Position());
-                    break;
-                }
+        std::vector<char> outside = MarkProjectedPoints(
+            _rclMesh.GetPoints(),
+            fixedProj,
+            [&](const Base::Vector2d& pt2d) {
+                return clPolyBBox.Contains(pt2d) && !rclPoly.Contains(pt2d);
+            }
+        );
+
+        const MeshFacetArray& rFacets = _rclMesh.GetFacets();
+        Base::SequencerLauncher seq("Check facets", rFacets.size());
+        FacetIndex index = 0;
+        for (auto jt = rFacets.begin(); jt != rFacets.end(); ++jt, ++index) {
+            if (outside[jt->_aulPoints[0]] || outside[jt->_aulPoints[1]]
+                || outside[jt->_aulPoints[2]]) {
+                raulFacets.push_back(index);
             }
             seq.next();
         }
@@ -1303,26 +1351,22 @@ void MeshAlgorithm::CheckFacets(
     std::vector<FacetIndex>& raulFacets
 ) const
 {
-    const MeshPointArray& p = _rclMesh.GetPoints();
     const MeshFacetArray& f = _rclMesh.GetFacets();
-    Base::Vector3f pt2d;
     // Use a bounding box to reduce number of call to Polygon::Contains
     Base::BoundBox2d bb = rclPoly.CalcBoundBox();
     // Precompute the screen projection matrix as Coin's projection function is expensive
     Base::ViewProjMatrix fixedProj(pclProj->getComposedProjectionMatrix());
 
+    std::vector<char> mask
+        = MarkProjectedPoints(_rclMesh.GetPoints(), fixedProj, [&](const Base::Vector2d& pt2d) {
+              // First check whether the point is in the bounding box of the polygon
+              return (bb.Contains(pt2d) && rclPoly.Contains(pt2d)) ^ !bInner;
+          });
+
     FacetIndex index = 0;
     for (auto it = f.begin(); it != f.end(); ++it, ++index) {
-        for (PointIndex ptIndex : it->_aulPoints) {
-            pt2d = fixedProj(p[ptIndex]);
-
-            // First check whether the point is in the bounding box of the polygon
-            if ((bb.Contains(Base::Vector2d(pt2d.x, pt2d.y))
-                 && rclPoly.Contains(Base::Vector2d(pt2d.x, pt2d.y)))
-                ^ !bInner) {
-                raulFacets.push_back(index);
-                break;
-            }
+        if (mask[it->_aulPoints[0]] || mask[it->_aulPoints[1]] || mask[it->_aulPoints[2]]) {
+            raulFacets.push_back(index);
         }
     }
 }
@@ -2213,22 +2257,33 @@ void MeshRefNormalToPoints::Rebuild()
     _norm.resize(rPoints.size());
 
     const MeshFacetArray& rFacets = _rclMesh.GetFacets();
-    for (const auto& rFacet : rFacets) {
-        const MeshPoint& p0 = rPoints[rFacet._aulPoints[0]];
-        const MeshPoint& p1 = rPoints[rFacet._aulPoints[1]];
-        const MeshPoint& p2 = rPoints[rFacet._aulPoints[2]];
-        float l2p01 = Base::DistanceP2(p0, p1);
-        float l2p12 = Base::DistanceP2(p1, p2);
-        float l2p20 = Base::DistanceP2(p2, p0);
-
-        Base::Vector3f facenormal = _rclMesh.GetFacet(rFacet).GetNormal();
-        _norm[rFacet._aulPoints[0]] += facenormal * (1.0F / (l2p01 * l2p20));
-        _norm[rFacet._aulPoints[1]] += facenormal * (1.0F / (l2p12 * l2p01));
-        _norm[rFacet._aulPoints[2]] += facenormal * (1.0F / (l2p20 * l2p12));
-    }
-    for (auto& it : _norm) {
-        it.Normalize();
-    }
+    const std::size_t chunkSize = 65536;
+    std::vector<Base::Vector3f> facenormals(rFacets.size());
+    ParallelChunks(rFacets.size(), chunkSize, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            facenormals[i] = _rclMesh.GetFacet(rFacets[i]).GetNormal();
+        }
+    });
+
+    // each point gathers the weighted normals of its facets in the order of the facets
+    MeshPointFan fan(_rclMesh);
+    ParallelChunks(rPoints.size(), chunkSize, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            Base::Vector3f normal;
+            for (const std::size_t* it = fan.Begin(i); it != fan.End(i); ++it) {
+                const MeshFacet& rFacet = rFacets[*it / 3];
+                std::size_t corner = *it % 3;
+                const MeshPoint& p0 = rPoints[rFacet._aulPoints[corner]];
+                const MeshPoint& p1 = rPoints[rFacet._aulPoints[(corner + 1) % 3]];
+                const MeshPoint& p2 = rPoints[rFacet._aulPoints[(corner + 2) % 3]];
+                float l2p01 = Base::DistanceP2(p0, p1);
+                float l2p20 = Base::DistanceP2(p2, p0);
+                normal += facenormals[*it / 3] * (1.0F / (l2p01 * l2p20));
+            }
+            normal.Normalize();
+            _norm[i] = normal;
+        }
+    });
 }
 
 const Base::Vector3f& MeshRefNormalToPoints::operator[](PointIndex pos) const
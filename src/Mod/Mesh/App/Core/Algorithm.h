@@ -46,6 +46,7 @@ namespace MeshCore
 class MeshGeomFacet;
 class MeshGeomEdge;
 class MeshKernel;
+class MeshFacetBVH;
 class MeshFacetGrid;
 class MeshFacetArray;
 class MeshRefPointToFacets;
@@ -106,6 +107,20 @@ public:
         Base::Vector3f& rclRes,
         FacetIndex& rulFacet
     ) const;
+    /**
+     * Searches for the nearest facet to the ray defined by
+     * (\a rclPt, \a rclDir) whose normal doesn't exceed the angle \a fMaxAngle.
+     * The result is the same as with the variant that tests all facets but it
+     * uses the bounding volume hierarchy \a rclBVH of the mesh.
+     */
+    bool NearestFacetOnRay(
+        const Base::Vector3f& rclPt,
+        const Base::Vector3f& rclDir,
+        float fMaxAngle,
+        const MeshFacetBVH& rclBVH,
+        Base::Vector3f& rclRes,
+        FacetIndex& rulFacet
+    ) const;
     /**
      * Searches for the nearest facet to the ray defined by
      * (\a rclPt, \a rclDir).
@@ -459,6 +459,127 @@ Base::BoundBox3f PlaneFit::GetBoundings() const
 
 // -------------------------------------------------------------------------------
 
+void IncrementalPlaneFit::Clear()
+{
+    sx = sy = sz = 0.0;
+    sxx = sxy = sxz = 0.0;
+    syy = syz = szz = 0.0;
+    count = 0;
+    fitted = false;
+}
+
+void IncrementalPlaneFit::AddPoint(const Base::Vector3f& point)
+{
+    if (count == 0) {
+        origin.Set(point.x, point.y, point.z);
+    }
+
+    double x = double(point.x) - origin.x;
+    double y = double(point.y) - origin.y;
+    double z = double(point.z) - origin.z;
+    sx += x;
+    sy += y;
+    sz += z;
+    sxx += x * x;
+    sxy += x * y;
+    sxz += x * z;
+    syy += y * y;
+    syz += y * z;
+    szz += z * z;
+    count++;
+    fitted = false;
+}
+
+float IncrementalPlaneFit::Fit()
+{
+    fitted = true;
+    if (count < 3) {
+        return std::numeric_limits<float>::max();
+    }
+
+    // Covariance matrix
+    double num = double(count);
+    double mx = sx / num;
+    double my = sy / num;
+    double mz = sz / num;
+    Wm4::Matrix3<double> akMat(
+        sxx - sx * mx,
+        sxy - sx * my,
+        sxz - sx * mz,
+        sxy - sx * my,
+        syy - sy * my,
+        syz - sy * mz,
+        sxz - sx * mz,
+        syz - sy * mz,
+        szz - sz * mz
+    );
+    Wm4::Matrix3<double> rkRot, rkDiag;
+    try {
+        akMat.EigenDecomposition(rkRot, rkDiag);
+    }
+    catch (const std::exception&) {
+        return std::numeric_limits<float>::max();
+    }
+
+    // points describe a line or even are identical
+    if (rkDiag(1, 1) <= 0) {
+        return std::numeric_limits<float>::max();
+    }
+
+    // The eigenvalues are ordered, so the normal is the first column
+    Wm4::Vector3<double> W = rkRot.GetColumn(0);
+    for (int i = 0; i < 3; i++) {
+        if (boost::math::isnan(W[i])) {
+            return std::numeric_limits<float>::max();
+        }
+    }
+
+    double sigma = W.Dot(akMat * W);
+    if (boost::math::isnan(sigma)) {
+        return std::numeric_limits<float>::max();
+    }
+
+    normal.Set(float(W.X()), float(W.Y()), float(W.Z()));
+    base.Set(float(origin.x + mx), float(origin.y + my), float(origin.z + mz));
+
+    // round-off errors may let it become slightly negative
+    sigma = std::max(sigma, 0.0);
+    if (count > 3) {
+        return float(sqrt(sigma / double(count - 3)));
+    }
+
+    return 0.0F;
+}
+
+Base::Vector3f IncrementalPlaneFit::GetBase() const
+{
+    if (fitted) {
+        return base;
+    }
+
+    return Base::Vector3f();
+}
+
+Base::Vector3f IncrementalPlaneFit::GetNormal() const
+{
+    if (fitted) {
+        return normal;
+    }
+
+    return Base::Vector3f();
+}
+
+float IncrementalPlaneFit::GetDistanceToPlane(const Base::Vector3f& point) const
+{
+    float fResult = std::numeric_limits<float>::max();
+    if (fitted) {
+        fResult = (point - base) * normal;
+    }
+    return fResult;
+}
+
+// -------------------------------------------------------------------------------
+
 bool QuadraticFit::GetCurvatureInfo(
     double x,
     double y,
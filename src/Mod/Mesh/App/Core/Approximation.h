@@ -278,6 +278,65 @@ protected:
 
 // -------------------------------------------------------------------------------
 
+/**
+ * Approximation of a plane into a growing set of points. Unlike PlaneFit the points
+ * are not kept but only their first and second order moments. So, adding a point and
+ * re-fitting the plane take constant time which makes this class suitable for region
+ * growing where the plane is re-fitted after each new point.
+ */
+class MeshExport IncrementalPlaneFit
+{
+public:
+    IncrementalPlaneFit() = default;
+    /**
+     * Removes all points.
+     */
+    void Clear();
+    /**
+     * Adds a point to the moments.
+     */
+    void AddPoint(const Base::Vector3f& point);
+    /**
+     * Returns the number of added points.
+     */
+    std::size_t CountPoints() const
+    {
+        return count;
+    }
+    /**
+     * Fit a plane into the added points. We must have at least three non-collinear points
+     * to succeed. If the fit fails FLOAT_MAX is returned and the previous plane is kept.
+     */
+    float Fit();
+    /**
+     * Determines whether Fit() has been called since the last point was added.
+     */
+    bool Done() const
+    {
+        return fitted;
+    }
+    Base::Vector3f GetBase() const;
+    Base::Vector3f GetNormal() const;
+    /**
+     * Returns the distance from the point \a point to the fitted plane. If Fit() has not been
+     * called FLOAT_MAX is returned.
+     */
+    float GetDistanceToPlane(const Base::Vector3f& point) const;
+
+private:
+    // The moments are taken relative to the first point to reduce cancellation errors
+    Base::Vector3d origin;
+    double sx {0.0}, sy {0.0}, sz {0.0};
+    double sxx {0.0}, sxy {0.0}, sxz {0.0};
+    double syy {0.0}, syz {0.0}, szz {0.0};
+    std::size_t count {0};
+    bool fitted {false};
+    Base::Vector3f base {0, 0, 0};
+    Base::Vector3f normal {0, 0, 1};
+};
+
+// -------------------------------------------------------------------------------
+
 /**
  * Approximation of a quadratic surface into a given set of points. The implicit form of the surface
  * is defined by F(x,y,z) = a * x^2 + b * y^2 + c * z^2 +
@@ -0,0 +1,506 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "BVH.h"
+#include "Elements.h"
+#include "MeshKernel.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+constexpr std::uint32_t maxLeafSize = 4;
+constexpr int numBins = 16;
+
+struct Box
+{
+    std::array<float, 3> min {
+        std::numeric_limits<float>::max(),
+        std::numeric_limits<float>::max(),
+        std::numeric_limits<float>::max()
+    };
+    std::array<float, 3> max {
+        -std::numeric_limits<float>::max(),
+        -std::numeric_limits<float>::max(),
+        -std::numeric_limits<float>::max()
+    };
+
+    void Add(const float* p)
+    {
+        for (int i = 0; i < 3; i++) {
+            min[i] = std::min(min[i], p[i]);
+            max[i] = std::max(max[i], p[i]);
+        }
+    }
+    void Add(const Box& box)
+    {
+        for (int i = 0; i < 3; i++) {
+            min[i] = std::min(min[i], box.min[i]);
+            max[i] = std::max(max[i], box.max[i]);
+        }
+    }
+    bool IsValid() const
+    {
+        return min[0] <= max[0];
+    }
+    float HalfArea() const
+    {
+        if (!IsValid()) {
+            return 0.0F;
+        }
+        float dx = max[0] - min[0];
+        float dy = max[1] - min[1];
+        float dz = max[2] - min[2];
+        return dx * dy + dy * dz + dz * dx;
+    }
+};
+
+// Squared distance of a point to an axis-aligned box, zero if the point is inside
+inline float SqrDistanceToBox(const float* p, const float* min, const float* max)
+{
+    float dist = 0.0F;
+    for (int i = 0; i < 3; i++) {
+        float d = std::max({min[i] - p[i], 0.0F, p[i] - max[i]});
+        dist += d * d;
+    }
+    return dist;
+}
+
+// Checks whether the infinite line through p with direction d crosses the box
+inline bool LineCrossesBox(const float* p, const float* d, const float* min, const float* max)
+{
+    float tmin = -std::numeric_limits<float>::max();
+    float tmax = std::numeric_limits<float>::max();
+    for (int i = 0; i < 3; i++) {
+        if (d[i] == 0.0F) {
+            if (p[i] < min[i] || p[i] > max[i]) {
+                return false;
+            }
+        }
+        else {
+            float t1 = (min[i] - p[i]) / d[i];
+            float t2 = (max[i] - p[i]) / d[i];
+            tmin = std::max(tmin, std::min(t1, t2));
+            tmax = std::min(tmax, std::max(t1, t2));
+        }
+    }
+    return tmin <= tmax;
+}
+
+// Squared distance of p to the triangle (a, b, c), see Ericson, Real-Time Collision Detection
+float SqrDistanceToTriangle(const float* p, const float* a, const float* b, const float* c)
+{
+    auto sub = [](const float* u, const float* v) {
+        return std::array<float, 3> {u[0] - v[0], u[1] - v[1], u[2] - v[2]};
+    };
+    auto dot = [](const std::array<float, 3>& u, const std::array<float, 3>& v) {
+        return u[0] * v[0] + u[1] * v[1] + u[2] * v[2];
+    };
+    auto dist = [&](float v, float w) {
+        // closest point is a + v * ab + w * ac
+        std::array<float, 3> q {};
+        for (int i = 0; i < 3; i++) {
+            q[i] = a[i] + v * (b[i] - a[i]) + w * (c[i] - a[i]) - p[i];
+        }
+        return dot(q, q);
+    };
+
+    std::array<float, 3> ab = sub(b, a);
+    std::array<float, 3> ac = sub(c, a);
+    std::array<float, 3> ap = sub(p, a);
+    float d1 = dot(ab, ap);
+    float d2 = dot(ac, ap);
+    if (d1 <= 0.0F && d2 <= 0.0F) {
+        return dist(0.0F, 0.0F);
+    }
+
+    std::array<float, 3> bp = sub(p, b);
+    float d3 = dot(ab, bp);
+    float d4 = dot(ac, bp);
+    if (d3 >= 0.0F && d4 <= d3) {
+        return dist(1.0F, 0.0F);
+    }
+
+    float vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.0F && d1 >= 0.0F && d3 <= 0.0F) {
+        return dist(d1 / (d1 - d3), 0.0F);
+    }
+
+    std::array<float, 3> cp = sub(p, c);
+    float d5 = dot(ab, cp);
+    float d6 = dot(ac, cp);
+    if (d6 >= 0.0F && d5 <= d6) {
+        return dist(0.0F, 1.0F);
+    }
+
+    float vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.0F && d2 >= 0.0F && d6 <= 0.0F) {
+        return dist(0.0F, d2 / (d2 - d6));
+    }
+
+    float va = d3 * d6 - d5 * d4;
+    if (va <= 0.0F && (d4 - d3) >= 0.0F && (d5 - d6) >= 0.0F) {
+        float w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+        return dist(1.0F - w, w);
+    }
+
+    float denom = va + vb + vc;
+    if (denom == 0.0F) {
+        // degenerated triangle
+        return std::min({dist(0.0F, 0.0F), dist(1.0F, 0.0F), dist(0.0F, 1.0F)});
+    }
+    return dist(vb / denom, vc / denom);
+}
+}  // namespace
+
+struct MeshFacetBVH::BuildItem
+{
+    Box box;
+    std::array<float, 3> center {};
+    std::uint32_t pos {};
+};
+
+MeshFacetBVH::MeshFacetBVH(const MeshKernel& rclM)
+{
+    Build(rclM);
+}
+
+MeshFacetBVH::MeshFacetBVH(const MeshKernel& rclM, const Base::Matrix4D& rclMat)
+{
+    Build(rclM, rclMat);
+}
+
+void MeshFacetBVH::Clear()
+{
+    _aclNodes.clear();
+    _aulFacets.clear();
+    _afPoints.clear();
+}
+
+void MeshFacetBVH::Build(const MeshKernel& rclM)
+{
+    const MeshPointArray& points = rclM.GetPoints();
+    std::vector<float> coords;
+    coords.reserve(3 * points.size());
+    for (const auto& pnt : points) {
+        coords.push_back(pnt.x);
+        coords.push_back(pnt.y);
+        coords.push_back(pnt.z);
+    }
+    Build(std::move(coords), rclM);
+}
+
+void MeshFacetBVH::Build(const MeshKernel& rclM, const Base::Matrix4D& rclMat)
+{
+    const MeshPointArray& points = rclM.GetPoints();
+    std::vector<float> coords;
+    coords.reserve(3 * points.size());
+    for (const auto& pnt : points) {
+        Base::Vector3f vec = rclMat * pnt;
+        coords.push_back(vec.x);
+        coords.push_back(vec.y);
+        coords.push_back(vec.z);
+    }
+    Build(std::move(coords), rclM);
+}
+
+void MeshFacetBVH::Build(std::vector<float>&& points, const MeshKernel& rclM)
+{
+    Clear();
+
+    const MeshFacetArray& facets = rclM.GetFacets();
+    if (facets.empty()) {
+        return;
+    }
+
+    std::vector<BuildItem> items(facets.size());
+    for (std::size_t i = 0; i < facets.size(); i++) {
+        BuildItem& item = items[i];
+        for (PointIndex ptIndex : facets[i]._aulPoints) {
+            item.box.Add(&points[3 * ptIndex]);
+        }
+        for (int j = 0; j < 3; j++) {
+            item.center[j] = 0.5F * (item.box.min[j] + item.box.max[j]);
+        }
+        item.pos = static_cast<std::uint32_t>(i);
+    }
+
+    _aclNodes.reserve(2 * facets.size() / maxLeafSize + 1);
+    BuildNode(items, 0, static_cast<std::uint32_t>(items.size()));
+
+    // store the facets in leaf order so that a leaf refers to a contiguous range
+    _aulFacets.reserve(items.size());
+    _afPoints.reserve(9 * items.size());
+    for (const BuildItem& item : items) {
+        _aulFacets.push_back(item.pos);
+        for (PointIndex ptIndex : facets[item.pos]._aulPoints) {
+            _afPoints.insert(_afPoints.end(), &points[3 * ptIndex], &points[3 * ptIndex] + 3);
+        }
+    }
+}
+
+std::uint32_t MeshFacetBVH::BuildNode(std::vector<BuildItem>& items, std::uint32_t begin, std::uint32_t end)
+{
+    auto index = static_cast<std::uint32_t>(_aclNodes.size());
+    _aclNodes.emplace_back();
+
+    Box bounds;
+    Box centers;
+    for (std::uint32_t i = begin; i < end; i++) {
+        bounds.Add(items[i].box);
+        centers.Add(items[i].center.data());
+    }
+
+    auto makeLeaf = [&]() {
+        Node& node = _aclNodes[index];
+        std::copy(bounds.min.begin(), bounds.min.end(), node.min);
+        std::copy(bounds.max.begin(), bounds.max.end(), node.max);
+        node.first = begin;
+        node.count = end - begin;
+        return index;
+    };
+
+    std::uint32_t count = end - begin;
+    if (count <= maxLeafSize) {
+        return makeLeaf();
+    }
+
+    // find the best split plane with the surface area heuristic over binned centroids
+    int bestAxis = -1;
+    int bestSplit = 0;
+    float bestCost = static_cast<float>(count) * bounds.HalfArea();
+    for (int axis = 0; axis < 3; axis++) {
+        float extent = centers.max[axis] - centers.min[axis];
+        if (extent <= 0.0F) {
+            continue;
+        }
+
+        std::array<Box, numBins> binBoxes;
+        std::array<std::uint32_t, numBins> binCounts {};
+        float scale = static_cast<float>(numBins) / extent;
+        for (std::uint32_t i = begin; i < end; i++) {
+            int bin = std::min(
+                numBins - 1,
+                static_cast<int>((items[i].center[axis] - centers.min[axis]) * scale)
+            );
+            binBoxes[bin].Add(items[i].box);
+            binCounts[bin]++;
+        }
+
+        // areas of all bins right of each split plane
+        std::array<float, numBins> rightCosts {};
+        Box right;
+        std::uint32_t rightCount = 0;
+        for (int bin = numBins - 1; bin > 0; bin--) {
+            right.Add(binBoxes[bin]);
+            rightCount += binCounts[bin];
+            rightCosts[bin] = static_cast<float>(rightCount) * right.HalfArea();
+        }
+
+        Box left;
+        std::uint32_t leftCount = 0;
+        for (int bin = 0; bin < numBins - 1; bin++) {
+            left.Add(binBoxes[bin]);
+            leftCount += binCounts[bin];
+            float cost = static_cast<float>(leftCount) * left.HalfArea() + rightCosts[bin + 1];
+            if (leftCount > 0 && leftCount < count && cost < bestCost) {
+                bestCost = cost;
+                bestAxis = axis;
+                bestSplit = bin + 1;
+            }
+        }
+    }
+
+    std::uint32_t mid = 0;
+    if (bestAxis >= 0) {
+        float extent = centers.max[bestAxis] - centers.min[bestAxis];
+        float scale = static_cast<float>(numBins) / extent;
+        float minCenter = centers.min[bestAxis];
+        auto it = std::partition(
+            items.begin() + begin,
+            items.begin() + end,
+            [=](const BuildItem& item) {
+                int bin = std::min(
+                    numBins - 1,
+                    static_cast<int>((item.center[bestAxis] - minCenter) * scale)
+                );
+                return bin < bestSplit;
+            }
+        );
+        mid = static_cast<std::uint32_t>(it - items.begin());
+    }
+    else if (count > 8 * maxLeafSize) {
+        // splitting doesn't pay off but avoid huge leaves, e.g. for many coincident facets
+        mid = begin + count / 2;
+    }
+    else {
+        return makeLeaf();
+    }
+
+    BuildNode(items, begin, mid);
+    std::uint32_t right = BuildNode(items, mid, end);
+
+    Node& node = _aclNodes[index];
+    std::copy(bounds.min.begin(), bounds.min.end(), node.min);
+    std::copy(bounds.max.begin(), bounds.max.end(), node.max);
+    node.first = right;
+    node.count = 0;
+    return index;
+}
+
+Base::BoundBox3f MeshFacetBVH::GetBoundBox() const
+{
+    if (_aclNodes.empty()) {
+        return Base::BoundBox3f();
+    }
+    return _aclNodes.front().GetBoundBox();
+}
+
+FacetIndex MeshFacetBVH::NearestFacetToPoint(const Base::Vector3f& rclPt, float& rfDist, float fMaxDist) const
+{
+    FacetIndex facet = FACET_INDEX_MAX;
+    if (_aclNodes.empty()) {
+        return facet;
+    }
+
+    const float pnt[3] = {rclPt.x, rclPt.y, rclPt.z};
+    float bestDist = fMaxDist < std::sqrt(std::numeric_limits<float>::max())
+        ? fMaxDist * fMaxDist
+        : std::numeric_limits<float>::max();
+
+    // the nearer child is visited first so that the search radius shrinks quickly
+    std::vector<std::pair<float, std::uint32_t>> stack;
+    stack.emplace_back(SqrDistanceToBox(pnt, _aclNodes[0].min, _aclNodes[0].max), 0);
+    while (!stack.empty()) {
+        auto [boxDist, index] = stack.back();
+        stack.pop_back();
+        if (boxDist >= bestDist) {
+            continue;
+        }
+
+        const Node& node = _aclNodes[index];
+        if (node.count > 0) {
+            for (std::uint32_t i = node.first; i < node.first + node.count; i++) {
+                const float* p = GetPoints(i);
+                float dist = SqrDistanceToTriangle(pnt, p, p + 3, p + 6);
+                if (dist < bestDist) {
+                    bestDist = dist;
+                    facet = _aulFacets[i];
+                }
+            }
+        }
+        else {
+            const Node& left = _aclNodes[index + 1];
+            const Node& right = _aclNodes[node.first];
+            float leftDist = SqrDistanceToBox(pnt, left.min, left.max);
+            float rightDist = SqrDistanceToBox(pnt, right.min, right.max);
+            if (leftDist < rightDist) {
+                stack.emplace_back(rightDist, node.first);
+                stack.emplace_back(leftDist, index + 1);
+            }
+            else {
+                stack.emplace_back(leftDist, index + 1);
+                stack.emplace_back(rightDist, node.first);
+            }
+        }
+    }
+
+    if (facet != FACET_INDEX_MAX) {
+        rfDist = std::sqrt(bestDist);
+    }
+    return facet;
+}
+
+bool MeshFacetBVH::NearestFacetOnRay(
+    const Base::Vector3f& rclPt,
+    const Base::Vector3f& rclDir,
+    float fMaxAngle,
+    Base::Vector3f& rclRes,
+    FacetIndex& rulFacet
+) const
+{
+    if (_aclNodes.empty()) {
+        return false;
+    }
+
+    const float pnt[3] = {rclPt.x, rclPt.y, rclPt.z};
+    const float dir[3] = {rclDir.x, rclDir.y, rclDir.z};
+
+    // enlarge the boxes a bit for the tolerance used in MeshGeomFacet::Foraminate()
+    Base::BoundBox3f bbox = GetBoundBox();
+    float tol = 1.0e-4F * bbox.CalcDiagonalLength() + std::numeric_limits<float>::epsilon();
+
+    bool found = false;
+    float bestDist = std::numeric_limits<float>::max();
+    Base::Vector3f clRes;
+
+    std::vector<std::uint32_t> stack;
+    stack.push_back(0);
+    while (!stack.empty()) {
+        std::uint32_t index = stack.back();
+        stack.pop_back();
+
+        const Node& node = _aclNodes[index];
+        const float min[3] = {node.min[0] - tol, node.min[1] - tol, node.min[2] - tol};
+        const float max[3] = {node.max[0] + tol, node.max[1] + tol, node.max[2] + tol};
+        if (!LineCrossesBox(pnt, dir, min, max)) {
+            continue;
+        }
+        // the intersection point cannot be nearer to rclPt than the box is
+        if (found && SqrDistanceToBox(pnt, min, max) > bestDist) {
+            continue;
+        }
+
+        if (node.count > 0) {
+            for (std::uint32_t i = node.first; i < node.first + node.count; i++) {
+                const float* p = GetPoints(i);
+                MeshGeomFacet facet(
+                    Base::Vector3f(p[0], p[1], p[2]),
+                    Base::Vector3f(p[3], p[4], p[5]),
+                    Base::Vector3f(p[6], p[7], p[8])
+                );
+                if (facet.Foraminate(rclPt, rclDir, clRes, fMaxAngle)) {
+                    float dist = Base::DistanceP2(clRes, rclPt);
+                    if (!found || dist < bestDist) {
+                        found = true;
+                        bestDist = dist;
+                        rclRes = clRes;
+                        rulFacet = _aulFacets[i];
+                    }
+                }
+            }
+        }
+        else {
+            stack.push_back(node.first);
+            stack.push_back(index + 1);
+        }
+    }
+
+    return found;
+}
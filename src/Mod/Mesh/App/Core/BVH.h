@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <Base/BoundBox.h>
+#include <Base/Matrix.h>
+
+#include "Definitions.h"
+
+
+namespace MeshCore
+{
+
+class MeshKernel;
+
+/**
+ * The MeshFacetBVH class is a bounding volume hierarchy over the facets of a mesh.
+ *
+ * The tree is built with the surface area heuristic over binned facet centroids. In contrast
+ * to the uniform MeshFacetGrid it adapts to meshes with very uneven facet density, e.g. scans
+ * with dense details and a sparse background. It can be used instead of a MeshFacetGrid for
+ * ray and nearest facet queries.
+ *
+ * The tree keeps a copy of the facet vertices, so it can be built for a transformed mesh and
+ * must be rebuilt if the mesh changes.
+ */
+class MeshExport MeshFacetBVH
+{
+public:
+    /** @name Construction */
+    //@{
+    MeshFacetBVH() = default;
+    explicit MeshFacetBVH(const MeshKernel& rclM);
+    MeshFacetBVH(const MeshKernel& rclM, const Base::Matrix4D& rclMat);
+    //@}
+
+    /** Builds the tree for the facets of \a rclM. */
+    void Build(const MeshKernel& rclM);
+    /** Builds the tree for the facets of \a rclM transformed by \a rclMat. */
+    void Build(const MeshKernel& rclM, const Base::Matrix4D& rclMat);
+    /** Removes all facets. */
+    void Clear();
+    /** Checks whether the tree contains any facets. */
+    bool IsEmpty() const
+    {
+        return _aulFacets.empty();
+    }
+    /** Returns the bounding box of all facets. */
+    Base::BoundBox3f GetBoundBox() const;
+
+    /** @name Search */
+    //@{
+    /** Searches for the facet nearest to \a rclPt whose distance is less than \a fMaxDist. Returns
+     * FACET_INDEX_MAX if there is no such facet, otherwise the facet index and its distance in
+     * \a rfDist. */
+    FacetIndex NearestFacetToPoint(
+        const Base::Vector3f& rclPt,
+        float& rfDist,
+        float fMaxDist = std::numeric_limits<float>::max()
+    ) const;
+    /** Searches for the facet hit by the line (\a rclPt, \a rclDir) whose intersection point
+     * \a rclRes is nearest to \a rclPt. The angle between the line and the facet normal must not
+     * exceed \a fMaxAngle. This gives the same result as the MeshAlgorithm::NearestFacetOnRay()
+     * variant that tests all facets. */
+    bool NearestFacetOnRay(
+        const Base::Vector3f& rclPt,
+        const Base::Vector3f& rclDir,
+        float fMaxAngle,
+        Base::Vector3f& rclRes,
+        FacetIndex& rulFacet
+    ) const;
+    /** Collects the facets whose bounding boxes fulfill \a pred. Subtrees whose bounding box does
+     * not fulfill \a pred are skipped, so the predicate must also hold for any box containing a
+     * box it holds for. */
+    template<class Predicate>
+    void Inside(Predicate&& pred, std::vector<FacetIndex>& raulFacets) const;
+    //@}
+
+private:
+    struct Node
+    {
+        float min[3];
+        float max[3];
+        std::uint32_t first;  /**< first facet of a leaf or the right child of an inner node */
+        std::uint32_t count;  /**< number of facets of a leaf, 0 for inner nodes */
+
+        Base::BoundBox3f GetBoundBox() const
+        {
+            return Base::BoundBox3f(min[0], min[1], min[2], max[0], max[1], max[2]);
+        }
+    };
+
+    struct BuildItem;
+    void Build(std::vector<float>&& points, const MeshKernel& rclM);
+    std::uint32_t BuildNode(std::vector<BuildItem>& items, std::uint32_t begin, std::uint32_t end);
+    const float* GetPoints(std::uint32_t pos) const
+    {
+        return &_afPoints[9 * static_cast<std::size_t>(pos)];
+    }
+
+    std::vector<Node> _aclNodes;         /**< nodes in depth-first order, the root comes first */
+    std::vector<FacetIndex> _aulFacets;  /**< facet indices in leaf order */
+    std::vector<float> _afPoints;        /**< the 3 vertices of each facet in leaf order */
+};
+
+template<class Predicate>
+void MeshFacetBVH::Inside(Predicate&& pred, std::vector<FacetIndex>& raulFacets) const
+{
+    if (_aclNodes.empty()) {
+        return;
+    }
+
+    std::vector<std::uint32_t> stack;
+    stack.push_back(0);
+    while (!stack.empty()) {
+        const Node& node = _aclNodes[stack.back()];
+        std::uint32_t index = stack.back();
+        stack.pop_back();
+        if (!pred(node.GetBoundBox())) {
+            continue;
+        }
+        if (node.count > 0) {
+            for (std::uint32_t i = node.first; i < node.first + node.count; i++) {
+                const float* p = GetPoints(i);
+                Base::BoundBox3f box(p[0], p[1], p[2], p[0], p[1], p[2]);
+                box.Add(Base::Vector3f(p[3], p[4], p[5]));
+                box.Add(Base::Vector3f(p[6], p[7], p[8]));
+                if (pred(box)) {
+                    raulFacets.push_back(_aulFacets[i]);
+                }
+            }
+        }
+        else {
+            stack.push_back(node.first);
+            stack.push_back(index + 1);
+        }
+    }
+}
+
+}  // namespace MeshCore
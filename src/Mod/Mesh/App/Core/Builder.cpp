@@ -24,15 +24,17 @@
 
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
 
 
 #include <Base/Exception.h>
 #include <Base/Sequencer.h>
 
 #include "Builder.h"
-#include "Functional.h"
 #include "MeshKernel.h"
-#include <QVector>
+#include <QtConcurrentMap>
 
 
 using namespace MeshCore;
@@ -276,46 +278,9 @@ void MeshBuilder::Finish(bool freeMemory)
 
 struct MeshFastBuilder::Private
 {
-    struct Vertex
-    {
-        Vertex()
-            : x(0)
-            , y(0)
-            , z(0)
-            , i(0)
-        {}
-        Vertex(float x, float y, float z)
-            : x(x)
-            , y(y)
-            , z(z)
-            , i(0)
-        {}
-
-        float x, y, z;
-        size_type i;
-
-        bool operator!=(const Vertex& rhs) const
-        {
-            return x != rhs.x || y != rhs.y || z != rhs.z;
-        }
-        bool operator<(const Vertex& rhs) const
-        {
-            if (x != rhs.x) {
-                return x < rhs.x;
-            }
-            if (y != rhs.y) {
-                return y < rhs.y;
-            }
-            if (z != rhs.z) {
-                return z < rhs.z;
-            }
-
-            return false;
-        }
-    };
-
-    // Hint: Using a QVector instead of std::vector is a bit faster
-    QVector<Vertex> verts;
+    // the three points of a facet are stored one after another
+    std::vector<Base::Vector3f> verts;
+    float tolerance = 0.0F;
 };
 
 MeshFastBuilder::MeshFastBuilder(MeshKernel& rclM)
@@ -330,70 +295,352 @@ MeshFastBuilder::~MeshFastBuilder()
 
 void MeshFastBuilder::Initialize(size_type ctFacets)
 {
-    p->verts.reserve(ctFacets * 3);
+    p->verts.reserve(static_cast<std::size_t>(ctFacets) * 3);
+}
+
+void MeshFastBuilder::SetTolerance(float fTol)
+{
+    p->tolerance = fTol;
 }
 
 void MeshFastBuilder::AddFacet(const Base::Vector3f* facetPoints)
 {
-    Private::Vertex v;
-    for (int i = 0; i < 3; i++) {
-        v.x = facetPoints[i].x;
-        v.y = facetPoints[i].y;
-        v.z = facetPoints[i].z;
-        p->verts.push_back(v);
-    }
+    p->verts.insert(p->verts.end(), facetPoints, facetPoints + 3);
 }
 
 void MeshFastBuilder::AddFacet(const MeshGeomFacet& facetPoints)
 {
-    Private::Vertex v;
-    for (const auto& pnt : facetPoints._aclPoints) {
-        v.x = pnt.x;
-        v.y = pnt.y;
-        v.z = pnt.z;
-        p->verts.push_back(v);
-    }
+    AddFacet(facetPoints._aclPoints);
 }
 
 void MeshFastBuilder::Finish()
 {
-    using size_type = QVector<Private::Vertex>::size_type;
-    QVector<Private::Vertex>& verts = p->verts;
-    size_type ulCtPts = verts.size();
-    for (size_type i = 0; i < ulCtPts; ++i) {
-        verts[i].i = i;
+    MeshPointArray rPoints;
+    MeshFacetArray rFacets;
+    MeshPointWelder welder(
+        reinterpret_cast<const char*>(p->verts.data()),
+        p->verts.size() / 3,
+        3 * sizeof(Base::Vector3f)
+    );
+    welder.Weld(rPoints, rFacets);
+    p->verts.clear();
+    p->verts.shrink_to_fit();
+
+    MeshPointWelder::Merge(rPoints, rFacets, p->tolerance);
+    _meshKernel.Adopt(rPoints, rFacets, true);
+}
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+constexpr int numShards = 256;
+constexpr std::size_t chunkSize = 1 << 16;
+
+struct PointKey
+{
+    std::uint32_t x, y, z;
+
+    bool operator==(const PointKey& rhs) const
+    {
+        return x == rhs.x && y == rhs.y && z == rhs.z;
+    }
+};
+
+struct CellKey
+{
+    std::int32_t x, y, z;
+
+    bool operator<(const CellKey& rhs) const
+    {
+        if (x != rhs.x) {
+            return x < rhs.x;
+        }
+        if (y != rhs.y) {
+            return y < rhs.y;
+        }
+        return z < rhs.z;
+    }
+};
+
+inline std::uint32_t FloatBits(float value)
+{
+    // -0 and +0 are equal
+    if (value == 0.0F) {
+        return 0;
+    }
+    std::uint32_t bits {};
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+inline std::uint64_t Mix(std::uint64_t hash)
+{
+    hash ^= hash >> 30;
+    hash *= 0xbf58476d1ce4e5b9ULL;
+    hash ^= hash >> 27;
+    hash *= 0x94d049bb133111ebULL;
+    hash ^= hash >> 31;
+    return hash;
+}
+
+inline std::uint64_t HashKey(const PointKey& key)
+{
+    std::uint64_t hash = (std::uint64_t(key.x) << 32) | key.y;
+    return Mix(hash ^ (std::uint64_t(key.z) * 0x9e3779b97f4a7c15ULL));
+}
+
+inline std::uint64_t HashKey(const CellKey& key)
+{
+    std::uint64_t hash = (std::uint64_t(std::uint32_t(key.x)) << 32) | std::uint32_t(key.y);
+    return Mix(hash ^ (std::uint64_t(std::uint32_t(key.z)) * 0x9e3779b97f4a7c15ULL));
+}
+
+inline int ShardOf(std::uint64_t hash)
+{
+    return static_cast<int>(hash >> 56);
+}
+
+/* Distributes the indices 0, ..., count-1 over the shards given by shardOf. On return the indices
+ * of shard i are order[shardBegin[i]], ..., order[shardBegin[i+1]-1] in ascending order. */
+template<class ShardFunc>
+void PartitionByShard(
+    std::size_t count,
+    ShardFunc shardOf,
+    std::vector<std::uint32_t>& order,
+    std::vector<std::size_t>& shardBegin
+)
+{
+    // count the elements of each chunk per shard
+    std::vector<std::size_t> chunks((count + chunkSize - 1) / chunkSize);
+    std::iota(chunks.begin(), chunks.end(), 0);
+    std::vector<std::size_t> offsets(chunks.size() * numShards);
+    QtConcurrent::blockingMap(chunks, [&](std::size_t& chunk) {
+        std::size_t* counts = &offsets[chunk * numShards];
+        std::size_t end = std::min(count, (chunk + 1) * chunkSize);
+        for (std::size_t index = chunk * chunkSize; index < end; index++) {
+            counts[shardOf(index)]++;
+        }
+    });
+
+    // turn the counts into the write positions of each chunk
+    shardBegin.assign(numShards + 1, 0);
+    std::size_t pos = 0;
+    for (int shard = 0; shard < numShards; shard++) {
+        shardBegin[shard] = pos;
+        for (std::size_t chunk = 0; chunk < chunks.size(); chunk++) {
+            std::size_t num = offsets[chunk * numShards + shard];
+            offsets[chunk * numShards + shard] = pos;
+            pos += num;
+        }
+    }
+    shardBegin[numShards] = pos;
+
+    order.resize(count);
+    QtConcurrent::blockingMap(chunks, [&](std::size_t& chunk) {
+        std::size_t* next = &offsets[chunk * numShards];
+        std::size_t end = std::min(count, (chunk + 1) * chunkSize);
+        for (std::size_t index = chunk * chunkSize; index < end; index++) {
+            order[next[shardOf(index)]++] = static_cast<std::uint32_t>(index);
+        }
+    });
+}
+}  // namespace
+
+MeshPointWelder::MeshPointWelder(const char* data, std::size_t ctFacets, std::size_t stride)
+    : _data(data)
+    , _ctFacets(ctFacets)
+    , _stride(stride)
+{}
+
+void MeshPointWelder::Weld(MeshPointArray& rPoints, MeshFacetArray& rFacets) const
+{
+    const std::size_t ctVerts = 3 * _ctFacets;
+    if (ctVerts > std::numeric_limits<std::uint32_t>::max()) {
+        throw Base::ValueError("Too many facets to merge their points");
     }
 
-    // std::sort(verts.begin(), verts.end());
-    int threads = int(std::thread::hardware_concurrency());
-    MeshCore::parallel_sort(verts.begin(), verts.end(), std::less<>(), threads);
+    auto getPoint = [this](std::size_t vert, float* coords) {
+        std::memcpy(coords, _data + (vert / 3) * _stride + (vert % 3) * 3 * sizeof(float), 3 * sizeof(float));
+    };
+    auto getKey = [&getPoint](std::size_t vert) {
+        float coords[3];
+        getPoint(vert, coords);
+        return PointKey {FloatBits(coords[0]), FloatBits(coords[1]), FloatBits(coords[2])};
+    };
 
-    QVector<FacetIndex> indices(ulCtPts);
+    rFacets.clear();
+    rFacets.resize(_ctFacets);
+    rPoints.clear();
+
+    std::vector<std::uint32_t> order;
+    std::vector<std::size_t> shardBegin;
+    PartitionByShard(
+        ctVerts,
+        [&getKey](std::size_t vert) {
+            return ShardOf(HashKey(getKey(vert)));
+        },
+        order,
+        shardBegin
+    );
 
-    size_type vertex_count = 0;
-    for (QVector<Private::Vertex>::iterator v = verts.begin(); v != verts.end(); ++v) {
-        if (!vertex_count || *v != verts[vertex_count - 1]) {
-            verts[vertex_count++] = *v;
+    // merge the points of each shard with an open addressing hash table
+    std::vector<int> shards(numShards);
+    std::iota(shards.begin(), shards.end(), 0);
+    std::vector<std::vector<std::uint32_t>> unique(numShards);
+    QtConcurrent::blockingMap(shards, [&](int& shard) {
+        const std::uint32_t empty = std::numeric_limits<std::uint32_t>::max();
+        std::size_t count = shardBegin[shard + 1] - shardBegin[shard];
+        std::size_t size = 16;
+        while (size < 2 * count) {
+            size *= 2;
+        }
+        const std::size_t mask = size - 1;
+        std::vector<std::uint32_t> table(size, empty);
+        std::vector<std::uint32_t>& points = unique[shard];
+
+        for (std::size_t i = shardBegin[shard]; i < shardBegin[shard + 1]; i++) {
+            std::uint32_t vert = order[i];
+            PointKey key = getKey(vert);
+            std::size_t slot = HashKey(key) & mask;
+            while (table[slot] != empty && !(getKey(points[table[slot]]) == key)) {
+                slot = (slot + 1) & mask;
+            }
+            if (table[slot] == empty) {
+                table[slot] = static_cast<std::uint32_t>(points.size());
+                points.push_back(vert);
+            }
+            rFacets[vert / 3]._aulPoints[vert % 3] = table[slot];
         }
+    });
 
-        indices[v->i] = static_cast<FacetIndex>(vertex_count - 1);
+    std::vector<std::size_t> pointBegin(numShards + 1);
+    for (int shard = 0; shard < numShards; shard++) {
+        pointBegin[shard + 1] = pointBegin[shard] + unique[shard].size();
     }
 
-    size_type ulCt = verts.size() / 3;
-    MeshFacetArray rFacets(static_cast<FacetIndex>(ulCt));
-    for (size_type i = 0; i < ulCt; ++i) {
-        rFacets[static_cast<size_t>(i)]._aulPoints[0] = indices[3 * i];
-        rFacets[static_cast<size_t>(i)]._aulPoints[1] = indices[3 * i + 1];
-        rFacets[static_cast<size_t>(i)]._aulPoints[2] = indices[3 * i + 2];
+    rPoints.resize(pointBegin[numShards]);
+    QtConcurrent::blockingMap(shards, [&](int& shard) {
+        PointIndex base = pointBegin[shard];
+        const std::vector<std::uint32_t>& points = unique[shard];
+        for (std::size_t i = 0; i < points.size(); i++) {
+            float coords[3];
+            getPoint(points[i], coords);
+            rPoints[base + i].Set(coords[0], coords[1], coords[2]);
+        }
+        for (std::size_t i = shardBegin[shard]; i < shardBegin[shard + 1]; i++) {
+            std::uint32_t vert = order[i];
+            rFacets[vert / 3]._aulPoints[vert % 3] += base;
+        }
+    });
+}
+
+void MeshPointWelder::Merge(MeshPointArray& rPoints, MeshFacetArray& rFacets, float fTolerance)
+{
+    if (fTolerance <= 0.0F || rPoints.empty()) {
+        return;
+    }
+    const std::size_t ctPoints = rPoints.size();
+    if (ctPoints > std::numeric_limits<std::uint32_t>::max()) {
+        throw Base::ValueError("Too many points to merge");
     }
 
-    verts.resize(vertex_count);
+    // the points are hashed into cells with the size of the tolerance so that all points
+    // within the tolerance are in the 27 surrounding cells
+    const double scale = 1.0 / double(fTolerance);
+    auto toCell = [scale](float value) {
+        double cell = std::floor(double(value) * scale);
+        if (std::isnan(cell)) {
+            return 0;
+        }
+        cell = std::clamp<double>(
+            cell,
+            std::numeric_limits<std::int32_t>::min() + 1,
+            std::numeric_limits<std::int32_t>::max() - 1
+        );
+        return static_cast<std::int32_t>(cell);
+    };
+    auto cellOf = [&](std::size_t index) {
+        const MeshPoint& pnt = rPoints[index];
+        return CellKey {toCell(pnt.x), toCell(pnt.y), toCell(pnt.z)};
+    };
 
-    MeshPointArray rPoints;
-    rPoints.reserve(static_cast<size_t>(vertex_count));
-    for (const auto& v : verts) {
-        rPoints.push_back(MeshPoint(v.x, v.y, v.z));
+    std::vector<std::uint32_t> order;
+    std::vector<std::size_t> shardBegin;
+    PartitionByShard(
+        ctPoints,
+        [&cellOf](std::size_t index) {
+            return ShardOf(HashKey(cellOf(index)));
+        },
+        order,
+        shardBegin
+    );
+
+    // sort the points of a shard by their cells so that each cell is a contiguous range
+    std::vector<int> shards(numShards);
+    std::iota(shards.begin(), shards.end(), 0);
+    auto lessCell = [&cellOf](std::uint32_t lhs, std::uint32_t rhs) {
+        CellKey cl = cellOf(lhs);
+        CellKey cr = cellOf(rhs);
+        return cl < cr || (!(cr < cl) && lhs < rhs);
+    };
+    QtConcurrent::blockingMap(shards, [&](int& shard) {
+        std::sort(order.begin() + shardBegin[shard], order.begin() + shardBegin[shard + 1], lessCell);
+    });
+
+    // each point refers to the point with the lowest index within the tolerance
+    const float fTolerance2 = fTolerance * fTolerance;
+    std::vector<std::uint32_t> rep(ctPoints);
+    std::vector<std::size_t> chunks((ctPoints + chunkSize - 1) / chunkSize);
+    std::iota(chunks.begin(), chunks.end(), 0);
+    QtConcurrent::blockingMap(chunks, [&](std::size_t& chunk) {
+        std::size_t end = std::min(ctPoints, (chunk + 1) * chunkSize);
+        for (std::size_t index = chunk * chunkSize; index < end; index++) {
+            const MeshPoint& pnt = rPoints[index];
+            CellKey cell = cellOf(index);
+            auto best = static_cast<std::uint32_t>(index);
+            for (int i = -1; i <= 1; i++) {
+                for (int j = -1; j <= 1; j++) {
+                    for (int k = -1; k <= 1; k++) {
+                        CellKey next {cell.x + i, cell.y + j, cell.z + k};
+                        int shard = ShardOf(HashKey(next));
+                        auto first = order.begin() + shardBegin[shard];
+                        auto last = order.begin() + shardBegin[shard + 1];
+                        auto it = std::lower_bound(first, last, next, [&cellOf](std::uint32_t lhs, const CellKey& rhs) {
+                            return cellOf(lhs) < rhs;
+                        });
+                        // the points of a cell are sorted by index
+                        for (; it != last && *it < best && !(next < cellOf(*it)); ++it) {
+                            if (Base::DistanceP2(pnt, rPoints[*it]) <= fTolerance2) {
+                                best = *it;
+                                break;
+                            }
+                        }
+                    }
+                }
+            }
+            rep[index] = best;
+        }
+    });
+
+    // resolve chains of references, a point always refers to a point with a lower index
+    std::vector<PointIndex> newIndex(ctPoints);
+    PointIndex ctUnique = 0;
+    for (std::size_t index = 0; index < ctPoints; index++) {
+        if (rep[index] == index) {
+            newIndex[index] = ctUnique;
+            rPoints[ctUnique] = rPoints[index];
+            ctUnique++;
+        }
+        else {
+            newIndex[index] = newIndex[rep[index]];
+        }
     }
+    rPoints.resize(ctUnique);
 
-    _meshKernel.Adopt(rPoints, rFacets, true);
+    QtConcurrent::blockingMap(rFacets, [&newIndex](MeshFacet& facet) {
+        for (PointIndex& index : facet._aulPoints) {
+            index = newIndex[index];
+        }
+    });
 }
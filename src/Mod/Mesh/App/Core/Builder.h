@@ -215,6 +215,10 @@ public:
      * @param ctFacets count of facets.
      */
     void Initialize(size_type ctFacets);
+    /** Points with a distance less than or equal to \a fTol are merged, by default only
+     * points with equal coordinates are merged.
+     */
+    void SetTolerance(float fTol);
     /** Add new facet
      */
     void AddFacet(const Base::Vector3f* facetPoints);
@@ -231,4 +235,43 @@ private:
     Private* p;
 };
 
+/**
+ * The MeshPointWelder class builds the points and facets of a mesh from a triangle soup given
+ * as raw float triples, e.g. the mapped content of a binary STL file. Points with equal
+ * coordinates are merged.
+ *
+ * In contrast to MeshFastBuilder the points are not sorted but distributed over shards by
+ * hashing their coordinates. The shards are merged in parallel, so the costs grow linearly
+ * with the number of facets and the triangle soup is never copied.
+ */
+class MeshExport MeshPointWelder
+{
+public:
+    /** Sets up the welder.
+     * @param data points to the first coordinate of the first facet. The three points of a facet
+     * must be stored as nine consecutive floats.
+     * @param ctFacets count of facets.
+     * @param stride count of bytes from one facet to the next.
+     */
+    MeshPointWelder(const char* data, std::size_t ctFacets, std::size_t stride);
+
+    /** Merges the points and returns the mesh structure in \a rPoints and \a rFacets. The
+     * neighbourhood of the facets is not set.
+     */
+    void Weld(MeshPointArray& rPoints, MeshFacetArray& rFacets) const;
+
+    /** Merges the points of \a rPoints that lie within the distance \a fTolerance and updates
+     * the point indices of \a rFacets. A point is merged into the point with the lowest index
+     * within the tolerance. The points are hashed into cells with the size of the tolerance,
+     * and the cells are distributed over shards that are processed in parallel. The facets
+     * are kept even if they become degenerated so that per-facet data stays valid.
+     */
+    static void Merge(MeshPointArray& rPoints, MeshFacetArray& rFacets, float fTolerance);
+
+private:
+    const char* _data;
+    std::size_t _ctFacets;
+    std::size_t _stride;
+};
+
 }  // namespace MeshCore
@@ -23,13 +23,12 @@
  ***************************************************************************/
 
 #include <algorithm>
-#include <functional>
 #include <limits>
 
 #include <QFuture>
-#include <QFutureWatcher>
 #include <QtConcurrentMap>
 
+#include <Base/ProgressTask.h>
 #include <Base/Sequencer.h>
 #include <Base/Tools.h>
 
@@ -37,18 +36,19 @@
 #ifdef OPTIMIZE_CURVATURE
 # include <Eigen/Eigenvalues>
 #else
-# include <Mod/Mesh/App/WildMagic4/Wm4MeshCurvature.h>
+# include <Mod/Mesh/App/WildMagic4/Wm4Matrix2.h>
+# include <Mod/Mesh/App/WildMagic4/Wm4Matrix3.h>
 #endif
 
 #include "Approximation.h"
 #include "Curvature.h"
 #include "Iterator.h"
 #include "MeshKernel.h"
+#include "Neighbourhood.h"
 #include "Tools.h"
 
 
 using namespace MeshCore;
-namespace sp = std::placeholders;
 
 MeshCurvature::MeshCurvature(const MeshKernel& kernel)
     : myKernel(kernel)
@@ -81,13 +81,19 @@ void MeshCurvature::ComputePerFace(bool parallel)
         }
     }
     else {
-        // NOLINTBEGIN
+        Base::ProgressTask task(mySegment.size());
         QFuture<CurvatureInfo> future
-            = QtConcurrent::mapped(mySegment, std::bind(&FacetCurvature::Compute, &face, sp::_1));
-        // NOLINTEND
-        QFutureWatcher<CurvatureInfo> watcher;
-        watcher.setFuture(future);
-        watcher.waitForFinished();
+            = QtConcurrent::mapped(mySegment, [&face, &task](FacetIndex index) {
+                  if (task.isCanceled()) {
+                      return CurvatureInfo();
+                  }
+                  CurvatureInfo info = face.Compute(index);
+                  task.advance();
+                  return info;
+              });
+        Base::waitForProgress("Curvature estimation", task, [&future]() {
+            return future.isFinished();
+        });
         for (const auto& it : future) {
             myCurvature.push_back(it);
         }
@@ -289,61 +295,136 @@ void MeshCurvature::ComputePerVertex()
     }
 }
 #else
+namespace
+{
+// Computes the principal curvatures at a point from its normal and the matrix of normal
+// derivatives as Wm4::MeshCurvature does.
+CurvatureInfo PrincipalCurvatures(const Wm4::Vector3<double>& normal, const Wm4::Matrix3<double>& dNormal)
+{
+    // If N is a unit-length normal at a vertex, let U and V be unit-length
+    // tangents so that {U, V, N} is an orthonormal set.  Define the matrix
+    // J = [U | V], a 3-by-2 matrix whose columns are U and V.  The shape matrix
+    //   S = J^T * dN/dX * J
+    // is 2-by-2 and its eigenvalues are the principal curvatures.  If k is a
+    // principal curvature and W is the eigenvector corresponding to it, then
+    // J*W is the principal direction for k.
+    Wm4::Vector3<double> kU, kV;
+    Wm4::Vector3<double>::GenerateComplementBasis(kU, kV, normal);
+
+    // In theory S is symmetric, but because dN/dX is estimated, make sure S is symmetric.
+    double fS01 = kU.Dot(dNormal * kV);
+    double fS10 = kV.Dot(dNormal * kU);
+    double fSAvr = 0.5 * (fS01 + fS10);
+    Wm4::Matrix2<double> kS(kU.Dot(dNormal * kU), fSAvr, fSAvr, kV.Dot(dNormal * kV));
+
+    // compute the eigenvalues of S (min and max curvatures)
+    double fTrace = kS[0][0] + kS[1][1];
+    double fDet = kS[0][0] * kS[1][1] - kS[0][1] * kS[1][0];
+    double fDiscr = fTrace * fTrace - 4.0 * fDet;
+    double fRootDiscr = std::sqrt(std::fabs(fDiscr));
+    double minCurvature = 0.5 * (fTrace - fRootDiscr);
+    double maxCurvature = 0.5 * (fTrace + fRootDiscr);
+
+    // compute the eigenvectors of S
+    auto direction = [&kS, &kU, &kV](double curvature) {
+        Wm4::Vector2<double> kW0(kS[0][1], curvature - kS[0][0]);
+        Wm4::Vector2<double> kW1(curvature - kS[1][1], kS[1][0]);
+        Wm4::Vector2<double>& kW = kW0.SquaredLength() >= kW1.SquaredLength() ? kW0 : kW1;
+        kW.Normalize();
+        Wm4::Vector3<double> dir = kW.X() * kU + kW.Y() * kV;
+        return Base::Vector3f(float(dir.X()), float(dir.Y()), float(dir.Z()));
+    };
+
+    CurvatureInfo ci;
+    ci.fMaxCurvature = float(maxCurvature);
+    ci.cMaxCurvDir = direction(maxCurvature);
+    ci.fMinCurvature = float(minCurvature);
+    ci.cMinCurvDir = direction(minCurvature);
+    return ci;
+}
+}  // namespace
+
 void MeshCurvature::ComputePerVertex()
 {
     myCurvature.clear();
 
-    // get all points
-    std::vector<Wm4::Vector3<double>> aPnts;
-    aPnts.reserve(myKernel.CountPoints());
-    MeshPointIterator cPIt(myKernel);
-    for (cPIt.Init(); cPIt.More(); cPIt.Next()) {
-        Wm4::Vector3<double> cP(cPIt->x, cPIt->y, cPIt->z);
-        aPnts.push_back(cP);
-    }
-
-    // get all point connections
-    std::vector<int> aIdx;
-    aIdx.reserve(3 * myKernel.CountFacets());
-    const MeshFacetArray& raFts = myKernel.GetFacets();
-    for (const auto& it : raFts) {
-        for (PointIndex point : it._aulPoints) {
-            aIdx.push_back(int(point));
-        }
-    }
-
     // in case of an empty mesh no curvature can be calculated
     if (myKernel.CountPoints() == 0 || myKernel.CountFacets() == 0) {
         return;
     }
 
-    // compute vertex based curvatures
-    Wm4::MeshCurvature<double>
-        meshCurv(myKernel.CountPoints(), aPnts.data(), myKernel.CountFacets(), aIdx.data());
+    // This is the algorithm of Wm4::MeshCurvature. But instead of scattering the values of
+    // the facets to their points the points gather them from their facets. This gives the
+    // same sums and allows to process the points in parallel.
+    const MeshPointArray& rPoints = myKernel.GetPoints();
+    const MeshFacetArray& rFacets = myKernel.GetFacets();
+    MeshPointFan fan(myKernel);
+    std::size_t numPoints = rPoints.size();
+    const std::size_t chunkSize = 65536;
+
+    auto vertex = [&rPoints](PointIndex index) {
+        const MeshPoint& p = rPoints[index];
+        return Wm4::Vector3<double>(p.x, p.y, p.z);
+    };
+
+    // compute normal vectors (length provides a weighted sum)
+    std::vector<Wm4::Vector3<double>> normals(numPoints);
+    ParallelChunks(numPoints, chunkSize, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            Wm4::Vector3<double> normal(0.0, 0.0, 0.0);
+            for (const std::size_t* it = fan.Begin(i); it != fan.End(i); ++it) {
+                const MeshFacet& facet = rFacets[*it / 3];
+                Wm4::Vector3<double> v0 = vertex(facet._aulPoints[0]);
+                Wm4::Vector3<double> kEdge1 = vertex(facet._aulPoints[1]) - v0;
+                Wm4::Vector3<double> kEdge2 = vertex(facet._aulPoints[2]) - v0;
+                normal += kEdge1.Cross(kEdge2);
+            }
+            normal.Normalize();
+            normals[i] = normal;
+        }
+    });
+
+    // compute the matrix of normal derivatives and the curvatures
+    myCurvature.resize(numPoints);
+    ParallelChunks(numPoints, chunkSize, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            const Wm4::Vector3<double>& n0 = normals[i];
+            Wm4::Vector3<double> v0 = vertex(i);
+            Wm4::Matrix3<double> akWWTrn(true);
+            Wm4::Matrix3<double> akDWTrn(true);
+
+            // Compute edge from V0 to V, project to tangent plane of vertex,
+            // and compute difference of adjacent normals.
+            auto addEdge = [&](PointIndex index) {
+                Wm4::Vector3<double> kE = vertex(index) - v0;
+                Wm4::Vector3<double> kW = kE - (kE.Dot(n0)) * n0;
+                Wm4::Vector3<double> kD = normals[index] - n0;
+                for (int iRow = 0; iRow < 3; iRow++) {
+                    for (int iCol = 0; iCol < 3; iCol++) {
+                        akWWTrn[iRow][iCol] += kW[iRow] * kW[iCol];
+                        akDWTrn[iRow][iCol] += kD[iRow] * kW[iCol];
+                    }
+                }
+            };
+
+            for (const std::size_t* it = fan.Begin(i); it != fan.End(i); ++it) {
+                const MeshFacet& facet = rFacets[*it / 3];
+                std::size_t corner = *it % 3;
+                addEdge(facet._aulPoints[(corner + 1) % 3]);
+                addEdge(facet._aulPoints[(corner + 2) % 3]);
+            }
 
-    // get curvature information now
-    const Wm4::Vector3<double>* aMaxCurvDir = meshCurv.GetMaxDirections();
-    const Wm4::Vector3<double>* aMinCurvDir = meshCurv.GetMinDirections();
-    const double* aMaxCurv = meshCurv.GetMaxCurvatures();
-    const double* aMinCurv = meshCurv.GetMinCurvatures();
+            // Add in N*N^T to W*W^T for numerical stability.
+            for (int iRow = 0; iRow < 3; iRow++) {
+                for (int iCol = 0; iCol < 3; iCol++) {
+                    akWWTrn[iRow][iCol] = 0.5 * akWWTrn[iRow][iCol] + n0[iRow] * n0[iCol];
+                    akDWTrn[iRow][iCol] *= 0.5;
+                }
+            }
 
-    myCurvature.reserve(myKernel.CountPoints());
-    for (unsigned long i = 0; i < myKernel.CountPoints(); i++) {
-        CurvatureInfo ci;
-        ci.cMaxCurvDir = Base::Vector3f(
-            (float)aMaxCurvDir[i].X(),
-            (float)aMaxCurvDir[i].Y(),
-            (float)aMaxCurvDir[i].Z()
-        );
-        ci.cMinCurvDir = Base::Vector3f(
-            (float)aMinCurvDir[i].X(),
-            (float)aMinCurvDir[i].Y(),
-            (float)aMinCurvDir[i].Z()
-        );
-        ci.fMaxCurvature = (float)aMaxCurv[i];
-        ci.fMinCurvature = (float)aMinCurv[i];
-        myCurvature.push_back(ci);
-    }
+            myCurvature[i] = PrincipalCurvatures(n0, akDWTrn * akWWTrn.Inverse());
+        }
+    });
 }
 #endif  // OPTIMIZE_CURVATURE
 
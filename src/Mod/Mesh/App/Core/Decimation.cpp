@@ -22,51 +22,275 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
+#include <array>
 #include <limits>
+#include <map>
+#include <numeric>
+#include <thread>
+
+#include <QtConcurrentMap>
 
 #include "Decimation.h"
+#include "Functional.h"
 #include "MeshKernel.h"
+#include "OutOfCore.h"
 #include "Simplify.h"
 
 
 using namespace MeshCore;
 
+namespace
+{
+struct Block
+{
+    std::vector<FacetIndex> facets;
+    int targetSize {};
+};
+
+// the local result of a block, locked points refer to their global index
+struct BlockResult
+{
+    std::vector<Base::Vector3f> points;
+    std::vector<int> globalIndex;
+    std::vector<std::array<int, 3>> triangles;
+};
+
+std::uint64_t SpreadBits(std::uint64_t value)
+{
+    // inserts two zero bits between each of the lower 21 bits
+    value &= 0x1fffff;
+    value = (value | value << 32) & 0x1f00000000ffffULL;
+    value = (value | value << 16) & 0x1f0000ff0000ffULL;
+    value = (value | value << 8) & 0x100f00f00f00f00fULL;
+    value = (value | value << 4) & 0x10c30c30c30c30c3ULL;
+    value = (value | value << 2) & 0x1249249249249249ULL;
+    return value;
+}
+
+void AddVertex(Simplify& alg, const MeshPoint& pnt, PointIndex index, int locked)
+{
+    Simplify::Vertex v;
+    v.tstart = 0;
+    v.tcount = 0;
+    v.border = 0;
+    v.p = pnt;
+    v.id = static_cast<int>(index);
+    v.locked = locked;
+    alg.vertices.push_back(v);
+}
+
+void AddTriangle(Simplify& alg, int v0, int v1, int v2)
+{
+    Simplify::Triangle t;
+    t.deleted = 0;
+    t.dirty = 0;
+    for (double& j : t.err) {
+        j = 0.0;
+    }
+    t.v[0] = v0;
+    t.v[1] = v1;
+    t.v[2] = v2;
+    alg.triangles.push_back(t);
+}
+
+// sets up the algorithm for the whole mesh
+void SetupAlgorithm(Simplify& alg, const MeshPointArray& points, const MeshFacetArray& facets)
+{
+    alg.vertices.reserve(points.size());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        AddVertex(alg, points[i], i, 0);
+    }
+
+    alg.triangles.reserve(facets.size());
+    for (const auto& facet : facets) {
+        AddTriangle(
+            alg,
+            static_cast<int>(facet._aulPoints[0]),
+            static_cast<int>(facet._aulPoints[1]),
+            static_cast<int>(facet._aulPoints[2])
+        );
+    }
+}
+
+// sets up the algorithm for the facets of a block
+void SetupAlgorithm(
+    Simplify& alg,
+    const MeshPointArray& points,
+    const MeshFacetArray& facets,
+    const std::vector<FacetIndex>& subset,
+    const std::vector<char>& locked
+)
+{
+    std::vector<PointIndex> used;
+    used.reserve(3 * subset.size());
+    for (FacetIndex index : subset) {
+        used.insert(used.end(), facets[index]._aulPoints, facets[index]._aulPoints + 3);
+    }
+    std::sort(used.begin(), used.end());
+    used.erase(std::unique(used.begin(), used.end()), used.end());
+
+    alg.vertices.reserve(used.size());
+    for (PointIndex index : used) {
+        AddVertex(alg, points[index], index, locked[index]);
+    }
+
+    auto localIndex = [&used](PointIndex index) {
+        return static_cast<int>(std::lower_bound(used.begin(), used.end(), index) - used.begin());
+    };
+    alg.triangles.reserve(subset.size());
+    for (FacetIndex index : subset) {
+        const MeshFacet& facet = facets[index];
+        AddTriangle(
+            alg,
+            localIndex(facet._aulPoints[0]),
+            localIndex(facet._aulPoints[1]),
+            localIndex(facet._aulPoints[2])
+        );
+    }
+}
+}  // namespace
+
 MeshSimplify::MeshSimplify(MeshKernel& mesh)
     : myKernel(mesh)
 {}
 
+void MeshSimplify::setBlockSize(std::size_t size)
+{
+    blockSize = size;
+}
+
 void MeshSimplify::simplify(float tolerance, float reduction)
 {
-    Simplify alg;
+    std::size_t numFacets = myKernel.CountFacets();
+    int target_count = static_cast<int>(static_cast<float>(numFacets) * (1.0F - reduction));
+    if (blockSize > 0 && numFacets > 2 * blockSize) {
+        simplifyBlocks(target_count, tolerance);
+    }
+    else {
+        simplifyMesh(target_count, tolerance);
+    }
+}
 
-    const MeshPointArray& points = myKernel.GetPoints();
-    for (std::size_t i = 0; i < points.size(); i++) {
-        Simplify::Vertex v;
-        v.tstart = 0;
-        v.tcount = 0;
-        v.border = 0;
-        v.p = points[i];
-        alg.vertices.push_back(v);
+void MeshSimplify::simplify(int targetSize)
+{
+    std::size_t numFacets = myKernel.CountFacets();
+    if (blockSize > 0 && numFacets > 2 * blockSize) {
+        simplifyBlocks(targetSize, std::numeric_limits<float>::max());
+    }
+    else {
+        simplifyMesh(targetSize, std::numeric_limits<float>::max());
+    }
+}
+
+void MeshSimplify::simplify(const MeshOutOfCore& store, int targetSize)
+{
+    const std::size_t numFacets = store.CountFacets();
+    if (numFacets == 0) {
+        myKernel.Clear();
+        return;
     }
 
-    const MeshFacetArray& facets = myKernel.GetFacets();
-    for (std::size_t i = 0; i < facets.size(); i++) {
-        Simplify::Triangle t;
-        t.deleted = 0;
-        t.dirty = 0;
-        for (double& j : t.err) {
-            j = 0.0;
+    double ratio = double(std::max(targetSize, 0)) / double(numFacets);
+    std::vector<std::size_t> chunks(store.CountChunks());
+    std::iota(chunks.begin(), chunks.end(), 0);
+
+    // simplify the chunks in parallel, only the reduced chunks are kept in memory
+    std::vector<BlockResult> results = QtConcurrent::blockingMapped<std::vector<BlockResult>>(
+        chunks,
+        [&](std::size_t chunk) {
+            MeshPointArray points;
+            MeshFacetArray facets;
+            store.GetChunk(chunk, points, facets);
+
+            // points on open edges may be shared with other chunks and are locked
+            std::map<std::pair<PointIndex, PointIndex>, int> edges;
+            for (const auto& facet : facets) {
+                for (int i = 0; i < 3; i++) {
+                    PointIndex p0 = facet._aulPoints[i];
+                    PointIndex p1 = facet._aulPoints[(i + 1) % 3];
+                    edges[std::minmax(p0, p1)]++;
+                }
+            }
+            std::vector<char> locked(points.size(), 0);
+            for (const auto& it : edges) {
+                if (it.second == 1) {
+                    locked[it.first.first] = 1;
+                    locked[it.first.second] = 1;
+                }
+            }
+            edges.clear();
+
+            Simplify alg;
+            std::vector<FacetIndex> subset(facets.size());
+            std::iota(subset.begin(), subset.end(), 0);
+            SetupAlgorithm(alg, points, facets, subset, locked);
+            alg.simplify_mesh(
+                static_cast<int>(double(facets.size()) * ratio),
+                std::numeric_limits<float>::max()
+            );
+
+            // locked points are marked by a non-negative index
+            BlockResult result;
+            for (const auto& vertex : alg.vertices) {
+                result.points.push_back(vertex.p);
+                result.globalIndex.push_back(vertex.locked ? vertex.id : -1);
+            }
+            for (const auto& triangle : alg.triangles) {
+                if (!triangle.deleted) {
+                    result.triangles.push_back({triangle.v[0], triangle.v[1], triangle.v[2]});
+                }
+            }
+            return result;
         }
-        for (int j = 0; j < 3; j++) {
-            t.v[j] = facets[i]._aulPoints[j];
+    );
+
+    // stitch the chunks together, the locked points of the chunks have identical coordinates
+    MeshPointArray new_points;
+    MeshFacetArray new_facets;
+    std::map<std::array<float, 3>, PointIndex> lockedIndex;
+    for (const auto& result : results) {
+        std::vector<PointIndex> newIndex(result.points.size());
+        for (std::size_t i = 0; i < result.points.size(); i++) {
+            const Base::Vector3f& pnt = result.points[i];
+            if (result.globalIndex[i] >= 0) {
+                auto it = lockedIndex.emplace(std::array<float, 3> {pnt.x, pnt.y, pnt.z}, 0);
+                if (!it.second) {
+                    newIndex[i] = it.first->second;
+                    continue;
+                }
+                it.first->second = new_points.size();
+            }
+            newIndex[i] = new_points.size();
+            new_points.push_back(pnt);
+        }
+        for (const auto& triangle : result.triangles) {
+            MeshFacet face;
+            face._aulPoints[0] = newIndex[triangle[0]];
+            face._aulPoints[1] = newIndex[triangle[1]];
+            face._aulPoints[2] = newIndex[triangle[2]];
+            new_facets.push_back(face);
         }
-        alg.triangles.push_back(t);
     }
+    results.clear();
+    lockedIndex.clear();
+
+    myKernel.Adopt(new_points, new_facets, true);
 
-    int target_count = static_cast<int>(static_cast<float>(facets.size()) * (1.0F - reduction));
+    // a final pass over the whole mesh also simplifies the regions along the chunk borders
+    simplifyMesh(targetSize, std::numeric_limits<float>::max());
+}
+
+void MeshSimplify::simplifyMesh(int targetSize, double tolerance)
+{
+    Simplify alg;
+
+    const MeshPointArray& points = myKernel.GetPoints();
+    const MeshFacetArray& facets = myKernel.GetFacets();
+    SetupAlgorithm(alg, points, facets);
 
     // Simplification starts
-    alg.simplify_mesh(target_count, tolerance);
+    alg.simplify_mesh(targetSize, tolerance);
 
     // Simplification done
     MeshPointArray new_points;
@@ -96,61 +320,120 @@ void MeshSimplify::simplify(float tolerance, float reduction)
     myKernel.Adopt(new_points, new_facets, true);
 }
 
-void MeshSimplify::simplify(int targetSize)
+void MeshSimplify::simplifyBlocks(int targetSize, double tolerance)
 {
-    Simplify alg;
-
     const MeshPointArray& points = myKernel.GetPoints();
-    for (std::size_t i = 0; i < points.size(); i++) {
-        Simplify::Vertex v;
-        v.tstart = 0;
-        v.tcount = 0;
-        v.border = 0;
-        v.p = points[i];
-        alg.vertices.push_back(v);
+    const MeshFacetArray& facets = myKernel.GetFacets();
+    const std::size_t numFacets = facets.size();
+
+    // order the facets along a Morton curve of their centers to get spatially coherent blocks
+    Base::BoundBox3f bbox = myKernel.GetBoundBox();
+    const float maxCode = float(0x1fffff);
+    auto scale = [&](float value, float min, float len) {
+        return len > 0.0F ? std::uint64_t(std::clamp((value - min) / len, 0.0F, 1.0F) * maxCode) : 0;
+    };
+    std::vector<std::pair<std::uint64_t, FacetIndex>> codes(numFacets);
+    for (std::size_t i = 0; i < numFacets; i++) {
+        const MeshFacet& facet = facets[i];
+        Base::Vector3f center = (points[facet._aulPoints[0]] + points[facet._aulPoints[1]]
+                                 + points[facet._aulPoints[2]])
+            / 3.0F;
+        codes[i].first = SpreadBits(scale(center.x, bbox.MinX, bbox.LengthX()))
+            | SpreadBits(scale(center.y, bbox.MinY, bbox.LengthY())) << 1
+            | SpreadBits(scale(center.z, bbox.MinZ, bbox.LengthZ())) << 2;
+        codes[i].second = i;
     }
+    int threads = int(std::thread::hardware_concurrency());
+    MeshCore::parallel_sort(codes.begin(), codes.end(), std::less<>(), threads);
 
-    const MeshFacetArray& facets = myKernel.GetFacets();
-    for (std::size_t i = 0; i < facets.size(); i++) {
-        Simplify::Triangle t;
-        t.deleted = 0;
-        t.dirty = 0;
-        for (double& j : t.err) {
-            j = 0.0;
-        }
-        for (int j = 0; j < 3; j++) {
-            t.v[j] = facets[i]._aulPoints[j];
-        }
-        alg.triangles.push_back(t);
+    const std::size_t numBlocks = (numFacets + blockSize - 1) / blockSize;
+    std::vector<Block> blocks(numBlocks);
+    std::vector<std::uint32_t> blockOf(numFacets);
+    for (std::size_t i = 0; i < numFacets; i++) {
+        std::size_t block = i / blockSize;
+        blocks[block].facets.push_back(codes[i].second);
+        blockOf[codes[i].second] = static_cast<std::uint32_t>(block);
     }
+    codes.clear();
+    codes.shrink_to_fit();
 
-    // Simplification starts
-    alg.simplify_mesh(targetSize, std::numeric_limits<float>::max());
+    // points used by facets of different blocks are locked
+    const std::uint32_t none = std::numeric_limits<std::uint32_t>::max();
+    std::vector<std::uint32_t> owner(points.size(), none);
+    std::vector<char> locked(points.size(), 0);
+    for (std::size_t i = 0; i < numFacets; i++) {
+        for (PointIndex index : facets[i]._aulPoints) {
+            if (owner[index] == none) {
+                owner[index] = blockOf[i];
+            }
+            else if (owner[index] != blockOf[i]) {
+                locked[index] = 1;
+            }
+        }
+    }
+    owner.clear();
+    owner.shrink_to_fit();
+    blockOf.clear();
+    blockOf.shrink_to_fit();
 
-    // Simplification done
-    MeshPointArray new_points;
-    new_points.reserve(alg.vertices.size());
-    for (const auto& vertex : alg.vertices) {
-        new_points.push_back(vertex.p);
+    double ratio = double(std::max(targetSize, 0)) / double(numFacets);
+    for (auto& block : blocks) {
+        block.targetSize = static_cast<int>(double(block.facets.size()) * ratio);
     }
 
-    std::size_t numFacets = 0;
-    for (const auto& triangle : alg.triangles) {
-        if (!triangle.deleted) {
-            numFacets++;
+    // simplify the blocks in parallel
+    std::vector<BlockResult> results = QtConcurrent::blockingMapped<std::vector<BlockResult>>(
+        blocks,
+        [&](const Block& block) {
+            Simplify alg;
+            SetupAlgorithm(alg, points, facets, block.facets, locked);
+            alg.simplify_mesh(block.targetSize, tolerance);
+
+            BlockResult result;
+            for (const auto& vertex : alg.vertices) {
+                result.points.push_back(vertex.p);
+                result.globalIndex.push_back(vertex.locked ? vertex.id : -1);
+            }
+            for (const auto& triangle : alg.triangles) {
+                if (!triangle.deleted) {
+                    result.triangles.push_back({triangle.v[0], triangle.v[1], triangle.v[2]});
+                }
+            }
+            return result;
         }
-    }
+    );
+    blocks.clear();
+
+    // stitch the blocks together, the locked points are shared by the blocks
+    MeshPointArray new_points;
     MeshFacetArray new_facets;
-    new_facets.reserve(numFacets);
-    for (const auto& triangle : alg.triangles) {
-        if (!triangle.deleted) {
+    std::vector<PointIndex> lockedIndex(points.size(), POINT_INDEX_MAX);
+    for (const auto& result : results) {
+        std::vector<PointIndex> newIndex(result.points.size());
+        for (std::size_t i = 0; i < result.points.size(); i++) {
+            int global = result.globalIndex[i];
+            if (global >= 0 && lockedIndex[global] != POINT_INDEX_MAX) {
+                newIndex[i] = lockedIndex[global];
+                continue;
+            }
+            newIndex[i] = new_points.size();
+            new_points.push_back(result.points[i]);
+            if (global >= 0) {
+                lockedIndex[global] = newIndex[i];
+            }
+        }
+        for (const auto& triangle : result.triangles) {
             MeshFacet face;
-            face._aulPoints[0] = triangle.v[0];
-            face._aulPoints[1] = triangle.v[1];
-            face._aulPoints[2] = triangle.v[2];
+            face._aulPoints[0] = newIndex[triangle[0]];
+            face._aulPoints[1] = newIndex[triangle[1]];
+            face._aulPoints[2] = newIndex[triangle[2]];
             new_facets.push_back(face);
         }
     }
+    results.clear();
 
     myKernel.Adopt(new_points, new_facets, true);
+
+    // a final pass over the whole mesh also simplifies the regions along the block borders
+    simplifyMesh(targetSize, tolerance);
 }
@@ -22,24 +22,47 @@
  *                                                                         *
  ***************************************************************************/
 
-
 #pragma once
 
+#include <cstddef>
+
 #include <Mod/Mesh/MeshGlobal.h>
 
 namespace MeshCore
 {
 class MeshKernel;
+class MeshOutOfCore;
 
 class MeshExport MeshSimplify
 {
 public:
+    /// Default count of facets per block
+    static constexpr std::size_t defaultBlockSize = 500000;
+
     explicit MeshSimplify(MeshKernel&);
     void simplify(float tolerance, float reduction);
     void simplify(int targetSize);
+    /** Replaces the mesh by a simplified version of the mesh in \a store with about
+     * \a targetSize facets. The chunks of the store are loaded and simplified in parallel while
+     * the points on their open edges are kept, so only the reduced chunks have to fit into
+     * memory. The kept points are merged by their coordinates and a final pass over the whole
+     * mesh simplifies the regions along the chunk borders.
+     */
+    void simplify(const MeshOutOfCore& store, int targetSize);
+    /** Meshes with more than twice \a size facets are split into spatially coherent blocks of
+     * about \a size facets. The blocks are simplified in parallel while the points they share
+     * with other blocks are kept. A final pass over the whole reduced mesh then simplifies the
+     * regions around these points. With 0 the mesh is always simplified as a whole.
+     */
+    void setBlockSize(std::size_t size);
+
+private:
+    void simplifyMesh(int targetSize, double tolerance);
+    void simplifyBlocks(int targetSize, double tolerance);
 
 private:
     MeshKernel& myKernel;
+    std::size_t blockSize {defaultBlockSize};
 };
 
 }  // namespace MeshCore
@@ -22,7 +22,11 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
 #include <limits>
+#include <numeric>
+
+#include <QtConcurrentMap>
 
 #include <Mod/Mesh/App/WildMagic4/Wm4DistSegment3Triangle3.h>
 #include <Mod/Mesh/App/WildMagic4/Wm4DistVector3Triangle3.h>
@@ -38,6 +42,71 @@
 using namespace MeshCore;
 using namespace Wm4;
 
+namespace
+{
+// the number of points handled by a task
+constexpr std::size_t pointChunkSize = 65536;
+
+std::size_t CountPointChunks(std::size_t count)
+{
+    return std::max<std::size_t>(1, (count + pointChunkSize - 1) / pointChunkSize);
+}
+
+// Calls func(chunk, begin, end) for consecutive ranges of [0, count). The loops over the points
+// are limited by memory bandwidth, so large arrays are processed in parallel.
+template<class Func>
+void ForEachPointChunk(std::size_t count, Func func)
+{
+    std::vector<std::size_t> chunks(CountPointChunks(count));
+    if (chunks.size() == 1) {
+        func(std::size_t(0), std::size_t(0), count);
+        return;
+    }
+
+    std::iota(chunks.begin(), chunks.end(), 0);
+    QtConcurrent::blockingMap(chunks, [&](std::size_t& chunk) {
+        func(chunk, chunk * pointChunkSize, std::min(count, (chunk + 1) * pointChunkSize));
+    });
+}
+
+// Branch-free bounding box of a range of points
+struct PointRangeBox
+{
+    float min[3] {
+        std::numeric_limits<float>::max(),
+        std::numeric_limits<float>::max(),
+        std::numeric_limits<float>::max()
+    };
+    float max[3] {
+        -std::numeric_limits<float>::max(),
+        -std::numeric_limits<float>::max(),
+        -std::numeric_limits<float>::max()
+    };
+
+    void Add(float x, float y, float z)
+    {
+        min[0] = std::min(min[0], x);
+        min[1] = std::min(min[1], y);
+        min[2] = std::min(min[2], z);
+        max[0] = std::max(max[0], x);
+        max[1] = std::max(max[1], y);
+        max[2] = std::max(max[2], z);
+    }
+
+    static Base::BoundBox3f Join(const std::vector<PointRangeBox>& boxes)
+    {
+        PointRangeBox all;
+        for (const auto& box : boxes) {
+            for (int i = 0; i < 3; i++) {
+                all.min[i] = std::min(all.min[i], box.min[i]);
+                all.max[i] = std::max(all.max[i], box.max[i]);
+            }
+        }
+        return Base::BoundBox3f(all.min[0], all.min[1], all.min[2], all.max[0], all.max[1], all.max[2]);
+    }
+};
+}  // namespace
+
 MeshPointArray::MeshPointArray(const MeshPointArray& ary) = default;
 
 MeshPointArray::MeshPointArray(MeshPointArray&& ary) = default;
@@ -100,9 +169,50 @@ MeshPointArray& MeshPointArray::operator=(MeshPointArray&& rclPAry) = default;
 
 void MeshPointArray::Transform(const Base::Matrix4D& mat)
 {
-    for (auto& pP : *this) {
-        mat.multVec(pP, pP);
-    }
+    Base::BoundBox3f box;
+    Transform(mat, box);
+}
+
+void MeshPointArray::Transform(const Base::Matrix4D& mat, Base::BoundBox3f& rclBox)
+{
+    // same computation as Base::Matrix4D::multVec()
+    const double m00 = mat[0][0], m01 = mat[0][1], m02 = mat[0][2], m03 = mat[0][3];
+    const double m10 = mat[1][0], m11 = mat[1][1], m12 = mat[1][2], m13 = mat[1][3];
+    const double m20 = mat[2][0], m21 = mat[2][1], m22 = mat[2][2], m23 = mat[2][3];
+
+    MeshPoint* points = data();
+    std::vector<PointRangeBox> boxes(CountPointChunks(size()));
+    ForEachPointChunk(size(), [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+        PointRangeBox box;
+        for (std::size_t i = begin; i < end; i++) {
+            MeshPoint& pnt = points[i];
+            const double sx = static_cast<double>(pnt.x);
+            const double sy = static_cast<double>(pnt.y);
+            const double sz = static_cast<double>(pnt.z);
+            pnt.x = static_cast<float>(m00 * sx + m01 * sy + m02 * sz + m03);
+            pnt.y = static_cast<float>(m10 * sx + m11 * sy + m12 * sz + m13);
+            pnt.z = static_cast<float>(m20 * sx + m21 * sy + m22 * sz + m23);
+            box.Add(pnt.x, pnt.y, pnt.z);
+        }
+        boxes[chunk] = box;
+    });
+
+    rclBox = PointRangeBox::Join(boxes);
+}
+
+Base::BoundBox3f MeshPointArray::GetBoundBox() const
+{
+    const MeshPoint* points = data();
+    std::vector<PointRangeBox> boxes(CountPointChunks(size()));
+    ForEachPointChunk(size(), [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+        PointRangeBox box;
+        for (std::size_t i = begin; i < end; i++) {
+            box.Add(points[i].x, points[i].y, points[i].z);
+        }
+        boxes[chunk] = box;
+    });
+
+    return PointRangeBox::Join(boxes);
 }
 
 MeshFacetArray::MeshFacetArray(const MeshFacetArray& ary) = default;
@@ -734,6 +734,11 @@ public:
     MeshPointArray& operator=(const MeshPointArray& rclPAry);
     MeshPointArray& operator=(MeshPointArray&& rclPAry);
     void Transform(const Base::Matrix4D&);
+    /** Transforms all points and computes the bounding box of the transformed points in the same
+     * pass over the array. */
+    void Transform(const Base::Matrix4D&, Base::BoundBox3f& rclBox);
+    /** Computes the bounding box of all points. */
+    Base::BoundBox3f GetBoundBox() const;
     /**
      * Searches for the first point index  Two points are equal if the distance is less
      * than EPSILON. If no such points is found POINT_INDEX_MAX is returned.
@@ -0,0 +1,370 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <set>
+
+#include <QtConcurrentMap>
+#include <QtConcurrentRun>
+
+#include "Algorithm.h"
+#include "Degeneration.h"
+#include "EvalPipeline.h"
+#include "Evaluation.h"
+#include "MeshKernel.h"
+#include "TopoAlgorithm.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+// the number of points handled by a task
+constexpr std::size_t pointChunkSize = 65536;
+
+// the defects found around a range of points
+struct PointDefects
+{
+    std::vector<std::pair<PointIndex, PointIndex>> nonManifoldEdges;
+    std::list<std::vector<FacetIndex>> nonManifoldFacets;
+    std::vector<FacetIndex> neighbourhoodFacets;
+    std::vector<PointIndex> nonManifoldPoints;
+    std::vector<FacetIndex> facetsOfNonManifoldPoints;
+};
+
+// Each edge is handled by its point with the lower index. This gives the same edges as the sorted
+// edge lists of MeshEvalTopology and MeshEvalNeighbourhood, and the same neighbour points as
+// MeshRefPointToPoints.
+PointDefects CheckPoints(
+    const MeshFacetArray& rFacets,
+    const MeshRefPointToFacets& vf_it,
+    PointIndex begin,
+    PointIndex end,
+    bool manifoldPoints
+)
+{
+    PointDefects defects;
+    std::vector<std::pair<PointIndex, FacetIndex>> edges;
+    std::vector<PointIndex> points;
+    for (PointIndex index = begin; index < end; index++) {
+        const std::set<FacetIndex>& nf = vf_it[index];
+        edges.clear();
+        points.clear();
+        for (FacetIndex facet : nf) {
+            const MeshFacet& rFace = rFacets[facet];
+            for (int i = 0; i < 3; i++) {
+                PointIndex p0 = rFace._aulPoints[i];
+                PointIndex p1 = rFace._aulPoints[(i + 1) % 3];
+                if (std::min<PointIndex>(p0, p1) == index) {
+                    edges.emplace_back(std::max<PointIndex>(p0, p1), facet);
+                }
+                if (p0 == index) {
+                    points.push_back(p1);
+                    points.push_back(rFace._aulPoints[(i + 2) % 3]);
+                }
+            }
+        }
+
+        std::sort(edges.begin(), edges.end());
+        for (auto it = edges.begin(); it != edges.end();) {
+            PointIndex other = it->first;
+            auto next = std::find_if(it, edges.end(), [other](const auto& edge) {
+                return edge.first != other;
+            });
+
+            auto count = std::distance(it, next);
+            if (count > 2) {
+                // edge that is shared by more than 2 facets
+                defects.nonManifoldEdges.emplace_back(index, other);
+                std::vector<FacetIndex>& facets = defects.nonManifoldFacets.emplace_back();
+                facets.reserve(count);
+                std::transform(it, next, std::back_inserter(facets), [](const auto& edge) {
+                    return edge.second;
+                });
+            }
+            else if (count == 2) {
+                // check whether both facets reference each other as neighbours
+                FacetIndex f0 = it->second;
+                FacetIndex f1 = std::next(it)->second;
+                const MeshFacet& rFace0 = rFacets[f0];
+                const MeshFacet& rFace1 = rFacets[f1];
+                if (rFace0._aulNeighbours[rFace0.Side(index, other)] != f1
+                    || rFace1._aulNeighbours[rFace1.Side(index, other)] != f0) {
+                    defects.neighbourhoodFacets.push_back(f0);
+                    defects.neighbourhoodFacets.push_back(f1);
+                }
+            }
+            else {
+                // should be an open edge
+                FacetIndex f0 = it->second;
+                const MeshFacet& rFace = rFacets[f0];
+                if (rFace._aulNeighbours[rFace.Side(index, other)] != FACET_INDEX_MAX) {
+                    defects.neighbourhoodFacets.push_back(f0);
+                }
+            }
+
+            it = next;
+        }
+
+        if (manifoldPoints) {
+            // see MeshEvalPointManifolds
+            std::sort(points.begin(), points.end());
+            points.erase(std::unique(points.begin(), points.end()), points.end());
+            if (points.size() > nf.size() + 1) {
+                defects.nonManifoldPoints.push_back(index);
+                defects.facetsOfNonManifoldPoints.insert(
+                    defects.facetsOfNonManifoldPoints.end(),
+                    nf.begin(),
+                    nf.end()
+                );
+            }
+        }
+    }
+
+    return defects;
+}
+
+void SortUnique(std::vector<FacetIndex>& indices)
+{
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+}
+
+template<class T>
+void Append(std::vector<T>& vec, const std::vector<T>& other)
+{
+    vec.insert(vec.end(), other.begin(), other.end());
+}
+
+}  // namespace
+
+bool MeshEvalPipeline::Result::IsValid() const
+{
+    return indexError == IndexError::None && flippedFacets.empty() && duplicatedFacets.empty()
+        && duplicatedPoints.empty() && degeneratedFacets.empty() && nonManifoldEdges.empty()
+        && nonManifoldPoints.empty() && selfIntersections.empty() && folds.empty();
+}
+
+MeshEvalPipeline::Result MeshEvalPipeline::Evaluate(const Settings& settings) const
+{
+    Result result;
+
+    // with indices out of range all other checks would crash
+    MeshEvalRangeFacet rf(_rclMesh);
+    if (!rf.Evaluate()) {
+        result.indexError = IndexError::FacetRange;
+        result.invalidIndices = rf.GetIndices();
+        return result;
+    }
+
+    MeshEvalRangePoint rp(_rclMesh);
+    if (!rp.Evaluate()) {
+        result.indexError = IndexError::PointRange;
+        result.invalidIndices = rp.GetIndices();
+        return result;
+    }
+
+    // The orientation check sets flags of the facets while MeshKernel::GetFacet() reads them.
+    // So, in a first step it only runs concurrently to the checks that don't create a
+    // MeshGeomFacet.
+    auto flipped = QtConcurrent::run([this]() {
+        return MeshEvalOrientation(_rclMesh).GetIndices();
+    });
+    auto duplicatedFacets = QtConcurrent::run([this]() {
+        return MeshEvalDuplicateFacets(_rclMesh).GetIndices();
+    });
+    auto duplicatedPoints = QtConcurrent::run([this]() {
+        return MeshEvalDuplicatePoints(_rclMesh).GetIndices();
+    });
+    auto corrupted = QtConcurrent::run([this]() {
+        return MeshEvalCorruptedFacets(_rclMesh).GetIndices();
+    });
+
+    // the neighbourhood of the points is shared by all the topological checks
+    {
+        const MeshFacetArray& rFacets = _rclMesh.GetFacets();
+        MeshRefPointToFacets vf_it(_rclMesh);
+
+        std::size_t numPoints = _rclMesh.CountPoints();
+        std::vector<std::size_t> chunks((numPoints + pointChunkSize - 1) / pointChunkSize);
+        std::iota(chunks.begin(), chunks.end(), 0);
+
+        bool manifoldPoints = settings.nonManifoldPoints;
+        std::vector<PointDefects> defects = QtConcurrent::blockingMapped<std::vector<PointDefects>>(
+            chunks,
+            [&rFacets, &vf_it, numPoints, manifoldPoints](std::size_t chunk) {
+                auto begin = static_cast<PointIndex>(chunk * pointChunkSize);
+                auto end = static_cast<PointIndex>(std::min(begin + pointChunkSize, numPoints));
+                return CheckPoints(rFacets, vf_it, begin, end, manifoldPoints);
+            }
+        );
+
+        for (auto& it : defects) {
+            Append(result.nonManifoldEdges, it.nonManifoldEdges);
+            result.nonManifoldFacets.splice(result.nonManifoldFacets.end(), it.nonManifoldFacets);
+            Append(result.neighbourhoodFacets, it.neighbourhoodFacets);
+            Append(result.nonManifoldPoints, it.nonManifoldPoints);
+            Append(result.facetsOfNonManifoldPoints, it.facetsOfNonManifoldPoints);
+        }
+
+        SortUnique(result.neighbourhoodFacets);
+        SortUnique(result.facetsOfNonManifoldPoints);
+    }
+
+    result.flippedFacets = flipped.result();
+    result.duplicatedFacets = duplicatedFacets.result();
+    result.duplicatedPoints = duplicatedPoints.result();
+    result.corruptedFacets = corrupted.result();
+
+    // the remaining checks only read the mesh
+    float epsilon = settings.degeneratedEpsilon;
+    auto degenerated = QtConcurrent::run([this, epsilon]() {
+        return MeshEvalDegeneratedFacets(_rclMesh, epsilon).GetIndices();
+    });
+    auto folds = QtConcurrent::run([this, &settings]() {
+        std::vector<FacetIndex> indices;
+        if (settings.folds) {
+            MeshEvalFoldsOnSurface s_eval(_rclMesh);
+            MeshEvalFoldsOnBoundary b_eval(_rclMesh);
+            MeshEvalFoldOversOnSurface f_eval(_rclMesh);
+            s_eval.Evaluate();
+            b_eval.Evaluate();
+            f_eval.Evaluate();
+            indices = f_eval.GetIndices();
+            Append(indices, s_eval.GetIndices());
+            Append(indices, b_eval.GetIndices());
+            SortUnique(indices);
+        }
+        return indices;
+    });
+
+    // the self-intersection check runs in parallel on its own
+    MeshEvalSelfIntersection eval(_rclMesh);
+    eval.GetIntersections(result.selfIntersections);
+
+    result.degeneratedFacets = degenerated.result();
+    result.folds = folds.result();
+
+    if (!result.corruptedFacets.empty()) {
+        result.indexError = IndexError::Corrupted;
+        result.invalidIndices = result.corruptedFacets;
+    }
+    else if (!result.neighbourhoodFacets.empty()) {
+        result.indexError = IndexError::Neighbourhood;
+        result.invalidIndices = result.neighbourhoodFacets;
+    }
+
+    return result;
+}
+
+// ----------------------------------------------------------------------
+
+bool MeshFixPipeline::FixupIndices(const MeshEvalPipeline::Result& result)
+{
+    // see MeshObject::validateIndices()
+    _rclMesh.RebuildNeighbours();
+    if (result.indexError == MeshEvalPipeline::IndexError::PointRange) {
+        MeshFixRangePoint fix(_rclMesh);
+        fix.Fixup();
+    }
+
+    MeshEvalCorruptedFacets cf(_rclMesh);
+    if (!cf.Evaluate()) {
+        MeshFixCorruptedFacets fix(_rclMesh);
+        fix.Fixup();
+    }
+
+    return true;
+}
+
+bool MeshFixPipeline::Fixup(const MeshEvalPipeline::Result& result)
+{
+    deletedFaces.clear();
+
+    using IndexError = MeshEvalPipeline::IndexError;
+    if (result.indexError == IndexError::FacetRange || result.indexError == IndexError::PointRange) {
+        return FixupIndices(result);
+    }
+
+    if (result.IsValid()) {
+        return false;
+    }
+
+    // collect all facets to be removed
+    if (!result.nonManifoldFacets.empty()) {
+        MeshFixTopology fix(_rclMesh, result.nonManifoldFacets);
+        Append(deletedFaces, fix.GetFacets());
+    }
+    if (!result.selfIntersections.empty()) {
+        MeshFixSelfIntersection fix(_rclMesh, result.selfIntersections);
+        Append(deletedFaces, fix.GetFacets());
+    }
+    if (_settings.nonManifoldPoints) {
+        Append(deletedFaces, result.facetsOfNonManifoldPoints);
+    }
+    if (_settings.folds) {
+        Append(deletedFaces, result.folds);
+    }
+    Append(deletedFaces, result.duplicatedFacets);
+    SortUnique(deletedFaces);
+
+    // this also repairs the invalid neighbour indices
+    if (!deletedFaces.empty() || result.indexError == IndexError::Neighbourhood) {
+        _rclMesh.DeleteFacets(deletedFaces);
+        _rclMesh.RebuildNeighbours();
+    }
+
+    // removing facets may create new folds on the boundary, see MeshObject::removeFoldsOnSurface()
+    if (_settings.folds && !deletedFaces.empty()) {
+        for (int i = 0; i < 5; i++) {
+            MeshEvalFoldsOnBoundary b_eval(_rclMesh);
+            if (b_eval.Evaluate()) {
+                break;
+            }
+            _rclMesh.DeleteFacets(b_eval.GetIndices());
+        }
+    }
+
+    // these fixes modify the topology around the defects and thus are applied afterwards
+    if (!result.corruptedFacets.empty()) {
+        MeshFixCorruptedFacets fix(_rclMesh);
+        fix.Fixup();
+    }
+    if (!result.degeneratedFacets.empty()) {
+        MeshFixDegeneratedFacets fix(_rclMesh, _settings.degeneratedEpsilon);
+        fix.Fixup();
+    }
+    if (!result.flippedFacets.empty()) {
+        MeshTopoAlgorithm(_rclMesh).HarmonizeNormals();
+    }
+    if (!result.duplicatedPoints.empty()) {
+        MeshFixDuplicatePoints fix(_rclMesh);
+        fix.Fixup();
+    }
+
+    return true;
+}
@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+#pragma once
+
+#include <list>
+#include <utility>
+#include <vector>
+
+#include "Definitions.h"
+
+
+namespace MeshCore
+{
+
+class MeshKernel;
+
+/**
+ * The MeshEvalPipeline class runs the checks of the mesh evaluation dialog in one go.
+ *
+ * The checks that need the neighbourhood of the points share one MeshRefPointToFacets: the
+ * non-manifold edges, the neighbour indices and the non-manifold points are all collected
+ * from it in a single parallel pass over the points instead of each check sorting its own
+ * edge list. The checks that only work on the facet or point array run concurrently to this
+ * pass. The results are the same as of the single evaluators.
+ * \note No Base::SequencerLauncher is used so that the checks can run in any thread.
+ */
+class MeshExport MeshEvalPipeline
+{
+public:
+    /** Describes the first kind of invalid indices found, in the order they are checked. */
+    enum class IndexError
+    {
+        None,
+        FacetRange,    /**< @see MeshEvalRangeFacet */
+        PointRange,    /**< @see MeshEvalRangePoint */
+        Corrupted,     /**< @see MeshEvalCorruptedFacets */
+        Neighbourhood  /**< @see MeshEvalNeighbourhood */
+    };
+
+    struct Settings
+    {
+        float degeneratedEpsilon {MeshDefinitions::_fMinPointDistanceP2};
+        bool nonManifoldPoints {false};
+        bool folds {false};
+    };
+
+    struct Result
+    {
+        IndexError indexError {IndexError::None};
+        std::vector<FacetIndex> invalidIndices;
+        std::vector<FacetIndex> corruptedFacets;
+        std::vector<FacetIndex> neighbourhoodFacets;
+        std::vector<FacetIndex> flippedFacets;
+        std::vector<FacetIndex> duplicatedFacets;
+        std::vector<PointIndex> duplicatedPoints;
+        std::vector<FacetIndex> degeneratedFacets;
+        /** The point indices of the non-manifold edges, @see MeshEvalTopology::GetIndices() */
+        std::vector<std::pair<PointIndex, PointIndex>> nonManifoldEdges;
+        /** The facets of each non-manifold edge, @see MeshEvalTopology::GetFacets() */
+        std::list<std::vector<FacetIndex>> nonManifoldFacets;
+        std::vector<PointIndex> nonManifoldPoints;
+        /** The facets of all non-manifold points, sorted and without duplicates */
+        std::vector<FacetIndex> facetsOfNonManifoldPoints;
+        std::vector<std::pair<FacetIndex, FacetIndex>> selfIntersections;
+        /** The union of all kind of folds, sorted and without duplicates */
+        std::vector<FacetIndex> folds;
+
+        /** Returns true if no defect has been found. */
+        bool IsValid() const;
+    };
+
+    explicit MeshEvalPipeline(const MeshKernel& rclM)
+        : _rclMesh(rclM)
+    {}
+
+    /** Runs all checks enabled in \a settings. If facet or point indices are out of range only
+     * the index check is done because all other checks would access invalid memory.
+     * \note The orientation check uses the VISIT and TMP0 flags of the facets.
+     */
+    Result Evaluate(const Settings& settings) const;
+
+private:
+    const MeshKernel& _rclMesh;
+};
+
+/**
+ * The MeshFixPipeline class repairs the defects found by MeshEvalPipeline.
+ *
+ * All facets to be removed, i.e. corrupted and duplicated facets, non-manifolds,
+ * self-intersections and folds, are collected and deleted with one call of
+ * MeshKernel::DeleteFacets() followed by one MeshKernel::RebuildNeighbours() which also
+ * repairs invalid neighbour indices. Like MeshObject::removeFoldsOnSurface() the folds on the
+ * boundary that this creates are removed, too. Degenerated facets, the orientation and
+ * duplicated points are fixed afterwards because these fixes change the topology locally.
+ * If indices are out of range only these get fixed and the mesh must be evaluated again.
+ */
+class MeshExport MeshFixPipeline
+{
+public:
+    MeshFixPipeline(MeshKernel& rclM, const MeshEvalPipeline::Settings& settings)
+        : _rclMesh(rclM)
+        , _settings(settings)
+    {}
+
+    /** Repairs the defects listed in \a result that must have been computed by
+     * MeshEvalPipeline with the same settings for the current state of the mesh.
+     * Returns false if nothing has been changed.
+     */
+    bool Fixup(const MeshEvalPipeline::Result& result);
+
+    /** The facets that were removed at once, in indices of the mesh before the fix. */
+    const std::vector<FacetIndex>& GetDeletedFaces() const
+    {
+        return deletedFaces;
+    }
+
+private:
+    bool FixupIndices(const MeshEvalPipeline::Result& result);
+
+private:
+    MeshKernel& _rclMesh;
+    MeshEvalPipeline::Settings _settings;
+    std::vector<FacetIndex> deletedFaces;
+};
+
+}  // namespace MeshCore
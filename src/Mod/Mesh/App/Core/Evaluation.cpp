@@ -33,6 +33,7 @@
 #include "Algorithm.h"
 #include "Approximation.h"
 #include "Evaluation.h"
+#include "FacetPairs.h"
 #include "Functional.h"
 #include "Grid.h"
 #include "Iterator.h"
@@ -433,8 +434,21 @@ bool MeshFixTopology::Fixup()
         _rclMesh.DeleteFacets(deletedFaces);
     }
 #else
+    deletedFaces = GetFacets();
+    if (!deletedFaces.empty()) {
+        _rclMesh.DeleteFacets(deletedFaces);
+        _rclMesh.RebuildNeighbours();
+    }
+#endif
+
+    return true;
+}
+
+std::vector<FacetIndex> MeshFixTopology::GetFacets() const
+{
+    std::vector<FacetIndex> facets;
     const MeshFacetArray& rFaces = _rclMesh.GetFacets();
-    deletedFaces.reserve(3 * nonManifoldList.size());  // allocate some memory
+    facets.reserve(3 * nonManifoldList.size());  // allocate some memory
     for (const auto& it : nonManifoldList) {
         std::vector<FacetIndex> non_mf;
         non_mf.reserve(it.size());
@@ -451,24 +465,18 @@ bool MeshFixTopology::Fixup()
 
         // are we able to repair the non-manifold edge by not removing all facets?
         if (it.size() - non_mf.size() == 2) {
-            deletedFaces.insert(deletedFaces.end(), non_mf.begin(), non_mf.end());
+            facets.insert(facets.end(), non_mf.begin(), non_mf.end());
         }
         else {
-            deletedFaces.insert(deletedFaces.end(), it.begin(), it.end());
+            facets.insert(facets.end(), it.begin(), it.end());
         }
     }
 
-    if (!deletedFaces.empty()) {
-        // remove duplicates
-        std::sort(deletedFaces.begin(), deletedFaces.end());
-        deletedFaces.erase(std::unique(deletedFaces.begin(), deletedFaces.end()), deletedFaces.end());
-
-        _rclMesh.DeleteFacets(deletedFaces);
-        _rclMesh.RebuildNeighbours();
-    }
-#endif
+    // remove duplicates
+    std::sort(facets.begin(), facets.end());
+    facets.erase(std::unique(facets.begin(), facets.end()), facets.end());
 
-    return true;
+    return facets;
 }
 
 // ---------------------------------------------------------
@@ -600,80 +608,40 @@ bool MeshFixSingleFacet::Fixup()
 
 // ----------------------------------------------------------------
 
-bool MeshEvalSelfIntersection::Evaluate()
+namespace
 {
-    // Contains bounding boxes for every facet
-    std::vector<Base::BoundBox3f> boxes;
+// The candidate pairs are tested in parallel in batches of this size. Between the batches the
+// progress is shown and a cancel is handled on the calling thread.
+constexpr std::size_t pairBatchSize = 1 << 18;
 
-    // Splits the mesh using grid for speeding up the calculation
-    MeshFacetGrid cMeshFacetGrid(_rclMesh);
-    const MeshFacetArray& rFaces = _rclMesh.GetFacets();
-    MeshGridIterator clGridIter(cMeshFacetGrid);
-    unsigned long ulGridX {}, ulGridY {}, ulGridZ {};
-    cMeshFacetGrid.GetCtGrids(ulGridX, ulGridY, ulGridZ);
-
-    MeshFacetIterator cMFI(_rclMesh);
-    for (cMFI.Begin(); cMFI.More(); cMFI.Next()) {
-        boxes.push_back((*cMFI).GetBoundBox());
-    }
-
-    // Calculates the intersections
-    Base::SequencerLauncher seq("Checking for self-intersections...", ulGridX * ulGridY * ulGridZ);
-    for (clGridIter.Init(); clGridIter.More(); clGridIter.Next()) {
-        // Get the facet indices, belonging to the current grid unit
-        std::vector<FacetIndex> aulGridElements;
-        clGridIter.GetElements(aulGridElements);
-
-        seq.next();
-        if (aulGridElements.empty()) {
-            continue;
-        }
+std::size_t CountBatches(const std::vector<FacetPair>& pairs)
+{
+    return (pairs.size() + pairBatchSize - 1) / pairBatchSize;
+}
 
-        MeshGeomFacet facet1, facet2;
-        Base::Vector3f pt1, pt2;
-        for (auto it = aulGridElements.begin(); it != aulGridElements.end(); ++it) {
-            const Base::BoundBox3f& box1 = boxes[*it];
-            cMFI.Set(*it);
-            facet1 = *cMFI;
-            const MeshFacet& rface1 = rFaces[*it];
-            for (auto jt = it; jt != aulGridElements.end(); ++jt) {
-                if (jt == it) {  // the identical facet
-                    continue;
-                }
-                // If the facets share a common vertex we do not check for self-intersections
-                // because they could but usually do not intersect each other and the algorithm
-                // below would detect false-positives, otherwise
-                const MeshFacet& rface2 = rFaces[*jt];
-                if (rface1._aulPoints[0] == rface2._aulPoints[0]
-                    || rface1._aulPoints[0] == rface2._aulPoints[1]
-                    || rface1._aulPoints[0] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[1] == rface2._aulPoints[0]
-                    || rface1._aulPoints[1] == rface2._aulPoints[1]
-                    || rface1._aulPoints[1] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[2] == rface2._aulPoints[0]
-                    || rface1._aulPoints[2] == rface2._aulPoints[1]
-                    || rface1._aulPoints[2] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
+std::vector<FacetPair> GetBatch(const std::vector<FacetPair>& pairs, std::size_t batch)
+{
+    auto begin = pairs.begin() + static_cast<std::ptrdiff_t>(batch * pairBatchSize);
+    auto end = pairs.begin()
+        + static_cast<std::ptrdiff_t>(std::min(pairs.size(), (batch + 1) * pairBatchSize));
+    return {begin, end};
+}
+}  // namespace
 
-                const Base::BoundBox3f& box2 = boxes[*jt];
-                if (box1 && box2) {
-                    cMFI.Set(*jt);
-                    facet2 = *cMFI;
-                    int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
-                    if (ret == 2) {
-                        // abort after the first detected self-intersection
-                        return false;
-                    }
-                }
-            }
+bool MeshEvalSelfIntersection::Evaluate()
+{
+    // Facets sharing a common vertex are not checked for self-intersections because they could
+    // but usually do not intersect each other and the algorithm would detect false-positives,
+    // otherwise
+    std::vector<FacetPair> pairs = MeshFacetPairs::Candidates(_rclMesh);
+    std::size_t ctBatches = CountBatches(pairs);
+    Base::SequencerLauncher seq("Checking for self-intersections...", ctBatches);
+    for (std::size_t batch = 0; batch < ctBatches; batch++) {
+        if (MeshFacetPairs::HasIntersection(_rclMesh, _rclMesh, GetBatch(pairs, batch))) {
+            return false;
         }
+        seq.next(true);  // allow one to cancel
     }
-
     return true;
 }
 
@@ -683,22 +651,9 @@ void MeshEvalSelfIntersection::GetIntersections(
 ) const
 {
     intersection.reserve(indices.size());
-    MeshFacetIterator cMF1(_rclMesh);
-    MeshFacetIterator cMF2(_rclMesh);
-
-    Base::Vector3f pt1, pt2;
-    std::vector<std::pair<FacetIndex, FacetIndex>>::const_iterator it;
-    for (it = indices.begin(); it != indices.end(); ++it) {
-        cMF1.Set(it->first);
-        cMF2.Set(it->second);
-
-        Base::BoundBox3f box1 = cMF1->GetBoundBox();
-        Base::BoundBox3f box2 = cMF2->GetBoundBox();
-        if (box1 && box2) {
-            int ret = cMF1->IntersectWithFacet(*cMF2, pt1, pt2);
-            if (ret == 2) {
-                intersection.emplace_back(pt1, pt2);
-            }
+    for (const auto& it : MeshFacetPairs::Intersect(_rclMesh, _rclMesh, indices)) {
+        if (it.points == 2) {
+            intersection.emplace_back(it.p1, it.p2);
         }
     }
 }
@@ -707,76 +662,18 @@ void MeshEvalSelfIntersection::GetIntersections(
     std::vector<std::pair<FacetIndex, FacetIndex>>& intersection
 ) const
 {
-    // Contains bounding boxes for every facet
-    std::vector<Base::BoundBox3f> boxes;
-    // intersection.clear();
-
-    // Splits the mesh using grid for speeding up the calculation
-    MeshFacetGrid cMeshFacetGrid(_rclMesh);
-    const MeshFacetArray& rFaces = _rclMesh.GetFacets();
-    MeshGridIterator clGridIter(cMeshFacetGrid);
-    unsigned long ulGridX {}, ulGridY {}, ulGridZ {};
-    cMeshFacetGrid.GetCtGrids(ulGridX, ulGridY, ulGridZ);
-
-    MeshFacetIterator cMFI(_rclMesh);
-    for (cMFI.Begin(); cMFI.More(); cMFI.Next()) {
-        boxes.push_back((*cMFI).GetBoundBox());
-    }
-
-    // Calculates the intersections
-    Base::SequencerLauncher seq("Checking for self-intersections...", ulGridX * ulGridY * ulGridZ);
-    for (clGridIter.Init(); clGridIter.More(); clGridIter.Next()) {
-        // Get the facet indices, belonging to the current grid unit
-        std::vector<FacetIndex> aulGridElements;
-        clGridIter.GetElements(aulGridElements);
-
-        seq.next(true);
-        if (aulGridElements.empty()) {
-            continue;
-        }
-
-        MeshGeomFacet facet1, facet2;
-        Base::Vector3f pt1, pt2;
-        for (auto it = aulGridElements.begin(); it != aulGridElements.end(); ++it) {
-            const Base::BoundBox3f& box1 = boxes[*it];
-            cMFI.Set(*it);
-            facet1 = *cMFI;
-            const MeshFacet& rface1 = rFaces[*it];
-            for (auto jt = it; jt != aulGridElements.end(); ++jt) {
-                if (jt == it) {  // the identical facet
-                    continue;
-                }
-                // If the facets share a common vertex we do not check for self-intersections
-                // because they could but usually do not intersect each other and the algorithm
-                // below would detect false-positives, otherwise
-                const MeshFacet& rface2 = rFaces[*jt];
-                if (rface1._aulPoints[0] == rface2._aulPoints[0]
-                    || rface1._aulPoints[0] == rface2._aulPoints[1]
-                    || rface1._aulPoints[0] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[1] == rface2._aulPoints[0]
-                    || rface1._aulPoints[1] == rface2._aulPoints[1]
-                    || rface1._aulPoints[1] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[2] == rface2._aulPoints[0]
-                    || rface1._aulPoints[2] == rface2._aulPoints[1]
-                    || rface1._aulPoints[2] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-
-                const Base::BoundBox3f& box2 = boxes[*jt];
-                if (box1 && box2) {
-                    cMFI.Set(*jt);
-                    facet2 = *cMFI;
-                    int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
-                    if (ret == 2) {
-                        intersection.emplace_back(*it, *jt);
-                    }
-                }
+    // Facets sharing a common vertex are not checked, see Evaluate()
+    std::vector<FacetPair> pairs = MeshFacetPairs::Candidates(_rclMesh);
+    std::size_t ctBatches = CountBatches(pairs);
+    Base::SequencerLauncher seq("Checking for self-intersections...", ctBatches);
+    for (std::size_t batch = 0; batch < ctBatches; batch++) {
+        for (const auto& it :
+             MeshFacetPairs::Intersect(_rclMesh, _rclMesh, GetBatch(pairs, batch))) {
+            if (it.points == 2) {
+                intersection.push_back(it.facets);
             }
         }
+        seq.next(true);  // allow one to cancel
     }
 }
 
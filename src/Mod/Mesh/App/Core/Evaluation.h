@@ -238,6 +238,8 @@ public:
     {}
     bool Fixup() override;
 
+    /** Returns the facets that Fixup() removes without touching the mesh. */
+    std::vector<FacetIndex> GetFacets() const;
     const std::vector<FacetIndex>& GetDeletedFaces() const
     {
         return deletedFaces;
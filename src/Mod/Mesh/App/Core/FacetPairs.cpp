@@ -0,0 +1,395 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+
+#include <QtConcurrentMap>
+
+#include "BVH.h"
+#include "Elements.h"
+#include "FacetPairs.h"
+#include "MeshKernel.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+constexpr std::size_t N = MeshFacetPairs::packetSize;
+
+// the number of facets or pairs handled by a task
+constexpr std::size_t chunkSize = 4096;
+
+// distances below this value are treated as zero by tri_tri_intersect_with_isectline
+constexpr float planeEpsilon = 0.000001F;
+// relative error bound of the signed distances
+constexpr float relativeError = 0.00001F;
+// squared cosine of the angle below which two facets are treated as coplanar
+constexpr float coplanarCos2 = 0.998F;
+
+// the vertices of N facets as structure of arrays
+struct TrianglePacket
+{
+    alignas(32) float x[3][N];
+    alignas(32) float y[3][N];
+    alignas(32) float z[3][N];
+
+    void Set(std::size_t lane, const MeshPointArray& points, const MeshFacet& facet)
+    {
+        for (int i = 0; i < 3; i++) {
+            const MeshPoint& pnt = points[facet._aulPoints[i]];
+            x[i][lane] = pnt.x;
+            y[i][lane] = pnt.y;
+            z[i][lane] = pnt.z;
+        }
+    }
+
+    // repeats the last used lane so that incomplete packets don't contain garbage
+    void Fill(std::size_t used)
+    {
+        for (std::size_t lane = used; lane < N; lane++) {
+            for (int i = 0; i < 3; i++) {
+                x[i][lane] = x[i][used - 1];
+                y[i][lane] = y[i][used - 1];
+                z[i][lane] = z[i][used - 1];
+            }
+        }
+    }
+};
+
+// Sets separated[lane] to 1 if the facets of the lane are certainly separated by the plane of one
+// of them. A pair is only rejected if the distances exceed a bound of the rounding error of the
+// exact test, so that culling doesn't change its result. The loop has no branches and works on
+// contiguous arrays, so it is vectorized for SSE, AVX or NEON.
+void CullPacket(const TrianglePacket& a, const TrianglePacket& b, std::uint8_t* separated)
+{
+    for (std::size_t i = 0; i < N; i++) {
+        const float ox = a.x[0][i];
+        const float oy = a.y[0][i];
+        const float oz = a.z[0][i];
+
+        const float a1x = a.x[1][i] - ox, a1y = a.y[1][i] - oy, a1z = a.z[1][i] - oz;
+        const float a2x = a.x[2][i] - ox, a2y = a.y[2][i] - oy, a2z = a.z[2][i] - oz;
+        const float b0x = b.x[0][i] - ox, b0y = b.y[0][i] - oy, b0z = b.z[0][i] - oz;
+        const float b1x = b.x[1][i] - ox, b1y = b.y[1][i] - oy, b1z = b.z[1][i] - oz;
+        const float b2x = b.x[2][i] - ox, b2y = b.y[2][i] - oy, b2z = b.z[2][i] - oz;
+
+        // extent of the pair plus the distance to the origin that limits the precision of the
+        // coordinates
+        float m = std::max(std::fabs(ox), std::max(std::fabs(oy), std::fabs(oz)));
+        m = std::max(m, std::fabs(a1x));
+        m = std::max(m, std::fabs(a1y));
+        m = std::max(m, std::fabs(a1z));
+        m = std::max(m, std::fabs(a2x));
+        m = std::max(m, std::fabs(a2y));
+        m = std::max(m, std::fabs(a2z));
+        m = std::max(m, std::fabs(b0x));
+        m = std::max(m, std::fabs(b0y));
+        m = std::max(m, std::fabs(b0z));
+        m = std::max(m, std::fabs(b1x));
+        m = std::max(m, std::fabs(b1y));
+        m = std::max(m, std::fabs(b1z));
+        m = std::max(m, std::fabs(b2x));
+        m = std::max(m, std::fabs(b2y));
+        m = std::max(m, std::fabs(b2z));
+
+        // plane of 'a' through the origin and distances of 'b'
+        const float nax = a1y * a2z - a1z * a2y;
+        const float nay = a1z * a2x - a1x * a2z;
+        const float naz = a1x * a2y - a1y * a2x;
+        const float db0 = nax * b0x + nay * b0y + naz * b0z;
+        const float db1 = nax * b1x + nay * b1y + naz * b1z;
+        const float db2 = nax * b2x + nay * b2y + naz * b2z;
+        const float ea = (std::fabs(a1x) + std::fabs(a1y) + std::fabs(a1z))
+            * (std::fabs(a2x) + std::fabs(a2y) + std::fabs(a2z));
+        const float tolA = planeEpsilon + relativeError * ea * m;
+        const float minB = std::min(db0, std::min(db1, db2));
+        const float maxB = std::max(db0, std::max(db1, db2));
+        const bool sepA = (minB > tolA) | (maxB < -tolA);
+
+        // plane of 'b' and distances of 'a'
+        const float e1x = b1x - b0x, e1y = b1y - b0y, e1z = b1z - b0z;
+        const float e2x = b2x - b0x, e2y = b2y - b0y, e2z = b2z - b0z;
+        const float nbx = e1y * e2z - e1z * e2y;
+        const float nby = e1z * e2x - e1x * e2z;
+        const float nbz = e1x * e2y - e1y * e2x;
+        const float d = nbx * b0x + nby * b0y + nbz * b0z;
+        const float da0 = -d;
+        const float da1 = nbx * a1x + nby * a1y + nbz * a1z - d;
+        const float da2 = nbx * a2x + nby * a2y + nbz * a2z - d;
+        const float eb = (std::fabs(e1x) + std::fabs(e1y) + std::fabs(e1z))
+            * (std::fabs(e2x) + std::fabs(e2y) + std::fabs(e2z));
+        const float tolB = planeEpsilon + relativeError * eb * m;
+        const float minA = std::min(da0, std::min(da1, da2));
+        const float maxA = std::max(da0, std::max(da1, da2));
+        const bool sepB = (minA > tolB) | (maxA < -tolB);
+
+        // nearly coplanar facets are handled separately by the exact test
+        const float dot = nax * nbx + nay * nby + naz * nbz;
+        const float lenA = nax * nax + nay * nay + naz * naz;
+        const float lenB = nbx * nbx + nby * nby + nbz * nbz;
+        const bool coplanar = dot * dot >= coplanarCos2 * lenA * lenB;
+
+        separated[i] = static_cast<std::uint8_t>((sepA | sepB) & !coplanar);
+    }
+}
+
+// Removes the separated pairs in [begin, end) and returns the new end
+std::vector<FacetPair>::iterator CullRange(
+    const MeshKernel& rclM1,
+    const MeshKernel& rclM2,
+    std::vector<FacetPair>::iterator begin,
+    std::vector<FacetPair>::iterator end
+)
+{
+    const MeshPointArray& points1 = rclM1.GetPoints();
+    const MeshPointArray& points2 = rclM2.GetPoints();
+    const MeshFacetArray& facets1 = rclM1.GetFacets();
+    const MeshFacetArray& facets2 = rclM2.GetFacets();
+
+    TrianglePacket a;
+    TrianglePacket b;
+    std::array<std::uint8_t, N> separated {};
+
+    auto out = begin;
+    for (auto it = begin; it != end;) {
+        std::size_t used = std::min<std::size_t>(N, std::distance(it, end));
+        for (std::size_t lane = 0; lane < used; lane++) {
+            a.Set(lane, points1, facets1[it[lane].first]);
+            b.Set(lane, points2, facets2[it[lane].second]);
+        }
+        a.Fill(used);
+        b.Fill(used);
+
+        CullPacket(a, b, separated.data());
+        for (std::size_t lane = 0; lane < used; lane++, ++it) {
+            if (!separated[lane]) {
+                *out++ = *it;
+            }
+        }
+    }
+
+    return out;
+}
+
+using Range = std::pair<std::size_t, std::size_t>;
+
+std::vector<Range> MakeChunks(std::size_t count)
+{
+    std::vector<Range> chunks;
+    for (std::size_t pos = 0; pos < count; pos += chunkSize) {
+        chunks.emplace_back(pos, std::min(pos + chunkSize, count));
+    }
+    return chunks;
+}
+
+std::vector<Base::BoundBox3f> FacetBoxes(const MeshKernel& rclM)
+{
+    const MeshPointArray& points = rclM.GetPoints();
+    const MeshFacetArray& facets = rclM.GetFacets();
+    std::vector<Base::BoundBox3f> boxes;
+    boxes.reserve(facets.size());
+    for (const auto& facet : facets) {
+        const MeshPoint& p0 = points[facet._aulPoints[0]];
+        Base::BoundBox3f box(p0.x, p0.y, p0.z, p0.x, p0.y, p0.z);
+        box.Add(points[facet._aulPoints[1]]);
+        box.Add(points[facet._aulPoints[2]]);
+        boxes.push_back(box);
+    }
+    return boxes;
+}
+
+bool SharePoint(const MeshFacet& facet1, const MeshFacet& facet2)
+{
+    for (PointIndex index : facet1._aulPoints) {
+        if (facet2.HasPoint(index)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::vector<FacetPair> Join(std::vector<std::vector<FacetPair>>&& parts)
+{
+    std::size_t count = 0;
+    for (const auto& part : parts) {
+        count += part.size();
+    }
+
+    std::vector<FacetPair> pairs;
+    pairs.reserve(count);
+    for (auto& part : parts) {
+        pairs.insert(pairs.end(), part.begin(), part.end());
+        part = std::vector<FacetPair>();
+    }
+    return pairs;
+}
+}  // namespace
+
+std::vector<FacetPair> MeshFacetPairs::Candidates(const MeshKernel& rclM)
+{
+    MeshFacetBVH bvh(rclM);
+    const MeshFacetArray& facets = rclM.GetFacets();
+    std::vector<Base::BoundBox3f> boxes = FacetBoxes(rclM);
+
+    auto collect = [&](const Range& range) {
+        std::vector<FacetPair> pairs;
+        std::vector<FacetIndex> found;
+        for (FacetIndex i = range.first; i < range.second; i++) {
+            const Base::BoundBox3f& box = boxes[i];
+            found.clear();
+            bvh.Inside([&box](const Base::BoundBox3f& other) { return box && other; }, found);
+            std::sort(found.begin(), found.end());
+            for (FacetIndex j : found) {
+                if (j > i && !SharePoint(facets[i], facets[j])) {
+                    pairs.emplace_back(i, j);
+                }
+            }
+        }
+        return pairs;
+    };
+
+    std::vector<Range> chunks = MakeChunks(facets.size());
+    return Join(
+        QtConcurrent::blockingMapped<std::vector<std::vector<FacetPair>>>(chunks, collect)
+    );
+}
+
+std::vector<FacetPair> MeshFacetPairs::Candidates(const MeshKernel& rclM1, const MeshKernel& rclM2)
+{
+    MeshFacetBVH bvh(rclM1);
+    std::vector<Base::BoundBox3f> boxes = FacetBoxes(rclM2);
+
+    auto collect = [&](const Range& range) {
+        std::vector<FacetPair> pairs;
+        std::vector<FacetIndex> found;
+        for (FacetIndex i = range.first; i < range.second; i++) {
+            const Base::BoundBox3f& box = boxes[i];
+            found.clear();
+            bvh.Inside([&box](const Base::BoundBox3f& other) { return box && other; }, found);
+            std::sort(found.begin(), found.end());
+            for (FacetIndex j : found) {
+                pairs.emplace_back(j, i);
+            }
+        }
+        return pairs;
+    };
+
+    std::vector<Range> chunks = MakeChunks(boxes.size());
+    return Join(
+        QtConcurrent::blockingMapped<std::vector<std::vector<FacetPair>>>(chunks, collect)
+    );
+}
+
+void MeshFacetPairs::Cull(const MeshKernel& rclM1, const MeshKernel& rclM2, std::vector<FacetPair>& pairs)
+{
+    std::vector<Range> chunks = MakeChunks(pairs.size());
+    std::vector<std::size_t> ends = QtConcurrent::blockingMapped<std::vector<std::size_t>>(
+        chunks,
+        [&](const Range& range) {
+            auto last = CullRange(
+                rclM1,
+                rclM2,
+                pairs.begin() + range.first,
+                pairs.begin() + range.second
+            );
+            return static_cast<std::size_t>(last - pairs.begin());
+        }
+    );
+
+    // move the remaining pairs of the chunks together
+    auto out = pairs.begin();
+    for (std::size_t i = 0; i < chunks.size(); i++) {
+        out = std::move(pairs.begin() + chunks[i].first, pairs.begin() + ends[i], out);
+    }
+    pairs.erase(out, pairs.end());
+}
+
+std::vector<MeshFacetPairs::Intersection> MeshFacetPairs::Intersect(
+    const MeshKernel& rclM1,
+    const MeshKernel& rclM2,
+    const std::vector<FacetPair>& pairs
+)
+{
+    auto intersect = [&](const Range& range) {
+        std::vector<FacetPair> chunk(pairs.begin() + range.first, pairs.begin() + range.second);
+        chunk.erase(CullRange(rclM1, rclM2, chunk.begin(), chunk.end()), chunk.end());
+
+        std::vector<Intersection> result;
+        for (const auto& pair : chunk) {
+            MeshGeomFacet facet1 = rclM1.GetFacet(pair.first);
+            MeshGeomFacet facet2 = rclM2.GetFacet(pair.second);
+            Intersection isect;
+            isect.points = facet1.IntersectWithFacet(facet2, isect.p1, isect.p2);
+            if (isect.points > 0) {
+                isect.facets = pair;
+                result.push_back(isect);
+            }
+        }
+        return result;
+    };
+
+    std::vector<Range> chunks = MakeChunks(pairs.size());
+    std::vector<std::vector<Intersection>> parts
+        = QtConcurrent::blockingMapped<std::vector<std::vector<Intersection>>>(chunks, intersect);
+
+    std::vector<Intersection> result;
+    for (const auto& part : parts) {
+        result.insert(result.end(), part.begin(), part.end());
+    }
+    return result;
+}
+
+bool MeshFacetPairs::HasIntersection(
+    const MeshKernel& rclM1,
+    const MeshKernel& rclM2,
+    const std::vector<FacetPair>& pairs
+)
+{
+    std::atomic<bool> found {false};
+    std::vector<Range> chunks = MakeChunks(pairs.size());
+    QtConcurrent::blockingMap(chunks, [&](Range& range) {
+        if (found) {
+            return;
+        }
+
+        std::vector<FacetPair> chunk(pairs.begin() + range.first, pairs.begin() + range.second);
+        chunk.erase(CullRange(rclM1, rclM2, chunk.begin(), chunk.end()), chunk.end());
+
+        Base::Vector3f pt1, pt2;
+        for (const auto& pair : chunk) {
+            MeshGeomFacet facet1 = rclM1.GetFacet(pair.first);
+            MeshGeomFacet facet2 = rclM2.GetFacet(pair.second);
+            if (facet1.IntersectWithFacet(facet2, pt1, pt2) == 2) {
+                found = true;
+                return;
+            }
+        }
+    });
+
+    return found;
+}
@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <Base/Vector3D.h>
+
+#include "Definitions.h"
+
+
+namespace MeshCore
+{
+
+class MeshKernel;
+
+using FacetPair = std::pair<FacetIndex, FacetIndex>;
+
+/**
+ * The MeshFacetPairs class finds intersecting facets of one or two meshes.
+ *
+ * The broad phase collects the pairs of facets whose bounding boxes overlap with a
+ * MeshFacetBVH. The pairs are then culled in packets: the vertices of packetSize pairs are
+ * stored as structure of arrays and tested against the plane of the other facet in branch-free
+ * loops that the compiler turns into SIMD code. Only the pairs that survive run the exact
+ * MeshGeomFacet::IntersectWithFacet() test. All phases run in parallel.
+ */
+class MeshExport MeshFacetPairs
+{
+public:
+    /** The number of facet pairs that are culled at once. */
+    static constexpr std::size_t packetSize = 8;
+
+    struct Intersection
+    {
+        FacetPair facets;
+        int points {};  /**< the result of MeshGeomFacet::IntersectWithFacet() */
+        Base::Vector3f p1;
+        Base::Vector3f p2;
+    };
+
+    /** Collects the pairs of facets of \a rclM whose bounding boxes overlap and that don't share
+     * a point. The first index of a pair is always lower than the second and the pairs are sorted.
+     */
+    static std::vector<FacetPair> Candidates(const MeshKernel& rclM);
+    /** Collects the pairs of facets of \a rclM1 and \a rclM2 whose bounding boxes overlap. The
+     * first index of a pair refers to \a rclM1 and the pairs are sorted by the second index.
+     */
+    static std::vector<FacetPair> Candidates(const MeshKernel& rclM1, const MeshKernel& rclM2);
+    /** Removes the pairs whose facets are separated by the plane of one of them. The test is
+     * conservative, pairs that are (nearly) coplanar are always kept.
+     */
+    static void Cull(const MeshKernel& rclM1, const MeshKernel& rclM2, std::vector<FacetPair>& pairs);
+    /** Culls \a pairs and returns the intersections of the remaining pairs in the order of
+     * \a pairs. Pairs that only touch in a single point are included.
+     */
+    static std::vector<Intersection> Intersect(
+        const MeshKernel& rclM1,
+        const MeshKernel& rclM2,
+        const std::vector<FacetPair>& pairs
+    );
+    /** Checks whether any of \a pairs intersects in a line. Stops after the first intersection.
+     */
+    static bool HasIntersection(
+        const MeshKernel& rclM1,
+        const MeshKernel& rclM2,
+        const std::vector<FacetPair>& pairs
+    );
+};
+
+}  // namespace MeshCore
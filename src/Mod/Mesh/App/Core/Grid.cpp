@@ -27,6 +27,8 @@
 #include <cmath>
 #include <limits>
 
+#include <QtConcurrentMap>
+
 #include "Algorithm.h"
 #include "Grid.h"
 #include "Iterator.h"
@@ -35,6 +37,92 @@
 
 using namespace MeshCore;
 
+void MeshGridCells::Resize(unsigned long ulX, unsigned long ulY, unsigned long ulZ)
+{
+    Clear();
+    _ulCtX = ulX;
+    _ulCtY = ulY;
+    _ulCtZ = ulZ;
+    _offsets.assign(static_cast<std::size_t>(ulX) * ulY * ulZ + 1, 0);
+}
+
+void MeshGridCells::Clear()
+{
+    _offsets.clear();
+    _indices.clear();
+    _pending.clear();
+    _ulCtX = _ulCtY = _ulCtZ = 0;
+}
+
+void MeshGridCells::Finish()
+{
+    if (_pending.empty()) {
+        return;
+    }
+
+    std::size_t numCells = static_cast<std::size_t>(_ulCtX) * _ulCtY * _ulCtZ;
+    std::vector<std::size_t> counts(numCells, 0);
+    for (std::size_t cell = 0; cell < numCells; cell++) {
+        counts[cell] = _offsets[cell + 1] - _offsets[cell];
+    }
+    for (const auto& entries : _pending) {
+        for (const auto& entry : entries) {
+            counts[entry.first]++;
+        }
+    }
+
+    // Move the already distributed elements to their new position and append the new ones
+    std::vector<std::size_t> offsets(numCells + 1, 0);
+    for (std::size_t cell = 0; cell < numCells; cell++) {
+        offsets[cell + 1] = offsets[cell] + counts[cell];
+    }
+    std::vector<ElementIndex> indices(offsets.back());
+    for (std::size_t cell = 0; cell < numCells; cell++) {
+        counts[cell] = offsets[cell];
+        for (std::size_t i = _offsets[cell]; i < _offsets[cell + 1]; i++) {
+            indices[counts[cell]++] = _indices[i];
+        }
+    }
+    for (const auto& entries : _pending) {
+        for (const auto& entry : entries) {
+            indices[counts[entry.first]++] = entry.second;
+        }
+    }
+    _pending.clear();
+    _pending.shrink_to_fit();
+
+    // Elements are usually added in ascending order, otherwise sort the cells and remove
+    // duplicates
+    bool ordered = true;
+    for (std::size_t cell = 0; cell < numCells && ordered; cell++) {
+        for (std::size_t i = offsets[cell] + 1; i < offsets[cell + 1]; i++) {
+            if (indices[i - 1] >= indices[i]) {
+                ordered = false;
+                break;
+            }
+        }
+    }
+    if (!ordered) {
+        std::size_t pos = 0;
+        for (std::size_t cell = 0; cell < numCells; cell++) {
+            auto first = indices.begin() + static_cast<std::ptrdiff_t>(offsets[cell]);
+            auto last = indices.begin() + static_cast<std::ptrdiff_t>(offsets[cell + 1]);
+            std::sort(first, last);
+            last = std::unique(first, last);
+            offsets[cell] = pos;
+            auto dest = indices.begin() + static_cast<std::ptrdiff_t>(pos);
+            pos = static_cast<std::size_t>(std::move(first, last, dest) - indices.begin());
+        }
+        offsets[numCells] = pos;
+        indices.resize(pos);
+    }
+
+    _offsets.swap(offsets);
+    _indices.swap(indices);
+}
+
+// ----------------------------------------------------------------
+
 MeshGrid::MeshGrid(const MeshKernel& rclM)
     : _pclMesh(&rclM)
     , _ulCtElements(0)
@@ -71,7 +159,7 @@ void MeshGrid::Attach(const MeshKernel& rclM)
 
 void MeshGrid::Clear()
 {
-    _aulGrid.clear();
+    _aulGrid.Clear();
     _pclMesh = nullptr;
 }
 
@@ -129,14 +217,7 @@ void MeshGrid::InitGrid()
     }
 
     // Create data structure
-    _aulGrid.clear();
-    _aulGrid.resize(_ulCtGridsX);
-    for (unsigned long i = 0; i < _ulCtGridsX; i++) {
-        _aulGrid[i].resize(_ulCtGridsY);
-        for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-            _aulGrid[i][j].resize(_ulCtGridsZ);
-        }
-    }
+    _aulGrid.Resize(_ulCtGridsX, _ulCtGridsY, _ulCtGridsZ);
 }
 
 unsigned long MeshGrid::Inside(
@@ -162,7 +243,7 @@ unsigned long MeshGrid::Inside(
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
                 raulElements
-                    .insert(raulElements.end(), _aulGrid[i][j][k].begin(), _aulGrid[i][j][k].end());
+                    .insert(raulElements.end(), _aulGrid(i, j, k).begin(), _aulGrid(i, j, k).end());
             }
         }
     }
@@ -205,8 +286,8 @@ unsigned long MeshGrid::Inside(
                 if (Base::DistanceP2(GetBoundBox(i, j, k).GetCenter(), rclOrg) < fMinDistP2) {
                     raulElements.insert(
                         raulElements.end(),
-                        _aulGrid[i][j][k].begin(),
-                        _aulGrid[i][j][k].end()
+                        _aulGrid(i, j, k).begin(),
+                        _aulGrid(i, j, k).end()
                     );
                 }
             }
@@ -240,7 +321,7 @@ unsigned long MeshGrid::Inside(const Base::BoundBox3f& rclBB, std::set<ElementIn
     for (auto i = ulMinX; i <= ulMaxX; i++) {
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
-                raulElements.insert(_aulGrid[i][j][k].begin(), _aulGrid[i][j][k].end());
+                raulElements.insert(_aulGrid(i, j, k).begin(), _aulGrid(i, j, k).end());
             }
         }
     }
@@ -470,7 +551,7 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt, std::set<Elemen
                 while (indices.empty() && nX < _ulCtGridsX) {
                     for (unsigned long i = 0; i < _ulCtGridsY; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            indices.insert(_aulGrid[nX][i][j].begin(), _aulGrid[nX][i][j].end());
+                            indices.insert(_aulGrid(nX, i, j).begin(), _aulGrid(nX, i, j).end());
                         }
                     }
                     nX++;
@@ -482,7 +563,7 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt, std::set<Elemen
                 while (indices.empty() && nX < _ulCtGridsX) {
                     for (unsigned long i = 0; i < _ulCtGridsY; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            indices.insert(_aulGrid[nX][i][j].begin(), _aulGrid[nX][i][j].end());
+                            indices.insert(_aulGrid(nX, i, j).begin(), _aulGrid(nX, i, j).end());
                         }
                     }
                     nX++;
@@ -494,7 +575,7 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt, std::set<Elemen
                 while (indices.empty() && nY < _ulCtGridsY) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            indices.insert(_aulGrid[i][nY][j].begin(), _aulGrid[i][nY][j].end());
+                            indices.insert(_aulGrid(i, nY, j).begin(), _aulGrid(i, nY, j).end());
                         }
                     }
                     nY++;
@@ -506,7 +587,7 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt, std::set<Elemen
                 while (indices.empty() && nY < _ulCtGridsY) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            indices.insert(_aulGrid[i][nY][j].begin(), _aulGrid[i][nY][j].end());
+                            indices.insert(_aulGrid(i, nY, j).begin(), _aulGrid(i, nY, j).end());
                         }
                     }
                     nY--;
@@ -518,7 +599,7 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt, std::set<Elemen
                 while (indices.empty() && nZ < _ulCtGridsZ) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-                            indices.insert(_aulGrid[i][j][nZ].begin(), _aulGrid[i][j][nZ].end());
+                            indices.insert(_aulGrid(i, j, nZ).begin(), _aulGrid(i, j, nZ).end());
                         }
                     }
                     nZ++;
@@ -530,7 +611,7 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt, std::set<Elemen
                 while (indices.empty() && nZ < _ulCtGridsZ) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-                            indices.insert(_aulGrid[i][j][nZ].begin(), _aulGrid[i][j][nZ].end());
+                            indices.insert(_aulGrid(i, j, nZ).begin(), _aulGrid(i, j, nZ).end());
                         }
                     }
                     nZ--;
@@ -634,7 +715,7 @@ unsigned long MeshGrid::GetElements(
     std::set<ElementIndex>& raclInd
 ) const
 {
-    const std::set<ElementIndex>& rclSet = _aulGrid[ulX][ulY][ulZ];
+    auto rclSet = _aulGrid(ulX, ulY, ulZ);
     if (!rclSet.empty()) {
         raclInd.insert(rclSet.begin(), rclSet.end());
         return rclSet.size();
@@ -655,9 +736,9 @@ unsigned long MeshGrid::GetElements(
         return 0;
     }
 
-    aulFacets.resize(_aulGrid[ulX][ulY][ulZ].size());
+    aulFacets.resize(_aulGrid(ulX, ulY, ulZ).size());
 
-    std::copy(_aulGrid[ulX][ulY][ulZ].begin(), _aulGrid[ulX][ulY][ulZ].end(), aulFacets.begin());
+    std::copy(_aulGrid(ulX, ulY, ulZ).begin(), _aulGrid(ulX, ulY, ulZ).end(), aulFacets.begin());
     return aulFacets.size();
 }
 
@@ -773,13 +854,70 @@ void MeshFacetGrid::RebuildGrid()
 
     InitGrid();
 
-    // Fill data structure
-    MeshFacetIterator clFIter(*_pclMesh);
+    // Fill data structure. The cells of blocks of facets are collected in parallel and merged
+    // in order, so that the facet indices of each cell are sorted.
+    const ElementIndex blockSize = 65536;
+    std::vector<ElementIndex> blocks;
+    for (ElementIndex i = 0; i < _ulCtElements; i += blockSize) {
+        blocks.push_back(i);
+    }
 
-    unsigned long i = 0;
-    for (clFIter.Init(); clFIter.More(); clFIter.Next()) {
-        //    AddFacet(*clFIter, i++, 2.0f);
-        AddFacet(*clFIter, i++);
+    auto collect = [this, blockSize](ElementIndex start) {
+        MeshGridCells::Entries entries;
+        ElementIndex end = std::min<ElementIndex>(start + blockSize, _ulCtElements);
+        for (ElementIndex i = start; i < end; i++) {
+            CollectFacet(_pclMesh->GetFacet(i), i, entries);
+        }
+        return entries;
+    };
+
+    if (blocks.size() > 1) {
+        std::vector<MeshGridCells::Entries> results
+            = QtConcurrent::blockingMapped<std::vector<MeshGridCells::Entries>>(blocks, collect);
+        for (auto& entries : results) {
+            _aulGrid.Add(std::move(entries));
+        }
+    }
+    else if (!blocks.empty()) {
+        _aulGrid.Add(collect(blocks.front()));
+    }
+    _aulGrid.Finish();
+}
+
+void MeshFacetGrid::CollectFacet(
+    const MeshGeomFacet& rclFacet,
+    ElementIndex ulFacetIndex,
+    MeshGridCells::Entries& entries
+) const
+{
+    unsigned long ulX1 {};
+    unsigned long ulY1 {};
+    unsigned long ulZ1 {};
+    unsigned long ulX2 {};
+    unsigned long ulY2 {};
+    unsigned long ulZ2 {};
+
+    Base::BoundBox3f clBB;
+    clBB.Add(rclFacet._aclPoints[0]);
+    clBB.Add(rclFacet._aclPoints[1]);
+    clBB.Add(rclFacet._aclPoints[2]);
+
+    Pos(Base::Vector3f(clBB.MinX, clBB.MinY, clBB.MinZ), ulX1, ulY1, ulZ1);
+    Pos(Base::Vector3f(clBB.MaxX, clBB.MaxY, clBB.MaxZ), ulX2, ulY2, ulZ2);
+
+    if ((ulX1 < ulX2) || (ulY1 < ulY2) || (ulZ1 < ulZ2)) {
+        for (unsigned long ulX = ulX1; ulX <= ulX2; ulX++) {
+            for (unsigned long ulY = ulY1; ulY <= ulY2; ulY++) {
+                for (unsigned long ulZ = ulZ1; ulZ <= ulZ2; ulZ++) {
+                    if (rclFacet.IntersectBoundingBox(GetBoundBox(ulX, ulY, ulZ))) {
+                        entries.emplace_back(_aulGrid.GetCellIndex(ulX, ulY, ulZ), ulFacetIndex);
+                    }
+                }
+            }
+        }
+    }
+    else {
+        entries.emplace_back(_aulGrid.GetCellIndex(ulX1, ulY1, ulZ1), ulFacetIndex);
     }
 }
 
@@ -1028,7 +1166,7 @@ void MeshFacetGrid::SearchNearestFacetInGrid(
     ElementIndex& rulFacetInd
 ) const
 {
-    const std::set<ElementIndex>& rclSet = _aulGrid[ulX][ulY][ulZ];
+    auto rclSet = _aulGrid(ulX, ulY, ulZ);
     for (ElementIndex pI : rclSet) {
         float fDist = _pclMesh->GetFacet(pI).DistanceToPoint(rclPt);
         if (fDist < rfMinDist) {
@@ -1079,7 +1217,7 @@ void MeshPointGrid::AddPoint(const MeshPoint& rclPt, ElementIndex ulPtIndex, flo
     unsigned long ulZ {};
     Pos(Base::Vector3f(rclPt.x, rclPt.y, rclPt.z), ulX, ulY, ulZ);
     if ((ulX < _ulCtGridsX) && (ulY < _ulCtGridsY) && (ulZ < _ulCtGridsZ)) {
-        _aulGrid[ulX][ulY][ulZ].insert(ulPtIndex);
+        _aulGrid.Add(ulX, ulY, ulZ, ulPtIndex);
     }
 }
 
@@ -1143,6 +1281,7 @@ void MeshPointGrid::RebuildGrid()
     for (cPIter.Init(); cPIter.More(); cPIter.Next()) {
         AddPoint(*cPIter, i++);
     }
+    _aulGrid.Finish();
 }
 
 void MeshPointGrid::Pos(
@@ -1217,8 +1356,8 @@ bool MeshGridIterator::InitOnRay(
         _rclGrid.Position(rclPt, _ulX, _ulY, _ulZ);
         raulElements.insert(
             raulElements.end(),
-            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end()
+            _rclGrid._aulGrid(_ulX, _ulY, _ulZ).begin(),
+            _rclGrid._aulGrid(_ulX, _ulY, _ulZ).end()
         );
         _bValidRay = true;
     }
@@ -1236,8 +1375,8 @@ bool MeshGridIterator::InitOnRay(
 
             raulElements.insert(
                 raulElements.end(),
-                _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end()
+                _rclGrid._aulGrid(_ulX, _ulY, _ulZ).begin(),
+                _rclGrid._aulGrid(_ulX, _ulY, _ulZ).end()
             );
             _bValidRay = true;
         }
@@ -1303,8 +1442,8 @@ bool MeshGridIterator::NextOnRay(std::vector<ElementIndex>& raulElements)
         _cSearchPositions.insert(pos);
         raulElements.insert(
             raulElements.end(),
-            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end()
+            _rclGrid._aulGrid(_ulX, _ulY, _ulZ).begin(),
+            _rclGrid._aulGrid(_ulX, _ulY, _ulZ).end()
         );
     }
     else {
@@ -24,8 +24,11 @@
 
 #pragma once
 
+#include <cstddef>
 #include <limits>
 #include <set>
+#include <utility>
+#include <vector>
 
 #include <Base/BoundBox.h>
 
@@ -46,6 +49,96 @@ class MeshGrid;
 
 static constexpr float MESHGRID_BBOX_EXTENSION = 10.0F;
 
+/**
+ * The MeshGridCells class stores the element indices of all cells of a grid.
+ *
+ * Instead of one container per cell all indices are kept in a single contiguous array
+ * together with an array of offsets to the first index of each cell (compressed sparse
+ * rows). The cells are filled in two passes: Add() collects (cell, element) pairs and
+ * Finish() distributes them to the cells. After Finish() the indices of each cell are
+ * sorted and unique.
+ */
+class MeshExport MeshGridCells
+{
+public:
+    /// The element indices of one cell
+    class Cell
+    {
+    public:
+        Cell(const ElementIndex* first, const ElementIndex* last)
+            : _first(first)
+            , _last(last)
+        {}
+        const ElementIndex* begin() const
+        {
+            return _first;
+        }
+        const ElementIndex* end() const
+        {
+            return _last;
+        }
+        std::size_t size() const
+        {
+            return static_cast<std::size_t>(_last - _first);
+        }
+        bool empty() const
+        {
+            return _first == _last;
+        }
+
+    private:
+        const ElementIndex* _first;
+        const ElementIndex* _last;
+    };
+
+    /// (cell, element) pairs as collected before Finish()
+    using Entries = std::vector<std::pair<std::size_t, ElementIndex>>;
+
+    /** Removes all elements and sets the number of cells in x, y and z direction. */
+    void Resize(unsigned long ulX, unsigned long ulY, unsigned long ulZ);
+    /** Removes all cells. */
+    void Clear();
+    /** Returns the index of the cell at the given grid position. */
+    std::size_t GetCellIndex(unsigned long ulX, unsigned long ulY, unsigned long ulZ) const
+    {
+        return (static_cast<std::size_t>(ulX) * _ulCtY + ulY) * _ulCtZ + ulZ;
+    }
+    /** Adds an element to a cell. It becomes visible after the next call of Finish(). */
+    void Add(unsigned long ulX, unsigned long ulY, unsigned long ulZ, ElementIndex ulIndex)
+    {
+        if (_pending.empty()) {
+            _pending.emplace_back();
+        }
+        _pending.back().emplace_back(GetCellIndex(ulX, ulY, ulZ), ulIndex);
+    }
+    /** Adds a batch of elements, e.g. collected by a worker thread. Batches are merged in the
+     * order they are added. */
+    void Add(Entries&& entries)
+    {
+        _pending.push_back(std::move(entries));
+    }
+    /** Distributes all added elements to the cells. */
+    void Finish();
+    /** Returns the elements of the cell at the given grid position. */
+    Cell operator()(unsigned long ulX, unsigned long ulY, unsigned long ulZ) const
+    {
+        std::size_t cell = GetCellIndex(ulX, ulY, ulZ);
+        if (cell + 1 >= _offsets.size()) {
+            return {nullptr, nullptr};
+        }
+        const ElementIndex* data = _indices.data();
+        return {data + _offsets[cell], data + _offsets[cell + 1]};
+    }
+
+private:
+    std::vector<std::size_t> _offsets;  /**< Offset of the first element of each cell. */
+    std::vector<ElementIndex> _indices; /**< Elements of all cells. */
+    std::vector<Entries> _pending;      /**< Elements added since the last Finish(). */
+    unsigned long _ulCtX {0};
+    unsigned long _ulCtY {0};
+    unsigned long _ulCtZ {0};
+};
+
 /**
  * The MeshGrid allows one to divide a global mesh object into smaller regions
  * of elements (e.g. facets, points or edges) depending on the resolution
@@ -161,7 +254,7 @@ public:
     /** Returns the number of elements in a given grid. */
     unsigned long GetCtElements(unsigned long ulX, unsigned long ulY, unsigned long ulZ) const
     {
-        return static_cast<unsigned long>(_aulGrid[ulX][ulY][ulZ].size());
+        return static_cast<unsigned long>(_aulGrid(ulX, ulY, ulZ).size());
     }
     /** Validates the grid structure and rebuilds it if needed. Must be implemented in sub-classes.
      */
@@ -211,8 +304,8 @@ protected:
 
 protected:
     // NOLINTBEGIN
-    std::vector<std::vector<std::vector<std::set<ElementIndex>>>> _aulGrid; /**< Grid data structure. */
-    const MeshKernel* _pclMesh;                                             /**< The mesh kernel. */
+    MeshGridCells _aulGrid;     /**< Grid data structure. */
+    const MeshKernel* _pclMesh; /**< The mesh kernel. */
     unsigned long _ulCtElements; /**< Number of grid elements for validation issues. */
     unsigned long _ulCtGridsX;   /**< Number of grid elements in z. */
     unsigned long _ulCtGridsY;   /**< Number of grid elements in z. */
@@ -311,6 +404,13 @@ protected:
      * ulFacetIndex the corresponding index in the mesh kernel. The facet is added to each grid
      * element that intersects the facet. */
     inline void AddFacet(const MeshGeomFacet& rclFacet, ElementIndex ulFacetIndex, float fEpsilon = 0.0F);
+    /** Collects the cells that intersect the facet into \a entries instead of adding it
+     * directly. This can be used from several threads. */
+    void CollectFacet(
+        const MeshGeomFacet& rclFacet,
+        ElementIndex ulFacetIndex,
+        MeshGridCells::Entries& entries
+    ) const;
     /** Returns the number of stored elements. */
     unsigned long HasElements() const override
     {
@@ -393,11 +493,8 @@ public:
     /** Returns indices of the elements in the current grid. */
     void GetElements(std::vector<ElementIndex>& raulElements) const
     {
-        raulElements.insert(
-            raulElements.end(),
-            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end()
-        );
+        auto cell = _rclGrid._aulGrid(_ulX, _ulY, _ulZ);
+        raulElements.insert(raulElements.end(), cell.begin(), cell.end());
     }
     /** Returns the number of elements in the current grid. */
     unsigned long GetCtElements() const
@@ -636,14 +733,14 @@ inline void MeshFacetGrid::AddFacet(const MeshGeomFacet& rclFacet, ElementIndex
             for (ulY = ulY1; ulY <= ulY2; ulY++) {
                 for (ulZ = ulZ1; ulZ <= ulZ2; ulZ++) {
                     if (rclFacet.IntersectBoundingBox(GetBoundBox(ulX, ulY, ulZ))) {
-                        _aulGrid[ulX][ulY][ulZ].insert(ulFacetIndex);
+                        _aulGrid.Add(ulX, ulY, ulZ, ulFacetIndex);
                     }
                 }
             }
         }
     }
     else {
-        _aulGrid[ulX1][ulY1][ulZ1].insert(ulFacetIndex);
+        _aulGrid.Add(ulX1, ulY1, ulZ1, ulFacetIndex);
     }
 }
 
@@ -0,0 +1,164 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <istream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <QtConcurrentMap>
+
+// Helper functions shared by the readers of text based mesh formats. The input is read into
+// memory at once, split into lines and the lines are converted in parallel directly into
+// pre-allocated arrays.
+namespace MeshCore::AsciiParser
+{
+
+/// Reads the remaining content of the stream into a string
+inline std::string readAll(std::istream& str)
+{
+    return {std::istreambuf_iterator<char>(str), std::istreambuf_iterator<char>()};
+}
+
+inline bool isSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v' || c == '\f';
+}
+
+/// Removes leading and trailing white spaces
+inline std::string_view trim(std::string_view str)
+{
+    while (!str.empty() && isSpace(str.front())) {
+        str.remove_prefix(1);
+    }
+    while (!str.empty() && isSpace(str.back())) {
+        str.remove_suffix(1);
+    }
+    return str;
+}
+
+/*!
+ * \brief Splits the buffer into lines starting at \a pos. At most \a maxLines lines are returned
+ * and \a pos is moved behind the last returned line.
+ */
+inline std::vector<std::string_view>
+splitLines(std::string_view buffer, std::size_t& pos, std::size_t maxLines = std::string_view::npos)
+{
+    std::vector<std::string_view> lines;
+    if (maxLines != std::string_view::npos) {
+        lines.reserve(maxLines);
+    }
+    while (pos < buffer.size() && lines.size() < maxLines) {
+        std::size_t end = buffer.find('\n', pos);
+        if (end == std::string_view::npos) {
+            end = buffer.size();
+        }
+        lines.push_back(buffer.substr(pos, end - pos));
+        pos = end + 1;
+    }
+    pos = std::min(pos, buffer.size());
+    return lines;
+}
+
+/*!
+ * \brief Reads the next number of the line and removes it together with the following
+ * separators. On failure false is returned and the line is left unchanged.
+ */
+template<typename T>
+bool readNumber(std::string_view& line, T& value, std::string_view separators = " \t\r")
+{
+    const char* begin = line.data();
+    const char* end = line.data() + line.size();
+    if (begin != end && *begin == '+') {
+        begin++;
+    }
+
+    const char* ptr = nullptr;
+    if constexpr (std::is_floating_point_v<T>) {
+#if defined(__cpp_lib_to_chars)
+        auto result = std::from_chars(begin, end, value);
+        if (result.ec != std::errc()) {
+            return false;
+        }
+        ptr = result.ptr;
+#else
+        // std::from_chars for floating point types is not available on all platforms
+        constexpr std::size_t maxLength = 64;
+        std::array<char, maxLength> text {};
+        std::size_t length = std::min<std::size_t>(end - begin, maxLength - 1);
+        std::memcpy(text.data(), begin, length);
+        char* textEnd = nullptr;
+        value = static_cast<T>(std::strtod(text.data(), &textEnd));
+        if (textEnd == text.data()) {
+            return false;
+        }
+        ptr = begin + (textEnd - text.data());
+#endif
+    }
+    else {
+        auto result = std::from_chars(begin, end, value);
+        if (result.ec != std::errc()) {
+            return false;
+        }
+        ptr = result.ptr;
+    }
+
+    line.remove_prefix(ptr - line.data());
+    std::size_t next = line.find_first_not_of(separators);
+    line.remove_prefix(next == std::string_view::npos ? line.size() : next);
+    return true;
+}
+
+/*!
+ * \brief Calls \a func(begin, end) for consecutive ranges of [0, count) in parallel.
+ * \return false if any of the calls failed.
+ */
+template<typename Func>
+bool parallelFor(std::size_t count, Func func)
+{
+    constexpr std::size_t chunkSize = 4096;
+    std::vector<std::pair<std::size_t, std::size_t>> chunks;
+    for (std::size_t i = 0; i < count; i += chunkSize) {
+        chunks.emplace_back(i, std::min(i + chunkSize, count));
+    }
+
+    std::vector<char> success = QtConcurrent::blockingMapped<std::vector<char>>(
+        chunks,
+        [&func](const std::pair<std::size_t, std::size_t>& range) -> char {
+            return func(range.first, range.second) ? 1 : 0;
+        }
+    );
+    return std::all_of(success.begin(), success.end(), [](char ok) { return ok != 0; });
+}
+
+}  // namespace MeshCore::AsciiParser
@@ -22,12 +22,17 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
 #include <boost/tokenizer.hpp>
 #include <memory>
 #include <ostream>
 #include <sstream>
-#include <xercesc/dom/DOM.hpp>
-#include <xercesc/parsers/XercesDOMParser.hpp>
+#include <stdexcept>
+#include <xercesc/sax2/Attributes.hpp>
+#include <xercesc/sax2/DefaultHandler.hpp>
+#include <xercesc/sax2/SAX2XMLReader.hpp>
+#include <xercesc/sax2/XMLReaderFactory.hpp>
+#include <xercesc/util/XMLUni.hpp>
 
 
 #include "Core/MeshIO.h"
@@ -37,6 +42,7 @@
 #include <Base/ZipHeader.h>
 #include <zipios++/zipfile.h>
 
+#include "AsciiParser.h"
 #include "Reader3MF.h"
 
 
@@ -107,378 +113,306 @@ bool Reader3MF::LoadModel(std::istream& str, const Component& comp)
     catch (const XMLException&) {
         return false;
     }
-    catch (const DOMException&) {
+    catch (const SAXException&) {
         return false;
     }
 }
 
-std::unique_ptr<XercesDOMParser> Reader3MF::makeDomParser()
+// Reads the model file as a stream of SAX events so that the vertices and triangles go directly
+// into the mesh arrays without building a DOM tree of the whole file first.
+class Reader3MF::ModelHandler: public DefaultHandler
 {
-    std::unique_ptr<XercesDOMParser> parser(new XercesDOMParser);
-    parser->setValidationScheme(XercesDOMParser::Val_Auto);
-    parser->setDoNamespaces(false);
-    parser->setDoSchema(false);
-    parser->setValidationSchemaFullChecking(false);
-    parser->setCreateEntityReferenceNodes(false);
-    return parser;
-}
-
-bool Reader3MF::TryLoadModel(std::istream& str, const Component& comp)
-{
-    if (!str) {
-        return false;
-    }
-
-    Base::StdInputSource inputSource(str, comp.path.c_str());
-    std::unique_ptr<XercesDOMParser> parser = makeDomParser();
-    parser->parse(inputSource);
-    std::unique_ptr<DOMDocument> xmlDocument(parser->adoptDocument());
-    return LoadModel(*xmlDocument, comp);
-}
-
-bool Reader3MF::LoadModel(DOMDocument& xmlDocument, const Component& comp)
-{
-    DOMNodeList* nodes = xmlDocument.getElementsByTagName(XStrLiteral("model").unicodeForm());
-    for (XMLSize_t i = 0; i < nodes->getLength(); i++) {
-        DOMNode* node = nodes->item(i);
-        if (node->getNodeType() == DOMNode::ELEMENT_NODE) {
-            return LoadResourcesAndBuild(static_cast<DOMElement*>(node), comp);
+public:
+    ModelHandler(Reader3MF& reader, const Component& comp)
+        : reader(reader)
+        , comp(comp)
+    {}
+
+    bool isValid() const
+    {
+        return hasModel && hasResources && hasBuild && !reader.meshes.empty();
+    }
+
+    void startElement(
+        const XMLCh* const /*uri*/,
+        const XMLCh* const /*localname*/,
+        const XMLCh* const qname,
+        const Attributes& attrs
+    ) override
+    {
+        // sorted by frequency
+        if (inMesh && isName(qname, "vertex")) {
+            readVertex(attrs);
+        }
+        else if (inMesh && isName(qname, "triangle")) {
+            readTriangle(attrs);
+        }
+        else if (isName(qname, "model")) {
+            hasModel = true;
+        }
+        else if (isName(qname, "resources")) {
+            inResources = !hasResources;
+            hasResources = true;
+        }
+        else if (isName(qname, "build")) {
+            inBuild = !hasBuild;
+            hasBuild = true;
+        }
+        else if (inResources && isName(qname, "object")) {
+            readObject(attrs);
+        }
+        else if (objectId >= 0 && isName(qname, "mesh")) {
+            inMesh = true;
+            points.clear();
+            facets.clear();
+        }
+        else if (objectId >= 0 && isName(qname, "component")) {
+            readComponent(attrs);
+        }
+        else if (inBuild && isName(qname, "item")) {
+            readItem(attrs);
         }
     }
 
-    return false;
-}
-
-bool Reader3MF::LoadResourcesAndBuild(DOMElement* node, const Component& comp)
-{
-    bool resource
-        = LoadResources(node->getElementsByTagName(XStrLiteral("resources").unicodeForm()), comp);
-    bool build = LoadBuild(node->getElementsByTagName(XStrLiteral("build").unicodeForm()));
-    return (resource && build);
-}
-
-bool Reader3MF::LoadResources(DOMNodeList* nodes, const Component& comp)
-{
-    if (!nodes) {
-        return false;
+    void endElement(
+        const XMLCh* const /*uri*/,
+        const XMLCh* const /*localname*/,
+        const XMLCh* const qname
+    ) override
+    {
+        if (inMesh && isName(qname, "mesh")) {
+            reader.AddMesh(objectId, points, facets, comp);
+            inMesh = false;
+        }
+        else if (isName(qname, "object")) {
+            objectId = -1;
+        }
+        else if (isName(qname, "resources")) {
+            inResources = false;
+        }
+        else if (isName(qname, "build")) {
+            inBuild = false;
+        }
     }
 
-    for (XMLSize_t i = 0; i < nodes->getLength(); i++) {
-        DOMNode* node = nodes->item(i);
-        if (node->getNodeType() == DOMNode::ELEMENT_NODE) {
-            auto elem = static_cast<DOMElement*>(node);
-            DOMNodeList* objectList = elem->getElementsByTagName(XStrLiteral("object").unicodeForm());
-            return LoadObject(objectList, comp);
+private:
+    // compares an element or attribute name with an ASCII string without transcoding it
+    static bool isName(const XMLCh* name, const char* ascii)
+    {
+        while (*ascii != 0 && *name == static_cast<XMLCh>(*ascii)) {
+            name++;
+            ascii++;
         }
+        return *name == 0 && *ascii == 0;
     }
 
-    return false;
-}
+    static const XMLCh* findValue(const Attributes& attrs, const char* name)
+    {
+        for (XMLSize_t i = 0; i < attrs.getLength(); i++) {
+            if (isName(attrs.getQName(i), name)) {
+                return attrs.getValue(i);
+            }
+        }
+        return nullptr;
+    }
+
+    // converts a numeric attribute value without going through a transcoder
+    template<typename T>
+    static T toNumber(const XMLCh* value)
+    {
+        constexpr std::size_t maxLength = 64;
+        std::array<char, maxLength> text {};
+        std::size_t length = 0;
+        while (length < maxLength && value[length] != 0 && value[length] < 0x80) {
+            text[length] = static_cast<char>(value[length]);
+            length++;
+        }
 
-bool Reader3MF::LoadBuild(DOMNodeList* nodes)
-{
-    if (!nodes) {
-        return false;
+        T number {};
+        std::string_view str = AsciiParser::trim(std::string_view(text.data(), length));
+        if (value[length] != 0 || !AsciiParser::readNumber(str, number)) {
+            throw std::invalid_argument("Invalid number in 3MF model");
+        }
+        return number;
     }
 
-    for (XMLSize_t i = 0; i < nodes->getLength(); i++) {
-        DOMNode* node = nodes->item(i);
-        if (node->getNodeType() == DOMNode::ELEMENT_NODE) {
-            auto elem = static_cast<DOMElement*>(node);
-            DOMNodeList* objectList = elem->getElementsByTagName(XStrLiteral("item").unicodeForm());
-            return LoadItems(objectList);
+    void readVertex(const Attributes& attrs)
+    {
+        const XMLCh* x = findValue(attrs, "x");
+        const XMLCh* y = findValue(attrs, "y");
+        const XMLCh* z = findValue(attrs, "z");
+        if (x && y && z) {
+            points.emplace_back(toNumber<float>(x), toNumber<float>(y), toNumber<float>(z));
         }
     }
 
-    return false;
-}
-
-bool Reader3MF::LoadItems(DOMNodeList* nodes)
-{
-    if (!nodes) {
-        return false;
+    void readTriangle(const Attributes& attrs)
+    {
+        const XMLCh* v1 = findValue(attrs, "v1");
+        const XMLCh* v2 = findValue(attrs, "v2");
+        const XMLCh* v3 = findValue(attrs, "v3");
+        if (v1 && v2 && v3) {
+            facets.emplace_back(
+                toNumber<PointIndex>(v1),
+                toNumber<PointIndex>(v2),
+                toNumber<PointIndex>(v3)
+            );
+        }
     }
 
-    for (XMLSize_t i = 0; i < nodes->getLength(); i++) {
-        DOMNode* itemNode = nodes->item(i);
-        DOMNamedNodeMap* nodeMap = itemNode->getAttributes();
-        LoadItem(nodeMap);
+    void readObject(const Attributes& attrs)
+    {
+        const XMLCh* id = findValue(attrs, "id");
+        objectId = id ? toNumber<int>(id) : -1;
     }
 
-    return true;
-}
-
-void Reader3MF::LoadItem(DOMNamedNodeMap* nodeMap)
-{
-    DOMNode* idAttr = nodeMap->getNamedItem(XStrLiteral("objectid").unicodeForm());
-    if (idAttr) {
-        std::string id = StrX(idAttr->getNodeValue()).c_str();
-        int idValue = std::stoi(id);
-
-        DOMNode* transformAttr = nodeMap->getNamedItem(XStrLiteral("transform").unicodeForm());
-        if (transformAttr) {
-            std::optional<Base::Matrix4D> mat = ReadTransform(transformAttr);
+    void readComponent(const Attributes& attrs)
+    {
+        Component component;
+        component.id = objectId;
+        if (const XMLCh* path = findValue(attrs, "p:path")) {
+            component.path = StrX(path).c_str();
+        }
+        if (const XMLCh* id = findValue(attrs, "objectid")) {
+            component.objectId = toNumber<int>(id);
+        }
+        if (const XMLCh* transform = findValue(attrs, "transform")) {
+            std::optional<Base::Matrix4D> mat = ReadTransform(StrX(transform).c_str());
             if (mat) {
-                auto it = meshes.find(idValue);
-                if (it != meshes.end()) {
-                    it->second.second = mat.value();
-                }
-
-                auto jt = std::find_if(
-                    components.begin(),
-                    components.end(),
-                    [idValue](const Component& comp) { return comp.id == idValue; }
-                );
-                if (jt != components.end()) {
-                    jt->transform = mat.value();
-                }
+                component.transform = mat.value();
             }
         }
+        reader.AddComponent(component);
     }
-}
 
-std::optional<Base::Matrix4D> Reader3MF::ReadTransform(DOMNode* transformAttr)
-{
-    constexpr const std::size_t numEntries = 12;
-    using Pos2d = std::array<std::array<int, 2>, numEntries>;
-    // clang-format off
-    static Pos2d pos = {{
-        {0, 0}, {1, 0}, {2, 0},
-        {0, 1}, {1, 1}, {2, 1},
-        {0, 2}, {1, 2}, {2, 2},
-        {0, 3}, {1, 3}, {2, 3}
-    }};
-    // clang-format on
-
-    if (transformAttr) {
-        std::string transform = StrX(transformAttr->getNodeValue()).c_str();
-        boost::char_separator<char> sep(" ,");
-        boost::tokenizer<boost::char_separator<char>> tokens(transform, sep);
-        std::vector<std::string> token_results;
-        token_results.assign(tokens.begin(), tokens.end());
-        if (token_results.size() == numEntries) {
-            Base::Matrix4D mat;
-            // NOLINTBEGIN
-            int index = 0;
-            for (const auto& it : pos) {
-                auto [r, c] = it;
-                mat[r][c] = std::stod(token_results[index++]);
+    void readItem(const Attributes& attrs)
+    {
+        if (const XMLCh* id = findValue(attrs, "objectid")) {
+            std::optional<Base::Matrix4D> mat;
+            if (const XMLCh* transform = findValue(attrs, "transform")) {
+                mat = ReadTransform(StrX(transform).c_str());
             }
-            // NOLINTEND
-            return mat;
+            reader.LoadItem(toNumber<int>(id), mat);
         }
     }
-    return {};
-}
 
-bool Reader3MF::LoadObject(DOMNodeList* nodes, const Component& comp)
+private:
+    Reader3MF& reader;
+    const Component& comp;
+    MeshPointArray points;
+    MeshFacetArray facets;
+    int objectId = -1;
+    bool hasModel = false;
+    bool hasResources = false;
+    bool hasBuild = false;
+    bool inResources = false;
+    bool inBuild = false;
+    bool inMesh = false;
+};
+
+bool Reader3MF::TryLoadModel(std::istream& str, const Component& comp)
 {
-    if (!nodes) {
+    if (!str) {
         return false;
     }
 
-    for (XMLSize_t i = 0; i < nodes->getLength(); i++) {
-        DOMNode* objectNode = nodes->item(i);
-        if (objectNode->getNodeType() == DOMNode::ELEMENT_NODE) {
-            DOMNode* idAttr = objectNode->getAttributes()->getNamedItem(
-                XStrLiteral("id").unicodeForm()
-            );
-            auto elem = static_cast<DOMElement*>(objectNode);
-            if (idAttr) {
-                int id = std::stoi(StrX(idAttr->getNodeValue()).c_str());
-                DOMNodeList* meshNode = elem->getElementsByTagName(XStrLiteral("mesh").unicodeForm());
-                if (meshNode->getLength() > 0) {
-                    LoadMesh(meshNode, id, comp);
-                }
-                else {
-                    DOMNodeList* compNode = elem->getElementsByTagName(
-                        XStrLiteral("components").unicodeForm()
-                    );
-                    LoadComponents(compNode, id);
-                }
-            }
-        }
-    }
-
-    return (!meshes.empty());
-}
-
-bool Reader3MF::LoadMeshFromComponents()
-{
-    for (const auto& it : components) {
-        std::string path = it.path.substr(1);
-        zip.reset(file->getInputStream(path));
-        LoadModel(*zip, it);
-    }
+    Base::StdInputSource inputSource(str, comp.path.c_str());
+    std::unique_ptr<SAX2XMLReader> parser(XMLReaderFactory::createXMLReader());
+    parser->setFeature(XMLUni::fgSAX2CoreNameSpaces, false);
+    parser->setFeature(XMLUni::fgSAX2CoreValidation, false);
 
-    return (!meshes.empty());
+    ModelHandler handler(*this, comp);
+    parser->setContentHandler(&handler);
+    parser->setErrorHandler(&handler);
+    parser->parse(inputSource);
+    return handler.isValid();
 }
 
-void Reader3MF::LoadComponents(DOMNodeList* nodes, int id)
+void Reader3MF::LoadItem(int id, const std::optional<Base::Matrix4D>& transform)
 {
-    if (!nodes) {
+    if (!transform) {
         return;
     }
 
-    for (XMLSize_t i = 0; i < nodes->getLength(); i++) {
-        DOMNode* objectNode = nodes->item(i);
-        if (objectNode->getNodeType() == DOMNode::ELEMENT_NODE) {
-            auto elem = static_cast<DOMElement*>(objectNode);
-            DOMNodeList* compNode = elem->getElementsByTagName(XStrLiteral("component").unicodeForm());
-            if (compNode->getLength() > 0) {
-                LoadComponent(compNode, id);
-            }
-        }
+    auto it = meshes.find(id);
+    if (it != meshes.end()) {
+        it->second.second = transform.value();
     }
-}
 
-void Reader3MF::LoadComponent(DOMNodeList* nodes, int id)
-{
-    if (!nodes) {
-        return;
-    }
-
-    for (XMLSize_t i = 0; i < nodes->getLength(); i++) {
-        DOMNode* compNode = nodes->item(i);
-        if (compNode->getNodeType() == DOMNode::ELEMENT_NODE) {
-            if (DOMNamedNodeMap* attr = compNode->getAttributes()) {
-                LoadComponent(attr, id);
-            }
-        }
+    auto jt = std::find_if(components.begin(), components.end(), [id](const Component& comp) {
+        return comp.id == id;
+    });
+    if (jt != components.end()) {
+        jt->transform = transform.value();
     }
 }
 
-void Reader3MF::LoadComponent(DOMNamedNodeMap* attr, int id)
+void Reader3MF::AddComponent(const Component& component)
 {
     auto validComponent = [](const Component& comp) {
         return (comp.id > 0 && comp.objectId >= 0 && !comp.path.empty());
     };
 
-    Component component;
-    component.id = id;
-    if (DOMNode* pathAttr = attr->getNamedItem(XStrLiteral("p:path").unicodeForm())) {
-        component.path = StrX(pathAttr->getNodeValue()).c_str();
-    }
-    if (DOMNode* idAttr = attr->getNamedItem(XStrLiteral("objectid").unicodeForm())) {
-        component.objectId = std::stoi(StrX(idAttr->getNodeValue()).c_str());
-    }
-    if (DOMNode* transformAttr = attr->getNamedItem(XStrLiteral("transform").unicodeForm())) {
-        std::optional<Base::Matrix4D> mat = ReadTransform(transformAttr);
-        if (mat) {
-            component.transform = mat.value();
-        }
-    }
     if (validComponent(component)) {
         components.push_back(component);
     }
 }
 
-void Reader3MF::LoadMesh(DOMNodeList* nodes, int id, const Component& comp)
+void Reader3MF::AddMesh(
+    int id,
+    MeshPointArray& points,
+    MeshFacetArray& facets,
+    const Component& comp
+)
 {
-    if (!nodes) {
-        return;
-    }
-
-    for (XMLSize_t i = 0; i < nodes->getLength(); i++) {
-        DOMNode* node = nodes->item(i);
-        if (node->getNodeType() == DOMNode::ELEMENT_NODE) {
-            auto elem = static_cast<DOMElement*>(node);
-            MeshPointArray points;
-            MeshFacetArray facets;
-            LoadVertices(elem->getElementsByTagName(XStrLiteral("vertices").unicodeForm()), points);
-            LoadTriangles(elem->getElementsByTagName(XStrLiteral("triangles").unicodeForm()), facets);
-
-            MeshCleanup meshCleanup(points, facets);
-            meshCleanup.RemoveInvalids();
-            MeshPointFacetAdjacency meshAdj(points.size(), facets);
-            meshAdj.SetFacetNeighbourhood();
-
-            Base::Matrix4D mat = comp.transform;
-            MeshKernel kernel;
-            kernel.Adopt(points, facets);
-            meshes.emplace(id, std::make_pair(kernel, mat));
-        }
-    }
+    MeshCleanup meshCleanup(points, facets);
+    meshCleanup.RemoveInvalids();
+    MeshPointFacetAdjacency meshAdj(points.size(), facets);
+    meshAdj.SetFacetNeighbourhood();
+
+    MeshKernel kernel;
+    kernel.Adopt(points, facets);
+    meshes.emplace(id, std::make_pair(std::move(kernel), comp.transform));
 }
 
-void Reader3MF::LoadVertices(DOMNodeList* nodes, MeshPointArray& points)
+std::optional<Base::Matrix4D> Reader3MF::ReadTransform(const std::string& transform)
 {
-    if (!nodes) {
-        return;
-    }
-
-    for (XMLSize_t i = 0; i < nodes->getLength(); i++) {
-        DOMNode* node = nodes->item(i);
-        if (node->getNodeType() == DOMNode::ELEMENT_NODE) {
-            auto elem = static_cast<DOMElement*>(node);
-            DOMNodeList* vertexList = elem->getElementsByTagName(XStrLiteral("vertex").unicodeForm());
-            if (vertexList) {
-                ReadVertices(vertexList, points);
-            }
-        }
-    }
-}
+    constexpr const std::size_t numEntries = 12;
+    using Pos2d = std::array<std::array<int, 2>, numEntries>;
+    // clang-format off
+    static Pos2d pos = {{
+        {0, 0}, {1, 0}, {2, 0},
+        {0, 1}, {1, 1}, {2, 1},
+        {0, 2}, {1, 2}, {2, 2},
+        {0, 3}, {1, 3}, {2, 3}
+    }};
+    // clang-format on
 
-void Reader3MF::ReadVertices(DOMNodeList* vertexList, MeshPointArray& points)
-{
-    XMLSize_t numVertices = vertexList->getLength();
-    points.reserve(numVertices);
-    for (XMLSize_t j = 0; j < numVertices; j++) {
-        DOMNode* vertexNode = vertexList->item(j);
-        DOMNamedNodeMap* attr = vertexNode->getAttributes();
-        if (attr) {
-            DOMNode* xAttr = attr->getNamedItem(XStrLiteral("x").unicodeForm());
-            DOMNode* yAttr = attr->getNamedItem(XStrLiteral("y").unicodeForm());
-            DOMNode* zAttr = attr->getNamedItem(XStrLiteral("z").unicodeForm());
-            if (xAttr && yAttr && zAttr) {
-                // NOLINTBEGIN
-                float x = std::stof(StrX(xAttr->getNodeValue()).c_str());
-                float y = std::stof(StrX(yAttr->getNodeValue()).c_str());
-                float z = std::stof(StrX(zAttr->getNodeValue()).c_str());
-                points.emplace_back(x, y, z);
-                // NOLINTEND
-            }
+    boost::char_separator<char> sep(" ,");
+    boost::tokenizer<boost::char_separator<char>> tokens(transform, sep);
+    std::vector<std::string> token_results;
+    token_results.assign(tokens.begin(), tokens.end());
+    if (token_results.size() == numEntries) {
+        Base::Matrix4D mat;
+        // NOLINTBEGIN
+        int index = 0;
+        for (const auto& it : pos) {
+            auto [r, c] = it;
+            mat[r][c] = std::stod(token_results[index++]);
         }
+        // NOLINTEND
+        return mat;
     }
+    return {};
 }
 
-void Reader3MF::LoadTriangles(DOMNodeList* nodes, MeshFacetArray& facets)
+bool Reader3MF::LoadMeshFromComponents()
 {
-    if (!nodes) {
-        return;
-    }
-
-    for (XMLSize_t i = 0; i < nodes->getLength(); i++) {
-        DOMNode* node = nodes->item(i);
-        if (node->getNodeType() == DOMNode::ELEMENT_NODE) {
-            auto elem = static_cast<DOMElement*>(node);
-            DOMNodeList* triangleList = elem->getElementsByTagName(
-                XStrLiteral("triangle").unicodeForm()
-            );
-            if (triangleList) {
-                ReadTriangles(triangleList, facets);
-            }
-        }
+    for (const auto& it : components) {
+        std::string path = it.path.substr(1);
+        zip.reset(file->getInputStream(path));
+        LoadModel(*zip, it);
     }
-}
 
-void Reader3MF::ReadTriangles(DOMNodeList* triangleList, MeshFacetArray& facets)
-{
-    XMLSize_t numTriangles = triangleList->getLength();
-    facets.reserve(numTriangles);
-    for (XMLSize_t j = 0; j < numTriangles; j++) {
-        DOMNode* triangleNode = triangleList->item(j);
-        DOMNamedNodeMap* attr = triangleNode->getAttributes();
-        if (attr) {
-            DOMNode* v1Attr = attr->getNamedItem(XStrLiteral("v1").unicodeForm());
-            DOMNode* v2Attr = attr->getNamedItem(XStrLiteral("v2").unicodeForm());
-            DOMNode* v3Attr = attr->getNamedItem(XStrLiteral("v3").unicodeForm());
-            if (v1Attr && v2Attr && v3Attr) {
-                PointIndex v1 = std::stoul(StrX(v1Attr->getNodeValue()).c_str());
-                PointIndex v2 = std::stoul(StrX(v2Attr->getNodeValue()).c_str());
-                PointIndex v3 = std::stoul(StrX(v3Attr->getNodeValue()).c_str());
-                facets.emplace_back(v1, v2, v3);
-            }
-        }
-    }
+    return (!meshes.empty());
 }
@@ -22,11 +22,10 @@
  *                                                                         *
  ***************************************************************************/
 
-#include <boost/algorithm/string.hpp>
-#include <boost/lexical_cast.hpp>
 #include <boost/tokenizer.hpp>
 #include <istream>
 #include <map>
+#include <stdexcept>
 
 #include "Core/MeshIO.h"
 #include "Core/MeshKernel.h"
@@ -35,6 +34,7 @@
 #include <Base/Stream.h>
 #include <Base/Tools.h>
 
+#include "AsciiParser.h"
 #include "ReaderOBJ.h"
 
 
@@ -52,40 +52,59 @@ public:
         : _material {material}
     {}
 
-    void Load(const std::string& line)
+    bool Load(const std::vector<std::string_view>& lines)
     {
-        if (Ignore(line)) {
-            return;
+        // Vertices and faces make up nearly all of the data and are converted in parallel. All
+        // other statements are handled afterwards in the order of the faces they precede.
+        std::vector<std::string_view> vertexLines;
+        std::vector<FaceRecord> faces;
+        std::vector<std::pair<std::size_t, std::string_view>> statements;
+        for (auto it : lines) {
+            std::string_view line = AsciiParser::trim(it);
+            if (Ignore(line)) {
+                continue;
+            }
+            if (IsStatement(line, 'v')) {
+                vertexLines.push_back(line);
+            }
+            else if (IsStatement(line, 'f')) {
+                FaceRecord face;
+                face.line = line;
+                face.verticesBefore = vertexLines.size();
+                faces.push_back(face);
+            }
+            else {
+                statements.emplace_back(faces.size(), line);
+            }
         }
 
-        boost::char_separator<char> sep(" /\t");
-        boost::tokenizer<boost::char_separator<char>> tokens(line, sep);
-        token_results.assign(tokens.begin(), tokens.end());
-        if (token_results.size() < 2) {
-            return;
+        if (!LoadVertices(vertexLines)) {
+            return false;
         }
 
-        if (MatchVertex(token_results)) {
-            LoadVertex(token_results);
+        // count the valid vertices in front of each vertex line to resolve relative indices
+        std::vector<std::size_t> validBefore(vertexLines.size() + 1, 0);
+        for (std::size_t i = 0; i < vertexLines.size(); i++) {
+            validBefore[i + 1] = validBefore[i] + (vertexState[i] != Invalid ? 1 : 0);
         }
-        else if (MatchVertexWithColor(token_results)) {
-            LoadVertexWithColor(token_results);
-        }
-        else if (MatchGroup(token_results)) {
-            LoadGroup(token_results);
-        }
-        else if (MatchLibrary(token_results)) {
-            LoadLibrary(token_results);
-        }
-        else if (MatchUseMaterial(token_results)) {
-            LoadUseMaterial(token_results);
+        CompactVertices();
+
+        if (!LoadFaces(faces)) {
+            return false;
         }
-        else if (MatchFace(token_results)) {
-            LoadFace(token_results);
+
+        auto jt = statements.begin();
+        for (std::size_t i = 0; i < faces.size(); i++) {
+            for (; jt != statements.end() && jt->first == i; ++jt) {
+                LoadStatement(jt->second);
+            }
+            AddFaces(faces[i], validBefore[faces[i].verticesBefore]);
         }
-        else if (MatchQuad(token_results)) {
-            LoadQuad(token_results);
+        for (; jt != statements.end(); ++jt) {
+            LoadStatement(jt->second);
         }
+
+        return true;
     }
 
     void SetupMaterial()
@@ -121,58 +140,223 @@ public:
     }
 
 private:
-    bool Ignore(const std::string& line) const
+    enum VertexState : char
+    {
+        Invalid,
+        Plain,
+        Colored
+    };
+
+    struct FaceRecord
+    {
+        std::string_view line;
+        std::size_t verticesBefore = 0;
+        std::array<int, 4> indices {};
+        int numCorners = 0;
+    };
+
+    // a face can have up to 13 tokens including the keyword
+    static constexpr std::size_t maxTokens = 14;
+    using Tokens = std::array<std::string_view, maxTokens>;
+
+    static std::size_t Tokenize(std::string_view line, Tokens& tokens)
+    {
+        constexpr std::string_view sep(" /\t");
+        std::size_t count = 0;
+        std::size_t pos = line.find_first_not_of(sep);
+        while (pos != std::string_view::npos) {
+            std::size_t end = std::min(line.find_first_of(sep, pos), line.size());
+            if (count < tokens.size()) {
+                tokens[count] = line.substr(pos, end - pos);
+            }
+            count++;
+            pos = line.find_first_not_of(sep, end);
+        }
+        return count;
+    }
+
+    template<typename T>
+    static bool ToNumber(std::string_view token, T& value)
+    {
+        return AsciiParser::readNumber(token, value, {});
+    }
+
+    static bool IsStatement(std::string_view line, char keyword)
+    {
+        return line.size() > 1 && line[0] == keyword
+            && (line[1] == ' ' || line[1] == '\t' || line[1] == '/');
+    }
+
+    bool Ignore(std::string_view line) const
     {
         // clang-format off
-        return boost::starts_with(line, "vn ") ||
-               boost::starts_with(line, "vt ") ||
-               boost::starts_with(line, "s ") ||
-               boost::starts_with(line, "o ") ||
-               boost::starts_with(line, "#");
+        return line.substr(0, 3) == "vn " ||
+               line.substr(0, 3) == "vt " ||
+               line.substr(0, 2) == "s " ||
+               line.substr(0, 2) == "o " ||
+               line.substr(0, 1) == "#";
         // clang-format on
     }
 
-    bool MatchVertex(const string_list& tokens) const
+    bool LoadVertices(const std::vector<std::string_view>& lines)
     {
-        return tokens[0] == "v" && tokens.size() == 4;
+        meshPoints.resize(lines.size());
+        vertexState.resize(lines.size());
+        auto load = [this, &lines](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                if (!LoadVertex(lines[i], meshPoints[i], vertexState[i])) {
+                    return false;
+                }
+            }
+            return true;
+        };
+        return AsciiParser::parallelFor(lines.size(), load);
+    }
+
+    static bool LoadVertex(std::string_view line, MeshPoint& point, char& state)
+    {
+        Tokens tokens;
+        std::size_t num = Tokenize(line, tokens);
+        state = Invalid;
+        if (num != 4 && num != 7) {  // NOLINT
+            return true;
+        }
+
+        std::array<float, 6> values {};  // NOLINT
+        for (std::size_t i = 1; i < num; i++) {
+            if (!ToNumber(tokens[i], values[i - 1])) {
+                return false;
+            }
+        }
+
+        point.Set(values[0], values[1], values[2]);
+        state = Plain;
+        if (num == 7) {  // NOLINT
+            // NOLINTBEGIN
+            float r = values[3];
+            float g = values[4];
+            float b = values[5];
+            if (r > 1.0F || g > 1.0F || b > 1.0F) {
+                r /= 255.0F;
+                g /= 255.0F;
+                b /= 255.0F;
+            }
+            // NOLINTEND
+
+            Base::Color c(r, g, b);
+            point.SetProperty(static_cast<uint32_t>(c.getPackedValue()));
+            state = Colored;
+        }
+
+        return true;
     }
 
-    void LoadVertex(const string_list& tokens)
+    void CompactVertices()
     {
-        float x = std::stof(tokens[1]);
-        float y = std::stof(tokens[2]);
-        float z = std::stof(tokens[3]);
-        meshPoints.push_back(MeshPoint(Base::Vector3f(x, y, z)));
+        if (std::find(vertexState.begin(), vertexState.end(), Colored) != vertexState.end()) {
+            rgb_value = MeshIO::PER_VERTEX;
+        }
+
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < meshPoints.size(); i++) {
+            if (vertexState[i] != Invalid) {
+                if (count != i) {
+                    meshPoints[count] = meshPoints[i];
+                }
+                count++;
+            }
+        }
+        meshPoints.resize(count);
     }
 
-    bool MatchVertexWithColor(const string_list& tokens) const
+    bool LoadFaces(std::vector<FaceRecord>& faces)
     {
-        return tokens[0] == "v" && tokens.size() == 7;  // NOLINT
+        auto load = [&faces](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                if (!LoadFace(faces[i])) {
+                    return false;
+                }
+            }
+            return true;
+        };
+        return AsciiParser::parallelFor(faces.size(), load);
     }
 
-    void LoadVertexWithColor(const string_list& tokens)
+    static bool LoadFace(FaceRecord& face)
     {
-        LoadVertex(tokens);
+        Tokens tokens;
+        std::size_t num = Tokenize(face.line, tokens);
 
+        // the position of the vertex index depends on whether texture and normal indices are
+        // given or not
         // NOLINTBEGIN
-        float r = std::stof(tokens[4]);
-        float g = std::stof(tokens[5]);
-        float b = std::stof(tokens[6]);
-        if (r > 1.0F || g > 1.0F || b > 1.0F) {
-            r /= 255.0F;
-            g /= 255.0F;
-            b /= 255.0F;
+        std::size_t stride = 0;
+        switch (num) {
+            case 4:
+            case 5:
+                stride = 1;
+                break;
+            case 7:
+            case 9:
+                stride = 2;
+                break;
+            case 10:
+            case 13:
+                stride = 3;
+                break;
+            default:
+                return true;
         }
+        face.numCorners = int((num - 1) / stride);
         // NOLINTEND
 
-        SetVertexColor(Base::Color(r, g, b));
+        for (int i = 0; i < face.numCorners; i++) {
+            if (!ToNumber(tokens[1 + i * stride], face.indices[i])) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void AddFaces(const FaceRecord& face, std::size_t numPoints)
+    {
+        if (face.numCorners == 0) {
+            return;
+        }
+
+        StartNewSegment();
+
+        std::array<int, 4> index {};
+        for (int i = 0; i < face.numCorners; i++) {
+            int value = face.indices[i];
+            index[i] = value > 0 ? value - 1 : value + static_cast<int>(numPoints);
+        }
+
+        AddFace(index[0], index[1], index[2]);
+        if (face.numCorners == 4) {
+            AddFace(index[2], index[3], index[0]);
+        }
     }
 
-    void SetVertexColor(const Base::Color& c)
+    void LoadStatement(std::string_view line)
     {
-        unsigned long prop = static_cast<uint32_t>(c.getPackedValue());
-        meshPoints.back().SetProperty(prop);
-        rgb_value = MeshIO::PER_VERTEX;
+        Tokens tokens;
+        std::size_t num = Tokenize(line, tokens);
+        if (num < 2 || num > tokens.size()) {
+            return;
+        }
+
+        token_results.assign(tokens.begin(), tokens.begin() + num);
+        if (MatchGroup(token_results)) {
+            LoadGroup(token_results);
+        }
+        else if (MatchLibrary(token_results)) {
+            LoadLibrary(token_results);
+        }
+        else if (MatchUseMaterial(token_results)) {
+            LoadUseMaterial(token_results);
+        }
     }
 
     bool MatchGroup(const string_list& tokens) const
@@ -212,86 +396,6 @@ private:
         countMaterialFacets = 0;
     }
 
-    bool MatchFace(const string_list& tokens) const
-    {
-        // NOLINTBEGIN
-        const auto num = tokens.size();
-        return tokens[0] == "f" && (num == 4 || num == 7 || num == 10);
-        // NOLINTEND
-    }
-
-    void LoadFace(const string_list& tokens)
-    {
-        StartNewSegment();
-
-        // NOLINTBEGIN
-        int index1 = 1;
-        int index2 = 2;
-        int index3 = 3;
-        if (tokens.size() == 7) {
-            index2 = 3;
-            index3 = 5;
-        }
-        else if (tokens.size() == 10) {
-            index2 = 4;
-            index3 = 7;
-        }
-        // NOLINTEND
-
-        // 3-vertex face
-        int i1 = std::stoi(tokens[index1]);
-        i1 = i1 > 0 ? i1 - 1 : i1 + static_cast<int>(meshPoints.size());
-        int i2 = std::stoi(tokens[index2]);
-        i2 = i2 > 0 ? i2 - 1 : i2 + static_cast<int>(meshPoints.size());
-        int i3 = std::stoi(tokens[index3]);
-        i3 = i3 > 0 ? i3 - 1 : i3 + static_cast<int>(meshPoints.size());
-
-        AddFace(i1, i2, i3);
-    }
-
-    bool MatchQuad(const string_list& tokens) const
-    {
-        // NOLINTBEGIN
-        const auto num = tokens.size();
-        return tokens[0] == "f" && (num == 5 || num == 9 || num == 13);
-        // NOLINTEND
-    }
-
-    void LoadQuad(const string_list& tokens)
-    {
-        StartNewSegment();
-
-        // NOLINTBEGIN
-        int index1 = 1;
-        int index2 = 2;
-        int index3 = 3;
-        int index4 = 4;
-        if (tokens.size() == 9) {
-            index2 = 3;
-            index3 = 5;
-            index4 = 7;
-        }
-        else if (tokens.size() == 13) {
-            index2 = 4;
-            index3 = 7;
-            index4 = 10;
-        }
-        // NOLINTEND
-
-        // 4-vertex face
-        int i1 = std::stoi(tokens[index1]);
-        i1 = i1 > 0 ? i1 - 1 : i1 + static_cast<int>(meshPoints.size());
-        int i2 = std::stoi(tokens[index2]);
-        i2 = i2 > 0 ? i2 - 1 : i2 + static_cast<int>(meshPoints.size());
-        int i3 = std::stoi(tokens[index3]);
-        i3 = i3 > 0 ? i3 - 1 : i3 + static_cast<int>(meshPoints.size());
-        int i4 = std::stoi(tokens[index4]);
-        i4 = i4 > 0 ? i4 - 1 : i4 + static_cast<int>(meshPoints.size());
-
-        AddFace(i1, i2, i3);
-        AddFace(i3, i4, i1);
-    }
-
     void StartNewSegment()
     {
         // starts a new segment
@@ -328,6 +432,7 @@ public:
 
 private:
     string_list token_results;
+    std::vector<char> vertexState;
     MeshIO::Binding rgb_value = MeshIO::OVERALL;
     unsigned long countMaterialFacets = 0;
     unsigned long segment = 0;
@@ -365,11 +470,13 @@ bool ReaderOBJ::Load(std::istream& str)
         return false;
     }
 
+    std::string buffer = AsciiParser::readAll(str);
+    std::size_t pos = 0;
+    std::vector<std::string_view> lines = AsciiParser::splitLines(buffer, pos);
+
     ReaderOBJImp reader(_material);
-    std::string line;
-    while (std::getline(str, line)) {
-        boost::trim(line);
-        reader.Load(line);
+    if (!reader.Load(lines)) {
+        throw std::invalid_argument("Invalid number in OBJ data");
     }
     reader.SetupMaterial();
     _materialNames = reader.GetMaterialNames();
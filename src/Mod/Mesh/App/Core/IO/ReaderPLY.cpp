@@ -30,6 +30,7 @@
 #include <Base/Stream.h>
 #include <Base/Tools.h>
 
+#include "AsciiParser.h"
 #include "ReaderPLY.h"
 
 
@@ -403,94 +404,115 @@ void ReaderPLY::CleanupMesh()
     _kernel.Adopt(meshPoints, meshFacets);
 }
 
-bool ReaderPLY::ReadVertexes(std::istream& input)
+bool ReaderPLY::ReadVertexes(const std::vector<std::string_view>& lines)
 {
-    std::string line;
-    for (std::size_t i = 0; i < v_count && std::getline(input, line); i++) {
-        std::istringstream str(line);
-        str.unsetf(std::ios_base::skipws);
-        str >> std::ws;
+    bool withColor = _material && _material->binding == MeshIO::PER_VERTEX;
+    meshPoints.resize(lines.size());
+    if (withColor) {
+        _material->diffuseColor.resize(lines.size());
+    }
+
+    auto load = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            std::string_view line = AsciiParser::trim(lines[i]);
+
+            // go through the vertex properties
+            PropertyArray prop_values {};
+            for (const auto& it : vertex_props) {
+                bool ok = false;
+                switch (it.second) {
+                    case int8:
+                    case int16:
+                    case int32: {
+                        int vt {};
+                        ok = AsciiParser::readNumber(line, vt);
+                        prop_values[it.first] = static_cast<float>(vt);
+                    } break;
+                    case uint8:
+                    case uint16:
+                    case uint32: {
+                        unsigned int vt {};
+                        ok = AsciiParser::readNumber(line, vt);
+                        prop_values[it.first] = static_cast<float>(vt);
+                    } break;
+                    case float32: {
+                        float vt {};
+                        ok = AsciiParser::readNumber(line, vt);
+                        prop_values[it.first] = vt;
+                    } break;
+                    case float64: {
+                        double vt {};
+                        ok = AsciiParser::readNumber(line, vt);
+                        prop_values[it.first] = static_cast<float>(vt);
+                    } break;
+                    default:
+                        break;
+                }
 
-        // go through the vertex properties
-        PropertyArray prop_values {};
-        std::size_t count_props = vertex_props.size();
-        for (const auto& it : vertex_props) {
-            switch (it.second) {
-                case int8:
-                case int16:
-                case int32: {
-                    int vt {};
-                    str >> vt >> std::ws;
-                    prop_values[it.first] = static_cast<float>(vt);
-                } break;
-                case uint8:
-                case uint16:
-                case uint32: {
-                    unsigned int vt {};
-                    str >> vt >> std::ws;
-                    prop_values[it.first] = static_cast<float>(vt);
-                } break;
-                case float32: {
-                    float vt {};
-                    str >> vt >> std::ws;
-                    prop_values[it.first] = vt;
-                } break;
-                case float64: {
-                    double vt {};
-                    str >> vt >> std::ws;
-                    prop_values[it.first] = static_cast<float>(vt);
-                } break;
-                default:
+                // does line contain all properties
+                if (!ok) {
                     return false;
+                }
             }
 
-            // does line contain all properties
-            if (--count_props > 0 && str.eof()) {
-                return false;
+            meshPoints[i].Set(prop_values[coord_x], prop_values[coord_y], prop_values[coord_z]);
+            if (withColor) {
+                // NOLINTBEGIN
+                float r = (prop_values[color_r]) / 255.0F;
+                float g = (prop_values[color_g]) / 255.0F;
+                float b = (prop_values[color_b]) / 255.0F;
+                // NOLINTEND
+                _material->diffuseColor[i].set(r, g, b);
             }
         }
 
-        addVertexProperty(prop_values);
-    }
+        return true;
+    };
 
-    return true;
+    return AsciiParser::parallelFor(lines.size(), load);
 }
 
-bool ReaderPLY::ReadFaces(std::istream& input)
+bool ReaderPLY::ReadFaces(const std::vector<std::string_view>& lines)
 {
-    constexpr const std::size_t count_props = 4;
-    std::string line;
-    for (std::size_t i = 0; i < f_count && std::getline(input, line); i++) {
-        std::istringstream str(line);
-        str.unsetf(std::ios_base::skipws);
-        str >> std::ws;
+    meshFacets.resize(lines.size());
 
-        std::array<int, count_props> v_indices {};
-        std::size_t index = count_props;
-        for (int& vt : v_indices) {
-            str >> vt >> std::ws;
-            if (--index > 0 && str.eof()) {
+    auto load = [&](std::size_t begin, std::size_t end) {
+        constexpr const std::size_t count_props = 4;
+        for (std::size_t i = begin; i < end; i++) {
+            std::string_view line = AsciiParser::trim(lines[i]);
+
+            std::array<int, count_props> v_indices {};
+            for (int& vt : v_indices) {
+                if (!AsciiParser::readNumber(line, vt)) {
+                    return false;
+                }
+            }
+
+            if (v_indices[0] != 3) {
                 return false;
             }
-        }
 
-        if (v_indices[0] != 3) {
-            return false;
+            meshFacets[i] = MeshFacet(v_indices[1], v_indices[2], v_indices[3]);
         }
 
-        meshFacets.push_back(MeshFacet(v_indices[1], v_indices[2], v_indices[3]));
-    }
+        return true;
+    };
 
-    return true;
+    return AsciiParser::parallelFor(lines.size(), load);
 }
 
 bool ReaderPLY::LoadAscii(std::istream& input)
 {
-    if (!ReadVertexes(input)) {
+    // the lines are converted in parallel directly into the final arrays
+    std::string buffer = AsciiParser::readAll(input);
+    std::size_t pos = 0;
+    std::vector<std::string_view> vertexLines = AsciiParser::splitLines(buffer, pos, v_count);
+    if (!ReadVertexes(vertexLines)) {
         return false;
     }
 
-    if (!ReadFaces(input)) {
+    std::vector<std::string_view> faceLines = AsciiParser::splitLines(buffer, pos, f_count);
+    if (!ReadFaces(faceLines)) {
         return false;
     }
 
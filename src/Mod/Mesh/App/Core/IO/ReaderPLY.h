@@ -27,6 +27,7 @@
 #include <Mod/Mesh/App/Core/MeshKernel.h>
 #include <Mod/Mesh/MeshGlobal.h>
 #include <iosfwd>
+#include <string_view>
 
 namespace Base
 {
@@ -63,8 +64,8 @@ private:
     bool ReadProperty(std::istream& str, const std::string& element);
     bool ReadVertexProperty(std::istream& str);
     bool ReadFaceProperty(std::istream& str);
-    bool ReadVertexes(std::istream& input);
-    bool ReadFaces(std::istream& input);
+    bool ReadVertexes(const std::vector<std::string_view>& lines);
+    bool ReadFaces(const std::vector<std::string_view>& lines);
     bool ReadVertexes(Base::InputStream& is);
     bool ReadFaces(Base::InputStream& is);
     bool LoadAscii(std::istream& input);
@@ -26,6 +26,11 @@
 # pragma warning(disable : 4396)
 #endif
 
+#include <algorithm>
+#include <cmath>
+
+#include <QtConcurrentMap>
+
 #include "KDTree.h"
 #include <kdtree++/kdtree.hpp>
 
@@ -84,8 +89,107 @@ class MeshKDTree::Private
 {
 public:
     MyKDTree kd_tree;
+
+    // Builds a balanced tree at once which is much faster than inserting the points one by one
+    template<typename Points>
+    void build(const Points& points)
+    {
+        std::vector<Point3d> values;
+        values.reserve(points.size());
+        PointIndex index = 0;
+        for (const auto& it : points) {
+            values.emplace_back(it, index++);
+        }
+        kd_tree.efficient_replace_and_optimise(values);
+    }
+};
+
+namespace
+{
+// the number of query points handled by a task
+constexpr std::size_t chunkSize = 1024;
+
+using Range = std::pair<std::size_t, std::size_t>;
+using Neighbours = std::vector<std::pair<float, PointIndex>>;
+
+struct BatchResult
+{
+    std::vector<std::size_t> counts;
+    std::vector<PointIndex> indices;
+    std::vector<float> distances;
 };
 
+// Collects the points of a box range query that are inside the sphere around the query point
+struct SphereCollector
+{
+    Base::Vector3f center;
+    float radius;
+    Neighbours* found;
+
+    void operator()(const Point3d& pnt) const
+    {
+        float dist = Base::Distance(center, pnt.p);
+        if (dist <= radius) {
+            found->emplace_back(dist, pnt.i);
+        }
+    }
+};
+
+// Runs the query for all points in parallel and joins the results in compressed row format
+template<typename Query>
+void RunBatch(
+    std::size_t numPoints,
+    const Query& query,
+    std::vector<std::size_t>& offsets,
+    std::vector<PointIndex>& indices,
+    std::vector<float>& distances
+)
+{
+    std::vector<Range> chunks;
+    for (std::size_t i = 0; i < numPoints; i += chunkSize) {
+        chunks.emplace_back(i, std::min(i + chunkSize, numPoints));
+    }
+
+    auto collect = [&query](const Range& range) {
+        BatchResult result;
+        Neighbours found;
+        for (std::size_t i = range.first; i < range.second; i++) {
+            found.clear();
+            query(i, found);
+            result.counts.push_back(found.size());
+            for (const auto& it : found) {
+                result.indices.push_back(it.second);
+                result.distances.push_back(it.first);
+            }
+        }
+        return result;
+    };
+
+    std::vector<BatchResult> results
+        = QtConcurrent::blockingMapped<std::vector<BatchResult>>(chunks, collect);
+
+    std::size_t total = 0;
+    for (const auto& it : results) {
+        total += it.indices.size();
+    }
+
+    offsets.clear();
+    offsets.reserve(numPoints + 1);
+    offsets.push_back(0);
+    indices.clear();
+    indices.reserve(total);
+    distances.clear();
+    distances.reserve(total);
+    for (const auto& it : results) {
+        for (std::size_t count : it.counts) {
+            offsets.push_back(offsets.back() + count);
+        }
+        indices.insert(indices.end(), it.indices.begin(), it.indices.end());
+        distances.insert(distances.end(), it.distances.begin(), it.distances.end());
+    }
+}
+}  // namespace
+
 MeshKDTree::MeshKDTree()
     : d(new Private)
 {}
@@ -93,19 +197,13 @@ MeshKDTree::MeshKDTree()
 MeshKDTree::MeshKDTree(const std::vector<Base::Vector3f>& points)
     : d(new Private)
 {
-    PointIndex index = 0;
-    for (auto it : points) {
-        d->kd_tree.insert(Point3d(it, index++));
-    }
+    d->build(points);
 }
 
 MeshKDTree::MeshKDTree(const MeshPointArray& points)
     : d(new Private)
 {
-    PointIndex index = 0;
-    for (const auto& it : points) {
-        d->kd_tree.insert(Point3d(it, index++));
-    }
+    d->build(points);
 }
 
 MeshKDTree::~MeshKDTree()
@@ -201,3 +299,67 @@ void MeshKDTree::FindInRange(const Base::Vector3f& p, float range, std::vector<P
         indices.push_back(it.i);
     }
 }
+
+void MeshKDTree::FindKNearest(
+    const std::vector<Base::Vector3f>& points,
+    std::size_t k,
+    std::vector<std::size_t>& offsets,
+    std::vector<PointIndex>& indices,
+    std::vector<float>& distances
+) const
+{
+    const MyKDTree& tree = d->kd_tree;
+    k = std::min(k, tree.size());
+
+    // average point spacing as start radius of the search
+    Base::BoundBox3f box;
+    for (const auto& it : tree) {
+        box.Add(it.p);
+    }
+    float spacing = k > 0 ? box.CalcDiagonalLength() / std::cbrt(float(tree.size())) : 0.0F;
+    float startRadius = spacing * std::cbrt(float(k));
+
+    auto query = [&tree, &points, k, startRadius](std::size_t i, Neighbours& found) {
+        if (k == 0) {
+            return;
+        }
+
+        const Point3d center(points[i], 0);
+        float radius = std::max(startRadius, tree.find_nearest(center).second);
+
+        // all points within the radius are found, so if there are at least k of them the k
+        // nearest of them are the k nearest of all points
+        for (;;) {
+            found.clear();
+            tree.visit_within_range(center, radius, SphereCollector {center.p, radius, &found});
+            if (found.size() >= k || radius <= 0.0F) {
+                break;
+            }
+            radius *= 2.0F;
+        }
+
+        std::size_t count = std::min(k, found.size());
+        std::partial_sort(found.begin(), found.begin() + count, found.end());
+        found.resize(count);
+    };
+
+    RunBatch(points.size(), query, offsets, indices, distances);
+}
+
+void MeshKDTree::FindInRadius(
+    const std::vector<Base::Vector3f>& points,
+    float radius,
+    std::vector<std::size_t>& offsets,
+    std::vector<PointIndex>& indices,
+    std::vector<float>& distances
+) const
+{
+    const MyKDTree& tree = d->kd_tree;
+    auto query = [&tree, &points, radius](std::size_t i, Neighbours& found) {
+        const Point3d center(points[i], 0);
+        tree.visit_within_range(center, radius, SphereCollector {center.p, radius, &found});
+        std::sort(found.begin(), found.end());
+    };
+
+    RunBatch(points.size(), query, offsets, indices, distances);
+}
@@ -51,6 +51,31 @@ public:
     PointIndex FindExact(const Base::Vector3f& p) const;
     void FindInRange(const Base::Vector3f&, float, std::vector<PointIndex>&) const;
 
+    /** @name Batch queries
+     * The queries are processed in parallel and the results are stored in compressed row
+     * format: the neighbours of the i-th query point are \a indices[offsets[i]] to
+     * \a indices[offsets[i+1]-1], sorted by their Euclidean distances that are stored in
+     * \a distances.
+     */
+    //@{
+    /// Finds the \a k nearest points of each query point
+    void FindKNearest(
+        const std::vector<Base::Vector3f>& points,
+        std::size_t k,
+        std::vector<std::size_t>& offsets,
+        std::vector<PointIndex>& indices,
+        std::vector<float>& distances
+    ) const;
+    /// Finds all points within the sphere of the given \a radius around each query point
+    void FindInRadius(
+        const std::vector<Base::Vector3f>& points,
+        float radius,
+        std::vector<std::size_t>& offsets,
+        std::vector<PointIndex>& indices,
+        std::vector<float>& distances
+    ) const;
+    //@}
+
     MeshKDTree(const MeshKDTree&) = delete;
     MeshKDTree(MeshKDTree&&) = delete;
     void operator=(const MeshKDTree&) = delete;
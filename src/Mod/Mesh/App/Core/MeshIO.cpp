@@ -25,7 +25,10 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <iomanip>
+#include <limits>
+#include <numeric>
 #include <sstream>
 #include <string_view>
 
@@ -36,6 +39,10 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/regex.hpp>
 
+#include <QFile>
+#include <QThreadPool>
+#include <QtConcurrentMap>
+
 #include "IO/Reader3MF.h"
 #include "IO/ReaderOBJ.h"
 #include "IO/ReaderPLY.h"
@@ -222,6 +229,8 @@ MeshIO::Format MeshInput::getFormat(const char* FileName)
 
 bool MeshInput::LoadAny(const char* FileName)
 {
+    _welded = false;
+
     // ask for read permission
     Base::FileInfo fi(FileName);
     if (!fi.exists() || !fi.isFile()) {
@@ -241,7 +250,7 @@ bool MeshInput::LoadAny(const char* FileName)
     // read file
     bool ok = false;
     if (fi.hasExtension({"stl", "ast"})) {
-        ok = LoadSTL(str);
+        ok = LoadMappedBinarySTL(FileName) || LoadSTL(str);
     }
     else if (fi.hasExtension("iv")) {
         ok = LoadInventor(str);
@@ -277,39 +286,59 @@ bool MeshInput::LoadAny(const char* FileName)
         throw Base::FileException("File extension not supported", FileName);
     }
 
+    if (ok) {
+        MergePoints();
+    }
     return ok;
 }
 
 bool MeshInput::LoadFormat(std::istream& input, MeshIO::Format fmt)
 {
+    _welded = false;
+    bool ok = false;
     switch (fmt) {
         case MeshIO::BMS:
             _rclMesh.Read(input);
             return true;
         case MeshIO::APLY:
         case MeshIO::PLY:
-            return LoadPLY(input);
+            ok = LoadPLY(input);
+            break;
         case MeshIO::ASTL:
-            return LoadAsciiSTL(input);
+            ok = LoadAsciiSTL(input);
+            break;
         case MeshIO::BSTL:
-            return LoadBinarySTL(input);
+            ok = LoadBinarySTL(input);
+            break;
         case MeshIO::STL:
-            return LoadSTL(input);
+            ok = LoadSTL(input);
+            break;
         case MeshIO::OBJ:
-            return LoadOBJ(input);
+            ok = LoadOBJ(input);
+            break;
         case MeshIO::SMF:
-            return LoadSMF(input);
+            ok = LoadSMF(input);
+            break;
         case MeshIO::ThreeMF:
-            return Load3MF(input);
+            ok = Load3MF(input);
+            break;
         case MeshIO::OFF:
-            return LoadOFF(input);
+            ok = LoadOFF(input);
+            break;
         case MeshIO::IV:
-            return LoadInventor(input);
+            ok = LoadInventor(input);
+            break;
         case MeshIO::NAS:
-            return LoadNastran(input);
+            ok = LoadNastran(input);
+            break;
         default:
             throw Base::FileException("Unsupported file format");
     }
+
+    if (ok) {
+        MergePoints();
+    }
+    return ok;
 }
 
 /** Loads an STL file either in binary or ASCII format.
@@ -779,6 +808,7 @@ bool MeshInput::LoadAsciiSTL(std::istream& input)
     MeshFastBuilder builder(this->_rclMesh);
 #endif
     builder.Initialize(ulFacetCt);
+    builder.SetTolerance(_weldTolerance);
 
     ulVertexCt = 0;
     while (std::getline(input, line)) {
@@ -802,6 +832,7 @@ bool MeshInput::LoadAsciiSTL(std::istream& input)
     }
 
     builder.Finish();
+    _welded = true;
 
     return true;
 }
@@ -850,6 +881,7 @@ bool MeshInput::LoadBinarySTL(std::istream& input)
     MeshFastBuilder builder(this->_rclMesh);
 #endif
     builder.Initialize(ulCt);
+    builder.SetTolerance(_weldTolerance);
 
     for (uint32_t i = 0; i < ulCt; i++) {
         // read normal, points
@@ -863,7 +895,67 @@ bool MeshInput::LoadBinarySTL(std::istream& input)
     }
 
     builder.Finish();
+    _welded = true;
+
+    return true;
+}
+
+void MeshInput::SetWeldTolerance(float fTol)
+{
+    _weldTolerance = fTol;
+}
+
+void MeshInput::MergePoints()
+{
+    // the STL readers already merged the points while building the mesh
+    if (_welded || _weldTolerance <= 0.0F || _rclMesh.CountPoints() == 0) {
+        return;
+    }
+
+    MeshPointArray rPoints = _rclMesh.GetPoints();
+    MeshFacetArray rFacets = _rclMesh.GetFacets();
+    PointIndex ctPoints = rPoints.size();
+    MeshPointWelder::Merge(rPoints, rFacets, _weldTolerance);
+    if (rPoints.size() != ctPoints) {
+        _rclMesh.Adopt(rPoints, rFacets, true);
+    }
+}
+
+bool MeshInput::LoadMappedBinarySTL(const char* FileName)
+{
+    const qint64 headerSize = 80 + sizeof(uint32_t);
+    const qint64 facetSize = 50;
+
+    QFile file(QString::fromUtf8(FileName));
+    if (!file.open(QIODevice::ReadOnly) || file.size() < headerSize) {
+        return false;
+    }
+
+    const uchar* data = file.map(0, file.size());
+    if (!data) {
+        return false;
+    }
 
+    // Only accept files whose size exactly fits to the number of facets. Everything else is
+    // either an ASCII file or a file with trailing data that is left to LoadSTL().
+    uint32_t ulCt {};
+    std::memcpy(&ulCt, data + 80, sizeof(ulCt));
+    if (file.size() != headerSize + facetSize * qint64(ulCt)) {
+        file.unmap(const_cast<uchar*>(data));
+        return false;
+    }
+
+    // skip the normal, the points follow as nine floats
+    const char* points = reinterpret_cast<const char*>(data) + headerSize + 3 * sizeof(float);
+    MeshPointArray rPoints;
+    MeshFacetArray rFacets;
+    MeshPointWelder welder(points, ulCt, facetSize);
+    welder.Weld(rPoints, rFacets);
+    file.unmap(const_cast<uchar*>(data));
+
+    MeshPointWelder::Merge(rPoints, rFacets, _weldTolerance);
+    _rclMesh.Adopt(rPoints, rFacets, true);
+    _welded = true;
     return true;
 }
 
@@ -1410,8 +1502,12 @@ bool MeshOutput::SaveAny(const char* FileName, MeshIO::Format format) const
         aWriter.Transform(this->_transform);
 
         // write file
-        bool ok = false;
-        ok = aWriter.SaveBinarySTL(str);
+        str.close();
+        bool ok = aWriter.SaveMappedBinarySTL(FileName);
+        if (!ok) {
+            Base::ofstream bstr(file, std::ios::out | std::ios::binary);
+            ok = aWriter.SaveBinarySTL(bstr);
+        }
         if (!ok) {
             throw Base::FileException("Export of STL mesh failed", FileName);
         }
@@ -1693,6 +1789,87 @@ bool MeshOutput::SaveBinarySTL(std::ostream& output) const
     return true;
 }
 
+bool MeshOutput::SaveMappedBinarySTL(const char* FileName) const
+{
+    const qint64 headerSize = 80 + sizeof(uint32_t);
+    const qint64 facetSize = 50;
+    const std::size_t ctFacets = _rclMesh.CountFacets();
+    if (ctFacets > std::numeric_limits<uint32_t>::max()) {
+        return false;
+    }
+
+    QFile file(QString::fromUtf8(FileName));
+    if (!file.open(QIODevice::ReadWrite | QIODevice::Truncate)) {
+        return false;
+    }
+    if (!file.resize(headerSize + facetSize * qint64(ctFacets))) {
+        return false;
+    }
+
+    uchar* data = file.map(0, file.size());
+    if (!data) {
+        return false;
+    }
+
+    // stl_header has a length of 80
+    std::memset(data, ' ', 80);
+    std::memcpy(data, stl_header.c_str(), std::min<std::size_t>(stl_header.size(), 80));
+    auto uCtFts = static_cast<uint32_t>(ctFacets);
+    std::memcpy(data + 80, &uCtFts, sizeof(uCtFts));
+
+    // every chunk of facets owns its own part of the mapped file
+    const std::size_t chunkSize = 1 << 16;
+    std::vector<std::size_t> chunks((ctFacets + chunkSize - 1) / chunkSize);
+    std::iota(chunks.begin(), chunks.end(), 0);
+    auto writeChunk = [&](std::size_t& chunk) {
+        std::size_t end = std::min(ctFacets, (chunk + 1) * chunkSize);
+        uchar* out = data + headerSize + facetSize * chunk * chunkSize;
+        for (std::size_t index = chunk * chunkSize; index < end; index++) {
+            MeshGeomFacet facet = _rclMesh.GetFacet(index);
+            if (apply_transform) {
+                facet.Transform(_transform);
+            }
+
+            float values[12];
+            Base::Vector3f normal = facet.GetNormal();
+            values[0] = normal.x;
+            values[1] = normal.y;
+            values[2] = normal.z;
+            for (int i = 0; i < 3; i++) {
+                values[3 * i + 3] = facet._aclPoints[i].x;
+                values[3 * i + 4] = facet._aclPoints[i].y;
+                values[3 * i + 5] = facet._aclPoints[i].z;
+            }
+            std::memcpy(out, values, sizeof(values));
+            // attribute
+            std::memset(out + sizeof(values), 0, sizeof(uint16_t));
+            out += facetSize;
+        }
+    };
+
+    // The chunks are written in rounds of one chunk per thread. Between the rounds the
+    // progress is shown and a cancel is handled on the calling thread.
+    Base::SequencerLauncher seq("saving...", chunks.size() + 1);
+    const auto round = static_cast<std::size_t>(
+        std::max(QThreadPool::globalInstance()->maxThreadCount(), 1)
+    );
+    try {
+        for (std::size_t first = 0; first < chunks.size(); first += round) {
+            std::size_t last = std::min(chunks.size(), first + round);
+            QtConcurrent::blockingMap(chunks.begin() + first, chunks.begin() + last, writeChunk);
+            for (std::size_t i = first; i < last; i++) {
+                seq.next(true);  // allow one to cancel
+            }
+        }
+    }
+    catch (...) {
+        file.unmap(data);
+        throw;
+    }
+
+    return file.unmap(data);
+}
+
 /** Saves an OBJ file. */
 bool MeshOutput::SaveOBJ(std::ostream& out) const
 {
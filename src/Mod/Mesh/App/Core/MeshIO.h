@@ -132,6 +132,11 @@ public:
     bool LoadAsciiSTL(std::istream& input);
     /** Loads a binary STL file. */
     bool LoadBinarySTL(std::istream& input);
+    /** Loads a binary STL file by mapping it into memory. The facets are read and their points
+     * merged in parallel. Returns false if the file is not a plain binary STL file or cannot be
+     * mapped, in this case the stream based method can be used.
+     */
+    bool LoadMappedBinarySTL(const char* FileName);
     /** Loads an OBJ Mesh file. */
     bool LoadOBJ(std::istream& input);
     /** Loads an OBJ Mesh file. */
@@ -157,11 +162,22 @@ public:
 
     static std::vector<std::string> supportedMeshFormats();
     static MeshIO::Format getFormat(const char* FileName);
+    /**
+     * Points of a loaded mesh with a distance less than or equal to \a fTol are merged by
+     * LoadAny() and LoadFormat(). The STL readers merge them while building the mesh. By
+     * default it's 0 so that no points are merged.
+     */
+    void SetWeldTolerance(float fTol);
+
+private:
+    void MergePoints();
 
 private:
     MeshKernel& _rclMesh; /**< reference to mesh data structure */
     Material* _material;
     std::vector<std::string> _groupNames;
+    float _weldTolerance {0.0F};
+    bool _welded {false};
 };
 
 /**
@@ -212,6 +228,11 @@ public:
     bool SaveAsciiSTL(std::ostream& output) const;
     /** Saves the mesh object into a binary STL file. */
     bool SaveBinarySTL(std::ostream& output) const;
+    /** Saves the mesh object into a binary STL file that is resized in advance and mapped into
+     * memory so that the facets can be written in parallel. Returns false if the file cannot be
+     * mapped, in this case the stream based method can be used.
+     */
+    bool SaveMappedBinarySTL(const char* FileName) const;
     /** Saves the mesh object into an OBJ file. */
     bool SaveOBJ(std::ostream& output) const;
     /** Saves the mesh object into an OBJ file. */
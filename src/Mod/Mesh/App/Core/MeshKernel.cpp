@@ -41,6 +41,7 @@
 #include "Iterator.h"
 #include "MeshIO.h"
 #include "MeshKernel.h"
+#include "Neighbourhood.h"
 #include "Smoothing.h"
 
 
@@ -1115,14 +1116,7 @@ void MeshKernel::operator*=(const Base::Matrix4D& rclMat)
 
 void MeshKernel::Transform(const Base::Matrix4D& rclMat)
 {
-    auto clPIter = _aclPointArray.begin(), clPEIter = _aclPointArray.end();
-
-    _clBoundBox.SetVoid();
-    while (clPIter < clPEIter) {
-        *clPIter *= rclMat;
-        _clBoundBox.Add(*clPIter);
-        clPIter++;
-    }
+    _aclPointArray.Transform(rclMat, _clBoundBox);
 }
 
 void MeshKernel::Smooth(int iterations, float stepsize)
@@ -1133,10 +1127,7 @@ void MeshKernel::Smooth(int iterations, float stepsize)
 
 void MeshKernel::RecalcBoundBox() const
 {
-    _clBoundBox.SetVoid();
-    for (const auto& pI : _aclPointArray) {
-        _clBoundBox.Add(pI);
-    }
+    _clBoundBox = _aclPointArray.GetBoundBox();
 }
 
 std::vector<Base::Vector3f> MeshKernel::CalcVertexNormals() const
@@ -1145,16 +1136,25 @@ std::vector<Base::Vector3f> MeshKernel::CalcVertexNormals() const
 
     normals.resize(CountPoints());
 
-    PointIndex p1 {}, p2 {}, p3 {};
-    unsigned int ct = CountFacets();
-    for (unsigned int pFIter = 0; pFIter < ct; pFIter++) {
-        GetFacetPoints(pFIter, p1, p2, p3);
-        Base::Vector3f Norm = (GetPoint(p2) - GetPoint(p1)) % (GetPoint(p3) - GetPoint(p1));
+    const std::size_t chunkSize = 65536;
+    std::vector<Base::Vector3f> facetNormals(CountFacets());
+    ParallelChunks(facetNormals.size(), chunkSize, [&](std::size_t begin, std::size_t end) {
+        PointIndex p1 {}, p2 {}, p3 {};
+        for (std::size_t i = begin; i < end; i++) {
+            GetFacetPoints(i, p1, p2, p3);
+            facetNormals[i] = (GetPoint(p2) - GetPoint(p1)) % (GetPoint(p3) - GetPoint(p1));
+        }
+    });
 
-        normals[p1] += Norm;
-        normals[p2] += Norm;
-        normals[p3] += Norm;
-    }
+    // gather per point in the order of the facets to get the same sums as a loop over them
+    MeshPointFan fan(*this);
+    ParallelChunks(normals.size(), chunkSize, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            for (const std::size_t* it = fan.Begin(i); it != fan.End(i); ++it) {
+                normals[i] += facetNormals[*it / 3];
+            }
+        }
+    });
 
     return normals;
 }
@@ -101,7 +101,8 @@ public:
     unsigned int GetMemSize() const
     {
         return static_cast<unsigned int>(
-            _aclPointArray.size() * sizeof(MeshPoint) + _aclFacetArray.size() * sizeof(MeshFacet)
+            _aclPointArray.capacity() * sizeof(MeshPoint)
+            + _aclFacetArray.capacity() * sizeof(MeshFacet)
         );
     }
     /// Determines the bounding box
@@ -0,0 +1,270 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+#include <QtConcurrentMap>
+
+#include <Base/BoundBox.h>
+#include <Mod/Mesh/App/WildMagic4/Wm4Matrix3.h>
+
+#include "MeshKernel.h"
+#include "Neighbourhood.h"
+
+
+using namespace MeshCore;
+
+void MeshCore::ParallelChunks(
+    std::size_t count,
+    std::size_t chunkSize,
+    const std::function<void(std::size_t, std::size_t)>& func
+)
+{
+    std::vector<std::size_t> chunks((count + chunkSize - 1) / chunkSize);
+    std::iota(chunks.begin(), chunks.end(), 0);
+    QtConcurrent::blockingMap(chunks, [&](std::size_t& chunk) {
+        func(chunk * chunkSize, std::min(count, (chunk + 1) * chunkSize));
+    });
+}
+
+// ----------------------------------------------------------------------------
+
+MeshPointFan::MeshPointFan(const MeshKernel& mesh)
+{
+    const MeshFacetArray& facets = mesh.GetFacets();
+    _offsets.resize(mesh.CountPoints() + 1);
+    for (const auto& facet : facets) {
+        for (PointIndex point : facet._aulPoints) {
+            _offsets[point + 1]++;
+        }
+    }
+    std::partial_sum(_offsets.begin(), _offsets.end(), _offsets.begin());
+
+    // counting sort of the corners by their point keeps them sorted by facet index
+    std::vector<std::size_t> next(_offsets.begin(), _offsets.end() - 1);
+    _corners.resize(_offsets.back());
+    std::size_t corner = 0;
+    for (const auto& facet : facets) {
+        for (PointIndex point : facet._aulPoints) {
+            _corners[next[point]++] = corner++;
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+MeshPointNeighbourhood::MeshPointNeighbourhood(const std::vector<Base::Vector3f>& points)
+    : _points(points)
+{
+    Init();
+}
+
+MeshPointNeighbourhood::MeshPointNeighbourhood(const MeshPointArray& points)
+    : _points(points.begin(), points.end())
+{
+    Init();
+}
+
+void MeshPointNeighbourhood::Init()
+{
+    _tree.AddPoints(_points);
+    _tree.Optimize();
+
+    Base::BoundBox3f box;
+    for (const auto& it : _points) {
+        box.Add(it);
+    }
+
+    // points sampled from a surface: about n points on an area of diagonal^2
+    if (!_points.empty()) {
+        _diagonal = box.CalcDiagonalLength();
+        _spacing = _diagonal / std::sqrt(float(_points.size()));
+    }
+}
+
+void MeshPointNeighbourhood::FindKNearest(
+    const Base::Vector3f& point,
+    std::size_t k,
+    float maxDist,
+    std::vector<PointIndex>& indices
+) const
+{
+    indices.clear();
+    if (k == 0 || _points.empty()) {
+        return;
+    }
+
+    float radius = _spacing * std::sqrt(float(k));
+    if (radius <= 0.0F) {
+        radius = std::max(_diagonal, 1.0F);
+    }
+    if (maxDist > 0.0F) {
+        radius = std::min(radius, maxDist);
+    }
+
+    // The tree returns the points inside a box. The k nearest points are found as soon as
+    // the sphere of the box contains at least k points.
+    std::vector<PointIndex> candidates;
+    std::vector<std::pair<float, PointIndex>> inside;
+    for (;;) {
+        candidates.clear();
+        _tree.FindInRange(point, radius, candidates);
+
+        bool last = candidates.size() == _points.size() || (maxDist > 0.0F && radius >= maxDist);
+        float limit = radius * radius;
+        if (last) {
+            limit = maxDist > 0.0F ? maxDist * maxDist : std::numeric_limits<float>::max();
+        }
+
+        inside.clear();
+        for (PointIndex it : candidates) {
+            float dist = Base::DistanceP2(point, _points[it]);
+            if (dist <= limit) {
+                inside.emplace_back(dist, it);
+            }
+        }
+
+        if (inside.size() >= k || last) {
+            break;
+        }
+
+        radius *= 2.0F;
+        if (maxDist > 0.0F) {
+            radius = std::min(radius, maxDist);
+        }
+    }
+
+    std::size_t count = std::min(k, inside.size());
+    std::partial_sort(inside.begin(), inside.begin() + count, inside.end());
+    indices.reserve(count);
+    for (std::size_t i = 0; i < count; i++) {
+        indices.push_back(inside[i].second);
+    }
+}
+
+void MeshPointNeighbourhood::FindInRadius(
+    const Base::Vector3f& point,
+    float radius,
+    std::vector<PointIndex>& indices
+) const
+{
+    indices.clear();
+    _tree.FindInRange(point, radius, indices);
+
+    float limit = radius * radius;
+    indices.erase(
+        std::remove_if(
+            indices.begin(),
+            indices.end(),
+            [&](PointIndex it) { return Base::DistanceP2(point, _points[it]) > limit; }
+        ),
+        indices.end()
+    );
+}
+
+void MeshPointNeighbourhood::ForEachNeighbourhood(
+    std::size_t k,
+    float radius,
+    const std::function<void(PointIndex, const std::vector<PointIndex>&)>& func
+) const
+{
+    // a query is much more expensive than a pass over an array, so use smaller chunks
+    const std::size_t chunkSize = 1024;
+    ParallelChunks(_points.size(), chunkSize, [&](std::size_t begin, std::size_t end) {
+        std::vector<PointIndex> neighbours;
+        for (std::size_t i = begin; i < end; i++) {
+            if (k > 0) {
+                FindKNearest(_points[i], k, radius, neighbours);
+            }
+            else if (radius > 0.0F) {
+                FindInRadius(_points[i], radius, neighbours);
+            }
+            func(PointIndex(i), neighbours);
+        }
+    });
+}
+
+std::vector<Base::Vector3f> MeshPointNeighbourhood::EstimateNormals(
+    std::size_t k,
+    float radius,
+    const Base::Vector3f& viewPoint
+) const
+{
+    std::vector<Base::Vector3f> normals(_points.size());
+    ForEachNeighbourhood(k, radius, [&](PointIndex index, const std::vector<PointIndex>& neighbours) {
+        if (neighbours.size() < 3) {
+            return;
+        }
+
+        double mx = 0.0, my = 0.0, mz = 0.0;
+        for (PointIndex it : neighbours) {
+            mx += _points[it].x;
+            my += _points[it].y;
+            mz += _points[it].z;
+        }
+        double size = double(neighbours.size());
+        mx /= size;
+        my /= size;
+        mz /= size;
+
+        double sxx = 0.0, sxy = 0.0, sxz = 0.0, syy = 0.0, syz = 0.0, szz = 0.0;
+        for (PointIndex it : neighbours) {
+            double dx = _points[it].x - mx;
+            double dy = _points[it].y - my;
+            double dz = _points[it].z - mz;
+            sxx += dx * dx;
+            sxy += dx * dy;
+            sxz += dx * dz;
+            syy += dy * dy;
+            syz += dy * dz;
+            szz += dz * dz;
+        }
+
+        // the eigenvector of the smallest eigenvalue is the normal
+        Wm4::Matrix3<double> akMat(sxx, sxy, sxz, sxy, syy, syz, sxz, syz, szz);
+        Wm4::Matrix3<double> rkRot, rkDiag;
+        try {
+            akMat.EigenDecomposition(rkRot, rkDiag);
+        }
+        catch (const std::exception&) {
+            return;
+        }
+
+        Wm4::Vector3<double> w = rkRot.GetColumn(0);
+        Base::Vector3f normal(float(w.X()), float(w.Y()), float(w.Z()));
+        if (std::isnan(normal.x) || std::isnan(normal.y) || std::isnan(normal.z)) {
+            return;
+        }
+        if (normal * (viewPoint - _points[index]) < 0.0F) {
+            normal = -normal;
+        }
+        normals[index] = normal;
+    });
+
+    return normals;
+}
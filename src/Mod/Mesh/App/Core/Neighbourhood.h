@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "Elements.h"
+#include "KDTree.h"
+
+
+namespace MeshCore
+{
+
+class MeshKernel;
+
+/**
+ * Splits the index range [0, count) into chunks of \a chunkSize elements and calls \a func
+ * with the bounds [begin, end) of each chunk. The chunks are run by the global thread pool.
+ * \note \a func must only write data that belongs to its own index range.
+ */
+MeshExport void ParallelChunks(
+    std::size_t count,
+    std::size_t chunkSize,
+    const std::function<void(std::size_t, std::size_t)>& func
+);
+
+/**
+ * The MeshPointFan class is a compact, read-only table of the facet corners around each point.
+ * A corner is encoded as 3 * facet + i where i is the position of the point in the facet.
+ *
+ * The corners of a point are sorted by facet index. A loop over the corners of a point thus
+ * accumulates values in the same order as a loop over the facet array does, so that
+ * algorithms can be turned from scattering over facets into gathering per point without
+ * changing their results. Points can then be processed in parallel.
+ * \note If the underlying mesh kernel gets changed this structure becomes invalid and must
+ * be rebuilt.
+ */
+class MeshExport MeshPointFan
+{
+public:
+    explicit MeshPointFan(const MeshKernel& mesh);
+
+    std::size_t CountPoints() const
+    {
+        return _offsets.size() - 1;
+    }
+    const std::size_t* Begin(PointIndex point) const
+    {
+        return _corners.data() + _offsets[point];
+    }
+    const std::size_t* End(PointIndex point) const
+    {
+        return _corners.data() + _offsets[point + 1];
+    }
+
+private:
+    std::vector<std::size_t> _offsets;
+    std::vector<std::size_t> _corners;
+};
+
+/**
+ * The MeshPointNeighbourhood class answers k-nearest neighbour and radius queries on a point
+ * set and runs the estimations that depend on the neighbourhood of each point in parallel.
+ *
+ * Both kinds of queries are answered by a MeshKDTree. A k-nearest neighbour query starts with
+ * a radius estimated from the density of the points and doubles it until at least k points
+ * lie inside. The result is exact.
+ */
+class MeshExport MeshPointNeighbourhood
+{
+public:
+    explicit MeshPointNeighbourhood(const std::vector<Base::Vector3f>& points);
+    explicit MeshPointNeighbourhood(const MeshPointArray& points);
+
+    /** Returns the indices of the \a k points nearest to \a point sorted by distance. If
+     * \a maxDist is positive only points within this distance are considered.
+     */
+    void FindKNearest(
+        const Base::Vector3f& point,
+        std::size_t k,
+        float maxDist,
+        std::vector<PointIndex>& indices
+    ) const;
+    /** Returns the indices of all points within the distance \a radius to \a point. */
+    void FindInRadius(const Base::Vector3f& point, float radius, std::vector<PointIndex>& indices) const;
+    /**
+     * Calls \a func for each point of the set with its index and its neighbours in parallel.
+     * If \a k is positive the neighbours are the \a k nearest points limited by \a radius if it
+     * is positive, too. Otherwise all points within \a radius are the neighbours. The point
+     * itself is part of its neighbourhood.
+     */
+    void ForEachNeighbourhood(
+        std::size_t k,
+        float radius,
+        const std::function<void(PointIndex, const std::vector<PointIndex>&)>& func
+    ) const;
+    /**
+     * Estimates the normal of each point as the direction of least variance of its
+     * neighbourhood. The normals are oriented towards \a viewPoint. Points with less than three
+     * neighbours get a null vector.
+     */
+    std::vector<Base::Vector3f> EstimateNormals(
+        std::size_t k,
+        float radius,
+        const Base::Vector3f& viewPoint = Base::Vector3f()
+    ) const;
+
+    const std::vector<Base::Vector3f>& GetPoints() const
+    {
+        return _points;
+    }
+
+private:
+    void Init();
+
+private:
+    std::vector<Base::Vector3f> _points;
+    MeshKDTree _tree;
+    float _spacing {0.0F};
+    float _diagonal {0.0F};
+};
+
+}  // namespace MeshCore
@@ -0,0 +1,413 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+#include <cstring>
+#include <list>
+#include <mutex>
+
+#include <QFile>
+
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
+#include <Base/Stream.h>
+
+#include "Builder.h"
+#include "MeshKernel.h"
+#include "OutOfCore.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+constexpr char magic[8] = {'F', 'C', 'M', 'E', 'S', 'H', 'O', 'C'};
+constexpr std::uint32_t version = 1;
+
+struct FileHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t reserved;
+    std::uint64_t ctChunks;
+    std::uint64_t ctFacets;
+    std::uint64_t ctPoints;
+    float box[6];
+};
+
+struct ChunkEntry
+{
+    std::uint64_t offset;
+    std::uint32_t ctPoints;
+    std::uint32_t ctFacets;
+    float box[6];
+};
+
+static_assert(sizeof(FileHeader) == 64, "Unexpected padding");
+static_assert(sizeof(ChunkEntry) == 40, "Unexpected padding");
+
+void SetBox(float* box, const Base::BoundBox3f& bbox)
+{
+    box[0] = bbox.MinX;
+    box[1] = bbox.MinY;
+    box[2] = bbox.MinZ;
+    box[3] = bbox.MaxX;
+    box[4] = bbox.MaxY;
+    box[5] = bbox.MaxZ;
+}
+
+Base::BoundBox3f GetBox(const float* box)
+{
+    return Base::BoundBox3f(box[0], box[1], box[2], box[3], box[4], box[5]);
+}
+
+/* Writes the header and the chunk table in advance and fills them in once all chunks are
+ * written. */
+class ChunkWriter
+{
+public:
+    ChunkWriter(const char* FileName, std::size_t ctChunks)
+        : file(FileName)
+        , str(file, std::ios::out | std::ios::binary)
+        , entries(ctChunks)
+    {
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, magic, sizeof(magic));
+        header.version = version;
+        header.ctChunks = ctChunks;
+        str.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        str.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(ChunkEntry));
+    }
+
+    void Write(std::size_t chunk, const MeshPointArray& rPoints, const MeshFacetArray& rFacets)
+    {
+        ChunkEntry& entry = entries[chunk];
+        entry.offset = static_cast<std::uint64_t>(str.tellp());
+        entry.ctPoints = static_cast<std::uint32_t>(rPoints.size());
+        entry.ctFacets = static_cast<std::uint32_t>(rFacets.size());
+
+        Base::BoundBox3f bbox;
+        std::vector<float> coords;
+        coords.reserve(3 * rPoints.size());
+        for (const auto& pnt : rPoints) {
+            coords.push_back(pnt.x);
+            coords.push_back(pnt.y);
+            coords.push_back(pnt.z);
+            bbox.Add(pnt);
+        }
+        std::vector<std::uint32_t> indices;
+        indices.reserve(3 * rFacets.size());
+        for (const auto& facet : rFacets) {
+            for (PointIndex index : facet._aulPoints) {
+                indices.push_back(static_cast<std::uint32_t>(index));
+            }
+        }
+        str.write(reinterpret_cast<const char*>(coords.data()), coords.size() * sizeof(float));
+        str.write(reinterpret_cast<const char*>(indices.data()), indices.size() * sizeof(std::uint32_t));
+
+        SetBox(entry.box, bbox);
+        box.Add(bbox);
+        header.ctPoints += entry.ctPoints;
+        header.ctFacets += entry.ctFacets;
+    }
+
+    bool Finish()
+    {
+        SetBox(header.box, box);
+        str.seekp(0);
+        str.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        str.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(ChunkEntry));
+        str.close();
+        return !str.fail();
+    }
+
+private:
+    Base::FileInfo file;
+    Base::ofstream str;
+    FileHeader header {};
+    std::vector<ChunkEntry> entries;
+    Base::BoundBox3f box;
+};
+}  // namespace
+
+struct MeshOutOfCore::Private
+{
+    QFile file;
+    FileHeader header {};
+    std::vector<ChunkEntry> entries;
+    std::vector<ChunkInfo> infos;
+    std::size_t ctCachedChunks {};
+
+    // mapped chunks, the most recently used comes first
+    std::list<std::pair<std::size_t, uchar*>> cache;
+    std::mutex mutex;
+
+    // must be called with the locked mutex
+    const uchar* Map(std::size_t chunk)
+    {
+        for (auto it = cache.begin(); it != cache.end(); ++it) {
+            if (it->first == chunk) {
+                cache.splice(cache.begin(), cache, it);
+                return it->second;
+            }
+        }
+
+        const ChunkEntry& entry = entries[chunk];
+        qint64 size = 3 * sizeof(float) * qint64(entry.ctPoints)
+            + 3 * sizeof(std::uint32_t) * qint64(entry.ctFacets);
+        if (size == 0) {
+            return nullptr;
+        }
+        uchar* data = file.map(qint64(entry.offset), size);
+        if (!data) {
+            throw Base::FileException("Cannot map mesh chunk into memory");
+        }
+
+        cache.emplace_front(chunk, data);
+        while (cache.size() > ctCachedChunks) {
+            file.unmap(cache.back().second);
+            cache.pop_back();
+        }
+        return data;
+    }
+
+    void Unmap()
+    {
+        for (const auto& it : cache) {
+            file.unmap(it.second);
+        }
+        cache.clear();
+    }
+};
+
+MeshOutOfCore::MeshOutOfCore(std::size_t ctCachedChunks)
+    : p(new Private)
+{
+    p->ctCachedChunks = std::max<std::size_t>(ctCachedChunks, 1);
+}
+
+MeshOutOfCore::~MeshOutOfCore()
+{
+    Close();
+    delete p;
+}
+
+bool MeshOutOfCore::Create(const MeshKernel& rclM, const char* FileName, std::size_t ctChunkFacets)
+{
+    ctChunkFacets = std::max<std::size_t>(ctChunkFacets, 1);
+    const MeshPointArray& points = rclM.GetPoints();
+    const MeshFacetArray& facets = rclM.GetFacets();
+    std::size_t ctChunks = (facets.size() + ctChunkFacets - 1) / ctChunkFacets;
+
+    ChunkWriter writer(FileName, ctChunks);
+    std::vector<PointIndex> pointMap(points.size(), POINT_INDEX_MAX);
+    for (std::size_t chunk = 0; chunk < ctChunks; chunk++) {
+        std::size_t begin = chunk * ctChunkFacets;
+        std::size_t end = std::min(facets.size(), begin + ctChunkFacets);
+
+        MeshPointArray chunkPoints;
+        MeshFacetArray chunkFacets;
+        chunkFacets.reserve(end - begin);
+        for (std::size_t i = begin; i < end; i++) {
+            MeshFacet facet;
+            for (int j = 0; j < 3; j++) {
+                PointIndex index = facets[i]._aulPoints[j];
+                if (pointMap[index] == POINT_INDEX_MAX) {
+                    pointMap[index] = chunkPoints.size();
+                    chunkPoints.push_back(points[index]);
+                }
+                facet._aulPoints[j] = pointMap[index];
+            }
+            chunkFacets.push_back(facet);
+        }
+
+        // reset the map for the next chunk
+        for (std::size_t i = begin; i < end; i++) {
+            for (PointIndex index : facets[i]._aulPoints) {
+                pointMap[index] = POINT_INDEX_MAX;
+            }
+        }
+
+        writer.Write(chunk, chunkPoints, chunkFacets);
+    }
+
+    return writer.Finish();
+}
+
+bool MeshOutOfCore::CreateFromBinarySTL(const char* STLFile, const char* FileName, std::size_t ctChunkFacets)
+{
+    const qint64 headerSize = 80 + sizeof(uint32_t);
+    const qint64 facetSize = 50;
+    ctChunkFacets = std::max<std::size_t>(ctChunkFacets, 1);
+
+    QFile file(QString::fromUtf8(STLFile));
+    if (!file.open(QIODevice::ReadOnly) || file.size() < headerSize) {
+        return false;
+    }
+
+    const uchar* data = file.map(0, file.size());
+    if (!data) {
+        return false;
+    }
+
+    uint32_t ulCt {};
+    std::memcpy(&ulCt, data + 80, sizeof(ulCt));
+    if (file.size() != headerSize + facetSize * qint64(ulCt)) {
+        file.unmap(const_cast<uchar*>(data));
+        return false;
+    }
+
+    // skip the normal, the points follow as nine floats
+    const char* points = reinterpret_cast<const char*>(data) + headerSize + 3 * sizeof(float);
+    std::size_t ctChunks = (ulCt + ctChunkFacets - 1) / ctChunkFacets;
+    ChunkWriter writer(FileName, ctChunks);
+    for (std::size_t chunk = 0; chunk < ctChunks; chunk++) {
+        std::size_t begin = chunk * ctChunkFacets;
+        std::size_t count = std::min<std::size_t>(ulCt - begin, ctChunkFacets);
+
+        MeshPointArray chunkPoints;
+        MeshFacetArray chunkFacets;
+        MeshPointWelder welder(points + begin * facetSize, count, facetSize);
+        welder.Weld(chunkPoints, chunkFacets);
+        writer.Write(chunk, chunkPoints, chunkFacets);
+    }
+
+    file.unmap(const_cast<uchar*>(data));
+    return writer.Finish();
+}
+
+bool MeshOutOfCore::Open(const char* FileName)
+{
+    Close();
+
+    p->file.setFileName(QString::fromUtf8(FileName));
+    if (!p->file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    FileHeader header {};
+    if (p->file.read(reinterpret_cast<char*>(&header), sizeof(header)) != qint64(sizeof(header))
+        || std::memcmp(header.magic, magic, sizeof(magic)) != 0 || header.version != version) {
+        p->file.close();
+        return false;
+    }
+
+    std::vector<ChunkEntry> entries(header.ctChunks);
+    qint64 tableSize = qint64(entries.size() * sizeof(ChunkEntry));
+    if (p->file.read(reinterpret_cast<char*>(entries.data()), tableSize) != tableSize) {
+        p->file.close();
+        return false;
+    }
+
+    p->header = header;
+    p->entries.swap(entries);
+    p->infos.clear();
+    p->infos.reserve(p->entries.size());
+    for (const auto& entry : p->entries) {
+        p->infos.push_back(ChunkInfo {entry.ctPoints, entry.ctFacets, GetBox(entry.box)});
+    }
+    return true;
+}
+
+void MeshOutOfCore::Close()
+{
+    std::lock_guard<std::mutex> lock(p->mutex);
+    p->Unmap();
+    if (p->file.isOpen()) {
+        p->file.close();
+    }
+    p->entries.clear();
+    p->infos.clear();
+    p->header = FileHeader {};
+}
+
+bool MeshOutOfCore::IsOpen() const
+{
+    return p->file.isOpen();
+}
+
+std::size_t MeshOutOfCore::CountChunks() const
+{
+    return p->entries.size();
+}
+
+FacetIndex MeshOutOfCore::CountFacets() const
+{
+    return p->header.ctFacets;
+}
+
+PointIndex MeshOutOfCore::CountPoints() const
+{
+    return p->header.ctPoints;
+}
+
+Base::BoundBox3f MeshOutOfCore::GetBoundBox() const
+{
+    if (p->entries.empty()) {
+        return Base::BoundBox3f();
+    }
+    return GetBox(p->header.box);
+}
+
+const MeshOutOfCore::ChunkInfo& MeshOutOfCore::GetChunkInfo(std::size_t chunk) const
+{
+    return p->infos.at(chunk);
+}
+
+void MeshOutOfCore::GetChunk(std::size_t chunk, MeshPointArray& rPoints, MeshFacetArray& rFacets) const
+{
+    const ChunkEntry& entry = p->entries.at(chunk);
+    rPoints.resize(entry.ctPoints);
+    rFacets.resize(entry.ctFacets);
+
+    std::lock_guard<std::mutex> lock(p->mutex);
+    const uchar* data = p->Map(chunk);
+    if (!data) {
+        return;
+    }
+
+    const float* coords = reinterpret_cast<const float*>(data);
+    for (std::size_t i = 0; i < rPoints.size(); i++) {
+        float xyz[3];
+        std::memcpy(xyz, coords + 3 * i, sizeof(xyz));
+        rPoints[i].Set(xyz[0], xyz[1], xyz[2]);
+    }
+
+    const uchar* facets = data + 3 * sizeof(float) * rPoints.size();
+    for (std::size_t i = 0; i < rFacets.size(); i++) {
+        std::uint32_t index[3];
+        std::memcpy(index, facets + 3 * sizeof(std::uint32_t) * i, sizeof(index));
+        rFacets[i]._aulPoints[0] = index[0];
+        rFacets[i]._aulPoints[1] = index[1];
+        rFacets[i]._aulPoints[2] = index[2];
+    }
+}
+
+void MeshOutOfCore::GetChunk(std::size_t chunk, MeshKernel& rclM) const
+{
+    MeshPointArray points;
+    MeshFacetArray facets;
+    GetChunk(chunk, points, facets);
+    rclM.Adopt(points, facets, true);
+}
@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#pragma once
+
+#include <vector>
+
+#include <Base/BoundBox.h>
+
+#include "Elements.h"
+
+
+namespace MeshCore
+{
+
+class MeshKernel;
+
+/**
+ * The MeshOutOfCore class gives access to meshes that are too big to be kept in memory as a
+ * whole. The mesh is stored in a file as a sequence of chunks, each with its own points and
+ * facets. A chunk is mapped into memory when it's accessed and kept in a cache of recently used
+ * chunks, so that the memory usage is bounded by the chunk and cache size and not by the size of
+ * the mesh.
+ *
+ * A chunk can be loaded into a MeshKernel so that the usual algorithms like the evaluation or
+ * decimation classes can be applied to it. Points on the border between two chunks are stored
+ * in both of them with the same coordinates, so that the chunks can be joined again by merging
+ * the points with MeshPointWelder.
+ */
+class MeshExport MeshOutOfCore
+{
+public:
+    /// Default count of facets per chunk
+    static constexpr std::size_t defaultChunkSize = 1 << 20;
+
+    struct ChunkInfo
+    {
+        PointIndex ctPoints {};
+        FacetIndex ctFacets {};
+        Base::BoundBox3f box;
+    };
+
+    /** Creates an instance that keeps at most \a ctCachedChunks chunks mapped. */
+    explicit MeshOutOfCore(std::size_t ctCachedChunks = 16);
+    ~MeshOutOfCore();
+
+    MeshOutOfCore(const MeshOutOfCore&) = delete;
+    MeshOutOfCore(MeshOutOfCore&&) = delete;
+    MeshOutOfCore& operator=(const MeshOutOfCore&) = delete;
+    MeshOutOfCore& operator=(MeshOutOfCore&&) = delete;
+
+    /** @name Creation */
+    //@{
+    /** Writes the mesh \a rclM into the file \a FileName with \a ctChunkFacets facets per chunk. */
+    static bool Create(const MeshKernel& rclM, const char* FileName, std::size_t ctChunkFacets = defaultChunkSize);
+    /** Converts the binary STL file \a STLFile into the file \a FileName with \a ctChunkFacets
+     * facets per chunk. The STL file is mapped into memory and only the points of one chunk
+     * are merged at a time, so this also works for files bigger than the main memory.
+     */
+    static bool CreateFromBinarySTL(
+        const char* STLFile,
+        const char* FileName,
+        std::size_t ctChunkFacets = defaultChunkSize
+    );
+    //@}
+
+    /** @name Access */
+    //@{
+    /** Opens a file written by Create() or CreateFromBinarySTL(). */
+    bool Open(const char* FileName);
+    void Close();
+    bool IsOpen() const;
+
+    std::size_t CountChunks() const;
+    FacetIndex CountFacets() const;
+    /** Returns the number of points of all chunks. Points on chunk borders are counted for each
+     * chunk they belong to. */
+    PointIndex CountPoints() const;
+    Base::BoundBox3f GetBoundBox() const;
+    const ChunkInfo& GetChunkInfo(std::size_t chunk) const;
+
+    /** Reads the points and facets of the chunk \a chunk. The neighbourhood of the facets is
+     * not set. This method is thread-safe. */
+    void GetChunk(std::size_t chunk, MeshPointArray& rPoints, MeshFacetArray& rFacets) const;
+    /** Loads the chunk \a chunk into \a rclM. This method is thread-safe. */
+    void GetChunk(std::size_t chunk, MeshKernel& rclM) const;
+    //@}
+
+private:
+    struct Private;
+    Private* p;
+};
+
+}  // namespace MeshCore
@@ -40,6 +40,7 @@ class TopoDS_Shape;
 namespace MeshCore
 {
 
+class MeshFacetBVH;
 class MeshFacetGrid;
 class MeshKernel;
 class MeshGeomFacet;
@@ -58,8 +59,28 @@ public:
         const Base::Vector3f& view,
         std::vector<Base::Vector3f>& polyline
     );
+    /** Does the same as the above method but uses a bounding volume hierarchy that must have
+     * been built for the untransformed mesh. */
+    bool projectLineOnMesh(
+        const MeshFacetBVH& bvh,
+        const Base::Vector3f& p1,
+        FacetIndex f1,
+        const Base::Vector3f& p2,
+        FacetIndex f2,
+        const Base::Vector3f& view,
+        std::vector<Base::Vector3f>& polyline
+    );
 
 protected:
+    bool projectLineOnFacets(
+        const std::vector<FacetIndex>& facets,
+        const Base::Vector3f& p1,
+        FacetIndex f1,
+        const Base::Vector3f& p2,
+        FacetIndex f2,
+        const Base::Vector3f& view,
+        std::vector<Base::Vector3f>& polyline
+    );
     bool bboxInsideRectangle(
         const Base::BoundBox3f& bbox,
         const Base::Vector3f& p1,
@@ -32,6 +32,19 @@
 
 using namespace MeshCore;
 
+namespace
+{
+// The cylinder and sphere fits are iterative and use all points. To avoid quadratic
+// run time when growing a segment they are only re-done once the number of points
+// has grown by 1/refitGrowth since the last fit.
+constexpr std::size_t refitGrowth = 20;
+
+bool needsRefit(std::size_t fittedPoints, std::size_t countPoints)
+{
+    return countPoints >= fittedPoints + fittedPoints / refitGrowth;
+}
+}  // namespace
+
 void MeshSurfaceSegment::Initialize(FacetIndex)
 {}
 
@@ -69,7 +82,7 @@ MeshDistancePlanarSegment::MeshDistancePlanarSegment(
     float tol
 )
     : MeshDistanceSurfaceSegment(mesh, minFacets, tol)
-    , fitter(new PlaneFit)
+    , fitter(new IncrementalPlaneFit)
 {}
 
 MeshDistancePlanarSegment::~MeshDistancePlanarSegment()
@@ -113,7 +126,7 @@ void MeshDistancePlanarSegment::AddFacet(const MeshFacet& face)
 // --------------------------------------------------------
 
 PlaneSurfaceFit::PlaneSurfaceFit()
-    : fitter(new PlaneFit)
+    : fitter(new IncrementalPlaneFit)
 {}
 
 PlaneSurfaceFit::PlaneSurfaceFit(const Base::Vector3f& b, const Base::Vector3f& n)
@@ -228,6 +241,7 @@ CylinderSurfaceFit::~CylinderSurfaceFit()
 void CylinderSurfaceFit::Initialize(const MeshCore::MeshGeomFacet& tria)
 {
     if (fitter) {
+        fittedPoints = 0;
         fitter->Clear();
         fitter->AddPoint(tria._aclPoints[0]);
         fitter->AddPoint(tria._aclPoints[1]);
@@ -255,7 +269,7 @@ bool CylinderSurfaceFit::TestTriangle(const MeshGeomFacet& tria) const
 bool CylinderSurfaceFit::Done() const
 {
     if (fitter) {
-        return fitter->Done();
+        return fitter->Done() || !needsRefit(fittedPoints, fitter->CountPoints());
     }
 
     return true;
@@ -268,6 +282,7 @@ float CylinderSurfaceFit::Fit()
     }
 
     float fit = fitter->Fit();
+    fittedPoints = fitter->CountPoints();
     if (fit < std::numeric_limits<float>::max()) {
         basepoint = fitter->GetBase();
         axis = fitter->GetAxis();
@@ -278,7 +293,7 @@ float CylinderSurfaceFit::Fit()
 
 float CylinderSurfaceFit::GetDistanceToSurface(const Base::Vector3f& pnt) const
 {
-    if (fitter && !fitter->Done()) {
+    if (fitter && fittedPoints == 0) {
         // collect some points
         return 0;
     }
@@ -331,6 +346,7 @@ SphereSurfaceFit::~SphereSurfaceFit()
 void SphereSurfaceFit::Initialize(const MeshCore::MeshGeomFacet& tria)
 {
     if (fitter) {
+        fittedPoints = 0;
         fitter->Clear();
         fitter->AddPoint(tria._aclPoints[0]);
         fitter->AddPoint(tria._aclPoints[1]);
@@ -356,7 +372,7 @@ bool SphereSurfaceFit::TestTriangle(const MeshGeomFacet&) const
 bool SphereSurfaceFit::Done() const
 {
     if (fitter) {
-        return fitter->Done();
+        return fitter->Done() || !needsRefit(fittedPoints, fitter->CountPoints());
     }
 
     return true;
@@ -369,6 +385,7 @@ float SphereSurfaceFit::Fit()
     }
 
     float fit = fitter->Fit();
+    fittedPoints = fitter->CountPoints();
     if (fit < std::numeric_limits<float>::max()) {
         center = fitter->GetCenter();
         radius = fitter->GetRadius();
@@ -35,7 +35,7 @@
 namespace MeshCore
 {
 
-class PlaneFit;
+class IncrementalPlaneFit;
 class CylinderFit;
 class SphereFit;
 class MeshFacet;
@@ -112,7 +112,7 @@ public:
 private:
     Base::Vector3f basepoint;
     Base::Vector3f normal;
-    PlaneFit* fitter;
+    IncrementalPlaneFit* fitter;
 };
 
 class MeshExport AbstractSurfaceFit
@@ -163,7 +163,7 @@ public:
 private:
     Base::Vector3f basepoint;
     Base::Vector3f normal;
-    PlaneFit* fitter;
+    IncrementalPlaneFit* fitter;
 };
 
 class MeshExport CylinderSurfaceFit: public AbstractSurfaceFit
@@ -195,6 +195,7 @@ private:
     Base::Vector3f axis;
     float radius;
     CylinderFit* fitter;
+    std::size_t fittedPoints {0};
 };
 
 class MeshExport SphereSurfaceFit: public AbstractSurfaceFit
@@ -225,6 +226,7 @@ private:
     Base::Vector3f center;
     float radius;
     SphereFit* fitter;
+    std::size_t fittedPoints {0};
 };
 
 class MeshExport MeshDistanceGenericSurfaceFitSegment: public MeshDistanceSurfaceSegment
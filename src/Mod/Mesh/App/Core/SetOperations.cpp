@@ -23,17 +23,22 @@
  ***************************************************************************/
 
 
+#include <cmath>
 #include <fstream>
 #include <ios>
+#include <numbers>
 
+#include <QtConcurrentMap>
 
 #include <Base/Builder3D.h>
+#include <Base/Converter.h>
 #include <Base/Sequencer.h>
 
 #include "Algorithm.h"
 #include "Builder.h"
 #include "Definitions.h"
 #include "Elements.h"
+#include "FacetPairs.h"
 #include "Grid.h"
 #include "Iterator.h"
 #include "SetOperations.h"
@@ -44,6 +49,36 @@
 using namespace Base;
 using namespace MeshCore;
 
+namespace
+{
+// Generalized winding number of a point w.r.t. a mesh. It's the sum of the signed solid
+// angles of all facets divided by 4*pi and is close to 1 for points inside a closed mesh
+// and close to 0 outside, even if the mesh has small gaps or self-intersections.
+double GeneralizedWindingNumber(const MeshKernel& mesh, const Base::Vector3f& point)
+{
+    const MeshPointArray& points = mesh.GetPoints();
+    const MeshFacetArray& facets = mesh.GetFacets();
+    Base::Vector3d pnt = Base::convertTo<Base::Vector3d>(point);
+
+    double angle = 0.0;
+    for (const auto& facet : facets) {
+        Base::Vector3d a = Base::convertTo<Base::Vector3d>(points[facet._aulPoints[0]]) - pnt;
+        Base::Vector3d b = Base::convertTo<Base::Vector3d>(points[facet._aulPoints[1]]) - pnt;
+        Base::Vector3d c = Base::convertTo<Base::Vector3d>(points[facet._aulPoints[2]]) - pnt;
+        double la = a.Length();
+        double lb = b.Length();
+        double lc = c.Length();
+
+        // Van Oosterom and Strackee
+        double num = a * (b % c);
+        double den = la * lb * lc + (a * b) * lc + (b * c) * la + (c * a) * lb;
+        angle += 2.0 * std::atan2(num, den);
+    }
+
+    return angle / (4.0 * std::numbers::pi);
+}
+}  // namespace
+
 
 SetOperations::SetOperations(
     const MeshKernel& cutMesh1,
@@ -74,7 +109,9 @@ void SetOperations::Do()
     Cut(facetsCuttingEdge0, facetsCuttingEdge1);
 
     // no intersection curve of the meshes found
-    if (facetsCuttingEdge0.empty() || facetsCuttingEdge1.empty()) {
+    // With winding numbers the meshes are classified as a whole further below
+    bool noCut = facetsCuttingEdge0.empty() || facetsCuttingEdge1.empty();
+    if (noCut && _classification == EdgeOrientation) {
         switch (_operationType) {
             case Union: {
                 _resultMesh = _cutMesh0;
@@ -175,239 +212,203 @@ void SetOperations::Do()
 
 void SetOperations::Cut(std::set<FacetIndex>& facetsCuttingEdge0, std::set<FacetIndex>& facetsCuttingEdge1)
 {
-    MeshFacetGrid grid1(_cutMesh0, 20);
-    MeshFacetGrid grid2(_cutMesh1, 20);
-
-    unsigned long ctGx1 {}, ctGy1 {}, ctGz1 {};
-    grid1.GetCtGrids(ctGx1, ctGy1, ctGz1);
-
-    for (auto gx1 = 0UL; gx1 < ctGx1; gx1++) {
-        for (auto gy1 = 0UL; gy1 < ctGy1; gy1++) {
-            for (auto gz1 = 0UL; gz1 < ctGz1; gz1++) {
-                if (grid1.GetCtElements(gx1, gy1, gz1) > 0) {
-                    std::vector<FacetIndex> vecFacets2;
-                    grid2.Inside(grid1.GetBoundBox(gx1, gy1, gz1), vecFacets2);
-
-                    if (!vecFacets2.empty()) {
-                        std::set<FacetIndex> vecFacets1;
-                        grid1.GetElements(gx1, gy1, gz1, vecFacets1);
-
-                        std::set<FacetIndex>::iterator it1;
-                        for (it1 = vecFacets1.begin(); it1 != vecFacets1.end(); ++it1) {
-                            FacetIndex fidx1 = *it1;
-                            MeshGeomFacet f1 = _cutMesh0.GetFacet(*it1);
-
-                            std::vector<FacetIndex>::iterator it2;
-                            for (it2 = vecFacets2.begin(); it2 != vecFacets2.end(); ++it2) {
-                                FacetIndex fidx2 = *it2;
-                                MeshGeomFacet f2 = _cutMesh1.GetFacet(fidx2);
-
-                                MeshPoint p0, p1;
-
-                                int isect = f1.IntersectWithFacet(f2, p0, p1);
-                                if (isect > 0) {
-                                    // optimize cut line if distance to nearest point is too small
-                                    float minDist1 = _minDistanceToPoint,
-                                          minDist2 = _minDistanceToPoint;
-                                    MeshPoint np0 = p0, np1 = p1;
-                                    for (int i = 0; i < 3; i++)  // NOLINT
-                                    {
-                                        float d1 = (f1._aclPoints[i] - p0).Length();
-                                        float d2 = (f1._aclPoints[i] - p1).Length();
-                                        if (d1 < minDist1) {
-                                            minDist1 = d1;
-                                            np0 = f1._aclPoints[i];
-                                        }
-                                        if (d2 < minDist2) {
-                                            minDist2 = d2;
-                                            p1 = f1._aclPoints[i];
-                                        }
-                                    }  // for (int i = 0; i < 3; i++)
-
-                                    // optimize cut line if distance to nearest point is too small
-                                    for (int i = 0; i < 3; i++)  // NOLINT
-                                    {
-                                        float d1 = (f2._aclPoints[i] - p0).Length();
-                                        float d2 = (f2._aclPoints[i] - p1).Length();
-                                        if (d1 < minDist1) {
-                                            minDist1 = d1;
-                                            np0 = f2._aclPoints[i];
-                                        }
-                                        if (d2 < minDist2) {
-                                            minDist2 = d2;
-                                            np1 = f2._aclPoints[i];
-                                        }
-                                    }  // for (int i = 0; i < 3; i++)
-
-                                    MeshPoint mp0 = np0;
-                                    MeshPoint mp1 = np1;
-
-                                    if (mp0 != mp1) {
-                                        facetsCuttingEdge0.insert(fidx1);
-                                        facetsCuttingEdge1.insert(fidx2);
-
-                                        _cutPoints.insert(mp0);
-                                        _cutPoints.insert(mp1);
-
-                                        std::pair<std::set<MeshPoint>::iterator, bool> pit0
-                                            = _cutPoints.insert(mp0);
-                                        std::pair<std::set<MeshPoint>::iterator, bool> pit1
-                                            = _cutPoints.insert(mp1);
-
-                                        _edges[Edge(mp0, mp1)] = EdgeInfo();
-
-                                        _facet2points[0][fidx1].push_back(pit0.first);
-                                        _facet2points[0][fidx1].push_back(pit1.first);
-                                        _facet2points[1][fidx2].push_back(pit0.first);
-                                        _facet2points[1][fidx2].push_back(pit1.first);
-                                    }
-                                    else {
-                                        std::pair<std::set<MeshPoint>::iterator, bool> pit
-                                            = _cutPoints.insert(mp0);
-
-                                        // do not insert a facet when only one corner point cuts the
-                                        // edge if (!((mp0 == f1._aclPoints[0]) || (mp0 ==
-                                        // f1._aclPoints[1]) || (mp0 == f1._aclPoints[2])))
-                                        {
-                                            facetsCuttingEdge0.insert(fidx1);
-                                            _facet2points[0][fidx1].push_back(pit.first);
-                                        }
-
-                                        // if (!((mp0 == f2._aclPoints[0]) || (mp0 ==
-                                        // f2._aclPoints[1]) || (mp0 == f2._aclPoints[2])))
-                                        {
-                                            facetsCuttingEdge1.insert(fidx2);
-                                            _facet2points[1][fidx2].push_back(pit.first);
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
+    std::vector<FacetPair> pairs = MeshFacetPairs::Candidates(_cutMesh0, _cutMesh1);
+    std::vector<MeshFacetPairs::Intersection> intersections
+        = MeshFacetPairs::Intersect(_cutMesh0, _cutMesh1, pairs);
+
+    for (const auto& it : intersections) {
+        FacetIndex fidx1 = it.facets.first;
+        FacetIndex fidx2 = it.facets.second;
+        MeshGeomFacet f1 = _cutMesh0.GetFacet(fidx1);
+        MeshGeomFacet f2 = _cutMesh1.GetFacet(fidx2);
+        MeshPoint p0 = it.p1;
+        MeshPoint p1 = it.p2;
+
+        // optimize cut line if distance to nearest point is too small
+        float minDist1 = _minDistanceToPoint, minDist2 = _minDistanceToPoint;
+        MeshPoint np0 = p0, np1 = p1;
+        for (int i = 0; i < 3; i++)  // NOLINT
+        {
+            float d1 = (f1._aclPoints[i] - p0).Length();
+            float d2 = (f1._aclPoints[i] - p1).Length();
+            if (d1 < minDist1) {
+                minDist1 = d1;
+                np0 = f1._aclPoints[i];
+            }
+            if (d2 < minDist2) {
+                minDist2 = d2;
+                p1 = f1._aclPoints[i];
+            }
+        }  // for (int i = 0; i < 3; i++)
+
+        // optimize cut line if distance to nearest point is too small
+        for (int i = 0; i < 3; i++)  // NOLINT
+        {
+            float d1 = (f2._aclPoints[i] - p0).Length();
+            float d2 = (f2._aclPoints[i] - p1).Length();
+            if (d1 < minDist1) {
+                minDist1 = d1;
+                np0 = f2._aclPoints[i];
+            }
+            if (d2 < minDist2) {
+                minDist2 = d2;
+                np1 = f2._aclPoints[i];
+            }
+        }  // for (int i = 0; i < 3; i++)
+
+        MeshPoint mp0 = np0;
+        MeshPoint mp1 = np1;
+
+        if (mp0 != mp1) {
+            facetsCuttingEdge0.insert(fidx1);
+            facetsCuttingEdge1.insert(fidx2);
+
+            _cutPoints.insert(mp0);
+            _cutPoints.insert(mp1);
+
+            std::pair<std::set<MeshPoint>::iterator, bool> pit0 = _cutPoints.insert(mp0);
+            std::pair<std::set<MeshPoint>::iterator, bool> pit1 = _cutPoints.insert(mp1);
+
+            _edges[Edge(mp0, mp1)] = EdgeInfo();
+
+            _facet2points[0][fidx1].push_back(pit0.first);
+            _facet2points[0][fidx1].push_back(pit1.first);
+            _facet2points[1][fidx2].push_back(pit0.first);
+            _facet2points[1][fidx2].push_back(pit1.first);
+        }
+        else {
+            std::pair<std::set<MeshPoint>::iterator, bool> pit = _cutPoints.insert(mp0);
+
+            // do not insert a facet when only one corner point cuts the edge
+            // if (!((mp0 == f1._aclPoints[0]) || (mp0 == f1._aclPoints[1]) || (mp0 ==
+            // f1._aclPoints[2])))
+            {
+                facetsCuttingEdge0.insert(fidx1);
+                _facet2points[0][fidx1].push_back(pit.first);
+            }
+
+            // if (!((mp0 == f2._aclPoints[0]) || (mp0 == f2._aclPoints[1]) || (mp0 ==
+            // f2._aclPoints[2])))
+            {
+                facetsCuttingEdge1.insert(fidx2);
+                _facet2points[1][fidx2].push_back(pit.first);
             }
         }
     }
 }
 
-void SetOperations::TriangulateMesh(const MeshKernel& cutMesh, int side)
+std::vector<MeshGeomFacet> SetOperations::SplitFacet(
+    const MeshGeomFacet& f,
+    const std::list<std::set<MeshPoint>::iterator>& cutPoints
+) const
 {
-    // Triangulate Mesh
-    std::map<FacetIndex, std::list<std::set<MeshPoint>::iterator>>::iterator it1;
-    for (it1 = _facet2points[side].begin(); it1 != _facet2points[side].end(); ++it1) {
-        std::vector<Vector3f> points;
-        std::set<MeshPoint> pointsSet;
+    std::vector<Vector3f> points;
+    std::set<MeshPoint> pointsSet;
+
+    // facet corner points
+    for (int i = 0; i < 3; i++)  // NOLINT
+    {
+        pointsSet.insert(f._aclPoints[i]);
+        points.push_back(f._aclPoints[i]);
+    }
 
-        FacetIndex fidx = it1->first;
-        MeshGeomFacet f = cutMesh.GetFacet(fidx);
+    // triangulated facets
+    for (const auto& it : cutPoints) {
+        if (pointsSet.find(*it) == pointsSet.end()) {
+            pointsSet.insert(*it);
+            points.push_back(*it);
+        }
+    }
 
-        // if (side == 1)
-        //     _builder.addSingleTriangle(f._aclPoints[0], f._aclPoints[1], f._aclPoints[2], 3, 0,
-        //     1, 1);
+    Vector3f normal = f.GetNormal();
+    Vector3f base = points[0];
+    Vector3f dirX = points[1] - points[0];
+    dirX.Normalize();
+    Vector3f dirY = dirX % normal;
+
+    // project points to 2D plane
+    std::vector<Vector3f> vertices;
+    for (const auto& it : points) {
+        Vector3f pv = it;
+        pv.TransformToCoordinateSystem(base, dirX, dirY);
+        vertices.push_back(pv);
+    }
 
-        // facet corner points
-        // const MeshFacet& mf = cutMesh._aclFacetArray[fidx];
-        for (int i = 0; i < 3; i++)  // NOLINT
-        {
-            pointsSet.insert(f._aclPoints[i]);
-            points.push_back(f._aclPoints[i]);
-        }
+    DelaunayTriangulator tria;
+    tria.SetPolygon(vertices);
+    tria.TriangulatePolygon();
 
-        // triangulated facets
-        std::list<std::set<MeshPoint>::iterator>::iterator it2;
-        for (it2 = it1->second.begin(); it2 != it1->second.end(); ++it2) {
-            if (pointsSet.find(*(*it2)) == pointsSet.end()) {
-                pointsSet.insert(*(*it2));
-                points.push_back(*(*it2));
-            }
+    std::vector<MeshGeomFacet> splitFacets;
+    std::vector<MeshFacet> facets = tria.GetFacets();
+    for (auto& it : facets) {
+        if ((it._aulPoints[0] == it._aulPoints[1]) || (it._aulPoints[1] == it._aulPoints[2])
+            || (it._aulPoints[2] == it._aulPoints[0])) {  // two same triangle corner points
+            continue;
         }
 
-        Vector3f normal = f.GetNormal();
-        Vector3f base = points[0];
-        Vector3f dirX = points[1] - points[0];
-        dirX.Normalize();
-        Vector3f dirY = dirX % normal;
-
-        // project points to 2D plane
-        std::vector<Vector3f>::iterator it;
-        std::vector<Vector3f> vertices;
-        for (it = points.begin(); it != points.end(); ++it) {
-            Vector3f pv = *it;
-            pv.TransformToCoordinateSystem(base, dirX, dirY);
-            vertices.push_back(pv);
+        MeshGeomFacet facet(
+            points[it._aulPoints[0]],
+            points[it._aulPoints[1]],
+            points[it._aulPoints[2]]
+        );
+
+        float dist0 = facet._aclPoints[0].DistanceToLine(
+            facet._aclPoints[1],
+            facet._aclPoints[1] - facet._aclPoints[2]
+        );
+        float dist1 = facet._aclPoints[1].DistanceToLine(
+            facet._aclPoints[0],
+            facet._aclPoints[0] - facet._aclPoints[2]
+        );
+        float dist2 = facet._aclPoints[2].DistanceToLine(
+            facet._aclPoints[0],
+            facet._aclPoints[0] - facet._aclPoints[1]
+        );
+
+        if ((dist0 < _minDistanceToPoint) || (dist1 < _minDistanceToPoint)
+            || (dist2 < _minDistanceToPoint)) {
+            continue;
         }
 
-        DelaunayTriangulator tria;
-        tria.SetPolygon(vertices);
-        tria.TriangulatePolygon();
-
-        std::vector<MeshFacet> facets = tria.GetFacets();
-        for (auto& it : facets) {
-            if ((it._aulPoints[0] == it._aulPoints[1]) || (it._aulPoints[1] == it._aulPoints[2])
-                || (it._aulPoints[2] == it._aulPoints[0])) {  // two same triangle corner points
-                continue;
-            }
+        facet.CalcNormal();
+        if ((facet.GetNormal() * f.GetNormal()) < 0.0F) {  // adjust normal
+            std::swap(facet._aclPoints[0], facet._aclPoints[1]);
+            facet.CalcNormal();
+        }
 
-            MeshGeomFacet facet(
-                points[it._aulPoints[0]],
-                points[it._aulPoints[1]],
-                points[it._aulPoints[2]]
-            );
-
-            // if (side == 1)
-            //  _builder.addSingleTriangle(facet._aclPoints[0], facet._aclPoints[1],
-            //  facet._aclPoints[2], true, 3, 0, 1, 1);
-
-            // if (facet.Area() < 0.0001f)
-            //{ // too small facet
-            //   continue;
-            // }
-
-            float dist0 = facet._aclPoints[0].DistanceToLine(
-                facet._aclPoints[1],
-                facet._aclPoints[1] - facet._aclPoints[2]
-            );
-            float dist1 = facet._aclPoints[1].DistanceToLine(
-                facet._aclPoints[0],
-                facet._aclPoints[0] - facet._aclPoints[2]
-            );
-            float dist2 = facet._aclPoints[2].DistanceToLine(
-                facet._aclPoints[0],
-                facet._aclPoints[0] - facet._aclPoints[1]
-            );
-
-            if ((dist0 < _minDistanceToPoint) || (dist1 < _minDistanceToPoint)
-                || (dist2 < _minDistanceToPoint)) {
-                continue;
-            }
+        splitFacets.push_back(facet);
+    }
 
-            // dist0 = (facet._aclPoints[0] - facet._aclPoints[1]).Length();
-            // dist1 = (facet._aclPoints[1] - facet._aclPoints[2]).Length();
-            // dist2 = (facet._aclPoints[2] - facet._aclPoints[3]).Length();
+    return splitFacets;
+}
 
-            // if ((dist0 < _minDistanceToPoint) || (dist1 < _minDistanceToPoint) || (dist2 <
-            // _minDistanceToPoint))
-            //{
-            //   continue;
-            // }
+void SetOperations::TriangulateMesh(const MeshKernel& cutMesh, int side)
+{
+    // The facets are triangulated independently of each other
+    using FacetPoints = std::map<FacetIndex, std::list<std::set<MeshPoint>::iterator>>::const_iterator;
+    std::vector<FacetPoints> cutFacets;
+    cutFacets.reserve(_facet2points[side].size());
+    for (auto it = _facet2points[side].cbegin(); it != _facet2points[side].cend(); ++it) {
+        cutFacets.push_back(it);
+    }
 
-            facet.CalcNormal();
-            if ((facet.GetNormal() * f.GetNormal()) < 0.0F) {  // adjust normal
-                std::swap(facet._aclPoints[0], facet._aclPoints[1]);
-                facet.CalcNormal();
+    std::vector<std::vector<MeshGeomFacet>> splitFacets
+        = QtConcurrent::blockingMapped<std::vector<std::vector<MeshGeomFacet>>>(
+            cutFacets,
+            [this, &cutMesh](const FacetPoints& it) {
+                return SplitFacet(cutMesh.GetFacet(it->first), it->second);
             }
+        );
 
-
+    // Assign the new facets to the cut edges in the order of the facet indices
+    for (std::size_t i = 0; i < cutFacets.size(); i++) {
+        FacetIndex fidx = cutFacets[i]->first;
+        for (auto& facet : splitFacets[i]) {
             for (int j = 0; j < 3; j++) {
                 auto eit = _edges.find(Edge(facet._aclPoints[j], facet._aclPoints[(j + 1) % 3]));
 
                 if (eit != _edges.end()) {
-
                     if (eit->second.fcounter[side] < 2) {
-                        // if (side == 0)
-                        //    _builder.addSingleTriangle(facet._aclPoints[0], facet._aclPoints[1],
-                        //    facet._aclPoints[2], true, 3, 0, 1, 1);
-
                         eit->second.facet[side] = fidx;
                         eit->second.facets[side][eit->second.fcounter[side]] = facet;
                         eit->second.fcounter[side]++;
@@ -445,6 +446,8 @@ void SetOperations::CollectFacets(int side, float mult)
 
     // bool hasFacetsNotVisited = true; // until facets not visited
     // search for facet not visited
+    std::vector<std::vector<FacetIndex>> regions;
+    std::vector<int> addRegion;
     MeshFacetArray::_TConstIterator itf;
     const MeshFacetArray& rFacets = mesh.GetFacets();
     for (itf = rFacets.begin(); itf != rFacets.end(); ++itf) {
@@ -454,9 +457,37 @@ void SetOperations::CollectFacets(int side, float mult)
             CollectFacetVisitor visitor(mesh, facets, _edges, side, mult, _builder);
             mesh.VisitNeighbourFacets(visitor, itf - rFacets.begin());
 
-            if (visitor._addFacets == 0) {  // mark all facets to add it to the result
-                algo.SetFacetsFlag(facets, MeshFacet::TMP0);
+            regions.push_back(facets);
+            addRegion.push_back(visitor._addFacets);
+        }
+    }
+
+    if (_classification == WindingNumber) {
+        // the seed facet of each region decides whether it's inside the other mesh
+        const MeshKernel& other = side == 0 ? _cutMesh1 : _cutMesh0;
+        std::vector<Base::Vector3f> seeds;
+        seeds.reserve(regions.size());
+        for (const auto& it : regions) {
+            seeds.push_back(mesh.GetFacet(it.front()).GetGravityPoint());
+        }
+
+        std::vector<double> winding = QtConcurrent::blockingMapped<std::vector<double>>(
+            seeds,
+            [&other](const Base::Vector3f& seed) {
+                return GeneralizedWindingNumber(other, seed);
             }
+        );
+
+        for (std::size_t i = 0; i < regions.size(); i++) {
+            bool inside = std::fabs(winding[i]) > 0.5;
+            bool add = (mult > 0.0F && inside) || (mult < 0.0F && !inside);
+            addRegion[i] = add ? 0 : 1;
+        }
+    }
+
+    for (std::size_t i = 0; i < regions.size(); i++) {
+        if (addRegion[i] == 0) {  // mark all facets to add it to the result
+            algo.SetFacetsFlag(regions[i], MeshFacet::TMP0);
         }
     }
 
@@ -638,107 +669,23 @@ bool MeshIntersection::hasIntersection() const
 
 void MeshIntersection::getIntersection(std::list<MeshIntersection::Tuple>& intsct) const
 {
-    const MeshKernel& k1 = kernel1;
-    const MeshKernel& k2 = kernel2;
-
-    // Contains bounding boxes for every facet of 'k1'
-    std::vector<Base::BoundBox3f> boxes1;
-    MeshFacetIterator cMFI1(k1);
-    for (cMFI1.Begin(); cMFI1.More(); cMFI1.Next()) {
-        boxes1.push_back((*cMFI1).GetBoundBox());
-    }
-
-    // Contains bounding boxes for every facet of 'k2'
-    std::vector<Base::BoundBox3f> boxes2;
-    MeshFacetIterator cMFI2(k2);
-    for (cMFI2.Begin(); cMFI2.More(); cMFI2.Next()) {
-        boxes2.push_back((*cMFI2).GetBoundBox());
-    }
-
-    // Splits the mesh using grid for speeding up the calculation
-    MeshFacetGrid cMeshFacetGrid(k1);
-
-    const MeshFacetArray& rFaces2 = k2.GetFacets();
-    Base::SequencerLauncher seq("Checking for intersections...", rFaces2.size());
-    int index = 0;
-    MeshGeomFacet facet1, facet2;
-    Base::Vector3f pt1, pt2;
-
-    // Iterate over the facets of the 2nd mesh and find the grid elements of the 1st mesh
-    for (auto it = rFaces2.begin(); it != rFaces2.end(); ++it, index++) {
-        seq.next();
-        std::vector<FacetIndex> elements;
-        cMeshFacetGrid.Inside(boxes2[index], elements, true);
-
-        cMFI2.Set(index);
-        facet2 = *cMFI2;
-
-        for (FacetIndex element : elements) {
-            if (boxes2[index] && boxes1[element]) {
-                cMFI1.Set(element);
-                facet1 = *cMFI1;
-                int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
-                if (ret == 2) {
-                    Tuple d;
-                    d.p1 = pt1;
-                    d.p2 = pt2;
-                    d.f1 = element;
-                    d.f2 = index;
-                    intsct.push_back(d);
-                }
-            }
+    std::vector<FacetPair> pairs = MeshFacetPairs::Candidates(kernel1, kernel2);
+    for (const auto& it : MeshFacetPairs::Intersect(kernel1, kernel2, pairs)) {
+        if (it.points == 2) {
+            Tuple d;
+            d.p1 = it.p1;
+            d.p2 = it.p2;
+            d.f1 = it.facets.first;
+            d.f2 = it.facets.second;
+            intsct.push_back(d);
         }
     }
 }
 
 bool MeshIntersection::testIntersection(const MeshKernel& k1, const MeshKernel& k2)
 {
-    // Contains bounding boxes for every facet of 'k1'
-    std::vector<Base::BoundBox3f> boxes1;
-    MeshFacetIterator cMFI1(k1);
-    for (cMFI1.Begin(); cMFI1.More(); cMFI1.Next()) {
-        boxes1.push_back((*cMFI1).GetBoundBox());
-    }
-
-    // Contains bounding boxes for every facet of 'k2'
-    std::vector<Base::BoundBox3f> boxes2;
-    MeshFacetIterator cMFI2(k2);
-    for (cMFI2.Begin(); cMFI2.More(); cMFI2.Next()) {
-        boxes2.push_back((*cMFI2).GetBoundBox());
-    }
-
-    // Splits the mesh using grid for speeding up the calculation
-    MeshFacetGrid cMeshFacetGrid(k1);
-
-    const MeshFacetArray& rFaces2 = k2.GetFacets();
-    Base::SequencerLauncher seq("Checking for intersections...", rFaces2.size());
-    int index = 0;
-    MeshGeomFacet facet1, facet2;
-    Base::Vector3f pt1, pt2;
-
-    // Iterate over the facets of the 2nd mesh and find the grid elements of the 1st mesh
-    for (auto it = rFaces2.begin(); it != rFaces2.end(); ++it, index++) {
-        seq.next();
-        std::vector<FacetIndex> elements;
-        cMeshFacetGrid.Inside(boxes2[index], elements, true);
-
-        cMFI2.Set(index);
-        facet2 = *cMFI2;
-
-        for (FacetIndex element : elements) {
-            if (boxes2[index] && boxes1[element]) {
-                cMFI1.Set(element);
-                facet1 = *cMFI1;
-                int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
-                if (ret == 2) {
-                    // abort after the first detected self-intersection
-                    return true;
-                }
-            }
-        }
-    }
-
-    return false;
+    std::vector<FacetPair> pairs = MeshFacetPairs::Candidates(k1, k2);
+    return MeshFacetPairs::HasIntersection(k1, k2, pairs);
 }
 
 void MeshIntersection::connectLines(
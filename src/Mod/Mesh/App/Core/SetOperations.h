@@ -63,6 +63,13 @@ public:
         Outer
     };
 
+    /// Determines how the split parts of the meshes are classified as inside or outside
+    enum Classification
+    {
+        EdgeOrientation, /**< Compare the facet orientations along the intersection curve */
+        WindingNumber    /**< Compute the winding number of each part w.r.t. the other mesh */
+    };
+
     /// Construction
     SetOperations(
         const MeshKernel& cutMesh1,
@@ -78,6 +85,15 @@ public:
      * polyline goes direct to the point
      */
     void Do();
+    /** Sets how the parts are classified. The default is EdgeOrientation which only works if
+     * every part touches the intersection curve. WindingNumber is slower but also handles
+     * parts that are not connected to the curve or meshes that do not intersect at all. It
+     * requires closed meshes.
+     */
+    void SetClassification(Classification type)
+    {
+        _classification = type;
+    }
 
 private:
     const MeshKernel& _cutMesh0;  /** Mesh for set operations source 1 */
@@ -85,6 +101,7 @@ private:
     MeshKernel& _resultMesh;      /** Result mesh */
     OperationType _operationType; /** Set Operation Type */
     float _minDistanceToPoint;    /** Minimal distance to facet corner points */
+    Classification _classification {EdgeOrientation}; /** Classification of the parts */
 
 private:
     // Helper class cutting edge to its two attached facets
@@ -194,6 +211,11 @@ private:
     void Cut(std::set<FacetIndex>& facetsCuttingEdge0, std::set<FacetIndex>& facetsCuttingEdge1);
     /** Trianglute each facets cut with its cutting points */
     void TriangulateMesh(const MeshKernel& cutMesh, int side);
+    /** Triangulate a single facet with its cutting points */
+    std::vector<MeshGeomFacet> SplitFacet(
+        const MeshGeomFacet& facet,
+        const std::list<std::set<MeshPoint>::iterator>& cutPoints
+    ) const;
     /** search facets for adding (with region growing) */
     void CollectFacets(int side, float mult);
     /** close gap in the mesh */
@@ -24,10 +24,13 @@
 
 #include <algorithm>
 #include <cmath>
+#include <numeric>
 
+#include <QtConcurrentMap>
 
 #include <Base/Sequencer.h>
 
+#include "BVH.h"
 #include "Grid.h"
 #include "Iterator.h"
 #include "Trim.h"
@@ -106,6 +109,55 @@ void MeshTrimming::CheckFacets(const MeshFacetGrid& rclGrid, std::vector<FacetIn
     }
 }
 
+void MeshTrimming::CheckFacets(const MeshFacetBVH& rclBVH, std::vector<FacetIndex>& raulFacets) const
+{
+    // Only facets whose projected bounding box touches the polygon need a closer look, whole
+    // subtrees are skipped this way. The other facets lie completely outside the polygon.
+    std::vector<FacetIndex> candidates;
+    rclBVH.Inside(
+        [this](const Base::BoundBox3f& box) {
+            return box.ProjectBox(myProj).Intersect(myPoly);
+        },
+        candidates
+    );
+    std::sort(candidates.begin(), candidates.end());
+
+    const std::size_t chunkSize = 4096;
+    std::vector<char> hit(candidates.size());
+    std::vector<std::size_t> chunks((candidates.size() + chunkSize - 1) / chunkSize);
+    std::iota(chunks.begin(), chunks.end(), 0);
+    QtConcurrent::blockingMap(chunks, [&](std::size_t& chunk) {
+        std::size_t end = std::min(candidates.size(), (chunk + 1) * chunkSize);
+        for (std::size_t i = chunk * chunkSize; i < end; i++) {
+            hit[i] = HasIntersection(myMesh.GetFacet(candidates[i])) ? 1 : 0;
+        }
+    });
+
+    if (myInner) {
+        for (std::size_t i = 0; i < candidates.size(); i++) {
+            if (hit[i]) {
+                raulFacets.push_back(candidates[i]);
+            }
+        }
+    }
+    else {
+        // cut outer: the facets outside the polygon are affected, too
+        auto it = candidates.begin();
+        std::size_t numFacets = myMesh.CountFacets();
+        for (FacetIndex index = 0; index < numFacets; index++) {
+            if (it != candidates.end() && *it == index) {
+                if (hit[it - candidates.begin()]) {
+                    raulFacets.push_back(index);
+                }
+                ++it;
+            }
+            else {
+                raulFacets.push_back(index);
+            }
+        }
+    }
+}
+
 bool MeshTrimming::HasIntersection(const MeshGeomFacet& rclFacet) const
 {
     Base::Polygon2d clPoly;
@@ -32,6 +32,8 @@
 namespace MeshCore
 {
 
+class MeshFacetBVH;
+
 /**
  * Checks the facets in 2D and then trim them in 3D
  */
@@ -53,6 +55,11 @@ public:
      * vector
      */
     void CheckFacets(const MeshFacetGrid& rclGrid, std::vector<FacetIndex>& raulFacets) const;
+    /**
+     * Does the same as the method above but only tests the facets of the subtrees whose projected
+     * bounding box touches the polygon. The remaining facets are tested in parallel.
+     */
+    void CheckFacets(const MeshFacetBVH& rclBVH, std::vector<FacetIndex>& raulFacets) const;
 
     /**
      * The facets from raulFacets will be trimmed or deleted and aclNewFacets gives the new
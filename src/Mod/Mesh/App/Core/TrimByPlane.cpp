@@ -23,8 +23,11 @@
  ***************************************************************************/
 
 #include <algorithm>
+#include <numeric>
 
+#include <QtConcurrentMap>
 
+#include "BVH.h"
 #include "Grid.h"
 #include "Iterator.h"
 #include "TrimByPlane.h"
@@ -32,6 +35,41 @@
 
 using namespace MeshCore;
 
+namespace
+{
+const std::size_t chunkSize = 4096;
+
+std::vector<std::size_t> MakeChunks(std::size_t count)
+{
+    std::vector<std::size_t> chunks((count + chunkSize - 1) / chunkSize);
+    std::iota(chunks.begin(), chunks.end(), 0);
+    return chunks;
+}
+
+// Clips a convex polygon to the part below the plane
+std::vector<Base::Vector3f> ClipPolygon(
+    const std::vector<Base::Vector3f>& poly,
+    const Base::Vector3f& base,
+    const Base::Vector3f& normal
+)
+{
+    std::vector<Base::Vector3f> clipped;
+    for (std::size_t i = 0; i < poly.size(); i++) {
+        const Base::Vector3f& p = poly[i];
+        const Base::Vector3f& q = poly[(i + 1) % poly.size()];
+        float dp = p.DistanceToPlane(base, normal);
+        float dq = q.DistanceToPlane(base, normal);
+        if (dp <= 0.0F) {
+            clipped.push_back(p);
+        }
+        if ((dp < 0.0F && dq > 0.0F) || (dp > 0.0F && dq < 0.0F)) {
+            clipped.push_back(p + (q - p) * (dp / (dp - dq)));
+        }
+    }
+    return clipped;
+}
+}  // namespace
+
 MeshTrimByPlane::MeshTrimByPlane(MeshKernel& mesh)
     : myMesh(mesh)
 {}
@@ -82,6 +120,51 @@ void MeshTrimByPlane::CheckFacets(
     removeFacets.erase(std::unique(removeFacets.begin(), removeFacets.end()), removeFacets.end());
 }
 
+void MeshTrimByPlane::CheckFacets(
+    const MeshFacetBVH& rclBVH,
+    const Base::Vector3f& base,
+    const Base::Vector3f& normal,
+    std::vector<FacetIndex>& trimFacets,
+    std::vector<FacetIndex>& removeFacets
+) const
+{
+    // Facets whose bounding box is completely below the plane will be kept
+    std::vector<FacetIndex> checkElements;
+    rclBVH.Inside(
+        [&base, &normal](const Base::BoundBox3f& box) {
+            return box.IsCutPlane(base, normal)
+                || box.CalcPoint(Base::BoundBox3f::TLB).DistanceToPlane(base, normal) > 0.0F;
+        },
+        checkElements
+    );
+    std::sort(checkElements.begin(), checkElements.end());
+
+    // 0: keep, 1: remove, 2: trim
+    std::vector<char> status(checkElements.size());
+    std::vector<std::size_t> chunks = MakeChunks(checkElements.size());
+    QtConcurrent::blockingMap(chunks, [&](std::size_t& chunk) {
+        std::size_t end = std::min(checkElements.size(), (chunk + 1) * chunkSize);
+        for (std::size_t i = chunk * chunkSize; i < end; i++) {
+            MeshGeomFacet clFacet = myMesh.GetFacet(checkElements[i]);
+            if (clFacet.IntersectWithPlane(base, normal)) {
+                status[i] = 2;
+            }
+            else if (clFacet._aclPoints[0].DistanceToPlane(base, normal) > 0.0F) {
+                status[i] = 1;
+            }
+        }
+    });
+
+    for (std::size_t i = 0; i < checkElements.size(); i++) {
+        if (status[i] == 2) {
+            trimFacets.push_back(checkElements[i]);
+        }
+        if (status[i] != 0) {
+            removeFacets.push_back(checkElements[i]);
+        }
+    }
+}
+
 void MeshTrimByPlane::CreateOneFacet(
     const Base::Vector3f& base,
     const Base::Vector3f& normal,
@@ -154,32 +237,115 @@ void MeshTrimByPlane::TrimFacets(
     std::vector<MeshGeomFacet>& trimmedFacets
 )
 {
-    trimmedFacets.reserve(2 * trimFacets.size());
-    for (FacetIndex index : trimFacets) {
-        MeshGeomFacet facet = myMesh.GetFacet(index);
-        float dist1 = facet._aclPoints[0].DistanceToPlane(base, normal);
-        float dist2 = facet._aclPoints[1].DistanceToPlane(base, normal);
-        float dist3 = facet._aclPoints[2].DistanceToPlane(base, normal);
-
-        // only one point below
-        if (dist1 < 0.0F && dist2 > 0.0F && dist3 > 0.0F) {
-            CreateOneFacet(base, normal, 0, facet, trimmedFacets);
-        }
-        else if (dist1 > 0.0F && dist2 < 0.0F && dist3 > 0.0F) {
-            CreateOneFacet(base, normal, 1, facet, trimmedFacets);
-        }
-        else if (dist1 > 0.0F && dist2 > 0.0F && dist3 < 0.0F) {
-            CreateOneFacet(base, normal, 2, facet, trimmedFacets);
-        }
-        // two points below
-        else if (dist1 < 0.0F && dist2 < 0.0F && dist3 > 0.0F) {
-            CreateTwoFacet(base, normal, 0, facet, trimmedFacets);
-        }
-        else if (dist1 > 0.0F && dist2 < 0.0F && dist3 < 0.0F) {
-            CreateTwoFacet(base, normal, 1, facet, trimmedFacets);
+    // The facets are split independently of each other and the results are joined in order
+    auto split = [&](std::size_t chunk) {
+        std::vector<MeshGeomFacet> created;
+        std::size_t end = std::min(trimFacets.size(), (chunk + 1) * chunkSize);
+        for (std::size_t i = chunk * chunkSize; i < end; i++) {
+            MeshGeomFacet facet = myMesh.GetFacet(trimFacets[i]);
+            float dist1 = facet._aclPoints[0].DistanceToPlane(base, normal);
+            float dist2 = facet._aclPoints[1].DistanceToPlane(base, normal);
+            float dist3 = facet._aclPoints[2].DistanceToPlane(base, normal);
+
+            // only one point below
+            if (dist1 < 0.0F && dist2 > 0.0F && dist3 > 0.0F) {
+                CreateOneFacet(base, normal, 0, facet, created);
+            }
+            else if (dist1 > 0.0F && dist2 < 0.0F && dist3 > 0.0F) {
+                CreateOneFacet(base, normal, 1, facet, created);
+            }
+            else if (dist1 > 0.0F && dist2 > 0.0F && dist3 < 0.0F) {
+                CreateOneFacet(base, normal, 2, facet, created);
+            }
+            // two points below
+            else if (dist1 < 0.0F && dist2 < 0.0F && dist3 > 0.0F) {
+                CreateTwoFacet(base, normal, 0, facet, created);
+            }
+            else if (dist1 > 0.0F && dist2 < 0.0F && dist3 < 0.0F) {
+                CreateTwoFacet(base, normal, 1, facet, created);
+            }
+            else if (dist1 < 0.0F && dist2 > 0.0F && dist3 < 0.0F) {
+                CreateTwoFacet(base, normal, 2, facet, created);
+            }
         }
-        else if (dist1 < 0.0F && dist2 > 0.0F && dist3 < 0.0F) {
-            CreateTwoFacet(base, normal, 2, facet, trimmedFacets);
+        return created;
+    };
+
+    std::vector<std::size_t> chunks = MakeChunks(trimFacets.size());
+    std::vector<std::vector<MeshGeomFacet>> results
+        = QtConcurrent::blockingMapped<std::vector<std::vector<MeshGeomFacet>>>(chunks, split);
+
+    trimmedFacets.reserve(trimmedFacets.size() + 2 * trimFacets.size());
+    for (const auto& it : results) {
+        trimmedFacets.insert(trimmedFacets.end(), it.begin(), it.end());
+    }
+}
+
+void MeshTrimByPlane::TrimByPlanes(
+    const std::vector<std::pair<Base::Vector3f, Base::Vector3f>>& planes,
+    std::vector<FacetIndex>& removeFacets,
+    std::vector<MeshGeomFacet>& trimmedFacets
+) const
+{
+    struct Result
+    {
+        std::vector<FacetIndex> removed;
+        std::vector<MeshGeomFacet> created;
+    };
+
+    std::size_t numFacets = myMesh.CountFacets();
+    auto trim = [&](std::size_t chunk) {
+        Result result;
+        std::size_t end = std::min(numFacets, (chunk + 1) * chunkSize);
+        for (std::size_t index = chunk * chunkSize; index < end; index++) {
+            MeshGeomFacet facet = myMesh.GetFacet(index);
+            bool above = false;
+            bool cut = false;
+            for (const auto& [base, normal] : planes) {
+                int numAbove = 0;
+                for (const auto& pnt : facet._aclPoints) {
+                    if (pnt.DistanceToPlane(base, normal) > 0.0F) {
+                        numAbove++;
+                    }
+                }
+                if (numAbove == 3) {
+                    above = true;
+                    break;
+                }
+                if (numAbove > 0) {
+                    cut = true;
+                }
+            }
+
+            if (!above && !cut) {
+                continue;
+            }
+
+            result.removed.push_back(index);
+            if (above) {
+                continue;
+            }
+
+            // the remaining part of the facet is convex, so a fan triangulation is sufficient
+            std::vector<Base::Vector3f> poly(std::begin(facet._aclPoints), std::end(facet._aclPoints));
+            for (const auto& [base, normal] : planes) {
+                poly = ClipPolygon(poly, base, normal);
+                if (poly.size() < 3) {
+                    break;
+                }
+            }
+            for (std::size_t i = 1; i + 1 < poly.size(); i++) {
+                result.created.emplace_back(poly[0], poly[i], poly[i + 1]);
+            }
         }
+        return result;
+    };
+
+    std::vector<std::size_t> chunks = MakeChunks(numFacets);
+    std::vector<Result> results = QtConcurrent::blockingMapped<std::vector<Result>>(chunks, trim);
+
+    for (const auto& it : results) {
+        removeFacets.insert(removeFacets.end(), it.removed.begin(), it.removed.end());
+        trimmedFacets.insert(trimmedFacets.end(), it.created.begin(), it.created.end());
     }
 }
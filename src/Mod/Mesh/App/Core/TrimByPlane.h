@@ -24,12 +24,16 @@
 
 #pragma once
 
+#include <utility>
+
 #include "MeshKernel.h"
 
 
 namespace MeshCore
 {
 
+class MeshFacetBVH;
+
 /**
  * Trim the facets in 3D with a plane
  * \author Werner Mayer
@@ -51,6 +55,17 @@ public:
         std::vector<FacetIndex>& trimFacets,
         std::vector<FacetIndex>& removeFacets
     ) const;
+    /**
+     * Does the same as the method above but skips the subtrees of \a rclBVH that lie completely
+     * below the plane. The remaining facets are checked in parallel.
+     */
+    void CheckFacets(
+        const MeshFacetBVH& rclBVH,
+        const Base::Vector3f& base,
+        const Base::Vector3f& normal,
+        std::vector<FacetIndex>& trimFacets,
+        std::vector<FacetIndex>& removeFacets
+    ) const;
 
     /**
      * The facets from \a trimFacets will be trimmed or deleted and \a trimmedFacets holds the newly
@@ -63,6 +78,17 @@ public:
         std::vector<MeshGeomFacet>& trimmedFacets
     );
 
+    /**
+     * Trims the mesh with several planes at once and keeps the part below all of them. Each plane
+     * is given by a base point and a normal. The facets to be deleted are written to
+     * \a removeFacets and \a trimmedFacets holds the remaining parts of the cut facets.
+     */
+    void TrimByPlanes(
+        const std::vector<std::pair<Base::Vector3f, Base::Vector3f>>& planes,
+        std::vector<FacetIndex>& removeFacets,
+        std::vector<MeshGeomFacet>& trimmedFacets
+    ) const;
+
 private:
     void CreateOneFacet(
         const Base::Vector3f& base,
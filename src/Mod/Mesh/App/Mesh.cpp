@@ -26,10 +26,12 @@
 #include <sstream>
 
 
+#include <App/Application.h>
 #include <Base/Builder3D.h>
 #include <Base/Console.h>
 #include <Base/Converter.h>
 #include <Base/Exception.h>
+#include <Base/FileInfo.h>
 #include <Base/Interpreter.h>
 #include <Base/Reader.h>
 #include <Base/Sequencer.h>
@@ -38,13 +40,16 @@
 #include <Base/ViewProj.h>
 #include <Base/Writer.h>
 
+#include "Core/BVH.h"
 #include "Core/Builder.h"
 #include "Core/Decimation.h"
 #include "Core/Degeneration.h"
+#include "Core/EvalPipeline.h"
 #include "Core/Grid.h"
 #include "Core/Info.h"
 #include "Core/Iterator.h"
 #include "Core/MeshKernel.h"
+#include "Core/OutOfCore.h"
 #include "Core/Segmentation.h"
 #include "Core/SetOperations.h"
 #include "Core/TopoAlgorithm.h"
@@ -459,10 +464,23 @@ void MeshObject::save(
     aWriter.SaveFormat(str, f);
 }
 
+namespace
+{
+// read for every load so that a changed preference takes effect at once
+float getWeldTolerance()
+{
+    ParameterGrp::handle handle = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Mesh"
+    );
+    return static_cast<float>(handle->GetFloat("WeldTolerance", 0.0));
+}
+}  // namespace
+
 bool MeshObject::load(const char* file, MeshCore::Material* mat)
 {
     MeshCore::MeshKernel kernel;
     MeshCore::MeshInput aReader(kernel, mat);
+    aReader.SetWeldTolerance(getWeldTolerance());
     if (!aReader.LoadAny(file)) {
         return false;
     }
@@ -471,10 +489,41 @@ bool MeshObject::load(const char* file, MeshCore::Material* mat)
     return true;
 }
 
+bool MeshObject::loadDecimated(const char* file, int targetSize)
+{
+    MeshCore::MeshKernel kernel;
+    Base::FileInfo store(Base::FileInfo::getTempFileName());
+    if (MeshCore::MeshOutOfCore::CreateFromBinarySTL(file, store.filePath().c_str())) {
+        MeshCore::MeshOutOfCore mesh;
+        bool opened = mesh.Open(store.filePath().c_str());
+        if (opened) {
+            MeshCore::MeshSimplify(kernel).simplify(mesh, targetSize);
+        }
+        mesh.Close();
+        store.deleteFile();
+        if (!opened) {
+            return false;
+        }
+    }
+    else {
+        store.deleteFile();
+        MeshCore::MeshInput aReader(kernel);
+        aReader.SetWeldTolerance(getWeldTolerance());
+        if (!aReader.LoadAny(file)) {
+            return false;
+        }
+        MeshCore::MeshSimplify(kernel).simplify(targetSize);
+    }
+
+    swapKernel(kernel, {});
+    return true;
+}
+
 bool MeshObject::load(std::istream& str, MeshCore::MeshIO::Format f, MeshCore::Material* mat)
 {
     MeshCore::MeshKernel kernel;
     MeshCore::MeshInput aReader(kernel, mat);
+    aReader.SetWeldTolerance(getWeldTolerance());
     if (!aReader.LoadFormat(str, f)) {
         return false;
     }
@@ -1097,15 +1146,21 @@ void MeshObject::smooth(int iterations, float d_max)
     _kernel.Smooth(iterations, d_max);
 }
 
-void MeshObject::decimate(float fTolerance, float fReduction)
+void MeshObject::decimate(float fTolerance, float fReduction, bool parallel)
 {
     MeshCore::MeshSimplify dm(this->_kernel);
+    if (!parallel) {
+        dm.setBlockSize(0);
+    }
     dm.simplify(fTolerance, fReduction);
 }
 
-void MeshObject::decimate(int targetSize)
+void MeshObject::decimate(int targetSize, bool parallel)
 {
     MeshCore::MeshSimplify dm(this->_kernel);
+    if (!parallel) {
+        dm.setBlockSize(0);
+    }
     dm.simplify(targetSize);
 }
 
@@ -1201,8 +1256,8 @@ void MeshObject::trim(
             break;
     }
 
-    MeshCore::MeshFacetGrid meshGrid(kernel);
-    trim.CheckFacets(meshGrid, check);
+    MeshCore::MeshFacetBVH meshBVH(kernel);
+    trim.CheckFacets(meshBVH, check);
     trim.TrimFacets(check, triangle);
     if (!check.empty()) {
         this->deleteFacets(check);
@@ -1233,8 +1288,8 @@ void MeshObject::trimByPlane(const Base::Vector3f& base, const Base::Vector3f& n
     meshPlacement.multVec(base, basePlane);
     meshPlacement.getRotation().multVec(normal, normalPlane);
 
-    MeshCore::MeshFacetGrid meshGrid(this->_kernel);
-    trim.CheckFacets(meshGrid, basePlane, normalPlane, trimFacets, removeFacets);
+    MeshCore::MeshFacetBVH meshBVH(this->_kernel);
+    trim.CheckFacets(meshBVH, basePlane, normalPlane, trimFacets, removeFacets);
     trim.TrimFacets(trimFacets, basePlane, normalPlane, triangle);
     if (!removeFacets.empty()) {
         this->deleteFacets(removeFacets);
@@ -1244,7 +1299,35 @@ void MeshObject::trimByPlane(const Base::Vector3f& base, const Base::Vector3f& n
     }
 }
 
-MeshObject* MeshObject::unite(const MeshObject& mesh) const
+void MeshObject::trimByPlanes(const std::vector<TPlane>& planes)
+{
+    MeshCore::MeshTrimByPlane trim(this->_kernel);
+    std::vector<FacetIndex> removeFacets;
+    std::vector<MeshCore::MeshGeomFacet> triangle;
+
+    // Apply the inverted mesh placement to the planes because the trimming is done
+    // on the untransformed mesh data
+    Base::Placement meshPlacement = getPlacement();
+    meshPlacement.invert();
+    std::vector<TPlane> localPlanes;
+    localPlanes.reserve(planes.size());
+    for (const auto& [base, normal] : planes) {
+        Base::Vector3f basePlane, normalPlane;
+        meshPlacement.multVec(base, basePlane);
+        meshPlacement.getRotation().multVec(normal, normalPlane);
+        localPlanes.emplace_back(basePlane, normalPlane);
+    }
+
+    trim.TrimByPlanes(localPlanes, removeFacets, triangle);
+    if (!removeFacets.empty()) {
+        this->deleteFacets(removeFacets);
+    }
+    if (!triangle.empty()) {
+        this->_kernel.AddFacets(triangle);
+    }
+}
+
+MeshObject* MeshObject::unite(const MeshObject& mesh, bool robust) const
 {
     MeshCore::MeshKernel result;
     MeshCore::MeshKernel kernel1(this->_kernel);
@@ -1252,11 +1335,14 @@ MeshObject* MeshObject::unite(const MeshObject& mesh) const
     MeshCore::MeshKernel kernel2(mesh._kernel);
     kernel2.Transform(mesh._Mtrx);
     MeshCore::SetOperations setOp(kernel1, kernel2, result, MeshCore::SetOperations::Union, Epsilon);
+    if (robust) {
+        setOp.SetClassification(MeshCore::SetOperations::WindingNumber);
+    }
     setOp.Do();
     return new MeshObject(result);
 }
 
-MeshObject* MeshObject::intersect(const MeshObject& mesh) const
+MeshObject* MeshObject::intersect(const MeshObject& mesh, bool robust) const
 {
     MeshCore::MeshKernel result;
     MeshCore::MeshKernel kernel1(this->_kernel);
@@ -1264,11 +1350,14 @@ MeshObject* MeshObject::intersect(const MeshObject& mesh) const
     MeshCore::MeshKernel kernel2(mesh._kernel);
     kernel2.Transform(mesh._Mtrx);
     MeshCore::SetOperations setOp(kernel1, kernel2, result, MeshCore::SetOperations::Intersect, Epsilon);
+    if (robust) {
+        setOp.SetClassification(MeshCore::SetOperations::WindingNumber);
+    }
     setOp.Do();
     return new MeshObject(result);
 }
 
-MeshObject* MeshObject::subtract(const MeshObject& mesh) const
+MeshObject* MeshObject::subtract(const MeshObject& mesh, bool robust) const
 {
     MeshCore::MeshKernel result;
     MeshCore::MeshKernel kernel1(this->_kernel);
@@ -1276,11 +1365,14 @@ MeshObject* MeshObject::subtract(const MeshObject& mesh) const
     MeshCore::MeshKernel kernel2(mesh._kernel);
     kernel2.Transform(mesh._Mtrx);
     MeshCore::SetOperations setOp(kernel1, kernel2, result, MeshCore::SetOperations::Difference, Epsilon);
+    if (robust) {
+        setOp.SetClassification(MeshCore::SetOperations::WindingNumber);
+    }
     setOp.Do();
     return new MeshObject(result);
 }
 
-MeshObject* MeshObject::inner(const MeshObject& mesh) const
+MeshObject* MeshObject::inner(const MeshObject& mesh, bool robust) const
 {
     MeshCore::MeshKernel result;
     MeshCore::MeshKernel kernel1(this->_kernel);
@@ -1288,11 +1380,14 @@ MeshObject* MeshObject::inner(const MeshObject& mesh) const
     MeshCore::MeshKernel kernel2(mesh._kernel);
     kernel2.Transform(mesh._Mtrx);
     MeshCore::SetOperations setOp(kernel1, kernel2, result, MeshCore::SetOperations::Inner, Epsilon);
+    if (robust) {
+        setOp.SetClassification(MeshCore::SetOperations::WindingNumber);
+    }
     setOp.Do();
     return new MeshObject(result);
 }
 
-MeshObject* MeshObject::outer(const MeshObject& mesh) const
+MeshObject* MeshObject::outer(const MeshObject& mesh, bool robust) const
 {
     MeshCore::MeshKernel result;
     MeshCore::MeshKernel kernel1(this->_kernel);
@@ -1300,6 +1395,9 @@ MeshObject* MeshObject::outer(const MeshObject& mesh) const
     MeshCore::MeshKernel kernel2(mesh._kernel);
     kernel2.Transform(mesh._Mtrx);
     MeshCore::SetOperations setOp(kernel1, kernel2, result, MeshCore::SetOperations::Outer, Epsilon);
+    if (robust) {
+        setOp.SetClassification(MeshCore::SetOperations::WindingNumber);
+    }
     setOp.Do();
     return new MeshObject(result);
 }
@@ -1795,6 +1893,37 @@ void MeshObject::removeDuplicatedFacets()
     }
 }
 
+bool MeshObject::repair(float fEpsDegenerated, bool nonManifoldPoints, bool folds, int iterations)
+{
+    MeshCore::MeshEvalPipeline::Settings settings;
+    settings.degeneratedEpsilon = fEpsDegenerated;
+    settings.nonManifoldPoints = nonManifoldPoints;
+    settings.folds = folds;
+
+    MeshCore::MeshEvalPipeline eval(_kernel);
+    MeshCore::MeshEvalPipeline::Result result = eval.Evaluate(settings);
+    for (int i = 0; i < iterations && !result.IsValid(); i++) {
+        unsigned long count = _kernel.CountFacets();
+        MeshCore::MeshFixPipeline fix(_kernel, settings);
+        if (!fix.Fixup(result)) {
+            break;
+        }
+
+        // the other fixes may remove facets, too
+        const std::vector<FacetIndex>& removed = fix.GetDeletedFaces();
+        if (_kernel.CountFacets() + removed.size() == count) {
+            deletedFacets(removed);
+        }
+        else {
+            this->_segments.clear();
+        }
+
+        result = eval.Evaluate(settings);
+    }
+
+    return result.IsValid();
+}
+
 MeshObject* MeshObject::createMeshFromList(Py::List& list)
 {
     std::vector<MeshCore::MeshGeomFacet> facets;
@@ -216,6 +216,10 @@ public:
         const char* objectname = nullptr
     ) const;
     bool load(const char* file, MeshCore::Material* mat = nullptr);
+    /** Loads the mesh from \a file and decimates it to about \a targetSize facets. Binary STL
+     * files are read chunk by chunk, so only the decimated mesh has to fit into memory.
+     */
+    bool loadDecimated(const char* file, int targetSize);
     bool load(std::istream&, MeshCore::MeshIO::Format f, MeshCore::Material* mat = nullptr);
     // Save and load in internal format
     void save(std::ostream&) const;
@@ -281,8 +285,8 @@ public:
     void movePoint(PointIndex, const Base::Vector3d& v);
     void setPoint(PointIndex index, const Base::Vector3d& p);
     void smooth(int iterations, float d_max);
-    void decimate(float fTolerance, float fReduction);
-    void decimate(int targetSize);
+    void decimate(float fTolerance, float fReduction, bool parallel = true);
+    void decimate(int targetSize, bool parallel = true);
     Base::Vector3d getPointNormal(PointIndex) const;
     std::vector<Base::Vector3d> getPointNormals() const;
     void crossSections(
@@ -294,6 +298,8 @@ public:
     void cut(const Base::Polygon2d& polygon, const Base::ViewProjMethod& proj, CutType);
     void trim(const Base::Polygon2d& polygon, const Base::ViewProjMethod& proj, CutType);
     void trimByPlane(const Base::Vector3f& base, const Base::Vector3f& normal);
+    /// Keeps the part of the mesh below all planes given by base point and normal
+    void trimByPlanes(const std::vector<TPlane>& planes);
     //@}
 
     /** @name Selection */
@@ -314,13 +320,17 @@ public:
     void clearPointSelection() const;
     //@}
 
-    /** @name Boolean operations */
+    /** @name Boolean operations
+     * If \a robust is true the parts of the meshes are classified by their winding numbers
+     * instead of the facet orientations along the intersection curve. This also works for
+     * parts that don't touch the curve and for meshes that don't intersect at all.
+     */
     //@{
-    MeshObject* unite(const MeshObject&) const;
-    MeshObject* intersect(const MeshObject&) const;
-    MeshObject* subtract(const MeshObject&) const;
-    MeshObject* inner(const MeshObject&) const;
-    MeshObject* outer(const MeshObject&) const;
+    MeshObject* unite(const MeshObject&, bool robust = false) const;
+    MeshObject* intersect(const MeshObject&, bool robust = false) const;
+    MeshObject* subtract(const MeshObject&, bool robust = false) const;
+    MeshObject* inner(const MeshObject&, bool robust = false) const;
+    MeshObject* outer(const MeshObject&, bool robust = false) const;
     std::vector<std::vector<Base::Vector3f>> section(
         const MeshObject&,
         bool connectLines,
@@ -375,6 +385,10 @@ public:
     void mergeFacets();
     bool hasPointsOnEdge() const;
     void removePointsOnEdge(bool fillBoundary);
+    /** Fixes all defects found by MeshCore::MeshEvalPipeline in one batch and repeats this at
+     * most \a iterations times while defects are left. Returns true if no defects are left.
+     */
+    bool repair(float fEpsDegenerated, bool nonManifoldPoints, bool folds, int iterations);
     //@}
 
     /** @name Mesh segments */
@@ -47,7 +47,10 @@ class Mesh(ComplexGeoData):
     def read(self, **kwargs) -> Any:
         """Read in a mesh object from file.
         mesh.read(Filename='mymesh.stl')
-        mesh.read(Stream=file,Format='STL')"""
+        mesh.read(Filename='mymesh.stl',TargetSize=100000)
+        mesh.read(Stream=file,Format='STL')
+        TargetSize: decimate the mesh to about this number of facets while reading it.
+        Binary STL files are then read in chunks, so the full mesh needn't fit into memory."""
         ...
 
     @constmethod
@@ -82,27 +85,42 @@ class Mesh(ComplexGeoData):
 
     @constmethod
     def unite(self) -> Any:
-        """Union of this and the given mesh object."""
+        """Union of this and the given mesh object.
+        unite(mesh, [robust=False])
+        If robust is True the parts are classified by their winding numbers which also
+        works for meshes that do not intersect. The meshes must be closed."""
         ...
 
     @constmethod
     def intersect(self) -> Any:
-        """Intersection of this and the given mesh object."""
+        """Intersection of this and the given mesh object.
+        intersect(mesh, [robust=False])
+        If robust is True the parts are classified by their winding numbers which also
+        works for meshes that do not intersect. The meshes must be closed."""
         ...
 
     @constmethod
     def difference(self) -> Any:
-        """Difference of this and the given mesh object."""
+        """Difference of this and the given mesh object.
+        difference(mesh, [robust=False])
+        If robust is True the parts are classified by their winding numbers which also
+        works for meshes that do not intersect. The meshes must be closed."""
         ...
 
     @constmethod
     def inner(self) -> Any:
-        """Get the part inside of the intersection"""
+        """Get the part inside of the intersection
+        inner(mesh, [robust=False])
+        If robust is True the parts are classified by their winding numbers which also
+        works for meshes that do not intersect. The meshes must be closed."""
         ...
 
     @constmethod
     def outer(self) -> Any:
-        """Get the part outside the intersection"""
+        """Get the part outside the intersection
+        outer(mesh, [robust=False])
+        If robust is True the parts are classified by their winding numbers which also
+        works for meshes that do not intersect. The meshes must be closed."""
         ...
 
     @constmethod
@@ -183,6 +201,27 @@ class Mesh(ComplexGeoData):
         Get the normals of the points."""
         ...
 
+    @constmethod
+    def getPointArray(self) -> Any:
+        """getPointArray() -> memoryview
+        Get the points as a memoryview of doubles with the shape (n, 3).
+        The coordinates are copied once and numpy.asarray() uses the view without a copy."""
+        ...
+
+    @constmethod
+    def getFacetArray(self) -> Any:
+        """getFacetArray() -> memoryview
+        Get the point indices of the facets as a memoryview of unsigned integers with the shape (n, 3)."""
+        ...
+
+    def setTopology(self) -> Any:
+        """setTopology(points, facets)
+        Replace the mesh by the given points and facets.
+        points is an array of shape (n, 3) and facets an array of point indices of shape (m, 3),
+        e.g. NumPy arrays or the results of getPointArray() and getFacetArray().
+        Flat sequences of numbers like (x0, y0, z0, x1, ...) are accepted as well."""
+        ...
+
     def addSegment(self) -> Any:
         """Add a list of facet indices that describes a segment to the mesh"""
         ...
@@ -422,6 +461,13 @@ class Mesh(ComplexGeoData):
         direction of the normal the part above or below will be kept."""
         ...
 
+    def trimByPlanes(self) -> Any:
+        """Trims the mesh with several planes at once
+        trimByPlanes([(Vector, Vector), ...]) -> None
+        Each plane is defined by a base and normal vector. The part of the mesh that is
+        below all planes will be kept. This is faster than trimming with each plane on its own."""
+        ...
+
     @constmethod
     def harmonizeNormals(self) -> Any:
         """Adjust wrong oriented facets"""
@@ -445,12 +491,16 @@ class Mesh(ComplexGeoData):
 
     def decimate(self) -> Any:
         """Decimate the mesh
-        decimate(tolerance(Float), reduction(Float))
+        decimate(tolerance(Float), reduction(Float), [parallel(Bool)])
+        decimate(targetSize(Int), [parallel(Bool)])
         tolerance: maximum error
         reduction: reduction factor must be in the range [0.0,1.0]
+        targetSize: the number of facets to keep
+        parallel: split large meshes into blocks and decimate them in parallel (default True)
         Example:
         mesh.decimate(0.5, 0.1) # reduction by up to 10 percent
-        mesh.decimate(0.5, 0.9) # reduction by up to 90 percent"""
+        mesh.decimate(0.5, 0.9) # reduction by up to 90 percent
+        mesh.decimate(1000, False) # serial reduction to 1000 facets"""
         ...
 
     def mergeFacets(self) -> Any:
@@ -73,6 +73,10 @@ public:
     /// recalculate the Feature
     App::DocumentObjectExecReturn* execute() override;
     void onChanged(const App::Property* prop) override;
+    bool isExecuteGILFree() const override
+    {
+        return true;
+    }
     //@}
 
     /// returns the type name of the ViewProvider
@@ -91,6 +91,18 @@ class MeshFeature(GeoFeature):
         """Remove folds on surfaces"""
         ...
 
+    def repair(self) -> Any:
+        """
+        Repair all defects of the mesh at once
+        repair([epsilon(Float), nonManifoldPoints(Bool), folds(Bool), iterations(Int)])
+        epsilon: the tolerance for degenerated facets
+        nonManifoldPoints: also remove the facets of non-manifold points (default False)
+        folds: also remove folds on the surface (default False)
+        iterations: the maximum number of repair passes (default 1)
+        Returns True if no defects are left.
+        """
+        ...
+
     def removeInvalidPoints(self) -> Any:
         """Remove points with invalid coordinates (NaN)"""
         ...
@@ -264,6 +264,43 @@ PyObject* MeshFeaturePy::removeFoldsOnSurface(PyObject* args)
     Py_Return;
 }
 
+PyObject* MeshFeaturePy::repair(PyObject* args)
+{
+    float fEpsilon = MeshCore::MeshDefinitions::_fMinPointDistanceP2;
+    PyObject* nonManifoldPoints = Py_False;
+    PyObject* folds = Py_False;
+    int iterations = 1;
+    if (!PyArg_ParseTuple(
+            args,
+            "|fO!O!i",
+            &fEpsilon,
+            &PyBool_Type,
+            &nonManifoldPoints,
+            &PyBool_Type,
+            &folds,
+            &iterations
+        )) {
+        return nullptr;
+    }
+
+    bool ok = false;
+    PY_TRY
+    {
+        Mesh::Feature* obj = getFeaturePtr();
+        MeshObject* kernel = obj->Mesh.startEditing();
+        ok = kernel->repair(
+            fEpsilon,
+            Base::asBoolean(nonManifoldPoints),
+            Base::asBoolean(folds),
+            iterations
+        );
+        obj->Mesh.finishEditing();
+    }
+    PY_CATCH;
+
+    return Py_BuildValue("O", (ok ? Py_True : Py_False));
+}
+
 PyObject* MeshFeaturePy::removeInvalidPoints(PyObject* args)
 {
     if (!PyArg_ParseTuple(args, "")) {
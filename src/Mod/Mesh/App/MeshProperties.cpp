@@ -739,12 +739,43 @@ PropertyMeshKernel::~PropertyMeshKernel()
     }
 }
 
+const MeshObject& PropertyMeshKernel::mesh() const
+{
+    return _shared ? **_shared : *_meshObject;
+}
+
+void PropertyMeshKernel::detach(bool overwrite)
+{
+    if (!_shared) {
+        return;
+    }
+    if (&**_shared == &*_meshObject) {
+        // keep the own mesh object as it is referenced by the Python wrapper
+        if (_shared.use_count() > 1) {
+            Base::Reference<MeshObject> content(new MeshObject());
+            if (overwrite) {
+                content->swap(*_meshObject);
+            }
+            else {
+                *content = *_meshObject;
+            }
+            *_shared = content;
+        }
+    }
+    else if (!overwrite) {
+        *_meshObject = **_shared;
+    }
+    _shared.reset();
+}
+
 void PropertyMeshKernel::setValuePtr(MeshObject* mesh)
 {
     // use the tmp. object to guarantee that the referenced mesh is not destroyed
     // before calling hasSetValue()
     Base::Reference<MeshObject> tmp(_meshObject);
     aboutToSetValue();
+    // the copies keep referencing the previous mesh
+    _shared.reset();
     _meshObject = mesh;
     hasSetValue();
 }
@@ -752,6 +783,7 @@ void PropertyMeshKernel::setValuePtr(MeshObject* mesh)
 void PropertyMeshKernel::setValue(const MeshObject& mesh)
 {
     aboutToSetValue();
+    detach(true);
     *_meshObject = mesh;
     hasSetValue();
 }
@@ -759,6 +791,7 @@ void PropertyMeshKernel::setValue(const MeshObject& mesh)
 void PropertyMeshKernel::setValue(const MeshCore::MeshKernel& mesh)
 {
     aboutToSetValue();
+    detach();
     _meshObject->setKernel(mesh);
     hasSetValue();
 }
@@ -766,6 +799,7 @@ void PropertyMeshKernel::setValue(const MeshCore::MeshKernel& mesh)
 void PropertyMeshKernel::swapMesh(MeshObject& mesh)
 {
     aboutToSetValue();
+    detach();
     _meshObject->swap(mesh);
     hasSetValue();
 }
@@ -773,34 +807,35 @@ void PropertyMeshKernel::swapMesh(MeshObject& mesh)
 void PropertyMeshKernel::swapMesh(MeshCore::MeshKernel& mesh)
 {
     aboutToSetValue();
+    detach();
     _meshObject->swap(mesh);
     hasSetValue();
 }
 
 const MeshObject& PropertyMeshKernel::getValue() const
 {
-    return *_meshObject;
+    return mesh();
 }
 
 const MeshObject* PropertyMeshKernel::getValuePtr() const
 {
-    return static_cast<MeshObject*>(_meshObject);
+    return &mesh();
 }
 
 const Data::ComplexGeoData* PropertyMeshKernel::getComplexData() const
 {
-    return static_cast<MeshObject*>(_meshObject);
+    return &mesh();
 }
 
 Base::BoundBox3d PropertyMeshKernel::getBoundingBox() const
 {
-    return _meshObject->getBoundBox();
+    return mesh().getBoundBox();
 }
 
 unsigned int PropertyMeshKernel::getMemSize() const
 {
     unsigned int size = 0;
-    size += _meshObject->getMemSize();
+    size += mesh().getMemSize();
 
     return size;
 }
@@ -808,6 +843,7 @@ unsigned int PropertyMeshKernel::getMemSize() const
 MeshObject* PropertyMeshKernel::startEditing()
 {
     aboutToSetValue();
+    detach();
     return static_cast<MeshObject*>(_meshObject);
 }
 
@@ -819,6 +855,7 @@ void PropertyMeshKernel::finishEditing()
 void PropertyMeshKernel::transformGeometry(const Base::Matrix4D& rclMat)
 {
     aboutToSetValue();
+    detach();
     _meshObject->transformGeometry(rclMat);
     hasSetValue();
 }
@@ -826,6 +863,7 @@ void PropertyMeshKernel::transformGeometry(const Base::Matrix4D& rclMat)
 void PropertyMeshKernel::setPointIndices(const std::vector<std::pair<PointIndex, Base::Vector3f>>& inds)
 {
     aboutToSetValue();
+    detach();
     MeshCore::MeshKernel& kernel = _meshObject->getKernel();
     for (const auto& it : inds) {
         kernel.SetPoint(it.first, it.second);
@@ -835,12 +873,13 @@ void PropertyMeshKernel::setPointIndices(const std::vector<std::pair<PointIndex,
 
 void PropertyMeshKernel::setTransform(const Base::Matrix4D& rclTrf)
 {
+    detach();
     _meshObject->setTransform(rclTrf);
 }
 
 Base::Matrix4D PropertyMeshKernel::getTransform() const
 {
-    return _meshObject->getTransform();
+    return mesh().getTransform();
 }
 
 PyObject* PropertyMeshKernel::getPyObject()
@@ -862,7 +901,7 @@ void PropertyMeshKernel::setPyObject(PyObject* value)
     if (PyObject_TypeCheck(value, &(MeshPy::Type))) {
         MeshPy* mesh = static_cast<MeshPy*>(value);
         // Do not allow one to reassign the same instance
-        if (&(*this->_meshObject) != mesh->getMeshObjectPtr()) {
+        if (&this->mesh() != mesh->getMeshObjectPtr()) {
             // Note: Copy the content, do NOT reference the same mesh object
             setValue(*(mesh->getMeshObjectPtr()));
         }
@@ -884,7 +923,7 @@ void PropertyMeshKernel::Save(Base::Writer& writer) const
 {
     if (writer.isForceXML()) {
         writer.Stream() << writer.ind() << "<Mesh>" << std::endl;
-        MeshCore::MeshOutput saver(_meshObject->getKernel());
+        MeshCore::MeshOutput saver(mesh().getKernel());
         saver.SaveXML(writer);
     }
     else {
@@ -910,6 +949,7 @@ void PropertyMeshKernel::Restore(Base::XMLReader& reader)
         kernel.Adopt(points, facets);
 
         aboutToSetValue();
+        detach(true);
         _meshObject->getKernel().Adopt(points, facets);
         hasSetValue();
     }
@@ -921,21 +961,26 @@ void PropertyMeshKernel::Restore(Base::XMLReader& reader)
 
 void PropertyMeshKernel::SaveDocFile(Base::Writer& writer) const
 {
-    _meshObject->save(writer.Stream());
+    mesh().save(writer.Stream());
 }
 
 void PropertyMeshKernel::RestoreDocFile(Base::Reader& reader)
 {
     aboutToSetValue();
+    detach();
     _meshObject->load(reader);
     hasSetValue();
 }
 
 App::Property* PropertyMeshKernel::Copy() const
 {
-    // Note: Copy the content, do NOT reference the same mesh object
+    // Note: Do NOT reference the same mesh object, but share its content until the
+    // property or the copy gets modified
     PropertyMeshKernel* prop = new PropertyMeshKernel();
-    *(prop->_meshObject) = *(this->_meshObject);
+    if (!_shared) {
+        _shared = std::make_shared<Base::Reference<MeshObject>>(_meshObject);
+    }
+    prop->_shared = _shared;
     return prop;
 }
 
@@ -944,6 +989,10 @@ void PropertyMeshKernel::Paste(const App::Property& from)
     // Note: Copy the content, do NOT reference the same mesh object
     aboutToSetValue();
     const PropertyMeshKernel& prop = dynamic_cast<const PropertyMeshKernel&>(from);
-    *(this->_meshObject) = *(prop._meshObject);
+    // nothing to copy if the property has not been modified since the copy was made
+    if (!_shared || _shared != prop._shared) {
+        detach(true);
+        *(this->_meshObject) = prop.mesh();
+    }
     hasSetValue();
 }
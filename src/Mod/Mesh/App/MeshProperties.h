@@ -26,6 +26,7 @@
 
 #include <list>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -321,8 +322,17 @@ public:
     void Paste(const App::Property& from) override;
     //@}
 
+private:
+    const MeshObject& mesh() const;
+    /// Stop sharing the mesh with copies before modifying it, \a overwrite if the
+    /// content will be replaced completely
+    void detach(bool overwrite = false);
+
 private:
     Base::Reference<MeshObject> _meshObject;
+    /// The mesh shared with the copies made by Copy() until one of them gets modified.
+    /// The modified property owning the mesh hands its content over to the copies.
+    mutable std::shared_ptr<Base::Reference<MeshObject>> _shared;
     MeshPy* meshPyObject {nullptr};
 };
 
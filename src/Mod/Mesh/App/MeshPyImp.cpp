@@ -25,7 +25,9 @@
 
 #include <Base/Converter.h>
 #include <Base/GeometryPyCXX.h>
+#include <Base/Interpreter.h>
 #include <Base/MatrixPy.h>
+#include <Base/PyArrayBuffer.h>
 #include <Base/PyWrapParseTupleAndKeywords.h>
 #include <Base/Stream.h>
 #include <Base/Tools.h>
@@ -149,10 +151,36 @@ PyObject* MeshPy::copy(PyObject* args) const
 PyObject* MeshPy::read(PyObject* args, PyObject* kwds)
 {
     char* Name {};
-    static const std::array<const char*, 2> keywords_path {"Filename", nullptr};
-    if (Base::Wrapped_ParseTupleAndKeywords(args, kwds, "et", keywords_path, "utf-8", &Name)) {
-        getMeshObjectPtr()->load(Name);
+    int targetSize {};
+    static const std::array<const char*, 3> keywords_path {"Filename", "TargetSize", nullptr};
+    if (Base::Wrapped_ParseTupleAndKeywords(
+            args,
+            kwds,
+            "et|i",
+            keywords_path,
+            "utf-8",
+            &Name,
+            &targetSize
+        )) {
+        std::string EncodedName(Name);
         PyMem_Free(Name);
+
+        // Read into a local mesh so that this object is only modified with the GIL held
+        MeshObject mesh;
+        bool loaded {};
+        {
+            Base::PyGILStateRelease unlock;
+            if (targetSize > 0) {
+                loaded = mesh.loadDecimated(EncodedName.c_str(), targetSize);
+            }
+            else {
+                loaded = mesh.load(EncodedName.c_str());
+            }
+        }
+        if (loaded) {
+            mesh.setTransform(getMeshObjectPtr()->getTransform());
+            getMeshObjectPtr()->swap(mesh);
+        }
         Py_Return;
     }
 
@@ -274,9 +302,11 @@ PyObject* MeshPy::write(PyObject* args, PyObject* kwds) const
             else {
                 mat.binding = MeshCore::MeshIO::OVERALL;
             }
+            Base::PyGILStateRelease unlock;
             getMeshObjectPtr()->save(Name, format, &mat, ObjName);
         }
         else {
+            Base::PyGILStateRelease unlock;
             getMeshObjectPtr()->save(Name, format, nullptr, ObjName);
         }
 
@@ -454,7 +484,8 @@ PyObject* MeshPy::unite(PyObject* args) const
 {
     MeshPy* pcObject {};
     PyObject* pcObj {};
-    if (!PyArg_ParseTuple(args, "O!", &(MeshPy::Type), &pcObj)) {
+    PyObject* robust = Py_False;
+    if (!PyArg_ParseTuple(args, "O!|O!", &(MeshPy::Type), &pcObj, &PyBool_Type, &robust)) {
         return nullptr;
     }
 
@@ -462,7 +493,12 @@ PyObject* MeshPy::unite(PyObject* args) const
 
     PY_TRY
     {
-        MeshObject* mesh = getMeshObjectPtr()->unite(*pcObject->getMeshObjectPtr());
+        const MeshObject& other = *pcObject->getMeshObjectPtr();
+        MeshObject* mesh {};
+        {
+            Base::PyGILStateRelease unlock;
+            mesh = getMeshObjectPtr()->unite(other, Base::asBoolean(robust));
+        }
         return new MeshPy(mesh);
     }
     PY_CATCH;
@@ -474,7 +510,8 @@ PyObject* MeshPy::intersect(PyObject* args) const
 {
     MeshPy* pcObject {};
     PyObject* pcObj {};
-    if (!PyArg_ParseTuple(args, "O!", &(MeshPy::Type), &pcObj)) {
+    PyObject* robust = Py_False;
+    if (!PyArg_ParseTuple(args, "O!|O!", &(MeshPy::Type), &pcObj, &PyBool_Type, &robust)) {
         return nullptr;
     }
 
@@ -482,7 +519,12 @@ PyObject* MeshPy::intersect(PyObject* args) const
 
     PY_TRY
     {
-        MeshObject* mesh = getMeshObjectPtr()->intersect(*pcObject->getMeshObjectPtr());
+        const MeshObject& other = *pcObject->getMeshObjectPtr();
+        MeshObject* mesh {};
+        {
+            Base::PyGILStateRelease unlock;
+            mesh = getMeshObjectPtr()->intersect(other, Base::asBoolean(robust));
+        }
         return new MeshPy(mesh);
     }
     PY_CATCH;
@@ -494,7 +536,8 @@ PyObject* MeshPy::difference(PyObject* args) const
 {
     MeshPy* pcObject {};
     PyObject* pcObj {};
-    if (!PyArg_ParseTuple(args, "O!", &(MeshPy::Type), &pcObj)) {
+    PyObject* robust = Py_False;
+    if (!PyArg_ParseTuple(args, "O!|O!", &(MeshPy::Type), &pcObj, &PyBool_Type, &robust)) {
         return nullptr;
     }
 
@@ -502,7 +545,12 @@ PyObject* MeshPy::difference(PyObject* args) const
 
     PY_TRY
     {
-        MeshObject* mesh = getMeshObjectPtr()->subtract(*pcObject->getMeshObjectPtr());
+        const MeshObject& other = *pcObject->getMeshObjectPtr();
+        MeshObject* mesh {};
+        {
+            Base::PyGILStateRelease unlock;
+            mesh = getMeshObjectPtr()->subtract(other, Base::asBoolean(robust));
+        }
         return new MeshPy(mesh);
     }
     PY_CATCH;
@@ -514,7 +562,8 @@ PyObject* MeshPy::inner(PyObject* args) const
 {
     MeshPy* pcObject {};
     PyObject* pcObj {};
-    if (!PyArg_ParseTuple(args, "O!", &(MeshPy::Type), &pcObj)) {
+    PyObject* robust = Py_False;
+    if (!PyArg_ParseTuple(args, "O!|O!", &(MeshPy::Type), &pcObj, &PyBool_Type, &robust)) {
         return nullptr;
     }
 
@@ -522,7 +571,12 @@ PyObject* MeshPy::inner(PyObject* args) const
 
     PY_TRY
     {
-        MeshObject* mesh = getMeshObjectPtr()->inner(*pcObject->getMeshObjectPtr());
+        const MeshObject& other = *pcObject->getMeshObjectPtr();
+        MeshObject* mesh {};
+        {
+            Base::PyGILStateRelease unlock;
+            mesh = getMeshObjectPtr()->inner(other, Base::asBoolean(robust));
+        }
         return new MeshPy(mesh);
     }
     PY_CATCH;
@@ -534,7 +588,8 @@ PyObject* MeshPy::outer(PyObject* args) const
 {
     MeshPy* pcObject {};
     PyObject* pcObj {};
-    if (!PyArg_ParseTuple(args, "O!", &(MeshPy::Type), &pcObj)) {
+    PyObject* robust = Py_False;
+    if (!PyArg_ParseTuple(args, "O!|O!", &(MeshPy::Type), &pcObj, &PyBool_Type, &robust)) {
         return nullptr;
     }
 
@@ -542,7 +597,12 @@ PyObject* MeshPy::outer(PyObject* args) const
 
     PY_TRY
     {
-        MeshObject* mesh = getMeshObjectPtr()->outer(*pcObject->getMeshObjectPtr());
+        const MeshObject& other = *pcObject->getMeshObjectPtr();
+        MeshObject* mesh {};
+        {
+            Base::PyGILStateRelease unlock;
+            mesh = getMeshObjectPtr()->outer(other, Base::asBoolean(robust));
+        }
         return new MeshPy(mesh);
     }
     PY_CATCH;
@@ -978,6 +1038,82 @@ PyObject* MeshPy::getPointNormals(PyObject* args) const
     PY_CATCH;
 }
 
+PyObject* MeshPy::getPointArray(PyObject* args) const
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    const MeshObject* mesh = getMeshObjectPtr();
+    Base::Matrix4D mat = mesh->getTransform();
+    const MeshCore::MeshPointArray& points = mesh->getKernel().GetPoints();
+    Base::PyArrayWriter<double> array(points.size(), 3);
+    double* coords = array.data();
+    for (const auto& it : points) {
+        Base::Vector3d pnt = mat * Base::Vector3d(it.x, it.y, it.z);
+        *coords++ = pnt.x;
+        *coords++ = pnt.y;
+        *coords++ = pnt.z;
+    }
+    return Py::new_reference_to(array.getView());
+}
+
+PyObject* MeshPy::getFacetArray(PyObject* args) const
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    const MeshCore::MeshFacetArray& facets = getMeshObjectPtr()->getKernel().GetFacets();
+    Base::PyArrayWriter<PointIndex> array(facets.size(), 3);
+    PointIndex* indices = array.data();
+    for (const auto& it : facets) {
+        *indices++ = it._aulPoints[0];
+        *indices++ = it._aulPoints[1];
+        *indices++ = it._aulPoints[2];
+    }
+    return Py::new_reference_to(array.getView());
+}
+
+PyObject* MeshPy::setTopology(PyObject* args)
+{
+    PyObject* pyPoints {};
+    PyObject* pyFacets {};
+    if (!PyArg_ParseTuple(args, "OO", &pyPoints, &pyFacets)) {
+        return nullptr;
+    }
+
+    Base::PyArrayReader pointArray(pyPoints, 3);
+    Base::PyArrayReader facetArray(pyFacets, 3);
+    std::vector<double> coords = pointArray.getValues<double>();
+    std::vector<PointIndex> indices = facetArray.getValues<PointIndex>();
+
+    MeshObject* mesh = getMeshObjectPtr();
+    Base::Matrix4D mat = mesh->getTransform();
+    mat.inverse();
+    MeshCore::MeshPointArray points;
+    points.reserve(pointArray.rows());
+    for (std::size_t i = 0; i < coords.size(); i += 3) {
+        Base::Vector3d pnt = mat * Base::Vector3d(coords[i], coords[i + 1], coords[i + 2]);
+        points.push_back(Base::Vector3f(float(pnt.x), float(pnt.y), float(pnt.z)));
+    }
+
+    MeshCore::MeshFacetArray facets;
+    facets.reserve(facetArray.rows());
+    for (std::size_t i = 0; i < indices.size(); i += 3) {
+        if (indices[i] >= points.size() || indices[i + 1] >= points.size()
+            || indices[i + 2] >= points.size()) {
+            throw Py::IndexError("Facet index out of range");
+        }
+        facets.push_back(MeshCore::MeshFacet(indices[i], indices[i + 1], indices[i + 2]));
+    }
+
+    MeshCore::MeshKernel kernel;
+    kernel.Adopt(points, facets, true);
+    mesh->swap(kernel);
+    Py_Return;
+}
+
 PyObject* MeshPy::addSegment(PyObject* args)
 {
     PyObject* pylist {};
@@ -2010,6 +2146,34 @@ PyObject* MeshPy::trimByPlane(PyObject* args)
     Py_Return;
 }
 
+PyObject* MeshPy::trimByPlanes(PyObject* args)
+{
+    PyObject* obj {};
+    if (!PyArg_ParseTuple(args, "O", &obj)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        std::vector<MeshObject::TPlane> planes;
+        Py::Sequence list(obj);
+        for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
+            Py::Tuple pair(*it);
+            Base::Vector3d pnt = Py::Vector(pair.getItem(0)).toVector();
+            Base::Vector3d dir = Py::Vector(pair.getItem(1)).toVector();
+            planes.emplace_back(
+                Base::convertTo<Base::Vector3f>(pnt),
+                Base::convertTo<Base::Vector3f>(dir)
+            );
+        }
+
+        getMeshObjectPtr()->trimByPlanes(planes);
+    }
+    PY_CATCH;
+
+    Py_Return;
+}
+
 PyObject* MeshPy::smooth(PyObject* args, PyObject* kwds) const
 {
     const char* method = "Laplace";
@@ -2079,10 +2243,11 @@ PyObject* MeshPy::decimate(PyObject* args)
 {
     float fTol {};
     float fRed {};
-    if (PyArg_ParseTuple(args, "ff", &fTol, &fRed)) {
+    PyObject* parallel = Py_True;
+    if (PyArg_ParseTuple(args, "ff|O!", &fTol, &fRed, &PyBool_Type, &parallel)) {
         PY_TRY
         {
-            getMeshObjectPtr()->decimate(fTol, fRed);
+            getMeshObjectPtr()->decimate(fTol, fRed, Base::asBoolean(parallel));
         }
         PY_CATCH;
 
@@ -2091,10 +2256,11 @@ PyObject* MeshPy::decimate(PyObject* args)
 
     PyErr_Clear();
     int targetSize {};
-    if (PyArg_ParseTuple(args, "i", &targetSize)) {
+    parallel = Py_True;
+    if (PyArg_ParseTuple(args, "i|O!", &targetSize, &PyBool_Type, &parallel)) {
         PY_TRY
         {
-            getMeshObjectPtr()->decimate(targetSize);
+            getMeshObjectPtr()->decimate(targetSize, Base::asBoolean(parallel));
         }
         PY_CATCH;
 
@@ -2103,7 +2269,8 @@ PyObject* MeshPy::decimate(PyObject* args)
 
     PyErr_SetString(
         PyExc_ValueError,
-        "decimate(tolerance=float, reduction=float) or decimate(targetSize=int)"
+        "decimate(tolerance=float, reduction=float, [parallel=bool]) or "
+        "decimate(targetSize=int, [parallel=bool])"
     );
     return nullptr;
 }
@@ -59,6 +59,11 @@ bool DlgDecimating::isAbsoluteNumber() const
     return ui->checkAbsoluteNumber->isChecked();
 }
 
+bool DlgDecimating::isParallel() const
+{
+    return ui->checkParallel->isChecked();
+}
+
 int DlgDecimating::targetNumberOfTriangles() const
 {
     if (ui->checkAbsoluteNumber->isChecked()) {
@@ -168,16 +173,17 @@ bool TaskDecimating::accept()
     float tolerance = float(widget->tolerance());
     float reduction = float(widget->reduction());
     bool absolute = widget->isAbsoluteNumber();
+    const char* parallel = widget->isParallel() ? "True" : "False";
     int targetSize = 0;
     if (absolute) {
         targetSize = widget->targetNumberOfTriangles();
     }
     for (auto mesh : meshes) {
         if (absolute) {
-            Gui::cmdAppObjectArgs(mesh, "decimate(%i)", targetSize);
+            Gui::cmdAppObjectArgs(mesh, "decimate(%i, %s)", targetSize, parallel);
         }
         else {
-            Gui::cmdAppObjectArgs(mesh, "decimate(%f, %f)", tolerance, reduction);
+            Gui::cmdAppObjectArgs(mesh, "decimate(%f, %f, %s)", tolerance, reduction, parallel);
         }
     }
 
@@ -46,6 +46,7 @@ public:
     double tolerance() const;
     double reduction() const;
     bool isAbsoluteNumber() const;
+    bool isParallel() const;
     int targetNumberOfTriangles() const;
 
 private:
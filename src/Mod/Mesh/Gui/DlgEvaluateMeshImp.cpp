@@ -39,6 +39,7 @@
 #include <Mod/Mesh/App/MeshFeature.h>
 #include <Mod/Mesh/App/Core/Evaluation.h>
 #include <Mod/Mesh/App/Core/Degeneration.h>
+#include <Mod/Mesh/App/Core/EvalPipeline.h>
 
 #include "DlgEvaluateMeshImp.h"
 #include "ui_DlgEvaluateMesh.h"
@@ -82,6 +83,15 @@ public:
         ui.repairFoldsButton->setVisible(on);
     }
 
+    MeshCore::MeshEvalPipeline::Settings pipelineSettings() const
+    {
+        MeshCore::MeshEvalPipeline::Settings settings;
+        settings.degeneratedEpsilon = epsilonDegenerated;
+        settings.nonManifoldPoints = checkNonManfoldPoints;
+        settings.folds = enableFoldsCheck;
+        return settings;
+    }
+
     Ui_DlgEvaluateMesh ui {};
     std::map<std::string, ViewProviderMeshDefects*> vp;
     Mesh::Feature* meshFeature {nullptr};
@@ -522,27 +532,30 @@ void DlgEvaluateMeshImp::onAnalyzeOrientationButtonClicked()
 
         const MeshKernel& rMesh = d->meshFeature->Mesh.getValue().getKernel();
         MeshEvalOrientation eval(rMesh);
-        std::vector<MeshCore::FacetIndex> inds = eval.GetIndices();
-
-        if (inds.empty()) {
-            d->ui.checkOrientationButton->setText(tr("No flipped normals"));
-            d->ui.checkOrientationButton->setChecked(false);
-            d->ui.repairOrientationButton->setEnabled(false);
-            removeViewProvider("MeshGui::ViewProviderMeshOrientation");
-        }
-        else {
-            d->ui.checkOrientationButton->setText(tr("%1 flipped normals").arg(inds.size()));
-            d->ui.checkOrientationButton->setChecked(true);
-            d->ui.repairOrientationButton->setEnabled(true);
-            d->ui.repairAllTogether->setEnabled(true);
-            addViewProvider("MeshGui::ViewProviderMeshOrientation", eval.GetIndices());
-        }
+        showOrientation(eval.GetIndices());
 
         qApp->restoreOverrideCursor();
         d->ui.analyzeOrientationButton->setEnabled(true);
     }
 }
 
+void DlgEvaluateMeshImp::showOrientation(const std::vector<Mesh::FacetIndex>& inds)
+{
+    if (inds.empty()) {
+        d->ui.checkOrientationButton->setText(tr("No flipped normals"));
+        d->ui.checkOrientationButton->setChecked(false);
+        d->ui.repairOrientationButton->setEnabled(false);
+        removeViewProvider("MeshGui::ViewProviderMeshOrientation");
+    }
+    else {
+        d->ui.checkOrientationButton->setText(tr("%1 flipped normals").arg(inds.size()));
+        d->ui.checkOrientationButton->setChecked(true);
+        d->ui.repairOrientationButton->setEnabled(true);
+        d->ui.repairAllTogether->setEnabled(true);
+        addViewProvider("MeshGui::ViewProviderMeshOrientation", inds);
+    }
+}
+
 void DlgEvaluateMeshImp::onRepairOrientationButtonClicked()
 {
     if (d->meshFeature) {
@@ -606,54 +619,57 @@ void DlgEvaluateMeshImp::onAnalyzeNonmanifoldsButtonClicked()
 
         const MeshKernel& rMesh = d->meshFeature->Mesh.getValue().getKernel();
         MeshEvalTopology f_eval(rMesh);
-        bool ok1 = f_eval.Evaluate();
-        bool ok2 = true;
+        f_eval.Evaluate();
         std::vector<Mesh::PointIndex> point_indices;
 
         if (d->checkNonManfoldPoints) {
             MeshEvalPointManifolds p_eval(rMesh);
-            ok2 = p_eval.Evaluate();
-            if (!ok2) {
+            if (!p_eval.Evaluate()) {
                 point_indices = p_eval.GetIndices();
             }
         }
 
-        if (ok1 && ok2) {
-            d->ui.checkNonmanifoldsButton->setText(tr("No non-manifolds"));
-            d->ui.checkNonmanifoldsButton->setChecked(false);
-            d->ui.repairNonmanifoldsButton->setEnabled(false);
-            removeViewProvider("MeshGui::ViewProviderMeshNonManifolds");
-            removeViewProvider("MeshGui::ViewProviderMeshNonManifoldPoints");
-        }
-        else {
-            d->ui.checkNonmanifoldsButton->setText(
-                tr("%1 non-manifolds").arg(f_eval.CountManifolds() + point_indices.size())
-            );
-            d->ui.checkNonmanifoldsButton->setChecked(true);
-            d->ui.repairNonmanifoldsButton->setEnabled(true);
-            d->ui.repairAllTogether->setEnabled(true);
-
-            if (!ok1) {
-                const std::vector<std::pair<Mesh::FacetIndex, Mesh::FacetIndex>>& inds
-                    = f_eval.GetIndices();
-                std::vector<Mesh::FacetIndex> indices;
-                indices.reserve(2 * inds.size());
-                std::vector<std::pair<Mesh::FacetIndex, Mesh::FacetIndex>>::const_iterator it;
-                for (it = inds.begin(); it != inds.end(); ++it) {
-                    indices.push_back(it->first);
-                    indices.push_back(it->second);
-                }
-
-                addViewProvider("MeshGui::ViewProviderMeshNonManifolds", indices);
-            }
+        showNonmanifolds(f_eval.GetIndices(), point_indices);
 
-            if (!ok2) {
-                addViewProvider("MeshGui::ViewProviderMeshNonManifoldPoints", point_indices);
+        qApp->restoreOverrideCursor();
+        d->ui.analyzeNonmanifoldsButton->setEnabled(true);
+    }
+}
+
+void DlgEvaluateMeshImp::showNonmanifolds(
+    const std::vector<std::pair<Mesh::PointIndex, Mesh::PointIndex>>& edges,
+    const std::vector<Mesh::PointIndex>& point_indices
+)
+{
+    if (edges.empty() && point_indices.empty()) {
+        d->ui.checkNonmanifoldsButton->setText(tr("No non-manifolds"));
+        d->ui.checkNonmanifoldsButton->setChecked(false);
+        d->ui.repairNonmanifoldsButton->setEnabled(false);
+        removeViewProvider("MeshGui::ViewProviderMeshNonManifolds");
+        removeViewProvider("MeshGui::ViewProviderMeshNonManifoldPoints");
+    }
+    else {
+        d->ui.checkNonmanifoldsButton->setText(
+            tr("%1 non-manifolds").arg(edges.size() + point_indices.size())
+        );
+        d->ui.checkNonmanifoldsButton->setChecked(true);
+        d->ui.repairNonmanifoldsButton->setEnabled(true);
+        d->ui.repairAllTogether->setEnabled(true);
+
+        if (!edges.empty()) {
+            std::vector<Mesh::PointIndex> indices;
+            indices.reserve(2 * edges.size());
+            for (const auto& it : edges) {
+                indices.push_back(it.first);
+                indices.push_back(it.second);
             }
+
+            addViewProvider("MeshGui::ViewProviderMeshNonManifolds", indices);
         }
 
-        qApp->restoreOverrideCursor();
-        d->ui.analyzeNonmanifoldsButton->setEnabled(true);
+        if (!point_indices.empty()) {
+            addViewProvider("MeshGui::ViewProviderMeshNonManifoldPoints", point_indices);
+        }
     }
 }
 
@@ -724,43 +740,61 @@ void DlgEvaluateMeshImp::onAnalyzeIndicesButtonClicked()
         MeshEvalCorruptedFacets cf(rMesh);
         MeshEvalNeighbourhood nb(rMesh);
 
+        using IndexError = MeshEvalPipeline::IndexError;
         if (!rf.Evaluate()) {
-            d->ui.checkIndicesButton->setText(tr("Invalid face indices"));
-            d->ui.checkIndicesButton->setChecked(true);
-            d->ui.repairIndicesButton->setEnabled(true);
-            d->ui.repairAllTogether->setEnabled(true);
-            addViewProvider("MeshGui::ViewProviderMeshIndices", rf.GetIndices());
+            showIndices(IndexError::FacetRange, rf.GetIndices());
         }
         else if (!rp.Evaluate()) {
-            d->ui.checkIndicesButton->setText(tr("Invalid point indices"));
-            d->ui.checkIndicesButton->setChecked(true);
-            d->ui.repairIndicesButton->setEnabled(true);
-            d->ui.repairAllTogether->setEnabled(true);
-            // addViewProvider("MeshGui::ViewProviderMeshIndices", rp.GetIndices());
+            showIndices(IndexError::PointRange, rp.GetIndices());
         }
         else if (!cf.Evaluate()) {
-            d->ui.checkIndicesButton->setText(tr("Multiple point indices"));
-            d->ui.checkIndicesButton->setChecked(true);
-            d->ui.repairIndicesButton->setEnabled(true);
-            d->ui.repairAllTogether->setEnabled(true);
-            addViewProvider("MeshGui::ViewProviderMeshIndices", cf.GetIndices());
+            showIndices(IndexError::Corrupted, cf.GetIndices());
         }
         else if (!nb.Evaluate()) {
-            d->ui.checkIndicesButton->setText(tr("Invalid neighbour indices"));
-            d->ui.checkIndicesButton->setChecked(true);
-            d->ui.repairIndicesButton->setEnabled(true);
-            d->ui.repairAllTogether->setEnabled(true);
-            addViewProvider("MeshGui::ViewProviderMeshIndices", nb.GetIndices());
+            showIndices(IndexError::Neighbourhood, nb.GetIndices());
         }
         else {
+            showIndices(IndexError::None, {});
+        }
+
+        qApp->restoreOverrideCursor();
+        d->ui.analyzeIndicesButton->setEnabled(true);
+    }
+}
+
+void DlgEvaluateMeshImp::showIndices(
+    MeshCore::MeshEvalPipeline::IndexError error,
+    const std::vector<Mesh::FacetIndex>& inds
+)
+{
+    using IndexError = MeshEvalPipeline::IndexError;
+    switch (error) {
+        case IndexError::FacetRange:
+            d->ui.checkIndicesButton->setText(tr("Invalid face indices"));
+            break;
+        case IndexError::PointRange:
+            d->ui.checkIndicesButton->setText(tr("Invalid point indices"));
+            break;
+        case IndexError::Corrupted:
+            d->ui.checkIndicesButton->setText(tr("Multiple point indices"));
+            break;
+        case IndexError::Neighbourhood:
+            d->ui.checkIndicesButton->setText(tr("Invalid neighbour indices"));
+            break;
+        case IndexError::None:
             d->ui.checkIndicesButton->setText(tr("No invalid indices"));
             d->ui.checkIndicesButton->setChecked(false);
             d->ui.repairIndicesButton->setEnabled(false);
             removeViewProvider("MeshGui::ViewProviderMeshIndices");
-        }
+            return;
+    }
 
-        qApp->restoreOverrideCursor();
-        d->ui.analyzeIndicesButton->setEnabled(true);
+    d->ui.checkIndicesButton->setChecked(true);
+    d->ui.repairIndicesButton->setEnabled(true);
+    d->ui.repairAllTogether->setEnabled(true);
+    // the indices of invalid points are not shown
+    if (error != IndexError::PointRange) {
+        addViewProvider("MeshGui::ViewProviderMeshIndices", inds);
     }
 }
 
@@ -814,27 +848,30 @@ void DlgEvaluateMeshImp::onAnalyzeDegeneratedButtonClicked()
 
         const MeshKernel& rMesh = d->meshFeature->Mesh.getValue().getKernel();
         MeshEvalDegeneratedFacets eval(rMesh, d->epsilonDegenerated);
-        std::vector<Mesh::FacetIndex> degen = eval.GetIndices();
-
-        if (degen.empty()) {
-            d->ui.checkDegenerationButton->setText(tr("No degenerations"));
-            d->ui.checkDegenerationButton->setChecked(false);
-            d->ui.repairDegeneratedButton->setEnabled(false);
-            removeViewProvider("MeshGui::ViewProviderMeshDegenerations");
-        }
-        else {
-            d->ui.checkDegenerationButton->setText(tr("%1 degenerated faces").arg(degen.size()));
-            d->ui.checkDegenerationButton->setChecked(true);
-            d->ui.repairDegeneratedButton->setEnabled(true);
-            d->ui.repairAllTogether->setEnabled(true);
-            addViewProvider("MeshGui::ViewProviderMeshDegenerations", degen);
-        }
+        showDegenerations(eval.GetIndices());
 
         qApp->restoreOverrideCursor();
         d->ui.analyzeDegeneratedButton->setEnabled(true);
     }
 }
 
+void DlgEvaluateMeshImp::showDegenerations(const std::vector<Mesh::FacetIndex>& degen)
+{
+    if (degen.empty()) {
+        d->ui.checkDegenerationButton->setText(tr("No degenerations"));
+        d->ui.checkDegenerationButton->setChecked(false);
+        d->ui.repairDegeneratedButton->setEnabled(false);
+        removeViewProvider("MeshGui::ViewProviderMeshDegenerations");
+    }
+    else {
+        d->ui.checkDegenerationButton->setText(tr("%1 degenerated faces").arg(degen.size()));
+        d->ui.checkDegenerationButton->setChecked(true);
+        d->ui.repairDegeneratedButton->setEnabled(true);
+        d->ui.repairAllTogether->setEnabled(true);
+        addViewProvider("MeshGui::ViewProviderMeshDegenerations", degen);
+    }
+}
+
 void DlgEvaluateMeshImp::onRepairDegeneratedButtonClicked()
 {
     if (d->meshFeature) {
@@ -886,28 +923,31 @@ void DlgEvaluateMeshImp::onAnalyzeDuplicatedFacesButtonClicked()
 
         const MeshKernel& rMesh = d->meshFeature->Mesh.getValue().getKernel();
         MeshEvalDuplicateFacets eval(rMesh);
-        std::vector<Mesh::FacetIndex> dupl = eval.GetIndices();
-
-        if (dupl.empty()) {
-            d->ui.checkDuplicatedFacesButton->setText(tr("No duplicated faces"));
-            d->ui.checkDuplicatedFacesButton->setChecked(false);
-            d->ui.repairDuplicatedFacesButton->setEnabled(false);
-            removeViewProvider("MeshGui::ViewProviderMeshDuplicatedFaces");
-        }
-        else {
-            d->ui.checkDuplicatedFacesButton->setText(tr("%1 duplicated faces").arg(dupl.size()));
-            d->ui.checkDuplicatedFacesButton->setChecked(true);
-            d->ui.repairDuplicatedFacesButton->setEnabled(true);
-            d->ui.repairAllTogether->setEnabled(true);
-
-            addViewProvider("MeshGui::ViewProviderMeshDuplicatedFaces", dupl);
-        }
+        showDuplicatedFaces(eval.GetIndices());
 
         qApp->restoreOverrideCursor();
         d->ui.analyzeDuplicatedFacesButton->setEnabled(true);
     }
 }
 
+void DlgEvaluateMeshImp::showDuplicatedFaces(const std::vector<Mesh::FacetIndex>& dupl)
+{
+    if (dupl.empty()) {
+        d->ui.checkDuplicatedFacesButton->setText(tr("No duplicated faces"));
+        d->ui.checkDuplicatedFacesButton->setChecked(false);
+        d->ui.repairDuplicatedFacesButton->setEnabled(false);
+        removeViewProvider("MeshGui::ViewProviderMeshDuplicatedFaces");
+    }
+    else {
+        d->ui.checkDuplicatedFacesButton->setText(tr("%1 duplicated faces").arg(dupl.size()));
+        d->ui.checkDuplicatedFacesButton->setChecked(true);
+        d->ui.repairDuplicatedFacesButton->setEnabled(true);
+        d->ui.repairAllTogether->setEnabled(true);
+
+        addViewProvider("MeshGui::ViewProviderMeshDuplicatedFaces", dupl);
+    }
+}
+
 void DlgEvaluateMeshImp::onRepairDuplicatedFacesButtonClicked()
 {
     if (d->meshFeature) {
@@ -958,19 +998,11 @@ void DlgEvaluateMeshImp::onAnalyzeDuplicatedPointsButtonClicked()
 
         const MeshKernel& rMesh = d->meshFeature->Mesh.getValue().getKernel();
         MeshEvalDuplicatePoints eval(rMesh);
-
         if (eval.Evaluate()) {
-            d->ui.checkDuplicatedPointsButton->setText(tr("No duplicated points"));
-            d->ui.checkDuplicatedPointsButton->setChecked(false);
-            d->ui.repairDuplicatedPointsButton->setEnabled(false);
-            removeViewProvider("MeshGui::ViewProviderMeshDuplicatedPoints");
+            showDuplicatedPoints({});
         }
         else {
-            d->ui.checkDuplicatedPointsButton->setText(tr("Duplicated points"));
-            d->ui.checkDuplicatedPointsButton->setChecked(true);
-            d->ui.repairDuplicatedPointsButton->setEnabled(true);
-            d->ui.repairAllTogether->setEnabled(true);
-            addViewProvider("MeshGui::ViewProviderMeshDuplicatedPoints", eval.GetIndices());
+            showDuplicatedPoints(eval.GetIndices());
         }
 
         qApp->restoreOverrideCursor();
@@ -978,6 +1010,23 @@ void DlgEvaluateMeshImp::onAnalyzeDuplicatedPointsButtonClicked()
     }
 }
 
+void DlgEvaluateMeshImp::showDuplicatedPoints(const std::vector<Mesh::PointIndex>& dupl)
+{
+    if (dupl.empty()) {
+        d->ui.checkDuplicatedPointsButton->setText(tr("No duplicated points"));
+        d->ui.checkDuplicatedPointsButton->setChecked(false);
+        d->ui.repairDuplicatedPointsButton->setEnabled(false);
+        removeViewProvider("MeshGui::ViewProviderMeshDuplicatedPoints");
+    }
+    else {
+        d->ui.checkDuplicatedPointsButton->setText(tr("Duplicated points"));
+        d->ui.checkDuplicatedPointsButton->setChecked(true);
+        d->ui.repairDuplicatedPointsButton->setEnabled(true);
+        d->ui.repairAllTogether->setEnabled(true);
+        addViewProvider("MeshGui::ViewProviderMeshDuplicatedPoints", dupl);
+    }
+}
+
 void DlgEvaluateMeshImp::onRepairDuplicatedPointsButtonClicked()
 {
     if (d->meshFeature) {
@@ -1036,35 +1085,41 @@ void DlgEvaluateMeshImp::onAnalyzeSelfIntersectionButtonClicked()
             Base::Console().message("The self-intersection analysis was aborted by the user\n");
         }
 
-        if (intersection.empty()) {
-            d->ui.checkSelfIntersectionButton->setText(tr("No self-intersections"));
-            d->ui.checkSelfIntersectionButton->setChecked(false);
-            d->ui.repairSelfIntersectionButton->setEnabled(false);
-            removeViewProvider("MeshGui::ViewProviderMeshSelfIntersections");
-        }
-        else {
-            d->ui.checkSelfIntersectionButton->setText(tr("Self-intersections"));
-            d->ui.checkSelfIntersectionButton->setChecked(true);
-            d->ui.repairSelfIntersectionButton->setEnabled(true);
-            d->ui.repairAllTogether->setEnabled(true);
-
-            std::vector<Mesh::FacetIndex> indices;
-            indices.reserve(2 * intersection.size());
-            std::vector<std::pair<Mesh::FacetIndex, Mesh::FacetIndex>>::iterator it;
-            for (it = intersection.begin(); it != intersection.end(); ++it) {
-                indices.push_back(it->first);
-                indices.push_back(it->second);
-            }
-
-            addViewProvider("MeshGui::ViewProviderMeshSelfIntersections", indices);
-            d->self_intersections.swap(indices);
-        }
+        showSelfIntersections(intersection);
 
         qApp->restoreOverrideCursor();
         d->ui.analyzeSelfIntersectionButton->setEnabled(true);
     }
 }
 
+void DlgEvaluateMeshImp::showSelfIntersections(
+    const std::vector<std::pair<Mesh::FacetIndex, Mesh::FacetIndex>>& intersection
+)
+{
+    if (intersection.empty()) {
+        d->ui.checkSelfIntersectionButton->setText(tr("No self-intersections"));
+        d->ui.checkSelfIntersectionButton->setChecked(false);
+        d->ui.repairSelfIntersectionButton->setEnabled(false);
+        removeViewProvider("MeshGui::ViewProviderMeshSelfIntersections");
+    }
+    else {
+        d->ui.checkSelfIntersectionButton->setText(tr("Self-intersections"));
+        d->ui.checkSelfIntersectionButton->setChecked(true);
+        d->ui.repairSelfIntersectionButton->setEnabled(true);
+        d->ui.repairAllTogether->setEnabled(true);
+
+        std::vector<Mesh::FacetIndex> indices;
+        indices.reserve(2 * intersection.size());
+        for (const auto& it : intersection) {
+            indices.push_back(it.first);
+            indices.push_back(it.second);
+        }
+
+        addViewProvider("MeshGui::ViewProviderMeshSelfIntersections", indices);
+        d->self_intersections.swap(indices);
+    }
+}
+
 void DlgEvaluateMeshImp::onRepairSelfIntersectionButtonClicked()
 {
     if (d->meshFeature) {
@@ -1112,14 +1167,9 @@ void DlgEvaluateMeshImp::onAnalyzeFoldsButtonClicked()
         bool ok2 = b_eval.Evaluate();
         bool ok3 = f_eval.Evaluate();
 
-        if (ok1 && ok2 && ok3) {
-            d->ui.checkFoldsButton->setText(tr("No folds on surface"));
-            d->ui.checkFoldsButton->setChecked(false);
-            d->ui.repairFoldsButton->setEnabled(false);
-            removeViewProvider("MeshGui::ViewProviderMeshFolds");
-        }
-        else {
-            std::vector<Mesh::FacetIndex> inds = f_eval.GetIndices();
+        std::vector<Mesh::FacetIndex> inds;
+        if (!ok1 || !ok2 || !ok3) {
+            inds = f_eval.GetIndices();
             std::vector<Mesh::FacetIndex> inds1 = s_eval.GetIndices();
             std::vector<Mesh::FacetIndex> inds2 = b_eval.GetIndices();
             inds.insert(inds.end(), inds1.begin(), inds1.end());
@@ -1128,19 +1178,32 @@ void DlgEvaluateMeshImp::onAnalyzeFoldsButtonClicked()
             // remove duplicates
             std::sort(inds.begin(), inds.end());
             inds.erase(std::unique(inds.begin(), inds.end()), inds.end());
-
-            d->ui.checkFoldsButton->setText(tr("%1 folds on surface").arg(inds.size()));
-            d->ui.checkFoldsButton->setChecked(true);
-            d->ui.repairFoldsButton->setEnabled(true);
-            d->ui.repairAllTogether->setEnabled(true);
-            addViewProvider("MeshGui::ViewProviderMeshFolds", inds);
         }
 
+        showFolds(inds);
+
         qApp->restoreOverrideCursor();
         d->ui.analyzeFoldsButton->setEnabled(true);
     }
 }
 
+void DlgEvaluateMeshImp::showFolds(const std::vector<Mesh::FacetIndex>& inds)
+{
+    if (inds.empty()) {
+        d->ui.checkFoldsButton->setText(tr("No folds on surface"));
+        d->ui.checkFoldsButton->setChecked(false);
+        d->ui.repairFoldsButton->setEnabled(false);
+        removeViewProvider("MeshGui::ViewProviderMeshFolds");
+    }
+    else {
+        d->ui.checkFoldsButton->setText(tr("%1 folds on surface").arg(inds.size()));
+        d->ui.checkFoldsButton->setChecked(true);
+        d->ui.repairFoldsButton->setEnabled(true);
+        d->ui.repairAllTogether->setEnabled(true);
+        addViewProvider("MeshGui::ViewProviderMeshFolds", inds);
+    }
+}
+
 void DlgEvaluateMeshImp::onRepairFoldsButtonClicked()
 {
     if (d->meshFeature) {
@@ -1173,21 +1236,38 @@ void DlgEvaluateMeshImp::onRepairFoldsButtonClicked()
 
 void DlgEvaluateMeshImp::onAnalyzeAllTogetherClicked()
 {
-    onAnalyzeOrientationButtonClicked();
-    onAnalyzeDuplicatedFacesButtonClicked();
-    onAnalyzeDuplicatedPointsButtonClicked();
-    onAnalyzeNonmanifoldsButtonClicked();
-    onAnalyzeDegeneratedButtonClicked();
-    onAnalyzeIndicesButtonClicked();
-    onAnalyzeSelfIntersectionButtonClicked();
-    if (d->enableFoldsCheck) {
-        onAnalyzeFoldsButtonClicked();
+    if (d->meshFeature) {
+        d->ui.analyzeAllTogether->setEnabled(false);
+        qApp->processEvents();
+        qApp->setOverrideCursor(Qt::WaitCursor);
+
+        // all checks share the same neighbourhood data and run in parallel
+        const MeshKernel& rMesh = d->meshFeature->Mesh.getValue().getKernel();
+        MeshEvalPipeline eval(rMesh);
+        MeshEvalPipeline::Result result = eval.Evaluate(d->pipelineSettings());
+
+        using IndexError = MeshEvalPipeline::IndexError;
+        showIndices(result.indexError, result.invalidIndices);
+        if (result.indexError != IndexError::FacetRange
+            && result.indexError != IndexError::PointRange) {
+            showOrientation(result.flippedFacets);
+            showDuplicatedFaces(result.duplicatedFacets);
+            showDuplicatedPoints(result.duplicatedPoints);
+            showNonmanifolds(result.nonManifoldEdges, result.nonManifoldPoints);
+            showDegenerations(result.degeneratedFacets);
+            showSelfIntersections(result.selfIntersections);
+            if (d->enableFoldsCheck) {
+                showFolds(result.folds);
+            }
+        }
+
+        qApp->restoreOverrideCursor();
+        d->ui.analyzeAllTogether->setEnabled(true);
     }
 }
 
 void DlgEvaluateMeshImp::onRepairAllTogetherClicked()
 {
-    // clang-format off
     if (d->meshFeature) {
         Gui::WaitCursor wc;
         const char* docName = App::GetApplication().getDocumentName(d->meshFeature->getDocument());
@@ -1195,101 +1275,20 @@ void DlgEvaluateMeshImp::onRepairAllTogetherClicked()
         Gui::Document* doc = Gui::Application::Instance->getDocument(docName);
         doc->openCommand(QT_TRANSLATE_NOOP("Command", "Repair Mesh"));
 
-        bool run = false;
-        bool self = true;
-        int max_iter = 10;
-        const MeshKernel& rMesh = d->meshFeature->Mesh.getValue().getKernel();
+        // all defects are fixed in one batch, repeat this if new defects arise from it
+        MeshEvalPipeline::Settings settings = d->pipelineSettings();
+        int max_iter = d->ui.checkRepeatButton->isChecked() ? 10 : 1;
         try {
-            do {
-                run = false;
-                {
-                    MeshEvalSelfIntersection eval(rMesh);
-                    if (self && !eval.Evaluate()) {
-                        Gui::Command::doCommand(Gui::Command::App,
-                            "App.getDocument(\"%s\").getObject(\"%s\").fixSelfIntersections()",
-                            docName, objName);
-                        run = true;
-                    }
-                    else {
-                        self = false; // once no self-intersections found do not repeat it later on
-                    }
-                    qApp->processEvents();
-                }
-                if (d->enableFoldsCheck) {
-                    MeshEvalFoldsOnSurface s_eval(rMesh);
-                    MeshEvalFoldsOnBoundary b_eval(rMesh);
-                    MeshEvalFoldOversOnSurface f_eval(rMesh);
-                    if (!s_eval.Evaluate() || !b_eval.Evaluate() || !f_eval.Evaluate()) {
-                        Gui::Command::doCommand(Gui::Command::App,
-                            "App.getDocument(\"%s\").getObject(\"%s\").removeFoldsOnSurface()",
-                            docName, objName);
-                        run = true;
-                    }
-                    qApp->processEvents();
-                }
-                {
-                    MeshEvalOrientation eval(rMesh);
-                    if (!eval.Evaluate()) {
-                        Gui::Command::doCommand(Gui::Command::App,
-                            "App.getDocument(\"%s\").getObject(\"%s\").harmonizeNormals()",
-                            docName, objName);
-                        run = true;
-                    }
-                    qApp->processEvents();
-                }
-                {
-                    MeshEvalTopology eval(rMesh);
-                    if (!eval.Evaluate()) {
-                        Gui::Command::doCommand(Gui::Command::App,
-                            "App.getDocument(\"%s\").getObject(\"%s\").removeNonManifolds()",
-                            docName, objName);
-                        run = true;
-                    }
-                    qApp->processEvents();
-                }
-                {
-                    MeshEvalRangeFacet rf(rMesh);
-                    MeshEvalRangePoint rp(rMesh);
-                    MeshEvalCorruptedFacets cf(rMesh);
-                    MeshEvalNeighbourhood nb(rMesh);
-                    if (!rf.Evaluate() || !rp.Evaluate() || !cf.Evaluate() || !nb.Evaluate()) {
-                        Gui::Command::doCommand(Gui::Command::App,
-                            "App.getDocument(\"%s\").getObject(\"%s\").fixIndices()",
-                            docName, objName);
-                        run = true;
-                    }
-                }
-                {
-                    MeshEvalDegeneratedFacets eval(rMesh, d->epsilonDegenerated);
-                    if (!eval.Evaluate()) {
-                        Gui::Command::doCommand(Gui::Command::App,
-                            "App.getDocument(\"%s\").getObject(\"%s\").fixDegenerations(%f)",
-                            docName, objName, d->epsilonDegenerated);
-                        run = true;
-                    }
-                    qApp->processEvents();
-                }
-                {
-                    MeshEvalDuplicateFacets eval(rMesh);
-                    if (!eval.Evaluate()) {
-                        Gui::Command::doCommand(Gui::Command::App,
-                            "App.getDocument(\"%s\").getObject(\"%s\").removeDuplicatedFacets()",
-                            docName, objName);
-                        run = true;
-                    }
-                    qApp->processEvents();
-                }
-                {
-                    MeshEvalDuplicatePoints eval(rMesh);
-                    if (!eval.Evaluate()) {
-                        Gui::Command::doCommand(Gui::Command::App,
-                            "App.getDocument(\"%s\").getObject(\"%s\").removeDuplicatedPoints()",
-                            docName, objName);
-                        run = true;
-                    }
-                    qApp->processEvents();
-                }
-            } while(d->ui.checkRepeatButton->isChecked() && run && (--max_iter > 0));
+            Gui::Command::doCommand(
+                Gui::Command::App,
+                R"(App.getDocument("%s").getObject("%s").repair(%f, %s, %s, %d))",
+                docName,
+                objName,
+                settings.degeneratedEpsilon,
+                settings.nonManifoldPoints ? "True" : "False",
+                settings.folds ? "True" : "False",
+                max_iter
+            );
         }
         catch (const Base::Exception& e) {
             QMessageBox::warning(this, tr("Mesh repair"), QString::fromLatin1(e.what()));
@@ -1301,7 +1300,6 @@ void DlgEvaluateMeshImp::onRepairAllTogetherClicked()
         doc->commitCommand();
         doc->getDocument()->recompute();
     }
-    // clang-format on
 }
 
 void DlgEvaluateMeshImp::onButtonBoxClicked(QAbstractButton* button)
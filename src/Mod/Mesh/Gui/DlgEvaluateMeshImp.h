@@ -32,6 +32,7 @@
 #include <App/Document.h>
 #include <App/DocumentObserver.h>
 #include <Mod/Mesh/App/Types.h>
+#include <Mod/Mesh/App/Core/EvalPipeline.h>
 
 
 class QAbstractButton;
@@ -138,6 +139,18 @@ protected:
     void removeViewProviders();
     void changeEvent(QEvent* e) override;
 
+    void showOrientation(const std::vector<Mesh::FacetIndex>&);
+    void showDuplicatedFaces(const std::vector<Mesh::FacetIndex>&);
+    void showDuplicatedPoints(const std::vector<Mesh::PointIndex>&);
+    void showNonmanifolds(
+        const std::vector<std::pair<Mesh::PointIndex, Mesh::PointIndex>>& edges,
+        const std::vector<Mesh::PointIndex>& points
+    );
+    void showDegenerations(const std::vector<Mesh::FacetIndex>&);
+    void showIndices(MeshCore::MeshEvalPipeline::IndexError, const std::vector<Mesh::FacetIndex>&);
+    void showSelfIntersections(const std::vector<std::pair<Mesh::FacetIndex, Mesh::FacetIndex>>&);
+    void showFolds(const std::vector<Mesh::FacetIndex>&);
+
 private:
     class Private;
     Private* d;
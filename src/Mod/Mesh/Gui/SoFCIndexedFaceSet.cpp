@@ -54,6 +54,7 @@
 #include <Inventor/elements/SoMaterialBindingElement.h>
 #include <Inventor/elements/SoNormalBindingElement.h>
 #include <Inventor/elements/SoProjectionMatrixElement.h>
+#include <Inventor/elements/SoTextureEnabledElement.h>
 #include <Inventor/elements/SoViewingMatrixElement.h>
 #include <Inventor/errors/SoDebugError.h>
 #include <Inventor/nodes/SoCoordinate3.h>
@@ -80,6 +81,7 @@ public:
     Gui::OpenGLMultiBuffer indices;
     const SbColor* pcolors {nullptr};
     SoMaterialBindingElement::Binding matbinding {SoMaterialBindingElement::OVERALL};
+    GLenum indexType {GL_UNSIGNED_INT};
     bool initialized {false};
 
     Private();
@@ -142,8 +144,17 @@ void MeshRenderer::Private::generateGLArrays(
     vertices.allocate(vertex.data(), vertex.size() * sizeof(float));
     vertices.release();
 
+    // most meshes have less than 65536 vertices, halve the size of their index buffer then
     indices.bind();
-    indices.allocate(index.data(), index.size() * sizeof(int32_t));
+    if (*std::max_element(index.begin(), index.end()) <= std::numeric_limits<uint16_t>::max()) {
+        std::vector<uint16_t> shortIndex(index.begin(), index.end());
+        indices.allocate(shortIndex.data(), shortIndex.size() * sizeof(uint16_t));
+        indexType = GL_UNSIGNED_SHORT;
+    }
+    else {
+        indices.allocate(index.data(), index.size() * sizeof(int32_t));
+        indexType = GL_UNSIGNED_INT;
+    }
     indices.release();
     this->matbinding = matbind;
 }
@@ -172,7 +183,8 @@ void MeshRenderer::Private::renderGLArray(SoGLRenderAction* action, GLenum mode)
         glInterleavedArrays(GL_N3F_V3F, 0, nullptr);
     }
 
-    glDrawElements(mode, indices.size() / sizeof(uint32_t), GL_UNSIGNED_INT, nullptr);
+    std::size_t indexSize = indexType == GL_UNSIGNED_SHORT ? sizeof(uint16_t) : sizeof(uint32_t);
+    glDrawElements(mode, indices.size() / indexSize, indexType, nullptr);
 
     vertices.release();
     indices.release();
@@ -513,6 +525,11 @@ void SoFCIndexedFaceSet::GLRender(SoGLRenderAction* action)
         useVBO = false;
     }
 
+    // the buffer doesn't contain texture coordinates
+    if (SoTextureEnabledElement::get(state)) {
+        useVBO = false;
+    }
+
     // use VBO for fast rendering if possible
     if (useVBO) {
         if (updateGLArray.getValue()) {
@@ -49,6 +49,8 @@
 #include <Inventor/bundles/SoTextureCoordinateBundle.h>
 #include <Inventor/details/SoFaceDetail.h>
 #include <Inventor/details/SoLineDetail.h>
+#include <Inventor/elements/SoTextureCoordinateElement.h>
+#include <Inventor/elements/SoTextureEnabledElement.h>
 #include <Inventor/misc/SoState.h>
 
 #include <Base/Console.h>
@@ -646,6 +648,7 @@ void SoFCMeshObjectShape::GLRender(SoGLRenderAction* action)
         }
 
         Binding mbind = this->findMaterialBinding(state);
+        const SbVec2f* texcoords = findTextureCoordinates(state, mesh);
 
         SoMaterialBundle mb(action);
         // SoTextureCoordinateBundle tb(action, true, false);
@@ -659,8 +662,8 @@ void SoFCMeshObjectShape::GLRender(SoGLRenderAction* action)
         }
 
         if (!mode || mesh->countFacets() <= this->renderTriangleLimit) {
-            if (mbind != OVERALL) {
-                drawFaces(mesh, &mb, mbind, needNormals, ccw);
+            if (mbind != OVERALL || texcoords) {
+                drawFaces(mesh, &mb, mbind, needNormals, ccw, texcoords);
             }
             else {
 #ifdef RENDER_GLARRAYS
@@ -684,6 +687,27 @@ void SoFCMeshObjectShape::GLRender(SoGLRenderAction* action)
     }
 }
 
+/**
+ * Returns the explicit per-vertex texture coordinates if texturing is enabled, otherwise null.
+ */
+const SbVec2f* SoFCMeshObjectShape::findTextureCoordinates(
+    SoState* const state,
+    const Mesh::MeshObject* mesh
+) const
+{
+    if (!SoTextureEnabledElement::get(state)) {
+        return nullptr;
+    }
+
+    const SoTextureCoordinateElement* tce = SoTextureCoordinateElement::getInstance(state);
+    if (SoTextureCoordinateElement::getType(state) != SoTextureCoordinateElement::EXPLICIT
+        || tce->getDimension() != 2 || tce->getNum() != static_cast<int32_t>(mesh->countPoints())) {
+        return nullptr;
+    }
+
+    return tce->getArrayPtr2();
+}
+
 /**
  * Translates current material binding into the internal Binding enum.
  */
@@ -727,13 +751,19 @@ void SoFCMeshObjectShape::drawFaces(
     SoMaterialBundle* mb,
     Binding bind,
     SbBool needNormals,
-    SbBool ccw
+    SbBool ccw,
+    const SbVec2f* texcoords
 ) const
 {
     const MeshCore::MeshPointArray& rPoints = mesh->getKernel().GetPoints();
     const MeshCore::MeshFacetArray& rFacets = mesh->getKernel().GetFacets();
     bool perVertex = (mb && bind == PER_VERTEX_INDEXED);
     bool perFace = (mb && bind == PER_FACE_INDEXED);
+    auto sendTexCoord = [texcoords](MeshCore::PointIndex index) {
+        if (texcoords) {
+            glTexCoord2fv(texcoords[index].getValue());
+        }
+    };
 
     if (needNormals) {
         glBegin(GL_TRIANGLES);
@@ -757,14 +787,17 @@ void SoFCMeshObjectShape::drawFaces(
                 if (perVertex) {
                     mb->send(it->_aulPoints[0], true);
                 }
+                sendTexCoord(it->_aulPoints[0]);
                 glVertex(v0);
                 if (perVertex) {
                     mb->send(it->_aulPoints[1], true);
                 }
+                sendTexCoord(it->_aulPoints[1]);
                 glVertex(v1);
                 if (perVertex) {
                     mb->send(it->_aulPoints[2], true);
                 }
+                sendTexCoord(it->_aulPoints[2]);
                 glVertex(v2);
             }
         }
@@ -782,8 +815,11 @@ void SoFCMeshObjectShape::drawFaces(
                 n[2] = -((v1.x - v0.x) * (v2.y - v0.y) - (v1.y - v0.y) * (v2.x - v0.x));
 
                 glNormal(n);
+                sendTexCoord(rFacet._aulPoints[0]);
                 glVertex(v0);
+                sendTexCoord(rFacet._aulPoints[1]);
                 glVertex(v1);
+                sendTexCoord(rFacet._aulPoints[2]);
                 glVertex(v2);
             }
         }
@@ -792,8 +828,11 @@ void SoFCMeshObjectShape::drawFaces(
     else {
         glBegin(GL_TRIANGLES);
         for (const auto& rFacet : rFacets) {
+            sendTexCoord(rFacet._aulPoints[0]);
             glVertex(rPoints[rFacet._aulPoints[0]]);
+            sendTexCoord(rFacet._aulPoints[1]);
             glVertex(rPoints[rFacet._aulPoints[1]]);
+            sendTexCoord(rFacet._aulPoints[2]);
             glVertex(rPoints[rFacet._aulPoints[2]]);
         }
         glEnd();
@@ -37,6 +37,8 @@ using GLuint = unsigned int;
 using GLint = int;
 using GLfloat = float;
 
+class SbVec2f;
+
 namespace MeshCore
 {
 class MeshFacetGrid;
@@ -218,13 +220,15 @@ private:
 private:
     void notify(SoNotList* node) override;
     Binding findMaterialBinding(SoState* const state) const;
+    const SbVec2f* findTextureCoordinates(SoState* const state, const Mesh::MeshObject*) const;
     // Draw faces
     void drawFaces(
         const Mesh::MeshObject*,
         SoMaterialBundle* mb,
         Binding bind,
         SbBool needNormals,
-        SbBool ccw
+        SbBool ccw,
+        const SbVec2f* texcoords = nullptr
     ) const;
     void drawPoints(const Mesh::MeshObject*, SbBool needNormals, SbBool ccw) const;
     unsigned int countTriangles(SoAction* action) const;
@@ -37,11 +37,10 @@
 #include <Inventor/nodes/SoDrawStyle.h>
 #include <Inventor/nodes/SoIndexedFaceSet.h>
 #include <Inventor/nodes/SoMaterial.h>
+#include <Inventor/nodes/SoMaterialBinding.h>
 #include <Inventor/nodes/SoShapeHints.h>
 #include <Inventor/sensors/SoIdleSensor.h>
 
-#include <boost/range/adaptors.hpp>
-
 #include <App/Annotation.h>
 #include <App/Document.h>
 #include <App/DocumentObjectGroup.h>
@@ -50,6 +49,7 @@
 #include <Gui/BitmapFactory.h>
 #include <Gui/Document.h>
 #include <Gui/MainWindow.h>
+#include <Gui/ScalarFieldColoring.h>
 #include <Gui/SoFCColorBar.h>
 #include <Gui/SoFCColorBarNotifier.h>
 #include <Gui/Selection/Selection.h>
@@ -88,6 +88,7 @@ ViewProviderMeshCurvature::ViewProviderMeshCurvature()
     pcColorBar->setRange(-0.5f, 0.5f, 3);
     pcLinkRoot = new SoGroup;
     pcLinkRoot->ref();
+    scalarField = std::make_unique<Gui::ScalarFieldColoring>();
     // NOLINTEND
 
     App::Material mat;
@@ -121,6 +122,9 @@ ViewProviderMeshCurvature::ViewProviderMeshCurvature()
 
     ADD_PROPERTY(TextureMaterial, (mat));
     SelectionStyle.setValue(1);  // BBOX
+
+    // the colors are taken from the texture of the scalar field
+    pcColorMat->diffuseColor.setValue(1.0F, 1.0F, 1.0F);
 }
 
 ViewProviderMeshCurvature::~ViewProviderMeshCurvature()
@@ -250,8 +254,7 @@ void ViewProviderMeshCurvature::slotChangedObject(
             const Mesh::PropertyMeshKernel& mesh = meshObject->Mesh;
             if ((&mesh) == (&Prop)) {
                 const Mesh::MeshObject& kernel = mesh.getValue();
-                pcColorMat->diffuseColor.setNum((int)kernel.countPoints());
-                pcColorMat->transparency.setNum((int)kernel.countPoints());
+                scalarField->setValues(std::vector<float>(kernel.countPoints()));
                 // make sure to recompute the feature
                 dynamic_cast<Mesh::Curvature*>(pcObject)->Source.touch();
             }
@@ -285,9 +288,10 @@ void ViewProviderMeshCurvature::attach(App::DocumentObject* pcFeat)
     pcColorShadedRoot->addChild(pcFlatStyle);
 
     auto pcMatBinding = new SoMaterialBinding;
-    pcMatBinding->value = SoMaterialBinding::PER_VERTEX_INDEXED;
+    pcMatBinding->value = SoMaterialBinding::OVERALL;
     pcColorShadedRoot->addChild(pcColorMat);
     pcColorShadedRoot->addChild(pcMatBinding);
+    pcColorShadedRoot->addChild(scalarField->getRoot());
     pcColorShadedRoot->addChild(pcLinkRoot);
 
     addDisplayMaskMode(pcColorShadedRoot, "ColorShaded");
@@ -318,8 +322,7 @@ void ViewProviderMeshCurvature::updateData(const App::Property* prop)
         Gui::coinRemoveAllChildren(this->pcLinkRoot);
         if (object) {
             const Mesh::MeshObject& kernel = object->Mesh.getValue();
-            pcColorMat->diffuseColor.setNum((int)kernel.countPoints());
-            pcColorMat->transparency.setNum((int)kernel.countPoints());
+            scalarField->setValues(std::vector<float>(kernel.countPoints()));
 
             // get the view provider of the associated mesh feature
             App::Document* rDoc = pcObject->getDocument();
@@ -363,24 +366,9 @@ void ViewProviderMeshCurvature::setVertexCurvatureMode(int mode)
 
     auto pCurvInfo = dynamic_cast<Mesh::PropertyCurvatureList*>(it->second);
 
-    // curvature values
-    std::vector<float> fValues = pCurvInfo->getCurvature(mode);
-    pcColorMat->diffuseColor.setNum(int(fValues.size()));
-    pcColorMat->transparency.setNum(int(fValues.size()));
-
-    SbColor* diffcol = pcColorMat->diffuseColor.startEditing();
-    float* transp = pcColorMat->transparency.startEditing();
-
-    for (auto const& value : fValues | boost::adaptors::indexed(0)) {
-        Base::Color c = pcColorBar->getColor(value.value());
-        // NOLINTBEGIN
-        diffcol[value.index()].setValue(c.r, c.g, c.b);
-        transp[value.index()] = c.transparency();
-        // NOLINTEND
-    }
-
-    pcColorMat->diffuseColor.finishEditing();
-    pcColorMat->transparency.finishEditing();
+    // curvature values, the colors are computed from the color bar when rendering
+    scalarField->setValues(pCurvInfo->getCurvature(mode));
+    scalarField->setColorBar(pcColorBar);
 
     // In order to apply the transparency changes the IndexFaceSet node must be touched
     touchShapeNode();
@@ -451,7 +439,9 @@ std::vector<std::string> ViewProviderMeshCurvature::getDisplayModes() const
 
 void ViewProviderMeshCurvature::OnChange(Base::Subject<int>& /*rCaller*/, int /*rcReason*/)
 {
-    setActiveMode();
+    // only the color mapping has changed, the values can be kept
+    scalarField->setColorBar(pcColorBar);
+    touchShapeNode();
 }
 
 namespace MeshGui
@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <memory>
 #include <App/DocumentObserver.h>
 #include <Base/Observer.h>
 
@@ -43,6 +44,7 @@ class SoTransformerManip;
 
 namespace Gui
 {
+class ScalarFieldColoring;
 class SoFCColorBar;
 class View3DInventorViewer;
 }  // namespace Gui
@@ -124,6 +126,7 @@ private:
     Gui::SoFCColorBar* pcColorBar;
     SoDrawStyle* pcColorStyle;
     SoSeparator* pcColorRoot;
+    std::unique_ptr<Gui::ScalarFieldColoring> scalarField;
 
 private:
     static bool addflag;
@@ -24,15 +24,21 @@
 
 #include <algorithm>
 
-#include <BRepMesh_IncrementalMesh.hxx>
-#include <BRepTools.hxx>
+#include <QtConcurrentMap>
+
+#include <Poly_Triangle.hxx>
 #include <Standard_Version.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
 #include <TopoDS_Shape.hxx>
 
 #include <Base/Console.h>
 #include <Base/Tools.h>
 #include <Mod/Mesh/App/Mesh.h>
 #include <Mod/Part/App/BRepMesh.h>
+#include <Mod/Part/App/TessellationCache.h>
+#include <Mod/Part/App/Tools.h>
 #include <Mod/Part/App/TopoShape.h>
 
 #include "Mesher.h"
@@ -213,6 +219,46 @@ public:
         }
         return meshdata;
     }
+
+    /**
+     * Collects the triangulations of all faces concurrently. Like TopoShape::getDomains()
+     * a face without triangulation yields an empty domain so that faces and domains match.
+     */
+    static std::vector<Part::TopoShape::Domain> getDomains(const TopoDS_Shape& shape)
+    {
+        std::vector<TopoDS_Face> faces;
+        for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+            faces.push_back(TopoDS::Face(xp.Current()));
+        }
+
+        return QtConcurrent::blockingMapped<std::vector<Part::TopoShape::Domain>>(
+            faces,
+            [](const TopoDS_Face& face) {
+                Part::TopoShape::Domain domain;
+                std::vector<gp_Pnt> points;
+                std::vector<Poly_Triangle> facets;
+                if (Part::Tools::getTriangulation(face, points, facets)) {
+                    domain.points.reserve(points.size());
+                    for (const auto& it : points) {
+                        domain.points.emplace_back(it.X(), it.Y(), it.Z());
+                    }
+
+                    domain.facets.reserve(facets.size());
+                    for (const auto& it : facets) {
+                        Standard_Integer N1, N2, N3;
+                        it.Get(N1, N2, N3);
+
+                        Part::TopoShape::Facet tria;
+                        tria.I1 = N1;
+                        tria.I2 = N2;
+                        tria.I3 = N3;
+                        domain.facets.push_back(tria);
+                    }
+                }
+                return domain;
+            }
+        );
+    }
 };
 }  // namespace MeshPart
 
@@ -226,13 +272,20 @@ Mesher::~Mesher() = default;
 
 Mesh::MeshObject* Mesher::createStandard() const
 {
-    if (!shape.IsNull()) {
-        BRepTools::Clean(shape);
-        BRepMesh_IncrementalMesh aMesh(shape, deflection, relative, angularDeflection);
-    }
+    Part::TessellationCache::Parameters params;
+    params.deflection = deflection;
+    params.relative = relative;
+    params.angularDeflection = angularDeflection;
+    params.parallel = parallel;
+    Part::TessellationCache::instance().mesh(shape, params);
 
     std::vector<Part::TopoShape::Domain> domains;
-    Part::TopoShape(shape).getDomains(domains);
+    if (parallel) {
+        domains = BrepMesh::getDomains(shape);
+    }
+    else {
+        Part::TopoShape(shape).getDomains(domains);
+    }
 
     BrepMesh brepmesh(this->segments, this->colors);
     return brepmesh.create(domains);
@@ -150,6 +150,19 @@ public:
     }
     //@}
 
+    /** @name Standard settings */
+    //@{
+    /// Mesh the faces concurrently and collect their triangles in parallel
+    void setParallel(bool on)
+    {
+        parallel = on;
+    }
+    bool isParallel() const
+    {
+        return parallel;
+    }
+    //@}
+
 #if defined(HAVE_NETGEN)
     /** @name Netgen settings */
     //@{
@@ -230,6 +243,7 @@ private:
     bool relative {false};
     bool regular {false};
     bool segments {false};
+    bool parallel {false};
 #if defined(HAVE_NETGEN)
     int fineness {5};
     double growthRate {0};
@@ -552,3 +552,39 @@ group() {
         doc = self.utility_create_scad(csg_data, "complex-fuse")
         self.assertEqual (doc.RootObjects[0].Placement, FreeCAD.Placement())
         FreeCAD.closeDocument(doc.Name)
+
+    def utility_open_csg_shapes(self, filename):
+        preferences = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Mod/OpenSCAD")
+        use_shape_import = preferences.GetBool('useShapeImport', False)
+        preferences.SetBool('useShapeImport', True)
+        try:
+            return importCSG.open(filename)
+        finally:
+            preferences.SetBool('useShapeImport', use_shape_import)
+
+    def test_open_csg_shapes(self):
+        testfile = join(self.test_dir, "CSG.csg")
+        doc = importCSG.open(testfile)
+        volumes = {name: doc.getObject(name).Shape.Volume
+                   for name in ("union", "intersection", "difference")}
+        FreeCAD.closeDocument(doc.Name)
+
+        doc = self.utility_open_csg_shapes(testfile)
+        # only the top level objects are created
+        self.assertEqual (len(doc.Objects), 3)
+        for name, volume in volumes.items():
+            obj = doc.getObject(name)
+            self.assertTrue (obj is not None)
+            self.assertEqual (obj.TypeId, "Part::Feature")
+            self.assertAlmostEqual (obj.Shape.Volume, volume, 3)
+        self.assertAlmostEqual (doc.getObject("union").Shape.BoundBox.Center.x, -24.0)
+        FreeCAD.closeDocument(doc.Name)
+
+    def test_open_csg_shapes_fallback(self):
+        filename = self.temp_dir.name + os.path.sep + "offset_shapes.csg"
+        with open(filename, "w+") as f:
+            f.write("offset(r = 1) {\n\tsquare(size = [2, 2], center = false);\n}\n")
+        doc = self.utility_open_csg_shapes(filename)
+        # offset isn't evaluated as shape, so the parametric import is used
+        self.assertTrue (doc.getObject("Offset2D") is not None)
+        FreeCAD.closeDocument(doc.Name)
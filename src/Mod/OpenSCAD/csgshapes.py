@@ -0,0 +1,369 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+
+#***************************************************************************
+#*   Copyright (c) 2026 FreeCAD Project Association                        *
+#*                                                                         *
+#*   This program is free software; you can redistribute it and/or modify  *
+#*   it under the terms of the GNU Lesser General Public License (LGPL)    *
+#*   as published by the Free Software Foundation; either version 2 of     *
+#*   the License, or (at your option) any later version.                   *
+#*   for detail see the LICENCE text file.                                 *
+#*                                                                         *
+#*   This program is distributed in the hope that it will be useful,       *
+#*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+#*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+#*   GNU Library General Public License for more details.                  *
+#*                                                                         *
+#*   You should have received a copy of the GNU Library General Public     *
+#*   License along with this program; if not, write to the Free Software   *
+#*   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  *
+#*   USA                                                                   *
+#*                                                                         *
+#***************************************************************************
+
+__title__ = "FreeCAD OpenSCAD Workbench - CSG import without intermediate objects"
+__url__ = ["https://www.freecad.org"]
+
+'''
+Evaluates a CSG file directly into shapes. Booleans are done with one
+(multi-argument) OCCT boolean per CSG node, and only one document object
+is created per top level statement. Nodes that can't be evaluated this way
+raise UnsupportedNode, so that the caller can fall back to importCSG.
+'''
+
+import math
+
+import FreeCAD
+import Part
+import ply.lex as lex
+
+import tokrules
+from OpenSCADUtils import fcsubmatrix, isspecialorthogonalpython, \
+        isrotoinversionpython, decomposerotoinversion
+
+
+class UnsupportedNode(Exception):
+    '''The CSG file contains a node that is only handled by importCSG'''
+
+
+class Node:
+    def __init__(self, name, args, positional, children):
+        self.name = name
+        self.args = args
+        self.positional = positional
+        self.children = children
+
+    def label(self):
+        '''name of the first node below transformations and groups'''
+        node = self
+        while node.name in ('multmatrix', 'group', 'color', 'render') \
+                and len(node.children) == 1:
+            node = node.children[0]
+        return node.name
+
+    def color(self):
+        '''colour of the outermost color node above the first real node'''
+        node = self
+        while node.name in ('multmatrix', 'group', 'render') and len(node.children) == 1:
+            node = node.children[0]
+        if node.name == 'color' and node.positional:
+            return node.positional[0]
+        return None
+
+
+class Parser:
+    '''Recursive descent parser for the statements of a CSG file'''
+    def __init__(self, text):
+        lexer = lex.lex(module=tokrules)
+        lexer.input(text)
+        self.tokens = list(lexer)
+        self.pos = 0
+
+    def peek(self, offset=0):
+        if self.pos + offset < len(self.tokens):
+            return self.tokens[self.pos + offset]
+        return None
+
+    def next(self):
+        tok = self.peek()
+        if tok is None:
+            raise UnsupportedNode('unexpected end of file')
+        self.pos += 1
+        return tok
+
+    def expect(self, type_):
+        tok = self.next()
+        if tok.type != type_:
+            raise UnsupportedNode('unexpected {} in line {}'.format(tok.value, tok.lineno))
+        return tok
+
+    def statements(self):
+        nodes = []
+        while self.peek() is not None and self.peek().type != 'EBRACE':
+            nodes.append(self.statement())
+        return nodes
+
+    def statement(self):
+        tok = self.next()
+        # modifiers are ignored like in importCSG
+        if tok.type.startswith('MODIFIER'):
+            tok = self.next()
+        name = tok.value
+        self.expect('LPAREN')
+        args, positional = self.arguments()
+        tok = self.next()
+        children = []
+        if tok.type == 'OBRACE':
+            children = self.statements()
+            self.expect('EBRACE')
+        elif tok.type != 'SEMICOL':
+            raise UnsupportedNode('unexpected {} in line {}'.format(tok.value, tok.lineno))
+        return Node(name, args, positional, children)
+
+    def arguments(self):
+        args = {}
+        positional = []
+        while self.peek() is not None and self.peek().type != 'RPAREN':
+            following = self.peek(1)
+            if following is not None and following.type == 'EQ':
+                key = self.next().value
+                self.next()
+                args[key] = self.value()
+            else:
+                positional.append(self.value())
+            if self.peek() is not None and self.peek().type == 'COMMA':
+                self.next()
+        self.expect('RPAREN')
+        return args, positional
+
+    def value(self):
+        tok = self.next()
+        if tok.type == 'NUMBER':
+            return float(tok.value)
+        if tok.type == 'true':
+            return True
+        if tok.type == 'false':
+            return False
+        if tok.type == 'undef':
+            return None
+        if tok.type == 'STRING':
+            return tok.value.strip('"')
+        if tok.type == 'OSQUARE':
+            values = []
+            while self.peek() is not None and self.peek().type != 'ESQUARE':
+                values.append(self.value())
+                if self.peek() is not None and self.peek().type == 'COMMA':
+                    self.next()
+            self.expect('ESQUARE')
+            return values
+        raise UnsupportedNode('unexpected {} in line {}'.format(tok.value, tok.lineno))
+
+
+def maxfn():
+    return FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Mod/OpenSCAD").\
+        GetInt('useMaxFN', 16)
+
+
+def isCircular(n):
+    fnmax = maxfn()
+    return n < 3 or fnmax != 0 and n > fnmax
+
+
+def regularPolygon(n, r, z=0.0):
+    pts = [FreeCAD.Vector(r * math.cos(2 * math.pi * i / n), r * math.sin(2 * math.pi * i / n), z)
+           for i in range(n)]
+    pts.append(pts[0])
+    return Part.makePolygon(pts)
+
+
+def fuse(shapes):
+    shapes = [s for s in shapes if s is not None]
+    if not shapes:
+        return None
+    if len(shapes) == 1:
+        return shapes[0]
+    return shapes[0].multiFuse(shapes[1:])
+
+
+def size3(value):
+    if isinstance(value, list):
+        return [float(v) for v in value]
+    return [float(value)] * 3
+
+
+class Evaluator:
+    def evaluate(self, node):
+        handler = getattr(self, 'eval_' + node.name, None)
+        if handler is None:
+            raise UnsupportedNode(node.name)
+        return handler(node)
+
+    def children(self, node):
+        return [self.evaluate(child) for child in node.children]
+
+    def eval_group(self, node):
+        return fuse(self.children(node))
+
+    eval_union = eval_group
+    eval_render = eval_group
+    eval_color = eval_group
+
+    def eval_difference(self, node):
+        shapes = self.children(node)
+        if not shapes or shapes[0] is None:
+            return None
+        tools = [s for s in shapes[1:] if s is not None]
+        if not tools:
+            return shapes[0]
+        return shapes[0].cut(tools)
+
+    def eval_intersection(self, node):
+        shapes = self.children(node)
+        if not shapes or any(s is None for s in shapes):
+            return None
+        result = shapes[0]
+        for tool in shapes[1:]:
+            result = result.common(tool)
+        return result
+
+    def eval_multmatrix(self, node):
+        shape = fuse(self.children(node))
+        if shape is None:
+            return None
+        matrix = FreeCAD.Matrix(*[float(v) for row in node.positional[0] for v in row])
+        submatrix = fcsubmatrix(matrix)
+        if isspecialorthogonalpython(submatrix):
+            shape = shape.copy()
+            shape.transformShape(matrix)
+        elif isrotoinversionpython(submatrix):
+            cmat, axis = decomposerotoinversion(matrix)
+            shape = shape.mirror(FreeCAD.Vector(), axis)
+            shape.transformShape(cmat)
+        else:
+            shape = shape.transformGeometry(matrix)
+        return shape
+
+    def eval_cube(self, node):
+        l, w, h = size3(node.args.get('size', 1.0))
+        if l <= 0 or w <= 0 or h <= 0:
+            return None
+        shape = Part.makeBox(l, w, h)
+        if node.args.get('center', False):
+            shape.translate(FreeCAD.Vector(-l / 2, -w / 2, -h / 2))
+        return shape
+
+    def eval_sphere(self, node):
+        r = float(node.args.get('r', 1.0))
+        if r <= 0:
+            return None
+        return Part.makeSphere(r)
+
+    def eval_cylinder(self, node):
+        h = float(node.args.get('h', 1.0))
+        r1 = float(node.args.get('r1', 1.0))
+        r2 = float(node.args.get('r2', 1.0))
+        n = int(round(float(node.args.get('$fn', 0))))
+        if h <= 0 or (r1 <= 0 and r2 <= 0):
+            return None
+        if isCircular(n):
+            if r1 == r2:
+                shape = Part.makeCylinder(r1, h)
+            else:
+                shape = Part.makeCone(r1, r2, h)
+        elif r1 == r2:
+            shape = Part.Face(regularPolygon(n, r1)).extrude(FreeCAD.Vector(0, 0, h))
+        elif r1 > 0 and r2 > 0:
+            wires = [regularPolygon(n, r1), regularPolygon(n, r2, h)]
+            shape = Part.makeLoft(wires, True)
+        else:
+            raise UnsupportedNode('pyramid')
+        if node.args.get('center', False):
+            shape.translate(FreeCAD.Vector(0, 0, -h / 2))
+        return shape
+
+    def eval_polyhedron(self, node):
+        points = [FreeCAD.Vector(*[float(c) for c in p]) for p in node.args['points']]
+        faces = node.args.get('faces') or node.args.get('triangles')
+        faces_list = []
+        for face in faces:
+            pp = [points[int(k)] for k in face]
+            pp.append(pp[0])
+            w = Part.makePolygon(pp)
+            try:
+                f = Part.Face(w)
+            except Exception:
+                f = Part.makeFilledFace(Part.__sortEdges__(w.Edges[:]))
+            faces_list.append(f)
+        solid = Part.Solid(Part.makeShell(faces_list)).removeSplitter()
+        if solid.Volume < 0:
+            solid.reverse()
+        return solid
+
+    def eval_square(self, node):
+        size = node.args.get('size', 1.0)
+        x, y = (float(size[0]), float(size[1])) if isinstance(size, list) else (size, size)
+        shape = Part.makePlane(x, y)
+        if node.args.get('center', False):
+            shape.translate(FreeCAD.Vector(-x / 2, -y / 2, 0))
+        return shape
+
+    def eval_circle(self, node):
+        r = float(node.args.get('r', 1.0)) or 0.00001
+        n = int(round(float(node.args.get('$fn', 0))))
+        if n == 0 or maxfn() != 0 and n >= maxfn():
+            return Part.Face(Part.Wire(Part.makeCircle(r)))
+        return Part.Face(regularPolygon(n, r))
+
+    def eval_polygon(self, node):
+        points = [FreeCAD.Vector(float(p[0]), float(p[1]), 0) for p in node.args['points']]
+        paths = node.args.get('paths') or [list(range(len(points)))]
+        wires = []
+        for path in paths:
+            pp = [points[int(k)] for k in path]
+            pp.append(pp[0])
+            wires.append(Part.makePolygon(pp))
+        if len(wires) == 1:
+            return Part.Face(wires[0])
+        return Part.makeFace(wires, 'Part::FaceMakerBullseye')
+
+    def eval_linear_extrude(self, node):
+        scale = node.args.get('scale', 1.0)
+        if float(node.args.get('twist', 0.0)) != 0.0 or scale not in (1.0, [1.0, 1.0]):
+            raise UnsupportedNode('linear_extrude with twist or scale')
+        base = fuse(self.children(node))
+        if base is None:
+            return None
+        h = float(node.args['height'])
+        shape = base.extrude(FreeCAD.Vector(0, 0, h))
+        if node.args.get('center', False):
+            shape.translate(FreeCAD.Vector(0, 0, -h / 2))
+        return shape
+
+
+def evaluate(text):
+    '''Returns a list of (node, shape) for the top level statements of the
+    CSG text. Raises UnsupportedNode before any object is created if a node
+    can only be handled by importCSG.'''
+    parser = Parser(text)
+    nodes = parser.statements()
+    if parser.peek() is not None:
+        raise UnsupportedNode('unexpected }')
+    evaluator = Evaluator()
+    return [(node, evaluator.evaluate(node)) for node in nodes]
+
+
+def insert(text, doc):
+    '''Creates one Part::Feature per non-empty top level statement'''
+    objects = []
+    for node, shape in evaluate(text):
+        if shape is None:
+            continue
+        obj = doc.addObject('Part::Feature', node.label())
+        obj.Shape = shape
+        color = node.color()
+        if FreeCAD.GuiUp and color:
+            obj.ViewObject.ShapeColor = tuple(float(c) for c in color[:3])
+            if len(color) > 3:
+                obj.ViewObject.Transparency = 100 - int(math.floor(100 * float(color[3])))
+        objects.append(obj)
+    return objects
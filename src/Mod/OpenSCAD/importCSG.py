@@ -169,11 +169,14 @@ def processcsg(filename):
     if printverbose: print('Parser Loaded')
 
     f = io.open(filename, 'r', encoding="utf8")
-
-    if printverbose: print('Start Parser')
-
-    result = parser.parse(f.read())
+    text = f.read()
     f.close()
+
+    if params.GetBool('useShapeImport', False) and processcsgshapes(text):
+        result = None
+    else:
+        if printverbose: print('Start Parser')
+        result = parser.parse(text)
     if printverbose:
         print('End Parser')
         print(result)
@@ -185,6 +188,18 @@ def processcsg(filename):
     doc.recompute()
 
 
+def processcsgshapes(text):
+    '''Import the CSG text as one shape per top level statement. Returns False
+    without creating any object if the file needs the parametric import.'''
+    import csgshapes
+    try:
+        csgshapes.insert(text, doc)
+    except csgshapes.UnsupportedNode as e:
+        FreeCAD.Console.PrintLog(f'Shape import not possible ({e}), using parametric import\n')
+        return False
+    return True
+
+
 def p_block_list_(p):
     '''
     block_list : statement
@@ -190,8 +190,10 @@
 
 #include <OCAF/ImportExportSettings.h>
 #include "MeasureClient.h"
+#include "RecomputeCache.h"
 
 #include <FuzzyHelper.h>
+#include <ParallelPolicy.h>
 
 #include <App/Services.h>
 #include <Services.h>
@@ -454,6 +456,7 @@ PyMOD_INIT_FUNC(Part)
     Part::Boolean               ::init();
     Part::Common                ::init();
     Part::MultiCommon           ::init();
+    Part::MultiCut              ::init();
     Part::Cut                   ::init();
     Part::Fuse                  ::init();
     Part::MultiFuse             ::init();
@@ -576,11 +579,13 @@ PyMOD_INIT_FUNC(Part)
 
     OCAF::ImportExportSettings::initialize();
     Part::MeasureClient::initialize();
+    Part::RecomputeCache::instance();
 
     Base::Reference<ParameterGrp> hGrp = App::GetApplication().GetUserParameter()
         .GetGroup("BaseApp")->GetGroup("Preferences")->GetGroup("Mod/Part/Boolean");
 
     Part::FuzzyHelper::setBooleanFuzzy(hGrp->GetFloat("BooleanFuzzy",10.0));
+    Part::ParallelPolicy::loadSettings();
 
     Base::registerServiceImplementation<App::SubObjectPlacementProvider>(new AttacherSubObjectPlacement);
     Base::registerServiceImplementation<App::CenterOfMassProvider>(new PartCenterOfMass);
@@ -92,8 +92,10 @@
 #include "ImportIges.h"
 #include "ImportStep.h"
 #include "Interface.h"
+#include "MassProperties.h"
 #include "modelRefine.h"
 #include "OCCError.h"
+#include "ParallelPolicy.h"
 #include "PartFeature.h"
 #include "PartPyCXX.h"
 #include "Tools.h"
@@ -783,6 +785,37 @@ public:
             &Module::joinSubname,
             "joinSubname(sub,mapped,subElement) -> subname\n"
         );
+        add_varargs_method(
+            "getParallelPolicy",
+            &Module::getParallelPolicy,
+            "getParallelPolicy() -> dict\n"
+            "Return the parallel mode settings of the OCCT algorithms used by Part.\n\n"
+            "ThreadCount: number of threads of the OCCT thread pool, 0 for one per core\n"
+            "Boolean, Mesh, Check, Distance, MassProperties, Sewing: whether the algorithm "
+            "runs in parallel"
+        );
+        add_keyword_method(
+            "setParallelPolicy",
+            &Module::setParallelPolicy,
+            "setParallelPolicy([dict], **kwds) -> dict\n"
+            "Change the parallel mode settings and return the previous ones.\n\n"
+            "Accepts the keys returned by getParallelPolicy(). Keys that are not given\n"
+            "keep their value. See PartParallel.policy() to change them for a block of code."
+        );
+        add_keyword_method(
+            "getMassProperties",
+            &Module::getMassProperties,
+            "getMassProperties(items, density=1.0, approximate=False) -> list(dict)\n"
+            "Compute the mass properties of many shapes at once.\n\n"
+            "* items: sequence of shapes or document objects. The density of an object is\n"
+            "         taken from its ShapeMaterial if the material has one.\n"
+            "* density: density of the shapes and of the objects without material density\n"
+            "* approximate: integrate over the triangulation of faces that have one\n\n"
+            "Each dict has the keys Dimension (3 for solids, 2 for faces, 1 for edges),\n"
+            "Volume, Area or Length depending on the dimension, Mass, CenterOfMass and\n"
+            "MatrixOfInertia. The shapes are handled in parallel unless disabled by\n"
+            "setParallelPolicy(MassProperties=False)."
+        );
         initialize("This is a module working with shapes.");  // register with Python
 
         PyModule_AddObject(m_module, "BRepFeat", brepFeat.module().ptr());
@@ -2795,6 +2828,148 @@ private:
         }
         return Py::String(subname);
     }
+
+    static Py::Dict parallelPolicyToPython(const ParallelPolicy::Settings& settings)
+    {
+        Py::Dict dict;
+        dict.setItem("ThreadCount", Py::Long(settings.threads));
+        for (std::size_t i = 0; i < ParallelPolicy::AlgorithmCount; ++i) {
+            auto algorithm = static_cast<ParallelPolicy::Algorithm>(i);
+            dict.setItem(ParallelPolicy::algorithmName(algorithm), Py::Boolean(settings.enabled[i]));
+        }
+        return dict;
+    }
+
+    static double getMaterialDensity(App::DocumentObject* obj, double defaultDensity)
+    {
+        auto feature = freecad_cast<Part::Feature*>(obj->getLinkedObject(true));
+        if (!feature) {
+            return defaultDensity;
+        }
+        const auto& material = feature->ShapeMaterial.getValue();
+        if (!material.hasPhysicalProperty(QStringLiteral("Density"))) {
+            return defaultDensity;
+        }
+        try {
+            double density = material.getPhysicalQuantity(QStringLiteral("Density")).getValue();
+            return density > 0.0 ? density : defaultDensity;
+        }
+        catch (const Base::Exception&) {
+            return defaultDensity;
+        }
+    }
+
+    Py::Object getMassProperties(const Py::Tuple& args, const Py::Dict& kwds)
+    {
+        PyObject* pyItems;
+        double density = 1.0;
+        PyObject* approximate = Py_False;
+        static const std::array<const char*, 4> kwd_list {"items", "density", "approximate", nullptr};
+        if (!Base::Wrapped_ParseTupleAndKeywords(
+                args.ptr(),
+                kwds.ptr(),
+                "O|dO!",
+                kwd_list,
+                &pyItems,
+                &density,
+                &PyBool_Type,
+                &approximate
+            )) {
+            throw Py::Exception();
+        }
+
+        std::vector<TopoDS_Shape> shapes;
+        std::vector<double> densities;
+        Py::Sequence items(pyItems);
+        shapes.reserve(items.size());
+        densities.reserve(items.size());
+        for (Py_ssize_t i = 0; i < items.size(); ++i) {
+            Py::Object item(items[i]);
+            if (PyObject_TypeCheck(item.ptr(), &TopoShapePy::Type)) {
+                shapes.push_back(static_cast<TopoShapePy*>(item.ptr())->getTopoShapePtr()->getShape());
+                densities.push_back(density);
+            }
+            else if (PyObject_TypeCheck(item.ptr(), &App::DocumentObjectPy::Type)) {
+                auto obj = static_cast<App::DocumentObjectPy*>(item.ptr())->getDocumentObjectPtr();
+                shapes.push_back(
+                    Feature::getShape(obj, ShapeOption::ResolveLink | ShapeOption::Transform)
+                );
+                densities.push_back(getMaterialDensity(obj, density));
+            }
+            else {
+                throw Py::TypeError("Expect a sequence of shapes or document objects");
+            }
+        }
+
+        std::vector<MassProperties> results;
+        {
+            Base::PyGILStateRelease unlock;
+            results = MassProperties::compute(shapes, densities, Base::asBoolean(approximate));
+        }
+
+        static const std::array<const char*, 4> sizeNames {nullptr, "Length", "Area", "Volume"};
+        Py::List list;
+        for (const auto& props : results) {
+            Py::Dict dict;
+            dict.setItem("Dimension", Py::Long(props.dimension));
+            if (props.dimension > 0) {
+                dict.setItem(sizeNames[props.dimension], Py::Float(props.size));
+            }
+            dict.setItem("Mass", Py::Float(props.mass));
+            dict.setItem("CenterOfMass", Py::Vector(props.centerOfMass));
+            dict.setItem("MatrixOfInertia", Py::Matrix(props.matrixOfInertia));
+            list.append(dict);
+        }
+        return list;
+    }
+
+    Py::Object getParallelPolicy(const Py::Tuple& args)
+    {
+        if (!PyArg_ParseTuple(args.ptr(), "")) {
+            throw Py::Exception();
+        }
+        return parallelPolicyToPython(ParallelPolicy::getSettings());
+    }
+
+    Py::Object setParallelPolicy(const Py::Tuple& args, const Py::Dict& kwds)
+    {
+        PyObject* pyDict = nullptr;
+        if (!PyArg_ParseTuple(args.ptr(), "|O!", &PyDict_Type, &pyDict)) {
+            throw Py::Exception();
+        }
+        // copy, so that the argument is not modified
+        Py::Dict values(pyDict ? PyDict_Copy(pyDict) : PyDict_New(), true);
+        Py::Dict keywords(kwds);
+        for (Py::Dict::iterator it = keywords.begin(); it != keywords.end(); ++it) {
+            values.setItem((*it).first, Py::Object((*it).second.ptr()));
+        }
+
+        auto oldSettings = ParallelPolicy::getSettings();
+        auto settings = oldSettings;
+        for (Py::Dict::iterator it = values.begin(); it != values.end(); ++it) {
+            std::string key = Py::String((*it).first).as_std_string();
+            Py::Object value((*it).second.ptr());
+            if (key == "ThreadCount") {
+                settings.threads = static_cast<int>(Py::Long(value));
+                if (settings.threads < 0) {
+                    throw Py::ValueError("ThreadCount must not be negative");
+                }
+                continue;
+            }
+            std::size_t i = 0;
+            for (; i < ParallelPolicy::AlgorithmCount; ++i) {
+                if (key == ParallelPolicy::algorithmName(static_cast<ParallelPolicy::Algorithm>(i))) {
+                    settings.enabled[i] = Py::Boolean(value);
+                    break;
+                }
+            }
+            if (i == ParallelPolicy::AlgorithmCount) {
+                throw Py::KeyError("Unknown parallel policy key '" + key + "'");
+            }
+        }
+        ParallelPolicy::setSettings(settings);
+        return parallelPolicyToPython(oldSettings);
+    }
 };
 
 PyObject* initModule()
@@ -87,8 +87,72 @@ void restoreAttacherEngine(AttachExtension* self)
         self->AttacherEngine.setValue(classToEnum(type));
     }
 }
+
+// The state of an attachment reference that determines the attached placement
+struct SupportState
+{
+    App::DocumentObject* object = nullptr;
+    Base::Matrix4D transform;
+    TopoDS_Shape shape;
+
+    bool operator==(const SupportState& other) const
+    {
+        return object == other.object && transform == other.transform
+            && shape.IsEqual(other.shape);
+    }
+};
+
+// Reads the state of the references of the attacher. Returns false if a reference cannot be
+// tracked without resolving its sub-shape, in which case the placement must be calculated.
+bool readSupportStates(const AttachEngine& attacher, std::vector<SupportState>& states)
+{
+    std::vector<App::DocumentObject*> objs;
+    try {
+        objs = attacher.getRefObjects();
+    }
+    catch (Base::Exception&) {
+        return false;
+    }
+
+    states.resize(objs.size());
+    for (std::size_t i = 0; i < objs.size(); i++) {
+        SupportState& state = states[i];
+        auto sobj = objs[i]->getSubObject(attacher.subnames[i].c_str(), nullptr, &state.transform);
+        auto linked = sobj ? sobj->getLinkedObject(true) : nullptr;
+        if (!linked) {
+            return false;
+        }
+        // a new shape is assigned to the Shape property on every recompute, the geometry of the
+        // datums is given by their placement
+        if (auto feature = dynamic_cast<Part::Feature*>(linked)) {
+            state.shape = feature->Shape.getValue();
+        }
+        else if (!linked->isDerivedFrom<App::DatumElement>()
+                 && !linked->isDerivedFrom<App::LocalCoordinateSystem>()) {
+            return false;
+        }
+        state.object = linked;
+    }
+    return true;
+}
+
+bool sameParameters(const AttachEngine& a, const AttachEngine& b)
+{
+    return a.getTypeId() == b.getTypeId() && a.docName == b.docName && a.objNames == b.objNames
+        && a.subnames == b.subnames && a.shadowSubs == b.shadowSubs && a.mapMode == b.mapMode
+        && a.mapReverse == b.mapReverse && a.attachParameter == b.attachParameter
+        && a.surfU == b.surfU && a.surfV == b.surfV && a.precision == b.precision;
+}
 }  // namespace
 
+struct AttachExtension::AttachmentCache
+{
+    std::unique_ptr<AttachEngine> attacher;
+    std::vector<SupportState> supports;
+    Base::Placement offset;
+    Base::Placement placement;
+};
+
 EXTENSION_PROPERTY_SOURCE(Part::AttachExtension, App::DocumentObjectExtension)
 
 AttachExtension::AttachExtension()
@@ -174,8 +238,7 @@ AttachExtension::AttachExtension()
     initExtensionType(AttachExtension::getExtensionClassTypeId());
 }
 
-AttachExtension::~AttachExtension()
-{}
+AttachExtension::~AttachExtension() = default;
 
 template<class T>
 static inline bool getProp(
@@ -349,6 +412,28 @@ bool AttachExtension::positionBySupport()
         if (_props.attacher->mapMode == mmDeactivated) {
             return false;
         }
+        // Apart from the mode Translate, the attacher applies the offset last. So the placement
+        // only needs to be calculated again if the attachment or one of the supports changed.
+        std::vector<SupportState> supports;
+        bool cacheable = _props.attacher->mapMode != mmTranslate
+            && (!_baseProps.attacher || _baseProps.attacher->mapMode == mmDeactivated)
+            && readSupportStates(*_props.attacher, supports);
+        if (!cacheable) {
+            _cache.reset();
+        }
+        else if (_cache && _cache->supports == supports
+                 && sameParameters(*_cache->attacher, *_props.attacher)) {
+            Base::Placement placement = _cache->placement;
+            if (_cache->offset != AttachmentOffset.getValue()) {
+                placement = placement * _cache->offset.inverse() * AttachmentOffset.getValue();
+            }
+            if (placement != plaOriginal) {
+                getPlacement().setValue(placement);
+            }
+            _active = 1;
+            return true;
+        }
+
         bool subChanged = false;
 
         getPlacement().setValue(Base::Placement());
@@ -376,19 +461,31 @@ bool AttachExtension::positionBySupport()
             AttachmentSupport.setValues(AttachmentSupport.getValues(), _props.attacher->getSubValues());
         }
         getPlacement().setValue(placement);
+        if (cacheable) {
+            if (!_cache) {
+                _cache = std::make_unique<AttachmentCache>();
+            }
+            _cache->attacher.reset(_props.attacher->copy());
+            _cache->supports = std::move(supports);
+            _cache->offset = AttachmentOffset.getValue();
+            _cache->placement = placement;
+        }
         _active = 1;
         return true;
     }
     catch (ExceptionCancel&) {
         // disabled, don't do anything
+        _cache.reset();
         getPlacement().setValue(plaOriginal);
         return false;
     }
     catch (Base::Exception&) {
+        _cache.reset();
         getPlacement().setValue(plaOriginal);
         throw;
     }
     catch (Standard_Failure&) {
+        _cache.reset();
         getPlacement().setValue(plaOriginal);
         throw;
     }
@@ -166,6 +166,11 @@ private:
     _Properties _baseProps;
 
     mutable int _active = -1;
+
+    // The last calculated placement together with the attachment parameters and the state of the
+    // supports it was calculated from, see positionBySupport()
+    struct AttachmentCache;
+    std::unique_ptr<AttachmentCache> _cache;
 };
 
 
@@ -23,7 +23,16 @@
  ***************************************************************************/
 
 #include <algorithm>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <QThreadPool>
+#include <QtConcurrentMap>
+#include <Bnd_Box.hxx>
 #include <BRepAdaptor_Surface.hxx>
+#include <BRepBndLib.hxx>
 #include <Mod/Part/App/FCBRepAlgoAPI_Common.h>
 #include <Mod/Part/App/FCBRepAlgoAPI_Cut.h>
 #include <Mod/Part/App/FCBRepAlgoAPI_Section.h>
@@ -44,11 +53,67 @@
 
 
 #include "CrossSection.h"
+#include "ParallelPolicy.h"
 #include "TopoShapeOpCode.h"
 
 
 using namespace Part;
 
+namespace
+{
+
+// Return the range of n * p of the points p of the shape, n = (a, b, c)
+std::pair<double, double> getExtent(const TopoDS_Shape& shape, double a, double b, double c)
+{
+    Bnd_Box box;
+    BRepBndLib::Add(shape, box);
+    if (box.IsVoid() || box.IsOpen()) {
+        return {-std::numeric_limits<double>::max(), std::numeric_limits<double>::max()};
+    }
+    double xmin, ymin, zmin, xmax, ymax, zmax;
+    box.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+    double min = std::min(a * xmin, a * xmax) + std::min(b * ymin, b * ymax)
+        + std::min(c * zmin, c * zmax);
+    double max = std::max(a * xmin, a * xmax) + std::max(b * ymin, b * ymax)
+        + std::max(c * zmin, c * zmax);
+    double tol = Precision::Confusion() * (std::abs(a) + std::abs(b) + std::abs(c));
+    return {min - tol, max + tol};
+}
+
+// Call func for the indices 0 to count - 1, concurrently if parallel booleans are enabled.
+// The first exception thrown by func is rethrown when all calls are done.
+template<typename Func>
+void forEachIndex(std::size_t count, Func func)
+{
+    if (count < 2 || !ParallelPolicy::isEnabled(ParallelPolicy::Algorithm::Boolean)) {
+        for (std::size_t i = 0; i < count; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    std::vector<std::size_t> indices(count);
+    std::iota(indices.begin(), indices.end(), 0);
+    std::mutex mutex;
+    std::exception_ptr error;
+    QtConcurrent::blockingMap(indices, [&](std::size_t i) {
+        try {
+            func(i);
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    });
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+}  // namespace
+
 CrossSection::CrossSection(double a, double b, double c, const TopoDS_Shape& s)
     : a(a)
     , b(b)
@@ -58,18 +123,51 @@ CrossSection::CrossSection(double a, double b, double c, const TopoDS_Shape& s)
 
 std::list<TopoDS_Wire> CrossSection::slice(double d) const
 {
-    std::list<TopoDS_Wire> wires;
+    return slices({d}).front();
+}
+
+std::vector<std::list<TopoDS_Wire>> CrossSection::slices(const std::vector<double>& d) const
+{
     // Fixes: 0001228: Cross section of Torus in Part Workbench fails or give wrong results
     // Fixes: 0001137: Incomplete slices when using Part.slice on a torus
-    TopExp_Explorer xp;
-    for (xp.Init(s, TopAbs_SOLID); xp.More(); xp.Next()) {
-        sliceSolid(d, xp.Current(), wires);
+    auto solids = getPieces(TopAbs_SOLID, TopAbs_SHAPE);
+    auto others = getPieces(TopAbs_SHELL, TopAbs_SOLID);
+    auto faces = getPieces(TopAbs_FACE, TopAbs_SHELL);
+    others.insert(others.end(), faces.begin(), faces.end());
+
+    std::vector<std::list<TopoDS_Wire>> wires(d.size());
+    forEachIndex(d.size(), [&](std::size_t i) {
+        wires[i] = slice(d[i], solids, others);
+    });
+    return wires;
+}
+
+std::vector<CrossSection::Piece> CrossSection::getPieces(TopAbs_ShapeEnum type,
+                                                         TopAbs_ShapeEnum avoid) const
+{
+    std::vector<Piece> pieces;
+    for (TopExp_Explorer xp(s, type, avoid); xp.More(); xp.Next()) {
+        auto extent = getExtent(xp.Current(), a, b, c);
+        pieces.push_back({xp.Current(), extent.first, extent.second});
     }
-    for (xp.Init(s, TopAbs_SHELL, TopAbs_SOLID); xp.More(); xp.Next()) {
-        sliceNonSolid(d, xp.Current(), wires);
+    return pieces;
+}
+
+std::list<TopoDS_Wire> CrossSection::slice(double d,
+                                           const std::vector<Piece>& solids,
+                                           const std::vector<Piece>& others) const
+{
+    // pieces not reaching the plane can't contribute to the section
+    std::list<TopoDS_Wire> wires;
+    for (const auto& piece : solids) {
+        if (piece.min <= d && d <= piece.max) {
+            sliceSolid(d, piece.shape, wires);
+        }
     }
-    for (xp.Init(s, TopAbs_FACE, TopAbs_SHELL); xp.More(); xp.Next()) {
-        sliceNonSolid(d, xp.Current(), wires);
+    for (const auto& piece : others) {
+        if (piece.min <= d && d <= piece.max) {
+            sliceNonSolid(d, piece.shape, wires);
+        }
     }
 
     return removeDuplicates(wires);
@@ -240,26 +338,21 @@ TopoCrossSection::TopoCrossSection(double a, double b, double c, const TopoShape
     , op(op ? op : Part::OpCodes::Slice)
 {}
 
+struct TopoCrossSection::Section
+{
+    const TopoShape* piece {nullptr};
+    gp_Pln plane;
+    // slicing a solid
+    std::unique_ptr<BRepBuilderAPI_MakeFace> mkFace;
+    std::unique_ptr<BRepPrimAPI_MakeHalfSpace> mkSolid;
+    std::unique_ptr<FCBRepAlgoAPI_Cut> mkCut;
+    // slicing a shell or face
+    std::unique_ptr<FCBRepAlgoAPI_Section> mkSection;
+};
+
 void TopoCrossSection::slice(int idx, double d, std::vector<TopoShape>& wires) const
 {
-    // Fixes: 0001228: Cross section of Torus in Part Workbench fails or give wrong results
-    // Fixes: 0001137: Incomplete slices when using Part.slice on a torus
-    bool found = false;
-    for (auto& s : shape.getSubTopoShapes(TopAbs_SOLID)) {
-        sliceSolid(idx, d, s, wires);
-        found = true;
-    }
-    if (!found) {
-        for (auto& s : shape.getSubTopoShapes(TopAbs_SHELL)) {
-            sliceNonSolid(idx, d, s, wires);
-            found = true;
-        }
-        if (!found) {
-            for (auto& s : shape.getSubTopoShapes(TopAbs_FACE)) {
-                sliceNonSolid(idx, d, s, wires);
-            }
-        }
-    }
+    slices(idx, {d}, wires);
 }
 
 TopoShape TopoCrossSection::slice(int idx, double d) const
@@ -270,36 +363,79 @@ TopoShape TopoCrossSection::slice(int idx, double d) const
         .makeElementCompound(wires, 0, TopoShape::SingleShapeCompoundCreationPolicy::returnShape);
 }
 
-void TopoCrossSection::sliceNonSolid(
-    int idx,
-    double d,
-    const TopoShape& shape,
-    std::vector<TopoShape>& wires
-) const
+void TopoCrossSection::slices(int startIdx,
+                              const std::vector<double>& d,
+                              std::vector<TopoShape>& wires) const
 {
-    FCBRepAlgoAPI_Section cs(shape.getShape(), gp_Pln(a, b, c, -d));
-    if (cs.IsDone()) {
-        std::string prefix(op);
-        prefix += Data::indexSuffix(idx);
-        auto res = TopoShape()
-                       .makeElementShape(cs, shape, prefix.c_str())
-                       .makeElementWires()
-                       .getSubTopoShapes(TopAbs_WIRE);
-        wires.insert(wires.end(), res.begin(), res.end());
+    auto pieces = getPieces();
+
+    // The sections are computed concurrently in batches of planes, which keeps the memory of
+    // the pending algorithms bounded. The naming then runs on this thread in plane order.
+    auto batchSize = static_cast<std::size_t>(
+        std::max(1, 4 * QThreadPool::globalInstance()->maxThreadCount())
+    );
+    std::vector<std::pair<std::size_t, const Piece*>> tasks;
+    std::vector<std::unique_ptr<Section>> sections;
+    for (std::size_t first = 0; first < d.size(); first += batchSize) {
+        tasks.clear();
+        for (std::size_t i = first; i < std::min(d.size(), first + batchSize); ++i) {
+            for (const auto& piece : pieces) {
+                // pieces not reaching the plane can't contribute to the section
+                if (piece.min <= d[i] && d[i] <= piece.max) {
+                    tasks.emplace_back(i, &piece);
+                }
+            }
+        }
+
+        sections.clear();
+        sections.resize(tasks.size());
+        forEachIndex(tasks.size(), [&](std::size_t k) {
+            const auto& task = tasks[k];
+            sections[k] = makeSection(d[task.first], task.second->shape, task.second->solid);
+        });
+
+        for (std::size_t k = 0; k < tasks.size(); ++k) {
+            nameSection(startIdx + static_cast<int>(tasks[k].first), *sections[k], wires);
+        }
     }
 }
 
-void TopoCrossSection::sliceSolid(
-    int idx,
-    double d,
-    const TopoShape& shape,
-    std::vector<TopoShape>& wires
-) const
+std::vector<TopoCrossSection::Piece> TopoCrossSection::getPieces() const
 {
-    gp_Pln slicePlane(a, b, c, -d);
-    BRepBuilderAPI_MakeFace mkFace(slicePlane);
-    TopoShape face(idx);
-    face.setShape(mkFace.Face());
+    // Fixes: 0001228: Cross section of Torus in Part Workbench fails or give wrong results
+    // Fixes: 0001137: Incomplete slices when using Part.slice on a torus
+    bool solid = true;
+    auto shapes = shape.getSubTopoShapes(TopAbs_SOLID);
+    if (shapes.empty()) {
+        solid = false;
+        shapes = shape.getSubTopoShapes(TopAbs_SHELL);
+        if (shapes.empty()) {
+            shapes = shape.getSubTopoShapes(TopAbs_FACE);
+        }
+    }
+
+    std::vector<Piece> pieces;
+    pieces.reserve(shapes.size());
+    for (auto& s : shapes) {
+        auto extent = getExtent(s.getShape(), a, b, c);
+        pieces.push_back({std::move(s), solid, extent.first, extent.second});
+    }
+    return pieces;
+}
+
+std::unique_ptr<TopoCrossSection::Section>
+TopoCrossSection::makeSection(double d, const TopoShape& piece, bool solid) const
+{
+    auto section = std::make_unique<Section>();
+    section->piece = &piece;
+    section->plane = gp_Pln(a, b, c, -d);
+    if (!solid) {
+        section->mkSection = std::make_unique<FCBRepAlgoAPI_Section>(piece.getShape(),
+                                                                     section->plane);
+        return section;
+    }
+
+    section->mkFace = std::make_unique<BRepBuilderAPI_MakeFace>(section->plane);
 
     // Make sure to choose a point that does not lie on the plane (fixes #0001228)
     gp_Vec tempVector(a, b, c);
@@ -308,19 +444,44 @@ void TopoCrossSection::sliceSolid(
     gp_Pnt refPoint(0.0, 0.0, 0.0);
     refPoint.Translate(tempVector);
 
-    BRepPrimAPI_MakeHalfSpace mkSolid(TopoDS::Face(face.getShape()), refPoint);
-    TopoShape solid(idx);
+    section->mkSolid = std::make_unique<BRepPrimAPI_MakeHalfSpace>(section->mkFace->Face(),
+                                                                   refPoint);
+    section->mkCut = std::make_unique<FCBRepAlgoAPI_Cut>(piece.getShape(),
+                                                         section->mkSolid->Solid());
+    return section;
+}
+
+void TopoCrossSection::nameSection(int idx,
+                                   const Section& section,
+                                   std::vector<TopoShape>& wires) const
+{
+    const TopoShape& piece = *section.piece;
     std::string prefix(op);
     prefix += Data::indexSuffix(idx);
-    solid.makeElementShape(mkSolid, face, prefix.c_str());
-    FCBRepAlgoAPI_Cut mkCut(shape.getShape(), solid.getShape());
 
-    if (mkCut.IsDone()) {
-        TopoShape res(shape.Tag, shape.Hasher);
+    if (section.mkSection) {
+        if (section.mkSection->IsDone()) {
+            auto res = TopoShape()
+                           .makeElementShape(*section.mkSection, piece, prefix.c_str())
+                           .makeElementWires()
+                           .getSubTopoShapes(TopAbs_WIRE);
+            wires.insert(wires.end(), res.begin(), res.end());
+        }
+        return;
+    }
+
+    TopoShape face(idx);
+    face.setShape(section.mkFace->Face());
+    TopoShape solid(idx);
+    solid.makeElementShape(*section.mkSolid, face, prefix.c_str());
+
+    if (section.mkCut->IsDone()) {
+        const gp_Pln& slicePlane = section.plane;
+        TopoShape res(piece.Tag, piece.Hasher);
         std::vector<TopoShape> shapes;
-        shapes.push_back(shape);
+        shapes.push_back(piece);
         shapes.push_back(solid);
-        res.makeElementShape(mkCut, shapes, prefix.c_str());
+        res.makeElementShape(*section.mkCut, shapes, prefix.c_str());
         for (auto& face : res.getSubTopoShapes(TopAbs_FACE)) {
             BRepAdaptor_Surface adapt(TopoDS::Face(face.getShape()));
             if (adapt.GetType() == GeomAbs_Plane) {
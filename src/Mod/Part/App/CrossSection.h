@@ -25,6 +25,9 @@
 #pragma once
 
 #include <list>
+#include <memory>
+#include <utility>
+#include <vector>
 #include <TopTools_IndexedMapOfShape.hxx>
 #include <Mod/Part/PartGlobal.h>
 #include "TopoShape.h"
@@ -41,8 +44,21 @@ class PartExport CrossSection
 public:
     CrossSection(double a, double b, double c, const TopoDS_Shape& s);
     std::list<TopoDS_Wire> slice(double d) const;
+    /// Slice the shape with the planes at the distances \a d, the planes are sliced concurrently
+    std::vector<std::list<TopoDS_Wire>> slices(const std::vector<double>& d) const;
 
 private:
+    /// A solid, shell or face of the shape and its extent along the plane normal
+    struct Piece
+    {
+        TopoDS_Shape shape;
+        double min;
+        double max;
+    };
+    std::vector<Piece> getPieces(TopAbs_ShapeEnum type, TopAbs_ShapeEnum avoid) const;
+    std::list<TopoDS_Wire> slice(double d,
+                                 const std::vector<Piece>& solids,
+                                 const std::vector<Piece>& others) const;
     void sliceNonSolid(double d, const TopoDS_Shape&, std::list<TopoDS_Wire>& wires) const;
     void sliceSolid(double d, const TopoDS_Shape&, std::list<TopoDS_Wire>& wires) const;
     void connectEdges(const std::list<TopoDS_Edge>& edges, std::list<TopoDS_Wire>& wires) const;
@@ -61,10 +77,27 @@ public:
     TopoCrossSection(double a, double b, double c, const TopoShape& s, const char* op = 0);
     void slice(int idx, double d, std::vector<TopoShape>& wires) const;
     TopoShape slice(int idx, double d) const;
+    /** Slice the shape with the planes at the distances \a d and append the wires to \a wires
+     *
+     * The OCCT algorithms of the planes run concurrently, the element names of the wires of
+     * the plane d[i] are assigned afterwards with the index \a startIdx + i.
+     */
+    void slices(int startIdx, const std::vector<double>& d, std::vector<TopoShape>& wires) const;
 
 private:
-    void sliceNonSolid(int idx, double d, const TopoShape&, std::vector<TopoShape>& wires) const;
-    void sliceSolid(int idx, double d, const TopoShape&, std::vector<TopoShape>& wires) const;
+    /// A solid, shell or face of the shape and its extent along the plane normal
+    struct Piece
+    {
+        TopoShape shape;
+        bool solid;
+        double min;
+        double max;
+    };
+    /// The OCCT algorithms slicing one piece with one plane
+    struct Section;
+    std::vector<Piece> getPieces() const;
+    std::unique_ptr<Section> makeSection(double d, const TopoShape& piece, bool solid) const;
+    void nameSection(int idx, const Section& section, std::vector<TopoShape>& wires) const;
 
 private:
     double a, b, c;
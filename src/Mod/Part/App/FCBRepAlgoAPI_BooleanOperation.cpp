@@ -35,11 +35,13 @@
 #include <TopoDS_Iterator.hxx>
 #include <Precision.hxx>
 #include <FuzzyHelper.h>
+#include <ParallelPolicy.h>
+#include <App/RecomputeStats.h>
 #include <Base/Console.h>
 
 FCBRepAlgoAPI_BooleanOperation::FCBRepAlgoAPI_BooleanOperation()
 {
-    SetRunParallel(Standard_True);
+    SetRunParallel(ParallelPolicy::useParallel(ParallelPolicy::Algorithm::Boolean));
     SetNonDestructive(Standard_True);
 }
 
@@ -60,7 +62,7 @@ FCBRepAlgoAPI_BooleanOperation::FCBRepAlgoAPI_BooleanOperation(
     }
 
     setAutoFuzzy();
-    SetRunParallel(Standard_True);
+    SetRunParallel(ParallelPolicy::useParallel(ParallelPolicy::Algorithm::Boolean));
     SetNonDestructive(Standard_True);
 }
 
@@ -95,6 +97,17 @@ void FCBRepAlgoAPIHelper::setAutoFuzzy(BRepAlgoAPI_BuilderAlgo* op)
     );
 }
 
+void FCBRepAlgoAPIHelper::setAutoFuzzy(BOPAlgo_Builder* op)
+{
+    Bnd_Box bounds;
+    for (TopTools_ListOfShape::Iterator it(op->Arguments()); it.More(); it.Next()) {
+        BRepBndLib::Add(it.Value(), bounds);
+    }
+    op->SetFuzzyValue(
+        Part::FuzzyHelper::getBooleanFuzzy() * sqrt(bounds.SquareExtent()) * Precision::Confusion()
+    );
+}
+
 void FCBRepAlgoAPI_BooleanOperation::Build()
 {
     Message_ProgressRange progressRange;
@@ -103,6 +116,7 @@ void FCBRepAlgoAPI_BooleanOperation::Build()
 
 void FCBRepAlgoAPI_BooleanOperation::Build(const Message_ProgressRange& progressRange)
 {
+    App::RecomputeStats::ScopedTimer timer(App::RecomputeStats::Category::Occ);
     if (progressRange.UserBreak()) {
         Standard_ConstructionError::Raise("User aborted");
     }
@@ -28,6 +28,7 @@
 
 #pragma once
 
+#include <BOPAlgo_Builder.hxx>
 #include <BRepAlgoAPI_BooleanOperation.hxx>
 #include <Message_ProgressRange.hxx>
 
@@ -36,6 +37,7 @@ class FCBRepAlgoAPIHelper
 public:
     static void setAutoFuzzy(BRepAlgoAPI_BooleanOperation* op);
     static void setAutoFuzzy(BRepAlgoAPI_BuilderAlgo* op);
+    static void setAutoFuzzy(BOPAlgo_Builder* op);
 };
 
 class FCBRepAlgoAPI_BooleanOperation: public BRepAlgoAPI_BooleanOperation
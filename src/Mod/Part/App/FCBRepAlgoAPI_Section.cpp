@@ -33,10 +33,11 @@
 #include <TopoDS_Shape.hxx>
 #include <Precision.hxx>
 #include <FuzzyHelper.h>
+#include <ParallelPolicy.h>
 
 FCBRepAlgoAPI_Section::FCBRepAlgoAPI_Section()
 {
-    SetRunParallel(Standard_True);
+    SetRunParallel(ParallelPolicy::useParallel(ParallelPolicy::Algorithm::Boolean));
     SetNonDestructive(Standard_True);
 }
 
@@ -54,7 +55,7 @@ FCBRepAlgoAPI_Section::FCBRepAlgoAPI_Section(
         Standard_ConstructionError::Raise("Tool shape is not valid for boolean operation");
     }
     setAutoFuzzy();
-    SetRunParallel(Standard_True);
+    SetRunParallel(ParallelPolicy::useParallel(ParallelPolicy::Algorithm::Boolean));
     SetNonDestructive(Standard_True);
     if (PerformNow) {
         Build();
@@ -72,7 +73,7 @@ FCBRepAlgoAPI_Section::FCBRepAlgoAPI_Section(
         Standard_ConstructionError::Raise("Base shape is not valid for boolean operation");
     }
     setAutoFuzzy();
-    SetRunParallel(Standard_True);
+    SetRunParallel(ParallelPolicy::useParallel(ParallelPolicy::Algorithm::Boolean));
     if (PerformNow) {
         Build();
     }
@@ -22,6 +22,8 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
+
 #include <BRep_Builder.hxx>
 #include <BRep_Tool.hxx>
 #include <BRepAdaptor_Surface.hxx>
@@ -196,6 +198,9 @@ FaceMakerBullseye::FaceDriller::FaceDriller(const gp_Pln& plane, TopoDS_Wire out
     builder.MakeFace(this->myFace, myHPlane, Precision::Confusion());
     builder.Add(this->myFace, outerWire);
     this->myTopoFace = TopoShape(this->myFace);
+
+    BRepBndLib::Add(outerWire, myBound, Standard_False);
+    myBound.Enlarge(Precision::Confusion());
 }
 
 FaceMakerBullseye::FaceDriller::HitTest FaceMakerBullseye::FaceDriller::hitTest(
@@ -203,6 +208,18 @@ FaceMakerBullseye::FaceDriller::HitTest FaceMakerBullseye::FaceDriller::hitTest(
 ) const
 {
     auto vertex = TopoDS::Vertex(shape.getSubShape(TopAbs_VERTEX, 1));
+    double tol = BRep_Tool::Tolerance(vertex);
+    auto point = BRep_Tool::Pnt(vertex);
+
+    // a point out of the bounding box of the outer wire can neither be on nor in the face
+    auto isOut = [&point, tol](Bnd_Box box) {
+        box.Enlarge(tol);
+        return box.IsOut(point);
+    };
+    if (isOut(myBound)) {
+        return HitTest::HitNone;
+    }
+
     if (!myFaceBound.IsNull()) {
         if (myTopoFaceBound.findShape(vertex) > 0) {
             return HitTest::HitNone;
@@ -217,8 +234,6 @@ FaceMakerBullseye::FaceDriller::HitTest FaceMakerBullseye::FaceDriller::hitTest(
         return HitTest::HitNone;
     }
 
-    double tol = BRep_Tool::Tolerance(vertex);
-    auto point = BRep_Tool::Pnt(vertex);
     double u, v;
     GeomAPI_ProjectPointOnSurf(point, myHPlane).LowerDistanceParameters(u, v);
     const char* err = "FaceMakerBullseye::FaceDriller::hitTest: result unknown";
@@ -235,6 +250,12 @@ FaceMakerBullseye::FaceDriller::HitTest FaceMakerBullseye::FaceDriller::hitTest(
             default:
                 throw Base::ValueError(err);
         }
+
+        // inside the outer wire and out of the bounding box of every hole, so inside the face.
+        // Classifying against the face itself costs time proportional to the number of holes.
+        if (std::all_of(myHoleBounds.begin(), myHoleBounds.end(), isOut)) {
+            return HitTest::Hit;
+        }
     }
     BRepClass_FaceClassifier cl(myFace, gp_Pnt2d(u, v), tol);
     TopAbs_State ret = cl.State();
@@ -278,6 +299,10 @@ void FaceMakerBullseye::FaceDriller::addHole(TopoDS_Wire w)
         copyFaceBound(this->myFaceBound, this->myTopoFaceBound, this->myTopoFace);
     }
 
+    Bnd_Box bound;
+    BRepBndLib::Add(w, bound, Standard_False);
+    myHoleBounds.push_back(bound);
+
     BRep_Builder builder;
     builder.Add(this->myFace, w);
 }
@@ -303,6 +328,7 @@ void FaceMakerBullseye::FaceDriller::addHole(const WireInfo& wireInfo, std::vect
     }
 
     myHoles.push_back(wireInfo);
+    myHoleBounds.push_back(wireInfo.bound);
     TopoShape wire = wireInfo.wire;
 
     if (intersected) {
@@ -139,6 +139,10 @@ protected:
         TopoShape myTopoFace;
         TopoShape myTopoFaceBound;
         std::vector<WireInfo> myHoles;
+        /// bounding box of the outer wire and of each hole, to skip the classification of the
+        /// points that are clearly outside of the face or clearly not in a hole
+        Bnd_Box myBound;
+        std::vector<Bnd_Box> myHoleBounds;
         Handle(Geom_Surface) myHPlane;
         std::unique_ptr<WireJoiner> myJoiner;
     };
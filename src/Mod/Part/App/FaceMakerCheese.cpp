@@ -23,6 +23,7 @@
  ***************************************************************************/
 
 #include <algorithm>
+#include <memory>
 #include <Bnd_Box.hxx>
 #include <BRep_Builder.hxx>
 #include <BRep_Tool.hxx>
@@ -114,49 +115,75 @@ bool FaceMakerCheese::Wire_Compare::operator()(const TopoDS_Wire& w1, const Topo
     return box1.SquareExtent() < box2.SquareExtent();
 }
 
-bool FaceMakerCheese::isInside(const TopoDS_Wire& wire1, const TopoDS_Wire& wire2)
+namespace
 {
-    Bnd_Box box1;
-    BRepBndLib::Add(wire1, box1);
-    box1.SetGap(0.0);
-
-    Bnd_Box box2;
-    BRepBndLib::Add(wire2, box2);
-    box2.SetGap(0.0);
 
-    if (box1.IsOut(box2)) {
-        return false;
+Bnd_Box wireBound(const TopoDS_Wire& wire)
+{
+    Bnd_Box box;
+    if (!wire.IsNull()) {
+        BRepBndLib::Add(wire, box);
+        box.SetGap(0.0);
     }
+    return box;
+}
 
-    double prec = Precision::Confusion();
+/// Tests which wires are inside of an outer wire. The face and the classifier of the outer wire
+/// are only made once, when the first wire overlapping its bounding box is tested.
+class OuterWireClassifier
+{
+public:
+    OuterWireClassifier(const TopoDS_Wire& outer, const Bnd_Box& outerBound)
+        : outerWire(outer)
+        , bound(outerBound)
+    {}
+
+    bool contains(const TopoDS_Wire& wire, const Bnd_Box& wireBound)
+    {
+        if (bound.IsOut(wireBound)) {
+            return false;
+        }
 
-    BRepBuilderAPI_MakeFace mkFace(wire1);
-    if (!mkFace.IsDone()) {
-        Standard_Failure::Raise("Failed to create a face from wire in sketch");
-    }
-    TopoDS_Face face = validateFace(mkFace.Face());
-    BRepAdaptor_Surface adapt(face);
-    IntTools_FClass2d class2d(face, prec);
-    Handle(Geom_Surface) surf = new Geom_Plane(adapt.Plane());
-    ShapeAnalysis_Surface as(surf);
-
-    TopExp_Explorer xp(wire2, TopAbs_VERTEX);
-    while (xp.More()) {
-        TopoDS_Vertex v = TopoDS::Vertex(xp.Current());
-        gp_Pnt p = BRep_Tool::Pnt(v);
-        gp_Pnt2d uv = as.ValueOfUV(p, prec);
-        if (class2d.Perform(uv) == TopAbs_IN) {
-            return true;
+        double prec = Precision::Confusion();
+
+        if (!classifier) {
+            BRepBuilderAPI_MakeFace mkFace(outerWire);
+            if (!mkFace.IsDone()) {
+                Standard_Failure::Raise("Failed to create a face from wire in sketch");
+            }
+            face = FaceMakerCheese::validateFace(mkFace.Face());
+            BRepAdaptor_Surface adapt(face);
+            classifier = std::make_unique<IntTools_FClass2d>(face, prec);
+            Handle(Geom_Surface) surf = new Geom_Plane(adapt.Plane());
+            surface = new ShapeAnalysis_Surface(surf);
         }
-        // TODO: We can make a check to see if all points are inside or all outside
-        // because otherwise we have some intersections which is not allowed
-        else {
-            return false;
+
+        TopExp_Explorer xp(wire, TopAbs_VERTEX);
+        if (xp.More()) {
+            TopoDS_Vertex v = TopoDS::Vertex(xp.Current());
+            gp_Pnt p = BRep_Tool::Pnt(v);
+            gp_Pnt2d uv = surface->ValueOfUV(p, prec);
+            // TODO: We can make a check to see if all points are inside or all outside
+            // because otherwise we have some intersections which is not allowed
+            return classifier->Perform(uv) == TopAbs_IN;
         }
-        // xp.Next();
+
+        return false;
     }
 
-    return false;
+private:
+    TopoDS_Wire outerWire;
+    Bnd_Box bound;
+    TopoDS_Face face;
+    std::unique_ptr<IntTools_FClass2d> classifier;
+    Handle(ShapeAnalysis_Surface) surface;
+};
+
+}  // namespace
+
+bool FaceMakerCheese::isInside(const TopoDS_Wire& wire1, const TopoDS_Wire& wire2)
+{
+    return OuterWireClassifier(wire1, wireBound(wire1)).contains(wire2, wireBound(wire2));
 }
 
 TopoDS_Shape FaceMakerCheese::makeFace(std::list<TopoDS_Wire>& wires)
@@ -200,25 +227,40 @@ TopoDS_Shape FaceMakerCheese::makeFace(const std::vector<TopoDS_Wire>& w)
         return {};
     }
 
+    // the bounding boxes are computed once, both for sorting and for the inside tests
+    struct BoundedWire
+    {
+        TopoDS_Wire wire;
+        Bnd_Box bound;
+        double extent;
+    };
+    std::vector<BoundedWire> wires;
+    wires.reserve(w.size());
+    for (const auto& wire : w) {
+        Bnd_Box bound = wireBound(wire);
+        wires.push_back({wire, bound, bound.SquareExtent()});
+    }
+
     // FIXME: Need a safe method to sort wire that the outermost one comes last
     //  Currently it's done with the diagonal lengths of the bounding boxes
-    std::vector<TopoDS_Wire> wires = w;
-    std::sort(wires.begin(), wires.end(), Wire_Compare());
-    std::list<TopoDS_Wire> wire_list;
+    std::sort(wires.begin(), wires.end(), [](const BoundedWire& w1, const BoundedWire& w2) {
+        return w1.extent < w2.extent;
+    });
+    std::list<BoundedWire> wire_list;
     wire_list.insert(wire_list.begin(), wires.rbegin(), wires.rend());
 
     // separate the wires into several independent faces
     std::list<std::list<TopoDS_Wire>> sep_wire_list;
     while (!wire_list.empty()) {
         std::list<TopoDS_Wire> sep_list;
-        TopoDS_Wire wire = wire_list.front();
+        OuterWireClassifier outer(wire_list.front().wire, wire_list.front().bound);
+        sep_list.push_back(wire_list.front().wire);
         wire_list.pop_front();
-        sep_list.push_back(wire);
 
-        std::list<TopoDS_Wire>::iterator it = wire_list.begin();
+        auto it = wire_list.begin();
         while (it != wire_list.end()) {
-            if (isInside(wire, *it)) {
-                sep_list.push_back(*it);
+            if (outer.contains(it->wire, it->bound)) {
+                sep_list.push_back(it->wire);
                 it = wire_list.erase(it);
             }
             else {
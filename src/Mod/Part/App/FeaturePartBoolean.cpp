@@ -165,6 +165,9 @@ App::DocumentObjectExecReturn* Boolean::execute()
 
         throwIfInvalidIfCheckModel(resShape);
 
+        // Names are generated on first access, which is often never for
+        // results that get refined or recomputed again before being saved
+        TopoShape::LazyElementMap lazyElementMap;
         TopoShape res(0);
         res.makeElementShape(*mkBool, shapes, opCode());
         if (this->Refine.getValue()) {
@@ -53,6 +53,14 @@ public:
     /// recalculate the Feature
     App::DocumentObjectExecReturn* execute() override;
     short mustExecute() const override;
+    bool isRecomputeCacheable() const override
+    {
+        return true;
+    }
+    bool isExecuteGILFree() const override
+    {
+        return true;
+    }
     //@}
 
     /// returns the type name of the ViewProvider
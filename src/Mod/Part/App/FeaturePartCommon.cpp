@@ -143,12 +143,9 @@ App::DocumentObjectExecReturn* MultiCommon::execute()
             }
         }
 
-        res = shapes.front();
-
-        // to achieve common of all shapes, we need to do it one shape at a time
-        for (const auto& tool : shapes) {
-            res = res.makeElementBoolean(OpCodes::Common, {res, tool});
-        }
+        // intersect all shapes in a single run instead of one shape at a time
+        res = TopoShape(0);
+        res.makeElementBatchBoolean(OpCodes::Common, shapes);
     }
     else {
         res = TopoShape(0);
@@ -71,6 +71,10 @@ public:
     /// recalculate the Feature
     App::DocumentObjectExecReturn* execute() override;
     short mustExecute() const override;
+    bool isExecuteGILFree() const override
+    {
+        return true;
+    }
     //@}
 
     void Restore(Base::XMLReader& reader) override;
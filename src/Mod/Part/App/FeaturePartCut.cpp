@@ -30,6 +30,12 @@
 
 using namespace Part;
 
+namespace Part
+{
+extern void throwIfInvalidIfCheckModel(const TopoDS_Shape& shape);
+extern bool getRefineModelParameter();
+}  // namespace Part
+
 PROPERTY_SOURCE(Part::Cut, Part::Boolean)
 
 
@@ -45,3 +51,87 @@ BRepAlgoAPI_BooleanOperation* Cut::makeOperation(const TopoDS_Shape& base, const
     // Let's call algorithm computing a cut operation:
     return new FCBRepAlgoAPI_Cut(base, tool);
 }
+
+// ----------------------------------------------------
+
+PROPERTY_SOURCE(Part::MultiCut, Part::Feature)
+
+// same order as BOPAlgo_GlueEnum
+const char* MultiCut::GlueEnums[] = {"Off", "Shift", "Full", nullptr};
+
+MultiCut::MultiCut()
+{
+    ADD_PROPERTY(Shapes, (nullptr));
+    Shapes.setSize(0);
+    ADD_PROPERTY_TYPE(
+        History,
+        (ShapeHistory()),
+        "Boolean",
+        (App::PropertyType)(App::Prop_Output | App::Prop_Transient | App::Prop_Hidden),
+        "Shape history"
+    );
+    History.setSize(0);
+
+    ADD_PROPERTY_TYPE(
+        Refine,
+        (0),
+        "Boolean",
+        (App::PropertyType)(App::Prop_None),
+        "Refine shape (clean up redundant edges) after this boolean operation"
+    );
+
+    ADD_PROPERTY_TYPE(
+        Glue,
+        (0L),
+        "Boolean",
+        (App::PropertyType)(App::Prop_None),
+        "Speeds up the operation when the shapes only touch (Shift) or fully coincide (Full) "
+        "without intersecting each other. Gives wrong results otherwise."
+    );
+    Glue.setEnums(GlueEnums);
+
+    this->Refine.setValue(getRefineModelParameter());
+}
+
+short MultiCut::mustExecute() const
+{
+    if (Shapes.isTouched() || Glue.isTouched()) {
+        return 1;
+    }
+    return 0;
+}
+
+App::DocumentObjectExecReturn* MultiCut::execute()
+{
+    std::vector<TopoShape> shapes;
+    for (auto obj : Shapes.getValues()) {
+        TopoShape sh = Feature::getTopoShape(obj, ShapeOption::ResolveLink | ShapeOption::Transform);
+        if (sh.isNull()) {
+            return new App::DocumentObjectExecReturn("Input shape is null");
+        }
+        shapes.push_back(sh);
+    }
+
+    if (shapes.size() < 2) {
+        throw Base::CADKernelError("Not enough shape objects linked");
+    }
+
+    BatchBooleanOptions options;
+    options.glue = static_cast<BOPAlgo_GlueEnum>(Glue.getValue());
+
+    TopoShape res(0);
+    res.makeElementBatchBoolean(OpCodes::Cut, shapes, options);
+    if (res.isNull()) {
+        throw Base::RuntimeError("Resulting shape is null");
+    }
+
+    throwIfInvalidIfCheckModel(res.getShape());
+
+    if (this->Refine.getValue()) {
+        res = res.makeElementRefine();
+    }
+    this->Shape.setValue(res);
+    copyMaterial(Shapes.getValues()[0]);
+
+    return Part::Feature::execute();
+}
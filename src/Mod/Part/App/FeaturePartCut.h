@@ -24,6 +24,8 @@
 
 #pragma once
 
+#include <Mod/Part/PartGlobal.h>
+
 #include "FeaturePartBoolean.h"
 
 
@@ -46,4 +48,38 @@ protected:
     //@}
 };
 
+/// Cut all but the first of the linked shapes from the first one in a single boolean run
+class PartExport MultiCut: public Part::Feature
+{
+    PROPERTY_HEADER_WITH_OVERRIDE(Part::MultiCut);
+
+public:
+    MultiCut();
+
+    App::PropertyLinkList Shapes;
+    PropertyShapeHistory History;
+    App::PropertyBool Refine;
+    App::PropertyEnumeration Glue;
+
+    /** @name methods override feature */
+    //@{
+    /// recalculate the Feature
+    App::DocumentObjectExecReturn* execute() override;
+    short mustExecute() const override;
+    bool isExecuteGILFree() const override
+    {
+        return true;
+    }
+    //@}
+
+    /// returns the type name of the ViewProvider
+    const char* getViewProviderName() const override
+    {
+        return "PartGui::ViewProviderMultiCut";
+    }
+
+private:
+    static const char* GlueEnums[];
+};
+
 }  // namespace Part
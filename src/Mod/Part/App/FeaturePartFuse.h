@@ -64,6 +64,10 @@ public:
     /// recalculate the Feature
     App::DocumentObjectExecReturn* execute() override;
     short mustExecute() const override;
+    bool isExecuteGILFree() const override
+    {
+        return true;
+    }
     //@}
     /// returns the type name of the ViewProvider
     const char* getViewProviderName() const override
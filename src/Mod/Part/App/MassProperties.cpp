@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+#include <exception>
+#include <mutex>
+#include <numeric>
+
+#include <BRepGProp.hxx>
+#include <GProp_GProps.hxx>
+#include <Standard_Version.hxx>
+#include <TopExp_Explorer.hxx>
+#include <QtConcurrentMap>
+
+#include <Base/Exception.h>
+
+#include "MassProperties.h"
+#include "ParallelPolicy.h"
+
+
+using namespace Part;
+
+namespace
+{
+int getDimension(const TopoDS_Shape& shape)
+{
+    if (TopExp_Explorer(shape, TopAbs_SOLID).More()) {
+        return 3;
+    }
+    if (TopExp_Explorer(shape, TopAbs_FACE).More()) {
+        return 2;
+    }
+    if (TopExp_Explorer(shape, TopAbs_EDGE).More()) {
+        return 1;
+    }
+    return 0;
+}
+}  // namespace
+
+MassProperties MassProperties::compute(const TopoDS_Shape& shape, double density, bool approximate)
+{
+    MassProperties result;
+    if (shape.IsNull()) {
+        return result;
+    }
+
+    result.dimension = getDimension(shape);
+    GProp_GProps props;
+#if OCC_VERSION_HEX >= 0x070600
+    Standard_Boolean useTriangulation = approximate ? Standard_True : Standard_False;
+#else
+    (void)approximate;
+#endif
+    switch (result.dimension) {
+        case 3:
+#if OCC_VERSION_HEX >= 0x070600
+            BRepGProp::VolumeProperties(shape, props, Standard_False, Standard_False, useTriangulation);
+#else
+            BRepGProp::VolumeProperties(shape, props);
+#endif
+            break;
+        case 2:
+#if OCC_VERSION_HEX >= 0x070600
+            BRepGProp::SurfaceProperties(shape, props, Standard_False, useTriangulation);
+#else
+            BRepGProp::SurfaceProperties(shape, props);
+#endif
+            break;
+        case 1:
+            BRepGProp::LinearProperties(shape, props);
+            break;
+        default:
+            return result;
+    }
+
+    result.size = props.Mass();
+    result.mass = result.size * density;
+    gp_Pnt center = props.CentreOfMass();
+    result.centerOfMass = Base::Vector3d(center.X(), center.Y(), center.Z());
+    gp_Mat inertia = props.MatrixOfInertia();
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            result.matrixOfInertia[i][j] = inertia(i + 1, j + 1) * density;
+        }
+    }
+    return result;
+}
+
+std::vector<MassProperties> MassProperties::compute(const std::vector<TopoDS_Shape>& shapes,
+                                                    const std::vector<double>& densities,
+                                                    bool approximate)
+{
+    if (!densities.empty() && densities.size() != shapes.size()) {
+        throw Base::ValueError("Expect one density per shape");
+    }
+
+    std::vector<MassProperties> results(shapes.size());
+    auto computeOne = [&](std::size_t i) {
+        results[i] = compute(shapes[i], densities.empty() ? 1.0 : densities[i], approximate);
+    };
+
+    if (shapes.size() < 2 || !ParallelPolicy::isEnabled(ParallelPolicy::Algorithm::MassProperties)) {
+        for (std::size_t i = 0; i < shapes.size(); ++i) {
+            computeOne(i);
+        }
+        return results;
+    }
+
+    std::vector<std::size_t> indices(shapes.size());
+    std::iota(indices.begin(), indices.end(), 0);
+    std::mutex mutex;
+    std::exception_ptr error;
+    QtConcurrent::blockingMap(indices, [&](std::size_t i) {
+        try {
+            computeOne(i);
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    });
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    return results;
+}
@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+#include <TopoDS_Shape.hxx>
+
+#include <Base/Matrix.h>
+#include <Base/Vector3D.h>
+#include <Mod/Part/PartGlobal.h>
+
+namespace Part
+{
+
+/** Mass properties of a shape
+ *
+ * All values come from a single BRepGProp run over the elements of the highest
+ * dimension in the shape: the solids if there are any, otherwise the faces, otherwise
+ * the edges.
+ */
+struct PartExport MassProperties
+{
+    /// 3 for solids, 2 for faces, 1 for edges and 0 if the shape has none of them
+    int dimension = 0;
+    /// Volume, area or length of the shape, depending on the dimension
+    double size = 0.0;
+    /// size multiplied by the density
+    double mass = 0.0;
+    Base::Vector3d centerOfMass;
+    /// Matrix of inertia at the center of mass, multiplied by the density
+    Base::Matrix4D matrixOfInertia;
+
+    /// Compute the properties of \a shape. With \a approximate, faces that have a
+    /// triangulation are integrated over it instead of their surface (needs OCCT 7.6).
+    static MassProperties compute(const TopoDS_Shape& shape,
+                                  double density = 1.0,
+                                  bool approximate = false);
+    /// Compute the properties of each shape, concurrently if enabled by ParallelPolicy.
+    /// \a densities is either empty, for a density of 1, or has one entry per shape.
+    static std::vector<MassProperties> compute(const std::vector<TopoDS_Shape>& shapes,
+                                               const std::vector<double>& densities = {},
+                                               bool approximate = false);
+};
+
+}  // namespace Part
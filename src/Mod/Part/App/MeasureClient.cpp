@@ -26,8 +26,14 @@
 
 #include <Mod/Part/PartGlobal.h>
 
+#include <mutex>
 #include <string>
+#include <unordered_map>
 
+#include <QFuture>
+#include <QtConcurrentRun>
+
+#include <Standard_Version.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <TopAbs.hxx>
@@ -61,6 +67,8 @@
 #include "Attacher.h"
 #include "VectorAdapter.h"
 #include "PartFeature.h"
+#include "TessellationCache.h"
+#include "TopoShapeMapper.h"
 
 #include "MeasureClient.h"
 
@@ -68,24 +76,160 @@ using namespace Part;
 using Attacher::AttachEnginePlane;
 
 
-// From:
-// https://github.com/Celemation/FreeCAD/blob/joel_selection_summary_demo/src/Gui/Selection/SelectionSummary.cpp
+namespace
+{
+
+// Length or area and centre of mass of a measured element
+struct MassProps
+{
+    double mass {};
+    gp_Pnt centre;
+};
+
+enum class PropsKind
+{
+    Linear,
+    Surface,
+};
 
-// Should work with edges and wires
-static float getLength(TopoDS_Shape& wire)
+MassProps computeProps(const TopoDS_Shape& shape, PropsKind kind, bool useTriangulation)
 {
     GProp_GProps gprops;
-    BRepGProp::LinearProperties(wire, gprops);
-    return gprops.Mass();
+    if (kind == PropsKind::Linear) {
+        BRepGProp::LinearProperties(shape, gprops);
+    }
+    else {
+#if OCC_VERSION_HEX >= 0x070600
+        BRepGProp::SurfaceProperties(shape, gprops, Standard_False, useTriangulation);
+#else
+        (void)useTriangulation;
+        BRepGProp::SurfaceProperties(shape, gprops);
+#endif
+    }
+    return {gprops.Mass(), gprops.CentreOfMass()};
 }
 
-static float getFaceArea(TopoDS_Shape& face)
+bool useApproximation()
 {
-    GProp_GProps gprops;
-    BRepGProp::SurfaceProperties(face, gprops);
-    return gprops.Mass();
+#if OCC_VERSION_HEX >= 0x070600
+    static ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Measure"
+    );
+    return hGrp->GetBool("ApproximateMeasurement", false);
+#else
+    return false;
+#endif
 }
 
+/* Results of measured elements keyed by the located sub-shape
+ *
+ * Selecting or hovering an element measures it again each time. The located sub-shape
+ * of an unchanged object is the same, so its mass properties and its copy are kept.
+ * A changed object gives new shapes and thus new entries. In approximate mode, areas
+ * are first taken from the triangulation of the shape, if all its faces have one, and
+ * the exact values are computed in the background. They replace the approximation
+ * once they are ready.
+ */
+class MeasureCache
+{
+public:
+    static MeasureCache& instance()
+    {
+        static MeasureCache cache;
+        return cache;
+    }
+
+    MassProps getProps(const TopoDS_Shape& shape, PropsKind kind)
+    {
+        auto& entries = kind == PropsKind::Linear ? linear : surface;
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(shape);
+        if (it != entries.end()) {
+            auto& entry = it->second;
+            if (entry.refining && entry.refined.isFinished()) {
+                entry.props = entry.refined.result();
+                entry.refining = false;
+            }
+            return entry.props;
+        }
+
+        prune(entries);
+        Entry entry;
+        if (kind == PropsKind::Surface && useApproximation()
+            && Part::TessellationCache::hasTriangulation(shape)) {
+            entry.props = computeProps(shape, kind, true);
+            entry.refined = QtConcurrent::run([shape, kind]() {
+                return computeProps(shape, kind, false);
+            });
+            entry.refining = true;
+        }
+        else {
+            entry.props = computeProps(shape, kind, false);
+        }
+        entries.emplace(shape, entry);
+        return entry.props;
+    }
+
+    TopoDS_Shape getCopy(const TopoDS_Shape& shape)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = copies.find(shape);
+        if (it != copies.end()) {
+            return it->second;
+        }
+        prune(copies);
+        BRepBuilderAPI_Copy copy(shape);
+        copies.emplace(shape, copy.Shape());
+        return copy.Shape();
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        linear.clear();
+        surface.clear();
+        copies.clear();
+    }
+
+private:
+    struct Entry
+    {
+        MassProps props;
+        QFuture<MassProps> refined;
+        bool refining {false};
+    };
+
+    static constexpr std::size_t MaxEntries = 1024;
+
+    template<typename Map>
+    static void prune(Map& map)
+    {
+        if (map.size() >= MaxEntries) {
+            map.clear();
+        }
+    }
+
+    std::unordered_map<TopoDS_Shape, Entry, Part::ShapeHasher, Part::ShapeHasher> linear;
+    std::unordered_map<TopoDS_Shape, Entry, Part::ShapeHasher, Part::ShapeHasher> surface;
+    std::unordered_map<TopoDS_Shape, TopoDS_Shape, Part::ShapeHasher, Part::ShapeHasher> copies;
+    std::mutex mutex;
+};
+
+MassProps getLinearProps(const TopoDS_Shape& shape)
+{
+    return MeasureCache::instance().getProps(shape, PropsKind::Linear);
+}
+
+MassProps getSurfaceProps(const TopoDS_Shape& shape)
+{
+    return MeasureCache::instance().getProps(shape, PropsKind::Surface);
+}
+
+}  // namespace
+
+// From:
+// https://github.com/Celemation/FreeCAD/blob/joel_selection_summary_demo/src/Gui/Selection/SelectionSummary.cpp
+
 static float getRadius(TopoDS_Shape& edge)
 {
     // gprops.Mass() would be the circumference (length) of the circle (arc)
@@ -349,12 +493,11 @@ MeasureLengthInfoPtr MeasureLengthHandler(const App::SubObjectT& subject)
     }
 
     // Get Center of mass as the attachment point of the label
-    GProp_GProps gprops;
-    BRepGProp::LinearProperties(shape, gprops);
-    auto origin = gprops.CentreOfMass();
+    auto props = getLinearProps(shape);
+    const auto& origin = props.centre;
 
     Base::Placement placement(Base::Vector3d(origin.X(), origin.Y(), origin.Z()), Base::Rotation());
-    return std::make_shared<MeasureLengthInfo>(true, getLength(shape), placement);
+    return std::make_shared<MeasureLengthInfo>(true, props.mass, placement);
 }
 
 MeasureRadiusInfoPtr MeasureRadiusHandler(const App::SubObjectT& subject)
@@ -376,14 +519,14 @@ MeasureRadiusInfoPtr MeasureRadiusHandler(const App::SubObjectT& subject)
         return invalidRes;
     }
 
-    GProp_GProps gprops;
+    gp_Pnt origin;
     TopoDS_Edge edge;
     TopoDS_Face face;
     gp_Pnt center;
     double radius = 0.0;
 
     if (sType == TopAbs_EDGE) {
-        BRepGProp::LinearProperties(shape, gprops);
+        origin = getLinearProps(shape).centre;
         edge = TopoDS::Edge(shape);
         BRepAdaptor_Curve adapt(edge);
         if (adapt.GetType() == GeomAbs_Circle) {
@@ -393,7 +536,7 @@ MeasureRadiusInfoPtr MeasureRadiusHandler(const App::SubObjectT& subject)
         }
     }
     else if (sType == TopAbs_FACE) {
-        BRepGProp::SurfaceProperties(shape, gprops);
+        origin = getSurfaceProps(shape).centre;
         face = TopoDS::Face(shape);
         TopExp_Explorer exp(face, TopAbs_EDGE);
         if (exp.More()) {
@@ -434,10 +577,7 @@ MeasureRadiusInfoPtr MeasureRadiusHandler(const App::SubObjectT& subject)
         return invalidRes;
     }
 
-    // Get Center of mass as the attachment point of the label
-    auto origin = gprops.CentreOfMass();
-
-
+    // The center of mass is the attachment point of the label
     centerPoint = Base::Vector3d(center.X(), center.Y(), center.Z());
 
     // a somewhat arbitrary radius from center -> point on curve
@@ -472,15 +612,14 @@ MeasureAreaInfoPtr MeasureAreaHandler(const App::SubObjectT& subject)
     }
 
     // Get Center of mass as the attachment point of the label
-    GProp_GProps gprops;
-    BRepGProp::SurfaceProperties(shape, gprops);
-    auto origin = gprops.CentreOfMass();
+    auto props = getSurfaceProps(shape);
+    const auto& origin = props.centre;
 
     // TODO: Center of Mass might not lie on the surface, somehow snap to the closest point on the
     // surface?
 
     Base::Placement placement(Base::Vector3d(origin.X(), origin.Y(), origin.Z()), Base::Rotation());
-    return std::make_shared<MeasureAreaInfo>(true, getFaceArea(shape), placement);
+    return std::make_shared<MeasureAreaInfo>(true, props.mass, placement);
 }
 
 
@@ -529,18 +668,10 @@ MeasureAngleInfoPtr MeasureAngleHandler(const App::SubObjectT& subject)
     gp_Pnt vec;
     Base::Vector3d position;
     if (sType == TopAbs_FACE) {
-        TopoDS_Face face = TopoDS::Face(shape);
-
-        GProp_GProps gprops;
-        BRepGProp::SurfaceProperties(face, gprops);
-        vec = gprops.CentreOfMass();
+        vec = getSurfaceProps(shape).centre;
     }
     else if (sType == TopAbs_EDGE) {
-        TopoDS_Edge edge = TopoDS::Edge(shape);
-
-        GProp_GProps gprops;
-        BRepGProp::LinearProperties(edge, gprops);
-        vec = gprops.CentreOfMass();
+        vec = getLinearProps(shape).centre;
     }
 
     position.Set(vec.X(), vec.Y(), vec.Z());
@@ -565,8 +696,7 @@ MeasureDistanceInfoPtr MeasureDistanceHandler(const App::SubObjectT& subject)
     }
 
     // return a persistent copy of the TopoDS_Shape here as shape will go out of scope at end
-    BRepBuilderAPI_Copy copy(shape);
-    return std::make_shared<MeasureDistanceInfo>(true, copy.Shape());
+    return std::make_shared<MeasureDistanceInfo>(true, MeasureCache::instance().getCopy(shape));
 }
 
 
@@ -575,6 +705,11 @@ void Part::MeasureClient::initialize()
     App::MeasureManager::addMeasureHandler("Part", PartMeasureTypeCb);
 }
 
+void Part::MeasureClient::clearCache()
+{
+    MeasureCache::instance().clear();
+}
+
 Part::CallbackRegistrationList Part::MeasureClient::reportLengthCB()
 {
     CallbackRegistrationList callbacks;
@@ -36,6 +36,8 @@ class PartExport MeasureClient
 {
 public:
     static void initialize();
+    /// Forget the properties and shape copies kept for measured elements
+    static void clearCache();
 
     static CallbackRegistrationList reportLengthCB();
     static CallbackRegistrationList reportPositionCB();
@@ -272,6 +272,36 @@ bool ImportExportSettings::getExpandCompound() const
     return pGroup->GetBool("ExpandCompound", false);
 }
 
+void ImportExportSettings::setInstanceShapes(bool on)
+{
+    pGroup->SetBool("InstanceShapes", on);
+}
+
+bool ImportExportSettings::getInstanceShapes() const
+{
+    return pGroup->GetBool("InstanceShapes", false);
+}
+
+void ImportExportSettings::setGltfMergeFaces(bool on)
+{
+    pGroup->SetBool("GltfMergeFaces", on);
+}
+
+bool ImportExportSettings::getGltfMergeFaces() const
+{
+    return pGroup->GetBool("GltfMergeFaces", false);
+}
+
+void ImportExportSettings::setGltfDracoCompression(bool on)
+{
+    pGroup->SetBool("GltfDracoCompression", on);
+}
+
+bool ImportExportSettings::getGltfDracoCompression() const
+{
+    return pGroup->GetBool("GltfDracoCompression", false);
+}
+
 void ImportExportSettings::setShowProgress(bool on)
 {
     pGroup->SetBool("ShowProgress", on);
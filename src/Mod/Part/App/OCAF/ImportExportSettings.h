@@ -100,6 +100,15 @@ public:
     void setExpandCompound(bool);
     bool getExpandCompound() const;
 
+    void setInstanceShapes(bool);
+    bool getInstanceShapes() const;
+
+    void setGltfMergeFaces(bool);
+    bool getGltfMergeFaces() const;
+
+    void setGltfDracoCompression(bool);
+    bool getGltfDracoCompression() const;
+
     void setShowProgress(bool);
     bool getShowProgress() const;
 
@@ -24,6 +24,7 @@
 
 #include <App/Application.h>
 #include <Base/ProgressIndicator.h>
+#include <Base/ProgressTask.h>
 #include <Mod/Part/PartGlobal.h>
 
 #include <Message_ProgressIndicator.hxx>
@@ -61,6 +62,34 @@ public:
     }
 };
 
+/**
+ * Reports the progress of an OCC algorithm into a Base::ProgressTask. Unlike
+ * OCCTProgressIndicator this never touches the user interface, so it can be used for OCC
+ * algorithms that run in worker threads.
+ */
+class PartExport OCCTTaskProgressIndicator: public Message_ProgressIndicator
+{
+    Base::ProgressTask& task;
+
+public:
+    OCCTTaskProgressIndicator(Base::ProgressTask& task)
+        : task(task)
+    {}
+
+    Standard_Boolean UserBreak() override
+    {
+        return task.isCanceled();
+    }
+
+    void Show(const Message_ProgressScope& scope, const Standard_Boolean /*isForce*/) override
+    {
+        if (!scope.IsInfinite()) {
+            auto steps = static_cast<double>(task.numberOfSteps());
+            task.setProgress(static_cast<std::size_t>(GetPosition() * steps));
+        }
+    }
+};
+
 
 #if OCC_VERSION_HEX < 0x070600
 // Stubs out OCCT Message_ProgressRange for OCCT versions below 7.5
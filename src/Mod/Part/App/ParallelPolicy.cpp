@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+#include <mutex>
+
+#include <OSD_Parallel.hxx>
+#include <OSD_ThreadPool.hxx>
+
+#include <App/Application.h>
+#include <Base/Parameter.h>
+
+#include "ParallelPolicy.h"
+
+using namespace Part;
+
+namespace
+{
+
+std::mutex SettingsMutex;
+ParallelPolicy::Settings CurrentSettings;
+
+const std::array<const char*, ParallelPolicy::AlgorithmCount> AlgorithmNames {
+    "Boolean",
+    "Mesh",
+    "Check",
+    "Distance",
+    "MassProperties",
+    "Sewing",
+};
+
+void applyThreadCount(int threads)
+{
+    Handle(OSD_ThreadPool) pool = OSD_ThreadPool::DefaultPool();
+    int count = threads > 0 ? threads : OSD_Parallel::NbLogicalProcessors();
+    if (pool->NbThreads() != count) {
+        pool->Init(count);
+    }
+}
+
+}  // namespace
+
+ParallelPolicy::Settings ParallelPolicy::getSettings()
+{
+    std::lock_guard<std::mutex> lock(SettingsMutex);
+    return CurrentSettings;
+}
+
+void ParallelPolicy::setSettings(const Settings& settings)
+{
+    std::lock_guard<std::mutex> lock(SettingsMutex);
+    if (settings.threads != CurrentSettings.threads) {
+        applyThreadCount(settings.threads);
+    }
+    CurrentSettings = settings;
+}
+
+void ParallelPolicy::loadSettings()
+{
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/Parallel"
+    );
+    Settings settings;
+    settings.threads = static_cast<int>(hGrp->GetInt("ThreadCount", 0));
+    for (std::size_t i = 0; i < AlgorithmCount; ++i) {
+        settings.enabled[i] = hGrp->GetBool(AlgorithmNames[i], true);
+    }
+    setSettings(settings);
+}
+
+void ParallelPolicy::withSettings(const Settings& settings, const std::function<void()>& func)
+{
+    Settings oldSettings = getSettings();
+    setSettings(settings);
+    try {
+        func();
+    }
+    catch (...) {
+        setSettings(oldSettings);
+        throw;
+    }
+    setSettings(oldSettings);
+}
+
+bool ParallelPolicy::isEnabled(Algorithm algorithm)
+{
+    std::lock_guard<std::mutex> lock(SettingsMutex);
+    return CurrentSettings.enabled[static_cast<std::size_t>(algorithm)];
+}
+
+bool ParallelPolicy::useParallel(Algorithm algorithm)
+{
+    // Some algorithms (e.g. BRepMesh) only use the OCCT thread pool, and thus
+    // the configured thread count, when this global switch is on
+    if (!isEnabled(algorithm)) {
+        return false;
+    }
+    OSD_Parallel::SetUseOcctThreads(Standard_True);
+    return true;
+}
+
+const char* ParallelPolicy::algorithmName(Algorithm algorithm)
+{
+    return AlgorithmNames[static_cast<std::size_t>(algorithm)];
+}
@@ -0,0 +1,88 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#pragma once
+
+#include <array>
+#include <functional>
+
+#include <Mod/Part/PartGlobal.h>
+
+namespace Part
+{
+
+/**
+ * @brief Central switch for the parallel modes of the OCCT algorithms used by Part
+ *
+ * Every wrapper that can run an OCCT algorithm in parallel asks useParallel()
+ * before doing so, instead of hard coding the mode. The defaults are read
+ * from the "Mod/Part/Parallel" parameter group at start up.
+ */
+namespace ParallelPolicy
+{
+
+enum class Algorithm
+{
+    Boolean,         ///< boolean and general fuse operations
+    Mesh,            ///< BRepMesh_IncrementalMesh
+    Check,           ///< BRepCheck_Analyzer and BOPAlgo_ArgumentAnalyzer
+    Distance,        ///< BRepExtrema_DistShapeShape
+    MassProperties,  ///< BRepGProp properties of many shapes at once
+    Sewing,          ///< BRepBuilderAPI_Sewing of independent groups of shapes
+};
+
+constexpr std::size_t AlgorithmCount = 6;
+
+struct Settings
+{
+    /// Number of threads of the OCCT thread pool, 0 for one per core
+    int threads = 0;
+    /// Whether parallel mode is enabled, indexed by Algorithm
+    std::array<bool, AlgorithmCount> enabled {true, true, true, true, true, true};
+
+    bool operator==(const Settings& other) const
+    {
+        return threads == other.threads && enabled == other.enabled;
+    }
+};
+
+Settings PartExport getSettings();
+/// Change the settings, resizing the OCCT thread pool if needed. Not to be
+/// called while an algorithm is running.
+void PartExport setSettings(const Settings& settings);
+/// Read the settings from the parameter group
+void PartExport loadSettings();
+/// Run func with the given settings, restoring the previous ones afterwards
+void PartExport withSettings(const Settings& settings, const std::function<void()>& func);
+
+/// Return whether parallel mode is enabled for the given algorithm
+bool PartExport isEnabled(Algorithm algorithm);
+/// Same as isEnabled(), but also makes sure the algorithm uses the OCCT thread pool
+bool PartExport useParallel(Algorithm algorithm);
+/// Return the name of the algorithm as used in the parameter group and Python
+const char* PartExport algorithmName(Algorithm algorithm);
+
+}  // namespace ParallelPolicy
+
+}  // namespace Part
@@ -76,6 +76,7 @@
 #include "PartFeature.h"
 #include "PartFeaturePy.h"
 #include "PartPyCXX.h"
+#include "RecomputeCache.h"
 #include "TopoShapePy.h"
 #include "Tools.h"
 
@@ -104,7 +105,27 @@ short Feature::mustExecute() const
 App::DocumentObjectExecReturn* Feature::recompute()
 {
     try {
-        return App::GeoFeature::recompute();
+        auto& cache = RecomputeCache::instance();
+        _recomputeKey.clear();
+        if (!isRecomputeCacheable() || !cache.isEnabled()) {
+            return App::GeoFeature::recompute();
+        }
+
+        std::string key = cache.getKey(this);
+        TopoShape shape;
+        if (cache.find(key, shape)) {
+            Base::ObjectStatusLocker<App::ObjectStatus, App::DocumentObject> exe(App::Recompute, this);
+            this->Shape.setValue(shape);
+            _recomputeKey = key;
+            return App::DocumentObject::StdReturn;
+        }
+
+        auto ret = App::GeoFeature::recompute();
+        if (ret == App::DocumentObject::StdReturn) {
+            cache.store(this, key);
+            _recomputeKey = key;
+        }
+        return ret;
     }
     catch (Standard_Failure& e) {
 
@@ -1537,14 +1558,22 @@ void Feature::onChanged(const App::Property* prop)
             this->Shape._Shape.setTransform(this->Placement.getValue().toMatrix());
         }
         else {
-            Base::Placement p;
-            // shape must not be null to override the placement
-            if (!this->Shape.getValue().IsNull()) {
-                try {
-                    p.fromMatrix(this->Shape.getShape().getTransform());
-                    this->Placement.setValueIfChanged(p);
-                }
-                catch (const Base::ValueError&) {
+            // A shape set outside of a recompute, e.g. by undo or from Python, is
+            // no longer the result the recompute key stands for
+            _recomputeKey.clear();
+
+            // the placement of restored but not yet parsed shape data is restored
+            // separately, so don't force parsing it here
+            if (!this->Shape.isLoadPending()) {
+                Base::Placement p;
+                // shape must not be null to override the placement
+                if (!this->Shape.getValue().IsNull()) {
+                    try {
+                        p.fromMatrix(this->Shape.getShape().getTransform());
+                        this->Placement.setValueIfChanged(p);
+                    }
+                    catch (const Base::ValueError&) {
+                    }
                 }
             }
         }
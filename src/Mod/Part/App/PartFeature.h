@@ -209,6 +209,21 @@ public:
         double atol = 1e-10
     ) const override;
 
+    /** Whether the result of this feature can be taken from the RecomputeCache
+     *
+     * Only features whose execute() changes nothing but the Shape (and maybe the
+     * ShapeMaterial) may return true.
+     */
+    virtual bool isRecomputeCacheable() const
+    {
+        return false;
+    }
+    /// The RecomputeCache key of the inputs of the last recompute, if any
+    const std::string& getRecomputeKey() const
+    {
+        return _recomputeKey;
+    }
+
 protected:
     /// recompute only this object
     App::DocumentObjectExecReturn* recompute() override;
@@ -253,6 +268,7 @@ private:
     struct ElementCache;
     std::map<std::string, ElementCache> _elementCache;
     std::vector<std::pair<std::string, PropertyPartShape*>> _elementCachePrefixMap;
+    std::string _recomputeKey;
 };
 
 class PartExport FilletBase: public Part::Feature
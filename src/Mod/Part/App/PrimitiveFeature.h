@@ -47,6 +47,14 @@ public:
     App::DocumentObjectExecReturn* execute() override;
     short mustExecute() const override;
     PyObject* getPyObject() override;
+    bool canRecomputeConcurrently() const override
+    {
+        return true;
+    }
+    bool isExecuteGILFree() const override
+    {
+        return true;
+    }
     //@}
 
 protected:
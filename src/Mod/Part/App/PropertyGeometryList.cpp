@@ -23,8 +23,19 @@
  ***************************************************************************/
 
 
+#include <algorithm>
+#include <array>
+#include <unordered_map>
+
+#include <gp_Ax2.hxx>
+#include <Standard_Failure.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColStd_Array1OfInteger.hxx>
+#include <TColStd_Array1OfReal.hxx>
+
 #include <Base/Console.h>
 #include <Base/Reader.h>
+#include <Base/Stream.h>
 #include <Base/Writer.h>
 
 #include "PropertyGeometryList.h"
@@ -39,6 +50,220 @@ using namespace std;
 using namespace Part;
 
 
+namespace
+{
+
+// Tags of the OCC geometries in the binary file
+enum class BinaryTag : uint8_t
+{
+    Point = 1,
+    Line = 2,
+    Circle = 3,
+    Ellipse = 4,
+    BSplineCurve = 5,
+    TrimmedCurve = 6,
+};
+
+// The geometry types that are saved in the binary file
+bool hasBinaryFormat(const Geometry* geom)
+{
+    static const std::array<Base::Type, 8> types {
+        GeomPoint::getClassTypeId(),
+        GeomLine::getClassTypeId(),
+        GeomLineSegment::getClassTypeId(),
+        GeomCircle::getClassTypeId(),
+        GeomArcOfCircle::getClassTypeId(),
+        GeomEllipse::getClassTypeId(),
+        GeomArcOfEllipse::getClassTypeId(),
+        GeomBSplineCurve::getClassTypeId(),
+    };
+    return std::ranges::find(types, geom->getTypeId()) != types.end();
+}
+
+void writeXYZ(Base::OutputStream& str, const gp_XYZ& xyz)
+{
+    str << xyz.X() << xyz.Y() << xyz.Z();
+}
+
+gp_XYZ readXYZ(Base::InputStream& str)
+{
+    double x {}, y {}, z {};
+    str >> x >> y >> z;
+    return {x, y, z};
+}
+
+void writeAx2(Base::OutputStream& str, const gp_Ax2& axis)
+{
+    writeXYZ(str, axis.Location().XYZ());
+    writeXYZ(str, axis.Direction().XYZ());
+    writeXYZ(str, axis.XDirection().XYZ());
+}
+
+gp_Ax2 readAx2(Base::InputStream& str)
+{
+    gp_Pnt location(readXYZ(str));
+    gp_Dir direction(readXYZ(str));
+    gp_Dir xDirection(readXYZ(str));
+    return {location, direction, xDirection};
+}
+
+void writeHandle(Base::OutputStream& str, const Handle(Geom_Geometry) & geom)
+{
+    if (auto point = Handle(Geom_CartesianPoint)::DownCast(geom); !point.IsNull()) {
+        str << static_cast<uint8_t>(BinaryTag::Point);
+        writeXYZ(str, point->Pnt().XYZ());
+    }
+    else if (auto line = Handle(Geom_Line)::DownCast(geom); !line.IsNull()) {
+        str << static_cast<uint8_t>(BinaryTag::Line);
+        writeXYZ(str, line->Position().Location().XYZ());
+        writeXYZ(str, line->Position().Direction().XYZ());
+    }
+    else if (auto circle = Handle(Geom_Circle)::DownCast(geom); !circle.IsNull()) {
+        str << static_cast<uint8_t>(BinaryTag::Circle);
+        writeAx2(str, circle->Position());
+        str << circle->Radius();
+    }
+    else if (auto ellipse = Handle(Geom_Ellipse)::DownCast(geom); !ellipse.IsNull()) {
+        str << static_cast<uint8_t>(BinaryTag::Ellipse);
+        writeAx2(str, ellipse->Position());
+        str << ellipse->MajorRadius() << ellipse->MinorRadius();
+    }
+    else if (auto spline = Handle(Geom_BSplineCurve)::DownCast(geom); !spline.IsNull()) {
+        str << static_cast<uint8_t>(BinaryTag::BSplineCurve);
+        str << static_cast<int32_t>(spline->Degree()) << spline->IsPeriodic()
+            << static_cast<int32_t>(spline->NbPoles()) << static_cast<int32_t>(spline->NbKnots());
+        for (int i = 1; i <= spline->NbPoles(); ++i) {
+            writeXYZ(str, spline->Pole(i).XYZ());
+            str << spline->Weight(i);
+        }
+        for (int i = 1; i <= spline->NbKnots(); ++i) {
+            str << spline->Knot(i) << static_cast<int32_t>(spline->Multiplicity(i));
+        }
+    }
+    else if (auto trimmed = Handle(Geom_TrimmedCurve)::DownCast(geom); !trimmed.IsNull()) {
+        str << static_cast<uint8_t>(BinaryTag::TrimmedCurve);
+        writeHandle(str, trimmed->BasisCurve());
+        str << trimmed->FirstParameter() << trimmed->LastParameter();
+    }
+    else {
+        throw Base::TypeError(
+            std::string("No binary format for ") + geom->DynamicType()->Name()
+        );
+    }
+}
+
+Handle(Geom_Geometry) readHandle(Base::InputStream& str)
+{
+    uint8_t tag = 0;
+    str >> tag;
+    switch (static_cast<BinaryTag>(tag)) {
+        case BinaryTag::Point:
+            return new Geom_CartesianPoint(gp_Pnt(readXYZ(str)));
+        case BinaryTag::Line: {
+            gp_Pnt location(readXYZ(str));
+            gp_Dir direction(readXYZ(str));
+            return new Geom_Line(location, direction);
+        }
+        case BinaryTag::Circle: {
+            gp_Ax2 axis = readAx2(str);
+            double radius {};
+            str >> radius;
+            return new Geom_Circle(axis, radius);
+        }
+        case BinaryTag::Ellipse: {
+            gp_Ax2 axis = readAx2(str);
+            double major {}, minor {};
+            str >> major >> minor;
+            return new Geom_Ellipse(axis, major, minor);
+        }
+        case BinaryTag::BSplineCurve: {
+            int32_t degree {}, numPoles {}, numKnots {};
+            bool periodic {};
+            str >> degree >> periodic >> numPoles >> numKnots;
+            if (numPoles < 1 || numKnots < 1) {
+                throw Base::BadFormatError("Invalid B-spline in geometry file");
+            }
+            TColgp_Array1OfPnt poles(1, numPoles);
+            TColStd_Array1OfReal weights(1, numPoles);
+            for (int i = 1; i <= numPoles; ++i) {
+                poles(i) = gp_Pnt(readXYZ(str));
+                str >> weights(i);
+            }
+            TColStd_Array1OfReal knots(1, numKnots);
+            TColStd_Array1OfInteger mults(1, numKnots);
+            for (int i = 1; i <= numKnots; ++i) {
+                int32_t mult {};
+                str >> knots(i) >> mult;
+                mults(i) = mult;
+            }
+            return new Geom_BSplineCurve(poles, weights, knots, mults, degree, periodic);
+        }
+        case BinaryTag::TrimmedCurve: {
+            auto basis = Handle(Geom_Curve)::DownCast(readHandle(str));
+            if (basis.IsNull()) {
+                throw Base::BadFormatError("Invalid trimmed curve in geometry file");
+            }
+            double first {}, last {};
+            str >> first >> last;
+            return new Geom_TrimmedCurve(basis, first, last);
+        }
+    }
+    throw Base::BadFormatError("Unknown geometry in geometry file");
+}
+
+template<typename GeomT, typename HandleT>
+bool trySetHandle(Geometry* geom, const Handle(Geom_Geometry) & handle)
+{
+    auto target = dynamic_cast<GeomT*>(geom);
+    if (!target) {
+        return false;
+    }
+    auto value = Handle(HandleT)::DownCast(handle);
+    if (value.IsNull()) {
+        throw Base::TypeError(
+            std::string("Geometry file does not match ") + geom->getTypeId().getName()
+        );
+    }
+    target->setHandle(value);
+    return true;
+}
+
+void setHandle(Geometry* geom, const Handle(Geom_Geometry) & handle)
+{
+    // GeomTrimmedCurve::setHandle() is overridden by the arcs and line segments, which check
+    // the basis curve
+    trySetHandle<GeomPoint, Geom_CartesianPoint>(geom, handle)
+        || trySetHandle<GeomTrimmedCurve, Geom_TrimmedCurve>(geom, handle)
+        || trySetHandle<GeomLine, Geom_Line>(geom, handle)
+        || trySetHandle<GeomCircle, Geom_Circle>(geom, handle)
+        || trySetHandle<GeomEllipse, Geom_Ellipse>(geom, handle)
+        || trySetHandle<GeomBSplineCurve, Geom_BSplineCurve>(geom, handle);
+}
+
+// The persistent extensions of a geometry, Geometry::Save() only writes these
+std::string saveExtensions(const Geometry& geom)
+{
+    Base::StringWriter writer;
+    geom.Geometry::Save(writer);
+    return writer.getString();
+}
+
+// Compares what is saved of two geometries, the tags are not saved
+bool sameGeometry(const Geometry* geom, const Geometry* other)
+{
+    if (geom == other) {
+        return true;
+    }
+    if (!geom || !other || geom->getTypeId() != other->getTypeId()
+        || !geom->isSame(*other, 0.0, 0.0)) {
+        return false;
+    }
+    return saveExtensions(*geom) == saveExtensions(*other);
+}
+
+}  // namespace
+
+
 //**************************************************************************
 // PropertyGeometryList
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -51,21 +276,12 @@ TYPESYSTEM_SOURCE(Part::PropertyGeometryList, App::PropertyLists)
 
 PropertyGeometryList::PropertyGeometryList() = default;
 
-PropertyGeometryList::~PropertyGeometryList()
-{
-    for (auto it : _lValueList) {
-        if (it) {
-            delete it;
-        }
-    }
-}
+PropertyGeometryList::~PropertyGeometryList() = default;
 
 void PropertyGeometryList::setSize(int newSize)
 {
-    for (unsigned int i = newSize; i < _lValueList.size(); i++) {
-        delete _lValueList[i];
-    }
     _lValueList.resize(newSize);
+    _lValueOwners.resize(newSize);
 }
 
 int PropertyGeometryList::getSize() const
@@ -73,58 +289,87 @@ int PropertyGeometryList::getSize() const
     return static_cast<int>(_lValueList.size());
 }
 
-void PropertyGeometryList::setValue(const Geometry* lValue)
+std::vector<std::shared_ptr<Geometry>>
+PropertyGeometryList::findOwners(const std::vector<Geometry*>& values) const
 {
-    if (lValue) {
-        aboutToSetValue();
-        Geometry* newVal = lValue->clone();
-        for (auto it : _lValueList) {
-            delete it;
+    std::unordered_map<const Geometry*, const std::shared_ptr<Geometry>*> owners;
+    owners.reserve(_lValueOwners.size());
+    for (const auto& owner : _lValueOwners) {
+        owners.emplace(owner.get(), &owner);
+    }
+
+    std::vector<std::shared_ptr<Geometry>> result(values.size());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        auto it = owners.find(values[i]);
+        if (it != owners.end()) {
+            result[i] = *it->second;
         }
-        _lValueList.resize(1);
-        _lValueList[0] = newVal;
-        hasSetValue();
     }
+    return result;
 }
 
-void PropertyGeometryList::setValues(const std::vector<Geometry*>& lValue)
+void PropertyGeometryList::assignValues(std::vector<std::shared_ptr<Geometry>>&& owners)
 {
-    auto copy = lValue;
     aboutToSetValue();
-    std::sort(_lValueList.begin(), _lValueList.end());
-    for (auto& geo : copy) {
-        auto range = std::equal_range(_lValueList.begin(), _lValueList.end(), geo);
-        // clone if the new entry does not exist in the original value list, or
-        // else, simply reuse it (i.e. erase it so that it won't get deleted below).
-        if (range.first == range.second) {
-            geo = geo->clone();
+    // Report the replaced geometries if the size didn't change, an empty touch list means all
+    _touchList.clear();
+    if (owners.size() == _lValueOwners.size()) {
+        for (std::size_t i = 0; i < owners.size(); ++i) {
+            if (owners[i] != _lValueOwners[i]) {
+                _touchList.insert(static_cast<int>(i));
+            }
         }
-        else {
-            _lValueList.erase(range.first, range.second);
+        if (_touchList.size() == owners.size()) {
+            _touchList.clear();
         }
     }
-    for (auto v : _lValueList) {
-        delete v;
-    }
-    _lValueList = std::move(copy);
+    _lValueOwners = std::move(owners);
+    _lValueList.resize(_lValueOwners.size());
+    std::ranges::transform(_lValueOwners, _lValueList.begin(), [](const auto& owner) {
+        return owner.get();
+    });
     hasSetValue();
 }
 
+void PropertyGeometryList::setValue(const Geometry* lValue)
+{
+    if (lValue) {
+        std::vector<std::shared_ptr<Geometry>> owners;
+        owners.emplace_back(lValue->clone());
+        assignValues(std::move(owners));
+    }
+}
+
+void PropertyGeometryList::setValues(const std::vector<Geometry*>& lValue)
+{
+    // clone if the new entry does not exist in the original value list, or
+    // else, simply share it.
+    auto owners = findOwners(lValue);
+    for (std::size_t i = 0; i < owners.size(); ++i) {
+        if (!owners[i] && lValue[i]) {
+            owners[i].reset(lValue[i]->clone());
+        }
+    }
+    assignValues(std::move(owners));
+}
+
 void PropertyGeometryList::setValues(std::vector<Geometry*>&& lValue)
 {
     // Unlike above, the moved version of setValues() indicates the caller want
     // us to manager the memory of the passed in values. So no need clone.
-    aboutToSetValue();
-    std::sort(_lValueList.begin(), _lValueList.end());
-    for (auto geo : lValue) {
-        auto range = std::equal_range(_lValueList.begin(), _lValueList.end(), geo);
-        _lValueList.erase(range.first, range.second);
-    }
-    for (auto geo : _lValueList) {
-        delete geo;
+    auto owners = findOwners(lValue);
+    std::unordered_map<Geometry*, std::shared_ptr<Geometry>> adopted;
+    for (std::size_t i = 0; i < owners.size(); ++i) {
+        if (!owners[i] && lValue[i]) {
+            auto& owner = adopted[lValue[i]];
+            if (!owner) {
+                owner.reset(lValue[i]);
+            }
+            owners[i] = owner;
+        }
     }
-    _lValueList = std::move(lValue);
-    hasSetValue();
+    lValue.clear();
+    assignValues(std::move(owners));
 }
 
 void PropertyGeometryList::set1Value(int idx, std::unique_ptr<Geometry>&& lValue)
@@ -137,12 +382,15 @@ void PropertyGeometryList::set1Value(int idx, std::unique_ptr<Geometry>&& lValue
     }
     aboutToSetValue();
     if (idx < 0) {
-        _lValueList.push_back(lValue.release());
+        idx = static_cast<int>(_lValueList.size());
+        _lValueList.push_back(lValue.get());
+        _lValueOwners.emplace_back(std::move(lValue));
     }
     else {
-        delete _lValueList[idx];
-        _lValueList[idx] = lValue.release();
+        _lValueList[idx] = lValue.get();
+        _lValueOwners[idx] = std::move(lValue);
     }
+    _touchList.insert(idx);
     hasSetValue();
 }
 
@@ -196,11 +444,17 @@ void PropertyGeometryList::setPyObject(PyObject* value)
     }
 }
 
-void PropertyGeometryList::trySaveGeometry(Geometry* geom, Base::Writer& writer) const
+void PropertyGeometryList::trySaveGeometry(Geometry* geom, Base::Writer& writer, bool binary) const
 {
     // Not all geometry classes implement Save() and throw an exception instead
     try {
-        geom->Save(writer);
+        if (binary) {
+            // only the extensions, the geometry is written by SaveDocFile()
+            geom->Geometry::Save(writer);
+        }
+        else {
+            geom->Save(writer);
+        }
         for (auto& ext : geom->getExtensions()) {
             auto extension = ext.lock();
             auto gpe = freecad_cast<GeometryMigrationPersistenceExtension*>(extension.get());
@@ -215,7 +469,7 @@ void PropertyGeometryList::trySaveGeometry(Geometry* geom, Base::Writer& writer)
     }
 }
 
-void PropertyGeometryList::tryRestoreGeometry(Geometry* geom, Base::XMLReader& reader)
+void PropertyGeometryList::tryRestoreGeometry(Geometry* geom, Base::XMLReader& reader, bool binary)
 {
     // Not all geometry classes implement Restore() and throw an exception instead
     try {
@@ -230,7 +484,12 @@ void PropertyGeometryList::tryRestoreGeometry(Geometry* geom, Base::XMLReader& r
             }
             geom->setExtension(std::move(ext));
         }
-        geom->Restore(reader);
+        if (binary) {
+            geom->Geometry::Restore(reader);
+        }
+        else {
+            geom->Restore(reader);
+        }
     }
     catch (const Base::NotImplementedError& e) {
         Base::Console()
@@ -240,9 +499,16 @@ void PropertyGeometryList::tryRestoreGeometry(Geometry* geom, Base::XMLReader& r
 
 void PropertyGeometryList::Save(Writer& writer) const
 {
-    writer.Stream() << writer.ind() << "<GeometryList count=\"" << getSize() << "\">" << endl;
+    bool binary = !writer.isForceXML() && writer.getMode("BinaryGeometry")
+        && std::ranges::any_of(_lValueList, hasBinaryFormat);
+    writer.Stream() << writer.ind() << "<GeometryList count=\"" << getSize() << "\"";
+    if (binary) {
+        writer.Stream() << " file=\"" << writer.addFile("Geometry.bin", this) << "\"";
+    }
+    writer.Stream() << ">" << endl;
     writer.incInd();
     for (int i = 0; i < getSize(); i++) {
+        bool binaryGeom = binary && hasBinaryFormat(_lValueList[i]);
         writer.Stream() << writer.ind() << "<Geometry type=\""
                         << _lValueList[i]->getTypeId().getName() << "\"";
         for (auto& e : _lValueList[i]->getExtensions()) {
@@ -251,10 +517,10 @@ void PropertyGeometryList::Save(Writer& writer) const
                 gpe->preSave(writer);
             }
         }
-        writer.Stream() << " migrated=\"1\">\n";
+        writer.Stream() << " migrated=\"1\"" << (binaryGeom ? " binary=\"1\"" : "") << ">\n";
 
         writer.incInd();
-        trySaveGeometry(_lValueList[i], writer);
+        trySaveGeometry(_lValueList[i], writer, binaryGeom);
         writer.decInd();
         writer.Stream() << writer.ind() << "</Geometry>" << endl;
     }
@@ -269,13 +535,16 @@ void PropertyGeometryList::Restore(Base::XMLReader& reader)
     reader.readElement("GeometryList");
     // get the value of my attribute
     int count = reader.getAttribute<long>("count");
+    std::string file(reader.getAttribute<const char*>("file", ""));
     std::vector<Geometry*> values;
+    std::vector<Geometry*> pending;
     values.reserve(count);
     for (int i = 0; i < count; i++) {
         reader.readElement("Geometry");
         const char* TypeName = reader.getAttribute<const char*>("type");
+        bool binary = !file.empty() && reader.getAttribute<long>("binary", 0);
         Geometry* newG = static_cast<Geometry*>(Base::Type::fromName(TypeName).createInstance());
-        tryRestoreGeometry(newG, reader);
+        tryRestoreGeometry(newG, reader, binary);
 
         if (reader.testStatus(Base::XMLReader::ReaderStatus::PartialRestoreInObject)) {
             Base::Console().error(
@@ -288,12 +557,16 @@ void PropertyGeometryList::Restore(Base::XMLReader& reader)
             }
             else {
                 delete newG;
+                newG = nullptr;
             }
             reader.clearPartialRestoreObject();
         }
         else {
             values.push_back(newG);
         }
+        if (binary) {
+            pending.push_back(newG);
+        }
 
         reader.readEndElement("Geometry");
     }
@@ -302,19 +575,92 @@ void PropertyGeometryList::Restore(Base::XMLReader& reader)
 
     // assignment
     setValues(std::move(values));
+
+    // the geometries of the binary file are read by RestoreDocFile()
+    _pendingBinary = findOwners(pending);
+    if (!_pendingBinary.empty()) {
+        reader.addFile(file.c_str(), this);
+    }
+}
+
+void PropertyGeometryList::SaveDocFile(Base::Writer& writer) const
+{
+    Base::OutputStream str(writer.Stream());
+    auto count = std::ranges::count_if(_lValueList, hasBinaryFormat);
+    str << static_cast<uint32_t>(count);
+    for (auto geom : _lValueList) {
+        if (hasBinaryFormat(geom)) {
+            writeHandle(str, geom->handle());
+        }
+    }
+}
+
+void PropertyGeometryList::RestoreDocFile(Base::Reader& reader)
+{
+    auto pending = std::move(_pendingBinary);
+    _pendingBinary.clear();
+
+    Base::InputStream str(reader);
+    uint32_t count = 0;
+    str >> count;
+    if (count != pending.size()) {
+        throw Base::BadFormatError("Geometry file does not match the geometry list");
+    }
+    std::vector<Handle(Geom_Geometry)> handles(count);
+    try {
+        for (auto& handle : handles) {
+            handle = readHandle(str);
+        }
+    }
+    catch (const Standard_Failure& e) {
+        throw Base::CADKernelError(e.GetMessageString());
+    }
+
+    aboutToSetValue();
+    for (std::size_t i = 0; i < pending.size(); ++i) {
+        // geometries dropped by Restore() are skipped
+        if (!pending[i]) {
+            continue;
+        }
+        try {
+            setHandle(pending[i].get(), handles[i]);
+        }
+        catch (const Standard_Failure& e) {
+            Base::Console().error("Failed to restore geometry: %s\n", e.GetMessageString());
+        }
+        catch (const Base::Exception& e) {
+            Base::Console().error("Failed to restore geometry: %s\n", e.what());
+        }
+    }
+    hasSetValue();
 }
 
 App::Property* PropertyGeometryList::Copy() const
 {
+    // the geometries are shared, see the class description
     PropertyGeometryList* p = new PropertyGeometryList();
-    p->setValues(_lValueList);
+    p->_lValueList = _lValueList;
+    p->_lValueOwners = _lValueOwners;
     return p;
 }
 
 void PropertyGeometryList::Paste(const Property& from)
 {
     const PropertyGeometryList& FromList = dynamic_cast<const PropertyGeometryList&>(from);
-    setValues(FromList._lValueList);
+    auto owners = FromList._lValueOwners;
+    assignValues(std::move(owners));
+}
+
+bool PropertyGeometryList::isSame(const Property& other) const
+{
+    if (&other == this) {
+        return true;
+    }
+    if (other.getTypeId() != getTypeId()) {
+        return false;
+    }
+    const auto& values = static_cast<const PropertyGeometryList&>(other)._lValueList;
+    return std::ranges::equal(_lValueList, values, sameGeometry);
 }
 
 unsigned int PropertyGeometryList::getMemSize() const
@@ -328,5 +674,17 @@ unsigned int PropertyGeometryList::getMemSize() const
 
 void PropertyGeometryList::moveValues(PropertyGeometryList&& other)
 {
-    setValues(std::move(other._lValueList));
+    // Keep the geometries that didn't change, so that they stay shared with the copies of the
+    // list, e.g. the ones of the undo transactions
+    auto owners = std::move(other._lValueOwners);
+    other._lValueList.clear();
+    std::size_t count = std::min(owners.size(), _lValueOwners.size());
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto& geom = owners[i];
+        const auto& old = _lValueOwners[i];
+        if (geom && old && geom->getTag() == old->getTag() && sameGeometry(geom.get(), old.get())) {
+            owners[i] = _lValueOwners[i];
+        }
+    }
+    assignValues(std::move(owners));
 }
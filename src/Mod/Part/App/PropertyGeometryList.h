@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include <App/Property.h>
@@ -42,6 +43,17 @@ namespace Part
 {
 class Geometry;
 
+/**
+ * A list of geometries, e.g. of a sketch.
+ *
+ * The geometries are shared with the copies of the property, e.g. the ones kept for undo, and
+ * with the values of setValues() that are already in the list. So a geometry of the list must not
+ * be modified in place but replaced with set1Value() or setValues(). If only some geometries are
+ * replaced, their indices are reported by getTouchList().
+ *
+ * With the writer mode "BinaryGeometry" the common curves of sketches are saved in a binary file
+ * instead of XML. Their extensions are still saved as XML.
+ */
 class PartExport PropertyGeometryList: public App::PropertyLists
 {
     TYPESYSTEM_HEADER_WITH_OVERRIDE();
@@ -68,6 +80,7 @@ public:
     void setValues(const std::vector<Geometry*>&);
     void setValues(std::vector<Geometry*>&&);
 
+    /// Takes the geometries of \a other, the ones that did not change are kept
     void moveValues(PropertyGeometryList&& other);
 
     /// index operator
@@ -88,18 +101,27 @@ public:
 
     void Save(Base::Writer& writer) const override;
     void Restore(Base::XMLReader& reader) override;
+    void SaveDocFile(Base::Writer& writer) const override;
+    void RestoreDocFile(Base::Reader& reader) override;
 
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
+    bool isSame(const App::Property& other) const override;
 
     unsigned int getMemSize() const override;
 
 private:
-    void trySaveGeometry(Geometry* geom, Base::Writer& writer) const;
-    void tryRestoreGeometry(Geometry* geom, Base::XMLReader& reader);
+    std::vector<std::shared_ptr<Geometry>> findOwners(const std::vector<Geometry*>& values) const;
+    void assignValues(std::vector<std::shared_ptr<Geometry>>&& owners);
+    void trySaveGeometry(Geometry* geom, Base::Writer& writer, bool binary) const;
+    void tryRestoreGeometry(Geometry* geom, Base::XMLReader& reader, bool binary);
 
 private:
     std::vector<Geometry*> _lValueList;
+    /// The owners of the geometries in _lValueList
+    std::vector<std::shared_ptr<Geometry>> _lValueOwners;
+    /// The geometries whose data follows in the binary file, null if dropped by Restore()
+    std::vector<std::shared_ptr<Geometry>> _pendingBinary;
 };
 
 }  // namespace Part
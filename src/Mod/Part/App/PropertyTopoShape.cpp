@@ -23,7 +23,12 @@
  ***************************************************************************/
 
 
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <mutex>
 #include <sstream>
+#include <QCryptographicHash>
 #include <Bnd_Box.hxx>
 #include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_Copy.hxx>
@@ -38,6 +43,7 @@
 #include <App/Document.h>
 #include <App/DocumentObject.h>
 #include <App/ObjectIdentifier.h>
+#include <App/PropertyTransfer.h>
 #include <Base/Console.h>
 #include <Base/Exception.h>
 #include <Base/FileInfo.h>
@@ -48,6 +54,7 @@
 #include "PartFeature.h"
 #include "PartPyCXX.h"
 #include "PropertyTopoShape.h"
+#include "ShapeTable.h"
 #include "TopoShapePy.h"
 #include "PartFeature.h"
 
@@ -56,6 +63,105 @@ FC_LOG_LEVEL_INIT("App", true, true)
 namespace sp = std::placeholders;
 using namespace Part;
 
+namespace
+{
+// Shapes restored from identical data are shared instead of being parsed
+// into separate copies, e.g. the shape of a PartDesign body and its tip.
+// The key is a digest of the stored data, so only shapes that are identical
+// down to the last byte are shared. Entries are dropped once nobody else
+// references their shape.
+class RestoredShapeCache
+{
+public:
+    static RestoredShapeCache& instance()
+    {
+        static RestoredShapeCache cache;
+        return cache;
+    }
+
+    TopoDS_Shape find(const QByteArray& key)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = shapes.find(key);
+        if (it != shapes.end()) {
+            return it->second;
+        }
+        return {};
+    }
+
+    void add(const QByteArray& key, const TopoDS_Shape& shape)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (shapes.size() >= pruneSize) {
+            prune();
+            pruneSize = std::max<std::size_t>(MinPruneSize, shapes.size() * 2);
+        }
+        shapes.emplace(key, shape);
+    }
+
+private:
+    RestoredShapeCache()
+    {
+        connection = App::GetApplication().signalDeletedDocument.connect([this]() {
+            std::lock_guard<std::mutex> lock(mutex);
+            prune();
+        });
+    }
+
+    void prune()
+    {
+        for (auto it = shapes.begin(); it != shapes.end();) {
+            if (it->second.TShape()->GetRefCount() <= 1) {
+                it = shapes.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+
+    static constexpr std::size_t MinPruneSize = 64;
+    std::mutex mutex;
+    std::map<QByteArray, TopoDS_Shape> shapes;
+    std::size_t pruneSize = MinPruneSize;
+    fastsignals::scoped_connection connection;
+};
+
+TopoDS_Shape readSharedShape(const std::string& data, bool binary)
+{
+    if (data.empty()) {
+        return {};
+    }
+
+    QByteArray key = QCryptographicHash::hash(
+        QByteArray::fromRawData(data.data(), static_cast<int>(data.size())),
+        QCryptographicHash::Sha1
+    );
+    key.append(binary ? 'b' : 'a');
+
+    auto& cache = RestoredShapeCache::instance();
+    TopoDS_Shape shape = cache.find(key);
+    if (!shape.IsNull()) {
+        return shape;
+    }
+
+    std::istringstream stream(data);
+    if (binary) {
+        TopoShape topoShape;
+        topoShape.importBinary(stream);
+        shape = topoShape.getShape();
+    }
+    else {
+        BRep_Builder builder;
+        BRepTools::Read(shape, stream, builder);
+    }
+    if (!shape.IsNull()) {
+        cache.add(key, shape);
+    }
+    return shape;
+}
+}  // namespace
+
 TYPESYSTEM_SOURCE(Part::PropertyPartShape, App::PropertyComplexGeoData)
 
 PropertyPartShape::PropertyPartShape() = default;
@@ -65,6 +171,14 @@ PropertyPartShape::~PropertyPartShape() = default;
 void PropertyPartShape::setValue(const TopoShape& sh)
 {
     aboutToSetValue();
+    assignShape(sh);
+    hasSetValue();
+    _Ver.clear();
+}
+
+void PropertyPartShape::assignShape(const TopoShape& sh)
+{
+    _PendingData.clear();
     _Shape = sh;
     auto obj = freecad_cast<App::DocumentObject*>(getContainer());
     if (obj) {
@@ -88,29 +202,77 @@ void PropertyPartShape::setValue(const TopoShape& sh)
             _Shape.hashChildMaps();
         }
     }
-    hasSetValue();
-    _Ver.clear();
+    // cleared last, so that readers don't access the shape while it is assigned
+    _Pending.store(false, std::memory_order_release);
+}
+
+void PropertyPartShape::loadPending() const
+{
+    if (!isLoadPending()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_PendingMutex);
+    if (_PendingData.empty()) {
+        // loaded by another thread in the meantime
+        return;
+    }
+
+    TopoShape shape;
+    try {
+        if (_PendingShared) {
+            shape.setShape(readSharedShape(_PendingData, _PendingBinary));
+        }
+        else if (_PendingBinary) {
+            std::istringstream stream(_PendingData);
+            shape.importBinary(stream);
+        }
+        else {
+            std::istringstream stream(_PendingData);
+            BRep_Builder builder;
+            TopoDS_Shape brep;
+            BRepTools::Read(brep, stream, builder);
+            shape.setShape(brep);
+        }
+    }
+    catch (const Standard_Failure& e) {
+        FC_WARN("Failed to load shape of " << getFullName() << ": " << e.GetMessageString());
+    }
+    catch (const std::exception& e) {
+        FC_WARN("Failed to load shape of " << getFullName() << ": " << e.what());
+    }
+    _PendingData.clear();
+
+    // Keep the element map that has been restored in the meantime. Loading
+    // the data doesn't change the value, so the property is not touched.
+    auto self = const_cast<PropertyPartShape*>(this);  // NOLINT
+    shape.Hasher = _Shape.Hasher;
+    shape.resetElementMap(self->_Shape.resetElementMap());
+    self->assignShape(shape);
 }
 
 void PropertyPartShape::setValue(const TopoDS_Shape& sh, bool resetElementMap)
 {
     aboutToSetValue();
+    _PendingData.clear();
     auto obj = dynamic_cast<App::DocumentObject*>(getContainer());
     if (obj) {
         _Shape.Tag = obj->getID();
     }
     _Shape.setShape(sh, resetElementMap);
+    _Pending.store(false, std::memory_order_release);
     hasSetValue();
     _Ver.clear();
 }
 
 const TopoDS_Shape& PropertyPartShape::getValue() const
 {
+    loadPending();
     return _Shape.getShape();
 }
 
 const TopoShape& PropertyPartShape::getShape() const
 {
+    loadPending();
     _Shape.initCache(-1);
     // March, 2024 Toponaming project:  There was originally an unused feature to disable
     // elementMapping that has not been kept:
@@ -127,12 +289,14 @@ const TopoShape& PropertyPartShape::getShape() const
 
 const Data::ComplexGeoData* PropertyPartShape::getComplexData() const
 {
+    loadPending();
     _Shape.initCache(-1);
     return &(this->_Shape);
 }
 
 Base::BoundBox3d PropertyPartShape::getBoundingBox() const
 {
+    loadPending();
     Base::BoundBox3d box;
     if (_Shape.getShape().IsNull()) {
         return box;
@@ -160,16 +324,19 @@ Base::BoundBox3d PropertyPartShape::getBoundingBox() const
 
 void PropertyPartShape::setTransform(const Base::Matrix4D& rclTrf)
 {
+    loadPending();
     _Shape.setTransform(rclTrf);
 }
 
 Base::Matrix4D PropertyPartShape::getTransform() const
 {
+    loadPending();
     return _Shape.getTransform();
 }
 
 void PropertyPartShape::transformGeometry(const Base::Matrix4D& rclTrf)
 {
+    loadPending();
     aboutToSetValue();
     _Shape.transformGeometry(rclTrf);
     hasSetValue();
@@ -177,6 +344,7 @@ void PropertyPartShape::transformGeometry(const Base::Matrix4D& rclTrf)
 
 PyObject* PropertyPartShape::getPyObject()
 {
+    loadPending();
     Base::PyObjectBase* prop = static_cast<Base::PyObjectBase*>(_Shape.getPyObject());
     if (prop) {
         prop->setConst();
@@ -224,8 +392,15 @@ App::Property* PropertyPartShape::Copy() const
     //        prop->_Shape = this->_Shape.makeElementCopy();
     //    } else
     //        prop->_Shape = this->_Shape;
+    // the shape may be loaded from the pending data by another thread
+    std::lock_guard<std::mutex> lock(_PendingMutex);
     prop->_Shape = this->_Shape;
     prop->_Ver = this->_Ver;
+    // copying the raw data is cheaper than parsing it
+    prop->_PendingData = this->_PendingData;
+    prop->_PendingBinary = this->_PendingBinary;
+    prop->_PendingShared = this->_PendingShared;
+    prop->_Pending.store(isLoadPending(), std::memory_order_release);
     return prop;
 }
 
@@ -233,6 +408,7 @@ void PropertyPartShape::Paste(const App::Property& from)
 {
     auto prop = freecad_cast<const PropertyPartShape*>(&from);
     if (prop) {
+        prop->loadPending();
         setValue(prop->_Shape);
         _Ver = prop->_Ver;
     }
@@ -240,7 +416,12 @@ void PropertyPartShape::Paste(const App::Property& from)
 
 unsigned int PropertyPartShape::getMemSize() const
 {
-    return _Shape.getMemSize();
+    return _Shape.getMemSize() + static_cast<unsigned int>(_PendingData.size());
+}
+
+unsigned int PropertyPartShape::getCopyMemSize() const
+{
+    return static_cast<unsigned int>(sizeof(PropertyPartShape) + _PendingData.size());
 }
 
 void PropertyPartShape::getPaths(std::vector<App::ObjectIdentifier>& paths) const
@@ -354,7 +535,7 @@ void PropertyPartShape::beforeSave() const
     _HasherIndex = 0;
     _SaveHasher = false;
     auto owner = freecad_cast<App::DocumentObject*>(getContainer());
-    if (owner && !_Shape.isNull() && _Shape.getElementMapSize() > 0) {
+    if (owner && !isEmpty() && _Shape.getElementMapSize() > 0) {
         auto ret = owner->getDocument()->addStringHasher(_Shape.Hasher);
         _HasherIndex = ret.second;
         _SaveHasher = ret.first;
@@ -366,7 +547,7 @@ void PropertyPartShape::Save(Base::Writer& writer) const
     // See SaveDocFile(), RestoreDocFile()
     writer.Stream() << writer.ind() << "<Part";
     auto owner = dynamic_cast<App::DocumentObject*>(getContainer());
-    if (owner && !_Shape.isNull() && _Shape.getElementMapSize() > 0 && !_Shape.Hasher.isNull()) {
+    if (owner && !isEmpty() && _Shape.getElementMapSize() > 0 && !_Shape.Hasher.isNull()) {
         writer.Stream() << " HasherIndex=\"" << _HasherIndex << '"';
         if (_SaveHasher) {
             writer.Stream() << " SaveHasher=\"1\"";
@@ -387,7 +568,25 @@ void PropertyPartShape::Save(Base::Writer& writer) const
 
     bool binary = writer.getMode("BinaryBrep");
     bool toXML = writer.isForceXML();
-    if (!toXML) {
+    auto transfer = toXML ? nullptr : App::PropertyTransfer::current();
+    bool shared = !toXML && !transfer && writer.getMode("SharedBrep");
+    if (toXML || shared) {
+        loadPending();
+    }
+    if (transfer) {
+        // The copy made by Document::copyObject() takes the shape from here, see Restore()
+        writer.Stream() << " transfer=\"" << transfer->add(this) << "\"/>\n";
+    }
+    else if (shared) {
+        // All shapes of the document go into a single shape set, see ShapeTable
+        if (!_Shape.isNull()) {
+            auto table = ShapeTable::forWriter(writer);
+            writer.Stream() << " table=\"" << table->getFileName() << "\" index=\""
+                            << table->addShape(_Shape.getShape()) << '"';
+        }
+        writer.Stream() << "/>\n";
+    }
+    else if (!toXML) {
         writer.Stream() << " file=\""
                         << writer.addFile(getFileName(binary ? ".bin" : ".brp").c_str(), this)
                         << "\"/>\n";
@@ -454,6 +653,21 @@ void PropertyPartShape::Restore(Base::XMLReader& reader)
             reader.addFile(file.c_str(), this);
         }
     }
+    else if (reader.hasAttribute("table")) {
+        auto table = ShapeTable::forReader(reader, reader.getAttribute<const char*>("table"));
+        table->addProperty(this, reader.getAttribute<int>("index", -1));
+    }
+    else if (reader.hasAttribute("transfer")) {
+        // Share the shape of the original instead of parsing a copy of it
+        auto transfer = App::PropertyTransfer::current();
+        auto source = dynamic_cast<const PropertyPartShape*>(
+            transfer ? transfer->get(reader.getAttribute<int>("transfer")) : nullptr
+        );
+        if (source) {
+            source->loadPending();
+            shape.setShape(source->_Shape.getShape(), false);
+        }
+    }
     else if (reader.hasAttribute(("binary")) && reader.getAttribute<long>("binary")) {
         TopoShape shape;
         shape.importBinary(reader.beginCharStream());
@@ -544,7 +758,37 @@ void PropertyPartShape::afterRestore()
             _Shape.Hasher->clear();
         }
     }
-    PropertyComplexGeoData::afterRestore();
+    if (!isLoadPending()) {
+        PropertyComplexGeoData::afterRestore();
+        return;
+    }
+
+    // Same as PropertyComplexGeoData::afterRestore() but without calling
+    // getComplexData(), which would parse the pending shape data
+    if (_Shape.isRestoreFailed()) {
+        _Shape.resetRestoreFailure();
+        auto owner = freecad_cast<App::DocumentObject*>(getContainer());
+        if (owner && owner->getDocument()
+            && !owner->getDocument()->testStatus(App::Document::PartialDoc)) {
+            owner->getDocument()->addRecomputeObject(owner);
+        }
+    }
+    App::PropertyGeometry::afterRestore();
+}
+
+void PropertyPartShape::setRestoredShape(const TopoDS_Shape& sh)
+{
+    // setValue() resets the element map and version that were restored with
+    // the property, so keep them
+    auto elementMap = _Shape.resetElementMap();
+    auto hasher = _Shape.Hasher;
+    std::string ver = _Ver;
+
+    TopoShape shape(sh);
+    shape.Hasher = hasher;
+    shape.resetElementMap(elementMap);
+    setValue(shape);
+    _Ver = ver;
 }
 
 // The following function is copied from OCCT BRepTools.cxx and modified
@@ -703,6 +947,16 @@ void PropertyPartShape::loadFromStream(Base::Reader& reader)
 
 void PropertyPartShape::SaveDocFile(Base::Writer& writer) const
 {
+    // A shape that hasn't been accessed since loading is written back as is
+    if (isLoadPending()) {
+        if (_PendingBinary == writer.getMode("BinaryBrep")) {
+            writer.Stream().write(_PendingData.data(),
+                                  static_cast<std::streamsize>(_PendingData.size()));
+            return;
+        }
+        loadPending();
+    }
+
     // If the shape is empty we simply store nothing. The file size will be 0 which
     // can be checked when reading in the data.
     if (_Shape.getShape().IsNull()) {
@@ -748,13 +1002,47 @@ void PropertyPartShape::RestoreDocFile(Base::Reader& reader)
 
     std::string ver = _Ver;
 
-    if (brep.hasExtension("bin")) {
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General"
+    );
+    bool lazy = hGrp->GetBool("LazyShapeLoading", false);
+    bool shared = hGrp->GetBool("ShareRestoredShapes", false);
+    bool direct = hGrp->GetBool("DirectAccess", true);
+    bool binary = brep.hasExtension("bin");
+    if (lazy && !isLoadPending() && _Shape.isNull()) {
+        // Only copy the data out of the archive and parse it once the shape
+        // is accessed. Most shapes of the feature history are never needed.
+        std::string data {std::istreambuf_iterator<char>(reader), std::istreambuf_iterator<char>()};
+        if (!data.empty()) {
+            aboutToSetValue();
+            _Shape.resetElementMap(elementMap);
+            _PendingData = std::move(data);
+            _PendingBinary = binary;
+            _PendingShared = shared;
+            _Pending.store(true, std::memory_order_release);
+            hasSetValue();
+            _Ver = ver;
+            return;
+        }
+    }
+
+    if (shared && (binary || direct)) {
+        std::string data {std::istreambuf_iterator<char>(reader), std::istreambuf_iterator<char>()};
+        try {
+            shape.setShape(readSharedShape(data, binary));
+        }
+        catch (...) {
+            // same as loadFromStream(), a broken BREP file is not fatal
+            if (binary) {
+                throw;
+            }
+            Base::Console().warning("Failed to load BRep file %s\n", reader.getFileName().c_str());
+        }
+    }
+    else if (binary) {
         shape.importBinary(reader);
     }
     else {
-        bool direct = App::GetApplication()
-                          .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Mod/Part/General")
-                          ->GetBool("DirectAccess", true);
         if (!direct) {
             loadFromFile(reader);
         }
@@ -24,7 +24,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <map>
+#include <mutex>
 #include <vector>
 
 #include <App/PropertyGeo.h>
@@ -97,6 +99,8 @@ public:
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
     unsigned int getMemSize() const override;
+    /// The shape of a copy is shared with the original, only the pending data is owned
+    unsigned int getCopyMemSize() const override;
     //@}
 
     /// Get valid paths for this property; used by auto completer
@@ -110,18 +114,42 @@ public:
 
     void afterRestore() override;
 
+    /// Check whether the restored shape data is still waiting to be parsed
+    bool isLoadPending() const
+    {
+        return _Pending.load(std::memory_order_acquire);
+    }
+
     friend class Feature;
+    friend class ShapeTable;
 
 private:
     void saveToFile(Base::Writer& writer) const;
     void loadFromFile(Base::Reader& reader);
     void loadFromStream(Base::Reader& reader);
+    void assignShape(const TopoShape& sh);
+    /// Set the shape read from a ShapeTable, keeping the restored element map
+    void setRestoredShape(const TopoDS_Shape& sh);
+    /// Parse the shape data deferred by RestoreDocFile(), if any
+    void loadPending() const;
+    bool isEmpty() const
+    {
+        return !isLoadPending() && _Shape.isNull();
+    }
 
 private:
     TopoShape _Shape;
     std::string _Ver;
     mutable int _HasherIndex = 0;
     mutable bool _SaveHasher = false;
+    // raw BREP or binary data of a restored shape that is parsed on first access
+    mutable std::string _PendingData;
+    mutable bool _PendingBinary = false;
+    mutable bool _PendingShared = false;
+    // set while _PendingData holds data, the mutex serializes loading it when
+    // features recomputed in parallel read the same shape
+    mutable std::atomic<bool> _Pending {false};
+    mutable std::mutex _PendingMutex;
 };
 
 struct PartExport ShapeHistory
@@ -0,0 +1,319 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+#include <cstring>
+#include <map>
+#include <sstream>
+
+#include <QByteArray>
+#include <QCryptographicHash>
+#include <Standard_Failure.hxx>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/DocumentObject.h>
+#include <App/StringHasher.h>
+#include <Base/Console.h>
+#include <Base/FileInfo.h>
+#include <Base/Reader.h>
+#include <Base/Stream.h>
+#include <Base/Writer.h>
+
+#include "PartFeature.h"
+#include "RecomputeCache.h"
+#include "TopoShape.h"
+
+
+FC_LOG_LEVEL_INIT("Part", true, true)
+
+using namespace Part;
+
+namespace
+{
+constexpr const char* Magic = "FreeCADRecomputeCache";
+
+void addData(QCryptographicHash& hash, const std::string& data)
+{
+    // prefix the size so that consecutive strings cannot be confused
+    hash.addData(QByteArray::number(static_cast<qulonglong>(data.size())));
+    hash.addData(QByteArray::fromRawData(data.data(), static_cast<int>(data.size())));
+}
+
+bool isKeyProperty(const App::DocumentObject* obj, const App::Property* prop)
+{
+    if (prop == &obj->Label || prop == &obj->Label2 || prop == &obj->Visibility
+        || prop == &obj->ExpressionEngine) {
+        return false;
+    }
+    if (obj->isDerivedFrom<Feature>()) {
+        // the result and what is copied to it by execute()
+        auto feature = static_cast<const Feature*>(obj);
+        if (prop == &feature->Shape || prop == &feature->ShapeMaterial) {
+            return false;
+        }
+    }
+    if (prop->testStatus(App::Property::Transient) || prop->testStatus(App::Property::Output)) {
+        return false;
+    }
+    return (obj->getPropertyType(prop) & (App::Prop_Transient | App::Prop_Output)) == 0;
+}
+
+class KeyBuilder
+{
+public:
+    QByteArray getObjectKey(const App::DocumentObject* obj)
+    {
+        auto it = keys.find(obj);
+        if (it != keys.end()) {
+            return it->second;
+        }
+
+        QCryptographicHash hash(QCryptographicHash::Sha1);
+        hash.addData(QByteArray::number(RecomputeCache::Version));
+        addData(hash, obj->getTypeId().getName());
+        // element names are tagged with the object ids
+        hash.addData(QByteArray::number(static_cast<qlonglong>(obj->getID())));
+
+        std::vector<std::pair<const char*, App::Property*>> props;
+        obj->getPropertyNamedList(props);
+        for (const auto& [name, prop] : props) {
+            if (!isKeyProperty(obj, prop)) {
+                continue;
+            }
+            Base::StringWriter writer;
+            prop->Save(writer);
+            addData(hash, name);
+            addData(hash, writer.getString());
+        }
+
+        for (auto dep : obj->getOutList()) {
+            hash.addData(getDependencyKey(dep));
+        }
+
+        return keys[obj] = hash.result();
+    }
+
+private:
+    QByteArray getDependencyKey(const App::DocumentObject* dep)
+    {
+        if (!dep->isDerivedFrom<Feature>()) {
+            return getObjectKey(dep);
+        }
+
+        auto feature = static_cast<const Feature*>(dep);
+        if (!feature->getRecomputeKey().empty() && !feature->isTouched()) {
+            return QByteArray::fromStdString(feature->getRecomputeKey());
+        }
+
+        // Use the content of the shape of other features
+        auto it = keys.find(dep);
+        if (it != keys.end()) {
+            return it->second;
+        }
+        const TopoShape& shape = feature->Shape.getShape();
+        std::ostringstream str;
+        shape.exportBinary(str);
+        if (shape.getElementMapSize() > 0) {
+            Base::StringWriter writer;
+            shape.SaveDocFile(writer);
+            str << writer.getString();
+        }
+        QCryptographicHash hash(QCryptographicHash::Sha1);
+        hash.addData(QByteArray::number(static_cast<qlonglong>(dep->getID())));
+        addData(hash, str.str());
+        return keys[dep] = hash.result();
+    }
+
+    std::map<const App::DocumentObject*, QByteArray> keys;
+};
+}  // namespace
+
+RecomputeCache& RecomputeCache::instance()
+{
+    static RecomputeCache* cache = new RecomputeCache;
+    return *cache;
+}
+
+RecomputeCache::RecomputeCache()
+{
+    handle = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General"
+    );
+    handle->Attach(this);
+    OnChange(*handle, "RecomputeCache");
+    // the entries queued by the workers of a parallel recompute
+    connRecomputed = App::GetApplication().signalRecomputed.connect(
+        [this](const App::Document&) { writePending(); }
+    );
+}
+
+RecomputeCache::~RecomputeCache()
+{
+    handle->Detach(this);
+}
+
+void RecomputeCache::OnChange(Base::Subject<const char*>& /*caller*/, const char* reason)
+{
+    if (!reason
+        || (strcmp(reason, "RecomputeCache") != 0 && strcmp(reason, "RecomputeCacheDir") != 0)) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    enabled = handle->GetBool("RecomputeCache", false);
+    directory = handle->GetASCII("RecomputeCacheDir", "");
+    if (directory.empty()) {
+        directory = App::Application::getUserCachePath() + "RecomputeCache";
+    }
+    if (enabled) {
+        Base::FileInfo dir(directory);
+        if (!dir.exists() && !dir.createDirectories()) {
+            FC_ERR("Cannot create recompute cache directory " << directory);
+            enabled = false;
+        }
+    }
+}
+
+std::string RecomputeCache::getFileName(const std::string& key) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return directory + "/" + key + ".fcshape";
+}
+
+std::string RecomputeCache::getKey(const Feature* feature) const
+{
+    KeyBuilder builder;
+    return builder.getObjectKey(feature).toHex().toStdString();
+}
+
+bool RecomputeCache::find(const std::string& key, TopoShape& shape) const
+{
+    Base::FileInfo fi(getFileName(key));
+    if (!fi.isReadable()) {
+        return false;
+    }
+
+    try {
+        Base::ifstream file(fi, std::ios::in | std::ios::binary);
+        Base::Reader reader(file, fi.fileName(), 1);
+        std::string magic;
+        int version = 0;
+        reader >> magic >> version;
+        if (magic != Magic || version != Version) {
+            return false;
+        }
+        reader.get();  // end of the header line
+
+        TopoShape result;
+        result.importBinary(reader);
+        int hasElementMap = 0;
+        reader >> hasElementMap;
+        if (hasElementMap) {
+            // the element map comes with its own string table
+            App::StringHasherRef hasher(new App::StringHasher);
+            hasher->RestoreDocFile(reader);
+            result.Hasher = hasher;
+            result.RestoreDocFile(reader);
+        }
+        if (result.isNull()) {
+            return false;
+        }
+        shape = result;
+        return true;
+    }
+    catch (const Base::Exception& e) {
+        FC_WARN("Failed to read recompute cache entry " << fi.filePath() << ": " << e.what());
+    }
+    catch (const Standard_Failure& e) {
+        FC_WARN(
+            "Failed to read recompute cache entry " << fi.filePath() << ": " << e.GetMessageString()
+        );
+    }
+    catch (const std::exception& e) {
+        FC_WARN("Failed to read recompute cache entry " << fi.filePath() << ": " << e.what());
+    }
+    return false;
+}
+
+void RecomputeCache::store(const Feature* feature, const std::string& key)
+{
+    const TopoShape& shape = feature->Shape.getShape();
+    if (shape.isNull()) {
+        return;
+    }
+
+    if (feature->getDocument()->isRecomputeWorker()) {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending.emplace_back(key, shape);
+        return;
+    }
+    write(key, shape);
+}
+
+void RecomputeCache::writePending()
+{
+    std::vector<std::pair<std::string, TopoShape>> entries;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.swap(pending);
+    }
+    for (const auto& [key, shape] : entries) {
+        write(key, shape);
+    }
+}
+
+void RecomputeCache::write(const std::string& key, const TopoShape& shape)
+{
+    Base::StringWriter writer;
+    writer.Stream() << Magic << ' ' << Version << '\n';
+    shape.exportBinary(writer.Stream());
+    bool hasElementMap = shape.getElementMapSize() > 0 && shape.Hasher;
+    writer.Stream() << '\n' << (hasElementMap ? 1 : 0) << '\n';
+    if (hasElementMap) {
+        // Only called by the main thread, no worker is using the string table
+        shape.Hasher->clearMarks();
+        shape.beforeSave();
+        shape.Hasher->SaveDocFile(writer);
+        shape.SaveDocFile(writer);
+    }
+
+    // Write to a temporary file first, other processes may share the cache
+    std::string fileName = getFileName(key);
+    std::string dir = Base::FileInfo(fileName).dirPath();
+    Base::FileInfo tmp(Base::FileInfo::getTempFileName(nullptr, dir.c_str()));
+    {
+        Base::ofstream file(tmp, std::ios::out | std::ios::binary);
+        file << writer.getString();
+        if (!file) {
+            FC_WARN("Failed to write recompute cache entry " << fileName);
+            file.close();
+            tmp.deleteFile();
+            return;
+        }
+    }
+    if (!tmp.renameFile(fileName.c_str())) {
+        tmp.deleteFile();
+    }
+}
@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <Base/Parameter.h>
+#include <Mod/Part/PartGlobal.h>
+
+#include "TopoShape.h"
+
+namespace Part
+{
+
+class Feature;
+
+/** On-disk cache of recompute results
+ *
+ * Features that opt in through Feature::isRecomputeCacheable() are keyed on a
+ * digest of their input properties and of the shapes of the objects they depend
+ * on. If a result for the same key has been stored before, possibly by another
+ * session, the shape including its element map is loaded from the cache instead
+ * of executing the feature again.
+ *
+ * The cache is enabled with the Mod/Part/General preference 'RecomputeCache'.
+ * The entries are stored in 'RecomputeCacheDir', which defaults to a
+ * sub-directory of the user cache path.
+ */
+class PartExport RecomputeCache: public ParameterGrp::ObserverType
+{
+public:
+    static RecomputeCache& instance();
+
+    bool isEnabled() const
+    {
+        return enabled;
+    }
+
+    /// Compute the digest of the inputs of \a feature
+    std::string getKey(const Feature* feature) const;
+    /// Load the shape stored for \a key, returns false if there is none
+    bool find(const std::string& key, TopoShape& shape) const;
+    /** Store the shape of \a feature as the result for \a key
+     *
+     * Saving the element map marks the used strings of the string table,
+     * which is shared by all objects of the document. If called by a worker
+     * of a parallel recompute the entry is therefore only queued, and written
+     * by the main thread once the recompute of the document is finished.
+     */
+    void store(const Feature* feature, const std::string& key);
+
+    void OnChange(Base::Subject<const char*>& caller, const char* reason) override;
+
+    static constexpr int Version = 1;
+
+private:
+    RecomputeCache();
+    ~RecomputeCache() override;
+
+    std::string getFileName(const std::string& key) const;
+    void write(const std::string& key, const TopoShape& shape);
+    void writePending();
+
+    ParameterGrp::handle handle;
+    std::string directory;
+    bool enabled = false;
+    mutable std::mutex mutex;
+    std::vector<std::pair<std::string, TopoShape>> pending;
+    fastsignals::scoped_connection connRecomputed;
+};
+
+}  // namespace Part
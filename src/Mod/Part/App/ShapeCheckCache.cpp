@@ -0,0 +1,251 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include <BRep_Tool.hxx>
+#include <BRepCheck_Analyzer.hxx>
+#include <Standard_Version.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Shape.hxx>
+
+#include "ParallelPolicy.h"
+#include "ShapeCheckCache.h"
+
+using namespace Part;
+
+namespace
+{
+
+constexpr std::size_t MaxEntries = 256;
+
+struct Signature
+{
+    int faces = 0;
+    int edges = 0;
+    int vertices = 0;
+    double tolerance = 0.0;
+
+    explicit Signature(const TopoDS_Shape& shape)
+    {
+        TopExp_Explorer xp;
+        for (xp.Init(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+            ++faces;
+            tolerance += BRep_Tool::Tolerance(TopoDS::Face(xp.Current()));
+        }
+        for (xp.Init(shape, TopAbs_EDGE); xp.More(); xp.Next()) {
+            ++edges;
+            tolerance += BRep_Tool::Tolerance(TopoDS::Edge(xp.Current()));
+        }
+        for (xp.Init(shape, TopAbs_VERTEX); xp.More(); xp.Next()) {
+            ++vertices;
+            tolerance += BRep_Tool::Tolerance(TopoDS::Vertex(xp.Current()));
+        }
+    }
+
+    bool operator==(const Signature& other) const
+    {
+        return faces == other.faces && edges == other.edges && vertices == other.vertices
+            && tolerance == other.tolerance;
+    }
+};
+
+struct Entry
+{
+    // Keeps the TShape alive, so that its address is not reused while cached
+    TopoDS_Shape shape;
+    Signature signature;
+    ShapeCheckCache::Validity validity = ShapeCheckCache::Validity::Unknown;
+    bool fixed = false;
+};
+
+class Cache
+{
+public:
+    static Cache& instance()
+    {
+        static Cache cache;
+        return cache;
+    }
+
+    template<class Func>
+    void update(const TopoDS_Shape& shape, Func func)
+    {
+        Signature signature(shape);
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = index.find(key(shape));
+        if (it != index.end() && !(it->second->signature == signature)) {
+            entries.erase(it->second);
+            index.erase(it);
+            it = index.end();
+        }
+        if (it == index.end()) {
+            entries.push_front(Entry {shape, signature});
+            it = index.emplace(key(shape), entries.begin()).first;
+            if (entries.size() > MaxEntries) {
+                index.erase(key(entries.back().shape));
+                entries.pop_back();
+            }
+        }
+        func(*it->second);
+    }
+
+    template<class Func>
+    auto lookup(const TopoDS_Shape& shape, Func func) -> decltype(func(nullptr))
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (index.find(key(shape)) == index.end()) {
+                return func(nullptr);
+            }
+        }
+        Signature signature(shape);
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = index.find(key(shape));
+        if (it == index.end()) {
+            return func(nullptr);
+        }
+        if (!(it->second->signature == signature)) {
+            entries.erase(it->second);
+            index.erase(it);
+            return func(nullptr);
+        }
+        entries.splice(entries.begin(), entries, it->second);
+        return func(&*it->second);
+    }
+
+    void remove(const TopoDS_Shape& shape)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = index.find(key(shape));
+        if (it != index.end()) {
+            entries.erase(it->second);
+            index.erase(it);
+        }
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        index.clear();
+        entries.clear();
+    }
+
+    std::size_t size()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return entries.size();
+    }
+
+private:
+    static const void* key(const TopoDS_Shape& shape)
+    {
+        return shape.TShape().get();
+    }
+
+    std::mutex mutex;
+    std::list<Entry> entries;
+    std::unordered_map<const void*, std::list<Entry>::iterator> index;
+};
+
+}  // namespace
+
+ShapeCheckCache::Validity ShapeCheckCache::getValidity(const TopoDS_Shape& shape)
+{
+    if (shape.IsNull()) {
+        return Validity::Unknown;
+    }
+    return Cache::instance().lookup(shape, [](const Entry* entry) {
+        return entry ? entry->validity : Validity::Unknown;
+    });
+}
+
+void ShapeCheckCache::setValidity(const TopoDS_Shape& shape, bool valid)
+{
+    if (shape.IsNull()) {
+        return;
+    }
+    Cache::instance().update(shape, [valid](Entry& entry) {
+        entry.validity = valid ? Validity::Valid : Validity::Invalid;
+    });
+}
+
+bool ShapeCheckCache::isValid(const TopoDS_Shape& shape)
+{
+    auto validity = getValidity(shape);
+    if (validity != Validity::Unknown) {
+        return validity == Validity::Valid;
+    }
+#if OCC_VERSION_HEX >= 0x070600
+    BRepCheck_Analyzer aChecker(
+        shape,
+        /*GeomControls*/ Standard_True,
+        /*theIsParallel*/ ParallelPolicy::useParallel(ParallelPolicy::Algorithm::Check)
+    );
+#else
+    BRepCheck_Analyzer aChecker(shape);
+#endif
+    bool valid = aChecker.IsValid() ? true : false;
+    setValidity(shape, valid);
+    return valid;
+}
+
+bool ShapeCheckCache::isFixed(const TopoDS_Shape& shape)
+{
+    if (shape.IsNull()) {
+        return false;
+    }
+    return Cache::instance().lookup(shape, [](const Entry* entry) {
+        return entry && entry->fixed;
+    });
+}
+
+void ShapeCheckCache::setFixed(const TopoDS_Shape& shape)
+{
+    if (shape.IsNull()) {
+        return;
+    }
+    Cache::instance().update(shape, [](Entry& entry) {
+        entry.fixed = true;
+    });
+}
+
+void ShapeCheckCache::invalidate(const TopoDS_Shape& shape)
+{
+    if (!shape.IsNull()) {
+        Cache::instance().remove(shape);
+    }
+}
+
+void ShapeCheckCache::clear()
+{
+    Cache::instance().clear();
+}
+
+std::size_t ShapeCheckCache::size()
+{
+    return Cache::instance().size();
+}
@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#pragma once
+
+#include <cstddef>
+
+#include <Mod/Part/PartGlobal.h>
+
+class TopoDS_Shape;
+
+namespace Part
+{
+
+/**
+ * @brief Process wide cache of shape check and healing results
+ *
+ * The results are keyed by the TShape, so they are shared by all copies,
+ * locations and orientations of a shape, e.g. an unchanged BaseFeature that
+ * is checked again on every recompute. Each entry also records a cheap
+ * signature of the sub-shapes and their tolerances, and is dropped when the
+ * signature no longer matches, i.e. when the shape was modified in place.
+ * Only a limited number of recently used shapes is kept.
+ */
+namespace ShapeCheckCache
+{
+
+enum class Validity
+{
+    Unknown,
+    Valid,
+    Invalid,
+};
+
+/// Return the cached BRepCheck_Analyzer result of the shape
+Validity PartExport getValidity(const TopoDS_Shape& shape);
+/// Record the BRepCheck_Analyzer result of the shape
+void PartExport setValidity(const TopoDS_Shape& shape, bool valid);
+/// Return whether the shape is valid, running BRepCheck_Analyzer if not cached
+bool PartExport isValid(const TopoDS_Shape& shape);
+
+/// Return whether an earlier ShapeFix_Shape pass found nothing to fix in the shape
+bool PartExport isFixed(const TopoDS_Shape& shape);
+/// Record that ShapeFix_Shape found nothing to fix in the shape
+void PartExport setFixed(const TopoDS_Shape& shape);
+
+/// Drop the cached results of the shape, e.g. before modifying it in place
+void PartExport invalidate(const TopoDS_Shape& shape);
+/// Drop all cached results
+void PartExport clear();
+/// Return the number of cached shapes
+std::size_t PartExport size();
+
+}  // namespace ShapeCheckCache
+
+}  // namespace Part
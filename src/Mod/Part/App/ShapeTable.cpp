@@ -0,0 +1,174 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+#include <array>
+
+#include <BinTools.hxx>
+#include <BinTools_ShapeSet.hxx>
+#include <Standard_Failure.hxx>
+
+#include <Base/Exception.h>
+#include <Base/Reader.h>
+#include <Base/Writer.h>
+
+#include "PropertyTopoShape.h"
+#include "ShapeTable.h"
+
+
+using namespace Part;
+
+namespace
+{
+// The tables of the documents currently being saved or restored
+std::map<const void*, std::shared_ptr<ShapeTable>> writerTables;
+std::map<const void*, std::shared_ptr<ShapeTable>> readerTables;
+
+// See BinTools_FormatVersion of OCCT 7.6
+constexpr int BinToolsVersion = 3;
+}  // namespace
+
+ShapeTable::ShapeTable() = default;
+
+ShapeTable::~ShapeTable() = default;
+
+std::shared_ptr<ShapeTable> ShapeTable::forWriter(Base::Writer& writer)
+{
+    auto& table = writerTables[&writer];
+    // A table left behind by an aborted save is not registered with a new
+    // writer that happens to reuse the same address
+    if (!table || !writer.isRegistered(table.get())) {
+        table = std::make_shared<ShapeTable>();
+        table->owner = &writer;
+        table->fileName = writer.addFile("Shapes.bin", table.get());
+    }
+    return table;
+}
+
+std::shared_ptr<ShapeTable> ShapeTable::forReader(Base::XMLReader& reader, const char* file)
+{
+    auto& table = readerTables[&reader];
+    if (!table || !reader.isRegistered(table.get())) {
+        table = std::make_shared<ShapeTable>();
+        table->owner = &reader;
+        table->fileName = reader.addFile(file, table.get());
+    }
+    return table;
+}
+
+int ShapeTable::addShape(const TopoDS_Shape& shape)
+{
+    shapes.push_back(shape);
+    return static_cast<int>(shapes.size()) - 1;
+}
+
+void ShapeTable::addProperty(PropertyPartShape* prop, int index)
+{
+    properties.emplace_back(prop, index);
+}
+
+unsigned int ShapeTable::getMemSize() const
+{
+    return static_cast<unsigned int>(shapes.size() * sizeof(TopoDS_Shape));
+}
+
+void ShapeTable::Save(Base::Writer& /*writer*/) const
+{
+    // the table is only stored as a separate file, see SaveDocFile()
+}
+
+void ShapeTable::Restore(Base::XMLReader& /*reader*/)
+{}
+
+void ShapeTable::SaveDocFile(Base::Writer& writer) const
+{
+    BinTools_ShapeSet shapeSet;
+    shapeSet.SetFormatNb(BinToolsVersion);
+
+    std::vector<std::array<Standard_Integer, 3>> refs;
+    refs.reserve(shapes.size());
+    for (const auto& shape : shapes) {
+        Standard_Integer shapeId = shapeSet.Add(shape);
+        Standard_Integer locId = shapeSet.Locations().Index(shape.Location());
+        refs.push_back({shapeId, locId, static_cast<Standard_Integer>(shape.Orientation())});
+    }
+
+    std::ostream& out = writer.Stream();
+    BinTools::PutInteger(out, Version);
+    BinTools::PutInteger(out, static_cast<Standard_Integer>(refs.size()));
+    shapeSet.Write(out);
+    for (const auto& ref : refs) {
+        BinTools::PutInteger(out, ref[0]);
+        BinTools::PutInteger(out, ref[1]);
+        BinTools::PutInteger(out, ref[2]);
+    }
+
+    // The shapes are not needed any more once they are written
+    auto self = shared_from_this();
+    writerTables.erase(owner);
+}
+
+void ShapeTable::RestoreDocFile(Base::Reader& reader)
+{
+    auto self = shared_from_this();
+    readerTables.erase(owner);
+
+    Standard_Integer version = 0;
+    Standard_Integer count = 0;
+    BinTools::GetInteger(reader, version);
+    if (version < 1 || version > Version) {
+        throw Base::FileException("Unsupported shape table version", fileName);
+    }
+    BinTools::GetInteger(reader, count);
+
+    BinTools_ShapeSet shapeSet;
+    try {
+        shapeSet.Read(reader);
+        shapes.resize(count);
+        for (auto& shape : shapes) {
+            Standard_Integer shapeId = 0;
+            Standard_Integer locId = 0;
+            Standard_Integer orient = 0;
+            BinTools::GetInteger(reader, shapeId);
+            BinTools::GetInteger(reader, locId);
+            BinTools::GetInteger(reader, orient);
+            if (shapeId > 0 && shapeId <= shapeSet.NbShapes()) {
+                shape = shapeSet.Shape(shapeId);
+                shape.Location(shapeSet.Locations().Location(locId));
+                shape.Orientation(static_cast<TopAbs_Orientation>(orient));
+            }
+        }
+    }
+    catch (Standard_Failure&) {
+        throw Base::FileException("Failed to read shape table", fileName);
+    }
+
+    for (const auto& [prop, index] : properties) {
+        if (index >= 0 && index < static_cast<int>(shapes.size())) {
+            prop->setRestoredShape(shapes[index]);
+        }
+    }
+    properties.clear();
+    shapes.clear();
+}
@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <TopoDS_Shape.hxx>
+
+#include <Base/Persistence.h>
+#include <Mod/Part/PartGlobal.h>
+
+namespace Base
+{
+class Writer;
+class XMLReader;
+}  // namespace Base
+
+namespace Part
+{
+
+class PropertyPartShape;
+
+/** Document wide storage of the shapes of PropertyPartShape
+ *
+ * If a document is saved with the writer mode "SharedBrep", the shapes of all
+ * PropertyPartShape are collected into one binary shape set that is written as a
+ * single file instead of one BREP file per property. Sub-shapes shared between
+ * features, e.g. the faces a PartDesign feature keeps from its base feature, are
+ * then only stored once, and they are shared again in memory after loading.
+ *
+ * The file starts with a format version followed by an OCC binary shape set and
+ * the (shape, location, orientation) index triple of each stored shape.
+ */
+class PartExport ShapeTable: public Base::Persistence, public std::enable_shared_from_this<ShapeTable>
+{
+public:
+    static constexpr int Version = 1;
+
+    ShapeTable();
+    ~ShapeTable() override;
+
+    /// Get the table collecting the shapes saved by \a writer
+    static std::shared_ptr<ShapeTable> forWriter(Base::Writer& writer);
+    /// Get the table providing the shapes restored by \a reader from \a file
+    static std::shared_ptr<ShapeTable> forReader(Base::XMLReader& reader, const char* file);
+
+    /// The file name of the table in the archive
+    const std::string& getFileName() const
+    {
+        return fileName;
+    }
+    /// Add a shape to be saved and return its index in the table
+    int addShape(const TopoDS_Shape& shape);
+    /// Assign the shape with \a index to \a prop once the table has been read
+    void addProperty(PropertyPartShape* prop, int index);
+
+    /** @name Save/restore */
+    //@{
+    unsigned int getMemSize() const override;
+    void Save(Base::Writer& writer) const override;
+    void Restore(Base::XMLReader& reader) override;
+    void SaveDocFile(Base::Writer& writer) const override;
+    void RestoreDocFile(Base::Reader& reader) override;
+    //@}
+
+    ShapeTable(const ShapeTable&) = delete;
+    ShapeTable& operator=(const ShapeTable&) = delete;
+
+private:
+    std::string fileName;
+    std::vector<TopoDS_Shape> shapes;
+    std::vector<std::pair<PropertyPartShape*, int>> properties;
+    const void* owner = nullptr;
+};
+
+}  // namespace Part
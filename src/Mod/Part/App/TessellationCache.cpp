@@ -0,0 +1,258 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+#include <unordered_set>
+
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepTools.hxx>
+#include <BRep_Tool.hxx>
+#include <IMeshTools_Parameters.hxx>
+#include <Standard_Version.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
+#include <QtConcurrentMap>
+
+#include "ParallelPolicy.h"
+#include "TessellationCache.h"
+
+
+using namespace Part;
+
+namespace
+{
+// The triangulation of the first face identifies the meshing run, shapes without faces
+// aren't cached
+Handle(Poly_Triangulation) getProbe(const TopoDS_Shape& shape)
+{
+    TopExp_Explorer xp(shape, TopAbs_FACE);
+    if (!xp.More()) {
+        return {};
+    }
+
+    TopLoc_Location loc;
+    return BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc);
+}
+}  // namespace
+
+bool TessellationCache::Parameters::operator==(const Parameters& other) const
+{
+    return deflection == other.deflection && angularDeflection == other.angularDeflection
+        && relative == other.relative;
+}
+
+TessellationCache& TessellationCache::instance()
+{
+    static TessellationCache cache;
+    return cache;
+}
+
+const TessellationCache::Entry* TessellationCache::findValid(const TopoDS_Shape& shape) const
+{
+    if (shape.IsNull()) {
+        return nullptr;
+    }
+
+    auto it = entries.find(shape.TShape().get());
+    if (it == entries.end()) {
+        return nullptr;
+    }
+
+    Handle(Poly_Triangulation) probe = getProbe(shape);
+    if (probe.IsNull() || probe != it->second.probe) {
+        return nullptr;
+    }
+
+    lru.splice(lru.begin(), lru, it->second.lru);
+    return &it->second;
+}
+
+bool TessellationCache::isMeshed(const TopoDS_Shape& shape, const Parameters& params) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    const Entry* entry = findValid(shape);
+    return entry && entry->params == params;
+}
+
+bool TessellationCache::isMeshed(const TopoDS_Shape& shape) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return findValid(shape) != nullptr;
+}
+
+bool TessellationCache::hasTriangulation(const TopoDS_Shape& shape)
+{
+    if (shape.IsNull()) {
+        return false;
+    }
+
+    for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+        TopLoc_Location loc;
+        if (BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc).IsNull()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TessellationCache::mesh(const TopoDS_Shape& shape, const Parameters& params)
+{
+    if (shape.IsNull()) {
+        return false;
+    }
+
+    // BRepMesh writes the triangulation into the shared TShapes
+    std::lock_guard<std::mutex> meshLock(meshMutex);
+    if (isMeshed(shape, params)) {
+        return false;
+    }
+
+    meshShape(shape, params, params.parallel);
+    return true;
+}
+
+std::size_t TessellationCache::mesh(const std::vector<std::pair<TopoDS_Shape, Parameters>>& shapes)
+{
+    std::lock_guard<std::mutex> meshLock(meshMutex);
+    std::vector<std::pair<TopoDS_Shape, Parameters>> pending;
+    for (const auto& item : shapes) {
+        if (!item.first.IsNull()) {
+            pending.push_back(item);
+        }
+    }
+    std::size_t count = 0;
+
+    // Many small shapes gain more from meshing them side by side than from
+    // BRepMesh's own face parallelism. Each round takes the shapes that share
+    // no face or edge with another shape of the round, the rest waits for the
+    // next round.
+    while (!pending.empty()) {
+        std::vector<std::pair<TopoDS_Shape, Parameters>> batch;
+        std::vector<std::pair<TopoDS_Shape, Parameters>> deferred;
+        std::unordered_set<const TopoDS_TShape*> claimed;
+        for (auto& item : pending) {
+            // copies of a shape meshed in the previous round are done
+            if (isMeshed(item.first, item.second)) {
+                continue;
+            }
+            std::vector<const TopoDS_TShape*> subShapes;
+            bool shared = false;
+            for (auto type : {TopAbs_FACE, TopAbs_EDGE}) {
+                for (TopExp_Explorer xp(item.first, type); xp.More() && !shared; xp.Next()) {
+                    const TopoDS_TShape* tshape = xp.Current().TShape().get();
+                    shared = claimed.count(tshape) > 0;
+                    subShapes.push_back(tshape);
+                }
+            }
+            if (shared) {
+                deferred.push_back(std::move(item));
+                continue;
+            }
+            claimed.insert(subShapes.begin(), subShapes.end());
+            batch.push_back(std::move(item));
+        }
+
+        if (batch.size() > 1 && ParallelPolicy::isEnabled(ParallelPolicy::Algorithm::Mesh)) {
+            QtConcurrent::blockingMap(batch, [this](const std::pair<TopoDS_Shape, Parameters>& item) {
+                meshShape(item.first, item.second, false);
+            });
+        }
+        else {
+            for (const auto& item : batch) {
+                meshShape(item.first, item.second, item.second.parallel);
+            }
+        }
+        count += batch.size();
+        pending = std::move(deferred);
+    }
+    return count;
+}
+
+void TessellationCache::meshShape(const TopoDS_Shape& shape, const Parameters& params, bool inParallel)
+{
+    // Clear triangulation and PCurves from geometry which can slow down the process
+#if OCC_VERSION_HEX < 0x070600
+    BRepTools::Clean(shape);
+#else
+    BRepTools::Clean(shape, Standard_True);
+#endif
+
+    IMeshTools_Parameters meshParams;
+    meshParams.Deflection = params.deflection;
+    meshParams.Relative = params.relative;
+    meshParams.Angle = params.angularDeflection;
+    meshParams.InParallel = inParallel
+        && ParallelPolicy::useParallel(ParallelPolicy::Algorithm::Mesh);
+    meshParams.AllowQualityDecrease = params.allowQualityDecrease;
+    BRepMesh_IncrementalMesh(shape, meshParams);
+
+    Handle(Poly_Triangulation) probe = getProbe(shape);
+    if (probe.IsNull()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    const TopoDS_TShape* key = shape.TShape().get();
+    auto it = entries.find(key);
+    if (it == entries.end()) {
+        lru.push_front(key);
+        it = entries.emplace(key, Entry {params, probe, lru.begin()}).first;
+    }
+    else {
+        it->second.params = params;
+        it->second.probe = probe;
+        lru.splice(lru.begin(), lru, it->second.lru);
+    }
+
+    while (entries.size() > MaxEntries) {
+        entries.erase(lru.back());
+        lru.pop_back();
+    }
+}
+
+void TessellationCache::remove(const TopoDS_Shape& shape)
+{
+    if (shape.IsNull()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(shape.TShape().get());
+    if (it != entries.end()) {
+        lru.erase(it->second.lru);
+        entries.erase(it);
+    }
+}
+
+void TessellationCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    lru.clear();
+}
+
+std::size_t TessellationCache::size() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
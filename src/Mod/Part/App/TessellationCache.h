@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <Poly_Triangulation.hxx>
+#include <TopoDS_Shape.hxx>
+
+#include <Mod/Part/PartGlobal.h>
+
+class TopoDS_TShape;
+
+namespace Part
+{
+
+/** Book keeping of the triangulations stored on shapes
+ *
+ * BRepMesh stores the triangulation of a face on its TShape, so all copies of a
+ * shape share it. The 3D view, the mesh export and the file exporters used to
+ * clean and re-mesh the shape each time even if it had been triangulated with
+ * the same settings before. The cache remembers with which parameters a shape
+ * was meshed so that later requests with the same parameters reuse the stored
+ * triangulation.
+ *
+ * Entries are keyed by the TShape and validated against the triangulation of
+ * the first face, so re-meshing or cleaning the shape elsewhere invalidates
+ * them. The number of entries is bounded and the least recently used ones are
+ * dropped first.
+ *
+ * Meshing runs are serialized, so shapes can be meshed from worker threads even if
+ * they share sub-shapes. A batch of shapes is meshed concurrently as far as the shapes
+ * don't share faces or edges.
+ */
+class PartExport TessellationCache
+{
+public:
+    struct PartExport Parameters
+    {
+        double deflection = 0.0;
+        /// Angular deflection in radians
+        double angularDeflection = 0.5;
+        bool relative = false;
+        /// The shape is cleaned before meshing, so these don't affect the result and
+        /// aren't part of the key
+        bool allowQualityDecrease = false;
+        bool parallel = true;
+
+        bool operator==(const Parameters& other) const;
+    };
+
+    static TessellationCache& instance();
+
+    /// Triangulate \a shape unless it already has a triangulation made with \a params.
+    /// Returns true if the shape had to be meshed.
+    bool mesh(const TopoDS_Shape& shape, const Parameters& params);
+    /// Triangulate each shape of \a shapes with its parameters, see mesh().
+    /// Returns the number of shapes that had to be meshed.
+    std::size_t mesh(const std::vector<std::pair<TopoDS_Shape, Parameters>>& shapes);
+    /// Check if \a shape has a triangulation made with \a params
+    bool isMeshed(const TopoDS_Shape& shape, const Parameters& params) const;
+    /// Check if \a shape has a triangulation made through the cache with any parameters
+    bool isMeshed(const TopoDS_Shape& shape) const;
+    /// Check if all faces of \a shape have a triangulation, no matter where it comes from
+    static bool hasTriangulation(const TopoDS_Shape& shape);
+    /// Forget about the triangulation of \a shape
+    void remove(const TopoDS_Shape& shape);
+    void clear();
+    std::size_t size() const;
+
+    static constexpr std::size_t MaxEntries = 1024;
+
+private:
+    TessellationCache() = default;
+
+    struct Entry
+    {
+        Parameters params;
+        Handle(Poly_Triangulation) probe;
+        std::list<const TopoDS_TShape*>::iterator lru;
+    };
+
+    const Entry* findValid(const TopoDS_Shape& shape) const;
+    // Mesh and store the shape, the caller holds meshMutex
+    void meshShape(const TopoDS_Shape& shape, const Parameters& params, bool inParallel);
+
+    std::unordered_map<const TopoDS_TShape*, Entry> entries;
+    mutable std::list<const TopoDS_TShape*> lru;
+    mutable std::mutex mutex;
+    std::mutex meshMutex;
+};
+
+}  // namespace Part
@@ -122,6 +122,9 @@
 #include <Law_BSpline.hxx>
 #include <Law_BSpFunc.hxx>
 #include <Law_Constant.hxx>
+#include <Poly_Polygon3D.hxx>
+#include <Poly_PolygonOnTriangulation.hxx>
+#include <Poly_Triangulation.hxx>
 #include <ShapeAnalysis_FreeBoundsProperties.hxx>
 #include <ShapeExtend_Explorer.hxx>
 #include <ShapeFix_Shape.hxx>
@@ -190,6 +193,8 @@
 #include "TopoShapeVertexPy.h"
 #include "TopoShapeWirePy.h"
 #include "OCCTProgressIndicator.h"
+#include "ParallelPolicy.h"
+#include "ShapeCheckCache.h"
 
 FC_LOG_LEVEL_INIT("TopoShape", true, true)
 
@@ -1004,7 +1009,7 @@ void TopoShape::exportStl(const char* filename, double deflection) const
         /*isRelative*/ Standard_False,
         /*theAngDeflection*/
         defaultAngularDeflection(deflection),
-        /*isInParallel*/ true
+        /*isInParallel*/ ParallelPolicy::useParallel(ParallelPolicy::Algorithm::Mesh)
     );
     writer.Write(this->_Shape, encodeFilename(filename).c_str());
 }
@@ -1033,7 +1038,7 @@ void TopoShape::exportFaceSet(
         /*isRelative*/ Standard_False,
         /*theAngDeflection*/
         defaultAngularDeflection(dev),
-        /*isInParallel*/ true
+        /*isInParallel*/ ParallelPolicy::useParallel(ParallelPolicy::Algorithm::Mesh)
     );
     for (ex.Init(this->_Shape, TopAbs_FACE); ex.More(); ex.Next(), index++) {
         // get the shape and mesh it
@@ -1295,6 +1300,20 @@ unsigned int TopoShape::getMemSize() const
                     // first, last, tolerance
                     memsize += 5 * sizeof(Standard_Real);
                     const TopoDS_Face& face = TopoDS::Face(shape);
+                    // the tessellation is often larger than the geometry
+                    TopLoc_Location loc;
+                    Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(face, loc);
+                    if (!mesh.IsNull()) {
+                        memsize += sizeof(Poly_Triangulation);
+                        memsize += mesh->NbNodes() * sizeof(gp_Pnt);
+                        memsize += mesh->NbTriangles() * sizeof(Poly_Triangle);
+                        if (mesh->HasUVNodes()) {
+                            memsize += mesh->NbNodes() * sizeof(gp_Pnt2d);
+                        }
+                        if (mesh->HasNormals()) {
+                            memsize += mesh->NbNodes() * 3 * sizeof(Standard_ShortReal);
+                        }
+                    }
                     // if no geometry is attached to a face an exception is raised
                     BRepAdaptor_Surface surface;
                     try {
@@ -1354,6 +1373,19 @@ unsigned int TopoShape::getMemSize() const
                     // first, last, tolerance
                     memsize += 3 * sizeof(Standard_Real);
                     const TopoDS_Edge& edge = TopoDS::Edge(shape);
+                    TopLoc_Location loc;
+                    Handle(Poly_Polygon3D) polygon = BRep_Tool::Polygon3D(edge, loc);
+                    if (!polygon.IsNull()) {
+                        memsize += sizeof(Poly_Polygon3D) + polygon->NbNodes() * sizeof(gp_Pnt);
+                    }
+                    Handle(Poly_PolygonOnTriangulation) polyOnTria;
+                    Handle(Poly_Triangulation) tria;
+                    BRep_Tool::PolygonOnTriangulation(edge, polyOnTria, tria, loc);
+                    if (!polyOnTria.IsNull()) {
+                        memsize += sizeof(Poly_PolygonOnTriangulation);
+                        memsize += polyOnTria->NbNodes()
+                            * (sizeof(Standard_Integer) + sizeof(Standard_Real));
+                    }
                     // if no geometry is attached to an edge an exception is raised
                     BRepAdaptor_Curve curve;
                     try {
@@ -1408,6 +1440,9 @@ unsigned int TopoShape::getMemSize() const
             }
         }
 
+        // the element map
+        memsize += Data::ComplexGeoData::getMemSize();
+
         // estimated memory usage
         return memsize;
     }
@@ -1423,8 +1458,7 @@ bool TopoShape::isNull() const
 
 bool TopoShape::isValid() const
 {
-    BRepCheck_Analyzer aChecker(this->_Shape);
-    return aChecker.IsValid() ? true : false;
+    return ShapeCheckCache::isValid(this->_Shape);
 }
 
 bool TopoShape::isEmpty() const
@@ -1471,7 +1505,21 @@ std::vector<std::string> buildBOPCheckResultVector()
 bool TopoShape::analyze(bool runBopCheck, std::ostream& str) const
 {
     if (!this->_Shape.IsNull()) {
+        // The detailed report is only needed for invalid shapes
+        if (!runBopCheck
+            && ShapeCheckCache::getValidity(this->_Shape) == ShapeCheckCache::Validity::Valid) {
+            return true;
+        }
+#if OCC_VERSION_HEX >= 0x070600
+        BRepCheck_Analyzer aChecker(
+            this->_Shape,
+            /*GeomControls*/ Standard_True,
+            /*theIsParallel*/ ParallelPolicy::useParallel(ParallelPolicy::Algorithm::Check)
+        );
+#else
         BRepCheck_Analyzer aChecker(this->_Shape);
+#endif
+        ShapeCheckCache::setValidity(this->_Shape, aChecker.IsValid());
         if (!aChecker.IsValid()) {
             std::vector<TopoDS_Shape> shapes;
 
@@ -1660,8 +1708,9 @@ bool TopoShape::analyze(bool runBopCheck, std::ostream& str) const
             BOPCheck.SmallEdgeMode() = true;
             BOPCheck.RebuildFaceMode() = true;
             BOPCheck.ContinuityMode() = true;
-            BOPCheck.SetParallelMode(true);  // this doesn't help for speed right now(occt 6.9.1).
-            BOPCheck.SetRunParallel(true);   // performance boost, use all available cores
+            bool parallel = ParallelPolicy::useParallel(ParallelPolicy::Algorithm::Check);
+            BOPCheck.SetParallelMode(parallel);  // this doesn't help for speed right now(occt 6.9.1).
+            BOPCheck.SetRunParallel(parallel);   // performance boost, use all available cores
             BOPCheck.TangentMode() = true;   // these 4 new tests add about 5% processing time.
             BOPCheck.MergeVertexMode() = true;
             BOPCheck.CurveOnSurfaceMode() = true;
@@ -1760,7 +1809,7 @@ TopoDS_Shape TopoShape::cut(const std::vector<TopoDS_Shape>& shapes, Standard_Re
         return this->_Shape;
     }
     FCBRepAlgoAPI_Cut mkCut;
-    mkCut.SetRunParallel(true);
+    mkCut.SetRunParallel(ParallelPolicy::useParallel(ParallelPolicy::Algorithm::Boolean));
     TopTools_ListOfShape shapeArguments, shapeTools;
     shapeArguments.Append(this->_Shape);
     for (const auto& shape : shapes) {
@@ -1809,7 +1858,7 @@ TopoDS_Shape TopoShape::common(const std::vector<TopoDS_Shape>& shapes, Standard
         return this->_Shape;
     }
     FCBRepAlgoAPI_Common mkCommon;
-    mkCommon.SetRunParallel(true);
+    mkCommon.SetRunParallel(ParallelPolicy::useParallel(ParallelPolicy::Algorithm::Boolean));
     TopTools_ListOfShape shapeArguments, shapeTools;
     shapeArguments.Append(this->_Shape);
     for (const auto& shape : shapes) {
@@ -1859,7 +1908,7 @@ TopoDS_Shape TopoShape::fuse(const std::vector<TopoDS_Shape>& shapes, Standard_R
     }
 
     FCBRepAlgoAPI_Fuse mkFuse;
-    mkFuse.SetRunParallel(true);
+    mkFuse.SetRunParallel(ParallelPolicy::useParallel(ParallelPolicy::Algorithm::Boolean));
     TopTools_ListOfShape shapeArguments, shapeTools;
     shapeArguments.Append(this->_Shape);
     for (const auto& shape : shapes) {
@@ -1924,7 +1973,7 @@ TopoDS_Shape TopoShape::section(
     }
 
     FCBRepAlgoAPI_Section mkSection;
-    mkSection.SetRunParallel(true);
+    mkSection.SetRunParallel(ParallelPolicy::useParallel(ParallelPolicy::Algorithm::Boolean));
     mkSection.Approximation(approximate);
     TopTools_ListOfShape shapeArguments, shapeTools;
     shapeArguments.Append(this->_Shape);
@@ -1964,11 +2013,8 @@ std::list<TopoDS_Wire> TopoShape::slice(const Base::Vector3d& dir, double d) con
 
 TopoDS_Compound TopoShape::slices(const Base::Vector3d& dir, const std::vector<double>& d) const
 {
-    std::vector<std::list<TopoDS_Wire>> wire_list;
     CrossSection cs(dir.x, dir.y, dir.z, this->_Shape);
-    for (double jt : d) {
-        wire_list.push_back(cs.slice(jt));
-    }
+    std::vector<std::list<TopoDS_Wire>> wire_list = cs.slices(d);
 
     std::vector<std::list<TopoDS_Wire>>::const_iterator ft;
     TopoDS_Compound comp;
@@ -1998,7 +2044,7 @@ TopoDS_Shape TopoShape::generalFuse(
     }
 
     BRepAlgoAPI_BuilderAlgo mkGFA;
-    mkGFA.SetRunParallel(true);
+    mkGFA.SetRunParallel(ParallelPolicy::useParallel(ParallelPolicy::Algorithm::Boolean));
     TopTools_ListOfShape GFAArguments;
     GFAArguments.Append(this->_Shape);
     for (const TopoDS_Shape& it : sOthers) {
@@ -3389,11 +3435,18 @@ bool TopoShape::fix()
     // BTW, the file attached in the issue also shows that ShapeFix_Shape may
     // actually make a valid input shape invalid). So, it actually change the
     // underlying shape data. Therefore, we try with a copy first.
+    //
+    // Unchanged inputs are fixed again and again on recompute, so remember
+    // the shapes where the fix above found nothing to do.
+    if (ShapeCheckCache::isFixed(this->_Shape)) {
+        return false;
+    }
     auto copy = makeElementCopy();
     ShapeFix_Shape fix(copy._Shape);
     fix.Perform();
 
     if (fix.Shape().IsSame(copy._Shape)) {
+        ShapeCheckCache::setFixed(this->_Shape);
         return false;
     }
 
@@ -3405,6 +3458,7 @@ bool TopoShape::fix()
     // If the above fix produces a valid shape, then we fix the original shape,
     // because BRepBuilderAPI_Copy has some undesired side effect (e.g. flatten
     // underlying shape, and thus break internal shape sharing).
+    ShapeCheckCache::invalidate(this->_Shape);
     ShapeFix_Shape fixThis(this->_Shape);
     fixThis.Perform();
 
@@ -3435,6 +3489,8 @@ bool TopoShape::fix(double precision, double mintol, double maxtol)
 
     TopAbs_ShapeEnum type = this->_Shape.ShapeType();
 
+    // ShapeFix may modify the shape in place
+    ShapeCheckCache::invalidate(this->_Shape);
     ShapeFix_Shape fix(this->_Shape);
     fix.SetPrecision(precision);
     fix.SetMinTolerance(mintol);
@@ -3661,7 +3717,7 @@ void TopoShape::
         /*isRelative*/ Standard_False,
         /*theAngDeflection*/
         defaultAngularDeflection(accuracy),
-        /*isInParallel*/ true
+        /*isInParallel*/ ParallelPolicy::useParallel(ParallelPolicy::Algorithm::Mesh)
     );
     std::vector<Domain> domains;
     getDomains(domains);
@@ -4029,7 +4085,7 @@ TopoDS_Shape TopoShape::defeaturing(const std::vector<TopoDS_Shape>& s) const
         Standard_Failure::Raise("Base shape is null");
     }
     BRepAlgoAPI_Defeaturing defeat;
-    defeat.SetRunParallel(true);
+    defeat.SetRunParallel(ParallelPolicy::useParallel(ParallelPolicy::Algorithm::Boolean));
     defeat.SetShape(this->_Shape);
     for (const auto& it : s) {
         defeat.AddFaceToRemove(it);
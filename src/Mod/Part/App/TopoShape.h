@@ -41,6 +41,7 @@
 #include <BRepOffsetAPI_MakePipeShell.hxx>
 #include <BRepFeat_MakePrism.hxx>
 #include <BRepPrimAPI_MakeHalfSpace.hxx>
+#include <BOPAlgo_GlueEnum.hxx>
 #include <BRepTools_History.hxx>
 #include <BRepTools_ReShape.hxx>
 #include <ShapeFix_Root.hxx>
@@ -272,6 +273,19 @@ enum class RevolMode
     None = 2
 };
 
+/// Options for TopoShape::makeElementBatchBoolean()
+struct BatchBooleanOptions
+{
+    /// Fuzzy value of the intersection. Zero disables it, a negative value
+    /// derives it from the size of the inputs and the BooleanFuzzy parameter.
+    double fuzzyValue = -1.0;
+    /// Glue option, only safe to turn on if the inputs are known to only
+    /// share coinciding (or no) sub-shapes, e.g. tools that do not overlap.
+    BOPAlgo_GlueEnum glue = BOPAlgo_GlueOff;
+    /// Run the intersections in parallel, if also enabled by ParallelPolicy
+    bool runParallel = true;
+};
+
 /** The representation for a CAD Shape
  */
 // NOLINTNEXTLINE cppcoreguidelines-special-member-functions
@@ -932,6 +946,42 @@ public:
         return TopoShape(Tag, Hasher).makeElementRefine(*this, op, no_fail);
     }
 
+    /** Refine only the faces of a shape that were changed by the last operation
+     *
+     * @param shape: input shape, usually the result of a boolean operation
+     * @param base: the already refined shape the operation started from. Faces
+     *              of \a shape that are shared with \a base are taken as refined,
+     *              so only the generated or modified faces and their neighbours
+     *              are considered for merging. A null \a base refines every face.
+     * @param op: optional string to be encoded into topo naming for indicating
+     *            the operation
+     * @param no_fail: if throwException, throw exception if failed to refine. Or else,
+     *                 if shapeUntouched the shape remains untouched if failed.
+     *
+     * @return The function returns the TopoShape itself as a self reference so
+     *         that multiple operations can be carried out for the same shape in
+     *         the same line of code.
+     */
+    TopoShape& makeElementIncrementalRefine(
+        const TopoShape& shape,
+        const TopoShape& base,
+        const char* op = nullptr,
+        RefineFail no_fail = RefineFail::throwException
+    );
+
+    /** Refine only the faces of this shape that are not shared with \a base
+     *
+     * @return Return a refined shape. The shape itself is not modified
+     */
+    TopoShape makeElementIncrementalRefine(
+        const TopoShape& base,
+        const char* op = nullptr,
+        RefineFail no_fail = RefineFail::throwException
+    ) const
+    {
+        return TopoShape(Tag, Hasher).makeElementIncrementalRefine(*this, base, op, no_fail);
+    }
+
 
     TopoShape& makeRefine(
         const TopoShape& shape,
@@ -1731,6 +1781,31 @@ public:
             return _res;
         }
     };
+
+    /** Scoped switch for deferred element map generation
+     *
+     * While an instance is alive, makeShapeWithElementMap() called on the
+     * current thread only records the shape history reported by the Mapper.
+     * The element map is generated from the record the first time it is
+     * accessed, e.g. through getElementName(), getMappedName() or when the
+     * shape is saved. Intermediate shapes whose names are never queried
+     * therefore skip the name encoding entirely.
+     */
+    class PartExport LazyElementMap
+    {
+    public:
+        explicit LazyElementMap(bool enable = true);
+        ~LazyElementMap();
+        LazyElementMap(const LazyElementMap&) = delete;
+        LazyElementMap& operator=(const LazyElementMap&) = delete;
+
+        /// Return whether deferred element map generation is active on this thread
+        static bool isEnabled();
+
+    private:
+        bool previous;
+    };
+
     /** Make an evolved shape
      *
      * An evolved shape is built from a planar spine (face or wire) and a
@@ -2148,6 +2223,33 @@ public:
         return TopoShape(0, Hasher).makeElementBoolean(maker, *this, op, tol);
     }
 
+    /** Boolean operation over many shapes in a single general fuse run
+     *
+     * @param maker: one of OpCodes::Fuse, OpCodes::Cut or OpCodes::Common
+     * @param sources: list of source shapes. Fuse unites all of them, Cut
+     *                 removes all but the first one from the first one, and
+     *                 Common intersects all of them.
+     * @param options: fuzzy value, glue and parallel options of the run
+     * @param op: optional string to be encoded into topo naming for indicating
+     *            the operation
+     *
+     * Unlike chaining makeElementBoolean(), all sources are intersected only
+     * once, and the result is then selected from the split pieces. This makes
+     * cutting many holes into a plate, or intersecting many shapes, cost a
+     * single boolean run.
+     *
+     * @return The original content of this TopoShape is discarded and replaced
+     *         with the new shape. The function returns the TopoShape itself as
+     *         a self reference so that multiple operations can be carried out
+     *         for the same shape in the same line of code.
+     */
+    TopoShape& makeElementBatchBoolean(
+        const char* maker,
+        const std::vector<TopoShape>& sources,
+        const BatchBooleanOptions& options = BatchBooleanOptions(),
+        const char* op = nullptr
+    );
+
     /** Make a mirrored shape
      *
      * @param source: the source shape
@@ -2991,6 +3093,9 @@ private:
         bool& warned
     );
     void mapCompoundSubElements(const std::vector<TopoShape>& shapes, const char* op);
+    void mapShapeElements(const Mapper& mapper, const std::vector<TopoShape>& shapes, const char* op);
+    static void prepareElementMaps(const std::vector<const TopoShape*>& shapes);
+    void recordShapeElements(const Mapper& mapper, const std::vector<TopoShape>& shapes, const char* op);
 
     /** Given a set of edges, return a sorted list of connected edges
      *
@@ -22,10 +22,126 @@
  *                                                                          *
  ***************************************************************************/
 
+#include <algorithm>
+#include <mutex>
+
 #include "TopoShapeCache.h"
 
 using namespace Part;
 
+namespace
+{
+
+/** Process wide registry of sub-shape maps
+ *
+ * Building the maps with TopExp is the expensive part of the cache. The maps
+ * only depend on the TShape and orientation of the cached shape (the location
+ * is applied on lookup), so TopoShape objects that are created again from the
+ * same TopoDS_Shape, e.g. after a copy with a new placement, can reuse them
+ * instead of exploring the shape again. Only shapes above face level are
+ * registered, smaller ones are cheap enough to map in place.
+ */
+class SharedMaps
+{
+public:
+    template<class Map, class Builder>
+    static std::shared_ptr<const Map> get(const TopoDS_Shape& shape, int kind, Builder build)
+    {
+        if (shape.ShapeType() >= TopAbs_FACE) {
+            auto res = std::make_shared<Map>();
+            build(shape, *res);
+            return res;
+        }
+
+        Key key {shape.TShape().get(), static_cast<int>(shape.Orientation()), kind};
+        auto& self = instance();
+        {
+            std::lock_guard<std::mutex> lock(self.mutex);
+            auto it = self.maps.find(key);
+            if (it != self.maps.end()) {
+                if (auto res = it->second.lock()) {
+                    return std::static_pointer_cast<const Map>(res);
+                }
+            }
+        }
+
+        // The holder keeps the TShape, and therefore the key, alive for as
+        // long as any cache uses the map.
+        struct Holder
+        {
+            TopoDS_Shape shape;
+            Map map;
+        };
+        auto holder = std::make_shared<Holder>();
+        holder->shape = shape;
+        build(shape, holder->map);
+        std::shared_ptr<const Map> res(holder, &holder->map);
+
+        std::lock_guard<std::mutex> lock(self.mutex);
+        auto& entry = self.maps[key];
+        if (auto existing = entry.lock()) {
+            return std::static_pointer_cast<const Map>(existing);
+        }
+        entry = res;
+        if (self.maps.size() > self.pruneSize) {
+            self.prune();
+        }
+        return res;
+    }
+
+private:
+    struct Key
+    {
+        const void* tshape;
+        int orientation;
+        int kind;
+
+        bool operator==(const Key& other) const
+        {
+            return tshape == other.tshape && orientation == other.orientation
+                && kind == other.kind;
+        }
+    };
+
+    struct KeyHasher
+    {
+        std::size_t operator()(const Key& key) const
+        {
+            std::size_t seed = std::hash<const void*>()(key.tshape);
+            seed ^= std::hash<int>()(key.orientation * 64 + key.kind) + 0x9e3779b9 + (seed << 6)
+                + (seed >> 2);
+            return seed;
+        }
+    };
+
+    static SharedMaps& instance()
+    {
+        static SharedMaps maps;
+        return maps;
+    }
+
+    void prune()
+    {
+        for (auto it = maps.begin(); it != maps.end();) {
+            if (it->second.expired()) {
+                it = maps.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+        pruneSize = std::max<std::size_t>(minPruneSize, maps.size() * 2);
+    }
+
+    static constexpr std::size_t minPruneSize = 1024;
+
+    std::mutex mutex;
+    std::unordered_map<Key, std::weak_ptr<const void>, KeyHasher> maps;
+    std::size_t pruneSize = minPruneSize;
+};
+
+}  // namespace
+
 ShapeRelationKey::ShapeRelationKey(Data::MappedName name, HistoryTraceType historyTraceType)
     : name(std::move(name))
     , historyTraceType(historyTraceType)
@@ -39,11 +155,17 @@ bool ShapeRelationKey::operator<(const ShapeRelationKey& other) const
     return name < other.name;
 }
 
+const TopTools_IndexedMapOfShape& TopoShapeCache::Ancestry::map() const
+{
+    static const TopTools_IndexedMapOfShape emptyMap;
+    return shapes ? *shapes : emptyMap;
+}
+
 TopoShape TopoShapeCache::Ancestry::_getTopoShape(const TopoShape& parent, int index)
 {
     auto& ts = topoShapes[index - 1];
     if (ts.isNull()) {
-        ts.setShape(shapes.FindKey(index), true);
+        ts.setShape(map().FindKey(index), true);
         ts.initCache();
         ts._cache->subLocation = ts._Shape.Location();
     }
@@ -97,16 +219,16 @@ void TopoShapeCache::Ancestry::clear()
 TopoShape TopoShapeCache::Ancestry::getTopoShape(const TopoShape& parent, int index)
 {
     TopoShape res;
-    if (index <= 0 || index > shapes.Extent()) {
+    if (index <= 0 || index > map().Extent()) {
         return res;
     }
-    topoShapes.resize(shapes.Extent());
+    topoShapes.resize(map().Extent());
     return _getTopoShape(parent, index);
 }
 
 std::vector<TopoShape> TopoShapeCache::Ancestry::getTopoShapes(const TopoShape& parent)
 {
-    int count = shapes.Extent();
+    int count = map().Extent();
     std::vector<TopoShape> res;
     res.reserve(count);
     topoShapes.resize(count);
@@ -128,30 +250,30 @@ TopoDS_Shape TopoShapeCache::Ancestry::stripLocation(const TopoDS_Shape& parent,
 int TopoShapeCache::Ancestry::find(const TopoDS_Shape& parent, const TopoDS_Shape& subShape)
 {
     if (parent.Location().IsIdentity()) {
-        return shapes.FindIndex(subShape);
+        return map().FindIndex(subShape);
     }
-    return shapes.FindIndex(stripLocation(parent, subShape));
+    return map().FindIndex(stripLocation(parent, subShape));
 }
 
 TopoDS_Shape TopoShapeCache::Ancestry::find(const TopoDS_Shape& parent, int index)
 {
-    if (index <= 0 || index > shapes.Extent()) {
+    if (index <= 0 || index > map().Extent()) {
         return {};
     }
     if (parent.Location().IsIdentity()) {
-        return shapes.FindKey(index);
+        return map().FindKey(index);
     }
-    return TopoShape::moved(shapes.FindKey(index), parent.Location());
+    return TopoShape::moved(map().FindKey(index), parent.Location());
 }
 
 int TopoShapeCache::Ancestry::count() const
 {
-    return shapes.Extent();
+    return map().Extent();
 }
 
 bool TopoShapeCache::Ancestry::empty() const
 {
-    return shapes.IsEmpty();
+    return map().IsEmpty();
 }
 
 TopoShapeCache::TopoShapeCache(const TopoDS_Shape& tds)
@@ -180,14 +302,20 @@ TopoShapeCache::Ancestry& TopoShapeCache::getAncestry(TopAbs_ShapeEnum type)
     if (!ancestry.owner) {
         ancestry.owner = this;
         if (!shape.IsNull()) {
-            if (type == TopAbs_SHAPE) {
-                for (TopoDS_Iterator it(shape); it.More(); it.Next()) {
-                    ancestry.shapes.Add(it.Value());
+            ancestry.shapes = SharedMaps::get<TopTools_IndexedMapOfShape>(
+                shape,
+                type,
+                [type](const TopoDS_Shape& s, TopTools_IndexedMapOfShape& map) {
+                    if (type == TopAbs_SHAPE) {
+                        for (TopoDS_Iterator it(s); it.More(); it.Next()) {
+                            map.Add(it.Value());
+                        }
+                    }
+                    else {
+                        TopExp::MapShapes(s, type, map);
+                    }
                 }
-            }
-            else {
-                TopExp::MapShapes(shape, type, ancestry.shapes);
-            }
+            );
         }
     }
     return ancestry;
@@ -234,16 +362,25 @@ TopoDS_Shape TopoShapeCache::findAncestor(
     auto& ancestorInfo = info.ancestors.at(subShape.ShapeType());
     if (!ancestorInfo.initialized) {
         ancestorInfo.initialized = true;
-        // ancestorInfo.shapes is the output variable here, storing (and caching) the actual map
-        TopExp::MapShapesAndAncestors(shape, subShape.ShapeType(), type, ancestorInfo.shapes);
+        auto subType = subShape.ShapeType();
+        // Ancestor maps are keyed after the plain sub-shape maps in the shared registry
+        int kind = (TopAbs_SHAPE + 1) * (subType + 1) + type;
+        ancestorInfo.shapes = SharedMaps::get<TopTools_IndexedDataMapOfShapeListOfShape>(
+            shape,
+            kind,
+            [subType, type](const TopoDS_Shape& s, TopTools_IndexedDataMapOfShapeListOfShape& map) {
+                TopExp::MapShapesAndAncestors(s, subType, type, map);
+            }
+        );
     }
+    const auto& ancestorMap = *ancestorInfo.shapes;
     int index = parent.Location().IsIdentity()
-        ? ancestorInfo.shapes.FindIndex(subShape)
-        : ancestorInfo.shapes.FindIndex(info.stripLocation(parent, subShape));
+        ? ancestorMap.FindIndex(subShape)
+        : ancestorMap.FindIndex(info.stripLocation(parent, subShape));
     if (index == 0) {
         return nullShape;
     }
-    const auto& shapes = ancestorInfo.shapes.FindFromIndex(index);
+    const auto& shapes = ancestorMap.FindFromIndex(index);
     if (shapes.Extent() == 0) {
         return nullShape;
     }
@@ -256,3 +393,30 @@ TopoDS_Shape TopoShapeCache::findAncestor(
     }
     return TopoShape::moved(shapes.First(), parent.Location());
 }
+
+void ShapeHistoryMapper::record(const TopoShape::Mapper& mapper, const TopoDS_Shape& shape)
+{
+    auto& entry = history[shape];
+    entry.modified = mapper.modified(shape);
+    entry.generated = mapper.generated(shape);
+}
+
+const std::vector<TopoDS_Shape>& ShapeHistoryMapper::generated(const TopoDS_Shape& shape) const
+{
+    auto it = history.find(shape);
+    if (it == history.end()) {
+        _res.clear();
+        return _res;
+    }
+    return it->second.generated;
+}
+
+const std::vector<TopoDS_Shape>& ShapeHistoryMapper::modified(const TopoDS_Shape& shape) const
+{
+    auto it = history.find(shape);
+    if (it == history.end()) {
+        _res.clear();
+        return _res;
+    }
+    return it->second.modified;
+}
@@ -32,12 +32,18 @@
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopTools_ListIteratorOfListOfShape.hxx>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <App/ElementMap.h>
 
 #include <Mod/Part/PartGlobal.h>
 
+#include "ShapeMapHasher.h"
 #include "TopoShape.h"
 
 namespace Part
@@ -52,6 +58,36 @@ struct PartExport ShapeRelationKey
     bool operator<(const ShapeRelationKey& other) const;
 };
 
+/// Mapper replaying the shape history recorded from another Mapper
+class PartExport ShapeHistoryMapper: public TopoShape::Mapper
+{
+public:
+    /// Query and store the generated and modified shapes of the given input shape
+    void record(const TopoShape::Mapper& mapper, const TopoDS_Shape& shape);
+
+    const std::vector<TopoDS_Shape>& generated(const TopoDS_Shape& shape) const override;
+    const std::vector<TopoDS_Shape>& modified(const TopoDS_Shape& shape) const override;
+
+private:
+    struct Entry
+    {
+        std::vector<TopoDS_Shape> generated;
+        std::vector<TopoDS_Shape> modified;
+    };
+    std::unordered_map<TopoDS_Shape, Entry, ShapeMapHasher> history;
+};
+
+/// Everything needed to run a deferred TopoShape::makeShapeWithElementMap()
+struct PartExport PendingElementMap
+{
+    long tag {0};
+    App::StringHasherRef hasher;
+    TopoDS_Shape shape;
+    std::vector<TopoShape> sources;
+    ShapeHistoryMapper mapper;
+    std::string op;
+};
+
 class PartExport TopoShapeCache: public std::enable_shared_from_this<TopoShapeCache>
 {
 public:
@@ -62,6 +98,14 @@ public:
     /// generated.
     Data::ElementMapPtr cachedElementMap;
 
+    /// Recorded shape history used to generate cachedElementMap on first
+    /// access, see TopoShape::LazyElementMap.
+    std::shared_ptr<PendingElementMap> pendingElementMap;
+
+    /// Guards generating cachedElementMap from pendingElementMap. Copies of a
+    /// shape share the cache and may be read from several threads at once.
+    std::recursive_mutex elementMapMutex;
+
     /// Location of the original cached TopoDS_Shape.
     TopLoc_Location subLocation;
 
@@ -78,7 +122,8 @@ public:
     struct PartExport AncestorInfo
     {
         bool initialized = false;
-        TopTools_IndexedDataMapOfShapeListOfShape shapes;
+        /// Shared with other caches of the same TShape.
+        std::shared_ptr<const TopTools_IndexedDataMapOfShapeListOfShape> shapes;
     };
 
     /// Class for caching the ancestor and children shapes mapping
@@ -88,8 +133,10 @@ public:
         TopoShapeCache* owner = nullptr;
 
         /// OCCT map from the owner TopoShape to a list of children (i.e. lower hierarchical)
-        /// TopoDS_Shape
-        TopTools_IndexedMapOfShape shapes;
+        /// TopoDS_Shape. Shared with other caches of the same TShape.
+        std::shared_ptr<const TopTools_IndexedMapOfShape> shapes;
+
+        const TopTools_IndexedMapOfShape& map() const;
 
         /// One-to-one corresponding TopoShape to each child TopoDS_Shape
         std::vector<TopoShape> topoShapes;
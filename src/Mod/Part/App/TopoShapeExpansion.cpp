@@ -29,6 +29,8 @@
 # include <Standard_Version.hxx>
 #endif
 
+#include <BOPAlgo_CellsBuilder.hxx>
+#include <Bnd_Box.hxx>
 #include <BRepAdaptor_Curve.hxx>
 #include <BRepAdaptor_CompCurve.hxx>
 #if OCC_VERSION_HEX < 0x070600
@@ -36,6 +38,7 @@
 # include <BRepAdaptor_HCompCurve.hxx>
 #endif
 
+#include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_MakeWire.hxx>
 #include <BRepCheck_Analyzer.hxx>
 #include <BRepFill.hxx>
@@ -83,9 +86,10 @@
 
 #include <boost/algorithm/string/predicate.hpp>
 
+#include <unordered_set>
 #include <utility>
 
-#include <OSD_Parallel.hxx>
+#include <QtConcurrentMap>
 
 #include <FCConfig.h>
 
@@ -96,15 +100,18 @@
 #include "TopoShapeCache.h"
 #include "TopoShapeMapper.h"
 #include "FaceMaker.h"
+#include "FuzzyHelper.h"
 #include "Geometry.h"
 #include "BRepOffsetAPI_MakeOffsetFix.h"
 #include "Base/BoundBox.h"
 #include "Base/Exception.h"
 #include "Base/Tools.h"
 #include "OCCTProgressIndicator.h"
+#include "ParallelPolicy.h"
 
 #include <App/ElementMap.h>
 #include <App/ElementNamingUtils.h>
+#include <App/RecomputeStats.h>
 #include <ShapeAnalysis_FreeBoundsProperties.hxx>
 #include <BRepFeat_MakeRevol.hxx>
 
@@ -135,6 +142,32 @@ static void expandCompound(const TopoShape& shape, std::vector<TopoShape>& res)
     }
 }
 
+/// Bounding boxes of boolean inputs, enlarged by the fuzzy value of the
+/// operation so that the boxes of any shapes that may interact overlap
+static std::vector<Bnd_Box> getBooleanBounds(const std::vector<TopoShape>& shapes, double tolerance)
+{
+    std::vector<Bnd_Box> boxes(shapes.size());
+    Bnd_Box total;
+    for (std::size_t i = 0; i < shapes.size(); ++i) {
+        // Use the geometry instead of a possibly coarse triangulation to
+        // stay on the safe side
+        BRepBndLib::Add(shapes[i].getShape(), boxes[i], Standard_False);
+        total.Add(boxes[i]);
+    }
+    double gap = 0.0;
+    if (tolerance > 0.0) {
+        gap = tolerance;
+    }
+    else if (tolerance < 0.0 && !total.IsVoid()) {
+        gap = FuzzyHelper::getBooleanFuzzy() * sqrt(total.SquareExtent()) * Precision::Confusion();
+    }
+    gap = 2.0 * std::max(gap, Precision::Confusion());
+    for (auto& box : boxes) {
+        box.Enlarge(gap);
+    }
+    return boxes;
+}
+
 void TopoShape::initCache(int reset) const
 {
     if (reset > 0 || !_cache || _cache->isTouched(_Shape)) {
@@ -158,6 +191,7 @@ Data::ElementMapPtr TopoShape::resetElementMap(Data::ElementMapPtr elementMap)
     }
     if (elementMap) {
         _cache->cachedElementMap = elementMap;
+        _cache->pendingElementMap.reset();
         _cache->subLocation.Identity();
         _subLocation.Identity();
         _parentCache.reset();
@@ -169,9 +203,19 @@ void TopoShape::flushElementMap() const
 {
     initCache();
     if (!elementMap(false) && this->_cache) {
+        std::lock_guard<std::recursive_mutex> lock(this->_cache->elementMapMutex);
         if (this->_cache->cachedElementMap) {
             const_cast<TopoShape*>(this)->resetElementMap(this->_cache->cachedElementMap);
         }
+        else if (this->_cache->pendingElementMap) {
+            // Take the record out first, so that the replay below does not
+            // come back here through the element map accessors.
+            auto pending = std::move(this->_cache->pendingElementMap);
+            TopoShape self(pending->tag, pending->hasher, pending->shape);
+            self._cache = _cache;
+            self.mapShapeElements(pending->mapper, pending->sources, pending->op.c_str());
+            const_cast<TopoShape*>(this)->resetElementMap(self.elementMap());
+        }
         else if (this->_parentCache) {
             TopoShape parent(this->Tag, this->Hasher, this->_parentCache->shape);
             parent._cache = _parentCache;
@@ -724,8 +768,12 @@ std::vector<TopoDS_Shape> TopoShape::findAncestorsShapes(
 
 bool TopoShape::hasPendingElementMap() const
 {
-    return !elementMap(false) && this->_cache
-        && (this->_parentCache || this->_cache->cachedElementMap);
+    if (elementMap(false) || !this->_cache) {
+        return false;
+    }
+    std::lock_guard<std::recursive_mutex> lock(this->_cache->elementMapMutex);
+    return this->_parentCache || this->_cache->cachedElementMap
+        || this->_cache->pendingElementMap;
 }
 
 bool TopoShape::canMapElement(const TopoShape& other) const
@@ -1056,6 +1104,44 @@ void TopoShape::mapCompoundSubElements(const std::vector<TopoShape>& shapes, con
     setMappedChildElements(children);
 }
 
+namespace
+{
+// Below these sizes the thread pool costs more than it saves
+constexpr std::size_t minParallelCaches {16};
+constexpr int minParallelElements {2048};
+}  // namespace
+
+void TopoShape::prepareElementMaps(const std::vector<const TopoShape*>& shapes)
+{
+    // Resolving a pending element map may touch the caches of other shapes,
+    // so it stays on the calling thread.
+    std::vector<TopoShapeCache*> caches;
+    std::unordered_set<TopoShapeCache*> seen;
+    for (auto shape : shapes) {
+        if (shape->isNull()) {
+            continue;
+        }
+        shape->elementMap();
+        shape->initCache();
+        if (seen.insert(shape->_cache.get()).second) {
+            caches.push_back(shape->_cache.get());
+        }
+    }
+    if (caches.size() < minParallelCaches) {
+        return;
+    }
+    // Building the sub-shape index is the expensive part for large children.
+    // Copies of the same shape (e.g. pattern instances) share a cache, and
+    // each cache is only ever touched by one task of this call. Other threads
+    // must not use the caches meanwhile, which is why Document::recompute()
+    // never runs objects sharing an input at the same time.
+    QtConcurrent::blockingMap(caches, [](TopoShapeCache* cache) {
+        for (auto type : {TopAbs_VERTEX, TopAbs_EDGE, TopAbs_FACE}) {
+            cache->countShape(type);
+        }
+    });
+}
+
 void TopoShape::mapSubElement(const std::vector<TopoShape>& shapes, const char* op)
 {
     if (shapes.empty()) {
@@ -1074,6 +1160,13 @@ void TopoShape::mapSubElement(const std::vector<TopoShape>& shapes, const char*
             }
         }
         if (count) {
+            std::vector<const TopoShape*> childShapes;
+            childShapes.reserve(shapes.size());
+            for (auto& s : shapes) {
+                childShapes.push_back(&s);
+            }
+            prepareElementMaps(childShapes);
+
             std::vector<Data::ElementMap::MappedChildElements> children;
             children.reserve(count * 3);
             TopAbs_ShapeEnum types[] = {TopAbs_VERTEX, TopAbs_EDGE, TopAbs_FACE};
@@ -1083,7 +1176,7 @@ void TopoShape::mapSubElement(const std::vector<TopoShape>& shapes, const char*
                     if (s.isNull()) {
                         continue;
                     }
-                    int count = s.countSubShapes(types[i]);
+                    int count = s._cache->countShape(types[i]);
                     if (!count) {
                         continue;
                     }
@@ -1434,6 +1527,81 @@ TopoShape& TopoShape::makeShapeWithElementMap(
     if (!op) {
         op = Part::OpCodes::Maker;
     }
+    if (LazyElementMap::isEnabled()) {
+        recordShapeElements(mapper, shapes, op);
+    }
+    else {
+        mapShapeElements(mapper, shapes, op);
+    }
+    return *this;
+}
+
+namespace
+{
+thread_local bool lazyElementMap = false;
+}
+
+TopoShape::LazyElementMap::LazyElementMap(bool enable)
+    : previous(lazyElementMap)
+{
+    lazyElementMap = enable;
+}
+
+TopoShape::LazyElementMap::~LazyElementMap()
+{
+    lazyElementMap = previous;
+}
+
+bool TopoShape::LazyElementMap::isEnabled()
+{
+    return lazyElementMap;
+}
+
+void TopoShape::recordShapeElements(
+    const Mapper& mapper,
+    const std::vector<TopoShape>& shapes,
+    const char* op
+)
+{
+    initCache();
+    for (const auto& incomingShape : shapes) {
+        if (incomingShape._cache == _cache) {
+            // The record would keep its own cache alive through the source
+            mapShapeElements(mapper, shapes, op);
+            return;
+        }
+    }
+
+    // Only the sub-shapes that mapShapeElements() queries the mapper with
+    // need to be recorded, i.e. the vertexes, edges and faces of each mappable
+    // input shape.
+    auto pending = std::make_shared<PendingElementMap>();
+    pending->tag = Tag;
+    pending->hasher = Hasher;
+    pending->shape = _Shape;
+    pending->sources = shapes;
+    pending->op = op;
+    for (const auto& incomingShape : shapes) {
+        if (!canMapElement(incomingShape)) {
+            continue;
+        }
+        for (auto type : {TopAbs_VERTEX, TopAbs_EDGE, TopAbs_FACE}) {
+            auto& otherMap = incomingShape._cache->getAncestry(type);
+            for (int i = 1; i <= otherMap.count(); i++) {
+                pending->mapper.record(mapper, otherMap.find(incomingShape._Shape, i));
+            }
+        }
+    }
+    _cache->cachedElementMap.reset();
+    _cache->pendingElementMap = std::move(pending);
+}
+
+void TopoShape::mapShapeElements(
+    const Mapper& mapper,
+    const std::vector<TopoShape>& shapes,
+    const char* op
+)
+{
     std::string _op = op;
     _op += '_';
 
@@ -1461,14 +1629,59 @@ TopoShape& TopoShape::makeShapeWithElementMap(
 
     std::map<Data::IndexedName, std::map<NameKey, NameInfo>> newNames;
 
+    // Look up the names of all input sub-shapes up front. Once the input
+    // element maps are flushed the lookups only read them, so for large
+    // inputs they run one input shape per task. The mapper queries below stay
+    // serial, as OCCT makers are not safe to query concurrently.
+    using SourceNames = std::array<std::vector<std::pair<Data::MappedName, Data::ElementIDRefs>>, 3>;
+    std::vector<const TopoShape*> sources;
+    int sourceElements = 0;
+    for (const auto& incomingShape : shapes) {
+        if (canMapElement(incomingShape)) {
+            sources.push_back(&incomingShape);
+        }
+    }
+    prepareElementMaps(sources);
+    for (auto source : sources) {
+        for (auto& pinfo : infos) {
+            sourceElements += source->_cache->countShape(pinfo->type);
+        }
+    }
+    auto lookupNames = [&infos](const TopoShape* source) {
+        SourceNames res;
+        for (std::size_t t = 0; t < infos.size(); ++t) {
+            auto& info = *infos[t];
+            int count = source->_cache->countShape(info.type);
+            res[t].reserve(count);
+            for (int i = 1; i <= count; ++i) {
+                Data::ElementIDRefs sids;
+                auto name = source->getMappedName(
+                    Data::IndexedName::fromConst(info.shapetype, i),
+                    true,
+                    &sids
+                );
+                res[t].emplace_back(std::move(name), std::move(sids));
+            }
+        }
+        return res;
+    };
+    std::vector<SourceNames> sourceNames;
+    if (sources.size() > 1 && sourceElements >= minParallelElements) {
+        sourceNames = QtConcurrent::blockingMapped<std::vector<SourceNames>>(sources, lookupNames);
+    }
+    else {
+        sourceNames.reserve(sources.size());
+        for (auto source : sources) {
+            sourceNames.push_back(lookupNames(source));
+        }
+    }
+
     // First, collect names from other shapes that generates or modifies the
     // new shape
-    for (auto& pinfo : infos) {  // Walk Vertexes, then Edges, then Faces
-        auto& info = *pinfo;
-        for (const auto& incomingShape : shapes) {
-            if (!canMapElement(incomingShape)) {
-                continue;
-            }
+    for (std::size_t t = 0; t < infos.size(); ++t) {  // Walk Vertexes, then Edges, then Faces
+        auto& info = *infos[t];
+        for (std::size_t s = 0; s < sources.size(); ++s) {
+            const auto& incomingShape = *sources[s];
             auto& otherMap = incomingShape._cache->getAncestry(info.type);
             if (otherMap.empty()) {
                 continue;
@@ -1476,12 +1689,9 @@ TopoShape& TopoShape::makeShapeWithElementMap(
             for (int i = 1; i <= otherMap.count(); i++) {
                 const auto& otherElement = otherMap.find(incomingShape._Shape, i);
                 // Find all new objects that are a modification of the old object
-                Data::ElementIDRefs sids;
-                NameKey key(
-                    info.type,
-                    incomingShape
-                        .getMappedName(Data::IndexedName::fromConst(info.shapetype, i), true, &sids)
-                );
+                auto& sourceName = sourceNames[s][t][i - 1];
+                Data::ElementIDRefs sids = sourceName.second;
+                NameKey key(info.type, sourceName.first);
 
                 int newShapeCounter = 0;
                 for (auto& newShape : mapper.modified(otherElement)) {
@@ -1984,7 +2194,6 @@ TopoShape& TopoShape::makeShapeWithElementMap(
         }
         delayed = true;
     }
-    return *this;
 }
 
 namespace
@@ -4024,10 +4233,7 @@ TopoShape& TopoShape::makeElementSlices(
 {
     std::vector<TopoShape> wires;
     TopoCrossSection cs(dir.x, dir.y, dir.z, shape, op);
-    int index = 0;
-    for (auto& distance : distances) {
-        cs.slice(++index, distance, wires);
-    }
+    cs.slices(1, distances, wires);
     return makeElementCompound(wires, op, SingleShapeCompoundCreationPolicy::returnShape);
 }
 
@@ -4177,7 +4383,7 @@ TopoShape& TopoShape::makeElementGeneralFuse(
     std::vector<TopoShape> shapes(_shapes);
 
     BRepAlgoAPI_BuilderAlgo mkGFA;
-    mkGFA.SetRunParallel(true);
+    mkGFA.SetRunParallel(ParallelPolicy::useParallel(ParallelPolicy::Algorithm::Boolean));
     TopTools_ListOfShape GFAArguments;
     for (auto& shape : shapes) {
         if (shape.isNull()) {
@@ -4852,6 +5058,10 @@ public:
         : BRepBuilderAPI_RefineModel(s)
     {}
 
+    MyRefineMaker(const TopoDS_Shape& s, const TopoDS_Shape& unchanged)
+        : BRepBuilderAPI_RefineModel(s, unchanged)
+    {}
+
     void populate(ShapeMapper& mapper)
     {
         for (TopTools_DataMapIteratorOfDataMapOfShapeListOfShape it(this->myModified); it.More();
@@ -4865,6 +5075,16 @@ public:
 };
 
 TopoShape& TopoShape::makeElementRefine(const TopoShape& shape, const char* op, RefineFail no_fail)
+{
+    return makeElementIncrementalRefine(shape, TopoShape(), op, no_fail);
+}
+
+TopoShape& TopoShape::makeElementIncrementalRefine(
+    const TopoShape& shape,
+    const TopoShape& base,
+    const char* op,
+    RefineFail no_fail
+)
 {
     if (shape.isNull()) {
         if (no_fail == RefineFail::throwException) {
@@ -4878,7 +5098,7 @@ TopoShape& TopoShape::makeElementRefine(const TopoShape& shape, const char* op,
     }
     bool closed = shape.isClosed();
     try {
-        MyRefineMaker mkRefine(shape.getShape());
+        MyRefineMaker mkRefine(shape.getShape(), base.getShape());
         GenericShapeMapper mapper;
         mkRefine.populate(mapper);
         mapper.init(shape, mkRefine.Shape());
@@ -5951,6 +6171,72 @@ TopoShape& TopoShape::makeElementBoolean(
         return *this;
     }
 
+    // Inputs whose bounding boxes do not overlap cannot interact, leave them
+    // out of the boolean and pass them straight through instead.
+    std::vector<TopoShape> interacting;
+    bool isFuse = strcmp(maker, Part::OpCodes::Fuse) == 0;
+    if (strcmp(maker, Part::OpCodes::Cut) == 0 || strcmp(maker, Part::OpCodes::Common) == 0) {
+        auto boxes = getBooleanBounds(inputs, tolerance);
+        interacting.push_back(inputs[0]);
+        for (std::size_t i = 1; i < inputs.size(); ++i) {
+            if (!boxes[0].IsOut(boxes[i])) {
+                interacting.push_back(inputs[i]);
+            }
+        }
+        if (interacting.size() == 1) {
+            if (strcmp(maker, Part::OpCodes::Cut) == 0) {
+                *this = inputs[0];
+            }
+            else {
+                // nothing in common
+                BRep_Builder builder;
+                TopoDS_Compound comp;
+                builder.MakeCompound(comp);
+                setShape(comp);
+            }
+            return *this;
+        }
+    }
+    else if (isFuse) {
+        auto boxes = getBooleanBounds(inputs, tolerance);
+        std::vector<bool> isolated(inputs.size(), true);
+        for (std::size_t i = 0; i < inputs.size(); ++i) {
+            for (std::size_t j = i + 1; j < inputs.size(); ++j) {
+                if ((isolated[i] || isolated[j]) && !boxes[i].IsOut(boxes[j])) {
+                    isolated[i] = isolated[j] = false;
+                }
+            }
+        }
+        for (std::size_t i = 0; i < inputs.size(); ++i) {
+            if (!isolated[i]) {
+                interacting.push_back(inputs[i]);
+            }
+        }
+        if (interacting.size() < inputs.size()) {
+            // Fuse the rest, and keep the order of the inputs in the result
+            TopoShape fused(0, Hasher);
+            if (!interacting.empty()) {
+                fused.makeElementBoolean(maker, interacting, op, tolerance);
+            }
+            std::vector<TopoShape> pieces;
+            bool fusedAdded = false;
+            for (std::size_t i = 0; i < inputs.size(); ++i) {
+                if (isolated[i]) {
+                    pieces.push_back(inputs[i]);
+                }
+                else if (!fusedAdded) {
+                    fusedAdded = true;
+                    expandCompound(fused, pieces);
+                }
+            }
+            return makeElementCompound(pieces, op, SingleShapeCompoundCreationPolicy::forceCompound);
+        }
+    }
+    if (interacting.size() == inputs.size()) {
+        interacting.clear();
+    }
+    const auto& arguments = interacting.empty() ? inputs : interacting;
+
     std::unique_ptr<BRepAlgoAPI_BooleanOperation> mk;
     if (strcmp(maker, Part::OpCodes::Fuse) == 0) {
         mk.reset(new FCBRepAlgoAPI_Fuse);
@@ -5972,7 +6258,7 @@ TopoShape& TopoShape::makeElementBoolean(
     TopTools_ListOfShape shapeArguments, shapeTools;
 
     int i = -1;
-    for (const auto& shape : inputs) {
+    for (const auto& shape : arguments) {
         if (shape.isNull()) {
             FC_THROWM(NullShapeException, "Null input shape");
         }
@@ -5984,8 +6270,7 @@ TopoShape& TopoShape::makeElementBoolean(
         }
     }
 
-    mk->SetRunParallel(Standard_True);
-    OSD_Parallel::SetUseOcctThreads(Standard_True);
+    mk->SetRunParallel(ParallelPolicy::useParallel(ParallelPolicy::Algorithm::Boolean));
 
     mk->SetArguments(shapeArguments);
     mk->SetTools(shapeTools);
@@ -6003,7 +6288,7 @@ TopoShape& TopoShape::makeElementBoolean(
     if (OCCTProgressIndicator::getAppIndicator().UserBreak()) {
         FC_THROWM(Base::CADKernelError, "User aborted");
     }
-    makeElementShape(*mk, inputs, op);
+    makeElementShape(*mk, arguments, op);
 
     if (buildShell) {
         makeElementShell();
@@ -6011,6 +6296,101 @@ TopoShape& TopoShape::makeElementBoolean(
     return *this;
 }
 
+TopoShape& TopoShape::makeElementBatchBoolean(
+    const char* maker,
+    const std::vector<TopoShape>& shapes,
+    const BatchBooleanOptions& options,
+    const char* op
+)
+{
+    if (!maker) {
+        FC_THROWM(Base::CADKernelError, "no maker");
+    }
+    bool isFuse = strcmp(maker, Part::OpCodes::Fuse) == 0;
+    bool isCut = strcmp(maker, Part::OpCodes::Cut) == 0;
+    if (!isFuse && !isCut && strcmp(maker, Part::OpCodes::Common) != 0) {
+        FC_THROWM(Base::CADKernelError, "Unknown maker");
+    }
+
+    if (!op) {
+        op = maker;
+    }
+
+    if (shapes.empty()) {
+        FC_THROWM(NullShapeException, "Null shape");
+    }
+
+    TopTools_ListOfShape arguments;
+    for (const auto& shape : shapes) {
+        if (shape.isNull()) {
+            FC_THROWM(NullShapeException, "Null input shape");
+        }
+        arguments.Append(shape.getShape());
+    }
+
+    if (shapes.size() == 1) {
+        *this = shapes[0];
+        FC_WARN("Boolean operation with only one shape input");
+        return *this;
+    }
+
+    if (OCCTProgressIndicator::getAppIndicator().UserBreak()) {
+        FC_THROWM(Base::CADKernelError, "User aborted");
+    }
+
+    // All shapes are split against each other once, the result is then
+    // picked from the split pieces (cells) according to the operation.
+    BOPAlgo_CellsBuilder mk;
+    mk.SetArguments(arguments);
+    mk.SetRunParallel(options.runParallel && ParallelPolicy::useParallel(ParallelPolicy::Algorithm::Boolean));
+    mk.SetNonDestructive(Standard_True);
+    mk.SetGlue(options.glue);
+    if (options.fuzzyValue > 0.0) {
+        mk.SetFuzzyValue(options.fuzzyValue);
+    }
+    else if (options.fuzzyValue < 0.0) {
+        FCBRepAlgoAPIHelper::setAutoFuzzy(&mk);
+    }
+    {
+        App::RecomputeStats::ScopedTimer timer(App::RecomputeStats::Category::Occ);
+#if OCC_VERSION_HEX >= 0x070600
+        mk.Perform(OCCTProgressIndicator::getAppIndicator().Start());
+#else
+        mk.Perform();
+#endif
+    }
+    if (OCCTProgressIndicator::getAppIndicator().UserBreak()) {
+        FC_THROWM(Base::CADKernelError, "User aborted");
+    }
+    if (mk.HasErrors()) {
+        FC_THROWM(Base::CADKernelError, "Boolean operation failed");
+    }
+
+    TopTools_ListOfShape take, avoid;
+    if (isFuse) {
+        mk.AddAllToResult(1);
+        mk.RemoveInternalBoundaries();
+    }
+    else if (isCut) {
+        auto it = shapes.begin();
+        take.Append(it->getShape());
+        for (++it; it != shapes.end(); ++it) {
+            avoid.Append(it->getShape());
+        }
+        mk.AddToResult(take, avoid);
+    }
+    else {
+        mk.AddToResult(arguments, avoid);
+    }
+    if (mk.HasErrors()) {
+        FC_THROWM(Base::CADKernelError, "Boolean operation failed");
+    }
+
+    makeShapeWithElementMap(mk.Shape(), MapperHistory(mk.History()), shapes, op);
+    makeElementShell();
+    return *this;
+}
+
 bool TopoShape::isSame(const Data::ComplexGeoData& _other) const
 {
     if (!_other.isDerivedFrom<TopoShape>()) {
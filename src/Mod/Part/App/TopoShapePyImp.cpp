@@ -70,6 +70,7 @@
 #include <App/StringHasherPy.h>
 #include <Base/FileInfo.h>
 #include <Base/GeometryPyCXX.h>
+#include <Base/Interpreter.h>
 #include <Base/MatrixPy.h>
 #include <Base/PyWrapParseTupleAndKeywords.h>
 #include <Base/Rotation.h>
@@ -94,6 +95,7 @@
 #include <Mod/Part/App/TopoShapeWirePy.h>
 
 #include "OCCError.h"
+#include "ParallelPolicy.h"
 #include "PartPyCXX.h"
 #include "ShapeMapHasher.h"
 #include "TopoShapeMapper.h"
@@ -312,7 +314,14 @@ PyObject* TopoShapePy::read(PyObject* args)
     std::string EncodedName = std::string(Name);
     PyMem_Free(Name);
 
-    getTopoShapePtr()->read(EncodedName.c_str());
+    // Read into a local shape so that the one owned by this object is only modified with the
+    // GIL held
+    TopoShape shape;
+    {
+        Base::PyGILStateRelease unlock;
+        shape.read(EncodedName.c_str());
+    }
+    getTopoShapePtr()->setShape(shape.getShape(), false);
     Py_Return;
 }
 
@@ -361,7 +370,9 @@ PyObject* TopoShapePy::exportIges(PyObject* args) const
 
     try {
         // write iges file
-        getTopoShapePtr()->exportIges(EncodedName.c_str());
+        TopoShape shape(*getTopoShapePtr());
+        Base::PyGILStateRelease unlock;
+        shape.exportIges(EncodedName.c_str());
     }
     catch (const Base::Exception& e) {
         PyErr_SetString(PartExceptionOCCError, e.what());
@@ -383,7 +394,9 @@ PyObject* TopoShapePy::exportStep(PyObject* args) const
 
     try {
         // write step file
-        getTopoShapePtr()->exportStep(EncodedName.c_str());
+        TopoShape shape(*getTopoShapePtr());
+        Base::PyGILStateRelease unlock;
+        shape.exportStep(EncodedName.c_str());
     }
     catch (const Base::Exception& e) {
         PyErr_SetString(PartExceptionOCCError, e.what());
@@ -402,7 +415,9 @@ PyObject* TopoShapePy::exportBrep(PyObject* args) const
 
         try {
             // write brep file
-            getTopoShapePtr()->exportBrep(EncodedName.c_str());
+            TopoShape shape(*getTopoShapePtr());
+            Base::PyGILStateRelease unlock;
+            shape.exportBrep(EncodedName.c_str());
         }
         catch (const Base::Exception& e) {
             PyErr_SetString(PartExceptionOCCError, e.what());
@@ -631,7 +646,9 @@ PyObject* TopoShapePy::exportStl(PyObject* args) const
 
     try {
         // write stl file
-        getTopoShapePtr()->exportStl(EncodedName.c_str(), deflection);
+        TopoShape shape(*getTopoShapePtr());
+        Base::PyGILStateRelease unlock;
+        shape.exportStl(EncodedName.c_str(), deflection);
     }
     catch (const Base::Exception& e) {
         PyErr_SetString(PartExceptionOCCError, e.what());
@@ -725,7 +742,13 @@ static PyObject* makeShape(const char* op, const TopoShape& shape, PyObject* arg
         std::vector<TopoShape> shapes;
         shapes.push_back(shape);
         getPyShapes(pcObj, shapes);
-        return Py::new_reference_to(shape2pyshape(TopoShape().makeElementBoolean(op, shapes, 0, tol)));
+        // the input shapes are copies, so the boolean operation doesn't need the GIL
+        TopoShape res;
+        {
+            Base::PyGILStateRelease unlock;
+            res.makeElementBoolean(op, shapes, 0, tol);
+        }
+        return Py::new_reference_to(shape2pyshape(res));
     }
     PY_CATCH_OCC
 }
@@ -761,8 +784,14 @@ PyObject* TopoShapePy::slice(PyObject* args) const
     Base::Vector3d vec = Py::Vector(dir, false).toVector();
 
     try {
+        TopoShape shape(*getTopoShapePtr());
+        std::vector<TopoShape> sections;
+        {
+            Base::PyGILStateRelease unlock;
+            sections = shape.makeElementSlice(vec, d).getSubTopoShapes(TopAbs_WIRE);
+        }
         Py::List wires;
-        for (auto& w : getTopoShapePtr()->makeElementSlice(vec, d).getSubTopoShapes(TopAbs_WIRE)) {
+        for (auto& w : sections) {
             wires.append(shape2pyshape(w));
         }
         return Py::new_reference_to(wires);
@@ -793,7 +822,13 @@ PyObject* TopoShapePy::slices(PyObject* args) const
         for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
             d.push_back((double)Py::Float(*it));
         }
-        return Py::new_reference_to(shape2pyshape(getTopoShapePtr()->makeElementSlices(vec, d)));
+        TopoShape shape(*getTopoShapePtr());
+        TopoShape res;
+        {
+            Base::PyGILStateRelease unlock;
+            res = shape.makeElementSlices(vec, d);
+        }
+        return Py::new_reference_to(shape2pyshape(res));
     }
     catch (Standard_Failure& e) {
         PyErr_SetString(PartExceptionOCCError, e.GetMessageString());
@@ -824,7 +859,10 @@ PyObject* TopoShapePy::generalFuse(PyObject* args) const
     try {
         getPyShapes(pcObj, shapes);
         TopoShape res;
-        res.makeElementGeneralFuse(shapes, modifies, tolerance);
+        {
+            Base::PyGILStateRelease unlock;
+            res.makeElementGeneralFuse(shapes, modifies, tolerance);
+        }
         Py::List mapPy;
         for (auto& mod : modifies) {
             Py::List shapesPy;
@@ -2370,7 +2408,7 @@ PyObject* TopoShapePy::distToShape(PyObject* args) const
     BRepExtrema_DistShapeShape extss;
     extss.SetDeflection(tol);
 #if OCC_VERSION_HEX >= 0x070600
-    extss.SetMultiThread(true);
+    extss.SetMultiThread(ParallelPolicy::useParallel(ParallelPolicy::Algorithm::Distance));
 #endif
     extss.LoadS1(s1);
     extss.LoadS2(s2);
@@ -22,7 +22,12 @@
  *                                                                          *
  ****************************************************************************/
 
+#include <algorithm>
+#include <exception>
 #include <limits>
+#include <mutex>
+
+#include <QtConcurrentMap>
 
 #include <boost/core/ignore_unused.hpp>
 #include <boost/geometry/geometries/register/point.hpp>
@@ -73,6 +78,7 @@
 #include "WireJoiner.h"
 
 #include "Geometry.h"
+#include "ParallelPolicy.h"
 #include "PartFeature.h"
 #include "TopoShapeOpCode.h"
 #include "TopoShapeMapper.h"
@@ -229,6 +235,7 @@ public:
         Handle(Geom_Curve) curve;
         GeomAbs_CurveType type {};
         bool isLinear;
+        bool planar {};  // set by splitEdges() before checking intersections
 
         EdgeInfo(
             const TopoDS_Edge& eForInfo,
@@ -1095,7 +1102,7 @@ public:
     )
     {
         gp_Pln pln;
-        bool planar = TopoShape(info.edge).findPlane(pln);
+        bool planar = info.planar;
         if (!planar) {
             TopoDS_Compound comp;
             builder.MakeCompound(comp);
@@ -1349,16 +1356,131 @@ public:
         }
     }
 
+    // Squared distance between the segments p1-p2 and q1-q2
+    static double segmentSquareDistance(
+        const gp_Pnt& p1,
+        const gp_Pnt& p2,
+        const gp_Pnt& q1,
+        const gp_Pnt& q2
+    )
+    {
+        gp_Vec d1(p1, p2);
+        gp_Vec d2(q1, q2);
+        gp_Vec r(q1, p1);
+        double a = d1.SquareMagnitude();
+        double e = d2.SquareMagnitude();
+        double f = d2.Dot(r);
+        double s = 0.0;
+        double t = 0.0;
+        if (a <= Precision::SquareConfusion() && e <= Precision::SquareConfusion()) {
+            return p1.SquareDistance(q1);
+        }
+        if (a <= Precision::SquareConfusion()) {
+            t = std::clamp(f / e, 0.0, 1.0);
+        }
+        else {
+            double c = d1.Dot(r);
+            if (e <= Precision::SquareConfusion()) {
+                s = std::clamp(-c / a, 0.0, 1.0);
+            }
+            else {
+                double b = d1.Dot(d2);
+                double denom = a * e - b * b;
+                if (denom > 0.0) {
+                    s = std::clamp((b * f - c * e) / denom, 0.0, 1.0);
+                }
+                t = (b * s + f) / e;
+                if (t < 0.0) {
+                    t = 0.0;
+                    s = std::clamp(-c / a, 0.0, 1.0);
+                }
+                else if (t > 1.0) {
+                    t = 1.0;
+                    s = std::clamp((b - c) / a, 0.0, 1.0);
+                }
+            }
+        }
+        gp_Pnt c1 = p1.Translated(d1 * s);
+        gp_Pnt c2 = q1.Translated(d2 * t);
+        return c1.SquareDistance(c2);
+    }
+
+    // Two straight edges whose bounding boxes overlap can still be far apart
+    bool canIntersect(const EdgeInfo& info, const EdgeInfo& other) const
+    {
+        if (!info.isLinear || !other.isLinear) {
+            return true;
+        }
+        return segmentSquareDistance(info.p1, info.p2, other.p1, other.p2) <= 4 * myTol2;
+    }
+
+    // Call func for each item, concurrently if parallel booleans are enabled and no debug
+    // shapes are shown. The first exception thrown by func is rethrown when all calls are done.
+    template<typename T, typename Func>
+    void forEachConcurrently(std::vector<T>& items, Func func) const
+    {
+        if (items.size() < 2 || canShowShape()
+            || !ParallelPolicy::isEnabled(ParallelPolicy::Algorithm::Boolean)) {
+            for (auto& item : items) {
+                func(item);
+            }
+            return;
+        }
+
+        std::mutex mutex;
+        std::exception_ptr error;
+        QtConcurrent::blockingMap(items, [&](T& item) {
+            try {
+                func(item);
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        });
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    // This method was originally part of WireJoinerP::splitEdges(), split to reduce cognitive
+    // complexity
+    void splitEdgesPrepareParams(const EdgeInfo& info, std::set<IntersectInfo>& params) const
+    {
+        auto itParam = params.begin();
+        if (itParam->point.SquareDistance(info.p1) < myTol2) {
+            params.erase(itParam);
+        }
+        params.emplace(info.firstParam, info.p1, TopoDS_Shape());
+        itParam = params.end();
+        --itParam;
+        if (itParam->point.SquareDistance(info.p2) < myTol2) {
+            params.erase(itParam);
+        }
+        params.emplace(info.lastParam, info.p2, TopoDS_Shape());
+    }
+
     // Try splitting any edges that intersects other edge
     void splitEdges()
     {
         std::unordered_map<const EdgeInfo*, std::set<IntersectInfo>> intersects;
 
         int idx = 0;
+        std::vector<EdgeInfo*> infos;
+        infos.reserve(edges.size());
         for (auto& info : edges) {
             info.iteration = ++idx;
+            infos.push_back(&info);
         }
 
+        // The plane of each edge is needed for every pair it takes part in
+        forEachConcurrently(infos, [](EdgeInfo* info) {
+            gp_Pln pln;
+            info->planar = TopoShape(info->edge).findPlane(pln);
+        });
+
         std::unique_ptr<Base::SequencerLauncher> seq(
             new Base::SequencerLauncher("Splitting edges", edges.size())
         );
@@ -1376,52 +1498,56 @@ public:
                     // means the edge is before us, and we've already checked intersection
                     continue;
                 }
+                if (!canIntersect(info, other)) {
+                    continue;
+                }
                 checkIntersection(info, other, params, intersects[&other]);
             }
         }
 
-        idx = 0;
-        std::vector<SplitInfo> splits;
-        for (auto it = edges.begin(); it != edges.end();) {
-            ++idx;
-            auto iter = intersects.find(&(*it));
-            if (iter == intersects.end()) {
-                ++it;
-                continue;
+        // Building the split edges only reads the curve of each edge, so it is done for all
+        // edges up front. The edge list and the spatial indices are updated afterwards in
+        // list order.
+        struct EdgeSplits
+        {
+            EdgeInfo* info;
+            std::set<IntersectInfo>* params;
+            std::vector<SplitInfo> splits;
+        };
+        std::vector<EdgeSplits> edgeSplits;
+        for (auto info : infos) {
+            auto iter = intersects.find(info);
+            if (iter != intersects.end() && !iter->second.empty()) {
+                edgeSplits.push_back({info, &iter->second, {}});
             }
-            auto& info = *it;
-            auto& params = iter->second;
-            if (params.empty()) {
-                ++it;
-                continue;
+        }
+        forEachConcurrently(edgeSplits, [this](EdgeSplits& entry) {
+            auto& params = *entry.params;
+            splitEdgesPrepareParams(*entry.info, params);
+            if (params.size() <= 2) {
+                return;
             }
-
             auto itParam = params.begin();
-            if (itParam->point.SquareDistance(info.p1) < myTol2) {
-                params.erase(itParam);
-            }
-            params.emplace(info.firstParam, info.p1, TopoDS_Shape());
-            itParam = params.end();
-            --itParam;
-            if (itParam->point.SquareDistance(info.p2) < myTol2) {
-                params.erase(itParam);
-            }
-            params.emplace(info.lastParam, info.p2, TopoDS_Shape());
+            splitEdgesMakeEdges(itParam, params, *entry.info, entry.splits);
+        });
 
-            if (params.size() <= 2) {
-                ++it;
-                continue;
+        std::unordered_map<const EdgeInfo*, std::vector<SplitInfo>*> splitMap;
+        for (auto& entry : edgeSplits) {
+            if (entry.splits.size() > 1) {
+                splitMap.emplace(entry.info, &entry.splits);
             }
+        }
 
-            splits.clear();
-            itParam = params.begin();
-
-            splitEdgesMakeEdges(itParam, params, info, splits);
-
-            if (splits.size() <= 1) {
+        for (auto it = edges.begin(); it != edges.end();) {
+            auto iter = splitMap.find(&(*it));
+            if (iter == splitMap.end()) {
                 ++it;
                 continue;
             }
+            auto& info = *it;
+            const auto& splits = *iter->second;
+            // the address of the removed edge may be reused by one of its splits
+            splitMap.erase(iter);
 
             showShape(info.edge, "remove");
             auto removedEdge = info.edge;
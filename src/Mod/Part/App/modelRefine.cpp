@@ -57,6 +57,7 @@
 #include <TColgp_Array2OfPnt.hxx>
 #include <TColgp_SequenceOfPnt.hxx>
 #include <TColStd_Array1OfReal.hxx>
+#include <TopLoc_Location.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Compound.hxx>
 #include <TopoDS_Shape.hxx>
@@ -155,11 +156,19 @@ bool FaceTypeSplitter::hasType(const GeomAbs_SurfaceType& type) const
     return typeMap.find(type) != typeMap.end();
 }
 
+void FaceTypeSplitter::setFaceFilter(const TopTools_MapOfShape* faces)
+{
+    faceFilter = faces;
+}
+
 void FaceTypeSplitter::split()
 {
     TopExp_Explorer shellIt;
     for (shellIt.Init(shell, TopAbs_FACE); shellIt.More(); shellIt.Next()) {
         TopoDS_Face tempFace(TopoDS::Face(shellIt.Current()));
+        if (faceFilter && !faceFilter->Contains(tempFace)) {
+            continue;
+        }
         GeomAbs_SurfaceType currentType = FaceTypedBase::getFaceType(tempFace);
         SplitMapType::iterator mapIt = typeMap.find(currentType);
         if (mapIt == typeMap.end()) {
@@ -1106,6 +1115,37 @@ FaceUniter::FaceUniter(const TopoDS_Shell& shellIn)
     workShell = shellIn;
 }
 
+bool FaceUniter::collectCandidates(TopTools_MapOfShape& candidates) const
+{
+    if (!unchangedFaces || unchangedFaces->IsEmpty()) {
+        return false;
+    }
+    TopTools_IndexedDataMapOfShapeListOfShape edgeToFaceMap;
+    TopExp::MapShapesAndAncestors(workShell, TopAbs_EDGE, TopAbs_FACE, edgeToFaceMap);
+    int faceCount = 0;
+    TopExp_Explorer faceIt;
+    for (faceIt.Init(workShell, TopAbs_FACE); faceIt.More(); faceIt.Next()) {
+        ++faceCount;
+        const TopoDS_Shape& face = faceIt.Current();
+        if (unchangedFaces->Contains(face.Located(TopLoc_Location()))) {
+            continue;
+        }
+        // A changed face may merge with any face it shares an edge with
+        candidates.Add(face);
+        TopExp_Explorer edgeIt;
+        for (edgeIt.Init(face, TopAbs_EDGE); edgeIt.More(); edgeIt.Next()) {
+            int index = edgeToFaceMap.FindIndex(edgeIt.Current());
+            if (index == 0) {
+                continue;
+            }
+            for (TopTools_ListIteratorOfListOfShape it(edgeToFaceMap(index)); it.More(); it.Next()) {
+                candidates.Add(it.Value());
+            }
+        }
+    }
+    return candidates.Extent() < faceCount;
+}
+
 bool FaceUniter::process()
 {
     if (workShell.IsNull()) {
@@ -1113,6 +1153,13 @@ bool FaceUniter::process()
     }
     modifiedShapes.clear();
     deletedShapes.clear();
+
+    TopTools_MapOfShape candidates;
+    bool incremental = collectCandidates(candidates);
+    if (incremental && candidates.IsEmpty()) {
+        // nothing changed since the last refine
+        return true;
+    }
     typeObjects.push_back(&getPlaneObject());
     typeObjects.push_back(&getCylinderObject());
     typeObjects.push_back(&getBSplineObject());
@@ -1125,6 +1172,9 @@ bool FaceUniter::process()
     for (typeIt = typeObjects.begin(); typeIt != typeObjects.end(); ++typeIt) {
         splitter.registerType((*typeIt)->getType());
     }
+    if (incremental) {
+        splitter.setFaceFilter(&candidates);
+    }
     splitter.split();
 
     ModelRefine::FaceVectorType facesToRemove;
@@ -1309,6 +1359,27 @@ Part::BRepBuilderAPI_RefineModel::BRepBuilderAPI_RefineModel(const TopoDS_Shape&
     Build();
 }
 
+Part::BRepBuilderAPI_RefineModel::BRepBuilderAPI_RefineModel(
+    const TopoDS_Shape& shape,
+    const TopoDS_Shape& unchanged
+)
+{
+    myShape = shape;
+    if (!unchanged.IsNull()) {
+        TopExp_Explorer xp;
+        for (xp.Init(unchanged, TopAbs_FACE); xp.More(); xp.Next()) {
+            myUnchanged.Add(xp.Current().Located(TopLoc_Location()));
+        }
+    }
+    Build();
+}
+
+bool Part::BRepBuilderAPI_RefineModel::processShell(ModelRefine::FaceUniter& uniter) const
+{
+    uniter.setUnchangedFaces(&myUnchanged);
+    return uniter.process();
+}
+
 #if OCC_VERSION_HEX >= 0x070600
 void Part::BRepBuilderAPI_RefineModel::Build(const Message_ProgressRange&)
 #else
@@ -1326,7 +1397,7 @@ void Part::BRepBuilderAPI_RefineModel::Build()
         for (it.Init(solid, TopAbs_SHELL); it.More(); it.Next()) {
             const TopoDS_Shell& currentShell = TopoDS::Shell(it.Current());
             ModelRefine::FaceUniter uniter(currentShell);
-            if (uniter.process()) {
+            if (processShell(uniter)) {
                 if (uniter.isModified()) {
                     const TopoDS_Shell& newShell = uniter.getShell();
                     mkSolid.Add(newShell);
@@ -1345,7 +1416,7 @@ void Part::BRepBuilderAPI_RefineModel::Build()
     else if (myShape.ShapeType() == TopAbs_SHELL) {
         const TopoDS_Shell& shell = TopoDS::Shell(myShape);
         ModelRefine::FaceUniter uniter(shell);
-        if (uniter.process()) {
+        if (processShell(uniter)) {
             // TODO: Why not check for uniter.isModified()?
             myShape = uniter.getShell();
             LogModifications(uniter);
@@ -1370,7 +1441,7 @@ void Part::BRepBuilderAPI_RefineModel::Build()
                 countShells++;
                 const TopoDS_Shell& currentShell = TopoDS::Shell(it.Current());
                 ModelRefine::FaceUniter uniter(currentShell);
-                if (uniter.process()) {
+                if (processShell(uniter)) {
                     if (uniter.isModified()) {
                         if (countShells > 1) {
                             uniter.fixOrientation(currentShell);
@@ -1387,7 +1458,7 @@ void Part::BRepBuilderAPI_RefineModel::Build()
         for (xp.Init(myShape, TopAbs_SHELL, TopAbs_SOLID); xp.More(); xp.Next()) {
             const TopoDS_Shell& shell = TopoDS::Shell(xp.Current());
             ModelRefine::FaceUniter uniter(shell);
-            if (uniter.process()) {
+            if (processShell(uniter)) {
                 builder.Add(comp, uniter.getShell());
                 LogModifications(uniter);
             }
@@ -134,12 +134,15 @@ public:
     void addShell(const TopoDS_Shell& shellIn);
     void registerType(const GeomAbs_SurfaceType& type);
     bool hasType(const GeomAbs_SurfaceType& type) const;
+    /// Only faces contained in \a faces are handed out by split(), nullptr disables the filter.
+    void setFaceFilter(const TopTools_MapOfShape* faces);
     void split();
     const FaceVectorType& getTypedFaceVector(const GeomAbs_SurfaceType& type) const;
 
 private:
     SplitMapType typeMap;
     TopoDS_Shell shell;
+    const TopTools_MapOfShape* faceFilter = nullptr;
 };
 
 class FaceAdjacencySplitter
@@ -193,6 +196,16 @@ private:
 public:
     FaceUniter(const TopoDS_Shell& shellIn);
     bool process();
+    /** Restrict the next process() to the faces not found in \a faces and their neighbours.
+     *
+     * The faces in \a faces are looked up by TShape, ignoring their location, and are assumed
+     * to be refined among themselves already, e.g. the untouched faces of the base shape of a
+     * boolean operation. Passing nullptr (the default) processes every face of the shell.
+     */
+    void setUnchangedFaces(const TopTools_MapOfShape* faces)
+    {
+        unchangedFaces = faces;
+    }
     const TopoDS_Shell& getShell() const
     {
         return workShell;
@@ -212,7 +225,10 @@ public:
     }
 
 private:
+    bool collectCandidates(TopTools_MapOfShape& candidates) const;
+
     TopoDS_Shell workShell;
+    const TopTools_MapOfShape* unchangedFaces = nullptr;
     std::vector<FaceTypedBase*> typeObjects;
     std::vector<ShapePairType> modifiedShapes;
     ShapeVectorType deletedShapes;
@@ -241,6 +257,12 @@ class PartExport BRepBuilderAPI_RefineModel: public BRepBuilderAPI_MakeShape
 {
 public:
     BRepBuilderAPI_RefineModel(const TopoDS_Shape&);
+    /** Refine only the part of a shape touched by the last operation
+     *
+     * Faces of the shape that also belong to \a unchanged (compared by TShape) are considered
+     * already refined, so only the other faces and their direct neighbours are examined.
+     */
+    BRepBuilderAPI_RefineModel(const TopoDS_Shape& shape, const TopoDS_Shape& unchanged);
 #if OCC_VERSION_HEX >= 0x070600
     void Build(const Message_ProgressRange& theRange = Message_ProgressRange()) override;
 #else
@@ -251,10 +273,12 @@ public:
 
 private:
     void LogModifications(const ModelRefine::FaceUniter& uniter);
+    bool processShell(ModelRefine::FaceUniter& uniter) const;
 
 protected:
     TopTools_DataMapOfShapeListOfShape myModified;
     TopTools_ListOfShape myEmptyList;
     TopTools_ListOfShape myDeleted;
+    TopTools_MapOfShape myUnchanged;
 };
 }  // namespace Part
@@ -211,6 +211,7 @@ PyMOD_INIT_FUNC(PartGui)
     PartGui::ViewProviderBoolean                    ::init();
     PartGui::ViewProviderMultiFuse                  ::init();
     PartGui::ViewProviderMultiCommon                ::init();
+    PartGui::ViewProviderMultiCut                   ::init();
     PartGui::ViewProviderCompound                   ::init();
     PartGui::ViewProviderSpline                     ::init();
     PartGui::ViewProviderCircleParametric           ::init();
@@ -112,6 +112,7 @@ void BoxSelection::selectionCallback(void* ud, SoEventCallback* cb)
     if (doc) {
         cb->setHandled();
 
+        Gui::SelectionBatch batch;
         std::vector<Part::Feature*> geom = doc->getObjectsOfType<Part::Feature>();
         for (auto it : geom) {
             Gui::ViewProvider* vp = Gui::Application::Instance->getViewProvider(it);
@@ -0,0 +1,366 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include <algorithm>
+
+#include <QtConcurrentRun>
+
+#include <BRepBuilderAPI_Copy.hxx>
+#include <Standard_Failure.hxx>
+
+#include <Inventor/SbViewVolume.h>
+#include <Inventor/SbViewportRegion.h>
+#include <Inventor/actions/SoGLRenderAction.h>
+#include <Inventor/elements/SoModelMatrixElement.h>
+#include <Inventor/elements/SoViewVolumeElement.h>
+#include <Inventor/elements/SoViewportRegionElement.h>
+#include <Inventor/nodes/SoCallback.h>
+#include <Inventor/nodes/SoCoordinate3.h>
+#include <Inventor/nodes/SoNormal.h>
+
+#include <App/Application.h>
+#include <Base/Parameter.h>
+#include <Gui/SoFCInteractiveElement.h>
+#include <Gui/Selection/SoFCSelectionAction.h>
+
+#include "ShapeLevelOfDetail.h"
+#include "SoBrepEdgeSet.h"
+#include "SoBrepFaceSet.h"
+#include "SoBrepPointSet.h"
+#include "SoFCShapeObject.h"
+#include "ViewProviderExt.h"
+
+
+using namespace PartGui;
+
+namespace
+{
+// Deviation and angular deflection of each level relative to the full tessellation
+constexpr std::array<double, ShapeLevelOfDetail::NumLevels> deviationFactors {1.0, 4.0, 16.0};
+constexpr std::array<double, ShapeLevelOfDetail::NumLevels> angularFactors {1.0, 2.0, 3.0};
+constexpr double maxAngularDeflection = 90.0;
+// Switch to a coarser level only with some margin to the threshold to avoid flickering
+constexpr float coarsenMargin = 0.75F;
+// Requests of views that haven't rendered the shape for a while are ignored
+constexpr auto requestTimeout = std::chrono::seconds(2);
+}  // namespace
+
+ShapeLevelOfDetail::ShapeLevelOfDetail(
+    SoCoordinate3* coords,
+    SoNormal* norm,
+    SoBrepFaceSet* faceset,
+    SoBrepEdgeSet* lineset,
+    SoBrepPointSet* nodeset
+)
+    : coords(coords)
+    , norm(norm)
+    , faceset(faceset)
+    , lineset(lineset)
+    , nodeset(nodeset)
+    , callback(new SoCallback)
+    , sensor(sensorCallback, this)
+{
+    callback->ref();
+    callback->setName("LevelOfDetail");
+    callback->setCallback(renderCallback, this);
+}
+
+ShapeLevelOfDetail::~ShapeLevelOfDetail()
+{
+    sensor.unschedule();
+    // the node may still be referenced by other scene graphs, e.g. of links
+    callback->setCallback(nullptr, nullptr);
+    callback->unref();
+    clear();
+}
+
+void ShapeLevelOfDetail::clear()
+{
+    // the result of a running computation is dropped
+    watcher.reset();
+    computed = false;
+    for (auto& level : levels) {
+        if (level) {
+            level->unref();
+            level = nullptr;
+        }
+    }
+    requests.clear();
+    currentLevel = 0;
+    enabled = false;
+    shape.Nullify();
+}
+
+void ShapeLevelOfDetail::reset(
+    const TopoDS_Shape& shape,
+    double deviation,
+    double angularDeflection,
+    bool normalsFromUV
+)
+{
+    clear();
+
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part"
+    );
+    int numTriangles = faceset->coordIndex.getNum() / 4;
+    enabled = hGrp->GetBool("LevelOfDetail", true)
+        && numTriangles >= hGrp->GetInt("LevelOfDetailMinTriangles", 20000);
+    if (!enabled) {
+        return;
+    }
+    screenError = static_cast<float>(
+        std::max(hGrp->GetFloat("LevelOfDetailScreenError", 1.0), 0.1)
+    );
+
+    this->shape = shape;
+    this->deviation = deviation;
+    this->angularDeflection = angularDeflection;
+    this->normalsFromUV = normalsFromUV;
+
+    bounds.makeEmpty();
+    const SbVec3f* points = coords->point.getValues(0);
+    for (int i = 0; i < coords->point.getNum(); ++i) {
+        bounds.extendBy(points[i]);
+    }
+
+    // Estimate the deflections the same way as Part::Tools::getDeflection() until the
+    // coarse levels have been computed
+    float dx, dy, dz;
+    bounds.getSize(dx, dy, dz);
+    double deflection = (dx + dy + dz) / 300.0 * deviation;
+    for (int level = 0; level < NumLevels; ++level) {
+        deflections[level] = deflection * deviationFactors[level];
+    }
+}
+
+void ShapeLevelOfDetail::renderCallback(void* data, SoAction* action)
+{
+    if (!data || !action->isOfType(SoGLRenderAction::getClassTypeId())) {
+        return;
+    }
+
+    auto self = static_cast<ShapeLevelOfDetail*>(data);
+    int level = self->chooseLevel(action->getState());
+    if (level < 0) {
+        return;
+    }
+
+    // Remember the level per view, so that views showing the shape at different sizes
+    // don't keep switching it back and forth
+    auto now = std::chrono::steady_clock::now();
+    auto it = std::find_if(self->requests.begin(), self->requests.end(), [action](const auto& req) {
+        return req.action == action;
+    });
+    if (it == self->requests.end()) {
+        self->requests.push_back({action, level, now});
+    }
+    else {
+        it->level = level;
+        it->time = now;
+    }
+
+    // The scene graph must not be modified during the traversal
+    if (level != self->currentLevel && !self->sensor.isScheduled()) {
+        self->sensor.schedule();
+    }
+}
+
+void ShapeLevelOfDetail::sensorCallback(void* data, SoSensor* /*sensor*/)
+{
+    auto self = static_cast<ShapeLevelOfDetail*>(data);
+
+    auto now = std::chrono::steady_clock::now();
+    int level = NumLevels;
+    for (const auto& req : self->requests) {
+        if (now - req.time <= requestTimeout) {
+            level = std::min(level, req.level);
+        }
+    }
+    if (level >= NumLevels || level == self->currentLevel) {
+        return;
+    }
+
+    if (!self->levels[level] && level > 0) {
+        self->startComputing();
+        return;
+    }
+    self->apply(level);
+}
+
+int ShapeLevelOfDetail::chooseLevel(SoState* state) const
+{
+    if (!enabled || bounds.isEmpty()) {
+        return -1;
+    }
+
+    const SbMatrix& matrix = SoModelMatrixElement::get(state);
+    const SbViewVolume& volume = SoViewVolumeElement::get(state);
+    const SbViewportRegion& viewport = SoViewportRegionElement::get(state);
+
+    SbVec3f center;
+    matrix.multVecMatrix(bounds.getCenter(), center);
+    // the height of the viewport in world units at the center of the shape
+    float worldHeight = volume.getWorldToScreenScale(center, 1.0F);
+    if (!(worldHeight > 0.0F)) {
+        return 0;
+    }
+
+    SbVec3f unit;
+    matrix.multDirMatrix(SbVec3f(1.0F, 0.0F, 0.0F), unit);
+    float pixelsPerUnit = unit.length() * viewport.getViewportSizePixels()[1] / worldHeight;
+    // Accept a coarser tessellation while navigating a scene that is too slow to render
+    float allowedError = screenError
+        * static_cast<float>(1 << (2 * Gui::SoFCInteractionDetailElement::get(state)));
+
+    for (int level = NumLevels - 1; level > 0; --level) {
+        float error = static_cast<float>(deflections[level]) * pixelsPerUnit;
+        float margin = level > currentLevel ? coarsenMargin : 1.0F;
+        if (error <= allowedError * margin) {
+            return level;
+        }
+    }
+    return 0;
+}
+
+void ShapeLevelOfDetail::startComputing()
+{
+    if (watcher || computed || shape.IsNull()) {
+        return;
+    }
+
+    watcher = std::make_unique<QFutureWatcher<Result>>();
+    QObject::connect(watcher.get(), &QFutureWatcher<Result>::finished, watcher.get(), [this]() {
+        onComputed();
+    });
+
+    // The coarse levels are meshed on copies, because the triangulation stored on the
+    // shape itself is shared with the full tessellation and the exporters
+    TopoDS_Shape source = shape;
+    double dev = deviation;
+    double angDeflection = angularDeflection;
+    watcher->setFuture(QtConcurrent::run([source, dev, angDeflection]() {
+        Result result;
+        for (int level = 1; level < NumLevels; ++level) {
+            try {
+                BRepBuilderAPI_Copy copy(source, Standard_True, Standard_False);
+                TopoDS_Shape coarse = copy.Shape();
+                result.deflections[level] = ViewProviderPartExt::meshShape(
+                    coarse,
+                    dev * deviationFactors[level],
+                    std::min(angDeflection * angularFactors[level], maxAngularDeflection)
+                );
+                result.shapes[level] = coarse;
+            }
+            catch (const Standard_Failure&) {
+                result.shapes[level].Nullify();
+            }
+        }
+        return result;
+    }));
+}
+
+void ShapeLevelOfDetail::onComputed()
+{
+    computed = true;
+    Result result = watcher->result();
+    int numFaces = faceset->partIndex.getNum();
+    if (levels[0]) {
+        numFaces = levels[0]->faceset->partIndex.getNum();
+    }
+
+    for (int level = 1; level < NumLevels; ++level) {
+        if (result.shapes[level].IsNull()) {
+            continue;
+        }
+        auto node = new SoFCShape;
+        node->ref();
+        try {
+            ViewProviderPartExt::fillCoinGeometry(
+                result.shapes[level],
+                node->coords,
+                node->faceset,
+                node->norm,
+                node->lineset,
+                node->nodeset,
+                normalsFromUV
+            );
+        }
+        catch (const Standard_Failure&) {
+            node->unref();
+            continue;
+        }
+        // faces are referenced by index, so all levels must have the same faces
+        if (node->faceset->partIndex.getNum() != numFaces) {
+            node->unref();
+            continue;
+        }
+        levels[level] = node;
+        deflections[level] = result.deflections[level];
+    }
+
+    // render again to choose the level
+    callback->touch();
+}
+
+void ShapeLevelOfDetail::store(SoFCShape* level) const
+{
+    level->coords->point = coords->point;
+    level->norm->vector = norm->vector;
+    level->faceset->coordIndex = faceset->coordIndex;
+    level->faceset->partIndex = faceset->partIndex;
+    level->lineset->coordIndex = lineset->coordIndex;
+    level->nodeset->startIndex = nodeset->startIndex;
+}
+
+void ShapeLevelOfDetail::apply(int level)
+{
+    if (level == currentLevel || !levels[level]) {
+        return;
+    }
+
+    if (!levels[0]) {
+        levels[0] = new SoFCShape;
+        levels[0]->ref();
+        store(levels[0]);
+    }
+
+    Gui::SoUpdateVBOAction action;
+    action.apply(faceset);
+
+    SoFCShape* source = levels[level];
+    coords->point = source->coords->point;
+    norm->vector = source->norm->vector;
+    faceset->coordIndex = source->faceset->coordIndex;
+    faceset->partIndex = source->faceset->partIndex;
+    lineset->coordIndex = source->lineset->coordIndex;
+    nodeset->startIndex = source->nodeset->startIndex;
+    currentLevel = level;
+
+    // the full tessellation is only kept aside while a coarser one is shown
+    if (level == 0) {
+        levels[0]->unref();
+        levels[0] = nullptr;
+    }
+}
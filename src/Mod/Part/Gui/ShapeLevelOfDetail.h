@@ -0,0 +1,155 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <QFutureWatcher>
+
+#include <Inventor/SbBox3f.h>
+#include <Inventor/sensors/SoOneShotSensor.h>
+
+#include <TopoDS_Shape.hxx>
+
+class SoAction;
+class SoCallback;
+class SoCoordinate3;
+class SoNormal;
+class SoSensor;
+class SoState;
+
+namespace PartGui
+{
+
+class SoBrepFaceSet;
+class SoBrepEdgeSet;
+class SoBrepPointSet;
+class SoFCShape;
+
+/** Automatic level of detail of the tessellation of a Part view provider
+ *
+ * The view provider renders its shape with the tessellation given by its Deviation and
+ * AngularDeflection. For big shapes coarser tessellations are computed in the background
+ * and, while the shape appears small on screen, swapped into the Coin nodes of the view
+ * provider. A level is used as long as its linear deflection projects to at most
+ * LevelOfDetailScreenError pixels. The faces, edges and vertices keep their order on all
+ * levels, so selection and per face colours are unaffected.
+ *
+ * The level is chosen from a callback node placed above the coordinates, so it sees the
+ * placement of every instance including links. The finest level any view asks for wins.
+ */
+class ShapeLevelOfDetail
+{
+public:
+    ShapeLevelOfDetail(
+        SoCoordinate3* coords,
+        SoNormal* norm,
+        SoBrepFaceSet* faceset,
+        SoBrepEdgeSet* lineset,
+        SoBrepPointSet* nodeset
+    );
+    ~ShapeLevelOfDetail();
+
+    ShapeLevelOfDetail(const ShapeLevelOfDetail&) = delete;
+    ShapeLevelOfDetail& operator=(const ShapeLevelOfDetail&) = delete;
+
+    /// The node that has to be inserted before the coordinates
+    SoCallback* getNode() const
+    {
+        return callback;
+    }
+
+    /// Called after the nodes were filled with the full tessellation of \a shape
+    void reset(
+        const TopoDS_Shape& shape,
+        double deviation,
+        double angularDeflection,
+        bool normalsFromUV
+    );
+    /// Forget all coarse levels, the nodes are about to be refilled
+    void clear();
+
+    int getLevel() const
+    {
+        return currentLevel;
+    }
+
+    static constexpr int NumLevels = 3;
+
+private:
+    static void renderCallback(void* data, SoAction* action);
+    static void sensorCallback(void* data, SoSensor* sensor);
+
+    int chooseLevel(SoState* state) const;
+    void startComputing();
+    void onComputed();
+    void apply(int level);
+    void store(SoFCShape* level) const;
+
+private:
+    SoCoordinate3* coords;
+    SoNormal* norm;
+    SoBrepFaceSet* faceset;
+    SoBrepEdgeSet* lineset;
+    SoBrepPointSet* nodeset;
+
+    SoCallback* callback;
+    SoOneShotSensor sensor;
+
+    TopoDS_Shape shape;
+    double deviation = 0.0;
+    double angularDeflection = 0.0;
+    bool normalsFromUV = false;
+    bool enabled = false;
+    float screenError = 1.0F;
+    SbBox3f bounds;
+
+    /// Level 0 is the full tessellation, it is only stored while a coarser level is shown
+    std::array<SoFCShape*, NumLevels> levels {};
+    std::array<double, NumLevels> deflections {};
+    int currentLevel = 0;
+
+    struct Request
+    {
+        const SoAction* action;
+        int level;
+        std::chrono::steady_clock::time_point time;
+    };
+    /// The level last chosen by each view rendering the shape
+    std::vector<Request> requests;
+
+    struct Result
+    {
+        std::array<TopoDS_Shape, NumLevels> shapes;
+        std::array<double, NumLevels> deflections {};
+    };
+    std::unique_ptr<QFutureWatcher<Result>> watcher;
+    bool computed = false;
+};
+
+}  // namespace PartGui
@@ -29,8 +29,10 @@
 #endif
 #ifdef FC_OS_MACOSX
 # include <OpenGL/gl.h>
+# include <OpenGL/glext.h>
 #else
 # include <GL/gl.h>
+# include <GL/glext.h>
 #endif
 #include <algorithm>
 #include <limits>
@@ -44,10 +46,13 @@
 #include <Inventor/elements/SoGLCoordinateElement.h>
 #include <Inventor/elements/SoLineWidthElement.h>
 #include <Inventor/errors/SoDebugError.h>
+#include <Inventor/misc/SoNotification.h>
 #include <Inventor/misc/SoState.h>
 #include <Inventor/nodes/SoGroup.h>
 #include <Inventor/actions/SoSearchAction.h>
 
+#include <Gui/GLBuffer.h>
+#include <Gui/SoFCInteractiveElement.h>
 #include <Gui/Selection/SoFCUnifiedSelection.h>
 #include <Gui/Selection/Selection.h>
 #include <Base/Console.h>
@@ -75,10 +80,50 @@ void SoBrepEdgeSet::initClass()
 SoBrepEdgeSet::SoBrepEdgeSet()
     : selContext(std::make_shared<SelContext>())
     , selContext2(std::make_shared<SelContext>())
+    , vertexBuffer(std::make_unique<Gui::OpenGLMultiBuffer>(GL_ARRAY_BUFFER))
 {
     SO_NODE_CONSTRUCTOR(SoBrepEdgeSet);
 }
 
+SoBrepEdgeSet::~SoBrepEdgeSet() = default;
+
+void SoBrepEdgeSet::notify(SoNotList* list)
+{
+    if (list->getLastField() == &this->coordIndex) {
+        lineIndexDirty = true;
+    }
+    inherited::notify(list);
+}
+
+const std::vector<int32_t>& SoBrepEdgeSet::getLineStarts()
+{
+    if (lineIndexDirty) {
+        lineIndexDirty = false;
+        const int32_t* cindices = this->coordIndex.getValues(0);
+        int numcindices = this->coordIndex.getNum();
+
+        // every -1 terminates a line, even if it is empty
+        lineStarts.clear();
+        bool newLine = true;
+        for (int i = 0; i < numcindices; i++) {
+            if (newLine) {
+                lineStarts.push_back(i);
+                newLine = false;
+            }
+            if (cindices[i] < 0) {
+                newLine = true;
+            }
+        }
+
+        segments.clear();
+        appendSegments(cindices, numcindices);
+        allSegments.swap(segments);
+        segments.clear();
+    }
+
+    return lineStarts;
+}
+
 void SoBrepEdgeSet::GLRender(SoGLRenderAction* action)
 {
     auto state = action->getState();
@@ -89,6 +134,11 @@ void SoBrepEdgeSet::GLRender(SoGLRenderAction* action)
     if (ctx2 && ctx2->selectionIndex.empty() && ctx2->colors.empty()) {
         return;
     }
+    // Unselected edges are left out while navigating a scene that is too slow to render
+    if (Gui::SoFCInteractionDetailElement::get(state) >= Gui::SoFCInteractionDetailElement::Minimal
+        && (!ctx || ctx->selectionIndex.empty())) {
+        return;
+    }
 
 
     bool hasContextHighlight = ctx && !ctx->hl.empty();
@@ -166,8 +216,6 @@ void SoBrepEdgeSet::GLRender(SoGLRenderAction* action)
             normalCacheUsed
         );
 
-        const SbVec3f* coords3d = coords->getArrayPtr3();
-
         // Apply the default material settings (Standard Lighting/Material)
         // This ensures default lines look correct (e.g. Black)
         SoMaterialBundle mb(action);
@@ -186,6 +234,7 @@ void SoBrepEdgeSet::GLRender(SoGLRenderAction* action)
         int i = 0;
 
         // --- PASS 1: Render Default Lines (Lit) ---
+        segments.clear();
         while (i < numcindices) {
             int startIndex = i;
 
@@ -214,8 +263,9 @@ void SoBrepEdgeSet::GLRender(SoGLRenderAction* action)
                 i++;  // skip the -1 separator
             }
             else {
-                // This is a default line. Render immediately with current (Lit) state.
-                glBegin(GL_LINE_STRIP);
+                // This is a default line. Collect it to render all of them at once with the
+                // current (Lit) state.
+                int32_t prev = -1;
                 while (i < numcindices) {
                     int32_t idx = cindices[i++];
                     if (idx < 0) {
@@ -223,16 +273,22 @@ void SoBrepEdgeSet::GLRender(SoGLRenderAction* action)
                     }
 
                     if (idx < coords->getNum()) {
-                        if (normals) {
-                            glNormal3fv((const GLfloat*)(normals + idx));
+                        if (prev >= 0) {
+                            segments.push_back(prev);
+                            segments.push_back(idx);
                         }
-                        glVertex3fv((const GLfloat*)(coords3d + idx));
+                        prev = idx;
                     }
                 }
-                glEnd();
             }
             linecount++;
         }
+        renderSegments(
+            action,
+            static_cast<const SoGLCoordinateElement*>(coords),
+            normals,
+            segments
+        );
 
         // --- PASS 2: Render Highlighted Lines (Unlit) ---
         if (!highlights.empty()) {
@@ -247,7 +303,8 @@ void SoBrepEdgeSet::GLRender(SoGLRenderAction* action)
                 // OpenGL Alpha is 1.0 (opaque) to 0.0 (transparent)
                 glColor4f(segment.color.r, segment.color.g, segment.color.b, 1.0f - segment.color.a);
 
-                glBegin(GL_LINE_STRIP);
+                segments.clear();
+                int32_t prev = -1;
                 int j = segment.startIndex;
                 while (j < numcindices) {
                     int32_t idx = cindices[j++];
@@ -256,10 +313,19 @@ void SoBrepEdgeSet::GLRender(SoGLRenderAction* action)
                     }
 
                     if (idx < coords->getNum()) {
-                        glVertex3fv((const GLfloat*)(coords3d + idx));
+                        if (prev >= 0) {
+                            segments.push_back(prev);
+                            segments.push_back(idx);
+                        }
+                        prev = idx;
                     }
                 }
-                glEnd();
+                renderSegments(
+                    action,
+                    static_cast<const SoGLCoordinateElement*>(coords),
+                    nullptr,
+                    segments
+                );
             }
             glPopAttrib();
         }
@@ -395,29 +461,103 @@ void SoBrepEdgeSet::getBoundingBox(SoGetBoundingBoxAction* action)
     }
 }
 
-void SoBrepEdgeSet::renderShape(
-    const SoGLCoordinateElement* const coords,
-    const int32_t* cindices,
-    int numindices
-)
+void SoBrepEdgeSet::appendSegments(const int32_t* cindices, int numindices)
 {
-
-    const SbVec3f* coords3d = coords->getArrayPtr3();
-
     int32_t i;
-    int previ;
+    int32_t previ;
     const int32_t* end = cindices + numindices;
     while (cindices < end) {
-        glBegin(GL_LINE_STRIP);
         previ = *cindices++;
         i = (cindices < end) ? *cindices++ : -1;
         while (i >= 0) {
-            glVertex3fv((const GLfloat*)(coords3d + previ));
-            glVertex3fv((const GLfloat*)(coords3d + i));
+            if (previ >= 0) {
+                segments.push_back(previ);
+                segments.push_back(i);
+            }
             previ = i;
             i = cindices < end ? *cindices++ : -1;
         }
-        glEnd();
+    }
+}
+
+void SoBrepEdgeSet::renderShape(
+    SoGLRenderAction* action,
+    const SoGLCoordinateElement* const coords,
+    const int32_t* cindices,
+    int numindices
+)
+{
+    // the complete shape uses the cached line segments
+    if (cindices == this->coordIndex.getValues(0) && numindices == this->coordIndex.getNum()) {
+        getLineStarts();
+        renderSegments(action, coords, nullptr, allSegments);
+        return;
+    }
+
+    segments.clear();
+    appendSegments(cindices, numindices);
+    renderSegments(action, coords, nullptr, segments);
+}
+
+/**
+ * Renders the line segments as vertex arrays. The coordinates are kept in a vertex buffer object
+ * that is only uploaded again if the coordinates have changed, so that highlighting or selecting
+ * some edges only transfers their indices.
+ */
+void SoBrepEdgeSet::renderSegments(
+    SoGLRenderAction* action,
+    const SoGLCoordinateElement* const coords,
+    const SbVec3f* normals,
+    const std::vector<uint32_t>& lines
+)
+{
+    const SbVec3f* coords3d = coords->getArrayPtr3();
+    if (lines.empty() || !coords3d) {
+        return;
+    }
+
+    static bool init = false;
+    static bool vboAvailable = false;
+    uint32_t context = action->getCacheContext();
+    if (!init) {
+        vboAvailable = Gui::OpenGLBuffer::isVBOSupported(context);
+        init = true;
+    }
+
+    // the normals are not part of the buffer object and must be set before binding it
+    if (normals) {
+        glEnableClientState(GL_NORMAL_ARRAY);
+        glNormalPointer(GL_FLOAT, 0, normals);
+    }
+    glEnableClientState(GL_VERTEX_ARRAY);
+
+    bool useVBO = vboAvailable;
+    if (useVBO) {
+        vertexBuffer->setCurrentContext(context);
+        auto it = vertexNodeIds.find(context);
+        if (vertexBuffer->isCreated(context) && it != vertexNodeIds.end()
+            && it->second == coords->getNodeId()) {
+            vertexBuffer->bind();
+        }
+        else if (vertexBuffer->create()) {
+            vertexBuffer->bind();
+            vertexBuffer->allocate(coords3d, coords->getNum() * int(sizeof(SbVec3f)));
+            vertexNodeIds[context] = coords->getNodeId();
+        }
+        else {
+            useVBO = false;
+        }
+    }
+
+    glVertexPointer(3, GL_FLOAT, 0, useVBO ? nullptr : coords3d);
+    glDrawElements(GL_LINES, GLsizei(lines.size()), GL_UNSIGNED_INT, lines.data());
+
+    if (useVBO) {
+        vertexBuffer->release();
+    }
+    glDisableClientState(GL_VERTEX_ARRAY);
+    if (normals) {
+        glDisableClientState(GL_NORMAL_ARRAY);
     }
 }
 
@@ -463,7 +603,12 @@ void SoBrepEdgeSet::renderHighlight(SoGLRenderAction* action, SelContextPtr ctx)
     int num = (int)ctx->hl.size();
     if (num > 0) {
         if (ctx->hl[0] < 0) {
-            renderShape(static_cast<const SoGLCoordinateElement*>(coords), cindices, numcindices);
+            renderShape(
+                action,
+                static_cast<const SoGLCoordinateElement*>(coords),
+                cindices,
+                numcindices
+            );
         }
         else {
             const int32_t* id = &(ctx->hl[0]);
@@ -474,7 +619,7 @@ void SoBrepEdgeSet::renderHighlight(SoGLRenderAction* action, SelContextPtr ctx)
                 );
             }
             else {
-                renderShape(static_cast<const SoGLCoordinateElement*>(coords), id, num);
+                renderShape(action, static_cast<const SoGLCoordinateElement*>(coords), id, num);
             }
         }
     }
@@ -521,7 +666,12 @@ void SoBrepEdgeSet::renderSelection(SoGLRenderAction* action, SelContextPtr ctx,
     int num = (int)ctx->sl.size();
     if (num > 0) {
         if (ctx->sl[0] < 0) {
-            renderShape(static_cast<const SoGLCoordinateElement*>(coords), cindices, numcindices);
+            renderShape(
+                action,
+                static_cast<const SoGLCoordinateElement*>(coords),
+                cindices,
+                numcindices
+            );
         }
         else {
             cindices = &(ctx->sl[0]);
@@ -533,7 +683,12 @@ void SoBrepEdgeSet::renderSelection(SoGLRenderAction* action, SelContextPtr ctx,
                 );
             }
             else {
-                renderShape(static_cast<const SoGLCoordinateElement*>(coords), cindices, numcindices);
+                renderShape(
+                    action,
+                    static_cast<const SoGLCoordinateElement*>(coords),
+                    cindices,
+                    numcindices
+                );
             }
         }
     }
@@ -594,15 +749,11 @@ void SoBrepEdgeSet::doAction(SoAction* action)
         int index = static_cast<const SoLineDetail*>(detail)->getLineIndex();
         const int32_t* cindices = this->coordIndex.getValues(0);
         int numcindices = this->coordIndex.getNum();
+        const std::vector<int32_t>& starts = getLineStarts();
 
         ctx->hl.clear();
-        for (int section = 0, i = 0; i < numcindices; i++) {
-            if (cindices[i] < 0) {
-                if (++section > index) {
-                    break;
-                }
-            }
-            else if (section == index) {
+        if (index >= 0 && index < int(starts.size())) {
+            for (int i = starts[index]; i < numcindices && cindices[i] >= 0; i++) {
                 ctx->hl.push_back(cindices[i]);
             }
         }
@@ -722,16 +873,16 @@ void SoBrepEdgeSet::doAction(SoAction* action)
                 if (!ctx->selectionIndex.empty()) {
                     const int32_t* cindices = this->coordIndex.getValues(0);
                     int numcindices = this->coordIndex.getNum();
-                    auto it = ctx->selectionIndex.begin();
-                    for (int section = 0, i = 0; i < numcindices; i++) {
-                        if (section == *it) {
-                            ctx->sl.push_back(cindices[i]);
+                    const std::vector<int32_t>& starts = getLineStarts();
+                    for (int line : ctx->selectionIndex) {
+                        if (line < 0 || line >= int(starts.size())) {
+                            continue;
                         }
-                        if (cindices[i] < 0) {
-                            if (++section > *it) {
-                                if (++it == ctx->selectionIndex.end()) {
-                                    break;
-                                }
+                        // copy the line including its terminating -1
+                        for (int i = starts[line]; i < numcindices; i++) {
+                            ctx->sl.push_back(cindices[i]);
+                            if (cindices[i] < 0) {
+                                break;
                             }
                         }
                     }
@@ -26,6 +26,7 @@
 
 #include <boost/algorithm/string/predicate.hpp>
 #include <Inventor/nodes/SoIndexedLineSet.h>
+#include <map>
 #include <memory>
 #include <vector>
 #include <Gui/Selection/SoFCSelectionContext.h>
@@ -36,6 +37,11 @@ class SoCoordinateElement;
 class SoGLCoordinateElement;
 class SoTextureCoordinateBundle;
 
+namespace Gui
+{
+class OpenGLMultiBuffer;
+}
+
 namespace PartGui
 {
 
@@ -57,7 +63,7 @@ public:
     }
 
 protected:
-    ~SoBrepEdgeSet() override = default;
+    ~SoBrepEdgeSet() override;
     void GLRender(SoGLRenderAction* action) override;
     void GLRenderBelowPath(SoGLRenderAction* action) override;
     void doAction(SoAction* action) override;
@@ -69,16 +75,26 @@ protected:
     ) override;
 
     void getBoundingBox(SoGetBoundingBoxAction* action) override;
+    void notify(SoNotList* list) override;
 
 private:
     struct SelContext;
     using SelContextPtr = std::shared_ptr<SelContext>;
 
     void renderShape(
+        SoGLRenderAction* action,
         const SoGLCoordinateElement* const vertexlist,
         const int32_t* vertexindices,
         int num_vertexindices
     );
+    void renderSegments(
+        SoGLRenderAction* action,
+        const SoGLCoordinateElement* const vertexlist,
+        const SbVec3f* normals,
+        const std::vector<uint32_t>& lines
+    );
+    void appendSegments(const int32_t* vertexindices, int num_vertexindices);
+    const std::vector<int32_t>& getLineStarts();
     void renderHighlight(SoGLRenderAction* action, SelContextPtr);
     void renderSelection(SoGLRenderAction* action, SelContextPtr, bool push = true);
     bool validIndexes(const SoCoordinateElement*, const std::vector<int32_t>&) const;
@@ -90,6 +106,17 @@ private:
     Gui::SoFCSelectionCounter selCounter;
     uint32_t packedColor {0};
 
+    // Offset of each line in coordIndex, rebuilt when coordIndex changes
+    std::vector<int32_t> lineStarts;
+    // Line segments of the complete shape as GL_LINES indices
+    std::vector<uint32_t> allSegments;
+    // Line segments of the currently rendered subset
+    std::vector<uint32_t> segments;
+    bool lineIndexDirty {true};
+    // The coordinates are uploaded once per context and kept until they change
+    std::unique_ptr<Gui::OpenGLMultiBuffer> vertexBuffer;
+    std::map<uint32_t, SbUniqueId> vertexNodeIds;
+
     // backreference to viewprovider that owns this node
     ViewProviderPartExt* viewProvider = nullptr;
 };
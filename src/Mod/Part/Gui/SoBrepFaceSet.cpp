@@ -31,12 +31,16 @@
 #endif
 
 #include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <limits>
 #include <map>
+#include <vector>
 #include <Inventor/SoPickedPoint.h>
 #include <Inventor/SoPrimitiveVertex.h>
 #include <Inventor/actions/SoGetBoundingBoxAction.h>
 #include <Inventor/actions/SoGLRenderAction.h>
+#include <Inventor/actions/SoRayPickAction.h>
 #include <Inventor/bundles/SoMaterialBundle.h>
 #include <Inventor/bundles/SoTextureCoordinateBundle.h>
 #include <Inventor/elements/SoLazyElement.h>
@@ -47,6 +51,9 @@
 #include <Inventor/elements/SoGLVBOElement.h>
 #include <Inventor/errors/SoDebugError.h>
 #include <Inventor/details/SoFaceDetail.h>
+#include <Inventor/details/SoPointDetail.h>
+#include <Inventor/elements/SoNormalElement.h>
+#include <Inventor/elements/SoPickStyleElement.h>
 #include <Inventor/misc/SoState.h>
 #include <Inventor/misc/SoContextHandler.h>
 #include <Inventor/elements/SoCacheElement.h>
@@ -89,11 +96,20 @@ SO_NODE_SOURCE(SoBrepFaceSet)
 class SoBrepFaceSet::VBO
 {
 public:
+    // The triangles are stored unindexed, so there is no index buffer. Normals and colours
+    // use the smallest types the fixed function pipeline accepts, normalized by OpenGL.
+    struct Vertex
+    {
+        float position[3];
+        int16_t normal[4];  // the last one only pads to 4 byte alignment
+        uint8_t color[4];
+    };
+    static_assert(sizeof(Vertex) == 24, "unexpected padding of the VBO vertex");
+
     struct Buffer
     {
-        uint32_t myvbo[2];
+        uint32_t myvbo;
         std::size_t vertex_array_size;
-        std::size_t index_array_size;
         bool updateVbo;
         bool vboLoaded;
     };
@@ -114,10 +130,8 @@ public:
         // schedule delete for all allocated GL resources
         std::map<uint32_t, Buffer>::iterator it;
         for (it = vbomap.begin(); it != vbomap.end(); ++it) {
-            void* ptr0 = (void*)((uintptr_t)it->second.myvbo[0]);
-            SoGLCacheContextElement::scheduleDeleteCallback(it->first, VBO::vbo_delete, ptr0);
-            void* ptr1 = (void*)((uintptr_t)it->second.myvbo[1]);
-            SoGLCacheContextElement::scheduleDeleteCallback(it->first, VBO::vbo_delete, ptr1);
+            void* ptr = (void*)((uintptr_t)it->second.myvbo);
+            SoGLCacheContextElement::scheduleDeleteCallback(it->first, VBO::vbo_delete, ptr);
         }
     }
 
@@ -139,6 +153,28 @@ public:
         SbBool texture
     );
 
+    static void addVertex(
+        std::vector<Vertex>& vertices,
+        const SbVec3f& point,
+        const SbVec3f& normal,
+        const SbColor& color
+    )
+    {
+        Vertex vertex;
+        point.getValue(vertex.position[0], vertex.position[1], vertex.position[2]);
+        for (int i = 0; i < 3; ++i) {
+            float n = std::clamp(normal[i], -1.0F, 1.0F);
+            vertex.normal[i] = static_cast<int16_t>(std::lround(n * 32767.0F));
+        }
+        vertex.normal[3] = 0;
+        uint32_t rgba = color.getPackedValue();
+        vertex.color[0] = static_cast<uint8_t>((rgba >> 24) & 0xFF);
+        vertex.color[1] = static_cast<uint8_t>((rgba >> 16) & 0xFF);
+        vertex.color[2] = static_cast<uint8_t>((rgba >> 8) & 0xFF);
+        vertex.color[3] = static_cast<uint8_t>(rgba & 0xFF);
+        vertices.push_back(vertex);
+    }
+
     static void context_destruction_cb(uint32_t context, void* userdata)
     {
         VBO* self = static_cast<VBO*>(userdata);
@@ -151,7 +187,7 @@ public:
                 = (PFNGLDELETEBUFFERSARBPROC)cc_glglue_getprocaddress(glue, "glDeleteBuffersARB");
 #endif
             auto& buffer = it->second;
-            glDeleteBuffersARB(2, buffer.myvbo);
+            glDeleteBuffersARB(1, &buffer.myvbo);
             self->vbomap.erase(it);
         }
     }
@@ -1678,15 +1714,11 @@ void SoBrepFaceSet::VBO::render(
     int matnr = 0;
     int trinr = 0;
 
-    float* vertex_array = nullptr;
-    GLuint* index_array = nullptr;
+    std::vector<Vertex> vertex_array;
     SbColor mycolor1, mycolor2, mycolor3;
     SbVec3f* mynormal1 = const_cast<SbVec3f*>(currnormal);
     SbVec3f* mynormal2 = const_cast<SbVec3f*>(currnormal);
     SbVec3f* mynormal3 = const_cast<SbVec3f*>(currnormal);
-    int indice = 0;
-    uint32_t RGBA, R, G, B, A;
-    float Rf, Gf, Bf, Af;
 
     uint32_t contextId = action->getCacheContext();
     auto res = this->vbomap.insert(std::make_pair(contextId, VBO::Buffer()));
@@ -1697,15 +1729,13 @@ void SoBrepFaceSet::VBO::render(
         PFNGLGENBUFFERSPROC glGenBuffersARB
             = (PFNGLGENBUFFERSPROC)cc_glglue_getprocaddress(glue, "glGenBuffersARB");
 #endif
-        glGenBuffersARB(2, buf.myvbo);
+        glGenBuffersARB(1, &buf.myvbo);
         buf.vertex_array_size = 0;
-        buf.index_array_size = 0;
         buf.vboLoaded = false;
     }
 
-    if ((buf.vertex_array_size != (sizeof(float) * num_indices * 10))
-        || (buf.index_array_size != (sizeof(GLuint) * num_indices))) {
-        if ((buf.vertex_array_size != 0) && (buf.index_array_size != 0)) {
+    if (buf.vertex_array_size != sizeof(Vertex) * num_indices) {
+        if (buf.vertex_array_size != 0) {
             buf.updateVbo = true;
         }
     }
@@ -1733,12 +1763,11 @@ void SoBrepFaceSet::VBO::render(
 #endif
         // We must manage buffer size increase let's clear everything and re-init to test the
         // clearing process
-        glDeleteBuffersARB(2, buf.myvbo);
-        glGenBuffersARB(2, buf.myvbo);
-        vertex_array = (float*)malloc(sizeof(float) * num_indices * 10);
-        index_array = (GLuint*)malloc(sizeof(GLuint) * num_indices);
-        buf.vertex_array_size = sizeof(float) * num_indices * 10;
-        buf.index_array_size = sizeof(GLuint) * num_indices;
+        glDeleteBuffersARB(1, &buf.myvbo);
+        glGenBuffersARB(1, &buf.myvbo);
+        // an upper bound, the index list also holds the -1 separators
+        vertex_array.reserve(num_indices);
+        buf.vertex_array_size = sizeof(Vertex) * num_indices;
         this->vbomap[contextId] = buf;
         this->indice_array = 0;
 
@@ -1840,83 +1869,11 @@ void SoBrepFaceSet::VBO::render(
             }
 
             /* We building the Vertex dataset there and push it to a VBO */
-            /* The Vertex array shall contain per element vertex_coordinates[3],
-            normal_coordinates[3], color_value[3] (RGBA format) */
-
-            index_array[this->indice_array] = this->indice_array;
-            index_array[this->indice_array + 1] = this->indice_array + 1;
-            index_array[this->indice_array + 2] = this->indice_array + 2;
+            addVertex(vertex_array, cur_coords3d[v1], *mynormal1, mycolor1);
+            addVertex(vertex_array, cur_coords3d[v2], *mynormal2, mycolor2);
+            addVertex(vertex_array, cur_coords3d[v3], *mynormal3, mycolor3);
             this->indice_array += 3;
 
-
-            ((SbVec3f*)(cur_coords3d + v1))
-                ->getValue(vertex_array[indice + 0], vertex_array[indice + 1], vertex_array[indice + 2]);
-
-            ((SbVec3f*)(mynormal1))
-                ->getValue(vertex_array[indice + 3], vertex_array[indice + 4], vertex_array[indice + 5]);
-
-            /* We decode the Vertex1 color */
-            RGBA = mycolor1.getPackedValue();
-            R = (RGBA & 0xFF000000) >> 24;
-            G = (RGBA & 0xFF0000) >> 16;
-            B = (RGBA & 0xFF00) >> 8;
-            A = (RGBA & 0xFF);
-
-            Rf = (((float)R) / 255.0);
-            Gf = (((float)G) / 255.0);
-            Bf = (((float)B) / 255.0);
-            Af = (((float)A) / 255.0);
-
-            vertex_array[indice + 6] = Rf;
-            vertex_array[indice + 7] = Gf;
-            vertex_array[indice + 8] = Bf;
-            vertex_array[indice + 9] = Af;
-            indice += 10;
-
-            ((SbVec3f*)(cur_coords3d + v2))
-                ->getValue(vertex_array[indice + 0], vertex_array[indice + 1], vertex_array[indice + 2]);
-            ((SbVec3f*)(mynormal2))
-                ->getValue(vertex_array[indice + 3], vertex_array[indice + 4], vertex_array[indice + 5]);
-
-            RGBA = mycolor2.getPackedValue();
-            R = (RGBA & 0xFF000000) >> 24;
-            G = (RGBA & 0xFF0000) >> 16;
-            B = (RGBA & 0xFF00) >> 8;
-            A = (RGBA & 0xFF);
-
-            Rf = (((float)R) / 255.0);
-            Gf = (((float)G) / 255.0);
-            Bf = (((float)B) / 255.0);
-            Af = (((float)A) / 255.0);
-
-            vertex_array[indice + 6] = Rf;
-            vertex_array[indice + 7] = Gf;
-            vertex_array[indice + 8] = Bf;
-            vertex_array[indice + 9] = Af;
-            indice += 10;
-
-            ((SbVec3f*)(cur_coords3d + v3))
-                ->getValue(vertex_array[indice + 0], vertex_array[indice + 1], vertex_array[indice + 2]);
-            ((SbVec3f*)(mynormal3))
-                ->getValue(vertex_array[indice + 3], vertex_array[indice + 4], vertex_array[indice + 5]);
-
-            RGBA = mycolor3.getPackedValue();
-            R = (RGBA & 0xFF000000) >> 24;
-            G = (RGBA & 0xFF0000) >> 16;
-            B = (RGBA & 0xFF00) >> 8;
-            A = (RGBA & 0xFF);
-
-            Rf = (((float)R) / 255.0);
-            Gf = (((float)G) / 255.0);
-            Bf = (((float)B) / 255.0);
-            Af = (((float)A) / 255.0);
-
-            vertex_array[indice + 6] = Rf;
-            vertex_array[indice + 7] = Gf;
-            vertex_array[indice + 8] = Bf;
-            vertex_array[indice + 9] = Af;
-            indice += 10;
-
             /* ============================================================ */
             trinr++;
             if (pi == trinr) {
@@ -1935,24 +1892,17 @@ void SoBrepFaceSet::VBO::render(
             }
         }
 
-        glBindBufferARB(GL_ARRAY_BUFFER_ARB, buf.myvbo[0]);
-        glBufferDataARB(GL_ARRAY_BUFFER_ARB, sizeof(float) * indice, vertex_array, GL_DYNAMIC_DRAW_ARB);
-
-        glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, buf.myvbo[1]);
+        glBindBufferARB(GL_ARRAY_BUFFER_ARB, buf.myvbo);
         glBufferDataARB(
-            GL_ELEMENT_ARRAY_BUFFER_ARB,
-            sizeof(GLuint) * this->indice_array,
-            &index_array[0],
+            GL_ARRAY_BUFFER_ARB,
+            sizeof(Vertex) * vertex_array.size(),
+            vertex_array.data(),
             GL_DYNAMIC_DRAW_ARB
         );
-
         glBindBufferARB(GL_ARRAY_BUFFER_ARB, 0);
-        glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, 0);
 
         buf.vboLoaded = true;
         buf.updateVbo = false;
-        free(vertex_array);
-        free(index_array);
     }
 
     // This is the VBO rendering code
@@ -1963,25 +1913,23 @@ void SoBrepFaceSet::VBO::render(
 #endif
 
     if (!buf.updateVbo) {
-        glBindBufferARB(GL_ARRAY_BUFFER_ARB, buf.myvbo[0]);
-        glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, buf.myvbo[1]);
+        glBindBufferARB(GL_ARRAY_BUFFER_ARB, buf.myvbo);
     }
 
     glEnableClientState(GL_VERTEX_ARRAY);
     glEnableClientState(GL_NORMAL_ARRAY);
     glEnableClientState(GL_COLOR_ARRAY);
 
-    glVertexPointer(3, GL_FLOAT, 10 * sizeof(GLfloat), nullptr);
-    glNormalPointer(GL_FLOAT, 10 * sizeof(GLfloat), (GLvoid*)(3 * sizeof(GLfloat)));
-    glColorPointer(4, GL_FLOAT, 10 * sizeof(GLfloat), (GLvoid*)(6 * sizeof(GLfloat)));
+    glVertexPointer(3, GL_FLOAT, sizeof(Vertex), (GLvoid*)offsetof(Vertex, position));
+    glNormalPointer(GL_SHORT, sizeof(Vertex), (GLvoid*)offsetof(Vertex, normal));
+    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), (GLvoid*)offsetof(Vertex, color));
 
-    glDrawElements(GL_TRIANGLES, this->indice_array, GL_UNSIGNED_INT, (void*)nullptr);
+    glDrawArrays(GL_TRIANGLES, 0, this->indice_array);
 
     glDisableClientState(GL_COLOR_ARRAY);
     glDisableClientState(GL_NORMAL_ARRAY);
     glDisableClientState(GL_VERTEX_ARRAY);
     glBindBufferARB(GL_ARRAY_BUFFER_ARB, 0);
-    glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, 0);
     buf.updateVbo = false;
     // The data is within the VBO we can clear it at application level
 }
@@ -2192,6 +2140,136 @@ void SoBrepFaceSet::renderShape(
     glEnd();
 }
 
+bool SoBrepFaceSet::updatePickBounds(const SoCoordinateElement* coords)
+{
+    if (pickNodeId == getNodeId() && pickCoordsId == coords->getNodeId()) {
+        return !partBounds.empty();
+    }
+    pickNodeId = getNodeId();
+    pickCoordsId = coords->getNodeId();
+    partBounds.clear();
+
+    // Only the plain triangle lists set up by the view provider are handled
+    const int32_t* cindices = this->coordIndex.getValues(0);
+    const int32_t* pindices = this->partIndex.getValues(0);
+    int numindices = this->coordIndex.getNum();
+    int numparts = this->partIndex.getNum();
+    if (numparts == 0 || numindices % 4 != 0) {
+        return false;
+    }
+
+    int numcoords = coords->getNum();
+    std::vector<SbBox3f> bounds(numparts);
+    int index = 0;
+    for (int part = 0; part < numparts; ++part) {
+        for (int tri = 0; tri < pindices[part]; ++tri, index += 4) {
+            if (index + 3 >= numindices || cindices[index + 3] >= 0) {
+                return false;
+            }
+            for (int k = 0; k < 3; ++k) {
+                int32_t v = cindices[index + k];
+                if (v < 0 || v >= numcoords) {
+                    return false;
+                }
+                bounds[part].extendBy(coords->get3(v));
+            }
+        }
+    }
+    if (index != numindices) {
+        return false;
+    }
+
+    partBounds = std::move(bounds);
+    return true;
+}
+
+void SoBrepFaceSet::rayPick(SoRayPickAction* action)
+{
+    // Picking the generated primitives tests every triangle of the shape. For the
+    // mouse-over preselection this shows on big shapes, so only the triangles of the
+    // parts whose bounding box is hit are tested here.
+    SoState* state = action->getState();
+    if (this->vertexProperty.getValue()
+        || SoPickStyleElement::get(state) != SoPickStyleElement::SHAPE) {
+        inherited::rayPick(action);
+        return;
+    }
+    if (!this->shouldRayPick(action)) {
+        return;
+    }
+
+    const SoCoordinateElement* coords = SoCoordinateElement::getInstance(state);
+    if (!updatePickBounds(coords)) {
+        inherited::rayPick(action);
+        return;
+    }
+
+    this->computeObjectSpaceRay(action);
+
+    // normals are indexed like the coordinates, see ViewProviderPartExt::setupCoinGeometry()
+    const SoNormalElement* normalElement = SoNormalElement::getInstance(state);
+    const SbVec3f* normals = nullptr;
+    if (findNormalBinding(state) == PER_VERTEX_INDEXED && this->normalIndex.getNum() == 0
+        && normalElement->getNum() >= coords->getNum()) {
+        normals = normalElement->getArrayPtr();
+    }
+
+    const int32_t* cindices = this->coordIndex.getValues(0);
+    const int32_t* pindices = this->partIndex.getValues(0);
+    int numparts = this->partIndex.getNum();
+    int index = 0;
+    int trinr = 0;
+    for (int part = 0; part < numparts; ++part) {
+        int numtris = pindices[part];
+        if (!action->intersect(partBounds[part], TRUE)) {
+            index += numtris * 4;
+            trinr += numtris;
+            continue;
+        }
+        for (int tri = 0; tri < numtris; ++tri, index += 4, ++trinr) {
+            const int32_t* v = cindices + index;
+            const SbVec3f& p0 = coords->get3(v[0]);
+            const SbVec3f& p1 = coords->get3(v[1]);
+            const SbVec3f& p2 = coords->get3(v[2]);
+            SbVec3f isect;
+            SbVec3f barycentric;
+            SbBool front;
+            if (!action->intersect(p0, p1, p2, isect, barycentric, front)
+                || !action->isBetweenPlanes(isect)) {
+                continue;
+            }
+            SoPickedPoint* pp = action->addIntersection(isect);
+            if (!pp) {
+                continue;
+            }
+
+            SbVec3f normal;
+            if (normals) {
+                normal = normals[v[0]] * barycentric[0] + normals[v[1]] * barycentric[1]
+                    + normals[v[2]] * barycentric[2];
+            }
+            else {
+                normal = (p1 - p0).cross(p2 - p0);
+            }
+            normal.normalize();
+            pp->setObjectNormal(normal);
+
+            // the same detail as created by createTriangleDetail() for the generated primitives
+            auto detail = new SoFaceDetail;
+            detail->setFaceIndex(trinr);
+            detail->setPartIndex(part);
+            detail->setNumPoints(3);
+            SoPointDetail pointDetail;
+            for (int k = 0; k < 3; ++k) {
+                pointDetail.setCoordinateIndex(v[k]);
+                pointDetail.setNormalIndex(v[k]);
+                detail->setPoint(k, &pointDetail);
+            }
+            pp->setDetail(detail, this);
+        }
+    }
+}
+
 SoDetail* SoBrepFaceSet::createTriangleDetail(
     SoRayPickAction* action,
     const SoPrimitiveVertex* v1,
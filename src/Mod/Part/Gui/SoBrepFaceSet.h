@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <Inventor/SbBox3f.h>
 #include <Inventor/fields/SoMFInt32.h>
 #include <Inventor/fields/SoSFInt32.h>
 #include <Inventor/nodes/SoIndexedFaceSet.h>
@@ -33,10 +34,10 @@
 #include <Mod/Part/PartGlobal.h>
 
 
+class SoCoordinateElement;
 class SoGLCoordinateElement;
 class SoTextureCoordinateBundle;
 
-
 namespace PartGui
 {
 
@@ -111,6 +112,7 @@ protected:
     ) override;
     void generatePrimitives(SoAction* action) override;
     void getBoundingBox(SoGetBoundingBoxAction* action) override;
+    void rayPick(SoRayPickAction* action) override;
 
 private:
     enum Binding
@@ -153,6 +155,8 @@ private:
 
     bool overrideMaterialBinding(SoGLRenderAction* action, SelContextPtr ctx, SelContextPtr ctx2);
 
+    bool updatePickBounds(const SoCoordinateElement* coords);
+
 #ifdef RENDER_GLARRAYS
     void renderSimpleArray();
     void renderColoredArray(SoMaterialBundle* const materials);
@@ -170,6 +174,11 @@ private:
     uint32_t packedColor;
     Gui::SoFCSelectionCounter selCounter;
 
+    // Bounding box of each part to skip the triangles of parts missed by a pick ray
+    std::vector<SbBox3f> partBounds;
+    SbUniqueId pickNodeId = 0;
+    SbUniqueId pickCoordsId = 0;
+
     // Define some VBO pointer for the current mesh
     class VBO;
     std::unique_ptr<VBO> pimpl;
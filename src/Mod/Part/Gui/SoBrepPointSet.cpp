@@ -34,6 +34,7 @@
 #endif
 #include <algorithm>
 #include <limits>
+#include <vector>
 #include <Inventor/actions/SoGetBoundingBoxAction.h>
 #include <Inventor/actions/SoGLRenderAction.h>
 #include <Inventor/bundles/SoMaterialBundle.h>
@@ -43,6 +44,7 @@
 #include <Inventor/errors/SoDebugError.h>
 #include <Inventor/misc/SoState.h>
 
+#include <Gui/SoFCInteractiveElement.h>
 #include <Gui/Selection/SoFCUnifiedSelection.h>
 #include <Gui/Inventor/So3DAnnotation.h>
 
@@ -54,6 +56,29 @@ using namespace PartGui;
 
 SO_NODE_SOURCE(SoBrepPointSet)
 
+namespace
+{
+// Render the points as vertex array instead of one call per point
+void renderPointArray(const SbVec3f* coords3d, int start, int count)
+{
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glVertexPointer(3, GL_FLOAT, 0, coords3d);
+    glDrawArrays(GL_POINTS, start, count);
+    glDisableClientState(GL_VERTEX_ARRAY);
+}
+
+void renderPointArray(const SbVec3f* coords3d, const std::vector<uint32_t>& indices)
+{
+    if (indices.empty()) {
+        return;
+    }
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glVertexPointer(3, GL_FLOAT, 0, coords3d);
+    glDrawElements(GL_POINTS, GLsizei(indices.size()), GL_UNSIGNED_INT, indices.data());
+    glDisableClientState(GL_VERTEX_ARRAY);
+}
+}  // namespace
+
 void SoBrepPointSet::initClass()
 {
     SO_NODE_INIT_CLASS(SoBrepPointSet, SoPointSet, "PointSet");
@@ -85,6 +110,11 @@ void SoBrepPointSet::GLRender(SoGLRenderAction* action)
     if (selContext2->checkGlobal(ctx)) {
         ctx = selContext2;
     }
+    // Unselected vertices are left out while navigating a scene that is too slow to render
+    if (Gui::SoFCInteractionDetailElement::get(state) >= Gui::SoFCInteractionDetailElement::Minimal
+        && (!ctx || ctx->selectionIndex.empty())) {
+        return;
+    }
 
 
     bool hasContextHighlight = ctx && ctx->isHighlighted() && !ctx->isHighlightAll()
@@ -245,11 +275,8 @@ void SoBrepPointSet::renderHighlight(SoGLRenderAction* action, SelContextPtr ctx
     const SbVec3f* coords3d = coords->getArrayPtr3();
     if (coords3d) {
         if (id == std::numeric_limits<int>::max()) {
-            glBegin(GL_POINTS);
-            for (int idx = startIndex.getValue(); idx < coords->getNum(); ++idx) {
-                glVertex3fv((const GLfloat*)(coords3d + idx));
-            }
-            glEnd();
+            int start = startIndex.getValue();
+            renderPointArray(coords3d, start, coords->getNum() - start);
         }
         else if (id < this->startIndex.getValue() || id >= coords->getNum()) {
             SoDebugError::postWarning("SoBrepPointSet::renderHighlight", "highlightIndex out of range");
@@ -290,23 +317,22 @@ void SoBrepPointSet::renderSelection(SoGLRenderAction* action, SelContextPtr ctx
     int startIndex = this->startIndex.getValue();
     const SbVec3f* coords3d = coords->getArrayPtr3();
     if (coords3d) {
-        glBegin(GL_POINTS);
         if (ctx->isSelectAll()) {
-            for (int idx = startIndex; idx < coords->getNum(); ++idx) {
-                glVertex3fv((const GLfloat*)(coords3d + idx));
-            }
+            renderPointArray(coords3d, startIndex, coords->getNum() - startIndex);
         }
         else {
+            std::vector<uint32_t> indices;
+            indices.reserve(ctx->selectionIndex.size());
             for (auto idx : ctx->selectionIndex) {
                 if (idx >= startIndex && idx < coords->getNum()) {
-                    glVertex3fv((const GLfloat*)(coords3d + idx));
+                    indices.push_back(idx);
                 }
                 else {
                     warn = true;
                 }
             }
+            renderPointArray(coords3d, indices);
         }
-        glEnd();
     }
     if (warn) {
         SoDebugError::postWarning("SoBrepPointSet::renderSelection", "selectionIndex out of range");
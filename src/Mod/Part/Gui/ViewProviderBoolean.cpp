@@ -31,6 +31,7 @@
 #include <Gui/BitmapFactory.h>
 #include <Gui/MainWindow.h>
 #include <Mod/Part/App/FeaturePartCommon.h>
+#include <Mod/Part/App/FeaturePartCut.h>
 #include <Mod/Part/App/FeaturePartFuse.h>
 
 #include "ViewProviderBoolean.h"
@@ -538,3 +539,147 @@ void ViewProviderMultiCommon::dropObject(App::DocumentObject* obj)
     pShapes.push_back(obj);
     pBool->Shapes.setValues(pShapes);
 }
+
+PROPERTY_SOURCE(PartGui::ViewProviderMultiCut, PartGui::ViewProviderPart)
+
+ViewProviderMultiCut::ViewProviderMultiCut() = default;
+
+ViewProviderMultiCut::~ViewProviderMultiCut() = default;
+
+std::vector<App::DocumentObject*> ViewProviderMultiCut::claimChildren() const
+{
+    return getObject<Part::MultiCut>()->Shapes.getValues();
+}
+
+QIcon ViewProviderMultiCut::getIcon() const
+{
+    return Gui::BitmapFactory().iconFromTheme("Part_Cut");
+}
+
+void ViewProviderMultiCut::updateData(const App::Property* prop)
+{
+    PartGui::ViewProviderPart::updateData(prop);
+    if (prop->is<Part::PropertyShapeHistory>()) {
+        const std::vector<Part::ShapeHistory>& hist
+            = static_cast<const Part::PropertyShapeHistory*>(prop)->getValues();
+        Part::MultiCut* objBool = getObject<Part::MultiCut>();
+        std::vector<App::DocumentObject*> sources = objBool->Shapes.getValues();
+        if (hist.size() != sources.size()) {
+            return;
+        }
+
+        const TopoDS_Shape& boolShape = objBool->Shape.getValue();
+        TopTools_IndexedMapOfShape boolMap;
+        TopExp::MapShapes(boolShape, TopAbs_FACE, boolMap);
+
+        std::vector<App::Material> colBool;
+        colBool.resize(boolMap.Extent(), this->ShapeAppearance[0]);
+
+        int index = 0;
+        for (std::vector<App::DocumentObject*>::iterator it = sources.begin(); it != sources.end();
+             ++it, ++index) {
+            Part::Feature* objBase = dynamic_cast<Part::Feature*>(Part::Feature::getShapeOwner(*it));
+            if (!objBase) {
+                continue;
+            }
+            const TopoDS_Shape& baseShape = objBase->Shape.getValue();
+
+            TopTools_IndexedMapOfShape baseMap;
+            TopExp::MapShapes(baseShape, TopAbs_FACE, baseMap);
+
+            auto vpBase = dynamic_cast<PartGui::ViewProviderPart*>(
+                Gui::Application::Instance->getViewProvider(objBase)
+            );
+            if (vpBase) {
+                std::vector<App::Material> colBase = vpBase->ShapeAppearance.getValues();
+                applyTransparency(vpBase->Transparency.getValue(), colBase);
+                if (static_cast<int>(colBase.size()) == baseMap.Extent()) {
+                    applyMaterial(hist[index], colBase, colBool);
+                }
+                else if (!colBase.empty() && colBase[0] != this->ShapeAppearance[0]) {
+                    colBase.resize(baseMap.Extent(), colBase[0]);
+                    applyMaterial(hist[index], colBase, colBool);
+                }
+            }
+        }
+
+        // If the view provider has set a transparency then override the values
+        // of the input shapes
+        if (Transparency.getValue() > 0) {
+            applyTransparency(Transparency.getValue(), colBool);
+        }
+
+        this->ShapeAppearance.setValues(colBool);
+    }
+    else if (prop->isDerivedFrom<App::PropertyLinkList>()) {
+        std::vector<App::DocumentObject*> pShapes
+            = static_cast<const App::PropertyLinkList*>(prop)->getValues();
+        for (auto it : pShapes) {
+            if (it) {
+                Gui::Application::Instance->hideViewProvider(it);
+            }
+        }
+    }
+}
+
+bool ViewProviderMultiCut::onDelete(const std::vector<std::string>& subNames)
+{
+    // get the input shapes
+    Part::MultiCut* pBool = getObject<Part::MultiCut>();
+    std::vector<App::DocumentObject*> pShapes = pBool->Shapes.getValues();
+
+    QString inputDescription = QObject::tr("%1 input objects").arg(pShapes.size());
+
+    return handleBooleanDeletion(
+        subNames,
+        QObject::tr("Cut"),
+        QString::fromUtf8(pBool->Label.getValue()),
+        pShapes,
+        inputDescription
+    );
+}
+
+bool ViewProviderMultiCut::canDragObjects() const
+{
+    return true;
+}
+
+bool ViewProviderMultiCut::canDragObject(App::DocumentObject* obj) const
+{
+    (void)obj;
+    // return Part::Feature::hasShapeOwner(obj);
+    return true;
+}
+
+void ViewProviderMultiCut::dragObject(App::DocumentObject* obj)
+{
+    Part::MultiCut* pBool = getObject<Part::MultiCut>();
+    std::vector<App::DocumentObject*> pShapes = pBool->Shapes.getValues();
+    for (std::vector<App::DocumentObject*>::iterator it = pShapes.begin(); it != pShapes.end(); ++it) {
+        if (*it == obj) {
+            pShapes.erase(it);
+            pBool->Shapes.setValues(pShapes);
+            break;
+        }
+    }
+}
+
+bool ViewProviderMultiCut::canDropObjects() const
+{
+    return true;
+}
+
+bool ViewProviderMultiCut::canDropObject(App::DocumentObject* obj) const
+{
+    (void)obj;
+    // return Part::Feature::hasShapeOwner(obj);
+    return true;
+}
+
+void ViewProviderMultiCut::dropObject(App::DocumentObject* obj)
+{
+    Part::MultiCut* pBool = getObject<Part::MultiCut>();
+    std::vector<App::DocumentObject*> pShapes = pBool->Shapes.getValues();
+    pShapes.push_back(obj);
+    pBool->Shapes.setValues(pShapes);
+}
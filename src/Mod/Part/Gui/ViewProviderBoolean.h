@@ -102,5 +102,31 @@ public:
     void dropObject(App::DocumentObject*) override;
 };
 
+/// ViewProvider for the MultiCut feature
+class PartGuiExport ViewProviderMultiCut: public ViewProviderPart
+{
+    PROPERTY_HEADER_WITH_OVERRIDE(PartGui::ViewProviderMultiCut);
+
+public:
+    /// constructor
+    ViewProviderMultiCut();
+    /// destructor
+    ~ViewProviderMultiCut() override;
+
+    /// grouping handling
+    std::vector<App::DocumentObject*> claimChildren() const override;
+    QIcon getIcon() const override;
+    void updateData(const App::Property*) override;
+    bool onDelete(const std::vector<std::string>&) override;
+
+    /// drag and drop
+    bool canDragObjects() const override;
+    bool canDragObject(App::DocumentObject*) const override;
+    void dragObject(App::DocumentObject*) override;
+    bool canDropObjects() const override;
+    bool canDropObject(App::DocumentObject*) const override;
+    void dropObject(App::DocumentObject*) override;
+};
+
 
 }  // namespace PartGui
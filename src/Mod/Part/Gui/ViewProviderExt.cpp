@@ -24,11 +24,9 @@
 
 #include <Bnd_Box.hxx>
 #include <BRep_Tool.hxx>
-#include <BRepTools.hxx>
 #include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include <BRepExtrema_DistShapeShape.hxx>
-#include <BRepMesh_IncrementalMesh.hxx>
 #include <gp_Trsf.hxx>
 #include <Precision.hxx>
 #include <Poly_Array1OfTriangle.hxx>
@@ -41,6 +39,7 @@
 #include <TColStd_Array1OfInteger.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
+#include <TopLoc_Location.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
@@ -50,6 +49,7 @@
 
 #include <QAction>
 #include <QMenu>
+#include <QtConcurrentRun>
 #include <sstream>
 
 #include <Inventor/SoPickedPoint.h>
@@ -58,6 +58,7 @@
 #include <Inventor/details/SoPointDetail.h>
 #include <Inventor/errors/SoDebugError.h>
 #include <Inventor/nodes/SoCoordinate3.h>
+#include <Inventor/nodes/SoCube.h>
 #include <Inventor/nodes/SoDrawStyle.h>
 #include <Inventor/nodes/SoMaterial.h>
 #include <Inventor/nodes/SoMaterialBinding.h>
@@ -66,6 +67,8 @@
 #include <Inventor/nodes/SoPolygonOffset.h>
 #include <Inventor/nodes/SoSeparator.h>
 #include <Inventor/nodes/SoShapeHints.h>
+#include <Inventor/nodes/SoSwitch.h>
+#include <Inventor/nodes/SoTranslation.h>
 
 #include <boost/algorithm/string/predicate.hpp>
 
@@ -84,6 +87,7 @@
 #include <Gui/Utilities.h>
 
 #include <Mod/Part/App/ShapeMapHasher.h>
+#include <Mod/Part/App/TessellationCache.h>
 #include <Mod/Part/App/Tools.h>
 
 #include "ViewProviderExt.h"
@@ -91,6 +95,7 @@
 #include "SoBrepEdgeSet.h"
 #include "SoBrepFaceSet.h"
 #include "SoBrepPointSet.h"
+#include "ShapeLevelOfDetail.h"
 #include "TaskFaceAppearances.h"
 
 
@@ -279,6 +284,22 @@ ViewProviderPartExt::ViewProviderPartExt()
     pShapeHints = new SoShapeHints;
     pShapeHints->shapeType = SoShapeHints::UNKNOWN_SHAPE_TYPE;
     pShapeHints->ref();
+
+    // bounding box shown while the shape is meshed in the background
+    pcProxySwitch = new SoSwitch;
+    pcProxySwitch->ref();
+    pcProxySwitch->setName("TessellationProxy");
+    pcProxySwitch->whichChild = SO_SWITCH_NONE;
+    auto* proxyRoot = new SoSeparator;
+    auto* proxyStyle = new SoDrawStyle;
+    proxyStyle->style = SoDrawStyle::LINES;
+    proxyStyle->lineWidth = 1.0F;
+    pcProxyTranslation = new SoTranslation;
+    pcProxyCube = new SoCube;
+    proxyRoot->addChild(proxyStyle);
+    proxyRoot->addChild(pcProxyTranslation);
+    proxyRoot->addChild(pcProxyCube);
+    pcProxySwitch->addChild(proxyRoot);
     Lighting.touch();
     DrawStyle.touch();
 
@@ -288,6 +309,9 @@ ViewProviderPartExt::ViewProviderPartExt()
 
 ViewProviderPartExt::~ViewProviderPartExt()
 {
+    levelOfDetail.reset();
+    cancelTessellation();
+    pcProxySwitch->unref();
     pcFaceBind->unref();
     pcLineBind->unref();
     pcPointBind->unref();
@@ -540,6 +564,12 @@ void ViewProviderPartExt::attach(App::DocumentObject* pcFeat)
     // Move 'coords' before the switch
     pcRoot->insertChild(coords, pcRoot->findChild(pcModeSwitch));
 
+    // Swaps the content of the nodes above with coarser tessellations when rendered small
+    levelOfDetail = std::make_unique<ShapeLevelOfDetail>(coords, norm, faceset, lineset, nodeset);
+    pcRoot->insertChild(levelOfDetail->getNode(), pcRoot->findChild(coords));
+
+    pcRoot->addChild(pcProxySwitch);
+
     // putting all together with the switch
     addDisplayMaskMode(pcNormalRoot, "Flat Lines");
     addDisplayMaskMode(pcFlatRoot, "Shaded");
@@ -1042,6 +1072,55 @@ void ViewProviderPartExt::unsetEdit(int ModNum)
     }
 }
 
+namespace
+{
+Part::TessellationCache::Parameters meshParameters(
+    const TopoDS_Shape& shape,
+    double deviation,
+    double angularDeflection
+)
+{
+    // calculating the deflection value
+    Standard_Real deflection = Part::Tools::getDeflection(shape, deviation);
+
+    // Since OCCT 7.6 a value of equal 0 is not allowed any more, this can happen if a single
+    // vertex should be displayed.
+    if (deflection < gp::Resolution()) {
+        deflection = Precision::Confusion();
+    }
+
+    // For very big objects the computed deflection can become very high and thus leads to a
+    // useless tessellation. To avoid this the upper limit is set to 20.0 See also forum:
+    // https://forum.freecad.org/viewtopic.php?t=77521
+    // deflection = std::min(deflection, 20.0);
+
+    // create or use the mesh on the data structure
+    Standard_Real AngDeflectionRads = Base::toRadians(angularDeflection);
+
+    Part::TessellationCache::Parameters meshParams;
+    meshParams.deflection = deflection;
+    meshParams.relative = false;
+    meshParams.angularDeflection = AngDeflectionRads;
+    meshParams.parallel = true;
+    meshParams.allowQualityDecrease = true;
+    return meshParams;
+}
+}  // namespace
+
+double ViewProviderPartExt::meshShape(
+    const TopoDS_Shape& shape,
+    double deviation,
+    double angularDeflection
+)
+{
+    auto meshParams = meshParameters(shape, deviation, angularDeflection);
+
+    // Only re-mesh if the shape hasn't been triangulated with these settings yet
+    Part::TessellationCache::instance().mesh(shape, meshParams);
+
+    return meshParams.deflection;
+}
+
 void ViewProviderPartExt::setupCoinGeometry(
     TopoDS_Shape shape,
     SoCoordinate3* coords,
@@ -1053,6 +1132,22 @@ void ViewProviderPartExt::setupCoinGeometry(
     double angularDeflection,
     bool normalsFromUV
 )
+{
+    if (!Part::Tools::isShapeEmpty(shape)) {
+        meshShape(shape, deviation, angularDeflection);
+    }
+    fillCoinGeometry(shape, coords, faceset, norm, lineset, nodeset, normalsFromUV);
+}
+
+void ViewProviderPartExt::fillCoinGeometry(
+    TopoDS_Shape shape,
+    SoCoordinate3* coords,
+    SoBrepFaceSet* faceset,
+    SoNormal* norm,
+    SoBrepEdgeSet* lineset,
+    SoBrepPointSet* nodeset,
+    bool normalsFromUV
+)
 {
     if (Part::Tools::isShapeEmpty(shape)) {
         coords->point.setNum(0);
@@ -1074,39 +1169,6 @@ void ViewProviderPartExt::setupCoinGeometry(
 
     std::set<int> faceEdges;
 
-    // calculating the deflection value
-    Standard_Real deflection = Part::Tools::getDeflection(shape, deviation);
-
-    // Since OCCT 7.6 a value of equal 0 is not allowed any more, this can happen if a single
-    // vertex should be displayed.
-    if (deflection < gp::Resolution()) {
-        deflection = Precision::Confusion();
-    }
-
-    // For very big objects the computed deflection can become very high and thus leads to a
-    // useless tessellation. To avoid this the upper limit is set to 20.0 See also forum:
-    // https://forum.freecad.org/viewtopic.php?t=77521
-    // deflection = std::min(deflection, 20.0);
-
-    // create or use the mesh on the data structure
-    Standard_Real AngDeflectionRads = Base::toRadians(angularDeflection);
-
-    IMeshTools_Parameters meshParams;
-    meshParams.Deflection = deflection;
-    meshParams.Relative = Standard_False;
-    meshParams.Angle = AngDeflectionRads;
-    meshParams.InParallel = Standard_True;
-    meshParams.AllowQualityDecrease = Standard_True;
-
-    // Clear triangulation and PCurves from geometry which can slow down the process
-#if OCC_VERSION_HEX < 0x070600
-    BRepTools::Clean(shape);
-#else
-    BRepTools::Clean(shape, Standard_True);
-#endif
-
-    BRepMesh_IncrementalMesh(shape, meshParams);
-
     // We must reset the location here because the transformation data
     // are set in the placement property
     TopLoc_Location aLoc;
@@ -1472,9 +1534,119 @@ void ViewProviderPartExt::updateVisual()
     TopoDS_Shape shape = getRenderedShape().getShape();
 
     if (lastRenderedShape.IsPartner(shape)) {
+        cancelTessellation();
+        return;
+    }
+
+    if (!pendingShape.IsNull() && pendingShape.IsPartner(shape)) {
+        return;
+    }
+
+    cancelTessellation();
+    if (startTessellation(shape)) {
+        return;
+    }
+
+    updateCoinGeometry(shape, false);
+}
+
+bool ViewProviderPartExt::startTessellation(const TopoDS_Shape& shape)
+{
+    if (isUpdateForced() || Part::Tools::isShapeEmpty(shape)) {
+        return false;
+    }
+
+    ParameterGrp::handle hPart = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part"
+    );
+    if (!hPart->GetBool("BackgroundTessellation", true)) {
+        return false;
+    }
+
+    // small shapes are meshed faster than the round trip through the thread pool
+    long minFaces = hPart->GetInt("BackgroundTessellationMinFaces", 50);
+    long numFaces = 0;
+    for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More() && numFaces < minFaces; xp.Next()) {
+        ++numFaces;
+    }
+    if (numFaces < minFaces) {
+        return false;
+    }
+
+    auto meshParams = meshParameters(shape, Deviation.getValue(), AngularDeflection.getValue());
+    if (Part::TessellationCache::instance().isMeshed(shape, meshParams)) {
+        return false;
+    }
+
+    pendingShape = shape;
+    // Until the mesh is ready, the previous tessellation stays visible. If there is none, a
+    // bounding box stands in for the shape.
+    if (coords->point.getNum() == 0) {
+        showProxy(shape);
+    }
+
+    tessellationWatcher = std::make_unique<QFutureWatcher<void>>();
+    QObject::connect(
+        tessellationWatcher.get(),
+        &QFutureWatcher<void>::finished,
+        tessellationWatcher.get(),
+        [this]() { onTessellationFinished(); }
+    );
+    tessellationWatcher->setFuture(QtConcurrent::run([shape, meshParams]() {
+        try {
+            Part::TessellationCache::instance().mesh(shape, meshParams);
+        }
+        catch (const Standard_Failure&) {
+            // reported when the Coin nodes are set up on the GUI thread
+        }
+    }));
+    return true;
+}
+
+void ViewProviderPartExt::cancelTessellation()
+{
+    if (tessellationWatcher) {
+        // The running meshing can't be stopped, its result is just not used. The watcher
+        // may be the sender of the signal currently handled, so it's deleted later.
+        tessellationWatcher->disconnect();
+        tessellationWatcher.release()->deleteLater();
+    }
+    pendingShape.Nullify();
+    pcProxySwitch->whichChild = SO_SWITCH_NONE;
+}
+
+void ViewProviderPartExt::onTessellationFinished()
+{
+    TopoDS_Shape shape = pendingShape;
+    cancelTessellation();
+    if (!shape.IsNull()) {
+        updateCoinGeometry(shape, true);
+    }
+}
+
+void ViewProviderPartExt::showProxy(const TopoDS_Shape& shape)
+{
+    // The nodes are set up without the placement, which is applied by the transformation
+    Bnd_Box bounds = Part::Tools::getBounds(shape.Located(TopLoc_Location()));
+    if (bounds.IsVoid()) {
         return;
     }
 
+    Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+    bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+    pcProxyTranslation->translation.setValue(
+        static_cast<float>((xMin + xMax) / 2.0),
+        static_cast<float>((yMin + yMax) / 2.0),
+        static_cast<float>((zMin + zMax) / 2.0)
+    );
+    pcProxyCube->width = static_cast<float>(xMax - xMin);
+    pcProxyCube->height = static_cast<float>(yMax - yMin);
+    pcProxyCube->depth = static_cast<float>(zMax - zMin);
+    pcProxySwitch->whichChild = 0;
+}
+
+void ViewProviderPartExt::updateCoinGeometry(const TopoDS_Shape& shape, bool meshed)
+{
     Gui::SoUpdateVBOAction action;
     action.apply(this->faceset);
 
@@ -1490,20 +1662,37 @@ void ViewProviderPartExt::updateVisual()
     haction.apply(this->lineset);
     haction.apply(this->nodeset);
 
+    if (levelOfDetail) {
+        levelOfDetail->clear();
+    }
+
     try {
-        setupCoinGeometry(
-            shape,
-            coords,
-            faceset,
-            norm,
-            lineset,
-            nodeset,
-            Deviation.getValue(),
-            AngularDeflection.getValue(),
-            NormalsFromUV
-        );
+        if (meshed) {
+            fillCoinGeometry(shape, coords, faceset, norm, lineset, nodeset, NormalsFromUV);
+        }
+        else {
+            setupCoinGeometry(
+                shape,
+                coords,
+                faceset,
+                norm,
+                lineset,
+                nodeset,
+                Deviation.getValue(),
+                AngularDeflection.getValue(),
+                NormalsFromUV
+            );
+        }
 
         lastRenderedShape = shape;
+        if (levelOfDetail) {
+            levelOfDetail->reset(
+                shape,
+                Deviation.getValue(),
+                AngularDeflection.getValue(),
+                NormalsFromUV
+            );
+        }
 
         VisualTouched = false;
     }
@@ -28,6 +28,9 @@
 
 
 #include <map>
+#include <memory>
+
+#include <QFutureWatcher>
 
 #include <App/PropertyUnits.h>
 #include <Gui/ViewProviderGeometryObject.h>
@@ -57,6 +60,8 @@ class SoNormal;
 class SoNormalBinding;
 class SoMaterialBinding;
 class SoIndexedLineSet;
+class SoCube;
+class SoTranslation;
 
 namespace PartGui
 {
@@ -64,6 +69,7 @@ namespace PartGui
 class SoBrepFaceSet;
 class SoBrepEdgeSet;
 class SoBrepPointSet;
+class ShapeLevelOfDetail;
 
 class PartGuiExport ViewProviderPartExt: public Gui::ViewProviderGeometryObject
 {
@@ -203,6 +209,20 @@ public:
         bool normalsFromUV = false
     );
 
+    /// triangulates the shape for the 3D view and returns the used linear deflection
+    static double meshShape(const TopoDS_Shape& shape, double deviation, double angularDeflection);
+
+    /// configures Coin nodes so they render the current triangulation of the given toposhape
+    static void fillCoinGeometry(
+        TopoDS_Shape shape,
+        SoCoordinate3* coords,
+        SoBrepFaceSet* faceset,
+        SoNormal* norm,
+        SoBrepEdgeSet* lineset,
+        SoBrepPointSet* nodeset,
+        bool normalsFromUV = false
+    );
+
 protected:
     bool setEdit(int ModNum) override;
     void unsetEdit(int ModNum) override;
@@ -213,6 +233,8 @@ protected:
     void onChanged(const App::Property* prop) override;
     bool loadParameter();
     void updateVisual();
+    /// sets up the Coin nodes for \a shape, \a meshed tells if it has been triangulated already
+    void updateCoinGeometry(const TopoDS_Shape& shape, bool meshed);
     void handleChangedPropertyName(
         Base::XMLReader& reader,
         const char* TypeName,
@@ -256,6 +278,20 @@ private:
 
     // shape that was last rendered so if it does not change we don't re-render it without need
     TopoDS_Shape lastRenderedShape;
+
+    std::unique_ptr<ShapeLevelOfDetail> levelOfDetail;
+
+    // Big shapes are meshed in a worker thread, see updateVisual()
+    bool startTessellation(const TopoDS_Shape& shape);
+    void cancelTessellation();
+    void onTessellationFinished();
+    void showProxy(const TopoDS_Shape& shape);
+
+    TopoDS_Shape pendingShape;
+    std::unique_ptr<QFutureWatcher<void>> tessellationWatcher;
+    SoSwitch* pcProxySwitch;
+    SoTranslation* pcProxyTranslation;
+    SoCube* pcProxyCube;
 };
 
 }  // namespace PartGui
@@ -0,0 +1,47 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+
+# ***************************************************************************
+# *   Copyright (c) 2026 FreeCAD Project Association                        *
+# *                                                                         *
+# *   This file is part of FreeCAD.                                         *
+# *                                                                         *
+# *   FreeCAD is free software: you can redistribute it and/or modify it    *
+# *   under the terms of the GNU Lesser General Public License as           *
+# *   published by the Free Software Foundation, either version 2.1 of the  *
+# *   License, or (at your option) any later version.                       *
+# *                                                                         *
+# *   FreeCAD is distributed in the hope that it will be useful, but        *
+# *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+# *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+# *   Lesser General Public License for more details.                       *
+# *                                                                         *
+# *   You should have received a copy of the GNU Lesser General Public      *
+# *   License along with FreeCAD. If not, see                               *
+# *   <https://www.gnu.org/licenses/>.                                      *
+# *                                                                         *
+# ***************************************************************************
+
+__title__ = "PartParallel module"
+__url__ = "https://www.freecad.org"
+__doc__ = "Temporary overrides of the parallel mode of the OCCT algorithms used by Part"
+
+from contextlib import contextmanager
+
+import Part
+
+
+@contextmanager
+def policy(**kwds):
+    """policy(**kwds): context manager changing the parallel mode for a block of code.
+
+    Accepts the keys of Part.getParallelPolicy(), e.g.
+
+        with PartParallel.policy(ThreadCount=4, Mesh=False):
+            shape = base.cut(tools)
+
+    The previous settings are restored when the block is left."""
+    old = Part.setParallelPolicy(**kwds)
+    try:
+        yield
+    finally:
+        Part.setParallelPolicy(old)
@@ -75,6 +75,10 @@ public:
     App::DocumentObjectExecReturn* recomputePreview() override;
 
     short mustExecute() const override;
+    bool isExecuteGILFree() const override
+    {
+        return true;
+    }
 
     /// Check whether the given feature is a datum feature
     static bool isDatum(const App::DocumentObject* feature);
@@ -23,7 +23,11 @@
  ***************************************************************************/
 
 
+#include <array>
+#include <deque>
 #include <limits>
+#include <map>
+#include <mutex>
 #include <gp_Circ.hxx>
 #include <gp_Dir.hxx>
 #include <gp_Cylinder.hxx>
@@ -2188,17 +2192,14 @@ TopoShape Hole::findHoles(
 ) const
 {
     TopoShape result(0);
+    const auto protoFaces = TopoShape(protoHole).getSubTopoShapes(TopAbs_FACE);
 
     auto addHole = [&](Part::TopoShape const& baseshape, gp_Pnt loc) {
         gp_Trsf localSketchTransformation;
         localSketchTransformation.SetTranslation(gp_Pnt(0, 0, 0), gp_Pnt(loc.X(), loc.Y(), loc.Z()));
 
         Part::ShapeMapper mapper;
-        mapper.populate(
-            Part::MappingStatus::Modified,
-            baseshape,
-            TopoShape(protoHole).getSubTopoShapes(TopAbs_FACE)
-        );
+        mapper.populate(Part::MappingStatus::Modified, baseshape, protoFaces);
 
         TopoShape hole(-getID());
         hole.makeShapeWithElementMap(protoHole, mapper, {baseshape});
@@ -2249,6 +2250,54 @@ TopoShape Hole::findHoles(
     return TopoShape().makeElementCompound(holes);
 }
 
+namespace
+{
+
+// The parameters of a thread solid built by Hole::makeThread()
+struct ThreadKey
+{
+    std::string type;
+    double pitch;
+    double radius;
+    double clearedRadius;
+    double helixLength;
+    double helixAngle;
+    bool leftHanded;
+    std::array<double, 6> directions;
+
+    auto operator<=>(const ThreadKey&) const = default;
+};
+
+// Sweeping the thread profile along the helix is by far the slowest part of a
+// hole. The last threads are kept, so that a recompute of a hole, or of
+// another hole with the same thread, reuses them.
+constexpr std::size_t threadCacheSize = 32;
+std::mutex threadCacheMutex;
+std::map<ThreadKey, TopoDS_Shape> threadCache;
+std::deque<ThreadKey> threadCacheOrder;
+
+TopoDS_Shape findThread(const ThreadKey& key)
+{
+    std::lock_guard<std::mutex> lock(threadCacheMutex);
+    auto it = threadCache.find(key);
+    return it != threadCache.end() ? it->second : TopoDS_Shape();
+}
+
+void storeThread(const ThreadKey& key, const TopoDS_Shape& shape)
+{
+    std::lock_guard<std::mutex> lock(threadCacheMutex);
+    if (!threadCache.emplace(key, shape).second) {
+        return;
+    }
+    threadCacheOrder.push_back(key);
+    if (threadCacheOrder.size() > threadCacheSize) {
+        threadCache.erase(threadCacheOrder.front());
+        threadCacheOrder.pop_front();
+    }
+}
+
+}  // namespace
+
 TopoDS_Shape Hole::makeThread(const gp_Vec& xDir, const gp_Vec& zDir, double length)
 {
     int threadType = ThreadType.getValue();
@@ -2278,10 +2327,59 @@ TopoDS_Shape Hole::makeThread(const gp_Vec& xDir, const gp_Vec& zDir, double len
     }
     double RmajC = Rmaj + clearance;
     double marginZ = 0.001;
+    std::string threadTypeStr = ThreadType.getValueAsString();
+
+    // the length of the helix path
+    double threadDepth = ThreadDepth.getValue();
+    double helixLength = threadDepth + Pitch / 2;
+    double holeDepth = Depth.getValue();
+    std::string threadDepthMethod(ThreadDepthType.getValueAsString());
+    std::string depthMethod(DepthType.getValueAsString());
+    if (threadDepthMethod != "Dimension") {
+        if (depthMethod == "ThroughAll") {
+            threadDepth = length;
+            ThreadDepth.setValue(threadDepth);
+            helixLength = threadDepth + 2 * Pitch;
+        }
+        else if (threadDepthMethod == "Tapped (DIN76)") {
+            threadDepth = holeDepth - getThreadRunout();
+            ThreadDepth.setValue(threadDepth);
+            helixLength = threadDepth + Pitch / 2;
+        }
+        else {  // Hole depth
+            threadDepth = holeDepth;
+            ThreadDepth.setValue(threadDepth);
+            helixLength = threadDepth + Pitch / 8;
+        }
+    }
+    else {
+        if (depthMethod == "Dimension") {
+            // the thread must not be deeper than the hole
+            // thus the max helixLength is holeDepth + P / 8;
+            if (threadDepth > (holeDepth - Pitch / 2)) {
+                helixLength = holeDepth + Pitch / 8;
+            }
+        }
+    }
+    double helixAngle = Tapered.getValue() ? TaperedAngle.getValue() - 90 : 0.0;
+
+    ThreadKey key {
+        threadTypeStr,
+        Pitch,
+        Rmaj,
+        RmajC,
+        helixLength,
+        helixAngle,
+        leftHanded,
+        {xDir.X(), xDir.Y(), xDir.Z(), zDir.X(), zDir.Y(), zDir.Z()}
+    };
+    TopoDS_Shape cached = findThread(key);
+    if (!cached.IsNull()) {
+        return cached;
+    }
 
     BRepBuilderAPI_MakeWire mkThreadWire;
     double H;
-    std::string threadTypeStr = ThreadType.getValueAsString();
     if (threadTypeStr == "BSP" || threadTypeStr == "BSW" || threadTypeStr == "BSF") {
         H = 0.960491 * Pitch;              // Height of Sharp V
         double radius = 0.137329 * Pitch;  // radius of the crest
@@ -2351,38 +2449,6 @@ TopoDS_Shape Hole::makeThread(const gp_Vec& xDir, const gp_Vec& zDir, double len
     TopoDS_Wire threadWire = mkThreadWire.Wire();
 
     // create the helix path
-    double threadDepth = ThreadDepth.getValue();
-    double helixLength = threadDepth + Pitch / 2;
-    double holeDepth = Depth.getValue();
-    std::string threadDepthMethod(ThreadDepthType.getValueAsString());
-    std::string depthMethod(DepthType.getValueAsString());
-    if (threadDepthMethod != "Dimension") {
-        if (depthMethod == "ThroughAll") {
-            threadDepth = length;
-            ThreadDepth.setValue(threadDepth);
-            helixLength = threadDepth + 2 * Pitch;
-        }
-        else if (threadDepthMethod == "Tapped (DIN76)") {
-            threadDepth = holeDepth - getThreadRunout();
-            ThreadDepth.setValue(threadDepth);
-            helixLength = threadDepth + Pitch / 2;
-        }
-        else {  // Hole depth
-            threadDepth = holeDepth;
-            ThreadDepth.setValue(threadDepth);
-            helixLength = threadDepth + Pitch / 8;
-        }
-    }
-    else {
-        if (depthMethod == "Dimension") {
-            // the thread must not be deeper than the hole
-            // thus the max helixLength is holeDepth + P / 8;
-            if (threadDepth > (holeDepth - Pitch / 2)) {
-                helixLength = holeDepth + Pitch / 8;
-            }
-        }
-    }
-    double helixAngle = Tapered.getValue() ? TaperedAngle.getValue() - 90 : 0.0;
     TopoDS_Shape helix = TopoShape().makeLongHelix(Pitch, helixLength, Rmaj, helixAngle, leftHanded);
 
     gp_Pnt origo(0.0, 0.0, 0.0);
@@ -2443,6 +2509,7 @@ TopoDS_Shape Hole::makeThread(const gp_Vec& xDir, const gp_Vec& zDir, double len
     }
 
     // we are done
+    storeThread(key, result);
     return result;
 }
 
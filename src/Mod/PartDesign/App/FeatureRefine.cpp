@@ -87,6 +87,12 @@ TopoShape FeatureRefine::refineShapeIfActive(
     }
     TopoShape shape(oldShape);
     try {
+        // When the base feature is refined already, only the faces added or
+        // modified by this feature can be merged, so skip the untouched ones.
+        auto base = freecad_cast<FeatureRefine*>(getBaseObject(true));
+        if (base && base->Refine.getValue()) {
+            return shape.makeElementIncrementalRefine(base->Shape.getShape());
+        }
         return shape.makeElementRefine();
     }
     catch (Standard_Failure& err) {
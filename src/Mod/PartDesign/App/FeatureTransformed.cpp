@@ -272,6 +272,10 @@ App::DocumentObjectExecReturn* Transformed::recomputePreview()
         return compound;
     };
 
+    // The intermediate fuse and cut results are only named if the final shape
+    // is ever asked for its element names
+    Part::TopoShape::LazyElementMap lazyElementMap;
+
     switch (mode) {
         case Mode::Features:
             PreviewShape.setValue(makeCompoundOfToolShapes());
@@ -364,9 +368,15 @@ App::DocumentObjectExecReturn* Transformed::execute()
 
     supportShape.setTransform(Base::Matrix4D());
 
-    auto getTransformedCompShape = [&](const auto& supportShape, const auto& origShape) {
-        std::vector<TopoShape> shapes = {supportShape};
-        TopoShape shape(origShape);
+    // Returns the transformed copies of origShape except the untransformed one. Rigid
+    // transformations only relocate the copies, so they all share the geometry of origShape.
+    // If clipBox is given, copies whose bounding box is outside of it are skipped.
+    auto getTransformedCopies = [&](const TopoShape& origShape, const Bnd_Box* clipBox) {
+        std::vector<TopoShape> shapes;
+        Bnd_Box origBox;
+        if (clipBox) {
+            BRepBndLib::Add(origShape.getShape(), origBox);
+        }
         int idx = 1;
         auto transformIter = transformations.cbegin();
         transformIter++;
@@ -375,19 +385,51 @@ App::DocumentObjectExecReturn* Transformed::execute()
                 return std::vector<TopoShape>();
             }
             auto opName = Data::indexSuffix(idx++);
-            shapes.emplace_back(shape.makeElementTransform(*transformIter, opName.c_str()));
+            if (clipBox && origBox.Transformed(*transformIter).IsOut(*clipBox)) {
+                continue;
+            }
+            shapes.emplace_back(origShape.makeElementTransform(*transformIter, opName.c_str()));
         }
         return shapes;
     };
 
+    // The copies of consecutive originals of the same kind are fused into or cut from the
+    // support with a single boolean operation
+    struct ToolRun
+    {
+        bool fuse;
+        std::vector<std::vector<TopoShape>> copies;  // one entry per original
+    };
+    std::vector<ToolRun> runs;
+    auto addTools = [&runs](bool fuse, std::vector<TopoShape>&& copies) {
+        if (runs.empty() || runs.back().fuse != fuse) {
+            runs.push_back({fuse, {}});
+        }
+        runs.back().copies.push_back(std::move(copies));
+    };
+    auto applyTools = [&supportShape](bool fuse,
+                                      const std::vector<std::vector<TopoShape>>& copies) {
+        std::vector<TopoShape> shapes = {supportShape};
+        for (const auto& entry : copies) {
+            shapes.insert(shapes.end(), entry.begin(), entry.end());
+        }
+        if (shapes.size() == 1) {
+            return;
+        }
+        if (fuse) {
+            supportShape.makeElementFuse(shapes);
+        }
+        else {
+            supportShape.makeElementCut(shapes);
+        }
+    };
+
     switch (mode) {
-        case Mode::Features:
-            // NOTE: It would be possible to build a compound from all original addShapes/subShapes
-            // and then transform the compounds as a whole. But we choose to apply the
-            // transformations to each Original separately. This way it is easier to discover what
-            // feature causes a fuse/cut to fail. The downside is that performance suffers when
-            // there are many originals. But it seems safe to assume that in most cases there are
-            // few originals and many transformations
+        case Mode::Features: {
+            Bnd_Box supportBox;
+            BRepBndLib::Add(supportShape.getShape(), supportBox);
+            supportBox.Enlarge(Precision::Confusion());
+
             for (auto original : originals) {
                 // Extract the original shape and determine whether to cut or to fuse
                 Part::TopoShape fuseShape;
@@ -415,26 +457,47 @@ App::DocumentObjectExecReturn* Transformed::execute()
                     cutShape = cutShape.makeElementTransform(trsf);
                 }
                 if (!fuseShape.isNull()) {
-                    auto shapes = getTransformedCompShape(supportShape, fuseShape);
-                    if (OCCTProgressIndicator::getAppIndicator().UserBreak()) {
-                        return new App::DocumentObjectExecReturn("User aborted");
+                    auto copies = getTransformedCopies(fuseShape, nullptr);
+                    // the fused copies enlarge the support for later cuts
+                    for (const auto& copy : copies) {
+                        BRepBndLib::Add(copy.getShape(), supportBox);
                     }
-                    supportShape.makeElementFuse(shapes);
+                    addTools(true, std::move(copies));
                 }
                 if (!cutShape.isNull()) {
-                    auto shapes = getTransformedCompShape(supportShape, cutShape);
-                    if (OCCTProgressIndicator::getAppIndicator().UserBreak()) {
-                        return new App::DocumentObjectExecReturn("User aborted");
+                    // copies outside of the support can't remove anything from it
+                    addTools(false, getTransformedCopies(cutShape, &supportBox));
+                }
+                if (OCCTProgressIndicator::getAppIndicator().UserBreak()) {
+                    return new App::DocumentObjectExecReturn("User aborted");
+                }
+            }
+
+            for (const auto& run : runs) {
+                Part::TopoShape base(supportShape);
+                try {
+                    applyTools(run.fuse, run.copies);
+                }
+                catch (...) {
+                    if (run.copies.size() == 1) {
+                        throw;
+                    }
+                    // Apply the originals one by one, so that the failing one can be
+                    // identified from the error
+                    supportShape = base;
+                    for (const auto& copies : run.copies) {
+                        applyTools(run.fuse, {copies});
                     }
-                    supportShape.makeElementCut(shapes);
                 }
             }
             break;
+        }
         case Mode::WholeShape: {
-            auto shapes = getTransformedCompShape(supportShape, supportShape);
+            auto shapes = getTransformedCopies(supportShape, nullptr);
             if (OCCTProgressIndicator::getAppIndicator().UserBreak()) {
                 return new App::DocumentObjectExecReturn("User aborted");
             }
+            shapes.insert(shapes.begin(), supportShape);
             supportShape.makeElementFuse(shapes);
             break;
         }
@@ -87,6 +87,8 @@ public:
      * Gets the transformations from the virtual getTransformations() method of the sub class
      * and applies them to every member of Originals. The total number of copies including
      * the untransformed Originals will be sizeof(Originals) times sizeof(getTransformations())
+     * The copies of consecutive additive or subtractive Originals are fused into or cut from
+     * the support with a single boolean operation
      * If Originals is empty, execute() returns immediately without doing anything as
      * the actual processing will happen in the MultiTransform feature
      */
@@ -26,6 +26,8 @@
 #include <Base/Console.h>
 #include <Base/Interpreter.h>
 
+#include "FeatureFilter.h"
+#include "FeatureOutOfCore.h"
 #include "Points.h"
 #include "PointsPy.h"
 #include "Properties.h"
@@ -61,6 +63,11 @@ PyMOD_INIT_FUNC(Points)
     Points::FeatureCustom           ::init();
     Points::StructuredCustom        ::init();
     Points::FeaturePython           ::init();
+    Points::FeatureOutOfCore        ::init();
+    Points::FilterFeature           ::init();
+    Points::VoxelDownsample         ::init();
+    Points::OutlierRemoval          ::init();
+    Points::Crop                    ::init();
     PyMOD_Return(pointsModule);
     // clang-format on
 }
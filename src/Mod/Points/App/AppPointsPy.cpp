@@ -33,9 +33,12 @@
 #include <Base/Console.h>
 #include <Base/FileInfo.h>
 #include <Base/Interpreter.h>
+#include <Base/Placement.h>
 
+#include "FeatureOutOfCore.h"
 #include "Points.h"
 #include "PointsAlgos.h"
+#include "PointsOutOfCore.h"
 #include "PointsPy.h"
 #include "Properties.h"
 #include "Structured.h"
@@ -52,6 +55,12 @@ public:
         add_varargs_method("open", &Module::open);
         add_varargs_method("insert", &Module::importer);
         add_varargs_method("export", &Module::exporter);
+        add_varargs_method(
+            "createTiles",
+            &Module::createTiles,
+            "createTiles(source, target, [tileSize]) -- Write the points of the file source "
+            "into the tile file target with about tileSize points per tile."
+        );
         add_varargs_method(
             "show",
             &Module::show,
@@ -75,6 +84,43 @@ private:
 
         return std::make_tuple(useColor, checkState, minDistance);
     }
+    std::unique_ptr<Reader> createReader(const Base::FileInfo& file) const
+    {
+        if (file.hasExtension("asc")) {
+            return std::make_unique<AscReader>();
+        }
+        if (file.hasExtension("e57")) {
+            auto setting = readE57Settings();
+            return std::make_unique<E57Reader>(
+                std::get<0>(setting),
+                std::get<1>(setting),
+                std::get<2>(setting)
+            );
+        }
+        if (file.hasExtension("ply")) {
+            return std::make_unique<PlyReader>();
+        }
+        if (file.hasExtension("pcd")) {
+            return std::make_unique<PcdReader>();
+        }
+
+        throw Py::RuntimeError("Unsupported file extension");
+    }
+    void addTiledPoints(App::Document* pcDoc, const Base::FileInfo& file) const
+    {
+        PointsOutOfCore tiles;
+        if (!tiles.open(file.filePath().c_str())) {
+            throw Py::RuntimeError("Cannot open tile file");
+        }
+
+        // the points are kept in the file, the feature only loads a preview of them
+        auto pcFeature = new Points::FeatureOutOfCore();
+        pcFeature->TileFile.setValue(file.filePath().c_str());
+        pcFeature->Placement.setValue(Base::Placement(tiles.getTransform()));
+        pcDoc->addObject(pcFeature, file.fileNamePure().c_str());
+        pcDoc->recomputeFeature(pcFeature);
+        pcFeature->purgeTouched();
+    }
     Py::Object open(const Py::Tuple& args)
     {
         char* Name {};
@@ -93,29 +139,16 @@ private:
                 throw Py::RuntimeError("No file extension");
             }
 
-            std::unique_ptr<Reader> reader;
-            if (file.hasExtension("asc")) {
-                reader = std::make_unique<AscReader>();
-            }
-            else if (file.hasExtension("e57")) {
-                auto setting = readE57Settings();
-                reader = std::make_unique<E57Reader>(
-                    std::get<0>(setting),
-                    std::get<1>(setting),
-                    std::get<2>(setting)
-                );
-            }
-            else if (file.hasExtension("ply")) {
-                reader = std::make_unique<PlyReader>();
-            }
-            else if (file.hasExtension("pcd")) {
-                reader = std::make_unique<PcdReader>();
-            }
-            else {
-                throw Py::RuntimeError("Unsupported file extension");
+            if (file.hasExtension("fcpt")) {
+                addTiledPoints(App::GetApplication().newDocument(), file);
+                return Py::None();
             }
 
-            reader->read(EncodedName);
+            std::unique_ptr<Reader> reader = createReader(file);
+            {
+                Base::PyGILStateRelease unlock;
+                reader->read(EncodedName);
+            }
 
             App::Document* pcDoc = App::GetApplication().newDocument();
 
@@ -220,29 +253,20 @@ private:
                 throw Py::RuntimeError("No file extension");
             }
 
-            std::unique_ptr<Reader> reader;
-            if (file.hasExtension("asc")) {
-                reader = std::make_unique<AscReader>();
-            }
-            else if (file.hasExtension("e57")) {
-                auto setting = readE57Settings();
-                reader = std::make_unique<E57Reader>(
-                    std::get<0>(setting),
-                    std::get<1>(setting),
-                    std::get<2>(setting)
-                );
-            }
-            else if (file.hasExtension("ply")) {
-                reader = std::make_unique<PlyReader>();
-            }
-            else if (file.hasExtension("pcd")) {
-                reader = std::make_unique<PcdReader>();
-            }
-            else {
-                throw Py::RuntimeError("Unsupported file extension");
+            if (file.hasExtension("fcpt")) {
+                App::Document* pcDoc = App::GetApplication().getDocument(DocName);
+                if (!pcDoc) {
+                    pcDoc = App::GetApplication().newDocument(DocName);
+                }
+                addTiledPoints(pcDoc, file);
+                return Py::None();
             }
 
-            reader->read(EncodedName);
+            std::unique_ptr<Reader> reader = createReader(file);
+            {
+                Base::PyGILStateRelease unlock;
+                reader->read(EncodedName);
+            }
 
             App::Document* pcDoc = App::GetApplication().getDocument(DocName);
             if (!pcDoc) {
@@ -320,6 +344,47 @@ private:
         return Py::None();
     }
 
+    Py::Object createTiles(const Py::Tuple& args)
+    {
+        char* Source {};
+        char* Target {};
+        unsigned long tileSize = PointsOutOfCore::defaultTileSize;
+        if (!PyArg_ParseTuple(args.ptr(), "etet|k", "utf-8", &Source, "utf-8", &Target, &tileSize)) {
+            throw Py::Exception();
+        }
+        std::string EncodedSource = std::string(Source);
+        PyMem_Free(Source);
+        std::string EncodedTarget = std::string(Target);
+        PyMem_Free(Target);
+
+        try {
+            Base::FileInfo file(EncodedSource.c_str());
+            bool ok {};
+            if (file.hasExtension("asc")) {
+                // stream the file so that it doesn't need to fit into memory
+                ok = PointsOutOfCore::createFromAscii(
+                    EncodedSource.c_str(),
+                    EncodedTarget.c_str(),
+                    tileSize
+                );
+            }
+            else {
+                std::unique_ptr<Reader> reader = createReader(file);
+                reader->read(EncodedSource);
+                ok = PointsOutOfCore::create(reader->getPoints(), EncodedTarget.c_str(), tileSize);
+            }
+
+            if (!ok) {
+                throw Py::RuntimeError("Cannot write tile file");
+            }
+        }
+        catch (const Base::Exception& e) {
+            throw Py::RuntimeError(e.what());
+        }
+
+        return Py::None();
+    }
+
     Py::Object exporter(const Py::Tuple& args)
     {
         PyObject* object {};
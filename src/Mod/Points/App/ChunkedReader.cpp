@@ -0,0 +1,511 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <functional>
+#include <locale>
+#include <numeric>
+#include <sstream>
+
+#include <QFile>
+#include <QThreadPool>
+#include <QtConcurrentMap>
+
+#include <Base/Exception.h>
+#include <Base/Sequencer.h>
+
+#include "ChunkedReader.h"
+#include "Points.h"
+
+
+using namespace Points;
+
+MappedFile::MappedFile(const std::string& filename)
+    : file(std::make_unique<QFile>(QString::fromUtf8(filename.c_str())))
+{
+    if (!file->open(QIODevice::ReadOnly)) {
+        throw Base::FileException("Cannot open file", filename);
+    }
+
+    qint64 size = file->size();
+    if (size <= 0) {
+        return;
+    }
+
+    if (const uchar* data = file->map(0, size)) {
+        begin = reinterpret_cast<const char*>(data);
+    }
+    else {
+        // e.g. if there is not enough address space
+        buffer.resize(static_cast<std::size_t>(size));
+        if (file->read(buffer.data(), size) != size) {
+            throw Base::FileException("Cannot read file", filename);
+        }
+        begin = buffer.data();
+    }
+    length = static_cast<std::size_t>(size);
+}
+
+// the mapping is released when the file is closed
+MappedFile::~MappedFile() = default;
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+// Size of the pieces of ASCII data that are parsed by one thread
+constexpr std::size_t asciiChunkSize = std::size_t(4) << 20;
+// Number of binary records that are converted by one thread
+constexpr std::size_t binaryChunkSize = 65536;
+
+// Powers of ten that are exactly representable as double
+constexpr std::array<double, 23> powersOfTen {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                              1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                              1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+inline bool isDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+inline bool isBlank(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+inline const char* skipBlanks(const char* first, const char* last)
+{
+    while (first != last && isBlank(*first)) {
+        ++first;
+    }
+    return first;
+}
+
+// Calls func(first, last) for each line of text without the line break
+template<typename Func>
+void forEachLine(std::string_view text, Func&& func)
+{
+    const char* it = text.data();
+    const char* end = it + text.size();
+    while (it != end) {
+        const char* nl = static_cast<const char*>(std::memchr(it, '\n', end - it));
+        const char* eol = nl ? nl : end;
+        if (!func(it, eol)) {
+            return;
+        }
+        it = nl ? nl + 1 : end;
+    }
+}
+
+// Parses the next number of a line that must be followed by a blank or the end of the line
+inline const char* parseField(const char* first, const char* last, double& value)
+{
+    const char* it = Points::ChunkedReader::parseNumber(first, last, value);
+    if (it && it != last && !isBlank(*it)) {
+        return nullptr;
+    }
+    return it;
+}
+
+std::vector<Base::Vector3d> parsePoints(std::string_view text)
+{
+    std::vector<Base::Vector3d> pts;
+    forEachLine(text, [&pts](const char* first, const char* last) {
+        double coords[3];
+        const char* it = first;
+        for (double& coord : coords) {
+            it = skipBlanks(it, last);
+            it = parseField(it, last, coord);
+            if (!it) {
+                return true;
+            }
+        }
+        if (skipBlanks(it, last) == last) {
+            pts.emplace_back(coords[0], coords[1], coords[2]);
+        }
+        return true;
+    });
+    return pts;
+}
+
+std::size_t countLines(std::string_view text)
+{
+    std::size_t count = 0;
+    forEachLine(text, [&count](const char* first, const char* last) {
+        if (skipBlanks(first, last) != last) {
+            ++count;
+        }
+        return true;
+    });
+    return count;
+}
+
+template<typename T>
+double loadValue(const char* data, bool swap)
+{
+    std::array<char, sizeof(T)> bytes;
+    std::memcpy(bytes.data(), data, sizeof(T));
+    if (swap) {
+        std::ranges::reverse(bytes);
+    }
+    T value;
+    std::memcpy(&value, bytes.data(), sizeof(T));
+    return static_cast<double>(value);
+}
+
+double loadValue(Points::ChunkedReader::ScalarType type, const char* data, bool swap)
+{
+    using Points::ChunkedReader::ScalarType;
+    switch (type) {
+        case ScalarType::Int8:
+            return loadValue<std::int8_t>(data, swap);
+        case ScalarType::UInt8:
+            return loadValue<std::uint8_t>(data, swap);
+        case ScalarType::Int16:
+            return loadValue<std::int16_t>(data, swap);
+        case ScalarType::UInt16:
+            return loadValue<std::uint16_t>(data, swap);
+        case ScalarType::Int32:
+            return loadValue<std::int32_t>(data, swap);
+        case ScalarType::UInt32:
+            return loadValue<std::uint32_t>(data, swap);
+        case ScalarType::Float32:
+            return loadValue<float>(data, swap);
+        case ScalarType::Float64:
+            return loadValue<double>(data, swap);
+    }
+    return 0.0;
+}
+
+std::vector<std::size_t> chunkIndices(std::size_t count)
+{
+    std::vector<std::size_t> indices(count);
+    std::iota(indices.begin(), indices.end(), 0);
+    return indices;
+}
+}  // namespace
+
+std::size_t ChunkedReader::sizeOf(ScalarType type)
+{
+    switch (type) {
+        case ScalarType::Int8:
+        case ScalarType::UInt8:
+            return 1;
+        case ScalarType::Int16:
+        case ScalarType::UInt16:
+            return 2;
+        case ScalarType::Int32:
+        case ScalarType::UInt32:
+        case ScalarType::Float32:
+            return 4;
+        case ScalarType::Float64:
+            return 8;
+    }
+    return 0;
+}
+
+const char* ChunkedReader::parseNumber(const char* first, const char* last, double& value)
+{
+    // Up to 19 significant digits fit into the mantissa. If the mantissa is below 2^53 and
+    // the decimal exponent is small the result of a single multiplication or division is
+    // correctly rounded, all other numbers go through the standard library.
+    const char* it = first;
+    bool negative = false;
+    if (it != last && (*it == '+' || *it == '-')) {
+        negative = (*it == '-');
+        ++it;
+    }
+
+    const char* digits = it;
+    std::uint64_t mantissa = 0;
+    int significant = 0;
+    int exponent = 0;
+    bool exact = true;
+    bool hasDigits = false;
+
+    for (; it != last && isDigit(*it); ++it) {
+        hasDigits = true;
+        if (significant < 19) {
+            mantissa = mantissa * 10 + static_cast<std::uint64_t>(*it - '0');
+            significant += (mantissa > 0) ? 1 : 0;
+        }
+        else {
+            exact = exact && (*it == '0');
+            ++exponent;
+        }
+    }
+    if (it != last && *it == '.') {
+        ++it;
+        for (; it != last && isDigit(*it); ++it) {
+            hasDigits = true;
+            if (significant < 19) {
+                mantissa = mantissa * 10 + static_cast<std::uint64_t>(*it - '0');
+                significant += (mantissa > 0) ? 1 : 0;
+                --exponent;
+            }
+            else {
+                exact = exact && (*it == '0');
+            }
+        }
+    }
+    if (!hasDigits) {
+        return nullptr;
+    }
+
+    if (it != last && (*it == 'e' || *it == 'E')) {
+        const char* exp = it + 1;
+        bool negativeExp = false;
+        if (exp != last && (*exp == '+' || *exp == '-')) {
+            negativeExp = (*exp == '-');
+            ++exp;
+        }
+        if (exp != last && isDigit(*exp)) {
+            int value10 = 0;
+            for (; exp != last && isDigit(*exp); ++exp) {
+                if (value10 < 100000) {
+                    value10 = value10 * 10 + (*exp - '0');
+                }
+            }
+            exponent += negativeExp ? -value10 : value10;
+            it = exp;
+        }
+    }
+
+    constexpr std::uint64_t maxExact = std::uint64_t(1) << 53;
+    if (mantissa == 0) {
+        value = 0.0;
+    }
+    else if (exact && mantissa <= maxExact && exponent >= -22 && exponent <= 22) {
+        value = static_cast<double>(mantissa);
+        if (exponent < 0) {
+            value /= powersOfTen[-exponent];
+        }
+        else {
+            value *= powersOfTen[exponent];
+        }
+    }
+    else {
+        std::istringstream str(std::string(digits, it));
+        str.imbue(std::locale::classic());
+        str >> value;
+    }
+
+    if (negative) {
+        value = -value;
+    }
+    return it;
+}
+
+std::vector<std::string_view> ChunkedReader::splitLines(
+    std::string_view text,
+    std::size_t chunkSize
+)
+{
+    std::vector<std::string_view> chunks;
+    chunkSize = std::max<std::size_t>(chunkSize, 1);
+    std::size_t pos = 0;
+    while (pos < text.size()) {
+        std::size_t end = text.size();
+        if (text.size() - pos > chunkSize) {
+            std::size_t nl = text.find('\n', pos + chunkSize - 1);
+            if (nl != std::string_view::npos) {
+                end = nl + 1;
+            }
+        }
+        chunks.push_back(text.substr(pos, end - pos));
+        pos = end;
+    }
+    return chunks;
+}
+
+std::size_t ChunkedReader::readAsciiPoints(
+    std::string_view text,
+    const std::function<void(const std::vector<Base::Vector3d>&)>& func
+)
+{
+    std::vector<std::string_view> chunks = splitLines(text, asciiChunkSize);
+    Base::SequencerLauncher seq("Loading points…", chunks.size());
+
+    // Only a few chunks per thread are parsed at once to keep the intermediate buffers small
+    const std::size_t batchSize =
+        std::max<std::size_t>(2 * QThreadPool::globalInstance()->maxThreadCount(), 4);
+    std::size_t numPoints = 0;
+    for (std::size_t start = 0; start < chunks.size(); start += batchSize) {
+        std::size_t count = std::min(batchSize, chunks.size() - start);
+        std::vector<std::size_t> indices = chunkIndices(count);
+        auto batch = QtConcurrent::blockingMapped<std::vector<std::vector<Base::Vector3d>>>(
+            indices,
+            [&chunks, start](std::size_t index) { return parsePoints(chunks[start + index]); }
+        );
+
+        for (const auto& pts : batch) {
+            func(pts);
+            numPoints += pts.size();
+            seq.next();
+        }
+    }
+
+    return numPoints;
+}
+
+std::size_t ChunkedReader::readAsciiPoints(std::string_view text, PointKernel& kernel)
+{
+    // the first chunk gives an estimate of the total number of points
+    std::size_t firstBytes = text.size();
+    if (text.size() > asciiChunkSize) {
+        std::size_t nl = text.find('\n', asciiChunkSize - 1);
+        if (nl != std::string_view::npos) {
+            firstBytes = nl + 1;
+        }
+    }
+
+    bool first = true;
+    return readAsciiPoints(text, [&](const std::vector<Base::Vector3d>& pts) {
+        if (first) {
+            first = false;
+            double estimate = static_cast<double>(pts.size()) * static_cast<double>(text.size())
+                / static_cast<double>(firstBytes);
+            kernel.reserve(kernel.size() + static_cast<std::size_t>(estimate * 1.05));
+        }
+        for (const auto& pt : pts) {
+            kernel.push_back(pt);
+        }
+    });
+}
+
+std::size_t ChunkedReader::readAsciiTable(
+    std::string_view text,
+    std::size_t skipLines,
+    std::size_t numFields,
+    std::size_t numRows,
+    double* table,
+    std::ptrdiff_t rowStride,
+    std::ptrdiff_t colStride
+)
+{
+    // The first pass counts the lines of each chunk so that the second pass knows the row
+    // of each line and can write the values directly into the table.
+    std::vector<std::string_view> chunks = splitLines(text, asciiChunkSize);
+    std::vector<std::size_t> indices = chunkIndices(chunks.size());
+    std::vector<std::size_t> numLines = QtConcurrent::blockingMapped<std::vector<std::size_t>>(
+        indices,
+        [&chunks](std::size_t index) { return countLines(chunks[index]); }
+    );
+    std::vector<std::size_t> firstLine(numLines.size());
+    std::exclusive_scan(numLines.begin(), numLines.end(), firstLine.begin(), std::size_t(0));
+
+    std::size_t endLine = skipLines + numRows;
+    std::vector<int> failed = QtConcurrent::blockingMapped<std::vector<int>>(
+        indices,
+        [&](std::size_t index) {
+            std::size_t line = firstLine[index];
+            if (line >= endLine) {
+                return 0;
+            }
+
+            bool ok = true;
+            forEachLine(chunks[index], [&](const char* first, const char* last) {
+                const char* it = skipBlanks(first, last);
+                if (it == last) {
+                    return true;
+                }
+                if (line < skipLines) {
+                    ++line;
+                    return true;
+                }
+
+                double* row = table + static_cast<std::ptrdiff_t>(line - skipLines) * rowStride;
+                for (std::size_t col = 0; col < numFields; col++) {
+                    double value = 0.0;
+                    if (it != last) {
+                        it = parseField(it, last, value);
+                        if (!it) {
+                            ok = false;
+                            return false;
+                        }
+                        it = skipBlanks(it, last);
+                    }
+                    row[static_cast<std::ptrdiff_t>(col) * colStride] = value;
+                }
+                return ++line < endLine;
+            });
+            return ok ? 0 : 1;
+        }
+    );
+
+    if (std::ranges::find(failed, 1) != failed.end()) {
+        throw Base::BadFormatError("Invalid number in ASCII data");
+    }
+
+    std::size_t totalLines = std::accumulate(numLines.begin(), numLines.end(), std::size_t(0));
+    return totalLines > skipLines ? std::min(totalLines - skipLines, numRows) : 0;
+}
+
+void ChunkedReader::readBinaryTable(
+    std::string_view bytes,
+    const std::vector<ScalarType>& types,
+    bool bigEndian,
+    bool fieldMajor,
+    std::size_t numRecords,
+    double* table,
+    std::ptrdiff_t rowStride,
+    std::ptrdiff_t colStride
+)
+{
+    // position of the first value of each field and the distance between two of its values
+    std::size_t recordSize = 0;
+    std::vector<std::size_t> base;
+    std::vector<std::size_t> stride;
+    for (ScalarType type : types) {
+        base.push_back(fieldMajor ? recordSize * numRecords : recordSize);
+        stride.push_back(sizeOf(type));
+        recordSize += sizeOf(type);
+    }
+    if (!fieldMajor) {
+        std::ranges::fill(stride, recordSize);
+    }
+
+    if (recordSize * numRecords > bytes.size()) {
+        throw Base::BadFormatError("File expects too many elements");
+    }
+
+    const bool swap = bigEndian != (std::endian::native == std::endian::big);
+    const char* data = bytes.data();
+    std::size_t numChunks = (numRecords + binaryChunkSize - 1) / binaryChunkSize;
+    std::vector<std::size_t> indices = chunkIndices(numChunks);
+    QtConcurrent::blockingMap(indices, [&](std::size_t index) {
+        std::size_t begin = index * binaryChunkSize;
+        std::size_t end = std::min(begin + binaryChunkSize, numRecords);
+        for (std::size_t j = 0; j < types.size(); j++) {
+            const char* value = data + base[j] + begin * stride[j];
+            double* column = table + static_cast<std::ptrdiff_t>(j) * colStride;
+            for (std::size_t i = begin; i < end; i++, value += stride[j]) {
+                column[static_cast<std::ptrdiff_t>(i) * rowStride] =
+                    loadValue(types[j], value, swap);
+            }
+        }
+    });
+}
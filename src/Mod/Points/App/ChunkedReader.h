@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <Base/Vector3D.h>
+
+#include <Mod/Points/PointsGlobal.h>
+
+class QFile;
+
+namespace Points
+{
+class PointKernel;
+
+/**
+ * Read-only view of the content of a whole file.
+ * The file is memory-mapped where possible, otherwise it is read into a buffer.
+ */
+class PointsExport MappedFile
+{
+public:
+    /// Throws Base::FileException if the file cannot be opened.
+    explicit MappedFile(const std::string& filename);
+    ~MappedFile();
+
+    std::string_view data() const
+    {
+        return {begin, length};
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+
+private:
+    std::unique_ptr<QFile> file;
+    std::vector<char> buffer;
+    const char* begin {nullptr};
+    std::size_t length {0};
+};
+
+/**
+ * Functions to read large point clouds in parallel.
+ *
+ * ASCII data is split into chunks on line boundaries which are then parsed concurrently,
+ * binary records are converted block-wise straight into the destination table.
+ */
+namespace ChunkedReader
+{
+/// Scalar types of binary records
+enum class ScalarType
+{
+    Int8,
+    UInt8,
+    Int16,
+    UInt16,
+    Int32,
+    UInt32,
+    Float32,
+    Float64
+};
+
+/// Returns the size in bytes of a value of type \a type.
+PointsExport std::size_t sizeOf(ScalarType type);
+
+/**
+ * Parses a decimal number of the form [+-]digits[.digits][(e|E)[+-]digits] from the range
+ * [first, last) independent of the locale. Returns the position after the number or nullptr
+ * if the range doesn't start with a number. The result is correctly rounded.
+ */
+PointsExport const char* parseNumber(const char* first, const char* last, double& value);
+
+/// Splits \a text into pieces of roughly \a chunkSize bytes that each end on a line boundary.
+PointsExport std::vector<std::string_view> splitLines(std::string_view text, std::size_t chunkSize);
+
+/**
+ * Appends the points of all lines of \a text that consist of exactly three numbers to
+ * \a kernel, all other lines are skipped. Returns the number of points read.
+ */
+PointsExport std::size_t readAsciiPoints(std::string_view text, PointKernel& kernel);
+
+/**
+ * Calls \a func with the points of the lines of \a text that consist of exactly three numbers.
+ * The points are passed in batches in the order of the lines. Returns the number of points read.
+ */
+PointsExport std::size_t readAsciiPoints(
+    std::string_view text,
+    const std::function<void(const std::vector<Base::Vector3d>&)>& func
+);
+
+/**
+ * Reads the numbers of the non-blank lines of \a text into a table with \a numFields
+ * columns after skipping the first \a skipLines non-blank lines. At most \a numRows rows are
+ * read and the number of read rows is returned. Missing values of a row are set to zero and
+ * additional values are ignored. The element (row, col) is written to
+ * table[row * rowStride + col * colStride].
+ * Throws Base::BadFormatError if a line contains an invalid number.
+ */
+PointsExport std::size_t readAsciiTable(
+    std::string_view text,
+    std::size_t skipLines,
+    std::size_t numFields,
+    std::size_t numRows,
+    double* table,
+    std::ptrdiff_t rowStride,
+    std::ptrdiff_t colStride
+);
+
+/**
+ * Converts \a numRecords binary records with the fields \a types into a table of doubles
+ * laid out as for readAsciiTable(). With \a bigEndian set the values are stored in big endian
+ * byte order, otherwise in little endian. If \a fieldMajor is set \a bytes holds all values
+ * of the first field followed by all values of the second field and so on, otherwise the
+ * records are stored one after another.
+ * Throws Base::BadFormatError if \a bytes is too small.
+ */
+PointsExport void readBinaryTable(
+    std::string_view bytes,
+    const std::vector<ScalarType>& types,
+    bool bigEndian,
+    bool fieldMajor,
+    std::size_t numRecords,
+    double* table,
+    std::ptrdiff_t rowStride,
+    std::ptrdiff_t colStride
+);
+}  // namespace ChunkedReader
+
+}  // namespace Points
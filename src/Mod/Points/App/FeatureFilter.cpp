@@ -0,0 +1,267 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include <Base/Exception.h>
+
+#include "FeatureFilter.h"
+#include "Properties.h"
+
+
+using namespace Points;
+
+
+//===========================================================================
+// FilterFeature
+//===========================================================================
+/*
+import Points
+doc=App.ActiveDocument
+scan=doc.ActiveObject
+voxel=doc.addObject('Points::VoxelDownsample','Downsampled')
+voxel.Source=scan
+voxel.VoxelSize=5
+clean=doc.addObject('Points::OutlierRemoval','Cleaned')
+clean.Source=voxel
+doc.recompute()
+*/
+
+// ---------------------------------------------------------
+
+PROPERTY_SOURCE_ABSTRACT(Points::FilterFeature, Points::Feature)
+
+FilterFeature::FilterFeature()
+{
+    ADD_PROPERTY_TYPE(Source, (nullptr), "Filter", App::Prop_None, "Points to filter");
+}
+
+short FilterFeature::mustExecute() const
+{
+    if (Source.isTouched()) {
+        return 1;
+    }
+    return Feature::mustExecute();
+}
+
+App::DocumentObjectExecReturn* FilterFeature::execute()
+{
+    auto source = freecad_cast<Feature*>(Source.getValue());
+    if (!source) {
+        return new App::DocumentObjectExecReturn("No points object linked");
+    }
+
+    const PointKernel& kernel = source->Points.getValue();
+    PointCloud cloud;
+    cloud.points = kernel.getBasicPoints();
+    if (auto prop = freecad_cast<PropertyNormalList*>(source->getPropertyByName("Normal"))) {
+        cloud.normals = prop->getValues();
+    }
+    if (auto prop = freecad_cast<PropertyGreyValueList*>(source->getPropertyByName("Intensity"))) {
+        cloud.intensity = prop->getValues();
+    }
+    if (auto prop = freecad_cast<App::PropertyColorList*>(source->getPropertyByName("Color"))) {
+        cloud.colors = prop->getValues();
+    }
+
+    PointCloud result;
+    try {
+        result = filter(cloud);
+    }
+    catch (const Base::Exception& e) {
+        return new App::DocumentObjectExecReturn(e.what());
+    }
+
+    PointKernel points;
+    points.swap(result.points);
+    points.setTransform(kernel.getTransform());
+    Points.setValue(points);
+    setAttribute<PropertyNormalList>("Normal", result.normals);
+    setAttribute<PropertyGreyValueList>("Intensity", result.intensity);
+    setAttribute<App::PropertyColorList>("Color", result.colors);
+    return App::DocumentObject::StdReturn;
+}
+
+template<typename PropertyT, typename ValueT>
+void FilterFeature::setAttribute(const char* name, const std::vector<ValueT>& values)
+{
+    auto prop = freecad_cast<PropertyT*>(getPropertyByName(name));
+    if (values.empty()) {
+        if (prop && prop->testStatus(App::Property::PropDynamic)) {
+            removeDynamicProperty(name);
+        }
+        return;
+    }
+
+    if (!prop) {
+        prop = freecad_cast<PropertyT*>(
+            addDynamicProperty(PropertyT::getClassTypeId().getName(), name)
+        );
+    }
+    if (prop) {
+        prop->setValues(values);
+    }
+}
+
+// ---------------------------------------------------------
+
+PROPERTY_SOURCE(Points::VoxelDownsample, Points::FilterFeature)
+
+VoxelDownsample::VoxelDownsample()
+{
+    ADD_PROPERTY_TYPE(VoxelSize, (1.0), "Filter", App::Prop_None, "Edge length of a voxel");
+}
+
+short VoxelDownsample::mustExecute() const
+{
+    if (VoxelSize.isTouched()) {
+        return 1;
+    }
+    return FilterFeature::mustExecute();
+}
+
+PointCloud VoxelDownsample::filter(const PointCloud& cloud) const
+{
+    return PointsFilter::voxelDownsample(cloud, static_cast<float>(VoxelSize.getValue()));
+}
+
+// ---------------------------------------------------------
+
+const char* OutlierRemoval::MethodEnums[] = {"Statistical", "Radius", nullptr};
+
+PROPERTY_SOURCE(Points::OutlierRemoval, Points::FilterFeature)
+
+OutlierRemoval::OutlierRemoval()
+{
+    ADD_PROPERTY_TYPE(Method, (0L), "Filter", App::Prop_None, "Method to detect outliers");
+    Method.setEnums(MethodEnums);
+    ADD_PROPERTY_TYPE(
+        Neighbours,
+        (20),
+        "Filter",
+        App::Prop_None,
+        "Number of nearest neighbours of the statistical method"
+    );
+    ADD_PROPERTY_TYPE(
+        StdRatio,
+        (2.0),
+        "Filter",
+        App::Prop_None,
+        "Standard deviations by which the mean neighbour distance of an inlier may exceed the "
+        "mean of all points"
+    );
+    ADD_PROPERTY_TYPE(
+        Radius,
+        (1.0),
+        "Filter",
+        App::Prop_None,
+        "Radius of the neighbourhood of the radius method"
+    );
+    ADD_PROPERTY_TYPE(
+        MinNeighbours,
+        (5),
+        "Filter",
+        App::Prop_None,
+        "Minimum number of neighbours of an inlier within the radius"
+    );
+}
+
+short OutlierRemoval::mustExecute() const
+{
+    if (Method.isTouched() || Neighbours.isTouched() || StdRatio.isTouched()
+        || Radius.isTouched() || MinNeighbours.isTouched()) {
+        return 1;
+    }
+    return FilterFeature::mustExecute();
+}
+
+PointCloud OutlierRemoval::filter(const PointCloud& cloud) const
+{
+    std::vector<std::size_t> inliers;
+    if (Method.getValue() == 0) {
+        inliers = PointsFilter::statisticalInliers(
+            cloud.points,
+            static_cast<int>(Neighbours.getValue()),
+            StdRatio.getValue()
+        );
+    }
+    else {
+        inliers = PointsFilter::radiusInliers(
+            cloud.points,
+            static_cast<float>(Radius.getValue()),
+            static_cast<int>(MinNeighbours.getValue())
+        );
+    }
+    return cloud.select(inliers);
+}
+
+// ---------------------------------------------------------
+
+const char* Crop::ModeEnums[] = {"Box", "Plane", nullptr};
+
+PROPERTY_SOURCE(Points::Crop, Points::FilterFeature)
+
+Crop::Crop()
+{
+    ADD_PROPERTY_TYPE(Mode, (0L), "Filter", App::Prop_None, "Shape of the cropped region");
+    Mode.setEnums(ModeEnums);
+    ADD_PROPERTY_TYPE(BoxMin, (0.0, 0.0, 0.0), "Filter", App::Prop_None, "Minimum of the box");
+    ADD_PROPERTY_TYPE(BoxMax, (1.0, 1.0, 1.0), "Filter", App::Prop_None, "Maximum of the box");
+    ADD_PROPERTY_TYPE(PlaneBase, (0.0, 0.0, 0.0), "Filter", App::Prop_None, "Point on the plane");
+    ADD_PROPERTY_TYPE(
+        PlaneNormal,
+        (0.0, 0.0, 1.0),
+        "Filter",
+        App::Prop_None,
+        "Normal of the plane pointing to the kept points"
+    );
+    ADD_PROPERTY_TYPE(Invert, (false), "Filter", App::Prop_None, "Keep the other points");
+}
+
+short Crop::mustExecute() const
+{
+    if (Mode.isTouched() || BoxMin.isTouched() || BoxMax.isTouched() || PlaneBase.isTouched()
+        || PlaneNormal.isTouched() || Invert.isTouched()) {
+        return 1;
+    }
+    return FilterFeature::mustExecute();
+}
+
+PointCloud Crop::filter(const PointCloud& cloud) const
+{
+    std::vector<std::size_t> inside;
+    if (Mode.getValue() == 0) {
+        Base::BoundBox3f box;
+        box.Add(Base::toVector<float>(BoxMin.getValue()));
+        box.Add(Base::toVector<float>(BoxMax.getValue()));
+        inside = PointsFilter::cropBox(cloud.points, box, Invert.getValue());
+    }
+    else {
+        inside = PointsFilter::cropPlane(
+            cloud.points,
+            Base::toVector<float>(PlaneBase.getValue()),
+            Base::toVector<float>(PlaneNormal.getValue()),
+            Invert.getValue()
+        );
+    }
+    return cloud.select(inside);
+}
@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+#pragma once
+
+#include <App/PropertyLinks.h>
+#include <App/PropertyStandard.h>
+#include <App/PropertyUnits.h>
+
+#include "PointsFeature.h"
+#include "PointsFilter.h"
+
+
+namespace Points
+{
+
+/*! Base class of the features that filter the points of their Source object. The normals,
+  intensities and colors of the source are passed on with the points. The filters work in the
+  coordinate system of the source points and the result takes over its placement.
+ */
+class PointsExport FilterFeature: public Feature
+{
+    PROPERTY_HEADER_WITH_OVERRIDE(Points::FilterFeature);
+
+public:
+    /// Constructor
+    FilterFeature();
+
+    App::PropertyLink Source; /**< The points to filter. */
+
+    /** @name methods override Feature */
+    //@{
+    short mustExecute() const override;
+    /// recalculate the Feature
+    App::DocumentObjectExecReturn* execute() override;
+    //@}
+
+protected:
+    /// Returns the filtered \a cloud
+    virtual PointCloud filter(const PointCloud& cloud) const = 0;
+
+private:
+    template<typename PropertyT, typename ValueT>
+    void setAttribute(const char* name, const std::vector<ValueT>& values);
+};
+
+/*! Replaces the points in each cell of a voxel grid by their centroid. */
+class PointsExport VoxelDownsample: public FilterFeature
+{
+    PROPERTY_HEADER_WITH_OVERRIDE(Points::VoxelDownsample);
+
+public:
+    /// Constructor
+    VoxelDownsample();
+
+    App::PropertyLength VoxelSize; /**< The edge length of a voxel. */
+
+    short mustExecute() const override;
+
+protected:
+    PointCloud filter(const PointCloud& cloud) const override;
+};
+
+/*! Removes points that are far from their neighbours. The statistical method compares the mean
+  distance of each point to its nearest neighbours with that of all points, the radius method
+  requires a minimum number of neighbours within a radius.
+ */
+class PointsExport OutlierRemoval: public FilterFeature
+{
+    PROPERTY_HEADER_WITH_OVERRIDE(Points::OutlierRemoval);
+
+public:
+    /// Constructor
+    OutlierRemoval();
+
+    App::PropertyEnumeration Method;    /**< Statistical or Radius. */
+    App::PropertyInteger Neighbours;    /**< The number of nearest neighbours. */
+    App::PropertyFloat StdRatio;        /**< The allowed standard deviations. */
+    App::PropertyLength Radius;         /**< The radius of the neighbourhood. */
+    App::PropertyInteger MinNeighbours; /**< The minimum number of neighbours in Radius. */
+
+    short mustExecute() const override;
+
+protected:
+    PointCloud filter(const PointCloud& cloud) const override;
+
+private:
+    static const char* MethodEnums[];
+};
+
+/*! Keeps the points inside a box or on one side of a plane. */
+class PointsExport Crop: public FilterFeature
+{
+    PROPERTY_HEADER_WITH_OVERRIDE(Points::Crop);
+
+public:
+    /// Constructor
+    Crop();
+
+    App::PropertyEnumeration Mode;   /**< Box or Plane. */
+    App::PropertyVector BoxMin;      /**< The minimum corner of the box. */
+    App::PropertyVector BoxMax;      /**< The maximum corner of the box. */
+    App::PropertyVector PlaneBase;   /**< A point on the plane. */
+    App::PropertyVector PlaneNormal; /**< The normal pointing to the kept side. */
+    App::PropertyBool Invert;        /**< Keeps the other points instead. */
+
+    short mustExecute() const override;
+
+protected:
+    PointCloud filter(const PointCloud& cloud) const override;
+
+private:
+    static const char* ModeEnums[];
+};
+
+}  // namespace Points
@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+#include <algorithm>
+
+
+#include <Base/Console.h>
+
+#include "FeatureOutOfCore.h"
+#include "PointsOutOfCore.h"
+
+
+using namespace Points;
+
+
+//===========================================================================
+// FeatureOutOfCore
+//===========================================================================
+/*
+import Points
+Points.createTiles("/tmp/scan.asc", "/tmp/scan.fcpt")
+doc=App.ActiveDocument
+pts=doc.addObject('Points::FeatureOutOfCore','Scan')
+pts.TileFile="/tmp/scan.fcpt"
+doc.recompute()
+*/
+
+// ---------------------------------------------------------
+
+PROPERTY_SOURCE(Points::FeatureOutOfCore, Points::Feature)
+
+FeatureOutOfCore::FeatureOutOfCore()
+{
+    ADD_PROPERTY_TYPE(TileFile, (""), "Tiled points", App::Prop_None, "File with the tiled points");
+    ADD_PROPERTY_TYPE(
+        PreviewSize,
+        (2000000),
+        "Tiled points",
+        App::Prop_None,
+        "Maximum number of displayed points"
+    );
+    // the points are only a preview of the tile file and rebuilt after loading
+    Points.setStatus(App::Property::Transient, true);
+}
+
+FeatureOutOfCore::~FeatureOutOfCore() = default;
+
+short FeatureOutOfCore::mustExecute() const
+{
+    if (TileFile.isTouched() || PreviewSize.isTouched()) {
+        return 1;
+    }
+    return Feature::mustExecute();
+}
+
+App::DocumentObjectExecReturn* FeatureOutOfCore::execute()
+{
+    if (!loadTiles()) {
+        return new App::DocumentObjectExecReturn("Cannot open tile file");
+    }
+
+    return App::DocumentObject::StdReturn;
+}
+
+void FeatureOutOfCore::onDocumentRestored()
+{
+    Feature::onDocumentRestored();
+    if (!loadTiles()) {
+        Base::Console().warning("Cannot open tile file '%s'\n", TileFile.getValue());
+    }
+}
+
+std::shared_ptr<const PointsOutOfCore> FeatureOutOfCore::getTiles() const
+{
+    return tiles;
+}
+
+bool FeatureOutOfCore::loadTiles()
+{
+    auto store = std::make_shared<PointsOutOfCore>();
+    if (!store->open(TileFile.getValue())) {
+        tiles.reset();
+        Points.setValue(PointKernel());
+        return false;
+    }
+
+    PointKernel preview;
+    store->getSample(static_cast<std::size_t>(std::max<long>(PreviewSize.getValue(), 0)), preview);
+    preview.setTransform(Placement.getValue().toMatrix());
+    tiles = store;
+    Points.setValue(preview);
+    return true;
+}
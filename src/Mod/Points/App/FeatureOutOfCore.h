@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#pragma once
+
+#include <memory>
+
+#include <App/PropertyFile.h>
+
+#include "PointsFeature.h"
+
+
+namespace Points
+{
+class PointsOutOfCore;
+
+/*! The FeatureOutOfCore class refers to a tile file written by PointsOutOfCore instead of
+  storing the points in the document. Its Points property only holds an evenly taken sample of
+  at most PreviewSize points for display and is not saved with the document. Algorithms that
+  need all points access them tile by tile with getTiles(), the points have to be transformed
+  with the placement of the feature.
+ */
+class PointsExport FeatureOutOfCore: public Feature
+{
+    PROPERTY_HEADER_WITH_OVERRIDE(Points::FeatureOutOfCore);
+
+public:
+    /// Constructor
+    FeatureOutOfCore();
+    ~FeatureOutOfCore() override;
+
+    App::PropertyFile TileFile;       /**< The tile file with all points. */
+    App::PropertyInteger PreviewSize; /**< The maximum number of displayed points. */
+
+    /** @name methods override Feature */
+    //@{
+    short mustExecute() const override;
+    /// recalculate the Feature
+    App::DocumentObjectExecReturn* execute() override;
+    //@}
+
+    /// Returns the opened tile file or null if it cannot be opened.
+    std::shared_ptr<const PointsOutOfCore> getTiles() const;
+
+protected:
+    void onDocumentRestored() override;
+
+private:
+    bool loadTiles();
+
+private:
+    std::shared_ptr<PointsOutOfCore> tiles;
+};
+
+}  // namespace Points
@@ -24,8 +24,10 @@
 
 #include <QtConcurrentMap>
 #include <boost/math/special_functions/fpclassify.hpp>
+#include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <numeric>
 
 
 #include <Base/Matrix.h>
@@ -84,16 +86,26 @@ Data::Segment* PointKernel::getSubElement(const char* /*Type*/, unsigned long /*
 void PointKernel::transformGeometry(const Base::Matrix4D& rclMat)
 {
     std::vector<value_type>& kernel = getBasicPoints();
+
+    // Transform ranges of points with the array kernel of the matrix that keeps its coefficients
+    // in registers, instead of dispatching every single point to the thread pool
+    constexpr std::size_t chunkSize = 16384;
+    std::size_t count = kernel.size();
+    std::vector<std::size_t> chunks((count + chunkSize - 1) / chunkSize);
+    std::iota(chunks.begin(), chunks.end(), 0);
+    value_type* points = kernel.data();
+    auto transform = [&](std::size_t chunk) {
+        std::size_t begin = chunk * chunkSize;
+        std::size_t end = std::min(count, begin + chunkSize);
+        rclMat.multVec(points + begin, points + begin, end - begin);
+    };
 #ifdef _MSC_VER
     // Win32-only at the moment since ppl.h is a Microsoft library. Points is not using Qt so we
-    // cannot use QtConcurrent We could also rewrite Points to leverage SIMD instructions Other
-    // option: openMP. But with VC2013 results in high CPU usage even after computation (busy-waits
-    // for >100ms)
-    Concurrency::parallel_for_each(kernel.begin(), kernel.end(), [rclMat](value_type& value) {
-        value = rclMat * value;
-    });
+    // cannot use QtConcurrent. Other option: openMP. But with VC2013 results in high CPU usage
+    // even after computation (busy-waits for >100ms)
+    Concurrency::parallel_for_each(chunks.begin(), chunks.end(), transform);
 #else
-    QtConcurrent::blockingMap(kernel, [rclMat](value_type& value) { rclMat.multVec(value, value); });
+    QtConcurrent::blockingMap(chunks, [&](std::size_t& chunk) { transform(chunk); });
 #endif
 }
 
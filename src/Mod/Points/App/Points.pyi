@@ -48,7 +48,17 @@ class Points(object):
         ...
 
     def addPoints(self) -> Any:
-        """add one or more (list of) points to the object"""
+        """add one or more (list of) points to the object
+
+An array of shape (n, 3) like a NumPy array is read in a single pass."""
+        ...
+
+    @constmethod
+    def getPointArray(self) -> Any:
+        """getPointArray() -> memoryview
+
+Return the points as a memoryview of doubles with the shape (n, 3).
+The coordinates are copied only once and numpy.asarray() uses the view without a copy."""
         ...
 
     @constmethod
@@ -33,15 +33,14 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/math/special_functions/fpclassify.hpp>  // needed for compilation on some systems
-#include <boost/regex.hpp>
 
 #include <Base/Console.h>
 #include <Base/Converter.h>
 #include <Base/Exception.h>
 #include <Base/FileInfo.h>
-#include <Base/Sequencer.h>
 #include <Base/Stream.h>
 
+#include "ChunkedReader.h"
 #include "PointsAlgos.h"
 #include <E57Format.h>
 
@@ -67,62 +66,18 @@ void PointsAlgos::Load(PointKernel& points, const char* FileName)
 
 void PointsAlgos::LoadAscii(PointKernel& points, const char* FileName)
 {
-    boost::regex rx(
-        "^\\s*([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-        "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-        "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)\\s*$"
-    );
-    // boost::regex rx("(\\b[0-9]+\\.([0-9]+\\b)?|\\.[0-9]+\\b)");
-    // boost::regex
-    // rx("^\\s*(-?[0-9]*)\\.([0-9]+)\\s+(-?[0-9]*)\\.([0-9]+)\\s+(-?[0-9]*)\\.([0-9]+)\\s*$");
-    boost::cmatch what;
-
-    Base::Vector3d pt;
-    int LineCnt = 0;
-    std::string line;
-    Base::FileInfo fi(FileName);
-
-    Base::ifstream tmp_str(fi, std::ios::in);
-
-    // estimating size
-    while (std::getline(tmp_str, line)) {
-        LineCnt++;
-    }
-
-    // resize the PointKernel
-    points.resize(LineCnt);
-
-    Base::SequencerLauncher seq("Loading points…", LineCnt);
-
-    // again to the beginning
-    Base::ifstream file(fi, std::ios::in);
-    LineCnt = 0;
+    // the file is parsed in chunks of lines in parallel, lines that don't consist of exactly
+    // three numbers are skipped
+    MappedFile file(FileName);
+    points.clear();
 
     try {
-        // read file
-        while (std::getline(file, line)) {
-            if (boost::regex_match(line.c_str(), what, rx)) {
-                pt.x = std::atof(what[1].first);
-                pt.y = std::atof(what[4].first);
-                pt.z = std::atof(what[7].first);
-
-                points.setPoint(LineCnt, pt);
-                seq.next();
-                LineCnt++;
-            }
-        }
+        ChunkedReader::readAsciiPoints(file.data(), points);
     }
     catch (...) {
         points.clear();
         throw Base::BadFormatError("Reading in points failed.");
     }
-
-    // now remove the last points from the kernel
-    // Note: first we allocate memory corresponding to the number of lines (points and comments)
-    //       and read in the file twice. But then the size of the kernel is too high
-    if (LineCnt < (int)points.size()) {
-        points.erase(LineCnt, points.size());
-    }
 }
 
 // ----------------------------------------------------------------------------
@@ -249,94 +204,6 @@ public:
 
 using ConverterPtr = std::shared_ptr<Converter>;
 
-class DataStreambuf: public std::streambuf
-{
-public:
-    explicit DataStreambuf(const std::vector<char>& data)
-        : _buffer(data)
-        , _end(int(data.size()))
-    {}
-    ~DataStreambuf() override = default;
-
-protected:
-    int_type uflow() override
-    {
-        if (_cur == _end) {
-            return traits_type::eof();
-        }
-
-        return static_cast<DataStreambuf::int_type>(_buffer[_cur++]) & 0x000000ff;
-    }
-    int_type underflow() override
-    {
-        if (_cur == _end) {
-            return traits_type::eof();
-        }
-
-        return static_cast<DataStreambuf::int_type>(_buffer[_cur]) & 0x000000ff;
-    }
-    int_type pbackfail(int_type ch) override
-    {
-        if (_cur == _beg || (ch != traits_type::eof() && ch != _buffer[_cur - 1])) {
-            return traits_type::eof();
-        }
-
-        return static_cast<DataStreambuf::int_type>(_buffer[--_cur]) & 0x000000ff;
-    }
-    std::streamsize showmanyc() override
-    {
-        return _end - _cur;
-    }
-    pos_type seekoff(
-        std::streambuf::off_type off,
-        std::ios_base::seekdir way,
-        std::ios_base::openmode mode = std::ios::in | std::ios::out
-    ) override
-    {
-        (void)mode;
-        int p_pos = -1;
-        if (way == std::ios_base::beg) {
-            p_pos = _beg;
-        }
-        else if (way == std::ios_base::end) {
-            p_pos = _end;
-        }
-        else if (way == std::ios_base::cur) {
-            p_pos = _cur;
-        }
-
-        if (p_pos > _end) {
-            return traits_type::eof();
-        }
-
-        if (((p_pos + off) > _end) || ((p_pos + off) < _beg)) {
-            return traits_type::eof();
-        }
-
-        _cur = p_pos + off;
-
-        return ((p_pos + off) - _beg);
-    }
-    pos_type seekpos(
-        std::streambuf::pos_type pos,
-        std::ios_base::openmode which = std::ios::in | std::ios::out
-    ) override
-    {
-        (void)which;
-        return seekoff(pos, std::ios_base::beg);
-    }
-
-public:
-    DataStreambuf(const DataStreambuf&) = delete;
-    DataStreambuf(DataStreambuf&&) = delete;
-    DataStreambuf& operator=(const DataStreambuf&) = delete;
-    DataStreambuf& operator=(DataStreambuf&&) = delete;
-
-private:
-    const std::vector<char>& _buffer;
-    int _beg {0}, _end {0}, _cur {0};
-};
-
 // NOLINTBEGIN
 // Taken from https://github.com/PointCloudLibrary/pcl/blob/master/io/src/lzf.cpp
 unsigned int lzfDecompress(
@@ -570,20 +437,26 @@ void PlyReader::read(const std::string& filename)
     std::size_t offset = 0;
     Eigen::Index numPoints = Eigen::Index(readHeader(inp, format, offset, fields, types, sizes));
 
-    this->width = numPoints;
-    this->height = 1;
+    // the data is parsed directly from the mapped file
+    MappedFile file(filename);
+    std::string_view body = file.data();
+    body.remove_prefix(std::min(static_cast<std::size_t>(inp.tellg()), body.size()));
 
     Eigen::MatrixXd data(numPoints, fields.size());
     if (format == "ascii") {
-        readAscii(inp, offset, data);
+        readAscii(body, offset, data);
     }
     else if (format == "binary_little_endian") {
-        readBinary(false, inp, offset, types, sizes, data);
+        readBinary(false, body, offset, types, sizes, data);
     }
     else if (format == "binary_big_endian") {
-        readBinary(true, inp, offset, types, sizes, data);
+        readBinary(true, body, offset, types, sizes, data);
     }
 
+    numPoints = data.rows();
+    this->width = numPoints;
+    this->height = 1;
+
     std::vector<std::string>::iterator it;
     Eigen::Index max_size = std::numeric_limits<Eigen::Index>::max();
 
@@ -902,71 +775,45 @@ std::size_t PlyReader::readHeader(
     return numPoints;
 }
 
-void PlyReader::readAscii(std::istream& inp, std::size_t offset, Eigen::MatrixXd& data)
+void PlyReader::readAscii(std::string_view body, std::size_t offset, Eigen::MatrixXd& data)
 {
-    std::string line;
-    Eigen::Index row = 0;
-    Eigen::Index numPoints = Eigen::Index(data.rows());
-    Eigen::Index numFields = Eigen::Index(data.cols());
-    std::vector<std::string> list;
-    while (std::getline(inp, line) && row < numPoints) {
-        if (line.empty()) {
-            continue;
-        }
-
-        if (offset > 0) {
-            offset--;
-            continue;
-        }
-
-        // since the file is loaded in binary mode we may get the CR at the end
-        boost::trim(line);
-        boost::split(list, line, boost::is_any_of("\t\r "), boost::token_compress_on);
-
-        std::istringstream str(line);
-
-        Eigen::Index size = Eigen::Index(list.size());
-        for (Eigen::Index col = 0; col < size && col < numFields; col++) {
-            double value = boost::lexical_cast<double>(list[col]);
-            data(row, col) = value;
-        }
-
-        ++row;
+    // Eigen matrices are stored column-wise
+    std::size_t numRows = ChunkedReader::readAsciiTable(
+        body,
+        offset,
+        static_cast<std::size_t>(data.cols()),
+        static_cast<std::size_t>(data.rows()),
+        data.data(),
+        1,
+        data.rows()
+    );
+    if (Eigen::Index(numRows) < data.rows()) {
+        data.conservativeResize(Eigen::Index(numRows), Eigen::NoChange);
     }
 }
 
 void PlyReader::readBinary(
-    bool swapByteOrder,
-    std::istream& inp,
+    bool bigEndian,
+    std::string_view body,
     std::size_t offset,
     const std::vector<std::string>& types,
     const std::vector<int>& sizes,
     Eigen::MatrixXd& data
 )
 {
-    Eigen::Index numPoints = data.rows();
+    using ChunkedReader::ScalarType;
     Eigen::Index numFields = data.cols();
 
-    int neededSize = 0;
-    ConverterPtr convert_float32(new ConverterT<float>);
-    ConverterPtr convert_float64(new ConverterT<double>);
-    ConverterPtr convert_int8(new ConverterT<int8_t>);
-    ConverterPtr convert_uint8(new ConverterT<uint8_t>);
-    ConverterPtr convert_int16(new ConverterT<int16_t>);
-    ConverterPtr convert_uint16(new ConverterT<uint16_t>);
-    ConverterPtr convert_int32(new ConverterT<int32_t>);
-    ConverterPtr convert_uint32(new ConverterT<uint32_t>);
-
-    std::vector<ConverterPtr> converters;
+    std::vector<ScalarType> scalars;
     for (Eigen::Index j = 0; j < numFields; j++) {
         const std::string& t = types[j];
         switch (sizes[j]) {
             case 1:
                 if (t == "char" || t == "int8") {
-                    converters.push_back(convert_int8);
+                    scalars.push_back(ScalarType::Int8);
                 }
                 else if (t == "uchar" || t == "uint8") {
-                    converters.push_back(convert_uint8);
+                    scalars.push_back(ScalarType::UInt8);
                 }
                 else {
                     throw Base::BadFormatError("Unexpected type");
@@ -974,10 +821,10 @@ void PlyReader::readBinary(
                 break;
             case 2:
                 if (t == "short" || t == "int16") {
-                    converters.push_back(convert_int16);
+                    scalars.push_back(ScalarType::Int16);
                 }
                 else if (t == "ushort" || t == "uint16") {
-                    converters.push_back(convert_uint16);
+                    scalars.push_back(ScalarType::UInt16);
                 }
                 else {
                     throw Base::BadFormatError("Unexpected type");
@@ -985,13 +832,13 @@ void PlyReader::readBinary(
                 break;
             case 4:
                 if (t == "int" || t == "int32") {
-                    converters.push_back(convert_int32);
+                    scalars.push_back(ScalarType::Int32);
                 }
                 else if (t == "uint" || t == "uint32") {
-                    converters.push_back(convert_uint32);
+                    scalars.push_back(ScalarType::UInt32);
                 }
                 else if (t == "float" || t == "float32") {
-                    converters.push_back(convert_float32);
+                    scalars.push_back(ScalarType::Float32);
                 }
                 else {
                     throw Base::BadFormatError("Unexpected type");
@@ -999,7 +846,7 @@ void PlyReader::readBinary(
                 break;
             case 8:
                 if (t == "double" || t == "float64") {
-                    converters.push_back(convert_float64);
+                    scalars.push_back(ScalarType::Float64);
                 }
                 else {
                     throw Base::BadFormatError("Unexpected type");
@@ -1008,30 +855,23 @@ void PlyReader::readBinary(
             default:
                 throw Base::BadFormatError("Unexpected type");
         }
-
-        neededSize += converters.back()->getSizeOf();
     }
 
-    std::streamoff ulSize = 0;
-    std::streamoff ulCurr = 0;
-    std::streambuf* buf = inp.rdbuf();
-    if (buf) {
-        ulCurr = buf->pubseekoff(static_cast<std::streamoff>(offset), std::ios::cur, std::ios::in);
-        ulSize = buf->pubseekoff(0, std::ios::end, std::ios::in);
-        buf->pubseekoff(ulCurr, std::ios::beg, std::ios::in);
-        if (ulCurr + neededSize * static_cast<std::streamoff>(numPoints) > ulSize) {
-            throw Base::BadFormatError("File expects too many elements");
-        }
+    if (offset > body.size()) {
+        throw Base::BadFormatError("File expects too many elements");
     }
 
-    Base::InputStream str(inp);
-    str.setByteOrder(swapByteOrder ? Base::Stream::BigEndian : Base::Stream::LittleEndian);
-    for (Eigen::Index i = 0; i < numPoints; i++) {
-        for (Eigen::Index j = 0; j < numFields; j++) {
-            double value = converters[j]->toDouble(str);
-            data(i, j) = value;
-        }
-    }
+    body.remove_prefix(offset);
+    ChunkedReader::readBinaryTable(
+        body,
+        scalars,
+        bigEndian,
+        false,
+        static_cast<std::size_t>(data.rows()),
+        data.data(),
+        1,
+        data.rows()
+    );
 }
 
 // ----------------------------------------------------------------------------
@@ -1053,12 +893,17 @@ void PcdReader::read(const std::string& filename)
     std::vector<int> sizes;
     Eigen::Index numPoints = Eigen::Index(readHeader(inp, format, fields, types, sizes));
 
+    // the data is parsed directly from the mapped file
+    MappedFile file(filename);
+    std::string_view body = file.data();
+    body.remove_prefix(std::min(static_cast<std::size_t>(inp.tellg()), body.size()));
+
     Eigen::MatrixXd data(numPoints, fields.size());
     if (format == "ascii") {
-        readAscii(inp, data);
+        readAscii(body, data);
     }
     else if (format == "binary") {
-        readBinary(false, inp, types, sizes, data);
+        readBinary(false, body, types, sizes, data);
     }
     else if (format == "binary_compressed") {
         unsigned int c {};
@@ -1066,20 +911,27 @@ void PcdReader::read(const std::string& filename)
         Base::InputStream str(inp);
         str >> c >> u;
 
-        std::vector<char> compressed(c);
-        inp.read(compressed.data(), c);
+        const std::size_t headerSize = 2 * sizeof(unsigned int);
+        if (!inp || body.size() < headerSize || body.size() - headerSize < c) {
+            throw Base::BadFormatError("Unexpected end of compressed data");
+        }
+
         std::vector<char> uncompressed(u);
-        if (lzfDecompress(compressed.data(), c, uncompressed.data(), u) == u) {
-            DataStreambuf ibuf(uncompressed);
-            std::istream istr(nullptr);
-            istr.rdbuf(&ibuf);
-            readBinary(true, istr, types, sizes, data);
+        if (lzfDecompress(body.data() + headerSize, c, uncompressed.data(), u) == u) {
+            readBinary(true, std::string_view(uncompressed.data(), u), types, sizes, data);
         }
         else {
             throw Base::BadFormatError("Failed to decompress binary data");
         }
     }
 
+    // a truncated file is no longer structured
+    if (numPoints != data.rows()) {
+        numPoints = data.rows();
+        this->width = numPoints;
+        this->height = 1;
+    }
+
     std::vector<std::string>::iterator it;
     Eigen::Index max_size = std::numeric_limits<Eigen::Index>::max();
 
@@ -1275,65 +1127,44 @@ std::size_t PcdReader::readHeader(
     return points;
 }
 
-void PcdReader::readAscii(std::istream& inp, Eigen::MatrixXd& data)
+void PcdReader::readAscii(std::string_view body, Eigen::MatrixXd& data)
 {
-    std::string line;
-    Eigen::Index row = 0;
-    Eigen::Index numPoints = data.rows();
-    Eigen::Index numFields = data.cols();
-    std::vector<std::string> list;
-    while (std::getline(inp, line) && row < numPoints) {
-        if (line.empty()) {
-            continue;
-        }
-
-        // since the file is loaded in binary mode we may get the CR at the end
-        boost::trim(line);
-        boost::split(list, line, boost::is_any_of("\t\r "), boost::token_compress_on);
-
-        std::istringstream str(line);
-
-        Eigen::Index size = Eigen::Index(list.size());
-        for (Eigen::Index col = 0; col < size && col < numFields; col++) {
-            double value = boost::lexical_cast<double>(list[col]);
-            data(row, col) = value;
-        }
-
-        ++row;
+    // Eigen matrices are stored column-wise
+    std::size_t numRows = ChunkedReader::readAsciiTable(
+        body,
+        0,
+        static_cast<std::size_t>(data.cols()),
+        static_cast<std::size_t>(data.rows()),
+        data.data(),
+        1,
+        data.rows()
+    );
+    if (Eigen::Index(numRows) < data.rows()) {
+        data.conservativeResize(Eigen::Index(numRows), Eigen::NoChange);
     }
 }
 
 void PcdReader::readBinary(
     bool transpose,
-    std::istream& inp,
+    std::string_view body,
     const std::vector<std::string>& types,
     const std::vector<int>& sizes,
     Eigen::MatrixXd& data
 )
 {
-    Eigen::Index numPoints = data.rows();
+    using ChunkedReader::ScalarType;
     Eigen::Index numFields = data.cols();
 
-    int neededSize = 0;
-    ConverterPtr convert_float32(new ConverterT<float>);
-    ConverterPtr convert_float64(new ConverterT<double>);
-    ConverterPtr convert_int8(new ConverterT<int8_t>);
-    ConverterPtr convert_uint8(new ConverterT<uint8_t>);
-    ConverterPtr convert_int16(new ConverterT<int16_t>);
-    ConverterPtr convert_uint16(new ConverterT<uint16_t>);
-    ConverterPtr convert_int32(new ConverterT<int32_t>);
-    ConverterPtr convert_uint32(new ConverterT<uint32_t>);
-
-    std::vector<ConverterPtr> converters;
+    std::vector<ScalarType> scalars;
     for (Eigen::Index j = 0; j < numFields; j++) {
         char t = types[j][0];
         switch (sizes[j]) {
             case 1:
                 if (t == 'I') {
-                    converters.push_back(convert_int8);
+                    scalars.push_back(ScalarType::Int8);
                 }
                 else if (t == 'U') {
-                    converters.push_back(convert_uint8);
+                    scalars.push_back(ScalarType::UInt8);
                 }
                 else {
                     throw Base::BadFormatError("Unexpected type");
@@ -1341,10 +1172,10 @@ void PcdReader::readBinary(
                 break;
             case 2:
                 if (t == 'I') {
-                    converters.push_back(convert_int16);
+                    scalars.push_back(ScalarType::Int16);
                 }
                 else if (t == 'U') {
-                    converters.push_back(convert_uint16);
+                    scalars.push_back(ScalarType::UInt16);
                 }
                 else {
                     throw Base::BadFormatError("Unexpected type");
@@ -1352,13 +1183,13 @@ void PcdReader::readBinary(
                 break;
             case 4:
                 if (t == 'I') {
-                    converters.push_back(convert_int32);
+                    scalars.push_back(ScalarType::Int32);
                 }
                 else if (t == 'U') {
-                    converters.push_back(convert_uint32);
+                    scalars.push_back(ScalarType::UInt32);
                 }
                 else if (t == 'F') {
-                    converters.push_back(convert_float32);
+                    scalars.push_back(ScalarType::Float32);
                 }
                 else {
                     throw Base::BadFormatError("Unexpected type");
@@ -1366,7 +1197,7 @@ void PcdReader::readBinary(
                 break;
             case 8:
                 if (t == 'F') {
-                    converters.push_back(convert_float64);
+                    scalars.push_back(ScalarType::Float64);
                 }
                 else {
                     throw Base::BadFormatError("Unexpected type");
@@ -1375,39 +1206,18 @@ void PcdReader::readBinary(
             default:
                 throw Base::BadFormatError("Unexpected type");
         }
-
-        neededSize += converters.back()->getSizeOf();
-    }
-
-    std::streamoff ulSize = 0;
-    std::streamoff ulCurr = 0;
-    std::streambuf* buf = inp.rdbuf();
-    if (buf) {
-        ulCurr = buf->pubseekoff(0, std::ios::cur, std::ios::in);
-        ulSize = buf->pubseekoff(0, std::ios::end, std::ios::in);
-        buf->pubseekoff(ulCurr, std::ios::beg, std::ios::in);
-        if (ulCurr + neededSize * static_cast<std::streamoff>(numPoints) > ulSize) {
-            throw Base::BadFormatError("File expects too many elements");
-        }
     }
 
-    Base::InputStream str(inp);
-    if (transpose) {
-        for (Eigen::Index j = 0; j < numFields; j++) {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                double value = converters[j]->toDouble(str);
-                data(i, j) = value;
-            }
-        }
-    }
-    else {
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            for (Eigen::Index j = 0; j < numFields; j++) {
-                double value = converters[j]->toDouble(str);
-                data(i, j) = value;
-            }
-        }
-    }
+    ChunkedReader::readBinaryTable(
+        body,
+        scalars,
+        false,
+        transpose,
+        static_cast<std::size_t>(data.rows()),
+        data.data(),
+        1,
+        data.rows()
+    );
 }
 
 // ----------------------------------------------------------------------------
@@ -1433,22 +1243,22 @@ public:
         }
     }
 
-    std::vector<Base::Color> getColors() const
+    std::vector<Base::Color>& getColors()
     {
         return colors;
     }
 
-    std::vector<float> getItensity() const
+    std::vector<float>& getItensity()
     {
         return intensity;
     }
 
-    const PointKernel& getPoints() const
+    PointKernel& getPoints()
     {
         return points;
     }
 
-    const std::vector<Base::Vector3f>& getNormals() const
+    std::vector<Base::Vector3f>& getNormals()
     {
         return normals;
     }
@@ -1733,6 +1543,19 @@ private:
         bool hasState = proto.inv_state && checkState;
         bool filter = false;
 
+        // the records are decoded block-wise straight into the preallocated arrays
+        auto numRecords = static_cast<std::size_t>(cvn.childCount());
+        points.reserve(points.size() + numRecords);
+        if (hasColor) {
+            colors.reserve(colors.size() + numRecords);
+        }
+        if (hasItensity) {
+            intensity.reserve(intensity.size() + numRecords);
+        }
+        if (hasNormal) {
+            normals.reserve(normals.size() + numRecords);
+        }
+
         while ((count = cvr.read())) {
             for (size_t i = 0; i < count; ++i) {
                 filter = false;
@@ -1864,7 +1687,7 @@ private:
     bool useColor;
     bool checkState;
     double minDistance;
-    const size_t buf_size = 1024;
+    const size_t buf_size = 65536;
     std::vector<Base::Color> colors;
     std::vector<float> intensity;
     PointKernel points;
@@ -1883,10 +1706,10 @@ void E57Reader::read(const std::string& filename)
     try {
         E57ReaderImp reader(filename, useColor, checkState, minDistance);
         reader.read();
-        points = reader.getPoints();
-        normals = reader.getNormals();
-        colors = reader.getColors();
-        intensity = reader.getItensity();
+        points.swap(reader.getPoints().getBasicPoints());
+        normals.swap(reader.getNormals());
+        colors.swap(reader.getColors());
+        intensity.swap(reader.getItensity());
         width = points.size();
         height = 1;
     }
@@ -24,6 +24,8 @@
 
 #pragma once
 
+#include <string_view>
+
 #include <Eigen/Core>
 
 #include "Points.h"
@@ -104,10 +106,10 @@ private:
         std::vector<std::string>& types,
         std::vector<int>& sizes
     );
-    void readAscii(std::istream&, std::size_t offset, Eigen::MatrixXd& data);
+    void readAscii(std::string_view, std::size_t offset, Eigen::MatrixXd& data);
     void readBinary(
-        bool swapByteOrder,
-        std::istream&,
+        bool bigEndian,
+        std::string_view,
         std::size_t offset,
         const std::vector<std::string>& types,
         const std::vector<int>& sizes,
@@ -129,10 +131,10 @@ private:
         std::vector<std::string>& types,
         std::vector<int>& sizes
     );
-    void readAscii(std::istream&, Eigen::MatrixXd& data);
+    void readAscii(std::string_view, Eigen::MatrixXd& data);
     void readBinary(
         bool transpose,
-        std::istream&,
+        std::string_view,
         const std::vector<std::string>& types,
         const std::vector<int>& sizes,
         Eigen::MatrixXd& data
@@ -0,0 +1,482 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+
+#include <QtConcurrentMap>
+
+#include <Base/Exception.h>
+
+#include "PointsFilter.h"
+
+
+using namespace Points;
+
+namespace
+{
+// cells per axis are packed into 21 bits of a 64-bit key
+constexpr std::int64_t maxCells = std::int64_t(1) << 21;
+
+bool isValid(const Base::Vector3f& pnt)
+{
+    return !std::isnan(pnt.x) && !std::isnan(pnt.y) && !std::isnan(pnt.z);
+}
+
+// Calls func(begin, end) for ranges of [0, count) on all cores
+template<typename Func>
+void parallelRanges(std::size_t count, std::size_t rangeSize, Func&& func)
+{
+    std::vector<std::size_t> ranges((count + rangeSize - 1) / rangeSize);
+    std::iota(ranges.begin(), ranges.end(), 0);
+    QtConcurrent::blockingMap(ranges, [&](std::size_t range) {
+        std::size_t begin = range * rangeSize;
+        func(begin, std::min(count, begin + rangeSize));
+    });
+}
+
+// Returns the indices of the valid points for which pred is true
+template<typename Pred>
+std::vector<std::size_t> selectIf(const std::vector<Base::Vector3f>& points, Pred&& pred)
+{
+    std::vector<char> keep(points.size());
+    parallelRanges(points.size(), 16384, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            keep[i] = isValid(points[i]) && pred(points[i]) ? 1 : 0;
+        }
+    });
+
+    std::vector<std::size_t> indices;
+    indices.reserve(std::count(keep.begin(), keep.end(), 1));
+    for (std::size_t i = 0; i < keep.size(); i++) {
+        if (keep[i]) {
+            indices.push_back(i);
+        }
+    }
+    return indices;
+}
+
+/*
+ * A uniform grid of the valid points where only the occupied cells are stored. The points are
+ * sorted by their cell so that each cell is a range of getOrder().
+ */
+class CellGrid
+{
+public:
+    struct Cell
+    {
+        std::int64_t x, y, z;
+    };
+
+    CellGrid(const std::vector<Base::Vector3f>& pts, float size)
+        : points(pts)
+        , cellSize(size)
+    {
+        std::vector<std::size_t> valid;
+        valid.reserve(points.size());
+        for (std::size_t i = 0; i < points.size(); i++) {
+            if (isValid(points[i])) {
+                valid.push_back(i);
+                box.Add(points[i]);
+            }
+        }
+        if (valid.empty()) {
+            return;
+        }
+
+        dims = {
+            cellIndex(box.MaxX, box.MinX) + 1,
+            cellIndex(box.MaxY, box.MinY) + 1,
+            cellIndex(box.MaxZ, box.MinZ) + 1,
+        };
+        if (dims.x > maxCells || dims.y > maxCells || dims.z > maxCells) {
+            throw Base::ValueError("Cell size is too small for the extent of the points");
+        }
+
+        std::vector<std::pair<std::uint64_t, std::size_t>> keys(valid.size());
+        parallelRanges(valid.size(), 16384, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                keys[i] = {key(cellOf(points[valid[i]])), valid[i]};
+            }
+        });
+        std::sort(keys.begin(), keys.end());
+
+        order.resize(keys.size());
+        for (std::size_t i = 0; i < keys.size(); i++) {
+            order[i] = keys[i].second;
+            if (i == 0 || keys[i].first != keys[i - 1].first) {
+                starts.push_back(i);
+                cells.emplace(keys[i].first, starts.size() - 1);
+            }
+        }
+        starts.push_back(keys.size());
+    }
+
+    const std::vector<std::size_t>& getOrder() const
+    {
+        return order;
+    }
+    // Returns the number of occupied cells, the points of cell i are the entries
+    // [getStart(i), getStart(i + 1)) of getOrder()
+    std::size_t countCells() const
+    {
+        return starts.empty() ? 0 : starts.size() - 1;
+    }
+    std::size_t getStart(std::size_t cell) const
+    {
+        return starts[cell];
+    }
+    std::int64_t maxDim() const
+    {
+        return std::max({dims.x, dims.y, dims.z});
+    }
+
+    Cell cellOf(const Base::Vector3f& pnt) const
+    {
+        return {cellIndex(pnt.x, box.MinX), cellIndex(pnt.y, box.MinY), cellIndex(pnt.z, box.MinZ)};
+    }
+
+    // Calls func(index) for the points of the cells whose Chebyshev distance to the cell of
+    // pnt is ring
+    template<typename Func>
+    void visitRing(const Base::Vector3f& pnt, std::int64_t ring, Func&& func) const
+    {
+        Cell center = cellOf(pnt);
+        for (std::int64_t x = center.x - ring; x <= center.x + ring; x++) {
+            if (x < 0 || x >= dims.x) {
+                continue;
+            }
+            bool xOnRing = std::abs(x - center.x) == ring;
+            for (std::int64_t y = center.y - ring; y <= center.y + ring; y++) {
+                if (y < 0 || y >= dims.y) {
+                    continue;
+                }
+                bool onRing = xOnRing || std::abs(y - center.y) == ring;
+                // inside the ring only the two cells on the z-faces belong to it
+                std::int64_t step = onRing ? 1 : std::max<std::int64_t>(2 * ring, 1);
+                for (std::int64_t z = center.z - ring; z <= center.z + ring; z += step) {
+                    if (z < 0 || z >= dims.z) {
+                        continue;
+                    }
+                    auto it = cells.find(key({x, y, z}));
+                    if (it != cells.end()) {
+                        for (std::size_t i = starts[it->second]; i < starts[it->second + 1]; i++) {
+                            func(order[i]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    std::int64_t cellIndex(float value, float min) const
+    {
+        return static_cast<std::int64_t>(std::floor((value - min) / cellSize));
+    }
+    static std::uint64_t key(const Cell& cell)
+    {
+        return (std::uint64_t(cell.x) << 42) | (std::uint64_t(cell.y) << 21)
+            | std::uint64_t(cell.z);
+    }
+
+private:
+    const std::vector<Base::Vector3f>& points;
+    float cellSize;
+    Base::BoundBox3f box;
+    Cell dims {0, 0, 0};
+    std::vector<std::size_t> order;
+    std::vector<std::size_t> starts;
+    std::unordered_map<std::uint64_t, std::size_t> cells;
+};
+
+// Returns a cell size for which a cell holds about count points
+float neighbourCellSize(const std::vector<Base::Vector3f>& points, std::size_t valid, int count)
+{
+    Base::BoundBox3f box;
+    for (const auto& pnt : points) {
+        if (isValid(pnt)) {
+            box.Add(pnt);
+        }
+    }
+
+    // Scans sample surfaces, so start with the density of points on a square of the size of
+    // the bounding box and correct it once with the actual occupancy of the cells
+    float length = std::max({box.LengthX(), box.LengthY(), box.LengthZ()});
+    if (length <= 0.0F) {
+        return 1.0F;
+    }
+    float minSize = length / float(maxCells - 1);
+    float size = std::max(length * std::sqrt(float(count) / float(valid)), minSize);
+    CellGrid grid(points, size);
+    float occupancy = float(valid) / float(std::max<std::size_t>(grid.countCells(), 1));
+    return std::max(size * std::sqrt(float(count) / occupancy), minSize);
+}
+}  // namespace
+
+PointCloud PointCloud::select(const std::vector<std::size_t>& indices) const
+{
+    auto pick = [&indices, this](const auto& values, auto& result) {
+        if (values.size() == points.size()) {
+            result.reserve(indices.size());
+            for (std::size_t index : indices) {
+                result.push_back(values[index]);
+            }
+        }
+    };
+
+    PointCloud cloud;
+    pick(points, cloud.points);
+    pick(normals, cloud.normals);
+    pick(intensity, cloud.intensity);
+    pick(colors, cloud.colors);
+    return cloud;
+}
+
+PointCloud PointsFilter::voxelDownsample(const PointCloud& cloud, float voxelSize)
+{
+    if (!(voxelSize > 0.0F)) {
+        throw Base::ValueError("Voxel size must be positive");
+    }
+
+    const auto& points = cloud.points;
+    bool hasNormals = cloud.normals.size() == points.size();
+    bool hasIntensity = cloud.intensity.size() == points.size();
+    bool hasColors = cloud.colors.size() == points.size();
+
+    CellGrid grid(points, voxelSize);
+    const auto& order = grid.getOrder();
+    std::size_t count = grid.countCells();
+
+    PointCloud result;
+    result.points.resize(count);
+    if (hasNormals) {
+        result.normals.resize(count);
+    }
+    if (hasIntensity) {
+        result.intensity.resize(count);
+    }
+    if (hasColors) {
+        result.colors.resize(count);
+    }
+
+    parallelRanges(count, 1024, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t cell = begin; cell < end; cell++) {
+            std::size_t first = grid.getStart(cell);
+            std::size_t last = grid.getStart(cell + 1);
+            auto num = double(last - first);
+
+            Base::Vector3d center;
+            Base::Vector3d normal;
+            double grey = 0.0;
+            double r = 0.0, g = 0.0, b = 0.0, a = 0.0;
+            for (std::size_t i = first; i < last; i++) {
+                std::size_t index = order[i];
+                center += Base::toVector<double>(points[index]);
+                if (hasNormals) {
+                    normal += Base::toVector<double>(cloud.normals[index]);
+                }
+                if (hasIntensity) {
+                    grey += cloud.intensity[index];
+                }
+                if (hasColors) {
+                    const Base::Color& color = cloud.colors[index];
+                    r += color.r;
+                    g += color.g;
+                    b += color.b;
+                    a += color.a;
+                }
+            }
+
+            result.points[cell] = Base::toVector<float>(center / num);
+            if (hasNormals) {
+                result.normals[cell] = Base::toVector<float>(normal.Normalize());
+            }
+            if (hasIntensity) {
+                result.intensity[cell] = float(grey / num);
+            }
+            if (hasColors) {
+                result.colors[cell] = Base::Color(
+                    float(r / num),
+                    float(g / num),
+                    float(b / num),
+                    float(a / num)
+                );
+            }
+        }
+    });
+
+    return result;
+}
+
+std::vector<std::size_t> PointsFilter::statisticalInliers(
+    const std::vector<Base::Vector3f>& points,
+    int neighbours,
+    double stdRatio
+)
+{
+    if (neighbours < 1) {
+        throw Base::ValueError("Number of neighbours must be positive");
+    }
+
+    std::size_t valid = std::count_if(points.begin(), points.end(), isValid);
+    auto k = std::min<std::size_t>(neighbours, valid > 0 ? valid - 1 : 0);
+    if (k == 0) {
+        return selectIf(points, [](const Base::Vector3f&) { return true; });
+    }
+
+    float cellSize = neighbourCellSize(points, valid, int(k));
+    CellGrid grid(points, cellSize);
+    const auto& order = grid.getOrder();
+
+    // mean distance of each point to its k nearest neighbours
+    std::vector<double> distances(order.size());
+    parallelRanges(order.size(), 1024, [&](std::size_t begin, std::size_t end) {
+        std::priority_queue<float> nearest;
+        for (std::size_t i = begin; i < end; i++) {
+            std::size_t index = order[i];
+            const Base::Vector3f& pnt = points[index];
+            nearest = {};
+            auto visit = [&](std::size_t other) {
+                if (other == index) {
+                    return;
+                }
+                float dist = Base::DistanceP2(pnt, points[other]);
+                if (nearest.size() < k) {
+                    nearest.push(dist);
+                }
+                else if (dist < nearest.top()) {
+                    nearest.pop();
+                    nearest.push(dist);
+                }
+            };
+
+            // a point in a cell beyond the ring is at least ring * cellSize away
+            for (std::int64_t ring = 0; ring <= grid.maxDim(); ring++) {
+                grid.visitRing(pnt, ring, visit);
+                float reach = float(ring) * cellSize;
+                if (nearest.size() == k && nearest.top() <= reach * reach) {
+                    break;
+                }
+            }
+
+            double sum = 0.0;
+            for (; !nearest.empty(); nearest.pop()) {
+                sum += std::sqrt(double(nearest.top()));
+            }
+            distances[i] = sum / double(k);
+        }
+    });
+
+    double mean = std::accumulate(distances.begin(), distances.end(), 0.0)
+        / double(distances.size());
+    double variance = 0.0;
+    for (double dist : distances) {
+        variance += (dist - mean) * (dist - mean);
+    }
+    double deviation = std::sqrt(variance / double(distances.size()));
+    double limit = mean + stdRatio * deviation;
+
+    std::vector<std::size_t> indices;
+    for (std::size_t i = 0; i < order.size(); i++) {
+        if (distances[i] <= limit) {
+            indices.push_back(order[i]);
+        }
+    }
+    std::sort(indices.begin(), indices.end());
+    return indices;
+}
+
+std::vector<std::size_t> PointsFilter::radiusInliers(
+    const std::vector<Base::Vector3f>& points,
+    float radius,
+    int minNeighbours
+)
+{
+    if (!(radius > 0.0F)) {
+        throw Base::ValueError("Radius must be positive");
+    }
+
+    CellGrid grid(points, radius);
+    const auto& order = grid.getOrder();
+    std::vector<char> keep(order.size());
+    float radius2 = radius * radius;
+    parallelRanges(order.size(), 1024, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            std::size_t index = order[i];
+            const Base::Vector3f& pnt = points[index];
+            int count = 0;
+            auto visit = [&](std::size_t other) {
+                if (other != index && Base::DistanceP2(pnt, points[other]) <= radius2) {
+                    count++;
+                }
+            };
+            // with the radius as cell size all neighbours are in the adjacent cells
+            grid.visitRing(pnt, 0, visit);
+            grid.visitRing(pnt, 1, visit);
+            keep[i] = count >= minNeighbours ? 1 : 0;
+        }
+    });
+
+    std::vector<std::size_t> indices;
+    for (std::size_t i = 0; i < order.size(); i++) {
+        if (keep[i]) {
+            indices.push_back(order[i]);
+        }
+    }
+    std::sort(indices.begin(), indices.end());
+    return indices;
+}
+
+std::vector<std::size_t> PointsFilter::cropBox(
+    const std::vector<Base::Vector3f>& points,
+    const Base::BoundBox3f& box,
+    bool invert
+)
+{
+    return selectIf(points, [&box, invert](const Base::Vector3f& pnt) {
+        return box.IsInBox(pnt) != invert;
+    });
+}
+
+std::vector<std::size_t> PointsFilter::cropPlane(
+    const std::vector<Base::Vector3f>& points,
+    const Base::Vector3f& base,
+    const Base::Vector3f& normal,
+    bool invert
+)
+{
+    if (normal.Sqr() == 0.0F) {
+        throw Base::ValueError("Plane normal must not be null");
+    }
+
+    return selectIf(points, [&base, &normal, invert](const Base::Vector3f& pnt) {
+        return ((pnt - base) * normal >= 0.0F) != invert;
+    });
+}
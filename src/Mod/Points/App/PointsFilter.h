@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <Base/BoundBox.h>
+#include <Base/Color.h>
+#include <Base/Vector3D.h>
+
+#include <Mod/Points/PointsGlobal.h>
+
+
+namespace Points
+{
+
+/**
+ * A point cloud with its per-point attributes. An attribute list is either empty or has one
+ * entry per point.
+ */
+struct PointsExport PointCloud
+{
+    std::vector<Base::Vector3f> points;
+    std::vector<Base::Vector3f> normals;
+    std::vector<float> intensity;
+    std::vector<Base::Color> colors;
+
+    /** Returns the cloud with the points \a indices and their attributes. */
+    PointCloud select(const std::vector<std::size_t>& indices) const;
+};
+
+/**
+ * The PointsFilter class contains the filters that are applied to every scan before it is
+ * processed further.
+ *
+ * The filters run on all cores. Points with NaN coordinates are removed by every filter.
+ */
+class PointsExport PointsFilter
+{
+public:
+    /**
+     * Replaces the points in each cell of a grid with the cell size \a voxelSize by their
+     * centroid. The attributes are averaged as well, the normals are normalized afterwards.
+     */
+    static PointCloud voxelDownsample(const PointCloud& cloud, float voxelSize);
+
+    /**
+     * Returns the indices of the points whose mean distance to their \a neighbours nearest
+     * neighbours is at most \a stdRatio standard deviations above the mean of all points.
+     */
+    static std::vector<std::size_t> statisticalInliers(
+        const std::vector<Base::Vector3f>& points,
+        int neighbours,
+        double stdRatio
+    );
+
+    /**
+     * Returns the indices of the points that have at least \a minNeighbours other points
+     * within \a radius.
+     */
+    static std::vector<std::size_t> radiusInliers(
+        const std::vector<Base::Vector3f>& points,
+        float radius,
+        int minNeighbours
+    );
+
+    /** Returns the indices of the points inside \a box, or outside if \a invert is true. */
+    static std::vector<std::size_t> cropBox(
+        const std::vector<Base::Vector3f>& points,
+        const Base::BoundBox3f& box,
+        bool invert
+    );
+
+    /**
+     * Returns the indices of the points on the side of the plane through \a base that
+     * \a normal points to, or on the other side if \a invert is true.
+     */
+    static std::vector<std::size_t> cropPlane(
+        const std::vector<Base::Vector3f>& points,
+        const Base::Vector3f& base,
+        const Base::Vector3f& normal,
+        bool invert
+    );
+};
+
+}  // namespace Points
@@ -0,0 +1,306 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <queue>
+
+#include <QtConcurrentMap>
+
+#include <Base/Exception.h>
+
+#include "PointsOctree.h"
+
+
+using namespace Points;
+
+namespace
+{
+// number of cells per axis of the grid used to sample the points of a node
+constexpr int sampleGrid = 128;
+// a node at this depth becomes a leaf, e.g. if many points are at the same location
+constexpr int maxDepth = 21;
+
+Base::BoundBox3f childBox(const Base::BoundBox3f& box, int octant)
+{
+    Base::Vector3f center = box.GetCenter();
+    Base::BoundBox3f child;
+    child.MinX = (octant & 1) ? center.x : box.MinX;
+    child.MaxX = (octant & 1) ? box.MaxX : center.x;
+    child.MinY = (octant & 2) ? center.y : box.MinY;
+    child.MaxY = (octant & 2) ? box.MaxY : center.y;
+    child.MinZ = (octant & 4) ? center.z : box.MinZ;
+    child.MaxZ = (octant & 4) ? box.MaxZ : center.z;
+    return child;
+}
+}  // namespace
+
+PointsOctree::PointsOctree(const std::vector<Base::Vector3f>& pts, std::size_t size)
+    : points(pts)
+    , nodeSize(std::max<std::size_t>(size, 1))
+{
+    if (points.size() > std::numeric_limits<index_type>::max()) {
+        throw Base::ValueError("Too many points for the level-of-detail structure");
+    }
+
+    Base::BoundBox3f box;
+    order.reserve(points.size());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        const Base::Vector3f& pnt = points[i];
+        if (!std::isnan(pnt.x) && !std::isnan(pnt.y) && !std::isnan(pnt.z)) {
+            order.push_back(index_type(i));
+            box.Add(pnt);
+        }
+    }
+
+    if (order.empty()) {
+        return;
+    }
+
+    // use a cube so that the spacing of a node is the same in all directions
+    Base::Vector3f center = box.GetCenter();
+    float half = 0.5F * std::max({box.LengthX(), box.LengthY(), box.LengthZ()});
+    Base::BoundBox3f cube(
+        center.x - half,
+        center.y - half,
+        center.z - half,
+        center.x + half,
+        center.y + half,
+        center.z + half
+    );
+    build(0, order.size(), cube, 0, nodes);
+}
+
+void PointsOctree::build(
+    std::size_t begin,
+    std::size_t end,
+    const Base::BoundBox3f& box,
+    int depth,
+    NodeList& list
+)
+{
+    int index = int(list.size());
+    list.emplace_back();
+    list[index].box = box;
+    list[index].begin = begin;
+
+    if (end - begin <= nodeSize || depth >= maxDepth || !(box.LengthX() > 0.0F)) {
+        list[index].count = end - begin;
+        return;
+    }
+
+    std::size_t count = sample(begin, end, box);
+    list[index].count = count;
+    list[index].spacing = box.LengthX() / float(sampleGrid);
+
+    std::array<std::size_t, 9> bounds = split(begin + count, end, box.GetCenter());
+    if (depth > 0) {
+        for (int octant = 0; octant < 8; octant++) {
+            if (bounds[octant] < bounds[octant + 1]) {
+                list[index].children[octant] = int(list.size());
+                build(bounds[octant], bounds[octant + 1], childBox(box, octant), depth + 1, list);
+            }
+        }
+        return;
+    }
+
+    // the octants of the root are built in parallel, each into its own list
+    std::vector<int> octants(8);
+    std::iota(octants.begin(), octants.end(), 0);
+    std::vector<NodeList> subtrees = QtConcurrent::blockingMapped<std::vector<NodeList>>(
+        octants,
+        [&](int octant) {
+            NodeList subtree;
+            if (bounds[octant] < bounds[octant + 1]) {
+                build(bounds[octant], bounds[octant + 1], childBox(box, octant), depth + 1, subtree);
+            }
+            return subtree;
+        }
+    );
+
+    for (int octant = 0; octant < 8; octant++) {
+        const NodeList& subtree = subtrees[octant];
+        if (subtree.empty()) {
+            continue;
+        }
+        int offset = int(list.size());
+        list[index].children[octant] = offset;
+        for (Node node : subtree) {
+            for (int& child : node.children) {
+                if (child >= 0) {
+                    child += offset;
+                }
+            }
+            list.push_back(node);
+        }
+    }
+}
+
+std::size_t PointsOctree::sample(std::size_t begin, std::size_t end, const Base::BoundBox3f& box)
+{
+    // Takes the first point of each cell of a regular grid over the box and moves it to the
+    // front of the range. Only the touched cells are reset afterwards.
+    thread_local std::vector<char> grid;
+    grid.resize(std::size_t(sampleGrid) * sampleGrid * sampleGrid);
+    std::vector<std::size_t> touched;
+
+    float scale = float(sampleGrid) / box.LengthX();
+    auto cell = [&](float value, float min) {
+        return std::clamp(int((value - min) * scale), 0, sampleGrid - 1);
+    };
+
+    std::size_t count = 0;
+    for (std::size_t i = begin; i < end && count < nodeSize; i++) {
+        const Base::Vector3f& pnt = points[order[i]];
+        std::size_t key = (std::size_t(cell(pnt.z, box.MinZ)) * sampleGrid + cell(pnt.y, box.MinY))
+                * sampleGrid
+            + cell(pnt.x, box.MinX);
+        if (!grid[key]) {
+            grid[key] = 1;
+            touched.push_back(key);
+            std::swap(order[begin + count], order[i]);
+            count++;
+        }
+    }
+
+    for (std::size_t key : touched) {
+        grid[key] = 0;
+    }
+
+    return count;
+}
+
+std::array<std::size_t, 9> PointsOctree::split(
+    std::size_t begin,
+    std::size_t end,
+    const Base::Vector3f& center
+)
+{
+    auto part = [this, &center](std::size_t first, std::size_t last, unsigned short axis) {
+        auto it = std::partition(order.begin() + first, order.begin() + last, [&](index_type index) {
+            return points[index][axis] < center[axis];
+        });
+        return std::size_t(it - order.begin());
+    };
+
+    // sort the range into the octants x + 2 * y + 4 * z
+    std::size_t z1 = part(begin, end, 2);
+    std::size_t z0y1 = part(begin, z1, 1);
+    std::size_t z1y1 = part(z1, end, 1);
+    return {
+        begin,
+        part(begin, z0y1, 0),
+        z0y1,
+        part(z0y1, z1, 0),
+        z1,
+        part(z1, z1y1, 0),
+        z1y1,
+        part(z1y1, end, 0),
+        end
+    };
+}
+
+bool PointsOctree::isVisible(const Base::BoundBox3f& box, const View& view)
+{
+    // the box is outside if its corner farthest along the normal is outside of a plane
+    for (const auto& it : view.planes) {
+        const Base::Vector3f& normal = it.first;
+        Base::Vector3f corner(
+            normal.x >= 0.0F ? box.MaxX : box.MinX,
+            normal.y >= 0.0F ? box.MaxY : box.MinY,
+            normal.z >= 0.0F ? box.MaxZ : box.MinZ
+        );
+        if (normal * corner < it.second) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+float PointsOctree::projectedLength(float length, const Base::BoundBox3f& box, const View& view)
+{
+    if (!view.perspective) {
+        return length * view.pixelScale;
+    }
+
+    const Base::Vector3f& eye = view.eye;
+    float dx = std::max({box.MinX - eye.x, 0.0F, eye.x - box.MaxX});
+    float dy = std::max({box.MinY - eye.y, 0.0F, eye.y - box.MaxY});
+    float dz = std::max({box.MinZ - eye.z, 0.0F, eye.z - box.MaxZ});
+    float dist = std::sqrt(dx * dx + dy * dy + dz * dz);
+    if (dist <= 0.0F) {
+        return std::numeric_limits<float>::max();
+    }
+
+    return length * view.pixelScale / dist;
+}
+
+std::vector<int> PointsOctree::selectNodes(
+    const View& view,
+    float maxPixelSpacing,
+    std::size_t pointBudget
+) const
+{
+    std::vector<int> selection;
+    if (nodes.empty() || !isVisible(nodes.front().box, view)) {
+        return selection;
+    }
+
+    // the nodes that appear largest on the screen are refined first
+    using Entry = std::pair<float, int>;
+    std::priority_queue<Entry> queue;
+    auto push = [&](int index) {
+        const Base::BoundBox3f& box = nodes[index].box;
+        queue.emplace(projectedLength(box.CalcDiagonalLength(), box, view), index);
+    };
+
+    push(0);
+    std::size_t count = 0;
+    while (!queue.empty()) {
+        int index = queue.top().second;
+        queue.pop();
+
+        const Node& node = nodes[index];
+        if (!selection.empty() && count + node.count > pointBudget) {
+            break;
+        }
+
+        selection.push_back(index);
+        count += node.count;
+
+        if (projectedLength(node.spacing, node.box, view) <= maxPixelSpacing) {
+            continue;
+        }
+        for (int child : node.children) {
+            if (child >= 0 && isVisible(nodes[child].box, view)) {
+                push(child);
+            }
+        }
+    }
+
+    return selection;
+}
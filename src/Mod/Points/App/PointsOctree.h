@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <Base/BoundBox.h>
+#include <Base/Vector3D.h>
+
+#include <Mod/Points/PointsGlobal.h>
+
+
+namespace Points
+{
+
+/**
+ * The PointsOctree class is a level-of-detail structure for large point clouds.
+ *
+ * Each node of the octree owns a spatially uniform sample of the points inside its box
+ * that were not taken by one of its ancestors, the leaves own all remaining points. Drawing
+ * a node together with all its ancestors thus gives a coarse view of its region and
+ * refining into the children adds detail. Every point is owned by exactly one node.
+ *
+ * The points themselves are not copied. Instead the octree keeps a permutation of the point
+ * indices in which the points of each node are stored contiguously, so that a node can be
+ * drawn directly with an index array into the original points. Points with NaN coordinates
+ * are left out.
+ * \note The octree refers to the points given to the constructor, so they must outlive it and
+ * must not change.
+ */
+class PointsExport PointsOctree
+{
+public:
+    using index_type = std::uint32_t;
+
+    struct Node
+    {
+        /** The box of the node. */
+        Base::BoundBox3f box;
+        /** The position of the own points in getOrder(). */
+        std::size_t begin {0};
+        /** The number of own points. */
+        std::size_t count {0};
+        /** The approximate distance of the own points, 0 for a leaf. */
+        float spacing {0.0F};
+        /** The indices of the children in getNodes() or -1. */
+        std::array<int, 8> children {-1, -1, -1, -1, -1, -1, -1, -1};
+    };
+
+    /** Describes the view for selectNodes() in the coordinate system of the points. */
+    struct View
+    {
+        /** Planes (n, d) of the view volume, points p inside fulfill n * p >= d. */
+        std::vector<std::pair<Base::Vector3f, float>> planes;
+        /** The eye position for a perspective view. */
+        Base::Vector3f eye;
+        bool perspective {true};
+        /** Pixels per length unit, for a perspective view at the distance 1 to the eye. */
+        float pixelScale {1.0F};
+    };
+
+    /** Builds the octree of \a points where each node owns at most about \a nodeSize points.
+     * At most 2^32 points are supported.
+     */
+    explicit PointsOctree(const std::vector<Base::Vector3f>& points, std::size_t nodeSize = 20000);
+
+    /** Returns all nodes, the root is the first one. */
+    const std::vector<Node>& getNodes() const
+    {
+        return nodes;
+    }
+    /** Returns the permutation of the point indices, see Node::begin. */
+    const std::vector<index_type>& getOrder() const
+    {
+        return order;
+    }
+    /** Returns the number of points in the octree. */
+    std::size_t countPoints() const
+    {
+        return order.size();
+    }
+
+    /**
+     * Returns the nodes to draw for \a view, coarse nodes first. A visible node is refined as
+     * long as the distance of its points on the screen exceeds \a maxPixelSpacing. The nodes of
+     * the most visible gaps are refined first until the number of points of the selected nodes
+     * would exceed \a pointBudget.
+     */
+    std::vector<int> selectNodes(const View& view, float maxPixelSpacing, std::size_t pointBudget) const;
+
+private:
+    using NodeList = std::vector<Node>;
+    void build(std::size_t begin, std::size_t end, const Base::BoundBox3f& box, int depth, NodeList& list);
+    std::size_t sample(std::size_t begin, std::size_t end, const Base::BoundBox3f& box);
+    std::array<std::size_t, 9> split(std::size_t begin, std::size_t end, const Base::Vector3f& center);
+    static bool isVisible(const Base::BoundBox3f& box, const View& view);
+    static float projectedLength(float length, const Base::BoundBox3f& box, const View& view);
+
+private:
+    const std::vector<Base::Vector3f>& points;
+    std::vector<index_type> order;
+    std::vector<Node> nodes;
+    std::size_t nodeSize;
+};
+
+}  // namespace Points
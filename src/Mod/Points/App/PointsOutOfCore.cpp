@@ -0,0 +1,615 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <numeric>
+
+#include <QFile>
+#include <QtConcurrentMap>
+
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
+#include <Base/Stream.h>
+
+#include "ChunkedReader.h"
+#include "Points.h"
+#include "PointsOutOfCore.h"
+
+
+using namespace Points;
+
+namespace
+{
+constexpr char magic[8] = {'F', 'C', 'P', 'O', 'I', 'N', 'T', 'S'};
+constexpr std::uint32_t version = 1;
+constexpr std::size_t pointSize = 3 * sizeof(float);
+
+struct FileHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t reserved;
+    std::uint64_t ctTiles;
+    std::uint64_t ctPoints;
+    float box[6];
+    double matrix[16];
+    std::uint64_t reserved2;
+};
+
+struct TileEntry
+{
+    std::uint64_t offset;
+    std::uint64_t ctPoints;
+    float box[6];
+};
+
+static_assert(sizeof(FileHeader) == 192, "Unexpected padding");
+static_assert(sizeof(TileEntry) == 40, "Unexpected padding");
+
+void setBox(float* box, const Base::BoundBox3f& bbox)
+{
+    box[0] = bbox.MinX;
+    box[1] = bbox.MinY;
+    box[2] = bbox.MinZ;
+    box[3] = bbox.MaxX;
+    box[4] = bbox.MaxY;
+    box[5] = bbox.MaxZ;
+}
+
+Base::BoundBox3f getBox(const float* box)
+{
+    return Base::BoundBox3f(box[0], box[1], box[2], box[3], box[4], box[5]);
+}
+
+inline Base::Vector3f loadPoint(const char* data)
+{
+    float xyz[3];
+    std::memcpy(xyz, data, sizeof(xyz));
+    return Base::Vector3f(xyz[0], xyz[1], xyz[2]);
+}
+
+inline bool isValid(const Base::Vector3f& pnt)
+{
+    return !std::isnan(pnt.x) && !std::isnan(pnt.y) && !std::isnan(pnt.z);
+}
+
+// spreads the lower 21 bits of v so that there are two zero bits between two bits
+std::uint64_t spreadBits(std::uint64_t v)
+{
+    v &= 0x1fffff;
+    v = (v | (v << 32)) & 0x1f00000000ffffULL;
+    v = (v | (v << 16)) & 0x1f0000ff0000ffULL;
+    v = (v | (v << 8)) & 0x100f00f00f00f00fULL;
+    v = (v | (v << 4)) & 0x10c30c30c30c30c3ULL;
+    v = (v | (v << 2)) & 0x1249249249249249ULL;
+    return v;
+}
+
+std::uint64_t mortonCode(std::size_t x, std::size_t y, std::size_t z)
+{
+    return spreadBits(x) | (spreadBits(y) << 1) | (spreadBits(z) << 2);
+}
+
+/* Sorts the points into the cells of a regular grid and writes each non-empty cell as a tile.
+ * The points are processed in a fixed number of chunks. For each chunk the points per cell are
+ * counted first, which gives every chunk its own write position inside each tile so that the
+ * chunks can be scattered into the mapped output file concurrently and the points of a tile
+ * keep their original order. */
+class TileWriter
+{
+public:
+    TileWriter(const char* xyz, std::size_t count, std::size_t tileSize)
+        : xyz(xyz)
+        , count(count)
+        , tileSize(std::max<std::size_t>(tileSize, 1))
+    {
+        constexpr std::size_t maxChunks = 64;
+        constexpr std::size_t minChunkSize = 65536;
+        std::size_t numChunks = std::clamp<std::size_t>(count / minChunkSize, 1, maxChunks);
+        chunkSize = (count + numChunks - 1) / numChunks;
+        chunks.resize(count > 0 ? numChunks : 0);
+        std::iota(chunks.begin(), chunks.end(), 0);
+    }
+
+    bool write(const char* fileName, const Base::Matrix4D& mat)
+    {
+        computeGrid();
+        countCells();
+        sortCells();
+
+        FileHeader header {};
+        std::memcpy(header.magic, magic, sizeof(magic));
+        header.version = version;
+        header.ctTiles = tiles.size();
+        header.ctPoints = numValid;
+        setBox(header.box, box);
+        mat.getMatrix(header.matrix);
+
+        std::uint64_t dataOffset = sizeof(FileHeader) + tiles.size() * sizeof(TileEntry);
+        qint64 fileSize = qint64(dataOffset + numValid * pointSize);
+
+        QFile file(QString::fromUtf8(fileName));
+        if (!file.open(QIODevice::ReadWrite | QIODevice::Truncate) || !file.resize(fileSize)) {
+            return false;
+        }
+        uchar* data = file.map(0, fileSize);
+        if (!data) {
+            return false;
+        }
+
+        char* points = reinterpret_cast<char*>(data) + dataOffset;
+        scatter(points);
+
+        std::vector<TileEntry> entries(tiles.size());
+        std::vector<std::size_t> indices = chunkIndices(tiles.size());
+        QtConcurrent::blockingMap(indices, [&](std::size_t tile) {
+            TileEntry& entry = entries[tile];
+            entry.offset = dataOffset + tileFirst[tile] * pointSize;
+            entry.ctPoints = tileFirst[tile + 1] - tileFirst[tile];
+            Base::BoundBox3f bbox;
+            const char* pnt = points + tileFirst[tile] * pointSize;
+            for (std::uint64_t i = 0; i < entry.ctPoints; i++, pnt += pointSize) {
+                bbox.Add(loadPoint(pnt));
+            }
+            setBox(entry.box, bbox);
+        });
+
+        std::memcpy(data, &header, sizeof(header));
+        std::memcpy(data + sizeof(header), entries.data(), entries.size() * sizeof(TileEntry));
+        bool ok = file.unmap(data);
+        file.close();
+        return ok;
+    }
+
+private:
+    static std::vector<std::size_t> chunkIndices(std::size_t num)
+    {
+        std::vector<std::size_t> indices(num);
+        std::iota(indices.begin(), indices.end(), 0);
+        return indices;
+    }
+
+    std::pair<std::size_t, std::size_t> range(std::size_t chunk) const
+    {
+        std::size_t begin = chunk * chunkSize;
+        return {begin, std::min(begin + chunkSize, count)};
+    }
+
+    void computeGrid()
+    {
+        struct Bounds
+        {
+            Base::BoundBox3f box;
+            std::size_t valid {};
+        };
+        std::vector<Bounds> bounds = QtConcurrent::blockingMapped<std::vector<Bounds>>(
+            chunks,
+            [this](std::size_t chunk) {
+                Bounds result;
+                auto [begin, end] = range(chunk);
+                for (std::size_t i = begin; i < end; i++) {
+                    Base::Vector3f pnt = loadPoint(xyz + i * pointSize);
+                    if (isValid(pnt)) {
+                        result.box.Add(pnt);
+                        result.valid++;
+                    }
+                }
+                return result;
+            }
+        );
+        for (const auto& it : bounds) {
+            box.Add(it.box);
+            numValid += it.valid;
+        }
+
+        // cubic cells of a size that gives tileSize points per cell for uniformly spread points
+        std::array<float, 3> length {};
+        if (box.IsValid()) {
+            length = {box.LengthX(), box.LengthY(), box.LengthZ()};
+        }
+        double measure = 1.0;
+        int dimension = 0;
+        for (float len : length) {
+            if (len > 0.0F) {
+                measure *= len;
+                dimension++;
+            }
+        }
+
+        double numCells = std::max<double>(1.0, std::ceil(double(numValid) / double(tileSize)));
+        double edge = dimension > 0 ? std::pow(measure / numCells, 1.0 / dimension) : 1.0;
+        constexpr std::size_t maxCells = std::size_t(1) << 21;
+        for (std::size_t i = 0; i < 3; i++) {
+            if (length[i] > 0.0F) {
+                auto num = std::size_t(std::lround(length[i] / edge));
+                cells[i] = std::clamp<std::size_t>(num, 1, maxCells);
+                cellSize[i] = length[i] / float(cells[i]);
+            }
+        }
+    }
+
+    std::size_t cellOf(const Base::Vector3f& pnt) const
+    {
+        std::array<float, 3> offset {pnt.x - box.MinX, pnt.y - box.MinY, pnt.z - box.MinZ};
+        std::array<std::size_t, 3> ind {};
+        for (std::size_t i = 0; i < 3; i++) {
+            if (cellSize[i] > 0.0F) {
+                auto num = std::size_t(std::max(offset[i] / cellSize[i], 0.0F));
+                ind[i] = std::min(num, cells[i] - 1);
+            }
+        }
+        return (ind[2] * cells[1] + ind[1]) * cells[0] + ind[0];
+    }
+
+    void countCells()
+    {
+        std::size_t numCells = cells[0] * cells[1] * cells[2];
+        cursors = QtConcurrent::blockingMapped<std::vector<std::vector<std::uint64_t>>>(
+            chunks,
+            [this, numCells](std::size_t chunk) {
+                std::vector<std::uint64_t> counts(numCells);
+                auto [begin, end] = range(chunk);
+                for (std::size_t i = begin; i < end; i++) {
+                    Base::Vector3f pnt = loadPoint(xyz + i * pointSize);
+                    if (isValid(pnt)) {
+                        counts[cellOf(pnt)]++;
+                    }
+                }
+                return counts;
+            }
+        );
+    }
+
+    void sortCells()
+    {
+        // the non-empty cells in Z-order become the tiles
+        std::size_t numCells = cells[0] * cells[1] * cells[2];
+        std::vector<std::pair<std::uint64_t, std::size_t>> order;
+        for (std::size_t cell = 0; cell < numCells; cell++) {
+            std::uint64_t num = 0;
+            for (const auto& counts : cursors) {
+                num += counts[cell];
+            }
+            if (num > 0) {
+                std::size_t x = cell % cells[0];
+                std::size_t y = (cell / cells[0]) % cells[1];
+                std::size_t z = cell / (cells[0] * cells[1]);
+                order.emplace_back(mortonCode(x, y, z), cell);
+            }
+        }
+        std::ranges::sort(order);
+
+        // turn the counts into the write positions of each chunk
+        tileFirst.assign(1, 0);
+        std::uint64_t pos = 0;
+        for (const auto& it : order) {
+            tiles.push_back(it.second);
+            for (auto& counts : cursors) {
+                std::uint64_t num = counts[it.second];
+                counts[it.second] = pos;
+                pos += num;
+            }
+            tileFirst.push_back(pos);
+        }
+    }
+
+    void scatter(char* points)
+    {
+        QtConcurrent::blockingMap(chunks, [this, points](std::size_t chunk) {
+            std::vector<std::uint64_t>& cursor = cursors[chunk];
+            auto [begin, end] = range(chunk);
+            for (std::size_t i = begin; i < end; i++) {
+                const char* src = xyz + i * pointSize;
+                Base::Vector3f pnt = loadPoint(src);
+                if (isValid(pnt)) {
+                    std::memcpy(points + cursor[cellOf(pnt)]++ * pointSize, src, pointSize);
+                }
+            }
+        });
+    }
+
+private:
+    const char* xyz;
+    std::size_t count;
+    std::size_t tileSize;
+    std::size_t chunkSize {1};
+    std::vector<std::size_t> chunks;
+    std::size_t numValid {};
+    Base::BoundBox3f box;
+    std::array<std::size_t, 3> cells {1, 1, 1};
+    std::array<float, 3> cellSize {};
+    std::vector<std::vector<std::uint64_t>> cursors;
+    std::vector<std::size_t> tiles;
+    std::vector<std::uint64_t> tileFirst;
+};
+}  // namespace
+
+struct PointsOutOfCore::Private
+{
+    QFile file;
+    FileHeader header {};
+    std::vector<TileEntry> entries;
+    std::vector<TileInfo> infos;
+    std::size_t cachedTiles {};
+
+    // mapped tiles, the most recently used comes first
+    std::list<std::pair<std::size_t, uchar*>> cache;
+    std::mutex mutex;
+
+    // must be called with the locked mutex
+    const uchar* map(std::size_t tile)
+    {
+        for (auto it = cache.begin(); it != cache.end(); ++it) {
+            if (it->first == tile) {
+                cache.splice(cache.begin(), cache, it);
+                return it->second;
+            }
+        }
+
+        const TileEntry& entry = entries[tile];
+        qint64 size = qint64(pointSize * entry.ctPoints);
+        if (size == 0) {
+            return nullptr;
+        }
+        uchar* data = file.map(qint64(entry.offset), size);
+        if (!data) {
+            throw Base::FileException("Cannot map point tile into memory");
+        }
+
+        cache.emplace_front(tile, data);
+        while (cache.size() > cachedTiles) {
+            file.unmap(cache.back().second);
+            cache.pop_back();
+        }
+        return data;
+    }
+
+    void unmap()
+    {
+        for (const auto& it : cache) {
+            file.unmap(it.second);
+        }
+        cache.clear();
+    }
+};
+
+PointsOutOfCore::PointsOutOfCore(std::size_t cachedTiles)
+    : p(new Private)
+{
+    p->cachedTiles = std::max<std::size_t>(cachedTiles, 1);
+}
+
+PointsOutOfCore::~PointsOutOfCore()
+{
+    close();
+    delete p;
+}
+
+bool PointsOutOfCore::create(const PointKernel& kernel, const char* fileName, std::size_t tileSize)
+{
+    static_assert(sizeof(PointKernel::value_type) == pointSize, "Unexpected padding");
+    const std::vector<PointKernel::value_type>& points = kernel.getBasicPoints();
+    TileWriter writer(reinterpret_cast<const char*>(points.data()), points.size(), tileSize);
+    return writer.write(fileName, kernel.getTransform());
+}
+
+bool PointsOutOfCore::createFromAscii(
+    const char* ascFile,
+    const char* fileName,
+    std::size_t tileSize
+)
+{
+    // convert the text into a flat array of coordinates first that can be mapped again
+    Base::FileInfo tmp(std::string(fileName) + ".tmp");
+    {
+        MappedFile text(ascFile);
+        Base::ofstream str(tmp, std::ios::out | std::ios::binary);
+        std::vector<float> coords;
+        ChunkedReader::readAsciiPoints(text.data(), [&](const std::vector<Base::Vector3d>& pts) {
+            coords.clear();
+            for (const auto& pnt : pts) {
+                coords.push_back(float(pnt.x));
+                coords.push_back(float(pnt.y));
+                coords.push_back(float(pnt.z));
+            }
+            str.write(reinterpret_cast<const char*>(coords.data()), coords.size() * sizeof(float));
+        });
+        str.close();
+        if (str.fail()) {
+            tmp.deleteFile();
+            return false;
+        }
+    }
+
+    bool ok = false;
+    {
+        MappedFile raw(tmp.filePath());
+        TileWriter writer(raw.data().data(), raw.data().size() / pointSize, tileSize);
+        ok = writer.write(fileName, Base::Matrix4D());
+    }
+    tmp.deleteFile();
+    return ok;
+}
+
+bool PointsOutOfCore::open(const char* fileName)
+{
+    close();
+
+    p->file.setFileName(QString::fromUtf8(fileName));
+    if (!p->file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    FileHeader header {};
+    if (p->file.read(reinterpret_cast<char*>(&header), sizeof(header)) != qint64(sizeof(header))
+        || std::memcmp(header.magic, magic, sizeof(magic)) != 0 || header.version != version) {
+        p->file.close();
+        return false;
+    }
+
+    std::vector<TileEntry> entries(header.ctTiles);
+    qint64 tableSize = qint64(entries.size() * sizeof(TileEntry));
+    if (p->file.read(reinterpret_cast<char*>(entries.data()), tableSize) != tableSize) {
+        p->file.close();
+        return false;
+    }
+
+    p->header = header;
+    p->entries.swap(entries);
+    p->infos.clear();
+    p->infos.reserve(p->entries.size());
+    std::size_t first = 0;
+    for (const auto& entry : p->entries) {
+        p->infos.push_back(TileInfo {first, entry.ctPoints, getBox(entry.box)});
+        first += entry.ctPoints;
+    }
+    return true;
+}
+
+void PointsOutOfCore::close()
+{
+    std::lock_guard<std::mutex> lock(p->mutex);
+    p->unmap();
+    if (p->file.isOpen()) {
+        p->file.close();
+    }
+    p->entries.clear();
+    p->infos.clear();
+    p->header = FileHeader {};
+}
+
+bool PointsOutOfCore::isOpen() const
+{
+    return p->file.isOpen();
+}
+
+std::size_t PointsOutOfCore::countTiles() const
+{
+    return p->entries.size();
+}
+
+std::size_t PointsOutOfCore::countPoints() const
+{
+    return p->header.ctPoints;
+}
+
+Base::BoundBox3f PointsOutOfCore::getBoundBox() const
+{
+    if (p->entries.empty()) {
+        return Base::BoundBox3f();
+    }
+    return getBox(p->header.box);
+}
+
+Base::Matrix4D PointsOutOfCore::getTransform() const
+{
+    Base::Matrix4D mat;
+    if (isOpen()) {
+        mat.setMatrix(p->header.matrix);
+    }
+    return mat;
+}
+
+const PointsOutOfCore::TileInfo& PointsOutOfCore::getTileInfo(std::size_t tile) const
+{
+    return p->infos.at(tile);
+}
+
+std::vector<std::size_t> PointsOutOfCore::findTiles(const Base::BoundBox3f& box) const
+{
+    std::vector<std::size_t> tiles;
+    for (std::size_t i = 0; i < p->infos.size(); i++) {
+        if (p->infos[i].box.Intersect(box)) {
+            tiles.push_back(i);
+        }
+    }
+    return tiles;
+}
+
+void PointsOutOfCore::getTile(std::size_t tile, std::vector<Base::Vector3f>& points) const
+{
+    const TileEntry& entry = p->entries.at(tile);
+    points.resize(entry.ctPoints);
+
+    std::lock_guard<std::mutex> lock(p->mutex);
+    const char* data = reinterpret_cast<const char*>(p->map(tile));
+    for (std::size_t i = 0; i < points.size(); i++) {
+        points[i] = loadPoint(data + i * pointSize);
+    }
+}
+
+void PointsOutOfCore::getTile(std::size_t tile, PointKernel& kernel) const
+{
+    std::vector<Base::Vector3f> points;
+    getTile(tile, points);
+    kernel.swap(points);
+    kernel.setTransform(getTransform());
+}
+
+Base::Vector3f PointsOutOfCore::getPoint(std::size_t index) const
+{
+    auto it = std::ranges::upper_bound(p->infos, index, {}, &TileInfo::first);
+    if (it == p->infos.begin() || index >= countPoints()) {
+        throw Base::IndexError("Point index out of range");
+    }
+    std::size_t tile = std::size_t(std::distance(p->infos.begin(), it)) - 1;
+
+    std::lock_guard<std::mutex> lock(p->mutex);
+    const char* data = reinterpret_cast<const char*>(p->map(tile));
+    return loadPoint(data + (index - p->infos[tile].first) * pointSize);
+}
+
+void PointsOutOfCore::getSample(std::size_t maxPoints, PointKernel& kernel) const
+{
+    // take every n-th point of the whole cloud
+    std::vector<Base::Vector3f> points;
+    std::size_t total = countPoints();
+    if (total == 0 || maxPoints == 0) {
+        kernel.swap(points);
+        return;
+    }
+
+    std::size_t step = std::max<std::size_t>((total + maxPoints - 1) / maxPoints, 1);
+    points.reserve(std::min(total, maxPoints));
+    for (std::size_t tile = 0; tile < p->infos.size(); tile++) {
+        const TileInfo& info = p->infos[tile];
+        std::size_t index = ((info.first + step - 1) / step) * step;
+        if (index >= info.first + info.count) {
+            continue;
+        }
+
+        std::lock_guard<std::mutex> lock(p->mutex);
+        const char* data = reinterpret_cast<const char*>(p->map(tile));
+        for (; index < info.first + info.count; index += step) {
+            points.push_back(loadPoint(data + (index - info.first) * pointSize));
+        }
+    }
+
+    kernel.swap(points);
+    kernel.setTransform(getTransform());
+}
@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <Base/BoundBox.h>
+#include <Base/Matrix.h>
+#include <Base/Vector3D.h>
+
+#include <Mod/Points/PointsGlobal.h>
+
+
+namespace Points
+{
+class PointKernel;
+
+/**
+ * The PointsOutOfCore class gives access to point clouds that are too big to be kept in memory
+ * as a whole. The points are sorted into the cells of a regular grid and each non-empty cell is
+ * stored as a tile in a file. Tiles are ordered along a Z-order curve so that neighbouring tiles
+ * are close in the file.
+ *
+ * A tile is mapped into memory when it's accessed and kept in a cache of recently used tiles, so
+ * the memory usage is bounded by the tile and cache size and not by the size of the point cloud.
+ * A tile can be loaded into a PointKernel so that the usual algorithms like PointsGrid can be
+ * applied to it.
+ *
+ * The points are stored in the local coordinate system of the kernel they were created from,
+ * together with its transformation.
+ */
+class PointsExport PointsOutOfCore
+{
+public:
+    /// Default average count of points per tile
+    static constexpr std::size_t defaultTileSize = 1 << 20;
+
+    struct TileInfo
+    {
+        /// Index of the first point of the tile in the whole cloud
+        std::size_t first {};
+        std::size_t count {};
+        Base::BoundBox3f box;
+    };
+
+    /** Creates an instance that keeps at most \a cachedTiles tiles mapped. */
+    explicit PointsOutOfCore(std::size_t cachedTiles = 16);
+    ~PointsOutOfCore();
+
+    PointsOutOfCore(const PointsOutOfCore&) = delete;
+    PointsOutOfCore(PointsOutOfCore&&) = delete;
+    PointsOutOfCore& operator=(const PointsOutOfCore&) = delete;
+    PointsOutOfCore& operator=(PointsOutOfCore&&) = delete;
+
+    /** @name Creation */
+    //@{
+    /** Writes the points of \a kernel into the file \a fileName with about \a tileSize points
+     * per tile. Points with NaN coordinates are skipped. */
+    static bool create(
+        const PointKernel& kernel,
+        const char* fileName,
+        std::size_t tileSize = defaultTileSize
+    );
+    /** Converts the ASCII file \a ascFile into the file \a fileName with about \a tileSize points
+     * per tile. The points are streamed through a temporary file next to \a fileName so that
+     * this also works for files bigger than the main memory. */
+    static bool createFromAscii(
+        const char* ascFile,
+        const char* fileName,
+        std::size_t tileSize = defaultTileSize
+    );
+    //@}
+
+    /** @name Access */
+    //@{
+    /** Opens a file written by create() or createFromAscii(). */
+    bool open(const char* fileName);
+    void close();
+    bool isOpen() const;
+
+    std::size_t countTiles() const;
+    std::size_t countPoints() const;
+    Base::BoundBox3f getBoundBox() const;
+    Base::Matrix4D getTransform() const;
+    const TileInfo& getTileInfo(std::size_t tile) const;
+    /** Returns the tiles whose bounding box intersects \a box. */
+    std::vector<std::size_t> findTiles(const Base::BoundBox3f& box) const;
+
+    /** Reads the points of the tile \a tile. This method is thread-safe. */
+    void getTile(std::size_t tile, std::vector<Base::Vector3f>& points) const;
+    /** Loads the tile \a tile into \a kernel including the transformation. This method is
+     * thread-safe. */
+    void getTile(std::size_t tile, PointKernel& kernel) const;
+    /** Returns the point with the index \a index in the whole cloud, the indices of the points
+     * of a tile are consecutive. This method is thread-safe. */
+    Base::Vector3f getPoint(std::size_t index) const;
+    /** Loads about \a maxPoints points evenly taken from all tiles into \a kernel. */
+    void getSample(std::size_t maxPoints, PointKernel& kernel) const;
+    //@}
+
+private:
+    struct Private;
+    Private* p;
+};
+
+}  // namespace Points
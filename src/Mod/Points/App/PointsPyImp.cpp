@@ -28,6 +28,8 @@
 #include <Base/Builder3D.h>
 #include <Base/Converter.h>
 #include <Base/GeometryPyCXX.h>
+#include <Base/Interpreter.h>
+#include <Base/PyArrayBuffer.h>
 #include <Base/VectorPy.h>
 
 #include "Points.h"
@@ -107,7 +109,15 @@ PyObject* PointsPy::read(PyObject* args)
 
     PY_TRY
     {
-        getPointKernelPtr()->load(Name);
+        // Read into a local kernel so that this object is only modified with the GIL held
+        PointKernel kernel;
+        {
+            Base::PyGILStateRelease unlock;
+            kernel.load(Name);
+        }
+        std::vector<PointKernel::value_type> points;
+        kernel.swap(points);
+        getPointKernelPtr()->swap(points);
     }
     PY_CATCH;
 
@@ -123,6 +133,7 @@ PyObject* PointsPy::write(PyObject* args) const
 
     PY_TRY
     {
+        Base::PyGILStateRelease unlock;
         getPointKernelPtr()->save(Name);
     }
     PY_CATCH;
@@ -159,6 +170,21 @@ PyObject* PointsPy::addPoints(PyObject* args)
         return nullptr;
     }
 
+    if (PyObject_CheckBuffer(obj)) {
+        // an array of shape (n, 3), e.g. a NumPy array
+        Base::PyArrayReader array(obj, 3);
+        std::vector<double> coords = array.getValues<double>();
+        Base::Matrix4D mat = getPointKernelPtr()->getTransform();
+        mat.inverse();
+        std::vector<PointKernel::value_type>& points = getPointKernelPtr()->getBasicPoints();
+        points.reserve(points.size() + array.rows());
+        for (std::size_t i = 0; i < coords.size(); i += 3) {
+            Base::Vector3d pnt = mat * Base::Vector3d(coords[i], coords[i + 1], coords[i + 2]);
+            points.emplace_back(float(pnt.x), float(pnt.y), float(pnt.z));
+        }
+        Py_Return;
+    }
+
     try {
         Py::Sequence list(obj);
         Py::Type vType(Base::getTypeAsObject(&Base::VectorPy::Type));
@@ -183,7 +209,8 @@ PyObject* PointsPy::addPoints(PyObject* args)
             PyExc_TypeError,
             "either expect\n"
             "-- [Vector,...] \n"
-            "-- [(x,y,z),...]"
+            "-- [(x,y,z),...]\n"
+            "-- array of shape (n, 3)"
         );
         return nullptr;
     }
@@ -191,6 +218,26 @@ PyObject* PointsPy::addPoints(PyObject* args)
     Py_Return;
 }
 
+PyObject* PointsPy::getPointArray(PyObject* args) const
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    const PointKernel* kernel = getPointKernelPtr();
+    Base::Matrix4D mat = kernel->getTransform();
+    const std::vector<PointKernel::value_type>& points = kernel->getBasicPoints();
+    Base::PyArrayWriter<double> array(points.size(), 3);
+    double* coords = array.data();
+    for (const auto& it : points) {
+        Base::Vector3d pnt = mat * Base::Vector3d(it.x, it.y, it.z);
+        *coords++ = pnt.x;
+        *coords++ = pnt.y;
+        *coords++ = pnt.z;
+    }
+    return Py::new_reference_to(array.getView());
+}
+
 PyObject* PointsPy::fromSegment(PyObject* args) const
 {
     PyObject* obj {};
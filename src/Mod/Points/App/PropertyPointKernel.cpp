@@ -43,41 +43,72 @@ PropertyPointKernel::PropertyPointKernel()
     : _cPoints(new PointKernel())
 {}
 
+const PointKernel& PropertyPointKernel::kernel() const
+{
+    return _shared ? **_shared : *_cPoints;
+}
+
+void PropertyPointKernel::detach(bool overwrite)
+{
+    if (!_shared) {
+        return;
+    }
+    if (&**_shared == &*_cPoints) {
+        // keep the own kernel as it may be referenced from Python
+        if (_shared.use_count() > 1) {
+            Base::Reference<PointKernel> content(new PointKernel());
+            if (overwrite) {
+                *content = std::move(*_cPoints);
+            }
+            else {
+                *content = *_cPoints;
+            }
+            *_shared = content;
+        }
+    }
+    else if (!overwrite) {
+        *_cPoints = **_shared;
+    }
+    _shared.reset();
+}
+
 void PropertyPointKernel::setValue(const PointKernel& m)
 {
     aboutToSetValue();
+    detach(true);
     *_cPoints = m;
     hasSetValue();
 }
 
 const PointKernel& PropertyPointKernel::getValue() const
 {
-    return *_cPoints;
+    return kernel();
 }
 
 const Data::ComplexGeoData* PropertyPointKernel::getComplexData() const
 {
-    return _cPoints;
+    return &kernel();
 }
 
 void PropertyPointKernel::setTransform(const Base::Matrix4D& rclTrf)
 {
+    detach();
     _cPoints->setTransform(rclTrf);
 }
 
 Base::Matrix4D PropertyPointKernel::getTransform() const
 {
-    return _cPoints->getTransform();
+    return kernel().getTransform();
 }
 
 Base::BoundBox3d PropertyPointKernel::getBoundingBox() const
 {
-    return _cPoints->getBoundBox();
+    return kernel().getBoundBox();
 }
 
 PyObject* PropertyPointKernel::getPyObject()
 {
-    PointsPy* points = new PointsPy(&*_cPoints);
+    PointsPy* points = new PointsPy(const_cast<PointKernel*>(&kernel()));
     points->setConst();  // set immutable
     return points;
 }
@@ -97,7 +128,7 @@ void PropertyPointKernel::setPyObject(PyObject* value)
 
 void PropertyPointKernel::Save(Base::Writer& writer) const
 {
-    _cPoints->Save(writer);
+    kernel().Save(writer);
 }
 
 void PropertyPointKernel::Restore(Base::XMLReader& reader)
@@ -115,6 +146,7 @@ void PropertyPointKernel::Restore(Base::XMLReader& reader)
         mtrx.fromString(Matrix);
 
         aboutToSetValue();
+        detach();
         _cPoints->setTransform(mtrx);
         hasSetValue();
     }
@@ -129,14 +161,19 @@ void PropertyPointKernel::SaveDocFile(Base::Writer& writer) const
 void PropertyPointKernel::RestoreDocFile(Base::Reader& reader)
 {
     aboutToSetValue();
+    detach();
     _cPoints->RestoreDocFile(reader);
     hasSetValue();
 }
 
 App::Property* PropertyPointKernel::Copy() const
 {
+    // Share the kernel until the property or the copy gets modified
     PropertyPointKernel* prop = new PropertyPointKernel();
-    (*prop->_cPoints) = (*this->_cPoints);
+    if (!_shared) {
+        _shared = std::make_shared<Base::Reference<PointKernel>>(_cPoints);
+    }
+    prop->_shared = _shared;
     return prop;
 }
 
@@ -144,18 +181,23 @@ void PropertyPointKernel::Paste(const App::Property& from)
 {
     aboutToSetValue();
     const PropertyPointKernel& prop = dynamic_cast<const PropertyPointKernel&>(from);
-    *(this->_cPoints) = *(prop._cPoints);
+    // nothing to copy if the property has not been modified since the copy was made
+    if (!_shared || _shared != prop._shared) {
+        detach(true);
+        *(this->_cPoints) = prop.kernel();
+    }
     hasSetValue();
 }
 
 unsigned int PropertyPointKernel::getMemSize() const
 {
-    return sizeof(Base::Vector3f) * this->_cPoints->size();
+    return sizeof(Base::Vector3f) * kernel().size();
 }
 
 PointKernel* PropertyPointKernel::startEditing()
 {
     aboutToSetValue();
+    detach();
     return static_cast<PointKernel*>(_cPoints);
 }
 
@@ -170,18 +212,19 @@ void PropertyPointKernel::removeIndices(const std::vector<unsigned long>& uIndic
     std::vector<unsigned long> uSortedInds = uIndices;
     std::sort(uSortedInds.begin(), uSortedInds.end());
 
-    assert(uSortedInds.size() <= _cPoints->size());
-    if (uSortedInds.size() > _cPoints->size()) {
+    const PointKernel& points = this->kernel();
+    assert(uSortedInds.size() <= points.size());
+    if (uSortedInds.size() > points.size()) {
         return;
     }
 
     PointKernel kernel;
-    kernel.setTransform(_cPoints->getTransform());
-    kernel.reserve(_cPoints->size() - uSortedInds.size());
+    kernel.setTransform(points.getTransform());
+    kernel.reserve(points.size() - uSortedInds.size());
 
     std::vector<unsigned long>::iterator pos = uSortedInds.begin();
     unsigned long index = 0;
-    for (PointKernel::const_iterator it = _cPoints->begin(); it != _cPoints->end(); ++it, ++index) {
+    for (PointKernel::const_iterator it = points.begin(); it != points.end(); ++it, ++index) {
         if (pos == uSortedInds.end()) {
             kernel.push_back(*it);
         }
@@ -199,6 +242,7 @@ void PropertyPointKernel::removeIndices(const std::vector<unsigned long>& uIndic
 void PropertyPointKernel::transformGeometry(const Base::Matrix4D& rclMat)
 {
     aboutToSetValue();
+    detach();
     _cPoints->transformGeometry(rclMat);
     hasSetValue();
 }
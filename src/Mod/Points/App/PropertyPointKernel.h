@@ -25,6 +25,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include "Points.h"
 
 namespace Points
@@ -88,8 +90,17 @@ public:
     void removeIndices(const std::vector<unsigned long>&);
     //@}
 
+private:
+    const PointKernel& kernel() const;
+    /// Stop sharing the kernel with copies before modifying it, \a overwrite if the
+    /// content will be replaced completely
+    void detach(bool overwrite = false);
+
 private:
     Base::Reference<PointKernel> _cPoints;
+    /// The kernel shared with the copies made by Copy() until one of them gets modified.
+    /// The modified property owning the kernel hands its content over to the copies.
+    mutable std::shared_ptr<Base::Reference<PointKernel>> _shared;
 };
 
 }  // namespace Points
@@ -30,6 +30,7 @@
 #include <Gui/Language/Translator.h>
 #include <Mod/Points/App/PropertyPointKernel.h>
 
+#include "SoFCPointsLOD.h"
 #include "ViewProvider.h"
 #include "Workbench.h"
 
@@ -89,6 +90,7 @@ PyMOD_INIT_FUNC(PointsGui)
     CreatePointsCommands();
 
     // clang-format off
+    PointsGui::SoFCPointsLOD            ::initClass();
     PointsGui::ViewProviderPoints       ::init();
     PointsGui::ViewProviderScattered    ::init();
     PointsGui::ViewProviderStructured   ::init();
@@ -0,0 +1,230 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include <FCConfig.h>
+
+#include <algorithm>
+#ifdef FC_OS_WIN32
+# include <windows.h>
+#endif
+#ifdef FC_OS_MACOSX
+# include <OpenGL/gl.h>
+#else
+# include <GL/gl.h>
+#endif
+#include <Inventor/SbPlane.h>
+#include <Inventor/SbViewVolume.h>
+#include <Inventor/SbViewportRegion.h>
+#include <Inventor/SoPrimitiveVertex.h>
+#include <Inventor/actions/SoGLRenderAction.h>
+#include <Inventor/actions/SoGetPrimitiveCountAction.h>
+#include <Inventor/bundles/SoMaterialBundle.h>
+#include <Inventor/details/SoPointDetail.h>
+#include <Inventor/elements/SoCacheElement.h>
+#include <Inventor/elements/SoGLLazyElement.h>
+#include <Inventor/elements/SoLightModelElement.h>
+#include <Inventor/elements/SoMaterialBindingElement.h>
+#include <Inventor/elements/SoModelMatrixElement.h>
+#include <Inventor/elements/SoViewVolumeElement.h>
+#include <Inventor/elements/SoViewportRegionElement.h>
+#include <Inventor/misc/SoState.h>
+
+#include "SoFCPointsLOD.h"
+
+
+using namespace PointsGui;
+
+SO_NODE_SOURCE(SoFCPointsLOD)
+
+void SoFCPointsLOD::initClass()
+{
+    SO_NODE_INIT_CLASS(SoFCPointsLOD, SoShape, "Shape");
+}
+
+SoFCPointsLOD::SoFCPointsLOD()
+{
+    SO_NODE_CONSTRUCTOR(SoFCPointsLOD);
+    SO_NODE_ADD_FIELD(maxPixelSpacing, (1.5F));
+    SO_NODE_ADD_FIELD(pointBudget, (3000000));
+}
+
+SoFCPointsLOD::~SoFCPointsLOD() = default;
+
+void SoFCPointsLOD::setPoints(
+    const std::vector<Base::Vector3f>* pts,
+    std::shared_ptr<const Points::PointsOctree> tree
+)
+{
+    points = pts;
+    octree = std::move(tree);
+    rendered = 0;
+    touch();
+}
+
+/**
+ * Returns the view volume of the current camera in the coordinate system of the points.
+ */
+Points::PointsOctree::View SoFCPointsLOD::getView(SoState* state) const
+{
+    const SbViewVolume& vv = SoViewVolumeElement::get(state);
+    const SbViewportRegion& vp = SoViewportRegionElement::get(state);
+    SbMatrix toLocal = SoModelMatrixElement::get(state).inverse();
+
+    Points::PointsOctree::View view;
+
+    // the normals of the planes point into the view volume
+    SbPlane planes[6];
+    vv.getViewVolumePlanes(planes);
+    for (SbPlane& plane : planes) {
+        plane.transform(toLocal);
+        const SbVec3f& normal = plane.getNormal();
+        view.planes.emplace_back(
+            Base::Vector3f(normal[0], normal[1], normal[2]),
+            plane.getDistanceFromOrigin()
+        );
+    }
+
+    SbVec3f eye;
+    toLocal.multVecMatrix(vv.getProjectionPoint(), eye);
+    view.eye.Set(eye[0], eye[1], eye[2]);
+
+    // the view height at the distance 1 for a perspective view
+    view.perspective = vv.getProjectionType() == SbViewVolume::PERSPECTIVE;
+    float height = vv.getHeight();
+    if (view.perspective && vv.getNearDist() > 0.0F) {
+        height /= vv.getNearDist();
+    }
+    if (height > 0.0F) {
+        view.pixelScale = float(vp.getViewportSizePixels()[1]) / height;
+    }
+
+    return view;
+}
+
+void SoFCPointsLOD::GLRender(SoGLRenderAction* action)
+{
+    if (!points || !octree || !shouldGLRender(action)) {
+        return;
+    }
+
+    SoState* state = action->getState();
+
+    // the drawn nodes depend on the camera and thus must not be cached
+    SoCacheElement::invalidate(state);
+
+    std::vector<int> selection = octree->selectNodes(
+        getView(state),
+        maxPixelSpacing.getValue(),
+        std::size_t(std::max(pointBudget.getValue(), 0))
+    );
+
+    state->push();
+    SoLightModelElement::set(state, this, SoLightModelElement::BASE_COLOR);
+    SoMaterialBundle mb(action);
+    mb.sendFirst();
+
+    SoGLLazyElement* gl = SoGLLazyElement::getInstance(state);
+    const SbColor* colors = nullptr;
+    SoMaterialBindingElement::Binding binding = SoMaterialBindingElement::get(state);
+    if (binding == SoMaterialBindingElement::PER_VERTEX
+        || binding == SoMaterialBindingElement::PER_VERTEX_INDEXED) {
+        if (gl && std::size_t(gl->getNumDiffuse()) == points->size()) {
+            colors = gl->getDiffusePointer();
+        }
+    }
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glVertexPointer(3, GL_FLOAT, 0, points->data());
+    if (colors) {
+        glEnableClientState(GL_COLOR_ARRAY);
+        glColorPointer(3, GL_FLOAT, 0, colors);
+    }
+
+    // the points of a node are contiguous in the order of the octree
+    rendered = 0;
+    const auto& nodes = octree->getNodes();
+    const auto& order = octree->getOrder();
+    for (int index : selection) {
+        const Points::PointsOctree::Node& node = nodes[index];
+        glDrawElements(GL_POINTS, GLsizei(node.count), GL_UNSIGNED_INT, order.data() + node.begin);
+        rendered += node.count;
+    }
+
+    if (colors) {
+        glDisableClientState(GL_COLOR_ARRAY);
+        // the current color is unknown now
+        gl->reset(state, SoLazyElement::DIFFUSE_MASK);
+    }
+    glDisableClientState(GL_VERTEX_ARRAY);
+
+    state->pop();
+}
+
+/**
+ * Only the points owned by the root of the octree are used for picking.
+ */
+void SoFCPointsLOD::generatePrimitives(SoAction* action)
+{
+    if (!points || !octree || octree->getNodes().empty()) {
+        return;
+    }
+
+    const Points::PointsOctree::Node& root = octree->getNodes().front();
+    const auto& order = octree->getOrder();
+
+    SoPrimitiveVertex vertex;
+    SoPointDetail pointDetail;
+    vertex.setDetail(&pointDetail);
+
+    beginShape(action, POINTS);
+    for (std::size_t i = root.begin; i < root.begin + root.count; i++) {
+        const Base::Vector3f& pnt = (*points)[order[i]];
+        pointDetail.setCoordinateIndex(int32_t(order[i]));
+        vertex.setPoint(SbVec3f(pnt.x, pnt.y, pnt.z));
+        shapeVertex(&vertex);
+    }
+    endShape();
+}
+
+void SoFCPointsLOD::computeBBox(SoAction* /*action*/, SbBox3f& box, SbVec3f& center)
+{
+    if (octree && !octree->getNodes().empty()) {
+        const Base::BoundBox3f& bbox = octree->getNodes().front().box;
+        box.setBounds(SbVec3f(bbox.MinX, bbox.MinY, bbox.MinZ), SbVec3f(bbox.MaxX, bbox.MaxY, bbox.MaxZ));
+        Base::Vector3f mid = bbox.GetCenter();
+        center.setValue(mid.x, mid.y, mid.z);
+    }
+    else {
+        box.setBounds(SbVec3f(0, 0, 0), SbVec3f(0, 0, 0));
+        center.setValue(0.0F, 0.0F, 0.0F);
+    }
+}
+
+void SoFCPointsLOD::getPrimitiveCount(SoGetPrimitiveCountAction* action)
+{
+    if (!this->shouldPrimitiveCount(action)) {
+        return;
+    }
+    action->addNumPoints(int(rendered));
+}
@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <Inventor/fields/SoSFFloat.h>
+#include <Inventor/fields/SoSFInt32.h>
+#include <Inventor/nodes/SoShape.h>
+
+#include <Mod/Points/App/PointsOctree.h>
+#include <Mod/Points/PointsGlobal.h>
+
+
+namespace PointsGui
+{
+
+/**
+ * The SoFCPointsLOD class renders large point clouds with the help of a Points::PointsOctree.
+ *
+ * For each frame only the octree nodes inside the view volume are drawn, and of these only
+ * as many levels until the distance of the points on the screen falls below maxPixelSpacing.
+ * In total at most pointBudget points are drawn.
+ *
+ * The points are drawn with the current material. If there is a diffuse color per point and
+ * the material binding is per vertex, the colors are used.
+ */
+class PointsGuiExport SoFCPointsLOD: public SoShape
+{
+    using inherited = SoShape;
+
+    SO_NODE_HEADER(SoFCPointsLOD);
+
+public:
+    static void initClass();
+    SoFCPointsLOD();
+
+    SoSFFloat maxPixelSpacing;  // NOLINT
+    SoSFInt32 pointBudget;      // NOLINT
+
+    /** Sets the points and their octree. The points must outlive this node or be reset. */
+    void setPoints(
+        const std::vector<Base::Vector3f>* points,
+        std::shared_ptr<const Points::PointsOctree> octree
+    );
+    /** Returns the number of points drawn in the last frame. */
+    std::size_t countRenderedPoints() const
+    {
+        return rendered;
+    }
+
+protected:
+    void GLRender(SoGLRenderAction* action) override;
+    void computeBBox(SoAction* action, SbBox3f& box, SbVec3f& center) override;
+    void getPrimitiveCount(SoGetPrimitiveCountAction* action) override;
+    void generatePrimitives(SoAction* action) override;
+    // Force using the reference count mechanism.
+    ~SoFCPointsLOD() override;
+
+private:
+    Points::PointsOctree::View getView(SoState* state) const;
+
+private:
+    const std::vector<Base::Vector3f>* points {nullptr};
+    std::shared_ptr<const Points::PointsOctree> octree;
+    std::size_t rendered {0};
+};
+
+}  // namespace PointsGui
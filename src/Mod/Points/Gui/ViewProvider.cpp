@@ -42,9 +42,12 @@
 #include <Gui/Document.h>
 #include <Gui/Selection/SoFCSelection.h>
 #include <Gui/View3DInventorViewer.h>
+#include <Gui/Window.h>
 #include <Mod/Points/App/PointsFeature.h>
+#include <Mod/Points/App/PointsOctree.h>
 #include <Mod/Points/App/Properties.h>
 
+#include "SoFCPointsLOD.h"
 #include "ViewProvider.h"
 
 
@@ -374,11 +377,14 @@ ViewProviderScattered::ViewProviderScattered()
 {
     pcPoints = new SoPointSet();
     pcPoints->ref();
+    pcPointsLOD = new SoFCPointsLOD();
+    pcPointsLOD->ref();
 }
 
 ViewProviderScattered::~ViewProviderScattered()
 {
     pcPoints->unref();
+    pcPointsLOD->unref();
 }
 
 void ViewProviderScattered::attach(App::DocumentObject* pcObj)
@@ -393,6 +399,7 @@ void ViewProviderScattered::attach(App::DocumentObject* pcObj)
     // Highlight for selection
     pcHighlight->addChild(pcPointsCoord);
     pcHighlight->addChild(pcPoints);
+    pcHighlight->addChild(pcPointsLOD);
 
     std::vector<std::string> modes = getDisplayModes();
 
@@ -431,8 +438,25 @@ void ViewProviderScattered::updateData(const App::Property* prop)
 {
     ViewProviderPoints::updateData(prop);
     if (prop->is<Points::PropertyPointKernel>()) {
-        ViewProviderPointsBuilder builder;
-        builder.createPoints(prop, pcPointsCoord, pcPoints);
+        const Points::PointKernel& kernel
+            = static_cast<const Points::PropertyPointKernel*>(prop)->getValue();
+        Base::Reference<ParameterGrp> hGrp = Gui::WindowParameter::getDefaultParameter()->GetGroup(
+            "Mod/Points"
+        );
+        long limit = hGrp->GetInt("LevelOfDetailLimit", 5000000);
+        if (limit > 0 && kernel.size() > std::size_t(limit)) {
+            // too many points to draw all of them each frame
+            pcPointsCoord->point.setNum(0);
+            pcPoints->numPoints = 0;
+            pcPointsLOD->pointBudget = int(hGrp->GetInt("LevelOfDetailBudget", 3000000));
+            const std::vector<Base::Vector3f>& points = kernel.getBasicPoints();
+            pcPointsLOD->setPoints(&points, std::make_shared<Points::PointsOctree>(points));
+        }
+        else {
+            pcPointsLOD->setPoints(nullptr, nullptr);
+            ViewProviderPointsBuilder builder;
+            builder.createPoints(prop, pcPointsCoord, pcPoints);
+        }
 
         // The number of points might have changed, so force also a resize of the Inventor internals
         setActiveMode();
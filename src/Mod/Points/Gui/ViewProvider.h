@@ -61,6 +61,8 @@ class Feature;
 namespace PointsGui
 {
 
+class SoFCPointsLOD;
+
 class ViewProviderPointsBuilder: public Gui::ViewProviderBuilder
 {
 public:
@@ -121,6 +123,8 @@ private:
 /**
  * The ViewProviderScattered class creates
  * a node representing the scattered point cloud.
+ * Clouds with more points than the parameter Mod/Points/LevelOfDetailLimit
+ * are drawn with a level-of-detail octree, see SoFCPointsLOD.
  * @author Werner Mayer
  */
 class PointsGuiExport ViewProviderScattered: public ViewProviderPoints
@@ -144,6 +148,7 @@ protected:
 
 protected:
     SoPointSet* pcPoints;
+    SoFCPointsLOD* pcPointsLOD;
 };
 
 /**
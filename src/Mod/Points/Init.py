@@ -27,4 +27,5 @@
 
 # Append the open handler
 FreeCAD.addImportType("Point formats (*.asc *.ASC *.pcd *.PCD *.ply *.PLY *.e57 *.E57)", "Points")
+FreeCAD.addImportType("Tiled point cloud (*.fcpt *.FCPT)", "Points")
 FreeCAD.addExportType("Point formats (*.asc *.pcd *.ply)", "Points")
@@ -124,11 +124,14 @@ public:
         add_keyword_method("filterVoxelGrid",&Module::filterVoxelGrid,
             "filterVoxelGrid(dim)."
         );
+#endif
         add_keyword_method("normalEstimation",&Module::normalEstimation,
             "normalEstimation(Points,[KSearch=0, SearchRadius=0]) -> Normals\n"
             "KSearch is an int and used to search the k-nearest neighbours in\n"
             "the k-d tree. Alternatively, SearchRadius (a float) can be used\n"
-            "as spatial distance to determine the neighbours of a point\n"
+            "as spatial distance to determine the neighbours of a point.\n"
+            "If both are given the k-nearest neighbours within SearchRadius\n"
+            "are used. The normals are estimated in parallel.\n"
             "Example:\n"
             "\n"
             "import ReverseEngineering as Reen\n"
@@ -142,7 +145,6 @@ public:
             "f.ViewObject.Proxy=0\n"
             "f.ViewObject.DisplayMode=1\n"
         );
-#endif
 #if defined(HAVE_PCL_SEGMENTATION)
         add_keyword_method("regionGrowingSegmentation",&Module::regionGrowingSegmentation,
             "regionGrowingSegmentation()."
@@ -155,6 +157,15 @@ public:
         add_keyword_method("sampleConsensus",&Module::sampleConsensus,
             "sampleConsensus()."
         );
+        add_keyword_method("detectShapes",&Module::detectShapes,
+            "detectShapes(Points,[SacModels=('Plane','Cylinder','Sphere'), Normals=None,\n"
+            "             MinInliers=100, MaxShapes=10, Threshold=0.01]) -> list\n"
+            "Detects several shapes in one run. In each round all models are fitted\n"
+            "in parallel to the remaining points and the model with most inliers\n"
+            "is taken. Each shape is returned as a dict like by sampleConsensus()\n"
+            "with the additional key 'SacModel'. If no normals are given but needed\n"
+            "they are estimated."
+        );
 #endif
         initialize("This module is the ReverseEngineering module."); // register with Python
     }
@@ -793,7 +804,6 @@ Mesh.show(m)
         return Py::asObject(new Points::PointsPy(points_sample));
     }
 #endif
-#if defined(HAVE_PCL_FILTERS)
     Py::Object normalEstimation(const Py::Tuple& args, const Py::Dict& kwds)
     {
         PyObject *pts;
@@ -821,7 +831,6 @@ Mesh.show(m)
 
         return list;
     }
-#endif
 #if defined(HAVE_PCL_SEGMENTATION)
     Py::Object regionGrowingSegmentation(const Py::Tuple& args, const Py::Dict& kwds)
     {
@@ -946,15 +955,7 @@ Points.show(np)
             }
         }
 
-        SampleConsensus::SacModel sacModel = SampleConsensus::SACMODEL_PLANE;
-        if (sacModelType) {
-            if (strcmp(sacModelType, "Cylinder") == 0)
-                sacModel = SampleConsensus::SACMODEL_CYLINDER;
-            else if (strcmp(sacModelType, "Sphere") == 0)
-                sacModel = SampleConsensus::SACMODEL_SPHERE;
-            else if (strcmp(sacModelType, "Cone") == 0)
-                sacModel = SampleConsensus::SACMODEL_CONE;
-        }
+        SampleConsensus::SacModel sacModel = getSacModel(sacModelType);
 
         std::vector<float> parameters;
         SampleConsensus sample(sacModel, *points, normals);
@@ -974,6 +975,101 @@ Points.show(np)
 
         return dict;
     }
+    Py::Object detectShapes(const Py::Tuple& args, const Py::Dict& kwds)
+    {
+        PyObject *pts;
+        PyObject *types = nullptr;
+        PyObject *vec = nullptr;
+        int minInliers = 100;
+        int maxShapes = 10;
+        double threshold = 0.01;
+
+        static const std::array<const char*,7> kwds_detect {"Points", "SacModels", "Normals",
+            "MinInliers", "MaxShapes", "Threshold", NULL};
+        if (!Base::Wrapped_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "O!|OOiid", kwds_detect,
+                                        &(Points::PointsPy::Type), &pts, &types, &vec,
+                                        &minInliers, &maxShapes, &threshold))
+            throw Py::Exception();
+
+        std::vector<SampleConsensus::SacModel> models;
+        if (types && types != Py_None) {
+            Py::Sequence list(types);
+            for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
+                std::string name = Py::String(*it).as_std_string();
+                models.push_back(getSacModel(name.c_str()));
+            }
+        }
+        else {
+            models = {SampleConsensus::SACMODEL_PLANE,
+                      SampleConsensus::SACMODEL_CYLINDER,
+                      SampleConsensus::SACMODEL_SPHERE};
+        }
+
+        Points::PointKernel* points = static_cast<Points::PointsPy*>(pts)->getPointKernelPtr();
+        std::vector<Base::Vector3d> normals;
+        if (vec && vec != Py_None) {
+            Py::Sequence list(vec);
+            normals.reserve(list.size());
+            for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
+                normals.push_back(Py::Vector(*it).toVector());
+            }
+        }
+
+        std::vector<SampleConsensus::Shape> shapes;
+        try {
+            SampleConsensus sample(SampleConsensus::SACMODEL_PLANE, *points, normals);
+            shapes = sample.detect(models, std::size_t(std::max(minInliers, 0)),
+                                   std::size_t(std::max(maxShapes, 0)), threshold);
+        }
+        catch (const Base::Exception& e) {
+            throw Py::RuntimeError(e.what());
+        }
+
+        Py::List list;
+        for (const auto& shape : shapes) {
+            Py::Tuple tuple(shape.parameters.size());
+            for (std::size_t i = 0; i < shape.parameters.size(); i++)
+                tuple.setItem(i, Py::Float(shape.parameters[i]));
+            Py::Tuple data(shape.inliers.size());
+            for (std::size_t i = 0; i < shape.inliers.size(); i++)
+                data.setItem(i, Py::Long(shape.inliers[i]));
+
+            Py::Dict dict;
+            dict.setItem(Py::String("SacModel"), Py::String(getSacModelName(shape.model)));
+            dict.setItem(Py::String("Probability"), Py::Float(shape.probability));
+            dict.setItem(Py::String("Parameters"), tuple);
+            dict.setItem(Py::String("Model"), data);
+            list.append(dict);
+        }
+
+        return list;
+    }
+    static SampleConsensus::SacModel getSacModel(const char* sacModelType)
+    {
+        SampleConsensus::SacModel sacModel = SampleConsensus::SACMODEL_PLANE;
+        if (sacModelType) {
+            if (strcmp(sacModelType, "Cylinder") == 0)
+                sacModel = SampleConsensus::SACMODEL_CYLINDER;
+            else if (strcmp(sacModelType, "Sphere") == 0)
+                sacModel = SampleConsensus::SACMODEL_SPHERE;
+            else if (strcmp(sacModelType, "Cone") == 0)
+                sacModel = SampleConsensus::SACMODEL_CONE;
+        }
+        return sacModel;
+    }
+    static const char* getSacModelName(SampleConsensus::SacModel sacModel)
+    {
+        switch (sacModel) {
+            case SampleConsensus::SACMODEL_CYLINDER:
+                return "Cylinder";
+            case SampleConsensus::SACMODEL_SPHERE:
+                return "Sphere";
+            case SampleConsensus::SACMODEL_CONE:
+                return "Cone";
+            default:
+                return "Plane";
+        }
+    }
 #endif
 };
 
@@ -22,14 +22,16 @@
  *                                                                         *
  ***************************************************************************/
 
-#include <QFuture>
-#include <QFutureWatcher>
+#include <algorithm>
+
+#include <QThread>
 #include <QtConcurrentMap>
 
+#include <Eigen/IterativeLinearSolvers>
+#include <Eigen/SparseCholesky>
+
 #include <Geom_BSplineSurface.hxx>
 #include <Precision.hxx>
-#include <math_Gauss.hxx>
-#include <math_Householder.hxx>
 
 #include <Base/Sequencer.h>
 #include <Base/Tools.h>
@@ -39,7 +41,6 @@
 
 
 using namespace Reen;
-namespace sp = std::placeholders;
 
 // SplineBasisfunction
 
@@ -966,311 +967,370 @@ void BSplineParameterCorrection::SetVKnots(const std::vector<double>& afKnots)
     _clVSpline.SetKnots(_vVKnots, _vVMults, _usVOrder);
 }
 
-void BSplineParameterCorrection::DoParameterCorrection(int iIter)
+namespace Reen
 {
-    int i = 0;
-    double fMaxDiff = 0.0, fMaxScalar = 1.0;
-    double fWeight = _fSmoothInfluence;
-
-    Base::SequencerLauncher seq(
-        "Calc surface...",
-        static_cast<size_t>(iIter) * static_cast<size_t>(_pvcPoints->Length())
-    );
+/**
+ * Splits the index range [lower, upper] into roughly equal blocks, one per thread, for the
+ * point loops that run in parallel.
+ */
+static std::vector<std::pair<int, int>> MakeBlocks(int lower, int upper)
+{
+    const int numPoints = upper - lower + 1;
+    const int minBlockSize = 1024;
+    int numBlocks = std::max(1, QThread::idealThreadCount());
+    numBlocks = std::max(1, std::min(numBlocks, numPoints / minBlockSize));
+
+    std::vector<std::pair<int, int>> blocks;
+    blocks.reserve(numBlocks);
+    for (int i = 0; i < numBlocks; i++) {
+        int begin = lower + static_cast<int>(static_cast<long long>(numPoints) * i / numBlocks);
+        int end = lower + static_cast<int>(static_cast<long long>(numPoints) * (i + 1) / numBlocks);
+        blocks.emplace_back(begin, end);
+    }
+    return blocks;
+}
 
-    do {
-        fMaxScalar = 1.0;
-        fMaxDiff = 0.0;
+/**
+ * Assembles the normal equations N^T*N*X = N^T*P of the least-squares fit in sparse form.
+ * At a point only the uOrder x vOrder basis functions of the span containing its (u,v)
+ * parameters don't vanish, so each control point only couples to its
+ * (2*uOrder-1) x (2*vOrder-1) neighbours. Blocks of points are accumulated in parallel
+ * into banded partial matrices which are summed up afterwards.
+ */
+class NormalEquations
+{
+public:
+    using SparseMatrix = Eigen::SparseMatrix<double>;
+
+    NormalEquations(
+        BSplineBasis& uSpline,
+        BSplineBasis& vSpline,
+        unsigned uOrder,
+        unsigned vOrder,
+        unsigned uCtrlpoints,
+        unsigned vCtrlpoints
+    )
+        : uSpline(uSpline)
+        , vSpline(vSpline)
+        , uOrder(static_cast<int>(uOrder))
+        , vOrder(static_cast<int>(vOrder))
+        , uCtrlpoints(static_cast<int>(uCtrlpoints))
+        , vCtrlpoints(static_cast<int>(vCtrlpoints))
+        , bandWidth((2 * this->vOrder - 1))
+        , bandSize((2 * this->uOrder - 1) * (2 * this->vOrder - 1))
+    {}
 
-        Handle(Geom_BSplineSurface) pclBSplineSurf = new Geom_BSplineSurface(
-            _vCtrlPntsOfSurf,
-            _vUKnots,
-            _vVKnots,
-            _vUMults,
-            _vVMults,
-            _usUOrder - 1,
-            _usVOrder - 1
+    void compute(const TColgp_Array1OfPnt& points, const TColgp_Array1OfPnt2d& uvParams)
+    {
+        std::vector<std::pair<int, int>> blocks = MakeBlocks(points.Lower(), points.Upper());
+        std::vector<Partial> partials = QtConcurrent::blockingMapped<std::vector<Partial>>(
+            blocks,
+            [&](const std::pair<int, int>& block) {
+                return accumulate(points, uvParams, block.first, block.second);
+            }
         );
 
-        for (int ii = _pvcPoints->Lower(); ii <= _pvcPoints->Upper(); ii++) {
-            double fDeltaU, fDeltaV, fU, fV;
-            const gp_Pnt& pnt = (*_pvcPoints)(ii);
-            gp_Vec P(pnt.X(), pnt.Y(), pnt.Z());
-            gp_Pnt PntX;
-            gp_Vec Xu, Xv, Xuv, Xuu, Xvv;
-            // Calculate the first two derivatives and point at (u,v)
-            gp_Pnt2d& uvValue = (*_pvcUVParam)(ii);
-            pclBSplineSurf->D2(uvValue.X(), uvValue.Y(), PntX, Xu, Xv, Xuu, Xvv, Xuv);
-            gp_Vec X(PntX.X(), PntX.Y(), PntX.Z());
-            gp_Vec ErrorVec = X - P;
-
-            // Calculate Xu x Xv the normal in X(u,v)
-            gp_Dir clNormal = Xu ^ Xv;
-
-            // Check, if X = P
-            if (!(X.IsEqual(P, 0.001, 0.001))) {
-                ErrorVec.Normalize();
-                if (fabs(clNormal * ErrorVec) < fMaxScalar) {
-                    fMaxScalar = fabs(clNormal * ErrorVec);
-                }
+        band = std::move(partials.front().band);
+        rhs = std::move(partials.front().rhs);
+        for (std::size_t i = 1; i < partials.size(); i++) {
+            const std::vector<double>& other = partials[i].band;
+            for (std::size_t j = 0; j < band.size(); j++) {
+                band[j] += other[j];
             }
+            rhs += partials[i].rhs;
+        }
+    }
 
-            fDeltaU = ((P - X) * Xu) / ((P - X) * Xuu - Xu * Xu);
-            if (fabs(fDeltaU) < Precision::Confusion()) {
-                fDeltaU = 0.0;
-            }
-            fDeltaV = ((P - X) * Xv) / ((P - X) * Xvv - Xv * Xv);
-            if (fabs(fDeltaV) < Precision::Confusion()) {
-                fDeltaV = 0.0;
+    /**
+     * Returns N^T*N + fWeight * smooth. The smoothing matrix is stored densely but most
+     * of its entries vanish, so only the non-zero ones are transferred.
+     */
+    SparseMatrix getMatrix(double fWeight, const math_Matrix* smooth) const
+    {
+        const int dim = uCtrlpoints * vCtrlpoints;
+        std::vector<Eigen::Triplet<double>> triplets;
+        triplets.reserve(band.size());
+        for (int row = 0; row < dim; row++) {
+            int i = row / vCtrlpoints;
+            int j = row % vCtrlpoints;
+            for (int du = 1 - uOrder; du < uOrder; du++) {
+                for (int dv = 1 - vOrder; dv < vOrder; dv++) {
+                    double value = band[bandIndex(row, du, dv)];
+                    if (value != 0.0) {
+                        int col = (i + du) * vCtrlpoints + (j + dv);
+                        triplets.emplace_back(row, col, value);
+                    }
+                }
             }
+        }
 
-            // Replace old u/v values with new ones
-            fU = uvValue.X() - fDeltaU;
-            fV = uvValue.Y() - fDeltaV;
-            if (fU <= 1.0 && fU >= 0.0 && fV <= 1.0 && fV >= 0.0) {
-                uvValue.SetX(fU);
-                uvValue.SetY(fV);
-                fMaxDiff = std::max<double>(fabs(fDeltaU), fMaxDiff);
-                fMaxDiff = std::max<double>(fabs(fDeltaV), fMaxDiff);
+        if (smooth && fWeight != 0.0) {
+            for (int row = 0; row < dim; row++) {
+                for (int col = 0; col < dim; col++) {
+                    double value = (*smooth)(row, col);
+                    if (value != 0.0) {
+                        triplets.emplace_back(row, col, fWeight * value);
+                    }
+                }
             }
-
-            seq.next();
         }
 
-        if (_bSmoothing) {
-            fWeight *= 0.5f;
-            SolveWithSmoothing(fWeight);
-        }
-        else {
-            SolveWithoutSmoothing();
-        }
+        SparseMatrix mat(dim, dim);
+        mat.setFromTriplets(triplets.begin(), triplets.end());
+        return mat;
+    }
 
-        i++;
-    } while (i < iIter && fMaxDiff > Precision::Confusion() && fMaxScalar < 0.99);
-}
+    const Eigen::MatrixX3d& getRightHandSide() const
+    {
+        return rhs;
+    }
 
-bool BSplineParameterCorrection::SolveWithoutSmoothing()
-{
-    unsigned ulSize = _pvcPoints->Length();
-    unsigned ulDim = _usUCtrlpoints * _usVCtrlpoints;
-    math_Matrix M(0, ulSize - 1, 0, ulDim - 1);
-    math_Matrix Xx(0, ulDim - 1, 0, 0);
-    math_Matrix Xy(0, ulDim - 1, 0, 0);
-    math_Matrix Xz(0, ulDim - 1, 0, 0);
-    math_Vector bx(0, ulSize - 1);
-    math_Vector by(0, ulSize - 1);
-    math_Vector bz(0, ulSize - 1);
-
-    // Determining the coefficient matrix of the overdetermined LGS
-    for (unsigned i = 0; i < ulSize; i++) {
-        const gp_Pnt2d& uvValue = (*_pvcUVParam)(i);
-        double fU = uvValue.X();
-        double fV = uvValue.Y();
-        unsigned ulIdx = 0;
-
-        // Pre-calculation of the values of the base functions
-        std::vector<double> basisU(_usUCtrlpoints);
-        for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-            basisU[j] = _clUSpline.BasisFunction(j, fU);
-        }
-        std::vector<double> basisV(_usVCtrlpoints);
-        for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-            basisV[k] = _clVSpline.BasisFunction(k, fV);
-        }
+private:
+    struct Partial
+    {
+        std::vector<double> band;
+        Eigen::MatrixX3d rhs;
+    };
+
+    int bandIndex(int row, int du, int dv) const
+    {
+        return row * bandSize + (du + uOrder - 1) * bandWidth + (dv + vOrder - 1);
+    }
 
-        for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-            double valueU = basisU[j];
-            if (valueU == 0.0) {
-                for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-                    M(i, ulIdx) = 0.0;
-                    ulIdx++;
+    Partial accumulate(
+        const TColgp_Array1OfPnt& points,
+        const TColgp_Array1OfPnt2d& uvParams,
+        int begin,
+        int end
+    ) const
+    {
+        const int dim = uCtrlpoints * vCtrlpoints;
+        Partial partial;
+        partial.band.resize(static_cast<std::size_t>(dim) * bandSize, 0.0);
+        partial.rhs.setZero(dim, 3);
+
+        TColStd_Array1OfReal basisU(0, uOrder - 1);
+        TColStd_Array1OfReal basisV(0, vOrder - 1);
+        std::vector<double> weights(static_cast<std::size_t>(uOrder) * vOrder);
+
+        for (int ii = begin; ii < end; ii++) {
+            const gp_Pnt2d& uvValue = uvParams(ii);
+            double fU = std::clamp(uvValue.X(), 0.0, 1.0);
+            double fV = std::clamp(uvValue.Y(), 0.0, 1.0);
+
+            int firstU = uSpline.FindSpan(fU) - (uOrder - 1);
+            int firstV = vSpline.FindSpan(fV) - (vOrder - 1);
+            uSpline.AllBasisFunctions(fU, basisU);
+            vSpline.AllBasisFunctions(fV, basisV);
+
+            for (int a = 0; a < uOrder; a++) {
+                for (int b = 0; b < vOrder; b++) {
+                    weights[a * vOrder + b] = basisU(a) * basisV(b);
                 }
             }
-            else {
-                for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-                    M(i, ulIdx) = valueU * basisV[k];
-                    ulIdx++;
+
+            const gp_Pnt& pnt = points(ii);
+            Eigen::RowVector3d P(pnt.X(), pnt.Y(), pnt.Z());
+            for (int a = 0; a < uOrder; a++) {
+                for (int b = 0; b < vOrder; b++) {
+                    double wab = weights[a * vOrder + b];
+                    if (wab == 0.0) {
+                        continue;
+                    }
+
+                    int row = (firstU + a) * vCtrlpoints + (firstV + b);
+                    partial.rhs.row(row) += wab * P;
+                    double* line = &partial.band[bandIndex(row, 0, 0)];
+                    for (int c = 0; c < uOrder; c++) {
+                        for (int d = 0; d < vOrder; d++) {
+                            line[(c - a) * bandWidth + (d - b)] += wab * weights[c * vOrder + d];
+                        }
+                    }
                 }
             }
         }
-    }
 
-    // Determine the right side
-    for (int ii = _pvcPoints->Lower(); ii <= _pvcPoints->Upper(); ii++) {
-        const gp_Pnt& pnt = (*_pvcPoints)(ii);
-        bx(ii) = pnt.X();
-        by(ii) = pnt.Y();
-        bz(ii) = pnt.Z();
+        return partial;
     }
 
-    // Solve the over-determined LGS with Householder-Transformation
-    math_Householder hhX(M, bx);
-    math_Householder hhY(M, by);
-    math_Householder hhZ(M, bz);
+private:
+    // FindSpan() and AllBasisFunctions() only read the knot vector
+    BSplineBasis& uSpline;
+    BSplineBasis& vSpline;
+    int uOrder, vOrder;
+    int uCtrlpoints, vCtrlpoints;
+    int bandWidth, bandSize;
+    std::vector<double> band;
+    Eigen::MatrixX3d rhs;
+};
 
-    if (!(hhX.IsDone() && hhY.IsDone() && hhZ.IsDone())) {
-        // LGS could not be solved
-        return false;
+/**
+ * Solves the symmetric system with a sparse LDL^T decomposition. If the matrix is (nearly)
+ * singular, e.g. because some control points aren't influenced by any point, the conjugate
+ * gradient method is used instead which starts from the current control points in @a x so
+ * that uncoupled control points keep their position.
+ */
+static bool SolveSparse(
+    const NormalEquations::SparseMatrix& A,
+    const Eigen::MatrixX3d& b,
+    Eigen::MatrixX3d& x
+)
+{
+    Eigen::SimplicialLDLT<NormalEquations::SparseMatrix> ldlt(A);
+    if (ldlt.info() == Eigen::Success) {
+        const auto& diag = ldlt.vectorD();
+        double maxPivot = diag.cwiseAbs().maxCoeff();
+        if (diag.minCoeff() > maxPivot * 1e-12) {
+            Eigen::MatrixX3d sol = ldlt.solve(b);
+            if (ldlt.info() == Eigen::Success && sol.allFinite()) {
+                x = sol;
+                return true;
+            }
+        }
     }
-    Xx = hhX.AllValues();
-    Xy = hhY.AllValues();
-    Xz = hhZ.AllValues();
 
-    unsigned ulIdx = 0;
-    for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-        for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-            _vCtrlPntsOfSurf(j, k) = gp_Pnt(Xx(ulIdx, 0), Xy(ulIdx, 0), Xz(ulIdx, 0));
-            ulIdx++;
-        }
+    Eigen::ConjugateGradient<NormalEquations::SparseMatrix, Eigen::Lower | Eigen::Upper> cg(A);
+    cg.setTolerance(1e-10);
+    Eigen::MatrixX3d sol = cg.solveWithGuess(b, x);
+    if (cg.info() != Eigen::Success || !sol.allFinite()) {
+        return false;
     }
 
+    x = sol;
     return true;
 }
+}  // namespace Reen
 
-namespace Reen
-{
-class ScalarProduct
+void BSplineParameterCorrection::DoParameterCorrection(int iIter)
 {
-public:
-    explicit ScalarProduct(const math_Matrix& mat)
-        : mat(mat)
-    {}
-    std::vector<double> multiply(int col) const
+    struct Correction
     {
-        math_Vector vec = mat.Col(col);
-        std::vector<double> out(mat.ColNumber());
-        for (int n = mat.LowerCol(); n <= mat.UpperCol(); n++) {
-            out[n] = vec * mat.Col(n);
-        }
-        return out;
-    }
+        double fMaxDiff = 0.0;
+        double fMaxScalar = 1.0;
+    };
 
-private:
-    const math_Matrix& mat;
-};
-}  // namespace Reen
+    int i = 0;
+    double fMaxDiff = 0.0, fMaxScalar = 1.0;
+    double fWeight = _fSmoothInfluence;
 
-bool BSplineParameterCorrection::SolveWithSmoothing(double fWeight)
-{
-    unsigned ulSize = _pvcPoints->Length();
-    unsigned ulDim = _usUCtrlpoints * _usVCtrlpoints;
-    math_Matrix M(0, ulSize - 1, 0, ulDim - 1);
-    math_Vector Xx(0, ulDim - 1);
-    math_Vector Xy(0, ulDim - 1);
-    math_Vector Xz(0, ulDim - 1);
-    math_Vector bx(0, ulSize - 1);
-    math_Vector by(0, ulSize - 1);
-    math_Vector bz(0, ulSize - 1);
-    math_Vector Mbx(0, ulDim - 1);
-    math_Vector Mby(0, ulDim - 1);
-    math_Vector Mbz(0, ulDim - 1);
-
-    // Determining the coefficient matrix of the overdetermined LGS
-    for (unsigned i = 0; i < ulSize; i++) {
-        const gp_Pnt2d& uvValue = (*_pvcUVParam)(i);
-        double fU = uvValue.X();
-        double fV = uvValue.Y();
-        int ulIdx = 0;
-
-        // Pre-calculation of the values of the basis functions
-        std::vector<double> basisU(_usUCtrlpoints);
-        for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-            basisU[j] = _clUSpline.BasisFunction(j, fU);
-        }
-        std::vector<double> basisV(_usVCtrlpoints);
-        for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-            basisV[k] = _clVSpline.BasisFunction(k, fV);
-        }
+    Base::SequencerLauncher seq("Calc surface...", static_cast<size_t>(iIter));
 
-        for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-            double valueU = basisU[j];
-            if (valueU == 0.0) {
-                for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-                    M(i, ulIdx) = 0.0;
-                    ulIdx++;
-                }
-            }
-            else {
-                for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-                    M(i, ulIdx) = valueU * basisV[k];
-                    ulIdx++;
+    std::vector<std::pair<int, int>> blocks = MakeBlocks(_pvcPoints->Lower(), _pvcPoints->Upper());
+
+    do {
+        Handle(Geom_BSplineSurface) pclBSplineSurf = new Geom_BSplineSurface(
+            _vCtrlPntsOfSurf,
+            _vUKnots,
+            _vVKnots,
+            _vUMults,
+            _vVMults,
+            _usUOrder - 1,
+            _usVOrder - 1
+        );
+
+        // The surface is only evaluated and each block writes its own (u,v) parameters
+        std::vector<Correction> corrections = QtConcurrent::blockingMapped<std::vector<Correction>>(
+            blocks,
+            [&](const std::pair<int, int>& block) {
+                Correction corr;
+                for (int ii = block.first; ii < block.second; ii++) {
+                    double fDeltaU, fDeltaV, fU, fV;
+                    const gp_Pnt& pnt = (*_pvcPoints)(ii);
+                    gp_Vec P(pnt.X(), pnt.Y(), pnt.Z());
+                    gp_Pnt PntX;
+                    gp_Vec Xu, Xv, Xuv, Xuu, Xvv;
+                    // Calculate the first two derivatives and point at (u,v)
+                    gp_Pnt2d& uvValue = (*_pvcUVParam)(ii);
+                    pclBSplineSurf->D2(uvValue.X(), uvValue.Y(), PntX, Xu, Xv, Xuu, Xvv, Xuv);
+                    gp_Vec X(PntX.X(), PntX.Y(), PntX.Z());
+                    gp_Vec ErrorVec = X - P;
+
+                    // Calculate Xu x Xv the normal in X(u,v)
+                    gp_Dir clNormal = Xu ^ Xv;
+
+                    // Check, if X = P
+                    if (!(X.IsEqual(P, 0.001, 0.001))) {
+                        ErrorVec.Normalize();
+                        if (fabs(clNormal * ErrorVec) < corr.fMaxScalar) {
+                            corr.fMaxScalar = fabs(clNormal * ErrorVec);
+                        }
+                    }
+
+                    fDeltaU = ((P - X) * Xu) / ((P - X) * Xuu - Xu * Xu);
+                    if (fabs(fDeltaU) < Precision::Confusion()) {
+                        fDeltaU = 0.0;
+                    }
+                    fDeltaV = ((P - X) * Xv) / ((P - X) * Xvv - Xv * Xv);
+                    if (fabs(fDeltaV) < Precision::Confusion()) {
+                        fDeltaV = 0.0;
+                    }
+
+                    // Replace old u/v values with new ones
+                    fU = uvValue.X() - fDeltaU;
+                    fV = uvValue.Y() - fDeltaV;
+                    if (fU <= 1.0 && fU >= 0.0 && fV <= 1.0 && fV >= 0.0) {
+                        uvValue.SetX(fU);
+                        uvValue.SetY(fV);
+                        corr.fMaxDiff = std::max<double>(fabs(fDeltaU), corr.fMaxDiff);
+                        corr.fMaxDiff = std::max<double>(fabs(fDeltaV), corr.fMaxDiff);
+                    }
                 }
+                return corr;
             }
+        );
+
+        fMaxScalar = 1.0;
+        fMaxDiff = 0.0;
+        for (const auto& it : corrections) {
+            fMaxScalar = std::min<double>(it.fMaxScalar, fMaxScalar);
+            fMaxDiff = std::max<double>(it.fMaxDiff, fMaxDiff);
         }
-    }
 
-    // The product of its transform and itself results in the quadratic
-    // system matrix (slowly)
-#if 0
-    math_Matrix MTM = M.TMultiply(M);
-#elif 0
-    math_Matrix MTM(0, ulDim - 1, 0, ulDim - 1);
-    for (unsigned m = 0; m < ulDim; m++) {
-        math_Vector Mm = M.Col(m);
-        for (unsigned n = m; n < ulDim; n++) {
-            MTM(m, n) = MTM(n, m) = Mm * M.Col(n);
+        if (_bSmoothing) {
+            fWeight *= 0.5f;
+            SolveWithSmoothing(fWeight);
         }
-    }
-#else  // multi-threaded
-    std::vector<int> columns(ulDim);
-    std::generate(columns.begin(), columns.end(), Base::iotaGen<int>(0));
-    ScalarProduct scalar(M);
-    // NOLINTBEGIN
-    QFuture<std::vector<double>> future
-        = QtConcurrent::mapped(columns, std::bind(&ScalarProduct::multiply, &scalar, sp::_1));
-    // NOLINTEND
-    QFutureWatcher<std::vector<double>> watcher;
-    watcher.setFuture(future);
-    watcher.waitForFinished();
-
-    math_Matrix MTM(0, ulDim - 1, 0, ulDim - 1);
-    int rowIndex = 0;
-    for (const auto& it : future) {
-        int colIndex = 0;
-        for (std::vector<double>::const_iterator jt = it.begin(); jt != it.end(); ++jt, colIndex++) {
-            MTM(rowIndex, colIndex) = *jt;
+        else {
+            SolveWithoutSmoothing();
         }
-        rowIndex++;
-    }
-#endif
 
-    // Determine the right side
-    for (int ii = _pvcPoints->Lower(); ii <= _pvcPoints->Upper(); ii++) {
-        const gp_Pnt& pnt = (*_pvcPoints)(ii);
-        bx(ii) = pnt.X();
-        by(ii) = pnt.Y();
-        bz(ii) = pnt.Z();
-    }
-    for (unsigned i = 0; i < ulDim; i++) {
-        math_Vector Mi = M.Col(i);
-        Mbx(i) = Mi * bx;
-        Mby(i) = Mi * by;
-        Mbz(i) = Mi * bz;
-    }
-
-    // Solve the LGS with the LU decomposition
-    math_Gauss mgGaussX(MTM + fWeight * _clSmoothMatrix);
-    math_Gauss mgGaussY(MTM + fWeight * _clSmoothMatrix);
-    math_Gauss mgGaussZ(MTM + fWeight * _clSmoothMatrix);
+        seq.next();
+        i++;
+    } while (i < iIter && fMaxDiff > Precision::Confusion() && fMaxScalar < 0.99);
+}
 
-    mgGaussX.Solve(Mbx, Xx);
-    if (!mgGaussX.IsDone()) {
-        return false;
-    }
+bool BSplineParameterCorrection::SolveSparseSystem(double fWeight, const math_Matrix* smooth)
+{
+    NormalEquations normal(
+        _clUSpline,
+        _clVSpline,
+        _usUOrder,
+        _usVOrder,
+        _usUCtrlpoints,
+        _usVCtrlpoints
+    );
+    normal.compute(*_pvcPoints, *_pvcUVParam);
 
-    mgGaussY.Solve(Mby, Xy);
-    if (!mgGaussY.IsDone()) {
-        return false;
+    // Start from the current control points
+    Eigen::MatrixX3d X(_usUCtrlpoints * _usVCtrlpoints, 3);
+    unsigned ulIdx = 0;
+    for (unsigned j = 0; j < _usUCtrlpoints; j++) {
+        for (unsigned k = 0; k < _usVCtrlpoints; k++) {
+            const gp_Pnt& pnt = _vCtrlPntsOfSurf(j, k);
+            X.row(ulIdx) = Eigen::RowVector3d(pnt.X(), pnt.Y(), pnt.Z());
+            ulIdx++;
+        }
     }
 
-    mgGaussZ.Solve(Mbz, Xz);
-    if (!mgGaussZ.IsDone()) {
+    if (!SolveSparse(normal.getMatrix(fWeight, smooth), normal.getRightHandSide(), X)) {
+        // LGS could not be solved
         return false;
     }
 
-    unsigned ulIdx = 0;
+    ulIdx = 0;
     for (unsigned j = 0; j < _usUCtrlpoints; j++) {
         for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-            _vCtrlPntsOfSurf(j, k) = gp_Pnt(Xx(ulIdx), Xy(ulIdx), Xz(ulIdx));
+            _vCtrlPntsOfSurf(j, k) = gp_Pnt(X(ulIdx, 0), X(ulIdx, 1), X(ulIdx, 2));
             ulIdx++;
         }
     }
@@ -1278,6 +1338,16 @@ bool BSplineParameterCorrection::SolveWithSmoothing(double fWeight)
     return true;
 }
 
+bool BSplineParameterCorrection::SolveWithoutSmoothing()
+{
+    return SolveSparseSystem(0.0, nullptr);
+}
+
+bool BSplineParameterCorrection::SolveWithSmoothing(double fWeight)
+{
+    return SolveSparseSystem(fWeight, &_clSmoothMatrix);
+}
+
 void BSplineParameterCorrection::CalcSmoothingTerms(bool bRecalc, double fFirst, double fSecond, double fThird)
 {
     if (bRecalc) {
@@ -413,16 +413,21 @@ protected:
     void DoParameterCorrection(int iIter) override;
 
     /**
-     * Solve an overdetermined LGS with the help of the Householder-Tansformation
+     * Solve the overdetermined LGS in the least-squares sense via its sparse normal equations
      */
     bool SolveWithoutSmoothing() override;
 
     /**
-     * Solve a regular system of equations by LU decomposition. Depending on the weighting,
-     * smoothing terms are included
+     * Solve the sparse normal equations. Depending on the weighting, smoothing terms are included
      */
     bool SolveWithSmoothing(double fWeight) override;
 
+    /**
+     * Assembles the sparse normal equations in parallel, adds the weighted smoothing matrix
+     * if given and solves the system with a sparse Cholesky decomposition.
+     */
+    bool SolveSparseSystem(double fWeight, const math_Matrix* smooth);
+
 public:
     /**
      * Setting the knot vector
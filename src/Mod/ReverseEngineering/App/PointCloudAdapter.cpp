@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+
+
+#include <Mod/Mesh/App/Core/Neighbourhood.h>
+#include <Mod/Points/App/Points.h>
+
+
+#if defined(HAVE_PCL_SEGMENTATION) || defined(HAVE_PCL_SAMPLE_CONSENSUS)
+# include "PointCloudAdapter.h"
+
+using namespace Reen;
+
+PointCloudAdapter::PointCloudAdapter(const Points::PointKernel& kernel)
+    : cloud(new pcl::PointCloud<pcl::PointXYZ>)
+{
+    const std::vector<Base::Vector3f>& points = kernel.getBasicPoints();
+    indices.reserve(points.size());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        const Base::Vector3f& p = points[i];
+        if (!std::isnan(p.x) && !std::isnan(p.y) && !std::isnan(p.z)) {
+            indices.push_back(int(i));
+        }
+    }
+
+    // every chunk writes its own range of the cloud
+    cloud->resize(indices.size());
+    MeshCore::ParallelChunks(indices.size(), 65536, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            Base::Vector3d p = kernel.getPoint(indices[i]);
+            (*cloud)[i] = pcl::PointXYZ(float(p.x), float(p.y), float(p.z));
+        }
+    });
+    cloud->width = std::uint32_t(cloud->size());
+    cloud->height = 1;
+    cloud->is_dense = true;
+}
+
+void PointCloudAdapter::toKernelIndices(std::vector<int>& values) const
+{
+    for (int& it : values) {
+        it = indices[it];
+    }
+}
+
+pcl::PointCloud<pcl::Normal>::Ptr PointCloudAdapter::estimateNormals(int ksearch, double radius) const
+{
+    std::vector<Base::Vector3f> points;
+    points.reserve(cloud->size());
+    for (const auto& it : *cloud) {
+        points.emplace_back(it.x, it.y, it.z);
+    }
+
+    MeshCore::MeshPointNeighbourhood neighbourhood(points);
+    std::vector<Base::Vector3f> normals
+        = neighbourhood.EstimateNormals(std::size_t(std::max(ksearch, 0)), float(radius));
+
+    pcl::PointCloud<pcl::Normal>::Ptr result(new pcl::PointCloud<pcl::Normal>);
+    result->resize(normals.size());
+    for (std::size_t i = 0; i < normals.size(); i++) {
+        (*result)[i] = pcl::Normal(normals[i].x, normals[i].y, normals[i].z);
+    }
+    return result;
+}
+
+#endif  // HAVE_PCL_SEGMENTATION || HAVE_PCL_SAMPLE_CONSENSUS
@@ -0,0 +1,88 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#pragma once
+
+#include <vector>
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <Base/Vector3D.h>
+
+
+namespace Points
+{
+class PointKernel;
+}
+
+namespace Reen
+{
+
+/**
+ * The PointCloudAdapter class converts a point kernel once into a PCL cloud so that the same
+ * cloud can be shared by the normal estimation, the search tree and the segmentation algorithms
+ * of one run. Points with NaN coordinates are skipped, getIndices() maps the points of the cloud
+ * back to the kernel. The cloud is allocated at once and filled in parallel.
+ */
+class PointCloudAdapter
+{
+public:
+    explicit PointCloudAdapter(const Points::PointKernel&);
+
+    pcl::PointCloud<pcl::PointXYZ>::Ptr getCloud() const
+    {
+        return cloud;
+    }
+    /** Returns for each point of the cloud its index in the kernel. */
+    const std::vector<int>& getIndices() const
+    {
+        return indices;
+    }
+    /** Replaces the cloud indices in \a values by the corresponding kernel indices. */
+    void toKernelIndices(std::vector<int>& values) const;
+
+    /** Takes the normals of the valid points from \a normals that must have one normal per
+     * point of the kernel. */
+    template<typename Vec>
+    pcl::PointCloud<pcl::Normal>::Ptr getNormals(const std::vector<Vec>& normals) const
+    {
+        pcl::PointCloud<pcl::Normal>::Ptr result(new pcl::PointCloud<pcl::Normal>);
+        result->resize(indices.size());
+        for (std::size_t i = 0; i < indices.size(); i++) {
+            const Vec& n = normals[indices[i]];
+            (*result)[i] = pcl::Normal(float(n.x), float(n.y), float(n.z));
+        }
+        return result;
+    }
+    /** Estimates the normals of the cloud in parallel from the \a ksearch nearest neighbours or
+     * the neighbours within \a radius. The normals are oriented towards the origin. */
+    pcl::PointCloud<pcl::Normal>::Ptr estimateNormals(int ksearch, double radius) const;
+
+private:
+    pcl::PointCloud<pcl::PointXYZ>::Ptr cloud;
+    std::vector<int> indices;
+};
+
+}  // namespace Reen
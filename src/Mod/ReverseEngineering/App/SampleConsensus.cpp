@@ -22,17 +22,18 @@
  *                                                                         *
  ***************************************************************************/
 
-#include <boost/math/special_functions/fpclassify.hpp>
+#include <algorithm>
+#include <numeric>
 
 
 #include <Base/Exception.h>
+#include <Mod/Mesh/App/Core/Neighbourhood.h>
 #include <Mod/Points/App/Points.h>
 
 #include "SampleConsensus.h"
 
 
 #if defined(HAVE_PCL_SAMPLE_CONSENSUS)
-# include <pcl/features/normal_3d.h>
 # include <pcl/point_types.h>
 # include <pcl/sample_consensus/ransac.h>
 # include <pcl/sample_consensus/sac_model_cone.h>
@@ -40,86 +41,77 @@
 # include <pcl/sample_consensus/sac_model_plane.h>
 # include <pcl/sample_consensus/sac_model_sphere.h>
 
+# include "PointCloudAdapter.h"
+
 using namespace std;
 using namespace Reen;
 using pcl::PointCloud;
 using pcl::PointNormal;
 using pcl::PointXYZ;
 
-SampleConsensus::SampleConsensus(
-    SacModel sac,
-    const Points::PointKernel& pts,
-    const std::vector<Base::Vector3d>& nor
-)
-    : mySac(sac)
-    , myPoints(pts)
-    , myNormals(nor)
-{}
+namespace
+{
+bool needsNormals(SampleConsensus::SacModel sac)
+{
+    return sac == SampleConsensus::SACMODEL_CONE || sac == SampleConsensus::SACMODEL_CYLINDER;
+}
 
-double SampleConsensus::perform(std::vector<float>& parameters, std::vector<int>& model)
+bool isSupported(SampleConsensus::SacModel sac)
 {
-    pcl::PointCloud<pcl::PointXYZ>::Ptr cloud(new pcl::PointCloud<pcl::PointXYZ>);
-    cloud->reserve(myPoints.size());
-    for (Points::PointKernel::const_iterator it = myPoints.begin(); it != myPoints.end(); ++it) {
-        if (!boost::math::isnan(it->x) && !boost::math::isnan(it->y) && !boost::math::isnan(it->z)) {
-            cloud->push_back(pcl::PointXYZ(it->x, it->y, it->z));
-        }
+    switch (sac) {
+        case SampleConsensus::SACMODEL_PLANE:
+        case SampleConsensus::SACMODEL_SPHERE:
+        case SampleConsensus::SACMODEL_CONE:
+        case SampleConsensus::SACMODEL_CYLINDER:
+            return true;
+        default:
+            return false;
     }
+}
 
-    cloud->width = int(cloud->points.size());
-    cloud->height = 1;
-    cloud->is_dense = true;
-
-    pcl::PointCloud<pcl::Normal>::Ptr normals(new pcl::PointCloud<pcl::Normal>());
-    if (mySac == SACMODEL_CONE || mySac == SACMODEL_CYLINDER) {
-# if 0
-        // Create search tree
-        pcl::search::KdTree<pcl::PointXYZ>::Ptr tree;
-        tree.reset (new pcl::search::KdTree<PointXYZ> (false));
-        tree->setInputCloud (cloud);
-
-        // Normal estimation
-        int ksearch = 10;
-        pcl::NormalEstimation<pcl::PointXYZ, pcl::Normal> n;
-        n.setInputCloud (cloud);
-        n.setSearchMethod (tree);
-        n.setKSearch (ksearch);
-        n.compute (*normals);
-# else
-        normals->reserve(myNormals.size());
-        for (std::vector<Base::Vector3d>::const_iterator it = myNormals.begin();
-             it != myNormals.end();
-             ++it) {
-            if (!boost::math::isnan(it->x) && !boost::math::isnan(it->y)
-                && !boost::math::isnan(it->z)) {
-                normals->push_back(pcl::Normal(it->x, it->y, it->z));
-            }
-        }
-# endif
+// If indices is given the model is only fitted to these points of the cloud
+template<typename Model>
+typename Model::Ptr createModel(
+    const pcl::PointCloud<pcl::PointXYZ>::Ptr& cloud,
+    const std::vector<int>* indices
+)
+{
+    if (indices) {
+        return typename Model::Ptr(new Model(cloud, *indices));
     }
+    return typename Model::Ptr(new Model(cloud));
+}
 
+SampleConsensus::Shape fitModel(
+    SampleConsensus::SacModel sac,
+    const pcl::PointCloud<pcl::PointXYZ>::Ptr& cloud,
+    const std::vector<int>* indices,
+    const pcl::PointCloud<pcl::Normal>::Ptr& normals,
+    double threshold
+)
+{
     // created RandomSampleConsensus object and compute the appropriated model
     pcl::SampleConsensusModel<pcl::PointXYZ>::Ptr model_p;
-    switch (mySac) {
-        case SACMODEL_PLANE: {
-            model_p.reset(new pcl::SampleConsensusModelPlane<pcl::PointXYZ>(cloud));
+    switch (sac) {
+        case SampleConsensus::SACMODEL_PLANE: {
+            model_p = createModel<pcl::SampleConsensusModelPlane<pcl::PointXYZ>>(cloud, indices);
             break;
         }
-        case SACMODEL_SPHERE: {
-            model_p.reset(new pcl::SampleConsensusModelSphere<pcl::PointXYZ>(cloud));
+        case SampleConsensus::SACMODEL_SPHERE: {
+            model_p = createModel<pcl::SampleConsensusModelSphere<pcl::PointXYZ>>(cloud, indices);
             break;
         }
-        case SACMODEL_CONE: {
-            pcl::SampleConsensusModelCone<pcl::PointXYZ, pcl::Normal>::Ptr model_c(
-                new pcl::SampleConsensusModelCone<pcl::PointXYZ, pcl::Normal>(cloud)
-            );
+        case SampleConsensus::SACMODEL_CONE: {
+            auto model_c
+                = createModel<pcl::SampleConsensusModelCone<pcl::PointXYZ, pcl::Normal>>(cloud, indices);
             model_c->setInputNormals(normals);
             model_p = model_c;
             break;
         }
-        case SACMODEL_CYLINDER: {
-            pcl::SampleConsensusModelCylinder<pcl::PointXYZ, pcl::Normal>::Ptr model_c(
-                new pcl::SampleConsensusModelCylinder<pcl::PointXYZ, pcl::Normal>(cloud)
+        case SampleConsensus::SACMODEL_CYLINDER: {
+            auto model_c = createModel<pcl::SampleConsensusModelCylinder<pcl::PointXYZ, pcl::Normal>>(
+                cloud,
+                indices
             );
             model_c->setInputNormals(normals);
             model_p = model_c;
@@ -129,18 +121,99 @@ double SampleConsensus::perform(std::vector<float>& parameters, std::vector<int>
             throw Base::RuntimeError("Unsupported SAC model");
     }
 
+    SampleConsensus::Shape shape {sac, 0.0, {}, {}};
     pcl::RandomSampleConsensus<pcl::PointXYZ> ransac(model_p);
-    ransac.setDistanceThreshold(.01);
+    ransac.setDistanceThreshold(threshold);
     ransac.computeModel();
-    ransac.getInliers(model);
+    ransac.getInliers(shape.inliers);
     // ransac.getModel (model);
     Eigen::VectorXf model_p_coefficients;
     ransac.getModelCoefficients(model_p_coefficients);
     for (int i = 0; i < model_p_coefficients.size(); i++) {
-        parameters.push_back(model_p_coefficients[i]);
+        shape.parameters.push_back(model_p_coefficients[i]);
+    }
+    shape.probability = ransac.getProbability();
+    return shape;
+}
+}  // namespace
+
+SampleConsensus::SampleConsensus(
+    SacModel sac,
+    const Points::PointKernel& pts,
+    const std::vector<Base::Vector3d>& nor
+)
+    : mySac(sac)
+    , myPoints(pts)
+    , myNormals(nor)
+{}
+
+double SampleConsensus::perform(std::vector<float>& parameters, std::vector<int>& model)
+{
+    PointCloudAdapter adapter(myPoints);
+
+    pcl::PointCloud<pcl::Normal>::Ptr normals;
+    if (needsNormals(mySac)) {
+        normals = myNormals.size() == myPoints.size() ? adapter.getNormals(myNormals)
+                                                      : adapter.estimateNormals(10, 0.0);
+    }
+
+    Shape shape = fitModel(mySac, adapter.getCloud(), nullptr, normals, 0.01);
+    adapter.toKernelIndices(shape.inliers);
+    model.swap(shape.inliers);
+    parameters.insert(parameters.end(), shape.parameters.begin(), shape.parameters.end());
+    return shape.probability;
+}
+
+std::vector<SampleConsensus::Shape> SampleConsensus::detect(
+    const std::vector<SacModel>& models,
+    std::size_t minInliers,
+    std::size_t maxShapes,
+    double threshold
+)
+{
+    if (!std::ranges::all_of(models, isSupported)) {
+        throw Base::RuntimeError("Unsupported SAC model");
+    }
+
+    // the cloud and the normals are shared by all models and rounds
+    PointCloudAdapter adapter(myPoints);
+    pcl::PointCloud<pcl::Normal>::Ptr normals;
+    if (std::ranges::any_of(models, needsNormals)) {
+        normals = myNormals.size() == myPoints.size() ? adapter.getNormals(myNormals)
+                                                      : adapter.estimateNormals(10, 0.0);
+    }
+
+    std::vector<int> remaining(adapter.getIndices().size());
+    std::iota(remaining.begin(), remaining.end(), 0);
+
+    std::vector<Shape> shapes;
+    while (shapes.size() < maxShapes && remaining.size() >= std::max<std::size_t>(minInliers, 1)) {
+        // each model has its own random generator, so they can be fitted at the same time
+        std::vector<Shape> fits(models.size());
+        MeshCore::ParallelChunks(models.size(), 1, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                fits[i] = fitModel(models[i], adapter.getCloud(), &remaining, normals, threshold);
+            }
+        });
+
+        auto best = std::ranges::max_element(fits, {}, [](const Shape& shape) {
+            return shape.inliers.size();
+        });
+        if (best == fits.end() || best->inliers.empty() || best->inliers.size() < minInliers) {
+            break;
+        }
+
+        std::vector<int> inliers = best->inliers;
+        std::ranges::sort(inliers);
+        std::erase_if(remaining, [&inliers](int index) {
+            return std::ranges::binary_search(inliers, index);
+        });
+
+        adapter.toKernelIndices(best->inliers);
+        shapes.push_back(std::move(*best));
     }
 
-    return ransac.getProbability();
+    return shapes;
 }
 
 #endif  // HAVE_PCL_SAMPLE_CONSENSUS
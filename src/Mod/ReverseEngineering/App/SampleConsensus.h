@@ -51,8 +51,32 @@ public:
         SACMODEL_CONE,
         SACMODEL_TORUS,
     };
+    /// A shape found by detect()
+    struct Shape
+    {
+        SacModel model;
+        double probability;
+        std::vector<float> parameters;
+        std::vector<int> inliers;
+    };
+
+    /** If no normals are passed but the model needs them they are estimated in parallel. */
     SampleConsensus(SacModel sac, const Points::PointKernel&, const std::vector<Base::Vector3d>&);
+    /** Fits the model to all points. The indices of the inliers refer to the point kernel. */
     double perform(std::vector<float>& parameters, std::vector<int>& model);
+    /**
+     * Detects several shapes of the given \a models in one run. In each round all models are
+     * fitted in parallel to the points not yet assigned, the model with most inliers is taken
+     * and its inliers are removed. This stops after \a maxShapes shapes or if no model has at
+     * least \a minInliers inliers within the distance \a threshold. The model given in the
+     * constructor is ignored.
+     */
+    std::vector<Shape> detect(
+        const std::vector<SacModel>& models,
+        std::size_t minInliers,
+        std::size_t maxShapes,
+        double threshold
+    );
 
 private:
     SacModel mySac;
@@ -23,6 +23,9 @@
  ***************************************************************************/
 
 
+#include <algorithm>
+
+#include <Mod/Mesh/App/Core/Neighbourhood.h>
 #include <Mod/Points/App/Points.h>
 
 #include "Segmentation.h"
@@ -161,7 +164,6 @@ void Segmentation::perform(int ksearch)
 
 // ----------------------------------------------------------------------------
 
-#if defined(HAVE_PCL_FILTERS)
 NormalEstimation::NormalEstimation(const Points::PointKernel& pts)
     : myPoints(pts)
     , kSearch(0)
@@ -171,46 +173,21 @@ NormalEstimation::NormalEstimation(const Points::PointKernel& pts)
 void NormalEstimation::perform(std::vector<Base::Vector3d>& normals)
 {
     // Copy the points
-    pcl::PointCloud<PointXYZ>::Ptr cloud(new pcl::PointCloud<PointXYZ>);
-    cloud->reserve(myPoints.size());
+    std::vector<Base::Vector3f> points;
+    points.reserve(myPoints.size());
     for (Points::PointKernel::const_iterator it = myPoints.begin(); it != myPoints.end(); ++it) {
-        cloud->push_back(pcl::PointXYZ(it->x, it->y, it->z));
+        points.emplace_back(float(it->x), float(it->y), float(it->z));
     }
 
-    cloud->width = int(cloud->points.size());
-    cloud->height = 1;
-
-# if 0
-    // Build a passthrough filter to remove spurious NaNs
-    pcl::PointCloud<PointXYZ>::Ptr cloud_filtered (new pcl::PointCloud<PointXYZ>);
-    pcl::PassThrough<PointXYZ> pass;
-    pass.setInputCloud (cloud);
-    pass.setFilterFieldName ("z");
-    pass.setFilterLimits (0, 1.5);
-    pass.filter (*cloud_filtered);
-# endif
-
-    // Estimate point normals
-    pcl::PointCloud<pcl::Normal>::Ptr cloud_normals(new pcl::PointCloud<pcl::Normal>);
-    pcl::search::KdTree<PointXYZ>::Ptr tree(new pcl::search::KdTree<PointXYZ>());
-    pcl::NormalEstimation<PointXYZ, pcl::Normal> ne;
-    ne.setSearchMethod(tree);
-    // ne.setInputCloud (cloud_filtered);
-    ne.setInputCloud(cloud);
-    if (kSearch > 0) {
-        ne.setKSearch(kSearch);
-    }
-    if (searchRadius > 0) {
-        ne.setRadiusSearch(searchRadius);
-    }
-    ne.compute(*cloud_normals);
+    // Estimate point normals oriented towards the origin
+    MeshCore::MeshPointNeighbourhood neighbourhood(points);
+    std::vector<Base::Vector3f> estimated = neighbourhood.EstimateNormals(
+        std::size_t(std::max(kSearch, 0)),
+        float(searchRadius)
+    );
 
-    normals.reserve(cloud_normals->size());
-    for (pcl::PointCloud<pcl::Normal>::const_iterator it = cloud_normals->begin();
-         it != cloud_normals->end();
-         ++it) {
-        normals.push_back(Base::Vector3d(it->normal_x, it->normal_y, it->normal_z));
+    normals.reserve(estimated.size());
+    for (const auto& it : estimated) {
+        normals.emplace_back(it.x, it.y, it.z);
     }
 }
-
-#endif  // HAVE_PCL_FILTERS
@@ -22,18 +22,25 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <QtConcurrentMap>
+
 #include "kdl_cp/chainfksolverpos_recursive.hpp"
 #include "kdl_cp/chainiksolverpos_nr_jl.hpp"
 #include "kdl_cp/chainiksolvervel_pinv.hpp"
 
 #include <Base/FileInfo.h>
 #include <Base/Reader.h>
+#include <Base/Exception.h>
 #include <Base/Stream.h>
 #include <Base/Tools.h>
 #include <Base/Writer.h>
 
 #include "Robot6Axis.h"
 #include "RobotAlgos.h"
+#include "Trajectory.h"
 
 namespace Robot
 {
@@ -51,6 +58,50 @@ AxisDefinition KukaIR500[6] = {
 };
 // clang-format on
 
+namespace
+{
+
+// number of trajectory samples solved by one task
+constexpr std::size_t sampleChunk = 64;
+
+// The solvers keep their own copy of the chain, so every thread needs its own instance
+class AxisSolver
+{
+public:
+    AxisSolver(const KDL::Chain& chain, const KDL::JntArray& min, const KDL::JntArray& max)
+        : fksolver(chain)
+        , iksolverv(chain)
+        , iksolver(chain, min, max, fksolver, iksolverv, 100, 1e-6)
+    {}
+
+    // solves the samples [begin, end) each one started from its predecessor
+    // an unreachable sample keeps the axis of its predecessor
+    void solve(
+        const KDL::JntArray& seed,
+        const std::vector<KDL::Frame>& frames,
+        std::vector<KDL::JntArray>& joints,
+        std::vector<char>& solved,
+        std::size_t begin,
+        std::size_t end
+    )
+    {
+        const KDL::JntArray* last = &seed;
+        for (std::size_t i = begin; i < end; i++) {
+            solved[i] = iksolver.CartToJnt(*last, frames[i], joints[i]) >= 0 ? 1 : 0;
+            if (!solved[i]) {
+                joints[i] = *last;
+            }
+            last = &joints[i];
+        }
+    }
+
+private:
+    KDL::ChainFkSolverPos_recursive fksolver;
+    KDL::ChainIkSolverVel_pinv iksolverv;
+    KDL::ChainIkSolverPos_NR_JL iksolver;
+};
+
+}  // namespace
 
 TYPESYSTEM_SOURCE(Robot::Robot6Axis, Base::Persistence)
 
@@ -303,4 +354,90 @@ double Robot6Axis::getAxis(int Axis)
     return RotDir[Axis] * Base::toDegrees<double>(Actual(Axis));
 }
 
+bool Robot6Axis::solveTrajectory(
+    const Trajectory& trac,
+    double timeStep,
+    std::vector<AxisValues>& axis,
+    std::vector<bool>& reachable,
+    bool parallel
+) const
+{
+    if (timeStep <= 0.0) {
+        throw Base::ValueError("Time step must be positive");
+    }
+
+    double duration = trac.getDuration();
+    std::size_t count = static_cast<std::size_t>(std::ceil(duration / timeStep)) + 1;
+
+    // the trajectory caches the last used path segment, so sample it in one go
+    std::vector<KDL::Frame> frames;
+    frames.reserve(count);
+    for (std::size_t i = 0; i < count; i++) {
+        frames.push_back(toFrame(trac.getPosition(std::min(double(i) * timeStep, duration))));
+    }
+
+    std::vector<KDL::JntArray> joints(count, KDL::JntArray(Kinematic.getNrOfJoints()));
+    std::vector<char> solved(count, 0);
+
+    if (!parallel || count <= sampleChunk) {
+        AxisSolver solver(Kinematic, Min, Max);
+        solver.solve(Actual, frames, joints, solved, 0, count);
+    }
+    else {
+        std::vector<std::size_t> chunks((count + sampleChunk - 1) / sampleChunk);
+        std::iota(chunks.begin(), chunks.end(), 0);
+
+        // solve the first sample of each chunk in order so that all chunks
+        // stay in the same configuration of the robot
+        AxisSolver solver(Kinematic, Min, Max);
+        const KDL::JntArray* seed = &Actual;
+        for (std::size_t chunk : chunks) {
+            std::size_t begin = chunk * sampleChunk;
+            solver.solve(*seed, frames, joints, solved, begin, begin + 1);
+            seed = &joints[begin];
+        }
+
+        QtConcurrent::blockingMap(chunks, [&](std::size_t& chunk) {
+            std::size_t begin = chunk * sampleChunk;
+            std::size_t end = std::min(begin + sampleChunk, count);
+            AxisSolver chunkSolver(Kinematic, Min, Max);
+            chunkSolver.solve(joints[begin], frames, joints, solved, begin + 1, end);
+        });
+    }
+
+    axis.resize(count);
+    reachable.resize(count);
+    bool all = true;
+    for (std::size_t i = 0; i < count; i++) {
+        for (int j = 0; j < 6; j++) {
+            axis[i][j] = RotDir[j] * Base::toDegrees<double>(joints[i](j));
+        }
+        reachable[i] = solved[i] != 0;
+        all = all && reachable[i];
+    }
+
+    return all;
+}
+
+std::vector<Base::Placement> Robot6Axis::calcTcp(const std::vector<AxisValues>& axis) const
+{
+    KDL::ChainFkSolverPos_recursive fksolver(Kinematic);
+    KDL::JntArray joints(Kinematic.getNrOfJoints());
+    KDL::Frame cartpos;
+
+    std::vector<Base::Placement> tcp;
+    tcp.reserve(axis.size());
+    for (const auto& it : axis) {
+        for (int j = 0; j < 6; j++) {
+            joints(j) = RotDir[j] * Base::toRadians<double>(it[j]);
+        }
+        if (fksolver.JntToCart(joints, cartpos) < 0) {
+            throw Base::RuntimeError("Failed to calculate the Tcp");
+        }
+        tcp.push_back(toPlacement(cartpos));
+    }
+
+    return tcp;
+}
+
 } /* namespace Robot */
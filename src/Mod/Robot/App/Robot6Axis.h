@@ -24,6 +24,9 @@
 
 #pragma once
 
+#include <array>
+#include <vector>
+
 #include "kdl_cp/chain.hpp"
 #include "kdl_cp/jntarray.hpp"
 #include <Base/Persistence.h>
@@ -34,6 +37,8 @@
 namespace Robot
 {
 
+class Trajectory;
+
 /// Definition of the Axis properties
 struct AxisDefinition
 {
@@ -47,6 +52,9 @@ struct AxisDefinition
     double velocity = 0.0;  // max vlocity of the axle in °/s
 };
 
+/// The poses of the six axis in degrees
+using AxisValues = std::array<double, 6>;
+
 
 /** The representation for a 6-Axis industry grade robot
  */
@@ -78,6 +86,22 @@ public:
     bool calcTcp();
     Base::Placement getTcp();
 
+    /** Samples the trajectory at fixed time steps and calculates the axis for each sample.
+     * Every sample is started from the solution of the previous one, the first one from the
+     * actual axis. The robot itself is not moved.
+     * If \a parallel is true the samples are solved in chunks on several threads.
+     * Returns false if at least one sample can't be reached.
+     */
+    bool solveTrajectory(
+        const Trajectory& trac,
+        double timeStep,
+        std::vector<AxisValues>& axis,
+        std::vector<bool>& reachable,
+        bool parallel = false
+    ) const;
+    /// calculate the Tcp for each set of axis values
+    std::vector<Base::Placement> calcTcp(const std::vector<AxisValues>& axis) const;
+
     // void setKinematik(const std::vector<std::vector<float> > &KinTable);
 
 
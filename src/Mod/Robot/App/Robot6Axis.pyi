@@ -6,6 +6,8 @@ from typing import Any
 
 from Base.Metadata import export
 from Base.Persistence import Persistence
+from Base.Placement import Placement
+from Robot.Trajectory import Trajectory
 
 @export(
     Include="Mod/Robot/App/Robot6Axis.h",
@@ -25,6 +27,25 @@ class Robot6Axis(Persistence):
         """Checks the shape and report errors in the shape structure.
         This is a more detailed check as done in isValid()."""
         ...
+
+    def solveTrajectory(
+        self, trajectory: Trajectory, timeStep: float, parallel: bool = False, /
+    ) -> tuple[list[tuple[float, ...]], list[bool]]:
+        """
+        solveTrajectory(trajectory, timeStep, [parallel=False]) -> (axis, reachable)
+        Samples the trajectory every timeStep seconds and calculates the six axis
+        in degrees for each sample. Each sample is started from the solution of the
+        previous one, the first one from the actual axis. The robot isn't moved.
+        If parallel is True the samples are solved on several threads.
+        """
+        ...
+
+    def calcTcp(self, axis: list[tuple[float, ...]], /) -> list[Placement]:
+        """
+        calcTcp(axis) -> list of Placement
+        Calculates the Tcp for each tuple of six axis values in degrees.
+        """
+        ...
     Axis1: float
     """Pose of Axis 1 in degrees"""
 
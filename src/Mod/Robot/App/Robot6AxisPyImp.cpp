@@ -32,6 +32,7 @@
 // inclusion of the generated files (generated out of Robot6AxisPy.xml)
 #include "Robot6AxisPy.h"
 #include "Robot6AxisPy.cpp"
+#include "TrajectoryPy.h"
 // clang-format on
 
 
@@ -77,6 +78,86 @@ PyObject* Robot6AxisPy::check(PyObject* /*args*/)
     return nullptr;
 }
 
+PyObject* Robot6AxisPy::solveTrajectory(PyObject* args)
+{
+    PyObject* pcTrac;
+    double timeStep;
+    PyObject* parallel = Py_False;
+    if (!PyArg_ParseTuple(
+            args,
+            "O!d|O!",
+            &(TrajectoryPy::Type),
+            &pcTrac,
+            &timeStep,
+            &PyBool_Type,
+            &parallel
+        )) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        const Trajectory* trac = static_cast<TrajectoryPy*>(pcTrac)->getTrajectoryPtr();
+        std::vector<AxisValues> axis;
+        std::vector<bool> reachable;
+        getRobot6AxisPtr()
+            ->solveTrajectory(*trac, timeStep, axis, reachable, Base::asBoolean(parallel));
+
+        Py::List axisList;
+        for (const auto& it : axis) {
+            Py::Tuple values(it.size());
+            for (std::size_t i = 0; i < it.size(); i++) {
+                values.setItem(i, Py::Float(it[i]));
+            }
+            axisList.append(values);
+        }
+
+        Py::List reachList;
+        for (bool it : reachable) {
+            reachList.append(Py::Boolean(it));
+        }
+
+        Py::Tuple tuple(2);
+        tuple.setItem(0, axisList);
+        tuple.setItem(1, reachList);
+        return Py::new_reference_to(tuple);
+    }
+    PY_CATCH;
+}
+
+PyObject* Robot6AxisPy::calcTcp(PyObject* args)
+{
+    PyObject* pcList;
+    if (!PyArg_ParseTuple(args, "O", &pcList)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        std::vector<AxisValues> axis;
+        Py::Sequence list(pcList);
+        for (const auto& it : list) {
+            Py::Sequence values(it);
+            if (values.size() != 6) {
+                throw Py::ValueError("Six axis values expected");
+            }
+            AxisValues item;
+            for (std::size_t i = 0; i < item.size(); i++) {
+                item[i] = static_cast<double>(Py::Float(values[i]));
+            }
+            axis.push_back(item);
+        }
+
+        std::vector<Base::Placement> tcp = getRobot6AxisPtr()->calcTcp(axis);
+        Py::List tcpList;
+        for (const auto& it : tcp) {
+            tcpList.append(Py::asObject(new Base::PlacementPy(new Base::Placement(it))));
+        }
+        return Py::new_reference_to(tcpList);
+    }
+    PY_CATCH;
+}
+
 
 Py::Float Robot6AxisPy::getAxis1() const
 {
@@ -644,6 +644,14 @@ public:
     {
         GCSsys.autoQRThreshold = val;
     }
+    inline void setSparseSolverThreshold(int val)
+    {
+        GCSsys.sparseSolverThreshold = val;
+    }
+    inline void setParallelSolverThreshold(int val)
+    {
+        GCSsys.parallelSolverThreshold = val;
+    }
     inline void setSketchAutoAlgo(bool val)
     {
         GCSsys.autoChooseAlgorithm = val;
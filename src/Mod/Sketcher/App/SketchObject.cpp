@@ -26,6 +26,7 @@
 #include <cmath>
 #include <cstddef>
 #include <limits>
+#include <utility>
 #include <vector>
 
 #include <BRepAdaptor_Curve.hxx>
@@ -531,6 +532,12 @@ void SketchObject::retrieveSolverDiagnostics()
 
 int SketchObject::solve(bool updateGeoAfterSolving /*=true*/)
 {
+    if (isBatchOpen()) {
+        batchNeedsSolve = true;
+        batchSolveUpdatesGeo = batchSolveUpdatesGeo || updateGeoAfterSolving;
+        return 0;
+    }
+
     // no need to check input data validity as this is an sketchobject managed operation.
     Base::StateLocker lock(managedoperation, true);
 
@@ -1421,6 +1428,11 @@ int SketchObject::setVisibility(int ConstrId, bool isVisible)
 
 int SketchObject::setUpSketch()
 {
+    if (isBatchOpen()) {
+        batchNeedsSetUp = true;
+        return lastDoF;
+    }
+
     lastDoF = solvedSketch.setUpSketch(
         getCompleteGeometry(), Constraints.getValues(), getExternalGeometryCount());
 
@@ -1433,6 +1445,52 @@ int SketchObject::setUpSketch()
     return lastDoF;
 }
 
+void SketchObject::openBatch()
+{
+    batchLevel++;
+}
+
+void SketchObject::closeBatch()
+{
+    if (batchLevel == 0) {
+        throw Base::RuntimeError("SketchObject::closeBatch: no open batch");
+    }
+
+    if (--batchLevel > 0) {
+        return;
+    }
+
+    if (std::exchange(batchNeedsAccept, false)) {
+        Base::StateLocker lock(managedoperation, true);
+        acceptGeometry();
+    }
+
+    bool updateGeo = std::exchange(batchSolveUpdatesGeo, false);
+    bool setUp = std::exchange(batchNeedsSetUp, false);
+    if (std::exchange(batchNeedsSolve, false)) {
+        solve(updateGeo);
+    }
+    else if (setUp) {
+        setUpSketch();
+    }
+}
+
+SketchObjectBatch::SketchObjectBatch(SketchObject& obj)
+    : sketch(obj)
+{
+    sketch.openBatch();
+}
+
+SketchObjectBatch::~SketchObjectBatch()
+{
+    try {
+        sketch.closeBatch();
+    }
+    catch (Base::Exception& e) {
+        e.reportException();
+    }
+}
+
 int SketchObject::diagnoseAdditionalConstraints(
     std::vector<Sketcher::Constraint*> additionalconstraints)
 {
@@ -1488,11 +1546,10 @@ int SketchObject::moveGeometries(const std::vector<GeoElementId>& geoEltIds, con
     // or a redundancy that we did not have before, or a change of DoF
 
     if (lastSolverStatus == 0) {
-        std::vector<Part::Geometry*> geomlist = solvedSketch.extractGeometry();
-        Geometry.setValues(geomlist);
-        for (auto* geo :  geomlist) {
-            delete geo;
-        }
+        // only the moved geometries are replaced
+        Part::PropertyGeometryList tmp;
+        tmp.setValues(solvedSketch.extractGeometry());
+        Geometry.moveValues(std::move(tmp));
     }
 
     solvedSketch.resetInitMove();// reset solver point moving mechanism
@@ -10527,6 +10584,12 @@ void SketchObject::onGeometryChanged()
     // internal sketchobject operations changing both geometry and constraints will
     // explicitly perform an update
 
+    if (managedoperation && isBatchOpen()) {
+        // the constraint geometry indices are updated when the batch is closed
+        batchNeedsAccept = true;
+        return;
+    }
+
     if (managedoperation || isRestoring()) {
         // if geometry changed, the constraint geometry indices must be updated
         acceptGeometry();
@@ -10568,6 +10631,12 @@ void SketchObject::onConstraintsChanged()
         return;
     }
 
+    if (managedoperation && isBatchOpen()) {
+        // the geometry may be ahead of the constraint geometry indices until the batch is closed
+        batchNeedsAccept = true;
+        return;
+    }
+
     if (managedoperation || isRestoring()) {
         Constraints.checkGeometry(getCompleteGeometry());
         return;
@@ -332,6 +332,26 @@ public:
        -2 if redundant constraints
     */
     int solve(bool updateGeoAfterSolving = true);
+
+    /** @name batched modifications
+        Between openBatch() and the matching closeBatch(), solve() and setUpSketch() are only
+       recorded (returning 0 and the last DoF), and the managed changes of Geometry and
+       Constraints do not update the constraint geometry indices and the vertex index. closeBatch()
+       performs these updates once, and a single solve if any was requested. Batches can be nested,
+       only the outermost one performs the deferred updates.
+
+       While a batch is open, the functions relying on the vertex index or on the solver
+       (e.g. getGeoVertexIndex, getPoint of the solved sketch, moveGeometry) see the state before
+       the batch. Use SketchObjectBatch to keep a batch open for a scope.
+    */
+    //@{
+    void openBatch();
+    void closeBatch();
+    bool isBatchOpen() const
+    {
+        return batchLevel > 0;
+    }
+    //@}
     /// set the datum of a Distance or Angle constraint and solve
     int setDatum(int ConstrId, double Datum);
     /// get the datum of a Distance or Angle constraint
@@ -1191,6 +1211,13 @@ private:
     bool managedoperation;  // indicates whether changes to properties are the deed of SketchObject
                             // or not (for input validation)
 
+    // nesting level of openBatch() and the updates deferred to the last closeBatch()
+    int batchLevel = 0;
+    bool batchNeedsAccept = false;
+    bool batchNeedsSetUp = false;
+    bool batchNeedsSolve = false;
+    bool batchSolveUpdatesGeo = false;
+
     // mapping from ExternalGeometry[*] to ExternalGeo[*].Id
     // Some external geometry may generate more than one projection
     std::map<std::string, std::vector<long>> externalGeoRefMap;
@@ -1216,6 +1243,20 @@ private:
     mutable std::map<std::string, std::string> internalElementMap;
 };
 
+/// Keeps a batch of modifications of a SketchObject open during its lifetime
+class SketcherExport SketchObjectBatch
+{
+public:
+    explicit SketchObjectBatch(SketchObject& obj);
+    ~SketchObjectBatch();
+
+    SketchObjectBatch(const SketchObjectBatch&) = delete;
+    SketchObjectBatch& operator=(const SketchObjectBatch&) = delete;
+
+private:
+    SketchObject& sketch;
+};
+
 inline int SketchObject::initTemporaryMove(std::vector<GeoElementId> moved, bool fine /*=true*/)
 {
     if (solverNeedsUpdate) {
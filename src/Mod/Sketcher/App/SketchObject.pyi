@@ -82,6 +82,38 @@ class SketchObject(Part2DObject):
         """
         ...
 
+    @no_args
+    def openBatch(self) -> None:
+        """
+        Open a batch of modifications of the sketch.
+
+        Until the matching closeBatch(), solving the sketch is deferred and
+        adding or deleting geometry and constraints does not update the
+        dependent information. Batches can be nested.
+        """
+        ...
+
+    @no_args
+    def closeBatch(self) -> None:
+        """
+        Close a batch of modifications opened with openBatch().
+
+        Closing the outermost batch updates the sketch once and solves it if
+        a solve was requested while it was open.
+        """
+        ...
+
+    @no_args
+    def batch(self) -> object:
+        """
+        Open a batch of modifications, closed when leaving the returned context.
+
+        with sketch.batch():
+            for geo in geometries:
+                sketch.addGeometry(geo)
+        """
+        ...
+
     @overload
     def addGeometry(self, geo: Geometry, isConstruction: bool = False, /) -> int: ...
     @overload
@@ -65,6 +65,39 @@ PyObject* SketchObjectPy::solve(PyObject* args)
     return Py_BuildValue("i", ret);
 }
 
+PyObject* SketchObjectPy::openBatch()
+{
+    this->getSketchObjectPtr()->openBatch();
+    Py_Return;
+}
+
+PyObject* SketchObjectPy::closeBatch()
+{
+    this->getSketchObjectPtr()->closeBatch();
+    Py_Return;
+}
+
+PyObject* SketchObjectPy::batch()
+{
+    // an ExitStack closes the batch at the end of the with statement
+    PyObject* module = PyImport_ImportModule("contextlib");
+    if (!module) {
+        return nullptr;
+    }
+    Py::Module contextlib(module, true);
+    Py::Callable exitStackType(contextlib.getAttr("ExitStack"));
+    Py::Object exitStack(exitStackType.apply(Py::Tuple()));
+
+    Py::Callable callback(exitStack.getAttr("callback"));
+    Py::Tuple args(1);
+    args.setItem(0, Py::Object(this).getAttr("closeBatch"));
+    callback.apply(args);
+
+    // only open the batch once nothing can fail anymore, or it would be left open
+    this->getSketchObjectPtr()->openBatch();
+    return Py::new_reference_to(exitStack);
+}
+
 PyObject* SketchObjectPy::addGeometry(PyObject* args)
 {
     PyObject* pcObj;
@@ -395,7 +428,8 @@ PyObject* SketchObjectPy::addConstraint(PyObject* args)
         // if the geometry moved during the solve, then the initial solution is invalid
         // at this point, so a point movement may not work in cases where redundant constraints
         // exist. this forces recalculation of the initial solution (not a full solve)
-        if (this->getSketchObjectPtr()->noRecomputes) {
+        if (this->getSketchObjectPtr()->noRecomputes
+            && !this->getSketchObjectPtr()->isBatchOpen()) {
             this->getSketchObjectPtr()->setUpSketch();
             this->getSketchObjectPtr()->Constraints.touch();  // update solver information
         }
@@ -90,6 +90,17 @@ double Constraint::maxStep(MAP_pD_D& /*dir*/, double lim)
     return lim;
 }
 
+void Constraint::grads(VEC_D& derivs)
+{
+    derivs.assign(pvec.size(), 0.);
+    for (std::size_t i = 0; i < pvec.size(); i++) {
+        // grad() already accounts for all entries of the parameter
+        if (findParamInPvec(pvec[i]) == static_cast<int>(i)) {
+            derivs[i] = grad(pvec[i]);
+        }
+    }
+}
+
 int Constraint::findParamInPvec(double* param)
 {
     int ret = -1;
@@ -135,6 +146,14 @@ double ConstraintEqual::grad(double* param)
     }
     return scale * deriv;
 }
+
+void ConstraintEqual::grads(VEC_D& derivs)
+{
+    derivs.resize(2);
+    derivs[0] = scale;
+    derivs[1] = -scale;
+}
+
 void ConstraintEqual::evaluate()
 {
     *param2() = *param1() / ratio;
@@ -543,6 +562,18 @@ void ConstraintPointOnBSpline::setStartPole(double u)
     }
 }
 
+void ConstraintPointOnBSpline::updateFactors()
+{
+    size_t k = startpole + bsp.degree;
+    bsp.getLinCombFactors(*theparam(), k, bsp.degree, factors);
+    if (bsp.degree > 0) {
+        bsp.getLinCombFactors(*theparam(), k, bsp.degree - 1, slopeFactors);
+    }
+    else {
+        slopeFactors.clear();
+    }
+}
+
 double ConstraintPointOnBSpline::error()
 {
     if (*theparam() < bsp.flattenedknots[startpole + bsp.degree]
@@ -550,19 +581,14 @@ double ConstraintPointOnBSpline::error()
         setStartPole(*theparam());
     }
 
+    // the spline values are linear combinations of the (weighted) poles
+    bsp.getLinCombFactors(*theparam(), startpole + bsp.degree, bsp.degree, factors);
     double sum = 0;
     double wsum = 0;
-
-    // TODO: maybe make it global so it doesn't have to be created every time
-    VEC_D d(numpoints);
     for (size_t i = 0; i < numpoints; ++i) {
-        d[i] = *poleat(i) * *weightat(i);
+        sum += *poleat(i) * *weightat(i) * factors[i];
+        wsum += *weightat(i) * factors[i];
     }
-    sum = BSpline::splineValue(*theparam(), startpole + bsp.degree, bsp.degree, d, bsp.flattenedknots);
-    for (size_t i = 0; i < numpoints; ++i) {
-        d[i] = *weightat(i);
-    }
-    wsum = BSpline::splineValue(*theparam(), startpole + bsp.degree, bsp.degree, d, bsp.flattenedknots);
 
     // TODO: Change the poles as the point moves between pieces
 
@@ -571,63 +597,72 @@ double ConstraintPointOnBSpline::error()
 
 double ConstraintPointOnBSpline::grad(double* gcsparam)
 {
+    updateFactors();
+
     double deriv = 0.;
     if (gcsparam == thepoint()) {
-        VEC_D d(numpoints);
         for (size_t i = 0; i < numpoints; ++i) {
-            d[i] = *weightat(i);
+            deriv += *weightat(i) * factors[i];
         }
-        double wsum = BSpline::splineValue(
-            *theparam(),
-            startpole + bsp.degree,
-            bsp.degree,
-            d,
-            bsp.flattenedknots
-        );
-        deriv += wsum;
     }
 
     if (gcsparam == theparam()) {
-        VEC_D d(numpoints - 1);
-        for (size_t i = 1; i < numpoints; ++i) {
-            d[i - 1] = (*poleat(i) * *weightat(i) - *poleat(i - 1) * *weightat(i - 1))
-                / (bsp.flattenedknots[startpole + i + bsp.degree] - bsp.flattenedknots[startpole + i]);
-        }
-        double slopevalue = BSpline::splineValue(
-            *theparam(),
-            startpole + bsp.degree,
-            bsp.degree - 1,
-            d,
-            bsp.flattenedknots
-        );
+        double slopevalue = 0;
+        double wslopevalue = 0;
         for (size_t i = 1; i < numpoints; ++i) {
-            d[i - 1] = (*weightat(i) - *weightat(i - 1))
-                / (bsp.flattenedknots[startpole + i + bsp.degree] - bsp.flattenedknots[startpole + i]);
-        }
-        double wslopevalue = BSpline::splineValue(
-            *theparam(),
-            startpole + bsp.degree,
-            bsp.degree - 1,
-            d,
-            bsp.flattenedknots
-        );
+            double span = bsp.flattenedknots[startpole + i + bsp.degree]
+                - bsp.flattenedknots[startpole + i];
+            slopevalue += (*poleat(i) * *weightat(i) - *poleat(i - 1) * *weightat(i - 1)) / span
+                * slopeFactors[i - 1];
+            wslopevalue += (*weightat(i) - *weightat(i - 1)) / span * slopeFactors[i - 1];
+        }
         deriv += (*thepoint() * wslopevalue - slopevalue) * bsp.degree;
     }
 
     for (size_t i = 0; i < numpoints; ++i) {
         if (gcsparam == poleat(i)) {
-            auto factorsI = bsp.getLinCombFactor(*theparam(), startpole + bsp.degree, startpole + i);
-            deriv += -(*weightat(i) * factorsI);
+            deriv += -(*weightat(i) * factors[i]);
         }
         if (gcsparam == weightat(i)) {
-            auto factorsI = bsp.getLinCombFactor(*theparam(), startpole + bsp.degree, startpole + i);
-            deriv += (*thepoint() - *poleat(i)) * factorsI;
+            deriv += (*thepoint() - *poleat(i)) * factors[i];
         }
     }
 
     return scale * deriv;
 }
 
+void ConstraintPointOnBSpline::grads(VEC_D& derivs)
+{
+    updateFactors();
+
+    derivs.assign(pvec.size(), 0.);
+
+    double wsum = 0;
+    for (size_t i = 0; i < numpoints; ++i) {
+        wsum += *weightat(i) * factors[i];
+    }
+    derivs[0] = scale * wsum;
+
+    double slopevalue = 0;
+    double wslopevalue = 0;
+    for (size_t i = 1; i < numpoints; ++i) {
+        double span =
+            bsp.flattenedknots[startpole + i + bsp.degree] - bsp.flattenedknots[startpole + i];
+        slopevalue += (*poleat(i) * *weightat(i) - *poleat(i - 1) * *weightat(i - 1)) / span
+            * slopeFactors[i - 1];
+        wslopevalue += (*weightat(i) - *weightat(i - 1)) / span * slopeFactors[i - 1];
+    }
+    derivs[1] = scale * (*thepoint() * wslopevalue - slopevalue) * bsp.degree;
+
+    // the entries of the poles and weights of the current piece
+    for (size_t i = 0; i < numpoints; ++i) {
+        size_t pole = 2 + (startpole + i) % bsp.poles.size();
+        size_t weight = 2 + bsp.poles.size() + (startpole + i) % bsp.weights.size();
+        derivs[pole] += -scale * *weightat(i) * factors[i];
+        derivs[weight] += scale * (*thepoint() - *poleat(i)) * factors[i];
+    }
+}
+
 // Difference
 ConstraintDifference::ConstraintDifference(double* p1, double* p2, double* d)
 {
@@ -665,6 +700,14 @@ double ConstraintDifference::grad(double* param)
     }
     return scale * deriv;
 }
+
+void ConstraintDifference::grads(VEC_D& derivs)
+{
+    derivs.resize(3);
+    derivs[0] = -scale;
+    derivs[1] = scale;
+    derivs[2] = -scale;
+}
 void ConstraintDifference::evaluate()
 {
     *difference() = scale * value();
@@ -727,6 +770,19 @@ double ConstraintP2PDistance::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintP2PDistance::grads(VEC_D& derivs)
+{
+    double dx = (*p1x() - *p2x());
+    double dy = (*p1y() - *p2y());
+    double d = sqrt(dx * dx + dy * dy);
+    derivs.resize(5);
+    derivs[0] = scale * dx / d;
+    derivs[1] = scale * dy / d;
+    derivs[2] = -scale * dx / d;
+    derivs[3] = -scale * dy / d;
+    derivs[4] = -scale;
+}
+
 double ConstraintP2PDistance::maxStep(MAP_pD_D& dir, double lim)
 {
     MAP_pD_D::iterator it;
@@ -1070,6 +1126,24 @@ double ConstraintPointOnLine::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintPointOnLine::grads(VEC_D& derivs)
+{
+    double x0 = *p0x(), x1 = *p1x(), x2 = *p2x();
+    double y0 = *p0y(), y1 = *p1y(), y2 = *p2y();
+    double dx = x2 - x1;
+    double dy = y2 - y1;
+    double d2 = dx * dx + dy * dy;
+    double d = sqrt(d2);
+    double area = -x0 * dy + y0 * dx + x1 * y2 - x2 * y1;
+    derivs.resize(6);
+    derivs[0] = scale * (y1 - y2) / d;
+    derivs[1] = scale * (x2 - x1) / d;
+    derivs[2] = scale * ((y2 - y0) * d + (dx / d) * area) / d2;
+    derivs[3] = scale * ((x0 - x2) * d + (dy / d) * area) / d2;
+    derivs[4] = scale * ((y0 - y1) * d - (dx / d) * area) / d2;
+    derivs[5] = scale * ((x1 - x0) * d - (dy / d) * area) / d2;
+}
+
 
 // --------------------------------------------------------
 // PointOnPerpBisector
@@ -1198,6 +1272,24 @@ double ConstraintParallel::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintParallel::grads(VEC_D& derivs)
+{
+    double dx1 = (*l1p1x() - *l1p2x());
+    double dy1 = (*l1p1y() - *l1p2y());
+    double dx2 = (*l2p1x() - *l2p2x());
+    double dy2 = (*l2p1y() - *l2p2y());
+    // pvec order: l1p1x, l1p1y, l1p2x, l1p2y, l2p1x, l2p1y, l2p2x, l2p2y
+    derivs.resize(8);
+    derivs[0] = scale * dy2;
+    derivs[1] = -scale * dx2;
+    derivs[2] = -scale * dy2;
+    derivs[3] = scale * dx2;
+    derivs[4] = -scale * dy1;
+    derivs[5] = scale * dx1;
+    derivs[6] = scale * dy1;
+    derivs[7] = -scale * dx1;
+}
+
 
 // --------------------------------------------------------
 // Perpendicular
@@ -1284,6 +1376,24 @@ double ConstraintPerpendicular::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintPerpendicular::grads(VEC_D& derivs)
+{
+    double dx1 = (*l1p1x() - *l1p2x());
+    double dy1 = (*l1p1y() - *l1p2y());
+    double dx2 = (*l2p1x() - *l2p2x());
+    double dy2 = (*l2p1y() - *l2p2y());
+    // pvec order: l1p1x, l1p1y, l1p2x, l1p2y, l2p1x, l2p1y, l2p2x, l2p2y
+    derivs.resize(8);
+    derivs[0] = scale * dx2;
+    derivs[1] = scale * dy2;
+    derivs[2] = -scale * dx2;
+    derivs[3] = -scale * dy2;
+    derivs[4] = scale * dx1;
+    derivs[5] = scale * dy1;
+    derivs[6] = -scale * dx1;
+    derivs[7] = -scale * dy1;
+}
+
 
 // --------------------------------------------------------
 // L2LAngle
@@ -200,7 +200,11 @@ public:
 
         return deriv * scale;
     };
-    // virtual void grad(MAP_pD_D &deriv);  --> TODO: vectorized grad version
+    // Partial derivatives of error() with respect to all entries of pvec at once, in pvec
+    // order, so that the geometry is evaluated only once. The derivative with respect to a
+    // parameter is the sum over the entries of pvec pointing to it. The default implementation
+    // calls grad() once for every distinct parameter.
+    virtual void grads(VEC_D& derivs);
     virtual double maxStep(MAP_pD_D& dir, double lim = 1.);
 
     // Evaluates the value of the constraint and assigns it to
@@ -236,6 +240,7 @@ public:
     ConstraintType getTypeId() override;
     double error() override;
     double grad(double*) override;
+    void grads(VEC_D& derivs) override;
     void evaluate() override;
 };
 
@@ -382,6 +387,11 @@ private:
         return pvec[2 + bsp.poles.size() + (startpole + i) % bsp.weights.size()];
     }
     void setStartPole(double u);
+    // basis functions of the current piece, and of degree - 1 for the derivative with respect
+    // to the parameter
+    void updateFactors();
+    VEC_D factors;
+    VEC_D slopeFactors;
 
 public:
     /// TODO: Explain how it's provided
@@ -390,6 +400,7 @@ public:
     ConstraintType getTypeId() override;
     double error() override;
     double grad(double*) override;
+    void grads(VEC_D& derivs) override;
     size_t numpoints;
     BSpline& bsp;
     size_t startpole;
@@ -418,6 +429,7 @@ public:
     ConstraintType getTypeId() override;
     double error() override;
     double grad(double*) override;
+    void grads(VEC_D& derivs) override;
     void evaluate() override;
 };
 
@@ -456,6 +468,7 @@ public:
     ConstraintType getTypeId() override;
     double error() override;
     double grad(double*) override;
+    void grads(VEC_D& derivs) override;
     double maxStep(MAP_pD_D& dir, double lim = 1.) override;
     void evaluate() override;
 };
@@ -586,6 +599,7 @@ public:
     ConstraintType getTypeId() override;
     double error() override;
     double grad(double*) override;
+    void grads(VEC_D& derivs) override;
 };
 
 // PointOnPerpBisector
@@ -674,6 +688,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void grads(VEC_D& derivs) override;
 };
 
 // Perpendicular
@@ -724,6 +739,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void grads(VEC_D& derivs) override;
 };
 
 // L2LAngle
@@ -49,10 +49,12 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <future>
 #include <iostream>
 #include <limits>
 #include <numbers>
+#include <thread>
 
 #include "GCS.h"
 #include "qp_eq.h"
@@ -488,6 +490,8 @@ System::System()
     , qrAlgorithm(EigenSparseQR)
     , autoChooseAlgorithm(true)
     , autoQRThreshold(1000)
+    , sparseSolverThreshold(1000)
+    , parallelSolverThreshold(8)
     , dogLegGaussStep(FullPivLU)
     , qrpivotThreshold(1E-13)
     , debugMode(Minimal)
@@ -1849,9 +1853,52 @@ void System::initSolution(Algorithm alg)
         }
     }
 
+    componentInputs.assign(clists.size(), VEC_pD());
+    componentInputValues.assign(clists.size(), VEC_D());
+    componentSolveKeys.assign(clists.size(), -1);
+    componentResults.assign(clists.size(), Success);
+    for (std::size_t cid = 0; cid < clists.size(); ++cid) {
+        SET_pD inputs;
+        for (const auto& constr : clists[cid]) {
+            for (const auto& param : constr->params()) {
+                if (pIndex.find(param) == pIndex.end()) {
+                    inputs.insert(param);
+                }
+            }
+        }
+        componentInputs[cid].assign(inputs.begin(), inputs.end());
+    }
+
     isInit = true;
 }
 
+bool System::isComponentUnchanged(int cid, int solveKey) const
+{
+    if (componentSolveKeys[cid] != solveKey) {
+        return false;
+    }
+    const VEC_pD& inputs = componentInputs[cid];
+    const VEC_D& values = componentInputValues[cid];
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        if (*inputs[i] != values[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void System::storeComponentSolve(int cid, int solveKey, int result)
+{
+    const VEC_pD& inputs = componentInputs[cid];
+    VEC_D& values = componentInputValues[cid];
+    values.resize(inputs.size());
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        values[i] = *inputs[i];
+    }
+    componentSolveKeys[cid] = solveKey;
+    componentResults[cid] = result;
+}
+
 void System::setReference()
 {
     reference.clear();
@@ -1889,21 +1936,75 @@ int System::solve(bool isFine, Algorithm alg, bool isRedundantsolving)
     // return success by default in order to permit coincidence constraints to be applied
     // even if no other system has to be solved
     int res = Success;
+    int solveKey = (int(alg) * 2 + int(isFine)) * 2 + int(isRedundantsolving);
+    std::vector<int> pending;
     for (int cid = 0; cid < int(subSystems.size()); cid++) {
         if ((subSystems[cid] || subSystemsAux[cid]) && !isReset) {
             resetToReference();
             isReset = true;
         }
+        // The subsystems keep the solution of their last solve, which applySolution() writes
+        // back, so components not affected since then (e.g. while dragging another part of
+        // the sketch) can be skipped.
+        if (isComponentUnchanged(cid, solveKey)) {
+            res = std::max(res, componentResults[cid]);
+            continue;
+        }
+        pending.push_back(cid);
+    }
+
+    std::vector<int> results(pending.size(), Success);
+    auto solveComponent = [&](std::size_t i) {
+        int cid = pending[i];
         if (subSystems[cid] && subSystemsAux[cid]) {
-            res = std::max(res, solve(subSystems[cid], subSystemsAux[cid], isFine, isRedundantsolving));
+            results[i] = solve(subSystems[cid], subSystemsAux[cid], isFine, isRedundantsolving);
         }
         else if (subSystems[cid]) {
-            res = std::max(res, solve(subSystems[cid], isFine, alg, isRedundantsolving));
+            results[i] = solve(subSystems[cid], isFine, alg, isRedundantsolving);
         }
         else if (subSystemsAux[cid]) {
-            res = std::max(res, solve(subSystemsAux[cid], isFine, alg, isRedundantsolving));
+            results[i] = solve(subSystemsAux[cid], isFine, alg, isRedundantsolving);
+        }
+    };
+
+    // The components share no unknowns and no constraints, each solve only works on the
+    // parameter copies of its subsystem. The iteration level debug output is not thread-safe.
+    bool parallel = parallelSolverThreshold > 0 && int(pending.size()) >= parallelSolverThreshold
+        && debugMode != IterationLevel;
+#ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
+    parallel = false;
+#endif
+    if (parallel) {
+        std::atomic<std::size_t> next(0);
+        auto worker = [&]() {
+            for (std::size_t i = next++; i < pending.size(); i = next++) {
+                solveComponent(i);
+            }
+        };
+        std::size_t threads = std::min<std::size_t>(
+            std::max(1U, std::thread::hardware_concurrency()),
+            pending.size()
+        );
+        std::vector<std::future<void>> futures;
+        for (std::size_t t = 1; t < threads; t++) {
+            futures.push_back(std::async(std::launch::async, worker));
+        }
+        worker();
+        for (auto& fut : futures) {
+            fut.get();
         }
     }
+    else {
+        for (std::size_t i = 0; i < pending.size(); i++) {
+            solveComponent(i);
+        }
+    }
+
+    // merged in component order, so the result does not depend on the scheduling
+    for (std::size_t i = 0; i < pending.size(); i++) {
+        storeComponentSolve(pending[i], solveKey, results[i]);
+        res = std::max(res, results[i]);
+    }
     if (res == Success) {
         for (std::set<Constraint*>::const_iterator constr = redundant.begin();
              constr != redundant.end();
@@ -2079,10 +2180,20 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
     Eigen::VectorXd e(csize),
         e_new(csize);  // vector of all function errors (every constraint is one function)
-    Eigen::MatrixXd J(csize, xsize);  // Jacobi of the subsystem
-    Eigen::MatrixXd A(xsize, xsize);
+    Eigen::MatrixXd J;  // Jacobi of the subsystem
+    Eigen::MatrixXd A;
     Eigen::VectorXd x(xsize), h(xsize), x_new(xsize), g(xsize), diag_A(xsize);
 
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+    // each constraint only depends on a few parameters, so for large subsystems
+    // the normal equations are assembled and factorized as sparse matrices
+    bool sparse = sparseSolverThreshold > 0 && xsize >= sparseSolverThreshold;
+    Eigen::SparseMatrix<double> SJ, SA, SI(xsize, xsize);
+    SI.setIdentity();
+#else
+    bool sparse = false;
+#endif
+
     subsys->redirectParams();
 
     subsys->getParams(x);
@@ -2131,14 +2242,27 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
         }
 
         // J^T J, J^T e
-        subsys->calcJacobi(J);
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+        if (sparse) {
+            subsys->calcJacobi(SJ);
+
+            SA = SJ.transpose() * SJ;
+            g = SJ.transpose() * e;
+            diag_A = SA.diagonal();
+        }
+        else
+#endif
+        {
+            subsys->calcJacobi(J);
 
-        A = J.transpose() * J;
-        g = J.transpose() * e;
+            A = J.transpose() * J;
+            g = J.transpose() * e;
+            diag_A = A.diagonal();  // save diagonal entries so that augmentation can be later
+                                    // canceled
+        }
 
         // Compute ||J^T e||_inf
         double g_inf = g.lpNorm<Eigen::Infinity>();
-        diag_A = A.diagonal();  // save diagonal entries so that augmentation can be later canceled
 
         // check for convergence
         if (g_inf <= eps1) {
@@ -2155,14 +2279,31 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
         // determine increment using adaptive damping
         int k = 0;
         while (k < 50) {
-            // augment normal equations A = A+uI
-            for (int i = 0; i < xsize; ++i) {
-                A(i, i) += mu;
+            double rel_error = std::numeric_limits<double>::infinity();
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+            if (sparse) {
+                // augment normal equations A = A+uI, which keeps them positive definite
+                Eigen::SparseMatrix<double> SA_aug = SA + mu * SI;
+
+                // solve augmented functions A*h=-g
+                Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> ldlt(SA_aug);
+                if (ldlt.info() == Eigen::Success) {
+                    h = ldlt.solve(g);
+                    rel_error = (SA_aug * h - g).norm() / g.norm();
+                }
             }
+            else
+#endif
+            {
+                // augment normal equations A = A+uI
+                for (int i = 0; i < xsize; ++i) {
+                    A(i, i) += mu;
+                }
 
-            // solve augmented functions A*h=-g
-            h = A.fullPivLu().solve(g);
-            double rel_error = (A * h - g).norm() / g.norm();
+                // solve augmented functions A*h=-g
+                h = A.fullPivLu().solve(g);
+                rel_error = (A * h - g).norm() / g.norm();
+            }
 
             // check if solving works
             if (rel_error < 1e-5) {
@@ -2212,8 +2353,10 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
             mu *= nu;
             nu *= 2.0;
-            for (int i = 0; i < xsize; ++i) {  // restore diagonal J^T J entries
-                A(i, i) = diag_A(i);
+            if (!sparse) {
+                for (int i = 0; i < xsize; ++i) {  // restore diagonal J^T J entries
+                    A(i, i) = diag_A(i);
+                }
             }
 
             k++;
@@ -2243,6 +2386,22 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
     return (stop == 1) ? Success : Failed;
 }
 
+Eigen::VectorXd System::solveDogLegGaussStep(const Eigen::MatrixXd& Jx, const Eigen::VectorXd& fx)
+{
+    // get the gauss-newton step
+    // https://forum.freecad.org/viewtopic.php?f=10&t=12769&start=50#p106220
+    // https://forum.kde.org/viewtopic.php?f=74&t=129439#p346104
+    switch (dogLegGaussStep) {
+        case LeastNormFullPivLU:
+            return Jx.adjoint() * (Jx * Jx.adjoint()).fullPivLu().solve(-fx);
+        case LeastNormLdlt:
+            return Jx.adjoint() * (Jx * Jx.adjoint()).ldlt().solve(-fx);
+        case FullPivLU:
+        default:
+            return Jx.fullPivLu().solve(-fx);
+    }
+}
+
 int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
 {
 #ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
@@ -2287,17 +2446,32 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
 
     Eigen::VectorXd x(xsize), x_new(xsize);
     Eigen::VectorXd fx(csize), fx_new(csize);
-    Eigen::MatrixXd Jx(csize, xsize), Jx_new(csize, xsize);
+    Eigen::MatrixXd Jx, Jx_new;
     Eigen::VectorXd g(xsize), h_sd(xsize), h_gn(xsize), h_dl(xsize);
 
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+    // each constraint only depends on a few parameters, so for large subsystems
+    // the Jacobian is kept sparse and the Gauss-Newton step uses a sparse factorization
+    bool sparse = sparseSolverThreshold > 0 && xsize >= sparseSolverThreshold;
+    Eigen::SparseMatrix<double> SJx, SJx_new;
+#endif
+
     subsys->redirectParams();
 
     double err;
     subsys->getParams(x);
     subsys->calcResidual(fx, err);
-    subsys->calcJacobi(Jx);
-
-    g = Jx.transpose() * (-fx);
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+    if (sparse) {
+        subsys->calcJacobi(SJx);
+        g = SJx.transpose() * (-fx);
+    }
+    else
+#endif
+    {
+        subsys->calcJacobi(Jx);
+        g = Jx.transpose() * (-fx);
+    }
 
     // get the infinity norm fx_inf and g_inf
     double g_inf = g.lpNorm<Eigen::Infinity>();
@@ -2335,25 +2509,37 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
         }
 
         // get the steepest descent direction
-        alpha = g.squaredNorm() / (Jx * g).squaredNorm();
-        h_sd = alpha * g;
-
-        // get the gauss-newton step
-        // https://forum.freecad.org/viewtopic.php?f=10&t=12769&start=50#p106220
-        // https://forum.kde.org/viewtopic.php?f=74&t=129439#p346104
-        switch (dogLegGaussStep) {
-            case FullPivLU:
-                h_gn = Jx.fullPivLu().solve(-fx);
-                break;
-            case LeastNormFullPivLU:
-                h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).fullPivLu().solve(-fx);
-                break;
-            case LeastNormLdlt:
-                h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).ldlt().solve(-fx);
-                break;
+        double rel_error = 0.;
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+        if (sparse) {
+            alpha = g.squaredNorm() / (SJx * g).squaredNorm();
+            h_sd = alpha * g;
+
+            // least norm gauss-newton step, the sparse counterpart of LeastNormLdlt. If
+            // J*J^T is singular, fall back to the dense step chosen by dogLegGaussStep.
+            Eigen::SparseMatrix<double> SJJt = SJx * SJx.transpose();
+            Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> ldlt(SJJt);
+            bool solved = false;
+            if (ldlt.info() == Eigen::Success) {
+                h_gn = SJx.transpose() * ldlt.solve(-fx);
+                rel_error = (SJx * h_gn + fx).norm() / fx.norm();
+                solved = rel_error < 1e-5;
+            }
+            if (!solved) {
+                Jx = Eigen::MatrixXd(SJx);
+                h_gn = solveDogLegGaussStep(Jx, fx);
+                rel_error = (SJx * h_gn + fx).norm() / fx.norm();
+            }
         }
+        else
+#endif
+        {
+            alpha = g.squaredNorm() / (Jx * g).squaredNorm();
+            h_sd = alpha * g;
 
-        double rel_error = (Jx * h_gn + fx).norm() / fx.norm();
+            h_gn = solveDogLegGaussStep(Jx, fx);
+            rel_error = (Jx * h_gn + fx).norm() / fx.norm();
+        }
         if (rel_error > 1e15) {
             break;
         }
@@ -2393,20 +2579,39 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
         x_new = x + h_dl;
         subsys->setParams(x_new);
         subsys->calcResidual(fx_new, err_new);
-        subsys->calcJacobi(Jx_new);
 
         // calculate the linear model and the update ratio
-        double dL = err - 0.5 * (fx + Jx * h_dl).squaredNorm();
+        double dL = 0.;
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+        if (sparse) {
+            subsys->calcJacobi(SJx_new);
+            dL = err - 0.5 * (fx + SJx * h_dl).squaredNorm();
+        }
+        else
+#endif
+        {
+            subsys->calcJacobi(Jx_new);
+            dL = err - 0.5 * (fx + Jx * h_dl).squaredNorm();
+        }
         double dF = err - err_new;
         double rho = dL / dF;
 
         if (dF > 0 && dL > 0) {
             x = x_new;
-            Jx = Jx_new;
             fx = fx_new;
             err = err_new;
 
-            g = Jx.transpose() * (-fx);
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+            if (sparse) {
+                SJx = SJx_new;
+                g = SJx.transpose() * (-fx);
+            }
+            else
+#endif
+            {
+                Jx = Jx_new;
+                g = Jx.transpose() * (-fx);
+            }
 
             // get infinity norms
             g_inf = g.lpNorm<Eigen::Infinity>();
@@ -4893,6 +5098,15 @@ int System::diagnose(Algorithm alg)
     // From here on, presuming `J.rows() > 0`.
     emptyDiagnoseMatrix = false;
 
+    // The sketch diagnoses the same system several times per edit (e.g. on every recompute),
+    // reuse the result of an identical system instead of decomposing it again
+    VEC_I diagnosisStructure;
+    VEC_D diagnosisValues;
+    makeDiagnosisKey(alg, J, pdiagnoselist, diagnosisStructure, diagnosisValues);
+    if (restoreDiagnosis(diagnosisStructure, diagnosisValues, pdiagnoselist)) {
+        return dofs;
+    }
+
     if (qrAlgorithm == EigenDenseQR) {
 #ifdef PROFILE_DIAGNOSE
         Base::TimeElapsed DenseQR_start_time;
@@ -5048,9 +5262,153 @@ int System::diagnose(Algorithm alg)
     }
 #endif
 
+    storeDiagnosis(std::move(diagnosisStructure), std::move(diagnosisValues), pdiagnoselist);
+
     return dofs;
 }
 
+void System::makeDiagnosisKey(
+    Algorithm alg,
+    const Eigen::MatrixXd& J,
+    const GCS::VEC_pD& pdiagnoselist,
+    VEC_I& structure,
+    VEC_D& values
+)
+{
+    MAP_pD_I diagnoseIndex;
+    for (int i = 0; i < int(pdiagnoselist.size()); i++) {
+        diagnoseIndex[pdiagnoselist[i]] = i;
+    }
+
+    // settings that affect the decompositions and the redundant solving
+    structure = {
+        int(alg),
+        int(qrAlgorithm),
+        maxIterRedundant,
+        int(sketchSizeMultiplierRedundant),
+        int(clist.size()),
+        int(J.rows()),
+        int(J.cols()),
+    };
+    values = {
+        qrpivotThreshold,
+        convergenceRedundant,
+        LM_epsRedundant,
+        LM_eps1Redundant,
+        LM_tauRedundant,
+        DL_tolgRedundant,
+        DL_tolxRedundant,
+        DL_tolfRedundant,
+    };
+
+    for (const auto& constr : clist) {
+        VEC_pD cparams = constr->params();
+        structure.push_back(constr->getTypeId());
+        structure.push_back(constr->getTag());
+        structure.push_back(int(constr->isDriving()));
+        structure.push_back(int(constr->isInternalAlignment()));
+        structure.push_back(int(cparams.size()));
+        values.push_back(constr->error());
+        for (const auto& param : cparams) {
+            auto it = diagnoseIndex.find(param);
+            structure.push_back(it != diagnoseIndex.end() ? it->second : -1);
+            values.push_back(*param);
+        }
+    }
+
+    for (int j = 0; j < int(J.cols()); j++) {
+        for (int i = 0; i < int(J.rows()); i++) {
+            if (J(i, j) != 0.) {
+                structure.push_back(i);
+                structure.push_back(j);
+                values.push_back(J(i, j));
+            }
+        }
+    }
+}
+
+bool System::restoreDiagnosis(
+    const VEC_I& structure,
+    const VEC_D& values,
+    const GCS::VEC_pD& pdiagnoselist
+)
+{
+    auto it = std::ranges::find_if(diagnosisCache, [&](const DiagnosisCacheEntry& entry) {
+        return entry.structure == structure && entry.values == values;
+    });
+    if (it == diagnosisCache.end()) {
+        return false;
+    }
+    diagnosisCache.splice(diagnosisCache.begin(), diagnosisCache, it);
+
+    dofs = it->dofs;
+    conflictingTags = it->conflictingTags;
+    redundantTags = it->redundantTags;
+    partiallyRedundantTags = it->partiallyRedundantTags;
+    for (int index : it->redundant) {
+        redundant.insert(clist[index]);
+    }
+    pDependentParameters.clear();
+    for (int index : it->dependentParameters) {
+        pDependentParameters.push_back(pdiagnoselist[index]);
+    }
+    pDependentParametersGroups.clear();
+    for (const auto& group : it->dependentParametersGroups) {
+        auto& params = pDependentParametersGroups.emplace_back();
+        for (int index : group) {
+            params.push_back(pdiagnoselist[index]);
+        }
+    }
+    return true;
+}
+
+void System::storeDiagnosis(VEC_I&& structure, VEC_D&& values, const GCS::VEC_pD& pdiagnoselist)
+{
+    MAP_pD_I diagnoseIndex;
+    for (int i = 0; i < int(pdiagnoselist.size()); i++) {
+        diagnoseIndex[pdiagnoselist[i]] = i;
+    }
+    std::map<Constraint*, int> constraintIndex;
+    for (int i = 0; i < int(clist.size()); i++) {
+        constraintIndex[clist[i]] = i;
+    }
+
+    DiagnosisCacheEntry entry;
+    entry.structure = std::move(structure);
+    entry.values = std::move(values);
+    entry.dofs = dofs;
+    entry.conflictingTags = conflictingTags;
+    entry.redundantTags = redundantTags;
+    entry.partiallyRedundantTags = partiallyRedundantTags;
+    for (const auto& constr : redundant) {
+        entry.redundant.push_back(constraintIndex.at(constr));
+    }
+    // dependent parameters left over from a diagnosis of another system are not cached
+    auto toIndices = [&diagnoseIndex](const VEC_pD& params, VEC_I& indices) {
+        for (const auto& param : params) {
+            auto it = diagnoseIndex.find(param);
+            if (it == diagnoseIndex.end()) {
+                return false;
+            }
+            indices.push_back(it->second);
+        }
+        return true;
+    };
+    if (!toIndices(pDependentParameters, entry.dependentParameters)) {
+        return;
+    }
+    for (const auto& group : pDependentParametersGroups) {
+        if (!toIndices(group, entry.dependentParametersGroups.emplace_back())) {
+            return;
+        }
+    }
+
+    diagnosisCache.push_front(std::move(entry));
+    if (diagnosisCache.size() > diagnosisCacheSize) {
+        diagnosisCache.pop_back();
+    }
+}
+
 void System::makeDenseQRDecomposition(
     const Eigen::MatrixXd& J,
     const std::map<int, int>& jacobianconstraintmap,
@@ -5690,6 +6048,10 @@ void System::clearSubSystems()
     deleteAllContent(subSystemsAux);
     subSystems.clear();
     subSystemsAux.clear();
+    componentInputs.clear();
+    componentInputValues.clear();
+    componentSolveKeys.clear();
+    componentResults.clear();
 }
 
 double lineSearch(SubSystem* subsys, Eigen::VectorXd& xdir)
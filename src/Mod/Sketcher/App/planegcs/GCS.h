@@ -24,6 +24,8 @@
 
 #pragma once
 
+#include <list>
+
 #include <Eigen/QR>
 
 #include "../../SketcherGlobal.h"
@@ -126,6 +128,17 @@ private:
     std::vector<SubSystem*> subSystems, subSystemsAux;
     void clearSubSystems();
 
+    // For every component the parameters it depends on that are not unknowns (e.g. the
+    // temporary move targets while dragging), their values at the last solve of the
+    // component, the settings of that solve and its result. Components whose inputs did not
+    // change are not solved again, as the result would be the same.
+    std::vector<VEC_pD> componentInputs;
+    std::vector<VEC_D> componentInputValues;
+    std::vector<int> componentSolveKeys;
+    std::vector<int> componentResults;
+    bool isComponentUnchanged(int cid, int solveKey) const;
+    void storeComponentSolve(int cid, int solveKey, int result);
+
     VEC_D reference;
     void setReference();      // copies the current parameter values to reference
     void resetToReference();  // reverts all parameter values to the stored reference
@@ -145,9 +158,41 @@ private:
 
     bool emptyDiagnoseMatrix;  // false only if there is at least one driving constraint.
 
+    // Results of the most recent diagnoses. The sketch rebuilds the system on every recompute,
+    // so entries are matched by content: the settings, the constraints with their tags and
+    // errors, the parameter values and the reduced jacobian. Constraints and parameters are
+    // referred to by their index in clist and pdiagnoselist.
+    struct DiagnosisCacheEntry
+    {
+        VEC_I structure;
+        VEC_D values;
+        int dofs;
+        VEC_I conflictingTags, redundantTags, partiallyRedundantTags;
+        VEC_I redundant;
+        VEC_I dependentParameters;
+        std::vector<VEC_I> dependentParametersGroups;
+    };
+    std::list<DiagnosisCacheEntry> diagnosisCache;
+    static constexpr std::size_t diagnosisCacheSize = 4;
+    void makeDiagnosisKey(
+        Algorithm alg,
+        const Eigen::MatrixXd& J,
+        const GCS::VEC_pD& pdiagnoselist,
+        VEC_I& structure,
+        VEC_D& values
+    );
+    bool restoreDiagnosis(
+        const VEC_I& structure,
+        const VEC_D& values,
+        const GCS::VEC_pD& pdiagnoselist
+    );
+    void storeDiagnosis(VEC_I&& structure, VEC_D&& values, const GCS::VEC_pD& pdiagnoselist);
+
     int solve_BFGS(SubSystem* subsys, bool isFine = true, bool isRedundantsolving = false);
     int solve_LM(SubSystem* subsys, bool isRedundantsolving = false);
     int solve_DL(SubSystem* subsys, bool isRedundantsolving = false);
+    // the gauss-newton step of the DogLeg solver according to dogLegGaussStep
+    Eigen::VectorXd solveDogLegGaussStep(const Eigen::MatrixXd& Jx, const Eigen::VectorXd& fx);
 
     void makeReducedJacobian(
         Eigen::MatrixXd& J,
@@ -241,6 +286,12 @@ public:
     QRAlgorithm qrAlgorithm;
     bool autoChooseAlgorithm;
     int autoQRThreshold;
+    // LM and DogLeg use a sparse Jacobian and sparse factorizations for subsystems
+    // with at least this many parameters, 0 disables the sparse path
+    int sparseSolverThreshold;
+    // independent components are solved concurrently when at least this many of them have to
+    // be solved, 0 disables parallel solving
+    int parallelSolverThreshold;
     DogLegGaussStep dogLegGaussStep;
     double qrpivotThreshold;
     DebugMode debugMode;
@@ -26,6 +26,8 @@
 #if DEBUG_DERIVS
 #endif
 
+#include <array>
+#include <atomic>
 #include <cassert>
 
 #include "Geo.h"
@@ -1076,23 +1078,67 @@ double BSpline::getLinCombFactor(double x, size_t k, size_t i, unsigned int p)
         setupFlattenedKnots();
     }
 
-    std::vector d(p + 1, 0.0);
     // Ensure this is within range
     int idxOfPole = static_cast<int>(i) + p - static_cast<int>(k);
     if (idxOfPole < 0 || idxOfPole > static_cast<int>(p)) {
         return 0.0;
     }
-    d[idxOfPole] = 1.0;
 
-    for (size_t r = 1; r < p + 1; ++r) {
-        for (size_t j = p; j > r - 1; --j) {
-            double alpha = (x - flattenedknots[j + k - p])
-                / (flattenedknots[j + 1 + k - r] - flattenedknots[j + k - p]);
-            d[j] = (1.0 - alpha) * d[j - 1] + alpha * d[j];
+    VEC_D factors;
+    getLinCombFactors(x, k, p, factors);
+    return factors[idxOfPole];
+}
+
+void BSpline::getLinCombFactors(double x, size_t k, unsigned int p, VEC_D& values)
+{
+    if (flattenedknots.empty()) {
+        setupFlattenedKnots();
+    }
+
+    struct CacheEntry
+    {
+        std::size_t knotsId {0};
+        double x {0.0};
+        size_t k {0};
+        unsigned int p {0};
+        VEC_D values;
+    };
+    // Few entries are enough: the constraints using a B-spline at a given parameter are
+    // evaluated one after the other.
+    thread_local std::array<CacheEntry, 4> cache;
+    thread_local std::size_t nextEntry = 0;
+
+    for (const auto& entry : cache) {
+        if (entry.knotsId == flattenedKnotsId && entry.x == x && entry.k == k && entry.p == p) {
+            values = entry.values;
+            return;
         }
     }
 
-    return d[p];
+    // All the non-zero basis functions at once, as in "The NURBS Book", algorithm A2.2.
+    // This gives the same factors as the de Boor algorithm applied to each control point.
+    values.assign(p + 1, 0.0);
+    VEC_D left(p + 1), right(p + 1);
+    values[0] = 1.0;
+    for (unsigned int j = 1; j <= p; ++j) {
+        left[j] = x - flattenedknots[k + 1 - j];
+        right[j] = flattenedknots[k + j] - x;
+        double saved = 0.0;
+        for (unsigned int r = 0; r < j; ++r) {
+            double temp = values[r] / (right[r + 1] + left[j - r]);
+            values[r] = saved + right[r + 1] * temp;
+            saved = left[j - r] * temp;
+        }
+        values[j] = saved;
+    }
+
+    auto& entry = cache[nextEntry];
+    nextEntry = (nextEntry + 1) % cache.size();
+    entry.knotsId = flattenedKnotsId;
+    entry.x = x;
+    entry.k = k;
+    entry.p = p;
+    entry.values = values;
 }
 
 double BSpline::splineValue(double x, size_t k, unsigned int p, VEC_D& d, const VEC_D& flatknots)
@@ -1110,6 +1156,9 @@ double BSpline::splineValue(double x, size_t k, unsigned int p, VEC_D& d, const
 
 void BSpline::setupFlattenedKnots()
 {
+    static std::atomic<std::size_t> lastFlattenedKnotsId {0};
+    flattenedKnotsId = ++lastFlattenedKnotsId;
+
     flattenedknots.clear();
 
     for (size_t i = 0; i < knots.size(); ++i) {
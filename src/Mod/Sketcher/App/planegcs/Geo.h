@@ -376,6 +376,8 @@ public:
     // knot vector with repetitions for multiplicity and "padding" for periodic spline
     // interface helpers
     VEC_D flattenedknots;
+    // identifies the values of flattenedknots in the cache of getLinCombFactors
+    std::size_t flattenedKnotsId {0};
     DeriVector2 CalculateNormal(const Point& p, const double* derivparam = nullptr) const override;
     // TODO: override parametric version
     DeriVector2 CalculateNormal(const double* param, const double* derivparam = nullptr) const override;
@@ -403,6 +405,14 @@ public:
     {
         return getLinCombFactor(x, k, i, degree);
     }
+    /// finds all the factors getLinCombFactor gives for the p + 1 control points k - p to k
+    /// x is the point at which combination is needed
+    /// k is the range in `flattenedknots` that contains x
+    /// p is the degree
+    /// values is resized to p + 1 and receives the factors
+    /// The last evaluations are cached (per thread), so that the constraints on the same B-spline
+    /// at the same parameter, e.g. the x and y point on B-spline constraints, share them.
+    void getLinCombFactors(double x, size_t k, unsigned int p, VEC_D& values);
     void setupFlattenedKnots();
     /// finds spline(x) for the given parameter and knot/pole vector
     /// x is the point at which combination is needed
@@ -26,6 +26,7 @@
 # pragma warning(disable : 4251)
 #endif
 
+#include <algorithm>
 #include <iostream>
 #include <iterator>
 
@@ -114,6 +115,15 @@ void SubSystem::initialize(VEC_pD& params, MAP_pD_pD& reductionmap)
 
     c2p.clear();
     p2c.clear();
+    // evaluating constraints of the same type one after another keeps the
+    // virtual calls predictable when assembling the jacobi matrix
+    evalOrder.resize(csize);
+    for (int i = 0; i < csize; i++) {
+        evalOrder[i] = i;
+    }
+    std::stable_sort(evalOrder.begin(), evalOrder.end(), [this](int a, int b) {
+        return clist[a]->getTypeId() < clist[b]->getTypeId();
+    });
     for (std::vector<Constraint*>::iterator constr = clist.begin(); constr != clist.end(); ++constr) {
         (*constr)->revertParams();  // ensure that the constraint points to the original parameters
         VEC_pD constr_params_orig = (*constr)->params();
@@ -251,14 +261,46 @@ void SubSystem::calcResidual(Eigen::VectorXd& r, double& err)
     err *= 0.5;
 }
 
-void SubSystem::calcJacobi(VEC_pD& params, Eigen::MatrixXd& jacobi)
+int SubSystem::pvalIndex(const double* param) const
 {
-    jacobi.setZero(csize, params.size());
+    // the constraints are redirected to pvals, other parameters are kept fixed
+    if (psize == 0 || param < pvals.data() || param >= pvals.data() + psize) {
+        return -1;
+    }
+    return static_cast<int>(param - pvals.data());
+}
+
+void SubSystem::paramColumns(VEC_pD& params, std::vector<std::vector<int>>& columns)
+{
+    columns.assign(psize, std::vector<int>());
     for (int j = 0; j < int(params.size()); j++) {
         MAP_pD_pD::const_iterator pmapfind = pmap.find(params[j]);
         if (pmapfind != pmap.end()) {
-            for (int i = 0; i < csize; i++) {
-                jacobi(i, j) = clist[i]->grad(pmapfind->second);
+            int k = pvalIndex(pmapfind->second);
+            if (k >= 0) {
+                columns[k].push_back(j);
+            }
+        }
+    }
+}
+
+void SubSystem::calcJacobi(VEC_pD& params, Eigen::MatrixXd& jacobi)
+{
+    jacobi.setZero(csize, params.size());
+    std::vector<std::vector<int>> columns;
+    paramColumns(params, columns);
+    VEC_D derivs;
+    for (int i : evalOrder) {
+        Constraint* constr = clist[i];
+        constr->grads(derivs);
+        const VEC_pD& constr_params = constr->params();
+        for (std::size_t l = 0; l < constr_params.size(); l++) {
+            int k = pvalIndex(constr_params[l]);
+            if (k < 0) {
+                continue;
+            }
+            for (int j : columns[k]) {
+                jacobi(i, j) += derivs[l];
             }
         }
     }
@@ -269,19 +311,46 @@ void SubSystem::calcJacobi(Eigen::MatrixXd& jacobi)
     calcJacobi(plist, jacobi);
 }
 
+void SubSystem::calcJacobi(Eigen::SparseMatrix<double>& jacobi)
+{
+    std::vector<Eigen::Triplet<double>> triplets;
+    VEC_D derivs;
+    for (int i : evalOrder) {
+        Constraint* constr = clist[i];
+        constr->grads(derivs);
+        const VEC_pD& constr_params = constr->params();
+        for (std::size_t l = 0; l < constr_params.size(); l++) {
+            // the column is the offset of the parameter in pvals, duplicates are summed up
+            int j = pvalIndex(constr_params[l]);
+            if (j >= 0) {
+                triplets.emplace_back(i, j, derivs[l]);
+            }
+        }
+    }
+    jacobi.resize(csize, psize);
+    jacobi.setFromTriplets(triplets.begin(), triplets.end());
+}
+
 void SubSystem::calcGrad(VEC_pD& params, Eigen::VectorXd& grad)
 {
     assert(grad.size() == int(params.size()));
 
     grad.setZero();
-    for (int j = 0; j < int(params.size()); j++) {
-        MAP_pD_pD::const_iterator pmapfind = pmap.find(params[j]);
-        if (pmapfind != pmap.end()) {
-            std::vector<Constraint*> constrs = p2c[pmapfind->second];
-            for (std::vector<Constraint*>::const_iterator constr = constrs.begin();
-                 constr != constrs.end();
-                 ++constr) {
-                grad[j] += (*constr)->error() * (*constr)->grad(pmapfind->second);
+    std::vector<std::vector<int>> columns;
+    paramColumns(params, columns);
+    VEC_D derivs;
+    for (int i : evalOrder) {
+        Constraint* constr = clist[i];
+        double err = constr->error();
+        constr->grads(derivs);
+        const VEC_pD& constr_params = constr->params();
+        for (std::size_t l = 0; l < constr_params.size(); l++) {
+            int k = pvalIndex(constr_params[l]);
+            if (k < 0) {
+                continue;
+            }
+            for (int j : columns[k]) {
+                grad[j] += err * derivs[l];
             }
         }
     }
@@ -28,6 +28,7 @@
 #undef max
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include "Constraints.h"
 
@@ -46,7 +47,12 @@ private:
                      //        JacobianMatrix jacobi;  // jacobi matrix of the residuals
     std::map<Constraint*, VEC_pD> c2p;                // constraint to parameter adjacency list
     std::map<double*, std::vector<Constraint*>> p2c;  // parameter to constraint adjacency list
+    std::vector<int> evalOrder;  // constraint rows grouped by constraint type for evaluation
     void initialize(VEC_pD& params, MAP_pD_pD& reductionmap);  // called by the constructors
+    // columns of params for each entry of pvals, used to scatter Constraint::grads()
+    void paramColumns(VEC_pD& params, std::vector<std::vector<int>>& columns);
+    // index of a redirected parameter in pvals, or -1 if it is not a parameter of the subsystem
+    int pvalIndex(const double* param) const;
 public:
     SubSystem(std::vector<Constraint*>& clist_, VEC_pD& params);
     SubSystem(std::vector<Constraint*>& clist_, VEC_pD& params, MAP_pD_pD& reductionmap);
@@ -79,6 +85,8 @@ public:
     void calcResidual(Eigen::VectorXd& r, double& err);
     void calcJacobi(VEC_pD& params, Eigen::MatrixXd& jacobi);
     void calcJacobi(Eigen::MatrixXd& jacobi);
+    // same as calcJacobi(jacobi) but only evaluates the non-zero entries given by c2p
+    void calcJacobi(Eigen::SparseMatrix<double>& jacobi);
     void calcGrad(VEC_pD& params, Eigen::VectorXd& grad);
     void calcGrad(Eigen::VectorXd& grad);
 
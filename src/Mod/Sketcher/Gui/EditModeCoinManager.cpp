@@ -466,6 +466,7 @@ void EditModeCoinManager::ParameterObserver::OnChange(
 
         function(string);
 
+        Client.pEditModeConstraintCoinManager->invalidateConstraintNodes();
         Client.redrawViewProvider();  // redraw with non-temporal geometry
     }
 }
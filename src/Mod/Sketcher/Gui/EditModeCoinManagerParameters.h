@@ -42,6 +42,7 @@
 #include <Inventor/nodes/SoTranslation.h>
 
 #include <Base/Color.h>
+#include <Base/Vector3D.h>
 #include <Gui/ViewParams.h>
 #include <Gui/Inventor/SmSwitchboard.h>
 #include <Mod/Sketcher/App/GeoList.h>
@@ -591,4 +592,26 @@ struct CoinMapping
     std::map<Sketcher::GeoElementId, MultiFieldId> GeoElementId2SetId;
 };
 
+/** @brief      Helper struct keeping the discretisation of curved geometry between draws.
+ *
+ * Entries are indexed by GeoId and reused as long as the geometry and the number of segments did
+ * not change, so that the geometry that does not move while dragging is not discretised again.
+ */
+struct GeometryDiscretisationCache
+{
+    struct Entry
+    {
+        std::vector<double> key;
+        std::vector<Base::Vector3d> coords;
+        double combRepresentationScale = 0;
+    };
+
+    void clear()
+    {
+        entries.clear();
+    }
+
+    std::map<int, Entry> entries;
+};
+
 }  // namespace SketcherGui
@@ -144,6 +144,8 @@ Restart:
         rebuildConstraintNodes(geolistfacade);
     }
 
+    vConstrDrawKey.resize(constrlist.size());
+
     assert(int(constrlist.size()) == editModeScenegraphNodes.constrGroup->getNumChildren());
     assert(int(vConstrType.size()) == editModeScenegraphNodes.constrGroup->getNumChildren());
 
@@ -205,6 +207,13 @@ Restart:
                 continue;
             }
 
+            // nothing to update if neither the constraint nor its geometry changed
+            auto drawKey = getConstraintDrawKey(Constr, geolistfacade, zConstrH);
+            if (drawKey == vConstrDrawKey[i]) {
+                continue;
+            }
+            vConstrDrawKey[i].first.clear();
+
             // distinguish different constraint types to build up
             switch (Constr->Type) {
                 case Block:
@@ -1590,6 +1599,8 @@ Restart:
                 case NumConstraintTypes:
                     break;
             }
+
+            vConstrDrawKey[i] = std::move(drawKey);
         }
         catch (Base::Exception& e) {
             Base::Console().developerError(
@@ -1645,6 +1656,46 @@ void EditModeConstraintCoinManager::findHelperAngles(
     }
 }
 
+EditModeConstraintCoinManager::ConstraintDrawKey EditModeConstraintCoinManager::getConstraintDrawKey(
+    const Sketcher::Constraint* constraint,
+    const GeoListFacade& geolistfacade,
+    double zConstrH
+) const
+{
+    std::vector<double> values {
+        static_cast<double>(constraint->Type),
+        static_cast<double>(constraint->First),
+        static_cast<double>(constraint->FirstPos),
+        static_cast<double>(constraint->Second),
+        static_cast<double>(constraint->SecondPos),
+        static_cast<double>(constraint->Third),
+        static_cast<double>(constraint->ThirdPos),
+        constraint->getValue(),
+        static_cast<double>(constraint->LabelDistance),
+        static_cast<double>(constraint->LabelPosition),
+        static_cast<double>(constraint->isActive),
+        static_cast<double>(constraint->isDriving),
+        static_cast<double>(constraint->isInVirtualSpace),
+        zConstrH
+    };
+
+    for (int geoId : {constraint->First, constraint->Second, constraint->Third}) {
+        if (geoId == GeoEnum::GeoUndef) {
+            continue;
+        }
+        auto geoKey = getGeometryFingerprint(geolistfacade.getGeometryFromGeoId(geoId));
+        values.push_back(static_cast<double>(geoKey.size()));
+        values.insert(values.end(), geoKey.begin(), geoKey.end());
+    }
+
+    return {std::move(values), constraint->Name};
+}
+
+void EditModeConstraintCoinManager::invalidateConstraintNodes()
+{
+    vConstrDrawKey.clear();
+}
+
 Base::Vector3d EditModeConstraintCoinManager::seekConstraintPosition(
     const Base::Vector3d& norm,
     float step
@@ -1871,6 +1922,9 @@ void EditModeConstraintCoinManager::rebuildConstraintNodes(
     SbVec3f norm
 )
 {
+    // the new nodes have not been drawn yet
+    vConstrDrawKey.clear();
+    coinIconKeys.clear();
 
     for (std::vector<Sketcher::Constraint*>::const_iterator it = constrlist.begin();
          it != constrlist.end();
@@ -2682,9 +2736,62 @@ void EditModeConstraintCoinManager::drawMergedConstraintIcons(IconQueue iconQueu
 }
 
 
+QImage EditModeConstraintCoinManager::renderConstrIcon(
+    const QString& type,
+    const QColor& iconColor,
+    const QStringList& labels,
+    const QList<QColor>& labelColors,
+    double iconRotation,
+    std::vector<QRect>* boundingBoxes,
+    int* vPad
+)
+{
+    QString key = QStringLiteral("%1|%2|%3|%4|%5")
+                      .arg(type)
+                      .arg(drawingParameters.constraintIconSize)
+                      .arg(iconRotation)
+                      .arg(iconColor.rgba())
+                      .arg(ViewProviderSketchCoinAttorney::getApplicationFont(viewProvider).key());
+    for (int i = 0; i < labels.size() && i < labelColors.size(); ++i) {
+        key += QStringLiteral("|%1|%2").arg(labelColors[i].rgba()).arg(labels[i]);
+    }
+
+    auto it = paintedConstrIcons.find(key);
+    if (it == paintedConstrIcons.end()) {
+        // Many constraints share a few distinct icons, don't let renamed or
+        // recolored ones pile up
+        if (paintedConstrIcons.size() > 2000) {
+            paintedConstrIcons.clear();
+        }
+        PaintedConstrIcon icon;
+        icon.image = paintConstrIcon(
+            type,
+            iconColor,
+            labels,
+            labelColors,
+            iconRotation,
+            &icon.boundingBoxes,
+            &icon.vPad
+        );
+        it = paintedConstrIcons.emplace(key, std::move(icon)).first;
+    }
+
+    if (boundingBoxes) {
+        boundingBoxes->insert(
+            boundingBoxes->end(),
+            it->second.boundingBoxes.begin(),
+            it->second.boundingBoxes.end()
+        );
+    }
+    if (vPad) {
+        *vPad = it->second.vPad;
+    }
+    return it->second.image;
+}
+
 /// Note: labels, labelColors, and boundingBoxes are all
 /// assumed to be the same length.
-QImage EditModeConstraintCoinManager::renderConstrIcon(
+QImage EditModeConstraintCoinManager::paintConstrIcon(
     const QString& type,
     const QColor& iconColor,
     const QStringList& labels,
@@ -2835,6 +2942,12 @@ QString EditModeConstraintCoinManager::iconTypeFromConstraint(Constraint* constr
 
 void EditModeConstraintCoinManager::sendConstraintIconToCoin(const QImage& icon, SoImage* soImagePtr)
 {
+    auto it = coinIconKeys.find(soImagePtr);
+    if (it != coinIconKeys.end() && it->second == icon.cacheKey()) {
+        return;
+    }
+    coinIconKeys[soImagePtr] = icon.cacheKey();
+
     SoSFImage icondata = SoSFImage();
 
     Gui::BitmapFactory().convert(icon, icondata);
@@ -2851,6 +2964,7 @@ void EditModeConstraintCoinManager::sendConstraintIconToCoin(const QImage& icon,
 
 void EditModeConstraintCoinManager::clearCoinImage(SoImage* soImagePtr)
 {
+    coinIconKeys.erase(soImagePtr);
     soImagePtr->setToDefaults();
 }
 
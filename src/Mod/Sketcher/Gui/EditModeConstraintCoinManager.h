@@ -25,6 +25,8 @@
 #pragma once
 
 #include <functional>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include <QColor>
@@ -134,6 +136,10 @@ public:
     void setConstraintSelectability(bool enabled = true);
     //@}
 
+    /// Forces the next processConstraints to update the nodes of every constraint, for changes
+    /// that are not part of the constraint or its geometry (e.g. the drawing parameters).
+    void invalidateConstraintNodes();
+
     std::set<int> detectPreselectionConstr(const SoPickedPoint* Point);
 
     SoSeparator* getConstraintIdSeparator(int i);
@@ -149,6 +155,14 @@ private:
         SbVec3f norm
     );
 
+    /// Values the coin nodes of a constraint are calculated from
+    using ConstraintDrawKey = std::pair<std::vector<double>, std::string>;
+    ConstraintDrawKey getConstraintDrawKey(
+        const Sketcher::Constraint* constraint,
+        const GeoListFacade& geolistfacade,
+        double zConstrH
+    ) const;
+
     /// finds a free position for placing a constraint icon
     Base::Vector3d seekConstraintPosition(const Base::Vector3d& norm, float step);
 
@@ -178,6 +192,10 @@ private:
     // helper data structures for the constraint rendering
     std::vector<Sketcher::ConstraintType> vConstrType;
 
+    // values each constraint was last drawn with, constraints whose values did not change since
+    // are not updated
+    std::vector<ConstraintDrawKey> vConstrDrawKey;
+
     // For each of the combined constraint icons drawn, also create a vector
     // of bounding boxes and associated constraint IDs, to go from the icon's
     // pixel coordinates to the relevant constraint IDs.
@@ -192,6 +210,21 @@ private:
 
     std::map<QString, ConstrIconBBVec> combinedConstrBoxes;
 
+    /// A constraint icon painted by paintConstrIcon()
+    struct PaintedConstrIcon
+    {
+        QImage image;
+        std::vector<QRect> boundingBoxes;
+        int vPad;
+    };
+
+    // Icons painted so far, by their type, colors, labels and rotation
+    std::map<QString, PaintedConstrIcon> paintedConstrIcons;
+
+    // QImage::cacheKey() of the icon last sent to each SoImage, an unchanged
+    // icon is not sent again, which would upload its texture again
+    std::map<SoImage*, qint64> coinIconKeys;
+
 
     /// Internal type used for drawing constraint icons
     struct constrIconQueueItem
@@ -232,6 +265,9 @@ private:
     void drawMergedConstraintIcons(IconQueue iconQueue);
 
     /// Helper for drawMergedConstraintIcons and drawTypicalConstraintIcon
+    /*! The icons are kept, so that redrawing the constraints only paints
+     *  the icons whose colors or labels changed.
+     */
     QImage renderConstrIcon(
         const QString& type,
         const QColor& iconColor,
@@ -247,6 +283,17 @@ private:
         int* vPad = nullptr
     );
 
+    /// Paints the icon returned by renderConstrIcon()
+    QImage paintConstrIcon(
+        const QString& type,
+        const QColor& iconColor,
+        const QStringList& labels,
+        const QList<QColor>& labelColors,
+        double iconRotation,
+        std::vector<QRect>* boundingBoxes,
+        int* vPad
+    );
+
     /// Copies a QImage constraint icon into a SoImage*
     /*! Used by drawTypicalConstraintIcon() and drawMergedConstraintIcons() */
     void sendConstraintIconToCoin(const QImage& icon, SoImage* soImagePtr);
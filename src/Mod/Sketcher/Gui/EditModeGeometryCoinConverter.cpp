@@ -41,13 +41,15 @@ EditModeGeometryCoinConverter::EditModeGeometryCoinConverter(
     GeometryLayerNodes& geometrylayernodes,
     DrawingParameters& drawingparameters,
     GeometryLayerParameters& geometryLayerParams,
-    CoinMapping& coinMap
+    CoinMapping& coinMap,
+    GeometryDiscretisationCache& discretisationcache
 )
     : viewProvider(vp)
     , geometryLayerNodes(geometrylayernodes)
     , drawingParameters(drawingparameters)
     , geometryLayerParameters(geometryLayerParams)
     , coinMapping(coinMap)
+    , discretisationCache(discretisationcache)
 {}
 
 void EditModeGeometryCoinConverter::convert(const Sketcher::GeoListFacade& geolistfacade)
@@ -282,18 +284,53 @@ void EditModeGeometryCoinConverter::convert(const Sketcher::GeoListFacade& geoli
     double linez = vOrFactor * static_cast<double>(drawingParameters.zLowLines);  // NOLINT
     double pointz = vOrFactor * static_cast<double>(drawingParameters.zLowPoints);
 
-    for (auto l = 0; l < geometryLayerParameters.getCoinLayerCount(); l++) {
-        geometryLayerNodes.PointsCoordinate[l]->point.setNum(Points[l].size());
-        geometryLayerNodes.PointsMaterials[l]->diffuseColor.setNum(Points[l].size());
-        SbVec3f* pverts = geometryLayerNodes.PointsCoordinate[l]->point.startEditing();
+    // Fields whose content did not change are not touched, so that their nodes are not notified
+    // and Coin keeps the render caches of the layers that did not move.
+    auto sameCoords = [](const SoMFVec3f& field, const std::vector<Base::Vector3d>& coords, double z) {
+        if (field.getNum() != static_cast<int>(coords.size())) {
+            return false;
+        }
+        const SbVec3f* values = field.getValues(0);
+        for (std::size_t i = 0; i < coords.size(); i++) {
+            if (values[i] != SbVec3f(coords[i].x, coords[i].y, z)) {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto sameIndex = [](const SoMFInt32& field, const std::vector<unsigned int>& index) {
+        if (field.getNum() != static_cast<int>(index.size())) {
+            return false;
+        }
+        const int32_t* values = field.getValues(0);
+        for (std::size_t i = 0; i < index.size(); i++) {
+            if (values[i] != static_cast<int32_t>(index[i])) {
+                return false;
+            }
+        }
+        return true;
+    };
 
-        int i = 0;  // setting up the point set
-        for (auto& point : Points[l]) {
-            pverts[i++].setValue(point.x, point.y, pointz);
+    for (auto l = 0; l < geometryLayerParameters.getCoinLayerCount(); l++) {
+        int i = 0;
+        if (!sameCoords(geometryLayerNodes.PointsCoordinate[l]->point, Points[l], pointz)) {
+            geometryLayerNodes.PointsCoordinate[l]->point.setNum(Points[l].size());
+            geometryLayerNodes.PointsMaterials[l]->diffuseColor.setNum(Points[l].size());
+            SbVec3f* pverts = geometryLayerNodes.PointsCoordinate[l]->point.startEditing();
+
+            // setting up the point set
+            for (auto& point : Points[l]) {
+                pverts[i++].setValue(point.x, point.y, pointz);
+            }
+            geometryLayerNodes.PointsCoordinate[l]->point.finishEditing();
         }
-        geometryLayerNodes.PointsCoordinate[l]->point.finishEditing();
 
         for (auto t = 0; t < geometryLayerParameters.getSubLayerCount(); t++) {
+            if (sameCoords(geometryLayerNodes.CurvesCoordinate[l][t]->point, Coords[l][t], linez)
+                && sameIndex(geometryLayerNodes.CurveSet[l][t]->numVertices, Index[l][t])) {
+                continue;
+            }
+
             geometryLayerNodes.CurvesCoordinate[l][t]->point.setNum(Coords[l][t].size());
             geometryLayerNodes.CurveSet[l][t]->numVertices.setNum(Index[l][t].size());
             geometryLayerNodes.CurvesMaterials[l][t]->diffuseColor.setNum(Index[l][t].size());
@@ -361,6 +398,24 @@ void EditModeGeometryCoinConverter::convert(
     }
 
     // Curves
+    std::vector<double> key;
+    [[maybe_unused]] std::size_t firstCoord = Coords[coinLayer][subLayer].size();
+    [[maybe_unused]] double curveRepScale = 0;
+    if constexpr (curvemode == CurveMode::ClosedCurve || curvemode == CurveMode::OpenCurve) {
+        // reuse the discretisation of the previous draw if the curve did not change
+        key = Sketcher::getGeometryFingerprint(geo);
+        key.push_back(drawingParameters.curvedEdgeCountSegments);
+        auto cached = discretisationCache.entries.find(geoid);
+        if (cached != discretisationCache.entries.end() && cached->second.key == key) {
+            for (const auto& pnt : cached->second.coords) {
+                addPoint(Coords[coinLayer][subLayer], pnt);
+            }
+            Index[coinLayer][subLayer].push_back(cached->second.coords.size());
+            combrepscale = std::max(combrepscale, cached->second.combRepresentationScale);
+            return;
+        }
+    }
+
     if constexpr (curvemode == CurveMode::StartEndPointsOnly) {
         addPoint(Coords[coinLayer][subLayer], geo->getStartPoint());
         addPoint(Coords[coinLayer][subLayer], geo->getEndPoint());
@@ -470,8 +525,19 @@ void EditModeGeometryCoinConverter::convert(
             if (temprepscale > combrepscale) {
                 combrepscale = temprepscale;
             }
+            curveRepScale = temprepscale;
         }
     }
+
+    if constexpr (curvemode == CurveMode::ClosedCurve || curvemode == CurveMode::OpenCurve) {
+        auto& entry = discretisationCache.entries[geoid];
+        entry.key = std::move(key);
+        entry.coords.assign(
+            Coords[coinLayer][subLayer].begin() + firstCoord,
+            Coords[coinLayer][subLayer].end()
+        );
+        entry.combRepresentationScale = curveRepScale;
+    }
 }
 
 float EditModeGeometryCoinConverter::getBoundingBoxMaxMagnitude()
@@ -55,6 +55,7 @@ struct GeometryLayerNodes;
 struct DrawingParameters;
 class GeometryLayerParameters;
 struct CoinMapping;
+struct GeometryDiscretisationCache;
 
 /** @brief      Class for creating the Geometry layer into coin nodes
  *  @details
@@ -109,13 +110,17 @@ public:
      * the geometry
      *
      * @param drawingparameters: Parameters for drawing the overlay information
+     *
+     * @param discretisationcache: Discretisation of curves of previous conversions, reused for
+     * unchanged curves and updated for the others
      */
     EditModeGeometryCoinConverter(
         ViewProviderSketch& vp,
         GeometryLayerNodes& geometrylayernodes,
         DrawingParameters& drawingparameters,
         GeometryLayerParameters& geometryLayerParams,
-        CoinMapping& coinMap
+        CoinMapping& coinMap,
+        GeometryDiscretisationCache& discretisationcache
     );
 
     /**
@@ -182,6 +187,7 @@ private:
     GeometryLayerParameters& geometryLayerParameters;
     // Mappings coin geoId
     CoinMapping& coinMapping;
+    GeometryDiscretisationCache& discretisationCache;
 
     // measurements
     float boundingBoxMaxMagnitude = 100;
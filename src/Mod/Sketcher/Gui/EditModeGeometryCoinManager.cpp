@@ -112,7 +112,8 @@ void EditModeGeometryCoinManager::processGeometry(const GeoListFacade& geolistfa
         geometrylayernodes,
         drawingParameters,
         geometryLayerParameters,
-        coinMapping
+        coinMapping,
+        discretisationCache
     );
 
     gcconv.convert(geolistfacade);
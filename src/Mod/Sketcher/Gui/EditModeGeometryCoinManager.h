@@ -125,6 +125,9 @@ private:
     EditModeScenegraphNodes& editModeScenegraphNodes;
 
     CoinMapping& coinMapping;
+
+    // discretised curves of the previous draw, reused for the geometry that did not change
+    GeometryDiscretisationCache discretisationCache;
 };
 
 
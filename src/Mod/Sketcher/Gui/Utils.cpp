@@ -117,6 +117,83 @@ std::tuple<double, Base::Vector3d> Sketcher::getRadiusCenterCircleArc(const Part
     THROWM(Base::TypeError, "getRadiusCenterCircleArc - Neither an arc nor a circle")
 };
 
+std::vector<double> Sketcher::getGeometryFingerprint(const Part::Geometry* geo)
+{
+    std::vector<double> values {static_cast<double>(geo->getTypeId().getKey())};
+    auto addVector = [&values](const Base::Vector3d& vec) {
+        values.insert(values.end(), {vec.x, vec.y, vec.z});
+    };
+    auto addRadii = [&values](const Part::Geometry* geo) {
+        if (auto circle = dynamic_cast<const Part::GeomCircle*>(geo)) {
+            values.push_back(circle->getRadius());
+        }
+        else if (auto arc = dynamic_cast<const Part::GeomArcOfCircle*>(geo)) {
+            values.push_back(arc->getRadius());
+        }
+        else if (auto ellipse = dynamic_cast<const Part::GeomEllipse*>(geo)) {
+            values.insert(values.end(), {ellipse->getMajorRadius(), ellipse->getMinorRadius()});
+        }
+        else if (auto arc = dynamic_cast<const Part::GeomArcOfEllipse*>(geo)) {
+            values.insert(values.end(), {arc->getMajorRadius(), arc->getMinorRadius()});
+        }
+        else if (auto hyperbola = dynamic_cast<const Part::GeomHyperbola*>(geo)) {
+            values.insert(values.end(), {hyperbola->getMajorRadius(), hyperbola->getMinorRadius()});
+        }
+        else if (auto arc = dynamic_cast<const Part::GeomArcOfHyperbola*>(geo)) {
+            values.insert(values.end(), {arc->getMajorRadius(), arc->getMinorRadius()});
+        }
+        else if (auto parabola = dynamic_cast<const Part::GeomParabola*>(geo)) {
+            values.push_back(parabola->getFocal());
+        }
+        else if (auto arc = dynamic_cast<const Part::GeomArcOfParabola*>(geo)) {
+            values.push_back(arc->getFocal());
+        }
+    };
+
+    if (auto point = dynamic_cast<const Part::GeomPoint*>(geo)) {
+        addVector(point->getPoint());
+    }
+    else if (auto line = dynamic_cast<const Part::GeomLineSegment*>(geo)) {
+        addVector(line->getStartPoint());
+        addVector(line->getEndPoint());
+    }
+    else if (auto conic = dynamic_cast<const Part::GeomConic*>(geo)) {
+        addVector(conic->getCenter());
+        values.push_back(conic->getAngleXU());
+        values.push_back(conic->isReversed() ? 1.0 : 0.0);
+        addRadii(geo);
+    }
+    else if (auto arc = dynamic_cast<const Part::GeomArcOfConic*>(geo)) {
+        double first, last;
+        arc->getRange(first, last, /*emulateCCWXY=*/false);
+        addVector(arc->getCenter());
+        values.insert(values.end(), {arc->getAngleXU(), arc->isReversed() ? 1.0 : 0.0, first, last});
+        addRadii(geo);
+    }
+    else if (auto bspline = dynamic_cast<const Part::GeomBSplineCurve*>(geo)) {
+        auto poles = bspline->getPoles();
+        auto weights = bspline->getWeights();
+        auto knots = bspline->getKnots();
+        values.push_back(static_cast<double>(poles.size()));
+        values.push_back(static_cast<double>(knots.size()));
+        for (const auto& pole : poles) {
+            addVector(pole);
+        }
+        values.insert(values.end(), weights.begin(), weights.end());
+        values.insert(values.end(), knots.begin(), knots.end());
+        for (int multiplicity : bspline->getMultiplicities()) {
+            values.push_back(multiplicity);
+        }
+        values.push_back(bspline->getDegree());
+        values.push_back(bspline->isPeriodic() ? 1.0 : 0.0);
+    }
+    else {
+        values.clear();
+    }
+
+    return values;
+}
+
 bool SketcherGui::tryAutoRecompute(Sketcher::SketchObject* obj, bool& autoremoveredundants)
 {
     ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
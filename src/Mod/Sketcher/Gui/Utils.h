@@ -69,6 +69,10 @@ bool isCircleOrArc(const Part::Geometry& geo);
 
 std::tuple<double, Base::Vector3d> getRadiusCenterCircleArc(const Part::Geometry* geo);
 
+/// Values defining the type, shape and placement of the geometry, used to detect which geometry
+/// changed between two draws. Returns an empty vector for types that are not drawn.
+std::vector<double> getGeometryFingerprint(const Part::Geometry* geo);
+
 }  // namespace Sketcher
 
 namespace SketcherGui
@@ -225,10 +225,10 @@ std::vector<CellAddress> PropertySheet::getNonEmptyCells() const
 {
     std::vector<CellAddress> usedSet;
 
-    std::string str;
+    // Cells with an expression always have a non-empty string content, so
+    // there is no need to format it
     for (const auto& i : data) {
-        str.clear();
-        if (i.second->isUsed() && i.second->getStringContent(str) && !str.empty()) {
+        if (i.second->isUsed() && i.second->getExpression()) {
             usedSet.push_back(i.first);
         }
     }
@@ -775,9 +775,7 @@ void PropertySheet::setAlias(CellAddress address, const std::string& alias)
      * disappears */
     std::string fullName = owner->getFullName() + "." + address.toString();
 
-    std::map<std::string, std::set<CellAddress>>::const_iterator j = propertyNameToCellMap.find(
-        fullName
-    );
+    auto j = propertyNameToCellMap.find(fullName);
     if (j != propertyNameToCellMap.end()) {
         std::set<CellAddress>::const_iterator k = j->second.begin();
 
@@ -1406,13 +1404,13 @@ void PropertySheet::removeDependencies(CellAddress key)
 {
     /* Remove from Property <-> Key maps */
 
-    std::map<CellAddress, std::set<std::string>>::iterator i1 = cellToPropertyNameMap.find(key);
+    auto i1 = cellToPropertyNameMap.find(key);
 
     if (i1 != cellToPropertyNameMap.end()) {
         std::set<std::string>::const_iterator j = i1->second.begin();
 
         while (j != i1->second.end()) {
-            std::map<std::string, std::set<CellAddress>>::iterator k = propertyNameToCellMap.find(*j);
+            auto k = propertyNameToCellMap.find(*j);
 
             // assert(k != propertyNameToCellMap.end());
             if (k != propertyNameToCellMap.end()) {
@@ -1426,13 +1424,13 @@ void PropertySheet::removeDependencies(CellAddress key)
 
     /* Remove from DocumentObject <-> Key maps */
 
-    std::map<CellAddress, std::set<std::string>>::iterator i2 = cellToDocumentObjectMap.find(key);
+    auto i2 = cellToDocumentObjectMap.find(key);
 
     if (i2 != cellToDocumentObjectMap.end()) {
         std::set<std::string>::const_iterator j = i2->second.begin();
 
         while (j != i2->second.end()) {
-            std::map<std::string, std::set<CellAddress>>::iterator k = documentObjectToCellMap.find(*j);
+            auto k = documentObjectToCellMap.find(*j);
 
             if (k != documentObjectToCellMap.end()) {
                 k->second.erase(key);
@@ -1619,7 +1617,7 @@ void PropertySheet::documentSet()
 const std::set<CellAddress>& PropertySheet::getDeps(const std::string& name) const
 {
     static std::set<CellAddress> empty;
-    std::map<std::string, std::set<CellAddress>>::const_iterator i = propertyNameToCellMap.find(name);
+    auto i = propertyNameToCellMap.find(name);
 
     if (i != propertyNameToCellMap.end()) {
         return i->second;
@@ -1632,7 +1630,7 @@ const std::set<CellAddress>& PropertySheet::getDeps(const std::string& name) con
 const std::set<std::string>& PropertySheet::getDeps(CellAddress pos) const
 {
     static std::set<std::string> empty;
-    std::map<CellAddress, std::set<std::string>>::const_iterator i = cellToPropertyNameMap.find(pos);
+    auto i = cellToPropertyNameMap.find(pos);
 
     if (i != cellToPropertyNameMap.end()) {
         return i->second;
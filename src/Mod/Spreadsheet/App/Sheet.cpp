@@ -24,8 +24,10 @@
 
 #include <boost/tokenizer.hpp>
 #include <boost/regex.hpp>
+#include <algorithm>
 #include <deque>
 #include <memory>
+#include <numeric>
 #include <sstream>
 #include <tuple>
 #include <list>
@@ -36,6 +38,8 @@
 
 #include <boost_graph_adjacency_list.hpp>
 #include <boost/graph/topological_sort.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <QtConcurrentMap>
 
 #include <App/Application.h>
 #include <App/Document.h>
@@ -73,6 +77,31 @@ using Traits = boost::graph_traits<DependencyList>;
 using Vertex = Traits::vertex_descriptor;
 using Edge = Traits::edge_descriptor;
 
+/**
+ * Group the vertices of \a graph by the length of the longest dependency chain
+ * leading to them. \a order is a topological order of the graph.
+ */
+static std::vector<std::vector<Vertex>> dependencyLevels(
+    const DependencyList& graph,
+    const std::list<Vertex>& order
+)
+{
+    std::vector<std::size_t> vertexLevels(boost::num_vertices(graph), 0);
+    std::vector<std::vector<Vertex>> levels;
+    for (auto vertex : order) {
+        std::size_t level = vertexLevels[vertex];
+        if (level >= levels.size()) {
+            levels.resize(level + 1);
+        }
+        levels[level].push_back(vertex);
+        for (auto edge : boost::make_iterator_range(boost::out_edges(vertex, graph))) {
+            auto target = boost::target(edge, graph);
+            vertexLevels[target] = std::max(vertexLevels[target], level + 1);
+        }
+    }
+    return levels;
+}
+
 /**
  * Construct a new Sheet object.
  */
@@ -222,7 +251,6 @@ bool Sheet::importFromFile(const std::string& filename, char delimiter, char quo
 {
     Base::FileInfo fi(filename);
     Base::ifstream file(fi, std::ios::in);
-    int row = 0;
 
     PropertySheet::AtomicPropertyChange signaller(cells);
 
@@ -230,13 +258,14 @@ bool Sheet::importFromFile(const std::string& filename, char delimiter, char quo
 
     if (file.is_open()) {
         std::string line;
+        std::vector<std::vector<std::string>> contents;
+        bool result = true;
 
         while (std::getline(file, line)) {
             using namespace boost;
 
             try {
                 escaped_list_separator<char> e;
-                int col = 0;
 
                 if (quoteChar) {
                     e = escaped_list_separator<char>(escapeChar, delimiter, quoteChar);
@@ -246,26 +275,19 @@ bool Sheet::importFromFile(const std::string& filename, char delimiter, char quo
                 }
 
                 tokenizer<escaped_list_separator<char>> tok(line, e);
-
-                for (tokenizer<escaped_list_separator<char>>::iterator i = tok.begin();
-                     i != tok.end();
-                     ++i) {
-                    if (!i->empty()) {
-                        setCell(CellAddress(row, col), (*i).c_str());
-                    }
-                    col++;
-                }
+                contents.emplace_back(tok.begin(), tok.end());
             }
             catch (...) {
-                signaller.tryInvoke();
-                return false;
+                result = false;
+                break;
             }
-
-            ++row;
         }
         file.close();
+
+        // The cells read so far are set even if the file could not be read completely
+        setCells(CellAddress(0, 0), contents);
         signaller.tryInvoke();
-        return true;
+        return result;
     }
     else {
         return false;
@@ -479,6 +501,57 @@ void Sheet::setCell(CellAddress address, const char* value)
     setContent(address, value);
 }
 
+/**
+ * Set the cells of the block starting at \a address to \a contents. The cells
+ * are set in one property change, so the dependencies are updated only once.
+ * Empty strings clear the cell.
+ *
+ * @param address  Address of the top left cell of the block.
+ * @param contents The rows of the block, each one holding the contents of its cells.
+ *
+ */
+
+void Sheet::setCells(CellAddress address, const std::vector<std::vector<std::string>>& contents)
+{
+    PropertySheet::AtomicPropertyChange signaller(cells);
+
+    int row = address.row();
+    for (const auto& rowContents : contents) {
+        int col = address.col();
+        for (const auto& content : rowContents) {
+            setCell(CellAddress(row, col), content.c_str());
+            ++col;
+        }
+        ++row;
+    }
+    signaller.tryInvoke();
+}
+
+/**
+ * Get the contents of the cells in \a range, as set by setCells().
+ *
+ * @param range Range of the cells.
+ *
+ * @returns The contents of the cells, row by row. Empty cells give empty strings.
+ */
+
+std::vector<std::vector<std::string>> Sheet::getCellContents(const Range& range) const
+{
+    std::vector<std::vector<std::string>> contents(
+        range.rowCount(),
+        std::vector<std::string>(range.colCount())
+    );
+    for (int row = 0; row < range.rowCount(); ++row) {
+        for (int col = 0; col < range.colCount(); ++col) {
+            CellAddress address(range.from().row() + row, range.from().col() + col);
+            if (const Cell* cell = getCell(address)) {
+                cell->getStringContent(contents[row][col]);
+            }
+        }
+    }
+    return contents;
+}
+
 /**
  * Get the Python object for the Sheet.
  *
@@ -610,6 +683,10 @@ Property* Sheet::setFloatProperty(CellAddress key, double value)
     }
     else {
         floatProp = static_cast<PropertyFloat*>(prop);
+        // Do not touch the dependents of unchanged cells
+        if (floatProp->getValue() == value) {
+            return floatProp;
+        }
     }
 
     propAddress[floatProp] = key;
@@ -639,6 +716,9 @@ Property* Sheet::setIntegerProperty(CellAddress key, long value)
     }
     else {
         intProp = static_cast<PropertyInteger*>(prop);
+        if (intProp->getValue() == value) {
+            return intProp;
+        }
     }
 
     propAddress[intProp] = key;
@@ -681,6 +761,9 @@ Property* Sheet::setQuantityProperty(CellAddress key, double value, const Base::
     }
     else {
         quantityProp = static_cast<PropertySpreadsheetQuantity*>(prop);
+        if (quantityProp->getValue() == value && quantityProp->getUnit() == unit) {
+            return quantityProp;
+        }
     }
 
     propAddress[quantityProp] = key;
@@ -721,6 +804,9 @@ Property* Sheet::setStringProperty(CellAddress key, const std::string& value)
             Prop_ReadOnly | Prop_Hidden | Prop_NoPersist
         ));
     }
+    else if (value == stringProp->getValue()) {
+        return stringProp;
+    }
 
     propAddress[stringProp] = key;
     stringProp->setValue(value.c_str());
@@ -777,21 +863,24 @@ struct CurrentAddressLock
  * Update the Property given by \a key. This will also eventually trigger recomputations of cells
  * depending on \a key.
  *
- * @param key The address of the cell we want to recompute.
+ * @param key   The address of the cell we want to recompute.
+ * @param value The already evaluated expression of the cell, if any.
  *
  */
 
-void Sheet::updateProperty(CellAddress key)
+void Sheet::updateProperty(CellAddress key, std::unique_ptr<Expression> value)
 {
     Cell* cell = getCell(key);
 
     if (cell) {
-        std::unique_ptr<Expression> output;
+        std::unique_ptr<Expression> output = std::move(value);
         const Expression* input = cell->getExpression();
 
         if (input) {
-            CurrentAddressLock lock(currentRow, currentCol, key);
-            output.reset(input->eval());
+            if (!output) {
+                CurrentAddressLock lock(currentRow, currentCol, key);
+                output.reset(input->eval());
+            }
         }
         else {
             std::string s;
@@ -846,7 +935,49 @@ void Sheet::updateProperty(CellAddress key)
         clear(key);
     }
 
-    cellUpdated(key);
+    notifyCellUpdated(key);
+}
+
+/**
+ * Signal cellUpdated for the cell at \a address, or remember it for
+ * flushCellUpdates() while the signals are held back.
+ */
+
+void Sheet::notifyCellUpdated(CellAddress address)
+{
+    if (deferCellUpdates) {
+        deferredCellUpdates.push_back(address);
+    }
+    else {
+        cellUpdated(address);
+    }
+}
+
+/**
+ * Signal the cells updated while the signals were held back, as one range
+ * covering all of them. A view then redraws once instead of once per cell.
+ */
+
+void Sheet::flushCellUpdates()
+{
+    deferCellUpdates = false;
+    if (deferredCellUpdates.size() == 1) {
+        cellUpdated(deferredCellUpdates.front());
+    }
+    else if (!deferredCellUpdates.empty()) {
+        int fromRow = deferredCellUpdates.front().row();
+        int fromCol = deferredCellUpdates.front().col();
+        int toRow = fromRow;
+        int toCol = fromCol;
+        for (const auto& address : deferredCellUpdates) {
+            fromRow = std::min(fromRow, address.row());
+            fromCol = std::min(fromCol, address.col());
+            toRow = std::max(toRow, address.row());
+            toCol = std::max(toCol, address.col());
+        }
+        rangeUpdated(Range(fromRow, fromCol, toRow, toCol));
+    }
+    deferredCellUpdates.clear();
 }
 
 /**
@@ -925,12 +1056,55 @@ void Sheet::recomputeCells(Range range)
     } while (range.next());
 }
 
+/**
+ * @brief Evaluate the purely numeric expressions of the cells at \a addresses
+ * on worker threads. The cells must not depend on each other.
+ *
+ * @param addresses Addresses of the cells.
+ * @return The evaluated expressions, or null for the cells that have to be
+ * evaluated normally by recomputeCell().
+ */
+
+std::vector<std::unique_ptr<Expression>> Sheet::evaluateNumericCells(
+    const std::vector<CellAddress>& addresses
+) const
+{
+    // not worth the thread synchronization for a few cells
+    constexpr std::size_t minParallelCells = 32;
+
+    std::vector<std::unique_ptr<Expression>> values(addresses.size());
+    if (addresses.size() < minParallelCells) {
+        return values;
+    }
+
+    std::vector<std::size_t> indices(addresses.size());
+    std::iota(indices.begin(), indices.end(), 0);
+    QtConcurrent::blockingMap(indices, [this, &addresses, &values](std::size_t i) {
+        const Cell* cell = cells.getValue(addresses[i]);
+        if (!cell || cell->hasException()) {
+            return;
+        }
+        const Expression* expr = cell->getExpression();
+        if (!expr) {
+            return;
+        }
+        try {
+            values[i].reset(expr->evalNumeric());
+        }
+        catch (...) {
+            // leave the error reporting to recomputeCell()
+        }
+    });
+    return values;
+}
+
 /**
  * @brief Recompute cell at address \a p.
  * @param p Address of cell.
+ * @param value The already evaluated expression of the cell, if any.
  */
 
-void Sheet::recomputeCell(CellAddress p)
+void Sheet::recomputeCell(CellAddress p, std::unique_ptr<Expression> value)
 {
     Cell* cell = cells.getValue(p);
 
@@ -941,7 +1115,7 @@ void Sheet::recomputeCell(CellAddress p)
             cell->setContent(content.c_str());
         }
 
-        updateProperty(p);
+        updateProperty(p, std::move(value));
 
         if (!cell || !cell->hasException()) {
             cells.clearDirty(p);
@@ -961,7 +1135,7 @@ void Sheet::recomputeCell(CellAddress p)
 
         // Mark as erroneous
         cellErrors.insert(p);
-        cellUpdated(p);
+        notifyCellUpdated(p);
 
         if (e.isDerivedFrom<Base::AbortException>()) {
             throw;
@@ -1080,6 +1254,9 @@ DocumentObjectExecReturn* Sheet::execute()
         dirtyCells.insert(cellError);
     }
 
+    // The cells depending on these are only recomputed if a value changed
+    std::set<CellAddress> pendingCells(dirtyCells);
+
     DependencyList graph;
     std::map<CellAddress, Vertex> VertexList;
     std::map<Vertex, CellAddress> VertexIndexList;
@@ -1116,10 +1293,59 @@ DocumentObjectExecReturn* Sheet::execute()
         boost::topological_sort(graph, std::front_inserter(make_order));
         // Recompute cells
         FC_LOG("recomputing " << getFullName());
-        for (auto& pos : make_order) {
-            const auto& addr = VertexIndexList[pos];
+        struct CellUpdateBatch
+        {
+            explicit CellUpdateBatch(Sheet* sheet)
+                : sheet(sheet)
+            {
+                sheet->deferCellUpdates = true;
+            }
+            ~CellUpdateBatch()
+            {
+                sheet->flushCellUpdates();
+            }
+            Sheet* sheet;
+        } batch(this);
+        auto recompute = [&](const CellAddress& addr, std::unique_ptr<Expression> value) {
             FC_TRACE(addr.toString());
-            recomputeCell(addr);
+            const Property* prop = getProperty(addr);
+            unsigned changes = cellValueChanges;
+            recomputeCell(addr, std::move(value));
+            if (changes != cellValueChanges || prop != getProperty(addr)) {
+                for (auto& dep : providesTo(addr)) {
+                    pendingCells.insert(dep);
+                }
+            }
+        };
+
+        ParameterGrp::handle group = App::GetApplication().GetParameterGroupByPath(
+            "User parameter:BaseApp/Preferences/Mod/Spreadsheet"
+        );
+        if (!group->GetBool("ParallelRecompute", false)) {
+            for (auto& pos : make_order) {
+                const auto& addr = VertexIndexList[pos];
+                if (pendingCells.count(addr)) {
+                    recompute(addr, nullptr);
+                }
+            }
+        }
+        else {
+            // The cells of one level do not depend on each other, so their
+            // numeric expressions can be evaluated at the same time. Setting
+            // the cell properties stays on this thread.
+            for (const auto& level : dependencyLevels(graph, make_order)) {
+                std::vector<CellAddress> addresses;
+                for (auto pos : level) {
+                    const auto& addr = VertexIndexList[pos];
+                    if (pendingCells.count(addr)) {
+                        addresses.push_back(addr);
+                    }
+                }
+                auto values = evaluateNumericCells(addresses);
+                for (std::size_t i = 0; i < addresses.size(); ++i) {
+                    recompute(addresses[i], std::move(values[i]));
+                }
+            }
         }
     }
     catch (std::exception&) {
@@ -1744,6 +1970,9 @@ void Sheet::onChanged(const App::Property* prop)
         }
     }
     else {
+        if (propAddress.count(prop)) {
+            ++cellValueChanges;
+        }
         cells.slotChangedObject(*this, *prop);
     }
     App::DocumentObject::onChanged(prop);
@@ -30,6 +30,7 @@
 #endif
 
 #include <map>
+#include <memory>
 #include <tuple>
 #include <set>
 #include <string>
@@ -134,6 +135,10 @@ public:
 
     void setCell(App::CellAddress address, const char* value);
 
+    void setCells(App::CellAddress address, const std::vector<std::vector<std::string>>& contents);
+
+    std::vector<std::vector<std::string>> getCellContents(const App::Range& range) const;
+
     void clearAll();
 
     void clear(App::CellAddress address, bool all = true);
@@ -258,13 +263,16 @@ protected:
 
     void onDocumentRestored() override;
 
-    void recomputeCell(App::CellAddress p);
+    void recomputeCell(App::CellAddress p, std::unique_ptr<App::Expression> value = nullptr);
+
+    std::vector<std::unique_ptr<App::Expression>>
+    evaluateNumericCells(const std::vector<App::CellAddress>& addresses) const;
 
     App::Property* getProperty(App::CellAddress key) const;
 
     App::Property* getProperty(const char* addr) const;
 
-    void updateProperty(App::CellAddress key);
+    void updateProperty(App::CellAddress key, std::unique_ptr<App::Expression> value = nullptr);
 
     App::Property* setStringProperty(App::CellAddress key, const std::string& value);
 
@@ -280,6 +288,10 @@ protected:
 
     void updateBindings();
 
+    void notifyCellUpdated(App::CellAddress address);
+
+    void flushCellUpdates();
+
     /* Properties for used cells */
     App::DynamicProperty& props;
 
@@ -289,6 +301,13 @@ protected:
     /* Set of cells with errors */
     std::set<App::CellAddress> cellErrors;
 
+    /* Number of changes of the cell properties, see execute() */
+    unsigned cellValueChanges = 0;
+
+    /* Hold back cellUpdated while recomputing, see flushCellUpdates() */
+    bool deferCellUpdates = false;
+    std::vector<App::CellAddress> deferredCellUpdates;
+
     /* Properties */
 
     /* Cell data */
@@ -25,6 +25,23 @@ class Sheet(DocumentObject):
         """Set data into a cell"""
         ...
 
+    def setCells(self, address: str, contents: list[list[str]], /) -> None:
+        """
+        Set a block of cells starting at the given cell. The contents are a list of
+        rows, each one a list of cell contents as accepted by set(); values that are
+        not strings are converted with str(). Empty strings clear the cell. All
+        cells are set at once, which is much faster than calling set() for each
+        cell.
+        """
+        ...
+
+    def getCellContents(self, address: str, address_to: str | None = None, /) -> list[list[str]]:
+        """
+        Get the contents of the cells in the given range, as a list of rows, each
+        one a list of cell contents. Empty cells give empty strings.
+        """
+        ...
+
     def get(self) -> Any:
         """Get evaluated cell contents"""
         ...
@@ -94,6 +94,61 @@ PyObject* SheetPy::set(PyObject* args)
     Py_Return;
 }
 
+PyObject* SheetPy::setCells(PyObject* args)
+{
+    const char* strAddress;
+    PyObject* pyContents;
+
+    if (!PyArg_ParseTuple(args, "sO:setCells", &strAddress, &pyContents)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        Sheet* sheet = getSheetPtr();
+        std::string addr = sheet->getAddressFromAlias(strAddress);
+        CellAddress address = stringToAddress(addr.empty() ? strAddress : addr.c_str());
+
+        std::vector<std::vector<std::string>> contents;
+        for (const auto& pyRow : Py::Sequence(pyContents)) {
+            Py::Sequence row(pyRow);
+            contents.emplace_back();
+            contents.back().reserve(row.size());
+            for (const auto& item : row) {
+                contents.back().push_back(Py::Object(item).as_string());
+            }
+        }
+        sheet->setCells(address, contents);
+        Py_Return;
+    }
+    PY_CATCH
+}
+
+PyObject* SheetPy::getCellContents(PyObject* args)
+{
+    const char* address;
+    const char* address2 = nullptr;
+
+    if (!PyArg_ParseTuple(args, "s|s:getCellContents", &address, &address2)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        Range range = address2 ? Range(address, address2) : Range(address);
+        Py::List pyRows;
+        for (const auto& row : getSheetPtr()->getCellContents(range)) {
+            Py::List pyRow;
+            for (const auto& content : row) {
+                pyRow.append(Py::String(content));
+            }
+            pyRows.append(pyRow);
+        }
+        return Py::new_reference_to(pyRows);
+    }
+    PY_CATCH
+}
+
 PyObject* SheetPy::get(PyObject* args)
 {
     const char* address;
@@ -23,6 +23,8 @@
  ***************************************************************************/
 
 
+#include <algorithm>
+
 #include <QFont>
 #include <QLocale>
 
@@ -132,12 +134,62 @@ QVariant formatCellDisplay(QString value, const Cell* cell)
 }
 }  // namespace
 
+namespace
+{
+/// Returns the slot of \a role in SheetModel::CellDisplay, or -1 if it is not cached
+int displaySlot(int role)
+{
+    switch (role) {
+        case Qt::DisplayRole:
+            return 0;
+        case Qt::ToolTipRole:
+            return 1;
+        case Qt::FontRole:
+            return 2;
+        case Qt::TextAlignmentRole:
+            return 3;
+        case Qt::BackgroundRole:
+            return 4;
+        case Qt::ForegroundRole:
+            return 5;
+        default:
+            return -1;
+    }
+}
+}  // namespace
+
 QVariant SheetModel::data(const QModelIndex& index, int role) const
 {
-    static const Cell* emptyCell = new Cell(CellAddress(0, 0), nullptr);
     int row = index.row();
     int col = index.column();
-    const Cell* cell = sheet->getCell(CellAddress(row, col));
+    int slot = displaySlot(role);
+    CellAddress address(row, col);
+    const Cell* cell = sheet->getCell(address);
+
+    // Empty cells are cheap to show, only the formatted cells are kept
+    if (slot < 0 || !cell) {
+        return cellData(cell, row, col, role);
+    }
+
+    bool dirty = sheet->getCells()->getDirty().count(address) > 0;
+    CellDisplay& display = displayCache[row * maxColumnCount + col];
+    if (display.cell != cell || display.dirty != dirty) {
+        display = CellDisplay();
+        display.cell = cell;
+        display.dirty = dirty;
+    }
+
+    unsigned bit = 1U << slot;
+    if (!(display.roles & bit)) {
+        display.values[slot] = cellData(cell, row, col, role);
+        display.roles |= bit;
+    }
+    return display.values[slot];
+}
+
+QVariant SheetModel::cellData(const Cell* cell, int row, int col, int role) const
+{
+    static const Cell* emptyCell = new Cell(CellAddress(0, 0), nullptr);
 
     if (!cell) {
         cell = emptyCell;
@@ -281,7 +333,7 @@ QVariant SheetModel::data(const QModelIndex& index, int role) const
         return QVariant::fromValue(f);
     }
 
-    auto dirtyCells = sheet->getCells()->getDirty();
+    const auto& dirtyCells = sheet->getCells()->getDirty();
     auto dirty = (dirtyCells.find(CellAddress(row, col)) != dirtyCells.end());
 
     if (!prop || dirty) {
@@ -621,8 +673,16 @@ Qt::ItemFlags SheetModel::flags(const QModelIndex& /*index*/) const
     return Qt::ItemIsSelectable | Qt::ItemIsEditable | Qt::ItemIsEnabled;
 }
 
+void SheetModel::setVisibleRows(int first, int last)
+{
+    firstVisibleRow = first;
+    lastVisibleRow = last;
+}
+
 void SheetModel::cellUpdated(CellAddress address)
 {
+    displayCache.erase(address.row() * maxColumnCount + address.col());
+
     QModelIndex i = index(address.row(), address.col());
 
     Q_EMIT dataChanged(i, i);
@@ -630,8 +690,40 @@ void SheetModel::cellUpdated(CellAddress address)
 
 void SheetModel::rangeUpdated(const Range& range)
 {
-    QModelIndex i = index(range.from().row(), range.from().col());
-    QModelIndex j = index(range.to().row(), range.to().col());
+    int fromRow = range.from().row();
+    int fromCol = range.from().col();
+    int toRow = range.to().row();
+    int toCol = range.to().col();
+
+    // A range may span whole rows or columns, so walk the shorter of range and cache
+    if (range.size() < static_cast<int>(displayCache.size())) {
+        Range cells(range);
+        do {
+            displayCache.erase((*cells).row() * maxColumnCount + (*cells).col());
+        } while (cells.next());
+    }
+    else {
+        for (auto it = displayCache.begin(); it != displayCache.end();) {
+            int row = it->first / maxColumnCount;
+            int col = it->first % maxColumnCount;
+            if (row >= fromRow && row <= toRow && col >= fromCol && col <= toCol) {
+                it = displayCache.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+
+    // Rows scrolled into view later are fetched again anyway
+    fromRow = std::max(fromRow, firstVisibleRow);
+    toRow = std::min(toRow, lastVisibleRow);
+    if (fromRow > toRow) {
+        return;
+    }
+
+    QModelIndex i = index(fromRow, fromCol);
+    QModelIndex j = index(toRow, toCol);
 
     Q_EMIT dataChanged(i, j);
 }
@@ -24,6 +24,9 @@
 
 #pragma once
 
+#include <array>
+#include <unordered_map>
+
 #include <QAbstractTableModel>
 
 #include <App/Range.h>
@@ -31,6 +34,7 @@
 
 namespace Spreadsheet
 {
+class Cell;
 class Sheet;
 }
 
@@ -52,10 +56,23 @@ public:
     bool setData(const QModelIndex& index, const QVariant& value, int role) override;
     Qt::ItemFlags flags(const QModelIndex&) const override;
 
+    /// Limits the dataChanged signals of updated ranges to the rows shown by the view
+    void setVisibleRows(int first, int last);
+
 private Q_SLOTS:
     void setCellData(QModelIndex index, QString str);
 
 private:
+    /// The formatted roles of a cell, filled on demand by data()
+    struct CellDisplay
+    {
+        const Spreadsheet::Cell* cell {nullptr};
+        bool dirty {false};
+        unsigned roles {0};
+        std::array<QVariant, 6> values;
+    };
+
+    QVariant cellData(const Spreadsheet::Cell* cell, int row, int col, int role) const;
     void cellUpdated(App::CellAddress address);
     void rangeUpdated(const App::Range& range);
 
@@ -70,6 +87,11 @@ private:
     QVariantList columnLabels, rowLabels;
 
     static constexpr int maxRowCount = 16384, maxColumnCount = 26 + 26 * 26;
+
+    /* Formatted cells by row * maxColumnCount + column, dropped when the cell is updated */
+    mutable std::unordered_map<int, CellDisplay> displayCache;
+    int firstVisibleRow = 0;
+    int lastVisibleRow = maxRowCount - 1;
 };
 
 }  // namespace SpreadsheetGui
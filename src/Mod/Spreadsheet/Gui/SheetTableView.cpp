@@ -22,6 +22,7 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
 #include <limits>
 #include <QAction>
 #include <QApplication>
@@ -49,6 +50,7 @@
 #include "DlgSheetConf.h"
 #include "LineEdit.h"
 #include "PropertiesDialog.h"
+#include "SheetModel.h"
 #include "SheetTableView.h"
 
 
@@ -1107,6 +1109,32 @@ void SheetTableView::selectionChanged(const QItemSelection& selected, const QIte
     QTableView::selectionChanged(selected, deselected);
 }
 
+void SheetTableView::scrollContentsBy(int dx, int dy)
+{
+    QTableView::scrollContentsBy(dx, dy);
+    updateVisibleRows();
+}
+
+void SheetTableView::updateGeometries()
+{
+    QTableView::updateGeometries();
+    updateVisibleRows();
+}
+
+void SheetTableView::updateVisibleRows()
+{
+    auto sheetModel = qobject_cast<SheetModel*>(model());
+    if (!sheetModel) {
+        return;
+    }
+    int first = rowAt(0);
+    int last = rowAt(viewport()->height());
+    if (last < 0) {
+        last = sheetModel->rowCount() - 1;
+    }
+    sheetModel->setVisibleRows(std::max(first, 0), last);
+}
+
 void SheetTableView::edit(const QModelIndex& index)
 {
     currentEditIndex = index;
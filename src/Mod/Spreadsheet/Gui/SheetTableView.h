@@ -102,6 +102,9 @@ protected:
     void selectionChanged(const QItemSelection& selected, const QItemSelection& deselected) override;
 
     void contextMenuEvent(QContextMenuEvent* e) override;
+    void scrollContentsBy(int dx, int dy) override;
+    void updateGeometries() override;
+    void updateVisibleRows();
 
     void _copySelection(const std::vector<App::Range>& ranges, bool copy);
 
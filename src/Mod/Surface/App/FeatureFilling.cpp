@@ -259,8 +259,40 @@ void Filling::addConstraints(BRepFill_Filling& builder, const App::PropertyLinkS
     }
 }
 
+InputHash Filling::getInputHash() const
+{
+    InputHash hash;
+    hash.add(BoundaryEdges);
+    hash.add(BoundaryFaces.getValues());
+    hash.add(BoundaryOrder.getValues());
+    hash.add(UnboundEdges);
+    hash.add(UnboundFaces.getValues());
+    hash.add(UnboundOrder.getValues());
+    hash.add(FreeFaces);
+    hash.add(FreeOrder.getValues());
+    hash.add(Points);
+    hash.add(InitialFace);
+    hash.add(Degree.getValue());
+    hash.add(PointsOnCurve.getValue());
+    hash.add(Iterations.getValue());
+    hash.add(Anisotropy.getValue());
+    hash.add(Tolerance2d.getValue());
+    hash.add(Tolerance3d.getValue());
+    hash.add(TolAngular.getValue());
+    hash.add(TolCurvature.getValue());
+    hash.add(MaximumDegree.getValue());
+    hash.add(MaximumSegments.getValue());
+    return hash;
+}
+
 App::DocumentObjectExecReturn* Filling::execute()
 {
+    // the filling is expensive, don't rebuild it from unchanged inputs
+    InputHash inputs = getInputHash();
+    if (cache.isCached(inputs, Shape.getShape())) {
+        return App::DocumentObject::StdReturn;
+    }
+
     // Assign Variables
     unsigned int degree = Degree.getValue();
     unsigned int ptsoncurve = PointsOnCurve.getValue();
@@ -325,6 +357,7 @@ App::DocumentObjectExecReturn* Filling::execute()
         // Return the face
         TopoDS_Face aFace = builder.Face();
         this->Shape.setValue(aFace);
+        cache.store(inputs, Shape.getShape());
         return App::DocumentObject::StdReturn;
     }
     catch (Standard_Failure& e) {
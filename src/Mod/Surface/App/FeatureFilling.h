@@ -28,6 +28,8 @@
 #include <Mod/Part/App/FeaturePartSpline.h>
 #include <Mod/Surface/SurfaceGlobal.h>
 
+#include "ShapeCache.h"
+
 
 class BRepFill_Filling;
 
@@ -90,6 +92,9 @@ private:
         const App::PropertyIntegerList& orders
     );
     void addConstraints(BRepFill_Filling& builder, const App::PropertyLinkSubList& points);
+    InputHash getInputHash() const;
+
+    ShapeCache cache;
 };
 
 }  // Namespace Surface
@@ -48,6 +48,12 @@ Sections::Sections()
 
 App::DocumentObjectExecReturn* Sections::execute()
 {
+    InputHash inputs;
+    inputs.add(NSections);
+    if (cache.isCached(inputs, Shape.getShape())) {
+        return StdReturn;
+    }
+
     TColGeom_SequenceOfCurve curveSeq;
     auto edge_obj = NSections.getValues();
     auto edge_sub = NSections.getSubValues();
@@ -92,5 +98,6 @@ App::DocumentObjectExecReturn* Sections::execute()
     BRepBuilderAPI_MakeFace mkFace(aSurf, Precision::Confusion());
 
     Shape.setValue(mkFace.Face());
+    cache.store(inputs, Shape.getShape());
     return StdReturn;
 }
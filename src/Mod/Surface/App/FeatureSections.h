@@ -28,6 +28,8 @@
 #include <Mod/Part/App/FeaturePartSpline.h>
 #include <Mod/Surface/SurfaceGlobal.h>
 
+#include "ShapeCache.h"
+
 
 namespace Surface
 {
@@ -48,6 +50,9 @@ public:
     {
         return "SurfaceGui::ViewProviderSections";
     }
+
+private:
+    ShapeCache cache;
 };
 
 }  // Namespace Surface
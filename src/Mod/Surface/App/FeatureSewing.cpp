@@ -22,16 +22,169 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
+#include <mutex>
+#include <numeric>
+
+#include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_Sewing.hxx>
+#include <BRep_Builder.hxx>
+#include <Bnd_Box.hxx>
 #include <Precision.hxx>
 #include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Iterator.hxx>
+#include <QtConcurrentMap>
 
+#include <Mod/Part/App/ParallelPolicy.h>
 
 #include "FeatureSewing.h"
 
 
 using namespace Surface;
 
+namespace
+{
+
+struct SewingOptions
+{
+    double tolerance;
+    bool sewing;
+    bool degenerate;
+    bool cutFreeEdges;
+    bool nonmanifold;
+};
+
+TopoDS_Shape sew(const std::vector<TopoDS_Shape>& shapes, const SewingOptions& opt)
+{
+    BRepBuilderAPI_Sewing
+        builder(opt.tolerance, opt.sewing, opt.degenerate, opt.cutFreeEdges, opt.nonmanifold);
+    for (const auto& it : shapes) {
+        builder.Add(it);
+    }
+    builder.Perform();
+    return builder.SewedShape();
+}
+
+std::size_t findRoot(std::vector<std::size_t>& parent, std::size_t i)
+{
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+    return i;
+}
+
+// Shapes can only be sewn together if they are closer than the tolerance. So, shapes
+// whose enlarged bounding boxes don't overlap, directly or via other shapes, form
+// groups that can be sewn independently of each other. Shapes sharing sub-shapes
+// always end up in the same group, so no two threads touch the same sub-shape.
+std::vector<std::vector<TopoDS_Shape>> groupShapes(
+    const std::vector<TopoDS_Shape>& shapes,
+    double tolerance
+)
+{
+    std::size_t count = shapes.size();
+    std::vector<Bnd_Box> boxes(count);
+    std::vector<double> xmin(count);
+    std::vector<double> xmax(count);
+    std::vector<std::size_t> order;
+    order.reserve(count);
+    for (std::size_t i = 0; i < count; i++) {
+        BRepBndLib::Add(shapes[i], boxes[i]);
+        if (!boxes[i].IsVoid()) {
+            boxes[i].Enlarge(tolerance);
+            double ymin, zmin, ymax, zmax;
+            boxes[i].Get(xmin[i], ymin, zmin, xmax[i], ymax, zmax);
+            order.push_back(i);
+        }
+    }
+
+    // sweep along the x axis and only compare boxes whose x ranges overlap
+    std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+        return xmin[a] < xmin[b];
+    });
+
+    std::vector<std::size_t> parent(count);
+    std::iota(parent.begin(), parent.end(), 0);
+    std::vector<std::size_t> active;
+    for (std::size_t i : order) {
+        active.erase(
+            std::remove_if(active.begin(), active.end(), [&](std::size_t j) {
+                return xmax[j] < xmin[i];
+            }),
+            active.end()
+        );
+        for (std::size_t j : active) {
+            if (!boxes[i].IsOut(boxes[j])) {
+                parent[findRoot(parent, i)] = findRoot(parent, j);
+            }
+        }
+        active.push_back(i);
+    }
+
+    std::vector<std::vector<TopoDS_Shape>> groups;
+    std::vector<std::size_t> groupOfRoot(count, count);
+    for (std::size_t i = 0; i < count; i++) {
+        std::size_t root = findRoot(parent, i);
+        if (groupOfRoot[root] == count) {
+            groupOfRoot[root] = groups.size();
+            groups.emplace_back();
+        }
+        groups[groupOfRoot[root]].push_back(shapes[i]);
+    }
+    return groups;
+}
+
+TopoDS_Shape sewInParallel(const std::vector<TopoDS_Shape>& shapes, const SewingOptions& opt)
+{
+    std::vector<std::vector<TopoDS_Shape>> groups = groupShapes(shapes, opt.tolerance);
+    if (groups.size() < 2) {
+        return sew(shapes, opt);
+    }
+
+    std::vector<TopoDS_Shape> results(groups.size());
+    std::vector<std::size_t> indices(groups.size());
+    std::iota(indices.begin(), indices.end(), 0);
+    std::mutex mutex;
+    std::exception_ptr error;
+    QtConcurrent::blockingMap(indices, [&](std::size_t i) {
+        try {
+            results[i] = sew(groups[i], opt);
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    });
+    if (error) {
+        std::rethrow_exception(error);
+    }
+
+    // combine the results the way a single sewing would return them
+    BRep_Builder builder;
+    TopoDS_Compound comp;
+    builder.MakeCompound(comp);
+    for (const auto& it : results) {
+        if (it.IsNull()) {
+            continue;
+        }
+        if (it.ShapeType() == TopAbs_COMPOUND) {
+            for (TopoDS_Iterator xp(it); xp.More(); xp.Next()) {
+                builder.Add(comp, xp.Value());
+            }
+        }
+        else {
+            builder.Add(comp, it);
+        }
+    }
+    return comp;
+}
+
+}  // namespace
+
 PROPERTY_SOURCE(Surface::Sewing, Part::Feature)
 
 // Initial values
@@ -60,15 +213,26 @@ short Sewing::mustExecute() const
 App::DocumentObjectExecReturn* Sewing::execute()
 {
     // Assign Variables
-    double atol = Tolerance.getValue();
-    bool opt1 = SewingOption.getValue();
-    bool opt2 = DegenerateShape.getValue();
-    bool opt3 = CutFreeEdges.getValue();
-    bool opt4 = Nonmanifold.getValue();
+    SewingOptions opt;
+    opt.tolerance = Tolerance.getValue();
+    opt.sewing = SewingOption.getValue();
+    opt.degenerate = DegenerateShape.getValue();
+    opt.cutFreeEdges = CutFreeEdges.getValue();
+    opt.nonmanifold = Nonmanifold.getValue();
 
-    try {
-        BRepBuilderAPI_Sewing builder(atol, opt1, opt2, opt3, opt4);
+    InputHash inputs;
+    inputs.add(ShapeList);
+    inputs.add(opt.tolerance);
+    inputs.add(opt.sewing);
+    inputs.add(opt.degenerate);
+    inputs.add(opt.cutFreeEdges);
+    inputs.add(opt.nonmanifold);
+    if (cache.isCached(inputs, Shape.getShape())) {
+        return StdReturn;
+    }
 
+    try {
+        std::vector<TopoDS_Shape> shapes;
         std::vector<App::PropertyLinkSubList::SubSet> subset = ShapeList.getSubListValues();
         for (const auto& it : subset) {
             // the subset has the documentobject and the element name which belongs to it,
@@ -79,8 +243,7 @@ App::DocumentObjectExecReturn* Sewing::execute()
 
                 // we want only the subshape which is linked
                 for (const auto& jt : it.second) {
-                    TopoDS_Shape sub = ts.getSubShape(jt.c_str());
-                    builder.Add(sub);
+                    shapes.push_back(ts.getSubShape(jt.c_str()));
                 }
             }
             else {
@@ -88,13 +251,20 @@ App::DocumentObjectExecReturn* Sewing::execute()
             }
         }
 
-        builder.Perform();  // Perform Sewing
+        // Perform Sewing
+        TopoDS_Shape aShape;
+        if (Part::ParallelPolicy::isEnabled(Part::ParallelPolicy::Algorithm::Sewing)) {
+            aShape = sewInParallel(shapes, opt);
+        }
+        else {
+            aShape = sew(shapes, opt);
+        }
 
-        TopoDS_Shape aShape = builder.SewedShape();  // Get Shape
         if (aShape.IsNull()) {
             return new App::DocumentObjectExecReturn("Resulting shape is null");
         }
         this->Shape.setValue(aShape);
+        cache.store(inputs, Shape.getShape());
         return StdReturn;
     }
     catch (Standard_Failure& e) {
@@ -28,6 +28,8 @@
 #include <Mod/Part/App/PartFeature.h>
 #include <Mod/Surface/SurfaceGlobal.h>
 
+#include "ShapeCache.h"
+
 
 namespace Surface
 {
@@ -50,6 +52,9 @@ public:
     // recalculate the feature
     App::DocumentObjectExecReturn* execute() override;
     short mustExecute() const override;
+
+private:
+    ShapeCache cache;
 };
 
 }  // Namespace Surface
@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+#include <App/DocumentObject.h>
+#include <Mod/Part/App/PartFeature.h>
+#include <Mod/Part/App/ShapeMapHasher.h>
+
+#include "ShapeCache.h"
+
+
+using namespace Surface;
+
+void InputHash::add(const TopoDS_Shape& shape)
+{
+    boost::hash_combine(seed, Part::ShapeMapHasher {}(shape));
+    boost::hash_combine(seed, static_cast<int>(shape.Orientation()));
+}
+
+void InputHash::add(const App::PropertyLinkSub& link)
+{
+    add(link.getValue(), link.getSubValues());
+}
+
+void InputHash::add(const App::PropertyLinkSubList& links)
+{
+    for (const auto& it : links.getSubListValues()) {
+        add(it.first, it.second);
+    }
+}
+
+void InputHash::add(App::DocumentObject* obj, const std::vector<std::string>& subs)
+{
+    boost::hash_combine(seed, obj);
+    boost::hash_combine(seed, subs);
+    if (obj && obj->isDerivedFrom<Part::Feature>()) {
+        const Part::TopoShape& shape = static_cast<Part::Feature*>(obj)->Shape.getShape();
+        for (const auto& it : subs) {
+            add(shape.getSubShape(it.c_str(), true));
+        }
+    }
+}
+
+bool ShapeCache::isCached(const InputHash& inputs, const Part::TopoShape& shape) const
+{
+    return !built.IsNull() && inputs.value() == hash && shape.getShape().IsPartner(built);
+}
+
+void ShapeCache::store(const InputHash& inputs, const Part::TopoShape& shape)
+{
+    hash = inputs.value();
+    built = shape.getShape();
+}
+
+void ShapeCache::clear()
+{
+    hash = 0;
+    built.Nullify();
+}
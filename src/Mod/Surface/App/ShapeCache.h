@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+#pragma once
+
+#include <cstddef>
+
+#include <boost/functional/hash.hpp>
+#include <TopoDS_Shape.hxx>
+
+#include <App/PropertyLinks.h>
+#include <Mod/Part/App/TopoShape.h>
+#include <Mod/Surface/SurfaceGlobal.h>
+
+
+namespace Surface
+{
+
+/** Hash of everything a surface feature is built from.
+ * Shapes are hashed by identity, i.e. by their TShape, location and orientation.
+ * A recomputed input gets a new TShape, so an equal hash means that the feature
+ * would build the same surface again.
+ */
+class SurfaceExport InputHash
+{
+public:
+    void add(const TopoDS_Shape& shape);
+    /// adds the linked sub-shapes
+    void add(const App::PropertyLinkSub& link);
+    /// adds the linked sub-shapes
+    void add(const App::PropertyLinkSubList& links);
+
+    template<typename T>
+    void add(const T& value)
+    {
+        boost::hash_combine(seed, value);
+    }
+
+    std::size_t value() const
+    {
+        return seed;
+    }
+
+private:
+    void add(App::DocumentObject* obj, const std::vector<std::string>& subs);
+
+    std::size_t seed {0};
+};
+
+/** Remembers the shape a feature built last and the hash of its inputs.
+ * The cache doesn't survive saving, the first recompute after loading a
+ * document always rebuilds the shape.
+ */
+class SurfaceExport ShapeCache
+{
+public:
+    /// returns true if \a shape is the one built from inputs with the given hash
+    bool isCached(const InputHash& inputs, const Part::TopoShape& shape) const;
+    void store(const InputHash& inputs, const Part::TopoShape& shape);
+    void clear();
+
+private:
+    std::size_t hash {0};
+    TopoDS_Shape built;
+};
+
+}  // namespace Surface
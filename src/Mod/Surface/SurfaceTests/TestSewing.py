@@ -0,0 +1,79 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+
+# ***************************************************************************
+# *                                                                         *
+# *   Copyright (c) 2026 FreeCAD Project Association                        *
+# *                                                                         *
+# *   This program is free software; you can redistribute it and/or modify  *
+# *   it under the terms of the GNU Lesser General Public License (LGPL)    *
+# *   as published by the Free Software Foundation; either version 2 of     *
+# *   the License, or (at your option) any later version.                   *
+# *   for detail see the LICENCE text file.                                 *
+# *                                                                         *
+# *   This program is distributed in the hope that it will be useful,       *
+# *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+# *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+# *   GNU Library General Public License for more details.                  *
+# *                                                                         *
+# *   You should have received a copy of the GNU Library General Public     *
+# *   License along with this program; if not, write to the Free Software   *
+# *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  *
+# *   USA                                                                   *
+# *                                                                         *
+# ***************************************************************************
+
+__title__ = "Surface sewing unit tests"
+__url__ = "https://www.freecad.org"
+
+import unittest
+
+import FreeCAD
+import Part
+
+
+class TestSewing(unittest.TestCase):
+    def setUp(self):
+        self.doc = FreeCAD.newDocument("TestSewing")
+        self.policy = Part.getParallelPolicy()
+
+    def tearDown(self):
+        Part.setParallelPolicy(self.policy)
+        FreeCAD.closeDocument(self.doc.Name)
+
+    def makeSewing(self, boxes):
+        sewing = self.doc.addObject("Surface::Sewing", "Sewing")
+        sewing.ShapeList = [(box, ["Face{}".format(i) for i in range(1, 7)]) for box in boxes]
+        self.doc.recompute()
+        return sewing
+
+    def makeBoxes(self):
+        box1 = self.doc.addObject("Part::Box", "Box1")
+        box2 = self.doc.addObject("Part::Box", "Box2")
+        box2.Placement.Base = FreeCAD.Vector(20, 0, 0)
+        return [box1, box2]
+
+    def test_sewing_groups(self):
+        Part.setParallelPolicy(Sewing=True)
+        parallel = self.makeSewing(self.makeBoxes())
+
+        Part.setParallelPolicy(Sewing=False)
+        serial = self.makeSewing(self.makeBoxes())
+
+        self.assertEqual(len(parallel.Shape.Shells), 2)
+        self.assertEqual(len(parallel.Shape.Shells), len(serial.Shape.Shells))
+        self.assertEqual(len(parallel.Shape.Faces), len(serial.Shape.Faces))
+        self.assertAlmostEqual(parallel.Shape.Area, serial.Shape.Area)
+        for shell in parallel.Shape.Shells:
+            self.assertTrue(shell.isClosed())
+
+    def test_sewing_cache(self):
+        sewing = self.makeSewing(self.makeBoxes())
+        shape = sewing.Shape
+
+        sewing.touch()
+        self.doc.recompute()
+        self.assertTrue(sewing.Shape.isPartner(shape))
+
+        sewing.Tolerance = 0.01
+        self.doc.recompute()
+        self.assertFalse(sewing.Shape.isPartner(shape))
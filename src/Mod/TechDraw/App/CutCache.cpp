@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include <BRepBuilderAPI_Copy.hxx>
+
+#include "CutCache.h"
+#include "ShapeUtils.h"
+
+
+using namespace TechDraw;
+
+namespace
+{
+
+struct CutEntry
+{
+    std::mutex mutex;   // held while the result is made
+    bool done {false};
+    TopoDS_Shape result;
+};
+
+// the cut results can be big, so only the most recently used ones are kept
+constexpr std::size_t MaxEntries = 8;
+
+std::mutex cacheMutex;
+std::map<std::string, std::shared_ptr<CutEntry>> entries;
+std::list<std::string> recentKeys;   // most recently used first
+
+std::shared_ptr<CutEntry> findOrAddEntry(const std::string& key)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    recentKeys.remove(key);
+    recentKeys.push_front(key);
+    auto& entry = entries[key];
+    if (!entry) {
+        entry = std::make_shared<CutEntry>();
+    }
+    while (recentKeys.size() > MaxEntries) {
+        entries.erase(recentKeys.back());
+        recentKeys.pop_back();
+    }
+    return entry;
+}
+
+TopoDS_Shape copyOf(const TopoDS_Shape& shape)
+{
+    if (shape.IsNull()) {
+        return shape;
+    }
+    BRepBuilderAPI_Copy copier(shape);
+    return copier.Shape();
+}
+
+}  // namespace
+
+TopoDS_Shape CutCache::getResult(const std::string& operation,
+                                 const TopoDS_Shape& shape,
+                                 const TopoDS_Shape& tool,
+                                 const std::function<TopoDS_Shape()>& make)
+{
+    std::string key = operation + "|" + ShapeUtils::shapeFingerprint(shape) + "|"
+        + ShapeUtils::shapeFingerprint(tool);
+    std::shared_ptr<CutEntry> entry = findOrAddEntry(key);
+
+    std::lock_guard<std::mutex> lock(entry->mutex);
+    if (!entry->done) {
+        entry->result = make();
+        entry->done = true;
+    }
+    // the views move and scale their results, which must not reach the other views
+    return copyOf(entry->result);
+}
+
+void CutCache::clear()
+{
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    entries.clear();
+    recentKeys.clear();
+}
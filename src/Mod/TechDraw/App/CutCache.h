@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+#pragma once
+
+#include <functional>
+#include <string>
+
+#include <TopoDS_Shape.hxx>
+
+#include <Mod/TechDraw/TechDrawGlobal.h>
+
+
+namespace TechDraw
+{
+
+//! Keeps the results of the boolean operations of section and detail views, so views that cut
+//! the same shape with the same tool share one result instead of each running the booleans.
+//! The results are keyed by the geometry of the shape and the tool, so a changed shape simply
+//! misses the cache.  This is safe to use from the threads the views make their cuts in.
+class TechDrawExport CutCache
+{
+public:
+    //! return the result of make(), which applies tool to shape in the way described by
+    //! operation.  make() is only called if the result is not cached yet.  If another thread
+    //! is already making the same result, this waits for it.  The caller gets its own copy.
+    static TopoDS_Shape getResult(const std::string& operation,
+                                  const TopoDS_Shape& shape,
+                                  const TopoDS_Shape& tool,
+                                  const std::function<TopoDS_Shape()>& make);
+    static void clear();
+};
+
+}  // namespace TechDraw
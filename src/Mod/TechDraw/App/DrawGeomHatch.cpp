@@ -25,10 +25,12 @@
 # include <limits>
 # include <sstream>
 
+#include <QtConcurrentMap>
 #include <Bnd_Box.hxx>
 #include <BRep_Builder.hxx>
 #include <Mod/Part/App/FCBRepAlgoAPI_Common.h>
 #include <BRepBndLib.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
 #include <BRepBuilderAPI_MakeEdge.hxx>
 #include <BRepBuilderAPI_MakeFace.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
@@ -247,6 +249,64 @@ std::vector<LineSet>  DrawGeomHatch::getTrimmedLines(int iFace)   //get the trim
                            PatternRotation.getValue(), PatternOffset.getValue());
 }
 
+//! get the trimmed hatch lines for all the faces in Source.  The faces are trimmed
+//! concurrently, which matters for views with many hatched faces.
+std::map<int, std::vector<LineSet>> DrawGeomHatch::getTrimmedLinesForFaces()
+{
+    std::map<int, std::vector<LineSet>> result;
+    if (m_lineSets.empty()) {
+        makeLineSets();
+    }
+
+    DrawViewPart* source = getSourceView();
+    if (!source ||
+        !source->hasGeometry()) {
+        return result;
+    }
+
+    struct FaceTask {
+        int iFace;
+        TopoDS_Face face;
+        std::vector<LineSet> lineSets;
+    };
+    std::vector<FaceTask> tasks;
+    for (auto& subName : Source.getSubValues()) {
+        int iFace = DrawUtil::getIndexFromName(subName);
+        if (result.count(iFace)) {
+            continue;
+        }
+        result[iFace] = {};
+        //the faces are made from the view's geometry, so this is done before going parallel
+        TopoDS_Face face = extractFace(source, iFace);
+        if (face.IsNull()) {
+            continue;
+        }
+        //the boolean operations may adjust tolerances of their input, so every task gets its
+        //own copy of the face
+        BRepBuilderAPI_Copy copier(face, true, false);
+        tasks.push_back({iFace, TopoDS::Face(copier.Shape()), {}});
+    }
+
+    double scale = ScalePattern.getValue();
+    double rotation = PatternRotation.getValue();
+    Base::Vector3d offset = PatternOffset.getValue();
+    auto trimFace = [&](FaceTask& task) {
+        try {
+            task.lineSets = getTrimmedLines(source, m_lineSets, task.face, scale, rotation, offset);
+        }
+        catch (const Base::Exception& e) {
+            Base::Console().error("DGH::getTrimmedLinesForFaces - face %d - %s\n", task.iFace,
+                                  e.what());
+        }
+    };
+    QtConcurrent::blockingMap(tasks, trimFace);
+
+    for (auto& task : tasks) {
+        result[task.iFace] = std::move(task.lineSets);
+    }
+    return result;
+}
+
 /* static */
 std::vector<LineSet>  DrawGeomHatch::getTrimmedLinesSection(DrawViewSection* source,
                                                             std::vector<LineSet> lineSets,
@@ -22,6 +22,8 @@
 
 #pragma once
 
+#include <map>
+
 #include <App/DocumentObject.h>
 #include <App/FeaturePython.h>
 #include <App/PropertyFile.h>
@@ -78,6 +80,7 @@ public:
 
     std::vector<LineSet> getFaceOverlay(int iFace = 0);
     std::vector<LineSet> getTrimmedLines(int iFace = 0);
+    std::map<int, std::vector<LineSet>> getTrimmedLinesForFaces();
     static std::vector<LineSet> getTrimmedLines(DrawViewPart* dvp, std::vector<LineSet> lineSets, int iface,
                                                 double scale, double hatchRotation = 0.0,
                                                 Base::Vector3d hatchOffset = Base::Vector3d(0.0, 0.0, 0.0));
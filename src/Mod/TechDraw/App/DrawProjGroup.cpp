@@ -23,6 +23,7 @@
 
 
 #include <QRectF>
+#include <BRepBuilderAPI_Copy.hxx>
 #include <gp_Ax2.hxx>
 #include <gp_Dir.hxx>
 #include <gp_Pnt.hxx>
@@ -45,6 +46,7 @@
 #include "DrawProjGroupPy.h"// generated from DrawProjGroupPy.xml
 #include "DrawUtil.h"
 #include "Preferences.h"
+#include "ShapeExtractor.h"
 
 
 using namespace TechDraw;
@@ -126,6 +128,7 @@ void DrawProjGroup::onChanged(const App::Property* prop)
     }
 
     if (prop == &Source || prop == &XSource) {
+        clearSharedSourceShape();
         updateChildrenSource();
         return;
     }
@@ -162,6 +165,10 @@ void DrawProjGroup::onChanged(const App::Property* prop)
 
 App::DocumentObjectExecReturn* DrawProjGroup::execute()
 {
+    //the items are recomputed before the group, so they all have their copy of the shared
+    //shape by now.  The next cycle has to extract it again in case the source changed.
+    clearSharedSourceShape();
+
     if (!keepUpdated())
         return App::DocumentObject::StdReturn;
 
@@ -223,6 +230,7 @@ void DrawProjGroup::reportReady()
         //not ready yet
         return;
     }
+    clearSharedSourceShape();
     //all the secondary views are ready so we can now figure out alignment
     if (AutoDistribute.getValue()) {
         recomputeFeature();
@@ -241,6 +249,39 @@ bool DrawProjGroup::waitingForChildren() const
     return false;
 }
 
+//! extract the source shape once for all the items recomputed in this cycle. The items only
+//! differ in their projection direction, so they all start their HLR from the same copy.
+TopoDS_Shape DrawProjGroup::getSharedSourceShape()
+{
+    std::vector<App::DocumentObject*> sources = getAllSources();
+    if (!m_sharedShape.IsNull() && sources == m_sharedSources) {
+        return m_sharedShape;
+    }
+
+    clearSharedSourceShape();
+    TopoDS_Shape shape = ShapeExtractor::getShapes(sources, true);
+    if (shape.IsNull()) {
+        return shape;
+    }
+    bool copyGeometry = true;
+    bool copyMesh = false;
+    BRepBuilderAPI_Copy copier(shape, copyGeometry, copyMesh);
+    m_sharedShape = copier.Shape();
+    m_sharedSources = sources;
+    return m_sharedShape;
+}
+
+bool DrawProjGroup::isSharedSourceShape(const TopoDS_Shape& shape) const
+{
+    return !m_sharedShape.IsNull() && m_sharedShape.IsSame(shape);
+}
+
+void DrawProjGroup::clearSharedSourceShape()
+{
+    m_sharedShape.Nullify();
+    m_sharedSources.clear();
+}
+
 TechDraw::DrawPage* DrawProjGroup::getPage() const { return findParentPage(); }
 
 //does the unscaled DPG fit on the page?
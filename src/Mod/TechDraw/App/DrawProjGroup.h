@@ -23,6 +23,7 @@
 #pragma once
 
 #include <QRectF>
+#include <TopoDS_Shape.hxx>
 
 #include <App/DocumentObject.h>
 #include <App/PropertyLinks.h>
@@ -155,6 +156,11 @@ public:
     bool waitingForChildren() const;
     void reportReady();
 
+    /// Source shape shared by the items recomputed in the same cycle
+    TopoDS_Shape getSharedSourceShape();
+    bool isSharedSourceShape(const TopoDS_Shape& shape) const;
+    void clearSharedSourceShape();
+
     void dumpTouchedProps();
 
 protected:
@@ -205,6 +211,10 @@ protected:
                            std::array<Base::BoundBox3d, MAXPROJECTIONCOUNT> bboxes);
     double getMaxColWidth(std::array<int, 3> list,
                           std::array<Base::BoundBox3d, MAXPROJECTIONCOUNT> bboxes);
+
+private:
+    TopoDS_Shape m_sharedShape;
+    std::vector<App::DocumentObject*> m_sharedSources;
 };
 
 } //namespace TechDraw
\ No newline at end of file
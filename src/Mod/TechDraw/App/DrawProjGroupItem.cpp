@@ -131,6 +131,28 @@ App::DocumentObjectExecReturn *DrawProjGroupItem::execute()
     return DrawViewPart::execute();
 }
 
+//! the items of a group share the source shape, so the group extracts and copies it once for
+//! all the items recomputed together instead of once per item.
+TopoDS_Shape DrawProjGroupItem::getSourceShape(bool fuse, bool allow2d) const
+{
+    DrawProjGroup* pGroup = getPGroup();
+    if (!pGroup || fuse || !allow2d || getAllSources() != pGroup->getAllSources()) {
+        return DrawViewPart::getSourceShape(fuse, allow2d);
+    }
+    return pGroup->getSharedSourceShape();
+}
+
+GeometryObjectPtr DrawProjGroupItem::makeGeometryForShape(TopoDS_Shape& shape)
+{
+    DrawProjGroup* pGroup = getPGroup();
+    if (pGroup && pGroup->isSharedSourceShape(shape)) {
+        //the shared shape is already a copy of the source, so there is no need for another one
+        TopoDS_Shape localShape = shape;
+        return makeGeometryForCopiedShape(localShape);
+    }
+    return DrawViewPart::makeGeometryForShape(shape);
+}
+
 void DrawProjGroupItem::postHlrTasks()
 {
 //    Base::Console().message("DPGI::postHlrTasks() - %s\n", getNameInDocument());
@@ -61,6 +61,7 @@ public:
                               const bool flip = true)  const override;
 
     App::DocumentObjectExecReturn *execute() override;
+    TopoDS_Shape getSourceShape(bool fuse = false, bool allow2d = true) const override;
 
     const char* getViewProviderName() const override {
         return "TechDrawGui::ViewProviderProjGroupItem";
@@ -87,6 +88,7 @@ public:
 
 protected:
     void onChanged(const App::Property* prop) override;
+    TechDraw::GeometryObjectPtr makeGeometryForShape(TopoDS_Shape& shape) override;
 
 private:
     static const char* TypeEnums[];
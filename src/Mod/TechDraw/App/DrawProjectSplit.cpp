@@ -21,9 +21,11 @@
  ***************************************************************************/
 
 
+# include <algorithm>
 # include <algorithm>
 # include <limits>
 # include <sstream>
+#include <QtConcurrentMap>
 #include <Bnd_Box.hxx>
 #include <BRep_Tool.hxx>
 #include <BRepAdaptor_Curve.hxx>
@@ -162,6 +164,78 @@ bool DrawProjectSplit::isOnEdge(TopoDS_Edge e, TopoDS_Vertex v, double& param, b
 }
 
 
+//find the places where an end of one edge touches the interior of another edge.
+//The edges are sorted along X by their bounding boxes, so each edge is only tested
+//against the edges whose boxes overlap its own, and the edges are handled concurrently.
+//The result is in the same order as testing every pair of edges.
+std::vector<splitPoint> DrawProjectSplit::findSplitPoints(const std::vector<TopoDS_Edge>& edges)
+{
+    const int edgeCount = edges.size();
+    std::vector<Bnd_Box> boxes(edgeCount);
+    std::vector<bool> usable(edgeCount, false);
+    for (int i = 0; i < edgeCount; i++) {
+        BRepBndLib::AddOptimal(edges[i], boxes[i]);
+        boxes[i].SetGap(0.1);
+        //skip zero length edges. shouldn't happen ;)
+        usable[i] = !boxes[i].IsVoid() && !DrawUtil::isZeroEdge(edges[i]);
+    }
+
+    //edges ordered by the low X of their boxes
+    std::vector<int> byXMin;
+    std::vector<double> xMins;
+    for (int i = 0; i < edgeCount; i++) {
+        if (usable[i]) {
+            byXMin.push_back(i);
+        }
+    }
+    auto xMin = [&boxes](int i) { return boxes[i].CornerMin().X(); };
+    std::sort(byXMin.begin(), byXMin.end(), [&xMin](int a, int b) { return xMin(a) < xMin(b); });
+    for (int i : byXMin) {
+        xMins.push_back(xMin(i));
+    }
+
+    std::vector<std::vector<splitPoint>> found(edgeCount);
+    auto findForEdge = [&](int iOuter) {
+        const Bnd_Box& sOuter = boxes[iOuter];
+        //only edges starting left of the end of this box can overlap it
+        auto end = std::upper_bound(xMins.begin(), xMins.end(), sOuter.CornerMax().X());
+        std::vector<int> candidates;
+        for (auto it = xMins.begin(); it != end; ++it) {
+            int iInner = byXMin[it - xMins.begin()];
+            if (iInner != iOuter && !sOuter.IsOut(boxes[iInner])) {
+                candidates.push_back(iInner);
+            }
+        }
+        std::sort(candidates.begin(), candidates.end());
+
+        TopoDS_Vertex v1 = TopExp::FirstVertex(edges[iOuter]);
+        TopoDS_Vertex v2 = TopExp::LastVertex(edges[iOuter]);
+        for (int iInner : candidates) {
+            for (auto& v : {v1, v2}) {
+                double param = -1;
+                if (boxes[iInner].IsOut(BRep_Tool::Pnt(v))) {
+                    continue;//same test as isOnEdge, but without making the box again
+                }
+                if (isOnEdge(edges[iInner], v, param, false)) {
+                    gp_Pnt pnt = BRep_Tool::Pnt(v);
+                    splitPoint s;
+                    s.i = iInner;
+                    s.v = Base::Vector3d(pnt.X(), pnt.Y(), pnt.Z());
+                    s.param = param;
+                    found[iOuter].push_back(s);
+                }
+            }
+        }
+    };
+    QtConcurrent::blockingMap(byXMin, findForEdge);
+
+    std::vector<splitPoint> splits;
+    for (auto& edgeSplits : found) {
+        splits.insert(splits.end(), edgeSplits.begin(), edgeSplits.end());
+    }
+    return splits;
+}
+
 std::vector<TopoDS_Edge> DrawProjectSplit::splitEdges(std::vector<TopoDS_Edge> edges, std::vector<splitPoint> splits)
 {
     std::vector<TopoDS_Edge> result;
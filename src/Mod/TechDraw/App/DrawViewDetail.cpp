@@ -52,6 +52,7 @@
 #include <Base/Console.h>
 #include <Base/Parameter.h>
 
+#include "CutCache.h"
 #include "DrawComplexSection.h"
 #include "DrawUtil.h"
 #include "DrawViewDetail.h"
@@ -289,69 +290,74 @@ void DrawViewDetail::makeDetailShape(const TopoDS_Shape& shape3d, DrawViewPart*
         }
     }
 
-    //for each solid and shell in the input shape, make a common with the tool and
-    //add the result to a compound.  This avoids issues with some geometry errors in the
-    //input shape.
-    BRep_Builder builder;
-    TopoDS_Compound pieces;
-    builder.MakeCompound(pieces);
-    TopExp_Explorer expl1(copyShape, TopAbs_SOLID);
-    for (; expl1.More(); expl1.Next()) {
-        const TopoDS_Solid& s = TopoDS::Solid(expl1.Current());
-        FCBRepAlgoAPI_Common mkCommon(s, tool);
-        if (!mkCommon.IsDone()) {
-            continue;
-        }
-        if (mkCommon.Shape().IsNull()) {
-            continue;
-        }
-        //Did we get a result?
-        TopExp_Explorer xp;
-        xp.Init(mkCommon.Shape(), TopAbs_SOLID);
-        if (xp.More() != Standard_True) {
-            continue;
+    //other details of the same shape with the same tool share the result
+    auto common = [&copyShape, &tool]() -> TopoDS_Shape {
+        //for each solid and shell in the input shape, make a common with the tool and
+        //add the result to a compound.  This avoids issues with some geometry errors in the
+        //input shape.
+        BRep_Builder builder;
+        TopoDS_Compound pieces;
+        builder.MakeCompound(pieces);
+        TopExp_Explorer expl1(copyShape, TopAbs_SOLID);
+        for (; expl1.More(); expl1.Next()) {
+            const TopoDS_Solid& s = TopoDS::Solid(expl1.Current());
+            FCBRepAlgoAPI_Common mkCommon(s, tool);
+            if (!mkCommon.IsDone()) {
+                continue;
+            }
+            if (mkCommon.Shape().IsNull()) {
+                continue;
+            }
+            //Did we get a result?
+            TopExp_Explorer xp;
+            xp.Init(mkCommon.Shape(), TopAbs_SOLID);
+            if (xp.More() != Standard_True) {
+                continue;
+            }
+            builder.Add(pieces, mkCommon.Shape());
         }
-        builder.Add(pieces, mkCommon.Shape());
-    }
 
-    TopExp_Explorer expl2(copyShape, TopAbs_SHELL, TopAbs_SOLID);
-    for (; expl2.More(); expl2.Next()) {
-        const TopoDS_Shell& s = TopoDS::Shell(expl2.Current());
-        FCBRepAlgoAPI_Common mkCommon(s, tool);
-        if (!mkCommon.IsDone()) {
-            continue;
-        }
-        if (mkCommon.Shape().IsNull()) {
-            continue;
+        TopExp_Explorer expl2(copyShape, TopAbs_SHELL, TopAbs_SOLID);
+        for (; expl2.More(); expl2.Next()) {
+            const TopoDS_Shell& s = TopoDS::Shell(expl2.Current());
+            FCBRepAlgoAPI_Common mkCommon(s, tool);
+            if (!mkCommon.IsDone()) {
+                continue;
+            }
+            if (mkCommon.Shape().IsNull()) {
+                continue;
+            }
+            //Did we get a result?
+            TopExp_Explorer xp;
+            xp.Init(mkCommon.Shape(), TopAbs_SHELL);
+            if (xp.More() != Standard_True) {
+                continue;
+            }
+            builder.Add(pieces, mkCommon.Shape());
         }
-        //Did we get a result?
-        TopExp_Explorer xp;
-        xp.Init(mkCommon.Shape(), TopAbs_SHELL);
-        if (xp.More() != Standard_True) {
-            continue;
-        }
-        builder.Add(pieces, mkCommon.Shape());
-    }
 
-    // now get any loose edges in the input
-    TopExp_Explorer expl3(copyShape, TopAbs_EDGE, TopAbs_FACE);
-    for (; expl3.More(); expl3.Next()) {
-        const TopoDS_Edge& e = TopoDS::Edge(expl3.Current());
-        FCBRepAlgoAPI_Common mkCommon(e, tool);
-        if (!mkCommon.IsDone()) {
-            continue;
-        }
-        if (mkCommon.Shape().IsNull()) {
-            continue;
+        // now get any loose edges in the input
+        TopExp_Explorer expl3(copyShape, TopAbs_EDGE, TopAbs_FACE);
+        for (; expl3.More(); expl3.Next()) {
+            const TopoDS_Edge& e = TopoDS::Edge(expl3.Current());
+            FCBRepAlgoAPI_Common mkCommon(e, tool);
+            if (!mkCommon.IsDone()) {
+                continue;
+            }
+            if (mkCommon.Shape().IsNull()) {
+                continue;
+            }
+            //Did we get a result?
+            TopExp_Explorer xp;
+            xp.Init(mkCommon.Shape(), TopAbs_EDGE);
+            if (xp.More() != Standard_True) {
+                continue;
+            }
+            builder.Add(pieces, mkCommon.Shape());
         }
-        //Did we get a result?
-        TopExp_Explorer xp;
-        xp.Init(mkCommon.Shape(), TopAbs_EDGE);
-        if (xp.More() != Standard_True) {
-            continue;
-        }
-        builder.Add(pieces, mkCommon.Shape());
-    }
+        return pieces;
+    };
+    TopoDS_Shape pieces = CutCache::getResult("DetailCommon", copyShape, tool, common);
 
     // save the detail shape for further processing
     m_detailShape = pieces;
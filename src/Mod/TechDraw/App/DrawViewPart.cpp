@@ -60,6 +60,7 @@
 #include <gp_Dir.hxx>
 #include <gp_Pln.hxx>
 #include <gp_Pnt.hxx>
+#include <iomanip>
 #include <sstream>
 
 
@@ -148,6 +149,13 @@ DrawViewPart::DrawViewPart()
     ADD_PROPERTY_TYPE(ScrubCount, (Preferences::scrubCount()), sgroup, App::Prop_None,
                       "The number of times FreeCAD should try to clean the HLR result.");
 
+    ADD_PROPERTY_TYPE(HlrCache, (TopoDS_Shape()), sgroup,
+                      (App::PropertyType)(App::Prop_Output | App::Prop_Hidden),
+                      "Saved HLR result, reused if the projected shape did not change");
+    ADD_PROPERTY_TYPE(HlrCacheKey, (""), sgroup,
+                      (App::PropertyType)(App::Prop_Output | App::Prop_Hidden),
+                      "Describes the projection HlrCache was computed for");
+
     //initialize bbox to non-garbage
     bbox = Base::BoundBox3d(Base::Vector3d(0.0, 0.0, 0.0), 0.0);
 }
@@ -155,6 +163,9 @@ DrawViewPart::DrawViewPart()
 DrawViewPart::~DrawViewPart()
 {
     //don't delete this object while it still has dependent threads running
+    if (m_previewFuture.isRunning()) {
+        m_previewFuture.waitForFinished();
+    }
     if (m_hlrFuture.isRunning()) {
         Base::Console().message("%s is waiting for HLR to finish\n", Label.getValue());
         m_hlrFuture.waitForFinished();
@@ -315,6 +326,12 @@ GeometryObjectPtr DrawViewPart::makeGeometryForShape(TopoDS_Shape& shape)
     BRepBuilderAPI_Copy copier(shape, copyGeometry, copyMesh);
     TopoDS_Shape localShape = copier.Shape();
 
+    return makeGeometryForCopiedShape(localShape);
+}
+
+//! prepare a shape that is already a private copy of the source for HLR processing
+GeometryObjectPtr DrawViewPart::makeGeometryForCopiedShape(TopoDS_Shape& localShape)
+{
     gp_Pnt gCentroid = ShapeUtils::findCentroid(localShape, getProjectionCS());
     m_saveCentroid = Base::convertTo<Base::Vector3d>(gCentroid);
     m_saveShape = centerScaleRotate(this, localShape, m_saveCentroid);
@@ -351,6 +368,7 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shap
     go->setFocus(Focus.getValue());
     go->usePolygonHLR(CoarseView.getValue());
     go->setScrubCount(ScrubCount.getValue());
+    m_pendingHlrKey.clear();
 
     if (CoarseView.getValue()) {
         //the polygon approximation HLR process runs quickly, so doesn't need to be in a
@@ -359,10 +377,26 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shap
         return go;
     }
 
+    //reuse the saved result if the shape and the projection are still the same, which saves
+    //running HLR again on every view when a document is opened
+    TopoDS_Shape cached;
+    if (Preferences::cacheHlrResults()) {
+        m_pendingHlrKey = hlrCacheKey(shape, viewAxis);
+        if (m_pendingHlrKey == HlrCacheKey.getValue()) {
+            cached = HlrCache.getValue();
+        }
+    }
+    else if (!HlrCache.getValue().IsNull()) {
+        HlrCache.setValue(TopoDS_Shape());
+        HlrCacheKey.setValue("");
+    }
+
     if (!DU::isGuiUp()) {
         // if the Gui is not running (actual the event loop), we cannot use the separate thread,
         // since we will never be notified of thread completion.
-        go->projectShape(shape, viewAxis);
+        if (cached.IsNull() || !go->setHlrResult(cached)) {
+            go->projectShape(shape, viewAxis);
+        }
         return go;
     }
 
@@ -376,18 +410,96 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shap
     // We create a lambda closure to hold a copy of go, shape and viewAxis.
     // This is important because those variables might be local to the calling
     // function and might get destructed before the parallel processing finishes.
-    auto lambda = [go, shape, viewAxis]{go->projectShape(shape, viewAxis);};
+    auto lambda = [go, shape, viewAxis, cached] {
+        if (cached.IsNull() || !go->setHlrResult(cached)) {
+            go->projectShape(shape, viewAxis);
+        }
+    };
     m_hlrFuture = QtConcurrent::run(std::move(lambda));
     m_hlrWatcher.setFuture(m_hlrFuture);
     waitingForHlr(true);
 
+    if (cached.IsNull() && Preferences::progressiveHlr()) {
+        startPreview(shape, viewAxis);
+    }
+
     return go;
 }
 
+//! run the polygon HLR next to the exact one, so there is something to show while the
+//! exact result is still being computed
+void DrawViewPart::startPreview(const TopoDS_Shape& shape, const gp_Ax2& viewAxis)
+{
+    if (m_previewFuture.isRunning()) {
+        //the last preview is still running, don't pile up another one
+        return;
+    }
+
+    TechDraw::GeometryObjectPtr preview(
+        std::make_shared<TechDraw::GeometryObject>(getNameInDocument(), this));
+    preview->isPerspective(Perspective.getValue());
+    preview->setFocus(Focus.getValue());
+    preview->usePolygonHLR(true);
+    preview->setScrubCount(ScrubCount.getValue());
+    m_previewGeometryObject = preview;
+
+    connectPreviewWatcher = QObject::connect(&m_previewWatcher, &QFutureWatcherBase::finished,
+                                             &m_previewWatcher,
+                                             [this] { this->onPreviewFinished(); });
+
+    auto lambda = [preview, shape, viewAxis] {
+        //the polygon algo meshes its input, so it must not share the faces with the
+        //exact algo running at the same time
+        BRepBuilderAPI_Copy copier(shape, true, false);
+        try {
+            preview->projectShapeWithPolygonAlgo(copier.Shape(), viewAxis);
+        }
+        catch (const Base::Exception&) {
+            preview->clear();//no preview, the exact result will follow anyway
+        }
+    };
+    m_previewFuture = QtConcurrent::run(std::move(lambda));
+    m_previewWatcher.setFuture(m_previewFuture);
+}
+
+//! show the polygon result unless the exact result has arrived in the meantime
+void DrawViewPart::onPreviewFinished()
+{
+    QObject::disconnect(connectPreviewWatcher);
+    TechDraw::GeometryObjectPtr preview = m_previewGeometryObject;
+    m_previewGeometryObject = nullptr;
+    if (!preview || !waitingForHlr() || preview->getEdgeGeometry().empty()) {
+        return;
+    }
+
+    geometryObject = preview;
+    bbox = geometryObject->calcBoundingBox();
+    requestPaint();
+}
+
+//! describes everything the hlr result of shape depends on
+std::string DrawViewPart::hlrCacheKey(const TopoDS_Shape& shape, const gp_Ax2& viewAxis) const
+{
+    std::stringstream ss;
+    ss << ShapeUtils::shapeFingerprint(shape) << std::setprecision(9);
+    auto writeDir = [&ss](const gp_XYZ& xyz) {
+        ss << ";" << xyz.X() << "," << xyz.Y() << "," << xyz.Z();
+    };
+    writeDir(viewAxis.Location().XYZ());
+    writeDir(viewAxis.Direction().XYZ());
+    writeDir(viewAxis.XDirection().XYZ());
+    ss << ";" << IsoCount.getValue() << ";" << Perspective.getValue();
+    if (Perspective.getValue()) {
+        ss << ";" << Focus.getValue();
+    }
+    return ss.str();
+}
+
 //! continue processing after hlr thread completes
 void DrawViewPart::onHlrFinished()
 {
     //now that the new GeometryObject is fully populated, we can replace the old one
+    m_previewGeometryObject = nullptr;
     if (m_tempGeometryObject) {
         geometryObject = m_tempGeometryObject;//replace with new
         m_tempGeometryObject = nullptr;       //superfluous?
@@ -396,6 +508,13 @@ void DrawViewPart::onHlrFinished()
         throw Base::RuntimeError("DrawViewPart has lost its geometry object");
     }
 
+    if (!m_pendingHlrKey.empty() && m_pendingHlrKey != HlrCacheKey.getValue()) {
+        //keep the result with the document, see buildGeometryObject
+        HlrCache.setValue(geometryObject->getHlrResult());
+        HlrCacheKey.setValue(m_pendingHlrKey);
+    }
+    m_pendingHlrKey.clear();
+
     if (!hasGeometry()) {
         Base::Console().error("TechDraw did not retrieve any geometry for %s/%s\n",
                               getNameInDocument(), Label.getValue());
@@ -607,60 +726,7 @@ void DrawViewPart::findFacesOld(const std::vector<BaseGeomPtr> &goEdges)
 
     //HLR algo does not provide all edge intersections for edge endpoints.
     //need to split long edges touched by Vertex of another edge
-    std::vector<splitPoint> splits;
-    std::vector<TopoDS_Edge>::iterator itOuter = nonZero.begin();
-    int iOuter = 0;
-    for (; itOuter != nonZero.end(); ++itOuter, iOuter++) {//*** itOuter != nonZero.end() - 1
-        TopoDS_Vertex v1 = TopExp::FirstVertex((*itOuter));
-        TopoDS_Vertex v2 = TopExp::LastVertex((*itOuter));
-        Bnd_Box sOuter;
-        BRepBndLib::AddOptimal(*itOuter, sOuter);
-        sOuter.SetGap(0.1);
-        if (sOuter.IsVoid()) {
-            continue;
-        }
-        if (DrawUtil::isZeroEdge(*itOuter)) {
-            continue;                   //skip zero length edges. shouldn't happen ;)
-        }
-        int iInner = 0;
-        std::vector<TopoDS_Edge>::iterator itInner = nonZero.begin();//***sb itOuter + 1;
-        for (; itInner != nonZero.end(); ++itInner, iInner++) {
-            if (iInner == iOuter) {
-                continue;
-            }
-            if (DrawUtil::isZeroEdge((*itInner))) {
-                continue;//skip zero length edges. shouldn't happen ;)
-            }
-
-            Bnd_Box sInner;
-            BRepBndLib::AddOptimal(*itInner, sInner);
-            sInner.SetGap(0.1);
-            if (sInner.IsVoid()) {
-                continue;
-            }
-            if (sOuter.IsOut(sInner)) {//bboxes of edges don't intersect, don't bother
-                continue;
-            }
-
-            double param = -1;
-            if (DrawProjectSplit::isOnEdge((*itInner), v1, param, false)) {
-                gp_Pnt pnt1 = BRep_Tool::Pnt(v1);
-                splitPoint s1;
-                s1.i = iInner;
-                s1.v = Base::Vector3d(pnt1.X(), pnt1.Y(), pnt1.Z());
-                s1.param = param;
-                splits.push_back(s1);
-            }
-            if (DrawProjectSplit::isOnEdge((*itInner), v2, param, false)) {
-                gp_Pnt pnt2 = BRep_Tool::Pnt(v2);
-                splitPoint s2;
-                s2.i = iInner;
-                s2.v = Base::Vector3d(pnt2.X(), pnt2.Y(), pnt2.Z());
-                s2.param = param;
-                splits.push_back(s2);
-            }
-        }//inner loop
-    }    //outer loop
+    std::vector<splitPoint> splits = DrawProjectSplit::findSplitPoints(nonZero);
 
     std::vector<splitPoint> sorted = DrawProjectSplit::sortSplits(splits, true);
     auto last = std::unique(sorted.begin(), sorted.end(),
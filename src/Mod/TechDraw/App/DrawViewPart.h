@@ -33,7 +33,9 @@
 #include <App/DocumentObject.h>
 #include <App/FeaturePython.h>
 #include <App/PropertyLinks.h>
+#include <App/PropertyStandard.h>
 #include <Base/BoundBox.h>
+#include <Mod/Part/App/PropertyTopoShape.h>
 #include <Mod/TechDraw/TechDrawGlobal.h>
 
 #include "CosmeticExtension.h"
@@ -134,6 +136,9 @@ public:
 
     App::PropertyInteger ScrubCount;
 
+    Part::PropertyPartShape HlrCache;   //hlr result saved with the document
+    App::PropertyString HlrCacheKey;    //what HlrCache was computed from
+
     short mustExecute() const override;
     App::DocumentObjectExecReturn* execute() override;
     const char* getViewProviderName() const override { return "TechDrawGui::ViewProviderViewPart"; }
@@ -247,6 +252,7 @@ public:
 
 public Q_SLOTS:
     void onHlrFinished(void);
+    void onPreviewFinished(void);
     void onFacesFinished(void);
 
 protected:
@@ -261,7 +267,10 @@ protected:
 
     virtual TechDraw::GeometryObjectPtr buildGeometryObject(TopoDS_Shape& shape,
                                                             const gp_Ax2& viewAxis);
+    std::string hlrCacheKey(const TopoDS_Shape& shape, const gp_Ax2& viewAxis) const;
+    void startPreview(const TopoDS_Shape& shape, const gp_Ax2& viewAxis);
     virtual TechDraw::GeometryObjectPtr makeGeometryForShape(TopoDS_Shape& shape);//const??
+    TechDraw::GeometryObjectPtr makeGeometryForCopiedShape(TopoDS_Shape& localShape);
     void partExec(TopoDS_Shape& shape);
     virtual void addPoints(void);
 
@@ -289,7 +298,12 @@ private:
     QMetaObject::Connection connectFaceWatcher;
     QFutureWatcher<void> m_faceWatcher;
     QFuture<void> m_faceFuture;
+    QMetaObject::Connection connectPreviewWatcher;
+    QFutureWatcher<void> m_previewWatcher;
+    QFuture<void> m_previewFuture;
+    TechDraw::GeometryObjectPtr m_previewGeometryObject;//polygon result shown until hlr is done
 
+    std::string m_pendingHlrKey;    //key of the hlr result being computed
 };
 
 using DrawViewPartPython = App::FeaturePythonT<DrawViewPart>;
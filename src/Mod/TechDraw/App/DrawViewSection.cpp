@@ -83,6 +83,7 @@
 
 #include <Mod/Part/App/PartFeature.h>
 
+#include "CutCache.h"
 #include "DrawGeomHatch.h"
 #include "DrawHatch.h"
 #include "DrawUtil.h"
@@ -515,39 +516,45 @@ void DrawViewSection::makeSectionCut(const TopoDS_Shape& baseShape)
         BRepTools::Write(m_cuttingTool, "DVSTool.brep");// debug
     }
 
-    // perform the cut. We cut each solid in myShape individually to avoid issues
-    // where a compound BaseShape does not cut correctly.
-    BRep_Builder builder;
-    TopoDS_Compound cutPieces;
-    builder.MakeCompound(cutPieces);
-    TopExp_Explorer expl(myShape, TopAbs_SOLID);
-    for (; expl.More(); expl.Next()) {
-        const TopoDS_Solid& s = TopoDS::Solid(expl.Current());
-        FCBRepAlgoAPI_Cut mkCut(s, m_cuttingTool);
-        if (!mkCut.IsDone()) {
-            Base::Console().warning("DVS: Section cut has failed in %s\n", getNameInDocument());
-            continue;
+    // other sections of the same base shape with the same cutting tool share the result
+    bool trim = trimAfterCut();
+    auto cut = [this, &myShape, trim]() -> TopoDS_Shape {
+        // perform the cut. We cut each solid in myShape individually to avoid issues
+        // where a compound BaseShape does not cut correctly.
+        BRep_Builder builder;
+        TopoDS_Compound cutPieces;
+        builder.MakeCompound(cutPieces);
+        TopExp_Explorer expl(myShape, TopAbs_SOLID);
+        for (; expl.More(); expl.Next()) {
+            const TopoDS_Solid& s = TopoDS::Solid(expl.Current());
+            FCBRepAlgoAPI_Cut mkCut(s, m_cuttingTool);
+            if (!mkCut.IsDone()) {
+                Base::Console().warning("DVS: Section cut has failed in %s\n", getNameInDocument());
+                continue;
+            }
+            builder.Add(cutPieces, mkCut.Shape());
         }
-        builder.Add(cutPieces, mkCut.Shape());
-    }
 
-    // cutPieces contains result of cutting each subshape in baseShape with tool
-    m_cutPieces = cutPieces;
-    if (debugSection()) {
-        BRepTools::Write(cutPieces, "DVSCutPieces1.brep");// debug
-    }
+        // cutPieces contains result of cutting each subshape in baseShape with tool
+        if (debugSection()) {
+            BRepTools::Write(cutPieces, "DVSCutPieces1.brep");// debug
+        }
 
-    // second cut if requested.  Sometimes the first cut includes extra uncut
-    // pieces.
-    if (trimAfterCut()) {
-        FCBRepAlgoAPI_Cut mkCut2(cutPieces, m_cuttingTool);
-        if (mkCut2.IsDone()) {
-            m_cutPieces = mkCut2.Shape();
-            if (debugSection()) {
-                BRepTools::Write(m_cutPieces, "DVSCutPieces2.brep");// debug
+        // second cut if requested.  Sometimes the first cut includes extra uncut
+        // pieces.
+        if (trim) {
+            FCBRepAlgoAPI_Cut mkCut2(cutPieces, m_cuttingTool);
+            if (mkCut2.IsDone()) {
+                if (debugSection()) {
+                    BRepTools::Write(mkCut2.Shape(), "DVSCutPieces2.brep");// debug
+                }
+                return mkCut2.Shape();
             }
         }
-    }
+        return cutPieces;
+    };
+    m_cutPieces = CutCache::getResult(trim ? "SectionCutTrimmed" : "SectionCut", myShape,
+                                      m_cuttingTool, cut);
 
     // check for error in cut
     Bnd_Box testBox;
@@ -47,8 +47,10 @@
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
+#include <TopoDS_Iterator.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <gp_Ax1.hxx>
@@ -244,6 +246,52 @@ void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& vie
     makeTDGeometry();
 }
 
+//! the hlr output as one compound, so it can be saved and later given to setHlrResult.
+//! Missing classes of edges are represented by empty compounds to keep the order.
+TopoDS_Shape GeometryObject::getHlrResult() const
+{
+    BRep_Builder builder;
+    TopoDS_Compound result;
+    builder.MakeCompound(result);
+    for (auto& shape : {visHard, visOutline, visSmooth, visSeam, visIso,
+                        hidHard, hidOutline, hidSmooth, hidSeam, hidIso}) {
+        if (shape.IsNull()) {
+            TopoDS_Compound empty;
+            builder.MakeCompound(empty);
+            builder.Add(result, empty);
+            continue;
+        }
+        builder.Add(result, shape);
+    }
+    return result;
+}
+
+//! fill the geometry from a result of getHlrResult instead of running the hlr again
+bool GeometryObject::setHlrResult(const TopoDS_Shape& result)
+{
+    std::vector<TopoDS_Shape> shapes;
+    for (TopoDS_Iterator it(result); it.More(); it.Next()) {
+        shapes.push_back(ShapeUtils::isShapeReallyNull(it.Value()) ? TopoDS_Shape() : it.Value());
+    }
+    if (shapes.size() != 10) {
+        return false;
+    }
+
+    clear();
+    visHard = shapes[0];
+    visOutline = shapes[1];
+    visSmooth = shapes[2];
+    visSeam = shapes[3];
+    visIso = shapes[4];
+    hidHard = shapes[5];
+    hidOutline = shapes[6];
+    hidSmooth = shapes[7];
+    hidSeam = shapes[8];
+    hidIso = shapes[9];
+    makeTDGeometry();
+    return true;
+}
+
 //convert the hlr output into TD Geometry
 void GeometryObject::makeTDGeometry()
 {
@@ -440,6 +440,19 @@ int Preferences::scrubCount()
     return getPreferenceGroup("General")->GetInt("ScrubCount", 1);
 }
 
+//! save the hidden line removal results with the document, so views do not have to be
+//! projected again when the document is opened
+bool Preferences::cacheHlrResults()
+{
+    return getPreferenceGroup("HLR")->GetBool("CacheResults", true);
+}
+
+//! show a quick polygon based projection while the exact hidden line removal is running
+bool Preferences::progressiveHlr()
+{
+    return getPreferenceGroup("HLR")->GetBool("ProgressivePreview", true);
+}
+
 //! Returns the factor for the overlap of svg tiles when hatching faces
 double Preferences::svgHatchFactor()
 {
@@ -109,6 +109,8 @@ public:
 
     static bool autoCorrectDimRefs();
     static int scrubCount();
+    static bool cacheHlrResults();
+    static bool progressiveHlr();
 
     static double svgHatchFactor();
     static bool SectionUsePreviousCut();
@@ -23,8 +23,13 @@
 //! a class to contain useful shape manipulations. these methods were originally
 //  in GeometryObject.
 
+#include <cmath>
+#include <cstdint>
 #include <limits>
+#include <sstream>
 
+#include <BRepAdaptor_Curve.hxx>
+#include <BRepAdaptor_Surface.hxx>
 #include <BRepAlgo_NormalProjection.hxx>
 #include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_Copy.hxx>
@@ -409,6 +414,58 @@ bool  ShapeUtils::isShapeReallyNull(TopoDS_Shape shape)
     return shape.IsNull() || !TopoDS_Iterator(shape).More();
 }
 
+//! a compact description of the shape's geometry, so shapes can be compared without keeping a
+//! copy of them.  Unlike the TShape addresses, it stays the same when the shape is restored in a
+//! later session.
+std::string ShapeUtils::shapeFingerprint(const TopoDS_Shape& shape)
+{
+    if (shape.IsNull()) {
+        return {};
+    }
+
+    // FNV-1a over the vertex positions, a point on each edge and the kinds of curves and surfaces
+    uint64_t hash = 14695981039346656037ULL;
+    auto mix = [&hash](int64_t value) {
+        for (int i = 0; i < 8; i++) {
+            hash ^= (static_cast<uint64_t>(value) >> (8 * i)) & 0xff;
+            hash *= 1099511628211ULL;
+        }
+    };
+    auto mixPoint = [&mix](const gp_Pnt& point) {
+        constexpr double resolution = 1.0e6;
+        mix(std::llround(point.X() * resolution));
+        mix(std::llround(point.Y() * resolution));
+        mix(std::llround(point.Z() * resolution));
+    };
+
+    int vertexCount = 0;
+    for (TopExp_Explorer expl(shape, TopAbs_VERTEX); expl.More(); expl.Next()) {
+        mixPoint(BRep_Tool::Pnt(TopoDS::Vertex(expl.Current())));
+        vertexCount++;
+    }
+    int edgeCount = 0;
+    for (TopExp_Explorer expl(shape, TopAbs_EDGE); expl.More(); expl.Next()) {
+        const TopoDS_Edge& edge = TopoDS::Edge(expl.Current());
+        edgeCount++;
+        if (BRep_Tool::Degenerated(edge)) {
+            continue;
+        }
+        BRepAdaptor_Curve adapt(edge);
+        mix(adapt.GetType());
+        mixPoint(adapt.Value((adapt.FirstParameter() + adapt.LastParameter()) / 2.0));
+    }
+    int faceCount = 0;
+    for (TopExp_Explorer expl(shape, TopAbs_FACE); expl.More(); expl.Next()) {
+        BRepAdaptor_Surface adapt(TopoDS::Face(expl.Current()));
+        mix(adapt.GetType());
+        faceCount++;
+    }
+
+    std::stringstream ss;
+    ss << vertexCount << "/" << edgeCount << "/" << faceCount << "/" << std::hex << hash;
+    return ss.str();
+}
+
 bool ShapeUtils::edgesAreParallel(TopoDS_Edge edge0, TopoDS_Edge edge1)
 {
     std::pair<Base::Vector3d, Base::Vector3d> ends0 = getEdgeEnds(edge0);
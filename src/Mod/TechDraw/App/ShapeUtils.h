@@ -109,6 +109,7 @@ public:
     static std::pair<Base::Vector3d, Base::Vector3d> getEdgeEnds(TopoDS_Edge edge);
 
     static bool isShapeReallyNull(TopoDS_Shape shape);
+    static std::string shapeFingerprint(const TopoDS_Shape& shape);
 
     static bool edgesAreParallel(TopoDS_Edge edge0, TopoDS_Edge edge1);
 
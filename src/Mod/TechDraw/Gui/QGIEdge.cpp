@@ -69,6 +69,7 @@ void QGIEdge::setHiddenEdge(bool b) {
 }
 
 void QGIEdge::setPrettyNormal() {
+    isPrettyNormal = true;
     if (isHiddenEdge) {
         m_pen.setColor(getHiddenColor());
         return;
@@ -76,6 +77,24 @@ void QGIEdge::setPrettyNormal() {
     QGIPrimPath::setPrettyNormal();
 }
 
+void QGIEdge::setPrettyPre() {
+    isPrettyNormal = false;
+    QGIPrimPath::setPrettyPre();
+}
+
+void QGIEdge::setPrettySel() {
+    isPrettyNormal = false;
+    QGIPrimPath::setPrettySel();
+}
+
+void QGIEdge::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
+{
+    if (isBatched && isPrettyNormal) {
+        return;
+    }
+    QGIPrimPath::paint(painter, option, widget);
+}
+
 QColor QGIEdge::getHiddenColor()
 {
     Base::Color fcColor = Base::Color((uint32_t) Preferences::getPreferenceGroup("Colors")->GetUnsigned("HiddenColor", 0x000000FF));
@@ -96,11 +115,16 @@ QRectF QGIEdge::boundingRect() const
 
 QPainterPath QGIEdge::shape() const
 {
-    QPainterPath outline;
-    QPainterPathStroker stroker;
-    stroker.setWidth(getEdgeFuzz());
-    outline = stroker.createStroke(path());
-    return outline;
+    QPainterPath edgePath = path();
+    double fuzz = getEdgeFuzz();
+    if (fuzz != m_shapeFuzz || edgePath != m_shapePath) {
+        QPainterPathStroker stroker;
+        stroker.setWidth(fuzz);
+        m_shape = stroker.createStroke(edgePath);
+        m_shapePath = edgePath;
+        m_shapeFuzz = fuzz;
+    }
+    return m_shape;
 }
 
 void QGIEdge::mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event)
@@ -51,10 +51,20 @@ public:
     void setSmoothEdge(bool b) { isSmoothEdge = b; }
     bool getSmoothEdge() const { return(isSmoothEdge); }
     void setPrettyNormal() override;
+    void setPrettyPre() override;
+    void setPrettySel() override;
+    void paint(QPainter* painter,
+               const QStyleOptionGraphicsItem* option,
+               QWidget* widget = nullptr) override;
 
     double getEdgeFuzz() const;
 
     void setLinePen(const QPen& isoPen);
+    QPen getLinePen() const { return m_pen; }
+
+    /// In the normal state the edge is painted by the QGIEdgeLayer of its view
+    void setBatched(bool state) { isBatched = state; }
+    bool getBatched() const { return isBatched; }
 
     void setSource(TechDraw::SourceType source) { m_source = source; }
     TechDraw::SourceType getSource() const { return m_source;}
@@ -73,6 +83,13 @@ private:
     bool isCosmetic;
     bool isHiddenEdge;
     bool isSmoothEdge;
+    bool isBatched{false};
+    bool isPrettyNormal{true};
+
+    // the stroked outline for hit testing, only rebuilt if the path or fuzz changes
+    mutable QPainterPath m_shapePath;
+    mutable QPainterPath m_shape;
+    mutable double m_shapeFuzz{0.0};
 
     TechDraw::SourceType m_source{TechDraw::SourceType::GEOMETRY};
 };
@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+#include <algorithm>
+
+#include <QPainter>
+#include <QStyleOptionGraphicsItem>
+
+#include "QGIEdgeLayer.h"
+
+using namespace TechDrawGui;
+
+QGIEdgeLayer::QGIEdgeLayer()
+{
+    setFlag(QGraphicsItem::ItemIsSelectable, false);
+    setFlag(QGraphicsItem::ItemIsMovable, false);
+    setAcceptedMouseButtons(Qt::NoButton);
+    setAcceptHoverEvents(false);
+}
+
+void QGIEdgeLayer::addEdge(const QPainterPath& path, const QPen& pen)
+{
+    auto it = std::find_if(m_batches.begin(), m_batches.end(), [&pen](const auto& batch) {
+        return batch.first == pen;
+    });
+    if (it == m_batches.end()) {
+        m_batches.emplace_back(pen, QPainterPath());
+        it = std::prev(m_batches.end());
+    }
+    it->second.addPath(path);
+
+    prepareGeometryChange();
+    double margin = std::max(pen.widthF(), 1.0);
+    m_bounds |= path.controlPointRect().adjusted(-margin, -margin, margin, margin);
+}
+
+QRectF QGIEdgeLayer::boundingRect() const
+{
+    return m_bounds;
+}
+
+void QGIEdgeLayer::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
+{
+    Q_UNUSED(option);
+    Q_UNUSED(widget);
+
+    painter->save();
+    painter->setBrush(Qt::NoBrush);
+    for (const auto& batch : m_batches) {
+        painter->setPen(batch.first);
+        painter->drawPath(batch.second);
+    }
+    painter->restore();
+}
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+#pragma once
+
+#include <Mod/TechDraw/TechDrawGlobal.h>
+
+#include <vector>
+
+#include <QGraphicsItem>
+#include <QPainterPath>
+#include <QPen>
+
+#include "QGIUserTypes.h"
+
+namespace TechDrawGui
+{
+
+/**
+ * Paints the edges of a view in their normal state.
+ *
+ * The edges are merged into one path per pen, so that a view with tens of thousands of edges
+ * is painted with a few calls instead of one per QGIEdge. The QGIEdge items are kept for hit
+ * testing and only paint themselves while they are preselected or selected. The layer doesn't
+ * accept mouse events.
+ */
+class TechDrawGuiExport QGIEdgeLayer : public QGraphicsItem
+{
+public:
+    QGIEdgeLayer();
+    ~QGIEdgeLayer() override = default;
+
+    enum {Type = UserType::QGIEdgeLayer};
+    int type() const override { return Type;}
+
+    /// Adds \a path to the paths painted with \a pen
+    void addEdge(const QPainterPath& path, const QPen& pen);
+
+    QRectF boundingRect() const override;
+    void paint(QPainter* painter,
+               const QStyleOptionGraphicsItem* option,
+               QWidget* widget = nullptr) override;
+
+private:
+    std::vector<std::pair<QPen, QPainterPath>> m_batches;
+    QRectF m_bounds;
+};
+
+}
@@ -54,6 +54,7 @@ enum : int {
     QGIDimLines,
     QGIDrawingTemplate,
     QGIEdge,
+    QGIEdgeLayer,
     QGIFace,
     QGIGhostHighlight,
     //QGIHatch,  //obsolete
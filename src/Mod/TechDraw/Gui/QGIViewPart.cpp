@@ -53,6 +53,7 @@
 #include "QGICMark.h"
 #include "QGICenterLine.h"
 #include "QGIEdge.h"
+#include "QGIEdgeLayer.h"
 #include "QGIFace.h"
 #include "QGIHighlight.h"
 #include "QGIMatting.h"
@@ -316,6 +317,11 @@ void QGIViewPart::drawAllFaces(void)
     std::vector<TechDraw::DrawHatch*> regularHatches = dvp->getHatches();
     std::vector<TechDraw::DrawGeomHatch*> geomHatches = dvp->getGeomHatches();
     const std::vector<TechDraw::FacePtr>& faceGeoms = dvp->getFaceGeometry();
+    // trim the hatch lines of all the faces of a hatch at once, so they are computed concurrently
+    std::map<TechDraw::DrawGeomHatch*, std::map<int, std::vector<LineSet>>> geomHatchLines;
+    for (auto& geomHatch : geomHatches) {
+        geomHatchLines[geomHatch] = geomHatch->getTrimmedLinesForFaces();
+    }
     int iFace(0);
     for (auto& face : faceGeoms) {
         QGIFace* newFace = drawFace(face, iFace);
@@ -330,7 +336,7 @@ void QGIViewPart::drawAllFaces(void)
             // geometric hatch (from PAT hatch specification)
             newFace->isHatched(true);
             newFace->setFillMode(FillMode::GeomHatchFill);
-            std::vector<LineSet> lineSets = fGeom->getTrimmedLines(iFace);
+            std::vector<LineSet>& lineSets = geomHatchLines[fGeom][iFace];
             if (!lineSets.empty()) {
                 // this face has geometric hatch lines
                 for (auto& ls : lineSets) {
@@ -471,6 +477,47 @@ void QGIViewPart::drawAllEdges()
         //            edgeId << "QGIVP.edgePath" << i;
         //            dumpPath(edgeId.str().c_str(), edgePath);
     }
+
+    updateEdgeLayers();
+}
+
+//! Paint the visible edges in their normal state in one pass per pen and z value. The edges
+//! only paint themselves while preselected or selected, see QGIEdge::paint().
+void QGIViewPart::updateEdgeLayers()
+{
+    std::map<qreal, QGIEdgeLayer*> layers;
+    for (auto* child : childItems()) {
+        if (child->type() == UserType::QGIEdgeLayer) {
+            scene()->removeItem(child);
+            delete child;
+        }
+    }
+
+    for (auto* child : childItems()) {
+        if (child->type() != UserType::QGIEdge) {
+            continue;
+        }
+        auto* edge = static_cast<QGIEdge*>(child);
+        if (!edge->isVisibleTo(this)) {
+            edge->setBatched(false);
+            continue;
+        }
+
+        QGIEdgeLayer*& layer = layers[edge->zValue()];
+        if (!layer) {
+            layer = new QGIEdgeLayer();
+            addToGroupWithoutUpdate(layer);
+            layer->setPos(0.0, 0.0);
+            // just below the edges, so that a highlighted edge is painted on top
+            layer->setZValue(edge->zValue() - 0.5);
+            // keep the painted edges while panning, but not for printing and export
+            layer->setCacheMode(isExporting() ? NoCache : DeviceCoordinateCache);
+        }
+        QTransform toLayer = edge->itemTransform(layer);
+        layer->addEdge(toLayer.isIdentity() ? edge->path() : toLayer.map(edge->path()),
+                       edge->getLinePen());
+        edge->setBatched(true);
+    }
 }
 
 void QGIViewPart::drawAllVertexes()
@@ -647,6 +694,10 @@ void QGIViewPart::removePrimitives()
             scene()->removeItem(prim);
             delete prim;
         }
+        else if (c->type() == UserType::QGIEdgeLayer) {
+            scene()->removeItem(c);
+            delete c;
+        }
     }
     if (mdi) {
         getMDIViewPage()->blockSceneSelection(false);
@@ -1096,6 +1147,7 @@ void QGIViewPart::toggleCosmeticLines(bool state)
             edge->setCosmetic(state);
         }
     }
+    updateEdgeLayers();
 }
 
 //get hatchObj for face i if it exists
@@ -146,6 +146,7 @@ protected:
     void dumpPath(const char* text, QPainterPath path);
     void removePrimitives();
     void removeDecorations();
+    void updateEdgeLayers();
     bool prefFaceEdges();
     Base::Color prefBreaklineColor();
 
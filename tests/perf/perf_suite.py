@@ -0,0 +1,304 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+
+# ***************************************************************************
+# *   Copyright (c) 2026 FreeCAD Project Association                        *
+# *                                                                         *
+# *   This file is part of FreeCAD.                                         *
+# *                                                                         *
+# *   FreeCAD is free software: you can redistribute it and/or modify it    *
+# *   under the terms of the GNU Lesser General Public License as           *
+# *   published by the Free Software Foundation, either version 2.1 of the  *
+# *   License, or (at your option) any later version.                       *
+# *                                                                         *
+# *   FreeCAD is distributed in the hope that it will be useful, but        *
+# *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+# *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+# *   Lesser General Public License for more details.                       *
+# *                                                                         *
+# *   You should have received a copy of the GNU Lesser General Public      *
+# *   License along with FreeCAD. If not, see                               *
+# *   <https://www.gnu.org/licenses/>.                                      *
+# *                                                                         *
+# ***************************************************************************
+
+"""End-to-end performance suite.
+
+Every document of the corpus goes through the phases open, full recompute,
+save, STEP export and offscreen rendering. The wall time and the peak resident
+set size of each phase are written as JSON. Run it with FreeCAD (with
+QT_QPA_PLATFORM=offscreen) to include the rendering, or with FreeCADCmd to
+measure everything else:
+
+    FreeCADCmd tests/perf/perf_suite.py
+
+The build target Perf_run does the same. The suite is configured with
+environment variables:
+
+    FC_PERF_CORPUS  the corpus file, default corpus.json next to this script
+    FC_PERF_ROOT    directory of the relative paths of the corpus, default the
+                    source directory
+    FC_PERF_OUTPUT  the result file, default perf_results.json
+    FC_PERF_FRAMES  the number of frames to render, default 100
+
+A corpus entry either names a 'file' or a generator in 'generate' that builds
+the document, e.g. for sketches or assemblies that are larger than the files
+shipped with the sources. The peak RSS is measured per phase on Linux. On
+other systems it is the peak of the process so far, which is marked with
+"peakRssScope": "process".
+"""
+
+import json
+import math
+import os
+import platform
+import sys
+import tempfile
+import time
+import traceback
+
+import FreeCAD
+
+FRAME_WIDTH = 800
+FRAME_HEIGHT = 600
+
+
+class Skipped(Exception):
+    """Raised by a phase that doesn't apply to a document"""
+
+
+# ---------------------------------------------------------------------------
+# Peak memory
+
+
+def reset_peak_rss():
+    """Resets the peak RSS of the process, returns False if that's not supported"""
+    try:
+        with open("/proc/self/clear_refs", "w") as f:
+            f.write("5")
+        return True
+    except OSError:
+        return False
+
+
+def peak_rss():
+    """Returns the peak RSS in bytes, or None if it can't be determined"""
+    try:
+        with open("/proc/self/status") as f:
+            for line in f:
+                if line.startswith("VmHWM:"):
+                    return int(line.split()[1]) * 1024
+    except OSError:
+        pass
+    try:
+        import resource
+    except ImportError:
+        return None
+    usage = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    # ru_maxrss is in bytes on macOS and in kilobytes elsewhere
+    return usage if sys.platform == "darwin" else usage * 1024
+
+
+def measure(phase):
+    """Runs a phase and returns its time, peak RSS and error as dictionary"""
+    scope = "phase" if reset_peak_rss() else "process"
+    start = time.perf_counter()
+    result = {}
+    try:
+        info = phase()
+        if info:
+            result.update(info)
+    except Skipped as e:
+        result["skipped"] = str(e)
+    except Exception:
+        result["error"] = traceback.format_exc(limit=3)
+    result["time"] = time.perf_counter() - start
+    result["peakRss"] = peak_rss()
+    result["peakRssScope"] = scope
+    return result
+
+
+# ---------------------------------------------------------------------------
+# Generated documents
+
+
+def generate_big_sketch(doc, entry):
+    """A fully constrained staircase of 'count' line segments"""
+    import Part
+    import Sketcher
+
+    count = entry.get("count", 1000)
+    sketch = doc.addObject("Sketcher::SketchObject", "Sketch")
+    geometries = []
+    x = y = 0.0
+    for i in range(count):
+        start = FreeCAD.Vector(x, y, 0)
+        if i % 2:
+            y += 1.0 + (i % 7)
+        else:
+            x += 2.0 + (i % 5)
+        geometries.append(Part.LineSegment(start, FreeCAD.Vector(x, y, 0)))
+    sketch.addGeometry(geometries, False)
+
+    constraints = [Sketcher.Constraint("Coincident", 0, 1, -1, 1)]
+    for i, geo in enumerate(geometries):
+        constraints.append(Sketcher.Constraint("Vertical" if i % 2 else "Horizontal", i))
+        constraints.append(Sketcher.Constraint("Distance", i, geo.length()))
+        if i > 0:
+            constraints.append(Sketcher.Constraint("Coincident", i - 1, 2, i, 1))
+    sketch.addConstraint(constraints)
+
+
+def generate_link_assembly(doc, entry):
+    """'count' links to a part with a drilled block, placed on a grid"""
+    part = doc.addObject("App::Part", "Part")
+    box = doc.addObject("Part::Box", "Block")
+    box.Length = box.Width = 8
+    box.Height = 4
+    hole = doc.addObject("Part::Cylinder", "Hole")
+    hole.Radius = 2
+    hole.Height = 4
+    hole.Placement.Base = FreeCAD.Vector(4, 4, 0)
+    cut = doc.addObject("Part::Cut", "Drilled")
+    cut.Base = box
+    cut.Tool = hole
+    part.addObject(cut)
+
+    count = entry.get("count", 100)
+    columns = max(1, int(math.sqrt(count)))
+    assembly = doc.addObject("App::Part", "Assembly")
+    for i in range(count):
+        link = doc.addObject("App::Link", "Link")
+        link.LinkedObject = part
+        link.Placement.Base = FreeCAD.Vector((i % columns) * 10, (i // columns) * 10, 0)
+        assembly.addObject(link)
+
+
+GENERATORS = {
+    "big_sketch": generate_big_sketch,
+    "link_assembly": generate_link_assembly,
+}
+
+
+def prepare_document(entry, root, workdir):
+    """Returns the path of the document of a corpus entry"""
+    if "file" in entry:
+        path = entry["file"]
+        return path if os.path.isabs(path) else os.path.join(root, path)
+
+    generator = GENERATORS[entry["generate"]]
+    doc = FreeCAD.newDocument(entry["name"])
+    try:
+        generator(doc, entry)
+        doc.recompute()
+        path = os.path.join(workdir, entry["name"] + ".FCStd")
+        doc.saveAs(path)
+    finally:
+        FreeCAD.closeDocument(doc.Name)
+    return path
+
+
+# ---------------------------------------------------------------------------
+# Phases
+
+
+def exportable_objects(doc):
+    objects = []
+    for obj in doc.RootObjects:
+        if obj.isDerivedFrom("App::Part") or obj.isDerivedFrom("App::Link"):
+            objects.append(obj)
+        elif obj.isDerivedFrom("Part::Feature") and obj.Visibility:
+            objects.append(obj)
+    return objects
+
+
+def export_step(doc, path):
+    import Import
+
+    objects = exportable_objects(doc)
+    if not objects:
+        raise Skipped("no shapes")
+    Import.export(objects, path)
+    return {"objects": len(objects), "size": os.path.getsize(path)}
+
+
+def render(doc, frames, path):
+    if not FreeCAD.GuiUp:
+        raise Skipped("no GUI")
+    import FreeCADGui
+
+    view = FreeCADGui.getDocument(doc.Name).ActiveView
+    if not view or not hasattr(view, "saveImage"):
+        raise Skipped("no 3D view")
+
+    view.viewIsometric()
+    view.fitAll()
+    iso = view.getCameraOrientation()
+    axis = FreeCAD.Vector(0, 0, 1)
+    # Every frame is rendered offscreen into an image, so the time includes writing it
+    for i in range(frames):
+        view.setCameraOrientation(FreeCAD.Rotation(axis, 360.0 * i / frames).multiply(iso))
+        view.saveImage(path, FRAME_WIDTH, FRAME_HEIGHT, "Current")
+    return {"frames": frames, "width": FRAME_WIDTH, "height": FRAME_HEIGHT}
+
+
+def run_document(entry, root, workdir, frames):
+    result = {"name": entry["name"], "category": entry.get("category", "")}
+    try:
+        path = prepare_document(entry, root, workdir)
+    except Exception:
+        result["error"] = traceback.format_exc(limit=3)
+        return result
+
+    phases = {}
+    state = {}
+
+    def open_document():
+        state["doc"] = FreeCAD.openDocument(path)
+        return {"objects": len(state["doc"].Objects)}
+
+    phases["open"] = measure(open_document)
+    doc = state.get("doc")
+    if doc:
+        base = os.path.join(workdir, entry["name"])
+        phases["recompute"] = measure(lambda: {"recomputed": doc.recompute(None, True)})
+        phases["save"] = measure(lambda: doc.saveAs(base + "_saved.FCStd"))
+        phases["exportStep"] = measure(lambda: export_step(doc, base + ".step"))
+        phases["render"] = measure(lambda: render(doc, frames, base + ".png"))
+        FreeCAD.closeDocument(doc.Name)
+
+    result["phases"] = phases
+    return result
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    corpus_file = os.environ.get("FC_PERF_CORPUS", os.path.join(here, "corpus.json"))
+    root = os.environ.get("FC_PERF_ROOT", os.path.dirname(os.path.dirname(here)))
+    output = os.environ.get("FC_PERF_OUTPUT", "perf_results.json")
+    frames = int(os.environ.get("FC_PERF_FRAMES", "100"))
+
+    with open(corpus_file) as f:
+        corpus = json.load(f)
+
+    results = {
+        "version": FreeCAD.Version()[:3],
+        "platform": platform.platform(),
+        "gui": bool(FreeCAD.GuiUp),
+        "documents": [],
+    }
+    with tempfile.TemporaryDirectory(prefix="fc_perf_") as workdir:
+        for entry in corpus["documents"]:
+            FreeCAD.Console.PrintMessage("Measuring {}\n".format(entry["name"]))
+            results["documents"].append(run_document(entry, root, workdir, frames))
+
+    with open(output, "w") as f:
+        json.dump(results, f, indent=2)
+    FreeCAD.Console.PrintMessage("Results written to {}\n".format(os.path.abspath(output)))
+
+
+main()
+
+if FreeCAD.GuiUp:
+    from PySide import QtCore, QtGui
+
+    QtCore.QTimer.singleShot(0, QtGui.QApplication.quit)
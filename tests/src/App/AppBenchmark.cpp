@@ -0,0 +1,277 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+// Micro-benchmarks of the hot paths in App. They are built as App_benchmark_run when Google
+// Benchmark is available and are not part of the regular test run. Run with
+// --benchmark_format=json or --benchmark_out=<file> --benchmark_out_format=json to get
+// results that can be compared between versions.
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/ElementMap.h>
+#include <App/Expression.h>
+#include <App/ExpressionParser.h>
+#include <App/FeatureTest.h>
+#include <App/StringHasher.h>
+#include <Base/Reader.h>
+#include <src/App/InitApplication.h>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-non-const-global-variables)
+
+namespace
+{
+
+// Opens a new document for the duration of a benchmark
+class TestDocument
+{
+public:
+    TestDocument()
+        : name(App::GetApplication().getUniqueDocumentName("benchmark"))
+        , doc(App::GetApplication().newDocument(name.c_str(), "benchmark"))
+    {}
+    ~TestDocument()
+    {
+        App::GetApplication().closeDocument(name.c_str());
+    }
+    TestDocument(const TestDocument&) = delete;
+    TestDocument& operator=(const TestDocument&) = delete;
+
+    App::Document* operator->() const
+    {
+        return doc;
+    }
+    App::Document* get() const
+    {
+        return doc;
+    }
+
+private:
+    std::string name;
+    App::Document* doc;
+};
+
+// Mapped names as produced by a few levels of topological naming
+std::vector<Data::MappedName> makeMappedNames(int count)
+{
+    std::vector<Data::MappedName> names;
+    names.reserve(count);
+    for (int i = 1; i <= count; ++i) {
+        names.emplace_back("Edge" + std::to_string(i) + ";:G;XTR;:H" + std::to_string(i % 97)
+                           + ":7,F;:M;FUS;:H2:4,F");
+    }
+    return names;
+}
+
+// Layered dependency graph of `depth` layers of `width` objects, each object depends on two
+// objects of the previous layer. Returns the objects of the first layer.
+std::vector<App::DocumentObject*> makeLayeredGraph(App::Document* doc, int width, int depth)
+{
+    std::vector<App::DocumentObject*> roots;
+    std::vector<App::DocumentObject*> previous;
+    for (int layer = 0; layer < depth; ++layer) {
+        std::vector<App::DocumentObject*> current;
+        for (int i = 0; i < width; ++i) {
+            auto obj = doc->addObject<App::FeatureTest>("Feature");
+            obj->Integer.setValue(layer * width + i);
+            if (!previous.empty()) {
+                obj->LinkList.setValues({previous[i], previous[(i + 1) % width]});
+            }
+            current.push_back(obj);
+        }
+        if (layer == 0) {
+            roots = current;
+        }
+        previous.swap(current);
+    }
+    return roots;
+}
+
+void ElementMapCreation(benchmark::State& state)
+{
+    auto count = static_cast<int>(state.range(0));
+    auto names = makeMappedNames(count);
+    App::StringHasherRef hasher(new App::StringHasher);
+    for (auto _ : state) {
+        Data::ElementMap map;
+        map.hasher = hasher;
+        for (int i = 0; i < count; ++i) {
+            map.setElementName(Data::IndexedName("Edge", i + 1), names[i], 1);
+        }
+        benchmark::DoNotOptimize(map.size());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(ElementMapCreation)->Arg(100)->Arg(10000);
+
+void ElementMapLookup(benchmark::State& state)
+{
+    auto count = static_cast<int>(state.range(0));
+    auto names = makeMappedNames(count);
+    Data::ElementMap map;
+    map.hasher = App::StringHasherRef(new App::StringHasher);
+    for (int i = 0; i < count; ++i) {
+        map.setElementName(Data::IndexedName("Edge", i + 1), names[i], 1);
+    }
+    for (auto _ : state) {
+        for (int i = 0; i < count; ++i) {
+            benchmark::DoNotOptimize(map.find(names[i]));
+            benchmark::DoNotOptimize(map.find(Data::IndexedName("Edge", i + 1)));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * count * 2);
+}
+BENCHMARK(ElementMapLookup)->Arg(100)->Arg(10000);
+
+void StringHasherGetID(benchmark::State& state)
+{
+    auto count = static_cast<int>(state.range(0));
+    bool existing = state.range(1) != 0;
+    std::vector<std::string> texts;
+    texts.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        texts.push_back("Face" + std::to_string(i) + ";:H1a2b,F;:M2;FUS");
+    }
+    App::StringHasherRef hasher(new App::StringHasher);
+    for (auto _ : state) {
+        if (!existing) {
+            state.PauseTiming();
+            hasher = App::StringHasherRef(new App::StringHasher);
+            state.ResumeTiming();
+        }
+        for (const auto& text : texts) {
+            benchmark::DoNotOptimize(hasher->getID(text.c_str(), int(text.size())));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(StringHasherGetID)
+    ->ArgNames({"count", "existing"})
+    ->Args({1000, 0})
+    ->Args({1000, 1})
+    ->Args({100000, 1});
+
+const char* const expressionText = "Float * 2 + sqrt(Integer + 4) / 3 - cos(Angle) * Float";
+
+void ExpressionParse(benchmark::State& state)
+{
+    TestDocument doc;
+    auto owner = doc->addObject<App::FeatureTest>("Owner");
+    for (auto _ : state) {
+        std::unique_ptr<App::Expression> expr(App::ExpressionParser::parse(owner, expressionText));
+        benchmark::DoNotOptimize(expr.get());
+    }
+}
+BENCHMARK(ExpressionParse);
+
+void ExpressionEvaluate(benchmark::State& state)
+{
+    TestDocument doc;
+    auto owner = doc->addObject<App::FeatureTest>("Owner");
+    owner->Float.setValue(1.5);
+    owner->Integer.setValue(12);
+    std::unique_ptr<App::Expression> expr(App::ExpressionParser::parse(owner, expressionText));
+    for (auto _ : state) {
+        std::unique_ptr<App::Expression> result(expr->eval());
+        benchmark::DoNotOptimize(result.get());
+    }
+}
+BENCHMARK(ExpressionEvaluate);
+
+void PropertyLookup(benchmark::State& state)
+{
+    TestDocument doc;
+    auto obj = doc->addObject<App::FeatureTest>("Feature");
+    const std::vector<const char*> names {"Label", "Integer", "Placement", "LinkSubList",
+                                          "TypeNoRecompute", "NoSuchProperty"};
+    for (auto _ : state) {
+        for (auto name : names) {
+            benchmark::DoNotOptimize(obj->getPropertyByName(name));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(names.size()));
+}
+BENCHMARK(PropertyLookup);
+
+void DocumentRecompute(benchmark::State& state)
+{
+    auto width = static_cast<int>(state.range(0));
+    auto depth = static_cast<int>(state.range(1));
+    TestDocument doc;
+    auto roots = makeLayeredGraph(doc.get(), width, depth);
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (auto obj : roots) {
+            obj->touch();
+        }
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(doc->recompute());
+    }
+    state.SetItemsProcessed(state.iterations() * width * depth);
+}
+BENCHMARK(DocumentRecompute)
+    ->ArgNames({"width", "depth"})
+    ->Args({1, 100})
+    ->Args({10, 10})
+    ->Args({50, 20})
+    ->Unit(benchmark::kMillisecond);
+
+void DocumentSave(benchmark::State& state)
+{
+    auto count = static_cast<int>(state.range(0));
+    TestDocument doc;
+    makeLayeredGraph(doc.get(), count / 10, 10);
+    auto objects = doc->getObjects();
+    for (auto _ : state) {
+        std::ostringstream out;
+        doc->exportObjects(objects, out);
+        benchmark::DoNotOptimize(out.tellp());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(DocumentSave)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+void DocumentRestore(benchmark::State& state)
+{
+    auto count = static_cast<int>(state.range(0));
+    std::string data;
+    {
+        TestDocument source;
+        makeLayeredGraph(source.get(), count / 10, 10);
+        std::ostringstream out;
+        source->exportObjects(source->getObjects(), out);
+        data = out.str();
+    }
+    TestDocument doc;
+    for (auto _ : state) {
+        std::istringstream in(data);
+        Base::XMLReader reader("Document.xml", in);
+        benchmark::DoNotOptimize(doc->importObjects(reader).size());
+        state.PauseTiming();
+        doc->clearDocument();
+        state.ResumeTiming();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(data.size()));
+}
+BENCHMARK(DocumentRestore)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    tests::initApplication();
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-non-const-global-variables)
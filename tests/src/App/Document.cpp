@@ -5,10 +5,16 @@
 
 #include "App/Application.h"
 #include "App/Document.h"
+#include "App/FeatureTest.h"
+#include "App/RecomputeStats.h"
 #include "App/StringHasher.h"
+#include "Base/Interpreter.h"
 #include "Base/Writer.h"
 #include <src/App/InitApplication.h>
 
+#include <chrono>
+#include <thread>
+
 using ::testing::Eq;
 using ::testing::Ne;
 
@@ -94,4 +100,264 @@ TEST_F(DocumentTest, getStringHasherGivesExpectedHasher)
     EXPECT_EQ(hasher, foundHasher);
 }
 
+TEST_F(DocumentTest, getRecomputeStatsRecordsEachObject)
+{
+    // Arrange
+    doc()->addObject("App::FeatureTest", "First");
+    doc()->addObject("App::FeatureTest", "Second");
+
+    // Act
+    doc()->recompute();
+    const auto& stats = doc()->getRecomputeStats();
+
+    // Assert
+    EXPECT_EQ(stats.getObjects().size(), 2);
+    for (const auto& entry : stats.getObjects()) {
+        EXPECT_GE(entry.wallTime, 0.0);
+        EXPECT_LE(entry.wallTime, stats.getTotalTime());
+    }
+}
+
+TEST_F(DocumentTest, getRecomputeStatsFollowsDependencyChain)
+{
+    // Arrange
+    auto first = doc()->addObject<App::FeatureTest>("First");
+    auto second = doc()->addObject<App::FeatureTest>("Second");
+    auto third = doc()->addObject<App::FeatureTest>("Third");
+    second->Link.setValue(first);
+    third->Link.setValue(second);
+
+    // Act
+    doc()->recompute();
+    const auto& stats = doc()->getRecomputeStats();
+
+    // Assert
+    std::vector<std::string> expected {"First", "Second", "Third"};
+    EXPECT_EQ(stats.getCriticalPath(), expected);
+    EXPECT_LE(stats.getCriticalPathTime(), stats.getTotalTime());
+}
+
+TEST_F(DocumentTest, recomputeStatsSeparatesObjectsOfSameName)
+{
+    // Arrange
+    std::string otherName = App::GetApplication().getUniqueDocumentName("other");
+    auto other = App::GetApplication().newDocument(otherName.c_str(), "testUser");
+    auto first = doc()->addObject<App::FeatureTest>("Body");
+    auto second = other->addObject<App::FeatureTest>("Body");
+    App::RecomputeStats stats;
+
+    // Act
+    stats.begin();
+    {
+        App::RecomputeStats::ObjectTimer timer(stats, first);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    {
+        App::RecomputeStats::ObjectTimer timer(stats, second);
+    }
+    stats.finish({first, second});
+
+    // Assert: the longer recompute of the first object is not replaced by the second one
+    ASSERT_EQ(stats.getObjects().size(), 2);
+    EXPECT_EQ(stats.getCriticalPath().size(), 1);
+    EXPECT_DOUBLE_EQ(stats.getCriticalPathTime(), stats.getObjects().front().wallTime);
+
+    App::GetApplication().closeDocument(otherName.c_str());
+}
+
+TEST_F(DocumentTest, recomputeFollowsChangedLinks)
+{
+    // Arrange
+    auto first = doc()->addObject<App::FeatureTest>("First");
+    auto second = doc()->addObject<App::FeatureTest>("Second");
+    second->Link.setValue(first);
+    doc()->recompute();
+    auto revision = App::DocumentObject::getDependencyRevision();
+
+    // Act
+    second->Link.setValue(nullptr);
+    first->Link.setValue(second);
+    first->touch();
+    second->touch();
+    doc()->recompute();
+
+    // Assert
+    std::vector<std::string> expected {"Second", "First"};
+    EXPECT_NE(App::DocumentObject::getDependencyRevision(), revision);
+    EXPECT_EQ(doc()->getRecomputeStats().getCriticalPath(), expected);
+}
+
+TEST_F(DocumentTest, bulkUpdateCoalescesChanges)
+{
+    // Arrange
+    auto existing = doc()->addObject<App::FeatureTest>("Existing");
+    std::vector<std::vector<App::BulkChange>> batches;
+    int changeSignals = 0;
+    fastsignals::scoped_connection bulkConnection = doc()->signalBulkChanged.connect(
+        [&batches](const App::Document&, const std::vector<App::BulkChange>& changes) {
+            batches.push_back(changes);
+        });
+    fastsignals::scoped_connection changeConnection = doc()->signalChangedObject.connect(
+        [&changeSignals](const App::DocumentObject&, const App::Property&) {
+            changeSignals++;
+        });
+
+    // Act
+    {
+        App::BulkUpdateLocker outer(doc());
+        App::BulkUpdateLocker inner(doc());
+        existing->Integer.setValue(1);
+        existing->Integer.setValue(2);
+        existing->Float.setValue(1.0);
+        auto created = doc()->addObject<App::FeatureTest>("Created");
+        created->Integer.setValue(3);
+        auto removed = doc()->addObject<App::FeatureTest>("Removed");
+        removed->Integer.setValue(4);
+        doc()->removeObject(removed->getNameInDocument());
+    }
+
+    // Assert
+    ASSERT_EQ(batches.size(), 1);
+    const auto& changes = batches.front();
+    ASSERT_EQ(changes.size(), 2);
+    std::vector<std::string> expected {"Integer", "Float"};
+    EXPECT_EQ(changes[0].object, existing);
+    EXPECT_FALSE(changes[0].created);
+    EXPECT_EQ(changes[0].properties, expected);
+    EXPECT_STREQ(changes[1].object->getNameInDocument(), "Created");
+    EXPECT_TRUE(changes[1].created);
+    EXPECT_FALSE(doc()->isBulkUpdating());
+    EXPECT_GE(changeSignals, 5);
+}
+
+TEST_F(DocumentTest, getObjectsOfTypeKeepsCreationOrder)
+{
+    // Arrange
+    auto first = doc()->addObject<App::FeatureTest>("First");
+    auto column = doc()->addObject<App::FeatureTestColumn>("Column");
+    auto second = doc()->addObject<App::FeatureTestException>("Second");
+    auto removed = doc()->addObject<App::FeatureTest>("Removed");
+    auto third = doc()->addObject<App::FeatureTest>("Third");
+    doc()->removeObject(removed->getNameInDocument());
+
+    // Act
+    auto objects = doc()->getObjectsOfType(App::FeatureTest::getClassTypeId());
+    auto exceptions = doc()->getObjectsOfType(App::FeatureTestException::getClassTypeId());
+    auto any = doc()->getObjectsOfType(
+        std::vector<Base::Type> {App::FeatureTestColumn::getClassTypeId(),
+                                 App::FeatureTestException::getClassTypeId()});
+
+    // Assert
+    std::vector<App::DocumentObject*> expected {first, second, third};
+    EXPECT_EQ(objects, expected);
+    EXPECT_EQ(exceptions, std::vector<App::DocumentObject*> {second});
+    EXPECT_EQ(any, (std::vector<App::DocumentObject*> {column, second}));
+    EXPECT_EQ(doc()->countObjectsOfType<App::FeatureTest>(), 3);
+    EXPECT_EQ(doc()->findObjects(App::FeatureTest::getClassTypeId(), "^Th", nullptr).size(), 1);
+}
+
+TEST_F(DocumentTest, getObjectsByLabelFollowsRelabel)
+{
+    // Arrange
+    auto first = doc()->addObject<App::FeatureTest>("First");
+    auto second = doc()->addObject<App::FeatureTest>("Second");
+    first->Label.setValue("Part");
+    second->Label.setValue("Other");
+    auto before = doc()->getObjectsByLabel("Part");
+
+    // Act
+    first->Label.setValue("Renamed");
+
+    // Assert
+    EXPECT_EQ(before, std::vector<App::DocumentObject*> {first});
+    EXPECT_TRUE(doc()->getObjectsByLabel("Part").empty());
+    EXPECT_EQ(doc()->getObjectsByLabel("Renamed"), std::vector<App::DocumentObject*> {first});
+    EXPECT_EQ(doc()->getObjectsByLabel("Other"), std::vector<App::DocumentObject*> {second});
+    EXPECT_TRUE(doc()->getObjectsByLabel("NoSuchLabel").empty());
+}
+
+TEST_F(DocumentTest, recomputeOfGILFreeObjectKeepsCallerLock)
+{
+    // Arrange
+    auto placement = doc()->addObject<App::FeatureTestPlacement>("Placement");
+    auto feature = doc()->addObject<App::FeatureTest>("Feature");
+    placement->Input1.setValue(Base::Placement(Base::Vector3d(1, 0, 0), Base::Rotation()));
+    placement->Input2.setValue(Base::Placement(Base::Vector3d(0, 2, 0), Base::Rotation()));
+
+    // Act
+    bool locked = false;
+    {
+        Base::PyGILStateLocker lock;
+        doc()->recompute();
+        locked = PyGILState_Check() != 0;
+    }
+
+    // Assert
+    EXPECT_TRUE(placement->isExecuteGILFree());
+    EXPECT_FALSE(feature->isExecuteGILFree());
+    EXPECT_TRUE(locked);
+    EXPECT_EQ(placement->MultLeft.getValue().getPosition(), Base::Vector3d(1, 2, 0));
+    EXPECT_FALSE(placement->isTouched());
+}
+
+TEST_F(DocumentTest, importPropertiesRestoresExportedValues)
+{
+    // Arrange
+    auto source = doc()->addObject<App::FeatureTestPlacement>("Source");
+    auto target = doc()->addObject<App::FeatureTestPlacement>("Target");
+    Base::Placement value(Base::Vector3d(1, 2, 3), Base::Rotation());
+    source->MultLeft.setValue(value);
+    source->Input1.setValue(value);
+
+    // Act
+    std::stringstream str;
+    doc()->exportProperties(source, {&source->MultLeft}, str);
+    doc()->importProperties(target, str);
+
+    // Assert
+    EXPECT_EQ(target->MultLeft.getValue(), value);
+    EXPECT_EQ(target->Input1.getValue(), Base::Placement());
+}
+
+TEST_F(DocumentTest, undoAfterUnrecordedListChange)
+{
+    // Arrange
+    doc()->setUndoMode(1);
+    auto feature = doc()->addObject<App::FeatureTest>("Feature");
+    feature->FloatList.setValues({1.0, 2.0, 3.0, 4.0, 5.0});
+    doc()->openTransaction("Change");
+    feature->FloatList.set1Value(2, 9.0);
+    doc()->commitTransaction();
+
+    // Act: the undo copy only holds the middle entry, then the head and the
+    // tail are changed without a transaction, like a solver does in a recompute
+    feature->FloatList.setValues({0.0, 2.0, 9.0, 4.0, 6.0});
+    bool undone = doc()->undo();
+
+    // Assert
+    EXPECT_TRUE(undone);
+    EXPECT_EQ(feature->FloatList.getValues(), std::vector<double>({1.0, 2.0, 3.0, 4.0, 5.0}));
+}
+
+TEST_F(DocumentTest, undoMemUsageIsSeparateFromLimit)
+{
+    // Arrange
+    doc()->setUndoMode(1);
+    doc()->setUndoLimit(1024 * 1024);
+    auto feature = doc()->addObject<App::FeatureTest>("Feature");
+    doc()->openTransaction("Change");
+    feature->String.setValue(std::string(1000, 'x'));
+    doc()->commitTransaction();
+
+    // Act
+    unsigned int limit = doc()->getUndoMemSize();
+    std::size_t usage = doc()->getUndoMemUsage();
+    doc()->setUndoLimit(0);
+
+    // Assert
+    EXPECT_EQ(limit, 1024 * 1024);
+    EXPECT_GT(usage, 0);
+    EXPECT_LT(usage, limit);
+}
+
 // NOLINTEND(readability-magic-numbers)
@@ -155,4 +155,30 @@ TEST_F(DocumentObjectTest, getSubObjectList)
     EXPECT_EQ(sizesFlatten[1], strlen(fuseName) + strlen(boxName) + 2);
 }
 
+TEST_F(DocumentObjectTest, globalGroupPlacementFollowsChanges)
+{
+    // Arrange
+    auto outer {_doc->addObject("App::Part")};
+    auto inner {_doc->addObject("App::Part")};
+    auto outerExt {outer->getExtensionByType<GeoFeatureGroupExtension>()};
+    auto innerExt {inner->getExtensionByType<GeoFeatureGroupExtension>()};
+    outerExt->addObject(inner);
+    outerExt->placement().setValue(Base::Placement(Base::Vector3d(1, 0, 0), Base::Rotation()));
+    innerExt->placement().setValue(Base::Placement(Base::Vector3d(0, 2, 0), Base::Rotation()));
+
+    // Act
+    auto nested {innerExt->globalGroupPlacement()};
+    auto cached {innerExt->globalGroupPlacement()};
+    outerExt->placement().setValue(Base::Placement(Base::Vector3d(3, 0, 0), Base::Rotation()));
+    auto moved {innerExt->globalGroupPlacement()};
+    outerExt->removeObject(inner);
+    auto removed {innerExt->globalGroupPlacement()};
+
+    // Assert
+    EXPECT_EQ(nested.getPosition(), Base::Vector3d(1, 2, 0));
+    EXPECT_EQ(cached.getPosition(), Base::Vector3d(1, 2, 0));
+    EXPECT_EQ(moved.getPosition(), Base::Vector3d(3, 2, 0));
+    EXPECT_EQ(removed.getPosition(), Base::Vector3d(0, 2, 0));
+}
+
 // NOLINTEND(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
@@ -2,7 +2,10 @@
 
 #include <gtest/gtest.h>
 
+#include <sstream>
+
 #include <App/Application.h>
+#include <App/CompactStream.h>
 #include <App/ElementMap.h>
 #include <src/App/InitApplication.h>
 
@@ -560,4 +563,42 @@ TEST_F(ElementMapTest, addAndGetChildElementsTest)
         return e.indexedName.toString() == "Pong2";
     }));
 }
+
+TEST_F(ElementMapTest, saveAndRestoreBinary)
+{
+    // Arrange
+    LessComplexPart cube(1L, "Box", _hasher);
+    LessComplexPart other(2L, "Other", _hasher);
+    Data::ElementMap::MappedChildElements child = {
+        Data::IndexedName("Face", 1),
+        0,
+        6,
+        2L,
+        other.elementMapPtr,
+        QByteArray(";:H2,F"),
+        _sid
+    };
+    cube.elementMapPtr->addChildElements(cube.Tag, {child});
+    Data::IndexedName edge("Edge", 1);
+    cube.elementMapPtr->setElementName(edge, Data::MappedName("Edge1;:M2,E"), cube.Tag);
+    std::ostringstream binary;
+    std::ostringstream text;
+    cube.elementMapPtr->save(text);
+
+    // Act
+    cube.elementMapPtr->saveBinary(binary);
+    std::string buffer = binary.str();
+    App::CompactInputStream stream(buffer);
+    auto restored = std::make_shared<Data::ElementMap>()->restoreBinary(_hasher, stream);
+
+    // Assert
+    std::ostringstream restoredText;
+    restored->save(restoredText);
+    EXPECT_EQ(stream.remaining(), 0U);
+    EXPECT_LT(buffer.size(), text.str().size());
+    EXPECT_EQ(restoredText.str(), text.str());
+    EXPECT_EQ(restored->size(), cube.elementMapPtr->size());
+    EXPECT_EQ(restored->getChildElements().size(), 1);
+}
+
 // NOLINTEND(readability-magic-numbers)
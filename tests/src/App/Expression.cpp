@@ -30,6 +30,8 @@
 #include "App/Expression.h"
 #include "App/ExpressionParser.h"
 #include "App/ExpressionTokenizer.h"
+#include "App/PropertyUnits.h"
+#include "Base/Interpreter.h"
 
 // +------------------------------------------------+
 // | Note: For more expression related tests, see:  |
@@ -412,4 +414,51 @@ TEST_F(Evaluate, test_simplify_refer_to_var)
     EXPECT_EQ(e->toString(), "sqrt(2 + Var)");
     EXPECT_EQ(simplified->toString(), "sqrt(2 + Var)");
 }
+
+// The numeric evaluation must give the same values and types as Python
+TEST_F(Evaluate, test_numeric_value_matches_python)
+{
+    auto* length = freecad_cast<App::PropertyLength*>(this_obj()->addDynamicProperty("App::PropertyLength", "Length"));
+    length->setValue(2.5);
+    auto* count = freecad_cast<App::PropertyInteger*>(this_obj()->addDynamicProperty("App::PropertyInteger", "Count"));
+    count->setValue(3);
+    auto* factor = freecad_cast<App::PropertyFloat*>(this_obj()->addDynamicProperty("App::PropertyFloat", "Factor"));
+    factor->setValue(0.5);
+
+    for (const char* expr : {"1 + 2", "7 / 2", "6 / 3", "-4 * 2", "1.5 * 2", "2 mm * 3",
+                             "10 mm / 2 mm", "pi * 2", "Count * 2", "Count / 2", "Factor * Count",
+                             "Length", "Length * Count + 1 mm", "-Length / Factor", "+Count"}) {
+        std::unique_ptr<App::Expression> e(App::ExpressionParser::parse(this_obj(), expr));
+        App::any value = e->getValueAsAny();
+        Base::PyGILStateLocker lock;
+        App::any pyValue = App::pyObjectToAny(e->getPyValue());
+        EXPECT_EQ(value.type(), pyValue.type()) << expr;
+        EXPECT_TRUE(App::isAnyEqual(value, pyValue)) << expr;
+    }
+}
+
+TEST_F(Evaluate, test_numeric_value_errors_from_python)
+{
+    for (const char* expr : {"1 mm + 1", "1 / 0", "1.5 / 0"}) {
+        std::unique_ptr<App::Expression> e(App::ExpressionParser::parse(this_obj(), expr));
+        EXPECT_THROW(e->getValueAsAny(), Base::Exception) << expr;
+    }
+}
+
+TEST_F(Evaluate, test_parse_cache_returns_copies)
+{
+    App::ExpressionParser::ParseCache cache;
+    std::unique_ptr<App::Expression> first(App::ExpressionParser::parse(this_obj(), "1 mm + 2 mm"));
+    std::unique_ptr<App::Expression> second(App::ExpressionParser::parse(this_obj(), "1 mm + 2 mm"));
+    EXPECT_NE(first.get(), second.get());
+    EXPECT_EQ(first->toString(), second->toString());
+
+    // a changed copy does not affect later results
+    first->comment = "changed";
+    std::unique_ptr<App::Expression> third(App::ExpressionParser::parse(this_obj(), "1 mm + 2 mm"));
+    EXPECT_TRUE(third->comment.empty());
+
+    EXPECT_THROW(App::ExpressionParser::parse(this_obj(), "1 +"), Base::Exception);
+    EXPECT_THROW(App::ExpressionParser::parse(this_obj(), "1 +"), Base::Exception);
+}
 // clang-format on
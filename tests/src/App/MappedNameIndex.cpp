@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include "App/MappedNameIndex.h"
+
+#include <map>
+#include <string>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+TEST(MappedNameIndex, insertAndFind)
+{
+    // Arrange
+    Data::MappedNameIndex index;
+    Data::MappedName name("Face1;:M;FUS");
+
+    // Act
+    auto first = index.insert(name, Data::IndexedName("Face", 1));
+    auto second = index.insert(name, Data::IndexedName("Face", 2));
+
+    // Assert
+    EXPECT_TRUE(first.second);
+    EXPECT_FALSE(second.second);
+    EXPECT_EQ(index.size(), 1);
+    ASSERT_NE(index.find(name), nullptr);
+    EXPECT_EQ(index.find(name)->index, Data::IndexedName("Face", 1));
+    EXPECT_EQ(index.find(Data::MappedName("Face2")), nullptr);
+}
+
+TEST(MappedNameIndex, hashIgnoresPostfixSplit)
+{
+    // Arrange
+    Data::MappedName whole("Edge3;:H1");
+    Data::MappedName split(Data::MappedName("Edge3"), ";:H1");
+    Data::MappedNameIndex index;
+    index.insert(whole, Data::IndexedName("Edge", 3));
+
+    // Assert
+    EXPECT_EQ(whole, split);
+    EXPECT_EQ(Data::MappedNameIndex::hashName(whole), Data::MappedNameIndex::hashName(split));
+    EXPECT_NE(index.find(split), nullptr);
+}
+
+TEST(MappedNameIndex, eraseKeepsOthers)
+{
+    // Arrange
+    Data::MappedNameIndex index;
+    for (int i = 1; i <= 1000; ++i) {
+        index.insert(Data::MappedName("Face" + std::to_string(i)), Data::IndexedName("Face", i));
+    }
+
+    // Act
+    for (int i = 1; i <= 1000; i += 2) {
+        EXPECT_TRUE(index.erase(Data::MappedName("Face" + std::to_string(i))));
+    }
+
+    // Assert
+    EXPECT_EQ(index.size(), 500);
+    EXPECT_FALSE(index.erase(Data::MappedName("Face1")));
+    for (int i = 1; i <= 1000; ++i) {
+        const auto* entry = index.find(Data::MappedName("Face" + std::to_string(i)));
+        if (i % 2 == 1) {
+            EXPECT_EQ(entry, nullptr);
+        }
+        else {
+            ASSERT_NE(entry, nullptr);
+            EXPECT_EQ(entry->index.getIndex(), i);
+        }
+    }
+}
+
+TEST(MappedNameIndex, sortedLikeMap)
+{
+    // Arrange
+    Data::MappedNameIndex index;
+    std::map<Data::MappedName, int> reference;
+    for (int i = 1; i <= 200; ++i) {
+        Data::MappedName name("Vertex" + std::to_string((i * 37) % 211));
+        index.insert(name, Data::IndexedName("Vertex", i));
+        reference.emplace(name, i);
+    }
+
+    // Act
+    auto sorted = index.sorted();
+
+    // Assert
+    ASSERT_EQ(sorted.size(), reference.size());
+    auto it = reference.begin();
+    for (const auto* entry : sorted) {
+        EXPECT_EQ(entry->name, it->first);
+        ++it;
+    }
+}
+
+// NOLINTEND(readability-magic-numbers)
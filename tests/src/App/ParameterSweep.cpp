@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/Expression.h>
+#include <App/ParameterSweep.h>
+#include <App/PropertyStandard.h>
+#include <App/VarSet.h>
+#include <Base/Exception.h>
+#include <src/App/InitApplication.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+class ParameterSweep: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+
+        _inputs = _doc->addObject("App::VarSet", "Inputs");
+        _input = freecad_cast<App::PropertyInteger*>(
+            _inputs->addDynamicProperty("App::PropertyInteger", "Width")
+        );
+        _input->setValue(1);
+
+        _results = _doc->addObject("App::VarSet", "Results");
+        _results->addDynamicProperty("App::PropertyInteger", "Area");
+        _results->setExpression(
+            App::ObjectIdentifier::parse(_results, "Area"),
+            std::shared_ptr<App::Expression>(App::Expression::parse(_results, "Inputs.Width * 3"))
+        );
+        _doc->recompute();
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    App::Document* doc()
+    {
+        return _doc;
+    }
+
+    App::PropertyInteger* input()
+    {
+        return _input;
+    }
+
+    App::ParameterSweep makeSweep()
+    {
+        App::ParameterSweep sweep(_doc);
+        sweep.addInput(_inputs, "Width");
+        sweep.addOutput(_results, "Area");
+        return sweep;
+    }
+
+private:
+    std::string _docName;
+    App::Document* _doc {};
+    App::DocumentObject* _inputs {};
+    App::DocumentObject* _results {};
+    App::PropertyInteger* _input {};
+};
+
+TEST_F(ParameterSweep, runVariants)
+{
+    auto sweep = makeSweep();
+    std::vector<std::size_t> called;
+
+    auto results = sweep.run(
+        {{App::any(2L)}, {App::any(5L)}},
+        [&](std::size_t index, const App::ParameterSweep::Result&) { called.push_back(index); }
+    );
+
+    ASSERT_EQ(results.size(), 2);
+    EXPECT_TRUE(results[0].valid);
+    EXPECT_TRUE(App::isAnyEqual(results[0].outputs.at(0), App::any(6L)));
+    EXPECT_TRUE(App::isAnyEqual(results[1].outputs.at(0), App::any(15L)));
+    EXPECT_EQ(called, (std::vector<std::size_t> {0, 1}));
+
+    // the document is back in its original state
+    EXPECT_EQ(input()->getValue(), 1);
+    EXPECT_FALSE(doc()->isTouched());
+}
+
+TEST_F(ParameterSweep, wrongRowSize)
+{
+    auto sweep = makeSweep();
+
+    EXPECT_THROW(sweep.run({{App::any(2L), App::any(3L)}}), Base::ValueError);
+    EXPECT_EQ(input()->getValue(), 1);
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -36,6 +36,7 @@
 #include <App/Document.h>
 #include <App/Expression.h>
 #include <App/ObjectIdentifier.h>
+#include <App/PropertyGeo.h>
 #include <App/PropertyLinks.h>
 #include <App/PropertyStandard.h>
 #include <App/VarSet.h>
@@ -91,6 +92,81 @@ TEST_F(PropertyFloatTest, testWriteRead)
     EXPECT_DOUBLE_EQ(prop2.getValue(), value);
 }
 
+TEST(PropertyChangeCount, countsValueChanges)
+{
+    App::PropertyInteger prop;
+    unsigned count = prop.getChangeCount();
+    prop.setValue(1);
+    EXPECT_EQ(prop.getChangeCount(), count + 1);
+    prop.setValue(2);
+    EXPECT_EQ(prop.getChangeCount(), count + 2);
+}
+
+TEST(PropertyListDelta, trimAndRestore)
+{
+    App::PropertyFloatList before;
+    before.setValues({1.0, 2.0, 3.0, 4.0, 5.0});
+    App::PropertyFloatList after;
+    after.setValues({1.0, 2.0, 9.0, 4.0, 5.0});
+
+    int front = 0;
+    int back = 0;
+    EXPECT_TRUE(before.trimDelta(after, front, back));
+    EXPECT_EQ(front, 2);
+    EXPECT_EQ(back, 2);
+    EXPECT_EQ(before.getSize(), 1);
+
+    before.restoreDelta(after, front, back);
+    EXPECT_EQ(before.getValues(), std::vector<double>({1.0, 2.0, 3.0, 4.0, 5.0}));
+}
+
+TEST(PropertyListDelta, trimAppended)
+{
+    App::PropertyIntegerList before;
+    before.setValues({1, 2});
+    App::PropertyIntegerList after;
+    after.setValues({1, 2, 3});
+
+    int front = 0;
+    int back = 0;
+    EXPECT_TRUE(before.trimDelta(after, front, back));
+    EXPECT_EQ(before.getSize(), 0);
+
+    before.restoreDelta(after, front, back);
+    EXPECT_EQ(before.getValues(), std::vector<long>({1, 2}));
+}
+
+TEST(PropertyListDelta, vectorsCompareExactly)
+{
+    // Base::Vector3d::operator==() would consider the middle entries equal
+    App::PropertyVectorList before;
+    before.setValues({Base::Vector3d(1, 0, 0), Base::Vector3d(0, 0, 0), Base::Vector3d(0, 0, 1)});
+    App::PropertyVectorList after;
+    after.setValues({Base::Vector3d(1, 0, 0), Base::Vector3d(1e-17, 0, 0), Base::Vector3d(0, 0, 1)});
+
+    int front = 0;
+    int back = 0;
+    EXPECT_TRUE(before.trimDelta(after, front, back));
+    EXPECT_EQ(front, 1);
+    EXPECT_EQ(back, 1);
+    ASSERT_EQ(before.getSize(), 1);
+    EXPECT_EQ(before[0].x, 0.0);
+}
+
+TEST(PropertyListDelta, hashDetectsChangedEntries)
+{
+    App::PropertyFloatList list;
+    list.setValues({1.0, 2.0, 3.0, 4.0, 5.0});
+    std::size_t hash = list.hashDelta(2, 2);
+
+    // entries in the middle are not part of the hash
+    list.set1Value(2, 9.0);
+    EXPECT_EQ(list.hashDelta(2, 2), hash);
+
+    list.set1Value(0, 0.0);
+    EXPECT_NE(list.hashDelta(2, 2), hash);
+}
+
 std::string RenameProperty::_docName;
 App::Document* RenameProperty::_doc {nullptr};
 
@@ -108,6 +184,38 @@ TEST_F(RenameProperty, renameProperty)
     EXPECT_EQ(varSet->getDynamicPropertyByName("NewName"), prop);
 }
 
+// Tests whether properties are found by names that are not the strings they were added with
+TEST_F(RenameProperty, getPropertyByNameCopy)
+{
+    // Arrange
+    std::string dynamicName("Variable");
+    std::string staticName("Label");
+    App::HashedName hashedName(dynamicName.c_str());
+
+    // Act
+    auto dynamicProp = varSet->getPropertyByName(dynamicName.c_str());
+    auto staticProp = varSet->getPropertyByName(staticName.c_str());
+
+    // Assert
+    EXPECT_EQ(dynamicProp, prop);
+    EXPECT_EQ(staticProp, &varSet->Label);
+    EXPECT_EQ(varSet->getPropertyByName("NoSuchName"), nullptr);
+    EXPECT_EQ(hashedName.hash, App::CStringHasher()("Variable"));
+}
+
+// Tests whether renaming a property is counted as a change of the dynamic properties
+TEST_F(RenameProperty, renamePropertyChangeCount)
+{
+    // Arrange
+    unsigned count = varSet->getDynamicPropertyChangeCount();
+
+    // Act
+    varSet->renameDynamicProperty(prop, "NewName");
+
+    // Assert
+    EXPECT_NE(varSet->getDynamicPropertyChangeCount(), count);
+}
+
 // Tests whether we can rename a property from Python
 TEST_F(RenameProperty, renamePropertyPython)
 {
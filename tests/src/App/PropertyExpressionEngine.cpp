@@ -10,6 +10,7 @@
 #include "App/Expression.h"
 #include "App/ObjectIdentifier.h"
 #include "App/PropertyExpressionEngine.h"
+#include "App/PropertyStandard.h"
 
 #include "src/App/InitApplication.h"
 
@@ -92,4 +93,41 @@ TEST_F(PropertyExpressionEngineTest, executeCrossPropertyReference)
     ;
 }
 
+TEST_F(PropertyExpressionEngineTest, executeOnlyChangedInputs)
+{
+    auto input = freecad_cast<App::PropertyFloat*>(this_obj()->addDynamicProperty("App::PropertyFloat", "Input"));
+    auto twice = freecad_cast<App::PropertyFloat*>(this_obj()->addDynamicProperty("App::PropertyFloat", "Twice"));
+    auto next = freecad_cast<App::PropertyFloat*>(this_obj()->addDynamicProperty("App::PropertyFloat", "Next"));
+    input->setValue(1.0);
+
+    auto bind = [this](const char* name, const char* expr) {
+        std::shared_ptr<App::Expression> rule(App::Expression::parse(this_obj(), expr));
+        this_obj()->setExpression(App::ObjectIdentifier::parse(this_obj(), name), rule);
+    };
+    bind("Twice", "Input * 2");
+    bind("Next", "Twice + 1");
+
+    this_obj()->ExpressionEngine.execute();
+    EXPECT_DOUBLE_EQ(twice->getValue(), 2.0);
+    EXPECT_DOUBLE_EQ(next->getValue(), 3.0);
+
+    // a changed input is propagated through the dependent bindings
+    input->setValue(2.0);
+    this_obj()->ExpressionEngine.execute();
+    EXPECT_DOUBLE_EQ(twice->getValue(), 4.0);
+    EXPECT_DOUBLE_EQ(next->getValue(), 5.0);
+
+    // a bound property set manually gets the value of its expression back
+    twice->setValue(10.0);
+    this_obj()->ExpressionEngine.execute();
+    EXPECT_DOUBLE_EQ(twice->getValue(), 4.0);
+    EXPECT_DOUBLE_EQ(next->getValue(), 5.0);
+
+    // a changed expression is evaluated
+    bind("Twice", "Input * 3");
+    this_obj()->ExpressionEngine.execute();
+    EXPECT_DOUBLE_EQ(twice->getValue(), 6.0);
+    EXPECT_DOUBLE_EQ(next->getValue(), 7.0);
+}
+
 // clang-format on
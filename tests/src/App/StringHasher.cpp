@@ -9,6 +9,8 @@
 
 #include <QCryptographicHash>
 #include <array>
+#include <set>
+#include <thread>
 
 class StringIDTest: public ::testing::Test
 {
@@ -1281,6 +1283,56 @@ TEST_F(StringHasherTest, getIDFromQByteArrayTwoIdenticalStrings)  // NOLINT
     EXPECT_EQ(idA.dataToText(), idB.dataToText());
 }
 
+TEST_F(StringHasherTest, getIDsMatchesGetID)  // NOLINT
+{
+    // Arrange
+    std::vector<QByteArray> data {"dataA", "dataB", "dataA", "dataC"};
+    auto idB = Hasher()->getID(data[1]);
+
+    // Act
+    auto ids = Hasher()->getIDs(data);
+
+    // Assert
+    ASSERT_EQ(ids.size(), data.size());
+    EXPECT_EQ(ids[0], ids[2]);
+    EXPECT_EQ(ids[1], idB);
+    EXPECT_NE(ids[0], ids[3]);
+    EXPECT_EQ(ids[3].dataToText(), "dataC");
+    EXPECT_EQ(3, Hasher()->size());
+}
+
+TEST_F(StringHasherTest, getIDConcurrently)  // NOLINT
+{
+    // Arrange
+    const int threadCount {4};
+    const int stringCount {500};
+    std::vector<std::vector<App::StringIDRef>> results(threadCount);
+
+    // Act
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([this, t, &results]() {
+            for (int i = 0; i < stringCount; ++i) {
+                results[t].push_back(Hasher()->getID(QByteArray::number(i)));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Assert
+    EXPECT_EQ(stringCount, Hasher()->size());
+    std::set<long> values;
+    for (int i = 0; i < stringCount; ++i) {
+        for (int t = 1; t < threadCount; ++t) {
+            EXPECT_EQ(results[0][i], results[t][i]);
+        }
+        values.insert(results[0][i].value());
+    }
+    EXPECT_EQ(stringCount, values.size());
+}
+
 TEST_F(StringHasherTest, getIDFromQByteArrayBinaryFlag)  // NOLINT
 {
     // Arrange
@@ -1586,3 +1638,19 @@ TEST_F(StringHasherTest, compact)  // NOLINT
     // Assert
     EXPECT_EQ(0, Hasher()->count());
 }
+
+TEST_F(StringHasherTest, compactKeepsReferencedIDs)  // NOLINT
+{
+    // Arrange
+    auto kept = Hasher()->getID(QByteArray("kept"));
+    Hasher()->getID(QByteArray("dropped"));
+    ASSERT_EQ(2, Hasher()->size());
+
+    // Act
+    Hasher()->compact();
+
+    // Assert
+    EXPECT_EQ(1, Hasher()->size());
+    EXPECT_EQ(kept, Hasher()->getID(kept.value()));
+    EXPECT_EQ(kept, Hasher()->getID(QByteArray("kept")));
+}
@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <vector>
 #include <Base/Matrix.h>
 #include <Base/Rotation.h>
 #include <Base/Tools.h>
@@ -573,5 +574,29 @@ TEST(Matrix, TestToAndFromString)
 
     EXPECT_EQ(mat, inp);
 }
+
+TEST(Matrix, TestMultVecArray)
+{
+    Base::Matrix4D mat;
+    mat.rotZ(0.5);
+    mat.scale(2.0, 3.0, 4.0);
+    mat.move(Base::Vector3d(1.0, -2.0, 3.0));
+
+    std::vector<Base::Vector3d> pntsd = {Base::Vector3d(1.0, 2.0, 3.0),
+                                         Base::Vector3d(-4.0, 0.5, 7.0),
+                                         Base::Vector3d(0.0, 0.0, 0.0)};
+    std::vector<Base::Vector3f> pntsf = {Base::Vector3f(1.0F, 2.0F, 3.0F),
+                                         Base::Vector3f(-4.0F, 0.5F, 7.0F),
+                                         Base::Vector3f(0.0F, 0.0F, 0.0F)};
+    std::vector<Base::Vector3d> outd(pntsd.size());
+    mat.multVec(pntsd.data(), outd.data(), pntsd.size());
+    std::vector<Base::Vector3f> outf = pntsf;
+    mat.multVec(outf.data(), outf.data(), outf.size());
+
+    for (std::size_t i = 0; i < pntsd.size(); i++) {
+        EXPECT_EQ(outd[i], mat * pntsd[i]);
+        EXPECT_EQ(outf[i], mat * pntsf[i]);
+    }
+}
 // clang-format on
 // NOLINTEND(cppcoreguidelines-*,readability-magic-numbers)
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include <boost/core/ignore_unused.hpp>
+#include <atomic>
+#include <thread>
 #include <QLockFile>
 #include <Base/FileInfo.h>
 #include <Base/Parameter.h>
@@ -250,6 +252,55 @@ TEST_F(ParameterTest, TestString)
     EXPECT_EQ(grp->GetASCIIs().size(), 1);
 }
 
+TEST_F(ParameterTest, TestCachedValues)
+{
+    auto cfg = getCreateConfig();
+    auto grp = cfg->GetGroup("TopLevelGroup");
+    EXPECT_EQ(grp->GetInt("Int", 5), 5);
+    EXPECT_EQ(grp->GetASCII("Text", "Preset"), "Preset");
+
+    grp->SetInt("Int", 1);
+    grp->SetASCII("Text", "Value");
+    EXPECT_EQ(grp->GetInt("Int", 5), 1);
+    EXPECT_EQ(grp->GetASCII("Text", "Preset"), "Value");
+
+    grp->SetInt("Int", 2);
+    EXPECT_EQ(grp->GetInt("Int", 5), 2);
+
+    grp->RemoveInt("Int");
+    EXPECT_EQ(grp->GetInt("Int", 5), 5);
+
+    cfg->Clear(false);
+    EXPECT_EQ(grp->GetASCII("Text", "Preset"), "Preset");
+}
+
+TEST_F(ParameterTest, TestConcurrentReads)
+{
+    auto cfg = getCreateConfig();
+    auto grp = cfg->GetGroup("TopLevelGroup/Sub1");
+    grp->SetBool("Bool", true);
+    grp->SetFloat("Float", 1.5);
+
+    std::atomic<int> failures {0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) {
+        threads.emplace_back([&cfg, &failures]() {
+            for (int j = 0; j < 1000; j++) {
+                auto sub = cfg->GetGroup("TopLevelGroup/Sub1");
+                if (!sub->GetBool("Bool", false) || sub->GetFloat("Float", 0.0) != 1.5
+                    || sub->GetInt("Missing", 3) != 3) {
+                    failures++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(failures, 0);
+}
+
 TEST_F(ParameterTest, TestCopy)
 {
     auto cfg = getCreateConfig();
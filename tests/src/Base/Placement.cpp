@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <vector>
 #include <Base/DualQuaternion.h>
 #include <Base/Matrix.h>
 #include <Base/Placement.h>
@@ -195,6 +196,23 @@ TEST(Placement, TestSlerp)
     EXPECT_EQ(plm6.getPosition().IsEqual(pos, epsilon), true);
 }
 
+TEST(Placement, TestMultVecArray)
+{
+    Base::Placement plm(Base::Vector3d(1, 4, 6), Base::Rotation(Base::Vector3d(1, 1, 0), 0.7));
+    std::vector<Base::Vector3d> pnts = {Base::Vector3d(1, 2, 3),
+                                        Base::Vector3d(-4, 0.5, 7),
+                                        Base::Vector3d(0, 0, 0)};
+    std::vector<Base::Vector3d> out = pnts;
+
+    plm.multVec(out.data(), out.data(), out.size());
+
+    for (std::size_t i = 0; i < pnts.size(); i++) {
+        Base::Vector3d expected;
+        plm.multVec(pnts[i], expected);
+        EXPECT_EQ(out[i].IsEqual(expected, epsilon), true);
+    }
+}
+
 TEST(Placement, TestSclerp)
 {
     Base::Vector3d pos(1, 4, 6);
@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include <Base/Exception.h>
+#include <Base/ProgressTask.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+TEST(ProgressTask, TestAdvance)
+{
+    Base::ProgressTask task(4);
+    EXPECT_FLOAT_EQ(task.fraction(), 0.0F);
+    task.advance();
+    EXPECT_FLOAT_EQ(task.fraction(), 0.25F);
+    task.advance(3);
+    EXPECT_FLOAT_EQ(task.fraction(), 1.0F);
+    task.advance();
+    EXPECT_FLOAT_EQ(task.fraction(), 1.0F);
+}
+
+TEST(ProgressTask, TestSetProgress)
+{
+    Base::ProgressTask task(10);
+    task.setProgress(5);
+    EXPECT_FLOAT_EQ(task.fraction(), 0.5F);
+    task.setProgress(2);
+    EXPECT_FLOAT_EQ(task.fraction(), 0.5F);
+}
+
+TEST(ProgressTask, TestSubTasks)
+{
+    Base::ProgressTask task(10);
+    task.advance(2);
+    {
+        Base::ProgressTask sub(task, 3, 4);
+        sub.advance();
+        EXPECT_NEAR(task.fraction(), 0.2F + 0.4F / 3.0F, 1e-6F);
+    }
+    // the remaining steps are credited when the sub task ends
+    EXPECT_NEAR(task.fraction(), 0.6F, 1e-6F);
+    {
+        Base::ProgressTask sub(task, 0, 4);
+    }
+    EXPECT_FLOAT_EQ(task.fraction(), 1.0F);
+}
+
+TEST(ProgressTask, TestCancel)
+{
+    Base::ProgressTask task(10);
+    Base::ProgressTask sub(task, 10, 5);
+    EXPECT_FALSE(sub.isCanceled());
+    EXPECT_NO_THROW(sub.checkAbort());
+    sub.cancel();
+    EXPECT_TRUE(task.isCanceled());
+    EXPECT_THROW(task.checkAbort(), Base::AbortException);
+}
+
+TEST(ProgressTask, TestThreads)
+{
+    const std::size_t count = 10000;
+    Base::ProgressTask task(4 * count);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) {
+        threads.emplace_back([&task]() {
+            for (std::size_t j = 0; j < count; j++) {
+                task.advance();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_FLOAT_EQ(task.fraction(), 1.0F);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -16,6 +16,7 @@
 #include <filesystem>
 #include <fstream>
 #include <random>
+#include <stdexcept>
 #include <string>
 #include <xercesc/util/PlatformUtils.hpp>
 
@@ -616,3 +617,49 @@ TEST_F(ReaderTest, validateXmlString)
     std::string result = Base::Persistence::validateXMLString(input);
     EXPECT_EQ(output, result);
 }
+
+TEST_F(ReaderTest, attributesOfCurrentElementOnly)
+{
+    auto xmlBody = R"(
+<node1 first='1' second='2' third='3'/>
+<node2 first='4'/>
+)";
+
+    ReaderXML xml;
+    xml.givenDataAsXMLStream(xmlBody);
+
+    xml.Reader()->readElement("node1");
+    EXPECT_EQ(xml.Reader()->getAttributeCount(), 3);
+    EXPECT_EQ(xml.Reader()->getAttribute<long>("third"), 3);
+
+    xml.Reader()->readElement("node2");
+    EXPECT_EQ(xml.Reader()->getAttributeCount(), 1);
+    EXPECT_EQ(xml.Reader()->getAttribute<long>("first"), 4);
+    EXPECT_FALSE(xml.Reader()->hasAttribute("second"));
+    EXPECT_FALSE(xml.Reader()->hasAttribute("third"));
+}
+
+TEST_F(ReaderTest, numericAttributes)
+{
+    auto xmlBody = R"(
+<node int='-12' long='1234567890' ulong='42' negative='-1' spaced=' 7' plus='+5'
+      double='-1.5e3' suffix='12mm' text='abc' utf8='Größe'/>
+)";
+
+    ReaderXML xml;
+    xml.givenDataAsXMLStream(xmlBody);
+    xml.Reader()->readElement("node");
+
+    EXPECT_EQ(xml.Reader()->getAttribute<int>("int"), -12);
+    EXPECT_EQ(xml.Reader()->getAttribute<long>("long"), 1234567890L);
+    EXPECT_EQ(xml.Reader()->getAttribute<unsigned long>("ulong"), 42UL);
+    // the same results as the standard conversions
+    EXPECT_EQ(xml.Reader()->getAttribute<unsigned long>("negative"), std::stoul("-1"));
+    EXPECT_EQ(xml.Reader()->getAttribute<long>("spaced"), 7);
+    EXPECT_EQ(xml.Reader()->getAttribute<long>("plus"), 5);
+    EXPECT_DOUBLE_EQ(xml.Reader()->getAttribute<double>("double"), -1500.0);
+    EXPECT_EQ(xml.Reader()->getAttribute<long>("suffix"), 12);
+    EXPECT_THROW(xml.Reader()->getAttribute<long>("text"), std::invalid_argument);
+    EXPECT_THROW(xml.Reader()->getAttribute<double>("text"), std::invalid_argument);
+    EXPECT_STREQ(xml.Reader()->getAttribute<const char*>("utf8"), "Größe");
+}
@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <Base/Type.h>
+
+class TypeTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        if (Base::Type::getNumTypes() == 0) {
+            Base::Type::init();
+        }
+        root = Base::Type::createType(Base::Type::BadType, "TypeTest::Root");
+        left = Base::Type::createType(root, "TypeTest::Left");
+        right = Base::Type::createType(root, "TypeTest::Right");
+        leaf = Base::Type::createType(left, "TypeTest::LeftLeaf");
+        other = Base::Type::createType(Base::Type::BadType, "TypeTest::Other");
+    }
+
+    static Base::Type root;
+    static Base::Type left;
+    static Base::Type right;
+    static Base::Type leaf;
+    static Base::Type other;
+};
+
+Base::Type TypeTest::root;
+Base::Type TypeTest::left;
+Base::Type TypeTest::right;
+Base::Type TypeTest::leaf;
+Base::Type TypeTest::other;
+
+TEST_F(TypeTest, isDerivedFrom)
+{
+    EXPECT_TRUE(leaf.isDerivedFrom(leaf));
+    EXPECT_TRUE(leaf.isDerivedFrom(left));
+    EXPECT_TRUE(leaf.isDerivedFrom(root));
+    EXPECT_FALSE(leaf.isDerivedFrom(right));
+    EXPECT_FALSE(leaf.isDerivedFrom(other));
+    EXPECT_FALSE(root.isDerivedFrom(leaf));
+    EXPECT_FALSE(right.isDerivedFrom(left));
+    EXPECT_FALSE(root.isDerivedFrom(Base::Type::BadType));
+    EXPECT_FALSE(Base::Type::BadType.isDerivedFrom(root));
+    EXPECT_TRUE(Base::Type::BadType.isDerivedFrom(Base::Type::BadType));
+}
+
+TEST_F(TypeTest, getAllDerivedFrom)
+{
+    std::vector<Base::Type> list;
+    EXPECT_EQ(Base::Type::getAllDerivedFrom(left, list), 2);
+    std::vector<Base::Type> expected {left, leaf};
+    EXPECT_EQ(list, expected);
+}
+
+TEST_F(TypeTest, fromName)
+{
+    std::string name("TypeTest::LeftLeaf");
+    EXPECT_EQ(Base::Type::fromName(name.c_str()), leaf);
+    EXPECT_TRUE(Base::Type::fromName("TypeTest::NoSuchType").isBad());
+    EXPECT_EQ(Base::Type::getTypeIfDerivedFrom("TypeTest::LeftLeaf", root), leaf);
+    EXPECT_TRUE(Base::Type::getTypeIfDerivedFrom("TypeTest::Right", left).isBad());
+}
@@ -2,7 +2,12 @@
 
 #include <gtest/gtest.h>
 
+#include <map>
+#include <sstream>
+#include <zipios++/zipinputstream.h>
+
 #include "Base/Exception.h"
+#include "Base/Persistence.h"
 #include "Base/Writer.h"
 
 // Writer is designed to be a base class, so for testing we actually instantiate a StringWriter,
@@ -129,3 +134,71 @@ TEST_F(WriterTest, charStreamBase64Encoded)
     // Conversion done using https://www.base64encode.org for testing purposes
     EXPECT_EQ(std::string("RnJlZUNBRCByb2NrcyEg8J+qqPCfqqjwn6qo\n"), _writer.getString());
 }
+
+namespace
+{
+class ZipFileData: public Base::Persistence
+{
+public:
+    explicit ZipFileData(std::string data)
+        : data(std::move(data))
+    {}
+    unsigned int getMemSize() const override
+    {
+        return static_cast<unsigned int>(data.size());
+    }
+    void Save(Base::Writer& /*writer*/) const override
+    {}
+    void Restore(Base::XMLReader& /*reader*/) override
+    {}
+    void SaveDocFile(Base::Writer& writer) const override
+    {
+        writer.Stream() << data;
+    }
+
+private:
+    std::string data;
+};
+
+std::map<std::string, std::string> writeZip(bool concurrent, const std::vector<ZipFileData>& files)
+{
+    std::stringstream zip;
+    {
+        Base::ZipWriter writer(zip);
+        writer.setConcurrentCompression(concurrent);
+        writer.putNextEntry("Document.xml");
+        writer.Stream() << "<Document/>";
+        int index = 0;
+        for (const auto& file : files) {
+            writer.addFile(("File" + std::to_string(index++)).c_str(), &file);
+        }
+        writer.writeFiles();
+    }
+
+    std::map<std::string, std::string> entries;
+    zipios::ZipInputStream input(zip);
+    for (auto entry = input.getNextEntry(); entry->isValid(); entry = input.getNextEntry()) {
+        std::stringstream content;
+        content << input.rdbuf();
+        entries[entry->getName()] = content.str();
+    }
+    return entries;
+}
+}  // namespace
+
+TEST(ZipWriterTest, concurrentCompressionMatchesSerial)
+{
+    // Arrange
+    std::vector<ZipFileData> files;
+    for (int i = 0; i < 20; ++i) {
+        files.emplace_back(std::string(static_cast<std::size_t>(i) * 1000, static_cast<char>('a' + i)));
+    }
+
+    // Act
+    auto serial = writeZip(false, files);
+    auto concurrent = writeZip(true, files);
+
+    // Assert
+    EXPECT_EQ(serial.size(), files.size() + 1);
+    EXPECT_EQ(serial, concurrent);
+}
@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QString>
+
+#include <App/Application.h>
+#include <src/App/InitApplication.h>
+
+#include <Mod/Material/App/MaterialIndex.h>
+#include <Mod/Material/App/MaterialManager.h>
+#include <Mod/Material/App/Materials.h>
+#include <Mod/Material/App/ModelManager.h>
+#include <Mod/Material/App/ModelUuids.h>
+
+// clang-format off
+
+class TestMaterialIndex : public ::testing::Test {
+protected:
+    static void SetUpTestSuite() {
+        if (App::Application::GetARGC() == 0) {
+            tests::initApplication();
+        }
+    }
+
+    void SetUp() override {
+        _libPath = QDir::tempPath() + QStringLiteral("/TestMaterialIndex");
+        QDir libDir(_libPath);
+        libDir.removeRecursively(); // Clear old run data
+        libDir.mkpath(_libPath);
+        _filePath = _libPath + QStringLiteral("/Test.FCMat");
+        writeFile(QStringLiteral("General:\n  UUID: \"test\"\n"));
+
+        Materials::ModelManager::getManager();
+        _material.setUUID(QStringLiteral("a7b9d6e6-5a41-4b9c-9c4a-3a5cbbd4c9a1"));
+        _material.setName(QStringLiteral("Test"));
+        _material.addPhysical(Materials::ModelUUIDs::ModelUUID_Mechanical_Density);
+        _material.setPhysicalValue(QStringLiteral("Density"), QStringLiteral("7800 kg/m^3"));
+    }
+
+    void writeFile(const QString& contents) {
+        QFile file(_filePath);
+        ASSERT_TRUE(file.open(QIODevice::WriteOnly | QIODevice::Text | QIODevice::Truncate));
+        file.write(contents.toUtf8());
+    }
+
+    QString _libPath;
+    QString _filePath;
+    Materials::Material _material;
+};
+
+TEST_F(TestMaterialIndex, TestRoundTrip)
+{
+    Materials::MaterialIndex index(_libPath);
+    index.load();
+    EXPECT_EQ(index.find(QFileInfo(_filePath)), nullptr);
+
+    index.update(QFileInfo(_filePath), _material);
+    index.save();
+
+    Materials::MaterialIndex reloaded(_libPath);
+    reloaded.load();
+    auto entry = reloaded.find(QFileInfo(_filePath));
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->uuid, _material.getUUID());
+    EXPECT_EQ(entry->name, QStringLiteral("Test"));
+    EXPECT_TRUE(entry->physicalModels.contains(Materials::ModelUUIDs::ModelUUID_Mechanical_Density));
+    EXPECT_TRUE(entry->appearanceModels.isEmpty());
+    EXPECT_EQ(entry->values, QStringList {QStringLiteral("Density")});
+}
+
+TEST_F(TestMaterialIndex, TestChangedFile)
+{
+    Materials::MaterialIndex index(_libPath);
+    index.update(QFileInfo(_filePath), _material);
+    ASSERT_NE(index.find(QFileInfo(_filePath)), nullptr);
+
+    // A different size marks the entry as stale
+    writeFile(QStringLiteral("General:\n  UUID: \"changed\"\n  Name: \"Test\"\n"));
+    EXPECT_EQ(index.find(QFileInfo(_filePath)), nullptr);
+}
+
+TEST_F(TestMaterialIndex, TestRetain)
+{
+    Materials::MaterialIndex index(_libPath);
+    index.update(QFileInfo(_filePath), _material);
+
+    index.retain({QFileInfo(_filePath).canonicalFilePath()});
+    EXPECT_NE(index.find(QFileInfo(_filePath)), nullptr);
+
+    index.retain({});
+    EXPECT_EQ(index.find(QFileInfo(_filePath)), nullptr);
+}
+
+TEST_F(TestMaterialIndex, TestIndexedCompleteness)
+{
+    Materials::Material material;
+    material.addPhysical(Materials::ModelUUIDs::ModelUUID_Mechanical_Density);
+    EXPECT_FALSE(material.isPhysicalModelComplete(Materials::ModelUUIDs::ModelUUID_Mechanical_Density));
+
+    // Values recorded in the index count until the material is read
+    material.setIndexedValues({QStringLiteral("Density")});
+    material.setLoaded(false);
+    EXPECT_TRUE(material.isPhysicalModelComplete(Materials::ModelUUIDs::ModelUUID_Mechanical_Density));
+    EXPECT_EQ(material.getValuedPropertyNames(), QSet<QString> {QStringLiteral("Density")});
+}
+
+TEST_F(TestMaterialIndex, TestLoadedOnRequest)
+{
+    auto& manager = Materials::MaterialManager::getManager();
+    auto steel = manager.getMaterialByPath(
+        QStringLiteral("Standard/Metal/Steel/CalculiX-Steel.FCMat"),
+        QStringLiteral("System"));
+    ASSERT_TRUE(steel);
+    EXPECT_TRUE(steel->isLoaded());
+    EXPECT_FALSE(steel->getPhysicalProperty(QStringLiteral("Density"))->isNull());
+}
@@ -22,6 +22,10 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include <QLocale>
 #include <QMetaType>
 #include <QString>
@@ -374,4 +378,31 @@ TEST_F(TestMaterial, TestColumns)
     EXPECT_EQ(dynamic_cast<Materials::Array3D &>(*array3d).columns(), 2);
 }
 
+TEST_F(TestMaterial, TestConcurrentLookup)
+{
+    auto steel = _materialManager->getMaterialByPath(
+        QStringLiteral("Standard/Metal/Steel/CalculiX-Steel.FCMat"),
+        QStringLiteral("System"));
+    auto uuid = steel->getUUID();
+
+    // Lookups from worker threads don't serialize on the manager and see the same material
+    std::atomic<int> found {0};
+    std::vector<std::thread> workers;
+    for (int i = 0; i < 4; i++) {
+        workers.emplace_back([&]() {
+            for (int j = 0; j < 100; j++) {
+                auto material = _materialManager->getMaterial(uuid);
+                auto model = _modelManager->getModel(Materials::ModelUUIDs::ModelUUID_Mechanical_Density);
+                if (material == steel && model) {
+                    found++;
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    EXPECT_EQ(found, 400);
+}
+
 // clang-format on
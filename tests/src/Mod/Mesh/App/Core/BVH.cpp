@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/BVH.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class BVHTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a wavy surface with a dense patch in one corner
+        MeshCore::MeshFacetArray facets;
+        MeshCore::MeshPointArray points;
+        const int size = 40;
+        for (int i = 0; i <= size; i++) {
+            for (int j = 0; j <= size; j++) {
+                float x = float(i);
+                float y = float(j);
+                if (i < size / 4 && j < size / 4) {
+                    x *= 0.05F;
+                    y *= 0.05F;
+                }
+                points.push_back(Base::Vector3f(x, y, float((i * j) % 5) * 0.3F));
+            }
+        }
+        for (int i = 0; i < size; i++) {
+            for (int j = 0; j < size; j++) {
+                auto p0 = MeshCore::PointIndex(i * (size + 1) + j);
+                auto p1 = p0 + size + 1;
+                facets.push_back(MeshCore::MeshFacet(p0, p1, p0 + 1));
+                facets.push_back(MeshCore::MeshFacet(p0 + 1, p1, p1 + 1));
+            }
+        }
+        kernel.Adopt(points, facets);
+    }
+
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(BVHTest, TestEmpty)
+{
+    MeshCore::MeshFacetBVH bvh;
+    EXPECT_TRUE(bvh.IsEmpty());
+
+    float dist {};
+    EXPECT_EQ(bvh.NearestFacetToPoint(Base::Vector3f(), dist), MeshCore::FACET_INDEX_MAX);
+
+    Base::Vector3f res;
+    MeshCore::FacetIndex facet {};
+    EXPECT_FALSE(bvh.NearestFacetOnRay(
+        Base::Vector3f(),
+        Base::Vector3f(0, 0, 1),
+        MeshCore::Mathf::PI,
+        res,
+        facet
+    ));
+}
+
+TEST_F(BVHTest, TestNearestFacetToPoint)
+{
+    MeshCore::MeshFacetBVH bvh(kernel);
+    EXPECT_FALSE(bvh.IsEmpty());
+
+    for (int i = 0; i < 50; i++) {
+        Base::Vector3f pnt(float(i % 7) * 6.1F - 2.0F, float(i % 11) * 3.7F - 1.0F, float(i % 3) - 1.0F);
+        float dist {};
+        MeshCore::FacetIndex nearest = bvh.NearestFacetToPoint(pnt, dist);
+        ASSERT_NE(nearest, MeshCore::FACET_INDEX_MAX);
+
+        float minDist = std::numeric_limits<float>::max();
+        for (MeshCore::FacetIndex j = 0; j < kernel.CountFacets(); j++) {
+            minDist = std::min(minDist, kernel.GetFacet(j).DistanceToPoint(pnt));
+        }
+        EXPECT_NEAR(dist, minDist, 1.0e-4F);
+        EXPECT_NEAR(kernel.GetFacet(nearest).DistanceToPoint(pnt), minDist, 1.0e-4F);
+    }
+}
+
+TEST_F(BVHTest, TestNearestFacetToPointMaxDist)
+{
+    MeshCore::MeshFacetBVH bvh(kernel);
+    float dist {};
+    EXPECT_EQ(
+        bvh.NearestFacetToPoint(Base::Vector3f(20, 20, 10), dist, 1.0F),
+        MeshCore::FACET_INDEX_MAX
+    );
+}
+
+TEST_F(BVHTest, TestNearestFacetOnRay)
+{
+    MeshCore::MeshFacetBVH bvh(kernel);
+    MeshCore::MeshAlgorithm algo(kernel);
+
+    for (int i = 0; i < 50; i++) {
+        Base::Vector3f pnt(float(i % 7) * 6.1F + 0.1F, float(i % 11) * 3.7F + 0.2F, 5.0F);
+        Base::Vector3f dir(float(i % 3) * 0.1F, float(i % 5) * 0.05F, -1.0F);
+
+        Base::Vector3f res1, res2;
+        MeshCore::FacetIndex facet1 {}, facet2 {};
+        bool hit1 = algo.NearestFacetOnRay(pnt, dir, MeshCore::Mathf::PI, res1, facet1);
+        bool hit2 = algo.NearestFacetOnRay(pnt, dir, MeshCore::Mathf::PI, bvh, res2, facet2);
+        ASSERT_EQ(hit1, hit2);
+        if (hit1) {
+            EXPECT_NEAR(Base::Distance(pnt, res1), Base::Distance(pnt, res2), 1.0e-4F);
+        }
+    }
+}
+
+TEST_F(BVHTest, TestTransformed)
+{
+    Base::Matrix4D mat;
+    mat.move(Base::Vector3f(100, 0, 0));
+    MeshCore::MeshFacetBVH bvh(kernel, mat);
+    EXPECT_FLOAT_EQ(bvh.GetBoundBox().MinX, kernel.GetBoundBox().MinX + 100.0F);
+
+    float dist {};
+    EXPECT_NE(bvh.NearestFacetToPoint(Base::Vector3f(120, 20, 0), dist, 2.0F), MeshCore::FACET_INDEX_MAX);
+}
+
+TEST_F(BVHTest, TestInside)
+{
+    MeshCore::MeshFacetBVH bvh(kernel);
+    Base::BoundBox3f box(10, 10, -1, 15, 15, 2);
+
+    std::vector<MeshCore::FacetIndex> facets;
+    bvh.Inside(
+        [&box](const Base::BoundBox3f& bbox) {
+            return box.Intersect(bbox);
+        },
+        facets
+    );
+
+    std::size_t count = 0;
+    for (MeshCore::FacetIndex i = 0; i < kernel.CountFacets(); i++) {
+        if (box.Intersect(kernel.GetFacet(i).GetBoundBox())) {
+            count++;
+        }
+    }
+    EXPECT_EQ(facets.size(), count);
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
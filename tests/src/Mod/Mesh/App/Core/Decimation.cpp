@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <Mod/Mesh/App/Core/Decimation.h>
+#include <Mod/Mesh/App/Core/Degeneration.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class DecimationTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        MeshCore::MeshFacetArray facets;
+        MeshCore::MeshPointArray points;
+        const int size = 60;
+        for (int i = 0; i <= size; i++) {
+            for (int j = 0; j <= size; j++) {
+                points.push_back(Base::Vector3f(float(i), float(j), 0.0F));
+            }
+        }
+        for (int i = 0; i < size; i++) {
+            for (int j = 0; j < size; j++) {
+                auto p0 = MeshCore::PointIndex(i * (size + 1) + j);
+                auto p1 = p0 + size + 1;
+                facets.push_back(MeshCore::MeshFacet(p0, p1, p0 + 1));
+                facets.push_back(MeshCore::MeshFacet(p0 + 1, p1, p1 + 1));
+            }
+        }
+        kernel.Adopt(points, facets);
+    }
+
+    void checkValid() const
+    {
+        MeshCore::MeshEvalRangeFacet rangeFacet(kernel);
+        EXPECT_TRUE(rangeFacet.Evaluate());
+        MeshCore::MeshEvalRangePoint rangePoint(kernel);
+        EXPECT_TRUE(rangePoint.Evaluate());
+    }
+
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(DecimationTest, TestTargetSizeSerial)
+{
+    MeshCore::MeshSimplify dm(kernel);
+    dm.setBlockSize(0);
+    dm.simplify(1000);
+    EXPECT_LE(kernel.CountFacets(), 1000);
+    EXPECT_GT(kernel.CountFacets(), 0);
+    checkValid();
+}
+
+TEST_F(DecimationTest, TestTargetSizeBlocks)
+{
+    MeshCore::MeshSimplify dm(kernel);
+    dm.setBlockSize(1000);
+    dm.simplify(1000);
+    EXPECT_LE(kernel.CountFacets(), 1000);
+    EXPECT_GT(kernel.CountFacets(), 0);
+    checkValid();
+}
+
+TEST_F(DecimationTest, TestReductionBlocks)
+{
+    std::size_t countFacets = kernel.CountFacets();
+    MeshCore::MeshSimplify dm(kernel);
+    dm.setBlockSize(1000);
+    dm.simplify(0.1F, 0.5F);
+    EXPECT_LT(kernel.CountFacets(), countFacets);
+    checkValid();
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <Mod/Mesh/App/Core/Degeneration.h>
+#include <Mod/Mesh/App/Core/EvalPipeline.h>
+#include <Mod/Mesh/App/Core/Evaluation.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class EvalPipelineTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        const int size = 20;
+        for (int i = 0; i <= size; i++) {
+            for (int j = 0; j <= size; j++) {
+                points.push_back(Base::Vector3f(float(i), float(j), 0.0F));
+            }
+        }
+        for (int i = 0; i < size; i++) {
+            for (int j = 0; j < size; j++) {
+                auto p0 = MeshCore::PointIndex(i * (size + 1) + j);
+                auto p1 = p0 + size + 1;
+                facets.push_back(MeshCore::MeshFacet(p0, p1, p0 + 1));
+                facets.push_back(MeshCore::MeshFacet(p0 + 1, p1, p1 + 1));
+            }
+        }
+    }
+
+    void addDefects()
+    {
+        // a duplicated facet that also causes three non-manifold edges
+        facets.push_back(facets[10]);
+        // a flipped facet
+        std::swap(facets[100]._aulPoints[0], facets[100]._aulPoints[1]);
+        // a duplicated point used by a single facet
+        points.push_back(points[0]);
+        auto index = MeshCore::PointIndex(points.size() - 1);
+        facets.push_back(MeshCore::MeshFacet(index, 1, 22));
+        // two facets that share a point only
+        auto base = MeshCore::PointIndex(points.size());
+        points.push_back(Base::Vector3f(40.0F, 0.0F, 0.0F));
+        points.push_back(Base::Vector3f(41.0F, 0.0F, 0.0F));
+        points.push_back(Base::Vector3f(40.0F, 1.0F, 0.0F));
+        points.push_back(Base::Vector3f(39.0F, 0.0F, 0.0F));
+        points.push_back(Base::Vector3f(40.0F, -1.0F, 0.0F));
+        facets.push_back(MeshCore::MeshFacet(base, base + 1, base + 2));
+        facets.push_back(MeshCore::MeshFacet(base, base + 3, base + 4));
+    }
+
+    MeshCore::MeshEvalPipeline::Result evaluate() const
+    {
+        MeshCore::MeshEvalPipeline::Settings settings;
+        settings.nonManifoldPoints = true;
+        settings.folds = true;
+        MeshCore::MeshEvalPipeline eval(kernel);
+        return eval.Evaluate(settings);
+    }
+
+    MeshCore::MeshPointArray points;
+    MeshCore::MeshFacetArray facets;
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(EvalPipelineTest, TestValidMesh)
+{
+    kernel.Adopt(points, facets, true);
+    auto result = evaluate();
+    EXPECT_TRUE(result.IsValid());
+}
+
+TEST_F(EvalPipelineTest, TestSameAsEvaluators)
+{
+    addDefects();
+    kernel.Adopt(points, facets, true);
+    auto result = evaluate();
+    EXPECT_FALSE(result.IsValid());
+    EXPECT_EQ(result.indexError, MeshCore::MeshEvalPipeline::IndexError::None);
+
+    MeshCore::MeshEvalTopology topology(kernel);
+    EXPECT_FALSE(topology.Evaluate());
+    EXPECT_EQ(result.nonManifoldEdges, topology.GetIndices());
+    EXPECT_EQ(result.nonManifoldFacets.size(), topology.GetFacets().size());
+
+    MeshCore::MeshEvalPointManifolds pointManifolds(kernel);
+    EXPECT_FALSE(pointManifolds.Evaluate());
+    EXPECT_EQ(result.nonManifoldPoints, pointManifolds.GetIndices());
+    std::vector<MeshCore::FacetIndex> facetsOfPoints;
+    pointManifolds.GetFacetIndices(facetsOfPoints);
+    EXPECT_EQ(result.facetsOfNonManifoldPoints, facetsOfPoints);
+
+    MeshCore::MeshEvalNeighbourhood neighbourhood(kernel);
+    EXPECT_TRUE(neighbourhood.Evaluate());
+    EXPECT_TRUE(result.neighbourhoodFacets.empty());
+
+    MeshCore::MeshEvalOrientation orientation(kernel);
+    EXPECT_EQ(result.flippedFacets, orientation.GetIndices());
+    EXPECT_FALSE(result.flippedFacets.empty());
+
+    MeshCore::MeshEvalDuplicateFacets duplicatedFacets(kernel);
+    EXPECT_EQ(result.duplicatedFacets, duplicatedFacets.GetIndices());
+    EXPECT_EQ(result.duplicatedFacets.size(), 1);
+
+    MeshCore::MeshEvalDuplicatePoints duplicatedPoints(kernel);
+    EXPECT_EQ(result.duplicatedPoints, duplicatedPoints.GetIndices());
+    EXPECT_EQ(result.duplicatedPoints.size(), 1);
+}
+
+TEST_F(EvalPipelineTest, TestInvalidNeighbourhood)
+{
+    kernel.Adopt(points, facets, true);
+    MeshCore::MeshPointArray copy = kernel.GetPoints();
+    MeshCore::MeshFacetArray invalid = kernel.GetFacets();
+    invalid[5]._aulNeighbours[0] = 7;
+    kernel.Adopt(copy, invalid, false);
+
+    auto result = evaluate();
+    EXPECT_EQ(result.indexError, MeshCore::MeshEvalPipeline::IndexError::Neighbourhood);
+    MeshCore::MeshEvalNeighbourhood neighbourhood(kernel);
+    EXPECT_EQ(result.neighbourhoodFacets, neighbourhood.GetIndices());
+}
+
+TEST_F(EvalPipelineTest, TestFacetsOutOfRange)
+{
+    kernel.Adopt(points, facets, true);
+    MeshCore::MeshPointArray copy = kernel.GetPoints();
+    MeshCore::MeshFacetArray invalid = kernel.GetFacets();
+    invalid[5]._aulNeighbours[0] = MeshCore::FacetIndex(invalid.size());
+    kernel.Adopt(copy, invalid, false);
+
+    auto result = evaluate();
+    EXPECT_EQ(result.indexError, MeshCore::MeshEvalPipeline::IndexError::FacetRange);
+    EXPECT_EQ(result.invalidIndices.size(), 1);
+}
+
+TEST_F(EvalPipelineTest, TestFixup)
+{
+    addDefects();
+    kernel.Adopt(points, facets, true);
+    MeshCore::MeshEvalPipeline::Settings settings;
+    settings.nonManifoldPoints = true;
+    settings.folds = true;
+
+    MeshCore::MeshFixPipeline fix(kernel, settings);
+    EXPECT_TRUE(fix.Fixup(evaluate()));
+    EXPECT_FALSE(fix.GetDeletedFaces().empty());
+    EXPECT_TRUE(evaluate().IsValid());
+    EXPECT_FALSE(fix.Fixup(evaluate()));
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
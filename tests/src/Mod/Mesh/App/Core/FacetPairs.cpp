@@ -0,0 +1,88 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <Mod/Mesh/App/Core/Evaluation.h>
+#include <Mod/Mesh/App/Core/FacetPairs.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class FacetPairsTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // two adjacent facets and a third facet crossing the first one
+        MeshCore::MeshPointArray points;
+        points.emplace_back(0.0F, 0.0F, 0.0F);
+        points.emplace_back(2.0F, 0.0F, 0.0F);
+        points.emplace_back(0.0F, 2.0F, 0.0F);
+        points.emplace_back(2.0F, 2.0F, 0.0F);
+        points.emplace_back(0.5F, 0.5F, -1.0F);
+        points.emplace_back(0.5F, 0.5F, 1.0F);
+        points.emplace_back(1.0F, 0.2F, 0.0F);
+
+        MeshCore::MeshFacetArray facets;
+        facets.emplace_back(0, 1, 2);
+        facets.emplace_back(1, 3, 2);
+        facets.emplace_back(4, 5, 6);
+        kernel.Adopt(points, facets);
+    }
+
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(FacetPairsTest, TestCandidates)
+{
+    // the adjacent facets share points
+    std::vector<MeshCore::FacetPair> pairs = MeshCore::MeshFacetPairs::Candidates(kernel);
+    std::vector<MeshCore::FacetPair> expected {{0, 2}, {1, 2}};
+    EXPECT_EQ(pairs, expected);
+}
+
+TEST_F(FacetPairsTest, TestCull)
+{
+    std::vector<MeshCore::FacetPair> pairs = MeshCore::MeshFacetPairs::Candidates(kernel);
+    MeshCore::MeshFacetPairs::Cull(kernel, kernel, pairs);
+    ASSERT_FALSE(pairs.empty());
+    EXPECT_EQ(pairs.front(), MeshCore::FacetPair(0, 2));
+}
+
+TEST_F(FacetPairsTest, TestCullSeparated)
+{
+    MeshCore::MeshKernel other;
+    MeshCore::MeshPointArray points;
+    points.emplace_back(0.0F, 0.0F, 0.5F);
+    points.emplace_back(2.0F, 0.0F, 0.5F);
+    points.emplace_back(0.0F, 2.0F, 0.6F);
+    MeshCore::MeshFacetArray facets;
+    facets.emplace_back(0, 1, 2);
+    other.Adopt(points, facets);
+
+    std::vector<MeshCore::FacetPair> pairs {{0, 0}, {1, 0}};
+    MeshCore::MeshFacetPairs::Cull(kernel, other, pairs);
+    EXPECT_TRUE(pairs.empty());
+}
+
+TEST_F(FacetPairsTest, TestIntersect)
+{
+    std::vector<MeshCore::FacetPair> pairs = MeshCore::MeshFacetPairs::Candidates(kernel);
+    std::vector<MeshCore::MeshFacetPairs::Intersection> result
+        = MeshCore::MeshFacetPairs::Intersect(kernel, kernel, pairs);
+    ASSERT_EQ(result.size(), 1);
+    EXPECT_EQ(result[0].facets, MeshCore::FacetPair(0, 2));
+    EXPECT_EQ(result[0].points, 2);
+    EXPECT_TRUE(MeshCore::MeshFacetPairs::HasIntersection(kernel, kernel, pairs));
+}
+
+TEST_F(FacetPairsTest, TestSelfIntersection)
+{
+    MeshCore::MeshEvalSelfIntersection eval(kernel);
+    EXPECT_FALSE(eval.Evaluate());
+
+    std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> intersection;
+    eval.GetIntersections(intersection);
+    ASSERT_EQ(intersection.size(), 1);
+    EXPECT_EQ(intersection[0], MeshCore::FacetPair(0, 2));
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -92,4 +92,50 @@ TEST_F(KDTreeTest, TestKDTreeFindRange)
     tree.FindInRange(Base::Vector3f(0.5F, 0, 0), 0.6F, index);
     EXPECT_EQ(index, result);
 }
+
+TEST_F(KDTreeTest, TestKDTreeFindKNearest)
+{
+    MeshCore::MeshKDTree tree(GetPoints());
+
+    std::vector<Base::Vector3f> queries;
+    queries.emplace_back(0.1F, 0.0F, 0.0F);
+    queries.emplace_back(0.8F, 0.9F, 1.0F);
+
+    std::vector<std::size_t> offsets;
+    std::vector<MeshCore::PointIndex> indices;
+    std::vector<float> distances;
+    tree.FindKNearest(queries, 2, offsets, indices, distances);
+
+    std::vector<std::size_t> resultOffsets = {0, 2, 4};
+    std::vector<MeshCore::PointIndex> resultIndices = {0, 4, 7, 3};
+    EXPECT_EQ(offsets, resultOffsets);
+    EXPECT_EQ(indices, resultIndices);
+    ASSERT_EQ(distances.size(), 4);
+    EXPECT_FLOAT_EQ(distances[0], 0.1F);
+    EXPECT_FLOAT_EQ(distances[1], 0.9F);
+
+    // k is limited to the number of points
+    tree.FindKNearest(queries, 20, offsets, indices, distances);
+    EXPECT_EQ(offsets.back(), 16);
+}
+
+TEST_F(KDTreeTest, TestKDTreeFindInRadius)
+{
+    MeshCore::MeshKDTree tree(GetPoints());
+
+    std::vector<Base::Vector3f> queries;
+    queries.emplace_back(0.5F, 0.0F, 0.0F);
+    queries.emplace_back(0.5F, 0.5F, 0.0F);
+
+    std::vector<std::size_t> offsets;
+    std::vector<MeshCore::PointIndex> indices;
+    std::vector<float> distances;
+    tree.FindInRadius(queries, 0.6F, offsets, indices, distances);
+
+    // unlike FindInRange the search region is a sphere
+    std::vector<std::size_t> resultOffsets = {0, 2, 2};
+    std::vector<MeshCore::PointIndex> resultIndices = {0, 4};
+    EXPECT_EQ(offsets, resultOffsets);
+    EXPECT_EQ(indices, resultIndices);
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,217 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/Curvature.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/Neighbourhood.h>
+#include <Mod/Mesh/App/WildMagic4/Wm4MeshCurvature.h>
+#include <algorithm>
+#include <random>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class NeighbourhoodTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a curved height field
+        const int size = 20;
+        MeshCore::MeshPointArray points;
+        MeshCore::MeshFacetArray facets;
+        for (int i = 0; i <= size; i++) {
+            for (int j = 0; j <= size; j++) {
+                float x = float(i) / size - 0.5F;
+                float y = float(j) / size - 0.5F;
+                points.push_back(Base::Vector3f(x, y, x * x + 0.5F * y * y));
+            }
+        }
+        for (int i = 0; i < size; i++) {
+            for (int j = 0; j < size; j++) {
+                auto p0 = MeshCore::PointIndex(i * (size + 1) + j);
+                auto p1 = p0 + size + 1;
+                facets.push_back(MeshCore::MeshFacet(p0, p1, p0 + 1));
+                facets.push_back(MeshCore::MeshFacet(p0 + 1, p1, p1 + 1));
+            }
+        }
+        kernel.Adopt(points, facets, true);
+
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> dist(-1.0F, 1.0F);
+        for (int i = 0; i < 2000; i++) {
+            cloud.emplace_back(dist(gen), dist(gen), dist(gen));
+        }
+    }
+
+    std::vector<MeshCore::PointIndex> bruteForce(const Base::Vector3f& p, std::size_t k) const
+    {
+        std::vector<std::pair<float, MeshCore::PointIndex>> dist;
+        for (std::size_t i = 0; i < cloud.size(); i++) {
+            dist.emplace_back(Base::DistanceP2(p, cloud[i]), MeshCore::PointIndex(i));
+        }
+        std::sort(dist.begin(), dist.end());
+        std::vector<MeshCore::PointIndex> indices;
+        for (std::size_t i = 0; i < std::min(k, dist.size()); i++) {
+            indices.push_back(dist[i].second);
+        }
+        return indices;
+    }
+
+    MeshCore::MeshKernel kernel;
+    std::vector<Base::Vector3f> cloud;
+};
+
+TEST_F(NeighbourhoodTest, testKNearest)
+{
+    MeshCore::MeshPointNeighbourhood neighbourhood(cloud);
+    std::vector<MeshCore::PointIndex> indices;
+    for (std::size_t i = 0; i < cloud.size(); i += 97) {
+        neighbourhood.FindKNearest(cloud[i], 10, 0.0F, indices);
+        EXPECT_EQ(indices, bruteForce(cloud[i], 10));
+    }
+
+    // a point far outside of the cloud
+    Base::Vector3f far(10.0F, 10.0F, 10.0F);
+    neighbourhood.FindKNearest(far, 5, 0.0F, indices);
+    EXPECT_EQ(indices, bruteForce(far, 5));
+
+    // more neighbours than points
+    neighbourhood.FindKNearest(far, 5000, 0.0F, indices);
+    EXPECT_EQ(indices.size(), cloud.size());
+}
+
+TEST_F(NeighbourhoodTest, testKNearestLimited)
+{
+    MeshCore::MeshPointNeighbourhood neighbourhood(cloud);
+    std::vector<MeshCore::PointIndex> indices;
+    neighbourhood.FindKNearest(cloud[0], 1000, 0.2F, indices);
+    EXPECT_FALSE(indices.empty());
+    EXPECT_LT(indices.size(), 1000);
+    for (auto it : indices) {
+        EXPECT_LE(Base::Distance(cloud[0], cloud[it]), 0.2F);
+    }
+}
+
+TEST_F(NeighbourhoodTest, testInRadius)
+{
+    MeshCore::MeshPointNeighbourhood neighbourhood(cloud);
+    std::vector<MeshCore::PointIndex> indices;
+    neighbourhood.FindInRadius(cloud[5], 0.3F, indices);
+    std::sort(indices.begin(), indices.end());
+
+    std::vector<MeshCore::PointIndex> expected;
+    for (std::size_t i = 0; i < cloud.size(); i++) {
+        if (Base::DistanceP2(cloud[5], cloud[i]) <= 0.3F * 0.3F) {
+            expected.push_back(MeshCore::PointIndex(i));
+        }
+    }
+    EXPECT_EQ(indices, expected);
+}
+
+TEST_F(NeighbourhoodTest, testEstimateNormals)
+{
+    std::vector<Base::Vector3f> plane;
+    for (int i = 0; i < 30; i++) {
+        for (int j = 0; j < 30; j++) {
+            plane.emplace_back(float(i), float(j), 0.0F);
+        }
+    }
+
+    MeshCore::MeshPointNeighbourhood neighbourhood(plane);
+    Base::Vector3f viewPoint(0.0F, 0.0F, -10.0F);
+    for (const auto& it : neighbourhood.EstimateNormals(8, 0.0F, viewPoint)) {
+        EXPECT_NEAR(it.z, -1.0F, 1e-5F);
+    }
+    for (const auto& it : neighbourhood.EstimateNormals(0, 1.5F, viewPoint)) {
+        EXPECT_NEAR(it.z, -1.0F, 1e-5F);
+    }
+
+    // not enough neighbours
+    for (const auto& it : neighbourhood.EstimateNormals(0, 0.5F, viewPoint)) {
+        EXPECT_EQ(it, Base::Vector3f());
+    }
+}
+
+TEST_F(NeighbourhoodTest, testPointFan)
+{
+    MeshCore::MeshPointFan fan(kernel);
+    const MeshCore::MeshFacetArray& facets = kernel.GetFacets();
+    ASSERT_EQ(fan.CountPoints(), kernel.CountPoints());
+
+    std::size_t corners = 0;
+    for (MeshCore::PointIndex i = 0; i < fan.CountPoints(); i++) {
+        EXPECT_TRUE(std::is_sorted(fan.Begin(i), fan.End(i)));
+        for (const std::size_t* it = fan.Begin(i); it != fan.End(i); ++it) {
+            EXPECT_EQ(facets[*it / 3]._aulPoints[*it % 3], i);
+            corners++;
+        }
+    }
+    EXPECT_EQ(corners, 3 * facets.size());
+}
+
+TEST_F(NeighbourhoodTest, testVertexNormals)
+{
+    const MeshCore::MeshPointArray& points = kernel.GetPoints();
+    const MeshCore::MeshFacetArray& facets = kernel.GetFacets();
+
+    std::vector<Base::Vector3f> sums(points.size());
+    std::vector<Base::Vector3f> weighted(points.size());
+    for (const auto& it : facets) {
+        const MeshCore::MeshPoint& p0 = points[it._aulPoints[0]];
+        const MeshCore::MeshPoint& p1 = points[it._aulPoints[1]];
+        const MeshCore::MeshPoint& p2 = points[it._aulPoints[2]];
+        Base::Vector3f normal = (p1 - p0) % (p2 - p0);
+        float l2p01 = Base::DistanceP2(p0, p1);
+        float l2p12 = Base::DistanceP2(p1, p2);
+        float l2p20 = Base::DistanceP2(p2, p0);
+        for (int i = 0; i < 3; i++) {
+            sums[it._aulPoints[i]] += normal;
+        }
+
+        Base::Vector3f facenormal = kernel.GetFacet(it).GetNormal();
+        weighted[it._aulPoints[0]] += facenormal * (1.0F / (l2p01 * l2p20));
+        weighted[it._aulPoints[1]] += facenormal * (1.0F / (l2p12 * l2p01));
+        weighted[it._aulPoints[2]] += facenormal * (1.0F / (l2p20 * l2p12));
+    }
+    for (auto& it : weighted) {
+        it.Normalize();
+    }
+
+    EXPECT_EQ(kernel.CalcVertexNormals(), sums);
+    MeshCore::MeshRefNormalToPoints normals(kernel);
+    EXPECT_EQ(normals.GetValues(), weighted);
+}
+
+TEST_F(NeighbourhoodTest, testCurvaturePerVertex)
+{
+    std::vector<Wm4::Vector3<double>> points;
+    for (const auto& it : kernel.GetPoints()) {
+        points.emplace_back(it.x, it.y, it.z);
+    }
+    std::vector<int> indices;
+    for (const auto& it : kernel.GetFacets()) {
+        for (auto index : it._aulPoints) {
+            indices.push_back(int(index));
+        }
+    }
+    Wm4::MeshCurvature<double> wm4(
+        int(points.size()),
+        points.data(),
+        int(kernel.CountFacets()),
+        indices.data()
+    );
+
+    MeshCore::MeshCurvature curvature(kernel);
+    curvature.ComputePerVertex();
+    const std::vector<MeshCore::CurvatureInfo>& info = curvature.GetCurvature();
+    ASSERT_EQ(info.size(), points.size());
+    for (std::size_t i = 0; i < info.size(); i++) {
+        EXPECT_FLOAT_EQ(info[i].fMaxCurvature, float(wm4.GetMaxCurvatures()[i]));
+        EXPECT_FLOAT_EQ(info[i].fMinCurvature, float(wm4.GetMinCurvatures()[i]));
+        EXPECT_FLOAT_EQ(info[i].cMaxCurvDir.x, float(wm4.GetMaxDirections()[i].X()));
+        EXPECT_FLOAT_EQ(info[i].cMinCurvDir.y, float(wm4.GetMinDirections()[i].Y()));
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,155 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <Base/FileInfo.h>
+#include <Mod/Mesh/App/Mesh.h>
+#include <Mod/Mesh/App/Core/Builder.h>
+#include <Mod/Mesh/App/Core/Decimation.h>
+#include <Mod/Mesh/App/Core/Degeneration.h>
+#include <Mod/Mesh/App/Core/MeshIO.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/OutOfCore.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class OutOfCoreTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        MeshCore::MeshFacetArray facets;
+        MeshCore::MeshPointArray points;
+        const int size = 30;
+        for (int i = 0; i <= size; i++) {
+            for (int j = 0; j <= size; j++) {
+                points.push_back(Base::Vector3f(float(i), float(j), float((i * j) % 3)));
+            }
+        }
+        for (int i = 0; i < size; i++) {
+            for (int j = 0; j < size; j++) {
+                auto p0 = MeshCore::PointIndex(i * (size + 1) + j);
+                auto p1 = p0 + size + 1;
+                facets.push_back(MeshCore::MeshFacet(p0, p1, p0 + 1));
+                facets.push_back(MeshCore::MeshFacet(p0 + 1, p1, p1 + 1));
+            }
+        }
+        kernel.Adopt(points, facets);
+        fileInfo.setFile(Base::FileInfo::getTempFileName() + ".fcm");
+    }
+
+    void TearDown() override
+    {
+        fileInfo.deleteFile();
+    }
+
+    MeshCore::MeshKernel kernel;
+    Base::FileInfo fileInfo;
+};
+
+TEST_F(OutOfCoreTest, TestOpenInvalid)
+{
+    MeshCore::MeshOutOfCore mesh;
+    EXPECT_FALSE(mesh.Open(fileInfo.filePath().c_str()));
+    EXPECT_FALSE(mesh.IsOpen());
+    EXPECT_EQ(mesh.CountChunks(), 0);
+}
+
+TEST_F(OutOfCoreTest, TestChunks)
+{
+    ASSERT_TRUE(MeshCore::MeshOutOfCore::Create(kernel, fileInfo.filePath().c_str(), 500));
+
+    MeshCore::MeshOutOfCore mesh(2);
+    ASSERT_TRUE(mesh.Open(fileInfo.filePath().c_str()));
+    EXPECT_EQ(mesh.CountChunks(), 4);
+    EXPECT_EQ(mesh.CountFacets(), kernel.CountFacets());
+    EXPECT_GE(mesh.CountPoints(), kernel.CountPoints());
+    EXPECT_EQ(mesh.GetBoundBox(), kernel.GetBoundBox());
+
+    // read the chunks more often than they fit into the cache
+    MeshCore::FacetIndex facetIndex = 0;
+    for (int pass = 0; pass < 2; pass++) {
+        facetIndex = 0;
+        for (std::size_t chunk = 0; chunk < mesh.CountChunks(); chunk++) {
+            MeshCore::MeshKernel part;
+            mesh.GetChunk(chunk, part);
+            EXPECT_EQ(part.CountFacets(), mesh.GetChunkInfo(chunk).ctFacets);
+            EXPECT_EQ(part.CountPoints(), mesh.GetChunkInfo(chunk).ctPoints);
+            for (MeshCore::FacetIndex i = 0; i < part.CountFacets(); i++, facetIndex++) {
+                MeshCore::MeshGeomFacet f1 = kernel.GetFacet(facetIndex);
+                MeshCore::MeshGeomFacet f2 = part.GetFacet(i);
+                for (int j = 0; j < 3; j++) {
+                    EXPECT_EQ(f1._aclPoints[j], f2._aclPoints[j]);
+                }
+            }
+        }
+    }
+    EXPECT_EQ(facetIndex, kernel.CountFacets());
+}
+
+TEST_F(OutOfCoreTest, TestBinarySTL)
+{
+    Base::FileInfo stl(Base::FileInfo::getTempFileName() + ".stl");
+    MeshCore::MeshOutput output(kernel);
+    ASSERT_TRUE(output.SaveMappedBinarySTL(stl.filePath().c_str()));
+    ASSERT_TRUE(MeshCore::MeshOutOfCore::CreateFromBinarySTL(
+        stl.filePath().c_str(),
+        fileInfo.filePath().c_str(),
+        700
+    ));
+    stl.deleteFile();
+
+    MeshCore::MeshOutOfCore mesh;
+    ASSERT_TRUE(mesh.Open(fileInfo.filePath().c_str()));
+    EXPECT_EQ(mesh.CountChunks(), 3);
+    EXPECT_EQ(mesh.CountFacets(), kernel.CountFacets());
+
+    // joining the chunks again gives the original mesh
+    std::vector<Base::Vector3f> soup;
+    for (std::size_t chunk = 0; chunk < mesh.CountChunks(); chunk++) {
+        MeshCore::MeshKernel part;
+        mesh.GetChunk(chunk, part);
+        for (MeshCore::FacetIndex i = 0; i < part.CountFacets(); i++) {
+            MeshCore::MeshGeomFacet facet = part.GetFacet(i);
+            soup.insert(soup.end(), facet._aclPoints, facet._aclPoints + 3);
+        }
+    }
+
+    MeshCore::MeshPointArray points;
+    MeshCore::MeshFacetArray facets;
+    MeshCore::MeshPointWelder welder(reinterpret_cast<const char*>(soup.data()), soup.size() / 3, 36);
+    welder.Weld(points, facets);
+    EXPECT_EQ(points.size(), kernel.CountPoints());
+    EXPECT_EQ(facets.size(), kernel.CountFacets());
+}
+
+TEST_F(OutOfCoreTest, TestDecimate)
+{
+    ASSERT_TRUE(MeshCore::MeshOutOfCore::Create(kernel, fileInfo.filePath().c_str(), 500));
+    MeshCore::MeshOutOfCore mesh(2);
+    ASSERT_TRUE(mesh.Open(fileInfo.filePath().c_str()));
+
+    MeshCore::MeshKernel result;
+    MeshCore::MeshSimplify dm(result);
+    dm.simplify(mesh, 600);
+    EXPECT_LE(result.CountFacets(), 600);
+    EXPECT_GT(result.CountFacets(), 0);
+
+    MeshCore::MeshEvalRangeFacet rangeFacet(result);
+    EXPECT_TRUE(rangeFacet.Evaluate());
+    MeshCore::MeshEvalRangePoint rangePoint(result);
+    EXPECT_TRUE(rangePoint.Evaluate());
+}
+
+TEST_F(OutOfCoreTest, TestLoadDecimated)
+{
+    Base::FileInfo stl(Base::FileInfo::getTempFileName() + ".stl");
+    MeshCore::MeshOutput output(kernel);
+    ASSERT_TRUE(output.SaveMappedBinarySTL(stl.filePath().c_str()));
+
+    Mesh::MeshObject mesh;
+    EXPECT_TRUE(mesh.loadDecimated(stl.filePath().c_str(), 600));
+    stl.deleteFile();
+    EXPECT_LE(mesh.countFacets(), 600);
+    EXPECT_GT(mesh.countFacets(), 0);
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <Mod/Mesh/App/Core/Approximation.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/Segmentation.h>
+#include <cmath>
+#include <random>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class SegmentationTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a unit cube
+        MeshCore::MeshPointArray points;
+        points.push_back(Base::Vector3f(0, 0, 0));
+        points.push_back(Base::Vector3f(1, 0, 0));
+        points.push_back(Base::Vector3f(1, 1, 0));
+        points.push_back(Base::Vector3f(0, 1, 0));
+        points.push_back(Base::Vector3f(0, 0, 1));
+        points.push_back(Base::Vector3f(1, 0, 1));
+        points.push_back(Base::Vector3f(1, 1, 1));
+        points.push_back(Base::Vector3f(0, 1, 1));
+
+        MeshCore::MeshFacetArray facets;
+        facets.push_back(MeshCore::MeshFacet(0, 2, 1));
+        facets.push_back(MeshCore::MeshFacet(0, 3, 2));
+        facets.push_back(MeshCore::MeshFacet(4, 5, 6));
+        facets.push_back(MeshCore::MeshFacet(4, 6, 7));
+        facets.push_back(MeshCore::MeshFacet(0, 1, 5));
+        facets.push_back(MeshCore::MeshFacet(0, 5, 4));
+        facets.push_back(MeshCore::MeshFacet(3, 7, 6));
+        facets.push_back(MeshCore::MeshFacet(3, 6, 2));
+        facets.push_back(MeshCore::MeshFacet(0, 4, 7));
+        facets.push_back(MeshCore::MeshFacet(0, 7, 3));
+        facets.push_back(MeshCore::MeshFacet(1, 2, 6));
+        facets.push_back(MeshCore::MeshFacet(1, 6, 5));
+        kernel.Adopt(points, facets, true);
+    }
+
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(SegmentationTest, testIncrementalPlaneFit)
+{
+    MeshCore::PlaneFit planeFit;
+    MeshCore::IncrementalPlaneFit incrementalFit;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(-0.01F, 0.01F);
+    for (int i = 0; i < 20; i++) {
+        for (int j = 0; j < 20; j++) {
+            Base::Vector3f point(1000.0F + float(i), 1000.0F + float(j), 1000.0F + dist(gen));
+            planeFit.AddPoint(point);
+            incrementalFit.AddPoint(point);
+        }
+    }
+
+    EXPECT_FALSE(incrementalFit.Done());
+    EXPECT_NEAR(incrementalFit.Fit(), planeFit.Fit(), 1e-4F);
+    EXPECT_TRUE(incrementalFit.Done());
+    EXPECT_EQ(incrementalFit.CountPoints(), 400U);
+
+    Base::Vector3f normal = incrementalFit.GetNormal();
+    EXPECT_NEAR(std::fabs(normal * planeFit.GetNormal()), 1.0F, 1e-5F);
+    EXPECT_NEAR(Base::Distance(incrementalFit.GetBase(), planeFit.GetBase()), 0.0F, 1e-3F);
+    EXPECT_NEAR(incrementalFit.GetDistanceToPlane(Base::Vector3f(1000, 1000, 1001)),
+                normal.z,
+                1e-2F);
+}
+
+TEST_F(SegmentationTest, testIncrementalPlaneFitCollinear)
+{
+    MeshCore::IncrementalPlaneFit fit;
+    fit.AddPoint(Base::Vector3f(0, 0, 0));
+    fit.AddPoint(Base::Vector3f(1, 0, 0));
+    EXPECT_EQ(fit.Fit(), std::numeric_limits<float>::max());
+    fit.AddPoint(Base::Vector3f(2, 0, 0));
+    EXPECT_EQ(fit.Fit(), std::numeric_limits<float>::max());
+
+    fit.Clear();
+    EXPECT_EQ(fit.CountPoints(), 0U);
+    EXPECT_FALSE(fit.Done());
+}
+
+TEST_F(SegmentationTest, testPlanarSegments)
+{
+    MeshCore::MeshSegmentAlgorithm finder(kernel);
+    auto planes = std::make_shared<MeshCore::MeshDistancePlanarSegment>(kernel, 2, 0.01F);
+    std::vector<MeshCore::MeshSurfaceSegmentPtr> segm {planes};
+    finder.FindSegments(segm);
+
+    const auto& segments = planes->GetSegments();
+    ASSERT_EQ(segments.size(), 6U);
+    for (const auto& it : segments) {
+        EXPECT_EQ(it.size(), 2U);
+    }
+}
+
+TEST_F(SegmentationTest, testPlaneSurfaceFitSegments)
+{
+    MeshCore::MeshSegmentAlgorithm finder(kernel);
+    auto planes = std::make_shared<MeshCore::MeshDistanceGenericSurfaceFitSegment>(
+        new MeshCore::PlaneSurfaceFit,
+        kernel,
+        2,
+        0.01F
+    );
+    std::vector<MeshCore::MeshSurfaceSegmentPtr> segm {planes};
+    finder.FindSegments(segm);
+
+    ASSERT_EQ(planes->GetSegments().size(), 6U);
+    std::vector<float> param = planes->Parameters();
+    ASSERT_EQ(param.size(), 6U);
+    Base::Vector3f normal(param[3], param[4], param[5]);
+    EXPECT_NEAR(normal.Length(), 1.0F, 1e-5F);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
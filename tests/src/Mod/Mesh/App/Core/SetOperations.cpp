@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/SetOperations.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class SetOperationsTest: public ::testing::Test
+{
+protected:
+    static MeshCore::MeshKernel makeCube(const Base::Vector3f& pos, float size)
+    {
+        MeshCore::MeshPointArray points;
+        points.push_back(pos + Base::Vector3f(0, 0, 0));
+        points.push_back(pos + Base::Vector3f(size, 0, 0));
+        points.push_back(pos + Base::Vector3f(size, size, 0));
+        points.push_back(pos + Base::Vector3f(0, size, 0));
+        points.push_back(pos + Base::Vector3f(0, 0, size));
+        points.push_back(pos + Base::Vector3f(size, 0, size));
+        points.push_back(pos + Base::Vector3f(size, size, size));
+        points.push_back(pos + Base::Vector3f(0, size, size));
+
+        MeshCore::MeshFacetArray facets;
+        facets.push_back(MeshCore::MeshFacet(0, 2, 1));
+        facets.push_back(MeshCore::MeshFacet(0, 3, 2));
+        facets.push_back(MeshCore::MeshFacet(4, 5, 6));
+        facets.push_back(MeshCore::MeshFacet(4, 6, 7));
+        facets.push_back(MeshCore::MeshFacet(0, 1, 5));
+        facets.push_back(MeshCore::MeshFacet(0, 5, 4));
+        facets.push_back(MeshCore::MeshFacet(3, 7, 6));
+        facets.push_back(MeshCore::MeshFacet(3, 6, 2));
+        facets.push_back(MeshCore::MeshFacet(0, 4, 7));
+        facets.push_back(MeshCore::MeshFacet(0, 7, 3));
+        facets.push_back(MeshCore::MeshFacet(1, 2, 6));
+        facets.push_back(MeshCore::MeshFacet(1, 6, 5));
+
+        MeshCore::MeshKernel kernel;
+        kernel.Adopt(points, facets, true);
+        return kernel;
+    }
+
+    static MeshCore::MeshKernel apply(
+        const MeshCore::MeshKernel& mesh1,
+        const MeshCore::MeshKernel& mesh2,
+        MeshCore::SetOperations::OperationType type
+    )
+    {
+        MeshCore::MeshKernel result;
+        MeshCore::SetOperations setOp(mesh1, mesh2, result, type);
+        setOp.SetClassification(MeshCore::SetOperations::WindingNumber);
+        setOp.Do();
+        return result;
+    }
+};
+
+TEST_F(SetOperationsTest, testUnionNested)
+{
+    auto outer = makeCube(Base::Vector3f(0, 0, 0), 2.0F);
+    auto inner = makeCube(Base::Vector3f(0.5F, 0.5F, 0.5F), 1.0F);
+    auto result = apply(outer, inner, MeshCore::SetOperations::Union);
+    EXPECT_EQ(result.CountFacets(), 12U);
+    EXPECT_NEAR(result.GetVolume(), 8.0F, 1e-5F);
+}
+
+TEST_F(SetOperationsTest, testIntersectNested)
+{
+    auto outer = makeCube(Base::Vector3f(0, 0, 0), 2.0F);
+    auto inner = makeCube(Base::Vector3f(0.5F, 0.5F, 0.5F), 1.0F);
+    auto result = apply(outer, inner, MeshCore::SetOperations::Intersect);
+    EXPECT_EQ(result.CountFacets(), 12U);
+    EXPECT_NEAR(result.GetVolume(), 1.0F, 1e-5F);
+}
+
+TEST_F(SetOperationsTest, testOuterNested)
+{
+    auto outer = makeCube(Base::Vector3f(0, 0, 0), 2.0F);
+    auto inner = makeCube(Base::Vector3f(0.5F, 0.5F, 0.5F), 1.0F);
+    auto result = apply(outer, inner, MeshCore::SetOperations::Outer);
+    EXPECT_EQ(result.CountFacets(), 12U);
+}
+
+TEST_F(SetOperationsTest, testUnionDisjoint)
+{
+    auto cube1 = makeCube(Base::Vector3f(0, 0, 0), 1.0F);
+    auto cube2 = makeCube(Base::Vector3f(2, 0, 0), 1.0F);
+    auto result = apply(cube1, cube2, MeshCore::SetOperations::Union);
+    EXPECT_EQ(result.CountFacets(), 24U);
+}
+
+TEST_F(SetOperationsTest, testIntersectDisjoint)
+{
+    auto cube1 = makeCube(Base::Vector3f(0, 0, 0), 1.0F);
+    auto cube2 = makeCube(Base::Vector3f(2, 0, 0), 1.0F);
+    auto result = apply(cube1, cube2, MeshCore::SetOperations::Intersect);
+    EXPECT_EQ(result.CountFacets(), 0U);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
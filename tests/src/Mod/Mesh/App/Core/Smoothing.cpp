@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/Smoothing.h>
+#include <cmath>
+#include <random>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class SmoothingTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a noisy plane
+        MeshCore::MeshPointArray points;
+        MeshCore::MeshFacetArray facets;
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> dist(-0.01F, 0.01F);
+        for (int i = 0; i <= size; i++) {
+            for (int j = 0; j <= size; j++) {
+                points.push_back(Base::Vector3f(float(i) / size, float(j) / size, dist(gen)));
+            }
+        }
+        for (int i = 0; i < size; i++) {
+            for (int j = 0; j < size; j++) {
+                auto p0 = MeshCore::PointIndex(i * (size + 1) + j);
+                auto p1 = p0 + size + 1;
+                facets.push_back(MeshCore::MeshFacet(p0, p1, p0 + 1));
+                facets.push_back(MeshCore::MeshFacet(p0 + 1, p1, p1 + 1));
+            }
+        }
+        kernel.Adopt(points, facets, true);
+        original = kernel.GetPoints();
+    }
+
+    bool isBorder(MeshCore::PointIndex index) const
+    {
+        auto i = int(index) / (size + 1);
+        auto j = int(index) % (size + 1);
+        return i == 0 || j == 0 || i == size || j == size;
+    }
+
+    float noise() const
+    {
+        float sum = 0.0F;
+        for (const auto& point : kernel.GetPoints()) {
+            sum += std::fabs(point.z);
+        }
+        return sum;
+    }
+
+    const int size = 30;
+    MeshCore::MeshKernel kernel;
+    MeshCore::MeshPointArray original;
+};
+
+TEST_F(SmoothingTest, testLaplace)
+{
+    float before = noise();
+    MeshCore::LaplaceSmoothing smoothing(kernel);
+    smoothing.Smooth(10);
+    EXPECT_LT(noise(), 0.5F * before);
+
+    // border points stay where they are
+    const auto& points = kernel.GetPoints();
+    for (MeshCore::PointIndex i = 0; i < points.size(); i++) {
+        if (isBorder(i)) {
+            EXPECT_EQ(points[i], original[i]);
+        }
+    }
+}
+
+TEST_F(SmoothingTest, testTaubin)
+{
+    float before = noise();
+    MeshCore::TaubinSmoothing smoothing(kernel);
+    smoothing.Smooth(20);
+    EXPECT_LT(noise(), before);
+}
+
+TEST_F(SmoothingTest, testSmoothPoints)
+{
+    MeshCore::PointIndex inner = 5 * (size + 1) + 5;
+    MeshCore::LaplaceSmoothing smoothing(kernel);
+    smoothing.SmoothPoints(5, {inner});
+
+    const auto& points = kernel.GetPoints();
+    for (MeshCore::PointIndex i = 0; i < points.size(); i++) {
+        if (i != inner) {
+            EXPECT_EQ(points[i], original[i]);
+        }
+    }
+}
+
+TEST_F(SmoothingTest, testMedianFilter)
+{
+    float before = noise();
+    MeshCore::MedianFilterSmoothing smoothing(kernel);
+    smoothing.Smooth(3);
+    EXPECT_LT(noise(), before);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <Mod/Mesh/App/Core/BVH.h>
+#include <Mod/Mesh/App/Core/Grid.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/TrimByPlane.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class TrimByPlaneTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a unit square in the xy plane
+        MeshCore::MeshPointArray points;
+        MeshCore::MeshFacetArray facets;
+        for (int i = 0; i <= size; i++) {
+            for (int j = 0; j <= size; j++) {
+                points.push_back(Base::Vector3f(float(i) / size, float(j) / size, 0.0F));
+            }
+        }
+        for (int i = 0; i < size; i++) {
+            for (int j = 0; j < size; j++) {
+                auto p0 = MeshCore::PointIndex(i * (size + 1) + j);
+                auto p1 = p0 + size + 1;
+                facets.push_back(MeshCore::MeshFacet(p0, p1, p0 + 1));
+                facets.push_back(MeshCore::MeshFacet(p0 + 1, p1, p1 + 1));
+            }
+        }
+        kernel.Adopt(points, facets, true);
+    }
+
+    const int size = 20;
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(TrimByPlaneTest, testCheckFacetsBVH)
+{
+    Base::Vector3f base(0.33F, 0.0F, 0.0F);
+    Base::Vector3f normal(1.0F, 0.2F, 0.0F);
+
+    MeshCore::MeshTrimByPlane trim(kernel);
+    std::vector<MeshCore::FacetIndex> trimGrid, removeGrid;
+    MeshCore::MeshFacetGrid grid(kernel);
+    trim.CheckFacets(grid, base, normal, trimGrid, removeGrid);
+
+    std::vector<MeshCore::FacetIndex> trimBVH, removeBVH;
+    MeshCore::MeshFacetBVH bvh(kernel);
+    trim.CheckFacets(bvh, base, normal, trimBVH, removeBVH);
+
+    EXPECT_FALSE(trimBVH.empty());
+    EXPECT_EQ(trimGrid, trimBVH);
+    EXPECT_EQ(removeGrid, removeBVH);
+}
+
+TEST_F(TrimByPlaneTest, testTrimFacets)
+{
+    Base::Vector3f base(0.33F, 0.0F, 0.0F);
+    Base::Vector3f normal(1.0F, 0.0F, 0.0F);
+
+    MeshCore::MeshTrimByPlane trim(kernel);
+    std::vector<MeshCore::FacetIndex> trimFacets, removeFacets;
+    std::vector<MeshCore::MeshGeomFacet> triangles;
+    MeshCore::MeshFacetBVH bvh(kernel);
+    trim.CheckFacets(bvh, base, normal, trimFacets, removeFacets);
+    trim.TrimFacets(trimFacets, base, normal, triangles);
+
+    kernel.DeleteFacets(removeFacets);
+    kernel.AddFacets(triangles);
+    EXPECT_NEAR(kernel.GetSurface(), 0.33F, 1e-4F);
+}
+
+TEST_F(TrimByPlaneTest, testTrimByPlanes)
+{
+    std::vector<std::pair<Base::Vector3f, Base::Vector3f>> planes;
+    planes.emplace_back(Base::Vector3f(0.33F, 0.0F, 0.0F), Base::Vector3f(1.0F, 0.0F, 0.0F));
+    planes.emplace_back(Base::Vector3f(0.0F, 0.52F, 0.0F), Base::Vector3f(0.0F, 1.0F, 0.0F));
+    planes.emplace_back(Base::Vector3f(0.1F, 0.0F, 0.0F), Base::Vector3f(-1.0F, 0.0F, 0.0F));
+
+    MeshCore::MeshTrimByPlane trim(kernel);
+    std::vector<MeshCore::FacetIndex> removeFacets;
+    std::vector<MeshCore::MeshGeomFacet> triangles;
+    trim.TrimByPlanes(planes, removeFacets, triangles);
+
+    EXPECT_FALSE(triangles.empty());
+    kernel.DeleteFacets(removeFacets);
+    kernel.AddFacets(triangles);
+    EXPECT_NEAR(kernel.GetSurface(), 0.23F * 0.52F, 1e-4F);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -4,6 +4,8 @@
 #include <Base/FileInfo.h>
 #include <Mod/Mesh/App/Core/IO/Reader3MF.h>
 #include <Mod/Mesh/App/Core/IO/ReaderOBJ.h>
+#include <Mod/Mesh/App/Core/IO/ReaderPLY.h>
+#include <sstream>
 #include <xercesc/util/PlatformUtils.hpp>
 #include <zipios++/fcoll.h>
 
@@ -53,4 +55,58 @@ TEST_F(ImporterTest, TestOBJ)
     EXPECT_EQ(kernel.CountPoints(), 8);
     EXPECT_EQ(kernel.CountFacets(), 12);
 }
+
+TEST_F(ImporterTest, TestOBJStream)
+{
+    std::stringstream str;
+    str << "# quad and triangle with relative indices\n"
+        << "v 0 0 0\n"
+        << "v 1 0 0\r\n"
+        << "vn 0 0 1\n"
+        << "v 1 1 0\n"
+        << "  v 0 1 0  \n"
+        << "g quad\n"
+        << "f 1/1 2/2 3/3 4/4\n"
+        << "g triangle\n"
+        << "f -4//1 -3//1 -1//1\n";
+
+    MeshCore::MeshKernel kernel;
+    MeshCore::ReaderOBJ reader(kernel, nullptr);
+    EXPECT_EQ(reader.Load(str), true);
+
+    EXPECT_EQ(kernel.CountPoints(), 4);
+    ASSERT_EQ(kernel.CountFacets(), 3);
+    EXPECT_EQ(kernel.GetFacets()[1]._aulPoints[1], 3);
+    EXPECT_EQ(kernel.GetFacets()[2]._aulPoints[2], 3);
+    EXPECT_EQ(kernel.GetFacets()[0]._ulProp, 1);
+    EXPECT_EQ(kernel.GetFacets()[2]._ulProp, 2);
+}
+
+TEST_F(ImporterTest, TestPLYAscii)
+{
+    std::stringstream str;
+    str << "ply\n"
+        << "format ascii 1.0\n"
+        << "element vertex 4\n"
+        << "property float x\n"
+        << "property float y\n"
+        << "property float z\n"
+        << "element face 2\n"
+        << "property list uchar int vertex_indices\n"
+        << "end_header\n"
+        << "0 0 0\n"
+        << "1.5 0 0\r\n"
+        << "1.5 1 0\n"
+        << "0 1e0 0\n"
+        << "3 0 1 2\n"
+        << "3 0 2 3\n";
+
+    MeshCore::MeshKernel kernel;
+    MeshCore::ReaderPLY reader(kernel);
+    EXPECT_EQ(reader.Load(str), true);
+
+    EXPECT_EQ(kernel.CountPoints(), 4);
+    EXPECT_EQ(kernel.CountFacets(), 2);
+    EXPECT_FLOAT_EQ(kernel.GetSurface(), 1.5F);
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
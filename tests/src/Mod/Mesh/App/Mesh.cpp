@@ -2,7 +2,12 @@
 
 #include <gtest/gtest.h>
 #include <Mod/Mesh/App/Mesh.h>
+#include <App/Application.h>
+#include <Base/FileInfo.h>
+#include <Base/Stream.h>
+#include <Mod/Mesh/App/Core/Builder.h>
 #include <Mod/Mesh/App/Core/Grid.h>
+#include <Mod/Mesh/App/Core/MeshIO.h>
 
 #include <src/App/InitApplication.h>
 
@@ -108,4 +113,228 @@ TEST_F(MeshTest, TestGrid2OfAlmostPlanarMesh)
     EXPECT_EQ(countY, 1);
     EXPECT_EQ(countZ, 1);
 }
+
+TEST_F(MeshTest, TestGridCells)
+{
+    MeshCore::MeshGridCells cells;
+    cells.Resize(2, 2, 2);
+    cells.Add(1, 0, 1, 7);
+    cells.Add(1, 0, 1, 3);
+    cells.Add(0, 1, 0, 5);
+    MeshCore::MeshGridCells::Entries entries;
+    entries.emplace_back(cells.GetCellIndex(1, 0, 1), 7);
+    entries.emplace_back(cells.GetCellIndex(0, 0, 0), 1);
+    cells.Add(std::move(entries));
+    cells.Finish();
+
+    std::vector<MeshCore::ElementIndex> cell(cells(1, 0, 1).begin(), cells(1, 0, 1).end());
+    EXPECT_EQ(cell, std::vector<MeshCore::ElementIndex>({3, 7}));
+    EXPECT_EQ(cells(0, 1, 0).size(), 1);
+    EXPECT_EQ(cells(0, 0, 0).size(), 1);
+    EXPECT_TRUE(cells(1, 1, 1).empty());
+}
+
+TEST_F(MeshTest, TestGridOfLargeMesh)
+{
+    // enough facets to fill the grid in several blocks
+    MeshCore::MeshKernel kernel;
+    MeshCore::MeshFacetArray facets;
+    MeshCore::MeshPointArray points;
+    const int size = 200;
+    for (int i = 0; i <= size; i++) {
+        for (int j = 0; j <= size; j++) {
+            points.push_back(Base::Vector3f(float(i), float(j), float((i * j) % 3)));
+        }
+    }
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            auto p0 = MeshCore::PointIndex(i * (size + 1) + j);
+            auto p1 = p0 + size + 1;
+            facets.push_back(MeshCore::MeshFacet(p0, p1, p0 + 1));
+            facets.push_back(MeshCore::MeshFacet(p0 + 1, p1, p1 + 1));
+        }
+    }
+    kernel.Adopt(points, facets);
+
+    MeshCore::MeshFacetGrid grid(kernel, 20);
+    EXPECT_TRUE(grid.Verify());
+
+    Base::Vector3f pnt(50.3F, 120.6F, 5.0F);
+    MeshCore::ElementIndex nearest = grid.SearchNearestFromPoint(pnt);
+    ASSERT_NE(nearest, MeshCore::ELEMENT_INDEX_MAX);
+    float minDist = std::numeric_limits<float>::max();
+    for (MeshCore::FacetIndex i = 0; i < kernel.CountFacets(); i++) {
+        minDist = std::min(minDist, kernel.GetFacet(i).DistanceToPoint(pnt));
+    }
+    EXPECT_FLOAT_EQ(kernel.GetFacet(nearest).DistanceToPoint(pnt), minDist);
+}
+
+TEST_F(MeshTest, TestFastBuilder)
+{
+    MeshCore::MeshKernel kernel;
+    MeshCore::MeshFastBuilder builder(kernel);
+    builder.Initialize(2);
+    builder.AddFacet(MeshCore::MeshGeomFacet({0, 0, 0}, {1, 0, 0}, {0, 1, 0}));
+    builder.AddFacet(MeshCore::MeshGeomFacet({0, 1, 0}, {1, 0, 0}, {1, 1, -0.0F}));
+    builder.Finish();
+
+    EXPECT_EQ(kernel.CountPoints(), 4);
+    EXPECT_EQ(kernel.CountFacets(), 2);
+}
+
+TEST_F(MeshTest, TestFastBuilderWithTolerance)
+{
+    MeshCore::MeshKernel kernel;
+    MeshCore::MeshFastBuilder builder(kernel);
+    builder.SetTolerance(0.01F);
+    builder.Initialize(2);
+    builder.AddFacet(MeshCore::MeshGeomFacet({0, 0, 0}, {1, 0, 0}, {0, 1, 0}));
+    builder.AddFacet(MeshCore::MeshGeomFacet({0, 1.005F, 0}, {1.005F, 0, 0}, {1, 1, 0}));
+    builder.Finish();
+
+    EXPECT_EQ(kernel.CountPoints(), 4);
+    EXPECT_EQ(kernel.CountFacets(), 2);
+}
+
+TEST_F(MeshTest, TestLoadWithWeldTolerance)
+{
+    MeshCore::MeshKernel kernel;
+    MeshCore::MeshFastBuilder builder(kernel);
+    builder.Initialize(2);
+    builder.AddFacet(MeshCore::MeshGeomFacet({0, 0, 0}, {1, 0, 0}, {0, 1, 0}));
+    builder.AddFacet(MeshCore::MeshGeomFacet({0, 1.005F, 0}, {1.005F, 0, 0}, {1, 1, 0}));
+    builder.Finish();
+    Base::FileInfo fi(Base::FileInfo::getTempFileName() + ".stl");
+    MeshCore::MeshOutput output(kernel);
+    ASSERT_TRUE(output.SaveMappedBinarySTL(fi.filePath().c_str()));
+
+    // the preference is read for every load
+    ParameterGrp::handle handle = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Mesh"
+    );
+    Mesh::MeshObject mesh;
+    handle->SetFloat("WeldTolerance", 0.01);
+    ASSERT_TRUE(mesh.load(fi.filePath().c_str()));
+    EXPECT_EQ(mesh.countPoints(), 4);
+    handle->RemoveFloat("WeldTolerance");
+    ASSERT_TRUE(mesh.load(fi.filePath().c_str()));
+    EXPECT_EQ(mesh.countPoints(), 6);
+    fi.deleteFile();
+}
+
+TEST_F(MeshTest, TestMergePoints)
+{
+    MeshCore::MeshPointArray points;
+    points.push_back(MeshCore::MeshPoint(0, 0, 0));
+    points.push_back(MeshCore::MeshPoint(1, 0, 0));
+    points.push_back(MeshCore::MeshPoint(0, 1, 0));
+    points.push_back(MeshCore::MeshPoint(0.999F, 0.0005F, 0));
+    points.push_back(MeshCore::MeshPoint(0, 1.001F, 0));
+    points.push_back(MeshCore::MeshPoint(1, 1, 0));
+    MeshCore::MeshFacetArray facets;
+    facets.push_back(MeshCore::MeshFacet(0, 1, 2));
+    facets.push_back(MeshCore::MeshFacet(4, 3, 5));
+
+    MeshCore::MeshPointWelder::Merge(points, facets, 0.01F);
+    ASSERT_EQ(points.size(), 4);
+    EXPECT_EQ(points[3], Base::Vector3f(1, 1, 0));
+    EXPECT_EQ(facets[1]._aulPoints[0], 2);
+    EXPECT_EQ(facets[1]._aulPoints[1], 1);
+    EXPECT_EQ(facets[1]._aulPoints[2], 3);
+}
+
+TEST_F(MeshTest, TestMappedBinarySTL)
+{
+    MeshCore::MeshKernel kernel;
+    MeshCore::MeshFacetArray facets;
+    MeshCore::MeshPointArray points;
+    const int size = 50;
+    for (int i = 0; i <= size; i++) {
+        for (int j = 0; j <= size; j++) {
+            points.push_back(Base::Vector3f(float(i), float(j), float((i * j) % 3)));
+        }
+    }
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            auto p0 = MeshCore::PointIndex(i * (size + 1) + j);
+            auto p1 = p0 + size + 1;
+            facets.push_back(MeshCore::MeshFacet(p0, p1, p0 + 1));
+            facets.push_back(MeshCore::MeshFacet(p0 + 1, p1, p1 + 1));
+        }
+    }
+    kernel.Adopt(points, facets);
+
+    Base::FileInfo fi(Base::FileInfo::getTempFileName() + ".stl");
+    MeshCore::MeshOutput output(kernel);
+    ASSERT_TRUE(output.SaveMappedBinarySTL(fi.filePath().c_str()));
+    EXPECT_EQ(fi.size(), 84 + 50 * kernel.CountFacets());
+
+    MeshCore::MeshKernel mapped;
+    MeshCore::MeshInput input(mapped);
+    ASSERT_TRUE(input.LoadMappedBinarySTL(fi.filePath().c_str()));
+    EXPECT_EQ(mapped.CountPoints(), kernel.CountPoints());
+    EXPECT_EQ(mapped.CountFacets(), kernel.CountFacets());
+    for (MeshCore::FacetIndex i = 0; i < kernel.CountFacets(); i++) {
+        MeshCore::MeshGeomFacet f1 = kernel.GetFacet(i);
+        MeshCore::MeshGeomFacet f2 = mapped.GetFacet(i);
+        for (int j = 0; j < 3; j++) {
+            EXPECT_EQ(f1._aclPoints[j], f2._aclPoints[j]);
+        }
+    }
+
+    MeshCore::MeshKernel streamed;
+    Base::ifstream str(fi, std::ios::in | std::ios::binary);
+    ASSERT_TRUE(MeshCore::MeshInput(streamed).LoadBinarySTL(str));
+    str.close();
+    EXPECT_EQ(streamed.CountPoints(), mapped.CountPoints());
+    fi.deleteFile();
+
+    // an ASCII STL is rejected
+    Base::ofstream ascii(fi, std::ios::out | std::ios::binary);
+    ASSERT_TRUE(output.SaveAsciiSTL(ascii));
+    ascii.close();
+    MeshCore::MeshKernel empty;
+    EXPECT_FALSE(MeshCore::MeshInput(empty).LoadMappedBinarySTL(fi.filePath().c_str()));
+    fi.deleteFile();
+}
+
+TEST_F(MeshTest, TestTransformLargePointArray)
+{
+    // more points than handled by a single task
+    MeshCore::MeshPointArray points;
+    for (int i = 0; i < 200000; i++) {
+        points.emplace_back(float(i % 1000), float(i / 1000), float(i % 7));
+    }
+    points[100].SetFlag(MeshCore::MeshPoint::MARKED);
+
+    Base::Matrix4D mat;
+    mat.rotZ(0.5);
+    mat.move(Base::Vector3d(1.0, 2.0, 3.0));
+
+    MeshCore::MeshPointArray expected = points;
+    Base::BoundBox3f expectedBox;
+    for (auto& pnt : expected) {
+        mat.multVec(pnt, pnt);
+        expectedBox.Add(pnt);
+    }
+
+    Base::BoundBox3f box;
+    points.Transform(mat, box);
+    for (std::size_t i = 0; i < points.size(); i++) {
+        EXPECT_EQ(points[i].x, expected[i].x);
+        EXPECT_EQ(points[i].y, expected[i].y);
+        EXPECT_EQ(points[i].z, expected[i].z);
+    }
+    EXPECT_TRUE(points[100].IsFlag(MeshCore::MeshPoint::MARKED));
+    EXPECT_EQ(box.MinX, expectedBox.MinX);
+    EXPECT_EQ(box.MaxY, expectedBox.MaxY);
+    EXPECT_EQ(box.MaxZ, expectedBox.MaxZ);
+
+    Base::BoundBox3f bbox = points.GetBoundBox();
+    EXPECT_EQ(bbox.MinY, expectedBox.MinY);
+    EXPECT_EQ(bbox.MinZ, expectedBox.MinZ);
+    EXPECT_EQ(bbox.MaxX, expectedBox.MaxX);
+
+    EXPECT_FALSE(MeshCore::MeshPointArray().GetBoundBox().IsValid());
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
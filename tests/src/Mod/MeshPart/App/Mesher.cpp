@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <BRepAlgoAPI_Cut.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <TopoDS_Shape.hxx>
+
+#include <Mod/Mesh/App/Mesh.h>
+#include <Mod/MeshPart/App/Mesher.h>
+#include <src/App/InitApplication.h>
+
+class Mesher: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    static Mesh::MeshObject* createMesh(const TopoDS_Shape& shape, bool parallel)
+    {
+        MeshPart::Mesher mesher(shape);
+        mesher.setMethod(MeshPart::Mesher::Standard);
+        mesher.setDeflection(0.1);
+        mesher.setAngularDeflection(0.5);
+        mesher.setSegments(true);
+        mesher.setParallel(parallel);
+        return mesher.createMesh();
+    }
+};
+
+// NOLINTBEGIN
+TEST_F(Mesher, testParallelStandard)
+{
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(10.0, 10.0, 10.0).Shape();
+    TopoDS_Shape cyl = BRepPrimAPI_MakeCylinder(gp_Ax2(gp_Pnt(5, 5, -1), gp_Dir(0, 0, 1)), 2.0, 12.0);
+    TopoDS_Shape shape = BRepAlgoAPI_Cut(box, cyl).Shape();
+
+    std::unique_ptr<Mesh::MeshObject> serial(createMesh(shape, false));
+    std::unique_ptr<Mesh::MeshObject> parallel(createMesh(shape, true));
+
+    EXPECT_GT(parallel->countFacets(), 0UL);
+    EXPECT_EQ(parallel->countPoints(), serial->countPoints());
+    EXPECT_EQ(parallel->countFacets(), serial->countFacets());
+    EXPECT_EQ(parallel->countSegments(), serial->countSegments());
+    EXPECT_EQ(parallel->getKernel().HasOpenEdges(), serial->getKernel().HasOpenEdges());
+}
+// NOLINTEND
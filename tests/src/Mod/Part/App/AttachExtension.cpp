@@ -96,3 +96,28 @@ TEST_F(AttachExtensionTest, testAttacherTypeEngine)
     plane->onExtendedDocumentRestored();
     EXPECT_STREQ(plane->AttacherEngine.getValueAsString(), "Engine 3D");
 }
+
+TEST_F(AttachExtensionTest, testFollowSupportChanges)
+{
+    // Arrange
+    auto plane1 = getDocument()->addObject<Part::Plane>("Plane1");
+    auto plane2 = getDocument()->addObject<Part::Plane>("Plane2");
+    plane2->AttachmentSupport.setValue(plane1);
+    plane2->MapMode.setValue("FlatFace");
+    getDocument()->recompute();
+    EXPECT_EQ(plane2->Placement.getValue().getPosition(), Base::Vector3d(0, 0, 0));
+
+    // Act
+    plane1->Placement.setValue(Base::Placement(Base::Vector3d(0, 0, 5), Base::Rotation()));
+    getDocument()->recompute();
+    Base::Vector3d moved = plane2->Placement.getValue().getPosition();
+    plane2->AttachmentOffset.setValue(Base::Placement(Base::Vector3d(1, 0, 0), Base::Rotation()));
+    Base::Vector3d offset = plane2->Placement.getValue().getPosition();
+    plane2->recomputeFeature();
+    Base::Vector3d recomputed = plane2->Placement.getValue().getPosition();
+
+    // Assert
+    EXPECT_EQ(moved, Base::Vector3d(0, 0, 5));
+    EXPECT_EQ(offset, Base::Vector3d(1, 0, 5));
+    EXPECT_EQ(recomputed, Base::Vector3d(1, 0, 5));
+}
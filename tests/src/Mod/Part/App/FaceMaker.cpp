@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include "src/App/InitApplication.h"
+#include "Mod/Part/App/FaceMakerBullseye.h"
+#include "Mod/Part/App/FaceMakerCheese.h"
+
+#include "PartTestHelpers.h"
+
+#include <numbers>
+
+#include <BRepBuilderAPI_MakeEdge.hxx>
+#include <BRepBuilderAPI_MakePolygon.hxx>
+#include <BRepBuilderAPI_MakeWire.hxx>
+#include <gp_Circ.hxx>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+using namespace Part;
+using namespace PartTestHelpers;
+
+class FaceMakerTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    static TopoDS_Wire square(double x, double y, double size)
+    {
+        BRepBuilderAPI_MakePolygon polygon(
+            gp_Pnt(x, y, 0.0),
+            gp_Pnt(x + size, y, 0.0),
+            gp_Pnt(x + size, y + size, 0.0),
+            gp_Pnt(x, y + size, 0.0),
+            Standard_True
+        );
+        return polygon.Wire();
+    }
+
+    static TopoDS_Wire circle(double x, double y, double radius)
+    {
+        gp_Circ circ(gp_Ax2(gp_Pnt(x, y, 0.0), gp_Dir(0.0, 0.0, 1.0)), radius);
+        return BRepBuilderAPI_MakeWire(BRepBuilderAPI_MakeEdge(circ).Edge()).Wire();
+    }
+
+    /// A 20x20 panel with a grid of 10x10 holes of the given radius
+    static void addPerforatedPanel(FaceMaker& mkFace, double radius)
+    {
+        mkFace.addWire(square(0.0, 0.0, 20.0));
+        for (int i = 0; i < 10; i++) {
+            for (int j = 0; j < 10; j++) {
+                mkFace.addWire(circle(1.0 + 2.0 * i, 1.0 + 2.0 * j, radius));
+            }
+        }
+    }
+};
+
+TEST_F(FaceMakerTest, bullseyePerforatedPanel)
+{
+    // Arrange
+    FaceMakerBullseye mkFace;
+    addPerforatedPanel(mkFace, 0.5);
+
+    // Act
+    mkFace.Build();
+
+    // Assert
+    EXPECT_NEAR(getArea(mkFace.Shape()), 400.0 - 100 * std::numbers::pi * 0.25, 1e-6);
+}
+
+TEST_F(FaceMakerTest, bullseyePerforatedPanelWithIsland)
+{
+    // Arrange
+    FaceMakerBullseye mkFace;
+    addPerforatedPanel(mkFace, 0.5);
+    // an island in the first hole, and a hole in the island
+    mkFace.addWire(circle(1.0, 1.0, 0.4));
+    mkFace.addWire(circle(1.0, 1.0, 0.2));
+
+    // Act
+    mkFace.Build();
+
+    // Assert
+    double expected = 400.0 - 100 * std::numbers::pi * 0.25 + std::numbers::pi * (0.16 - 0.04);
+    EXPECT_NEAR(getArea(mkFace.Shape()), expected, 1e-6);
+}
+
+TEST_F(FaceMakerTest, cheesePerforatedPanel)
+{
+    // Arrange
+    FaceMakerCheese mkFace;
+    addPerforatedPanel(mkFace, 0.5);
+    // a separate face next to the panel
+    mkFace.addWire(square(30.0, 0.0, 2.0));
+
+    // Act
+    mkFace.Build();
+
+    // Assert
+    EXPECT_NEAR(getArea(mkFace.Shape()), 404.0 - 100 * std::numbers::pi * 0.25, 1e-6);
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
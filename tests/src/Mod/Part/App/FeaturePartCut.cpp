@@ -3,6 +3,9 @@
 #include <gtest/gtest.h>
 
 #include "Mod/Part/App/FeaturePartCut.h"
+#include "Mod/Part/App/RecomputeCache.h"
+#include <App/Application.h>
+#include <Base/FileInfo.h>
 #include <src/App/InitApplication.h>
 
 #include "PartTestHelpers.h"
@@ -187,3 +190,103 @@ TEST_F(FeaturePartCutTest, testMapping)
 }
 
 // See FeaturePartCommon.cpp for a history test.  It would be exactly the same and redundant here.
+
+TEST_F(FeaturePartCutTest, testMultiCut)
+{
+    // Arrange
+    auto multiCut = _doc->addObject<Part::MultiCut>();
+    multiCut->Shapes.setValues({_boxes[0], _boxes[1], _boxes[2]});
+
+    // Act
+    multiCut->execute();
+    Part::TopoShape ts = multiCut->Shape.getValue();
+    double volume = PartTestHelpers::getVolume(ts.getShape());
+    Base::BoundBox3d bb = ts.getBoundBox();
+
+    // Assert the overlapping box is removed and the distant one is ignored
+    EXPECT_DOUBLE_EQ(volume, 1.0 * 1.0 * 3.0);
+    EXPECT_DOUBLE_EQ(bb.MaxY, 1.0);
+    EXPECT_GT(multiCut->Shape.getShape().getElementMapSize(), 0);
+    EXPECT_STREQ(multiCut->getViewProviderName(), "PartGui::ViewProviderMultiCut");
+}
+
+TEST_F(FeaturePartCutTest, testRecomputeCache)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General"
+    );
+    Base::FileInfo dir(Base::FileInfo::getTempPath() + "RecomputeCacheTest");
+    hGrp->SetASCII("RecomputeCacheDir", dir.filePath().c_str());
+    hGrp->SetBool("RecomputeCache", true);
+    _cut->Base.setValue(_boxes[0]);
+    _cut->Tool.setValue(_boxes[1]);
+
+    // Act
+    _doc->recompute();
+    std::string key = _cut->getRecomputeKey();
+    double volume = PartTestHelpers::getVolume(_cut->Shape.getValue());
+    auto mapSize = _cut->Shape.getShape().getElementMapSize();
+    _cut->touch();
+    _doc->recompute();
+
+    // Assert
+    EXPECT_FALSE(key.empty());
+    EXPECT_EQ(_cut->getRecomputeKey(), key);
+    EXPECT_TRUE(Base::FileInfo(dir.filePath() + "/" + key + ".fcshape").exists());
+    EXPECT_DOUBLE_EQ(PartTestHelpers::getVolume(_cut->Shape.getValue()), volume);
+    EXPECT_EQ(_cut->Shape.getShape().getElementMapSize(), mapSize);
+
+    hGrp->SetBool("RecomputeCache", false);
+    dir.deleteDirectoryRecursive();
+}
+
+TEST_F(FeaturePartCutTest, testRecomputeKeyClearedByShapeChange)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General"
+    );
+    Base::FileInfo dir(Base::FileInfo::getTempPath() + "RecomputeCacheTest");
+    hGrp->SetASCII("RecomputeCacheDir", dir.filePath().c_str());
+    hGrp->SetBool("RecomputeCache", true);
+    _cut->Base.setValue(_boxes[0]);
+    _cut->Tool.setValue(_boxes[1]);
+    _doc->recompute();
+    std::string key = _cut->getRecomputeKey();
+
+    // Act: like undo or an assignment from Python, the shape changes without a recompute
+    _cut->Shape.setValue(_boxes[0]->Shape.getShape());
+
+    // Assert: dependents must not take the shape for the cached result
+    EXPECT_FALSE(key.empty());
+    EXPECT_TRUE(_cut->getRecomputeKey().empty());
+
+    hGrp->SetBool("RecomputeCache", false);
+    dir.deleteDirectoryRecursive();
+}
+
+TEST_F(FeaturePartCutTest, testParallelRecomputeWithSharedBase)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document"
+    );
+    hGrp->SetBool("ParallelRecompute", true);
+    auto other = _doc->addObject<Part::Cut>();
+    _cut->Base.setValue(_boxes[0]);
+    _cut->Tool.setValue(_boxes[1]);
+    other->Base.setValue(_boxes[0]);
+    other->Tool.setValue(_boxes[2]);
+
+    // Act: both cuts are in the same dependency level and read the cache of the same base
+    _doc->recompute();
+    hGrp->RemoveBool("ParallelRecompute");
+
+    // Assert
+    EXPECT_FALSE(_cut->canRecomputeConcurrently());
+    EXPECT_DOUBLE_EQ(PartTestHelpers::getVolume(_cut->Shape.getValue()), 3.0);
+    EXPECT_DOUBLE_EQ(PartTestHelpers::getVolume(other->Shape.getValue()), 6.0);
+    EXPECT_FALSE(_cut->isError());
+    EXPECT_FALSE(other->isError());
+}
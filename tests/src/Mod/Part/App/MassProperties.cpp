@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <Base/Exception.h>
+#include <Mod/Part/App/MassProperties.h>
+#include <Mod/Part/App/ParallelPolicy.h>
+
+#include <BRepBuilderAPI_MakeEdge.hxx>
+#include <BRepBuilderAPI_MakeFace.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <gp_Pln.hxx>
+#include <gp_Pnt.hxx>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+using Part::MassProperties;
+using Part::ParallelPolicy::Algorithm;
+
+TEST(MassProperties, boxUsesVolume)
+{
+    // Arrange
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape();
+
+    // Act
+    auto props = MassProperties::compute(box, 2.0);
+
+    // Assert
+    EXPECT_EQ(props.dimension, 3);
+    EXPECT_NEAR(props.size, 6000.0, 1e-6);
+    EXPECT_NEAR(props.mass, 12000.0, 1e-6);
+    EXPECT_NEAR(props.centerOfMass.x, 5.0, 1e-9);
+    EXPECT_NEAR(props.centerOfMass.y, 10.0, 1e-9);
+    EXPECT_NEAR(props.centerOfMass.z, 15.0, 1e-9);
+    // Ixx = m * (b^2 + c^2) / 12
+    EXPECT_NEAR(props.matrixOfInertia[0][0], 12000.0 * (400.0 + 900.0) / 12.0, 1e-3);
+}
+
+TEST(MassProperties, lowerDimensions)
+{
+    // Arrange
+    TopoDS_Shape face = BRepBuilderAPI_MakeFace(gp_Pln(), 0.0, 4.0, 0.0, 5.0).Shape();
+    TopoDS_Shape edge = BRepBuilderAPI_MakeEdge(gp_Pnt(0, 0, 0), gp_Pnt(3, 4, 0)).Shape();
+
+    // Act
+    auto faceProps = MassProperties::compute(face);
+    auto edgeProps = MassProperties::compute(edge);
+    auto nullProps = MassProperties::compute(TopoDS_Shape());
+
+    // Assert
+    EXPECT_EQ(faceProps.dimension, 2);
+    EXPECT_NEAR(faceProps.size, 20.0, 1e-9);
+    EXPECT_EQ(edgeProps.dimension, 1);
+    EXPECT_NEAR(edgeProps.size, 5.0, 1e-9);
+    EXPECT_EQ(nullProps.dimension, 0);
+    EXPECT_DOUBLE_EQ(nullProps.mass, 0.0);
+}
+
+TEST(MassProperties, batchMatchesSingleShapes)
+{
+    // Arrange
+    std::vector<TopoDS_Shape> shapes;
+    std::vector<double> densities;
+    for (int i = 1; i <= 8; ++i) {
+        shapes.push_back(BRepPrimAPI_MakeBox(static_cast<double>(i), 2.0, 3.0).Shape());
+        densities.push_back(i * 0.5);
+    }
+    auto saved = Part::ParallelPolicy::getSettings();
+    auto sequential = saved;
+    sequential.enabled[static_cast<std::size_t>(Algorithm::MassProperties)] = false;
+
+    // Act
+    auto parallel = MassProperties::compute(shapes, densities);
+    std::vector<MassProperties> single;
+    Part::ParallelPolicy::withSettings(sequential, [&]() {
+        single = MassProperties::compute(shapes, densities);
+    });
+
+    // Assert
+    ASSERT_EQ(parallel.size(), shapes.size());
+    ASSERT_EQ(single.size(), shapes.size());
+    for (std::size_t i = 0; i < shapes.size(); ++i) {
+        EXPECT_DOUBLE_EQ(parallel[i].mass, single[i].mass);
+        EXPECT_NEAR(parallel[i].mass, (i + 1) * 6.0 * densities[i], 1e-6);
+    }
+    EXPECT_TRUE(Part::ParallelPolicy::getSettings() == saved);
+}
+
+TEST(MassProperties, batchRejectsDensityMismatch)
+{
+    // Arrange
+    std::vector<TopoDS_Shape> shapes {BRepPrimAPI_MakeBox(1.0, 1.0, 1.0).Shape()};
+
+    // Act and Assert
+    EXPECT_THROW(MassProperties::compute(shapes, {1.0, 2.0}), Base::ValueError);
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <Mod/Part/App/ParallelPolicy.h>
+
+#include <stdexcept>
+
+#include <OSD_ThreadPool.hxx>
+
+using Part::ParallelPolicy::Algorithm;
+
+class ParallelPolicyTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        _saved = Part::ParallelPolicy::getSettings();
+    }
+
+    void TearDown() override
+    {
+        Part::ParallelPolicy::setSettings(_saved);
+    }
+
+private:
+    Part::ParallelPolicy::Settings _saved;
+};
+
+TEST_F(ParallelPolicyTest, disableSingleAlgorithm)
+{
+    // Arrange
+    auto settings = Part::ParallelPolicy::getSettings();
+    settings.enabled[static_cast<std::size_t>(Algorithm::Mesh)] = false;
+
+    // Act
+    Part::ParallelPolicy::setSettings(settings);
+
+    // Assert
+    EXPECT_FALSE(Part::ParallelPolicy::useParallel(Algorithm::Mesh));
+    EXPECT_TRUE(Part::ParallelPolicy::useParallel(Algorithm::Boolean));
+}
+
+TEST_F(ParallelPolicyTest, threadCountResizesPool)
+{
+    // Arrange
+    auto settings = Part::ParallelPolicy::getSettings();
+    settings.threads = 3;
+
+    // Act
+    Part::ParallelPolicy::setSettings(settings);
+
+    // Assert
+    EXPECT_EQ(OSD_ThreadPool::DefaultPool()->NbThreads(), 3);
+}
+
+TEST_F(ParallelPolicyTest, withSettingsRestoresOnException)
+{
+    // Arrange
+    auto before = Part::ParallelPolicy::getSettings();
+    auto settings = before;
+    settings.enabled[static_cast<std::size_t>(Algorithm::Boolean)] = false;
+
+    // Act
+    bool enabledInside = true;
+    EXPECT_THROW(
+        Part::ParallelPolicy::withSettings(
+            settings,
+            [&]() {
+                enabledInside = Part::ParallelPolicy::isEnabled(Algorithm::Boolean);
+                throw std::runtime_error("abort");
+            }
+        ),
+        std::runtime_error
+    );
+
+    // Assert
+    EXPECT_FALSE(enabledInside);
+    EXPECT_TRUE(Part::ParallelPolicy::getSettings() == before);
+}
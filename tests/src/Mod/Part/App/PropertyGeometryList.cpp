@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <Base/Reader.h>
+#include <Base/Writer.h>
+#include "Mod/Part/App/Geometry.h"
+#include "Mod/Part/App/PropertyGeometryList.h"
+#include <src/App/InitApplication.h>
+#include "PartTestHelpers.h"
+
+using namespace Part;
+
+class PropertyGeometryListTest: public ::testing::Test, public PartTestHelpers::PartTestHelperClass
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        createTestDoc();
+        std::vector<Geometry*> geometries;
+        geometries.push_back(new GeomPoint(Base::Vector3d(1, 2, 0)));
+        geometries.push_back(new GeomLineSegment());
+        static_cast<GeomLineSegment*>(geometries.back())
+            ->setPoints(Base::Vector3d(0, 0, 0), Base::Vector3d(3, 0, 0));
+        geometries.push_back(new GeomArcOfCircle());
+        static_cast<GeomArcOfCircle*>(geometries.back())->setRadius(2.5);
+        static_cast<GeomArcOfCircle*>(geometries.back())->setRange(0.25, 2.0, false);
+        // saved as XML also in the binary format
+        auto hyperbola = new GeomHyperbola();
+        hyperbola->setMajorRadius(3.0);
+        hyperbola->setMinorRadius(1.0);
+        geometries.push_back(hyperbola);
+        _prop.setValues(std::move(geometries));
+    }
+
+    void TearDown() override
+    {}
+
+    PropertyGeometryList _prop;
+};
+
+TEST_F(PropertyGeometryListTest, testCopySharesGeometries)
+{
+    // Act
+    std::unique_ptr<App::Property> copy(_prop.Copy());
+
+    // Assert
+    auto& values = static_cast<PropertyGeometryList*>(copy.get())->getValues();
+    EXPECT_EQ(values, _prop.getValues());
+    EXPECT_TRUE(_prop.isSame(*copy));
+}
+
+TEST_F(PropertyGeometryListTest, testSet1ValueKeepsCopy)
+{
+    // Arrange
+    std::unique_ptr<App::Property> copy(_prop.Copy());
+    Geometry* point = _prop[0];
+
+    // Act
+    _prop.set1Value(1, std::make_unique<GeomPoint>(Base::Vector3d(5, 5, 0)));
+
+    // Assert
+    auto& values = static_cast<PropertyGeometryList*>(copy.get())->getValues();
+    EXPECT_EQ(values[1]->getTypeId(), GeomLineSegment::getClassTypeId());
+    EXPECT_EQ(_prop[0], point);
+    EXPECT_EQ(_prop.getTouchList(), std::set<int> {1});
+    EXPECT_FALSE(_prop.isSame(*copy));
+}
+
+TEST_F(PropertyGeometryListTest, testMoveValuesKeepsUnchanged)
+{
+    // Arrange
+    std::vector<Geometry*> geometries;
+    for (auto geom : _prop.getValues()) {
+        geometries.push_back(geom->clone());
+    }
+    delete geometries[0];
+    geometries[0] = new GeomPoint(Base::Vector3d(7, 8, 0));
+    PropertyGeometryList other;
+    other.setValues(std::move(geometries));
+    Geometry* line = _prop[1];
+
+    // Act
+    _prop.moveValues(std::move(other));
+
+    // Assert
+    EXPECT_EQ(_prop[1], line);
+    EXPECT_EQ(_prop.getTouchList(), std::set<int> {0});
+    EXPECT_EQ(static_cast<GeomPoint*>(_prop[0])->getPoint(), Base::Vector3d(7, 8, 0));
+}
+
+TEST_F(PropertyGeometryListTest, testBinaryRoundTrip)
+{
+    // Arrange
+    Base::StringWriter writer;
+    writer.setMode("BinaryGeometry");
+    _prop.Save(writer);
+    Base::StringWriter binaryWriter;
+    _prop.SaveDocFile(binaryWriter);
+    std::string str = "<?xml version='1.0' encoding='utf-8'?>\n";
+    str.append(writer.getString());
+    std::stringstream data(str);
+    std::istringstream binary(binaryWriter.getString());
+    Base::XMLReader reader("Document.xml", data);
+    Base::Reader binaryReader(binary, "Geometry.bin", 1);
+    PropertyGeometryList restored;
+
+    // Act
+    restored.Restore(reader);
+    restored.RestoreDocFile(binaryReader);
+
+    // Assert
+    EXPECT_NE(str.find("binary=\"1\""), std::string::npos);
+    EXPECT_TRUE(restored.isSame(_prop));
+}
@@ -3,6 +3,9 @@
 #include <gtest/gtest.h>
 
 #include <BRepFilletAPI_MakeFillet.hxx>
+#include <App/Application.h>
+#include <Base/FileInfo.h>
+#include <Base/Reader.h>
 #include "Mod/Part/App/FeaturePartCommon.h"
 #include "Mod/Part/App/PropertyTopoShape.h"
 #include <src/App/InitApplication.h>
@@ -269,3 +272,74 @@ TEST_F(PropertyTopoShapeTest, testRestore)
     EXPECT_TRUE(reader.isValid());
     EXPECT_TRUE(reader.isEndOfElement());
 }
+
+TEST_F(PropertyTopoShapeTest, testSharedShapeStorage)
+{
+    // Arrange
+    _boxes[0]->execute();
+    auto copy = _doc->addObject<Part::Feature>();
+    copy->Shape.setValue(_boxes[0]->Shape.getValue());
+    _doc->Meta.setValue("SaveSharedBrep", "1");
+    Base::FileInfo fi(App::Application::getTempFileName("shared.FCStd"));
+
+    // Act
+    ASSERT_TRUE(_doc->saveCopy(fi.filePath().c_str()));
+    auto doc = App::GetApplication().openDocument(fi.filePath().c_str());
+
+    // Assert
+    ASSERT_NE(doc, nullptr);
+    auto box = freecad_cast<Part::Feature*>(doc->getObject(_boxes[0]->getNameInDocument()));
+    auto restored = freecad_cast<Part::Feature*>(doc->getObject(copy->getNameInDocument()));
+    ASSERT_NE(box, nullptr);
+    ASSERT_NE(restored, nullptr);
+    EXPECT_FALSE(box->Shape.getValue().IsNull());
+    // Both features share the same shape data again after loading
+    EXPECT_TRUE(box->Shape.getValue().IsSame(restored->Shape.getValue()));
+
+    App::GetApplication().closeDocument(doc->getName());
+    fi.deleteFile();
+}
+
+TEST_F(PropertyTopoShapeTest, testRestoreSharesIdenticalShapes)
+{
+    // Arrange
+    _boxes[0]->execute();
+    std::ostringstream brep;
+    _boxes[0]->Shape.getShape().exportBrep(brep);
+    std::istringstream first(brep.str());
+    std::istringstream second(brep.str());
+    Base::Reader firstReader(first, "First.Shape.brp", 1);
+    Base::Reader secondReader(second, "Second.Shape.brp", 1);
+    Part::PropertyPartShape firstProp;
+    Part::PropertyPartShape secondProp;
+
+    // Act
+    firstProp.RestoreDocFile(firstReader);
+    secondProp.RestoreDocFile(secondReader);
+
+    // Assert
+    EXPECT_FALSE(firstProp.getValue().IsNull());
+    EXPECT_TRUE(firstProp.getValue().IsSame(secondProp.getValue()));
+}
+
+TEST_F(PropertyTopoShapeTest, testCopyObjectSharesShape)
+{
+    // Arrange
+    _common->execute();
+
+    // Act
+    auto copies = _doc->copyObject({_common});
+
+    // Assert
+    ASSERT_EQ(copies.size(), 1);
+    auto copy = freecad_cast<Part::Feature*>(copies[0]);
+    ASSERT_NE(copy, nullptr);
+    EXPECT_NE(copy, _common);
+    EXPECT_FALSE(copy->Shape.getValue().IsNull());
+    // The copy shares the shape data instead of parsing a serialized one
+    EXPECT_TRUE(copy->Shape.getValue().IsSame(_common->Shape.getValue()));
+    // Links of the copy still refer to the same objects
+    auto copyCommon = freecad_cast<Common*>(copy);
+    ASSERT_NE(copyCommon, nullptr);
+    EXPECT_EQ(copyCommon->Base.getValue(), _boxes[0]);
+}
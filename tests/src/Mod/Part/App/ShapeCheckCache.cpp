@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <Mod/Part/App/ShapeCheckCache.h>
+#include <Mod/Part/App/TopoShape.h>
+
+#include <BRep_Builder.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <gp_Trsf.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+
+using Part::ShapeCheckCache::Validity;
+
+class ShapeCheckCacheTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        Part::ShapeCheckCache::clear();
+    }
+
+    void TearDown() override
+    {
+        Part::ShapeCheckCache::clear();
+    }
+};
+
+TEST_F(ShapeCheckCacheTest, validityIsSharedByLocatedCopies)
+{
+    // Arrange
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+    gp_Trsf trsf;
+    trsf.SetTranslation(gp_Vec(10.0, 0.0, 0.0));
+    TopoDS_Shape moved = box.Moved(TopLoc_Location(trsf));
+
+    // Act
+    bool valid = Part::TopoShape(box).isValid();
+
+    // Assert
+    EXPECT_TRUE(valid);
+    EXPECT_EQ(Part::ShapeCheckCache::size(), 1U);
+    EXPECT_EQ(Part::ShapeCheckCache::getValidity(moved), Validity::Valid);
+    EXPECT_EQ(Part::ShapeCheckCache::getValidity(moved.Reversed()), Validity::Valid);
+}
+
+TEST_F(ShapeCheckCacheTest, modifiedShapeIsCheckedAgain)
+{
+    // Arrange
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+    Part::ShapeCheckCache::setValidity(box, true);
+    TopExp_Explorer xp(box, TopAbs_VERTEX);
+
+    // Act
+    BRep_Builder().UpdateVertex(TopoDS::Vertex(xp.Current()), 0.5);
+
+    // Assert
+    EXPECT_EQ(Part::ShapeCheckCache::getValidity(box), Validity::Unknown);
+    EXPECT_EQ(Part::ShapeCheckCache::size(), 0U);
+}
+
+TEST_F(ShapeCheckCacheTest, fixIsSkippedForFixedShapes)
+{
+    // Arrange
+    Part::TopoShape box(BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape());
+
+    // Act
+    bool changed = box.fix();
+
+    // Assert
+    EXPECT_FALSE(changed);
+    EXPECT_TRUE(Part::ShapeCheckCache::isFixed(box.getShape()));
+    EXPECT_FALSE(box.fix());
+    Part::ShapeCheckCache::invalidate(box.getShape());
+    EXPECT_FALSE(Part::ShapeCheckCache::isFixed(box.getShape()));
+}
@@ -0,0 +1,155 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <Mod/Part/App/TessellationCache.h>
+
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepTools.hxx>
+#include <BRep_Tool.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Shape.hxx>
+#include <gp_Trsf.hxx>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+class TessellationCacheTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        Part::TessellationCache::instance().clear();
+        params.deflection = 0.1;
+        params.angularDeflection = 0.5;
+    }
+
+    void TearDown() override
+    {
+        Part::TessellationCache::instance().clear();
+    }
+
+    static Handle(Poly_Triangulation) firstTriangulation(const TopoDS_Shape& shape)
+    {
+        TopExp_Explorer xp(shape, TopAbs_FACE);
+        TopLoc_Location loc;
+        return BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc);
+    }
+
+    Part::TessellationCache::Parameters params;
+};
+
+TEST_F(TessellationCacheTest, meshOnce)
+{
+    // Arrange
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(10.0, 10.0, 10.0).Shape();
+    auto& cache = Part::TessellationCache::instance();
+
+    // Act
+    bool first = cache.mesh(box, params);
+    Handle(Poly_Triangulation) mesh = firstTriangulation(box);
+    bool second = cache.mesh(box, params);
+
+    // Assert
+    EXPECT_TRUE(first);
+    EXPECT_FALSE(second);
+    EXPECT_TRUE(cache.isMeshed(box, params));
+    EXPECT_TRUE(Part::TessellationCache::hasTriangulation(box));
+    EXPECT_EQ(mesh, firstTriangulation(box));
+    EXPECT_EQ(cache.size(), 1U);
+}
+
+TEST_F(TessellationCacheTest, sharedByCopies)
+{
+    // Arrange
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(10.0, 10.0, 10.0).Shape();
+    TopoDS_Shape copy = box;
+    gp_Trsf trsf;
+    trsf.SetTranslation(gp_Vec(5.0, 0.0, 0.0));
+    copy.Move(TopLoc_Location(trsf));
+    auto& cache = Part::TessellationCache::instance();
+
+    // Act
+    cache.mesh(box, params);
+
+    // Assert
+    EXPECT_TRUE(cache.isMeshed(copy, params));
+    EXPECT_FALSE(cache.mesh(copy, params));
+}
+
+TEST_F(TessellationCacheTest, otherParameters)
+{
+    // Arrange
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(10.0, 10.0, 10.0).Shape();
+    auto& cache = Part::TessellationCache::instance();
+    Part::TessellationCache::Parameters finer = params;
+    finer.deflection = 0.01;
+
+    // Act
+    cache.mesh(box, params);
+
+    // Assert
+    EXPECT_TRUE(cache.isMeshed(box));
+    EXPECT_FALSE(cache.isMeshed(box, finer));
+    EXPECT_TRUE(cache.mesh(box, finer));
+    EXPECT_TRUE(cache.isMeshed(box, finer));
+    EXPECT_FALSE(cache.isMeshed(box, params));
+}
+
+TEST_F(TessellationCacheTest, invalidatedByClean)
+{
+    // Arrange
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(10.0, 10.0, 10.0).Shape();
+    auto& cache = Part::TessellationCache::instance();
+    cache.mesh(box, params);
+
+    // Act
+    BRepTools::Clean(box);
+
+    // Assert
+    EXPECT_FALSE(Part::TessellationCache::hasTriangulation(box));
+    EXPECT_FALSE(cache.isMeshed(box, params));
+    EXPECT_TRUE(cache.mesh(box, params));
+}
+
+TEST_F(TessellationCacheTest, remove)
+{
+    // Arrange
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(10.0, 10.0, 10.0).Shape();
+    auto& cache = Part::TessellationCache::instance();
+    cache.mesh(box, params);
+
+    // Act
+    cache.remove(box);
+
+    // Assert
+    EXPECT_EQ(cache.size(), 0U);
+    EXPECT_FALSE(cache.isMeshed(box));
+    EXPECT_TRUE(Part::TessellationCache::hasTriangulation(box));
+}
+
+TEST_F(TessellationCacheTest, meshBatch)
+{
+    // Arrange
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(10.0, 10.0, 10.0).Shape();
+    TopoDS_Shape other = BRepPrimAPI_MakeBox(5.0, 5.0, 5.0).Shape();
+    TopoDS_Shape copy = box;
+    gp_Trsf trsf;
+    trsf.SetTranslation(gp_Vec(20.0, 0.0, 0.0));
+    copy.Move(TopLoc_Location(trsf));
+    auto& cache = Part::TessellationCache::instance();
+    cache.mesh(other, params);
+    Handle(Poly_Triangulation) otherMesh = firstTriangulation(other);
+
+    // Act
+    std::size_t count = cache.mesh({{box, params}, {copy, params}, {other, params}});
+
+    // Assert
+    EXPECT_EQ(count, 1U);
+    EXPECT_TRUE(cache.isMeshed(box, params));
+    EXPECT_TRUE(cache.isMeshed(copy, params));
+    EXPECT_EQ(otherMesh, firstTriangulation(other));
+    EXPECT_EQ(cache.mesh({{box, params}, {other, params}}), 0U);
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
@@ -289,4 +289,27 @@ TEST_F(TopoShapeCacheTest, FindAncestor)
     EXPECT_FALSE(ancestorResultCompound.IsNull());
 }
 
+TEST_F(TopoShapeCacheTest, IndependentCachesShareSubShapeIndex)
+{
+    // Arrange
+    const auto [shape, ancestors] = CreateFusedCubes();
+    auto transform = gp_Trsf();
+    transform.SetTranslation(gp_Pnt(0.0, 0.0, 0.0), gp_Pnt(0.0, 0.0, 5.0));
+    auto moved = shape.Moved(TopLoc_Location(transform));
+    Part::TopoShapeCache cache1(shape);
+    Part::TopoShapeCache cache2(moved);
+
+    // Act
+    int count1 = cache1.countShape(TopAbs_FACE);
+    int count2 = cache2.countShape(TopAbs_FACE);
+    auto face = cache2.findShape(moved, TopAbs_FACE, 3);
+
+    // Assert
+    EXPECT_EQ(count1, count2);
+    EXPECT_EQ(cache1.getAncestry(TopAbs_FACE).shapes, cache2.getAncestry(TopAbs_FACE).shapes);
+    EXPECT_TRUE(face.Location().IsEqual(moved.Location()));
+    EXPECT_EQ(cache1.findShape(moved, face), 3);
+    EXPECT_EQ(cache2.findShape(moved, face), 3);
+}
+
 // NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
@@ -152,6 +152,35 @@ TEST_F(TopoShapeExpansionTest, makeElementCompoundTwoShapesGeneratesMap)
     EXPECT_EQ(elements[IndexedName("Vertex", 4)], MappedName("Vertex2;:H3,V"));
 }
 
+TEST_F(TopoShapeExpansionTest, makeElementCompoundManyShapesGeneratesMap)
+{
+    // Arrange enough independent children to build their sub-shape indices in parallel
+    const int childCount = 40;
+    std::vector<TopoShape> shapes;
+    for (int i = 0; i < childCount; ++i) {
+        auto edge = BRepBuilderAPI_MakeEdge(gp_Pnt(i, 0.0, 0.0), gp_Pnt(i + 1.0, 1.0, 0.0)).Edge();
+        shapes.emplace_back(edge, i + 2L);
+    }
+    TopoShape topoShape {1L};
+    // Act
+    topoShape.makeElementCompound(shapes);
+    auto elements = elementMap((topoShape));
+    // Assert map is correct
+    EXPECT_EQ(elements.size(), childCount * 3);
+    for (int i = 0; i < childCount; ++i) {
+        std::ostringstream tag;
+        tag << std::hex << i + 2;
+        EXPECT_EQ(
+            elements[IndexedName("Edge", i + 1)],
+            MappedName("Edge1;:H" + tag.str() + ",E")
+        );
+        EXPECT_EQ(
+            elements[IndexedName("Vertex", 2 * i + 1)],
+            MappedName("Vertex1;:H" + tag.str() + ",V")
+        );
+    }
+}
+
 TEST_F(TopoShapeExpansionTest, makeElementCompoundTwoCubes)
 {
     auto [cube1TS, cube2TS] = CreateTwoTopoShapeCubes();
@@ -1493,6 +1522,52 @@ TEST_F(TopoShapeExpansionTest, makeElementBooleanCut)
     ));
 }
 
+TEST_F(TopoShapeExpansionTest, makeElementBooleanCutSkipsDistantTools)
+{
+    // Arrange
+    auto [cube1, cube2] = CreateTwoCubes();
+    auto [cube3, cube4] = CreateTwoCubes();
+    auto tr {gp_Trsf()};
+    tr.SetTranslation(gp_Vec(gp_XYZ(-0.5, -0.5, 0)));
+    cube2.Move(TopLoc_Location(tr));
+    tr.SetTranslation(gp_Vec(gp_XYZ(5, 5, 5)));
+    cube3.Move(TopLoc_Location(tr));
+    TopoShape topoShape1 {cube1, 1L};
+    TopoShape topoShape2 {cube2, 2L};
+    TopoShape topoShape3 {cube3, 3L};
+    TopoShape expected {0L};
+    TopoShape result {0L};
+    // Act
+    expected.makeElementBoolean(Part::OpCodes::Cut, {topoShape1, topoShape2});
+    result.makeElementBoolean(Part::OpCodes::Cut, {topoShape1, topoShape2, topoShape3});
+    // Assert the distant tool makes no difference
+    EXPECT_FLOAT_EQ(getVolume(result.getShape()), 0.75);
+    EXPECT_EQ(elementMap(result), elementMap(expected));
+}
+
+TEST_F(TopoShapeExpansionTest, makeElementBooleanFusePassesIsolatedShapes)
+{
+    // Arrange
+    auto [cube1, cube2] = CreateTwoCubes();
+    auto [cube3, cube4] = CreateTwoCubes();
+    auto tr {gp_Trsf()};
+    tr.SetTranslation(gp_Vec(gp_XYZ(-0.5, -0.5, 0)));
+    cube2.Move(TopLoc_Location(tr));
+    tr.SetTranslation(gp_Vec(gp_XYZ(5, 5, 5)));
+    cube3.Move(TopLoc_Location(tr));
+    TopoShape topoShape1 {cube1, 1L};
+    TopoShape topoShape2 {cube2, 2L};
+    TopoShape topoShape3 {cube3, 3L};
+    TopoShape result {0L};
+    // Act
+    result.makeElementBoolean(Part::OpCodes::Fuse, {topoShape1, topoShape2, topoShape3});
+    // Assert
+    EXPECT_FLOAT_EQ(getVolume(result.getShape()), 2.75);
+    EXPECT_EQ(result.countSubShapes(TopAbs_SOLID), 2);
+    // Assert names of both the fused and the passed through solid are kept
+    EXPECT_EQ(elementMap(result).size(), 66 + 26);
+}
+
 TEST_F(TopoShapeExpansionTest, makeElementBooleanFuse)
 {
     // Arrange
@@ -2063,6 +2138,38 @@ TEST_F(TopoShapeExpansionTest, makeElementFuse)
     ));
 }
 
+TEST_F(TopoShapeExpansionTest, makeElementFuseLazyElementMap)
+{
+    // Arrange
+    auto [cube1, cube2] = CreateTwoCubes();
+    auto tr {gp_Trsf()};
+    tr.SetTranslation(gp_Vec(gp_XYZ(-0.5, -0.5, 0)));
+    cube2.Move(TopLoc_Location(tr));
+    TopoShape topoShape1 {cube1, 1L};
+    TopoShape topoShape2 {cube2, 2L};
+    TopoShape eager {0L};
+    TopoShape lazy {0L};
+    // Act
+    eager.makeElementFuse({topoShape1, topoShape2});
+    {
+        TopoShape::LazyElementMap lazyElementMap;
+        lazy.makeElementFuse({topoShape1, topoShape2});
+    }
+    // Assert nothing is generated until the names are asked for
+    EXPECT_FALSE(lazy.elementMap(false));
+    EXPECT_TRUE(lazy.hasPendingElementMap());
+    EXPECT_FALSE(TopoShape::LazyElementMap::isEnabled());
+    // Assert the deferred map matches the eager one
+    auto eagerElements = eager.getElementMap();
+    auto lazyElements = lazy.getElementMap();
+    ASSERT_EQ(lazyElements.size(), eagerElements.size());
+    EXPECT_EQ(lazyElements.size(), 66);
+    for (const auto& element : eagerElements) {
+        EXPECT_EQ(lazy.getMappedName(element.index), element.name);
+    }
+    EXPECT_FALSE(lazy.hasPendingElementMap());
+}
+
 TEST_F(TopoShapeExpansionTest, makeElementCut)
 {
     // Arrange
@@ -2127,6 +2234,53 @@ TEST_F(TopoShapeExpansionTest, makeElementCut)
     ));
 }
 
+TEST_F(TopoShapeExpansionTest, makeElementBatchBooleanCutManyTools)
+{
+    // Arrange
+    auto [cube1, cube2] = CreateTwoCubes();
+    auto [cube3, cube4] = CreateTwoCubes();
+    auto tr {gp_Trsf()};
+    tr.SetTranslation(gp_Vec(gp_XYZ(-0.5, -0.5, 0)));
+    cube2.Move(TopLoc_Location(tr));
+    tr.SetTranslation(gp_Vec(gp_XYZ(0.5, 0.5, 0)));
+    cube3.Move(TopLoc_Location(tr));
+    TopoShape plate {cube1, 1L};
+    TopoShape tool1 {cube2, 2L};
+    TopoShape tool2 {cube3, 3L};
+    TopoShape result {0L};
+    // Act
+    result.makeElementBatchBoolean(Part::OpCodes::Cut, {plate, tool1, tool2});
+    auto elements = elementMap(result);
+    // Assert both tools are removed in the one run
+    EXPECT_FLOAT_EQ(getVolume(result.getShape()), 0.5);
+    EXPECT_EQ(result.countSubShapes(TopAbs_SOLID), 1);
+    // Assert the history is kept in the element map
+    EXPECT_EQ(elements.size(), result.countSubElements("Face") + result.countSubElements("Edge")
+                  + result.countSubElements("Vertex"));
+    EXPECT_EQ(elements.count(IndexedName("Face", 1)), 1);
+}
+
+TEST_F(TopoShapeExpansionTest, makeElementBatchBooleanCommonOfAll)
+{
+    // Arrange
+    auto [cube1, cube2] = CreateTwoCubes();
+    auto [cube3, cube4] = CreateTwoCubes();
+    auto tr {gp_Trsf()};
+    tr.SetTranslation(gp_Vec(gp_XYZ(-0.5, -0.5, 0)));
+    cube2.Move(TopLoc_Location(tr));
+    tr.SetTranslation(gp_Vec(gp_XYZ(-0.25, -0.25, 0)));
+    cube3.Move(TopLoc_Location(tr));
+    TopoShape topoShape1 {cube1, 1L};
+    TopoShape topoShape2 {cube2, 2L};
+    TopoShape topoShape3 {cube3, 3L};
+    TopoShape result {0L};
+    // Act
+    result.makeElementBatchBoolean(Part::OpCodes::Common, {topoShape1, topoShape2, topoShape3});
+    // Assert the result is inside all three cubes
+    EXPECT_FLOAT_EQ(getVolume(result.getShape()), 0.25);
+    EXPECT_FALSE(elementMap(result).empty());
+}
+
 TEST_F(TopoShapeExpansionTest, makeElementChamfer)
 {
     // Arrange
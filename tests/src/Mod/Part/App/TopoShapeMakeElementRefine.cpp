@@ -2,6 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <gp_Pnt.hxx>
+
 #include <src/App/InitApplication.h>
 
 #include "PartTestHelpers.h"
@@ -54,3 +57,25 @@ TEST_F(FeaturePartMakeElementRefineTest, makeElementRefineBoxes)
     // TODO: Refine doesn't work on compounds, so we're going to need a binary operation or the
     // like, and those don't exist yet.  Once they do, this test can be expanded
 }
+
+TEST_F(FeaturePartMakeElementRefineTest, makeElementIncrementalRefineBoxes)
+{
+    // Arrange
+    auto box1 = Part::TopoShape(BRepPrimAPI_MakeBox(gp_Pnt(0, 0, 0), 1.0, 1.0, 1.0).Shape(), 1);
+    auto box2 = Part::TopoShape(BRepPrimAPI_MakeBox(gp_Pnt(1, 0, 0), 1.0, 1.0, 1.0).Shape(), 2);
+    auto box3 = Part::TopoShape(BRepPrimAPI_MakeBox(gp_Pnt(2, 0, 0), 1.0, 1.0, 1.0).Shape(), 3);
+    Part::TopoShape base = box1.makeElementFuse(box2).makeElementRefine();
+    Part::TopoShape fused = base.makeElementFuse(box3);
+    // Act
+    Part::TopoShape refined = fused.makeElementIncrementalRefine(base);
+    Part::TopoShape fullyRefined = fused.makeElementRefine();
+    Part::TopoShape untouched = base.makeElementIncrementalRefine(base);
+    // Assert
+    EXPECT_EQ(base.countSubElements("Face"), 6);
+    EXPECT_EQ(fused.countSubElements("Face"), 10);
+    EXPECT_DOUBLE_EQ(PartTestHelpers::getVolume(refined.getShape()), 3.0);
+    EXPECT_EQ(refined.countSubElements("Face"), fullyRefined.countSubElements("Face"));
+    EXPECT_EQ(refined.countSubElements("Face"), 6);
+    EXPECT_EQ(refined.countSubElements("Edge"), 12);
+    EXPECT_EQ(untouched.countSubElements("Face"), 6);  // Nothing to do without changed faces
+}
@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <Base/Exception.h>
+#include <Mod/Points/App/ChunkedReader.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+using namespace Points::ChunkedReader;
+
+namespace
+{
+double parse(const std::string& str, std::size_t& length)
+{
+    double value = -1.0;
+    const char* end = parseNumber(str.data(), str.data() + str.size(), value);
+    length = end ? std::size_t(end - str.data()) : std::string::npos;
+    return value;
+}
+}  // namespace
+
+TEST(ChunkedReader, testParseNumber)
+{
+    std::size_t len {};
+    EXPECT_EQ(parse("42", len), 42.0);
+    EXPECT_EQ(len, 2);
+    EXPECT_EQ(parse("-1.5 7", len), -1.5);
+    EXPECT_EQ(len, 4);
+    EXPECT_EQ(parse("+.25", len), 0.25);
+    EXPECT_EQ(parse("3.", len), 3.0);
+    EXPECT_EQ(len, 2);
+    EXPECT_EQ(parse("1e3", len), 1000.0);
+    EXPECT_EQ(parse("2.5E-2", len), 0.025);
+    EXPECT_EQ(parse("0.1", len), 0.1);
+    EXPECT_EQ(parse("0.000123", len), 0.000123);
+    // exponent without digits is not part of the number
+    EXPECT_EQ(parse("7e", len), 7.0);
+    EXPECT_EQ(len, 1);
+}
+
+TEST(ChunkedReader, testParseNumberRounding)
+{
+    std::size_t len {};
+    // outside of the exact range
+    EXPECT_EQ(parse("1.7976931348623157e308", len), 1.7976931348623157e308);
+    EXPECT_EQ(parse("4.9406564584124654e-324", len), 4.9406564584124654e-324);
+    EXPECT_EQ(parse("3.14159265358979323846264338", len), 3.14159265358979323846264338);
+    EXPECT_EQ(parse("123456789012345678901234", len), 123456789012345678901234.0);
+    EXPECT_EQ(len, 24);
+}
+
+TEST(ChunkedReader, testParseNoNumber)
+{
+    std::size_t len {};
+    parse("abc", len);
+    EXPECT_EQ(len, std::string::npos);
+    parse("-.", len);
+    EXPECT_EQ(len, std::string::npos);
+    parse("", len);
+    EXPECT_EQ(len, std::string::npos);
+}
+
+TEST(ChunkedReader, testSplitLines)
+{
+    std::string text = "1 2 3\n4 5 6\n7 8 9\n10 11 12";
+    std::vector<std::string_view> chunks = splitLines(text, 7);
+    ASSERT_EQ(chunks.size(), 2);
+    EXPECT_EQ(chunks[0], "1 2 3\n4 5 6\n");
+    EXPECT_EQ(chunks[1], "7 8 9\n10 11 12");
+
+    std::string joined;
+    for (auto chunk : splitLines(text, 1)) {
+        EXPECT_TRUE(chunk.back() == '\n' || chunk.back() == '2');
+        joined += chunk;
+    }
+    EXPECT_EQ(joined, text);
+}
+
+TEST(ChunkedReader, testReadAsciiTable)
+{
+    std::string text = "3 0 1 2\n\n1 2 3\r\n  4 5\n6 7 8 9\n10 11 12\n";
+    std::vector<double> table(9, -1.0);
+    std::size_t rows = readAsciiTable(text, 1, 3, 3, table.data(), 3, 1);
+    EXPECT_EQ(rows, 3);
+    std::vector<double> expected {1, 2, 3, 4, 5, 0, 6, 7, 8};
+    EXPECT_EQ(table, expected);
+}
+
+TEST(ChunkedReader, testReadAsciiTableColumnMajor)
+{
+    std::string text = "1 2\n3 4\n";
+    std::vector<double> table(6, -1.0);
+    std::size_t rows = readAsciiTable(text, 0, 2, 3, table.data(), 1, 3);
+    EXPECT_EQ(rows, 2);
+    std::vector<double> expected {1, 3, -1, 2, 4, -1};
+    EXPECT_EQ(table, expected);
+}
+
+TEST(ChunkedReader, testReadAsciiTableInvalid)
+{
+    std::string text = "1 2 3\n4 x 6\n";
+    std::vector<double> table(6);
+    EXPECT_THROW(readAsciiTable(text, 0, 3, 2, table.data(), 3, 1), Base::BadFormatError);
+}
+
+TEST(ChunkedReader, testReadBinaryTable)
+{
+    std::string bytes;
+    float x = 1.5F;
+    std::uint8_t c = 200;
+    std::int16_t s = -7;
+    for (int i = 0; i < 2; i++) {
+        bytes.append(reinterpret_cast<const char*>(&x), sizeof(x));
+        bytes.append(reinterpret_cast<const char*>(&c), sizeof(c));
+        bytes.append(reinterpret_cast<const char*>(&s), sizeof(s));
+        x += 1.0F;
+    }
+
+    std::vector<ScalarType> types {ScalarType::Float32, ScalarType::UInt8, ScalarType::Int16};
+    bool bigEndian = (std::endian::native == std::endian::big);
+    std::vector<double> table(6);
+    readBinaryTable(bytes, types, bigEndian, false, 2, table.data(), 3, 1);
+    std::vector<double> expected {1.5, 200, -7, 2.5, 200, -7};
+    EXPECT_EQ(table, expected);
+
+    EXPECT_THROW(
+        readBinaryTable(bytes, types, bigEndian, false, 3, table.data(), 3, 1),
+        Base::BadFormatError
+    );
+}
+
+TEST(ChunkedReader, testReadBinaryTableSwapped)
+{
+    std::string bytes(4, '\0');
+    std::uint32_t value = 0x01020304;
+    std::memcpy(bytes.data(), &value, sizeof(value));
+    std::ranges::reverse(bytes);
+
+    bool bigEndian = (std::endian::native != std::endian::big);
+    double result {};
+    readBinaryTable(bytes, {ScalarType::UInt32}, bigEndian, false, 1, &result, 1, 1);
+    EXPECT_EQ(result, double(0x01020304));
+}
+
+TEST(ChunkedReader, testReadBinaryTableFieldMajor)
+{
+    std::vector<std::int32_t> values {1, 2, 3, 10, 20, 30};
+    std::string bytes(
+        reinterpret_cast<const char*>(values.data()),
+        values.size() * sizeof(std::int32_t)
+    );
+
+    std::vector<ScalarType> types {ScalarType::Int32, ScalarType::Int32};
+    bool bigEndian = (std::endian::native == std::endian::big);
+    std::vector<double> table(6);
+    readBinaryTable(bytes, types, bigEndian, true, 3, table.data(), 2, 1);
+    std::vector<double> expected {1, 10, 2, 20, 3, 30};
+    EXPECT_EQ(table, expected);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
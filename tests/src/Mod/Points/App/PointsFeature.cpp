@@ -2,7 +2,9 @@
 
 #include "gtest/gtest.h"
 #include <src/App/InitApplication.h>
+#include <memory>
 #include <Mod/Points/App/PointsFeature.h>
+#include <Mod/Points/App/PropertyPointKernel.h>
 
 class PointsFeatureTest: public ::testing::Test
 {
@@ -35,4 +37,34 @@ TEST_F(PointsFeatureTest, getComplexElementTypes)
 
     EXPECT_EQ(types.size(), 0);
 }
+
+TEST_F(PointsFeatureTest, copyIsIndependentOfChanges)
+{
+    Points::PropertyPointKernel prop;
+    Points::PointKernel kernel;
+    kernel.push_back(Base::Vector3d(1, 2, 3));
+    prop.setValue(kernel);
+    const Points::PointKernel* points = &prop.getValue();
+
+    std::unique_ptr<App::Property> copy(prop.Copy());
+    auto& copied = static_cast<Points::PropertyPointKernel&>(*copy);
+    EXPECT_EQ(copied.getValue().size(), 1);
+
+    Points::PointKernel* edit = prop.startEditing();
+    edit->push_back(Base::Vector3d(4, 5, 6));
+    prop.finishEditing();
+
+    // the property keeps its kernel while the copy keeps the previous content
+    EXPECT_EQ(&prop.getValue(), points);
+    EXPECT_EQ(prop.getValue().size(), 2);
+    EXPECT_EQ(copied.getValue().size(), 1);
+
+    prop.Paste(copied);
+    EXPECT_EQ(&prop.getValue(), points);
+    EXPECT_EQ(prop.getValue().size(), 1);
+
+    copied.setValue(kernel);
+    copied.transformGeometry(Base::Matrix4D());
+    EXPECT_EQ(prop.getValue().getPoint(0), Base::Vector3d(1, 2, 3));
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
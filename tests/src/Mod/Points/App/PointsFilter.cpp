@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <Mod/Points/App/PointsFilter.h>
+#include <cmath>
+#include <limits>
+#include <random>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class PointsFilterTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a grid of 100 x 100 points with the spacing 0.1 on the xy plane
+        for (int i = 0; i < 100; i++) {
+            for (int j = 0; j < 100; j++) {
+                cloud.points.emplace_back(0.1F * float(i) + 0.05F, 0.1F * float(j) + 0.05F, 0.0F);
+                cloud.intensity.push_back(float(i));
+            }
+        }
+    }
+
+    Points::PointCloud cloud;
+};
+
+TEST_F(PointsFilterTest, testVoxelDownsample)
+{
+    cloud.points.emplace_back(std::numeric_limits<float>::quiet_NaN(), 0.0F, 0.0F);
+    cloud.intensity.push_back(0.0F);
+    // the grid starts at the first point, keep the points off the voxel boundaries
+    Points::PointCloud result = Points::PointsFilter::voxelDownsample(cloud, 0.999F);
+
+    // 10 x 10 voxels of 10 x 10 points each
+    ASSERT_EQ(result.points.size(), 100);
+    ASSERT_EQ(result.intensity.size(), 100);
+    EXPECT_TRUE(result.normals.empty());
+    for (std::size_t i = 0; i < result.points.size(); i++) {
+        const Base::Vector3f& pnt = result.points[i];
+        EXPECT_NEAR(std::fmod(pnt.x, 1.0F), 0.5F, 1e-3F);
+        // the intensity is the mean of the points in the voxel
+        EXPECT_NEAR(result.intensity[i], std::floor(pnt.x) * 10.0F + 4.5F, 1e-3F);
+    }
+}
+
+TEST_F(PointsFilterTest, testStatisticalOutliers)
+{
+    cloud.points.emplace_back(5.0F, 5.0F, 3.0F);
+    cloud.points.emplace_back(20.0F, 0.0F, 0.0F);
+    std::vector<std::size_t> inliers =
+        Points::PointsFilter::statisticalInliers(cloud.points, 8, 2.0);
+    ASSERT_EQ(inliers.size(), 10000);
+    EXPECT_EQ(inliers.back(), 9999);
+}
+
+TEST_F(PointsFilterTest, testRadiusOutliers)
+{
+    cloud.points.emplace_back(5.0F, 5.0F, 3.0F);
+    std::vector<std::size_t> inliers = Points::PointsFilter::radiusInliers(cloud.points, 0.15F, 3);
+    ASSERT_EQ(inliers.size(), 10000);
+    EXPECT_EQ(inliers.back(), 9999);
+
+    // the corners only have three neighbours within the radius
+    inliers = Points::PointsFilter::radiusInliers(cloud.points, 0.15F, 4);
+    EXPECT_EQ(inliers.size(), 9996);
+}
+
+TEST_F(PointsFilterTest, testCrop)
+{
+    Base::BoundBox3f box(0.0F, 0.0F, -1.0F, 5.0F, 5.0F, 1.0F);
+    EXPECT_EQ(Points::PointsFilter::cropBox(cloud.points, box, false).size(), 2500);
+    EXPECT_EQ(Points::PointsFilter::cropBox(cloud.points, box, true).size(), 7500);
+
+    Base::Vector3f base(2.5F, 0.0F, 0.0F);
+    Base::Vector3f normal(-1.0F, 0.0F, 0.0F);
+    std::vector<std::size_t> kept =
+        Points::PointsFilter::cropPlane(cloud.points, base, normal, false);
+    EXPECT_EQ(kept.size(), 2500);
+
+    Points::PointCloud result = cloud.select(kept);
+    ASSERT_EQ(result.intensity.size(), 2500);
+    EXPECT_EQ(result.intensity.back(), 24.0F);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
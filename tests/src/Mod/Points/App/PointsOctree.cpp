@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <Mod/Points/App/PointsOctree.h>
+#include <cmath>
+#include <limits>
+#include <random>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class PointsOctreeTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        std::mt19937 gen(7);
+        std::uniform_real_distribution<float> dist(0.0F, 1.0F);
+        for (int i = 0; i < 50000; i++) {
+            points.emplace_back(dist(gen), dist(gen), 0.1F * dist(gen));
+        }
+        points[10].x = std::numeric_limits<float>::quiet_NaN();
+    }
+
+    std::vector<Base::Vector3f> points;
+};
+
+TEST_F(PointsOctreeTest, testStructure)
+{
+    Points::PointsOctree octree(points, 1000);
+    const auto& nodes = octree.getNodes();
+    const auto& order = octree.getOrder();
+    ASSERT_FALSE(nodes.empty());
+    EXPECT_EQ(octree.countPoints(), points.size() - 1);
+
+    // each valid point is owned by exactly one node that contains it
+    std::vector<int> owned(points.size());
+    std::size_t count = 0;
+    for (const auto& node : nodes) {
+        EXPECT_LE(node.count, 1000);
+        for (std::size_t i = node.begin; i < node.begin + node.count; i++) {
+            EXPECT_TRUE(node.box.IsInBox(points[order[i]]));
+            owned[order[i]]++;
+        }
+        count += node.count;
+    }
+    EXPECT_EQ(count, octree.countPoints());
+    EXPECT_EQ(owned[10], 0);
+    EXPECT_EQ(std::count(owned.begin(), owned.end(), 1), octree.countPoints());
+}
+
+TEST_F(PointsOctreeTest, testSelectCoarse)
+{
+    Points::PointsOctree octree(points, 1000);
+    Points::PointsOctree::View view;
+    view.perspective = false;
+    view.pixelScale = 1.0F;
+
+    // the whole cloud covers a single pixel
+    std::vector<int> nodes = octree.selectNodes(view, 1.0F, points.size());
+    ASSERT_EQ(nodes.size(), 1);
+    EXPECT_EQ(nodes.front(), 0);
+}
+
+TEST_F(PointsOctreeTest, testSelectAll)
+{
+    Points::PointsOctree octree(points, 1000);
+    Points::PointsOctree::View view;
+    view.eye.Set(0.5F, 0.5F, 10.0F);
+    view.pixelScale = 1.0e6F;
+
+    std::vector<int> nodes = octree.selectNodes(view, 1.0F, points.size());
+    EXPECT_EQ(nodes.size(), octree.getNodes().size());
+}
+
+TEST_F(PointsOctreeTest, testSelectBudget)
+{
+    Points::PointsOctree octree(points, 1000);
+    Points::PointsOctree::View view;
+    view.eye.Set(0.5F, 0.5F, 10.0F);
+    view.pixelScale = 1.0e6F;
+
+    std::vector<int> nodes = octree.selectNodes(view, 1.0F, 10000);
+    std::size_t count = 0;
+    for (int index : nodes) {
+        count += octree.getNodes()[index].count;
+    }
+    EXPECT_LE(count, 10000);
+    EXPECT_LT(nodes.size(), octree.getNodes().size());
+}
+
+TEST_F(PointsOctreeTest, testSelectFrustum)
+{
+    Points::PointsOctree octree(points, 1000);
+    Points::PointsOctree::View view;
+    view.perspective = false;
+    view.pixelScale = 1.0e6F;
+    view.planes.emplace_back(Base::Vector3f(1.0F, 0.0F, 0.0F), 0.75F);
+
+    std::vector<int> nodes = octree.selectNodes(view, 1.0F, points.size());
+    ASSERT_FALSE(nodes.empty());
+    for (int index : nodes) {
+        EXPECT_GE(octree.getNodes()[index].box.MaxX, 0.75F);
+    }
+
+    // everything is culled
+    view.planes.emplace_back(Base::Vector3f(-1.0F, 0.0F, 0.0F), 0.0F);
+    EXPECT_TRUE(octree.selectNodes(view, 1.0F, points.size()).empty());
+}
+
+TEST_F(PointsOctreeTest, testCoincidentPoints)
+{
+    std::vector<Base::Vector3f> same(5000, Base::Vector3f(1.0F, 2.0F, 3.0F));
+    Points::PointsOctree octree(same, 100);
+    EXPECT_EQ(octree.getNodes().size(), 1);
+    EXPECT_EQ(octree.getNodes().front().count, same.size());
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,216 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <vector>
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
+#include <Mod/Points/App/Points.h>
+#include <Mod/Points/App/PointsOutOfCore.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class PointsOutOfCoreTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        tmp.setFile(Base::FileInfo::getTempFileName());
+        for (int i = 0; i < 20; i++) {
+            for (int j = 0; j < 20; j++) {
+                for (int k = 0; k < 20; k++) {
+                    points.emplace_back(float(i), float(j), 0.5F * float(k));
+                }
+            }
+        }
+        kernel.setBasicPoints(points);
+    }
+
+    void TearDown() override
+    {
+        tmp.deleteFile();
+    }
+
+    std::vector<Base::Vector3f> readAll(const Points::PointsOutOfCore& store) const
+    {
+        std::vector<Base::Vector3f> all;
+        for (std::size_t i = 0; i < store.countTiles(); i++) {
+            std::vector<Base::Vector3f> tile;
+            store.getTile(i, tile);
+            all.insert(all.end(), tile.begin(), tile.end());
+        }
+        return all;
+    }
+
+    static void sort(std::vector<Base::Vector3f>& pts)
+    {
+        std::ranges::sort(pts, [](const Base::Vector3f& a, const Base::Vector3f& b) {
+            return std::tie(a.x, a.y, a.z) < std::tie(b.x, b.y, b.z);
+        });
+    }
+
+    Base::FileInfo tmp;
+    std::vector<Base::Vector3f> points;
+    Points::PointKernel kernel;
+};
+
+TEST_F(PointsOutOfCoreTest, testCreate)
+{
+    ASSERT_TRUE(Points::PointsOutOfCore::create(kernel, tmp.filePath().c_str(), 500));
+
+    Points::PointsOutOfCore store;
+    ASSERT_TRUE(store.open(tmp.filePath().c_str()));
+    EXPECT_EQ(store.countPoints(), points.size());
+    EXPECT_GE(store.countTiles(), 8);
+
+    std::size_t first = 0;
+    for (std::size_t i = 0; i < store.countTiles(); i++) {
+        const auto& info = store.getTileInfo(i);
+        EXPECT_EQ(info.first, first);
+        EXPECT_GT(info.count, 0);
+        first += info.count;
+
+        std::vector<Base::Vector3f> tile;
+        store.getTile(i, tile);
+        ASSERT_EQ(tile.size(), info.count);
+        for (const auto& pnt : tile) {
+            EXPECT_TRUE(info.box.IsInBox(pnt));
+        }
+    }
+
+    std::vector<Base::Vector3f> all = readAll(store);
+    sort(all);
+    sort(points);
+    EXPECT_EQ(all, points);
+
+    Base::BoundBox3f box = store.getBoundBox();
+    EXPECT_FLOAT_EQ(box.MaxX, 19.0F);
+    EXPECT_FLOAT_EQ(box.MaxZ, 9.5F);
+}
+
+TEST_F(PointsOutOfCoreTest, testGetPoint)
+{
+    ASSERT_TRUE(Points::PointsOutOfCore::create(kernel, tmp.filePath().c_str(), 700));
+
+    Points::PointsOutOfCore store(2);
+    ASSERT_TRUE(store.open(tmp.filePath().c_str()));
+    std::vector<Base::Vector3f> all = readAll(store);
+    for (std::size_t i = 0; i < all.size(); i += 7) {
+        EXPECT_EQ(store.getPoint(i), all[i]);
+    }
+    EXPECT_THROW(store.getPoint(all.size()), Base::IndexError);
+}
+
+TEST_F(PointsOutOfCoreTest, testFindTiles)
+{
+    ASSERT_TRUE(Points::PointsOutOfCore::create(kernel, tmp.filePath().c_str(), 500));
+
+    Points::PointsOutOfCore store;
+    ASSERT_TRUE(store.open(tmp.filePath().c_str()));
+
+    Base::BoundBox3f corner(-1.0F, -1.0F, -1.0F, 2.5F, 2.5F, 1.2F);
+    std::vector<std::size_t> tiles = store.findTiles(corner);
+    EXPECT_LT(tiles.size(), store.countTiles());
+
+    std::size_t inside = 0;
+    for (std::size_t tile : tiles) {
+        std::vector<Base::Vector3f> pts;
+        store.getTile(tile, pts);
+        inside += std::ranges::count_if(pts, [&](const auto& pnt) {
+            return corner.IsInBox(pnt);
+        });
+    }
+    // 3 x 3 x 3 points
+    EXPECT_EQ(inside, 27);
+}
+
+TEST_F(PointsOutOfCoreTest, testSkipNaN)
+{
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    points.emplace_back(nan, 0.0F, 0.0F);
+    kernel.setBasicPoints(points);
+    ASSERT_TRUE(Points::PointsOutOfCore::create(kernel, tmp.filePath().c_str()));
+
+    Points::PointsOutOfCore store;
+    ASSERT_TRUE(store.open(tmp.filePath().c_str()));
+    EXPECT_EQ(store.countPoints(), points.size() - 1);
+    EXPECT_EQ(store.countTiles(), 1);
+}
+
+TEST_F(PointsOutOfCoreTest, testTransform)
+{
+    Base::Matrix4D mat;
+    mat.move(Base::Vector3d(10, 20, 30));
+    kernel.setTransform(mat);
+    ASSERT_TRUE(Points::PointsOutOfCore::create(kernel, tmp.filePath().c_str(), 1000));
+
+    Points::PointsOutOfCore store;
+    ASSERT_TRUE(store.open(tmp.filePath().c_str()));
+    EXPECT_EQ(store.getTransform(), mat);
+
+    Points::PointKernel tile;
+    store.getTile(0, tile);
+    EXPECT_EQ(tile.getTransform(), mat);
+    EXPECT_EQ(tile.size(), store.getTileInfo(0).count);
+}
+
+TEST_F(PointsOutOfCoreTest, testSample)
+{
+    ASSERT_TRUE(Points::PointsOutOfCore::create(kernel, tmp.filePath().c_str(), 500));
+
+    Points::PointsOutOfCore store;
+    ASSERT_TRUE(store.open(tmp.filePath().c_str()));
+
+    Points::PointKernel sample;
+    store.getSample(1000, sample);
+    EXPECT_EQ(sample.size(), 1000);
+    store.getSample(100000, sample);
+    EXPECT_EQ(sample.size(), points.size());
+    store.getSample(0, sample);
+    EXPECT_EQ(sample.size(), 0);
+}
+
+TEST_F(PointsOutOfCoreTest, testCreateFromAscii)
+{
+    Base::FileInfo asc(Base::FileInfo::getTempFileName());
+    {
+        std::ofstream str(asc.filePath());
+        str << "# header\n";
+        for (const auto& pnt : points) {
+            str << pnt.x << " " << pnt.y << " " << pnt.z << "\n";
+        }
+    }
+
+    bool ok = Points::PointsOutOfCore::createFromAscii(
+        asc.filePath().c_str(),
+        tmp.filePath().c_str(),
+        500
+    );
+    asc.deleteFile();
+    ASSERT_TRUE(ok);
+
+    Points::PointsOutOfCore store;
+    ASSERT_TRUE(store.open(tmp.filePath().c_str()));
+    std::vector<Base::Vector3f> all = readAll(store);
+    sort(all);
+    sort(points);
+    EXPECT_EQ(all, points);
+}
+
+TEST_F(PointsOutOfCoreTest, testOpenInvalid)
+{
+    {
+        std::ofstream str(tmp.filePath());
+        str << "no tiles";
+    }
+
+    Points::PointsOutOfCore store;
+    EXPECT_FALSE(store.open(tmp.filePath().c_str()));
+    EXPECT_FALSE(store.isOpen());
+    EXPECT_EQ(store.countPoints(), 0);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -8,7 +8,10 @@
 #include <App/Document.h>
 #include <App/Expression.h>
 #include <App/ObjectIdentifier.h>
+#include <Base/Exception.h>
+#include <Base/Interpreter.h>
 #include <Mod/Part/App/FeaturePartBox.h>
+#include <Mod/Sketcher/App/Constraint.h>
 #include <Mod/Sketcher/App/GeoEnum.h>
 #include <Mod/Sketcher/App/SketchObject.h>
 #include "SketcherTestHelpers.h"
@@ -1210,3 +1213,90 @@ TEST_F(SketchObjectTest, testJoinCurvesWhenTangent)
         = static_cast<const Part::GeomBSplineCurve*>(getObject()->getGeometry(0))->getMultiplicities();
     EXPECT_TRUE(std::all_of(mults.begin(), mults.end(), [](auto mult) { return mult >= 1; }));
 }
+
+TEST_F(SketchObjectTest, testBatchDefersUpdatesUntilClosed)
+{
+    // Arrange
+    getObject()->noRecomputes = true;
+    Part::GeomLineSegment lineSeg;
+    setupLineSegment(lineSeg);
+    int dofBefore = getObject()->getLastDoF();
+
+    // Act
+    {
+        Sketcher::SketchObjectBatch batch(*getObject());
+        int first = getObject()->addGeometry(&lineSeg);
+        int second = getObject()->addGeometry(&lineSeg);
+        auto constr = std::make_unique<Sketcher::Constraint>();
+        constr->Type = Sketcher::Coincident;
+        constr->First = first;
+        constr->FirstPos = Sketcher::PointPos::end;
+        constr->Second = second;
+        constr->SecondPos = Sketcher::PointPos::start;
+        getObject()->addConstraint(std::move(constr));
+
+        // Assert
+        EXPECT_TRUE(getObject()->isBatchOpen());
+        EXPECT_EQ(getObject()->Constraints.getValues().size(), 1U);
+        EXPECT_EQ(getObject()->solve(), 0);
+        EXPECT_EQ(getObject()->getLastDoF(), dofBefore);
+    }
+
+    // Assert
+    EXPECT_FALSE(getObject()->isBatchOpen());
+    EXPECT_EQ(getObject()->Constraints.getValues().size(), 1U);
+    EXPECT_EQ(getObject()->getHighestVertexIndex(), 3);
+    EXPECT_EQ(getObject()->getLastDoF(), 6);
+}
+
+TEST_F(SketchObjectTest, testNestedBatchesUpdateOnce)
+{
+    // Arrange
+    Part::GeomLineSegment lineSeg;
+    setupLineSegment(lineSeg);
+
+    // Act
+    getObject()->openBatch();
+    getObject()->openBatch();
+    getObject()->addGeometry(&lineSeg);
+    getObject()->closeBatch();
+    bool openAfterInner = getObject()->isBatchOpen();
+    getObject()->closeBatch();
+
+    // Assert
+    EXPECT_TRUE(openAfterInner);
+    EXPECT_FALSE(getObject()->isBatchOpen());
+    EXPECT_EQ(getObject()->getHighestVertexIndex(), 1);
+    EXPECT_THROW(getObject()->closeBatch(), Base::RuntimeError);
+}
+
+TEST_F(SketchObjectTest, testPythonBatchNotOpenedOnFailure)
+{
+    // Arrange: registering the close callback of the context fails
+    Base::PyGILStateLocker lock;
+    Base::Interpreter().runString(
+        "import contextlib\n"
+        "class FailingExitStack(contextlib.ExitStack):\n"
+        "    def callback(self, *args):\n"
+        "        raise RuntimeError('callback failed')\n"
+    );
+    Py::Module contextlib(PyImport_ImportModule("contextlib"), true);
+    Py::Object exitStack(contextlib.getAttr("ExitStack"));
+    contextlib.setAttr("ExitStack", Py::Module("__main__").getAttr("FailingExitStack"));
+    Py::Object sketch(getObject()->getPyObject(), true);
+
+    // Act
+    bool failed = false;
+    try {
+        Py::Callable(sketch.getAttr("batch")).apply(Py::Tuple());
+    }
+    catch (Py::Exception& e) {
+        e.clear();
+        failed = true;
+    }
+    contextlib.setAttr("ExitStack", exitStack);
+
+    // Assert
+    EXPECT_TRUE(failed);
+    EXPECT_FALSE(getObject()->isBatchOpen());
+}
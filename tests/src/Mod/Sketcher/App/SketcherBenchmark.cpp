@@ -0,0 +1,277 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+// Solver benchmark over a generated corpus of sketches. It is built as Sketcher_benchmark_run
+// and is not part of the regular test run. Every case is set up (including the diagnosis),
+// solved and dragged with each solver algorithm and QR algorithm, and one line per case is
+// written to the standard output, so results of two builds can be compared directly.
+
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <FCConfig.h>
+
+#include <App/Document.h>
+#include <Base/TimeInfo.h>
+#include <Mod/Part/App/Geometry.h>
+#include <Mod/Sketcher/App/Constraint.h>
+#include <Mod/Sketcher/App/GeoEnum.h>
+#include <Mod/Sketcher/App/Sketch.h>
+#include <Mod/Sketcher/App/SketchObject.h>
+#include "SketcherTestHelpers.h"
+
+namespace
+{
+
+using Geometries = std::vector<std::unique_ptr<Part::Geometry>>;
+using Constraints = std::vector<std::unique_ptr<Sketcher::Constraint>>;
+
+std::unique_ptr<Sketcher::Constraint> makeConstraint(
+    Sketcher::ConstraintType type,
+    int first,
+    Sketcher::PointPos firstPos,
+    int second = Sketcher::GeoEnum::GeoUndef,
+    Sketcher::PointPos secondPos = Sketcher::PointPos::none
+)
+{
+    auto constr = std::make_unique<Sketcher::Constraint>();
+    constr->Type = type;
+    constr->First = first;
+    constr->FirstPos = firstPos;
+    constr->Second = second;
+    constr->SecondPos = secondPos;
+    return constr;
+}
+
+std::unique_ptr<Sketcher::Constraint> makeDistance(
+    Sketcher::ConstraintType type,
+    int first,
+    Sketcher::PointPos firstPos,
+    double value
+)
+{
+    auto constr = makeConstraint(type, first, firstPos);
+    constr->setValue(value);
+    return constr;
+}
+
+// Fully constrained rectangles, the typical hand drawn sketch
+void makeRectangles(int count, Geometries& geos, Constraints& constrs)
+{
+    using Sketcher::PointPos;
+    for (int i = 0; i < count; i++) {
+        double x = 3.0 * (i % 40);
+        double y = 3.0 * (i / 40);
+        int first = int(geos.size());
+        Base::Vector3d corners[] = {
+            {x, y, 0.0},
+            {x + 2.1, y + 0.1, 0.0},
+            {x + 1.9, y + 1.1, 0.0},
+            {x - 0.1, y + 0.9, 0.0},
+        };
+        for (int side = 0; side < 4; side++) {
+            geos.push_back(std::make_unique<Part::GeomLineSegment>());
+            static_cast<Part::GeomLineSegment*>(geos.back().get())
+                ->setPoints(corners[side], corners[(side + 1) % 4]);
+        }
+        for (int side = 0; side < 4; side++) {
+            constrs.push_back(makeConstraint(
+                Sketcher::Coincident,
+                first + side,
+                PointPos::end,
+                first + (side + 1) % 4,
+                PointPos::start
+            ));
+            constrs.push_back(makeConstraint(
+                side % 2 == 0 ? Sketcher::Horizontal : Sketcher::Vertical,
+                first + side,
+                PointPos::none
+            ));
+        }
+        constrs.push_back(makeDistance(Sketcher::DistanceX, first, PointPos::start, x));
+        constrs.push_back(makeDistance(Sketcher::DistanceY, first, PointPos::start, y));
+        constrs.push_back(makeDistance(Sketcher::DistanceX, first, PointPos::none, 2.0));
+        constrs.push_back(makeDistance(Sketcher::DistanceY, first + 1, PointPos::none, 1.0));
+    }
+}
+
+// Polylines only held together by coincidences, as imported from DXF files
+void makePolylines(int count, Geometries& geos, Constraints& constrs)
+{
+    using Sketcher::PointPos;
+    constexpr int segments = 8;
+    for (int i = 0; i < count; i++) {
+        int first = int(geos.size());
+        double y = 2.0 * i;
+        for (int s = 0; s < segments; s++) {
+            geos.push_back(std::make_unique<Part::GeomLineSegment>());
+            static_cast<Part::GeomLineSegment*>(geos.back().get())
+                ->setPoints(
+                    Base::Vector3d(s, y + 0.3 * (s % 2), 0.0),
+                    Base::Vector3d(s + 1.0, y + 0.3 * ((s + 1) % 2), 0.0)
+                );
+            if (s > 0) {
+                constrs.push_back(makeConstraint(
+                    Sketcher::Coincident,
+                    first + s - 1,
+                    PointPos::end,
+                    first + s,
+                    PointPos::start
+                ));
+            }
+        }
+    }
+}
+
+// B-splines, their control polygons are exposed after adding them to the sketch
+void makeBSplines(int count, Geometries& geos, Constraints& /*constrs*/)
+{
+    constexpr int degree = 3;
+    std::vector<double> weights(5, 1.0);
+    std::vector<double> knots = {0.0, 1.0, 2.0};
+    std::vector<int> multiplicities = {degree + 1, 1, degree + 1};
+    for (int i = 0; i < count; i++) {
+        double x = 2.0 * i;
+        std::vector<Base::Vector3d> poles = {
+            {x + 1.0, 0.0, 0.0},
+            {x + 1.0, 1.0, 0.0},
+            {x + 1.0, 0.5, 0.0},
+            {x, 1.0, 0.0},
+            {x, 0.0, 0.0},
+        };
+        geos.push_back(std::make_unique<Part::GeomBSplineCurve>(
+            poles,
+            weights,
+            knots,
+            multiplicities,
+            degree,
+            false
+        ));
+    }
+}
+
+struct Corpus
+{
+    std::string name;
+    std::function<void(Geometries&, Constraints&)> make;
+    bool exposeBSplines;
+};
+
+std::vector<Corpus> corpus()
+{
+    using namespace std::placeholders;
+    return {
+        {"rectangles-10", std::bind(makeRectangles, 10, _1, _2), false},
+        {"rectangles-100", std::bind(makeRectangles, 100, _1, _2), false},
+        {"rectangles-1000", std::bind(makeRectangles, 1000, _1, _2), false},
+        {"dxf-polylines-50", std::bind(makePolylines, 50, _1, _2), false},
+        {"dxf-polylines-500", std::bind(makePolylines, 500, _1, _2), false},
+        {"bsplines-10", std::bind(makeBSplines, 10, _1, _2), true},
+        {"bsplines-100", std::bind(makeBSplines, 100, _1, _2), true},
+    };
+}
+
+const char* algorithmName(GCS::Algorithm alg)
+{
+    switch (alg) {
+        case GCS::BFGS:
+            return "BFGS";
+        case GCS::LevenbergMarquardt:
+            return "LM";
+        case GCS::DogLeg:
+            return "DogLeg";
+    }
+    return "?";
+}
+
+}  // namespace
+
+class SketcherBenchmark: public SketchObjectTest
+{
+protected:
+    Sketcher::SketchObject* makeSketch(const Corpus& entry)
+    {
+        auto sketch = static_cast<Sketcher::SketchObject*>(
+            getObject()->getDocument()->addObject("Sketcher::SketchObject", entry.name.c_str())
+        );
+        Geometries geos;
+        Constraints constrs;
+        entry.make(geos, constrs);
+        std::vector<Part::Geometry*> geoList;
+        for (const auto& geo : geos) {
+            geoList.push_back(geo.get());
+        }
+        sketch->addGeometry(geoList);
+        if (entry.exposeBSplines) {
+            for (int geoId = 0; geoId < int(geos.size()); geoId++) {
+                sketch->exposeInternalGeometry(geoId);
+            }
+        }
+        std::vector<Sketcher::Constraint*> constrList;
+        for (const auto& constr : constrs) {
+            constrList.push_back(constr.get());
+        }
+        sketch->addConstraints(constrList);
+        return sketch;
+    }
+
+    void run(const Corpus& entry, GCS::Algorithm alg, GCS::QRAlgorithm qr)
+    {
+        Sketcher::SketchObject* sketch = makeSketch(entry);
+        // same as the advanced solver settings of the task panel
+        auto& solver = const_cast<Sketcher::Sketch&>(sketch->getSolvedSketch());
+        solver.defaultSolver = alg;
+        solver.setSketchAutoAlgo(false);
+        solver.setQRAlgorithm(qr);
+        solver.setDebugMode(GCS::NoDebug);
+
+        Base::TimeElapsed setupStart;
+        int dofs = sketch->setUpSketch();
+        Base::TimeElapsed solveStart;
+        int solveError = sketch->solve();
+        Base::TimeElapsed dragStart;
+
+        int dragFailures = 0;
+        constexpr int dragSteps = 20;
+        Base::Vector3d startPoint = sketch->getPoint(0, Sketcher::PointPos::start);
+        sketch->initTemporaryMove(0, Sketcher::PointPos::start);
+        for (int step = 1; step <= dragSteps; step++) {
+            Base::Vector3d toPoint = startPoint + Base::Vector3d(0.05 * step, 0.02 * step, 0.0);
+            if (sketch->moveGeometryTemporary(0, Sketcher::PointPos::start, toPoint) != 0) {
+                dragFailures++;
+            }
+        }
+        Base::TimeElapsed dragEnd;
+
+        const char* qrName = qr == GCS::EigenDenseQR ? "dense" : "sparse";
+        std::cout << std::left << std::setw(20) << entry.name << std::setw(8) << algorithmName(alg)
+                  << std::setw(8) << qrName << std::right;
+        std::cout << " geos " << std::setw(6) << sketch->getHighestCurveIndex() + 1;
+        std::cout << " constraints " << std::setw(6) << sketch->Constraints.getSize();
+        std::cout << " dofs " << std::setw(6) << dofs << std::fixed << std::setprecision(4);
+        std::cout << " setup " << Base::TimeElapsed::diffTimeF(setupStart, solveStart) << "s";
+        std::cout << " solve " << Base::TimeElapsed::diffTimeF(solveStart, dragStart) << "s";
+        std::cout << " (solver " << sketch->getLastSolveTime() << "s)";
+        std::cout << " drag " << Base::TimeElapsed::diffTimeF(dragStart, dragEnd) << "s";
+        std::cout << " status " << sketch->getLastSolverStatus() << " error " << solveError;
+        std::cout << " drag failures " << dragFailures << "/" << dragSteps << std::endl;
+
+        getObject()->getDocument()->removeObject(sketch->getNameInDocument());
+    }
+};
+
+TEST_F(SketcherBenchmark, solveCorpus)  // NOLINT
+{
+    for (const auto& entry : corpus()) {
+        for (auto alg : {GCS::BFGS, GCS::LevenbergMarquardt, GCS::DogLeg}) {
+            for (auto qr : {GCS::EigenDenseQR, GCS::EigenSparseQR}) {
+                run(entry, alg, qr);
+            }
+        }
+    }
+}
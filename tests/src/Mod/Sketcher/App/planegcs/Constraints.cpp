@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
 #include <cmath>
+#include <memory>
 #include <numbers>
 
 #include <gtest/gtest.h>
@@ -178,3 +179,139 @@ TEST_F(ConstraintsTest, tangentBSplineAndArc)  // NOLINT
         0.005
     );
 }
+
+TEST_F(ConstraintsTest, gradsMatchGrad)  // NOLINT
+{
+    // Arrange
+    std::vector<double> values {0.5, 1.0, 3.0, -2.0, 4.0, 1.5, -1.0, 2.5, 2.0};
+    GCS::Point p1, p2, p3, p4;
+    p1.x = &values[0];
+    p1.y = &values[1];
+    p2.x = &values[2];
+    p2.y = &values[3];
+    p3.x = &values[4];
+    p3.y = &values[5];
+    p4.x = &values[6];
+    p4.y = &values[7];
+    double* distance = &values[8];
+    GCS::Line l1, l2;
+    l1.p1 = p1;
+    l1.p2 = p2;
+    l2.p1 = p3;
+    l2.p2 = p4;
+    std::vector<std::unique_ptr<GCS::Constraint>> constraints;
+    constraints.push_back(std::make_unique<GCS::ConstraintEqual>(p1.x, p2.y));
+    constraints.push_back(std::make_unique<GCS::ConstraintDifference>(p1.x, p2.x, distance));
+    constraints.push_back(std::make_unique<GCS::ConstraintP2PDistance>(p1, p3, distance));
+    constraints.push_back(std::make_unique<GCS::ConstraintPointOnLine>(p3, l1));
+    constraints.push_back(std::make_unique<GCS::ConstraintParallel>(l1, l2));
+    constraints.push_back(std::make_unique<GCS::ConstraintPerpendicular>(l1, l2));
+    // a constraint sharing a parameter between two of its entries
+    constraints.push_back(std::make_unique<GCS::ConstraintPerpendicular>(p1, p2, p2, p3));
+    // uses the default implementation of grads()
+    constraints.push_back(std::make_unique<GCS::ConstraintP2PAngle>(p1, p4, distance));
+
+    for (auto& constraint : constraints) {
+        // Act
+        std::vector<double> derivs;
+        constraint->grads(derivs);
+
+        // Assert
+        std::vector<double*> params = constraint->params();
+        ASSERT_EQ(derivs.size(), params.size());
+        for (double* param : params) {
+            double sum = 0.0;
+            for (size_t i = 0; i < params.size(); ++i) {
+                if (params[i] == param) {
+                    sum += derivs[i];
+                }
+            }
+            EXPECT_NEAR(sum, constraint->grad(param), 1e-12);
+        }
+    }
+}
+
+TEST_F(ConstraintsTest, pointOnBSplineDerivatives)  // NOLINT
+{
+    // Arrange
+    // a rational cubic B-spline with an inner knot
+    std::vector<double> polesX {0.0, 1.0, 3.0, 6.0, 7.0};
+    std::vector<double> polesY {0.0, 2.0, 3.0, 1.0, -1.0};
+    std::vector<double> weights {1.0, 0.8, 1.5, 1.2, 1.0};
+    std::vector<double> knots {0.0, 1.0, 2.0};
+    GCS::BSpline bspline;
+    for (size_t i = 0; i < polesX.size(); ++i) {
+        GCS::Point pole;
+        pole.x = &polesX[i];
+        pole.y = &polesY[i];
+        bspline.poles.push_back(pole);
+        bspline.weights.push_back(&weights[i]);
+    }
+    for (auto& knot : knots) {
+        bspline.knots.push_back(&knot);
+    }
+    bspline.mult = {4, 1, 4};
+    bspline.degree = 3;
+    bspline.periodic = false;
+    double pointX = 2.0;
+    double param = 1.3;
+    GCS::ConstraintPointOnBSpline constraint(&pointX, &param, 0, bspline);
+
+    // Act
+    std::vector<double> derivs;
+    constraint.grads(derivs);
+
+    // Assert
+    std::vector<double*> params = constraint.params();
+    ASSERT_EQ(derivs.size(), params.size());
+    const double step = 1e-7;
+    for (size_t i = 0; i < params.size(); ++i) {
+        EXPECT_NEAR(derivs[i], constraint.grad(params[i]), 1e-12);
+
+        double value = *params[i];
+        *params[i] = value + step;
+        double errorAfter = constraint.error();
+        *params[i] = value - step;
+        double errorBefore = constraint.error();
+        *params[i] = value;
+        EXPECT_NEAR(derivs[i], (errorAfter - errorBefore) / (2 * step), 1e-6);
+    }
+}
+
+TEST_F(ConstraintsTest, bSplineLinCombFactors)  // NOLINT
+{
+    // Arrange
+    std::vector<double> knots {0.0, 0.5, 2.0, 3.0};
+    GCS::BSpline bspline;
+    for (auto& knot : knots) {
+        bspline.knots.push_back(&knot);
+    }
+    bspline.mult = {4, 1, 2, 4};
+    bspline.degree = 3;
+    bspline.setupFlattenedKnots();
+
+    for (double x : {0.0, 0.3, 0.5, 1.7, 2.4, 3.0}) {
+        size_t k = 3;
+        while (k + 1 < bspline.flattenedknots.size() - 4 && bspline.flattenedknots[k + 1] <= x) {
+            ++k;
+        }
+        for (unsigned int p : {3U, 2U}) {
+            // Act
+            std::vector<double> factors;
+            bspline.getLinCombFactors(x, k, p, factors);
+
+            // Assert
+            ASSERT_EQ(factors.size(), p + 1);
+            double sum = 0.0;
+            for (unsigned int j = 0; j <= p; ++j) {
+                // the de Boor algorithm on the j-th control point alone
+                std::vector<double> d(p + 1, 0.0);
+                d[j] = 1.0;
+                double factor = GCS::BSpline::splineValue(x, k, p, d, bspline.flattenedknots);
+                EXPECT_NEAR(factors[j], factor, 1e-14);
+                sum += factors[j];
+            }
+            EXPECT_NEAR(sum, 1.0, 1e-14);
+        }
+    }
+}
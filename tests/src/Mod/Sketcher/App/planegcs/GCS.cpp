@@ -1,8 +1,12 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
+#include <algorithm>
+#include <cmath>
+
 #include <gtest/gtest.h>
 
 #include "Mod/Sketcher/App/planegcs/GCS.h"
+#include "Mod/Sketcher/App/planegcs/Geo.h"
 
 class SystemTest: public GCS::System
 {
@@ -50,3 +54,212 @@ TEST_F(GCSTest, clearConstraints)  // NOLINT
     // Assert
     EXPECT_EQ(0, System()->getNumberOfConstraints());
 }
+
+namespace
+{
+// Solve a chain of point to point distances with the sparse solver path and
+// return the largest error of the distances
+double solveDistanceChain(SystemTest* system, GCS::Algorithm alg, int& solveResult)
+{
+    const size_t numPoints {40};
+    std::vector<double> coords(2 * numPoints);
+    std::vector<GCS::Point> points(numPoints);
+    std::vector<double*> params;
+    for (size_t i = 0; i < numPoints; ++i) {
+        coords[2 * i] = 1.5 * static_cast<double>(i);
+        coords[2 * i + 1] = 0.1 * static_cast<double>(i % 3);
+        points[i].x = &coords[2 * i];
+        points[i].y = &coords[2 * i + 1];
+        params.push_back(points[i].x);
+        params.push_back(points[i].y);
+    }
+    double distance = 1.0;
+    for (size_t i = 1; i < numPoints; ++i) {
+        system->addConstraintP2PDistance(points[i - 1], points[i], &distance);
+    }
+    // Force the sparse path even for this small system
+    system->sparseSolverThreshold = 1;
+
+    solveResult = system->solve(params, true, alg);
+    if (solveResult == GCS::Success) {
+        system->applySolution();
+    }
+
+    double maxError = 0.0;
+    for (size_t i = 1; i < numPoints; ++i) {
+        double dx = coords[2 * i] - coords[2 * i - 2];
+        double dy = coords[2 * i + 1] - coords[2 * i - 1];
+        maxError = std::max(maxError, std::fabs(std::sqrt(dx * dx + dy * dy) - distance));
+    }
+    return maxError;
+}
+}  // namespace
+
+TEST_F(GCSTest, sparseDogLegSolvesDistanceChain)  // NOLINT
+{
+    // Arrange
+    int solveResult = GCS::Failed;
+
+    // Act
+    double maxError = solveDistanceChain(System(), GCS::DogLeg, solveResult);
+
+    // Assert
+    EXPECT_EQ(solveResult, GCS::Success);
+    EXPECT_LT(maxError, 1e-7);
+}
+
+TEST_F(GCSTest, sparseLevenbergMarquardtSolvesDistanceChain)  // NOLINT
+{
+    // Arrange
+    int solveResult = GCS::Failed;
+
+    // Act
+    double maxError = solveDistanceChain(System(), GCS::LevenbergMarquardt, solveResult);
+
+    // Assert
+    EXPECT_EQ(solveResult, GCS::Success);
+    EXPECT_LT(maxError, 1e-7);
+}
+
+TEST_F(GCSTest, resolveOnlyChangedComponents)  // NOLINT
+{
+    // Arrange: two independent islands, each pulled to a target that is not an unknown
+    std::vector<double> unknowns {0.0, 0.0, 1.0, 0.5, 5.0, 5.0, 6.0, 5.5};
+    std::vector<double> targets {0.5, 0.5, 4.0, 6.0};
+    GCS::Point a0, a1, b0, b1, targetA, targetB;
+    a0.x = &unknowns[0];
+    a0.y = &unknowns[1];
+    a1.x = &unknowns[2];
+    a1.y = &unknowns[3];
+    b0.x = &unknowns[4];
+    b0.y = &unknowns[5];
+    b1.x = &unknowns[6];
+    b1.y = &unknowns[7];
+    targetA.x = &targets[0];
+    targetA.y = &targets[1];
+    targetB.x = &targets[2];
+    targetB.y = &targets[3];
+    double distanceA = 1.0, distanceB = 2.0;
+    System()->addConstraintP2PDistance(a0, a1, &distanceA);
+    System()->addConstraintP2PDistance(b0, b1, &distanceB);
+    System()->addConstraintP2PCoincident(a0, targetA, -1);
+    System()->addConstraintP2PCoincident(b0, targetB, -1);
+    std::vector<double*> params;
+    for (auto& value : unknowns) {
+        params.push_back(&value);
+    }
+    System()->declareUnknowns(params);
+    System()->initSolution();
+    ASSERT_EQ(System()->solve(true, GCS::DogLeg), GCS::Success);
+    System()->applySolution();
+
+    auto distance = [](const GCS::Point& p, const GCS::Point& q) {
+        return std::hypot(*p.x - *q.x, *p.y - *q.y);
+    };
+
+    // Act: move only the target of the first island, then only the second one
+    targets[0] = 1.5;
+    int firstResult = System()->solve(true, GCS::DogLeg);
+    System()->applySolution();
+    std::vector<double> afterFirst = unknowns;
+    targets[3] = 7.0;
+    int secondResult = System()->solve(true, GCS::DogLeg);
+    System()->applySolution();
+
+    // Assert
+    EXPECT_EQ(firstResult, GCS::Success);
+    EXPECT_EQ(secondResult, GCS::Success);
+    EXPECT_NEAR(afterFirst[0], 1.5, 1e-7);
+    EXPECT_NEAR(afterFirst[1], 0.5, 1e-7);
+    EXPECT_NEAR(distance(a0, a1), distanceA, 1e-7);
+    EXPECT_NEAR(*b0.x, 4.0, 1e-7);
+    EXPECT_NEAR(*b0.y, 7.0, 1e-7);
+    EXPECT_NEAR(distance(b0, b1), distanceB, 1e-7);
+    // the first island was not affected by the second move
+    for (size_t i = 0; i < 4; ++i) {
+        EXPECT_DOUBLE_EQ(unknowns[i], afterFirst[i]);
+    }
+}
+
+TEST_F(GCSTest, diagnoseRebuiltSystem)  // NOLINT
+{
+    // Arrange: a point fixed twice in x, the second time with the given value
+    auto diagnose = [this](double secondX, GCS::VEC_I& conflicting, GCS::VEC_I& redundant) {
+        std::vector<double> values {1.0, 2.0};
+        double firstX = 1.0;
+        GCS::Point point;
+        point.x = &values[0];
+        point.y = &values[1];
+        System()->clear();
+        System()->addConstraintCoordinateX(point, &firstX, 1);
+        System()->addConstraintCoordinateX(point, &secondX, 2);
+        std::vector<double*> params {point.x, point.y};
+        System()->declareUnknowns(params);
+        System()->initSolution();
+        System()->getConflicting(conflicting);
+        System()->getRedundant(redundant);
+        return System()->dofsNumber();
+    };
+    GCS::VEC_I conflicting, redundant;
+
+    // Act & Assert: the same system rebuilt in new memory gives the same diagnosis
+    for (int i = 0; i < 2; i++) {
+        EXPECT_EQ(diagnose(1.0, conflicting, redundant), 1);
+        EXPECT_TRUE(conflicting.empty());
+        EXPECT_EQ(redundant, GCS::VEC_I {2});
+    }
+    // a changed value is diagnosed again
+    EXPECT_EQ(diagnose(3.0, conflicting, redundant), 1);
+    EXPECT_EQ(conflicting, (GCS::VEC_I {1, 2}));
+    EXPECT_TRUE(redundant.empty());
+}
+
+TEST_F(GCSTest, parallelSolveOfIndependentComponents)  // NOLINT
+{
+    // Arrange: many islands, each a segment of a different length anchored at its own target
+    constexpr int islands = 32;
+    std::vector<double> unknowns(4 * islands);
+    std::vector<double> targets(2 * islands);
+    std::vector<double> lengths(islands);
+    std::vector<GCS::Point> starts(islands), ends(islands), anchors(islands);
+    for (int i = 0; i < islands; i++) {
+        unknowns[4 * i] = i;
+        unknowns[4 * i + 1] = 0.0;
+        unknowns[4 * i + 2] = i + 0.3;
+        unknowns[4 * i + 3] = 0.4;
+        targets[2 * i] = i + 0.1;
+        targets[2 * i + 1] = -0.2;
+        lengths[i] = 1.0 + 0.1 * i;
+        starts[i].x = &unknowns[4 * i];
+        starts[i].y = &unknowns[4 * i + 1];
+        ends[i].x = &unknowns[4 * i + 2];
+        ends[i].y = &unknowns[4 * i + 3];
+        anchors[i].x = &targets[2 * i];
+        anchors[i].y = &targets[2 * i + 1];
+        System()->addConstraintP2PDistance(starts[i], ends[i], &lengths[i]);
+        System()->addConstraintP2PCoincident(starts[i], anchors[i], -1);
+    }
+    std::vector<double*> params;
+    for (auto& value : unknowns) {
+        params.push_back(&value);
+    }
+    System()->parallelSolverThreshold = 2;
+    System()->declareUnknowns(params);
+    System()->initSolution();
+
+    // Act
+    int solveResult = System()->solve(true, GCS::DogLeg);
+    System()->applySolution();
+
+    // Assert
+    EXPECT_EQ(solveResult, GCS::Success);
+    for (int i = 0; i < islands; i++) {
+        EXPECT_NEAR(*starts[i].x, targets[2 * i], 1e-7);
+        EXPECT_NEAR(*starts[i].y, targets[2 * i + 1], 1e-7);
+        EXPECT_NEAR(
+            std::hypot(*ends[i].x - *starts[i].x, *ends[i].y - *starts[i].y),
+            lengths[i],
+            1e-7
+        );
+    }
+}
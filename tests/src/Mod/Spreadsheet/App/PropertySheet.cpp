@@ -86,3 +86,14 @@ TEST_F(PropertySheetTest, invalidAliases)  // NOLINT
             << "\"" << name << "\" was accepted as an alias name, and should not be";
     }
 }
+
+TEST_F(PropertySheetTest, nonEmptyCells)  // NOLINT
+{
+    propertySheet()->setContent(App::CellAddress("A1"), "1");
+    propertySheet()->setContent(App::CellAddress("B2"), "'text");
+    propertySheet()->setStyle(App::CellAddress("C3"), {"bold"});
+
+    std::vector<App::CellAddress> expected {App::CellAddress("A1"), App::CellAddress("B2")};
+    EXPECT_EQ(propertySheet()->getNonEmptyCells(), expected);
+    EXPECT_EQ(propertySheet()->getUsedCells().size(), 3);
+}
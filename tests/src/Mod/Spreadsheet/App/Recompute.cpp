@@ -0,0 +1,219 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include "src/App/InitApplication.h"
+
+#include <thread>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/PropertyStandard.h>
+#include <Mod/Spreadsheet/App/Sheet.h>
+
+class SheetRecomputeTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+        _sheet = freecad_cast<Spreadsheet::Sheet*>(_doc->addObject("Spreadsheet::Sheet", "Sheet"));
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    App::Document* doc()
+    {
+        return _doc;
+    }
+
+    Spreadsheet::Sheet* sheet()
+    {
+        return _sheet;
+    }
+
+    long intValue(const char* name)
+    {
+        auto prop = freecad_cast<App::PropertyInteger*>(_sheet->getPropertyByName(name));
+        EXPECT_NE(prop, nullptr) << name;
+        return prop ? prop->getValue() : 0;
+    }
+
+    double floatValue(const char* name)
+    {
+        auto prop = freecad_cast<App::PropertyFloat*>(_sheet->getPropertyByName(name));
+        EXPECT_NE(prop, nullptr) << name;
+        return prop ? prop->getValue() : 0.0;
+    }
+
+private:
+    std::string _docName;
+    App::Document* _doc {};
+    Spreadsheet::Sheet* _sheet {};
+};
+
+TEST_F(SheetRecomputeTest, unchangedValueStopsPropagation)  // NOLINT
+{
+    sheet()->setCell("A1", "1");
+    sheet()->setCell("B1", "=A1 * 0");
+    sheet()->setCell("C1", "=B1 + 1");
+    doc()->recompute();
+    EXPECT_EQ(intValue("C1"), 1);
+
+    int changes = 0;
+    auto c1 = sheet()->getPropertyByName("C1");
+    fastsignals::scoped_connection conn = sheet()->signalChanged.connect(
+        [&](const App::DocumentObject&, const App::Property& prop) {
+            if (&prop == c1) {
+                ++changes;
+            }
+        }
+    );
+
+    // B1 keeps its value, so C1 is neither recomputed nor touched
+    sheet()->setCell("A1", "2");
+    doc()->recompute();
+    EXPECT_EQ(intValue("B1"), 0);
+    EXPECT_EQ(intValue("C1"), 1);
+    EXPECT_EQ(changes, 0);
+
+    // a changed value is propagated to all dependent cells
+    sheet()->setCell("B1", "=A1 * 2");
+    doc()->recompute();
+    EXPECT_EQ(intValue("B1"), 4);
+    EXPECT_EQ(intValue("C1"), 5);
+    EXPECT_EQ(changes, 1);
+}
+
+TEST_F(SheetRecomputeTest, parallelRecompute)  // NOLINT
+{
+    ParameterGrp::handle group = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Spreadsheet"
+    );
+    group->SetBool("ParallelRecompute", true);
+
+    // enough independent cells for a parallel evaluation, and one chain
+    constexpr int rows = 64;
+    sheet()->setCell("A1", "2");
+    for (int row = 1; row <= rows; ++row) {
+        std::string expr = "=A1 * " + std::to_string(row);
+        sheet()->setCell(("B" + std::to_string(row)).c_str(), expr.c_str());
+    }
+    sheet()->setCell("C1", "=B64 + B1");
+    doc()->recompute();
+
+    EXPECT_EQ(intValue("B1"), 2);
+    EXPECT_EQ(intValue("B64"), 128);
+    EXPECT_EQ(intValue("C1"), 130);
+
+    sheet()->setCell("A1", "3");
+    doc()->recompute();
+    EXPECT_EQ(intValue("B32"), 96);
+    EXPECT_EQ(intValue("C1"), 195);
+
+    group->RemoveBool("ParallelRecompute");
+}
+
+TEST_F(SheetRecomputeTest, documentParallelRecompute)  // NOLINT
+{
+    // Arrange
+    ParameterGrp::handle group = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document"
+    );
+    group->SetBool("ParallelRecompute", true);
+    auto other =
+        freecad_cast<Spreadsheet::Sheet*>(doc()->addObject("Spreadsheet::Sheet", "Sheet2"));
+    sheet()->setCell("A1", "2");
+    sheet()->setCell("B1", "=A1 * 3");
+    other->setCell("A1", "=5 + 1");
+    other->setCell("A2", "=A1 * 2");
+
+    // The sheets add and remove their cell properties in execute(), whose
+    // signals must not be fired on a worker thread
+    auto mainThread = std::this_thread::get_id();
+    int offThread = 0;
+    auto check = [&](const App::Property&) {
+        if (std::this_thread::get_id() != mainThread) {
+            ++offThread;
+        }
+    };
+    fastsignals::scoped_connection appendConn =
+        App::GetApplication().signalAppendDynamicProperty.connect(check);
+    fastsignals::scoped_connection removeConn =
+        App::GetApplication().signalRemoveDynamicProperty.connect(check);
+
+    // Act
+    doc()->recompute();
+    other->setCell("A1", "7.5");
+    doc()->recompute();
+    group->RemoveBool("ParallelRecompute");
+
+    // Assert
+    EXPECT_FALSE(sheet()->canRecomputeConcurrently());
+    EXPECT_EQ(offThread, 0);
+    EXPECT_EQ(intValue("B1"), 6);
+    auto a2 = freecad_cast<App::PropertyFloat*>(other->getPropertyByName("A2"));
+    ASSERT_NE(a2, nullptr);
+    EXPECT_DOUBLE_EQ(a2->getValue(), 15.0);
+}
+
+TEST_F(SheetRecomputeTest, setCellsUpdatesViewOnce)  // NOLINT
+{
+    std::vector<std::vector<std::string>> contents {
+        {"1", "=A1 + 1", "text"},
+        {"2", "", "=B1 * A2"},
+    };
+    sheet()->setCells(App::CellAddress(0, 0), contents);
+    EXPECT_EQ(sheet()->getCellContents(App::Range("A1:C2")), contents);
+
+    int cellUpdates = 0;
+    std::vector<App::Range> rangeUpdates;
+    fastsignals::scoped_connection cellConn = sheet()->cellUpdated.connect(
+        [&](App::CellAddress) { ++cellUpdates; }
+    );
+    fastsignals::scoped_connection rangeConn = sheet()->rangeUpdated.connect(
+        [&](App::Range range) { rangeUpdates.push_back(range); }
+    );
+    doc()->recompute();
+
+    EXPECT_EQ(intValue("B1"), 2);
+    EXPECT_EQ(intValue("C2"), 4);
+    EXPECT_EQ(cellUpdates, 0);
+    ASSERT_EQ(rangeUpdates.size(), 1);
+    EXPECT_EQ(rangeUpdates.front().rangeString(), "A1:C2");
+}
+
+TEST_F(SheetRecomputeTest, rangeAggregateFollowsChanges)  // NOLINT
+{
+    sheet()->setCell("A1", "1");
+    sheet()->setCell("A2", "2");
+    sheet()->setCell("A3", "3");
+    sheet()->setCell("B1", "=sum(A1:A3)");
+    sheet()->setCell("B2", "=B1 + sum(A1:A3)");
+    doc()->recompute();
+    EXPECT_EQ(intValue("B2"), 12);
+
+    // changed value
+    sheet()->setCell("A2", "4");
+    doc()->recompute();
+    EXPECT_EQ(intValue("B1"), 8);
+
+    // the cell property is replaced by one of another type
+    sheet()->setCell("A3", "2.5");
+    doc()->recompute();
+    EXPECT_DOUBLE_EQ(floatValue("B1"), 7.5);
+
+    // the cell property is removed
+    sheet()->setCell("A1", "");
+    doc()->recompute();
+    EXPECT_DOUBLE_EQ(floatValue("B1"), 6.5);
+    EXPECT_DOUBLE_EQ(floatValue("B2"), 13.0);
+}